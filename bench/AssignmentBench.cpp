@@ -0,0 +1,133 @@
+#include <chrono>
+#include <random>
+#include <vector>
+#include <cstdlib>
+#include <algorithm>
+#include <iostream>
+
+#include "math/AssignmentSolver.hpp"
+#include "math/HungarianMethod.hpp"
+
+using namespace llvm;
+using namespace bphls;
+
+/**
+ * Functional unit binding benchmark: batches of weighted bipartite matching
+ * problems, shaped like the ones of a state, are solved by the assignment
+ * solver and by libhungarian. Forbidden entries are given to libhungarian
+ * as a large cost, the optimal costs of both must match.
+ *
+ * Usage: assignment-bench [max size] [solves per size]
+ */
+
+static const int FORBIDDEN_COST = 1 << 20;
+
+/* Binding weights are mux inputs plus register sharing bonuses */
+static void generateWeights(unsigned int n_share,
+                            unsigned int n_available,
+                            double density,
+                            std::mt19937& rng,
+                            std::vector<int>& weights)
+{
+    std::uniform_int_distribution<int> weight_dist(-5, 40);
+    std::bernoulli_distribution allowed_dist(density);
+
+    weights.resize(n_share * n_available);
+
+    for (unsigned int row = 0; row < n_share; row++) {
+        /* Every row may take its own column, a solution always exists */
+        for (unsigned int col = 0; col < n_available; col++) {
+            bool is_allowed = (col == row) || allowed_dist(rng);
+
+            weights[row * n_available + col] =
+                is_allowed ? weight_dist(rng) : math::AssignmentSolver<int>::FORBIDDEN;
+        }
+    }
+}
+
+static int solveHungarian(std::vector<int>& weights, unsigned int n_share, unsigned int n_available) {
+    hungarian_problem_t hungarian_solver;
+
+    /* Same copy into square malloc'd rows as the former binding */
+    int** matrix = new int*[n_available];
+    for (unsigned int i = 0; i < n_available; i++) {
+        matrix[i] = new int[n_available];
+        for (unsigned int j = 0; j < n_available; j++) {
+            int weight = (i < n_share) ? weights[i * n_available + j] : 0;
+            matrix[i][j] = (weight == math::AssignmentSolver<int>::FORBIDDEN) ? FORBIDDEN_COST : weight;
+        }
+    }
+
+    hungarian_init(&hungarian_solver, matrix, n_available, n_available, HUNGARIAN_MODE_MINIMIZE_COST);
+    hungarian_solve(&hungarian_solver);
+
+    int cost = 0;
+    for (unsigned int i = 0; i < n_share; i++) {
+        for (unsigned int j = 0; j < n_available; j++) {
+            if (hungarian_solver.assignment[i][j] != 0) {
+                cost += weights[i * n_available + j];
+            }
+        }
+    }
+
+    hungarian_free(&hungarian_solver);
+
+    for (unsigned int i = 0; i < n_available; i++) {
+        delete[] matrix[i];
+    }
+    delete[] matrix;
+
+    return cost;
+}
+
+int main(int argc, char const *argv[]) {
+    unsigned int max_size = (argc > 1) ? std::atoi(argv[1]) : 256;
+    unsigned int n_solves = (argc > 2) ? std::atoi(argv[2]) : 2000;
+
+    std::mt19937 rng(42);
+
+    std::cout << "size,density,solves,solver_us,hungarian_us,speedup,costs_match" << std::endl;
+
+    for (unsigned int size = 2; size <= max_size; size *= 2) {
+        for (double density : {1.0, 0.25}) {
+            /* Keep total work roughly constant across sizes */
+            unsigned int n_size_solves = std::max(10U, n_solves * 4 / (size * size / 4 + 1));
+
+            std::vector<std::vector<int>> problems(n_size_solves);
+            for (auto& weights : problems) {
+                generateWeights(size / 2 + 1, size, density, rng, weights);
+            }
+
+            unsigned int n_share = size / 2 + 1;
+            math::AssignmentSolver<int> solver;
+
+            std::vector<int> solver_costs(n_size_solves);
+            std::vector<int> hungarian_costs(n_size_solves);
+
+            auto start = std::chrono::steady_clock::now();
+            for (unsigned int i = 0; i < n_size_solves; i++) {
+                solver.solve(problems[i].data(), n_share, size);
+                solver_costs[i] = solver.getCost();
+            }
+            auto middle = std::chrono::steady_clock::now();
+            for (unsigned int i = 0; i < n_size_solves; i++) {
+                hungarian_costs[i] = solveHungarian(problems[i], n_share, size);
+            }
+            auto end = std::chrono::steady_clock::now();
+
+            double solver_us =
+                std::chrono::duration<double, std::micro>(middle - start).count() / n_size_solves;
+            double hungarian_us =
+                std::chrono::duration<double, std::micro>(end - middle).count() / n_size_solves;
+
+            bool costs_match = (solver_costs == hungarian_costs);
+
+            std::cout << size << "," << density << "," << n_size_solves << ","
+                      << solver_us << "," << hungarian_us << ","
+                      << (hungarian_us / solver_us) << ","
+                      << (costs_match ? "yes" : "no") << std::endl;
+        }
+    }
+
+    return 0;
+}
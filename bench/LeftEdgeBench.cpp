@@ -0,0 +1,147 @@
+#include <chrono>
+#include <random>
+#include <vector>
+#include <cstdlib>
+#include <algorithm>
+#include <iostream>
+
+#include "binding/IntervalAllocator.hpp"
+
+using namespace llvm;
+using namespace bphls;
+
+/**
+ * Bit-packing register allocation benchmark: lifetime chunks of synthetic
+ * values are allocated by the sweep-line allocator and by the former
+ * quadratic left-edge loop, the latter only up to QUADRATIC_LIMIT chunks.
+ *
+ * Usage: left-edge-bench [max chunks]
+ */
+
+static const unsigned int N_STAGES = 1024;
+static const unsigned int QUADRATIC_LIMIT = 25000;
+
+struct Chunk {
+    unsigned int def;
+    unsigned int use;
+};
+
+static std::vector<Chunk> generateChunks(unsigned int n_chunks, std::mt19937& rng) {
+    std::uniform_int_distribution<unsigned int> def_dist(0, N_STAGES - 1);
+    std::uniform_int_distribution<unsigned int> length_dist(1, 16);
+    std::uniform_int_distribution<unsigned int> width_dist(1, 32);
+
+    std::vector<Chunk> chunks;
+    chunks.reserve(n_chunks);
+
+    /* Chunks of a value share its lifetime */
+    while (chunks.size() < n_chunks) {
+        unsigned int def = def_dist(rng);
+        unsigned int use = def + length_dist(rng);
+
+        for (unsigned int i = width_dist(rng); (i > 0) && (chunks.size() < n_chunks); i--) {
+            chunks.push_back({def, use});
+        }
+    }
+
+    return chunks;
+}
+
+static unsigned int quadraticLeftEdge(std::vector<Chunk>& chunks) {
+    std::vector<unsigned int> order(chunks.size());
+
+    for (unsigned int i = 0; i < order.size(); i++) {
+        order[i] = i;
+    }
+
+    std::stable_sort(
+        order.begin(),
+        order.end(),
+        [&chunks](unsigned int a, unsigned int b) { return chunks[a].def < chunks[b].def; }
+    );
+
+    std::vector<bool> is_bound(chunks.size(), false);
+    unsigned int n_tracks = 0;
+
+    for (unsigned int i = 0; i < order.size(); i++) {
+        if (is_bound[order[i]]) {
+            continue;
+        }
+
+        is_bound[order[i]] = true;
+        unsigned int last_use_edge = chunks[order[i]].use;
+
+        for (unsigned int j = i + 1; j < order.size(); j++) {
+            auto& chunk = chunks[order[j]];
+
+            if (!is_bound[order[j]] && (chunk.def >= last_use_edge)) {
+                is_bound[order[j]] = true;
+                last_use_edge = chunk.use;
+            }
+        }
+
+        n_tracks++;
+    }
+
+    return n_tracks;
+}
+
+template <typename F>
+static double measureMs(F func) {
+    auto start = std::chrono::steady_clock::now();
+    func();
+    auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+int main(int argc, char const *argv[]) {
+    unsigned int max_chunks = (argc > 1) ? std::atoi(argv[1]) : 100000;
+
+    std::mt19937 rng(42);
+
+    std::cout << "chunks,tracks,sweep_ms,quadratic_tracks,quadratic_ms" << std::endl;
+
+    for (unsigned int n_chunks = 1000; n_chunks <= max_chunks; n_chunks *= 10) {
+        for (unsigned int step : {1, 2, 5}) {
+            unsigned int n = n_chunks * step;
+
+            if (n > max_chunks) {
+                break;
+            }
+
+            auto chunks = generateChunks(n, rng);
+
+            binding::IntervalAllocator allocator;
+            unsigned int n_tracks = 0;
+
+            double sweep_ms = measureMs([&]() {
+                allocator.reserve(chunks.size());
+
+                for (auto& chunk : chunks) {
+                    allocator.addInterval(chunk.def, chunk.use);
+                }
+
+                n_tracks = allocator.allocate();
+            });
+
+            std::cout << n << "," << n_tracks << "," << sweep_ms;
+
+            if (n <= QUADRATIC_LIMIT) {
+                unsigned int n_quadratic_tracks = 0;
+
+                double quadratic_ms = measureMs([&]() {
+                    n_quadratic_tracks = quadraticLeftEdge(chunks);
+                });
+
+                std::cout << "," << n_quadratic_tracks << "," << quadratic_ms;
+            } else {
+                std::cout << ",,";
+            }
+
+            std::cout << std::endl;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,758 @@
+#include <chrono>
+#include <random>
+#include <vector>
+#include <string>
+#include <map>
+#include <algorithm>
+#include <iterator>
+
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include <llvm/IR/Function.h>
+#include <llvm/IR/BasicBlock.h>
+#include <llvm/IR/IRBuilder.h>
+#include <llvm/IR/Verifier.h>
+#include <llvm/Support/CommandLine.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/JSON.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/Program.h>
+#include <llvm/Support/raw_ostream.h>
+
+using namespace llvm;
+
+/**
+ * Compiler scalability benchmark. Synthetic kernels of growing size are
+ * generated as LLVM IR and synthesized by bitpack-hls in a child process.
+ * Phase times, peak memory and quality of results are taken from its
+ * -hls-stats=json report and tabulated as CSV or JSON, one row per kernel
+ * and size. Every compiled kernel is then simulated against its IR in an
+ * untimed run, mismatching modules are reported as miscompiled.
+ *
+ * Kernels:
+ *   dag    - straight-line expression DAG
+ *   loops  - chain of loop nests carrying an accumulator
+ *   switch - wide switch whose case results merge in one phi
+ *
+ * Operations are spread over the -widths, operands of different widths
+ * are zero-extended, so values are never truncated.
+ *
+ * Usage: scalability-bench [-kernel=dag,loops,switch] [-max-size=N] ...
+ */
+
+enum KernelKind {
+    DagKernel,
+    LoopsKernel,
+    SwitchKernel,
+};
+
+static cl::list<KernelKind> kernels(
+    "kernel",
+    cl::desc("Kernels to generate (default: all)"),
+    cl::values(
+        clEnumValN(DagKernel, "dag", "Straight-line expression DAG"),
+        clEnumValN(LoopsKernel, "loops", "Chain of loop nests"),
+        clEnumValN(SwitchKernel, "switch", "Wide switch statement")
+    ),
+    cl::CommaSeparated
+);
+
+static cl::opt<unsigned int> min_size(
+    "min-size",
+    cl::desc("Instructions of the smallest kernel"),
+    cl::init(10)
+);
+
+static cl::opt<unsigned int> max_size(
+    "max-size",
+    cl::desc("Instructions of the largest kernel"),
+    cl::init(10000)
+);
+
+static cl::opt<unsigned int> size_factor(
+    "size-factor",
+    cl::desc("Growth of kernel size between runs"),
+    cl::init(10)
+);
+
+static cl::list<unsigned int> widths(
+    "widths",
+    cl::desc("Operation bitwidths (default: 8,16,32,64)"),
+    cl::CommaSeparated
+);
+
+static cl::opt<unsigned int> loop_depth(
+    "loop-depth",
+    cl::desc("Depth of every loop nest"),
+    cl::init(3)
+);
+
+static cl::opt<unsigned int> loop_ops(
+    "loop-ops",
+    cl::desc("Operations in the innermost loop body"),
+    cl::init(8)
+);
+
+static cl::opt<unsigned int> case_ops(
+    "case-ops",
+    cl::desc("Operations of every switch case"),
+    cl::init(4)
+);
+
+static cl::opt<unsigned int> seed(
+    "seed",
+    cl::desc("Random seed of the generator"),
+    cl::init(42)
+);
+
+static cl::opt<std::string> hls_bin(
+    "hls",
+    cl::desc("Compiler binary"),
+    cl::value_desc("path"),
+    cl::init("build/bin/bitpack-hls")
+);
+
+static cl::opt<std::string> work_dir(
+    "work-dir",
+    cl::desc("Directory of generated kernels and compiler outputs"),
+    cl::value_desc("dir"),
+    cl::init("build/bench/scalability")
+);
+
+static cl::opt<unsigned int> timeout(
+    "timeout",
+    cl::desc("Seconds allowed for one compilation (0 - unlimited)"),
+    cl::init(600)
+);
+
+static cl::opt<unsigned int> verify_vectors(
+    "verify-vectors",
+    cl::desc("Random test vectors simulated against the kernel after the timed run (0 - no verification)"),
+    cl::init(16)
+);
+
+enum OutputFormat {
+    CsvFormat,
+    JsonFormat,
+};
+
+static cl::opt<OutputFormat> output_format(
+    "format",
+    cl::desc("Results format"),
+    cl::values(
+        clEnumValN(CsvFormat, "csv", "One line per run"),
+        clEnumValN(JsonFormat, "json", "Array of run objects")
+    ),
+    cl::init(CsvFormat)
+);
+
+static cl::opt<std::string> output_file(
+    "o",
+    cl::desc("Results file"),
+    cl::value_desc("file"),
+    cl::init("-")
+);
+
+/* Phases of bitpack-hls, bitpack-binding exists in BITPACK builds only */
+static const std::vector<std::string> PHASES = {
+    "pre-hls",
+    "code-motion",
+    "tree-height",
+    "bitwidth",
+    "dag",
+    "scheduling",
+    "lifetime",
+    "binding",
+    "bitpack-binding",
+    "rtl",
+    "verilog",
+};
+
+static const std::vector<std::string> METRICS = {
+    "fsm_states",
+    "registers",
+    "fu_instances",
+    "mux_inputs",
+};
+
+/**
+ * Builds kernels into a module. Values of every width are kept in pools,
+ * new operations take their first operand from the most recent values of
+ * the pool so that long dependency chains and wide fan-out both appear.
+ */
+class KernelGenerator {
+public:
+    KernelGenerator(Module& module, std::vector<unsigned int>& op_widths, unsigned int seed)
+        : module(module),
+          context(module.getContext()),
+          builder(module.getContext()),
+          op_widths(op_widths),
+          rng(seed)
+    {
+        max_width = *std::max_element(op_widths.begin(), op_widths.end());
+    }
+
+    Function* generate(KernelKind kind, std::string name, unsigned int size);
+
+private:
+    static constexpr unsigned int RECENT_VALUES = 8;
+
+    Module& module;
+    LLVMContext& context;
+    IRBuilder<> builder;
+
+    std::vector<unsigned int>& op_widths;
+    unsigned int max_width;
+
+    std::mt19937 rng;
+
+    std::map<unsigned int, std::vector<Value*>> pools;
+
+    Function* createFunction(std::string name);
+
+    Value* pick(std::vector<Value*>& pool);
+
+    Value* extend(Value* value, unsigned int width);
+
+    Value* emitOperation();
+
+    Value* emitOperations(unsigned int n_ops);
+
+    Value* emitResult();
+
+    Value* emitLoop(unsigned int level, Value* acc_in);
+
+    void generateDag(unsigned int size);
+
+    void generateLoops(unsigned int size);
+
+    void generateSwitch(unsigned int size);
+};
+
+Function* KernelGenerator::generate(KernelKind kind, std::string name, unsigned int size) {
+    auto* function = createFunction(name);
+
+    switch (kind) {
+    case DagKernel:
+        generateDag(size);
+        break;
+    case LoopsKernel:
+        generateLoops(size);
+        break;
+    case SwitchKernel:
+        generateSwitch(size);
+        break;
+    }
+
+    return function;
+}
+
+Function* KernelGenerator::createFunction(std::string name) {
+    /* Two arguments of every width */
+    std::vector<Type*> arg_types;
+    for (auto width : op_widths) {
+        arg_types.push_back(builder.getIntNTy(width));
+        arg_types.push_back(builder.getIntNTy(width));
+    }
+
+    auto* function_type = FunctionType::get(builder.getIntNTy(max_width), arg_types, false);
+    auto* function = Function::Create(function_type, Function::ExternalLinkage, name, module);
+
+    builder.SetInsertPoint(BasicBlock::Create(context, "entry", function));
+
+    pools.clear();
+    for (auto& arg : function->args()) {
+        pools[arg.getType()->getIntegerBitWidth()].push_back(&arg);
+    }
+
+    return function;
+}
+
+Value* KernelGenerator::pick(std::vector<Value*>& pool) {
+    unsigned int n_recent = std::min<unsigned int>(pool.size(), RECENT_VALUES);
+    std::uniform_int_distribution<unsigned int> recent_dist(0, n_recent - 1);
+
+    return pool[pool.size() - 1 - recent_dist(rng)];
+}
+
+Value* KernelGenerator::extend(Value* value, unsigned int width) {
+    if (value->getType()->getIntegerBitWidth() == width) {
+        return value;
+    }
+
+    return builder.CreateZExt(value, builder.getIntNTy(width));
+}
+
+Value* KernelGenerator::emitOperation() {
+    static const Instruction::BinaryOps OPCODES[] = {
+        Instruction::Add,
+        Instruction::Sub,
+        Instruction::And,
+        Instruction::Or,
+        Instruction::Xor,
+        Instruction::Add,
+        Instruction::Mul,
+    };
+
+    std::uniform_int_distribution<unsigned int> width_dist(0, op_widths.size() - 1);
+    std::uniform_int_distribution<unsigned int> opcode_dist(0, std::size(OPCODES) - 1);
+    std::bernoulli_distribution cross_width_dist(0.2);
+
+    unsigned int width = op_widths[width_dist(rng)];
+    auto& pool = pools[width];
+
+    auto* lhs = pick(pool);
+    auto* rhs = pick(pool);
+
+    /* Some operands come from a narrower pool */
+    if (cross_width_dist(rng)) {
+        unsigned int narrow_width = op_widths[width_dist(rng)];
+
+        if (narrow_width < width) {
+            rhs = extend(pick(pools[narrow_width]), width);
+        }
+    }
+
+    auto* result = builder.CreateBinOp(OPCODES[opcode_dist(rng)], lhs, rhs);
+    pool.push_back(result);
+
+    return result;
+}
+
+Value* KernelGenerator::emitOperations(unsigned int n_ops) {
+    Value* result = nullptr;
+
+    for (unsigned int i = 0; i < n_ops; i++) {
+        result = emitOperation();
+    }
+
+    return result;
+}
+
+Value* KernelGenerator::emitResult() {
+    /* Latest value of every pool, combined at the widest width */
+    Value* result = nullptr;
+
+    for (auto width : op_widths) {
+        auto* value = extend(pools[width].back(), max_width);
+        result = (result == nullptr) ? value : builder.CreateXor(result, value);
+    }
+
+    return result;
+}
+
+void KernelGenerator::generateDag(unsigned int size) {
+    emitOperations(size);
+
+    builder.CreateRet(emitResult());
+}
+
+Value* KernelGenerator::emitLoop(unsigned int level, Value* acc_in) {
+    static const unsigned int TRIP_COUNT = 4;
+
+    auto* function = builder.GetInsertBlock()->getParent();
+    auto* preheader = builder.GetInsertBlock();
+    auto level_name = std::to_string(level);
+
+    auto* header = BasicBlock::Create(context, "loop" + level_name, function);
+    builder.CreateBr(header);
+    builder.SetInsertPoint(header);
+
+    auto* counter = builder.CreatePHI(builder.getInt32Ty(), 2);
+    auto* acc = builder.CreatePHI(acc_in->getType(), 2);
+
+    counter->addIncoming(builder.getInt32(0), preheader);
+    acc->addIncoming(acc_in, preheader);
+
+    Value* acc_out = nullptr;
+
+    if (level + 1 < loop_depth) {
+        acc_out = emitLoop(level + 1, acc);
+    } else {
+        /* Innermost body is a single block, it may be pipelined */
+        pools[max_width].push_back(acc);
+        acc_out = builder.CreateAdd(acc, extend(emitOperations(loop_ops), max_width));
+    }
+
+    auto* latch = builder.GetInsertBlock();
+
+    auto* next_counter = builder.CreateAdd(counter, builder.getInt32(1));
+    auto* is_looping = builder.CreateICmpULT(next_counter, builder.getInt32(TRIP_COUNT));
+
+    auto* exit = BasicBlock::Create(context, "exit" + level_name, function);
+    builder.CreateCondBr(is_looping, header, exit);
+
+    counter->addIncoming(next_counter, latch);
+    acc->addIncoming(acc_out, latch);
+
+    builder.SetInsertPoint(exit);
+
+    return acc_out;
+}
+
+void KernelGenerator::generateLoops(unsigned int size) {
+    /* Counter, accumulator and branch instructions of every level */
+    const unsigned int nest_size = loop_depth * 5 + loop_ops + 2;
+
+    Value* acc = extend(pools[max_width].back(), max_width);
+
+    for (unsigned int n_instr = 0; n_instr < size; n_instr += nest_size) {
+        acc = emitLoop(0, acc);
+    }
+
+    builder.CreateRet(acc);
+}
+
+void KernelGenerator::generateSwitch(unsigned int size) {
+    const unsigned int n_cases = std::max(2U, size / (case_ops + 2));
+
+    auto* function = builder.GetInsertBlock()->getParent();
+    auto* selector = function->getArg(0);
+    auto* selector_type = cast<IntegerType>(selector->getType());
+
+    /* Case values must fit the selector */
+    const unsigned int n_case_values =
+        (selector_type->getBitWidth() >= 32)
+            ? n_cases
+            : std::min<unsigned int>(n_cases, 1U << selector_type->getBitWidth());
+
+    auto* merge = BasicBlock::Create(context, "merge", function);
+    auto* default_case = BasicBlock::Create(context, "default", function);
+
+    auto* switch_instr = builder.CreateSwitch(selector, default_case, n_case_values);
+    auto entry_pools = pools;
+
+    std::vector<std::pair<Value*, BasicBlock*>> results;
+
+    for (unsigned int i = 0; i <= n_case_values; i++) {
+        bool is_default = (i == n_case_values);
+
+        auto* case_block =
+            is_default
+                ? default_case
+                : BasicBlock::Create(context, "case" + std::to_string(i), function, default_case);
+
+        if (!is_default) {
+            switch_instr->addCase(ConstantInt::get(selector_type, i), case_block);
+        }
+
+        builder.SetInsertPoint(case_block);
+
+        /* Cases only see the values of the entry block */
+        pools = entry_pools;
+        emitOperations(case_ops);
+
+        results.push_back({ emitResult(), builder.GetInsertBlock() });
+        builder.CreateBr(merge);
+    }
+
+    builder.SetInsertPoint(merge);
+
+    auto* result = builder.CreatePHI(builder.getIntNTy(max_width), results.size());
+    for (auto& value_block : results) {
+        result->addIncoming(value_block.first, value_block.second);
+    }
+
+    builder.CreateRet(result);
+}
+
+static std::string getKernelName(KernelKind kind) {
+    switch (kind) {
+    case DagKernel:
+        return "dag";
+    case LoopsKernel:
+        return "loops";
+    case SwitchKernel:
+        return "switch";
+    }
+
+    return "unknown";
+}
+
+/** Results of one compilation */
+struct BenchRun {
+    std::string kernel;
+    unsigned int size;
+    unsigned int n_instructions;
+    std::string status;
+
+    double wall_ms;
+    uint64_t peak_memory_kib;
+
+    std::map<std::string, double> phase_ms;
+    std::map<std::string, int64_t> metrics;
+};
+
+static void readStats(std::string stats_file, BenchRun& run) {
+    auto stats_buffer = MemoryBuffer::getFile(stats_file);
+
+    if (!stats_buffer) {
+        run.status = "no-stats";
+        return;
+    }
+
+    auto stats = json::parse(stats_buffer.get()->getBuffer());
+
+    if (!stats) {
+        consumeError(stats.takeError());
+        run.status = "bad-stats";
+        return;
+    }
+
+    auto* stats_object = stats->getAsObject();
+
+    if (auto* phases = stats_object->getArray("phases")) {
+        for (auto& phase : *phases) {
+            auto* phase_object = phase.getAsObject();
+            auto name = phase_object->getString("name");
+            auto wall_ms = phase_object->getNumber("wall_ms");
+
+            if (name && wall_ms) {
+                run.phase_ms[name->str()] += wall_ms.getValue();
+            }
+        }
+    }
+
+    if (auto* metrics = stats_object->getObject("metrics")) {
+        for (auto& metric : *metrics) {
+            if (auto value = metric.second.getAsInteger()) {
+                run.metrics[metric.first.str()] = value.getValue();
+            }
+        }
+    }
+}
+
+/** Simulates the module of a compiled kernel, apart from the timed run */
+static void verifyKernel(std::string ir_file, std::string out_dir, std::string run_name, BenchRun& run) {
+    const std::string sim_vectors = "--sim-vectors=" + std::to_string(verify_vectors);
+    const std::string sim_dir = out_dir + "/verify";
+
+    std::vector<StringRef> args = {
+        hls_bin,
+        sim_vectors,
+        "--out-dir",
+        sim_dir,
+        ir_file,
+        run_name,
+    };
+
+    const std::string log_file = out_dir + ".verify.log";
+    Optional<StringRef> redirects[] = { StringRef(""), StringRef(log_file), StringRef(log_file) };
+
+    int status = sys::ExecuteAndWait(hls_bin, args, None, redirects, timeout);
+
+    if (status != 0) {
+        run.status = "miscompiled";
+    }
+}
+
+static BenchRun runKernel(KernelKind kind, unsigned int size) {
+    BenchRun run;
+    run.kernel = getKernelName(kind);
+    run.size = size;
+    run.status = "ok";
+    run.wall_ms = 0;
+    run.peak_memory_kib = 0;
+
+    const std::string run_name = run.kernel + "_" + std::to_string(size);
+    const std::string ir_file = work_dir + "/" + run_name + ".ll";
+    const std::string out_dir = work_dir + "/" + run_name;
+
+    {
+        LLVMContext context;
+        Module module(run_name, context);
+
+        KernelGenerator generator(module, widths, seed);
+        auto* function = generator.generate(kind, run_name, size);
+
+        if (verifyFunction(*function, &errs())) {
+            run.status = "invalid-ir";
+            return run;
+        }
+
+        run.n_instructions = function->getInstructionCount();
+
+        std::error_code ec;
+        raw_fd_ostream ir_out(ir_file, ec, sys::fs::OF_None);
+
+        if (ec) {
+            errs() << "Cannot write '" << ir_file << "': " << ec.message() << "\n";
+            run.status = "io-error";
+            return run;
+        }
+
+        module.print(ir_out, nullptr);
+    }
+
+    std::vector<StringRef> args = {
+        hls_bin,
+        "--hls-stats=json",
+        "--out-dir",
+        out_dir,
+        ir_file,
+        run_name,
+    };
+
+    const std::string log_file = out_dir + ".log";
+    Optional<StringRef> redirects[] = { StringRef(""), StringRef(log_file), StringRef(log_file) };
+
+    std::string error_message;
+    Optional<sys::ProcessStatistics> process_stats;
+
+    auto start = std::chrono::steady_clock::now();
+
+    int status = sys::ExecuteAndWait(
+        hls_bin,
+        args,
+        None,
+        redirects,
+        timeout,
+        0,
+        &error_message,
+        nullptr,
+        &process_stats
+    );
+
+    auto end = std::chrono::steady_clock::now();
+
+    run.wall_ms = std::chrono::duration<double, std::milli>(end - start).count();
+
+    if (process_stats) {
+        run.peak_memory_kib = process_stats->PeakMemory;
+    }
+
+    if (status != 0) {
+        /* Killed children report -2 for both crashes and timeouts */
+        bool is_timeout = (timeout != 0) && (run.wall_ms >= timeout * 1000.0);
+
+        run.status = is_timeout ? "timeout" : ((status < 0) ? "crashed" : "failed");
+        return run;
+    }
+
+    readStats(out_dir + "/" + run_name + ".stats.json", run);
+
+    if ((run.status == "ok") && (verify_vectors > 0)) {
+        verifyKernel(ir_file, out_dir, run_name, run);
+    }
+
+    return run;
+}
+
+static void printCsv(raw_ostream& out, std::vector<BenchRun>& runs) {
+    out << "kernel,size,instructions,status,wall_ms,peak_memory_kib";
+
+    for (auto& phase : PHASES) {
+        out << "," << phase << "_ms";
+    }
+
+    for (auto& metric : METRICS) {
+        out << "," << metric;
+    }
+
+    out << "\n";
+
+    for (auto& run : runs) {
+        out << run.kernel << "," << run.size << "," << run.n_instructions << ","
+            << run.status << "," << format("%.3f", run.wall_ms) << ","
+            << run.peak_memory_kib;
+
+        for (auto& phase : PHASES) {
+            out << "," << format("%.3f", run.phase_ms[phase]);
+        }
+
+        for (auto& metric : METRICS) {
+            out << "," << run.metrics[metric];
+        }
+
+        out << "\n";
+    }
+}
+
+static void printJson(raw_ostream& out, std::vector<BenchRun>& runs) {
+    json::OStream json_out(out, 2);
+
+    json_out.array([&]() {
+        for (auto& run : runs) {
+            json_out.object([&]() {
+                json_out.attribute("kernel", run.kernel);
+                json_out.attribute("size", run.size);
+                json_out.attribute("instructions", run.n_instructions);
+                json_out.attribute("status", run.status);
+                json_out.attribute("wall_ms", run.wall_ms);
+                json_out.attribute("peak_memory_kib", static_cast<int64_t>(run.peak_memory_kib));
+
+                json_out.attributeObject("phases_ms", [&]() {
+                    for (auto& phase : PHASES) {
+                        json_out.attribute(phase, run.phase_ms[phase]);
+                    }
+                });
+
+                json_out.attributeObject("metrics", [&]() {
+                    for (auto& metric : METRICS) {
+                        json_out.attribute(metric, run.metrics[metric]);
+                    }
+                });
+            });
+        }
+    });
+
+    out << "\n";
+}
+
+int main(int argc, char const *argv[]) {
+    cl::ParseCommandLineOptions(argc, argv, "Bitpack HLS scalability benchmark\n");
+
+    if (kernels.empty()) {
+        kernels.push_back(DagKernel);
+        kernels.push_back(LoopsKernel);
+        kernels.push_back(SwitchKernel);
+    }
+
+    if (widths.empty()) {
+        for (unsigned int width : { 8, 16, 32, 64 }) {
+            widths.push_back(width);
+        }
+    }
+
+    if ((min_size == 0) || (size_factor < 2)) {
+        errs() << "Sizes must start above 0 and grow by a factor of 2 or more\n";
+        return 1;
+    }
+
+    if (auto ec = sys::fs::create_directories(work_dir)) {
+        errs() << "Cannot create '" << work_dir << "': " << ec.message() << "\n";
+        return 1;
+    }
+
+    std::error_code ec;
+    raw_fd_ostream out(output_file, ec, sys::fs::OF_None);
+
+    if (ec) {
+        errs() << "Cannot open '" << output_file << "': " << ec.message() << "\n";
+        return 1;
+    }
+
+    std::vector<BenchRun> runs;
+
+    for (auto kind : kernels) {
+        for (uint64_t size = min_size; size <= max_size; size *= size_factor) {
+            runs.push_back(runKernel(kind, size));
+
+            auto& run = runs.back();
+            errs() << run.kernel << " " << run.size << ": " << run.status
+                << " " << format("%.1f", run.wall_ms) << " ms\n";
+        }
+    }
+
+    if (output_format == JsonFormat) {
+        printJson(out, runs);
+    } else {
+        printCsv(out, runs);
+    }
+
+    bool is_all_ok = std::all_of(runs.begin(), runs.end(), [](BenchRun& run) {
+        return run.status == "ok";
+    });
+
+    return is_all_ok ? 0 : 1;
+}
@@ -0,0 +1,121 @@
+; ModuleID = 'dag_100'
+source_filename = "dag_100"
+
+define i64 @dag_100(i8 %0, i8 %1, i16 %2, i16 %3, i32 %4, i32 %5, i64 %6, i64 %7) {
+entry:
+  %8 = add i16 %2, %2
+  %9 = zext i8 %1 to i32
+  %10 = or i32 %4, %9
+  %11 = xor i64 %7, %6
+  %12 = mul i8 %1, %0
+  %13 = and i8 %12, %12
+  %14 = zext i16 %3 to i32
+  %15 = xor i32 %5, %14
+  %16 = and i16 %8, %8
+  %17 = sub i8 %12, %13
+  %18 = add i16 %3, %2
+  %19 = add i64 %7, %6
+  %20 = add i8 %0, %0
+  %21 = xor i16 %16, %18
+  %22 = or i8 %13, %1
+  %23 = sub i64 %19, %19
+  %24 = or i8 %12, %1
+  %25 = add i8 %13, %13
+  %26 = mul i64 %11, %6
+  %27 = sub i32 %5, %4
+  %28 = and i32 %27, %4
+  %29 = and i32 %27, %10
+  %30 = add i64 %23, %11
+  %31 = and i16 %3, %21
+  %32 = zext i8 %12 to i64
+  %33 = sub i64 %23, %32
+  %34 = xor i32 %10, %5
+  %35 = mul i8 %1, %22
+  %36 = zext i8 %24 to i64
+  %37 = and i64 %19, %36
+  %38 = xor i32 %28, %10
+  %39 = add i16 %2, %16
+  %40 = or i64 %19, %11
+  %41 = xor i8 %13, %24
+  %42 = zext i8 %41 to i16
+  %43 = mul i16 %39, %42
+  %44 = xor i32 %28, %29
+  %45 = or i64 %37, %37
+  %46 = zext i32 %34 to i64
+  %47 = xor i64 %40, %46
+  %48 = and i8 %13, %13
+  %49 = sub i32 %44, %15
+  %50 = and i8 %25, %17
+  %51 = mul i64 %47, %23
+  %52 = add i8 %41, %48
+  %53 = zext i8 %35 to i64
+  %54 = or i64 %45, %53
+  %55 = and i16 %21, %39
+  %56 = or i8 %22, %50
+  %57 = sub i32 %28, %34
+  %58 = xor i64 %51, %47
+  %59 = xor i16 %43, %39
+  %60 = zext i16 %43 to i64
+  %61 = mul i64 %45, %60
+  %62 = or i32 %49, %29
+  %63 = xor i16 %16, %31
+  %64 = add i8 %25, %50
+  %65 = xor i64 %54, %51
+  %66 = add i16 %39, %21
+  %67 = add i8 %52, %48
+  %68 = add i64 %51, %58
+  %69 = xor i32 %38, %29
+  %70 = and i8 %64, %35
+  %71 = and i32 %29, %34
+  %72 = mul i32 %71, %69
+  %73 = mul i32 %69, %71
+  %74 = mul i32 %62, %62
+  %75 = mul i8 %41, %41
+  %76 = xor i32 %73, %72
+  %77 = and i32 %62, %57
+  %78 = sub i64 %45, %51
+  %79 = add i64 %47, %54
+  %80 = add i16 %66, %21
+  %81 = xor i16 %66, %63
+  %82 = add i16 %55, %39
+  %83 = and i8 %64, %67
+  %84 = and i32 %71, %69
+  %85 = xor i32 %73, %84
+  %86 = mul i16 %80, %81
+  %87 = or i16 %80, %55
+  %88 = xor i64 %68, %61
+  %89 = or i16 %63, %86
+  %90 = add i16 %81, %89
+  %91 = sub i8 %50, %50
+  %92 = mul i64 %54, %78
+  %93 = mul i16 %86, %82
+  %94 = and i64 %61, %92
+  %95 = sub i8 %56, %75
+  %96 = xor i16 %86, %87
+  %97 = xor i64 %78, %94
+  %98 = or i32 %71, %77
+  %99 = xor i16 %81, %90
+  %100 = and i8 %67, %67
+  %101 = mul i16 %86, %90
+  %102 = xor i32 %72, %98
+  %103 = and i64 %94, %78
+  %104 = add i64 %103, %68
+  %105 = xor i16 %90, %101
+  %106 = mul i8 %91, %83
+  %107 = add i16 %89, %93
+  %108 = add i8 %70, %95
+  %109 = sub i16 %96, %90
+  %110 = add i64 %92, %94
+  %111 = xor i8 %91, %95
+  %112 = or i8 %91, %108
+  %113 = sub i32 %85, %102
+  %114 = add i16 %101, %96
+  %115 = xor i8 %83, %112
+  %116 = zext i8 %115 to i64
+  %117 = zext i16 %114 to i64
+  %118 = xor i64 %116, %117
+  %119 = zext i32 %113 to i64
+  %120 = xor i64 %118, %119
+  %121 = xor i64 %120, %110
+  ret i64 %121
+}
@@ -0,0 +1,1724 @@
+module dag_100
+(
+	input wire  clk,
+	input wire  reset,
+	input wire  start,
+	output reg  finish,
+	output reg [63:0] return_val,
+	input wire [7:0] arg_0,
+	input wire [7:0] arg_1,
+	input wire [15:0] arg_2,
+	input wire [15:0] arg_3,
+	input wire [31:0] arg_4,
+	input wire [31:0] arg_5,
+	input wire [63:0] arg_6,
+	input wire [63:0] arg_7
+);
+
+parameter [2:0] BPHLS = 3'd0;
+parameter [2:0] BPHLS_F_dag_100_BB_0_S_0 = 3'd1;
+parameter [2:0] BPHLS_F_dag_100_BB_0_S_1 = 3'd2;
+parameter [2:0] BPHLS_F_dag_100_BB_0_S_2 = 3'd3;
+parameter [2:0] BPHLS_F_dag_100_BB_0_S_3 = 3'd4;
+parameter [2:0] BPHLS_F_dag_100_BB_0_S_4 = 3'd5;
+parameter [2:0] BPHLS_F_dag_100_BB_0_S_5 = 3'd6;
+parameter [2:0] BPHLS_F_dag_100_BB_0_S_6 = 3'd7;
+
+reg [2:0] cur_state;
+reg [2:0] next_state;
+reg [15:0] dag_100_entry_8;
+reg [15:0] dag_100_entry_8_reg;
+reg [31:0] dag_100_entry_9;
+reg [31:0] dag_100_entry_9_reg;
+reg [63:0] dag_100_entry_10;
+reg [63:0] dag_100_entry_10_reg;
+reg [7:0] dag_100_entry_11;
+reg [7:0] dag_100_entry_11_reg;
+reg [7:0] dag_100_entry_12;
+reg [7:0] dag_100_entry_12_reg;
+reg [31:0] dag_100_entry_13;
+reg [31:0] dag_100_entry_13_reg;
+reg [15:0] dag_100_entry_14;
+reg [15:0] dag_100_entry_14_reg;
+reg [7:0] dag_100_entry_15;
+reg [7:0] dag_100_entry_15_reg;
+reg [15:0] dag_100_entry_16;
+reg [15:0] dag_100_entry_16_reg;
+reg [63:0] dag_100_entry_17;
+reg [63:0] dag_100_entry_17_reg;
+reg [15:0] dag_100_entry_19;
+reg [15:0] dag_100_entry_19_reg;
+reg [7:0] dag_100_entry_20;
+reg [7:0] dag_100_entry_20_reg;
+reg [63:0] dag_100_entry_21;
+reg  dag_100_entry_21_reg;
+reg [7:0] dag_100_entry_22;
+reg [7:0] dag_100_entry_22_reg;
+reg [7:0] dag_100_entry_23;
+reg [7:0] dag_100_entry_23_reg;
+reg [31:0] dag_100_entry_25;
+reg [31:0] dag_100_entry_25_reg;
+reg [31:0] dag_100_entry_26;
+reg [31:0] dag_100_entry_26_reg;
+reg [31:0] dag_100_entry_27;
+reg [31:0] dag_100_entry_27_reg;
+reg [15:0] dag_100_entry_29;
+reg [15:0] dag_100_entry_29_reg;
+reg [31:0] dag_100_entry_31;
+reg [31:0] dag_100_entry_31_reg;
+reg [7:0] dag_100_entry_32;
+reg [7:0] dag_100_entry_32_reg;
+reg [63:0] dag_100_entry_33;
+reg [7:0] dag_100_entry_33_reg;
+reg [31:0] dag_100_entry_34;
+reg [31:0] dag_100_entry_34_reg;
+reg [15:0] dag_100_entry_35;
+reg [15:0] dag_100_entry_35_reg;
+reg [63:0] dag_100_entry_36;
+reg [63:0] dag_100_entry_36_reg;
+reg [7:0] dag_100_entry_37;
+reg [7:0] dag_100_entry_37_reg;
+reg [15:0] dag_100_entry_38;
+reg [15:0] dag_100_entry_38_reg;
+reg [31:0] dag_100_entry_39;
+reg [31:0] dag_100_entry_39_reg;
+reg [63:0] dag_100_entry_40;
+reg [7:0] dag_100_entry_40_reg;
+reg [63:0] dag_100_entry_41;
+reg [63:0] dag_100_entry_41_reg;
+reg [7:0] dag_100_entry_42;
+reg [7:0] dag_100_entry_42_reg;
+reg [31:0] dag_100_entry_43;
+reg [31:0] dag_100_entry_43_reg;
+reg [7:0] dag_100_entry_44;
+reg [7:0] dag_100_entry_44_reg;
+reg [63:0] dag_100_entry_45;
+reg  dag_100_entry_45_reg;
+reg [7:0] dag_100_entry_46;
+reg [7:0] dag_100_entry_46_reg;
+reg [63:0] dag_100_entry_47;
+reg [7:0] dag_100_entry_47_reg;
+reg [15:0] dag_100_entry_48;
+reg [15:0] dag_100_entry_48_reg;
+reg [7:0] dag_100_entry_49;
+reg [7:0] dag_100_entry_49_reg;
+reg [31:0] dag_100_entry_50;
+reg [31:0] dag_100_entry_50_reg;
+reg [63:0] dag_100_entry_51;
+reg [63:0] dag_100_entry_51_reg;
+reg [63:0] dag_100_entry_53;
+reg [23:0] dag_100_entry_53_reg;
+reg [31:0] dag_100_entry_54;
+reg [31:0] dag_100_entry_54_reg;
+reg [15:0] dag_100_entry_55;
+reg [15:0] dag_100_entry_55_reg;
+reg [7:0] dag_100_entry_56;
+reg [7:0] dag_100_entry_56_reg;
+reg [15:0] dag_100_entry_58;
+reg [15:0] dag_100_entry_58_reg;
+reg [7:0] dag_100_entry_59;
+reg [7:0] dag_100_entry_59_reg;
+reg [63:0] dag_100_entry_60;
+reg [63:0] dag_100_entry_60_reg;
+reg [31:0] dag_100_entry_61;
+reg [31:0] dag_100_entry_61_reg;
+reg [7:0] dag_100_entry_62;
+reg [7:0] dag_100_entry_62_reg;
+reg [31:0] dag_100_entry_63;
+reg [31:0] dag_100_entry_63_reg;
+reg [31:0] dag_100_entry_64;
+reg [31:0] dag_100_entry_64_reg;
+reg [31:0] dag_100_entry_65;
+reg [31:0] dag_100_entry_65_reg;
+reg [7:0] dag_100_entry_67;
+reg [7:0] dag_100_entry_67_reg;
+reg [31:0] dag_100_entry_69;
+reg [31:0] dag_100_entry_69_reg;
+reg [63:0] dag_100_entry_70;
+reg [7:0] dag_100_entry_70_reg;
+reg [15:0] dag_100_entry_72;
+reg [15:0] dag_100_entry_72_reg;
+reg [15:0] dag_100_entry_73;
+reg [15:0] dag_100_entry_73_reg;
+reg [15:0] dag_100_entry_74;
+reg [15:0] dag_100_entry_74_reg;
+reg [7:0] dag_100_entry_75;
+reg [7:0] dag_100_entry_75_reg;
+reg [31:0] dag_100_entry_76;
+reg [31:0] dag_100_entry_76_reg;
+reg [31:0] dag_100_entry_77;
+reg [31:0] dag_100_entry_77_reg;
+reg [15:0] dag_100_entry_78;
+reg [15:0] dag_100_entry_78_reg;
+reg [15:0] dag_100_entry_79;
+reg [15:0] dag_100_entry_79_reg;
+reg [15:0] dag_100_entry_81;
+reg [15:0] dag_100_entry_81_reg;
+reg [15:0] dag_100_entry_82;
+reg [15:0] dag_100_entry_82_reg;
+reg [7:0] dag_100_entry_83;
+reg  dag_100_entry_83_reg;
+reg [63:0] dag_100_entry_84;
+reg [15:0] dag_100_entry_84_reg;
+reg [15:0] dag_100_entry_85;
+reg [15:0] dag_100_entry_85_reg;
+reg [63:0] dag_100_entry_86;
+reg [15:0] dag_100_entry_86_reg;
+reg [7:0] dag_100_entry_87;
+reg [7:0] dag_100_entry_87_reg;
+reg [15:0] dag_100_entry_88;
+reg [15:0] dag_100_entry_88_reg;
+reg [31:0] dag_100_entry_90;
+reg [31:0] dag_100_entry_90_reg;
+reg [15:0] dag_100_entry_93;
+reg [15:0] dag_100_entry_93_reg;
+reg [31:0] dag_100_entry_94;
+reg [31:0] dag_100_entry_94_reg;
+reg [63:0] dag_100_entry_95;
+reg [7:0] dag_100_entry_95_reg;
+reg [7:0] dag_100_entry_100;
+reg [7:0] dag_100_entry_100_reg;
+reg [63:0] dag_100_entry_102;
+reg [16:0] dag_100_entry_102_reg;
+reg [7:0] dag_100_entry_104;
+reg [7:0] dag_100_entry_104_reg;
+reg [31:0] dag_100_entry_105;
+reg [31:0] dag_100_entry_105_reg;
+reg [15:0] dag_100_entry_106;
+reg [15:0] dag_100_entry_106_reg;
+reg [7:0] dag_100_entry_107;
+reg [7:0] dag_100_entry_107_reg;
+reg [63:0] dag_100_entry_108;
+reg [63:0] dag_100_entry_108_reg;
+reg [63:0] dag_100_entry_109;
+reg [63:0] dag_100_entry_109_reg;
+reg [63:0] dag_100_entry_110;
+reg [63:0] dag_100_entry_110_reg;
+reg [15:0] dag_100_entry_and_16_16_0_op0;
+reg [15:0] dag_100_entry_and_16_16_0_op1;
+reg [15:0] dag_100_entry_and_16_16_0;
+reg [7:0] dag_100_entry_mul_8_8_0_op0;
+reg [7:0] dag_100_entry_mul_8_8_0_op1;
+reg [7:0] dag_100_entry_mul_8_8_0;
+reg [7:0] dag_100_entry_or_8_8_0_op0;
+reg [7:0] dag_100_entry_or_8_8_0_op1;
+reg [7:0] dag_100_entry_or_8_8_0;
+reg [7:0] dag_100_entry_add_8_8_0_op0;
+reg [7:0] dag_100_entry_add_8_8_0_op1;
+reg [7:0] dag_100_entry_add_8_8_0;
+reg [7:0] dag_100_entry_add_8_8_1_op0;
+reg [7:0] dag_100_entry_add_8_8_1_op1;
+reg [7:0] dag_100_entry_add_8_8_1;
+reg [7:0] dag_100_entry_and_8_8_0_op0;
+reg [7:0] dag_100_entry_and_8_8_0_op1;
+reg [7:0] dag_100_entry_and_8_8_0;
+reg [31:0] dag_100_entry_and_32_32_0_op0;
+reg [31:0] dag_100_entry_and_32_32_0_op1;
+reg [31:0] dag_100_entry_and_32_32_0;
+reg [31:0] dag_100_entry_or_32_32_0_op0;
+reg [31:0] dag_100_entry_or_32_32_0_op1;
+reg [31:0] dag_100_entry_or_32_32_0;
+reg [15:0] dag_100_entry_add_16_16_0_op0;
+reg [15:0] dag_100_entry_add_16_16_0_op1;
+reg [15:0] dag_100_entry_add_16_16_0;
+reg [15:0] dag_100_entry_add_16_16_1_op0;
+reg [15:0] dag_100_entry_add_16_16_1_op1;
+reg [15:0] dag_100_entry_add_16_16_1;
+reg [15:0] dag_100_entry_mul_16_16_0_op0;
+reg [15:0] dag_100_entry_mul_16_16_0_op1;
+reg [15:0] dag_100_entry_mul_16_16_0;
+reg [15:0] dag_100_entry_or_16_16_0_op0;
+reg [15:0] dag_100_entry_or_16_16_0_op1;
+reg [15:0] dag_100_entry_or_16_16_0;
+reg [31:0] dag_100_entry_mul_32_32_0_op0;
+reg [31:0] dag_100_entry_mul_32_32_0_op1;
+reg [31:0] dag_100_entry_mul_32_32_0;
+reg [15:0] dag_100_entry_add_32_32_0_op0;
+reg [15:0] dag_100_entry_add_32_32_0_op1;
+reg [16:0] dag_100_entry_add_32_32_0;
+reg [7:0] dag_100_entry_18;
+reg [63:0] dag_100_entry_28;
+reg [63:0] dag_100_entry_30;
+reg [63:0] dag_100_entry_24;
+reg [15:0] dag_100_entry_52;
+reg [63:0] dag_100_entry_80;
+reg [63:0] dag_100_entry_57;
+reg [63:0] dag_100_entry_71;
+reg [15:0] dag_100_entry_91;
+reg [15:0] dag_100_entry_101;
+reg [31:0] dag_100_entry_68;
+reg [15:0] dag_100_entry_97;
+reg [7:0] dag_100_entry_98;
+reg [7:0] dag_100_entry_103;
+reg [31:0] dag_100_entry_66;
+reg [63:0] dag_100_entry_89;
+reg [7:0] dag_100_entry_92;
+reg [63:0] dag_100_entry_96;
+reg [15:0] dag_100_entry_99;
+
+/* FSM BEGIN ---------------------------------------------------------------*/
+
+always @ (posedge clk) begin
+	if (reset == 1'b1) begin
+		cur_state <= BPHLS;
+	end else begin 
+		cur_state <= next_state;
+	end
+end
+
+always @ (*) begin
+	next_state = cur_state;
+
+	case (cur_state)
+	BPHLS:
+		if ((start == 1'd1)) begin
+			next_state = BPHLS_F_dag_100_BB_0_S_0;
+		end
+	BPHLS_F_dag_100_BB_0_S_0:
+		next_state = BPHLS_F_dag_100_BB_0_S_1;
+	BPHLS_F_dag_100_BB_0_S_1:
+		next_state = BPHLS_F_dag_100_BB_0_S_2;
+	BPHLS_F_dag_100_BB_0_S_2:
+		next_state = BPHLS_F_dag_100_BB_0_S_3;
+	BPHLS_F_dag_100_BB_0_S_3:
+		next_state = BPHLS_F_dag_100_BB_0_S_4;
+	BPHLS_F_dag_100_BB_0_S_4:
+		next_state = BPHLS_F_dag_100_BB_0_S_5;
+	BPHLS_F_dag_100_BB_0_S_5:
+		next_state = BPHLS_F_dag_100_BB_0_S_6;
+	BPHLS_F_dag_100_BB_0_S_6:
+		next_state = BPHLS;
+	default:
+		next_state = cur_state;
+	endcase
+end
+
+/* FSM END -----------------------------------------------------------------*/
+
+always @ (*) begin
+	dag_100_entry_8[15:0] = dag_100_entry_add_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_0)) begin
+		dag_100_entry_8_reg[15:0] <= dag_100_entry_8[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_1)) begin
+		dag_100_entry_8_reg[15:0] <= dag_100_entry_35[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_9[31:0] = dag_100_entry_or_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_0)) begin
+		dag_100_entry_9_reg[31:0] <= dag_100_entry_9[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_3)) begin
+		dag_100_entry_9_reg[31:0] <= dag_100_entry_90[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_10[63:0] = (arg_7 ^ arg_6);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_0)) begin
+		dag_100_entry_10_reg[63:0] <= dag_100_entry_10[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_11[7:0] = dag_100_entry_mul_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_0)) begin
+		dag_100_entry_11_reg[7:0] <= dag_100_entry_11[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_1)) begin
+		dag_100_entry_11_reg[7:0] <= dag_100_entry_32[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_12[7:0] = dag_100_entry_and_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_0)) begin
+		dag_100_entry_12_reg[7:0] <= dag_100_entry_12[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_2)) begin
+		dag_100_entry_12_reg[7:0] <= dag_100_entry_44[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_13[31:0] = (arg_5 ^ arg_3);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_0)) begin
+		dag_100_entry_13_reg[31:0] <= dag_100_entry_13[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_14[15:0] = dag_100_entry_and_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_0)) begin
+		dag_100_entry_14_reg[15:0] <= dag_100_entry_14[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_2)) begin
+		dag_100_entry_14_reg[15:0] <= dag_100_entry_48[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_5)) begin
+		dag_100_entry_14_reg[15:0] <= dag_100_entry_95[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_15[7:0] = (dag_100_entry_11 - dag_100_entry_12);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_0)) begin
+		dag_100_entry_15_reg[7:0] <= dag_100_entry_15[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_16[15:0] = dag_100_entry_add_16_16_1[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_0)) begin
+		dag_100_entry_16_reg[15:0] <= dag_100_entry_16[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_1)) begin
+		dag_100_entry_16_reg[15:0] <= dag_100_entry_58[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_4)) begin
+		dag_100_entry_16_reg[15:0] <= dag_100_entry_74[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_17[63:0] = (arg_7 + arg_6);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_0)) begin
+		dag_100_entry_17_reg[63:0] <= dag_100_entry_17[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_19[15:0] = (dag_100_entry_14 ^ dag_100_entry_16);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_0)) begin
+		dag_100_entry_19_reg[15:0] <= dag_100_entry_19[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_20[7:0] = dag_100_entry_or_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_1)) begin
+		dag_100_entry_20_reg[7:0] <= dag_100_entry_20[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_0)) begin
+		dag_100_entry_20_reg[7:0] <= dag_100_entry_22[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_5)) begin
+		dag_100_entry_20_reg[7:0] <= dag_100_entry_104[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_21[63:0] = (dag_100_entry_17 - dag_100_entry_17);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_0)) begin
+		dag_100_entry_21_reg <= dag_100_entry_21;
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_22[7:0] = dag_100_entry_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_100_entry_22_reg[7:0] = dag_100_entry_20_reg[7:0];
+end
+
+always @ (*) begin
+	dag_100_entry_23[7:0] = dag_100_entry_add_8_8_1[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_0)) begin
+		dag_100_entry_23_reg[7:0] <= dag_100_entry_23[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_25[31:0] = (arg_5 - arg_4);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_0)) begin
+		dag_100_entry_25_reg[31:0] <= dag_100_entry_25[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_26[31:0] = dag_100_entry_and_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_0)) begin
+		dag_100_entry_26_reg[31:0] <= dag_100_entry_26[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_2)) begin
+		dag_100_entry_26_reg[31:0] <= dag_100_entry_63[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_5)) begin
+		dag_100_entry_26_reg[31:0] <= dag_100_entry_86[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_27[31:0] = dag_100_entry_and_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_1)) begin
+		dag_100_entry_27_reg[31:0] <= dag_100_entry_27[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_3)) begin
+		dag_100_entry_27_reg[31:0] <= dag_100_entry_69[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_4)) begin
+		dag_100_entry_27_reg[31:0] <= dag_100_entry_76[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_29[15:0] = dag_100_entry_and_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_1)) begin
+		dag_100_entry_29_reg[15:0] <= dag_100_entry_29[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_31[31:0] = (dag_100_entry_9 ^ arg_5);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_0)) begin
+		dag_100_entry_31_reg[31:0] <= dag_100_entry_31[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_32[7:0] = dag_100_entry_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_100_entry_32_reg[7:0] = dag_100_entry_11_reg[7:0];
+end
+
+always @ (*) begin
+	dag_100_entry_33[63:0] = (dag_100_entry_17 & dag_100_entry_22);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_0)) begin
+		dag_100_entry_33_reg[7:0] <= dag_100_entry_33[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_34[31:0] = (dag_100_entry_26 ^ dag_100_entry_9);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_0)) begin
+		dag_100_entry_34_reg[31:0] <= dag_100_entry_34[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_35[15:0] = dag_100_entry_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_100_entry_35_reg[15:0] = dag_100_entry_8_reg[15:0];
+end
+
+always @ (*) begin
+	dag_100_entry_36[63:0] = (dag_100_entry_17 | dag_100_entry_10);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_0)) begin
+		dag_100_entry_36_reg[63:0] <= dag_100_entry_36[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_37[7:0] = (dag_100_entry_12 ^ dag_100_entry_22);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_0)) begin
+		dag_100_entry_37_reg[7:0] <= dag_100_entry_37[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_38[15:0] = dag_100_entry_mul_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_1)) begin
+		dag_100_entry_38_reg[15:0] <= dag_100_entry_38[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_3)) begin
+		dag_100_entry_38_reg[15:0] <= dag_100_entry_84[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_39[31:0] = (dag_100_entry_26_reg ^ dag_100_entry_27);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_1)) begin
+		dag_100_entry_39_reg[31:0] <= dag_100_entry_39[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_40[63:0] = dag_100_entry_or_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_2)) begin
+		dag_100_entry_40_reg[7:0] <= dag_100_entry_40[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_4)) begin
+		dag_100_entry_40_reg[7:0] <= dag_100_entry_49[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_41[63:0] = (dag_100_entry_36 ^ dag_100_entry_31);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_0)) begin
+		dag_100_entry_41_reg[63:0] <= dag_100_entry_41[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_42[7:0] = dag_100_entry_and_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_1)) begin
+		dag_100_entry_42_reg[7:0] <= dag_100_entry_42[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_3)) begin
+		dag_100_entry_42_reg[7:0] <= dag_100_entry_62[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_43[31:0] = (dag_100_entry_39 - dag_100_entry_13_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_1)) begin
+		dag_100_entry_43_reg[31:0] <= dag_100_entry_43[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_44[7:0] = dag_100_entry_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_100_entry_44_reg[7:0] = dag_100_entry_12_reg[7:0];
+end
+
+always @ (*) begin
+	dag_100_entry_45[63:0] = (dag_100_entry_41_reg * dag_100_entry_21_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_1)) begin
+		dag_100_entry_45_reg <= dag_100_entry_45;
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_46[7:0] = dag_100_entry_add_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_1)) begin
+		dag_100_entry_46_reg[7:0] <= dag_100_entry_46[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_4)) begin
+		dag_100_entry_46_reg[7:0] <= dag_100_entry_100[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_47[63:0] = dag_100_entry_or_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_3)) begin
+		dag_100_entry_47_reg[7:0] <= dag_100_entry_47[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_48[15:0] = dag_100_entry_and_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_100_entry_48_reg[15:0] = dag_100_entry_14_reg[15:0];
+end
+
+always @ (*) begin
+	dag_100_entry_49[7:0] = dag_100_entry_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_100_entry_49_reg[7:0] = dag_100_entry_40_reg[7:0];
+end
+
+always @ (*) begin
+	dag_100_entry_50[31:0] = (dag_100_entry_26 - dag_100_entry_31);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_0)) begin
+		dag_100_entry_50_reg[31:0] <= dag_100_entry_50[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_51[63:0] = (dag_100_entry_45_reg ^ dag_100_entry_41_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_2)) begin
+		dag_100_entry_51_reg[63:0] <= dag_100_entry_51[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_53[63:0] = dag_100_entry_mul_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_2)) begin
+		dag_100_entry_53_reg[23:0] <= dag_100_entry_53[23:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_54[31:0] = dag_100_entry_or_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_1)) begin
+		dag_100_entry_54_reg[31:0] <= dag_100_entry_54[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_55[15:0] = (dag_100_entry_14_reg ^ dag_100_entry_29);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_1)) begin
+		dag_100_entry_55_reg[15:0] <= dag_100_entry_55[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_56[7:0] = dag_100_entry_add_8_8_1[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_2)) begin
+		dag_100_entry_56_reg[7:0] <= dag_100_entry_56[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_58[15:0] = dag_100_entry_add_16_16_1[15:0];
+end
+
+always @ (*) begin
+	dag_100_entry_58_reg[15:0] = dag_100_entry_16_reg[15:0];
+end
+
+always @ (*) begin
+	dag_100_entry_59[7:0] = dag_100_entry_add_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_2)) begin
+		dag_100_entry_59_reg[7:0] <= dag_100_entry_59[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_60[63:0] = (dag_100_entry_45_reg + dag_100_entry_51);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_2)) begin
+		dag_100_entry_60_reg[63:0] <= dag_100_entry_60[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_61[31:0] = (dag_100_entry_34_reg ^ dag_100_entry_27);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_1)) begin
+		dag_100_entry_61_reg[31:0] <= dag_100_entry_61[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_62[7:0] = dag_100_entry_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_100_entry_62_reg[7:0] = dag_100_entry_42_reg[7:0];
+end
+
+always @ (*) begin
+	dag_100_entry_63[31:0] = dag_100_entry_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_100_entry_63_reg[31:0] = dag_100_entry_26_reg[31:0];
+end
+
+always @ (*) begin
+	dag_100_entry_64[31:0] = dag_100_entry_mul_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_3)) begin
+		dag_100_entry_64_reg[31:0] <= dag_100_entry_64[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_65[31:0] = dag_100_entry_mul_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_4)) begin
+		dag_100_entry_65_reg[31:0] <= dag_100_entry_65[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_67[7:0] = dag_100_entry_mul_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_2)) begin
+		dag_100_entry_67_reg[7:0] <= dag_100_entry_67[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_69[31:0] = dag_100_entry_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_100_entry_69_reg[31:0] = dag_100_entry_27_reg[31:0];
+end
+
+always @ (*) begin
+	dag_100_entry_70[63:0] = (dag_100_entry_40 - dag_100_entry_45_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_2)) begin
+		dag_100_entry_70_reg[7:0] <= dag_100_entry_70[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_72[15:0] = dag_100_entry_add_16_16_1[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_2)) begin
+		dag_100_entry_72_reg[15:0] <= dag_100_entry_72[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_73[15:0] = (dag_100_entry_58 ^ dag_100_entry_55);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_1)) begin
+		dag_100_entry_73_reg[15:0] <= dag_100_entry_73[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_74[15:0] = dag_100_entry_add_16_16_1[15:0];
+end
+
+always @ (*) begin
+	dag_100_entry_74_reg[15:0] = dag_100_entry_16_reg[15:0];
+end
+
+always @ (*) begin
+	dag_100_entry_75[7:0] = dag_100_entry_and_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_4)) begin
+		dag_100_entry_75_reg[7:0] <= dag_100_entry_75[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_76[31:0] = dag_100_entry_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_100_entry_76_reg[31:0] = dag_100_entry_27_reg[31:0];
+end
+
+always @ (*) begin
+	dag_100_entry_77[31:0] = (dag_100_entry_65 ^ dag_100_entry_76);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_4)) begin
+		dag_100_entry_77_reg[31:0] <= dag_100_entry_77[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_78[15:0] = dag_100_entry_mul_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_2)) begin
+		dag_100_entry_78_reg[15:0] <= dag_100_entry_78[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_79[15:0] = dag_100_entry_or_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_2)) begin
+		dag_100_entry_79_reg[15:0] <= dag_100_entry_79[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_3)) begin
+		dag_100_entry_79_reg[15:0] <= dag_100_entry_81[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_81[15:0] = dag_100_entry_or_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_100_entry_81_reg[15:0] = dag_100_entry_79_reg[15:0];
+end
+
+always @ (*) begin
+	dag_100_entry_82[15:0] = dag_100_entry_add_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_3)) begin
+		dag_100_entry_82_reg[15:0] <= dag_100_entry_82[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_83[7:0] = (dag_100_entry_44 - dag_100_entry_44);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_2)) begin
+		dag_100_entry_83_reg <= dag_100_entry_83;
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_84[63:0] = dag_100_entry_mul_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_100_entry_84_reg[15:0] = dag_100_entry_38_reg[15:0];
+end
+
+always @ (*) begin
+	dag_100_entry_85[15:0] = dag_100_entry_mul_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_5)) begin
+		dag_100_entry_85_reg[15:0] <= dag_100_entry_85[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_4)) begin
+		dag_100_entry_85_reg[15:0] <= dag_100_entry_93[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_86[63:0] = dag_100_entry_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_100_entry_86_reg[15:0] = dag_100_entry_26_reg[31:0];
+end
+
+always @ (*) begin
+	dag_100_entry_87[7:0] = (dag_100_entry_49 - dag_100_entry_67_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_4)) begin
+		dag_100_entry_87_reg[7:0] <= dag_100_entry_87[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_88[15:0] = (dag_100_entry_78 ^ dag_100_entry_79);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_2)) begin
+		dag_100_entry_88_reg[15:0] <= dag_100_entry_88[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_90[31:0] = dag_100_entry_or_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_100_entry_90_reg[31:0] = dag_100_entry_9_reg[31:0];
+end
+
+always @ (*) begin
+	dag_100_entry_93[15:0] = dag_100_entry_mul_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_100_entry_93_reg[15:0] = dag_100_entry_85_reg[15:0];
+end
+
+always @ (*) begin
+	dag_100_entry_94[31:0] = (dag_100_entry_64 ^ dag_100_entry_90);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_3)) begin
+		dag_100_entry_94_reg[31:0] <= dag_100_entry_94[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_95[63:0] = dag_100_entry_and_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_100_entry_95_reg[7:0] = dag_100_entry_14_reg[15:0];
+end
+
+always @ (*) begin
+	dag_100_entry_100[7:0] = dag_100_entry_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_100_entry_100_reg[7:0] = dag_100_entry_46_reg[7:0];
+end
+
+always @ (*) begin
+	dag_100_entry_102[63:0] = dag_100_entry_add_32_32_0[16:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_5)) begin
+		dag_100_entry_102_reg[16:0] <= dag_100_entry_102[16:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_104[7:0] = dag_100_entry_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_100_entry_104_reg[7:0] = dag_100_entry_20_reg[7:0];
+end
+
+always @ (*) begin
+	dag_100_entry_105[31:0] = (dag_100_entry_77 - dag_100_entry_94_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_4)) begin
+		dag_100_entry_105_reg[31:0] <= dag_100_entry_105[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_106[15:0] = dag_100_entry_add_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_4)) begin
+		dag_100_entry_106_reg[15:0] <= dag_100_entry_106[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_107[7:0] = (dag_100_entry_75_reg ^ dag_100_entry_104);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_5)) begin
+		dag_100_entry_107_reg[7:0] <= dag_100_entry_107[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_108[63:0] = (dag_100_entry_102 ^ dag_100_entry_107);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_5)) begin
+		dag_100_entry_108_reg[63:0] <= dag_100_entry_108[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_109[63:0] = (dag_100_entry_105_reg ^ dag_100_entry_108);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_5)) begin
+		dag_100_entry_109_reg[63:0] <= dag_100_entry_109[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_110[63:0] = (dag_100_entry_106_reg ^ dag_100_entry_109);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_5)) begin
+		dag_100_entry_110_reg[63:0] <= dag_100_entry_110[63:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_0)) begin
+		dag_100_entry_and_16_16_0_op0[15:0] = dag_100_entry_8[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_1)) begin
+		dag_100_entry_and_16_16_0_op0[15:0] = arg_3[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_2)) begin
+		dag_100_entry_and_16_16_0_op0[15:0] = dag_100_entry_19_reg[15:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_100_BB_0_S_5)) */ begin
+		dag_100_entry_and_16_16_0_op0[15:0] = dag_100_entry_86[63:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_0)) begin
+		dag_100_entry_and_16_16_0_op1[15:0] = dag_100_entry_8[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_1)) begin
+		dag_100_entry_and_16_16_0_op1[15:0] = dag_100_entry_19_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_2)) begin
+		dag_100_entry_and_16_16_0_op1[15:0] = dag_100_entry_35_reg[15:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_100_BB_0_S_5)) */ begin
+		dag_100_entry_and_16_16_0_op1[15:0] = dag_100_entry_70_reg[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_and_16_16_0[15:0] = (dag_100_entry_and_16_16_0_op0 & dag_100_entry_and_16_16_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_0)) begin
+		dag_100_entry_mul_8_8_0_op0[7:0] = arg_1[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_1)) begin
+		dag_100_entry_mul_8_8_0_op0[7:0] = arg_1[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_2)) begin
+		dag_100_entry_mul_8_8_0_op0[7:0] = dag_100_entry_37_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_100_BB_0_S_4)) */ begin
+		dag_100_entry_mul_8_8_0_op0[7:0] = dag_100_entry_83_reg;
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_0)) begin
+		dag_100_entry_mul_8_8_0_op1[7:0] = arg_0[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_1)) begin
+		dag_100_entry_mul_8_8_0_op1[7:0] = dag_100_entry_20[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_2)) begin
+		dag_100_entry_mul_8_8_0_op1[7:0] = dag_100_entry_37_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_100_BB_0_S_4)) */ begin
+		dag_100_entry_mul_8_8_0_op1[7:0] = dag_100_entry_75[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_mul_8_8_0[7:0] = (dag_100_entry_mul_8_8_0_op0 * dag_100_entry_mul_8_8_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_0)) begin
+		dag_100_entry_or_8_8_0_op0[7:0] = dag_100_entry_11[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_1)) begin
+		dag_100_entry_or_8_8_0_op0[7:0] = dag_100_entry_12_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_2)) begin
+		dag_100_entry_or_8_8_0_op0[7:0] = dag_100_entry_33_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_3)) begin
+		dag_100_entry_or_8_8_0_op0[7:0] = dag_100_entry_40_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_4)) begin
+		dag_100_entry_or_8_8_0_op0[7:0] = dag_100_entry_20_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_100_BB_0_S_5)) */ begin
+		dag_100_entry_or_8_8_0_op0[7:0] = dag_100_entry_83_reg;
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_0)) begin
+		dag_100_entry_or_8_8_0_op1[7:0] = arg_1[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_1)) begin
+		dag_100_entry_or_8_8_0_op1[7:0] = arg_1[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_2)) begin
+		dag_100_entry_or_8_8_0_op1[7:0] = dag_100_entry_33_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_3)) begin
+		dag_100_entry_or_8_8_0_op1[7:0] = dag_100_entry_32_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_4)) begin
+		dag_100_entry_or_8_8_0_op1[7:0] = dag_100_entry_44_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_100_BB_0_S_5)) */ begin
+		dag_100_entry_or_8_8_0_op1[7:0] = dag_100_entry_100_reg[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_or_8_8_0[7:0] = (dag_100_entry_or_8_8_0_op0 | dag_100_entry_or_8_8_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_0)) begin
+		dag_100_entry_add_8_8_0_op0[7:0] = arg_0[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_1)) begin
+		dag_100_entry_add_8_8_0_op0[7:0] = dag_100_entry_37_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_2)) begin
+		dag_100_entry_add_8_8_0_op0[7:0] = dag_100_entry_46_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_100_BB_0_S_4)) */ begin
+		dag_100_entry_add_8_8_0_op0[7:0] = dag_100_entry_62_reg[7:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_0)) begin
+		dag_100_entry_add_8_8_0_op1[7:0] = arg_0[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_1)) begin
+		dag_100_entry_add_8_8_0_op1[7:0] = dag_100_entry_42[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_2)) begin
+		dag_100_entry_add_8_8_0_op1[7:0] = dag_100_entry_42_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_100_BB_0_S_4)) */ begin
+		dag_100_entry_add_8_8_0_op1[7:0] = dag_100_entry_87[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_add_8_8_0[7:0] = (dag_100_entry_add_8_8_0_op0 + dag_100_entry_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_0)) begin
+		dag_100_entry_add_8_8_1_op0[7:0] = dag_100_entry_12[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_100_BB_0_S_2)) */ begin
+		dag_100_entry_add_8_8_1_op0[7:0] = dag_100_entry_23_reg[7:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_0)) begin
+		dag_100_entry_add_8_8_1_op1[7:0] = dag_100_entry_12[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_100_BB_0_S_2)) */ begin
+		dag_100_entry_add_8_8_1_op1[7:0] = dag_100_entry_44[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_add_8_8_1[7:0] = (dag_100_entry_add_8_8_1_op0 + dag_100_entry_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_0)) begin
+		dag_100_entry_and_8_8_0_op0[7:0] = dag_100_entry_11[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_1)) begin
+		dag_100_entry_and_8_8_0_op0[7:0] = dag_100_entry_12_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_2)) begin
+		dag_100_entry_and_8_8_0_op0[7:0] = dag_100_entry_23_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_3)) begin
+		dag_100_entry_and_8_8_0_op0[7:0] = dag_100_entry_56_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_4)) begin
+		dag_100_entry_and_8_8_0_op0[7:0] = dag_100_entry_56_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_100_BB_0_S_5)) */ begin
+		dag_100_entry_and_8_8_0_op0[7:0] = dag_100_entry_59_reg[7:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_0)) begin
+		dag_100_entry_and_8_8_0_op1[7:0] = dag_100_entry_11[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_1)) begin
+		dag_100_entry_and_8_8_0_op1[7:0] = dag_100_entry_12_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_2)) begin
+		dag_100_entry_and_8_8_0_op1[7:0] = dag_100_entry_15_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_3)) begin
+		dag_100_entry_and_8_8_0_op1[7:0] = dag_100_entry_32_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_4)) begin
+		dag_100_entry_and_8_8_0_op1[7:0] = dag_100_entry_59_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_100_BB_0_S_5)) */ begin
+		dag_100_entry_and_8_8_0_op1[7:0] = dag_100_entry_59_reg[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_and_8_8_0[7:0] = (dag_100_entry_and_8_8_0_op0 & dag_100_entry_and_8_8_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_0)) begin
+		dag_100_entry_and_32_32_0_op0[31:0] = dag_100_entry_25[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_1)) begin
+		dag_100_entry_and_32_32_0_op0[31:0] = dag_100_entry_25_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_2)) begin
+		dag_100_entry_and_32_32_0_op0[31:0] = dag_100_entry_27_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_3)) begin
+		dag_100_entry_and_32_32_0_op0[31:0] = dag_100_entry_54_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_4)) begin
+		dag_100_entry_and_32_32_0_op0[31:0] = dag_100_entry_63_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_100_BB_0_S_5)) */ begin
+		dag_100_entry_and_32_32_0_op0[31:0] = dag_100_entry_53_reg[23:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_0)) begin
+		dag_100_entry_and_32_32_0_op1[31:0] = arg_4[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_1)) begin
+		dag_100_entry_and_32_32_0_op1[31:0] = dag_100_entry_9_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_2)) begin
+		dag_100_entry_and_32_32_0_op1[31:0] = dag_100_entry_31_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_3)) begin
+		dag_100_entry_and_32_32_0_op1[31:0] = dag_100_entry_50_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_4)) begin
+		dag_100_entry_and_32_32_0_op1[31:0] = dag_100_entry_61_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_100_BB_0_S_5)) */ begin
+		dag_100_entry_and_32_32_0_op1[31:0] = dag_100_entry_84_reg[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_and_32_32_0[31:0] = (dag_100_entry_and_32_32_0_op0 & dag_100_entry_and_32_32_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_0)) begin
+		dag_100_entry_or_32_32_0_op0[31:0] = arg_4[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_1)) begin
+		dag_100_entry_or_32_32_0_op0[31:0] = dag_100_entry_43[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_100_BB_0_S_3)) */ begin
+		dag_100_entry_or_32_32_0_op0[31:0] = dag_100_entry_63_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_0)) begin
+		dag_100_entry_or_32_32_0_op1[31:0] = arg_1[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_1)) begin
+		dag_100_entry_or_32_32_0_op1[31:0] = dag_100_entry_27[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_100_BB_0_S_3)) */ begin
+		dag_100_entry_or_32_32_0_op1[31:0] = dag_100_entry_69[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_or_32_32_0[31:0] = (dag_100_entry_or_32_32_0_op0 | dag_100_entry_or_32_32_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_0)) begin
+		dag_100_entry_add_16_16_0_op0[15:0] = arg_2[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_1)) begin
+		dag_100_entry_add_16_16_0_op0[15:0] = arg_2[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_3)) begin
+		dag_100_entry_add_16_16_0_op0[15:0] = dag_100_entry_73_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_4)) begin
+		dag_100_entry_add_16_16_0_op0[15:0] = dag_100_entry_93[15:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_100_BB_0_S_5)) */ begin
+		dag_100_entry_add_16_16_0_op0[15:0] = dag_100_entry_81_reg[15:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_0)) begin
+		dag_100_entry_add_16_16_0_op1[15:0] = arg_2[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_1)) begin
+		dag_100_entry_add_16_16_0_op1[15:0] = dag_100_entry_14_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_3)) begin
+		dag_100_entry_add_16_16_0_op1[15:0] = dag_100_entry_81[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_4)) begin
+		dag_100_entry_add_16_16_0_op1[15:0] = dag_100_entry_88_reg[15:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_100_BB_0_S_5)) */ begin
+		dag_100_entry_add_16_16_0_op1[15:0] = dag_100_entry_85[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_add_16_16_0[15:0] = (dag_100_entry_add_16_16_0_op0 + dag_100_entry_add_16_16_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_0)) begin
+		dag_100_entry_add_16_16_1_op0[15:0] = arg_3[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_1)) begin
+		dag_100_entry_add_16_16_1_op0[15:0] = dag_100_entry_35[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_2)) begin
+		dag_100_entry_add_16_16_1_op0[15:0] = dag_100_entry_58_reg[15:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_100_BB_0_S_4)) */ begin
+		dag_100_entry_add_16_16_1_op0[15:0] = dag_100_entry_48_reg[15:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_0)) begin
+		dag_100_entry_add_16_16_1_op1[15:0] = arg_2[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_1)) begin
+		dag_100_entry_add_16_16_1_op1[15:0] = dag_100_entry_19_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_2)) begin
+		dag_100_entry_add_16_16_1_op1[15:0] = dag_100_entry_19_reg[15:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_100_BB_0_S_4)) */ begin
+		dag_100_entry_add_16_16_1_op1[15:0] = dag_100_entry_35_reg[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_add_16_16_1[15:0] = (dag_100_entry_add_16_16_1_op0 + dag_100_entry_add_16_16_1_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_1)) begin
+		dag_100_entry_mul_16_16_0_op0[15:0] = dag_100_entry_35[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_2)) begin
+		dag_100_entry_mul_16_16_0_op0[15:0] = dag_100_entry_72[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_3)) begin
+		dag_100_entry_mul_16_16_0_op0[15:0] = dag_100_entry_47[63:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_4)) begin
+		dag_100_entry_mul_16_16_0_op0[15:0] = dag_100_entry_78_reg[15:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_100_BB_0_S_5)) */ begin
+		dag_100_entry_mul_16_16_0_op0[15:0] = dag_100_entry_78_reg[15:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_1)) begin
+		dag_100_entry_mul_16_16_0_op1[15:0] = dag_100_entry_37_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_2)) begin
+		dag_100_entry_mul_16_16_0_op1[15:0] = dag_100_entry_73_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_3)) begin
+		dag_100_entry_mul_16_16_0_op1[15:0] = dag_100_entry_70_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_4)) begin
+		dag_100_entry_mul_16_16_0_op1[15:0] = dag_100_entry_82_reg[15:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_100_BB_0_S_5)) */ begin
+		dag_100_entry_mul_16_16_0_op1[15:0] = dag_100_entry_74_reg[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_mul_16_16_0[15:0] = (dag_100_entry_mul_16_16_0_op0 * dag_100_entry_mul_16_16_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_2)) begin
+		dag_100_entry_or_16_16_0_op0[15:0] = dag_100_entry_72[15:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_100_BB_0_S_3)) */ begin
+		dag_100_entry_or_16_16_0_op0[15:0] = dag_100_entry_55_reg[15:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_2)) begin
+		dag_100_entry_or_16_16_0_op1[15:0] = dag_100_entry_48[15:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_100_BB_0_S_3)) */ begin
+		dag_100_entry_or_16_16_0_op1[15:0] = dag_100_entry_78_reg[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_or_16_16_0[15:0] = (dag_100_entry_or_16_16_0_op0 | dag_100_entry_or_16_16_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_2)) begin
+		dag_100_entry_mul_32_32_0_op0[31:0] = dag_100_entry_40[63:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_3)) begin
+		dag_100_entry_mul_32_32_0_op0[31:0] = dag_100_entry_63_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_4)) begin
+		dag_100_entry_mul_32_32_0_op0[31:0] = dag_100_entry_61_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_100_BB_0_S_5)) */ begin
+		dag_100_entry_mul_32_32_0_op0[31:0] = dag_100_entry_54_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_2)) begin
+		dag_100_entry_mul_32_32_0_op1[31:0] = dag_100_entry_38_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_3)) begin
+		dag_100_entry_mul_32_32_0_op1[31:0] = dag_100_entry_61_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_100_BB_0_S_4)) begin
+		dag_100_entry_mul_32_32_0_op1[31:0] = dag_100_entry_63_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_100_BB_0_S_5)) */ begin
+		dag_100_entry_mul_32_32_0_op1[31:0] = dag_100_entry_54_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_100_entry_mul_32_32_0[31:0] = (dag_100_entry_mul_32_32_0_op0 * dag_100_entry_mul_32_32_0_op1);
+end
+
+always @ (*) begin
+	dag_100_entry_add_32_32_0_op0[15:0] = dag_100_entry_84_reg[15:0];
+end
+
+always @ (*) begin
+	dag_100_entry_add_32_32_0_op1[15:0] = dag_100_entry_86[63:0];
+end
+
+always @ (*) begin
+	dag_100_entry_add_32_32_0[16:0] = (dag_100_entry_add_32_32_0_op0 + dag_100_entry_add_32_32_0_op1);
+end
+
+always @ (*) begin
+	dag_100_entry_18[7:0] = dag_100_entry_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_100_entry_28[63:0] = (dag_100_entry_21 + dag_100_entry_10);
+end
+
+always @ (*) begin
+	dag_100_entry_30[63:0] = (dag_100_entry_21 - dag_100_entry_11);
+end
+
+always @ (*) begin
+	dag_100_entry_24[63:0] = (dag_100_entry_10_reg * arg_6);
+end
+
+always @ (*) begin
+	dag_100_entry_52[15:0] = (dag_100_entry_38 ^ dag_100_entry_35);
+end
+
+always @ (*) begin
+	dag_100_entry_80[63:0] = (dag_100_entry_60 ^ dag_100_entry_53);
+end
+
+always @ (*) begin
+	dag_100_entry_57[63:0] = (dag_100_entry_47 ^ dag_100_entry_45_reg);
+end
+
+always @ (*) begin
+	dag_100_entry_71[63:0] = (dag_100_entry_41_reg + dag_100_entry_47);
+end
+
+always @ (*) begin
+	dag_100_entry_91[15:0] = (dag_100_entry_73_reg ^ dag_100_entry_82);
+end
+
+always @ (*) begin
+	dag_100_entry_101[15:0] = (dag_100_entry_88_reg - dag_100_entry_82);
+end
+
+always @ (*) begin
+	dag_100_entry_68[31:0] = (dag_100_entry_65 ^ dag_100_entry_64_reg);
+end
+
+always @ (*) begin
+	dag_100_entry_97[15:0] = (dag_100_entry_82_reg ^ dag_100_entry_93);
+end
+
+always @ (*) begin
+	dag_100_entry_98[7:0] = dag_100_entry_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_100_entry_103[7:0] = (dag_100_entry_83_reg ^ dag_100_entry_87);
+end
+
+always @ (*) begin
+	dag_100_entry_66[31:0] = dag_100_entry_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_100_entry_89[63:0] = (dag_100_entry_70_reg ^ dag_100_entry_86);
+end
+
+always @ (*) begin
+	dag_100_entry_92[7:0] = dag_100_entry_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_100_entry_96[63:0] = (dag_100_entry_95 + dag_100_entry_60_reg);
+end
+
+always @ (*) begin
+	dag_100_entry_99[15:0] = dag_100_entry_add_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS)) begin
+		finish <= 1'd0;
+	end
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_6)) begin
+		finish <= 1'd1;
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS)) begin
+		return_val[63:0] <= 64'd0;
+	end
+	if ((cur_state == BPHLS_F_dag_100_BB_0_S_6)) begin
+		return_val[63:0] <= dag_100_entry_110_reg[63:0];
+	end
+end
+
+endmodule
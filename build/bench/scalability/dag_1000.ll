@@ -0,0 +1,1081 @@
+; ModuleID = 'dag_1000'
+source_filename = "dag_1000"
+
+define i64 @dag_1000(i8 %0, i8 %1, i16 %2, i16 %3, i32 %4, i32 %5, i64 %6, i64 %7) {
+entry:
+  %8 = add i16 %2, %2
+  %9 = zext i8 %1 to i32
+  %10 = or i32 %4, %9
+  %11 = xor i64 %7, %6
+  %12 = mul i8 %1, %0
+  %13 = and i8 %12, %12
+  %14 = zext i16 %3 to i32
+  %15 = xor i32 %5, %14
+  %16 = and i16 %8, %8
+  %17 = sub i8 %12, %13
+  %18 = add i16 %3, %2
+  %19 = add i64 %7, %6
+  %20 = add i8 %0, %0
+  %21 = xor i16 %16, %18
+  %22 = or i8 %13, %1
+  %23 = sub i64 %19, %19
+  %24 = or i8 %12, %1
+  %25 = add i8 %13, %13
+  %26 = mul i64 %11, %6
+  %27 = sub i32 %5, %4
+  %28 = and i32 %27, %4
+  %29 = and i32 %27, %10
+  %30 = add i64 %23, %11
+  %31 = and i16 %3, %21
+  %32 = zext i8 %12 to i64
+  %33 = sub i64 %23, %32
+  %34 = xor i32 %10, %5
+  %35 = mul i8 %1, %22
+  %36 = zext i8 %24 to i64
+  %37 = and i64 %19, %36
+  %38 = xor i32 %28, %10
+  %39 = add i16 %2, %16
+  %40 = or i64 %19, %11
+  %41 = xor i8 %13, %24
+  %42 = zext i8 %41 to i16
+  %43 = mul i16 %39, %42
+  %44 = xor i32 %28, %29
+  %45 = or i64 %37, %37
+  %46 = zext i32 %34 to i64
+  %47 = xor i64 %40, %46
+  %48 = and i8 %13, %13
+  %49 = sub i32 %44, %15
+  %50 = and i8 %25, %17
+  %51 = mul i64 %47, %23
+  %52 = add i8 %41, %48
+  %53 = zext i8 %35 to i64
+  %54 = or i64 %45, %53
+  %55 = and i16 %21, %39
+  %56 = or i8 %22, %50
+  %57 = sub i32 %28, %34
+  %58 = xor i64 %51, %47
+  %59 = xor i16 %43, %39
+  %60 = zext i16 %43 to i64
+  %61 = mul i64 %45, %60
+  %62 = or i32 %49, %29
+  %63 = xor i16 %16, %31
+  %64 = add i8 %25, %50
+  %65 = xor i64 %54, %51
+  %66 = add i16 %39, %21
+  %67 = add i8 %52, %48
+  %68 = add i64 %51, %58
+  %69 = xor i32 %38, %29
+  %70 = and i8 %64, %35
+  %71 = and i32 %29, %34
+  %72 = mul i32 %71, %69
+  %73 = mul i32 %69, %71
+  %74 = mul i32 %62, %62
+  %75 = mul i8 %41, %41
+  %76 = xor i32 %73, %72
+  %77 = and i32 %62, %57
+  %78 = sub i64 %45, %51
+  %79 = add i64 %47, %54
+  %80 = add i16 %66, %21
+  %81 = xor i16 %66, %63
+  %82 = add i16 %55, %39
+  %83 = and i8 %64, %67
+  %84 = and i32 %71, %69
+  %85 = xor i32 %73, %84
+  %86 = mul i16 %80, %81
+  %87 = or i16 %80, %55
+  %88 = xor i64 %68, %61
+  %89 = or i16 %63, %86
+  %90 = add i16 %81, %89
+  %91 = sub i8 %50, %50
+  %92 = mul i64 %54, %78
+  %93 = mul i16 %86, %82
+  %94 = and i64 %61, %92
+  %95 = sub i8 %56, %75
+  %96 = xor i16 %86, %87
+  %97 = xor i64 %78, %94
+  %98 = or i32 %71, %77
+  %99 = xor i16 %81, %90
+  %100 = and i8 %67, %67
+  %101 = mul i16 %86, %90
+  %102 = xor i32 %72, %98
+  %103 = and i64 %94, %78
+  %104 = add i64 %103, %68
+  %105 = xor i16 %90, %101
+  %106 = mul i8 %91, %83
+  %107 = add i16 %89, %93
+  %108 = add i8 %70, %95
+  %109 = sub i16 %96, %90
+  %110 = add i64 %92, %94
+  %111 = xor i8 %91, %95
+  %112 = or i8 %91, %108
+  %113 = sub i32 %85, %102
+  %114 = add i16 %101, %96
+  %115 = xor i8 %83, %112
+  %116 = sub i32 %85, %113
+  %117 = sub i16 %107, %109
+  %118 = or i32 %76, %102
+  %119 = add i32 %85, %98
+  %120 = sub i16 %117, %114
+  %121 = zext i8 %115 to i64
+  %122 = add i64 %110, %121
+  %123 = sub i8 %111, %95
+  %124 = add i16 %120, %120
+  %125 = xor i16 %117, %120
+  %126 = mul i16 %125, %114
+  %127 = mul i8 %112, %112
+  %128 = xor i32 %102, %85
+  %129 = mul i8 %111, %127
+  %130 = add i8 %108, %112
+  %131 = add i32 %102, %116
+  %132 = xor i16 %109, %117
+  %133 = sub i16 %114, %109
+  %134 = add i8 %127, %130
+  %135 = add i8 %134, %123
+  %136 = add i32 %119, %118
+  %137 = add i16 %117, %126
+  %138 = mul i32 %116, %128
+  %139 = sub i8 %123, %129
+  %140 = add i32 %136, %128
+  %141 = zext i16 %132 to i32
+  %142 = add i32 %116, %141
+  %143 = mul i32 %138, %119
+  %144 = add i8 %130, %127
+  %145 = or i8 %144, %134
+  %146 = mul i16 %120, %126
+  %147 = mul i8 %135, %145
+  %148 = mul i64 %122, %104
+  %149 = xor i32 %119, %138
+  %150 = and i8 %139, %147
+  %151 = add i32 %136, %143
+  %152 = or i64 %94, %148
+  %153 = zext i16 %125 to i64
+  %154 = mul i64 %152, %153
+  %155 = sub i32 %143, %138
+  %156 = add i32 %138, %138
+  %157 = add i64 %154, %122
+  %158 = zext i8 %139 to i16
+  %159 = add i16 %124, %158
+  %160 = and i8 %130, %139
+  %161 = mul i64 %104, %154
+  %162 = add i32 %140, %151
+  %163 = and i16 %125, %133
+  %164 = or i8 %134, %147
+  %165 = add i16 %163, %137
+  %166 = xor i32 %162, %142
+  %167 = mul i32 %149, %149
+  %168 = or i16 %159, %146
+  %169 = mul i8 %147, %135
+  %170 = mul i32 %167, %162
+  %171 = xor i64 %104, %161
+  %172 = sub i64 %171, %152
+  %173 = xor i32 %166, %162
+  %174 = sub i32 %166, %151
+  %175 = or i64 %122, %172
+  %176 = xor i8 %147, %160
+  %177 = sub i16 %159, %163
+  %178 = or i8 %164, %144
+  %179 = and i32 %174, %166
+  %180 = zext i8 %145 to i64
+  %181 = add i64 %157, %180
+  %182 = xor i64 %152, %152
+  %183 = mul i32 %156, %170
+  %184 = zext i16 %163 to i64
+  %185 = add i64 %171, %184
+  %186 = zext i16 %159 to i64
+  %187 = add i64 %175, %186
+  %188 = or i16 %163, %133
+  %189 = add i64 %187, %181
+  %190 = xor i16 %188, %188
+  %191 = mul i64 %181, %171
+  %192 = add i32 %170, %166
+  %193 = sub i64 %185, %189
+  %194 = sub i8 %169, %145
+  %195 = add i8 %147, %160
+  %196 = or i16 %177, %190
+  %197 = and i32 %174, %167
+  %198 = add i64 %181, %185
+  %199 = zext i16 %196 to i64
+  %200 = and i64 %182, %199
+  %201 = add i64 %185, %189
+  %202 = and i8 %150, %194
+  %203 = or i32 %174, %173
+  %204 = or i8 %160, %169
+  %205 = xor i16 %163, %159
+  %206 = sub i32 %173, %174
+  %207 = sub i16 %163, %165
+  %208 = or i8 %194, %204
+  %209 = sub i16 %196, %205
+  %210 = add i16 %209, %190
+  %211 = xor i32 %203, %192
+  %212 = mul i8 %204, %178
+  %213 = sub i64 %193, %191
+  %214 = sub i32 %206, %206
+  %215 = zext i8 %195 to i16
+  %216 = add i16 %207, %215
+  %217 = and i32 %203, %206
+  %218 = add i8 %195, %204
+  %219 = add i8 %194, %204
+  %220 = add i32 %192, %214
+  %221 = xor i8 %212, %195
+  %222 = mul i8 %195, %219
+  %223 = or i16 %210, %205
+  %224 = zext i8 %219 to i16
+  %225 = add i16 %205, %224
+  %226 = add i32 %203, %192
+  %227 = and i32 %226, %226
+  %228 = add i32 %217, %226
+  %229 = add i16 %223, %225
+  %230 = mul i8 %222, %219
+  %231 = add i16 %210, %216
+  %232 = or i32 %220, %220
+  %233 = or i32 %220, %220
+  %234 = and i32 %232, %227
+  %235 = and i64 %191, %193
+  %236 = sub i16 %207, %225
+  %237 = sub i8 %230, %222
+  %238 = add i16 %231, %210
+  %239 = or i8 %237, %208
+  %240 = add i8 %222, %219
+  %241 = mul i64 %200, %198
+  %242 = sub i8 %219, %218
+  %243 = or i32 %226, %220
+  %244 = add i32 %228, %232
+  %245 = and i8 %240, %219
+  %246 = add i8 %237, %230
+  %247 = or i32 %232, %227
+  %248 = xor i8 %222, %240
+  %249 = add i8 %245, %245
+  %250 = add i32 %227, %244
+  %251 = add i8 %246, %248
+  %252 = add i32 %243, %243
+  %253 = add i16 %238, %210
+  %254 = mul i64 %201, %241
+  %255 = add i64 %241, %241
+  %256 = add i32 %243, %252
+  %257 = sub i64 %200, %200
+  %258 = xor i64 %255, %255
+  %259 = mul i32 %244, %233
+  %260 = or i32 %250, %244
+  %261 = and i32 %252, %243
+  %262 = sub i32 %250, %256
+  %263 = or i16 %216, %231
+  %264 = add i8 %239, %249
+  %265 = and i16 %223, %238
+  %266 = xor i32 %261, %261
+  %267 = add i16 %236, %231
+  %268 = sub i64 %257, %213
+  %269 = or i64 %241, %258
+  %270 = and i32 %252, %260
+  %271 = add i8 %242, %246
+  %272 = add i16 %265, %238
+  %273 = add i32 %266, %261
+  %274 = xor i64 %254, %269
+  %275 = and i32 %261, %260
+  %276 = xor i64 %269, %241
+  %277 = mul i8 %249, %249
+  %278 = add i32 %273, %259
+  %279 = xor i32 %273, %278
+  %280 = add i64 %276, %258
+  %281 = xor i64 %280, %258
+  %282 = add i16 %253, %272
+  %283 = add i64 %258, %257
+  %284 = sub i8 %271, %245
+  %285 = and i8 %248, %246
+  %286 = and i32 %278, %270
+  %287 = add i8 %251, %277
+  %288 = and i8 %271, %284
+  %289 = or i32 %266, %262
+  %290 = xor i16 %265, %253
+  %291 = sub i8 %288, %284
+  %292 = and i32 %278, %286
+  %293 = sub i16 %253, %265
+  %294 = mul i8 %288, %277
+  %295 = add i16 %290, %267
+  %296 = xor i32 %270, %289
+  %297 = sub i16 %295, %282
+  %298 = sub i64 %258, %280
+  %299 = or i32 %296, %286
+  %300 = or i32 %299, %292
+  %301 = and i32 %289, %289
+  %302 = zext i8 %288 to i16
+  %303 = mul i16 %282, %302
+  %304 = sub i8 %271, %277
+  %305 = add i64 %274, %276
+  %306 = xor i64 %298, %274
+  %307 = sub i16 %303, %290
+  %308 = add i8 %285, %287
+  %309 = xor i16 %282, %293
+  %310 = sub i32 %300, %289
+  %311 = add i64 %280, %281
+  %312 = zext i8 %291 to i64
+  %313 = and i64 %298, %312
+  %314 = add i16 %282, %309
+  %315 = zext i8 %284 to i32
+  %316 = xor i32 %301, %315
+  %317 = add i32 %300, %296
+  %318 = and i32 %310, %310
+  %319 = xor i16 %297, %314
+  %320 = or i16 %307, %295
+  %321 = add i64 %306, %311
+  %322 = or i64 %313, %321
+  %323 = zext i16 %309 to i64
+  %324 = add i64 %283, %323
+  %325 = xor i32 %316, %300
+  %326 = add i16 %314, %319
+  %327 = sub i16 %297, %320
+  %328 = mul i32 %317, %301
+  %329 = sub i32 %328, %301
+  %330 = add i8 %288, %291
+  %331 = zext i8 %304 to i32
+  %332 = mul i32 %328, %331
+  %333 = xor i16 %307, %309
+  %334 = mul i32 %317, %325
+  %335 = or i64 %313, %313
+  %336 = add i16 %333, %326
+  %337 = sub i8 %330, %330
+  %338 = and i8 %304, %288
+  %339 = or i64 %311, %311
+  %340 = mul i64 %322, %322
+  %341 = add i8 %294, %308
+  %342 = add i32 %329, %332
+  %343 = zext i16 %320 to i64
+  %344 = add i64 %324, %343
+  %345 = add i16 %336, %327
+  %346 = or i16 %327, %320
+  %347 = add i16 %345, %346
+  %348 = add i32 %317, %332
+  %349 = mul i16 %345, %347
+  %350 = or i8 %294, %291
+  %351 = add i8 %350, %330
+  %352 = add i32 %328, %325
+  %353 = mul i32 %329, %328
+  %354 = add i16 %333, %347
+  %355 = xor i64 %322, %344
+  %356 = or i64 %321, %344
+  %357 = add i64 %344, %356
+  %358 = and i16 %349, %327
+  %359 = add i64 %335, %344
+  %360 = xor i64 %355, %356
+  %361 = or i8 %330, %337
+  %362 = or i8 %341, %361
+  %363 = and i16 %347, %345
+  %364 = and i64 %355, %355
+  %365 = xor i32 %332, %334
+  %366 = mul i64 %360, %357
+  %367 = zext i32 %348 to i64
+  %368 = mul i64 %366, %367
+  %369 = zext i16 %363 to i64
+  %370 = add i64 %356, %369
+  %371 = xor i8 %350, %362
+  %372 = add i32 %332, %352
+  %373 = add i8 %351, %361
+  %374 = and i32 %365, %372
+  %375 = sub i16 %354, %345
+  %376 = mul i32 %374, %365
+  %377 = xor i8 %361, %373
+  %378 = add i8 %373, %341
+  %379 = mul i16 %375, %349
+  %380 = xor i64 %356, %360
+  %381 = zext i8 %371 to i64
+  %382 = mul i64 %370, %381
+  %383 = or i64 %364, %380
+  %384 = sub i8 %377, %378
+  %385 = and i8 %378, %351
+  %386 = mul i64 %383, %366
+  %387 = sub i32 %342, %353
+  %388 = xor i16 %358, %354
+  %389 = sub i64 %383, %364
+  %390 = mul i32 %376, %353
+  %391 = and i32 %353, %390
+  %392 = add i16 %375, %379
+  %393 = and i64 %368, %368
+  %394 = zext i16 %375 to i32
+  %395 = sub i32 %353, %394
+  %396 = add i16 %392, %379
+  %397 = add i16 %375, %396
+  %398 = add i32 %365, %395
+  %399 = mul i16 %358, %388
+  %400 = or i64 %382, %386
+  %401 = or i32 %374, %391
+  %402 = sub i64 %380, %382
+  %403 = sub i64 %400, %383
+  %404 = xor i32 %374, %387
+  %405 = mul i64 %402, %402
+  %406 = add i64 %400, %405
+  %407 = mul i8 %362, %378
+  %408 = add i8 %407, %371
+  %409 = add i32 %398, %404
+  %410 = add i32 %401, %387
+  %411 = add i16 %392, %379
+  %412 = add i64 %405, %406
+  %413 = and i32 %401, %390
+  %414 = mul i32 %410, %391
+  %415 = and i8 %377, %373
+  %416 = xor i8 %378, %377
+  %417 = zext i8 %378 to i16
+  %418 = mul i16 %397, %417
+  %419 = add i64 %389, %400
+  %420 = add i32 %413, %404
+  %421 = or i8 %416, %378
+  %422 = zext i16 %411 to i64
+  %423 = sub i64 %400, %422
+  %424 = add i16 %379, %379
+  %425 = and i8 %407, %384
+  %426 = sub i8 %385, %425
+  %427 = mul i32 %414, %413
+  %428 = mul i8 %426, %416
+  %429 = add i16 %392, %396
+  %430 = and i16 %411, %392
+  %431 = sub i64 %403, %419
+  %432 = or i8 %408, %415
+  %433 = sub i64 %412, %412
+  %434 = sub i8 %428, %415
+  %435 = add i64 %419, %405
+  %436 = mul i32 %404, %420
+  %437 = or i64 %419, %433
+  %438 = xor i8 %434, %425
+  %439 = or i8 %428, %426
+  %440 = sub i8 %439, %426
+  %441 = or i32 %409, %414
+  %442 = and i8 %440, %434
+  %443 = and i16 %418, %396
+  %444 = add i32 %413, %410
+  %445 = add i64 %437, %419
+  %446 = add i8 %440, %442
+  %447 = xor i8 %439, %439
+  %448 = and i16 %418, %399
+  %449 = and i8 %439, %439
+  %450 = and i8 %449, %438
+  %451 = xor i16 %443, %399
+  %452 = zext i8 %440 to i32
+  %453 = add i32 %413, %452
+  %454 = add i64 %423, %445
+  %455 = or i32 %413, %427
+  %456 = xor i16 %424, %411
+  %457 = add i32 %420, %420
+  %458 = or i16 %456, %429
+  %459 = xor i32 %427, %427
+  %460 = add i8 %442, %449
+  %461 = sub i32 %459, %444
+  %462 = mul i16 %429, %443
+  %463 = add i16 %456, %443
+  %464 = add i16 %448, %463
+  %465 = or i32 %444, %459
+  %466 = zext i16 %451 to i64
+  %467 = sub i64 %435, %466
+  %468 = add i8 %447, %460
+  %469 = and i16 %463, %448
+  %470 = add i32 %444, %457
+  %471 = mul i16 %451, %448
+  %472 = and i32 %457, %457
+  %473 = add i16 %462, %456
+  %474 = sub i16 %462, %469
+  %475 = or i64 %445, %454
+  %476 = add i32 %455, %457
+  %477 = sub i16 %458, %464
+  %478 = add i16 %462, %469
+  %479 = and i8 %449, %449
+  %480 = xor i16 %471, %471
+  %481 = and i32 %476, %472
+  %482 = add i64 %445, %454
+  %483 = mul i16 %473, %469
+  %484 = add i8 %450, %468
+  %485 = and i16 %480, %478
+  %486 = sub i32 %459, %476
+  %487 = sub i32 %470, %459
+  %488 = add i16 %483, %478
+  %489 = add i16 %477, %478
+  %490 = mul i32 %465, %476
+  %491 = zext i16 %474 to i32
+  %492 = add i32 %487, %491
+  %493 = xor i8 %450, %479
+  %494 = add i8 %484, %468
+  %495 = sub i16 %489, %480
+  %496 = add i16 %477, %485
+  %497 = mul i8 %449, %484
+  %498 = or i32 %486, %487
+  %499 = zext i8 %494 to i16
+  %500 = and i16 %483, %499
+  %501 = xor i8 %468, %450
+  %502 = xor i8 %460, %497
+  %503 = sub i8 %494, %501
+  %504 = mul i16 %485, %485
+  %505 = xor i16 %488, %504
+  %506 = add i64 %435, %435
+  %507 = xor i8 %479, %484
+  %508 = and i32 %492, %472
+  %509 = xor i32 %486, %487
+  %510 = mul i8 %484, %497
+  %511 = add i64 %467, %435
+  %512 = xor i8 %501, %503
+  %513 = or i16 %488, %500
+  %514 = and i64 %437, %445
+  %515 = or i16 %489, %489
+  %516 = and i32 %509, %498
+  %517 = and i32 %498, %492
+  %518 = and i32 %508, %498
+  %519 = xor i16 %513, %515
+  %520 = or i8 %501, %501
+  %521 = or i32 %509, %508
+  %522 = and i64 %482, %445
+  %523 = xor i8 %507, %512
+  %524 = add i8 %507, %510
+  %525 = mul i32 %498, %508
+  %526 = add i32 %525, %508
+  %527 = sub i64 %475, %522
+  %528 = or i32 %508, %518
+  %529 = xor i16 %515, %519
+  %530 = mul i16 %505, %515
+  %531 = add i64 %506, %506
+  %532 = mul i32 %517, %517
+  %533 = zext i8 %507 to i16
+  %534 = mul i16 %504, %533
+  %535 = and i8 %503, %510
+  %536 = mul i8 %507, %512
+  %537 = add i64 %514, %514
+  %538 = add i32 %526, %532
+  %539 = or i64 %537, %514
+  %540 = xor i64 %522, %537
+  %541 = mul i32 %532, %526
+  %542 = sub i64 %514, %537
+  %543 = add i64 %539, %539
+  %544 = xor i16 %513, %513
+  %545 = sub i8 %523, %523
+  %546 = or i32 %521, %521
+  %547 = sub i8 %536, %545
+  %548 = sub i32 %541, %528
+  %549 = add i16 %515, %519
+  %550 = xor i64 %540, %542
+  %551 = add i16 %530, %530
+  %552 = add i32 %548, %525
+  %553 = sub i32 %532, %546
+  %554 = mul i64 %550, %542
+  %555 = sub i32 %552, %546
+  %556 = or i16 %544, %530
+  %557 = zext i8 %523 to i64
+  %558 = or i64 %554, %557
+  %559 = or i16 %519, %534
+  %560 = add i8 %536, %535
+  %561 = mul i64 %543, %540
+  %562 = or i32 %548, %548
+  %563 = xor i8 %520, %520
+  %564 = add i64 %558, %558
+  %565 = and i16 %549, %530
+  %566 = and i32 %538, %541
+  %567 = mul i8 %563, %545
+  %568 = add i32 %541, %546
+  %569 = add i32 %553, %568
+  %570 = add i64 %542, %542
+  %571 = zext i8 %567 to i32
+  %572 = and i32 %552, %571
+  %573 = add i8 %560, %560
+  %574 = and i16 %530, %559
+  %575 = xor i64 %558, %561
+  %576 = or i64 %558, %570
+  %577 = sub i32 %552, %562
+  %578 = add i32 %553, %568
+  %579 = mul i32 %569, %566
+  %580 = and i32 %566, %578
+  %581 = zext i8 %567 to i64
+  %582 = xor i64 %576, %581
+  %583 = xor i8 %563, %535
+  %584 = mul i64 %558, %564
+  %585 = mul i16 %534, %551
+  %586 = mul i64 %561, %582
+  %587 = add i16 %549, %574
+  %588 = mul i8 %563, %583
+  %589 = xor i8 %563, %547
+  %590 = sub i16 %549, %559
+  %591 = add i8 %560, %563
+  %592 = zext i16 %590 to i32
+  %593 = or i32 %572, %592
+  %594 = zext i16 %551 to i64
+  %595 = add i64 %584, %594
+  %596 = or i8 %573, %567
+  %597 = and i8 %591, %591
+  %598 = add i16 %590, %587
+  %599 = add i32 %577, %572
+  %600 = xor i8 %588, %596
+  %601 = mul i32 %572, %579
+  %602 = and i16 %585, %565
+  %603 = and i32 %580, %580
+  %604 = add i64 %564, %595
+  %605 = xor i16 %587, %602
+  %606 = xor i64 %576, %595
+  %607 = xor i8 %596, %600
+  %608 = add i64 %604, %576
+  %609 = xor i16 %598, %605
+  %610 = zext i8 %596 to i16
+  %611 = add i16 %598, %610
+  %612 = xor i8 %588, %597
+  %613 = mul i16 %587, %602
+  %614 = add i16 %605, %590
+  %615 = mul i64 %608, %582
+  %616 = sub i32 %578, %593
+  %617 = add i64 %582, %615
+  %618 = and i16 %598, %602
+  %619 = mul i64 %606, %595
+  %620 = add i8 %597, %596
+  %621 = zext i8 %620 to i64
+  %622 = add i64 %606, %621
+  %623 = add i32 %580, %580
+  %624 = add i8 %620, %620
+  %625 = and i16 %613, %611
+  %626 = sub i64 %604, %595
+  %627 = xor i16 %618, %613
+  %628 = add i64 %606, %626
+  %629 = and i8 %624, %600
+  %630 = and i64 %608, %626
+  %631 = xor i32 %616, %623
+  %632 = or i16 %609, %627
+  %633 = add i16 %632, %609
+  %634 = or i8 %620, %612
+  %635 = xor i32 %580, %599
+  %636 = add i32 %631, %631
+  %637 = and i64 %619, %628
+  %638 = sub i16 %618, %625
+  %639 = zext i32 %635 to i64
+  %640 = or i64 %628, %639
+  %641 = xor i64 %640, %622
+  %642 = sub i64 %637, %622
+  %643 = sub i64 %630, %640
+  %644 = or i16 %613, %614
+  %645 = zext i16 %627 to i64
+  %646 = add i64 %642, %645
+  %647 = zext i32 %635 to i64
+  %648 = add i64 %642, %647
+  %649 = mul i8 %607, %607
+  %650 = and i8 %624, %620
+  %651 = add i32 %623, %616
+  %652 = sub i32 %623, %635
+  %653 = mul i32 %652, %616
+  %654 = or i64 %642, %646
+  %655 = mul i8 %612, %649
+  %656 = mul i64 %646, %654
+  %657 = add i64 %642, %654
+  %658 = and i32 %623, %635
+  %659 = add i16 %618, %627
+  %660 = add i64 %642, %642
+  %661 = and i8 %650, %624
+  %662 = and i32 %652, %631
+  %663 = and i16 %618, %632
+  %664 = sub i16 %632, %632
+  %665 = add i32 %658, %652
+  %666 = sub i32 %662, %665
+  %667 = xor i16 %663, %632
+  %668 = add i64 %654, %648
+  %669 = or i8 %634, %655
+  %670 = add i8 %649, %650
+  %671 = or i32 %662, %666
+  %672 = and i32 %671, %666
+  %673 = add i32 %653, %652
+  %674 = sub i64 %654, %654
+  %675 = add i8 %661, %649
+  %676 = add i16 %664, %667
+  %677 = xor i64 %646, %654
+  %678 = add i8 %661, %650
+  %679 = add i8 %678, %655
+  %680 = xor i32 %666, %662
+  %681 = and i8 %678, %669
+  %682 = add i8 %681, %669
+  %683 = and i32 %672, %665
+  %684 = or i64 %648, %677
+  %685 = sub i8 %669, %678
+  %686 = or i16 %638, %663
+  %687 = mul i32 %680, %666
+  %688 = add i16 %638, %664
+  %689 = add i64 %684, %677
+  %690 = or i8 %679, %670
+  %691 = zext i8 %682 to i64
+  %692 = add i64 %689, %691
+  %693 = add i16 %676, %686
+  %694 = or i8 %670, %682
+  %695 = zext i8 %682 to i16
+  %696 = add i16 %663, %695
+  %697 = or i8 %694, %694
+  %698 = add i8 %690, %682
+  %699 = xor i16 %696, %663
+  %700 = mul i32 %665, %683
+  %701 = sub i16 %699, %667
+  %702 = sub i32 %672, %680
+  %703 = and i8 %682, %682
+  %704 = mul i16 %696, %667
+  %705 = sub i16 %701, %704
+  %706 = or i16 %701, %705
+  %707 = mul i32 %680, %671
+  %708 = xor i16 %696, %699
+  %709 = or i32 %683, %683
+  %710 = xor i64 %677, %677
+  %711 = mul i64 %692, %674
+  %712 = and i16 %704, %699
+  %713 = and i8 %682, %690
+  %714 = or i16 %696, %712
+  %715 = and i8 %698, %698
+  %716 = zext i8 %713 to i64
+  %717 = mul i64 %674, %716
+  %718 = sub i32 %673, %707
+  %719 = add i64 %692, %689
+  %720 = zext i16 %708 to i32
+  %721 = mul i32 %718, %720
+  %722 = add i16 %705, %706
+  %723 = and i16 %705, %708
+  %724 = sub i8 %690, %698
+  %725 = add i32 %721, %709
+  %726 = xor i32 %718, %702
+  %727 = or i16 %722, %704
+  %728 = sub i8 %703, %697
+  %729 = mul i16 %712, %706
+  %730 = sub i16 %727, %706
+  %731 = xor i8 %724, %715
+  %732 = xor i64 %717, %711
+  %733 = add i64 %732, %689
+  %734 = or i32 %721, %700
+  %735 = and i64 %733, %710
+  %736 = xor i8 %697, %697
+  %737 = add i8 %731, %736
+  %738 = sub i32 %734, %709
+  %739 = mul i8 %728, %715
+  %740 = add i16 %712, %708
+  %741 = xor i16 %712, %727
+  %742 = add i16 %730, %730
+  %743 = zext i8 %724 to i64
+  %744 = add i64 %692, %743
+  %745 = and i64 %744, %744
+  %746 = sub i8 %713, %736
+  %747 = xor i32 %721, %718
+  %748 = add i16 %727, %723
+  %749 = zext i32 %721 to i64
+  %750 = add i64 %735, %749
+  %751 = sub i16 %741, %729
+  %752 = add i8 %724, %728
+  %753 = xor i8 %739, %752
+  %754 = sub i64 %733, %745
+  %755 = xor i8 %753, %731
+  %756 = add i64 %719, %719
+  %757 = sub i64 %733, %756
+  %758 = sub i32 %709, %718
+  %759 = sub i8 %746, %746
+  %760 = and i64 %750, %745
+  %761 = add i64 %744, %760
+  %762 = mul i8 %752, %739
+  %763 = mul i16 %748, %729
+  %764 = add i64 %745, %745
+  %765 = or i8 %737, %737
+  %766 = xor i16 %740, %730
+  %767 = add i64 %757, %764
+  %768 = add i32 %758, %758
+  %769 = add i8 %753, %755
+  %770 = add i32 %768, %747
+  %771 = mul i32 %738, %770
+  %772 = and i64 %750, %756
+  %773 = zext i32 %770 to i64
+  %774 = add i64 %754, %773
+  %775 = sub i64 %767, %774
+  %776 = xor i64 %760, %760
+  %777 = or i8 %762, %752
+  %778 = add i8 %755, %777
+  %779 = mul i32 %734, %734
+  %780 = add i32 %779, %758
+  %781 = add i16 %730, %748
+  %782 = sub i32 %771, %738
+  %783 = add i32 %747, %768
+  %784 = add i32 %770, %782
+  %785 = mul i8 %777, %765
+  %786 = or i32 %782, %768
+  %787 = and i32 %770, %780
+  %788 = add i8 %755, %777
+  %789 = zext i8 %778 to i16
+  %790 = or i16 %748, %789
+  %791 = xor i64 %772, %774
+  %792 = or i8 %777, %769
+  %793 = add i8 %777, %777
+  %794 = add i8 %792, %769
+  %795 = xor i16 %766, %763
+  %796 = sub i8 %785, %788
+  %797 = add i16 %748, %795
+  %798 = xor i8 %788, %793
+  %799 = add i64 %791, %774
+  %800 = sub i64 %775, %791
+  %801 = mul i16 %781, %781
+  %802 = xor i64 %774, %774
+  %803 = mul i16 %795, %763
+  %804 = add i64 %775, %802
+  %805 = xor i8 %788, %794
+  %806 = and i64 %776, %800
+  %807 = zext i8 %793 to i64
+  %808 = and i64 %800, %807
+  %809 = add i32 %779, %771
+  %810 = xor i16 %797, %781
+  %811 = xor i32 %782, %782
+  %812 = add i32 %811, %784
+  %813 = xor i32 %811, %783
+  %814 = or i8 %792, %785
+  %815 = and i64 %806, %791
+  %816 = and i32 %811, %809
+  %817 = sub i8 %788, %814
+  %818 = add i16 %797, %790
+  %819 = and i64 %804, %800
+  %820 = mul i32 %816, %812
+  %821 = and i64 %804, %806
+  %822 = add i64 %808, %802
+  %823 = add i16 %818, %803
+  %824 = and i16 %810, %801
+  %825 = zext i8 %798 to i32
+  %826 = xor i32 %811, %825
+  %827 = mul i8 %817, %792
+  %828 = and i8 %814, %827
+  %829 = and i32 %826, %816
+  %830 = xor i32 %820, %829
+  %831 = mul i32 %826, %812
+  %832 = zext i8 %794 to i32
+  %833 = or i32 %826, %832
+  %834 = mul i8 %828, %794
+  %835 = add i8 %817, %834
+  %836 = add i64 %815, %815
+  %837 = and i16 %797, %823
+  %838 = mul i8 %798, %805
+  %839 = xor i16 %823, %818
+  %840 = zext i16 %818 to i64
+  %841 = mul i64 %806, %840
+  %842 = and i8 %828, %838
+  %843 = or i64 %819, %806
+  %844 = add i32 %826, %831
+  %845 = sub i64 %822, %836
+  %846 = and i32 %833, %833
+  %847 = or i32 %833, %844
+  %848 = add i32 %844, %846
+  %849 = or i64 %836, %843
+  %850 = mul i8 %834, %817
+  %851 = xor i16 %818, %824
+  %852 = zext i8 %827 to i16
+  %853 = or i16 %839, %852
+  %854 = xor i32 %833, %829
+  %855 = or i64 %836, %822
+  %856 = or i64 %855, %849
+  %857 = or i8 %850, %827
+  %858 = or i64 %856, %822
+  %859 = mul i32 %830, %854
+  %860 = and i16 %824, %839
+  %861 = and i32 %854, %846
+  %862 = xor i32 %847, %833
+  %863 = and i32 %846, %844
+  %864 = xor i16 %823, %837
+  %865 = add i64 %836, %849
+  %866 = add i8 %828, %857
+  %867 = mul i16 %823, %860
+  %868 = xor i16 %853, %867
+  %869 = or i8 %828, %835
+  %870 = xor i64 %845, %865
+  %871 = and i32 %862, %848
+  %872 = sub i64 %845, %858
+  %873 = mul i32 %847, %848
+  %874 = add i8 %838, %834
+  %875 = xor i8 %874, %842
+  %876 = mul i32 %873, %871
+  %877 = mul i64 %849, %855
+  %878 = zext i16 %860 to i64
+  %879 = add i64 %856, %878
+  %880 = add i8 %869, %866
+  %881 = add i8 %874, %874
+  %882 = add i32 %854, %861
+  %883 = zext i8 %869 to i32
+  %884 = add i32 %861, %883
+  %885 = zext i8 %881 to i64
+  %886 = xor i64 %877, %885
+  %887 = mul i16 %851, %864
+  %888 = sub i16 %864, %851
+  %889 = xor i16 %868, %851
+  %890 = sub i16 %860, %888
+  %891 = and i64 %886, %870
+  %892 = add i32 %862, %884
+  %893 = add i32 %863, %876
+  %894 = or i32 %876, %893
+  %895 = and i8 %874, %866
+  %896 = add i64 %879, %872
+  %897 = and i8 %857, %866
+  %898 = xor i16 %889, %888
+  %899 = and i32 %894, %892
+  %900 = add i8 %897, %895
+  %901 = add i32 %893, %884
+  %902 = sub i32 %882, %893
+  %903 = add i64 %872, %896
+  %904 = add i64 %891, %896
+  %905 = mul i64 %896, %886
+  %906 = and i64 %896, %896
+  %907 = zext i32 %902 to i64
+  %908 = or i64 %879, %907
+  %909 = xor i32 %894, %882
+  %910 = xor i32 %909, %902
+  %911 = add i64 %896, %906
+  %912 = and i8 %869, %875
+  %913 = xor i16 %898, %888
+  %914 = mul i64 %911, %911
+  %915 = or i16 %888, %868
+  %916 = and i8 %900, %880
+  %917 = or i8 %916, %880
+  %918 = and i64 %906, %903
+  %919 = xor i32 %893, %901
+  %920 = add i8 %881, %895
+  %921 = add i16 %890, %913
+  %922 = add i32 %899, %909
+  %923 = mul i16 %889, %889
+  %924 = add i8 %916, %920
+  %925 = sub i64 %918, %904
+  %926 = and i8 %897, %900
+  %927 = add i64 %914, %905
+  %928 = and i64 %914, %927
+  %929 = add i16 %898, %888
+  %930 = and i32 %909, %894
+  %931 = sub i32 %901, %919
+  %932 = add i64 %927, %914
+  %933 = and i8 %916, %926
+  %934 = or i64 %927, %932
+  %935 = add i8 %924, %924
+  %936 = or i32 %930, %922
+  %937 = or i8 %920, %926
+  %938 = zext i32 %902 to i64
+  %939 = add i64 %911, %938
+  %940 = sub i64 %927, %918
+  %941 = sub i16 %923, %921
+  %942 = add i64 %939, %928
+  %943 = mul i8 %926, %920
+  %944 = mul i64 %925, %940
+  %945 = add i32 %919, %910
+  %946 = sub i64 %940, %942
+  %947 = add i32 %936, %909
+  %948 = add i16 %915, %923
+  %949 = xor i32 %922, %910
+  %950 = and i16 %913, %929
+  %951 = add i16 %921, %929
+  %952 = add i32 %930, %949
+  %953 = zext i8 %933 to i16
+  %954 = mul i16 %923, %953
+  %955 = or i16 %941, %923
+  %956 = sub i64 %934, %928
+  %957 = or i64 %934, %934
+  %958 = sub i8 %933, %933
+  %959 = add i64 %944, %944
+  %960 = add i32 %930, %949
+  %961 = mul i32 %931, %947
+  %962 = mul i8 %943, %926
+  %963 = or i16 %941, %923
+  %964 = xor i8 %943, %937
+  %965 = add i8 %964, %962
+  %966 = and i8 %935, %935
+  %967 = mul i64 %942, %939
+  %968 = or i64 %940, %942
+  %969 = xor i64 %946, %959
+  %970 = or i16 %948, %941
+  %971 = add i64 %946, %946
+  %972 = mul i64 %971, %956
+  %973 = zext i8 %937 to i32
+  %974 = and i32 %960, %973
+  %975 = add i8 %937, %958
+  %976 = or i16 %954, %963
+  %977 = and i64 %959, %972
+  %978 = mul i8 %964, %937
+  %979 = and i16 %976, %954
+  %980 = add i32 %952, %974
+  %981 = xor i64 %969, %968
+  %982 = xor i64 %959, %972
+  %983 = mul i16 %963, %954
+  %984 = or i8 %943, %943
+  %985 = add i64 %981, %968
+  %986 = sub i64 %982, %982
+  %987 = or i8 %958, %966
+  %988 = add i32 %952, %960
+  %989 = mul i64 %982, %985
+  %990 = and i64 %971, %972
+  %991 = or i64 %977, %977
+  %992 = sub i32 %980, %980
+  %993 = zext i8 %965 to i16
+  %994 = add i16 %976, %993
+  %995 = or i16 %994, %979
+  %996 = add i16 %979, %995
+  %997 = add i8 %978, %965
+  %998 = mul i16 %976, %970
+  %999 = and i16 %983, %998
+  %1000 = add i64 %991, %986
+  %1001 = and i32 %992, %961
+  %1002 = sub i8 %966, %964
+  %1003 = mul i16 %999, %996
+  %1004 = and i8 %1002, %975
+  %1005 = and i8 %978, %978
+  %1006 = mul i64 %982, %989
+  %1007 = sub i16 %983, %994
+  %1008 = mul i8 %1004, %1002
+  %1009 = add i64 %990, %982
+  %1010 = and i16 %996, %996
+  %1011 = add i8 %1002, %997
+  %1012 = sub i8 %1005, %987
+  %1013 = and i64 %989, %1009
+  %1014 = add i32 %952, %988
+  %1015 = xor i64 %991, %1013
+  %1016 = or i32 %1001, %992
+  %1017 = add i64 %1013, %991
+  %1018 = add i16 %995, %994
+  %1019 = add i32 %974, %974
+  %1020 = sub i64 %1017, %1015
+  %1021 = add i16 %998, %995
+  %1022 = or i32 %980, %988
+  %1023 = or i64 %1009, %1013
+  %1024 = mul i8 %1004, %997
+  %1025 = add i16 %1021, %1021
+  %1026 = add i8 %1002, %1004
+  %1027 = or i16 %1025, %1021
+  %1028 = or i64 %1009, %1013
+  %1029 = or i8 %1011, %1008
+  %1030 = add i64 %1028, %1023
+  %1031 = mul i32 %980, %1014
+  %1032 = and i64 %1028, %1015
+  %1033 = add i16 %1003, %1003
+  %1034 = xor i8 %1024, %1024
+  %1035 = add i64 %1015, %1013
+  %1036 = add i8 %1011, %1029
+  %1037 = and i16 %1021, %1025
+  %1038 = mul i32 %988, %1019
+  %1039 = and i16 %1021, %1037
+  %1040 = xor i16 %1039, %1027
+  %1041 = and i16 %1040, %1040
+  %1042 = add i64 %1015, %1020
+  %1043 = add i32 %1038, %1031
+  %1044 = and i64 %1028, %1042
+  %1045 = add i16 %1021, %1037
+  %1046 = mul i8 %1026, %1024
+  %1047 = add i32 %1043, %1001
+  %1048 = and i8 %1024, %1026
+  %1049 = sub i32 %1031, %1047
+  %1050 = and i32 %1038, %1022
+  %1051 = xor i32 %1031, %1031
+  %1052 = add i8 %1046, %1048
+  %1053 = or i16 %1039, %1045
+  %1054 = xor i32 %1051, %1038
+  %1055 = or i8 %1029, %1024
+  %1056 = xor i32 %1049, %1043
+  %1057 = add i16 %1039, %1041
+  %1058 = zext i16 %1053 to i64
+  %1059 = xor i64 %1042, %1058
+  %1060 = add i64 %1044, %1030
+  %1061 = and i8 %1029, %1036
+  %1062 = zext i16 %1040 to i32
+  %1063 = mul i32 %1056, %1062
+  %1064 = sub i16 %1040, %1041
+  %1065 = xor i16 %1040, %1039
+  %1066 = add i8 %1029, %1036
+  %1067 = add i32 %1051, %1054
+  %1068 = sub i8 %1034, %1036
+  %1069 = add i64 %1042, %1035
+  %1070 = xor i64 %1042, %1060
+  %1071 = add i32 %1063, %1050
+  %1072 = mul i32 %1067, %1050
+  %1073 = add i8 %1068, %1066
+  %1074 = or i16 %1065, %1064
+  %1075 = xor i16 %1045, %1065
+  %1076 = zext i8 %1073 to i64
+  %1077 = zext i16 %1075 to i64
+  %1078 = xor i64 %1076, %1077
+  %1079 = zext i32 %1072 to i64
+  %1080 = xor i64 %1078, %1079
+  %1081 = xor i64 %1080, %1070
+  ret i64 %1081
+}
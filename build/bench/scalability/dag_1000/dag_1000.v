@@ -0,0 +1,15901 @@
+module dag_1000
+(
+	input wire  clk,
+	input wire  reset,
+	input wire  start,
+	output reg  finish,
+	output reg [63:0] return_val,
+	input wire [7:0] arg_0,
+	input wire [7:0] arg_1,
+	input wire [15:0] arg_2,
+	input wire [15:0] arg_3,
+	input wire [31:0] arg_4,
+	input wire [31:0] arg_5,
+	input wire [63:0] arg_6,
+	input wire [63:0] arg_7
+);
+
+parameter [6:0] BPHLS = 7'd0;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_0 = 7'd1;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_1 = 7'd2;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_2 = 7'd3;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_3 = 7'd4;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_4 = 7'd5;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_5 = 7'd6;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_6 = 7'd7;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_7 = 7'd8;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_8 = 7'd9;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_9 = 7'd10;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_10 = 7'd11;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_11 = 7'd12;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_12 = 7'd13;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_13 = 7'd14;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_14 = 7'd15;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_15 = 7'd16;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_16 = 7'd17;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_17 = 7'd18;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_18 = 7'd19;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_19 = 7'd20;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_20 = 7'd21;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_21 = 7'd22;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_22 = 7'd23;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_23 = 7'd24;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_24 = 7'd25;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_25 = 7'd26;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_26 = 7'd27;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_27 = 7'd28;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_28 = 7'd29;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_29 = 7'd30;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_30 = 7'd31;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_31 = 7'd32;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_32 = 7'd33;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_33 = 7'd34;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_34 = 7'd35;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_35 = 7'd36;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_36 = 7'd37;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_37 = 7'd38;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_38 = 7'd39;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_39 = 7'd40;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_40 = 7'd41;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_41 = 7'd42;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_42 = 7'd43;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_43 = 7'd44;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_44 = 7'd45;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_45 = 7'd46;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_46 = 7'd47;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_47 = 7'd48;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_48 = 7'd49;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_49 = 7'd50;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_50 = 7'd51;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_51 = 7'd52;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_52 = 7'd53;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_53 = 7'd54;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_54 = 7'd55;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_55 = 7'd56;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_56 = 7'd57;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_57 = 7'd58;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_58 = 7'd59;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_59 = 7'd60;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_60 = 7'd61;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_61 = 7'd62;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_62 = 7'd63;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_63 = 7'd64;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_64 = 7'd65;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_65 = 7'd66;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_66 = 7'd67;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_67 = 7'd68;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_68 = 7'd69;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_69 = 7'd70;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_70 = 7'd71;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_71 = 7'd72;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_72 = 7'd73;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_73 = 7'd74;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_74 = 7'd75;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_75 = 7'd76;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_76 = 7'd77;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_77 = 7'd78;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_78 = 7'd79;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_79 = 7'd80;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_80 = 7'd81;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_81 = 7'd82;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_82 = 7'd83;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_83 = 7'd84;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_84 = 7'd85;
+parameter [6:0] BPHLS_F_dag_1000_BB_0_S_85 = 7'd86;
+
+reg [6:0] cur_state;
+reg [6:0] next_state;
+reg [15:0] dag_1000_entry_8;
+reg [127:0] bp_reg_0;
+reg [15:0] dag_1000_entry_8_reg;
+reg [31:0] dag_1000_entry_9;
+reg [31:0] dag_1000_entry_9_reg;
+reg [63:0] dag_1000_entry_10;
+reg [63:0] dag_1000_entry_10_reg;
+reg [7:0] dag_1000_entry_11;
+reg [7:0] dag_1000_entry_11_reg;
+reg [7:0] dag_1000_entry_12;
+reg [7:0] dag_1000_entry_12_reg;
+reg [31:0] dag_1000_entry_13;
+reg [31:0] bp_reg_11;
+reg [31:0] dag_1000_entry_13_reg;
+reg [15:0] dag_1000_entry_14;
+reg [103:0] bp_reg_1;
+reg [15:0] dag_1000_entry_14_reg;
+reg [7:0] dag_1000_entry_15;
+reg [7:0] dag_1000_entry_15_reg;
+reg [15:0] dag_1000_entry_16;
+reg [15:0] dag_1000_entry_16_reg;
+reg [63:0] dag_1000_entry_17;
+reg [63:0] dag_1000_entry_17_reg;
+reg [15:0] dag_1000_entry_19;
+reg [64:0] bp_reg_12;
+reg [15:0] dag_1000_entry_19_reg;
+reg [7:0] dag_1000_entry_20;
+reg [7:0] dag_1000_entry_20_reg;
+reg [63:0] dag_1000_entry_21;
+reg  dag_1000_entry_21_reg;
+reg [7:0] dag_1000_entry_22;
+reg [7:0] dag_1000_entry_22_reg;
+reg [7:0] dag_1000_entry_23;
+reg [7:0] dag_1000_entry_23_reg;
+reg [31:0] dag_1000_entry_25;
+reg [31:0] dag_1000_entry_25_reg;
+reg [31:0] dag_1000_entry_26;
+reg [31:0] dag_1000_entry_26_reg;
+reg [31:0] dag_1000_entry_27;
+reg [31:0] dag_1000_entry_27_reg;
+reg [15:0] dag_1000_entry_29;
+reg [15:0] dag_1000_entry_29_reg;
+reg [31:0] dag_1000_entry_31;
+reg [31:0] bp_reg_13;
+reg [31:0] dag_1000_entry_31_reg;
+reg [7:0] dag_1000_entry_32;
+reg [7:0] dag_1000_entry_32_reg;
+reg [63:0] dag_1000_entry_33;
+reg [152:0] bp_reg_2;
+reg [7:0] dag_1000_entry_33_reg;
+reg [31:0] dag_1000_entry_34;
+reg [31:0] dag_1000_entry_34_reg;
+reg [15:0] dag_1000_entry_35;
+reg [15:0] dag_1000_entry_35_reg;
+reg [63:0] dag_1000_entry_36;
+reg [63:0] dag_1000_entry_36_reg;
+reg [7:0] dag_1000_entry_37;
+reg [7:0] dag_1000_entry_37_reg;
+reg [15:0] dag_1000_entry_38;
+reg [15:0] dag_1000_entry_38_reg;
+reg [31:0] dag_1000_entry_39;
+reg [31:0] dag_1000_entry_39_reg;
+reg [63:0] dag_1000_entry_40;
+reg [7:0] dag_1000_entry_40_reg;
+reg [63:0] dag_1000_entry_41;
+reg [63:0] dag_1000_entry_41_reg;
+reg [7:0] dag_1000_entry_42;
+reg [7:0] dag_1000_entry_42_reg;
+reg [31:0] dag_1000_entry_43;
+reg [31:0] dag_1000_entry_43_reg;
+reg [7:0] dag_1000_entry_44;
+reg [7:0] dag_1000_entry_44_reg;
+reg [63:0] dag_1000_entry_45;
+reg  dag_1000_entry_45_reg;
+reg [7:0] dag_1000_entry_46;
+reg [7:0] dag_1000_entry_46_reg;
+reg [63:0] dag_1000_entry_47;
+reg [7:0] dag_1000_entry_47_reg;
+reg [15:0] dag_1000_entry_48;
+reg [15:0] dag_1000_entry_48_reg;
+reg [7:0] dag_1000_entry_49;
+reg [7:0] dag_1000_entry_49_reg;
+reg [31:0] dag_1000_entry_50;
+reg [31:0] dag_1000_entry_50_reg;
+reg [63:0] dag_1000_entry_51;
+reg [63:0] dag_1000_entry_51_reg;
+reg [63:0] dag_1000_entry_53;
+reg [23:0] dag_1000_entry_53_reg;
+reg [31:0] dag_1000_entry_54;
+reg [31:0] dag_1000_entry_54_reg;
+reg [15:0] dag_1000_entry_55;
+reg [15:0] dag_1000_entry_55_reg;
+reg [7:0] dag_1000_entry_56;
+reg [7:0] dag_1000_entry_56_reg;
+reg [15:0] dag_1000_entry_58;
+reg [15:0] dag_1000_entry_58_reg;
+reg [7:0] dag_1000_entry_59;
+reg [7:0] dag_1000_entry_59_reg;
+reg [63:0] dag_1000_entry_60;
+reg [63:0] dag_1000_entry_60_reg;
+reg [31:0] dag_1000_entry_61;
+reg [31:0] dag_1000_entry_61_reg;
+reg [7:0] dag_1000_entry_62;
+reg [7:0] dag_1000_entry_62_reg;
+reg [31:0] dag_1000_entry_63;
+reg [31:0] dag_1000_entry_63_reg;
+reg [31:0] dag_1000_entry_64;
+reg [31:0] dag_1000_entry_64_reg;
+reg [31:0] dag_1000_entry_65;
+reg [31:0] dag_1000_entry_65_reg;
+reg [7:0] dag_1000_entry_67;
+reg [7:0] dag_1000_entry_67_reg;
+reg [31:0] dag_1000_entry_68;
+reg [31:0] dag_1000_entry_68_reg;
+reg [31:0] dag_1000_entry_69;
+reg [31:0] dag_1000_entry_69_reg;
+reg [63:0] dag_1000_entry_70;
+reg [7:0] dag_1000_entry_70_reg;
+reg [15:0] dag_1000_entry_72;
+reg [15:0] dag_1000_entry_72_reg;
+reg [15:0] dag_1000_entry_73;
+reg [15:0] dag_1000_entry_73_reg;
+reg [15:0] dag_1000_entry_74;
+reg [15:0] dag_1000_entry_74_reg;
+reg [7:0] dag_1000_entry_75;
+reg [7:0] dag_1000_entry_75_reg;
+reg [31:0] dag_1000_entry_76;
+reg [31:0] dag_1000_entry_76_reg;
+reg [31:0] dag_1000_entry_77;
+reg [31:0] dag_1000_entry_77_reg;
+reg [15:0] dag_1000_entry_78;
+reg [15:0] dag_1000_entry_78_reg;
+reg [15:0] dag_1000_entry_79;
+reg [15:0] dag_1000_entry_79_reg;
+reg [15:0] dag_1000_entry_81;
+reg [15:0] dag_1000_entry_81_reg;
+reg [15:0] dag_1000_entry_82;
+reg [15:0] dag_1000_entry_82_reg;
+reg [7:0] dag_1000_entry_83;
+reg  dag_1000_entry_83_reg;
+reg [63:0] dag_1000_entry_84;
+reg [15:0] dag_1000_entry_84_reg;
+reg [15:0] dag_1000_entry_85;
+reg [15:0] dag_1000_entry_85_reg;
+reg [63:0] dag_1000_entry_86;
+reg [31:0] dag_1000_entry_86_reg;
+reg [7:0] dag_1000_entry_87;
+reg [7:0] dag_1000_entry_87_reg;
+reg [15:0] dag_1000_entry_88;
+reg [15:0] dag_1000_entry_88_reg;
+reg [31:0] dag_1000_entry_90;
+reg [31:0] dag_1000_entry_90_reg;
+reg [15:0] dag_1000_entry_93;
+reg [15:0] dag_1000_entry_93_reg;
+reg [31:0] dag_1000_entry_94;
+reg [31:0] dag_1000_entry_94_reg;
+reg [63:0] dag_1000_entry_95;
+reg [7:0] dag_1000_entry_95_reg;
+reg [63:0] dag_1000_entry_96;
+reg [63:0] dag_1000_entry_96_reg;
+reg [15:0] dag_1000_entry_99;
+reg [15:0] dag_1000_entry_99_reg;
+reg [7:0] dag_1000_entry_100;
+reg [7:0] dag_1000_entry_100_reg;
+reg [15:0] dag_1000_entry_101;
+reg [15:0] dag_1000_entry_101_reg;
+reg [63:0] dag_1000_entry_102;
+reg [16:0] dag_1000_entry_102_reg;
+reg [7:0] dag_1000_entry_103;
+reg [7:0] dag_1000_entry_103_reg;
+reg [7:0] dag_1000_entry_104;
+reg [7:0] dag_1000_entry_104_reg;
+reg [31:0] dag_1000_entry_105;
+reg [31:0] dag_1000_entry_105_reg;
+reg [15:0] dag_1000_entry_106;
+reg [15:0] dag_1000_entry_106_reg;
+reg [7:0] dag_1000_entry_107;
+reg [7:0] dag_1000_entry_107_reg;
+reg [31:0] dag_1000_entry_108;
+reg [31:0] dag_1000_entry_108_reg;
+reg [15:0] dag_1000_entry_109;
+reg [15:0] dag_1000_entry_109_reg;
+reg [31:0] dag_1000_entry_110;
+reg [31:0] dag_1000_entry_110_reg;
+reg [31:0] dag_1000_entry_111;
+reg [31:0] dag_1000_entry_111_reg;
+reg [15:0] dag_1000_entry_112;
+reg [15:0] dag_1000_entry_112_reg;
+reg [63:0] dag_1000_entry_113;
+reg [31:0] dag_1000_entry_113_reg;
+reg [7:0] dag_1000_entry_114;
+reg [7:0] dag_1000_entry_114_reg;
+reg [15:0] dag_1000_entry_115;
+reg [15:0] dag_1000_entry_115_reg;
+reg [15:0] dag_1000_entry_116;
+reg [15:0] dag_1000_entry_116_reg;
+reg [15:0] dag_1000_entry_117;
+reg [15:0] dag_1000_entry_117_reg;
+reg [7:0] dag_1000_entry_118;
+reg [7:0] dag_1000_entry_118_reg;
+reg [31:0] dag_1000_entry_119;
+reg [31:0] dag_1000_entry_119_reg;
+reg [7:0] dag_1000_entry_120;
+reg [7:0] dag_1000_entry_120_reg;
+reg [7:0] dag_1000_entry_121;
+reg [7:0] dag_1000_entry_121_reg;
+reg [15:0] dag_1000_entry_123;
+reg [15:0] dag_1000_entry_123_reg;
+reg [15:0] dag_1000_entry_124;
+reg [15:0] dag_1000_entry_124_reg;
+reg [7:0] dag_1000_entry_125;
+reg [7:0] bp_reg_39;
+reg [7:0] dag_1000_entry_125_reg;
+reg [7:0] dag_1000_entry_126;
+reg [7:0] dag_1000_entry_126_reg;
+reg [31:0] dag_1000_entry_127;
+reg [31:0] dag_1000_entry_127_reg;
+reg [15:0] dag_1000_entry_128;
+reg [15:0] dag_1000_entry_128_reg;
+reg [31:0] dag_1000_entry_129;
+reg [31:0] dag_1000_entry_129_reg;
+reg [7:0] dag_1000_entry_130;
+reg [7:0] dag_1000_entry_130_reg;
+reg [31:0] dag_1000_entry_131;
+reg [31:0] dag_1000_entry_131_reg;
+reg [31:0] dag_1000_entry_132;
+reg [31:0] dag_1000_entry_132_reg;
+reg [31:0] dag_1000_entry_133;
+reg [31:0] dag_1000_entry_133_reg;
+reg [7:0] dag_1000_entry_134;
+reg [7:0] dag_1000_entry_134_reg;
+reg [7:0] dag_1000_entry_135;
+reg [7:0] dag_1000_entry_135_reg;
+reg [15:0] dag_1000_entry_136;
+reg [15:0] dag_1000_entry_136_reg;
+reg [7:0] dag_1000_entry_137;
+reg [7:0] bp_reg_40;
+reg [7:0] dag_1000_entry_137_reg;
+reg [63:0] dag_1000_entry_138;
+reg [63:0] dag_1000_entry_138_reg;
+reg [31:0] dag_1000_entry_139;
+reg [31:0] dag_1000_entry_139_reg;
+reg [7:0] dag_1000_entry_140;
+reg [7:0] dag_1000_entry_140_reg;
+reg [31:0] dag_1000_entry_141;
+reg [31:0] dag_1000_entry_141_reg;
+reg [63:0] dag_1000_entry_142;
+reg [159:0] bp_reg_3;
+reg [63:0] dag_1000_entry_142_reg;
+reg [63:0] dag_1000_entry_143;
+reg [63:0] dag_1000_entry_143_reg;
+reg [31:0] dag_1000_entry_145;
+reg [31:0] dag_1000_entry_145_reg;
+reg [15:0] dag_1000_entry_146;
+reg [15:0] dag_1000_entry_146_reg;
+reg [7:0] dag_1000_entry_147;
+reg [7:0] dag_1000_entry_147_reg;
+reg [63:0] dag_1000_entry_148;
+reg [63:0] dag_1000_entry_148_reg;
+reg [31:0] dag_1000_entry_149;
+reg [31:0] dag_1000_entry_149_reg;
+reg [15:0] dag_1000_entry_150;
+reg [15:0] dag_1000_entry_150_reg;
+reg [15:0] dag_1000_entry_151;
+reg [15:0] dag_1000_entry_151_reg;
+reg [31:0] dag_1000_entry_152;
+reg [31:0] dag_1000_entry_152_reg;
+reg [31:0] dag_1000_entry_153;
+reg [31:0] dag_1000_entry_153_reg;
+reg [7:0] dag_1000_entry_155;
+reg [7:0] dag_1000_entry_155_reg;
+reg [31:0] dag_1000_entry_156;
+reg [31:0] dag_1000_entry_156_reg;
+reg [63:0] dag_1000_entry_157;
+reg [63:0] dag_1000_entry_157_reg;
+reg [63:0] dag_1000_entry_158;
+reg [63:0] dag_1000_entry_158_reg;
+reg [31:0] dag_1000_entry_159;
+reg [31:0] dag_1000_entry_159_reg;
+reg [31:0] dag_1000_entry_160;
+reg [31:0] dag_1000_entry_160_reg;
+reg [63:0] dag_1000_entry_161;
+reg [63:0] dag_1000_entry_161_reg;
+reg [15:0] dag_1000_entry_163;
+reg [15:0] dag_1000_entry_163_reg;
+reg [7:0] dag_1000_entry_164;
+reg [7:0] dag_1000_entry_164_reg;
+reg [7:0] dag_1000_entry_165;
+reg [7:0] dag_1000_entry_165_reg;
+reg [63:0] dag_1000_entry_167;
+reg [31:0] dag_1000_entry_167_reg;
+reg [63:0] dag_1000_entry_168;
+reg [63:0] dag_1000_entry_168_reg;
+reg [63:0] dag_1000_entry_169;
+reg [63:0] dag_1000_entry_169_reg;
+reg [63:0] dag_1000_entry_171;
+reg [63:0] dag_1000_entry_171_reg;
+reg [15:0] dag_1000_entry_172;
+reg [15:0] dag_1000_entry_172_reg;
+reg [63:0] dag_1000_entry_173;
+reg [63:0] dag_1000_entry_173_reg;
+reg [63:0] dag_1000_entry_174;
+reg [63:0] dag_1000_entry_174_reg;
+reg [15:0] dag_1000_entry_175;
+reg [15:0] bp_reg_19;
+reg [15:0] dag_1000_entry_175_reg;
+reg [63:0] dag_1000_entry_176;
+reg [63:0] dag_1000_entry_176_reg;
+reg [31:0] dag_1000_entry_177;
+reg [31:0] dag_1000_entry_177_reg;
+reg [63:0] dag_1000_entry_178;
+reg [63:0] dag_1000_entry_178_reg;
+reg [7:0] dag_1000_entry_179;
+reg [7:0] dag_1000_entry_179_reg;
+reg [7:0] dag_1000_entry_180;
+reg [7:0] bp_reg_41;
+reg [7:0] dag_1000_entry_180_reg;
+reg [15:0] dag_1000_entry_181;
+reg [15:0] dag_1000_entry_181_reg;
+reg [63:0] dag_1000_entry_183;
+reg [63:0] dag_1000_entry_183_reg;
+reg [63:0] dag_1000_entry_184;
+reg [15:0] bp_reg_20;
+reg [15:0] dag_1000_entry_184_reg;
+reg [63:0] dag_1000_entry_185;
+reg [295:0] bp_reg_4;
+reg [63:0] dag_1000_entry_185_reg;
+reg [31:0] dag_1000_entry_187;
+reg [31:0] dag_1000_entry_187_reg;
+reg [7:0] dag_1000_entry_188;
+reg [7:0] bp_reg_42;
+reg [7:0] dag_1000_entry_188_reg;
+reg [15:0] dag_1000_entry_189;
+reg [15:0] dag_1000_entry_189_reg;
+reg [31:0] dag_1000_entry_190;
+reg [31:0] dag_1000_entry_190_reg;
+reg [15:0] dag_1000_entry_191;
+reg [15:0] dag_1000_entry_191_reg;
+reg [7:0] dag_1000_entry_192;
+reg [7:0] dag_1000_entry_192_reg;
+reg [15:0] dag_1000_entry_193;
+reg [15:0] dag_1000_entry_193_reg;
+reg [15:0] dag_1000_entry_194;
+reg [15:0] dag_1000_entry_194_reg;
+reg [7:0] dag_1000_entry_196;
+reg [7:0] dag_1000_entry_196_reg;
+reg [63:0] dag_1000_entry_197;
+reg [63:0] dag_1000_entry_197_reg;
+reg [31:0] dag_1000_entry_198;
+reg  dag_1000_entry_198_reg;
+reg [15:0] dag_1000_entry_199;
+reg [15:0] bp_reg_21;
+reg [15:0] dag_1000_entry_199_reg;
+reg [31:0] dag_1000_entry_200;
+reg [31:0] dag_1000_entry_200_reg;
+reg [7:0] dag_1000_entry_201;
+reg [7:0] dag_1000_entry_201_reg;
+reg [7:0] dag_1000_entry_202;
+reg [7:0] dag_1000_entry_202_reg;
+reg [31:0] dag_1000_entry_203;
+reg [31:0] dag_1000_entry_203_reg;
+reg [7:0] dag_1000_entry_205;
+reg [7:0] dag_1000_entry_205_reg;
+reg [15:0] dag_1000_entry_206;
+reg [15:0] bp_reg_22;
+reg [15:0] dag_1000_entry_206_reg;
+reg [15:0] dag_1000_entry_207;
+reg [15:0] bp_reg_23;
+reg [15:0] dag_1000_entry_207_reg;
+reg [31:0] dag_1000_entry_208;
+reg [31:0] dag_1000_entry_208_reg;
+reg [31:0] dag_1000_entry_209;
+reg [31:0] dag_1000_entry_209_reg;
+reg [31:0] dag_1000_entry_210;
+reg [31:0] dag_1000_entry_210_reg;
+reg [7:0] dag_1000_entry_212;
+reg [7:0] dag_1000_entry_212_reg;
+reg [15:0] dag_1000_entry_213;
+reg [15:0] dag_1000_entry_213_reg;
+reg [31:0] dag_1000_entry_214;
+reg [31:0] dag_1000_entry_214_reg;
+reg [31:0] dag_1000_entry_215;
+reg [31:0] dag_1000_entry_215_reg;
+reg [15:0] dag_1000_entry_218;
+reg [15:0] dag_1000_entry_218_reg;
+reg [7:0] dag_1000_entry_219;
+reg [7:0] bp_reg_43;
+reg [7:0] dag_1000_entry_219_reg;
+reg [15:0] dag_1000_entry_220;
+reg [15:0] dag_1000_entry_220_reg;
+reg [7:0] dag_1000_entry_221;
+reg [7:0] dag_1000_entry_221_reg;
+reg [7:0] dag_1000_entry_222;
+reg [7:0] dag_1000_entry_222_reg;
+reg [63:0] dag_1000_entry_223;
+reg [63:0] dag_1000_entry_223_reg;
+reg [7:0] dag_1000_entry_224;
+reg [7:0] dag_1000_entry_224_reg;
+reg [31:0] dag_1000_entry_225;
+reg [31:0] dag_1000_entry_225_reg;
+reg [31:0] dag_1000_entry_226;
+reg [31:0] dag_1000_entry_226_reg;
+reg [7:0] dag_1000_entry_227;
+reg [7:0] dag_1000_entry_227_reg;
+reg [7:0] dag_1000_entry_228;
+reg [15:0] bp_reg_44;
+reg [7:0] dag_1000_entry_228_reg;
+reg [7:0] dag_1000_entry_230;
+reg [7:0] dag_1000_entry_230_reg;
+reg [7:0] dag_1000_entry_231;
+reg [7:0] dag_1000_entry_231_reg;
+reg [31:0] dag_1000_entry_232;
+reg [31:0] dag_1000_entry_232_reg;
+reg [7:0] dag_1000_entry_233;
+reg [7:0] dag_1000_entry_233_reg;
+reg [31:0] dag_1000_entry_234;
+reg [31:0] dag_1000_entry_234_reg;
+reg [15:0] dag_1000_entry_235;
+reg [15:0] dag_1000_entry_235_reg;
+reg [63:0] dag_1000_entry_236;
+reg [63:0] dag_1000_entry_236_reg;
+reg [63:0] dag_1000_entry_237;
+reg [63:0] dag_1000_entry_237_reg;
+reg [31:0] dag_1000_entry_238;
+reg [31:0] dag_1000_entry_238_reg;
+reg [63:0] dag_1000_entry_239;
+reg  dag_1000_entry_239_reg;
+reg [63:0] dag_1000_entry_240;
+reg [63:0] dag_1000_entry_240_reg;
+reg [31:0] dag_1000_entry_241;
+reg [31:0] dag_1000_entry_241_reg;
+reg [31:0] dag_1000_entry_242;
+reg [31:0] dag_1000_entry_242_reg;
+reg [31:0] dag_1000_entry_243;
+reg [31:0] dag_1000_entry_243_reg;
+reg [31:0] dag_1000_entry_244;
+reg [31:0] dag_1000_entry_244_reg;
+reg [15:0] dag_1000_entry_247;
+reg [15:0] dag_1000_entry_247_reg;
+reg [31:0] dag_1000_entry_248;
+reg [31:0] dag_1000_entry_248_reg;
+reg [15:0] dag_1000_entry_249;
+reg [15:0] dag_1000_entry_249_reg;
+reg [63:0] dag_1000_entry_251;
+reg [63:0] dag_1000_entry_251_reg;
+reg [31:0] dag_1000_entry_252;
+reg [31:0] dag_1000_entry_252_reg;
+reg [7:0] dag_1000_entry_253;
+reg [7:0] dag_1000_entry_253_reg;
+reg [15:0] dag_1000_entry_254;
+reg [15:0] dag_1000_entry_254_reg;
+reg [31:0] dag_1000_entry_255;
+reg [31:0] dag_1000_entry_255_reg;
+reg [63:0] dag_1000_entry_256;
+reg [63:0] dag_1000_entry_256_reg;
+reg [63:0] dag_1000_entry_258;
+reg [63:0] dag_1000_entry_258_reg;
+reg [7:0] dag_1000_entry_259;
+reg [7:0] dag_1000_entry_259_reg;
+reg [31:0] dag_1000_entry_260;
+reg [31:0] dag_1000_entry_260_reg;
+reg [63:0] dag_1000_entry_262;
+reg [63:0] dag_1000_entry_262_reg;
+reg [63:0] dag_1000_entry_263;
+reg [63:0] dag_1000_entry_263_reg;
+reg [15:0] dag_1000_entry_264;
+reg [15:0] dag_1000_entry_264_reg;
+reg [63:0] dag_1000_entry_265;
+reg [63:0] dag_1000_entry_265_reg;
+reg [7:0] dag_1000_entry_266;
+reg [7:0] bp_reg_45;
+reg [7:0] dag_1000_entry_266_reg;
+reg [7:0] dag_1000_entry_267;
+reg [7:0] dag_1000_entry_267_reg;
+reg [31:0] dag_1000_entry_268;
+reg [31:0] dag_1000_entry_268_reg;
+reg [7:0] dag_1000_entry_269;
+reg [7:0] dag_1000_entry_269_reg;
+reg [7:0] dag_1000_entry_270;
+reg [7:0] bp_reg_46;
+reg [7:0] dag_1000_entry_270_reg;
+reg [31:0] dag_1000_entry_271;
+reg [31:0] dag_1000_entry_271_reg;
+reg [15:0] dag_1000_entry_272;
+reg [15:0] dag_1000_entry_272_reg;
+reg [7:0] dag_1000_entry_273;
+reg [7:0] bp_reg_47;
+reg [7:0] dag_1000_entry_273_reg;
+reg [31:0] dag_1000_entry_274;
+reg [31:0] dag_1000_entry_274_reg;
+reg [15:0] dag_1000_entry_275;
+reg [15:0] dag_1000_entry_275_reg;
+reg [7:0] dag_1000_entry_276;
+reg [15:0] bp_reg_25;
+reg [7:0] dag_1000_entry_276_reg;
+reg [15:0] dag_1000_entry_277;
+reg [15:0] dag_1000_entry_277_reg;
+reg [31:0] dag_1000_entry_278;
+reg [31:0] dag_1000_entry_278_reg;
+reg [15:0] dag_1000_entry_279;
+reg [15:0] dag_1000_entry_279_reg;
+reg [63:0] dag_1000_entry_280;
+reg [135:0] bp_reg_5;
+reg [63:0] dag_1000_entry_280_reg;
+reg [31:0] dag_1000_entry_281;
+reg [31:0] dag_1000_entry_281_reg;
+reg [31:0] dag_1000_entry_282;
+reg [31:0] dag_1000_entry_282_reg;
+reg [31:0] dag_1000_entry_283;
+reg [31:0] dag_1000_entry_283_reg;
+reg [15:0] dag_1000_entry_284;
+reg [15:0] dag_1000_entry_284_reg;
+reg [7:0] dag_1000_entry_285;
+reg [7:0] dag_1000_entry_285_reg;
+reg [63:0] dag_1000_entry_287;
+reg [63:0] dag_1000_entry_287_reg;
+reg [15:0] dag_1000_entry_288;
+reg [15:0] dag_1000_entry_288_reg;
+reg [7:0] dag_1000_entry_289;
+reg [7:0] dag_1000_entry_289_reg;
+reg [15:0] dag_1000_entry_290;
+reg [15:0] dag_1000_entry_290_reg;
+reg [31:0] dag_1000_entry_291;
+reg [31:0] dag_1000_entry_291_reg;
+reg [63:0] dag_1000_entry_292;
+reg [63:0] dag_1000_entry_292_reg;
+reg [63:0] dag_1000_entry_293;
+reg [7:0] bp_reg_48;
+reg [7:0] dag_1000_entry_293_reg;
+reg [15:0] dag_1000_entry_294;
+reg [15:0] dag_1000_entry_294_reg;
+reg [31:0] dag_1000_entry_295;
+reg [31:0] dag_1000_entry_295_reg;
+reg [31:0] dag_1000_entry_296;
+reg [31:0] dag_1000_entry_296_reg;
+reg [15:0] dag_1000_entry_298;
+reg [15:0] dag_1000_entry_298_reg;
+reg [15:0] dag_1000_entry_299;
+reg [15:0] dag_1000_entry_299_reg;
+reg [63:0] dag_1000_entry_300;
+reg [63:0] dag_1000_entry_300_reg;
+reg [63:0] dag_1000_entry_301;
+reg [63:0] dag_1000_entry_301_reg;
+reg [63:0] dag_1000_entry_302;
+reg [63:0] dag_1000_entry_302_reg;
+reg [31:0] dag_1000_entry_303;
+reg [31:0] dag_1000_entry_303_reg;
+reg [15:0] dag_1000_entry_304;
+reg [15:0] dag_1000_entry_304_reg;
+reg [15:0] dag_1000_entry_305;
+reg [15:0] dag_1000_entry_305_reg;
+reg [31:0] dag_1000_entry_306;
+reg [31:0] dag_1000_entry_306_reg;
+reg [31:0] dag_1000_entry_307;
+reg [31:0] dag_1000_entry_307_reg;
+reg [7:0] dag_1000_entry_308;
+reg [7:0] dag_1000_entry_308_reg;
+reg [31:0] dag_1000_entry_309;
+reg [31:0] dag_1000_entry_309_reg;
+reg [15:0] dag_1000_entry_310;
+reg [15:0] dag_1000_entry_310_reg;
+reg [31:0] dag_1000_entry_311;
+reg [31:0] dag_1000_entry_311_reg;
+reg [63:0] dag_1000_entry_312;
+reg [7:0] dag_1000_entry_312_reg;
+reg [15:0] dag_1000_entry_313;
+reg [15:0] dag_1000_entry_313_reg;
+reg [7:0] dag_1000_entry_314;
+reg  dag_1000_entry_314_reg;
+reg [7:0] dag_1000_entry_318;
+reg [7:0] dag_1000_entry_318_reg;
+reg [31:0] dag_1000_entry_319;
+reg [31:0] dag_1000_entry_319_reg;
+reg [63:0] dag_1000_entry_320;
+reg [63:0] dag_1000_entry_320_reg;
+reg [15:0] dag_1000_entry_321;
+reg [15:0] dag_1000_entry_321_reg;
+reg [15:0] dag_1000_entry_322;
+reg [15:0] dag_1000_entry_322_reg;
+reg [15:0] dag_1000_entry_323;
+reg [15:0] dag_1000_entry_323_reg;
+reg [31:0] dag_1000_entry_324;
+reg [31:0] dag_1000_entry_324_reg;
+reg [15:0] dag_1000_entry_325;
+reg [15:0] dag_1000_entry_325_reg;
+reg [7:0] dag_1000_entry_326;
+reg [88:0] bp_reg_6;
+reg [7:0] dag_1000_entry_326_reg;
+reg [7:0] dag_1000_entry_327;
+reg [7:0] dag_1000_entry_327_reg;
+reg [31:0] dag_1000_entry_328;
+reg [31:0] dag_1000_entry_328_reg;
+reg [31:0] dag_1000_entry_329;
+reg [31:0] dag_1000_entry_329_reg;
+reg [15:0] dag_1000_entry_330;
+reg [15:0] dag_1000_entry_330_reg;
+reg [63:0] dag_1000_entry_331;
+reg [63:0] dag_1000_entry_331_reg;
+reg [63:0] dag_1000_entry_332;
+reg [63:0] dag_1000_entry_332_reg;
+reg [63:0] dag_1000_entry_333;
+reg [63:0] dag_1000_entry_333_reg;
+reg [15:0] dag_1000_entry_334;
+reg [15:0] dag_1000_entry_334_reg;
+reg [63:0] dag_1000_entry_336;
+reg [63:0] dag_1000_entry_336_reg;
+reg [7:0] dag_1000_entry_337;
+reg [7:0] dag_1000_entry_337_reg;
+reg [7:0] dag_1000_entry_338;
+reg [7:0] dag_1000_entry_338_reg;
+reg [15:0] dag_1000_entry_339;
+reg [15:0] dag_1000_entry_339_reg;
+reg [63:0] dag_1000_entry_340;
+reg [63:0] dag_1000_entry_340_reg;
+reg [31:0] dag_1000_entry_341;
+reg [31:0] dag_1000_entry_341_reg;
+reg [63:0] dag_1000_entry_342;
+reg [63:0] dag_1000_entry_342_reg;
+reg [63:0] dag_1000_entry_343;
+reg [63:0] dag_1000_entry_343_reg;
+reg [63:0] dag_1000_entry_344;
+reg [63:0] dag_1000_entry_344_reg;
+reg [7:0] dag_1000_entry_345;
+reg [7:0] dag_1000_entry_345_reg;
+reg [31:0] dag_1000_entry_346;
+reg [31:0] dag_1000_entry_346_reg;
+reg [7:0] dag_1000_entry_347;
+reg [7:0] dag_1000_entry_347_reg;
+reg [31:0] dag_1000_entry_348;
+reg [31:0] dag_1000_entry_348_reg;
+reg [15:0] dag_1000_entry_349;
+reg [15:0] dag_1000_entry_349_reg;
+reg [7:0] dag_1000_entry_350;
+reg [7:0] dag_1000_entry_350_reg;
+reg [7:0] dag_1000_entry_351;
+reg [7:0] dag_1000_entry_351_reg;
+reg [15:0] dag_1000_entry_352;
+reg [15:0] dag_1000_entry_352_reg;
+reg [63:0] dag_1000_entry_353;
+reg [63:0] dag_1000_entry_353_reg;
+reg [63:0] dag_1000_entry_354;
+reg [63:0] dag_1000_entry_354_reg;
+reg [63:0] dag_1000_entry_355;
+reg [63:0] dag_1000_entry_355_reg;
+reg [7:0] dag_1000_entry_356;
+reg [7:0] dag_1000_entry_356_reg;
+reg [7:0] dag_1000_entry_357;
+reg [7:0] dag_1000_entry_357_reg;
+reg [63:0] dag_1000_entry_358;
+reg [63:0] dag_1000_entry_358_reg;
+reg [31:0] dag_1000_entry_359;
+reg [31:0] dag_1000_entry_359_reg;
+reg [15:0] dag_1000_entry_360;
+reg [15:0] dag_1000_entry_360_reg;
+reg [63:0] dag_1000_entry_361;
+reg [63:0] dag_1000_entry_361_reg;
+reg [31:0] dag_1000_entry_362;
+reg [31:0] dag_1000_entry_362_reg;
+reg [31:0] dag_1000_entry_363;
+reg [31:0] dag_1000_entry_363_reg;
+reg [31:0] dag_1000_entry_364;
+reg [31:0] dag_1000_entry_364_reg;
+reg [15:0] dag_1000_entry_365;
+reg [15:0] dag_1000_entry_365_reg;
+reg [31:0] dag_1000_entry_367;
+reg [31:0] dag_1000_entry_367_reg;
+reg [15:0] dag_1000_entry_368;
+reg [15:0] dag_1000_entry_368_reg;
+reg [15:0] dag_1000_entry_369;
+reg [15:0] dag_1000_entry_369_reg;
+reg [31:0] dag_1000_entry_370;
+reg [31:0] dag_1000_entry_370_reg;
+reg [15:0] dag_1000_entry_371;
+reg [15:0] dag_1000_entry_371_reg;
+reg [63:0] dag_1000_entry_372;
+reg [63:0] dag_1000_entry_372_reg;
+reg [31:0] dag_1000_entry_373;
+reg [31:0] dag_1000_entry_373_reg;
+reg [63:0] dag_1000_entry_374;
+reg [63:0] dag_1000_entry_374_reg;
+reg [63:0] dag_1000_entry_375;
+reg [63:0] dag_1000_entry_375_reg;
+reg [31:0] dag_1000_entry_376;
+reg [31:0] dag_1000_entry_376_reg;
+reg [63:0] dag_1000_entry_377;
+reg [63:0] dag_1000_entry_377_reg;
+reg [63:0] dag_1000_entry_378;
+reg [63:0] dag_1000_entry_378_reg;
+reg [7:0] dag_1000_entry_379;
+reg [7:0] dag_1000_entry_379_reg;
+reg [7:0] dag_1000_entry_380;
+reg [7:0] dag_1000_entry_380_reg;
+reg [31:0] dag_1000_entry_381;
+reg [31:0] dag_1000_entry_381_reg;
+reg [31:0] dag_1000_entry_382;
+reg [31:0] dag_1000_entry_382_reg;
+reg [15:0] dag_1000_entry_383;
+reg [15:0] dag_1000_entry_383_reg;
+reg [63:0] dag_1000_entry_384;
+reg [63:0] dag_1000_entry_384_reg;
+reg [31:0] dag_1000_entry_385;
+reg [31:0] dag_1000_entry_385_reg;
+reg [31:0] dag_1000_entry_386;
+reg [31:0] dag_1000_entry_386_reg;
+reg [7:0] dag_1000_entry_387;
+reg [7:0] dag_1000_entry_387_reg;
+reg [7:0] dag_1000_entry_388;
+reg [7:0] dag_1000_entry_388_reg;
+reg [15:0] dag_1000_entry_389;
+reg [15:0] dag_1000_entry_389_reg;
+reg [63:0] dag_1000_entry_390;
+reg [63:0] dag_1000_entry_390_reg;
+reg [31:0] dag_1000_entry_391;
+reg [31:0] dag_1000_entry_391_reg;
+reg [63:0] dag_1000_entry_393;
+reg [63:0] dag_1000_entry_393_reg;
+reg [15:0] dag_1000_entry_394;
+reg [15:0] dag_1000_entry_394_reg;
+reg [7:0] dag_1000_entry_395;
+reg [7:0] dag_1000_entry_395_reg;
+reg [7:0] dag_1000_entry_396;
+reg [7:0] dag_1000_entry_396_reg;
+reg [31:0] dag_1000_entry_397;
+reg [31:0] dag_1000_entry_397_reg;
+reg [7:0] dag_1000_entry_398;
+reg [7:0] dag_1000_entry_398_reg;
+reg [15:0] dag_1000_entry_399;
+reg [15:0] dag_1000_entry_399_reg;
+reg [63:0] dag_1000_entry_403;
+reg  dag_1000_entry_403_reg;
+reg [7:0] dag_1000_entry_404;
+reg [7:0] dag_1000_entry_404_reg;
+reg [63:0] dag_1000_entry_405;
+reg [63:0] dag_1000_entry_405_reg;
+reg [63:0] dag_1000_entry_407;
+reg [63:0] dag_1000_entry_407_reg;
+reg [7:0] dag_1000_entry_408;
+reg [7:0] dag_1000_entry_408_reg;
+reg [7:0] dag_1000_entry_409;
+reg [7:0] dag_1000_entry_409_reg;
+reg [7:0] dag_1000_entry_410;
+reg [7:0] dag_1000_entry_410_reg;
+reg [7:0] dag_1000_entry_412;
+reg [7:0] dag_1000_entry_412_reg;
+reg [15:0] dag_1000_entry_413;
+reg [15:0] dag_1000_entry_413_reg;
+reg [31:0] dag_1000_entry_414;
+reg [31:0] dag_1000_entry_414_reg;
+reg [63:0] dag_1000_entry_415;
+reg [63:0] dag_1000_entry_415_reg;
+reg [7:0] dag_1000_entry_417;
+reg [7:0] dag_1000_entry_417_reg;
+reg [15:0] dag_1000_entry_418;
+reg [15:0] dag_1000_entry_418_reg;
+reg [7:0] dag_1000_entry_419;
+reg [7:0] dag_1000_entry_419_reg;
+reg [7:0] dag_1000_entry_420;
+reg [7:0] dag_1000_entry_420_reg;
+reg [15:0] dag_1000_entry_421;
+reg [15:0] dag_1000_entry_421_reg;
+reg [63:0] dag_1000_entry_423;
+reg [63:0] dag_1000_entry_423_reg;
+reg [31:0] dag_1000_entry_424;
+reg [31:0] dag_1000_entry_424_reg;
+reg [15:0] dag_1000_entry_425;
+reg [15:0] dag_1000_entry_425_reg;
+reg [31:0] dag_1000_entry_426;
+reg [31:0] dag_1000_entry_426_reg;
+reg [15:0] dag_1000_entry_427;
+reg [15:0] dag_1000_entry_427_reg;
+reg [31:0] dag_1000_entry_428;
+reg [31:0] dag_1000_entry_428_reg;
+reg [7:0] dag_1000_entry_429;
+reg [7:0] dag_1000_entry_429_reg;
+reg [15:0] dag_1000_entry_431;
+reg [15:0] bp_reg_24;
+reg [15:0] dag_1000_entry_431_reg;
+reg [15:0] dag_1000_entry_432;
+reg [79:0] bp_reg_7;
+reg [15:0] dag_1000_entry_432_reg;
+reg [15:0] dag_1000_entry_433;
+reg [15:0] dag_1000_entry_433_reg;
+reg [31:0] dag_1000_entry_434;
+reg [31:0] dag_1000_entry_434_reg;
+reg [63:0] dag_1000_entry_435;
+reg [63:0] dag_1000_entry_435_reg;
+reg [7:0] dag_1000_entry_436;
+reg [7:0] dag_1000_entry_436_reg;
+reg [15:0] dag_1000_entry_437;
+reg [15:0] dag_1000_entry_437_reg;
+reg [31:0] dag_1000_entry_438;
+reg [31:0] dag_1000_entry_438_reg;
+reg [15:0] dag_1000_entry_439;
+reg [15:0] dag_1000_entry_439_reg;
+reg [31:0] dag_1000_entry_440;
+reg [31:0] bp_reg_14;
+reg [31:0] dag_1000_entry_440_reg;
+reg [15:0] dag_1000_entry_441;
+reg [15:0] dag_1000_entry_441_reg;
+reg [15:0] dag_1000_entry_442;
+reg [15:0] dag_1000_entry_442_reg;
+reg [63:0] dag_1000_entry_443;
+reg [63:0] dag_1000_entry_443_reg;
+reg [31:0] dag_1000_entry_444;
+reg [31:0] dag_1000_entry_444_reg;
+reg [15:0] dag_1000_entry_445;
+reg [15:0] dag_1000_entry_445_reg;
+reg [15:0] dag_1000_entry_446;
+reg [15:0] dag_1000_entry_446_reg;
+reg [7:0] dag_1000_entry_447;
+reg [7:0] dag_1000_entry_447_reg;
+reg [15:0] dag_1000_entry_448;
+reg [15:0] dag_1000_entry_448_reg;
+reg [63:0] dag_1000_entry_450;
+reg [63:0] dag_1000_entry_450_reg;
+reg [15:0] dag_1000_entry_451;
+reg [15:0] dag_1000_entry_451_reg;
+reg [7:0] dag_1000_entry_452;
+reg [7:0] bp_reg_49;
+reg [7:0] dag_1000_entry_452_reg;
+reg [15:0] dag_1000_entry_453;
+reg [15:0] dag_1000_entry_453_reg;
+reg [31:0] dag_1000_entry_454;
+reg [31:0] dag_1000_entry_454_reg;
+reg [31:0] dag_1000_entry_455;
+reg [31:0] bp_reg_15;
+reg [31:0] dag_1000_entry_455_reg;
+reg [15:0] dag_1000_entry_456;
+reg [15:0] dag_1000_entry_456_reg;
+reg [15:0] dag_1000_entry_457;
+reg [15:0] dag_1000_entry_457_reg;
+reg [31:0] dag_1000_entry_459;
+reg [31:0] dag_1000_entry_459_reg;
+reg [7:0] dag_1000_entry_461;
+reg [7:0] bp_reg_50;
+reg [7:0] dag_1000_entry_461_reg;
+reg [7:0] dag_1000_entry_464;
+reg [15:0] bp_reg_51;
+reg [7:0] dag_1000_entry_464_reg;
+reg [31:0] dag_1000_entry_465;
+reg [31:0] dag_1000_entry_465_reg;
+reg [15:0] dag_1000_entry_466;
+reg [7:0] dag_1000_entry_466_reg;
+reg [7:0] dag_1000_entry_467;
+reg [7:0] dag_1000_entry_467_reg;
+reg [7:0] dag_1000_entry_469;
+reg [7:0] bp_reg_52;
+reg [7:0] dag_1000_entry_469_reg;
+reg [15:0] dag_1000_entry_470;
+reg [15:0] dag_1000_entry_470_reg;
+reg [15:0] dag_1000_entry_471;
+reg [15:0] dag_1000_entry_471_reg;
+reg [63:0] dag_1000_entry_472;
+reg [439:0] bp_reg_8;
+reg [63:0] dag_1000_entry_472_reg;
+reg [7:0] dag_1000_entry_473;
+reg [7:0] dag_1000_entry_473_reg;
+reg [31:0] dag_1000_entry_474;
+reg [31:0] dag_1000_entry_474_reg;
+reg [31:0] dag_1000_entry_475;
+reg [31:0] dag_1000_entry_475_reg;
+reg [7:0] dag_1000_entry_476;
+reg [7:0] dag_1000_entry_476_reg;
+reg [7:0] dag_1000_entry_478;
+reg [7:0] dag_1000_entry_478_reg;
+reg [15:0] dag_1000_entry_479;
+reg [15:0] dag_1000_entry_479_reg;
+reg [63:0] dag_1000_entry_480;
+reg [63:0] dag_1000_entry_480_reg;
+reg [15:0] dag_1000_entry_481;
+reg [15:0] dag_1000_entry_481_reg;
+reg [31:0] dag_1000_entry_483;
+reg [31:0] dag_1000_entry_483_reg;
+reg [31:0] dag_1000_entry_484;
+reg [31:0] dag_1000_entry_484_reg;
+reg [15:0] dag_1000_entry_485;
+reg [15:0] dag_1000_entry_485_reg;
+reg [7:0] dag_1000_entry_486;
+reg [7:0] dag_1000_entry_486_reg;
+reg [31:0] dag_1000_entry_487;
+reg [31:0] dag_1000_entry_487_reg;
+reg [63:0] dag_1000_entry_488;
+reg [63:0] dag_1000_entry_488_reg;
+reg [7:0] dag_1000_entry_489;
+reg [7:0] dag_1000_entry_489_reg;
+reg [31:0] dag_1000_entry_491;
+reg [31:0] dag_1000_entry_491_reg;
+reg [31:0] dag_1000_entry_492;
+reg [31:0] dag_1000_entry_492_reg;
+reg [31:0] dag_1000_entry_494;
+reg [31:0] dag_1000_entry_494_reg;
+reg [15:0] dag_1000_entry_496;
+reg [15:0] dag_1000_entry_496_reg;
+reg [31:0] dag_1000_entry_498;
+reg [47:0] bp_reg_16;
+reg [31:0] dag_1000_entry_498_reg;
+reg [15:0] dag_1000_entry_499;
+reg [15:0] dag_1000_entry_499_reg;
+reg [7:0] dag_1000_entry_500;
+reg [7:0] dag_1000_entry_500_reg;
+reg [7:0] dag_1000_entry_501;
+reg [7:0] dag_1000_entry_501_reg;
+reg [63:0] dag_1000_entry_502;
+reg [63:0] dag_1000_entry_502_reg;
+reg [31:0] dag_1000_entry_503;
+reg [31:0] dag_1000_entry_503_reg;
+reg [63:0] dag_1000_entry_504;
+reg [63:0] dag_1000_entry_504_reg;
+reg [63:0] dag_1000_entry_505;
+reg [63:0] dag_1000_entry_505_reg;
+reg [31:0] dag_1000_entry_506;
+reg [70:0] bp_reg_17;
+reg [31:0] dag_1000_entry_506_reg;
+reg [63:0] dag_1000_entry_507;
+reg [63:0] dag_1000_entry_507_reg;
+reg [63:0] dag_1000_entry_508;
+reg [63:0] dag_1000_entry_508_reg;
+reg [15:0] dag_1000_entry_509;
+reg [15:0] dag_1000_entry_509_reg;
+reg [7:0] dag_1000_entry_510;
+reg  dag_1000_entry_510_reg;
+reg [31:0] dag_1000_entry_511;
+reg [31:0] dag_1000_entry_511_reg;
+reg [7:0] dag_1000_entry_512;
+reg [7:0] dag_1000_entry_512_reg;
+reg [31:0] dag_1000_entry_513;
+reg [31:0] dag_1000_entry_513_reg;
+reg [15:0] dag_1000_entry_514;
+reg [15:0] dag_1000_entry_514_reg;
+reg [63:0] dag_1000_entry_515;
+reg [63:0] dag_1000_entry_515_reg;
+reg [15:0] dag_1000_entry_516;
+reg [15:0] dag_1000_entry_516_reg;
+reg [31:0] dag_1000_entry_517;
+reg [31:0] dag_1000_entry_517_reg;
+reg [31:0] dag_1000_entry_518;
+reg [31:0] dag_1000_entry_518_reg;
+reg [63:0] dag_1000_entry_519;
+reg [63:0] dag_1000_entry_519_reg;
+reg [63:0] dag_1000_entry_522;
+reg [63:0] dag_1000_entry_522_reg;
+reg [15:0] dag_1000_entry_523;
+reg [15:0] dag_1000_entry_523_reg;
+reg [7:0] dag_1000_entry_524;
+reg [7:0] dag_1000_entry_524_reg;
+reg [63:0] dag_1000_entry_525;
+reg [63:0] dag_1000_entry_525_reg;
+reg [31:0] dag_1000_entry_526;
+reg [31:0] dag_1000_entry_526_reg;
+reg [7:0] dag_1000_entry_527;
+reg [7:0] dag_1000_entry_527_reg;
+reg [63:0] dag_1000_entry_528;
+reg [63:0] dag_1000_entry_528_reg;
+reg [15:0] dag_1000_entry_529;
+reg [15:0] dag_1000_entry_529_reg;
+reg [31:0] dag_1000_entry_530;
+reg [31:0] dag_1000_entry_530_reg;
+reg [7:0] dag_1000_entry_531;
+reg  dag_1000_entry_531_reg;
+reg [31:0] dag_1000_entry_532;
+reg [31:0] dag_1000_entry_532_reg;
+reg [31:0] dag_1000_entry_533;
+reg [31:0] dag_1000_entry_533_reg;
+reg [63:0] dag_1000_entry_534;
+reg [63:0] dag_1000_entry_534_reg;
+reg [31:0] dag_1000_entry_535;
+reg  dag_1000_entry_535_reg;
+reg [7:0] dag_1000_entry_536;
+reg [7:0] dag_1000_entry_536_reg;
+reg [15:0] dag_1000_entry_537;
+reg [15:0] dag_1000_entry_537_reg;
+reg [63:0] dag_1000_entry_539;
+reg [63:0] dag_1000_entry_539_reg;
+reg [31:0] dag_1000_entry_540;
+reg [31:0] dag_1000_entry_540_reg;
+reg [31:0] dag_1000_entry_541;
+reg [31:0] dag_1000_entry_541_reg;
+reg [31:0] dag_1000_entry_542;
+reg [31:0] dag_1000_entry_542_reg;
+reg [31:0] dag_1000_entry_543;
+reg [31:0] dag_1000_entry_543_reg;
+reg [63:0] dag_1000_entry_544;
+reg [63:0] dag_1000_entry_544_reg;
+reg [7:0] dag_1000_entry_545;
+reg [7:0] dag_1000_entry_545_reg;
+reg [63:0] dag_1000_entry_546;
+reg [63:0] dag_1000_entry_546_reg;
+reg [15:0] dag_1000_entry_547;
+reg [15:0] dag_1000_entry_547_reg;
+reg [15:0] dag_1000_entry_549;
+reg [15:0] dag_1000_entry_549_reg;
+reg [7:0] dag_1000_entry_550;
+reg [7:0] dag_1000_entry_550_reg;
+reg [15:0] dag_1000_entry_552;
+reg [15:0] dag_1000_entry_552_reg;
+reg [7:0] dag_1000_entry_553;
+reg [7:0] dag_1000_entry_553_reg;
+reg [31:0] dag_1000_entry_554;
+reg [24:0] bp_reg_26;
+reg [15:0] dag_1000_entry_554_reg;
+reg [63:0] dag_1000_entry_555;
+reg [63:0] dag_1000_entry_555_reg;
+reg [7:0] dag_1000_entry_556;
+reg [7:0] dag_1000_entry_556_reg;
+reg [7:0] dag_1000_entry_557;
+reg [7:0] dag_1000_entry_557_reg;
+reg [15:0] dag_1000_entry_558;
+reg [15:0] dag_1000_entry_558_reg;
+reg [31:0] dag_1000_entry_559;
+reg [31:0] dag_1000_entry_559_reg;
+reg [7:0] dag_1000_entry_560;
+reg [7:0] dag_1000_entry_560_reg;
+reg [15:0] dag_1000_entry_562;
+reg [15:0] dag_1000_entry_562_reg;
+reg [63:0] dag_1000_entry_564;
+reg [63:0] dag_1000_entry_564_reg;
+reg [15:0] dag_1000_entry_565;
+reg [15:0] dag_1000_entry_565_reg;
+reg [63:0] dag_1000_entry_566;
+reg [63:0] dag_1000_entry_566_reg;
+reg [7:0] dag_1000_entry_567;
+reg [7:0] dag_1000_entry_567_reg;
+reg [63:0] dag_1000_entry_568;
+reg [63:0] dag_1000_entry_568_reg;
+reg [15:0] dag_1000_entry_569;
+reg [15:0] dag_1000_entry_569_reg;
+reg [15:0] dag_1000_entry_570;
+reg [15:0] dag_1000_entry_570_reg;
+reg [7:0] dag_1000_entry_571;
+reg [7:0] dag_1000_entry_571_reg;
+reg [15:0] dag_1000_entry_572;
+reg [15:0] dag_1000_entry_572_reg;
+reg [15:0] dag_1000_entry_573;
+reg [15:0] dag_1000_entry_573_reg;
+reg [63:0] dag_1000_entry_574;
+reg [63:0] dag_1000_entry_574_reg;
+reg [31:0] dag_1000_entry_575;
+reg [31:0] dag_1000_entry_575_reg;
+reg [15:0] dag_1000_entry_577;
+reg [15:0] dag_1000_entry_577_reg;
+reg [63:0] dag_1000_entry_578;
+reg [63:0] dag_1000_entry_578_reg;
+reg [7:0] dag_1000_entry_579;
+reg [7:0] dag_1000_entry_579_reg;
+reg [63:0] dag_1000_entry_580;
+reg [63:0] dag_1000_entry_580_reg;
+reg [31:0] dag_1000_entry_581;
+reg [31:0] dag_1000_entry_581_reg;
+reg [7:0] dag_1000_entry_582;
+reg [7:0] dag_1000_entry_582_reg;
+reg [15:0] dag_1000_entry_583;
+reg [15:0] dag_1000_entry_583_reg;
+reg [63:0] dag_1000_entry_584;
+reg [63:0] dag_1000_entry_584_reg;
+reg [15:0] dag_1000_entry_585;
+reg [15:0] dag_1000_entry_585_reg;
+reg [63:0] dag_1000_entry_586;
+reg [63:0] dag_1000_entry_586_reg;
+reg [63:0] dag_1000_entry_588;
+reg [63:0] dag_1000_entry_588_reg;
+reg [31:0] dag_1000_entry_589;
+reg [31:0] dag_1000_entry_589_reg;
+reg [15:0] dag_1000_entry_590;
+reg [15:0] bp_reg_27;
+reg [15:0] dag_1000_entry_590_reg;
+reg [7:0] dag_1000_entry_592;
+reg [7:0] dag_1000_entry_592_reg;
+reg [31:0] dag_1000_entry_593;
+reg [31:0] dag_1000_entry_593_reg;
+reg [63:0] dag_1000_entry_595;
+reg [63:0] dag_1000_entry_595_reg;
+reg [15:0] dag_1000_entry_596;
+reg [15:0] dag_1000_entry_596_reg;
+reg [63:0] dag_1000_entry_597;
+reg [63:0] dag_1000_entry_597_reg;
+reg [63:0] dag_1000_entry_599;
+reg [63:0] dag_1000_entry_599_reg;
+reg [63:0] dag_1000_entry_602;
+reg [63:0] dag_1000_entry_602_reg;
+reg [63:0] dag_1000_entry_603;
+reg [63:0] dag_1000_entry_603_reg;
+reg [7:0] dag_1000_entry_604;
+reg [7:0] dag_1000_entry_604_reg;
+reg [7:0] dag_1000_entry_605;
+reg [7:0] dag_1000_entry_605_reg;
+reg [31:0] dag_1000_entry_607;
+reg [31:0] dag_1000_entry_607_reg;
+reg [31:0] dag_1000_entry_608;
+reg [31:0] dag_1000_entry_608_reg;
+reg [63:0] dag_1000_entry_609;
+reg [63:0] dag_1000_entry_609_reg;
+reg [7:0] dag_1000_entry_610;
+reg [7:0] dag_1000_entry_610_reg;
+reg [31:0] dag_1000_entry_613;
+reg [31:0] dag_1000_entry_613_reg;
+reg [7:0] dag_1000_entry_616;
+reg [7:0] dag_1000_entry_616_reg;
+reg [31:0] dag_1000_entry_617;
+reg [31:0] dag_1000_entry_617_reg;
+reg [15:0] dag_1000_entry_618;
+reg [15:0] bp_reg_28;
+reg [15:0] dag_1000_entry_618_reg;
+reg [15:0] dag_1000_entry_619;
+reg  bp_reg_75;
+reg  dag_1000_entry_619_reg;
+reg [31:0] dag_1000_entry_620;
+reg [31:0] dag_1000_entry_620_reg;
+reg [31:0] dag_1000_entry_621;
+reg [31:0] dag_1000_entry_621_reg;
+reg [15:0] dag_1000_entry_622;
+reg [15:0] bp_reg_29;
+reg [15:0] dag_1000_entry_622_reg;
+reg [7:0] dag_1000_entry_624;
+reg [7:0] dag_1000_entry_624_reg;
+reg [7:0] dag_1000_entry_625;
+reg [7:0] dag_1000_entry_625_reg;
+reg [31:0] dag_1000_entry_626;
+reg [31:0] dag_1000_entry_626_reg;
+reg [31:0] dag_1000_entry_627;
+reg [31:0] dag_1000_entry_627_reg;
+reg [31:0] dag_1000_entry_628;
+reg [31:0] dag_1000_entry_628_reg;
+reg [63:0] dag_1000_entry_629;
+reg  dag_1000_entry_629_reg;
+reg [15:0] dag_1000_entry_631;
+reg [15:0] dag_1000_entry_631_reg;
+reg [63:0] dag_1000_entry_632;
+reg [63:0] dag_1000_entry_632_reg;
+reg [7:0] dag_1000_entry_633;
+reg [7:0] dag_1000_entry_633_reg;
+reg [7:0] dag_1000_entry_634;
+reg [7:0] dag_1000_entry_634_reg;
+reg [31:0] dag_1000_entry_635;
+reg [31:0] dag_1000_entry_635_reg;
+reg [7:0] dag_1000_entry_636;
+reg [7:0] dag_1000_entry_636_reg;
+reg [7:0] dag_1000_entry_637;
+reg [7:0] dag_1000_entry_637_reg;
+reg [31:0] dag_1000_entry_638;
+reg [31:0] dag_1000_entry_638_reg;
+reg [63:0] dag_1000_entry_639;
+reg [63:0] dag_1000_entry_639_reg;
+reg [15:0] dag_1000_entry_641;
+reg [15:0] dag_1000_entry_641_reg;
+reg [63:0] dag_1000_entry_644;
+reg [63:0] dag_1000_entry_644_reg;
+reg [7:0] dag_1000_entry_645;
+reg [7:0] dag_1000_entry_645_reg;
+reg [63:0] dag_1000_entry_646;
+reg [63:0] dag_1000_entry_646_reg;
+reg [7:0] dag_1000_entry_648;
+reg [7:0] dag_1000_entry_648_reg;
+reg [15:0] dag_1000_entry_649;
+reg [15:0] bp_reg_30;
+reg [15:0] dag_1000_entry_649_reg;
+reg [7:0] dag_1000_entry_650;
+reg [7:0] dag_1000_entry_650_reg;
+reg [7:0] dag_1000_entry_651;
+reg [7:0] dag_1000_entry_651_reg;
+reg [15:0] dag_1000_entry_652;
+reg [15:0] bp_reg_31;
+reg [15:0] dag_1000_entry_652_reg;
+reg [31:0] dag_1000_entry_653;
+reg [31:0] dag_1000_entry_653_reg;
+reg [15:0] dag_1000_entry_654;
+reg [15:0] bp_reg_32;
+reg [15:0] dag_1000_entry_654_reg;
+reg [31:0] dag_1000_entry_655;
+reg [31:0] dag_1000_entry_655_reg;
+reg [7:0] dag_1000_entry_656;
+reg [7:0] dag_1000_entry_656_reg;
+reg [15:0] dag_1000_entry_657;
+reg [15:0] bp_reg_33;
+reg [15:0] dag_1000_entry_657_reg;
+reg [15:0] dag_1000_entry_658;
+reg [77:0] bp_reg_18;
+reg [15:0] dag_1000_entry_658_reg;
+reg [15:0] dag_1000_entry_659;
+reg [15:0] dag_1000_entry_659_reg;
+reg [31:0] dag_1000_entry_660;
+reg [31:0] dag_1000_entry_660_reg;
+reg [15:0] dag_1000_entry_661;
+reg [15:0] dag_1000_entry_661_reg;
+reg [31:0] dag_1000_entry_662;
+reg [31:0] dag_1000_entry_662_reg;
+reg [63:0] dag_1000_entry_663;
+reg [63:0] dag_1000_entry_663_reg;
+reg [63:0] dag_1000_entry_664;
+reg  dag_1000_entry_664_reg;
+reg [15:0] dag_1000_entry_665;
+reg [15:0] dag_1000_entry_665_reg;
+reg [7:0] dag_1000_entry_666;
+reg [7:0] dag_1000_entry_666_reg;
+reg [7:0] dag_1000_entry_668;
+reg [7:0] dag_1000_entry_668_reg;
+reg [63:0] dag_1000_entry_669;
+reg  dag_1000_entry_669_reg;
+reg [31:0] dag_1000_entry_670;
+reg [31:0] dag_1000_entry_670_reg;
+reg [63:0] dag_1000_entry_671;
+reg [63:0] dag_1000_entry_671_reg;
+reg [31:0] dag_1000_entry_672;
+reg [31:0] dag_1000_entry_672_reg;
+reg [15:0] dag_1000_entry_673;
+reg [15:0] dag_1000_entry_673_reg;
+reg [15:0] dag_1000_entry_674;
+reg [15:0] dag_1000_entry_674_reg;
+reg [7:0] dag_1000_entry_675;
+reg [7:0] bp_reg_53;
+reg [7:0] dag_1000_entry_675_reg;
+reg [15:0] dag_1000_entry_678;
+reg [15:0] dag_1000_entry_678_reg;
+reg [7:0] dag_1000_entry_679;
+reg [7:0] dag_1000_entry_679_reg;
+reg [15:0] dag_1000_entry_680;
+reg [15:0] dag_1000_entry_680_reg;
+reg [15:0] dag_1000_entry_681;
+reg [15:0] dag_1000_entry_681_reg;
+reg [7:0] dag_1000_entry_682;
+reg [7:0] dag_1000_entry_682_reg;
+reg [63:0] dag_1000_entry_683;
+reg  dag_1000_entry_683_reg;
+reg [63:0] dag_1000_entry_684;
+reg [63:0] dag_1000_entry_684_reg;
+reg [31:0] dag_1000_entry_685;
+reg [31:0] dag_1000_entry_685_reg;
+reg [63:0] dag_1000_entry_686;
+reg [63:0] dag_1000_entry_686_reg;
+reg [7:0] dag_1000_entry_687;
+reg [7:0] dag_1000_entry_687_reg;
+reg [7:0] dag_1000_entry_688;
+reg [7:0] dag_1000_entry_688_reg;
+reg [31:0] dag_1000_entry_689;
+reg [31:0] dag_1000_entry_689_reg;
+reg [7:0] dag_1000_entry_690;
+reg [7:0] dag_1000_entry_690_reg;
+reg [15:0] dag_1000_entry_691;
+reg [15:0] dag_1000_entry_691_reg;
+reg [15:0] dag_1000_entry_692;
+reg [15:0] dag_1000_entry_692_reg;
+reg [63:0] dag_1000_entry_694;
+reg [63:0] dag_1000_entry_694_reg;
+reg [63:0] dag_1000_entry_695;
+reg [63:0] dag_1000_entry_695_reg;
+reg [7:0] dag_1000_entry_696;
+reg [7:0] dag_1000_entry_696_reg;
+reg [31:0] dag_1000_entry_697;
+reg [31:0] dag_1000_entry_697_reg;
+reg [15:0] dag_1000_entry_698;
+reg [15:0] dag_1000_entry_698_reg;
+reg [63:0] dag_1000_entry_699;
+reg [63:0] dag_1000_entry_699_reg;
+reg [7:0] dag_1000_entry_701;
+reg [7:0] dag_1000_entry_701_reg;
+reg [7:0] dag_1000_entry_702;
+reg [7:0] dag_1000_entry_702_reg;
+reg [63:0] dag_1000_entry_703;
+reg [63:0] dag_1000_entry_703_reg;
+reg [7:0] dag_1000_entry_704;
+reg [7:0] dag_1000_entry_704_reg;
+reg [63:0] dag_1000_entry_705;
+reg [63:0] dag_1000_entry_705_reg;
+reg [63:0] dag_1000_entry_706;
+reg [63:0] dag_1000_entry_706_reg;
+reg [31:0] dag_1000_entry_707;
+reg [31:0] dag_1000_entry_707_reg;
+reg [63:0] dag_1000_entry_709;
+reg [63:0] dag_1000_entry_709_reg;
+reg [7:0] dag_1000_entry_711;
+reg [7:0] dag_1000_entry_711_reg;
+reg [15:0] dag_1000_entry_712;
+reg [141:0] bp_reg_9;
+reg [15:0] dag_1000_entry_712_reg;
+reg [63:0] dag_1000_entry_713;
+reg [63:0] dag_1000_entry_713_reg;
+reg [7:0] dag_1000_entry_714;
+reg [7:0] dag_1000_entry_714_reg;
+reg [15:0] dag_1000_entry_715;
+reg [15:0] dag_1000_entry_715_reg;
+reg [63:0] dag_1000_entry_716;
+reg [63:0] dag_1000_entry_716_reg;
+reg [31:0] dag_1000_entry_717;
+reg [31:0] dag_1000_entry_717_reg;
+reg [7:0] dag_1000_entry_718;
+reg [7:0] dag_1000_entry_718_reg;
+reg [31:0] dag_1000_entry_719;
+reg [31:0] dag_1000_entry_719_reg;
+reg [31:0] dag_1000_entry_720;
+reg [31:0] dag_1000_entry_720_reg;
+reg [63:0] dag_1000_entry_721;
+reg [63:0] dag_1000_entry_721_reg;
+reg [63:0] dag_1000_entry_722;
+reg [63:0] dag_1000_entry_722_reg;
+reg [63:0] dag_1000_entry_723;
+reg [63:0] dag_1000_entry_723_reg;
+reg [63:0] dag_1000_entry_724;
+reg [63:0] dag_1000_entry_724_reg;
+reg [7:0] dag_1000_entry_725;
+reg [7:0] dag_1000_entry_725_reg;
+reg [7:0] dag_1000_entry_726;
+reg [7:0] dag_1000_entry_726_reg;
+reg [31:0] dag_1000_entry_727;
+reg [31:0] dag_1000_entry_727_reg;
+reg [31:0] dag_1000_entry_728;
+reg [31:0] dag_1000_entry_728_reg;
+reg [15:0] dag_1000_entry_729;
+reg [15:0] dag_1000_entry_729_reg;
+reg [31:0] dag_1000_entry_730;
+reg [31:0] dag_1000_entry_730_reg;
+reg [31:0] dag_1000_entry_731;
+reg [31:0] dag_1000_entry_731_reg;
+reg [31:0] dag_1000_entry_732;
+reg [31:0] dag_1000_entry_732_reg;
+reg [7:0] dag_1000_entry_733;
+reg [7:0] dag_1000_entry_733_reg;
+reg [7:0] dag_1000_entry_736;
+reg [7:0] dag_1000_entry_736_reg;
+reg [15:0] dag_1000_entry_737;
+reg [15:0] dag_1000_entry_737_reg;
+reg [63:0] dag_1000_entry_738;
+reg [63:0] dag_1000_entry_738_reg;
+reg [7:0] dag_1000_entry_739;
+reg [7:0] dag_1000_entry_739_reg;
+reg [7:0] dag_1000_entry_740;
+reg [7:0] dag_1000_entry_740_reg;
+reg [7:0] dag_1000_entry_741;
+reg [7:0] dag_1000_entry_741_reg;
+reg [15:0] dag_1000_entry_742;
+reg [15:0] dag_1000_entry_742_reg;
+reg [15:0] dag_1000_entry_744;
+reg [15:0] dag_1000_entry_744_reg;
+reg [7:0] dag_1000_entry_745;
+reg [7:0] dag_1000_entry_745_reg;
+reg [63:0] dag_1000_entry_747;
+reg [63:0] dag_1000_entry_747_reg;
+reg [15:0] dag_1000_entry_748;
+reg [15:0] dag_1000_entry_748_reg;
+reg [63:0] dag_1000_entry_749;
+reg [63:0] dag_1000_entry_749_reg;
+reg [15:0] dag_1000_entry_750;
+reg [15:0] dag_1000_entry_750_reg;
+reg [63:0] dag_1000_entry_751;
+reg [63:0] dag_1000_entry_751_reg;
+reg [7:0] dag_1000_entry_752;
+reg [7:0] dag_1000_entry_752_reg;
+reg [63:0] dag_1000_entry_753;
+reg [63:0] dag_1000_entry_753_reg;
+reg [63:0] dag_1000_entry_754;
+reg [7:0] dag_1000_entry_754_reg;
+reg [31:0] dag_1000_entry_755;
+reg [31:0] dag_1000_entry_755_reg;
+reg [15:0] dag_1000_entry_756;
+reg [15:0] dag_1000_entry_756_reg;
+reg [31:0] dag_1000_entry_757;
+reg [31:0] dag_1000_entry_757_reg;
+reg [31:0] dag_1000_entry_758;
+reg [31:0] dag_1000_entry_758_reg;
+reg [7:0] dag_1000_entry_760;
+reg [7:0] dag_1000_entry_760_reg;
+reg [63:0] dag_1000_entry_761;
+reg [63:0] dag_1000_entry_761_reg;
+reg [31:0] dag_1000_entry_762;
+reg [31:0] dag_1000_entry_762_reg;
+reg [7:0] dag_1000_entry_763;
+reg [7:0] bp_reg_54;
+reg [7:0] dag_1000_entry_763_reg;
+reg [15:0] dag_1000_entry_764;
+reg [15:0] dag_1000_entry_764_reg;
+reg [63:0] dag_1000_entry_765;
+reg [341:0] bp_reg_10;
+reg [63:0] dag_1000_entry_765_reg;
+reg [31:0] dag_1000_entry_766;
+reg [31:0] dag_1000_entry_766_reg;
+reg [63:0] dag_1000_entry_768;
+reg [63:0] dag_1000_entry_768_reg;
+reg [15:0] dag_1000_entry_769;
+reg [15:0] bp_reg_34;
+reg [15:0] dag_1000_entry_769_reg;
+reg [15:0] dag_1000_entry_770;
+reg [15:0] dag_1000_entry_770_reg;
+reg [31:0] dag_1000_entry_771;
+reg [31:0] dag_1000_entry_771_reg;
+reg [7:0] dag_1000_entry_772;
+reg [7:0] bp_reg_55;
+reg [7:0] dag_1000_entry_772_reg;
+reg [7:0] dag_1000_entry_773;
+reg [7:0] bp_reg_56;
+reg [7:0] dag_1000_entry_773_reg;
+reg [31:0] dag_1000_entry_774;
+reg [31:0] dag_1000_entry_774_reg;
+reg [31:0] dag_1000_entry_775;
+reg [31:0] dag_1000_entry_775_reg;
+reg [31:0] dag_1000_entry_776;
+reg [31:0] dag_1000_entry_776_reg;
+reg [31:0] dag_1000_entry_777;
+reg [31:0] dag_1000_entry_777_reg;
+reg [7:0] dag_1000_entry_778;
+reg [7:0] bp_reg_57;
+reg [7:0] dag_1000_entry_778_reg;
+reg [7:0] dag_1000_entry_779;
+reg [7:0] bp_reg_58;
+reg [7:0] dag_1000_entry_779_reg;
+reg [63:0] dag_1000_entry_780;
+reg [63:0] dag_1000_entry_780_reg;
+reg [15:0] dag_1000_entry_781;
+reg [15:0] dag_1000_entry_781_reg;
+reg [7:0] dag_1000_entry_782;
+reg [7:0] bp_reg_59;
+reg [7:0] dag_1000_entry_782_reg;
+reg [15:0] dag_1000_entry_783;
+reg [15:0] dag_1000_entry_783_reg;
+reg [7:0] dag_1000_entry_785;
+reg [7:0] dag_1000_entry_785_reg;
+reg [63:0] dag_1000_entry_786;
+reg [63:0] dag_1000_entry_786_reg;
+reg [31:0] dag_1000_entry_787;
+reg [31:0] dag_1000_entry_787_reg;
+reg [63:0] dag_1000_entry_788;
+reg [63:0] dag_1000_entry_788_reg;
+reg [31:0] dag_1000_entry_789;
+reg [31:0] dag_1000_entry_789_reg;
+reg [31:0] dag_1000_entry_790;
+reg [31:0] dag_1000_entry_790_reg;
+reg [31:0] dag_1000_entry_791;
+reg [31:0] dag_1000_entry_791_reg;
+reg [63:0] dag_1000_entry_792;
+reg [63:0] dag_1000_entry_792_reg;
+reg [7:0] dag_1000_entry_793;
+reg [7:0] bp_reg_60;
+reg [7:0] dag_1000_entry_793_reg;
+reg [15:0] dag_1000_entry_794;
+reg [15:0] bp_reg_35;
+reg [15:0] dag_1000_entry_794_reg;
+reg [15:0] dag_1000_entry_795;
+reg [15:0] dag_1000_entry_795_reg;
+reg [31:0] dag_1000_entry_796;
+reg [31:0] dag_1000_entry_796_reg;
+reg [63:0] dag_1000_entry_797;
+reg [63:0] dag_1000_entry_797_reg;
+reg [63:0] dag_1000_entry_798;
+reg [63:0] dag_1000_entry_798_reg;
+reg [7:0] dag_1000_entry_799;
+reg [7:0] bp_reg_61;
+reg [7:0] dag_1000_entry_799_reg;
+reg [63:0] dag_1000_entry_800;
+reg [63:0] dag_1000_entry_800_reg;
+reg [15:0] dag_1000_entry_802;
+reg [15:0] dag_1000_entry_802_reg;
+reg [31:0] dag_1000_entry_803;
+reg [31:0] dag_1000_entry_803_reg;
+reg [31:0] dag_1000_entry_804;
+reg [31:0] dag_1000_entry_804_reg;
+reg [31:0] dag_1000_entry_805;
+reg [31:0] dag_1000_entry_805_reg;
+reg [15:0] dag_1000_entry_806;
+reg [15:0] dag_1000_entry_806_reg;
+reg [63:0] dag_1000_entry_807;
+reg [63:0] dag_1000_entry_807_reg;
+reg [7:0] dag_1000_entry_808;
+reg [7:0] bp_reg_62;
+reg [7:0] dag_1000_entry_808_reg;
+reg [15:0] dag_1000_entry_809;
+reg [15:0] dag_1000_entry_809_reg;
+reg [15:0] dag_1000_entry_810;
+reg [15:0] dag_1000_entry_810_reg;
+reg [7:0] dag_1000_entry_811;
+reg [7:0] bp_reg_63;
+reg [7:0] dag_1000_entry_811_reg;
+reg [63:0] dag_1000_entry_812;
+reg [63:0] dag_1000_entry_812_reg;
+reg [31:0] dag_1000_entry_813;
+reg [31:0] dag_1000_entry_813_reg;
+reg [63:0] dag_1000_entry_814;
+reg [63:0] dag_1000_entry_814_reg;
+reg [31:0] dag_1000_entry_815;
+reg [31:0] dag_1000_entry_815_reg;
+reg [7:0] dag_1000_entry_816;
+reg [7:0] bp_reg_64;
+reg [7:0] dag_1000_entry_816_reg;
+reg [7:0] dag_1000_entry_817;
+reg [7:0] dag_1000_entry_817_reg;
+reg [31:0] dag_1000_entry_818;
+reg [31:0] dag_1000_entry_818_reg;
+reg [63:0] dag_1000_entry_819;
+reg [63:0] dag_1000_entry_819_reg;
+reg [63:0] dag_1000_entry_820;
+reg [63:0] dag_1000_entry_820_reg;
+reg [7:0] dag_1000_entry_821;
+reg [7:0] bp_reg_65;
+reg [7:0] dag_1000_entry_821_reg;
+reg [7:0] dag_1000_entry_822;
+reg [7:0] bp_reg_66;
+reg [7:0] dag_1000_entry_822_reg;
+reg [31:0] dag_1000_entry_823;
+reg [31:0] dag_1000_entry_823_reg;
+reg [31:0] dag_1000_entry_824;
+reg [31:0] dag_1000_entry_824_reg;
+reg [63:0] dag_1000_entry_825;
+reg [63:0] dag_1000_entry_825_reg;
+reg [15:0] dag_1000_entry_827;
+reg [15:0] dag_1000_entry_827_reg;
+reg [15:0] dag_1000_entry_828;
+reg [15:0] dag_1000_entry_828_reg;
+reg [15:0] dag_1000_entry_829;
+reg [15:0] dag_1000_entry_829_reg;
+reg [63:0] dag_1000_entry_830;
+reg [63:0] dag_1000_entry_830_reg;
+reg [31:0] dag_1000_entry_831;
+reg [31:0] dag_1000_entry_831_reg;
+reg [31:0] dag_1000_entry_832;
+reg [31:0] dag_1000_entry_832_reg;
+reg [31:0] dag_1000_entry_833;
+reg [31:0] dag_1000_entry_833_reg;
+reg [7:0] dag_1000_entry_834;
+reg [7:0] bp_reg_67;
+reg [7:0] dag_1000_entry_834_reg;
+reg [63:0] dag_1000_entry_835;
+reg [63:0] dag_1000_entry_835_reg;
+reg [7:0] dag_1000_entry_836;
+reg [7:0] dag_1000_entry_836_reg;
+reg [15:0] dag_1000_entry_837;
+reg [15:0] dag_1000_entry_837_reg;
+reg [31:0] dag_1000_entry_838;
+reg [31:0] dag_1000_entry_838_reg;
+reg [7:0] dag_1000_entry_839;
+reg [7:0] dag_1000_entry_839_reg;
+reg [31:0] dag_1000_entry_840;
+reg [31:0] dag_1000_entry_840_reg;
+reg [31:0] dag_1000_entry_841;
+reg [31:0] dag_1000_entry_841_reg;
+reg [63:0] dag_1000_entry_842;
+reg [63:0] dag_1000_entry_842_reg;
+reg [63:0] dag_1000_entry_843;
+reg [63:0] dag_1000_entry_843_reg;
+reg [63:0] dag_1000_entry_844;
+reg [63:0] dag_1000_entry_844_reg;
+reg [63:0] dag_1000_entry_845;
+reg [63:0] dag_1000_entry_845_reg;
+reg [31:0] dag_1000_entry_847;
+reg [31:0] dag_1000_entry_847_reg;
+reg [31:0] dag_1000_entry_848;
+reg [31:0] dag_1000_entry_848_reg;
+reg [63:0] dag_1000_entry_849;
+reg [63:0] dag_1000_entry_849_reg;
+reg [15:0] dag_1000_entry_851;
+reg [15:0] dag_1000_entry_851_reg;
+reg [63:0] dag_1000_entry_852;
+reg [63:0] dag_1000_entry_852_reg;
+reg [15:0] dag_1000_entry_853;
+reg [15:0] dag_1000_entry_853_reg;
+reg [7:0] dag_1000_entry_854;
+reg [7:0] dag_1000_entry_854_reg;
+reg [63:0] dag_1000_entry_856;
+reg [63:0] dag_1000_entry_856_reg;
+reg [31:0] dag_1000_entry_857;
+reg [31:0] dag_1000_entry_857_reg;
+reg [7:0] dag_1000_entry_858;
+reg [7:0] dag_1000_entry_858_reg;
+reg [15:0] dag_1000_entry_859;
+reg [15:0] dag_1000_entry_859_reg;
+reg [31:0] dag_1000_entry_860;
+reg [31:0] dag_1000_entry_860_reg;
+reg [15:0] dag_1000_entry_861;
+reg [15:0] dag_1000_entry_861_reg;
+reg [7:0] dag_1000_entry_862;
+reg [7:0] dag_1000_entry_862_reg;
+reg [63:0] dag_1000_entry_863;
+reg [63:0] dag_1000_entry_863_reg;
+reg [7:0] dag_1000_entry_864;
+reg [7:0] bp_reg_68;
+reg [7:0] dag_1000_entry_864_reg;
+reg [63:0] dag_1000_entry_865;
+reg [63:0] dag_1000_entry_865_reg;
+reg [63:0] dag_1000_entry_866;
+reg [63:0] dag_1000_entry_866_reg;
+reg [15:0] dag_1000_entry_867;
+reg [15:0] dag_1000_entry_867_reg;
+reg [31:0] dag_1000_entry_868;
+reg [31:0] dag_1000_entry_868_reg;
+reg [31:0] dag_1000_entry_869;
+reg [31:0] dag_1000_entry_869_reg;
+reg [63:0] dag_1000_entry_870;
+reg [63:0] dag_1000_entry_870_reg;
+reg [7:0] dag_1000_entry_871;
+reg [7:0] dag_1000_entry_871_reg;
+reg [63:0] dag_1000_entry_872;
+reg [63:0] dag_1000_entry_872_reg;
+reg [7:0] dag_1000_entry_873;
+reg [7:0] dag_1000_entry_873_reg;
+reg [31:0] dag_1000_entry_874;
+reg [31:0] dag_1000_entry_874_reg;
+reg [7:0] dag_1000_entry_875;
+reg [7:0] bp_reg_69;
+reg [7:0] dag_1000_entry_875_reg;
+reg [63:0] dag_1000_entry_876;
+reg [63:0] dag_1000_entry_876_reg;
+reg [63:0] dag_1000_entry_877;
+reg [63:0] dag_1000_entry_877_reg;
+reg [15:0] dag_1000_entry_878;
+reg [15:0] dag_1000_entry_878_reg;
+reg [63:0] dag_1000_entry_879;
+reg [63:0] dag_1000_entry_879_reg;
+reg [7:0] dag_1000_entry_880;
+reg [7:0] bp_reg_70;
+reg [7:0] dag_1000_entry_880_reg;
+reg [63:0] dag_1000_entry_881;
+reg [63:0] dag_1000_entry_881_reg;
+reg [63:0] dag_1000_entry_883;
+reg [63:0] dag_1000_entry_883_reg;
+reg [31:0] dag_1000_entry_884;
+reg [31:0] dag_1000_entry_884_reg;
+reg [15:0] dag_1000_entry_885;
+reg [15:0] dag_1000_entry_885_reg;
+reg [31:0] dag_1000_entry_886;
+reg [31:0] dag_1000_entry_886_reg;
+reg [31:0] dag_1000_entry_889;
+reg [31:0] dag_1000_entry_889_reg;
+reg [15:0] dag_1000_entry_890;
+reg [15:0] bp_reg_36;
+reg [15:0] dag_1000_entry_890_reg;
+reg [63:0] dag_1000_entry_892;
+reg [63:0] dag_1000_entry_892_reg;
+reg [7:0] dag_1000_entry_894;
+reg  dag_1000_entry_894_reg;
+reg [63:0] dag_1000_entry_895;
+reg [63:0] dag_1000_entry_895_reg;
+reg [31:0] dag_1000_entry_896;
+reg [31:0] dag_1000_entry_896_reg;
+reg [31:0] dag_1000_entry_897;
+reg [31:0] dag_1000_entry_897_reg;
+reg [7:0] dag_1000_entry_898;
+reg [7:0] bp_reg_71;
+reg [7:0] dag_1000_entry_898_reg;
+reg [15:0] dag_1000_entry_899;
+reg [15:0] dag_1000_entry_899_reg;
+reg [7:0] dag_1000_entry_900;
+reg [7:0] bp_reg_72;
+reg [7:0] dag_1000_entry_900_reg;
+reg [7:0] dag_1000_entry_901;
+reg [7:0] dag_1000_entry_901_reg;
+reg [7:0] dag_1000_entry_902;
+reg [7:0] dag_1000_entry_902_reg;
+reg [63:0] dag_1000_entry_904;
+reg [63:0] dag_1000_entry_904_reg;
+reg [63:0] dag_1000_entry_905;
+reg [63:0] dag_1000_entry_905_reg;
+reg [15:0] dag_1000_entry_906;
+reg [15:0] dag_1000_entry_906_reg;
+reg [63:0] dag_1000_entry_907;
+reg [63:0] dag_1000_entry_907_reg;
+reg [63:0] dag_1000_entry_908;
+reg [63:0] dag_1000_entry_908_reg;
+reg [31:0] dag_1000_entry_909;
+reg [7:0] dag_1000_entry_909_reg;
+reg [7:0] dag_1000_entry_910;
+reg [7:0] dag_1000_entry_910_reg;
+reg [15:0] dag_1000_entry_911;
+reg [15:0] dag_1000_entry_911_reg;
+reg [63:0] dag_1000_entry_912;
+reg [63:0] dag_1000_entry_912_reg;
+reg [7:0] dag_1000_entry_913;
+reg [7:0] dag_1000_entry_913_reg;
+reg [15:0] dag_1000_entry_914;
+reg [15:0] dag_1000_entry_914_reg;
+reg [31:0] dag_1000_entry_915;
+reg [31:0] dag_1000_entry_915_reg;
+reg [63:0] dag_1000_entry_916;
+reg [63:0] dag_1000_entry_916_reg;
+reg [63:0] dag_1000_entry_917;
+reg [63:0] dag_1000_entry_917_reg;
+reg [15:0] dag_1000_entry_918;
+reg [15:0] dag_1000_entry_918_reg;
+reg [63:0] dag_1000_entry_920;
+reg [63:0] dag_1000_entry_920_reg;
+reg [63:0] dag_1000_entry_921;
+reg  dag_1000_entry_921_reg;
+reg [7:0] dag_1000_entry_922;
+reg [7:0] dag_1000_entry_922_reg;
+reg [31:0] dag_1000_entry_923;
+reg [31:0] dag_1000_entry_923_reg;
+reg [63:0] dag_1000_entry_924;
+reg [63:0] dag_1000_entry_924_reg;
+reg [63:0] dag_1000_entry_925;
+reg [63:0] dag_1000_entry_925_reg;
+reg [63:0] dag_1000_entry_926;
+reg [63:0] dag_1000_entry_926_reg;
+reg [31:0] dag_1000_entry_927;
+reg  dag_1000_entry_927_reg;
+reg [15:0] dag_1000_entry_928;
+reg [15:0] dag_1000_entry_928_reg;
+reg [15:0] dag_1000_entry_929;
+reg [15:0] dag_1000_entry_929_reg;
+reg [15:0] dag_1000_entry_930;
+reg [15:0] dag_1000_entry_930_reg;
+reg [7:0] dag_1000_entry_931;
+reg [7:0] dag_1000_entry_931_reg;
+reg [15:0] dag_1000_entry_932;
+reg [15:0] dag_1000_entry_932_reg;
+reg [15:0] dag_1000_entry_933;
+reg [15:0] dag_1000_entry_933_reg;
+reg [31:0] dag_1000_entry_935;
+reg  dag_1000_entry_935_reg;
+reg [7:0] dag_1000_entry_936;
+reg [7:0] dag_1000_entry_936_reg;
+reg [15:0] dag_1000_entry_937;
+reg [15:0] dag_1000_entry_937_reg;
+reg [7:0] dag_1000_entry_938;
+reg [7:0] dag_1000_entry_938_reg;
+reg [7:0] dag_1000_entry_939;
+reg [7:0] dag_1000_entry_939_reg;
+reg [7:0] dag_1000_entry_942;
+reg [7:0] dag_1000_entry_942_reg;
+reg [63:0] dag_1000_entry_943;
+reg [63:0] dag_1000_entry_943_reg;
+reg [7:0] dag_1000_entry_945;
+reg [7:0] dag_1000_entry_945_reg;
+reg [63:0] dag_1000_entry_947;
+reg [63:0] dag_1000_entry_947_reg;
+reg [31:0] dag_1000_entry_948;
+reg [31:0] dag_1000_entry_948_reg;
+reg [63:0] dag_1000_entry_949;
+reg [63:0] dag_1000_entry_949_reg;
+reg [63:0] dag_1000_entry_951;
+reg [63:0] dag_1000_entry_951_reg;
+reg [31:0] dag_1000_entry_953;
+reg [8:0] dag_1000_entry_953_reg;
+reg [63:0] dag_1000_entry_954;
+reg [63:0] dag_1000_entry_954_reg;
+reg [15:0] dag_1000_entry_955;
+reg [15:0] dag_1000_entry_955_reg;
+reg [31:0] dag_1000_entry_956;
+reg [31:0] dag_1000_entry_956_reg;
+reg [63:0] dag_1000_entry_957;
+reg [63:0] dag_1000_entry_957_reg;
+reg [7:0] dag_1000_entry_958;
+reg [7:0] bp_reg_73;
+reg [7:0] dag_1000_entry_958_reg;
+reg [15:0] dag_1000_entry_959;
+reg [15:0] bp_reg_37;
+reg [15:0] dag_1000_entry_959_reg;
+reg [7:0] dag_1000_entry_960;
+reg [7:0] dag_1000_entry_960_reg;
+reg [15:0] dag_1000_entry_961;
+reg [15:0] dag_1000_entry_961_reg;
+reg [63:0] dag_1000_entry_962;
+reg [63:0] dag_1000_entry_962_reg;
+reg [7:0] dag_1000_entry_963;
+reg [7:0] dag_1000_entry_963_reg;
+reg [63:0] dag_1000_entry_964;
+reg [63:0] dag_1000_entry_964_reg;
+reg [31:0] dag_1000_entry_965;
+reg [31:0] dag_1000_entry_965_reg;
+reg [7:0] dag_1000_entry_968;
+reg [7:0] dag_1000_entry_968_reg;
+reg [63:0] dag_1000_entry_969;
+reg [63:0] dag_1000_entry_969_reg;
+reg [7:0] dag_1000_entry_970;
+reg [7:0] dag_1000_entry_970_reg;
+reg [15:0] dag_1000_entry_971;
+reg [15:0] bp_reg_38;
+reg [15:0] dag_1000_entry_971_reg;
+reg [31:0] dag_1000_entry_972;
+reg [31:0] dag_1000_entry_972_reg;
+reg [15:0] dag_1000_entry_973;
+reg [15:0] dag_1000_entry_973_reg;
+reg [15:0] dag_1000_entry_974;
+reg [15:0] dag_1000_entry_974_reg;
+reg [15:0] dag_1000_entry_975;
+reg [15:0] dag_1000_entry_975_reg;
+reg [63:0] dag_1000_entry_976;
+reg [63:0] dag_1000_entry_976_reg;
+reg [31:0] dag_1000_entry_977;
+reg [31:0] dag_1000_entry_977_reg;
+reg [63:0] dag_1000_entry_978;
+reg [63:0] dag_1000_entry_978_reg;
+reg [15:0] dag_1000_entry_979;
+reg [15:0] dag_1000_entry_979_reg;
+reg [7:0] dag_1000_entry_980;
+reg [7:0] dag_1000_entry_980_reg;
+reg [31:0] dag_1000_entry_981;
+reg [31:0] dag_1000_entry_981_reg;
+reg [7:0] dag_1000_entry_982;
+reg [7:0] dag_1000_entry_982_reg;
+reg [31:0] dag_1000_entry_983;
+reg [31:0] dag_1000_entry_983_reg;
+reg [31:0] dag_1000_entry_984;
+reg [31:0] dag_1000_entry_984_reg;
+reg [31:0] dag_1000_entry_985;
+reg [31:0] dag_1000_entry_985_reg;
+reg [15:0] dag_1000_entry_987;
+reg [15:0] dag_1000_entry_987_reg;
+reg [31:0] dag_1000_entry_988;
+reg [31:0] dag_1000_entry_988_reg;
+reg [31:0] dag_1000_entry_990;
+reg [31:0] dag_1000_entry_990_reg;
+reg [63:0] dag_1000_entry_993;
+reg [63:0] dag_1000_entry_993_reg;
+reg [31:0] dag_1000_entry_995;
+reg [31:0] dag_1000_entry_995_reg;
+reg [15:0] dag_1000_entry_996;
+reg [15:0] dag_1000_entry_996_reg;
+reg [15:0] dag_1000_entry_997;
+reg [15:0] dag_1000_entry_997_reg;
+reg [7:0] dag_1000_entry_998;
+reg [7:0] dag_1000_entry_998_reg;
+reg [31:0] dag_1000_entry_999;
+reg [31:0] dag_1000_entry_999_reg;
+reg [7:0] dag_1000_entry_1000;
+reg [7:0] dag_1000_entry_1000_reg;
+reg [31:0] dag_1000_entry_1003;
+reg [31:0] dag_1000_entry_1003_reg;
+reg [7:0] dag_1000_entry_1004;
+reg [7:0] bp_reg_74;
+reg [7:0] dag_1000_entry_1004_reg;
+reg [15:0] dag_1000_entry_1006;
+reg [15:0] dag_1000_entry_1006_reg;
+reg [63:0] dag_1000_entry_1007;
+reg [31:0] dag_1000_entry_1007_reg;
+reg [63:0] dag_1000_entry_1008;
+reg [31:0] dag_1000_entry_1008_reg;
+reg [63:0] dag_1000_entry_1009;
+reg [63:0] dag_1000_entry_1009_reg;
+reg [63:0] dag_1000_entry_1010;
+reg [63:0] dag_1000_entry_1010_reg;
+reg [15:0] dag_1000_entry_and_16_16_0_op0;
+reg [15:0] dag_1000_entry_and_16_16_0_op1;
+reg [15:0] dag_1000_entry_and_16_16_0;
+reg [7:0] dag_1000_entry_mul_8_8_0_op0;
+reg [7:0] dag_1000_entry_mul_8_8_0_op1;
+reg [7:0] dag_1000_entry_mul_8_8_0;
+reg [7:0] dag_1000_entry_or_8_8_0_op0;
+reg [7:0] dag_1000_entry_or_8_8_0_op1;
+reg [7:0] dag_1000_entry_or_8_8_0;
+reg [7:0] dag_1000_entry_add_8_8_0_op0;
+reg [7:0] dag_1000_entry_add_8_8_0_op1;
+reg [7:0] dag_1000_entry_add_8_8_0;
+reg [7:0] dag_1000_entry_add_8_8_1_op0;
+reg [7:0] dag_1000_entry_add_8_8_1_op1;
+reg [7:0] dag_1000_entry_add_8_8_1;
+reg [7:0] dag_1000_entry_and_8_8_0_op0;
+reg [7:0] dag_1000_entry_and_8_8_0_op1;
+reg [7:0] dag_1000_entry_and_8_8_0;
+reg [31:0] dag_1000_entry_or_32_32_0_op0;
+reg [31:0] dag_1000_entry_or_32_32_0_op1;
+reg [31:0] dag_1000_entry_or_32_32_0;
+reg [15:0] dag_1000_entry_add_16_16_0_op0;
+reg [15:0] dag_1000_entry_add_16_16_0_op1;
+reg [15:0] dag_1000_entry_add_16_16_0;
+reg [15:0] dag_1000_entry_add_16_16_1_op0;
+reg [15:0] dag_1000_entry_add_16_16_1_op1;
+reg [15:0] dag_1000_entry_add_16_16_1;
+reg [15:0] dag_1000_entry_mul_16_16_0_op0;
+reg [15:0] dag_1000_entry_mul_16_16_0_op1;
+reg [15:0] dag_1000_entry_mul_16_16_0;
+reg [31:0] dag_1000_entry_mul_32_32_0_op0;
+reg [31:0] dag_1000_entry_mul_32_32_0_op1;
+reg [31:0] dag_1000_entry_mul_32_32_0;
+reg [31:0] dag_1000_entry_add_32_32_0_op0;
+reg [31:0] dag_1000_entry_add_32_32_0_op1;
+reg [31:0] dag_1000_entry_add_32_32_0;
+reg [31:0] dag_1000_entry_and_32_32_0_op0;
+reg [31:0] dag_1000_entry_and_32_32_0_op1;
+reg [31:0] dag_1000_entry_and_32_32_0;
+reg [15:0] dag_1000_entry_or_16_16_0_op0;
+reg [15:0] dag_1000_entry_or_16_16_0_op1;
+reg [15:0] dag_1000_entry_or_16_16_0;
+reg [7:0] dag_1000_entry_18;
+reg [63:0] dag_1000_entry_28;
+reg [63:0] dag_1000_entry_30;
+reg [63:0] dag_1000_entry_24;
+reg [15:0] dag_1000_entry_52;
+reg [63:0] dag_1000_entry_80;
+reg [63:0] dag_1000_entry_57;
+reg [63:0] dag_1000_entry_71;
+reg [63:0] dag_1000_entry_89;
+reg [15:0] dag_1000_entry_91;
+reg [15:0] dag_1000_entry_97;
+reg [7:0] dag_1000_entry_162;
+reg [31:0] dag_1000_entry_144;
+reg [63:0] dag_1000_entry_217;
+reg [63:0] dag_1000_entry_250;
+reg [63:0] dag_1000_entry_316;
+reg [63:0] dag_1000_entry_286;
+reg [63:0] dag_1000_entry_317;
+reg [31:0] dag_1000_entry_195;
+reg [63:0] dag_1000_entry_401;
+reg [7:0] dag_1000_entry_468;
+reg [63:0] dag_1000_entry_477;
+reg [63:0] dag_1000_entry_497;
+reg [7:0] dag_1000_entry_460;
+reg [63:0] dag_1000_entry_493;
+reg [7:0] dag_1000_entry_551;
+reg [15:0] dag_1000_entry_462;
+reg [63:0] dag_1000_entry_538;
+reg [31:0] dag_1000_entry_261;
+reg [15:0] dag_1000_entry_495;
+reg [63:0] dag_1000_entry_548;
+reg [7:0] dag_1000_entry_640;
+reg [63:0] dag_1000_entry_576;
+reg [63:0] dag_1000_entry_615;
+reg [63:0] dag_1000_entry_611;
+reg [63:0] dag_1000_entry_612;
+reg [7:0] dag_1000_entry_708;
+reg [7:0] dag_1000_entry_743;
+reg [31:0] dag_1000_entry_430;
+reg [31:0] dag_1000_entry_520;
+reg [63:0] dag_1000_entry_598;
+reg [63:0] dag_1000_entry_600;
+reg [63:0] dag_1000_entry_623;
+reg [7:0] dag_1000_entry_92;
+reg [15:0] dag_1000_entry_700;
+reg [7:0] dag_1000_entry_98;
+reg [7:0] dag_1000_entry_186;
+reg [7:0] dag_1000_entry_204;
+reg [7:0] dag_1000_entry_490;
+reg [31:0] dag_1000_entry_677;
+reg [7:0] dag_1000_entry_246;
+reg [7:0] dag_1000_entry_315;
+reg [63:0] dag_1000_entry_335;
+reg [7:0] dag_1000_entry_416;
+reg [7:0] dag_1000_entry_587;
+reg [7:0] dag_1000_entry_392;
+reg [7:0] dag_1000_entry_630;
+reg [63:0] dag_1000_entry_710;
+reg [63:0] dag_1000_entry_746;
+reg [63:0] dag_1000_entry_767;
+reg [7:0] dag_1000_entry_402;
+reg [63:0] dag_1000_entry_784;
+reg [7:0] dag_1000_entry_850;
+reg [7:0] dag_1000_entry_855;
+reg [7:0] dag_1000_entry_919;
+reg [7:0] dag_1000_entry_986;
+reg [7:0] dag_1000_entry_946;
+reg [7:0] dag_1000_entry_994;
+reg [63:0] dag_1000_entry_893;
+reg [63:0] dag_1000_entry_846;
+reg [63:0] dag_1000_entry_903;
+reg [63:0] dag_1000_entry_934;
+reg [63:0] dag_1000_entry_940;
+reg [63:0] dag_1000_entry_966;
+reg [63:0] dag_1000_entry_1001;
+reg [31:0] dag_1000_entry_229;
+reg [15:0] dag_1000_entry_941;
+reg [15:0] dag_1000_entry_211;
+reg [15:0] dag_1000_entry_154;
+reg [15:0] dag_1000_entry_400;
+reg [15:0] dag_1000_entry_463;
+reg [15:0] dag_1000_entry_826;
+reg [31:0] dag_1000_entry_950;
+reg [15:0] dag_1000_entry_245;
+reg [63:0] dag_1000_entry_366;
+reg [15:0] dag_1000_entry_591;
+reg [7:0] dag_1000_entry_989;
+reg [15:0] dag_1000_entry_521;
+reg [15:0] dag_1000_entry_614;
+reg [31:0] dag_1000_entry_166;
+reg [15:0] dag_1000_entry_601;
+reg [15:0] dag_1000_entry_643;
+reg [31:0] dag_1000_entry_182;
+reg [15:0] dag_1000_entry_647;
+reg [15:0] dag_1000_entry_693;
+reg [31:0] dag_1000_entry_216;
+reg [15:0] dag_1000_entry_667;
+reg [15:0] dag_1000_entry_887;
+reg [15:0] dag_1000_entry_888;
+reg [31:0] dag_1000_entry_66;
+reg [31:0] dag_1000_entry_122;
+reg [31:0] dag_1000_entry_257;
+reg [15:0] dag_1000_entry_891;
+reg [15:0] dag_1000_entry_952;
+reg [31:0] dag_1000_entry_170;
+reg [31:0] dag_1000_entry_297;
+reg [15:0] dag_1000_entry_944;
+reg [15:0] dag_1000_entry_967;
+reg [63:0] dag_1000_entry_992;
+reg [31:0] dag_1000_entry_406;
+reg [31:0] dag_1000_entry_449;
+reg [15:0] dag_1000_entry_991;
+reg [15:0] dag_1000_entry_1005;
+reg [31:0] dag_1000_entry_411;
+reg [31:0] dag_1000_entry_482;
+reg [31:0] dag_1000_entry_422;
+reg [31:0] dag_1000_entry_458;
+reg [31:0] dag_1000_entry_563;
+reg [31:0] dag_1000_entry_561;
+reg [31:0] dag_1000_entry_594;
+reg [31:0] dag_1000_entry_734;
+reg [31:0] dag_1000_entry_606;
+reg [31:0] dag_1000_entry_642;
+reg [31:0] dag_1000_entry_676;
+reg [31:0] dag_1000_entry_801;
+reg [31:0] dag_1000_entry_735;
+reg [31:0] dag_1000_entry_759;
+reg [31:0] dag_1000_entry_882;
+reg [31:0] dag_1000_entry_1002;
+
+/* FSM BEGIN ---------------------------------------------------------------*/
+
+always @ (posedge clk) begin
+	if (reset == 1'b1) begin
+		cur_state <= BPHLS;
+	end else begin 
+		cur_state <= next_state;
+	end
+end
+
+always @ (*) begin
+	next_state = cur_state;
+
+	case (cur_state)
+	BPHLS:
+		if ((start == 1'd1)) begin
+			next_state = BPHLS_F_dag_1000_BB_0_S_0;
+		end
+	BPHLS_F_dag_1000_BB_0_S_0:
+		next_state = BPHLS_F_dag_1000_BB_0_S_1;
+	BPHLS_F_dag_1000_BB_0_S_1:
+		next_state = BPHLS_F_dag_1000_BB_0_S_2;
+	BPHLS_F_dag_1000_BB_0_S_10:
+		next_state = BPHLS_F_dag_1000_BB_0_S_11;
+	BPHLS_F_dag_1000_BB_0_S_11:
+		next_state = BPHLS_F_dag_1000_BB_0_S_12;
+	BPHLS_F_dag_1000_BB_0_S_12:
+		next_state = BPHLS_F_dag_1000_BB_0_S_13;
+	BPHLS_F_dag_1000_BB_0_S_13:
+		next_state = BPHLS_F_dag_1000_BB_0_S_14;
+	BPHLS_F_dag_1000_BB_0_S_14:
+		next_state = BPHLS_F_dag_1000_BB_0_S_15;
+	BPHLS_F_dag_1000_BB_0_S_15:
+		next_state = BPHLS_F_dag_1000_BB_0_S_16;
+	BPHLS_F_dag_1000_BB_0_S_16:
+		next_state = BPHLS_F_dag_1000_BB_0_S_17;
+	BPHLS_F_dag_1000_BB_0_S_17:
+		next_state = BPHLS_F_dag_1000_BB_0_S_18;
+	BPHLS_F_dag_1000_BB_0_S_18:
+		next_state = BPHLS_F_dag_1000_BB_0_S_19;
+	BPHLS_F_dag_1000_BB_0_S_19:
+		next_state = BPHLS_F_dag_1000_BB_0_S_20;
+	BPHLS_F_dag_1000_BB_0_S_2:
+		next_state = BPHLS_F_dag_1000_BB_0_S_3;
+	BPHLS_F_dag_1000_BB_0_S_20:
+		next_state = BPHLS_F_dag_1000_BB_0_S_21;
+	BPHLS_F_dag_1000_BB_0_S_21:
+		next_state = BPHLS_F_dag_1000_BB_0_S_22;
+	BPHLS_F_dag_1000_BB_0_S_22:
+		next_state = BPHLS_F_dag_1000_BB_0_S_23;
+	BPHLS_F_dag_1000_BB_0_S_23:
+		next_state = BPHLS_F_dag_1000_BB_0_S_24;
+	BPHLS_F_dag_1000_BB_0_S_24:
+		next_state = BPHLS_F_dag_1000_BB_0_S_25;
+	BPHLS_F_dag_1000_BB_0_S_25:
+		next_state = BPHLS_F_dag_1000_BB_0_S_26;
+	BPHLS_F_dag_1000_BB_0_S_26:
+		next_state = BPHLS_F_dag_1000_BB_0_S_27;
+	BPHLS_F_dag_1000_BB_0_S_27:
+		next_state = BPHLS_F_dag_1000_BB_0_S_28;
+	BPHLS_F_dag_1000_BB_0_S_28:
+		next_state = BPHLS_F_dag_1000_BB_0_S_29;
+	BPHLS_F_dag_1000_BB_0_S_29:
+		next_state = BPHLS_F_dag_1000_BB_0_S_30;
+	BPHLS_F_dag_1000_BB_0_S_3:
+		next_state = BPHLS_F_dag_1000_BB_0_S_4;
+	BPHLS_F_dag_1000_BB_0_S_30:
+		next_state = BPHLS_F_dag_1000_BB_0_S_31;
+	BPHLS_F_dag_1000_BB_0_S_31:
+		next_state = BPHLS_F_dag_1000_BB_0_S_32;
+	BPHLS_F_dag_1000_BB_0_S_32:
+		next_state = BPHLS_F_dag_1000_BB_0_S_33;
+	BPHLS_F_dag_1000_BB_0_S_33:
+		next_state = BPHLS_F_dag_1000_BB_0_S_34;
+	BPHLS_F_dag_1000_BB_0_S_34:
+		next_state = BPHLS_F_dag_1000_BB_0_S_35;
+	BPHLS_F_dag_1000_BB_0_S_35:
+		next_state = BPHLS_F_dag_1000_BB_0_S_36;
+	BPHLS_F_dag_1000_BB_0_S_36:
+		next_state = BPHLS_F_dag_1000_BB_0_S_37;
+	BPHLS_F_dag_1000_BB_0_S_37:
+		next_state = BPHLS_F_dag_1000_BB_0_S_38;
+	BPHLS_F_dag_1000_BB_0_S_38:
+		next_state = BPHLS_F_dag_1000_BB_0_S_39;
+	BPHLS_F_dag_1000_BB_0_S_39:
+		next_state = BPHLS_F_dag_1000_BB_0_S_40;
+	BPHLS_F_dag_1000_BB_0_S_4:
+		next_state = BPHLS_F_dag_1000_BB_0_S_5;
+	BPHLS_F_dag_1000_BB_0_S_40:
+		next_state = BPHLS_F_dag_1000_BB_0_S_41;
+	BPHLS_F_dag_1000_BB_0_S_41:
+		next_state = BPHLS_F_dag_1000_BB_0_S_42;
+	BPHLS_F_dag_1000_BB_0_S_42:
+		next_state = BPHLS_F_dag_1000_BB_0_S_43;
+	BPHLS_F_dag_1000_BB_0_S_43:
+		next_state = BPHLS_F_dag_1000_BB_0_S_44;
+	BPHLS_F_dag_1000_BB_0_S_44:
+		next_state = BPHLS_F_dag_1000_BB_0_S_45;
+	BPHLS_F_dag_1000_BB_0_S_45:
+		next_state = BPHLS_F_dag_1000_BB_0_S_46;
+	BPHLS_F_dag_1000_BB_0_S_46:
+		next_state = BPHLS_F_dag_1000_BB_0_S_47;
+	BPHLS_F_dag_1000_BB_0_S_47:
+		next_state = BPHLS_F_dag_1000_BB_0_S_48;
+	BPHLS_F_dag_1000_BB_0_S_48:
+		next_state = BPHLS_F_dag_1000_BB_0_S_49;
+	BPHLS_F_dag_1000_BB_0_S_49:
+		next_state = BPHLS_F_dag_1000_BB_0_S_50;
+	BPHLS_F_dag_1000_BB_0_S_5:
+		next_state = BPHLS_F_dag_1000_BB_0_S_6;
+	BPHLS_F_dag_1000_BB_0_S_50:
+		next_state = BPHLS_F_dag_1000_BB_0_S_51;
+	BPHLS_F_dag_1000_BB_0_S_51:
+		next_state = BPHLS_F_dag_1000_BB_0_S_52;
+	BPHLS_F_dag_1000_BB_0_S_52:
+		next_state = BPHLS_F_dag_1000_BB_0_S_53;
+	BPHLS_F_dag_1000_BB_0_S_53:
+		next_state = BPHLS_F_dag_1000_BB_0_S_54;
+	BPHLS_F_dag_1000_BB_0_S_54:
+		next_state = BPHLS_F_dag_1000_BB_0_S_55;
+	BPHLS_F_dag_1000_BB_0_S_55:
+		next_state = BPHLS_F_dag_1000_BB_0_S_56;
+	BPHLS_F_dag_1000_BB_0_S_56:
+		next_state = BPHLS_F_dag_1000_BB_0_S_57;
+	BPHLS_F_dag_1000_BB_0_S_57:
+		next_state = BPHLS_F_dag_1000_BB_0_S_58;
+	BPHLS_F_dag_1000_BB_0_S_58:
+		next_state = BPHLS_F_dag_1000_BB_0_S_59;
+	BPHLS_F_dag_1000_BB_0_S_59:
+		next_state = BPHLS_F_dag_1000_BB_0_S_60;
+	BPHLS_F_dag_1000_BB_0_S_6:
+		next_state = BPHLS_F_dag_1000_BB_0_S_7;
+	BPHLS_F_dag_1000_BB_0_S_60:
+		next_state = BPHLS_F_dag_1000_BB_0_S_61;
+	BPHLS_F_dag_1000_BB_0_S_61:
+		next_state = BPHLS_F_dag_1000_BB_0_S_62;
+	BPHLS_F_dag_1000_BB_0_S_62:
+		next_state = BPHLS_F_dag_1000_BB_0_S_63;
+	BPHLS_F_dag_1000_BB_0_S_63:
+		next_state = BPHLS_F_dag_1000_BB_0_S_64;
+	BPHLS_F_dag_1000_BB_0_S_64:
+		next_state = BPHLS_F_dag_1000_BB_0_S_65;
+	BPHLS_F_dag_1000_BB_0_S_65:
+		next_state = BPHLS_F_dag_1000_BB_0_S_66;
+	BPHLS_F_dag_1000_BB_0_S_66:
+		next_state = BPHLS_F_dag_1000_BB_0_S_67;
+	BPHLS_F_dag_1000_BB_0_S_67:
+		next_state = BPHLS_F_dag_1000_BB_0_S_68;
+	BPHLS_F_dag_1000_BB_0_S_68:
+		next_state = BPHLS_F_dag_1000_BB_0_S_69;
+	BPHLS_F_dag_1000_BB_0_S_69:
+		next_state = BPHLS_F_dag_1000_BB_0_S_70;
+	BPHLS_F_dag_1000_BB_0_S_7:
+		next_state = BPHLS_F_dag_1000_BB_0_S_8;
+	BPHLS_F_dag_1000_BB_0_S_70:
+		next_state = BPHLS_F_dag_1000_BB_0_S_71;
+	BPHLS_F_dag_1000_BB_0_S_71:
+		next_state = BPHLS_F_dag_1000_BB_0_S_72;
+	BPHLS_F_dag_1000_BB_0_S_72:
+		next_state = BPHLS_F_dag_1000_BB_0_S_73;
+	BPHLS_F_dag_1000_BB_0_S_73:
+		next_state = BPHLS_F_dag_1000_BB_0_S_74;
+	BPHLS_F_dag_1000_BB_0_S_74:
+		next_state = BPHLS_F_dag_1000_BB_0_S_75;
+	BPHLS_F_dag_1000_BB_0_S_75:
+		next_state = BPHLS_F_dag_1000_BB_0_S_76;
+	BPHLS_F_dag_1000_BB_0_S_76:
+		next_state = BPHLS_F_dag_1000_BB_0_S_77;
+	BPHLS_F_dag_1000_BB_0_S_77:
+		next_state = BPHLS_F_dag_1000_BB_0_S_78;
+	BPHLS_F_dag_1000_BB_0_S_78:
+		next_state = BPHLS_F_dag_1000_BB_0_S_79;
+	BPHLS_F_dag_1000_BB_0_S_79:
+		next_state = BPHLS_F_dag_1000_BB_0_S_80;
+	BPHLS_F_dag_1000_BB_0_S_8:
+		next_state = BPHLS_F_dag_1000_BB_0_S_9;
+	BPHLS_F_dag_1000_BB_0_S_80:
+		next_state = BPHLS_F_dag_1000_BB_0_S_81;
+	BPHLS_F_dag_1000_BB_0_S_81:
+		next_state = BPHLS_F_dag_1000_BB_0_S_82;
+	BPHLS_F_dag_1000_BB_0_S_82:
+		next_state = BPHLS_F_dag_1000_BB_0_S_83;
+	BPHLS_F_dag_1000_BB_0_S_83:
+		next_state = BPHLS_F_dag_1000_BB_0_S_84;
+	BPHLS_F_dag_1000_BB_0_S_84:
+		next_state = BPHLS_F_dag_1000_BB_0_S_85;
+	BPHLS_F_dag_1000_BB_0_S_85:
+		next_state = BPHLS;
+	BPHLS_F_dag_1000_BB_0_S_9:
+		next_state = BPHLS_F_dag_1000_BB_0_S_10;
+	default:
+		next_state = cur_state;
+	endcase
+end
+
+/* FSM END -----------------------------------------------------------------*/
+
+always @ (*) begin
+	dag_1000_entry_8[15:0] = dag_1000_entry_add_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_0)) begin
+		bp_reg_0[15:0] <= dag_1000_entry_8[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_0)) begin
+		bp_reg_0[47:16] <= dag_1000_entry_9[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_0)) begin
+		bp_reg_0[111:48] <= dag_1000_entry_10[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_0)) begin
+		bp_reg_0[119:112] <= dag_1000_entry_11[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_0)) begin
+		bp_reg_0[127:120] <= dag_1000_entry_12[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_1)) begin
+		bp_reg_0[7:0] <= dag_1000_entry_20[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_5)) begin
+		bp_reg_0[31:0] <= dag_1000_entry_27[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_4)) begin
+		bp_reg_0[95:80] <= dag_1000_entry_29[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_1)) begin
+		bp_reg_0[15:8] <= dag_1000_entry_32[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_1)) begin
+		bp_reg_0[63:48] <= dag_1000_entry_35[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_1)) begin
+		bp_reg_0[79:64] <= dag_1000_entry_38[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_5)) begin
+		bp_reg_0[63:32] <= dag_1000_entry_39[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_2)) begin
+		bp_reg_0[71:64] <= dag_1000_entry_40[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_1)) begin
+		bp_reg_0[87:80] <= dag_1000_entry_42[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_5)) begin
+		bp_reg_0[95:64] <= dag_1000_entry_43[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_2)) begin
+		bp_reg_0[79:72] <= dag_1000_entry_44[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_1)) begin
+		bp_reg_0[88:88] <= dag_1000_entry_45;
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_1)) begin
+		bp_reg_0[96:89] <= dag_1000_entry_46[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_3)) begin
+		bp_reg_0[15:8] <= dag_1000_entry_47[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_5)) begin
+		bp_reg_0[112:97] <= dag_1000_entry_48[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_1)) begin
+		bp_reg_0[112:97] <= dag_1000_entry_58[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_3)) begin
+		bp_reg_0[71:64] <= dag_1000_entry_62[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_6)) begin
+		bp_reg_0[31:0] <= dag_1000_entry_63[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_6)) begin
+		bp_reg_0[63:32] <= dag_1000_entry_64[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_7)) begin
+		bp_reg_0[63:32] <= dag_1000_entry_65[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_7)) begin
+		bp_reg_0[95:64] <= dag_1000_entry_68[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_7)) begin
+		bp_reg_0[127:96] <= dag_1000_entry_69[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_8)) begin
+		bp_reg_0[31:0] <= dag_1000_entry_76[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_8)) begin
+		bp_reg_0[63:32] <= dag_1000_entry_77[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_6)) begin
+		bp_reg_0[79:64] <= dag_1000_entry_81[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_6)) begin
+		bp_reg_0[95:80] <= dag_1000_entry_82[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_3)) begin
+		bp_reg_0[95:80] <= dag_1000_entry_84[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_6)) begin
+		bp_reg_0[112:97] <= dag_1000_entry_93[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_8)) begin
+		bp_reg_0[95:64] <= dag_1000_entry_105[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_8)) begin
+		bp_reg_0[127:96] <= dag_1000_entry_108[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_10)) begin
+		bp_reg_0[95:64] <= dag_1000_entry_127[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_9)) begin
+		bp_reg_0[31:0] <= dag_1000_entry_129[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_11)) begin
+		bp_reg_0[63:32] <= dag_1000_entry_131[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_67)) begin
+		bp_reg_0[47:32] <= dag_1000_entry_136[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_9)) begin
+		bp_reg_0[63:32] <= dag_1000_entry_139[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_12)) begin
+		bp_reg_0[95:64] <= dag_1000_entry_141[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_75)) begin
+		bp_reg_0[31:0] <= dag_1000_entry_145[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_14)) begin
+		bp_reg_0[63:32] <= dag_1000_entry_149[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_14)) begin
+		bp_reg_0[95:64] <= dag_1000_entry_152[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_15)) begin
+		bp_reg_0[63:32] <= dag_1000_entry_177[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_17)) begin
+		bp_reg_0[63:32] <= dag_1000_entry_208[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_18)) begin
+		bp_reg_0[63:32] <= dag_1000_entry_210[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_19)) begin
+		bp_reg_0[63:32] <= dag_1000_entry_226[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_20)) begin
+		bp_reg_0[63:32] <= dag_1000_entry_232[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_22)) begin
+		bp_reg_0[63:32] <= dag_1000_entry_238[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_23)) begin
+		bp_reg_0[63:32] <= dag_1000_entry_255[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_24)) begin
+		bp_reg_0[63:32] <= dag_1000_entry_260[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_25)) begin
+		bp_reg_0[63:32] <= dag_1000_entry_274[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_26)) begin
+		bp_reg_0[63:32] <= dag_1000_entry_283[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_27)) begin
+		bp_reg_0[63:32] <= dag_1000_entry_309[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_76)) begin
+		bp_reg_0[31:0] <= dag_1000_entry_370[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_77)) begin
+		bp_reg_0[31:0] <= dag_1000_entry_381[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_78)) begin
+		bp_reg_0[31:0] <= dag_1000_entry_434[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_69)) begin
+		bp_reg_0[47:32] <= dag_1000_entry_573[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_69)) begin
+		bp_reg_0[63:48] <= dag_1000_entry_583[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_70)) begin
+		bp_reg_0[63:48] <= dag_1000_entry_631[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_72)) begin
+		bp_reg_0[47:32] <= dag_1000_entry_641[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_82)) begin
+		bp_reg_0[31:0] <= dag_1000_entry_728[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_83)) begin
+		bp_reg_0[31:0] <= dag_1000_entry_731[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_72)) begin
+		bp_reg_0[79:48] <= dag_1000_entry_766[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_73)) begin
+		bp_reg_0[47:32] <= dag_1000_entry_867[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_74)) begin
+		bp_reg_0[47:32] <= dag_1000_entry_930[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_74)) begin
+		bp_reg_0[63:48] <= dag_1000_entry_933[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_74)) begin
+		bp_reg_0[79:64] <= dag_1000_entry_937[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_76)) begin
+		bp_reg_0[47:32] <= dag_1000_entry_975[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_73)) begin
+		bp_reg_0[79:48] <= dag_1000_entry_981[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_75)) begin
+		bp_reg_0[47:32] <= dag_1000_entry_987[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_82)) begin
+		bp_reg_0[63:32] <= dag_1000_entry_995[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_76)) begin
+		bp_reg_0[63:48] <= dag_1000_entry_996[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_8_reg[15:0] = bp_reg_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_9[31:0] = dag_1000_entry_or_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_9_reg[31:0] = bp_reg_0[47:16];
+end
+
+always @ (*) begin
+	dag_1000_entry_10[63:0] = (arg_7 ^ arg_6);
+end
+
+always @ (*) begin
+	dag_1000_entry_10_reg[63:0] = bp_reg_0[111:48];
+end
+
+always @ (*) begin
+	dag_1000_entry_11[7:0] = dag_1000_entry_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_11_reg[7:0] = bp_reg_0[119:112];
+end
+
+always @ (*) begin
+	dag_1000_entry_12[7:0] = dag_1000_entry_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_12_reg[7:0] = bp_reg_0[127:120];
+end
+
+always @ (*) begin
+	dag_1000_entry_13[31:0] = (arg_5 ^ arg_3);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_0)) begin
+		bp_reg_11[31:0] <= dag_1000_entry_13[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_5)) begin
+		bp_reg_11[31:0] <= dag_1000_entry_54[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_13_reg[31:0] = bp_reg_11[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_14[15:0] = dag_1000_entry_and_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_0)) begin
+		bp_reg_1[15:0] <= dag_1000_entry_14[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_0)) begin
+		bp_reg_1[23:16] <= dag_1000_entry_15[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_0)) begin
+		bp_reg_1[39:24] <= dag_1000_entry_16[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_0)) begin
+		bp_reg_1[103:40] <= dag_1000_entry_17[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_4)) begin
+		bp_reg_1[23:16] <= dag_1000_entry_49[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_2)) begin
+		bp_reg_1[72:49] <= dag_1000_entry_53[23:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_2)) begin
+		bp_reg_1[80:73] <= dag_1000_entry_56[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_2)) begin
+		bp_reg_1[88:81] <= dag_1000_entry_59[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_3)) begin
+		bp_reg_1[23:16] <= dag_1000_entry_95[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_13)) begin
+		bp_reg_1[31:0] <= dag_1000_entry_132[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_10)) begin
+		bp_reg_1[31:0] <= dag_1000_entry_133[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_45)) begin
+		bp_reg_1[88:81] <= dag_1000_entry_140[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_11)) begin
+		bp_reg_1[63:32] <= dag_1000_entry_153[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_14)) begin
+		bp_reg_1[31:0] <= dag_1000_entry_156[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_44)) begin
+		bp_reg_1[88:81] <= dag_1000_entry_164[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_46)) begin
+		bp_reg_1[88:81] <= dag_1000_entry_192[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_47)) begin
+		bp_reg_1[88:81] <= dag_1000_entry_221[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_13)) begin
+		bp_reg_1[79:64] <= dag_1000_entry_254[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_15)) begin
+		bp_reg_1[79:64] <= dag_1000_entry_304[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_48)) begin
+		bp_reg_1[88:81] <= dag_1000_entry_312[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_23)) begin
+		bp_reg_1[79:64] <= dag_1000_entry_457[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_72)) begin
+		bp_reg_1[63:32] <= dag_1000_entry_775[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_14_reg[15:0] = bp_reg_1[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_15[7:0] = (dag_1000_entry_11 - dag_1000_entry_12);
+end
+
+always @ (*) begin
+	dag_1000_entry_15_reg[7:0] = bp_reg_1[23:16];
+end
+
+always @ (*) begin
+	dag_1000_entry_16[15:0] = dag_1000_entry_add_16_16_1[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_16_reg[15:0] = bp_reg_1[39:24];
+end
+
+always @ (*) begin
+	dag_1000_entry_17[63:0] = (arg_7 + arg_6);
+end
+
+always @ (*) begin
+	dag_1000_entry_17_reg[63:0] = bp_reg_1[103:40];
+end
+
+always @ (*) begin
+	dag_1000_entry_19[15:0] = (dag_1000_entry_14 ^ dag_1000_entry_16);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_0)) begin
+		bp_reg_12[15:0] <= dag_1000_entry_19[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_0)) begin
+		bp_reg_12[16:16] <= dag_1000_entry_21;
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_0)) begin
+		bp_reg_12[24:17] <= dag_1000_entry_22[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_0)) begin
+		bp_reg_12[32:25] <= dag_1000_entry_23[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_0)) begin
+		bp_reg_12[64:33] <= dag_1000_entry_25[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_5)) begin
+		bp_reg_12[23:8] <= dag_1000_entry_74[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_5)) begin
+		bp_reg_12[39:24] <= dag_1000_entry_79[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_5)) begin
+		bp_reg_12[55:40] <= dag_1000_entry_85[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_6)) begin
+		bp_reg_12[23:8] <= dag_1000_entry_99[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_6)) begin
+		bp_reg_12[39:24] <= dag_1000_entry_101[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_3)) begin
+		bp_reg_12[32:16] <= dag_1000_entry_102[16:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_6)) begin
+		bp_reg_12[55:40] <= dag_1000_entry_109[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_8)) begin
+		bp_reg_12[31:0] <= dag_1000_entry_111[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_14)) begin
+		bp_reg_12[31:0] <= dag_1000_entry_160[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_11)) begin
+		bp_reg_12[55:40] <= dag_1000_entry_213[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_12)) begin
+		bp_reg_12[15:0] <= dag_1000_entry_235[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_69)) begin
+		bp_reg_12[55:40] <= dag_1000_entry_596[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_72)) begin
+		bp_reg_12[31:0] <= dag_1000_entry_977[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_73)) begin
+		bp_reg_12[31:0] <= dag_1000_entry_983[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_19_reg[15:0] = bp_reg_12[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_20[7:0] = dag_1000_entry_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_20_reg[7:0] = bp_reg_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_21[63:0] = (dag_1000_entry_17 - dag_1000_entry_17);
+end
+
+always @ (*) begin
+	dag_1000_entry_21_reg = bp_reg_12[16:16];
+end
+
+always @ (*) begin
+	dag_1000_entry_22[7:0] = dag_1000_entry_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_22_reg[7:0] = bp_reg_12[24:17];
+end
+
+always @ (*) begin
+	dag_1000_entry_23[7:0] = dag_1000_entry_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_23_reg[7:0] = bp_reg_12[32:25];
+end
+
+always @ (*) begin
+	dag_1000_entry_25[31:0] = (arg_5 - arg_4);
+end
+
+always @ (*) begin
+	dag_1000_entry_25_reg[31:0] = bp_reg_12[64:33];
+end
+
+always @ (*) begin
+	dag_1000_entry_26[31:0] = dag_1000_entry_and_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_4)) begin
+		dag_1000_entry_26_reg[31:0] <= dag_1000_entry_26[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_14)) begin
+		dag_1000_entry_26_reg[31:0] <= dag_1000_entry_200[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_24)) begin
+		dag_1000_entry_26_reg[31:0] <= dag_1000_entry_268[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_28)) begin
+		dag_1000_entry_26_reg[31:0] <= dag_1000_entry_348[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_32)) begin
+		dag_1000_entry_26_reg[31:0] <= dag_1000_entry_385[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_27[31:0] = dag_1000_entry_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_27_reg[31:0] = bp_reg_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_29[15:0] = dag_1000_entry_and_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_29_reg[15:0] = bp_reg_0[95:80];
+end
+
+always @ (*) begin
+	dag_1000_entry_31[31:0] = (dag_1000_entry_9 ^ arg_5);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_0)) begin
+		bp_reg_13[31:0] <= dag_1000_entry_31[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_6)) begin
+		bp_reg_13[7:0] <= dag_1000_entry_120[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_6)) begin
+		bp_reg_13[23:8] <= dag_1000_entry_123[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_6)) begin
+		bp_reg_13[31:24] <= dag_1000_entry_126[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_31_reg[31:0] = bp_reg_13[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_32[7:0] = dag_1000_entry_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_32_reg[7:0] = bp_reg_0[15:8];
+end
+
+always @ (*) begin
+	dag_1000_entry_33[63:0] = (dag_1000_entry_17 & dag_1000_entry_22);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_0)) begin
+		bp_reg_2[7:0] <= dag_1000_entry_33[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_0)) begin
+		bp_reg_2[71:8] <= dag_1000_entry_36[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_0)) begin
+		bp_reg_2[79:72] <= dag_1000_entry_37[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_0)) begin
+		bp_reg_2[143:80] <= dag_1000_entry_41[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_4)) begin
+		bp_reg_2[39:24] <= dag_1000_entry_55[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_2)) begin
+		bp_reg_2[39:32] <= dag_1000_entry_67[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_2)) begin
+		bp_reg_2[47:40] <= dag_1000_entry_70[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_2)) begin
+		bp_reg_2[63:48] <= dag_1000_entry_72[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_4)) begin
+		bp_reg_2[80:73] <= dag_1000_entry_75[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_4)) begin
+		bp_reg_2[96:81] <= dag_1000_entry_78[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_2)) begin
+		bp_reg_2[64:64] <= dag_1000_entry_83;
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_4)) begin
+		bp_reg_2[104:97] <= dag_1000_entry_87[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_4)) begin
+		bp_reg_2[112:105] <= dag_1000_entry_100[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_4)) begin
+		bp_reg_2[120:113] <= dag_1000_entry_103[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_5)) begin
+		bp_reg_2[62:55] <= dag_1000_entry_104[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_7)) begin
+		bp_reg_2[22:7] <= dag_1000_entry_106[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_4)) begin
+		bp_reg_2[128:121] <= dag_1000_entry_114[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_7)) begin
+		bp_reg_2[103:88] <= dag_1000_entry_116[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_7)) begin
+		bp_reg_2[128:113] <= dag_1000_entry_117[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_5)) begin
+		bp_reg_2[144:137] <= dag_1000_entry_118[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_5)) begin
+		bp_reg_2[152:145] <= dag_1000_entry_121[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_6)) begin
+		bp_reg_2[31:24] <= dag_1000_entry_130[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_6)) begin
+		bp_reg_2[39:32] <= dag_1000_entry_134[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_6)) begin
+		bp_reg_2[47:40] <= dag_1000_entry_135[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_6)) begin
+		bp_reg_2[152:145] <= dag_1000_entry_147[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_9)) begin
+		bp_reg_2[103:88] <= dag_1000_entry_151[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_45)) begin
+		bp_reg_2[31:24] <= dag_1000_entry_165[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_46)) begin
+		bp_reg_2[31:24] <= dag_1000_entry_196[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_14)) begin
+		bp_reg_2[88:88] <= dag_1000_entry_198;
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_11)) begin
+		bp_reg_2[143:136] <= dag_1000_entry_231[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_11)) begin
+		bp_reg_2[151:144] <= dag_1000_entry_233[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_18)) begin
+		bp_reg_2[104:89] <= dag_1000_entry_368[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_68)) begin
+		bp_reg_2[128:113] <= dag_1000_entry_570[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_67)) begin
+		bp_reg_2[128:113] <= dag_1000_entry_961[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_73)) begin
+		bp_reg_2[78:47] <= dag_1000_entry_1007[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_33_reg[7:0] = bp_reg_2[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_34[31:0] = (dag_1000_entry_26 ^ dag_1000_entry_9_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_4)) begin
+		dag_1000_entry_34_reg[31:0] <= dag_1000_entry_34[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_35[15:0] = dag_1000_entry_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_35_reg[15:0] = bp_reg_0[63:48];
+end
+
+always @ (*) begin
+	dag_1000_entry_36[63:0] = (dag_1000_entry_17 | dag_1000_entry_10);
+end
+
+always @ (*) begin
+	dag_1000_entry_36_reg[63:0] = bp_reg_2[71:8];
+end
+
+always @ (*) begin
+	dag_1000_entry_37[7:0] = (dag_1000_entry_12 ^ dag_1000_entry_22);
+end
+
+always @ (*) begin
+	dag_1000_entry_37_reg[7:0] = bp_reg_2[79:72];
+end
+
+always @ (*) begin
+	dag_1000_entry_38[15:0] = dag_1000_entry_mul_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_38_reg[15:0] = bp_reg_0[79:64];
+end
+
+always @ (*) begin
+	dag_1000_entry_39[31:0] = (dag_1000_entry_26_reg ^ dag_1000_entry_27);
+end
+
+always @ (*) begin
+	dag_1000_entry_39_reg[31:0] = bp_reg_0[63:32];
+end
+
+always @ (*) begin
+	dag_1000_entry_40[63:0] = dag_1000_entry_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_40_reg[7:0] = bp_reg_0[71:64];
+end
+
+always @ (*) begin
+	dag_1000_entry_41[63:0] = (dag_1000_entry_36 ^ dag_1000_entry_31);
+end
+
+always @ (*) begin
+	dag_1000_entry_41_reg[63:0] = bp_reg_2[143:80];
+end
+
+always @ (*) begin
+	dag_1000_entry_42[7:0] = dag_1000_entry_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_42_reg[7:0] = bp_reg_0[87:80];
+end
+
+always @ (*) begin
+	dag_1000_entry_43[31:0] = (dag_1000_entry_39 - dag_1000_entry_13_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_43_reg[31:0] = bp_reg_0[95:64];
+end
+
+always @ (*) begin
+	dag_1000_entry_44[7:0] = dag_1000_entry_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_44_reg[7:0] = bp_reg_0[79:72];
+end
+
+always @ (*) begin
+	dag_1000_entry_45[63:0] = (dag_1000_entry_41_reg * dag_1000_entry_21_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_45_reg = bp_reg_0[88:88];
+end
+
+always @ (*) begin
+	dag_1000_entry_46[7:0] = dag_1000_entry_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_46_reg[7:0] = bp_reg_0[96:89];
+end
+
+always @ (*) begin
+	dag_1000_entry_47[63:0] = dag_1000_entry_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_47_reg[7:0] = bp_reg_0[15:8];
+end
+
+always @ (*) begin
+	dag_1000_entry_48[15:0] = dag_1000_entry_and_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_48_reg[15:0] = bp_reg_0[112:97];
+end
+
+always @ (*) begin
+	dag_1000_entry_49[7:0] = dag_1000_entry_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_49_reg[7:0] = bp_reg_1[23:16];
+end
+
+always @ (*) begin
+	dag_1000_entry_50[31:0] = (dag_1000_entry_26 - dag_1000_entry_31_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_4)) begin
+		dag_1000_entry_50_reg[31:0] <= dag_1000_entry_50[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_51[63:0] = (dag_1000_entry_45_reg ^ dag_1000_entry_41_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_2)) begin
+		dag_1000_entry_51_reg[63:0] <= dag_1000_entry_51[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_53[63:0] = dag_1000_entry_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_53_reg[23:0] = bp_reg_1[72:49];
+end
+
+always @ (*) begin
+	dag_1000_entry_54[31:0] = dag_1000_entry_or_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_54_reg[31:0] = bp_reg_11[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_55[15:0] = (dag_1000_entry_14_reg ^ dag_1000_entry_29);
+end
+
+always @ (*) begin
+	dag_1000_entry_55_reg[15:0] = bp_reg_2[39:24];
+end
+
+always @ (*) begin
+	dag_1000_entry_56[7:0] = dag_1000_entry_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_56_reg[7:0] = bp_reg_1[80:73];
+end
+
+always @ (*) begin
+	dag_1000_entry_58[15:0] = dag_1000_entry_add_16_16_1[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_58_reg[15:0] = bp_reg_0[112:97];
+end
+
+always @ (*) begin
+	dag_1000_entry_59[7:0] = dag_1000_entry_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_59_reg[7:0] = bp_reg_1[88:81];
+end
+
+always @ (*) begin
+	dag_1000_entry_60[63:0] = (dag_1000_entry_45_reg + dag_1000_entry_51);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_2)) begin
+		dag_1000_entry_60_reg[63:0] <= dag_1000_entry_60[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_61[31:0] = (dag_1000_entry_34_reg ^ dag_1000_entry_27);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_5)) begin
+		dag_1000_entry_61_reg[31:0] <= dag_1000_entry_61[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_62[7:0] = dag_1000_entry_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_62_reg[7:0] = bp_reg_0[71:64];
+end
+
+always @ (*) begin
+	dag_1000_entry_63[31:0] = dag_1000_entry_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_63_reg[31:0] = bp_reg_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_64[31:0] = dag_1000_entry_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_64_reg[31:0] = bp_reg_0[63:32];
+end
+
+always @ (*) begin
+	dag_1000_entry_65[31:0] = dag_1000_entry_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_65_reg[31:0] = bp_reg_0[63:32];
+end
+
+always @ (*) begin
+	dag_1000_entry_67[7:0] = dag_1000_entry_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_67_reg[7:0] = bp_reg_2[39:32];
+end
+
+always @ (*) begin
+	dag_1000_entry_68[31:0] = (dag_1000_entry_65 ^ dag_1000_entry_64_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_68_reg[31:0] = bp_reg_0[95:64];
+end
+
+always @ (*) begin
+	dag_1000_entry_69[31:0] = dag_1000_entry_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_69_reg[31:0] = bp_reg_0[127:96];
+end
+
+always @ (*) begin
+	dag_1000_entry_70[63:0] = (dag_1000_entry_40 - dag_1000_entry_45_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_70_reg[7:0] = bp_reg_2[47:40];
+end
+
+always @ (*) begin
+	dag_1000_entry_72[15:0] = dag_1000_entry_add_16_16_1[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_72_reg[15:0] = bp_reg_2[63:48];
+end
+
+always @ (*) begin
+	dag_1000_entry_73[15:0] = (dag_1000_entry_58_reg ^ dag_1000_entry_55);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_4)) begin
+		dag_1000_entry_73_reg[15:0] <= dag_1000_entry_73[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_74[15:0] = dag_1000_entry_add_16_16_1[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_74_reg[15:0] = bp_reg_12[23:8];
+end
+
+always @ (*) begin
+	dag_1000_entry_75[7:0] = dag_1000_entry_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_75_reg[7:0] = bp_reg_2[80:73];
+end
+
+always @ (*) begin
+	dag_1000_entry_76[31:0] = dag_1000_entry_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_76_reg[31:0] = bp_reg_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_77[31:0] = (dag_1000_entry_65_reg ^ dag_1000_entry_76);
+end
+
+always @ (*) begin
+	dag_1000_entry_77_reg[31:0] = bp_reg_0[63:32];
+end
+
+always @ (*) begin
+	dag_1000_entry_78[15:0] = dag_1000_entry_mul_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_78_reg[15:0] = bp_reg_2[96:81];
+end
+
+always @ (*) begin
+	dag_1000_entry_79[15:0] = dag_1000_entry_or_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_79_reg[15:0] = bp_reg_12[39:24];
+end
+
+always @ (*) begin
+	dag_1000_entry_81[15:0] = dag_1000_entry_or_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_81_reg[15:0] = bp_reg_0[79:64];
+end
+
+always @ (*) begin
+	dag_1000_entry_82[15:0] = dag_1000_entry_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_82_reg[15:0] = bp_reg_0[95:80];
+end
+
+always @ (*) begin
+	dag_1000_entry_83[7:0] = (dag_1000_entry_44 - dag_1000_entry_44);
+end
+
+always @ (*) begin
+	dag_1000_entry_83_reg = bp_reg_2[64:64];
+end
+
+always @ (*) begin
+	dag_1000_entry_84[63:0] = dag_1000_entry_mul_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_84_reg[15:0] = bp_reg_0[95:80];
+end
+
+always @ (*) begin
+	dag_1000_entry_85[15:0] = dag_1000_entry_mul_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_85_reg[15:0] = bp_reg_12[55:40];
+end
+
+always @ (*) begin
+	dag_1000_entry_86[63:0] = dag_1000_entry_and_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_3)) begin
+		dag_1000_entry_86_reg[31:0] <= dag_1000_entry_86[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_17)) begin
+		dag_1000_entry_86_reg[31:0] <= dag_1000_entry_209[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_87[7:0] = (dag_1000_entry_49 - dag_1000_entry_67_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_87_reg[7:0] = bp_reg_2[104:97];
+end
+
+always @ (*) begin
+	dag_1000_entry_88[15:0] = (dag_1000_entry_78_reg ^ dag_1000_entry_79);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_5)) begin
+		dag_1000_entry_88_reg[15:0] <= dag_1000_entry_88[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_90[31:0] = dag_1000_entry_or_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_7)) begin
+		dag_1000_entry_90_reg[31:0] <= dag_1000_entry_90[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_14)) begin
+		dag_1000_entry_90_reg[31:0] <= dag_1000_entry_187[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_18)) begin
+		dag_1000_entry_90_reg[31:0] <= dag_1000_entry_225[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_24)) begin
+		dag_1000_entry_90_reg[31:0] <= dag_1000_entry_281[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_31)) begin
+		dag_1000_entry_90_reg[31:0] <= dag_1000_entry_373[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_33)) begin
+		dag_1000_entry_90_reg[31:0] <= dag_1000_entry_424[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_40)) begin
+		dag_1000_entry_90_reg[31:0] <= dag_1000_entry_487[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_39)) begin
+		dag_1000_entry_90_reg[31:0] <= dag_1000_entry_494[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_42)) begin
+		dag_1000_entry_90_reg[31:0] <= dag_1000_entry_526[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_47)) begin
+		dag_1000_entry_90_reg[31:0] <= dag_1000_entry_662[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_93[15:0] = dag_1000_entry_mul_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_93_reg[15:0] = bp_reg_0[112:97];
+end
+
+always @ (*) begin
+	dag_1000_entry_94[31:0] = (dag_1000_entry_64_reg ^ dag_1000_entry_90);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_7)) begin
+		dag_1000_entry_94_reg[31:0] <= dag_1000_entry_94[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_95[63:0] = dag_1000_entry_and_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_95_reg[7:0] = bp_reg_1[23:16];
+end
+
+always @ (*) begin
+	dag_1000_entry_96[63:0] = (dag_1000_entry_95 + dag_1000_entry_60_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_3)) begin
+		dag_1000_entry_96_reg[63:0] <= dag_1000_entry_96[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_99[15:0] = dag_1000_entry_add_16_16_1[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_99_reg[15:0] = bp_reg_12[23:8];
+end
+
+always @ (*) begin
+	dag_1000_entry_100[7:0] = dag_1000_entry_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_100_reg[7:0] = bp_reg_2[112:105];
+end
+
+always @ (*) begin
+	dag_1000_entry_101[15:0] = (dag_1000_entry_88_reg - dag_1000_entry_82);
+end
+
+always @ (*) begin
+	dag_1000_entry_101_reg[15:0] = bp_reg_12[39:24];
+end
+
+always @ (*) begin
+	dag_1000_entry_102[63:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_102_reg[16:0] = bp_reg_12[32:16];
+end
+
+always @ (*) begin
+	dag_1000_entry_103[7:0] = (dag_1000_entry_83_reg ^ dag_1000_entry_87);
+end
+
+always @ (*) begin
+	dag_1000_entry_103_reg[7:0] = bp_reg_2[120:113];
+end
+
+always @ (*) begin
+	dag_1000_entry_104[7:0] = dag_1000_entry_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_104_reg[7:0] = bp_reg_2[62:55];
+end
+
+always @ (*) begin
+	dag_1000_entry_105[31:0] = (dag_1000_entry_77 - dag_1000_entry_94_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_105_reg[31:0] = bp_reg_0[95:64];
+end
+
+always @ (*) begin
+	dag_1000_entry_106[15:0] = dag_1000_entry_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_106_reg[15:0] = bp_reg_2[22:7];
+end
+
+always @ (*) begin
+	dag_1000_entry_107[7:0] = (dag_1000_entry_75_reg ^ dag_1000_entry_104);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_5)) begin
+		dag_1000_entry_107_reg[7:0] <= dag_1000_entry_107[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_108[31:0] = (dag_1000_entry_77 - dag_1000_entry_105);
+end
+
+always @ (*) begin
+	dag_1000_entry_108_reg[31:0] = bp_reg_0[127:96];
+end
+
+always @ (*) begin
+	dag_1000_entry_109[15:0] = (dag_1000_entry_99 - dag_1000_entry_101);
+end
+
+always @ (*) begin
+	dag_1000_entry_109_reg[15:0] = bp_reg_12[55:40];
+end
+
+always @ (*) begin
+	dag_1000_entry_110[31:0] = dag_1000_entry_or_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_8)) begin
+		dag_1000_entry_110_reg[31:0] <= dag_1000_entry_110[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_16)) begin
+		dag_1000_entry_110_reg[31:0] <= dag_1000_entry_214[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_111[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_111_reg[31:0] = bp_reg_12[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_112[15:0] = (dag_1000_entry_109_reg - dag_1000_entry_106);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_7)) begin
+		dag_1000_entry_112_reg[15:0] <= dag_1000_entry_112[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_113[63:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_5)) begin
+		dag_1000_entry_113_reg[31:0] <= dag_1000_entry_113[16:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_16)) begin
+		dag_1000_entry_113_reg[31:0] <= dag_1000_entry_203[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_27)) begin
+		dag_1000_entry_113_reg[31:0] <= dag_1000_entry_319[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_67)) begin
+		dag_1000_entry_113_reg[31:0] <= dag_1000_entry_324[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_31)) begin
+		dag_1000_entry_113_reg[31:0] <= dag_1000_entry_382[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_34)) begin
+		dag_1000_entry_113_reg[31:0] <= dag_1000_entry_426[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_37)) begin
+		dag_1000_entry_113_reg[31:0] <= dag_1000_entry_459[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_39)) begin
+		dag_1000_entry_113_reg[31:0] <= dag_1000_entry_503[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_71)) begin
+		dag_1000_entry_113_reg[31:0] <= dag_1000_entry_533[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_42)) begin
+		dag_1000_entry_113_reg[31:0] <= dag_1000_entry_541[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_43)) begin
+		dag_1000_entry_113_reg[31:0] <= dag_1000_entry_559[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_45)) begin
+		dag_1000_entry_113_reg[31:0] <= dag_1000_entry_620[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_50)) begin
+		dag_1000_entry_113_reg[31:0] <= dag_1000_entry_732[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_54)) begin
+		dag_1000_entry_113_reg[31:0] <= dag_1000_entry_755[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_53)) begin
+		dag_1000_entry_113_reg[31:0] <= dag_1000_entry_791[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_56)) begin
+		dag_1000_entry_113_reg[31:0] <= dag_1000_entry_823[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_58)) begin
+		dag_1000_entry_113_reg[31:0] <= dag_1000_entry_824[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_61)) begin
+		dag_1000_entry_113_reg[31:0] <= dag_1000_entry_860[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_62)) begin
+		dag_1000_entry_113_reg[31:0] <= dag_1000_entry_889[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_114[7:0] = (dag_1000_entry_103 - dag_1000_entry_87);
+end
+
+always @ (*) begin
+	dag_1000_entry_114_reg[7:0] = bp_reg_2[128:121];
+end
+
+always @ (*) begin
+	dag_1000_entry_115[15:0] = dag_1000_entry_add_16_16_1[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_7)) begin
+		dag_1000_entry_115_reg[15:0] <= dag_1000_entry_115[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_11)) begin
+		dag_1000_entry_115_reg[15:0] <= dag_1000_entry_220[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_14)) begin
+		dag_1000_entry_115_reg[15:0] <= dag_1000_entry_294[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_18)) begin
+		dag_1000_entry_115_reg[15:0] <= dag_1000_entry_383[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_116[15:0] = (dag_1000_entry_109_reg ^ dag_1000_entry_112);
+end
+
+always @ (*) begin
+	dag_1000_entry_116_reg[15:0] = bp_reg_2[103:88];
+end
+
+always @ (*) begin
+	dag_1000_entry_117[15:0] = dag_1000_entry_mul_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_117_reg[15:0] = bp_reg_2[128:113];
+end
+
+always @ (*) begin
+	dag_1000_entry_118[7:0] = dag_1000_entry_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_118_reg[7:0] = bp_reg_2[144:137];
+end
+
+always @ (*) begin
+	dag_1000_entry_119[31:0] = (dag_1000_entry_94_reg ^ dag_1000_entry_77);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_8)) begin
+		dag_1000_entry_119_reg[31:0] <= dag_1000_entry_119[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_120[7:0] = dag_1000_entry_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_120_reg[7:0] = bp_reg_13[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_121[7:0] = dag_1000_entry_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_121_reg[7:0] = bp_reg_2[152:145];
+end
+
+always @ (*) begin
+	dag_1000_entry_123[15:0] = (dag_1000_entry_101 ^ dag_1000_entry_109);
+end
+
+always @ (*) begin
+	dag_1000_entry_123_reg[15:0] = bp_reg_13[23:8];
+end
+
+always @ (*) begin
+	dag_1000_entry_124[15:0] = (dag_1000_entry_106 - dag_1000_entry_101_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_7)) begin
+		dag_1000_entry_124_reg[15:0] <= dag_1000_entry_124[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_125[7:0] = dag_1000_entry_add_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_5)) begin
+		bp_reg_39[7:0] <= dag_1000_entry_125[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_125_reg[7:0] = bp_reg_39[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_126[7:0] = dag_1000_entry_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_126_reg[7:0] = bp_reg_13[31:24];
+end
+
+always @ (*) begin
+	dag_1000_entry_127[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_127_reg[31:0] = bp_reg_0[95:64];
+end
+
+always @ (*) begin
+	dag_1000_entry_128[15:0] = dag_1000_entry_add_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_8)) begin
+		dag_1000_entry_128_reg[15:0] <= dag_1000_entry_128[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_14)) begin
+		dag_1000_entry_128_reg[15:0] <= dag_1000_entry_277[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_16)) begin
+		dag_1000_entry_128_reg[15:0] <= dag_1000_entry_321[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_19)) begin
+		dag_1000_entry_128_reg[15:0] <= dag_1000_entry_369[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_21)) begin
+		dag_1000_entry_128_reg[15:0] <= dag_1000_entry_433[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_64)) begin
+		dag_1000_entry_128_reg[15:0] <= dag_1000_entry_885[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_129[31:0] = dag_1000_entry_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_129_reg[31:0] = bp_reg_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_130[7:0] = (dag_1000_entry_114_reg - dag_1000_entry_120);
+end
+
+always @ (*) begin
+	dag_1000_entry_130_reg[7:0] = bp_reg_2[31:24];
+end
+
+always @ (*) begin
+	dag_1000_entry_131[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_131_reg[31:0] = bp_reg_0[63:32];
+end
+
+always @ (*) begin
+	dag_1000_entry_132[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_132_reg[31:0] = bp_reg_1[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_133[31:0] = dag_1000_entry_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_133_reg[31:0] = bp_reg_1[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_134[7:0] = dag_1000_entry_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_134_reg[7:0] = bp_reg_2[39:32];
+end
+
+always @ (*) begin
+	dag_1000_entry_135[7:0] = dag_1000_entry_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_135_reg[7:0] = bp_reg_2[47:40];
+end
+
+always @ (*) begin
+	dag_1000_entry_136[15:0] = dag_1000_entry_mul_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_136_reg[15:0] = bp_reg_0[47:32];
+end
+
+always @ (*) begin
+	dag_1000_entry_137[7:0] = dag_1000_entry_mul_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_7)) begin
+		bp_reg_40[7:0] <= dag_1000_entry_137[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_137_reg[7:0] = bp_reg_40[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_138[63:0] = (dag_1000_entry_113_reg * dag_1000_entry_96_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_6)) begin
+		dag_1000_entry_138_reg[63:0] <= dag_1000_entry_138[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_139[31:0] = (dag_1000_entry_111_reg ^ dag_1000_entry_129);
+end
+
+always @ (*) begin
+	dag_1000_entry_139_reg[31:0] = bp_reg_0[63:32];
+end
+
+always @ (*) begin
+	dag_1000_entry_140[7:0] = dag_1000_entry_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_140_reg[7:0] = bp_reg_1[88:81];
+end
+
+always @ (*) begin
+	dag_1000_entry_141[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_141_reg[31:0] = bp_reg_0[95:64];
+end
+
+always @ (*) begin
+	dag_1000_entry_142[63:0] = (dag_1000_entry_86_reg | dag_1000_entry_138_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_7)) begin
+		bp_reg_3[63:0] <= dag_1000_entry_142[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_8)) begin
+		bp_reg_3[111:96] <= dag_1000_entry_146[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_7)) begin
+		bp_reg_3[79:64] <= dag_1000_entry_150[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_8)) begin
+		bp_reg_3[119:112] <= dag_1000_entry_155[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_8)) begin
+		bp_reg_3[135:120] <= dag_1000_entry_163[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_7)) begin
+		bp_reg_3[143:80] <= dag_1000_entry_169[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_10)) begin
+		bp_reg_3[77:14] <= dag_1000_entry_171[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_7)) begin
+		bp_reg_3[159:144] <= dag_1000_entry_172[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_8)) begin
+		bp_reg_3[143:136] <= dag_1000_entry_179[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_8)) begin
+		bp_reg_3[159:144] <= dag_1000_entry_181[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_11)) begin
+		bp_reg_3[14:7] <= dag_1000_entry_259[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_11)) begin
+		bp_reg_3[22:15] <= dag_1000_entry_267[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_14)) begin
+		bp_reg_3[15:0] <= dag_1000_entry_279[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_11)) begin
+		bp_reg_3[30:23] <= dag_1000_entry_285[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_14)) begin
+		bp_reg_3[55:40] <= dag_1000_entry_298[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_14)) begin
+		bp_reg_3[71:56] <= dag_1000_entry_299[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_14)) begin
+		bp_reg_3[87:72] <= dag_1000_entry_305[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_15)) begin
+		bp_reg_3[47:40] <= dag_1000_entry_351[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_15)) begin
+		bp_reg_3[55:48] <= dag_1000_entry_356[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_15)) begin
+		bp_reg_3[63:56] <= dag_1000_entry_357[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_15)) begin
+		bp_reg_3[71:64] <= dag_1000_entry_379[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_48)) begin
+		bp_reg_3[158:127] <= dag_1000_entry_689[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_142_reg[63:0] = bp_reg_3[63:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_143[63:0] = (dag_1000_entry_142_reg * dag_1000_entry_116_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_8)) begin
+		dag_1000_entry_143_reg[63:0] <= dag_1000_entry_143[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_145[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_145_reg[31:0] = bp_reg_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_146[15:0] = dag_1000_entry_add_16_16_1[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_146_reg[15:0] = bp_reg_3[111:96];
+end
+
+always @ (*) begin
+	dag_1000_entry_147[7:0] = dag_1000_entry_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_147_reg[7:0] = bp_reg_2[152:145];
+end
+
+always @ (*) begin
+	dag_1000_entry_148[63:0] = (dag_1000_entry_96_reg * dag_1000_entry_143_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_9)) begin
+		dag_1000_entry_148_reg[63:0] <= dag_1000_entry_148[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_149[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_149_reg[31:0] = bp_reg_0[63:32];
+end
+
+always @ (*) begin
+	dag_1000_entry_150[15:0] = dag_1000_entry_and_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_150_reg[15:0] = bp_reg_3[79:64];
+end
+
+always @ (*) begin
+	dag_1000_entry_151[15:0] = dag_1000_entry_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_151_reg[15:0] = bp_reg_2[103:88];
+end
+
+always @ (*) begin
+	dag_1000_entry_152[31:0] = (dag_1000_entry_149 ^ dag_1000_entry_132_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_152_reg[31:0] = bp_reg_0[95:64];
+end
+
+always @ (*) begin
+	dag_1000_entry_153[31:0] = dag_1000_entry_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_153_reg[31:0] = bp_reg_1[63:32];
+end
+
+always @ (*) begin
+	dag_1000_entry_155[7:0] = dag_1000_entry_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_155_reg[7:0] = bp_reg_3[119:112];
+end
+
+always @ (*) begin
+	dag_1000_entry_156[31:0] = dag_1000_entry_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_156_reg[31:0] = bp_reg_1[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_157[63:0] = (dag_1000_entry_96_reg ^ dag_1000_entry_148_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_10)) begin
+		dag_1000_entry_157_reg[63:0] <= dag_1000_entry_157[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_158[63:0] = (dag_1000_entry_157 - dag_1000_entry_142_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_10)) begin
+		dag_1000_entry_158_reg[63:0] <= dag_1000_entry_158[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_159[31:0] = (dag_1000_entry_152 ^ dag_1000_entry_149);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_14)) begin
+		dag_1000_entry_159_reg[31:0] <= dag_1000_entry_159[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_160[31:0] = (dag_1000_entry_152 - dag_1000_entry_141_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_160_reg[31:0] = bp_reg_12[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_161[63:0] = (dag_1000_entry_113_reg | dag_1000_entry_158);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_10)) begin
+		dag_1000_entry_161_reg[63:0] <= dag_1000_entry_161[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_163[15:0] = (dag_1000_entry_146 - dag_1000_entry_150_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_163_reg[15:0] = bp_reg_3[135:120];
+end
+
+always @ (*) begin
+	dag_1000_entry_164[7:0] = dag_1000_entry_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_164_reg[7:0] = bp_reg_1[88:81];
+end
+
+always @ (*) begin
+	dag_1000_entry_165[7:0] = dag_1000_entry_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_165_reg[7:0] = bp_reg_2[31:24];
+end
+
+always @ (*) begin
+	dag_1000_entry_167[63:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_9)) begin
+		dag_1000_entry_167_reg[31:0] <= dag_1000_entry_167[16:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_26)) begin
+		dag_1000_entry_167_reg[31:0] <= dag_1000_entry_328[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_32)) begin
+		dag_1000_entry_167_reg[31:0] <= dag_1000_entry_391[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_168[63:0] = (dag_1000_entry_167 + dag_1000_entry_143_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_9)) begin
+		dag_1000_entry_168_reg[63:0] <= dag_1000_entry_168[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_169[63:0] = (dag_1000_entry_142 ^ dag_1000_entry_142);
+end
+
+always @ (*) begin
+	dag_1000_entry_169_reg[63:0] = bp_reg_3[143:80];
+end
+
+always @ (*) begin
+	dag_1000_entry_171[63:0] = (dag_1000_entry_157 + dag_1000_entry_150_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_171_reg[63:0] = bp_reg_3[77:14];
+end
+
+always @ (*) begin
+	dag_1000_entry_172[15:0] = dag_1000_entry_or_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_172_reg[15:0] = bp_reg_3[159:144];
+end
+
+always @ (*) begin
+	dag_1000_entry_173[63:0] = (dag_1000_entry_146_reg + dag_1000_entry_168);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_9)) begin
+		dag_1000_entry_173_reg[63:0] <= dag_1000_entry_173[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_174[63:0] = (dag_1000_entry_173_reg + dag_1000_entry_161);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_10)) begin
+		dag_1000_entry_174_reg[63:0] <= dag_1000_entry_174[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_175[15:0] = (dag_1000_entry_172 ^ dag_1000_entry_172);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_7)) begin
+		bp_reg_19[15:0] <= dag_1000_entry_175[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_175_reg[15:0] = bp_reg_19[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_176[63:0] = (dag_1000_entry_168_reg * dag_1000_entry_157_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_11)) begin
+		dag_1000_entry_176_reg[63:0] <= dag_1000_entry_176[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_177[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_177_reg[31:0] = bp_reg_0[63:32];
+end
+
+always @ (*) begin
+	dag_1000_entry_178[63:0] = (dag_1000_entry_171 - dag_1000_entry_174);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_10)) begin
+		dag_1000_entry_178_reg[63:0] <= dag_1000_entry_178[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_179[7:0] = (dag_1000_entry_155 - dag_1000_entry_135_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_179_reg[7:0] = bp_reg_3[143:136];
+end
+
+always @ (*) begin
+	dag_1000_entry_180[7:0] = dag_1000_entry_add_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_7)) begin
+		bp_reg_41[7:0] <= dag_1000_entry_180[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_180_reg[7:0] = bp_reg_41[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_181[15:0] = dag_1000_entry_or_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_181_reg[15:0] = bp_reg_3[159:144];
+end
+
+always @ (*) begin
+	dag_1000_entry_183[63:0] = (dag_1000_entry_168_reg + dag_1000_entry_171);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_10)) begin
+		dag_1000_entry_183_reg[63:0] <= dag_1000_entry_183[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_184[63:0] = (dag_1000_entry_169_reg & dag_1000_entry_181);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_8)) begin
+		bp_reg_20[15:0] <= dag_1000_entry_184[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_14)) begin
+		bp_reg_20[7:0] <= dag_1000_entry_327[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_15)) begin
+		bp_reg_20[7:0] <= dag_1000_entry_388[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_184_reg[15:0] = bp_reg_20[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_185[63:0] = (dag_1000_entry_171 + dag_1000_entry_174);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_10)) begin
+		bp_reg_4[271:208] <= dag_1000_entry_185[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_8)) begin
+		bp_reg_4[15:0] <= dag_1000_entry_189[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_9)) begin
+		bp_reg_4[97:82] <= dag_1000_entry_191[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_8)) begin
+		bp_reg_4[31:16] <= dag_1000_entry_193[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_9)) begin
+		bp_reg_4[113:98] <= dag_1000_entry_194[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_8)) begin
+		bp_reg_4[39:32] <= dag_1000_entry_201[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_8)) begin
+		bp_reg_4[47:40] <= dag_1000_entry_202[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_9)) begin
+		bp_reg_4[121:114] <= dag_1000_entry_205[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_10)) begin
+		bp_reg_4[279:272] <= dag_1000_entry_212[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_10)) begin
+		bp_reg_4[295:280] <= dag_1000_entry_218[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_9)) begin
+		bp_reg_4[129:122] <= dag_1000_entry_222[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_8)) begin
+		bp_reg_4[55:48] <= dag_1000_entry_224[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_9)) begin
+		bp_reg_4[137:130] <= dag_1000_entry_227[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_9)) begin
+		bp_reg_4[145:138] <= dag_1000_entry_230[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_21)) begin
+		bp_reg_4[38:7] <= dag_1000_entry_234[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_8)) begin
+		bp_reg_4[56:56] <= dag_1000_entry_239;
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_21)) begin
+		bp_reg_4[86:55] <= dag_1000_entry_243[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_21)) begin
+		bp_reg_4[118:87] <= dag_1000_entry_248[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_22)) begin
+		bp_reg_4[38:7] <= dag_1000_entry_252[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_12)) begin
+		bp_reg_4[94:31] <= dag_1000_entry_258[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_12)) begin
+		bp_reg_4[158:95] <= dag_1000_entry_262[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_12)) begin
+		bp_reg_4[222:159] <= dag_1000_entry_263[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_12)) begin
+		bp_reg_4[286:223] <= dag_1000_entry_265[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_12)) begin
+		bp_reg_4[294:287] <= dag_1000_entry_269[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_22)) begin
+		bp_reg_4[150:119] <= dag_1000_entry_271[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_22)) begin
+		bp_reg_4[182:151] <= dag_1000_entry_278[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_25)) begin
+		bp_reg_4[38:7] <= dag_1000_entry_296[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_13)) begin
+		bp_reg_4[78:15] <= dag_1000_entry_302[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_26)) begin
+		bp_reg_4[166:135] <= dag_1000_entry_306[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_13)) begin
+		bp_reg_4[86:79] <= dag_1000_entry_308[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_13)) begin
+		bp_reg_4[102:87] <= dag_1000_entry_310[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_13)) begin
+		bp_reg_4[103:103] <= dag_1000_entry_314;
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_13)) begin
+		bp_reg_4[111:104] <= dag_1000_entry_318[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_16)) begin
+		bp_reg_4[22:7] <= dag_1000_entry_323[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_16)) begin
+		bp_reg_4[38:23] <= dag_1000_entry_325[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_17)) begin
+		bp_reg_4[22:7] <= dag_1000_entry_330[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_14)) begin
+		bp_reg_4[207:144] <= dag_1000_entry_333[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_17)) begin
+		bp_reg_4[38:23] <= dag_1000_entry_334[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_14)) begin
+		bp_reg_4[271:208] <= dag_1000_entry_336[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_13)) begin
+		bp_reg_4[119:112] <= dag_1000_entry_337[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_14)) begin
+		bp_reg_4[279:272] <= dag_1000_entry_338[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_16)) begin
+		bp_reg_4[54:39] <= dag_1000_entry_339[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_17)) begin
+		bp_reg_4[54:39] <= dag_1000_entry_349[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_17)) begin
+		bp_reg_4[70:55] <= dag_1000_entry_352[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_17)) begin
+		bp_reg_4[134:71] <= dag_1000_entry_354[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_16)) begin
+		bp_reg_4[198:135] <= dag_1000_entry_358[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_17)) begin
+		bp_reg_4[214:199] <= dag_1000_entry_360[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_29)) begin
+		bp_reg_4[150:119] <= dag_1000_entry_367[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_18)) begin
+		bp_reg_4[166:103] <= dag_1000_entry_374[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_29)) begin
+		bp_reg_4[182:151] <= dag_1000_entry_376[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_19)) begin
+		bp_reg_4[166:103] <= dag_1000_entry_377[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_20)) begin
+		bp_reg_4[150:87] <= dag_1000_entry_384[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_17)) begin
+		bp_reg_4[262:255] <= dag_1000_entry_387[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_19)) begin
+		bp_reg_4[182:167] <= dag_1000_entry_389[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_20)) begin
+		bp_reg_4[166:151] <= dag_1000_entry_394[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_16)) begin
+		bp_reg_4[206:199] <= dag_1000_entry_395[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_16)) begin
+		bp_reg_4[214:207] <= dag_1000_entry_396[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_16)) begin
+		bp_reg_4[222:215] <= dag_1000_entry_398[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_19)) begin
+		bp_reg_4[198:183] <= dag_1000_entry_399[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_20)) begin
+		bp_reg_4[167:167] <= dag_1000_entry_403;
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_17)) begin
+		bp_reg_4[270:263] <= dag_1000_entry_404[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_17)) begin
+		bp_reg_4[278:271] <= dag_1000_entry_408[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_16)) begin
+		bp_reg_4[230:223] <= dag_1000_entry_409[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_16)) begin
+		bp_reg_4[238:231] <= dag_1000_entry_410[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_19)) begin
+		bp_reg_4[214:199] <= dag_1000_entry_413[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_21)) begin
+		bp_reg_4[182:119] <= dag_1000_entry_415[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_16)) begin
+		bp_reg_4[246:239] <= dag_1000_entry_417[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_19)) begin
+		bp_reg_4[230:223] <= dag_1000_entry_419[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_19)) begin
+		bp_reg_4[286:279] <= dag_1000_entry_429[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_22)) begin
+		bp_reg_4[198:183] <= dag_1000_entry_446[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_22)) begin
+		bp_reg_4[214:199] <= dag_1000_entry_451[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_22)) begin
+		bp_reg_4[278:263] <= dag_1000_entry_456[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_23)) begin
+		bp_reg_4[110:95] <= dag_1000_entry_471[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_24)) begin
+		bp_reg_4[30:15] <= dag_1000_entry_479[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_24)) begin
+		bp_reg_4[118:103] <= dag_1000_entry_496[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_25)) begin
+		bp_reg_4[102:87] <= dag_1000_entry_499[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_22)) begin
+		bp_reg_4[286:279] <= dag_1000_entry_500[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_24)) begin
+		bp_reg_4[198:183] <= dag_1000_entry_509[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_24)) begin
+		bp_reg_4[214:199] <= dag_1000_entry_514[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_24)) begin
+		bp_reg_4[278:263] <= dag_1000_entry_516[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_25)) begin
+		bp_reg_4[166:151] <= dag_1000_entry_523[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_25)) begin
+		bp_reg_4[182:167] <= dag_1000_entry_537[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_25)) begin
+		bp_reg_4[214:199] <= dag_1000_entry_549[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_27)) begin
+		bp_reg_4[214:199] <= dag_1000_entry_572[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_29)) begin
+		bp_reg_4[270:263] <= dag_1000_entry_650[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_29)) begin
+		bp_reg_4[278:271] <= dag_1000_entry_668[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_68)) begin
+		bp_reg_4[215:215] <= dag_1000_entry_935;
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_67)) begin
+		bp_reg_4[22:7] <= dag_1000_entry_973[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_67)) begin
+		bp_reg_4[38:23] <= dag_1000_entry_974[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_185_reg[63:0] = bp_reg_4[271:208];
+end
+
+always @ (*) begin
+	dag_1000_entry_187[31:0] = dag_1000_entry_or_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_187_reg[31:0] = dag_1000_entry_90_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_188[7:0] = dag_1000_entry_or_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_8)) begin
+		bp_reg_42[7:0] <= dag_1000_entry_188[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_188_reg[7:0] = bp_reg_42[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_189[15:0] = (dag_1000_entry_150_reg ^ dag_1000_entry_146);
+end
+
+always @ (*) begin
+	dag_1000_entry_189_reg[15:0] = bp_reg_4[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_190[31:0] = (dag_1000_entry_159 - dag_1000_entry_160);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_14)) begin
+		dag_1000_entry_190_reg[31:0] <= dag_1000_entry_190[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_191[15:0] = (dag_1000_entry_150_reg - dag_1000_entry_151);
+end
+
+always @ (*) begin
+	dag_1000_entry_191_reg[15:0] = bp_reg_4[97:82];
+end
+
+always @ (*) begin
+	dag_1000_entry_192[7:0] = dag_1000_entry_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_192_reg[7:0] = bp_reg_1[88:81];
+end
+
+always @ (*) begin
+	dag_1000_entry_193[15:0] = (dag_1000_entry_181 - dag_1000_entry_189);
+end
+
+always @ (*) begin
+	dag_1000_entry_193_reg[15:0] = bp_reg_4[31:16];
+end
+
+always @ (*) begin
+	dag_1000_entry_194[15:0] = dag_1000_entry_add_16_16_1[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_194_reg[15:0] = bp_reg_4[113:98];
+end
+
+always @ (*) begin
+	dag_1000_entry_196[7:0] = dag_1000_entry_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_196_reg[7:0] = bp_reg_2[31:24];
+end
+
+always @ (*) begin
+	dag_1000_entry_197[63:0] = (dag_1000_entry_178_reg - dag_1000_entry_176_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_12)) begin
+		dag_1000_entry_197_reg[63:0] <= dag_1000_entry_197[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_198[31:0] = (dag_1000_entry_190 - dag_1000_entry_190);
+end
+
+always @ (*) begin
+	dag_1000_entry_198_reg = bp_reg_2[88:88];
+end
+
+always @ (*) begin
+	dag_1000_entry_199[15:0] = dag_1000_entry_add_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_10)) begin
+		bp_reg_21[15:0] <= dag_1000_entry_199[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_199_reg[15:0] = bp_reg_21[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_200[31:0] = dag_1000_entry_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_200_reg[31:0] = dag_1000_entry_26_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_201[7:0] = dag_1000_entry_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_201_reg[7:0] = bp_reg_4[39:32];
+end
+
+always @ (*) begin
+	dag_1000_entry_202[7:0] = dag_1000_entry_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_202_reg[7:0] = bp_reg_4[47:40];
+end
+
+always @ (*) begin
+	dag_1000_entry_203[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_203_reg[31:0] = dag_1000_entry_113_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_205[7:0] = dag_1000_entry_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_205_reg[7:0] = bp_reg_4[121:114];
+end
+
+always @ (*) begin
+	dag_1000_entry_206[15:0] = dag_1000_entry_or_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_9)) begin
+		bp_reg_22[15:0] <= dag_1000_entry_206[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_67)) begin
+		bp_reg_22[15:0] <= dag_1000_entry_979[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_206_reg[15:0] = bp_reg_22[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_207[15:0] = dag_1000_entry_add_16_16_1[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_10)) begin
+		bp_reg_23[15:0] <= dag_1000_entry_207[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_67)) begin
+		bp_reg_23[15:0] <= dag_1000_entry_997[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_207_reg[15:0] = bp_reg_23[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_208[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_208_reg[31:0] = bp_reg_0[63:32];
+end
+
+always @ (*) begin
+	dag_1000_entry_209[31:0] = dag_1000_entry_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_209_reg[31:0] = dag_1000_entry_86_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_210[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_210_reg[31:0] = bp_reg_0[63:32];
+end
+
+always @ (*) begin
+	dag_1000_entry_212[7:0] = dag_1000_entry_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_212_reg[7:0] = bp_reg_4[279:272];
+end
+
+always @ (*) begin
+	dag_1000_entry_213[15:0] = dag_1000_entry_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_213_reg[15:0] = bp_reg_12[55:40];
+end
+
+always @ (*) begin
+	dag_1000_entry_214[31:0] = dag_1000_entry_or_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_214_reg[31:0] = dag_1000_entry_110_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_215[31:0] = dag_1000_entry_or_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_17)) begin
+		dag_1000_entry_215_reg[31:0] <= dag_1000_entry_215[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_20)) begin
+		dag_1000_entry_215_reg[31:0] <= dag_1000_entry_242[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_218[15:0] = (dag_1000_entry_191_reg - dag_1000_entry_207);
+end
+
+always @ (*) begin
+	dag_1000_entry_218_reg[15:0] = bp_reg_4[295:280];
+end
+
+always @ (*) begin
+	dag_1000_entry_219[7:0] = (dag_1000_entry_212 - dag_1000_entry_205_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_10)) begin
+		bp_reg_43[7:0] <= dag_1000_entry_219[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_219_reg[7:0] = bp_reg_43[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_220[15:0] = dag_1000_entry_add_16_16_1[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_220_reg[15:0] = dag_1000_entry_115_reg[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_221[7:0] = dag_1000_entry_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_221_reg[7:0] = bp_reg_1[88:81];
+end
+
+always @ (*) begin
+	dag_1000_entry_222[7:0] = dag_1000_entry_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_222_reg[7:0] = bp_reg_4[129:122];
+end
+
+always @ (*) begin
+	dag_1000_entry_223[63:0] = (dag_1000_entry_184_reg * dag_1000_entry_183_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_11)) begin
+		dag_1000_entry_223_reg[63:0] <= dag_1000_entry_223[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_224[7:0] = (dag_1000_entry_202 - dag_1000_entry_201);
+end
+
+always @ (*) begin
+	dag_1000_entry_224_reg[7:0] = bp_reg_4[55:48];
+end
+
+always @ (*) begin
+	dag_1000_entry_225[31:0] = dag_1000_entry_or_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_225_reg[31:0] = dag_1000_entry_90_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_226[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_226_reg[31:0] = bp_reg_0[63:32];
+end
+
+always @ (*) begin
+	dag_1000_entry_227[7:0] = dag_1000_entry_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_227_reg[7:0] = bp_reg_4[137:130];
+end
+
+always @ (*) begin
+	dag_1000_entry_228[7:0] = dag_1000_entry_add_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_10)) begin
+		bp_reg_44[7:0] <= dag_1000_entry_228[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_10)) begin
+		bp_reg_44[15:8] <= dag_1000_entry_253[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_22)) begin
+		bp_reg_44[14:7] <= dag_1000_entry_501[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_228_reg[7:0] = bp_reg_44[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_230[7:0] = (dag_1000_entry_205 ^ dag_1000_entry_222);
+end
+
+always @ (*) begin
+	dag_1000_entry_230_reg[7:0] = bp_reg_4[145:138];
+end
+
+always @ (*) begin
+	dag_1000_entry_231[7:0] = dag_1000_entry_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_231_reg[7:0] = bp_reg_2[143:136];
+end
+
+always @ (*) begin
+	dag_1000_entry_232[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_232_reg[31:0] = bp_reg_0[63:32];
+end
+
+always @ (*) begin
+	dag_1000_entry_233[7:0] = dag_1000_entry_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_233_reg[7:0] = bp_reg_2[151:144];
+end
+
+always @ (*) begin
+	dag_1000_entry_234[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_234_reg[31:0] = bp_reg_4[38:7];
+end
+
+always @ (*) begin
+	dag_1000_entry_235[15:0] = dag_1000_entry_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_235_reg[15:0] = bp_reg_12[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_236[63:0] = (dag_1000_entry_185_reg * dag_1000_entry_223_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_12)) begin
+		dag_1000_entry_236_reg[63:0] <= dag_1000_entry_236[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_237[63:0] = (dag_1000_entry_223_reg + dag_1000_entry_223_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_12)) begin
+		dag_1000_entry_237_reg[63:0] <= dag_1000_entry_237[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_238[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_238_reg[31:0] = bp_reg_0[63:32];
+end
+
+always @ (*) begin
+	dag_1000_entry_239[63:0] = (dag_1000_entry_184 - dag_1000_entry_184);
+end
+
+always @ (*) begin
+	dag_1000_entry_239_reg = bp_reg_4[56:56];
+end
+
+always @ (*) begin
+	dag_1000_entry_240[63:0] = (dag_1000_entry_237 ^ dag_1000_entry_237);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_12)) begin
+		dag_1000_entry_240_reg[63:0] <= dag_1000_entry_240[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_241[31:0] = dag_1000_entry_mul_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_19)) begin
+		dag_1000_entry_241_reg[31:0] <= dag_1000_entry_241[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_28)) begin
+		dag_1000_entry_241_reg[31:0] <= dag_1000_entry_311[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_29)) begin
+		dag_1000_entry_241_reg[31:0] <= dag_1000_entry_329[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_32)) begin
+		dag_1000_entry_241_reg[31:0] <= dag_1000_entry_386[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_242[31:0] = dag_1000_entry_or_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_242_reg[31:0] = dag_1000_entry_215_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_243[31:0] = dag_1000_entry_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_243_reg[31:0] = bp_reg_4[86:55];
+end
+
+always @ (*) begin
+	dag_1000_entry_244[31:0] = (dag_1000_entry_232_reg - dag_1000_entry_238);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_22)) begin
+		dag_1000_entry_244_reg[31:0] <= dag_1000_entry_244[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_247[15:0] = dag_1000_entry_and_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_11)) begin
+		dag_1000_entry_247_reg[15:0] <= dag_1000_entry_247[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_21)) begin
+		dag_1000_entry_247_reg[15:0] <= dag_1000_entry_437[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_23)) begin
+		dag_1000_entry_247_reg[15:0] <= dag_1000_entry_466[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_26)) begin
+		dag_1000_entry_247_reg[15:0] <= dag_1000_entry_562[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_45)) begin
+		dag_1000_entry_247_reg[15:0] <= dag_1000_entry_770[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_47)) begin
+		dag_1000_entry_247_reg[15:0] <= dag_1000_entry_781[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_248[31:0] = (dag_1000_entry_243 ^ dag_1000_entry_243);
+end
+
+always @ (*) begin
+	dag_1000_entry_248_reg[31:0] = bp_reg_4[118:87];
+end
+
+always @ (*) begin
+	dag_1000_entry_249[15:0] = dag_1000_entry_add_16_16_1[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_12)) begin
+		dag_1000_entry_249_reg[15:0] <= dag_1000_entry_249[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_15)) begin
+		dag_1000_entry_249_reg[15:0] <= dag_1000_entry_313[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_21)) begin
+		dag_1000_entry_249_reg[15:0] <= dag_1000_entry_441[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_45)) begin
+		dag_1000_entry_249_reg[15:0] <= dag_1000_entry_744[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_65)) begin
+		dag_1000_entry_249_reg[15:0] <= dag_1000_entry_928[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_251[63:0] = (dag_1000_entry_223_reg | dag_1000_entry_240);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_12)) begin
+		dag_1000_entry_251_reg[63:0] <= dag_1000_entry_251[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_252[31:0] = dag_1000_entry_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_252_reg[31:0] = bp_reg_4[38:7];
+end
+
+always @ (*) begin
+	dag_1000_entry_253[7:0] = dag_1000_entry_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_253_reg[7:0] = bp_reg_44[15:8];
+end
+
+always @ (*) begin
+	dag_1000_entry_254[15:0] = dag_1000_entry_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_254_reg[15:0] = bp_reg_1[79:64];
+end
+
+always @ (*) begin
+	dag_1000_entry_255[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_255_reg[31:0] = bp_reg_0[63:32];
+end
+
+always @ (*) begin
+	dag_1000_entry_256[63:0] = (dag_1000_entry_236_reg ^ dag_1000_entry_251_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_13)) begin
+		dag_1000_entry_256_reg[63:0] <= dag_1000_entry_256[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_258[63:0] = (dag_1000_entry_251 ^ dag_1000_entry_223_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_258_reg[63:0] = bp_reg_4[94:31];
+end
+
+always @ (*) begin
+	dag_1000_entry_259[7:0] = dag_1000_entry_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_259_reg[7:0] = bp_reg_3[14:7];
+end
+
+always @ (*) begin
+	dag_1000_entry_260[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_260_reg[31:0] = bp_reg_0[63:32];
+end
+
+always @ (*) begin
+	dag_1000_entry_262[63:0] = (dag_1000_entry_258 + dag_1000_entry_240);
+end
+
+always @ (*) begin
+	dag_1000_entry_262_reg[63:0] = bp_reg_4[158:95];
+end
+
+always @ (*) begin
+	dag_1000_entry_263[63:0] = (dag_1000_entry_262 ^ dag_1000_entry_240);
+end
+
+always @ (*) begin
+	dag_1000_entry_263_reg[63:0] = bp_reg_4[222:159];
+end
+
+always @ (*) begin
+	dag_1000_entry_264[15:0] = dag_1000_entry_add_16_16_1[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_13)) begin
+		dag_1000_entry_264_reg[15:0] <= dag_1000_entry_264[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_265[63:0] = (dag_1000_entry_240 + dag_1000_entry_239_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_265_reg[63:0] = bp_reg_4[286:223];
+end
+
+always @ (*) begin
+	dag_1000_entry_266[7:0] = (dag_1000_entry_253 - dag_1000_entry_227_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_10)) begin
+		bp_reg_45[7:0] <= dag_1000_entry_266[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_266_reg[7:0] = bp_reg_45[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_267[7:0] = dag_1000_entry_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_267_reg[7:0] = bp_reg_3[22:15];
+end
+
+always @ (*) begin
+	dag_1000_entry_268[31:0] = dag_1000_entry_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_268_reg[31:0] = dag_1000_entry_26_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_269[7:0] = dag_1000_entry_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_269_reg[7:0] = bp_reg_4[294:287];
+end
+
+always @ (*) begin
+	dag_1000_entry_270[7:0] = dag_1000_entry_and_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_10)) begin
+		bp_reg_46[7:0] <= dag_1000_entry_270[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_270_reg[7:0] = bp_reg_46[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_271[31:0] = dag_1000_entry_or_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_271_reg[31:0] = bp_reg_4[150:119];
+end
+
+always @ (*) begin
+	dag_1000_entry_272[15:0] = (dag_1000_entry_247_reg ^ dag_1000_entry_235);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_12)) begin
+		dag_1000_entry_272_reg[15:0] <= dag_1000_entry_272[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_273[7:0] = (dag_1000_entry_270 - dag_1000_entry_266);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_10)) begin
+		bp_reg_47[7:0] <= dag_1000_entry_273[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_273_reg[7:0] = bp_reg_47[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_274[31:0] = dag_1000_entry_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_274_reg[31:0] = bp_reg_0[63:32];
+end
+
+always @ (*) begin
+	dag_1000_entry_275[15:0] = (dag_1000_entry_235 - dag_1000_entry_247_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_12)) begin
+		dag_1000_entry_275_reg[15:0] <= dag_1000_entry_275[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_276[7:0] = dag_1000_entry_mul_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_12)) begin
+		bp_reg_25[15:8] <= dag_1000_entry_276[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_21)) begin
+		bp_reg_25[15:0] <= dag_1000_entry_439[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_276_reg[7:0] = bp_reg_25[15:8];
+end
+
+always @ (*) begin
+	dag_1000_entry_277[15:0] = dag_1000_entry_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_277_reg[15:0] = dag_1000_entry_128_reg[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_278[31:0] = (dag_1000_entry_252 ^ dag_1000_entry_271);
+end
+
+always @ (*) begin
+	dag_1000_entry_278_reg[31:0] = bp_reg_4[182:151];
+end
+
+always @ (*) begin
+	dag_1000_entry_279[15:0] = (dag_1000_entry_277 - dag_1000_entry_264_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_279_reg[15:0] = bp_reg_3[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_280[63:0] = (dag_1000_entry_240 - dag_1000_entry_262);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_12)) begin
+		bp_reg_5[63:0] <= dag_1000_entry_280[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_12)) begin
+		bp_reg_5[71:64] <= dag_1000_entry_289[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_12)) begin
+		bp_reg_5[135:72] <= dag_1000_entry_292[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_14)) begin
+		bp_reg_5[8:1] <= dag_1000_entry_345[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_14)) begin
+		bp_reg_5[16:9] <= dag_1000_entry_347[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_14)) begin
+		bp_reg_5[24:17] <= dag_1000_entry_350[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_14)) begin
+		bp_reg_5[88:25] <= dag_1000_entry_353[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_18)) begin
+		bp_reg_5[95:32] <= dag_1000_entry_393[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_18)) begin
+		bp_reg_5[103:96] <= dag_1000_entry_412[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_19)) begin
+		bp_reg_5[111:104] <= dag_1000_entry_436[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_21)) begin
+		bp_reg_5[39:24] <= dag_1000_entry_442[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_21)) begin
+		bp_reg_5[127:112] <= dag_1000_entry_445[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_21)) begin
+		bp_reg_5[135:128] <= dag_1000_entry_447[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_22)) begin
+		bp_reg_5[71:64] <= dag_1000_entry_524[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_25)) begin
+		bp_reg_5[87:72] <= dag_1000_entry_558[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_26)) begin
+		bp_reg_5[63:48] <= dag_1000_entry_565[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_29)) begin
+		bp_reg_5[111:104] <= dag_1000_entry_679[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_29)) begin
+		bp_reg_5[135:128] <= dag_1000_entry_682[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_280_reg[63:0] = bp_reg_5[63:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_281[31:0] = dag_1000_entry_or_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_281_reg[31:0] = dag_1000_entry_90_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_282[31:0] = dag_1000_entry_or_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_25)) begin
+		dag_1000_entry_282_reg[31:0] <= dag_1000_entry_282[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_36)) begin
+		dag_1000_entry_282_reg[31:0] <= dag_1000_entry_465[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_283[31:0] = dag_1000_entry_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_283_reg[31:0] = bp_reg_0[63:32];
+end
+
+always @ (*) begin
+	dag_1000_entry_284[15:0] = dag_1000_entry_mul_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_13)) begin
+		dag_1000_entry_284_reg[15:0] <= dag_1000_entry_284[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_18)) begin
+		dag_1000_entry_284_reg[15:0] <= dag_1000_entry_371[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_23)) begin
+		dag_1000_entry_284_reg[15:0] <= dag_1000_entry_470[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_26)) begin
+		dag_1000_entry_284_reg[15:0] <= dag_1000_entry_547[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_45)) begin
+		dag_1000_entry_284_reg[15:0] <= dag_1000_entry_748[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_47)) begin
+		dag_1000_entry_284_reg[15:0] <= dag_1000_entry_809[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_66)) begin
+		dag_1000_entry_284_reg[15:0] <= dag_1000_entry_918[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_285[7:0] = (dag_1000_entry_253_reg - dag_1000_entry_259);
+end
+
+always @ (*) begin
+	dag_1000_entry_285_reg[7:0] = bp_reg_3[30:23];
+end
+
+always @ (*) begin
+	dag_1000_entry_287[63:0] = (dag_1000_entry_280_reg ^ dag_1000_entry_256);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_13)) begin
+		dag_1000_entry_287_reg[63:0] <= dag_1000_entry_287[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_288[15:0] = (dag_1000_entry_284 - dag_1000_entry_272_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_13)) begin
+		dag_1000_entry_288_reg[15:0] <= dag_1000_entry_288[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_289[7:0] = dag_1000_entry_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_289_reg[7:0] = bp_reg_5[71:64];
+end
+
+always @ (*) begin
+	dag_1000_entry_290[15:0] = (dag_1000_entry_264 ^ dag_1000_entry_275_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_13)) begin
+		dag_1000_entry_290_reg[15:0] <= dag_1000_entry_290[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_291[31:0] = (dag_1000_entry_282 - dag_1000_entry_271_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_25)) begin
+		dag_1000_entry_291_reg[31:0] <= dag_1000_entry_291[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_292[63:0] = (dag_1000_entry_262 + dag_1000_entry_263);
+end
+
+always @ (*) begin
+	dag_1000_entry_292_reg[63:0] = bp_reg_5[135:72];
+end
+
+always @ (*) begin
+	dag_1000_entry_293[63:0] = (dag_1000_entry_280 & dag_1000_entry_273_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_12)) begin
+		bp_reg_48[7:0] <= dag_1000_entry_293[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_293_reg[7:0] = bp_reg_48[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_294[15:0] = dag_1000_entry_add_16_16_1[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_294_reg[15:0] = dag_1000_entry_115_reg[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_295[31:0] = (dag_1000_entry_283 ^ dag_1000_entry_266_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_26)) begin
+		dag_1000_entry_295_reg[31:0] <= dag_1000_entry_295[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_296[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_296_reg[31:0] = bp_reg_4[38:7];
+end
+
+always @ (*) begin
+	dag_1000_entry_298[15:0] = (dag_1000_entry_279 ^ dag_1000_entry_294);
+end
+
+always @ (*) begin
+	dag_1000_entry_298_reg[15:0] = bp_reg_3[55:40];
+end
+
+always @ (*) begin
+	dag_1000_entry_299[15:0] = dag_1000_entry_or_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_299_reg[15:0] = bp_reg_3[71:56];
+end
+
+always @ (*) begin
+	dag_1000_entry_300[63:0] = (dag_1000_entry_287 + dag_1000_entry_292_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_13)) begin
+		dag_1000_entry_300_reg[63:0] <= dag_1000_entry_300[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_301[63:0] = (dag_1000_entry_293_reg | dag_1000_entry_300);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_13)) begin
+		dag_1000_entry_301_reg[63:0] <= dag_1000_entry_301[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_302[63:0] = (dag_1000_entry_265_reg + dag_1000_entry_290);
+end
+
+always @ (*) begin
+	dag_1000_entry_302_reg[63:0] = bp_reg_4[78:15];
+end
+
+always @ (*) begin
+	dag_1000_entry_303[31:0] = (dag_1000_entry_295 ^ dag_1000_entry_282_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_26)) begin
+		dag_1000_entry_303_reg[31:0] <= dag_1000_entry_303[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_304[15:0] = dag_1000_entry_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_304_reg[15:0] = bp_reg_1[79:64];
+end
+
+always @ (*) begin
+	dag_1000_entry_305[15:0] = (dag_1000_entry_279 - dag_1000_entry_299);
+end
+
+always @ (*) begin
+	dag_1000_entry_305_reg[15:0] = bp_reg_3[87:72];
+end
+
+always @ (*) begin
+	dag_1000_entry_306[31:0] = dag_1000_entry_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_306_reg[31:0] = bp_reg_4[166:135];
+end
+
+always @ (*) begin
+	dag_1000_entry_307[31:0] = (dag_1000_entry_306 - dag_1000_entry_283);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_26)) begin
+		dag_1000_entry_307_reg[31:0] <= dag_1000_entry_307[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_308[7:0] = dag_1000_entry_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_308_reg[7:0] = bp_reg_4[86:79];
+end
+
+always @ (*) begin
+	dag_1000_entry_309[31:0] = dag_1000_entry_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_309_reg[31:0] = bp_reg_0[63:32];
+end
+
+always @ (*) begin
+	dag_1000_entry_310[15:0] = (dag_1000_entry_288 ^ dag_1000_entry_290);
+end
+
+always @ (*) begin
+	dag_1000_entry_310_reg[15:0] = bp_reg_4[102:87];
+end
+
+always @ (*) begin
+	dag_1000_entry_311[31:0] = dag_1000_entry_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_311_reg[31:0] = dag_1000_entry_241_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_312[63:0] = dag_1000_entry_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_312_reg[7:0] = bp_reg_1[88:81];
+end
+
+always @ (*) begin
+	dag_1000_entry_313[15:0] = dag_1000_entry_add_16_16_1[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_313_reg[15:0] = dag_1000_entry_249_reg[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_314[7:0] = (dag_1000_entry_308 - dag_1000_entry_308);
+end
+
+always @ (*) begin
+	dag_1000_entry_314_reg = bp_reg_4[103:103];
+end
+
+always @ (*) begin
+	dag_1000_entry_318[7:0] = dag_1000_entry_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_318_reg[7:0] = bp_reg_4[111:104];
+end
+
+always @ (*) begin
+	dag_1000_entry_319[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_319_reg[31:0] = dag_1000_entry_113_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_320[63:0] = (dag_1000_entry_302_reg + dag_1000_entry_299);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_14)) begin
+		dag_1000_entry_320_reg[63:0] <= dag_1000_entry_320[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_321[15:0] = dag_1000_entry_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_321_reg[15:0] = dag_1000_entry_128_reg[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_322[15:0] = dag_1000_entry_or_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_15)) begin
+		dag_1000_entry_322_reg[15:0] <= dag_1000_entry_322[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_23)) begin
+		dag_1000_entry_322_reg[15:0] <= dag_1000_entry_481[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_44)) begin
+		dag_1000_entry_322_reg[15:0] <= dag_1000_entry_678[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_45)) begin
+		dag_1000_entry_322_reg[15:0] <= dag_1000_entry_737[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_47)) begin
+		dag_1000_entry_322_reg[15:0] <= dag_1000_entry_853[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_65)) begin
+		dag_1000_entry_322_reg[15:0] <= dag_1000_entry_911[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_66)) begin
+		dag_1000_entry_322_reg[15:0] <= dag_1000_entry_929[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_323[15:0] = dag_1000_entry_add_16_16_1[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_323_reg[15:0] = bp_reg_4[22:7];
+end
+
+always @ (*) begin
+	dag_1000_entry_324[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_324_reg[31:0] = dag_1000_entry_113_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_325[15:0] = dag_1000_entry_mul_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_325_reg[15:0] = bp_reg_4[38:23];
+end
+
+always @ (*) begin
+	dag_1000_entry_326[7:0] = dag_1000_entry_or_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_12)) begin
+		bp_reg_6[7:0] <= dag_1000_entry_326[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_14)) begin
+		bp_reg_6[80:17] <= dag_1000_entry_361[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_20)) begin
+		bp_reg_6[48:33] <= dag_1000_entry_418[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_20)) begin
+		bp_reg_6[56:49] <= dag_1000_entry_420[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_20)) begin
+		bp_reg_6[72:57] <= dag_1000_entry_425[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_20)) begin
+		bp_reg_6[88:73] <= dag_1000_entry_427[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_21)) begin
+		bp_reg_6[15:0] <= dag_1000_entry_448[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_21)) begin
+		bp_reg_6[79:16] <= dag_1000_entry_450[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_21)) begin
+		bp_reg_6[87:80] <= dag_1000_entry_473[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_23)) begin
+		bp_reg_6[8:8] <= dag_1000_entry_531;
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_24)) begin
+		bp_reg_6[23:16] <= dag_1000_entry_550[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_24)) begin
+		bp_reg_6[31:24] <= dag_1000_entry_560[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_24)) begin
+		bp_reg_6[39:32] <= dag_1000_entry_567[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_29)) begin
+		bp_reg_6[7:0] <= dag_1000_entry_687[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_31)) begin
+		bp_reg_6[48:41] <= dag_1000_entry_688[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_29)) begin
+		bp_reg_6[16:9] <= dag_1000_entry_690[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_31)) begin
+		bp_reg_6[56:49] <= dag_1000_entry_714[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_32)) begin
+		bp_reg_6[48:41] <= dag_1000_entry_726[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_32)) begin
+		bp_reg_6[56:49] <= dag_1000_entry_739[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_326_reg[7:0] = bp_reg_6[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_327[7:0] = dag_1000_entry_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_327_reg[7:0] = bp_reg_20[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_328[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_328_reg[31:0] = dag_1000_entry_167_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_329[31:0] = dag_1000_entry_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_329_reg[31:0] = dag_1000_entry_241_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_330[15:0] = dag_1000_entry_add_16_16_1[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_330_reg[15:0] = bp_reg_4[22:7];
+end
+
+always @ (*) begin
+	dag_1000_entry_331[63:0] = (dag_1000_entry_301_reg ^ dag_1000_entry_320);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_14)) begin
+		dag_1000_entry_331_reg[63:0] <= dag_1000_entry_331[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_332[63:0] = (dag_1000_entry_300_reg | dag_1000_entry_320);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_14)) begin
+		dag_1000_entry_332_reg[63:0] <= dag_1000_entry_332[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_333[63:0] = (dag_1000_entry_320 + dag_1000_entry_332);
+end
+
+always @ (*) begin
+	dag_1000_entry_333_reg[63:0] = bp_reg_4[207:144];
+end
+
+always @ (*) begin
+	dag_1000_entry_334[15:0] = dag_1000_entry_and_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_334_reg[15:0] = bp_reg_4[38:23];
+end
+
+always @ (*) begin
+	dag_1000_entry_336[63:0] = (dag_1000_entry_331 ^ dag_1000_entry_332);
+end
+
+always @ (*) begin
+	dag_1000_entry_336_reg[63:0] = bp_reg_4[271:208];
+end
+
+always @ (*) begin
+	dag_1000_entry_337[7:0] = dag_1000_entry_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_337_reg[7:0] = bp_reg_4[119:112];
+end
+
+always @ (*) begin
+	dag_1000_entry_338[7:0] = dag_1000_entry_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_338_reg[7:0] = bp_reg_4[279:272];
+end
+
+always @ (*) begin
+	dag_1000_entry_339[15:0] = dag_1000_entry_and_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_339_reg[15:0] = bp_reg_4[54:39];
+end
+
+always @ (*) begin
+	dag_1000_entry_340[63:0] = (dag_1000_entry_331 & dag_1000_entry_331);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_14)) begin
+		dag_1000_entry_340_reg[63:0] <= dag_1000_entry_340[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_341[31:0] = (dag_1000_entry_309_reg ^ dag_1000_entry_311);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_28)) begin
+		dag_1000_entry_341_reg[31:0] <= dag_1000_entry_341[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_342[63:0] = (dag_1000_entry_336_reg * dag_1000_entry_333_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_15)) begin
+		dag_1000_entry_342_reg[63:0] <= dag_1000_entry_342[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_343[63:0] = (dag_1000_entry_342_reg * dag_1000_entry_324_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_68)) begin
+		dag_1000_entry_343_reg[63:0] <= dag_1000_entry_343[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_344[63:0] = (dag_1000_entry_332_reg + dag_1000_entry_339);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_16)) begin
+		dag_1000_entry_344_reg[63:0] <= dag_1000_entry_344[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_345[7:0] = (dag_1000_entry_326_reg ^ dag_1000_entry_338);
+end
+
+always @ (*) begin
+	dag_1000_entry_345_reg[7:0] = bp_reg_5[8:1];
+end
+
+always @ (*) begin
+	dag_1000_entry_346[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_28)) begin
+		dag_1000_entry_346_reg[31:0] <= dag_1000_entry_346[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_33)) begin
+		dag_1000_entry_346_reg[31:0] <= dag_1000_entry_414[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_347[7:0] = dag_1000_entry_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_347_reg[7:0] = bp_reg_5[16:9];
+end
+
+always @ (*) begin
+	dag_1000_entry_348[31:0] = dag_1000_entry_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_348_reg[31:0] = dag_1000_entry_26_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_349[15:0] = (dag_1000_entry_330 - dag_1000_entry_321_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_349_reg[15:0] = bp_reg_4[54:39];
+end
+
+always @ (*) begin
+	dag_1000_entry_350[7:0] = (dag_1000_entry_337_reg ^ dag_1000_entry_347);
+end
+
+always @ (*) begin
+	dag_1000_entry_350_reg[7:0] = bp_reg_5[24:17];
+end
+
+always @ (*) begin
+	dag_1000_entry_351[7:0] = dag_1000_entry_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_351_reg[7:0] = bp_reg_3[47:40];
+end
+
+always @ (*) begin
+	dag_1000_entry_352[15:0] = dag_1000_entry_mul_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_352_reg[15:0] = bp_reg_4[70:55];
+end
+
+always @ (*) begin
+	dag_1000_entry_353[63:0] = (dag_1000_entry_332 ^ dag_1000_entry_336);
+end
+
+always @ (*) begin
+	dag_1000_entry_353_reg[63:0] = bp_reg_5[88:25];
+end
+
+always @ (*) begin
+	dag_1000_entry_354[63:0] = (dag_1000_entry_344_reg * dag_1000_entry_345_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_354_reg[63:0] = bp_reg_4[134:71];
+end
+
+always @ (*) begin
+	dag_1000_entry_355[63:0] = (dag_1000_entry_340 | dag_1000_entry_353);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_14)) begin
+		dag_1000_entry_355_reg[63:0] <= dag_1000_entry_355[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_356[7:0] = (dag_1000_entry_350_reg - dag_1000_entry_351);
+end
+
+always @ (*) begin
+	dag_1000_entry_356_reg[7:0] = bp_reg_3[55:48];
+end
+
+always @ (*) begin
+	dag_1000_entry_357[7:0] = dag_1000_entry_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_357_reg[7:0] = bp_reg_3[63:56];
+end
+
+always @ (*) begin
+	dag_1000_entry_358[63:0] = (dag_1000_entry_355_reg * dag_1000_entry_342_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_358_reg[63:0] = bp_reg_4[198:135];
+end
+
+always @ (*) begin
+	dag_1000_entry_359[31:0] = (dag_1000_entry_319_reg - dag_1000_entry_329);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_29)) begin
+		dag_1000_entry_359_reg[31:0] <= dag_1000_entry_359[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_360[15:0] = (dag_1000_entry_334 ^ dag_1000_entry_330);
+end
+
+always @ (*) begin
+	dag_1000_entry_360_reg[15:0] = bp_reg_4[214:199];
+end
+
+always @ (*) begin
+	dag_1000_entry_361[63:0] = (dag_1000_entry_355 - dag_1000_entry_340);
+end
+
+always @ (*) begin
+	dag_1000_entry_361_reg[63:0] = bp_reg_6[80:17];
+end
+
+always @ (*) begin
+	dag_1000_entry_362[31:0] = dag_1000_entry_mul_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_30)) begin
+		dag_1000_entry_362_reg[31:0] <= dag_1000_entry_362[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_33)) begin
+		dag_1000_entry_362_reg[31:0] <= dag_1000_entry_397[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_37)) begin
+		dag_1000_entry_362_reg[31:0] <= dag_1000_entry_491[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_71)) begin
+		dag_1000_entry_362_reg[31:0] <= dag_1000_entry_542[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_45)) begin
+		dag_1000_entry_362_reg[31:0] <= dag_1000_entry_608[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_47)) begin
+		dag_1000_entry_362_reg[31:0] <= dag_1000_entry_653[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_49)) begin
+		dag_1000_entry_362_reg[31:0] <= dag_1000_entry_720[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_55)) begin
+		dag_1000_entry_362_reg[31:0] <= dag_1000_entry_818[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_68)) begin
+		dag_1000_entry_362_reg[31:0] <= dag_1000_entry_897[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_363[31:0] = dag_1000_entry_mul_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_31)) begin
+		dag_1000_entry_363_reg[31:0] <= dag_1000_entry_363[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_46)) begin
+		dag_1000_entry_363_reg[31:0] <= dag_1000_entry_660[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_48)) begin
+		dag_1000_entry_363_reg[31:0] <= dag_1000_entry_672[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_364[31:0] = dag_1000_entry_and_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_31)) begin
+		dag_1000_entry_364_reg[31:0] <= dag_1000_entry_364[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_37)) begin
+		dag_1000_entry_364_reg[31:0] <= dag_1000_entry_474[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_44)) begin
+		dag_1000_entry_364_reg[31:0] <= dag_1000_entry_613[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_46)) begin
+		dag_1000_entry_364_reg[31:0] <= dag_1000_entry_627[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_54)) begin
+		dag_1000_entry_364_reg[31:0] <= dag_1000_entry_762[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_365[15:0] = dag_1000_entry_add_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_17)) begin
+		dag_1000_entry_365_reg[15:0] <= dag_1000_entry_365[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_367[31:0] = (dag_1000_entry_329 - dag_1000_entry_349_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_367_reg[31:0] = bp_reg_4[150:119];
+end
+
+always @ (*) begin
+	dag_1000_entry_368[15:0] = dag_1000_entry_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_368_reg[15:0] = bp_reg_2[104:89];
+end
+
+always @ (*) begin
+	dag_1000_entry_369[15:0] = dag_1000_entry_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_369_reg[15:0] = dag_1000_entry_128_reg[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_370[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_370_reg[31:0] = bp_reg_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_371[15:0] = dag_1000_entry_mul_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_371_reg[15:0] = dag_1000_entry_284_reg[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_372[63:0] = (dag_1000_entry_354_reg | dag_1000_entry_358_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_18)) begin
+		dag_1000_entry_372_reg[63:0] <= dag_1000_entry_372[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_373[31:0] = dag_1000_entry_or_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_373_reg[31:0] = dag_1000_entry_90_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_374[63:0] = (dag_1000_entry_353_reg - dag_1000_entry_354_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_374_reg[63:0] = bp_reg_4[166:103];
+end
+
+always @ (*) begin
+	dag_1000_entry_375[63:0] = (dag_1000_entry_372 - dag_1000_entry_355_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_18)) begin
+		dag_1000_entry_375_reg[63:0] <= dag_1000_entry_375[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_376[31:0] = (dag_1000_entry_348_reg ^ dag_1000_entry_359);
+end
+
+always @ (*) begin
+	dag_1000_entry_376_reg[31:0] = bp_reg_4[182:151];
+end
+
+always @ (*) begin
+	dag_1000_entry_377[63:0] = (dag_1000_entry_374_reg * dag_1000_entry_374_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_377_reg[63:0] = bp_reg_4[166:103];
+end
+
+always @ (*) begin
+	dag_1000_entry_378[63:0] = (dag_1000_entry_372_reg + dag_1000_entry_377_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_20)) begin
+		dag_1000_entry_378_reg[63:0] <= dag_1000_entry_378[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_379[7:0] = dag_1000_entry_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_379_reg[7:0] = bp_reg_3[71:64];
+end
+
+always @ (*) begin
+	dag_1000_entry_380[7:0] = dag_1000_entry_add_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_45)) begin
+		dag_1000_entry_380_reg[7:0] <= dag_1000_entry_380[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_43)) begin
+		dag_1000_entry_380_reg[7:0] <= dag_1000_entry_998[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_381[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_381_reg[31:0] = bp_reg_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_382[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_382_reg[31:0] = dag_1000_entry_113_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_383[15:0] = dag_1000_entry_add_16_16_1[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_383_reg[15:0] = dag_1000_entry_115_reg[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_384[63:0] = (dag_1000_entry_377_reg + dag_1000_entry_378);
+end
+
+always @ (*) begin
+	dag_1000_entry_384_reg[63:0] = bp_reg_4[150:87];
+end
+
+always @ (*) begin
+	dag_1000_entry_385[31:0] = dag_1000_entry_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_385_reg[31:0] = dag_1000_entry_26_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_386[31:0] = dag_1000_entry_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_386_reg[31:0] = dag_1000_entry_241_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_387[7:0] = dag_1000_entry_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_387_reg[7:0] = bp_reg_4[262:255];
+end
+
+always @ (*) begin
+	dag_1000_entry_388[7:0] = (dag_1000_entry_351 ^ dag_1000_entry_350_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_388_reg[7:0] = bp_reg_20[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_389[15:0] = dag_1000_entry_mul_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_389_reg[15:0] = bp_reg_4[182:167];
+end
+
+always @ (*) begin
+	dag_1000_entry_390[63:0] = (dag_1000_entry_361_reg + dag_1000_entry_372);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_18)) begin
+		dag_1000_entry_390_reg[63:0] <= dag_1000_entry_390[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_391[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_391_reg[31:0] = dag_1000_entry_167_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_393[63:0] = (dag_1000_entry_372 - dag_1000_entry_383);
+end
+
+always @ (*) begin
+	dag_1000_entry_393_reg[63:0] = bp_reg_5[95:32];
+end
+
+always @ (*) begin
+	dag_1000_entry_394[15:0] = dag_1000_entry_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_394_reg[15:0] = bp_reg_4[166:151];
+end
+
+always @ (*) begin
+	dag_1000_entry_395[7:0] = dag_1000_entry_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_395_reg[7:0] = bp_reg_4[206:199];
+end
+
+always @ (*) begin
+	dag_1000_entry_396[7:0] = (dag_1000_entry_357_reg - dag_1000_entry_395);
+end
+
+always @ (*) begin
+	dag_1000_entry_396_reg[7:0] = bp_reg_4[214:207];
+end
+
+always @ (*) begin
+	dag_1000_entry_397[31:0] = dag_1000_entry_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_397_reg[31:0] = dag_1000_entry_362_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_398[7:0] = dag_1000_entry_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_398_reg[7:0] = bp_reg_4[222:215];
+end
+
+always @ (*) begin
+	dag_1000_entry_399[15:0] = dag_1000_entry_add_16_16_1[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_399_reg[15:0] = bp_reg_4[198:183];
+end
+
+always @ (*) begin
+	dag_1000_entry_403[63:0] = (dag_1000_entry_384 - dag_1000_entry_384);
+end
+
+always @ (*) begin
+	dag_1000_entry_403_reg = bp_reg_4[167:167];
+end
+
+always @ (*) begin
+	dag_1000_entry_404[7:0] = (dag_1000_entry_398_reg - dag_1000_entry_387);
+end
+
+always @ (*) begin
+	dag_1000_entry_404_reg[7:0] = bp_reg_4[270:263];
+end
+
+always @ (*) begin
+	dag_1000_entry_405[63:0] = (dag_1000_entry_390_reg + dag_1000_entry_377_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_20)) begin
+		dag_1000_entry_405_reg[63:0] <= dag_1000_entry_405[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_407[63:0] = (dag_1000_entry_390_reg | dag_1000_entry_403);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_20)) begin
+		dag_1000_entry_407_reg[63:0] <= dag_1000_entry_407[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_408[7:0] = (dag_1000_entry_404 ^ dag_1000_entry_395_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_408_reg[7:0] = bp_reg_4[278:271];
+end
+
+always @ (*) begin
+	dag_1000_entry_409[7:0] = dag_1000_entry_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_409_reg[7:0] = bp_reg_4[230:223];
+end
+
+always @ (*) begin
+	dag_1000_entry_410[7:0] = (dag_1000_entry_409 - dag_1000_entry_396);
+end
+
+always @ (*) begin
+	dag_1000_entry_410_reg[7:0] = bp_reg_4[238:231];
+end
+
+always @ (*) begin
+	dag_1000_entry_412[7:0] = dag_1000_entry_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_412_reg[7:0] = bp_reg_5[103:96];
+end
+
+always @ (*) begin
+	dag_1000_entry_413[15:0] = dag_1000_entry_and_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_413_reg[15:0] = bp_reg_4[214:199];
+end
+
+always @ (*) begin
+	dag_1000_entry_414[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_414_reg[31:0] = dag_1000_entry_346_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_415[63:0] = (dag_1000_entry_407_reg + dag_1000_entry_390_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_415_reg[63:0] = bp_reg_4[182:119];
+end
+
+always @ (*) begin
+	dag_1000_entry_417[7:0] = (dag_1000_entry_409 ^ dag_1000_entry_409);
+end
+
+always @ (*) begin
+	dag_1000_entry_417_reg[7:0] = bp_reg_4[246:239];
+end
+
+always @ (*) begin
+	dag_1000_entry_418[15:0] = dag_1000_entry_and_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_418_reg[15:0] = bp_reg_6[48:33];
+end
+
+always @ (*) begin
+	dag_1000_entry_419[7:0] = dag_1000_entry_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_419_reg[7:0] = bp_reg_4[230:223];
+end
+
+always @ (*) begin
+	dag_1000_entry_420[7:0] = dag_1000_entry_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_420_reg[7:0] = bp_reg_6[56:49];
+end
+
+always @ (*) begin
+	dag_1000_entry_421[15:0] = (dag_1000_entry_413 ^ dag_1000_entry_371_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_19)) begin
+		dag_1000_entry_421_reg[15:0] <= dag_1000_entry_421[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_423[63:0] = (dag_1000_entry_393_reg + dag_1000_entry_415);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_21)) begin
+		dag_1000_entry_423_reg[63:0] <= dag_1000_entry_423[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_424[31:0] = dag_1000_entry_or_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_424_reg[31:0] = dag_1000_entry_90_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_425[15:0] = (dag_1000_entry_394 ^ dag_1000_entry_383_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_425_reg[15:0] = bp_reg_6[72:57];
+end
+
+always @ (*) begin
+	dag_1000_entry_426[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_426_reg[31:0] = dag_1000_entry_113_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_427[15:0] = dag_1000_entry_or_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_427_reg[15:0] = bp_reg_6[88:73];
+end
+
+always @ (*) begin
+	dag_1000_entry_428[31:0] = (dag_1000_entry_397 ^ dag_1000_entry_397);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_33)) begin
+		dag_1000_entry_428_reg[31:0] <= dag_1000_entry_428[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_429[7:0] = dag_1000_entry_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_429_reg[7:0] = bp_reg_4[286:279];
+end
+
+always @ (*) begin
+	dag_1000_entry_431[15:0] = dag_1000_entry_mul_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_20)) begin
+		bp_reg_24[15:0] <= dag_1000_entry_431[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_431_reg[15:0] = bp_reg_24[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_432[15:0] = dag_1000_entry_add_16_16_1[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_20)) begin
+		bp_reg_7[15:0] <= dag_1000_entry_432[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_20)) begin
+		bp_reg_7[79:16] <= dag_1000_entry_435[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_21)) begin
+		bp_reg_7[70:7] <= dag_1000_entry_480[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_22)) begin
+		bp_reg_7[22:15] <= dag_1000_entry_536[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_22)) begin
+		bp_reg_7[30:23] <= dag_1000_entry_545[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_24)) begin
+		bp_reg_7[30:23] <= dag_1000_entry_571[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_28)) begin
+		bp_reg_7[32:32] <= dag_1000_entry_629;
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_28)) begin
+		bp_reg_7[40:33] <= dag_1000_entry_648[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_28)) begin
+		bp_reg_7[48:41] <= dag_1000_entry_656[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_28)) begin
+		bp_reg_7[49:49] <= dag_1000_entry_669;
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_29)) begin
+		bp_reg_7[40:33] <= dag_1000_entry_696[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_29)) begin
+		bp_reg_7[48:41] <= dag_1000_entry_701[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_29)) begin
+		bp_reg_7[57:50] <= dag_1000_entry_702[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_29)) begin
+		bp_reg_7[65:58] <= dag_1000_entry_704[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_30)) begin
+		bp_reg_7[40:33] <= dag_1000_entry_711[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_31)) begin
+		bp_reg_7[40:33] <= dag_1000_entry_718[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_30)) begin
+		bp_reg_7[48:41] <= dag_1000_entry_725[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_31)) begin
+		bp_reg_7[57:50] <= dag_1000_entry_733[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_30)) begin
+		bp_reg_7[73:66] <= dag_1000_entry_736[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_32)) begin
+		bp_reg_7[40:33] <= dag_1000_entry_741[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_32)) begin
+		bp_reg_7[48:41] <= dag_1000_entry_752[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_432_reg[15:0] = bp_reg_7[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_433[15:0] = dag_1000_entry_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_433_reg[15:0] = dag_1000_entry_128_reg[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_434[31:0] = dag_1000_entry_or_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_434_reg[31:0] = bp_reg_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_435[63:0] = (dag_1000_entry_405 - dag_1000_entry_421_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_435_reg[63:0] = bp_reg_7[79:16];
+end
+
+always @ (*) begin
+	dag_1000_entry_436[7:0] = dag_1000_entry_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_436_reg[7:0] = bp_reg_5[111:104];
+end
+
+always @ (*) begin
+	dag_1000_entry_437[15:0] = dag_1000_entry_and_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_437_reg[15:0] = dag_1000_entry_247_reg[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_438[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_35)) begin
+		dag_1000_entry_438_reg[31:0] <= dag_1000_entry_438[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_36)) begin
+		dag_1000_entry_438_reg[31:0] <= dag_1000_entry_444[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_439[15:0] = dag_1000_entry_mul_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_439_reg[15:0] = bp_reg_25[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_440[31:0] = dag_1000_entry_and_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_34)) begin
+		bp_reg_14[31:0] <= dag_1000_entry_440[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_33)) begin
+		bp_reg_14[7:0] <= dag_1000_entry_760[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_440_reg[31:0] = bp_reg_14[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_441[15:0] = dag_1000_entry_add_16_16_1[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_441_reg[15:0] = dag_1000_entry_249_reg[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_442[15:0] = (dag_1000_entry_431_reg - dag_1000_entry_437);
+end
+
+always @ (*) begin
+	dag_1000_entry_442_reg[15:0] = bp_reg_5[39:24];
+end
+
+always @ (*) begin
+	dag_1000_entry_443[63:0] = (dag_1000_entry_415 | dag_1000_entry_423);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_21)) begin
+		dag_1000_entry_443_reg[63:0] <= dag_1000_entry_443[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_444[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_444_reg[31:0] = dag_1000_entry_438_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_445[15:0] = (dag_1000_entry_427_reg - dag_1000_entry_433);
+end
+
+always @ (*) begin
+	dag_1000_entry_445_reg[15:0] = bp_reg_5[127:112];
+end
+
+always @ (*) begin
+	dag_1000_entry_446[15:0] = dag_1000_entry_add_16_16_1[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_446_reg[15:0] = bp_reg_4[198:183];
+end
+
+always @ (*) begin
+	dag_1000_entry_447[7:0] = dag_1000_entry_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_447_reg[7:0] = bp_reg_5[135:128];
+end
+
+always @ (*) begin
+	dag_1000_entry_448[15:0] = (dag_1000_entry_439 ^ dag_1000_entry_439);
+end
+
+always @ (*) begin
+	dag_1000_entry_448_reg[15:0] = bp_reg_6[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_450[63:0] = (dag_1000_entry_415 + dag_1000_entry_423);
+end
+
+always @ (*) begin
+	dag_1000_entry_450_reg[63:0] = bp_reg_6[79:16];
+end
+
+always @ (*) begin
+	dag_1000_entry_451[15:0] = dag_1000_entry_mul_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_451_reg[15:0] = bp_reg_4[214:199];
+end
+
+always @ (*) begin
+	dag_1000_entry_452[7:0] = dag_1000_entry_add_8_8_1[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_20)) begin
+		bp_reg_49[7:0] <= dag_1000_entry_452[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_23)) begin
+		bp_reg_49[7:0] <= dag_1000_entry_553[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_24)) begin
+		bp_reg_49[7:0] <= dag_1000_entry_582[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_452_reg[7:0] = bp_reg_49[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_453[15:0] = dag_1000_entry_and_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_22)) begin
+		dag_1000_entry_453_reg[15:0] <= dag_1000_entry_453[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_454[31:0] = (dag_1000_entry_428_reg - dag_1000_entry_444);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_36)) begin
+		dag_1000_entry_454_reg[31:0] <= dag_1000_entry_454[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_455[31:0] = (dag_1000_entry_438 - dag_1000_entry_428_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_35)) begin
+		bp_reg_15[31:0] <= dag_1000_entry_455[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_455_reg[31:0] = bp_reg_15[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_456[15:0] = dag_1000_entry_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_456_reg[15:0] = bp_reg_4[278:263];
+end
+
+always @ (*) begin
+	dag_1000_entry_457[15:0] = dag_1000_entry_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_457_reg[15:0] = bp_reg_1[79:64];
+end
+
+always @ (*) begin
+	dag_1000_entry_459[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_459_reg[31:0] = dag_1000_entry_113_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_461[7:0] = dag_1000_entry_add_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_20)) begin
+		bp_reg_50[7:0] <= dag_1000_entry_461[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_23)) begin
+		bp_reg_50[7:0] <= dag_1000_entry_556[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_461_reg[7:0] = bp_reg_50[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_464[7:0] = dag_1000_entry_mul_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_20)) begin
+		bp_reg_51[7:0] <= dag_1000_entry_464[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_20)) begin
+		bp_reg_51[15:8] <= dag_1000_entry_467[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_23)) begin
+		bp_reg_51[7:0] <= dag_1000_entry_557[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_23)) begin
+		bp_reg_51[15:8] <= dag_1000_entry_579[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_24)) begin
+		bp_reg_51[7:0] <= dag_1000_entry_592[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_30)) begin
+		bp_reg_51[9:2] <= dag_1000_entry_745[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_464_reg[7:0] = bp_reg_51[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_465[31:0] = dag_1000_entry_or_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_465_reg[31:0] = dag_1000_entry_282_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_466[15:0] = dag_1000_entry_and_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_466_reg[7:0] = dag_1000_entry_247_reg[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_467[7:0] = (dag_1000_entry_436_reg ^ dag_1000_entry_420);
+end
+
+always @ (*) begin
+	dag_1000_entry_467_reg[7:0] = bp_reg_51[15:8];
+end
+
+always @ (*) begin
+	dag_1000_entry_469[7:0] = (dag_1000_entry_461 - dag_1000_entry_467);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_20)) begin
+		bp_reg_52[7:0] <= dag_1000_entry_469[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_24)) begin
+		bp_reg_52[7:0] <= dag_1000_entry_605[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_26)) begin
+		bp_reg_52[7:0] <= dag_1000_entry_610[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_469_reg[7:0] = bp_reg_52[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_470[15:0] = dag_1000_entry_mul_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_470_reg[15:0] = dag_1000_entry_284_reg[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_471[15:0] = (dag_1000_entry_456_reg ^ dag_1000_entry_470);
+end
+
+always @ (*) begin
+	dag_1000_entry_471_reg[15:0] = bp_reg_4[110:95];
+end
+
+always @ (*) begin
+	dag_1000_entry_472[63:0] = (dag_1000_entry_405 + dag_1000_entry_405);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_20)) begin
+		bp_reg_8[63:0] <= dag_1000_entry_472[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_20)) begin
+		bp_reg_8[71:64] <= dag_1000_entry_478[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_20)) begin
+		bp_reg_8[79:72] <= dag_1000_entry_486[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_21)) begin
+		bp_reg_8[38:31] <= dag_1000_entry_489[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_21)) begin
+		bp_reg_8[182:119] <= dag_1000_entry_504[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_21)) begin
+		bp_reg_8[246:183] <= dag_1000_entry_505[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_21)) begin
+		bp_reg_8[310:247] <= dag_1000_entry_507[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_21)) begin
+		bp_reg_8[374:311] <= dag_1000_entry_508[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_21)) begin
+		bp_reg_8[375:375] <= dag_1000_entry_510;
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_21)) begin
+		bp_reg_8[439:376] <= dag_1000_entry_515[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_20)) begin
+		bp_reg_8[87:80] <= dag_1000_entry_527[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_25)) begin
+		bp_reg_8[71:8] <= dag_1000_entry_568[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_25)) begin
+		bp_reg_8[135:72] <= dag_1000_entry_580[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_25)) begin
+		bp_reg_8[199:136] <= dag_1000_entry_584[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_25)) begin
+		bp_reg_8[263:200] <= dag_1000_entry_586[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_25)) begin
+		bp_reg_8[327:264] <= dag_1000_entry_588[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_43)) begin
+		bp_reg_8[97:34] <= dag_1000_entry_603[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_25)) begin
+		bp_reg_8[335:328] <= dag_1000_entry_604[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_25)) begin
+		bp_reg_8[343:336] <= dag_1000_entry_616[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_45)) begin
+		bp_reg_8[71:40] <= dag_1000_entry_621[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_26)) begin
+		bp_reg_8[7:0] <= dag_1000_entry_624[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_26)) begin
+		bp_reg_8[15:8] <= dag_1000_entry_625[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_45)) begin
+		bp_reg_8[103:72] <= dag_1000_entry_626[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_27)) begin
+		bp_reg_8[199:136] <= dag_1000_entry_632[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_25)) begin
+		bp_reg_8[351:344] <= dag_1000_entry_633[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_27)) begin
+		bp_reg_8[351:344] <= dag_1000_entry_634[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_45)) begin
+		bp_reg_8[135:104] <= dag_1000_entry_635[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_26)) begin
+		bp_reg_8[23:16] <= dag_1000_entry_636[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_26)) begin
+		bp_reg_8[31:24] <= dag_1000_entry_637[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_43)) begin
+		bp_reg_8[161:98] <= dag_1000_entry_639[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_43)) begin
+		bp_reg_8[225:162] <= dag_1000_entry_644[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_27)) begin
+		bp_reg_8[359:352] <= dag_1000_entry_645[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_44)) begin
+		bp_reg_8[73:10] <= dag_1000_entry_646[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_27)) begin
+		bp_reg_8[367:360] <= dag_1000_entry_651[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_43)) begin
+		bp_reg_8[241:226] <= dag_1000_entry_659[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_27)) begin
+		bp_reg_8[431:368] <= dag_1000_entry_663[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_45)) begin
+		bp_reg_8[136:136] <= dag_1000_entry_664;
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_43)) begin
+		bp_reg_8[257:242] <= dag_1000_entry_665[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_27)) begin
+		bp_reg_8[439:432] <= dag_1000_entry_666[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_44)) begin
+		bp_reg_8[137:74] <= dag_1000_entry_671[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_43)) begin
+		bp_reg_8[273:258] <= dag_1000_entry_673[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_44)) begin
+		bp_reg_8[153:138] <= dag_1000_entry_674[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_43)) begin
+		bp_reg_8[289:274] <= dag_1000_entry_680[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_46)) begin
+		bp_reg_8[95:95] <= dag_1000_entry_683;
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_44)) begin
+		bp_reg_8[281:266] <= dag_1000_entry_691[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_48)) begin
+		bp_reg_8[214:183] <= dag_1000_entry_719[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_45)) begin
+		bp_reg_8[152:137] <= dag_1000_entry_729[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_47)) begin
+		bp_reg_8[31:16] <= dag_1000_entry_806[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_47)) begin
+		bp_reg_8[166:151] <= dag_1000_entry_827[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_47)) begin
+		bp_reg_8[182:167] <= dag_1000_entry_828[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_57)) begin
+		bp_reg_8[413:382] <= dag_1000_entry_841[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_61)) begin
+		bp_reg_8[413:382] <= dag_1000_entry_886[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_63)) begin
+		bp_reg_8[389:382] <= dag_1000_entry_909[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_65)) begin
+		bp_reg_8[182:167] <= dag_1000_entry_914[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_53)) begin
+		bp_reg_8[421:414] <= dag_1000_entry_922[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_43)) begin
+		bp_reg_8[297:290] <= dag_1000_entry_938[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_43)) begin
+		bp_reg_8[305:298] <= dag_1000_entry_942[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_63)) begin
+		bp_reg_8[398:390] <= dag_1000_entry_953[8:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_43)) begin
+		bp_reg_8[313:306] <= dag_1000_entry_963[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_43)) begin
+		bp_reg_8[321:314] <= dag_1000_entry_970[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_472_reg[63:0] = bp_reg_8[63:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_473[7:0] = (dag_1000_entry_447 ^ dag_1000_entry_452_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_473_reg[7:0] = bp_reg_6[87:80];
+end
+
+always @ (*) begin
+	dag_1000_entry_474[31:0] = dag_1000_entry_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_474_reg[31:0] = dag_1000_entry_364_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_475[31:0] = (dag_1000_entry_454 ^ dag_1000_entry_455_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_36)) begin
+		dag_1000_entry_475_reg[31:0] <= dag_1000_entry_475[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_476[7:0] = dag_1000_entry_mul_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_21)) begin
+		dag_1000_entry_476_reg[7:0] <= dag_1000_entry_476[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_478[7:0] = (dag_1000_entry_467 ^ dag_1000_entry_469);
+end
+
+always @ (*) begin
+	dag_1000_entry_478_reg[7:0] = bp_reg_8[71:64];
+end
+
+always @ (*) begin
+	dag_1000_entry_479[15:0] = dag_1000_entry_or_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_479_reg[15:0] = bp_reg_4[30:15];
+end
+
+always @ (*) begin
+	dag_1000_entry_480[63:0] = (dag_1000_entry_407_reg & dag_1000_entry_415);
+end
+
+always @ (*) begin
+	dag_1000_entry_480_reg[63:0] = bp_reg_7[70:7];
+end
+
+always @ (*) begin
+	dag_1000_entry_481[15:0] = dag_1000_entry_or_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_481_reg[15:0] = dag_1000_entry_322_reg[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_483[31:0] = dag_1000_entry_and_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_38)) begin
+		dag_1000_entry_483_reg[31:0] <= dag_1000_entry_483[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_39)) begin
+		dag_1000_entry_483_reg[31:0] <= dag_1000_entry_484[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_40)) begin
+		dag_1000_entry_483_reg[31:0] <= dag_1000_entry_530[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_484[31:0] = dag_1000_entry_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_484_reg[31:0] = dag_1000_entry_483_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_485[15:0] = (dag_1000_entry_479 ^ dag_1000_entry_481_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_24)) begin
+		dag_1000_entry_485_reg[15:0] <= dag_1000_entry_485[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_486[7:0] = dag_1000_entry_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_486_reg[7:0] = bp_reg_8[79:72];
+end
+
+always @ (*) begin
+	dag_1000_entry_487[31:0] = dag_1000_entry_or_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_487_reg[31:0] = dag_1000_entry_90_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_488[63:0] = (dag_1000_entry_450 & dag_1000_entry_415);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_21)) begin
+		dag_1000_entry_488_reg[63:0] <= dag_1000_entry_488[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_489[7:0] = (dag_1000_entry_473 ^ dag_1000_entry_478_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_489_reg[7:0] = bp_reg_8[38:31];
+end
+
+always @ (*) begin
+	dag_1000_entry_491[31:0] = dag_1000_entry_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_491_reg[31:0] = dag_1000_entry_362_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_492[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_38)) begin
+		dag_1000_entry_492_reg[31:0] <= dag_1000_entry_492[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_40)) begin
+		dag_1000_entry_492_reg[31:0] <= dag_1000_entry_517[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_44)) begin
+		dag_1000_entry_492_reg[31:0] <= dag_1000_entry_581[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_494[31:0] = dag_1000_entry_or_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_494_reg[31:0] = dag_1000_entry_90_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_496[15:0] = dag_1000_entry_mul_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_496_reg[15:0] = bp_reg_4[118:103];
+end
+
+always @ (*) begin
+	dag_1000_entry_498[31:0] = dag_1000_entry_mul_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_38)) begin
+		bp_reg_16[31:0] <= dag_1000_entry_498[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_41)) begin
+		bp_reg_16[46:15] <= dag_1000_entry_532[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_41)) begin
+		bp_reg_16[47:47] <= dag_1000_entry_535;
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_38)) begin
+		bp_reg_16[39:32] <= dag_1000_entry_836[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_38)) begin
+		bp_reg_16[47:40] <= dag_1000_entry_839[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_498_reg[31:0] = bp_reg_16[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_499[15:0] = dag_1000_entry_mul_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_499_reg[15:0] = bp_reg_4[102:87];
+end
+
+always @ (*) begin
+	dag_1000_entry_500[7:0] = dag_1000_entry_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_500_reg[7:0] = bp_reg_4[286:279];
+end
+
+always @ (*) begin
+	dag_1000_entry_501[7:0] = dag_1000_entry_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_501_reg[7:0] = bp_reg_44[14:7];
+end
+
+always @ (*) begin
+	dag_1000_entry_502[63:0] = (dag_1000_entry_480 + dag_1000_entry_480);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_21)) begin
+		dag_1000_entry_502_reg[63:0] <= dag_1000_entry_502[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_503[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_503_reg[31:0] = dag_1000_entry_113_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_504[63:0] = (dag_1000_entry_502 | dag_1000_entry_480);
+end
+
+always @ (*) begin
+	dag_1000_entry_504_reg[63:0] = bp_reg_8[182:119];
+end
+
+always @ (*) begin
+	dag_1000_entry_505[63:0] = (dag_1000_entry_488 ^ dag_1000_entry_502);
+end
+
+always @ (*) begin
+	dag_1000_entry_505_reg[63:0] = bp_reg_8[246:183];
+end
+
+always @ (*) begin
+	dag_1000_entry_506[31:0] = dag_1000_entry_mul_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_39)) begin
+		bp_reg_17[38:7] <= dag_1000_entry_506[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_39)) begin
+		bp_reg_17[70:39] <= dag_1000_entry_513[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_42)) begin
+		bp_reg_17[63:32] <= dag_1000_entry_543[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_41)) begin
+		bp_reg_17[7:0] <= dag_1000_entry_901[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_41)) begin
+		bp_reg_17[15:8] <= dag_1000_entry_910[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_41)) begin
+		bp_reg_17[23:16] <= dag_1000_entry_913[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_60)) begin
+		bp_reg_17[31:31] <= dag_1000_entry_921;
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_51)) begin
+		bp_reg_17[31:24] <= dag_1000_entry_939[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_506_reg[31:0] = bp_reg_17[38:7];
+end
+
+always @ (*) begin
+	dag_1000_entry_507[63:0] = (dag_1000_entry_480 - dag_1000_entry_502);
+end
+
+always @ (*) begin
+	dag_1000_entry_507_reg[63:0] = bp_reg_8[310:247];
+end
+
+always @ (*) begin
+	dag_1000_entry_508[63:0] = (dag_1000_entry_504 + dag_1000_entry_504);
+end
+
+always @ (*) begin
+	dag_1000_entry_508_reg[63:0] = bp_reg_8[374:311];
+end
+
+always @ (*) begin
+	dag_1000_entry_509[15:0] = (dag_1000_entry_479 ^ dag_1000_entry_479);
+end
+
+always @ (*) begin
+	dag_1000_entry_509_reg[15:0] = bp_reg_4[198:183];
+end
+
+always @ (*) begin
+	dag_1000_entry_510[7:0] = (dag_1000_entry_489 - dag_1000_entry_489);
+end
+
+always @ (*) begin
+	dag_1000_entry_510_reg = bp_reg_8[375:375];
+end
+
+always @ (*) begin
+	dag_1000_entry_511[31:0] = dag_1000_entry_or_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_41)) begin
+		dag_1000_entry_511_reg[31:0] <= dag_1000_entry_511[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_48)) begin
+		dag_1000_entry_511_reg[31:0] <= dag_1000_entry_685[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_57)) begin
+		dag_1000_entry_511_reg[31:0] <= dag_1000_entry_833[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_61)) begin
+		dag_1000_entry_511_reg[31:0] <= dag_1000_entry_874[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_512[7:0] = (dag_1000_entry_501 - dag_1000_entry_510_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_22)) begin
+		dag_1000_entry_512_reg[7:0] <= dag_1000_entry_512[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_513[31:0] = (dag_1000_entry_506 - dag_1000_entry_494);
+end
+
+always @ (*) begin
+	dag_1000_entry_513_reg[31:0] = bp_reg_17[70:39];
+end
+
+always @ (*) begin
+	dag_1000_entry_514[15:0] = dag_1000_entry_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_514_reg[15:0] = bp_reg_4[214:199];
+end
+
+always @ (*) begin
+	dag_1000_entry_515[63:0] = (dag_1000_entry_505 ^ dag_1000_entry_507);
+end
+
+always @ (*) begin
+	dag_1000_entry_515_reg[63:0] = bp_reg_8[439:376];
+end
+
+always @ (*) begin
+	dag_1000_entry_516[15:0] = dag_1000_entry_add_16_16_1[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_516_reg[15:0] = bp_reg_4[278:263];
+end
+
+always @ (*) begin
+	dag_1000_entry_517[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_517_reg[31:0] = dag_1000_entry_492_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_518[31:0] = (dag_1000_entry_498_reg - dag_1000_entry_511);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_41)) begin
+		dag_1000_entry_518_reg[31:0] <= dag_1000_entry_518[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_519[63:0] = (dag_1000_entry_515_reg * dag_1000_entry_507_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_22)) begin
+		dag_1000_entry_519_reg[63:0] <= dag_1000_entry_519[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_522[63:0] = (dag_1000_entry_519_reg | dag_1000_entry_489_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_23)) begin
+		dag_1000_entry_522_reg[63:0] <= dag_1000_entry_522[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_523[15:0] = dag_1000_entry_or_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_523_reg[15:0] = bp_reg_4[166:151];
+end
+
+always @ (*) begin
+	dag_1000_entry_524[7:0] = dag_1000_entry_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_524_reg[7:0] = bp_reg_5[71:64];
+end
+
+always @ (*) begin
+	dag_1000_entry_525[63:0] = (dag_1000_entry_508_reg * dag_1000_entry_505_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_22)) begin
+		dag_1000_entry_525_reg[63:0] <= dag_1000_entry_525[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_526[31:0] = dag_1000_entry_or_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_526_reg[31:0] = dag_1000_entry_90_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_527[7:0] = (dag_1000_entry_486 ^ dag_1000_entry_486);
+end
+
+always @ (*) begin
+	dag_1000_entry_527_reg[7:0] = bp_reg_8[87:80];
+end
+
+always @ (*) begin
+	dag_1000_entry_528[63:0] = (dag_1000_entry_522 + dag_1000_entry_522);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_23)) begin
+		dag_1000_entry_528_reg[63:0] <= dag_1000_entry_528[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_529[15:0] = dag_1000_entry_and_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_24)) begin
+		dag_1000_entry_529_reg[15:0] <= dag_1000_entry_529[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_27)) begin
+		dag_1000_entry_529_reg[15:0] <= dag_1000_entry_577[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_530[31:0] = dag_1000_entry_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_530_reg[31:0] = dag_1000_entry_483_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_531[7:0] = dag_1000_entry_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_531_reg = bp_reg_6[8:8];
+end
+
+always @ (*) begin
+	dag_1000_entry_532[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_532_reg[31:0] = bp_reg_16[46:15];
+end
+
+always @ (*) begin
+	dag_1000_entry_533[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_533_reg[31:0] = dag_1000_entry_113_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_534[63:0] = (dag_1000_entry_507_reg + dag_1000_entry_507_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_22)) begin
+		dag_1000_entry_534_reg[63:0] <= dag_1000_entry_534[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_535[31:0] = dag_1000_entry_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_535_reg = bp_reg_16[47:47];
+end
+
+always @ (*) begin
+	dag_1000_entry_536[7:0] = dag_1000_entry_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_536_reg[7:0] = bp_reg_7[22:15];
+end
+
+always @ (*) begin
+	dag_1000_entry_537[15:0] = dag_1000_entry_and_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_537_reg[15:0] = bp_reg_4[182:167];
+end
+
+always @ (*) begin
+	dag_1000_entry_539[63:0] = (dag_1000_entry_522 | dag_1000_entry_534_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_23)) begin
+		dag_1000_entry_539_reg[63:0] <= dag_1000_entry_539[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_540[31:0] = (dag_1000_entry_517_reg - dag_1000_entry_526);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_42)) begin
+		dag_1000_entry_540_reg[31:0] <= dag_1000_entry_540[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_541[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_541_reg[31:0] = dag_1000_entry_113_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_542[31:0] = dag_1000_entry_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_542_reg[31:0] = dag_1000_entry_362_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_543[31:0] = dag_1000_entry_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_543_reg[31:0] = bp_reg_17[63:32];
+end
+
+always @ (*) begin
+	dag_1000_entry_544[63:0] = (dag_1000_entry_539 ^ dag_1000_entry_531);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_23)) begin
+		dag_1000_entry_544_reg[63:0] <= dag_1000_entry_544[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_545[7:0] = (dag_1000_entry_527_reg ^ dag_1000_entry_500);
+end
+
+always @ (*) begin
+	dag_1000_entry_545_reg[7:0] = bp_reg_7[30:23];
+end
+
+always @ (*) begin
+	dag_1000_entry_546[63:0] = (dag_1000_entry_522_reg * dag_1000_entry_528_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_24)) begin
+		dag_1000_entry_546_reg[63:0] <= dag_1000_entry_546[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_547[15:0] = dag_1000_entry_mul_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_547_reg[15:0] = dag_1000_entry_284_reg[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_549[15:0] = dag_1000_entry_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_549_reg[15:0] = bp_reg_4[214:199];
+end
+
+always @ (*) begin
+	dag_1000_entry_550[7:0] = dag_1000_entry_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_550_reg[7:0] = bp_reg_6[23:16];
+end
+
+always @ (*) begin
+	dag_1000_entry_552[15:0] = (dag_1000_entry_514_reg - dag_1000_entry_523);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_25)) begin
+		dag_1000_entry_552_reg[15:0] <= dag_1000_entry_552[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_553[7:0] = dag_1000_entry_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_553_reg[7:0] = bp_reg_49[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_554[31:0] = dag_1000_entry_or_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_41)) begin
+		bp_reg_26[15:0] <= dag_1000_entry_554[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_38)) begin
+		bp_reg_26[7:0] <= dag_1000_entry_858[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_41)) begin
+		bp_reg_26[23:16] <= dag_1000_entry_871[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_41)) begin
+		bp_reg_26[24:24] <= dag_1000_entry_894;
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_64)) begin
+		bp_reg_26[24:9] <= dag_1000_entry_906[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_554_reg[15:0] = bp_reg_26[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_555[63:0] = (dag_1000_entry_546_reg + dag_1000_entry_516_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_25)) begin
+		dag_1000_entry_555_reg[63:0] <= dag_1000_entry_555[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_556[7:0] = dag_1000_entry_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_556_reg[7:0] = bp_reg_50[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_557[7:0] = dag_1000_entry_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_557_reg[7:0] = bp_reg_51[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_558[15:0] = dag_1000_entry_add_16_16_1[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_558_reg[15:0] = bp_reg_5[87:72];
+end
+
+always @ (*) begin
+	dag_1000_entry_559[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_559_reg[31:0] = dag_1000_entry_113_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_560[7:0] = (dag_1000_entry_550 ^ dag_1000_entry_556_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_560_reg[7:0] = bp_reg_6[31:24];
+end
+
+always @ (*) begin
+	dag_1000_entry_562[15:0] = dag_1000_entry_and_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_562_reg[15:0] = dag_1000_entry_247_reg[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_564[63:0] = (dag_1000_entry_528_reg + dag_1000_entry_555);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_25)) begin
+		dag_1000_entry_564_reg[63:0] <= dag_1000_entry_564[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_565[15:0] = (dag_1000_entry_549_reg ^ dag_1000_entry_562);
+end
+
+always @ (*) begin
+	dag_1000_entry_565_reg[15:0] = bp_reg_5[63:48];
+end
+
+always @ (*) begin
+	dag_1000_entry_566[63:0] = (dag_1000_entry_539_reg ^ dag_1000_entry_555);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_25)) begin
+		dag_1000_entry_566_reg[63:0] <= dag_1000_entry_566[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_567[7:0] = (dag_1000_entry_556_reg ^ dag_1000_entry_560);
+end
+
+always @ (*) begin
+	dag_1000_entry_567_reg[7:0] = bp_reg_6[39:32];
+end
+
+always @ (*) begin
+	dag_1000_entry_568[63:0] = (dag_1000_entry_564 + dag_1000_entry_539_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_568_reg[63:0] = bp_reg_8[71:8];
+end
+
+always @ (*) begin
+	dag_1000_entry_569[15:0] = (dag_1000_entry_558_reg ^ dag_1000_entry_565);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_26)) begin
+		dag_1000_entry_569_reg[15:0] <= dag_1000_entry_569[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_570[15:0] = dag_1000_entry_add_16_16_1[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_570_reg[15:0] = bp_reg_2[128:113];
+end
+
+always @ (*) begin
+	dag_1000_entry_571[7:0] = (dag_1000_entry_550 ^ dag_1000_entry_557_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_571_reg[7:0] = bp_reg_7[30:23];
+end
+
+always @ (*) begin
+	dag_1000_entry_572[15:0] = dag_1000_entry_mul_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_572_reg[15:0] = bp_reg_4[214:199];
+end
+
+always @ (*) begin
+	dag_1000_entry_573[15:0] = dag_1000_entry_add_16_16_1[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_573_reg[15:0] = bp_reg_0[47:32];
+end
+
+always @ (*) begin
+	dag_1000_entry_574[63:0] = (dag_1000_entry_568_reg * dag_1000_entry_544_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_26)) begin
+		dag_1000_entry_574_reg[63:0] <= dag_1000_entry_574[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_575[31:0] = (dag_1000_entry_541 - dag_1000_entry_554_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_42)) begin
+		dag_1000_entry_575_reg[31:0] <= dag_1000_entry_575[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_577[15:0] = dag_1000_entry_and_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_577_reg[15:0] = dag_1000_entry_529_reg[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_578[63:0] = (dag_1000_entry_566_reg * dag_1000_entry_555_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_26)) begin
+		dag_1000_entry_578_reg[63:0] <= dag_1000_entry_578[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_579[7:0] = dag_1000_entry_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_579_reg[7:0] = bp_reg_51[15:8];
+end
+
+always @ (*) begin
+	dag_1000_entry_580[63:0] = (dag_1000_entry_566 + dag_1000_entry_579_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_580_reg[63:0] = bp_reg_8[135:72];
+end
+
+always @ (*) begin
+	dag_1000_entry_581[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_581_reg[31:0] = dag_1000_entry_492_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_582[7:0] = dag_1000_entry_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_582_reg[7:0] = bp_reg_49[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_583[15:0] = dag_1000_entry_and_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_583_reg[15:0] = bp_reg_0[63:48];
+end
+
+always @ (*) begin
+	dag_1000_entry_584[63:0] = (dag_1000_entry_564 - dag_1000_entry_555);
+end
+
+always @ (*) begin
+	dag_1000_entry_584_reg[63:0] = bp_reg_8[199:136];
+end
+
+always @ (*) begin
+	dag_1000_entry_585[15:0] = (dag_1000_entry_577 ^ dag_1000_entry_572);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_27)) begin
+		dag_1000_entry_585_reg[15:0] <= dag_1000_entry_585[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_586[63:0] = (dag_1000_entry_566 + dag_1000_entry_584);
+end
+
+always @ (*) begin
+	dag_1000_entry_586_reg[63:0] = bp_reg_8[263:200];
+end
+
+always @ (*) begin
+	dag_1000_entry_588[63:0] = (dag_1000_entry_568 & dag_1000_entry_584);
+end
+
+always @ (*) begin
+	dag_1000_entry_588_reg[63:0] = bp_reg_8[327:264];
+end
+
+always @ (*) begin
+	dag_1000_entry_589[31:0] = (dag_1000_entry_575_reg ^ dag_1000_entry_581);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_44)) begin
+		dag_1000_entry_589_reg[31:0] <= dag_1000_entry_589[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_590[15:0] = dag_1000_entry_or_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_42)) begin
+		bp_reg_27[15:0] <= dag_1000_entry_590[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_590_reg[15:0] = bp_reg_27[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_592[7:0] = dag_1000_entry_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_592_reg[7:0] = bp_reg_51[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_593[31:0] = (dag_1000_entry_543_reg ^ dag_1000_entry_559);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_43)) begin
+		dag_1000_entry_593_reg[31:0] <= dag_1000_entry_593[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_595[63:0] = (dag_1000_entry_578_reg & dag_1000_entry_586_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_27)) begin
+		dag_1000_entry_595_reg[63:0] <= dag_1000_entry_595[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_596[15:0] = (dag_1000_entry_577_reg - dag_1000_entry_583);
+end
+
+always @ (*) begin
+	dag_1000_entry_596_reg[15:0] = bp_reg_12[55:40];
+end
+
+always @ (*) begin
+	dag_1000_entry_597[63:0] = (dag_1000_entry_586_reg | dag_1000_entry_593);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_43)) begin
+		dag_1000_entry_597_reg[63:0] <= dag_1000_entry_597[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_599[63:0] = (dag_1000_entry_595 - dag_1000_entry_580_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_27)) begin
+		dag_1000_entry_599_reg[63:0] <= dag_1000_entry_599[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_602[63:0] = (dag_1000_entry_599 + dag_1000_entry_585);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_27)) begin
+		dag_1000_entry_602_reg[63:0] <= dag_1000_entry_602[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_603[63:0] = (dag_1000_entry_599_reg + dag_1000_entry_593);
+end
+
+always @ (*) begin
+	dag_1000_entry_603_reg[63:0] = bp_reg_8[97:34];
+end
+
+always @ (*) begin
+	dag_1000_entry_604[7:0] = dag_1000_entry_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_604_reg[7:0] = bp_reg_8[335:328];
+end
+
+always @ (*) begin
+	dag_1000_entry_605[7:0] = dag_1000_entry_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_605_reg[7:0] = bp_reg_52[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_607[31:0] = (dag_1000_entry_581 - dag_1000_entry_593_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_44)) begin
+		dag_1000_entry_607_reg[31:0] <= dag_1000_entry_607[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_608[31:0] = dag_1000_entry_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_608_reg[31:0] = dag_1000_entry_362_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_609[63:0] = (dag_1000_entry_599 | dag_1000_entry_602);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_27)) begin
+		dag_1000_entry_609_reg[63:0] <= dag_1000_entry_609[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_610[7:0] = dag_1000_entry_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_610_reg[7:0] = bp_reg_52[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_613[31:0] = dag_1000_entry_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_613_reg[31:0] = dag_1000_entry_364_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_616[7:0] = dag_1000_entry_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_616_reg[7:0] = bp_reg_8[343:336];
+end
+
+always @ (*) begin
+	dag_1000_entry_617[31:0] = dag_1000_entry_and_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_45)) begin
+		dag_1000_entry_617_reg[31:0] <= dag_1000_entry_617[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_47)) begin
+		dag_1000_entry_617_reg[31:0] <= dag_1000_entry_638[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_55)) begin
+		dag_1000_entry_617_reg[31:0] <= dag_1000_entry_774[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_618[15:0] = dag_1000_entry_and_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_42)) begin
+		bp_reg_28[15:0] <= dag_1000_entry_618[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_618_reg[15:0] = bp_reg_28[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_619[15:0] = (dag_1000_entry_590 - dag_1000_entry_590);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_42)) begin
+		bp_reg_75 <= dag_1000_entry_619;
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_619_reg = bp_reg_75;
+end
+
+always @ (*) begin
+	dag_1000_entry_620[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_620_reg[31:0] = dag_1000_entry_113_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_621[31:0] = (dag_1000_entry_617 - dag_1000_entry_620);
+end
+
+always @ (*) begin
+	dag_1000_entry_621_reg[31:0] = bp_reg_8[71:40];
+end
+
+always @ (*) begin
+	dag_1000_entry_622[15:0] = (dag_1000_entry_618 ^ dag_1000_entry_590);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_42)) begin
+		bp_reg_29[15:0] <= dag_1000_entry_622[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_622_reg[15:0] = bp_reg_29[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_624[7:0] = dag_1000_entry_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_624_reg[7:0] = bp_reg_8[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_625[7:0] = dag_1000_entry_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_625_reg[7:0] = bp_reg_8[15:8];
+end
+
+always @ (*) begin
+	dag_1000_entry_626[31:0] = dag_1000_entry_or_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_626_reg[31:0] = bp_reg_8[103:72];
+end
+
+always @ (*) begin
+	dag_1000_entry_627[31:0] = dag_1000_entry_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_627_reg[31:0] = dag_1000_entry_364_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_628[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_46)) begin
+		dag_1000_entry_628_reg[31:0] <= dag_1000_entry_628[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_47)) begin
+		dag_1000_entry_628_reg[31:0] <= dag_1000_entry_717[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_629[63:0] = (dag_1000_entry_609_reg - dag_1000_entry_609_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_629_reg = bp_reg_7[32:32];
+end
+
+always @ (*) begin
+	dag_1000_entry_631[15:0] = dag_1000_entry_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_631_reg[15:0] = bp_reg_0[63:48];
+end
+
+always @ (*) begin
+	dag_1000_entry_632[63:0] = (dag_1000_entry_602 ^ dag_1000_entry_609);
+end
+
+always @ (*) begin
+	dag_1000_entry_632_reg[63:0] = bp_reg_8[199:136];
+end
+
+always @ (*) begin
+	dag_1000_entry_633[7:0] = dag_1000_entry_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_633_reg[7:0] = bp_reg_8[351:344];
+end
+
+always @ (*) begin
+	dag_1000_entry_634[7:0] = dag_1000_entry_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_634_reg[7:0] = bp_reg_8[351:344];
+end
+
+always @ (*) begin
+	dag_1000_entry_635[31:0] = (dag_1000_entry_621 ^ dag_1000_entry_617);
+end
+
+always @ (*) begin
+	dag_1000_entry_635_reg[31:0] = bp_reg_8[135:104];
+end
+
+always @ (*) begin
+	dag_1000_entry_636[7:0] = dag_1000_entry_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_636_reg[7:0] = bp_reg_8[23:16];
+end
+
+always @ (*) begin
+	dag_1000_entry_637[7:0] = dag_1000_entry_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_637_reg[7:0] = bp_reg_8[31:24];
+end
+
+always @ (*) begin
+	dag_1000_entry_638[31:0] = dag_1000_entry_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_638_reg[31:0] = dag_1000_entry_617_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_639[63:0] = (dag_1000_entry_603 | dag_1000_entry_632_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_639_reg[63:0] = bp_reg_8[161:98];
+end
+
+always @ (*) begin
+	dag_1000_entry_641[15:0] = dag_1000_entry_or_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_641_reg[15:0] = bp_reg_0[47:32];
+end
+
+always @ (*) begin
+	dag_1000_entry_644[63:0] = (dag_1000_entry_639 + dag_1000_entry_632_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_644_reg[63:0] = bp_reg_8[225:162];
+end
+
+always @ (*) begin
+	dag_1000_entry_645[7:0] = dag_1000_entry_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_645_reg[7:0] = bp_reg_8[359:352];
+end
+
+always @ (*) begin
+	dag_1000_entry_646[63:0] = (dag_1000_entry_644_reg + dag_1000_entry_637_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_646_reg[63:0] = bp_reg_8[73:10];
+end
+
+always @ (*) begin
+	dag_1000_entry_648[7:0] = dag_1000_entry_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_648_reg[7:0] = bp_reg_7[40:33];
+end
+
+always @ (*) begin
+	dag_1000_entry_649[15:0] = dag_1000_entry_add_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_42)) begin
+		bp_reg_30[15:0] <= dag_1000_entry_649[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_649_reg[15:0] = bp_reg_30[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_650[7:0] = dag_1000_entry_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_650_reg[7:0] = bp_reg_4[270:263];
+end
+
+always @ (*) begin
+	dag_1000_entry_651[7:0] = dag_1000_entry_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_651_reg[7:0] = bp_reg_8[367:360];
+end
+
+always @ (*) begin
+	dag_1000_entry_652[15:0] = (dag_1000_entry_649 ^ dag_1000_entry_618);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_42)) begin
+		bp_reg_31[15:0] <= dag_1000_entry_652[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_48)) begin
+		bp_reg_31[15:0] <= dag_1000_entry_861[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_652_reg[15:0] = bp_reg_31[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_653[31:0] = dag_1000_entry_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_653_reg[31:0] = dag_1000_entry_362_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_654[15:0] = (dag_1000_entry_652 - dag_1000_entry_622);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_42)) begin
+		bp_reg_32[15:0] <= dag_1000_entry_654[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_48)) begin
+		bp_reg_32[15:0] <= dag_1000_entry_878[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_654_reg[15:0] = bp_reg_32[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_655[31:0] = (dag_1000_entry_627 - dag_1000_entry_635_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_46)) begin
+		dag_1000_entry_655_reg[31:0] <= dag_1000_entry_655[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_656[7:0] = dag_1000_entry_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_656_reg[7:0] = bp_reg_7[48:41];
+end
+
+always @ (*) begin
+	dag_1000_entry_657[15:0] = dag_1000_entry_mul_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_42)) begin
+		bp_reg_33[15:0] <= dag_1000_entry_657[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_48)) begin
+		bp_reg_33[15:0] <= dag_1000_entry_899[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_657_reg[15:0] = bp_reg_33[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_658[15:0] = (dag_1000_entry_654 - dag_1000_entry_657);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_42)) begin
+		bp_reg_18[15:0] <= dag_1000_entry_658[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_42)) begin
+		bp_reg_18[31:16] <= dag_1000_entry_661[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_44)) begin
+		bp_reg_18[15:0] <= dag_1000_entry_698[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_42)) begin
+		bp_reg_18[39:32] <= dag_1000_entry_902[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_42)) begin
+		bp_reg_18[47:40] <= dag_1000_entry_931[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_65)) begin
+		bp_reg_18[29:14] <= dag_1000_entry_932[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_42)) begin
+		bp_reg_18[55:48] <= dag_1000_entry_936[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_42)) begin
+		bp_reg_18[63:56] <= dag_1000_entry_945[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_66)) begin
+		bp_reg_18[77:62] <= dag_1000_entry_955[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_65)) begin
+		bp_reg_18[61:30] <= dag_1000_entry_956[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_67)) begin
+		bp_reg_18[77:62] <= dag_1000_entry_1006[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_658_reg[15:0] = bp_reg_18[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_659[15:0] = dag_1000_entry_or_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_659_reg[15:0] = bp_reg_8[241:226];
+end
+
+always @ (*) begin
+	dag_1000_entry_660[31:0] = dag_1000_entry_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_660_reg[31:0] = dag_1000_entry_363_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_661[15:0] = (dag_1000_entry_649 ^ dag_1000_entry_652);
+end
+
+always @ (*) begin
+	dag_1000_entry_661_reg[15:0] = bp_reg_18[31:16];
+end
+
+always @ (*) begin
+	dag_1000_entry_662[31:0] = dag_1000_entry_or_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_662_reg[31:0] = dag_1000_entry_90_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_663[63:0] = (dag_1000_entry_632 ^ dag_1000_entry_632);
+end
+
+always @ (*) begin
+	dag_1000_entry_663_reg[63:0] = bp_reg_8[431:368];
+end
+
+always @ (*) begin
+	dag_1000_entry_664[63:0] = (dag_1000_entry_646_reg * dag_1000_entry_629_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_664_reg = bp_reg_8[136:136];
+end
+
+always @ (*) begin
+	dag_1000_entry_665[15:0] = dag_1000_entry_and_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_665_reg[15:0] = bp_reg_8[257:242];
+end
+
+always @ (*) begin
+	dag_1000_entry_666[7:0] = dag_1000_entry_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_666_reg[7:0] = bp_reg_8[439:432];
+end
+
+always @ (*) begin
+	dag_1000_entry_668[7:0] = dag_1000_entry_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_668_reg[7:0] = bp_reg_4[278:271];
+end
+
+always @ (*) begin
+	dag_1000_entry_669[63:0] = dag_1000_entry_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_669_reg = bp_reg_7[49:49];
+end
+
+always @ (*) begin
+	dag_1000_entry_670[31:0] = (dag_1000_entry_628 - dag_1000_entry_660);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_46)) begin
+		dag_1000_entry_670_reg[31:0] <= dag_1000_entry_670[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_671[63:0] = (dag_1000_entry_646 + dag_1000_entry_644_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_671_reg[63:0] = bp_reg_8[137:74];
+end
+
+always @ (*) begin
+	dag_1000_entry_672[31:0] = dag_1000_entry_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_672_reg[31:0] = dag_1000_entry_363_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_673[15:0] = dag_1000_entry_add_16_16_1[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_673_reg[15:0] = bp_reg_8[273:258];
+end
+
+always @ (*) begin
+	dag_1000_entry_674[15:0] = dag_1000_entry_and_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_674_reg[15:0] = bp_reg_8[153:138];
+end
+
+always @ (*) begin
+	dag_1000_entry_675[7:0] = (dag_1000_entry_645 - dag_1000_entry_651);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_27)) begin
+		bp_reg_53[7:0] <= dag_1000_entry_675[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_675_reg[7:0] = bp_reg_53[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_678[15:0] = dag_1000_entry_or_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_678_reg[15:0] = dag_1000_entry_322_reg[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_679[7:0] = (dag_1000_entry_656_reg - dag_1000_entry_650);
+end
+
+always @ (*) begin
+	dag_1000_entry_679_reg[7:0] = bp_reg_5[111:104];
+end
+
+always @ (*) begin
+	dag_1000_entry_680[15:0] = dag_1000_entry_mul_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_680_reg[15:0] = bp_reg_8[289:274];
+end
+
+always @ (*) begin
+	dag_1000_entry_681[15:0] = (dag_1000_entry_678 - dag_1000_entry_659_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_44)) begin
+		dag_1000_entry_681_reg[15:0] <= dag_1000_entry_681[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_682[7:0] = (dag_1000_entry_675_reg ^ dag_1000_entry_668);
+end
+
+always @ (*) begin
+	dag_1000_entry_682_reg[7:0] = bp_reg_5[135:128];
+end
+
+always @ (*) begin
+	dag_1000_entry_683[63:0] = (dag_1000_entry_669_reg ^ dag_1000_entry_664_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_683_reg = bp_reg_8[95:95];
+end
+
+always @ (*) begin
+	dag_1000_entry_684[63:0] = (dag_1000_entry_683 + dag_1000_entry_644_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_46)) begin
+		dag_1000_entry_684_reg[63:0] <= dag_1000_entry_684[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_685[31:0] = dag_1000_entry_or_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_685_reg[31:0] = dag_1000_entry_511_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_686[63:0] = (dag_1000_entry_684 & dag_1000_entry_663_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_46)) begin
+		dag_1000_entry_686_reg[63:0] <= dag_1000_entry_686[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_687[7:0] = (dag_1000_entry_650 ^ dag_1000_entry_650);
+end
+
+always @ (*) begin
+	dag_1000_entry_687_reg[7:0] = bp_reg_6[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_688[7:0] = dag_1000_entry_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_688_reg[7:0] = bp_reg_6[48:41];
+end
+
+always @ (*) begin
+	dag_1000_entry_689[31:0] = (dag_1000_entry_685 - dag_1000_entry_662_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_689_reg[31:0] = bp_reg_3[158:127];
+end
+
+always @ (*) begin
+	dag_1000_entry_690[7:0] = dag_1000_entry_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_690_reg[7:0] = bp_reg_6[16:9];
+end
+
+always @ (*) begin
+	dag_1000_entry_691[15:0] = dag_1000_entry_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_691_reg[15:0] = bp_reg_8[281:266];
+end
+
+always @ (*) begin
+	dag_1000_entry_692[15:0] = (dag_1000_entry_665_reg ^ dag_1000_entry_678);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_44)) begin
+		dag_1000_entry_692_reg[15:0] <= dag_1000_entry_692[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_694[63:0] = (dag_1000_entry_646 + dag_1000_entry_675_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_44)) begin
+		dag_1000_entry_694_reg[63:0] <= dag_1000_entry_694[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_695[63:0] = (dag_1000_entry_694 & dag_1000_entry_694);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_44)) begin
+		dag_1000_entry_695_reg[63:0] <= dag_1000_entry_695[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_696[7:0] = (dag_1000_entry_666_reg - dag_1000_entry_687);
+end
+
+always @ (*) begin
+	dag_1000_entry_696_reg[7:0] = bp_reg_7[40:33];
+end
+
+always @ (*) begin
+	dag_1000_entry_697[31:0] = (dag_1000_entry_672 ^ dag_1000_entry_670_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_48)) begin
+		dag_1000_entry_697_reg[31:0] <= dag_1000_entry_697[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_698[15:0] = dag_1000_entry_add_16_16_1[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_698_reg[15:0] = bp_reg_18[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_699[63:0] = (dag_1000_entry_686_reg + dag_1000_entry_672);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_48)) begin
+		dag_1000_entry_699_reg[63:0] <= dag_1000_entry_699[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_701[7:0] = dag_1000_entry_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_701_reg[7:0] = bp_reg_7[48:41];
+end
+
+always @ (*) begin
+	dag_1000_entry_702[7:0] = (dag_1000_entry_690 ^ dag_1000_entry_701);
+end
+
+always @ (*) begin
+	dag_1000_entry_702_reg[7:0] = bp_reg_7[57:50];
+end
+
+always @ (*) begin
+	dag_1000_entry_703[63:0] = (dag_1000_entry_684 - dag_1000_entry_695_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_46)) begin
+		dag_1000_entry_703_reg[63:0] <= dag_1000_entry_703[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_704[7:0] = (dag_1000_entry_702 ^ dag_1000_entry_682);
+end
+
+always @ (*) begin
+	dag_1000_entry_704_reg[7:0] = bp_reg_7[65:58];
+end
+
+always @ (*) begin
+	dag_1000_entry_705[63:0] = (dag_1000_entry_671 + dag_1000_entry_671);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_44)) begin
+		dag_1000_entry_705_reg[63:0] <= dag_1000_entry_705[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_706[63:0] = (dag_1000_entry_684 - dag_1000_entry_705_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_46)) begin
+		dag_1000_entry_706_reg[63:0] <= dag_1000_entry_706[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_707[31:0] = (dag_1000_entry_662 - dag_1000_entry_670_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_47)) begin
+		dag_1000_entry_707_reg[31:0] <= dag_1000_entry_707[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_709[63:0] = (dag_1000_entry_699 & dag_1000_entry_695_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_48)) begin
+		dag_1000_entry_709_reg[63:0] <= dag_1000_entry_709[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_711[7:0] = dag_1000_entry_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_711_reg[7:0] = bp_reg_7[40:33];
+end
+
+always @ (*) begin
+	dag_1000_entry_712[15:0] = dag_1000_entry_mul_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_44)) begin
+		bp_reg_9[15:0] <= dag_1000_entry_712[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_44)) begin
+		bp_reg_9[79:16] <= dag_1000_entry_713[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_44)) begin
+		bp_reg_9[95:80] <= dag_1000_entry_715[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_46)) begin
+		bp_reg_9[109:46] <= dag_1000_entry_716[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_44)) begin
+		bp_reg_9[111:96] <= dag_1000_entry_742[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_46)) begin
+		bp_reg_9[125:110] <= dag_1000_entry_750[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_49)) begin
+		bp_reg_9[92:85] <= dag_1000_entry_754[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_49)) begin
+		bp_reg_9[124:93] <= dag_1000_entry_757[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_46)) begin
+		bp_reg_9[141:126] <= dag_1000_entry_764[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_47)) begin
+		bp_reg_9[20:5] <= dag_1000_entry_859[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_47)) begin
+		bp_reg_9[28:21] <= dag_1000_entry_960[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_44)) begin
+		bp_reg_9[119:112] <= dag_1000_entry_968[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_47)) begin
+		bp_reg_9[36:29] <= dag_1000_entry_980[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_44)) begin
+		bp_reg_9[127:120] <= dag_1000_entry_1000[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_712_reg[15:0] = bp_reg_9[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_713[63:0] = (dag_1000_entry_695 + dag_1000_entry_695);
+end
+
+always @ (*) begin
+	dag_1000_entry_713_reg[63:0] = bp_reg_9[79:16];
+end
+
+always @ (*) begin
+	dag_1000_entry_714[7:0] = dag_1000_entry_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_714_reg[7:0] = bp_reg_6[56:49];
+end
+
+always @ (*) begin
+	dag_1000_entry_715[15:0] = (dag_1000_entry_691 ^ dag_1000_entry_681);
+end
+
+always @ (*) begin
+	dag_1000_entry_715_reg[15:0] = bp_reg_9[95:80];
+end
+
+always @ (*) begin
+	dag_1000_entry_716[63:0] = (dag_1000_entry_706 + dag_1000_entry_713_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_716_reg[63:0] = bp_reg_9[109:46];
+end
+
+always @ (*) begin
+	dag_1000_entry_717[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_717_reg[31:0] = dag_1000_entry_628_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_718[7:0] = dag_1000_entry_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_718_reg[7:0] = bp_reg_7[40:33];
+end
+
+always @ (*) begin
+	dag_1000_entry_719[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_719_reg[31:0] = bp_reg_8[214:183];
+end
+
+always @ (*) begin
+	dag_1000_entry_720[31:0] = dag_1000_entry_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_720_reg[31:0] = dag_1000_entry_362_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_721[63:0] = (dag_1000_entry_699 & dag_1000_entry_705_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_48)) begin
+		dag_1000_entry_721_reg[63:0] <= dag_1000_entry_721[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_722[63:0] = (dag_1000_entry_703_reg + dag_1000_entry_719_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_49)) begin
+		dag_1000_entry_722_reg[63:0] <= dag_1000_entry_722[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_723[63:0] = (dag_1000_entry_716_reg - dag_1000_entry_722);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_49)) begin
+		dag_1000_entry_723_reg[63:0] <= dag_1000_entry_723[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_724[63:0] = (dag_1000_entry_709_reg ^ dag_1000_entry_709_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_49)) begin
+		dag_1000_entry_724_reg[63:0] <= dag_1000_entry_724[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_725[7:0] = dag_1000_entry_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_725_reg[7:0] = bp_reg_7[48:41];
+end
+
+always @ (*) begin
+	dag_1000_entry_726[7:0] = dag_1000_entry_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_726_reg[7:0] = bp_reg_6[48:41];
+end
+
+always @ (*) begin
+	dag_1000_entry_727[31:0] = dag_1000_entry_mul_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_54)) begin
+		dag_1000_entry_727_reg[31:0] <= dag_1000_entry_727[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_51)) begin
+		dag_1000_entry_727_reg[31:0] <= dag_1000_entry_776[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_728[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_728_reg[31:0] = bp_reg_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_729[15:0] = dag_1000_entry_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_729_reg[15:0] = bp_reg_8[152:137];
+end
+
+always @ (*) begin
+	dag_1000_entry_730[31:0] = (dag_1000_entry_720 - dag_1000_entry_689_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_49)) begin
+		dag_1000_entry_730_reg[31:0] <= dag_1000_entry_730[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_731[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_731_reg[31:0] = bp_reg_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_732[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_732_reg[31:0] = dag_1000_entry_113_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_733[7:0] = dag_1000_entry_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_733_reg[7:0] = bp_reg_7[57:50];
+end
+
+always @ (*) begin
+	dag_1000_entry_736[7:0] = dag_1000_entry_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_736_reg[7:0] = bp_reg_7[73:66];
+end
+
+always @ (*) begin
+	dag_1000_entry_737[15:0] = dag_1000_entry_or_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_737_reg[15:0] = dag_1000_entry_322_reg[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_738[63:0] = (dag_1000_entry_721_reg ^ dag_1000_entry_722);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_49)) begin
+		dag_1000_entry_738_reg[63:0] <= dag_1000_entry_738[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_739[7:0] = dag_1000_entry_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_739_reg[7:0] = bp_reg_6[56:49];
+end
+
+always @ (*) begin
+	dag_1000_entry_740[7:0] = dag_1000_entry_add_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_30)) begin
+		dag_1000_entry_740_reg[7:0] <= dag_1000_entry_740[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_741[7:0] = dag_1000_entry_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_741_reg[7:0] = bp_reg_7[40:33];
+end
+
+always @ (*) begin
+	dag_1000_entry_742[15:0] = (dag_1000_entry_715 ^ dag_1000_entry_712);
+end
+
+always @ (*) begin
+	dag_1000_entry_742_reg[15:0] = bp_reg_9[111:96];
+end
+
+always @ (*) begin
+	dag_1000_entry_744[15:0] = dag_1000_entry_add_16_16_1[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_744_reg[15:0] = dag_1000_entry_249_reg[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_745[7:0] = (dag_1000_entry_736 ^ dag_1000_entry_740);
+end
+
+always @ (*) begin
+	dag_1000_entry_745_reg[7:0] = bp_reg_51[9:2];
+end
+
+always @ (*) begin
+	dag_1000_entry_747[63:0] = (dag_1000_entry_723 - dag_1000_entry_738);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_49)) begin
+		dag_1000_entry_747_reg[63:0] <= dag_1000_entry_747[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_748[15:0] = dag_1000_entry_mul_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_748_reg[15:0] = dag_1000_entry_284_reg[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_749[63:0] = (dag_1000_entry_722 ^ dag_1000_entry_722);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_49)) begin
+		dag_1000_entry_749_reg[63:0] <= dag_1000_entry_749[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_750[15:0] = dag_1000_entry_mul_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_750_reg[15:0] = bp_reg_9[125:110];
+end
+
+always @ (*) begin
+	dag_1000_entry_751[63:0] = (dag_1000_entry_723 + dag_1000_entry_749);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_49)) begin
+		dag_1000_entry_751_reg[63:0] <= dag_1000_entry_751[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_752[7:0] = (dag_1000_entry_736_reg ^ dag_1000_entry_741);
+end
+
+always @ (*) begin
+	dag_1000_entry_752_reg[7:0] = bp_reg_7[48:41];
+end
+
+always @ (*) begin
+	dag_1000_entry_753[63:0] = (dag_1000_entry_724 & dag_1000_entry_747);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_49)) begin
+		dag_1000_entry_753_reg[63:0] <= dag_1000_entry_753[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_754[63:0] = (dag_1000_entry_747 & dag_1000_entry_740_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_754_reg[7:0] = bp_reg_9[92:85];
+end
+
+always @ (*) begin
+	dag_1000_entry_755[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_755_reg[31:0] = dag_1000_entry_113_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_756[15:0] = (dag_1000_entry_744 ^ dag_1000_entry_729);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_45)) begin
+		dag_1000_entry_756_reg[15:0] <= dag_1000_entry_756[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_757[31:0] = (dag_1000_entry_730 ^ dag_1000_entry_730);
+end
+
+always @ (*) begin
+	dag_1000_entry_757_reg[31:0] = bp_reg_9[124:93];
+end
+
+always @ (*) begin
+	dag_1000_entry_758[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_51)) begin
+		dag_1000_entry_758_reg[31:0] <= dag_1000_entry_758[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_760[7:0] = dag_1000_entry_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_760_reg[7:0] = bp_reg_14[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_761[63:0] = (dag_1000_entry_753 & dag_1000_entry_738);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_49)) begin
+		dag_1000_entry_761_reg[63:0] <= dag_1000_entry_761[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_762[31:0] = dag_1000_entry_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_762_reg[31:0] = dag_1000_entry_364_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_763[7:0] = (dag_1000_entry_736_reg - dag_1000_entry_760);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_33)) begin
+		bp_reg_54[7:0] <= dag_1000_entry_763[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_763_reg[7:0] = bp_reg_54[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_764[15:0] = dag_1000_entry_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_764_reg[15:0] = bp_reg_9[141:126];
+end
+
+always @ (*) begin
+	dag_1000_entry_765[63:0] = (dag_1000_entry_751 & dag_1000_entry_747);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_49)) begin
+		bp_reg_10[126:63] <= dag_1000_entry_765[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_49)) begin
+		bp_reg_10[158:127] <= dag_1000_entry_771[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_49)) begin
+		bp_reg_10[190:159] <= dag_1000_entry_777[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_46)) begin
+		bp_reg_10[15:0] <= dag_1000_entry_783[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_49)) begin
+		bp_reg_10[198:191] <= dag_1000_entry_785[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_49)) begin
+		bp_reg_10[262:199] <= dag_1000_entry_786[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_46)) begin
+		bp_reg_10[31:16] <= dag_1000_entry_795[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_46)) begin
+		bp_reg_10[47:32] <= dag_1000_entry_802[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_50)) begin
+		bp_reg_10[70:7] <= dag_1000_entry_812[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_49)) begin
+		bp_reg_10[270:263] <= dag_1000_entry_817[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_50)) begin
+		bp_reg_10[262:199] <= dag_1000_entry_820[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_50)) begin
+		bp_reg_10[326:263] <= dag_1000_entry_835[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_54)) begin
+		bp_reg_10[93:30] <= dag_1000_entry_892[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_62)) begin
+		bp_reg_10[85:22] <= dag_1000_entry_962[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_62)) begin
+		bp_reg_10[149:86] <= dag_1000_entry_964[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_62)) begin
+		bp_reg_10[213:150] <= dag_1000_entry_969[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_62)) begin
+		bp_reg_10[277:214] <= dag_1000_entry_976[63:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_62)) begin
+		bp_reg_10[341:278] <= dag_1000_entry_978[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_765_reg[63:0] = bp_reg_10[126:63];
+end
+
+always @ (*) begin
+	dag_1000_entry_766[31:0] = dag_1000_entry_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_766_reg[31:0] = bp_reg_0[79:48];
+end
+
+always @ (*) begin
+	dag_1000_entry_768[63:0] = (dag_1000_entry_754_reg + dag_1000_entry_749_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_50)) begin
+		dag_1000_entry_768_reg[63:0] <= dag_1000_entry_768[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_769[15:0] = dag_1000_entry_add_16_16_1[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_46)) begin
+		bp_reg_34[15:0] <= dag_1000_entry_769[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_52)) begin
+		bp_reg_34[14:7] <= dag_1000_entry_982[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_769_reg[15:0] = bp_reg_34[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_770[15:0] = dag_1000_entry_and_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_770_reg[15:0] = dag_1000_entry_247_reg[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_771[31:0] = (dag_1000_entry_757 ^ dag_1000_entry_745_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_771_reg[31:0] = bp_reg_10[158:127];
+end
+
+always @ (*) begin
+	dag_1000_entry_772[7:0] = dag_1000_entry_mul_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_33)) begin
+		bp_reg_55[7:0] <= dag_1000_entry_772[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_772_reg[7:0] = bp_reg_55[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_773[7:0] = dag_1000_entry_and_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_33)) begin
+		bp_reg_56[7:0] <= dag_1000_entry_773[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_773_reg[7:0] = bp_reg_56[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_774[31:0] = dag_1000_entry_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_774_reg[31:0] = dag_1000_entry_617_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_775[31:0] = (dag_1000_entry_766 ^ dag_1000_entry_774_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_775_reg[31:0] = bp_reg_1[63:32];
+end
+
+always @ (*) begin
+	dag_1000_entry_776[31:0] = dag_1000_entry_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_776_reg[31:0] = dag_1000_entry_727_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_777[31:0] = dag_1000_entry_or_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_777_reg[31:0] = bp_reg_10[190:159];
+end
+
+always @ (*) begin
+	dag_1000_entry_778[7:0] = dag_1000_entry_mul_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_34)) begin
+		bp_reg_57[7:0] <= dag_1000_entry_778[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_778_reg[7:0] = bp_reg_57[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_779[7:0] = dag_1000_entry_add_8_8_1[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_36)) begin
+		bp_reg_58[7:0] <= dag_1000_entry_779[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_779_reg[7:0] = bp_reg_58[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_780[63:0] = (dag_1000_entry_761_reg + dag_1000_entry_761_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_50)) begin
+		dag_1000_entry_780_reg[63:0] <= dag_1000_entry_780[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_781[15:0] = dag_1000_entry_and_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_781_reg[15:0] = dag_1000_entry_247_reg[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_782[7:0] = dag_1000_entry_mul_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_35)) begin
+		bp_reg_59[7:0] <= dag_1000_entry_782[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_782_reg[7:0] = bp_reg_59[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_783[15:0] = (dag_1000_entry_769 ^ dag_1000_entry_764);
+end
+
+always @ (*) begin
+	dag_1000_entry_783_reg[15:0] = bp_reg_10[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_785[7:0] = dag_1000_entry_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_785_reg[7:0] = bp_reg_10[198:191];
+end
+
+always @ (*) begin
+	dag_1000_entry_786[63:0] = (dag_1000_entry_765 | dag_1000_entry_753);
+end
+
+always @ (*) begin
+	dag_1000_entry_786_reg[63:0] = bp_reg_10[262:199];
+end
+
+always @ (*) begin
+	dag_1000_entry_787[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_52)) begin
+		dag_1000_entry_787_reg[31:0] <= dag_1000_entry_787[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_59)) begin
+		dag_1000_entry_787_reg[31:0] <= dag_1000_entry_831[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_60)) begin
+		dag_1000_entry_787_reg[31:0] <= dag_1000_entry_840[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_68)) begin
+		dag_1000_entry_787_reg[31:0] <= dag_1000_entry_884[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_63)) begin
+		dag_1000_entry_787_reg[31:0] <= dag_1000_entry_896[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_70)) begin
+		dag_1000_entry_787_reg[31:0] <= dag_1000_entry_999[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_788[63:0] = (dag_1000_entry_768 - dag_1000_entry_780);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_50)) begin
+		dag_1000_entry_788_reg[63:0] <= dag_1000_entry_788[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_789[31:0] = dag_1000_entry_and_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_50)) begin
+		dag_1000_entry_789_reg[31:0] <= dag_1000_entry_789[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_59)) begin
+		dag_1000_entry_789_reg[31:0] <= dag_1000_entry_838[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_70)) begin
+		dag_1000_entry_789_reg[31:0] <= dag_1000_entry_984[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_790[31:0] = dag_1000_entry_or_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_52)) begin
+		dag_1000_entry_790_reg[31:0] <= dag_1000_entry_790[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_791[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_791_reg[31:0] = dag_1000_entry_113_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_792[63:0] = (dag_1000_entry_780 | dag_1000_entry_786_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_50)) begin
+		dag_1000_entry_792_reg[63:0] <= dag_1000_entry_792[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_793[7:0] = dag_1000_entry_mul_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_36)) begin
+		bp_reg_60[7:0] <= dag_1000_entry_793[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_793_reg[7:0] = bp_reg_60[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_794[15:0] = (dag_1000_entry_764 ^ dag_1000_entry_770_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_46)) begin
+		bp_reg_35[15:0] <= dag_1000_entry_794[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_794_reg[15:0] = bp_reg_35[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_795[15:0] = dag_1000_entry_or_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_795_reg[15:0] = bp_reg_10[31:16];
+end
+
+always @ (*) begin
+	dag_1000_entry_796[31:0] = (dag_1000_entry_777_reg ^ dag_1000_entry_774);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_55)) begin
+		dag_1000_entry_796_reg[31:0] <= dag_1000_entry_796[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_797[63:0] = (dag_1000_entry_780 | dag_1000_entry_768);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_50)) begin
+		dag_1000_entry_797_reg[63:0] <= dag_1000_entry_797[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_798[63:0] = (dag_1000_entry_797 | dag_1000_entry_792);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_50)) begin
+		dag_1000_entry_798_reg[63:0] <= dag_1000_entry_798[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_799[7:0] = dag_1000_entry_or_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_37)) begin
+		bp_reg_61[7:0] <= dag_1000_entry_799[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_40)) begin
+		bp_reg_61[7:0] <= dag_1000_entry_854[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_799_reg[7:0] = bp_reg_61[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_800[63:0] = (dag_1000_entry_798 | dag_1000_entry_768);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_50)) begin
+		dag_1000_entry_800_reg[63:0] <= dag_1000_entry_800[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_802[15:0] = dag_1000_entry_and_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_802_reg[15:0] = bp_reg_10[47:32];
+end
+
+always @ (*) begin
+	dag_1000_entry_803[31:0] = dag_1000_entry_and_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_56)) begin
+		dag_1000_entry_803_reg[31:0] <= dag_1000_entry_803[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_53)) begin
+		dag_1000_entry_803_reg[31:0] <= dag_1000_entry_813[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_60)) begin
+		dag_1000_entry_803_reg[31:0] <= dag_1000_entry_868[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_804[31:0] = (dag_1000_entry_790 ^ dag_1000_entry_777_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_52)) begin
+		dag_1000_entry_804_reg[31:0] <= dag_1000_entry_804[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_805[31:0] = dag_1000_entry_and_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_57)) begin
+		dag_1000_entry_805_reg[31:0] <= dag_1000_entry_805[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_806[15:0] = (dag_1000_entry_769_reg ^ dag_1000_entry_781);
+end
+
+always @ (*) begin
+	dag_1000_entry_806_reg[15:0] = bp_reg_8[31:16];
+end
+
+always @ (*) begin
+	dag_1000_entry_807[63:0] = (dag_1000_entry_780 + dag_1000_entry_792);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_50)) begin
+		dag_1000_entry_807_reg[63:0] <= dag_1000_entry_807[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_808[7:0] = dag_1000_entry_add_8_8_1[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_37)) begin
+		bp_reg_62[7:0] <= dag_1000_entry_808[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_40)) begin
+		bp_reg_62[7:0] <= dag_1000_entry_862[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_808_reg[7:0] = bp_reg_62[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_809[15:0] = dag_1000_entry_mul_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_809_reg[15:0] = dag_1000_entry_284_reg[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_810[15:0] = (dag_1000_entry_795_reg ^ dag_1000_entry_809);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_47)) begin
+		dag_1000_entry_810_reg[15:0] <= dag_1000_entry_810[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_811[7:0] = dag_1000_entry_or_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_36)) begin
+		bp_reg_63[7:0] <= dag_1000_entry_811[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_811_reg[7:0] = bp_reg_63[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_812[63:0] = (dag_1000_entry_788 ^ dag_1000_entry_807);
+end
+
+always @ (*) begin
+	dag_1000_entry_812_reg[63:0] = bp_reg_10[70:7];
+end
+
+always @ (*) begin
+	dag_1000_entry_813[31:0] = dag_1000_entry_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_813_reg[31:0] = dag_1000_entry_803_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_814[63:0] = (dag_1000_entry_788 - dag_1000_entry_800);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_50)) begin
+		dag_1000_entry_814_reg[63:0] <= dag_1000_entry_814[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_815[31:0] = dag_1000_entry_mul_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_53)) begin
+		dag_1000_entry_815_reg[31:0] <= dag_1000_entry_815[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_69)) begin
+		dag_1000_entry_815_reg[31:0] <= dag_1000_entry_965[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_816[7:0] = dag_1000_entry_add_8_8_1[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_35)) begin
+		bp_reg_64[7:0] <= dag_1000_entry_816[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_816_reg[7:0] = bp_reg_64[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_817[7:0] = (dag_1000_entry_816_reg ^ dag_1000_entry_785);
+end
+
+always @ (*) begin
+	dag_1000_entry_817_reg[7:0] = bp_reg_10[270:263];
+end
+
+always @ (*) begin
+	dag_1000_entry_818[31:0] = dag_1000_entry_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_818_reg[31:0] = dag_1000_entry_362_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_819[63:0] = (dag_1000_entry_792_reg * dag_1000_entry_797_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_51)) begin
+		dag_1000_entry_819_reg[63:0] <= dag_1000_entry_819[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_820[63:0] = (dag_1000_entry_798 + dag_1000_entry_802_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_820_reg[63:0] = bp_reg_10[262:199];
+end
+
+always @ (*) begin
+	dag_1000_entry_821[7:0] = dag_1000_entry_add_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_37)) begin
+		bp_reg_65[7:0] <= dag_1000_entry_821[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_821_reg[7:0] = bp_reg_65[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_822[7:0] = dag_1000_entry_add_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_35)) begin
+		bp_reg_66[7:0] <= dag_1000_entry_822[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_822_reg[7:0] = bp_reg_66[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_823[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_823_reg[31:0] = dag_1000_entry_113_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_824[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_824_reg[31:0] = dag_1000_entry_113_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_825[63:0] = (dag_1000_entry_819_reg ^ dag_1000_entry_822_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_52)) begin
+		dag_1000_entry_825_reg[63:0] <= dag_1000_entry_825[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_827[15:0] = (dag_1000_entry_806 - dag_1000_entry_794_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_827_reg[15:0] = bp_reg_8[166:151];
+end
+
+always @ (*) begin
+	dag_1000_entry_828[15:0] = (dag_1000_entry_810 ^ dag_1000_entry_794_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_828_reg[15:0] = bp_reg_8[182:167];
+end
+
+always @ (*) begin
+	dag_1000_entry_829[15:0] = (dag_1000_entry_802_reg - dag_1000_entry_827);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_47)) begin
+		dag_1000_entry_829_reg[15:0] <= dag_1000_entry_829[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_830[63:0] = (dag_1000_entry_825 & dag_1000_entry_812_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_52)) begin
+		dag_1000_entry_830_reg[63:0] <= dag_1000_entry_830[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_831[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_831_reg[31:0] = dag_1000_entry_787_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_832[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_57)) begin
+		dag_1000_entry_832_reg[31:0] <= dag_1000_entry_832[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_64)) begin
+		dag_1000_entry_832_reg[31:0] <= dag_1000_entry_915[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_833[31:0] = dag_1000_entry_or_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_833_reg[31:0] = dag_1000_entry_511_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_834[7:0] = dag_1000_entry_and_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_37)) begin
+		bp_reg_67[7:0] <= dag_1000_entry_834[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_40)) begin
+		bp_reg_67[7:0] <= dag_1000_entry_873[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_834_reg[7:0] = bp_reg_67[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_835[63:0] = (dag_1000_entry_820 + dag_1000_entry_814);
+end
+
+always @ (*) begin
+	dag_1000_entry_835_reg[63:0] = bp_reg_10[326:263];
+end
+
+always @ (*) begin
+	dag_1000_entry_836[7:0] = dag_1000_entry_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_836_reg[7:0] = bp_reg_16[39:32];
+end
+
+always @ (*) begin
+	dag_1000_entry_837[15:0] = (dag_1000_entry_828 ^ dag_1000_entry_827);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_47)) begin
+		dag_1000_entry_837_reg[15:0] <= dag_1000_entry_837[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_838[31:0] = dag_1000_entry_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_838_reg[31:0] = dag_1000_entry_789_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_839[7:0] = dag_1000_entry_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_839_reg[7:0] = bp_reg_16[47:40];
+end
+
+always @ (*) begin
+	dag_1000_entry_840[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_840_reg[31:0] = dag_1000_entry_787_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_841[31:0] = (dag_1000_entry_823_reg - dag_1000_entry_832);
+end
+
+always @ (*) begin
+	dag_1000_entry_841_reg[31:0] = bp_reg_8[413:382];
+end
+
+always @ (*) begin
+	dag_1000_entry_842[63:0] = (dag_1000_entry_814_reg + dag_1000_entry_835_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_51)) begin
+		dag_1000_entry_842_reg[63:0] <= dag_1000_entry_842[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_843[63:0] = (dag_1000_entry_830 + dag_1000_entry_835_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_52)) begin
+		dag_1000_entry_843_reg[63:0] <= dag_1000_entry_843[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_844[63:0] = (dag_1000_entry_835_reg * dag_1000_entry_825_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_53)) begin
+		dag_1000_entry_844_reg[63:0] <= dag_1000_entry_844[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_845[63:0] = (dag_1000_entry_835_reg & dag_1000_entry_835_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_51)) begin
+		dag_1000_entry_845_reg[63:0] <= dag_1000_entry_845[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_847[31:0] = (dag_1000_entry_833 ^ dag_1000_entry_823_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_57)) begin
+		dag_1000_entry_847_reg[31:0] <= dag_1000_entry_847[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_848[31:0] = (dag_1000_entry_847 ^ dag_1000_entry_841);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_57)) begin
+		dag_1000_entry_848_reg[31:0] <= dag_1000_entry_848[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_849[63:0] = (dag_1000_entry_835_reg + dag_1000_entry_845);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_51)) begin
+		dag_1000_entry_849_reg[63:0] <= dag_1000_entry_849[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_851[15:0] = (dag_1000_entry_837 ^ dag_1000_entry_827);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_47)) begin
+		dag_1000_entry_851_reg[15:0] <= dag_1000_entry_851[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_852[63:0] = (dag_1000_entry_849_reg * dag_1000_entry_849_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_52)) begin
+		dag_1000_entry_852_reg[63:0] <= dag_1000_entry_852[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_853[15:0] = dag_1000_entry_or_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_853_reg[15:0] = dag_1000_entry_322_reg[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_854[7:0] = dag_1000_entry_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_854_reg[7:0] = bp_reg_61[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_856[63:0] = (dag_1000_entry_845 & dag_1000_entry_842);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_51)) begin
+		dag_1000_entry_856_reg[63:0] <= dag_1000_entry_856[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_857[31:0] = (dag_1000_entry_832_reg ^ dag_1000_entry_840);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_60)) begin
+		dag_1000_entry_857_reg[31:0] <= dag_1000_entry_857[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_858[7:0] = dag_1000_entry_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_858_reg[7:0] = bp_reg_26[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_859[15:0] = dag_1000_entry_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_859_reg[15:0] = bp_reg_9[20:5];
+end
+
+always @ (*) begin
+	dag_1000_entry_860[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_860_reg[31:0] = dag_1000_entry_113_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_861[15:0] = dag_1000_entry_mul_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_861_reg[15:0] = bp_reg_31[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_862[7:0] = dag_1000_entry_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_862_reg[7:0] = bp_reg_62[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_863[63:0] = (dag_1000_entry_856_reg - dag_1000_entry_843);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_52)) begin
+		dag_1000_entry_863_reg[63:0] <= dag_1000_entry_863[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_864[7:0] = dag_1000_entry_and_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_39)) begin
+		bp_reg_68[7:0] <= dag_1000_entry_864[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_864_reg[7:0] = bp_reg_68[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_865[63:0] = (dag_1000_entry_852_reg + dag_1000_entry_844_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_54)) begin
+		dag_1000_entry_865_reg[63:0] <= dag_1000_entry_865[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_866[63:0] = (dag_1000_entry_852_reg & dag_1000_entry_865);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_54)) begin
+		dag_1000_entry_866_reg[63:0] <= dag_1000_entry_866[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_867[15:0] = dag_1000_entry_add_16_16_1[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_867_reg[15:0] = bp_reg_0[47:32];
+end
+
+always @ (*) begin
+	dag_1000_entry_868[31:0] = dag_1000_entry_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_868_reg[31:0] = dag_1000_entry_803_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_869[31:0] = (dag_1000_entry_840 - dag_1000_entry_857);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_60)) begin
+		dag_1000_entry_869_reg[31:0] <= dag_1000_entry_869[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_870[63:0] = (dag_1000_entry_865 + dag_1000_entry_852_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_54)) begin
+		dag_1000_entry_870_reg[63:0] <= dag_1000_entry_870[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_871[7:0] = dag_1000_entry_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_871_reg[7:0] = bp_reg_26[23:16];
+end
+
+always @ (*) begin
+	dag_1000_entry_872[63:0] = (dag_1000_entry_865 | dag_1000_entry_870);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_54)) begin
+		dag_1000_entry_872_reg[63:0] <= dag_1000_entry_872[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_873[7:0] = dag_1000_entry_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_873_reg[7:0] = bp_reg_67[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_874[31:0] = dag_1000_entry_or_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_874_reg[31:0] = dag_1000_entry_511_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_875[7:0] = dag_1000_entry_or_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_39)) begin
+		bp_reg_69[7:0] <= dag_1000_entry_875[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_875_reg[7:0] = bp_reg_69[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_876[63:0] = (dag_1000_entry_849_reg + dag_1000_entry_841);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_57)) begin
+		dag_1000_entry_876_reg[63:0] <= dag_1000_entry_876[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_877[63:0] = (dag_1000_entry_865 - dag_1000_entry_856_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_54)) begin
+		dag_1000_entry_877_reg[63:0] <= dag_1000_entry_877[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_878[15:0] = (dag_1000_entry_861 - dag_1000_entry_859_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_878_reg[15:0] = bp_reg_32[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_879[63:0] = (dag_1000_entry_876 + dag_1000_entry_866_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_57)) begin
+		dag_1000_entry_879_reg[63:0] <= dag_1000_entry_879[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_880[7:0] = dag_1000_entry_mul_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_39)) begin
+		bp_reg_70[7:0] <= dag_1000_entry_880[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_64)) begin
+		bp_reg_70[0:0] <= dag_1000_entry_927;
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_880_reg[7:0] = bp_reg_70[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_881[63:0] = (dag_1000_entry_863_reg * dag_1000_entry_877_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_55)) begin
+		dag_1000_entry_881_reg[63:0] <= dag_1000_entry_881[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_883[63:0] = (dag_1000_entry_877_reg - dag_1000_entry_879_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_58)) begin
+		dag_1000_entry_883_reg[63:0] <= dag_1000_entry_883[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_884[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_884_reg[31:0] = dag_1000_entry_787_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_885[15:0] = dag_1000_entry_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_885_reg[15:0] = dag_1000_entry_128_reg[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_886[31:0] = (dag_1000_entry_860 ^ dag_1000_entry_848_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_886_reg[31:0] = bp_reg_8[413:382];
+end
+
+always @ (*) begin
+	dag_1000_entry_889[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_889_reg[31:0] = dag_1000_entry_113_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_890[15:0] = dag_1000_entry_mul_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_49)) begin
+		bp_reg_36[15:0] <= dag_1000_entry_890[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_890_reg[15:0] = bp_reg_36[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_892[63:0] = (dag_1000_entry_872 - dag_1000_entry_866);
+end
+
+always @ (*) begin
+	dag_1000_entry_892_reg[63:0] = bp_reg_10[93:30];
+end
+
+always @ (*) begin
+	dag_1000_entry_894[7:0] = (dag_1000_entry_871 - dag_1000_entry_871);
+end
+
+always @ (*) begin
+	dag_1000_entry_894_reg = bp_reg_26[24:24];
+end
+
+always @ (*) begin
+	dag_1000_entry_895[63:0] = (dag_1000_entry_881_reg + dag_1000_entry_881_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_56)) begin
+		dag_1000_entry_895_reg[63:0] <= dag_1000_entry_895[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_896[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_896_reg[31:0] = dag_1000_entry_787_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_897[31:0] = dag_1000_entry_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_897_reg[31:0] = dag_1000_entry_362_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_898[7:0] = dag_1000_entry_mul_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_40)) begin
+		bp_reg_71[7:0] <= dag_1000_entry_898[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_898_reg[7:0] = bp_reg_71[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_899[15:0] = dag_1000_entry_or_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_899_reg[15:0] = bp_reg_33[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_900[7:0] = (dag_1000_entry_880 ^ dag_1000_entry_875);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_39)) begin
+		bp_reg_72[7:0] <= dag_1000_entry_900[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_900_reg[7:0] = bp_reg_72[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_901[7:0] = dag_1000_entry_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_901_reg[7:0] = bp_reg_17[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_902[7:0] = dag_1000_entry_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_902_reg[7:0] = bp_reg_18[39:32];
+end
+
+always @ (*) begin
+	dag_1000_entry_904[63:0] = (dag_1000_entry_877_reg | dag_1000_entry_879);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_57)) begin
+		dag_1000_entry_904_reg[63:0] <= dag_1000_entry_904[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_905[63:0] = (dag_1000_entry_883 ^ dag_1000_entry_895_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_58)) begin
+		dag_1000_entry_905_reg[63:0] <= dag_1000_entry_905[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_906[15:0] = dag_1000_entry_or_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_906_reg[15:0] = bp_reg_26[24:9];
+end
+
+always @ (*) begin
+	dag_1000_entry_907[63:0] = (dag_1000_entry_883 + dag_1000_entry_883);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_58)) begin
+		dag_1000_entry_907_reg[63:0] <= dag_1000_entry_907[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_908[63:0] = (dag_1000_entry_907_reg * dag_1000_entry_892_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_59)) begin
+		dag_1000_entry_908_reg[63:0] <= dag_1000_entry_908[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_909[31:0] = dag_1000_entry_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_909_reg[7:0] = bp_reg_8[389:382];
+end
+
+always @ (*) begin
+	dag_1000_entry_910[7:0] = dag_1000_entry_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_910_reg[7:0] = bp_reg_17[15:8];
+end
+
+always @ (*) begin
+	dag_1000_entry_911[15:0] = dag_1000_entry_or_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_911_reg[15:0] = dag_1000_entry_322_reg[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_912[63:0] = (dag_1000_entry_895_reg & dag_1000_entry_908_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_60)) begin
+		dag_1000_entry_912_reg[63:0] <= dag_1000_entry_912[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_913[7:0] = dag_1000_entry_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_913_reg[7:0] = bp_reg_17[23:16];
+end
+
+always @ (*) begin
+	dag_1000_entry_914[15:0] = dag_1000_entry_and_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_914_reg[15:0] = bp_reg_8[182:167];
+end
+
+always @ (*) begin
+	dag_1000_entry_915[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_915_reg[31:0] = dag_1000_entry_832_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_916[63:0] = (dag_1000_entry_905 ^ dag_1000_entry_904_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_58)) begin
+		dag_1000_entry_916_reg[63:0] <= dag_1000_entry_916[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_917[63:0] = (dag_1000_entry_895_reg ^ dag_1000_entry_908_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_60)) begin
+		dag_1000_entry_917_reg[63:0] <= dag_1000_entry_917[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_918[15:0] = dag_1000_entry_mul_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_918_reg[15:0] = dag_1000_entry_284_reg[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_920[63:0] = (dag_1000_entry_916 + dag_1000_entry_904_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_58)) begin
+		dag_1000_entry_920_reg[63:0] <= dag_1000_entry_920[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_921[63:0] = (dag_1000_entry_917 - dag_1000_entry_917);
+end
+
+always @ (*) begin
+	dag_1000_entry_921_reg = bp_reg_17[31:31];
+end
+
+always @ (*) begin
+	dag_1000_entry_922[7:0] = dag_1000_entry_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_922_reg[7:0] = bp_reg_8[421:414];
+end
+
+always @ (*) begin
+	dag_1000_entry_923[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_65)) begin
+		dag_1000_entry_923_reg[31:0] <= dag_1000_entry_923[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_924[63:0] = (dag_1000_entry_917_reg * dag_1000_entry_920_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_61)) begin
+		dag_1000_entry_924_reg[63:0] <= dag_1000_entry_924[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_925[63:0] = (dag_1000_entry_907_reg & dag_1000_entry_908_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_60)) begin
+		dag_1000_entry_925_reg[63:0] <= dag_1000_entry_925[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_926[63:0] = (dag_1000_entry_912 | dag_1000_entry_912);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_60)) begin
+		dag_1000_entry_926_reg[63:0] <= dag_1000_entry_926[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_927[31:0] = (dag_1000_entry_915 - dag_1000_entry_915);
+end
+
+always @ (*) begin
+	dag_1000_entry_927_reg = bp_reg_70[0:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_928[15:0] = dag_1000_entry_add_16_16_1[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_928_reg[15:0] = dag_1000_entry_249_reg[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_929[15:0] = dag_1000_entry_or_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_929_reg[15:0] = dag_1000_entry_322_reg[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_930[15:0] = dag_1000_entry_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_930_reg[15:0] = bp_reg_0[47:32];
+end
+
+always @ (*) begin
+	dag_1000_entry_931[7:0] = dag_1000_entry_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_931_reg[7:0] = bp_reg_18[47:40];
+end
+
+always @ (*) begin
+	dag_1000_entry_932[15:0] = dag_1000_entry_mul_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_932_reg[15:0] = bp_reg_18[29:14];
+end
+
+always @ (*) begin
+	dag_1000_entry_933[15:0] = dag_1000_entry_and_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_933_reg[15:0] = bp_reg_0[63:48];
+end
+
+always @ (*) begin
+	dag_1000_entry_935[31:0] = dag_1000_entry_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_935_reg = bp_reg_4[215:215];
+end
+
+always @ (*) begin
+	dag_1000_entry_936[7:0] = (dag_1000_entry_902 - dag_1000_entry_900_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_936_reg[7:0] = bp_reg_18[55:48];
+end
+
+always @ (*) begin
+	dag_1000_entry_937[15:0] = dag_1000_entry_mul_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_937_reg[15:0] = bp_reg_0[79:64];
+end
+
+always @ (*) begin
+	dag_1000_entry_938[7:0] = dag_1000_entry_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_938_reg[7:0] = bp_reg_8[297:290];
+end
+
+always @ (*) begin
+	dag_1000_entry_939[7:0] = dag_1000_entry_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_939_reg[7:0] = bp_reg_17[31:24];
+end
+
+always @ (*) begin
+	dag_1000_entry_942[7:0] = dag_1000_entry_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_942_reg[7:0] = bp_reg_8[305:298];
+end
+
+always @ (*) begin
+	dag_1000_entry_943[63:0] = (dag_1000_entry_925 + dag_1000_entry_917);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_60)) begin
+		dag_1000_entry_943_reg[63:0] <= dag_1000_entry_943[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_945[7:0] = dag_1000_entry_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_945_reg[7:0] = bp_reg_18[63:56];
+end
+
+always @ (*) begin
+	dag_1000_entry_947[63:0] = (dag_1000_entry_924_reg & dag_1000_entry_943_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_62)) begin
+		dag_1000_entry_947_reg[63:0] <= dag_1000_entry_947[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_948[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_66)) begin
+		dag_1000_entry_948_reg[31:0] <= dag_1000_entry_948[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_949[63:0] = (dag_1000_entry_926_reg ^ dag_1000_entry_947);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_62)) begin
+		dag_1000_entry_949_reg[63:0] <= dag_1000_entry_949[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_951[63:0] = (dag_1000_entry_947 + dag_1000_entry_926_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_62)) begin
+		dag_1000_entry_951_reg[63:0] <= dag_1000_entry_951[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_953[31:0] = dag_1000_entry_add_16_16_1[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_953_reg[8:0] = bp_reg_8[398:390];
+end
+
+always @ (*) begin
+	dag_1000_entry_954[63:0] = (dag_1000_entry_951 - dag_1000_entry_949);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_62)) begin
+		dag_1000_entry_954_reg[63:0] <= dag_1000_entry_954[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_955[15:0] = dag_1000_entry_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_955_reg[15:0] = bp_reg_18[77:62];
+end
+
+always @ (*) begin
+	dag_1000_entry_956[31:0] = dag_1000_entry_or_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_956_reg[31:0] = bp_reg_18[61:30];
+end
+
+always @ (*) begin
+	dag_1000_entry_957[63:0] = (dag_1000_entry_943_reg | dag_1000_entry_947);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_62)) begin
+		dag_1000_entry_957_reg[63:0] <= dag_1000_entry_957[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_958[7:0] = dag_1000_entry_mul_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_44)) begin
+		bp_reg_73[7:0] <= dag_1000_entry_958[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_958_reg[7:0] = bp_reg_73[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_959[15:0] = dag_1000_entry_add_16_16_1[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_66)) begin
+		bp_reg_37[15:0] <= dag_1000_entry_959[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_959_reg[15:0] = bp_reg_37[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_960[7:0] = dag_1000_entry_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_960_reg[7:0] = bp_reg_9[28:21];
+end
+
+always @ (*) begin
+	dag_1000_entry_961[15:0] = dag_1000_entry_or_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_961_reg[15:0] = bp_reg_2[128:113];
+end
+
+always @ (*) begin
+	dag_1000_entry_962[63:0] = (dag_1000_entry_943_reg | dag_1000_entry_947);
+end
+
+always @ (*) begin
+	dag_1000_entry_962_reg[63:0] = bp_reg_10[85:22];
+end
+
+always @ (*) begin
+	dag_1000_entry_963[7:0] = dag_1000_entry_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_963_reg[7:0] = bp_reg_8[313:306];
+end
+
+always @ (*) begin
+	dag_1000_entry_964[63:0] = (dag_1000_entry_962 + dag_1000_entry_957);
+end
+
+always @ (*) begin
+	dag_1000_entry_964_reg[63:0] = bp_reg_10[149:86];
+end
+
+always @ (*) begin
+	dag_1000_entry_965[31:0] = dag_1000_entry_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_965_reg[31:0] = dag_1000_entry_815_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_968[7:0] = (dag_1000_entry_958 ^ dag_1000_entry_958);
+end
+
+always @ (*) begin
+	dag_1000_entry_968_reg[7:0] = bp_reg_9[119:112];
+end
+
+always @ (*) begin
+	dag_1000_entry_969[63:0] = (dag_1000_entry_949 + dag_1000_entry_947);
+end
+
+always @ (*) begin
+	dag_1000_entry_969_reg[63:0] = bp_reg_10[213:150];
+end
+
+always @ (*) begin
+	dag_1000_entry_970[7:0] = dag_1000_entry_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_970_reg[7:0] = bp_reg_8[321:314];
+end
+
+always @ (*) begin
+	dag_1000_entry_971[15:0] = dag_1000_entry_and_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_66)) begin
+		bp_reg_38[15:0] <= dag_1000_entry_971[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_971_reg[15:0] = bp_reg_38[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_972[31:0] = dag_1000_entry_mul_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_70)) begin
+		dag_1000_entry_972_reg[31:0] <= dag_1000_entry_972[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_73)) begin
+		dag_1000_entry_972_reg[31:0] <= dag_1000_entry_1003[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_973[15:0] = dag_1000_entry_and_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_973_reg[15:0] = bp_reg_4[22:7];
+end
+
+always @ (*) begin
+	dag_1000_entry_974[15:0] = (dag_1000_entry_973 ^ dag_1000_entry_961);
+end
+
+always @ (*) begin
+	dag_1000_entry_974_reg[15:0] = bp_reg_4[38:23];
+end
+
+always @ (*) begin
+	dag_1000_entry_975[15:0] = dag_1000_entry_and_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_975_reg[15:0] = bp_reg_0[47:32];
+end
+
+always @ (*) begin
+	dag_1000_entry_976[63:0] = (dag_1000_entry_949 + dag_1000_entry_954);
+end
+
+always @ (*) begin
+	dag_1000_entry_976_reg[63:0] = bp_reg_10[277:214];
+end
+
+always @ (*) begin
+	dag_1000_entry_977[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_977_reg[31:0] = bp_reg_12[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_978[63:0] = (dag_1000_entry_962 & dag_1000_entry_976);
+end
+
+always @ (*) begin
+	dag_1000_entry_978_reg[63:0] = bp_reg_10[341:278];
+end
+
+always @ (*) begin
+	dag_1000_entry_979[15:0] = dag_1000_entry_add_16_16_1[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_979_reg[15:0] = bp_reg_22[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_980[7:0] = dag_1000_entry_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_980_reg[7:0] = bp_reg_9[36:29];
+end
+
+always @ (*) begin
+	dag_1000_entry_981[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_981_reg[31:0] = bp_reg_0[79:48];
+end
+
+always @ (*) begin
+	dag_1000_entry_982[7:0] = dag_1000_entry_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_982_reg[7:0] = bp_reg_34[14:7];
+end
+
+always @ (*) begin
+	dag_1000_entry_983[31:0] = (dag_1000_entry_965_reg - dag_1000_entry_981);
+end
+
+always @ (*) begin
+	dag_1000_entry_983_reg[31:0] = bp_reg_12[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_984[31:0] = dag_1000_entry_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_984_reg[31:0] = dag_1000_entry_789_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_985[31:0] = (dag_1000_entry_965 ^ dag_1000_entry_965);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_69)) begin
+		dag_1000_entry_985_reg[31:0] <= dag_1000_entry_985[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_987[15:0] = dag_1000_entry_or_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_987_reg[15:0] = bp_reg_0[47:32];
+end
+
+always @ (*) begin
+	dag_1000_entry_988[31:0] = (dag_1000_entry_985_reg ^ dag_1000_entry_972);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_70)) begin
+		dag_1000_entry_988_reg[31:0] <= dag_1000_entry_988[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_990[31:0] = (dag_1000_entry_983 ^ dag_1000_entry_977_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_73)) begin
+		dag_1000_entry_990_reg[31:0] <= dag_1000_entry_990[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_993[63:0] = (dag_1000_entry_978_reg + dag_1000_entry_964_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_63)) begin
+		dag_1000_entry_993_reg[63:0] <= dag_1000_entry_993[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_995[31:0] = dag_1000_entry_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_995_reg[31:0] = bp_reg_0[63:32];
+end
+
+always @ (*) begin
+	dag_1000_entry_996[15:0] = (dag_1000_entry_974_reg - dag_1000_entry_975);
+end
+
+always @ (*) begin
+	dag_1000_entry_996_reg[15:0] = bp_reg_0[63:48];
+end
+
+always @ (*) begin
+	dag_1000_entry_997[15:0] = (dag_1000_entry_974 ^ dag_1000_entry_973);
+end
+
+always @ (*) begin
+	dag_1000_entry_997_reg[15:0] = bp_reg_23[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_998[7:0] = dag_1000_entry_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_998_reg[7:0] = dag_1000_entry_380_reg[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_999[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_999_reg[31:0] = dag_1000_entry_787_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_1000[7:0] = (dag_1000_entry_968 - dag_1000_entry_970_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_1000_reg[7:0] = bp_reg_9[127:120];
+end
+
+always @ (*) begin
+	dag_1000_entry_1003[31:0] = dag_1000_entry_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_1003_reg[31:0] = dag_1000_entry_972_reg[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_1004[7:0] = dag_1000_entry_add_8_8_1[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_44)) begin
+		bp_reg_74[7:0] <= dag_1000_entry_1004[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_1004_reg[7:0] = bp_reg_74[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_1006[15:0] = (dag_1000_entry_979 ^ dag_1000_entry_997);
+end
+
+always @ (*) begin
+	dag_1000_entry_1006_reg[15:0] = bp_reg_18[77:62];
+end
+
+always @ (*) begin
+	dag_1000_entry_1007[63:0] = (dag_1000_entry_1004_reg ^ dag_1000_entry_1003);
+end
+
+always @ (*) begin
+	dag_1000_entry_1007_reg[31:0] = bp_reg_2[78:47];
+end
+
+always @ (*) begin
+	dag_1000_entry_1008[63:0] = (dag_1000_entry_1006_reg ^ dag_1000_entry_1007);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_73)) begin
+		dag_1000_entry_1008_reg[31:0] <= dag_1000_entry_1008[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_1009[63:0] = (dag_1000_entry_1008 ^ dag_1000_entry_976_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_73)) begin
+		dag_1000_entry_1009_reg[63:0] <= dag_1000_entry_1009[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_1010[63:0] = (dag_1000_entry_1009 ^ dag_1000_entry_993_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_73)) begin
+		dag_1000_entry_1010_reg[63:0] <= dag_1000_entry_1010[63:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_0)) begin
+		dag_1000_entry_and_16_16_0_op0[15:0] = dag_1000_entry_8[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_3)) begin
+		dag_1000_entry_and_16_16_0_op0[15:0] = dag_1000_entry_86[63:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_4)) begin
+		dag_1000_entry_and_16_16_0_op0[15:0] = arg_3[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_5)) begin
+		dag_1000_entry_and_16_16_0_op0[15:0] = dag_1000_entry_19_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_7)) begin
+		dag_1000_entry_and_16_16_0_op0[15:0] = dag_1000_entry_116[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_11)) begin
+		dag_1000_entry_and_16_16_0_op0[15:0] = dag_1000_entry_206_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_16)) begin
+		dag_1000_entry_and_16_16_0_op0[15:0] = dag_1000_entry_323[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_17)) begin
+		dag_1000_entry_and_16_16_0_op0[15:0] = dag_1000_entry_325_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_19)) begin
+		dag_1000_entry_and_16_16_0_op0[15:0] = dag_1000_entry_389[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_20)) begin
+		dag_1000_entry_and_16_16_0_op0[15:0] = dag_1000_entry_389_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_21)) begin
+		dag_1000_entry_and_16_16_0_op0[15:0] = dag_1000_entry_432_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_22)) begin
+		dag_1000_entry_and_16_16_0_op0[15:0] = dag_1000_entry_448_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_23)) begin
+		dag_1000_entry_and_16_16_0_op0[15:0] = dag_1000_entry_451_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_24)) begin
+		dag_1000_entry_and_16_16_0_op0[15:0] = dag_1000_entry_514[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_25)) begin
+		dag_1000_entry_and_16_16_0_op0[15:0] = dag_1000_entry_496_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_26)) begin
+		dag_1000_entry_and_16_16_0_op0[15:0] = dag_1000_entry_547[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_27)) begin
+		dag_1000_entry_and_16_16_0_op0[15:0] = dag_1000_entry_558_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_42)) begin
+		dag_1000_entry_and_16_16_0_op0[15:0] = dag_1000_entry_577_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_43)) begin
+		dag_1000_entry_and_16_16_0_op0[15:0] = dag_1000_entry_657_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_44)) begin
+		dag_1000_entry_and_16_16_0_op0[15:0] = dag_1000_entry_658_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_45)) begin
+		dag_1000_entry_and_16_16_0_op0[15:0] = dag_1000_entry_756[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_46)) begin
+		dag_1000_entry_and_16_16_0_op0[15:0] = dag_1000_entry_770_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_47)) begin
+		dag_1000_entry_and_16_16_0_op0[15:0] = dag_1000_entry_744_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_65)) begin
+		dag_1000_entry_and_16_16_0_op0[15:0] = dag_1000_entry_911[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_66)) begin
+		dag_1000_entry_and_16_16_0_op0[15:0] = dag_1000_entry_955[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_67)) begin
+		dag_1000_entry_and_16_16_0_op0[15:0] = dag_1000_entry_955_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_68)) begin
+		dag_1000_entry_and_16_16_0_op0[15:0] = dag_1000_entry_383_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_69)) begin
+		dag_1000_entry_and_16_16_0_op0[15:0] = dag_1000_entry_572_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_73)) begin
+		dag_1000_entry_and_16_16_0_op0[15:0] = dag_1000_entry_851_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_74)) begin
+		dag_1000_entry_and_16_16_0_op0[15:0] = dag_1000_entry_918_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_75)) begin
+		dag_1000_entry_and_16_16_0_op0[15:0] = dag_1000_entry_930_reg[15:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_1000_BB_0_S_76)) */ begin
+		dag_1000_entry_and_16_16_0_op0[15:0] = dag_1000_entry_974_reg[15:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_0)) begin
+		dag_1000_entry_and_16_16_0_op1[15:0] = dag_1000_entry_8[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_3)) begin
+		dag_1000_entry_and_16_16_0_op1[15:0] = dag_1000_entry_70_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_4)) begin
+		dag_1000_entry_and_16_16_0_op1[15:0] = dag_1000_entry_19_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_5)) begin
+		dag_1000_entry_and_16_16_0_op1[15:0] = dag_1000_entry_35_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_7)) begin
+		dag_1000_entry_and_16_16_0_op1[15:0] = dag_1000_entry_124[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_11)) begin
+		dag_1000_entry_and_16_16_0_op1[15:0] = dag_1000_entry_220[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_16)) begin
+		dag_1000_entry_and_16_16_0_op1[15:0] = dag_1000_entry_321[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_17)) begin
+		dag_1000_entry_and_16_16_0_op1[15:0] = dag_1000_entry_305_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_19)) begin
+		dag_1000_entry_and_16_16_0_op1[15:0] = dag_1000_entry_368_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_20)) begin
+		dag_1000_entry_and_16_16_0_op1[15:0] = dag_1000_entry_371_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_21)) begin
+		dag_1000_entry_and_16_16_0_op1[15:0] = dag_1000_entry_418_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_22)) begin
+		dag_1000_entry_and_16_16_0_op1[15:0] = dag_1000_entry_446[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_23)) begin
+		dag_1000_entry_and_16_16_0_op1[15:0] = dag_1000_entry_461_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_24)) begin
+		dag_1000_entry_and_16_16_0_op1[15:0] = dag_1000_entry_496[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_25)) begin
+		dag_1000_entry_and_16_16_0_op1[15:0] = dag_1000_entry_523[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_26)) begin
+		dag_1000_entry_and_16_16_0_op1[15:0] = dag_1000_entry_529_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_27)) begin
+		dag_1000_entry_and_16_16_0_op1[15:0] = dag_1000_entry_562_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_42)) begin
+		dag_1000_entry_and_16_16_0_op1[15:0] = dag_1000_entry_590[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_43)) begin
+		dag_1000_entry_and_16_16_0_op1[15:0] = dag_1000_entry_652_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_44)) begin
+		dag_1000_entry_and_16_16_0_op1[15:0] = dag_1000_entry_661_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_45)) begin
+		dag_1000_entry_and_16_16_0_op1[15:0] = dag_1000_entry_748[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_46)) begin
+		dag_1000_entry_and_16_16_0_op1[15:0] = dag_1000_entry_783[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_47)) begin
+		dag_1000_entry_and_16_16_0_op1[15:0] = dag_1000_entry_769_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_65)) begin
+		dag_1000_entry_and_16_16_0_op1[15:0] = dag_1000_entry_890_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_66)) begin
+		dag_1000_entry_and_16_16_0_op1[15:0] = dag_1000_entry_959[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_67)) begin
+		dag_1000_entry_and_16_16_0_op1[15:0] = dag_1000_entry_971_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_68)) begin
+		dag_1000_entry_and_16_16_0_op1[15:0] = dag_1000_entry_365_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_69)) begin
+		dag_1000_entry_and_16_16_0_op1[15:0] = dag_1000_entry_570_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_73)) begin
+		dag_1000_entry_and_16_16_0_op1[15:0] = dag_1000_entry_867[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_74)) begin
+		dag_1000_entry_and_16_16_0_op1[15:0] = dag_1000_entry_932_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_75)) begin
+		dag_1000_entry_and_16_16_0_op1[15:0] = dag_1000_entry_930_reg[15:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_1000_BB_0_S_76)) */ begin
+		dag_1000_entry_and_16_16_0_op1[15:0] = dag_1000_entry_974_reg[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_and_16_16_0[15:0] = (dag_1000_entry_and_16_16_0_op0 & dag_1000_entry_and_16_16_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_0)) begin
+		dag_1000_entry_mul_8_8_0_op0[7:0] = arg_1[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_1)) begin
+		dag_1000_entry_mul_8_8_0_op0[7:0] = arg_1[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_2)) begin
+		dag_1000_entry_mul_8_8_0_op0[7:0] = dag_1000_entry_37_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_5)) begin
+		dag_1000_entry_mul_8_8_0_op0[7:0] = dag_1000_entry_104[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_6)) begin
+		dag_1000_entry_mul_8_8_0_op0[7:0] = dag_1000_entry_103_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_7)) begin
+		dag_1000_entry_mul_8_8_0_op0[7:0] = dag_1000_entry_126_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_8)) begin
+		dag_1000_entry_mul_8_8_0_op0[7:0] = dag_1000_entry_137_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_9)) begin
+		dag_1000_entry_mul_8_8_0_op0[7:0] = dag_1000_entry_180_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_10)) begin
+		dag_1000_entry_mul_8_8_0_op0[7:0] = dag_1000_entry_205_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_11)) begin
+		dag_1000_entry_mul_8_8_0_op0[7:0] = dag_1000_entry_231[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_12)) begin
+		dag_1000_entry_mul_8_8_0_op0[7:0] = dag_1000_entry_270_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_15)) begin
+		dag_1000_entry_mul_8_8_0_op0[7:0] = dag_1000_entry_338_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_16)) begin
+		dag_1000_entry_mul_8_8_0_op0[7:0] = dag_1000_entry_396[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_20)) begin
+		dag_1000_entry_mul_8_8_0_op0[7:0] = dag_1000_entry_419_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_21)) begin
+		dag_1000_entry_mul_8_8_0_op0[7:0] = dag_1000_entry_452_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_22)) begin
+		dag_1000_entry_mul_8_8_0_op0[7:0] = dag_1000_entry_473_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_23)) begin
+		dag_1000_entry_mul_8_8_0_op0[7:0] = dag_1000_entry_527_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_24)) begin
+		dag_1000_entry_mul_8_8_0_op0[7:0] = dag_1000_entry_527_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_25)) begin
+		dag_1000_entry_mul_8_8_0_op0[7:0] = dag_1000_entry_567_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_26)) begin
+		dag_1000_entry_mul_8_8_0_op0[7:0] = dag_1000_entry_571_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_28)) begin
+		dag_1000_entry_mul_8_8_0_op0[7:0] = dag_1000_entry_629[63:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_29)) begin
+		dag_1000_entry_mul_8_8_0_op0[7:0] = dag_1000_entry_679[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_30)) begin
+		dag_1000_entry_mul_8_8_0_op0[7:0] = dag_1000_entry_701_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_31)) begin
+		dag_1000_entry_mul_8_8_0_op0[7:0] = dag_1000_entry_725_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_33)) begin
+		dag_1000_entry_mul_8_8_0_op0[7:0] = dag_1000_entry_763[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_34)) begin
+		dag_1000_entry_mul_8_8_0_op0[7:0] = dag_1000_entry_773_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_35)) begin
+		dag_1000_entry_mul_8_8_0_op0[7:0] = dag_1000_entry_745_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_36)) begin
+		dag_1000_entry_mul_8_8_0_op0[7:0] = dag_1000_entry_778_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_39)) begin
+		dag_1000_entry_mul_8_8_0_op0[7:0] = dag_1000_entry_864[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_40)) begin
+		dag_1000_entry_mul_8_8_0_op0[7:0] = dag_1000_entry_880_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_41)) begin
+		dag_1000_entry_mul_8_8_0_op0[7:0] = dag_1000_entry_900_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_43)) begin
+		dag_1000_entry_mul_8_8_0_op0[7:0] = dag_1000_entry_938[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_44)) begin
+		dag_1000_entry_mul_8_8_0_op0[7:0] = dag_1000_entry_938_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_45)) begin
+		dag_1000_entry_mul_8_8_0_op0[7:0] = dag_1000_entry_83_reg;
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_46)) begin
+		dag_1000_entry_mul_8_8_0_op0[7:0] = dag_1000_entry_188_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_1000_BB_0_S_47)) */ begin
+		dag_1000_entry_mul_8_8_0_op0[7:0] = dag_1000_entry_960[7:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_0)) begin
+		dag_1000_entry_mul_8_8_0_op1[7:0] = arg_0[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_1)) begin
+		dag_1000_entry_mul_8_8_0_op1[7:0] = dag_1000_entry_20[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_2)) begin
+		dag_1000_entry_mul_8_8_0_op1[7:0] = dag_1000_entry_37_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_5)) begin
+		dag_1000_entry_mul_8_8_0_op1[7:0] = dag_1000_entry_104[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_6)) begin
+		dag_1000_entry_mul_8_8_0_op1[7:0] = dag_1000_entry_118_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_7)) begin
+		dag_1000_entry_mul_8_8_0_op1[7:0] = dag_1000_entry_135_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_8)) begin
+		dag_1000_entry_mul_8_8_0_op1[7:0] = dag_1000_entry_126_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_9)) begin
+		dag_1000_entry_mul_8_8_0_op1[7:0] = dag_1000_entry_202_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_10)) begin
+		dag_1000_entry_mul_8_8_0_op1[7:0] = dag_1000_entry_202_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_11)) begin
+		dag_1000_entry_mul_8_8_0_op1[7:0] = dag_1000_entry_231[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_12)) begin
+		dag_1000_entry_mul_8_8_0_op1[7:0] = dag_1000_entry_259_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_15)) begin
+		dag_1000_entry_mul_8_8_0_op1[7:0] = dag_1000_entry_351[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_16)) begin
+		dag_1000_entry_mul_8_8_0_op1[7:0] = dag_1000_entry_388_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_20)) begin
+		dag_1000_entry_mul_8_8_0_op1[7:0] = dag_1000_entry_452[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_21)) begin
+		dag_1000_entry_mul_8_8_0_op1[7:0] = dag_1000_entry_464_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_22)) begin
+		dag_1000_entry_mul_8_8_0_op1[7:0] = dag_1000_entry_478_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_23)) begin
+		dag_1000_entry_mul_8_8_0_op1[7:0] = dag_1000_entry_510_reg;
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_24)) begin
+		dag_1000_entry_mul_8_8_0_op1[7:0] = dag_1000_entry_545_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_25)) begin
+		dag_1000_entry_mul_8_8_0_op1[7:0] = dag_1000_entry_567_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_26)) begin
+		dag_1000_entry_mul_8_8_0_op1[7:0] = dag_1000_entry_604_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_28)) begin
+		dag_1000_entry_mul_8_8_0_op1[7:0] = dag_1000_entry_666_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_29)) begin
+		dag_1000_entry_mul_8_8_0_op1[7:0] = dag_1000_entry_668[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_30)) begin
+		dag_1000_entry_mul_8_8_0_op1[7:0] = dag_1000_entry_690_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_31)) begin
+		dag_1000_entry_mul_8_8_0_op1[7:0] = dag_1000_entry_714[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_33)) begin
+		dag_1000_entry_mul_8_8_0_op1[7:0] = dag_1000_entry_739_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_34)) begin
+		dag_1000_entry_mul_8_8_0_op1[7:0] = dag_1000_entry_741_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_35)) begin
+		dag_1000_entry_mul_8_8_0_op1[7:0] = dag_1000_entry_752_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_36)) begin
+		dag_1000_entry_mul_8_8_0_op1[7:0] = dag_1000_entry_763_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_39)) begin
+		dag_1000_entry_mul_8_8_0_op1[7:0] = dag_1000_entry_858_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_40)) begin
+		dag_1000_entry_mul_8_8_0_op1[7:0] = dag_1000_entry_864_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_41)) begin
+		dag_1000_entry_mul_8_8_0_op1[7:0] = dag_1000_entry_875_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_43)) begin
+		dag_1000_entry_mul_8_8_0_op1[7:0] = dag_1000_entry_936_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_44)) begin
+		dag_1000_entry_mul_8_8_0_op1[7:0] = dag_1000_entry_931_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_45)) begin
+		dag_1000_entry_mul_8_8_0_op1[7:0] = dag_1000_entry_75_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_46)) begin
+		dag_1000_entry_mul_8_8_0_op1[7:0] = dag_1000_entry_165_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_1000_BB_0_S_47)) */ begin
+		dag_1000_entry_mul_8_8_0_op1[7:0] = dag_1000_entry_958_reg[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_mul_8_8_0[7:0] = (dag_1000_entry_mul_8_8_0_op0 * dag_1000_entry_mul_8_8_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_0)) begin
+		dag_1000_entry_or_8_8_0_op0[7:0] = dag_1000_entry_11[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_1)) begin
+		dag_1000_entry_or_8_8_0_op0[7:0] = dag_1000_entry_12_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_2)) begin
+		dag_1000_entry_or_8_8_0_op0[7:0] = dag_1000_entry_33_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_3)) begin
+		dag_1000_entry_or_8_8_0_op0[7:0] = dag_1000_entry_40_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_4)) begin
+		dag_1000_entry_or_8_8_0_op0[7:0] = dag_1000_entry_20_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_5)) begin
+		dag_1000_entry_or_8_8_0_op0[7:0] = dag_1000_entry_83_reg;
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_6)) begin
+		dag_1000_entry_or_8_8_0_op0[7:0] = dag_1000_entry_134[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_8)) begin
+		dag_1000_entry_or_8_8_0_op0[7:0] = dag_1000_entry_147_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_12)) begin
+		dag_1000_entry_or_8_8_0_op0[7:0] = dag_1000_entry_276[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_13)) begin
+		dag_1000_entry_or_8_8_0_op0[7:0] = dag_1000_entry_308[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_14)) begin
+		dag_1000_entry_or_8_8_0_op0[7:0] = dag_1000_entry_318_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_16)) begin
+		dag_1000_entry_or_8_8_0_op0[7:0] = dag_1000_entry_398[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_20)) begin
+		dag_1000_entry_or_8_8_0_op0[7:0] = dag_1000_entry_467[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_23)) begin
+		dag_1000_entry_or_8_8_0_op0[7:0] = dag_1000_entry_536_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_24)) begin
+		dag_1000_entry_or_8_8_0_op0[7:0] = dag_1000_entry_579_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_26)) begin
+		dag_1000_entry_or_8_8_0_op0[7:0] = dag_1000_entry_592_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_27)) begin
+		dag_1000_entry_or_8_8_0_op0[7:0] = dag_1000_entry_634[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_28)) begin
+		dag_1000_entry_or_8_8_0_op0[7:0] = dag_1000_entry_625_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_29)) begin
+		dag_1000_entry_or_8_8_0_op0[7:0] = dag_1000_entry_648_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_30)) begin
+		dag_1000_entry_or_8_8_0_op0[7:0] = dag_1000_entry_711[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_31)) begin
+		dag_1000_entry_or_8_8_0_op0[7:0] = dag_1000_entry_688[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_32)) begin
+		dag_1000_entry_or_8_8_0_op0[7:0] = dag_1000_entry_725_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_33)) begin
+		dag_1000_entry_or_8_8_0_op0[7:0] = dag_1000_entry_739_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_36)) begin
+		dag_1000_entry_or_8_8_0_op0[7:0] = dag_1000_entry_773_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_37)) begin
+		dag_1000_entry_or_8_8_0_op0[7:0] = dag_1000_entry_793_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_39)) begin
+		dag_1000_entry_or_8_8_0_op0[7:0] = dag_1000_entry_858_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_43)) begin
+		dag_1000_entry_or_8_8_0_op0[7:0] = dag_1000_entry_945_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_44)) begin
+		dag_1000_entry_or_8_8_0_op0[7:0] = dag_1000_entry_125_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_45)) begin
+		dag_1000_entry_or_8_8_0_op0[7:0] = dag_1000_entry_164_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_46)) begin
+		dag_1000_entry_or_8_8_0_op0[7:0] = dag_1000_entry_179_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_47)) begin
+		dag_1000_entry_or_8_8_0_op0[7:0] = dag_1000_entry_219_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_48)) begin
+		dag_1000_entry_or_8_8_0_op0[7:0] = dag_1000_entry_293_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_49)) begin
+		dag_1000_entry_or_8_8_0_op0[7:0] = dag_1000_entry_388_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_50)) begin
+		dag_1000_entry_or_8_8_0_op0[7:0] = dag_1000_entry_380_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_51)) begin
+		dag_1000_entry_or_8_8_0_op0[7:0] = dag_1000_entry_854_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_52)) begin
+		dag_1000_entry_or_8_8_0_op0[7:0] = dag_1000_entry_880_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_53)) begin
+		dag_1000_entry_or_8_8_0_op0[7:0] = dag_1000_entry_894_reg;
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_68)) begin
+		dag_1000_entry_or_8_8_0_op0[7:0] = dag_1000_entry_935[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_1000_BB_0_S_69)) */ begin
+		dag_1000_entry_or_8_8_0_op0[7:0] = dag_1000_entry_963_reg[7:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_0)) begin
+		dag_1000_entry_or_8_8_0_op1[7:0] = arg_1[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_1)) begin
+		dag_1000_entry_or_8_8_0_op1[7:0] = arg_1[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_2)) begin
+		dag_1000_entry_or_8_8_0_op1[7:0] = dag_1000_entry_33_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_3)) begin
+		dag_1000_entry_or_8_8_0_op1[7:0] = dag_1000_entry_32_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_4)) begin
+		dag_1000_entry_or_8_8_0_op1[7:0] = dag_1000_entry_44_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_5)) begin
+		dag_1000_entry_or_8_8_0_op1[7:0] = dag_1000_entry_100_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_6)) begin
+		dag_1000_entry_or_8_8_0_op1[7:0] = dag_1000_entry_125_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_8)) begin
+		dag_1000_entry_or_8_8_0_op1[7:0] = dag_1000_entry_155[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_12)) begin
+		dag_1000_entry_or_8_8_0_op1[7:0] = dag_1000_entry_273_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_13)) begin
+		dag_1000_entry_or_8_8_0_op1[7:0] = dag_1000_entry_314[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_14)) begin
+		dag_1000_entry_or_8_8_0_op1[7:0] = dag_1000_entry_337_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_16)) begin
+		dag_1000_entry_or_8_8_0_op1[7:0] = dag_1000_entry_396[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_20)) begin
+		dag_1000_entry_or_8_8_0_op1[7:0] = dag_1000_entry_467[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_23)) begin
+		dag_1000_entry_or_8_8_0_op1[7:0] = dag_1000_entry_531[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_24)) begin
+		dag_1000_entry_or_8_8_0_op1[7:0] = dag_1000_entry_571[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_26)) begin
+		dag_1000_entry_or_8_8_0_op1[7:0] = dag_1000_entry_610[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_27)) begin
+		dag_1000_entry_or_8_8_0_op1[7:0] = dag_1000_entry_625_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_28)) begin
+		dag_1000_entry_or_8_8_0_op1[7:0] = dag_1000_entry_637_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_29)) begin
+		dag_1000_entry_or_8_8_0_op1[7:0] = dag_1000_entry_648_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_30)) begin
+		dag_1000_entry_or_8_8_0_op1[7:0] = dag_1000_entry_701_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_31)) begin
+		dag_1000_entry_or_8_8_0_op1[7:0] = dag_1000_entry_688[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_32)) begin
+		dag_1000_entry_or_8_8_0_op1[7:0] = dag_1000_entry_718_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_33)) begin
+		dag_1000_entry_or_8_8_0_op1[7:0] = dag_1000_entry_733_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_36)) begin
+		dag_1000_entry_or_8_8_0_op1[7:0] = dag_1000_entry_779[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_37)) begin
+		dag_1000_entry_or_8_8_0_op1[7:0] = dag_1000_entry_772_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_39)) begin
+		dag_1000_entry_or_8_8_0_op1[7:0] = dag_1000_entry_864[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_43)) begin
+		dag_1000_entry_or_8_8_0_op1[7:0] = dag_1000_entry_942[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_44)) begin
+		dag_1000_entry_or_8_8_0_op1[7:0] = dag_1000_entry_134_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_45)) begin
+		dag_1000_entry_or_8_8_0_op1[7:0] = dag_1000_entry_137_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_46)) begin
+		dag_1000_entry_or_8_8_0_op1[7:0] = dag_1000_entry_188_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_47)) begin
+		dag_1000_entry_or_8_8_0_op1[7:0] = dag_1000_entry_192_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_48)) begin
+		dag_1000_entry_or_8_8_0_op1[7:0] = dag_1000_entry_293_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_49)) begin
+		dag_1000_entry_or_8_8_0_op1[7:0] = dag_1000_entry_351_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_50)) begin
+		dag_1000_entry_or_8_8_0_op1[7:0] = dag_1000_entry_387_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_51)) begin
+		dag_1000_entry_or_8_8_0_op1[7:0] = dag_1000_entry_821_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_52)) begin
+		dag_1000_entry_or_8_8_0_op1[7:0] = dag_1000_entry_880_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_53)) begin
+		dag_1000_entry_or_8_8_0_op1[7:0] = dag_1000_entry_902_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_68)) begin
+		dag_1000_entry_or_8_8_0_op1[7:0] = dag_1000_entry_927_reg;
+	end
+	else /* if ((cur_state == BPHLS_F_dag_1000_BB_0_S_69)) */ begin
+		dag_1000_entry_or_8_8_0_op1[7:0] = dag_1000_entry_958_reg[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_or_8_8_0[7:0] = (dag_1000_entry_or_8_8_0_op0 | dag_1000_entry_or_8_8_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_0)) begin
+		dag_1000_entry_add_8_8_0_op0[7:0] = arg_0[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_1)) begin
+		dag_1000_entry_add_8_8_0_op0[7:0] = dag_1000_entry_37_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_2)) begin
+		dag_1000_entry_add_8_8_0_op0[7:0] = dag_1000_entry_46_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_4)) begin
+		dag_1000_entry_add_8_8_0_op0[7:0] = dag_1000_entry_62_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_5)) begin
+		dag_1000_entry_add_8_8_0_op0[7:0] = dag_1000_entry_118[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_6)) begin
+		dag_1000_entry_add_8_8_0_op0[7:0] = dag_1000_entry_121_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_7)) begin
+		dag_1000_entry_add_8_8_0_op0[7:0] = dag_1000_entry_137[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_8)) begin
+		dag_1000_entry_add_8_8_0_op0[7:0] = dag_1000_entry_179[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_10)) begin
+		dag_1000_entry_add_8_8_0_op0[7:0] = dag_1000_entry_219[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_11)) begin
+		dag_1000_entry_add_8_8_0_op0[7:0] = dag_1000_entry_227_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_12)) begin
+		dag_1000_entry_add_8_8_0_op0[7:0] = dag_1000_entry_233_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_13)) begin
+		dag_1000_entry_add_8_8_0_op0[7:0] = dag_1000_entry_270_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_14)) begin
+		dag_1000_entry_add_8_8_0_op0[7:0] = dag_1000_entry_326_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_15)) begin
+		dag_1000_entry_add_8_8_0_op0[7:0] = dag_1000_entry_347_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_19)) begin
+		dag_1000_entry_add_8_8_0_op0[7:0] = dag_1000_entry_417_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_20)) begin
+		dag_1000_entry_add_8_8_0_op0[7:0] = dag_1000_entry_452[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_22)) begin
+		dag_1000_entry_add_8_8_0_op0[7:0] = dag_1000_entry_524[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_23)) begin
+		dag_1000_entry_add_8_8_0_op0[7:0] = dag_1000_entry_524_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_24)) begin
+		dag_1000_entry_add_8_8_0_op0[7:0] = dag_1000_entry_579_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_26)) begin
+		dag_1000_entry_add_8_8_0_op0[7:0] = dag_1000_entry_636[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_27)) begin
+		dag_1000_entry_add_8_8_0_op0[7:0] = dag_1000_entry_633_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_29)) begin
+		dag_1000_entry_add_8_8_0_op0[7:0] = dag_1000_entry_675_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_30)) begin
+		dag_1000_entry_add_8_8_0_op0[7:0] = dag_1000_entry_725[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_31)) begin
+		dag_1000_entry_add_8_8_0_op0[7:0] = dag_1000_entry_682_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_32)) begin
+		dag_1000_entry_add_8_8_0_op0[7:0] = dag_1000_entry_739[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_35)) begin
+		dag_1000_entry_add_8_8_0_op0[7:0] = dag_1000_entry_816[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_37)) begin
+		dag_1000_entry_add_8_8_0_op0[7:0] = dag_1000_entry_811_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_38)) begin
+		dag_1000_entry_add_8_8_0_op0[7:0] = dag_1000_entry_822_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_40)) begin
+		dag_1000_entry_add_8_8_0_op0[7:0] = dag_1000_entry_862[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_41)) begin
+		dag_1000_entry_add_8_8_0_op0[7:0] = dag_1000_entry_875_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_42)) begin
+		dag_1000_entry_add_8_8_0_op0[7:0] = dag_1000_entry_936[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_43)) begin
+		dag_1000_entry_add_8_8_0_op0[7:0] = dag_1000_entry_963[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_45)) begin
+		dag_1000_entry_add_8_8_0_op0[7:0] = dag_1000_entry_379_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_47)) begin
+		dag_1000_entry_add_8_8_0_op0[7:0] = dag_1000_entry_936_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_1000_BB_0_S_52)) */ begin
+		dag_1000_entry_add_8_8_0_op0[7:0] = dag_1000_entry_980_reg[7:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_0)) begin
+		dag_1000_entry_add_8_8_0_op1[7:0] = arg_0[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_1)) begin
+		dag_1000_entry_add_8_8_0_op1[7:0] = dag_1000_entry_42[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_2)) begin
+		dag_1000_entry_add_8_8_0_op1[7:0] = dag_1000_entry_42_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_4)) begin
+		dag_1000_entry_add_8_8_0_op1[7:0] = dag_1000_entry_87[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_5)) begin
+		dag_1000_entry_add_8_8_0_op1[7:0] = dag_1000_entry_121[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_6)) begin
+		dag_1000_entry_add_8_8_0_op1[7:0] = dag_1000_entry_118_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_7)) begin
+		dag_1000_entry_add_8_8_0_op1[7:0] = dag_1000_entry_147_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_8)) begin
+		dag_1000_entry_add_8_8_0_op1[7:0] = dag_1000_entry_188[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_10)) begin
+		dag_1000_entry_add_8_8_0_op1[7:0] = dag_1000_entry_212[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_11)) begin
+		dag_1000_entry_add_8_8_0_op1[7:0] = dag_1000_entry_227_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_12)) begin
+		dag_1000_entry_add_8_8_0_op1[7:0] = dag_1000_entry_259_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_13)) begin
+		dag_1000_entry_add_8_8_0_op1[7:0] = dag_1000_entry_273_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_14)) begin
+		dag_1000_entry_add_8_8_0_op1[7:0] = dag_1000_entry_308_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_15)) begin
+		dag_1000_entry_add_8_8_0_op1[7:0] = dag_1000_entry_318_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_19)) begin
+		dag_1000_entry_add_8_8_0_op1[7:0] = dag_1000_entry_429[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_20)) begin
+		dag_1000_entry_add_8_8_0_op1[7:0] = dag_1000_entry_436_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_22)) begin
+		dag_1000_entry_add_8_8_0_op1[7:0] = dag_1000_entry_524[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_23)) begin
+		dag_1000_entry_add_8_8_0_op1[7:0] = dag_1000_entry_527_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_24)) begin
+		dag_1000_entry_add_8_8_0_op1[7:0] = dag_1000_entry_579_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_26)) begin
+		dag_1000_entry_add_8_8_0_op1[7:0] = dag_1000_entry_624[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_27)) begin
+		dag_1000_entry_add_8_8_0_op1[7:0] = dag_1000_entry_610_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_29)) begin
+		dag_1000_entry_add_8_8_0_op1[7:0] = dag_1000_entry_679[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_30)) begin
+		dag_1000_entry_add_8_8_0_op1[7:0] = dag_1000_entry_725[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_31)) begin
+		dag_1000_entry_add_8_8_0_op1[7:0] = dag_1000_entry_687_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_32)) begin
+		dag_1000_entry_add_8_8_0_op1[7:0] = dag_1000_entry_718_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_35)) begin
+		dag_1000_entry_add_8_8_0_op1[7:0] = dag_1000_entry_816[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_37)) begin
+		dag_1000_entry_add_8_8_0_op1[7:0] = dag_1000_entry_808[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_38)) begin
+		dag_1000_entry_add_8_8_0_op1[7:0] = dag_1000_entry_834_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_40)) begin
+		dag_1000_entry_add_8_8_0_op1[7:0] = dag_1000_entry_862[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_41)) begin
+		dag_1000_entry_add_8_8_0_op1[7:0] = dag_1000_entry_894[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_42)) begin
+		dag_1000_entry_add_8_8_0_op1[7:0] = dag_1000_entry_931[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_43)) begin
+		dag_1000_entry_add_8_8_0_op1[7:0] = dag_1000_entry_970[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_45)) begin
+		dag_1000_entry_add_8_8_0_op1[7:0] = dag_1000_entry_345_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_47)) begin
+		dag_1000_entry_add_8_8_0_op1[7:0] = dag_1000_entry_938_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_1000_BB_0_S_52)) */ begin
+		dag_1000_entry_add_8_8_0_op1[7:0] = dag_1000_entry_982[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_add_8_8_0[7:0] = (dag_1000_entry_add_8_8_0_op0 + dag_1000_entry_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_0)) begin
+		dag_1000_entry_add_8_8_1_op0[7:0] = dag_1000_entry_12[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_2)) begin
+		dag_1000_entry_add_8_8_1_op0[7:0] = dag_1000_entry_23_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_5)) begin
+		dag_1000_entry_add_8_8_1_op0[7:0] = dag_1000_entry_100_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_6)) begin
+		dag_1000_entry_add_8_8_1_op0[7:0] = dag_1000_entry_125_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_8)) begin
+		dag_1000_entry_add_8_8_1_op0[7:0] = dag_1000_entry_180_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_9)) begin
+		dag_1000_entry_add_8_8_1_op0[7:0] = dag_1000_entry_205[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_10)) begin
+		dag_1000_entry_add_8_8_1_op0[7:0] = dag_1000_entry_224_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_11)) begin
+		dag_1000_entry_add_8_8_1_op0[7:0] = dag_1000_entry_228_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_12)) begin
+		dag_1000_entry_add_8_8_1_op0[7:0] = dag_1000_entry_267_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_13)) begin
+		dag_1000_entry_add_8_8_1_op0[7:0] = dag_1000_entry_276_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_14)) begin
+		dag_1000_entry_add_8_8_1_op0[7:0] = dag_1000_entry_327[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_19)) begin
+		dag_1000_entry_add_8_8_1_op0[7:0] = dag_1000_entry_412_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_20)) begin
+		dag_1000_entry_add_8_8_1_op0[7:0] = dag_1000_entry_420[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_22)) begin
+		dag_1000_entry_add_8_8_1_op0[7:0] = dag_1000_entry_501[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_23)) begin
+		dag_1000_entry_add_8_8_1_op0[7:0] = dag_1000_entry_557[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_25)) begin
+		dag_1000_entry_add_8_8_1_op0[7:0] = dag_1000_entry_616[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_26)) begin
+		dag_1000_entry_add_8_8_1_op0[7:0] = dag_1000_entry_604_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_27)) begin
+		dag_1000_entry_add_8_8_1_op0[7:0] = dag_1000_entry_645[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_30)) begin
+		dag_1000_entry_add_8_8_1_op0[7:0] = dag_1000_entry_704_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_31)) begin
+		dag_1000_entry_add_8_8_1_op0[7:0] = dag_1000_entry_702_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_32)) begin
+		dag_1000_entry_add_8_8_1_op0[7:0] = dag_1000_entry_704_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_35)) begin
+		dag_1000_entry_add_8_8_1_op0[7:0] = dag_1000_entry_782[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_36)) begin
+		dag_1000_entry_add_8_8_1_op0[7:0] = dag_1000_entry_763_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_37)) begin
+		dag_1000_entry_add_8_8_1_op0[7:0] = dag_1000_entry_773_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_38)) begin
+		dag_1000_entry_add_8_8_1_op0[7:0] = dag_1000_entry_836[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_40)) begin
+		dag_1000_entry_add_8_8_1_op0[7:0] = dag_1000_entry_854[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_41)) begin
+		dag_1000_entry_add_8_8_1_op0[7:0] = dag_1000_entry_900_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_42)) begin
+		dag_1000_entry_add_8_8_1_op0[7:0] = dag_1000_entry_913_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_43)) begin
+		dag_1000_entry_add_8_8_1_op0[7:0] = dag_1000_entry_945_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_44)) begin
+		dag_1000_entry_add_8_8_1_op0[7:0] = dag_1000_entry_1000[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_46)) begin
+		dag_1000_entry_add_8_8_1_op0[7:0] = dag_1000_entry_473_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_47)) begin
+		dag_1000_entry_add_8_8_1_op0[7:0] = dag_1000_entry_221[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_48)) begin
+		dag_1000_entry_add_8_8_1_op0[7:0] = dag_1000_entry_410_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_1000_BB_0_S_49)) */ begin
+		dag_1000_entry_add_8_8_1_op0[7:0] = dag_1000_entry_616_reg[7:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_0)) begin
+		dag_1000_entry_add_8_8_1_op1[7:0] = dag_1000_entry_12[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_2)) begin
+		dag_1000_entry_add_8_8_1_op1[7:0] = dag_1000_entry_44[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_5)) begin
+		dag_1000_entry_add_8_8_1_op1[7:0] = dag_1000_entry_104[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_6)) begin
+		dag_1000_entry_add_8_8_1_op1[7:0] = dag_1000_entry_114_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_8)) begin
+		dag_1000_entry_add_8_8_1_op1[7:0] = dag_1000_entry_188[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_9)) begin
+		dag_1000_entry_add_8_8_1_op1[7:0] = dag_1000_entry_202_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_10)) begin
+		dag_1000_entry_add_8_8_1_op1[7:0] = dag_1000_entry_228[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_11)) begin
+		dag_1000_entry_add_8_8_1_op1[7:0] = dag_1000_entry_230_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_12)) begin
+		dag_1000_entry_add_8_8_1_op1[7:0] = dag_1000_entry_269[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_13)) begin
+		dag_1000_entry_add_8_8_1_op1[7:0] = dag_1000_entry_289_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_14)) begin
+		dag_1000_entry_add_8_8_1_op1[7:0] = dag_1000_entry_337_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_19)) begin
+		dag_1000_entry_add_8_8_1_op1[7:0] = dag_1000_entry_419[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_20)) begin
+		dag_1000_entry_add_8_8_1_op1[7:0] = dag_1000_entry_436_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_22)) begin
+		dag_1000_entry_add_8_8_1_op1[7:0] = dag_1000_entry_500[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_23)) begin
+		dag_1000_entry_add_8_8_1_op1[7:0] = dag_1000_entry_556[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_25)) begin
+		dag_1000_entry_add_8_8_1_op1[7:0] = dag_1000_entry_605_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_26)) begin
+		dag_1000_entry_add_8_8_1_op1[7:0] = dag_1000_entry_605_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_27)) begin
+		dag_1000_entry_add_8_8_1_op1[7:0] = dag_1000_entry_637_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_30)) begin
+		dag_1000_entry_add_8_8_1_op1[7:0] = dag_1000_entry_725[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_31)) begin
+		dag_1000_entry_add_8_8_1_op1[7:0] = dag_1000_entry_704_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_32)) begin
+		dag_1000_entry_add_8_8_1_op1[7:0] = dag_1000_entry_725_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_35)) begin
+		dag_1000_entry_add_8_8_1_op1[7:0] = dag_1000_entry_778_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_36)) begin
+		dag_1000_entry_add_8_8_1_op1[7:0] = dag_1000_entry_778_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_37)) begin
+		dag_1000_entry_add_8_8_1_op1[7:0] = dag_1000_entry_799[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_38)) begin
+		dag_1000_entry_add_8_8_1_op1[7:0] = dag_1000_entry_834_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_40)) begin
+		dag_1000_entry_add_8_8_1_op1[7:0] = dag_1000_entry_858_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_41)) begin
+		dag_1000_entry_add_8_8_1_op1[7:0] = dag_1000_entry_898_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_42)) begin
+		dag_1000_entry_add_8_8_1_op1[7:0] = dag_1000_entry_901_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_43)) begin
+		dag_1000_entry_add_8_8_1_op1[7:0] = dag_1000_entry_963[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_44)) begin
+		dag_1000_entry_add_8_8_1_op1[7:0] = dag_1000_entry_998_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_46)) begin
+		dag_1000_entry_add_8_8_1_op1[7:0] = dag_1000_entry_476_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_47)) begin
+		dag_1000_entry_add_8_8_1_op1[7:0] = dag_1000_entry_231_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_48)) begin
+		dag_1000_entry_add_8_8_1_op1[7:0] = dag_1000_entry_412_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_1000_BB_0_S_49)) */ begin
+		dag_1000_entry_add_8_8_1_op1[7:0] = dag_1000_entry_604_reg[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_add_8_8_1[7:0] = (dag_1000_entry_add_8_8_1_op0 + dag_1000_entry_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_0)) begin
+		dag_1000_entry_and_8_8_0_op0[7:0] = dag_1000_entry_11[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_1)) begin
+		dag_1000_entry_and_8_8_0_op0[7:0] = dag_1000_entry_12_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_2)) begin
+		dag_1000_entry_and_8_8_0_op0[7:0] = dag_1000_entry_23_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_3)) begin
+		dag_1000_entry_and_8_8_0_op0[7:0] = dag_1000_entry_56_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_4)) begin
+		dag_1000_entry_and_8_8_0_op0[7:0] = dag_1000_entry_56_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_6)) begin
+		dag_1000_entry_and_8_8_0_op0[7:0] = dag_1000_entry_121_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_9)) begin
+		dag_1000_entry_and_8_8_0_op0[7:0] = dag_1000_entry_222[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_10)) begin
+		dag_1000_entry_and_8_8_0_op0[7:0] = dag_1000_entry_253[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_11)) begin
+		dag_1000_entry_and_8_8_0_op0[7:0] = dag_1000_entry_230_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_15)) begin
+		dag_1000_entry_and_8_8_0_op0[7:0] = dag_1000_entry_351[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_16)) begin
+		dag_1000_entry_and_8_8_0_op0[7:0] = dag_1000_entry_379_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_17)) begin
+		dag_1000_entry_and_8_8_0_op0[7:0] = dag_1000_entry_350_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_18)) begin
+		dag_1000_entry_and_8_8_0_op0[7:0] = dag_1000_entry_410_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_19)) begin
+		dag_1000_entry_and_8_8_0_op0[7:0] = dag_1000_entry_409_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_20)) begin
+		dag_1000_entry_and_8_8_0_op0[7:0] = dag_1000_entry_419_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_21)) begin
+		dag_1000_entry_and_8_8_0_op0[7:0] = dag_1000_entry_419_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_22)) begin
+		dag_1000_entry_and_8_8_0_op0[7:0] = dag_1000_entry_469_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_23)) begin
+		dag_1000_entry_and_8_8_0_op0[7:0] = dag_1000_entry_553[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_24)) begin
+		dag_1000_entry_and_8_8_0_op0[7:0] = dag_1000_entry_582[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_25)) begin
+		dag_1000_entry_and_8_8_0_op0[7:0] = dag_1000_entry_605_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_26)) begin
+		dag_1000_entry_and_8_8_0_op0[7:0] = dag_1000_entry_633_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_27)) begin
+		dag_1000_entry_and_8_8_0_op0[7:0] = dag_1000_entry_637_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_28)) begin
+		dag_1000_entry_and_8_8_0_op0[7:0] = dag_1000_entry_637_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_29)) begin
+		dag_1000_entry_and_8_8_0_op0[7:0] = dag_1000_entry_651_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_33)) begin
+		dag_1000_entry_and_8_8_0_op0[7:0] = dag_1000_entry_760[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_37)) begin
+		dag_1000_entry_and_8_8_0_op0[7:0] = dag_1000_entry_816_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_38)) begin
+		dag_1000_entry_and_8_8_0_op0[7:0] = dag_1000_entry_799_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_39)) begin
+		dag_1000_entry_and_8_8_0_op0[7:0] = dag_1000_entry_836_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_40)) begin
+		dag_1000_entry_and_8_8_0_op0[7:0] = dag_1000_entry_839_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_41)) begin
+		dag_1000_entry_and_8_8_0_op0[7:0] = dag_1000_entry_854_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_42)) begin
+		dag_1000_entry_and_8_8_0_op0[7:0] = dag_1000_entry_873_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_43)) begin
+		dag_1000_entry_and_8_8_0_op0[7:0] = dag_1000_entry_936_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_44)) begin
+		dag_1000_entry_and_8_8_0_op0[7:0] = dag_1000_entry_59_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_45)) begin
+		dag_1000_entry_and_8_8_0_op0[7:0] = dag_1000_entry_130_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_46)) begin
+		dag_1000_entry_and_8_8_0_op0[7:0] = dag_1000_entry_140_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_47)) begin
+		dag_1000_entry_and_8_8_0_op0[7:0] = dag_1000_entry_285_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_48)) begin
+		dag_1000_entry_and_8_8_0_op0[7:0] = dag_1000_entry_582_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_49)) begin
+		dag_1000_entry_and_8_8_0_op0[7:0] = dag_1000_entry_773_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_50)) begin
+		dag_1000_entry_and_8_8_0_op0[7:0] = dag_1000_entry_811_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_51)) begin
+		dag_1000_entry_and_8_8_0_op0[7:0] = dag_1000_entry_913_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_52)) begin
+		dag_1000_entry_and_8_8_0_op0[7:0] = dag_1000_entry_958_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_1000_BB_0_S_53)) */ begin
+		dag_1000_entry_and_8_8_0_op0[7:0] = dag_1000_entry_963_reg[7:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_0)) begin
+		dag_1000_entry_and_8_8_0_op1[7:0] = dag_1000_entry_11[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_1)) begin
+		dag_1000_entry_and_8_8_0_op1[7:0] = dag_1000_entry_12_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_2)) begin
+		dag_1000_entry_and_8_8_0_op1[7:0] = dag_1000_entry_15_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_3)) begin
+		dag_1000_entry_and_8_8_0_op1[7:0] = dag_1000_entry_32_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_4)) begin
+		dag_1000_entry_and_8_8_0_op1[7:0] = dag_1000_entry_59_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_6)) begin
+		dag_1000_entry_and_8_8_0_op1[7:0] = dag_1000_entry_130[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_9)) begin
+		dag_1000_entry_and_8_8_0_op1[7:0] = dag_1000_entry_202_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_10)) begin
+		dag_1000_entry_and_8_8_0_op1[7:0] = dag_1000_entry_266[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_11)) begin
+		dag_1000_entry_and_8_8_0_op1[7:0] = dag_1000_entry_228_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_15)) begin
+		dag_1000_entry_and_8_8_0_op1[7:0] = dag_1000_entry_327_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_16)) begin
+		dag_1000_entry_and_8_8_0_op1[7:0] = dag_1000_entry_356_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_17)) begin
+		dag_1000_entry_and_8_8_0_op1[7:0] = dag_1000_entry_347_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_18)) begin
+		dag_1000_entry_and_8_8_0_op1[7:0] = dag_1000_entry_404_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_19)) begin
+		dag_1000_entry_and_8_8_0_op1[7:0] = dag_1000_entry_409_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_20)) begin
+		dag_1000_entry_and_8_8_0_op1[7:0] = dag_1000_entry_408_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_21)) begin
+		dag_1000_entry_and_8_8_0_op1[7:0] = dag_1000_entry_419_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_22)) begin
+		dag_1000_entry_and_8_8_0_op1[7:0] = dag_1000_entry_476_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_23)) begin
+		dag_1000_entry_and_8_8_0_op1[7:0] = dag_1000_entry_553[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_24)) begin
+		dag_1000_entry_and_8_8_0_op1[7:0] = dag_1000_entry_579_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_25)) begin
+		dag_1000_entry_and_8_8_0_op1[7:0] = dag_1000_entry_582_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_26)) begin
+		dag_1000_entry_and_8_8_0_op1[7:0] = dag_1000_entry_624[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_27)) begin
+		dag_1000_entry_and_8_8_0_op1[7:0] = dag_1000_entry_645[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_28)) begin
+		dag_1000_entry_and_8_8_0_op1[7:0] = dag_1000_entry_637_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_29)) begin
+		dag_1000_entry_and_8_8_0_op1[7:0] = dag_1000_entry_651_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_33)) begin
+		dag_1000_entry_and_8_8_0_op1[7:0] = dag_1000_entry_772[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_37)) begin
+		dag_1000_entry_and_8_8_0_op1[7:0] = dag_1000_entry_808[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_38)) begin
+		dag_1000_entry_and_8_8_0_op1[7:0] = dag_1000_entry_808_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_39)) begin
+		dag_1000_entry_and_8_8_0_op1[7:0] = dag_1000_entry_839_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_40)) begin
+		dag_1000_entry_and_8_8_0_op1[7:0] = dag_1000_entry_821_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_41)) begin
+		dag_1000_entry_and_8_8_0_op1[7:0] = dag_1000_entry_864_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_42)) begin
+		dag_1000_entry_and_8_8_0_op1[7:0] = dag_1000_entry_873_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_43)) begin
+		dag_1000_entry_and_8_8_0_op1[7:0] = dag_1000_entry_910_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_44)) begin
+		dag_1000_entry_and_8_8_0_op1[7:0] = dag_1000_entry_59_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_45)) begin
+		dag_1000_entry_and_8_8_0_op1[7:0] = dag_1000_entry_137_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_46)) begin
+		dag_1000_entry_and_8_8_0_op1[7:0] = dag_1000_entry_179_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_47)) begin
+		dag_1000_entry_and_8_8_0_op1[7:0] = dag_1000_entry_270_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_48)) begin
+		dag_1000_entry_and_8_8_0_op1[7:0] = dag_1000_entry_560_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_49)) begin
+		dag_1000_entry_and_8_8_0_op1[7:0] = dag_1000_entry_782_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_50)) begin
+		dag_1000_entry_and_8_8_0_op1[7:0] = dag_1000_entry_817_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_51)) begin
+		dag_1000_entry_and_8_8_0_op1[7:0] = dag_1000_entry_913_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_52)) begin
+		dag_1000_entry_and_8_8_0_op1[7:0] = dag_1000_entry_960_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_1000_BB_0_S_53)) */ begin
+		dag_1000_entry_and_8_8_0_op1[7:0] = dag_1000_entry_970_reg[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_and_8_8_0[7:0] = (dag_1000_entry_and_8_8_0_op0 & dag_1000_entry_and_8_8_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_0)) begin
+		dag_1000_entry_or_32_32_0_op0[31:0] = arg_4[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_5)) begin
+		dag_1000_entry_or_32_32_0_op0[31:0] = dag_1000_entry_43[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_7)) begin
+		dag_1000_entry_or_32_32_0_op0[31:0] = dag_1000_entry_63_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_8)) begin
+		dag_1000_entry_or_32_32_0_op0[31:0] = dag_1000_entry_68_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_14)) begin
+		dag_1000_entry_or_32_32_0_op0[31:0] = dag_1000_entry_160[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_16)) begin
+		dag_1000_entry_or_32_32_0_op0[31:0] = dag_1000_entry_203[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_17)) begin
+		dag_1000_entry_or_32_32_0_op0[31:0] = dag_1000_entry_203_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_18)) begin
+		dag_1000_entry_or_32_32_0_op0[31:0] = dag_1000_entry_208_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_20)) begin
+		dag_1000_entry_or_32_32_0_op0[31:0] = dag_1000_entry_232[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_22)) begin
+		dag_1000_entry_or_32_32_0_op0[31:0] = dag_1000_entry_248_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_24)) begin
+		dag_1000_entry_or_32_32_0_op0[31:0] = dag_1000_entry_278_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_25)) begin
+		dag_1000_entry_or_32_32_0_op0[31:0] = dag_1000_entry_281_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_31)) begin
+		dag_1000_entry_or_32_32_0_op0[31:0] = dag_1000_entry_348_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_33)) begin
+		dag_1000_entry_or_32_32_0_op0[31:0] = dag_1000_entry_385_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_36)) begin
+		dag_1000_entry_or_32_32_0_op0[31:0] = dag_1000_entry_454[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_39)) begin
+		dag_1000_entry_or_32_32_0_op0[31:0] = dag_1000_entry_474_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_40)) begin
+		dag_1000_entry_or_32_32_0_op0[31:0] = dag_1000_entry_475_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_41)) begin
+		dag_1000_entry_or_32_32_0_op0[31:0] = dag_1000_entry_487_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_42)) begin
+		dag_1000_entry_or_32_32_0_op0[31:0] = dag_1000_entry_513_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_45)) begin
+		dag_1000_entry_or_32_32_0_op0[31:0] = dag_1000_entry_617[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_47)) begin
+		dag_1000_entry_or_32_32_0_op0[31:0] = dag_1000_entry_638[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_48)) begin
+		dag_1000_entry_or_32_32_0_op0[31:0] = dag_1000_entry_672[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_49)) begin
+		dag_1000_entry_or_32_32_0_op0[31:0] = dag_1000_entry_771[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_52)) begin
+		dag_1000_entry_or_32_32_0_op0[31:0] = dag_1000_entry_777_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_57)) begin
+		dag_1000_entry_or_32_32_0_op0[31:0] = dag_1000_entry_818_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_61)) begin
+		dag_1000_entry_or_32_32_0_op0[31:0] = dag_1000_entry_868_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_65)) begin
+		dag_1000_entry_or_32_32_0_op0[31:0] = dag_1000_entry_915_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_66)) begin
+		dag_1000_entry_or_32_32_0_op0[31:0] = dag_1000_entry_214_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_77)) begin
+		dag_1000_entry_or_32_32_0_op0[31:0] = dag_1000_entry_381[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_78)) begin
+		dag_1000_entry_or_32_32_0_op0[31:0] = dag_1000_entry_414_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_1000_BB_0_S_79)) */ begin
+		dag_1000_entry_or_32_32_0_op0[31:0] = dag_1000_entry_730_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_0)) begin
+		dag_1000_entry_or_32_32_0_op1[31:0] = arg_1[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_5)) begin
+		dag_1000_entry_or_32_32_0_op1[31:0] = dag_1000_entry_27[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_7)) begin
+		dag_1000_entry_or_32_32_0_op1[31:0] = dag_1000_entry_69[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_8)) begin
+		dag_1000_entry_or_32_32_0_op1[31:0] = dag_1000_entry_94_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_14)) begin
+		dag_1000_entry_or_32_32_0_op1[31:0] = dag_1000_entry_159[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_16)) begin
+		dag_1000_entry_or_32_32_0_op1[31:0] = dag_1000_entry_203[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_17)) begin
+		dag_1000_entry_or_32_32_0_op1[31:0] = dag_1000_entry_203_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_18)) begin
+		dag_1000_entry_or_32_32_0_op1[31:0] = dag_1000_entry_203_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_20)) begin
+		dag_1000_entry_or_32_32_0_op1[31:0] = dag_1000_entry_226_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_22)) begin
+		dag_1000_entry_or_32_32_0_op1[31:0] = dag_1000_entry_244[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_24)) begin
+		dag_1000_entry_or_32_32_0_op1[31:0] = dag_1000_entry_268[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_25)) begin
+		dag_1000_entry_or_32_32_0_op1[31:0] = dag_1000_entry_274[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_31)) begin
+		dag_1000_entry_or_32_32_0_op1[31:0] = dag_1000_entry_364[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_33)) begin
+		dag_1000_entry_or_32_32_0_op1[31:0] = dag_1000_entry_397[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_36)) begin
+		dag_1000_entry_or_32_32_0_op1[31:0] = dag_1000_entry_455_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_39)) begin
+		dag_1000_entry_or_32_32_0_op1[31:0] = dag_1000_entry_484[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_40)) begin
+		dag_1000_entry_or_32_32_0_op1[31:0] = dag_1000_entry_474_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_41)) begin
+		dag_1000_entry_or_32_32_0_op1[31:0] = dag_1000_entry_487_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_42)) begin
+		dag_1000_entry_or_32_32_0_op1[31:0] = dag_1000_entry_513_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_45)) begin
+		dag_1000_entry_or_32_32_0_op1[31:0] = dag_1000_entry_621[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_47)) begin
+		dag_1000_entry_or_32_32_0_op1[31:0] = dag_1000_entry_638[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_48)) begin
+		dag_1000_entry_or_32_32_0_op1[31:0] = dag_1000_entry_653_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_49)) begin
+		dag_1000_entry_or_32_32_0_op1[31:0] = dag_1000_entry_741_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_52)) begin
+		dag_1000_entry_or_32_32_0_op1[31:0] = dag_1000_entry_787[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_57)) begin
+		dag_1000_entry_or_32_32_0_op1[31:0] = dag_1000_entry_832[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_61)) begin
+		dag_1000_entry_or_32_32_0_op1[31:0] = dag_1000_entry_860[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_65)) begin
+		dag_1000_entry_or_32_32_0_op1[31:0] = dag_1000_entry_923[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_66)) begin
+		dag_1000_entry_or_32_32_0_op1[31:0] = dag_1000_entry_209_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_77)) begin
+		dag_1000_entry_or_32_32_0_op1[31:0] = dag_1000_entry_386_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_78)) begin
+		dag_1000_entry_or_32_32_0_op1[31:0] = dag_1000_entry_428_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_1000_BB_0_S_79)) */ begin
+		dag_1000_entry_or_32_32_0_op1[31:0] = dag_1000_entry_717_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_or_32_32_0[31:0] = (dag_1000_entry_or_32_32_0_op0 | dag_1000_entry_or_32_32_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_0)) begin
+		dag_1000_entry_add_16_16_0_op0[15:0] = arg_2[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_1)) begin
+		dag_1000_entry_add_16_16_0_op0[15:0] = arg_2[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_6)) begin
+		dag_1000_entry_add_16_16_0_op0[15:0] = dag_1000_entry_73_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_7)) begin
+		dag_1000_entry_add_16_16_0_op0[15:0] = dag_1000_entry_93_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_8)) begin
+		dag_1000_entry_add_16_16_0_op0[15:0] = dag_1000_entry_109_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_9)) begin
+		dag_1000_entry_add_16_16_0_op0[15:0] = dag_1000_entry_150_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_10)) begin
+		dag_1000_entry_add_16_16_0_op0[15:0] = dag_1000_entry_191_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_11)) begin
+		dag_1000_entry_add_16_16_0_op0[15:0] = dag_1000_entry_194_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_12)) begin
+		dag_1000_entry_add_16_16_0_op0[15:0] = dag_1000_entry_220_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_13)) begin
+		dag_1000_entry_add_16_16_0_op0[15:0] = dag_1000_entry_247_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_14)) begin
+		dag_1000_entry_add_16_16_0_op0[15:0] = dag_1000_entry_272_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_15)) begin
+		dag_1000_entry_add_16_16_0_op0[15:0] = dag_1000_entry_294_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_16)) begin
+		dag_1000_entry_add_16_16_0_op0[15:0] = dag_1000_entry_313_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_17)) begin
+		dag_1000_entry_add_16_16_0_op0[15:0] = dag_1000_entry_349[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_18)) begin
+		dag_1000_entry_add_16_16_0_op0[15:0] = dag_1000_entry_365_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_19)) begin
+		dag_1000_entry_add_16_16_0_op0[15:0] = dag_1000_entry_349_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_20)) begin
+		dag_1000_entry_add_16_16_0_op0[15:0] = dag_1000_entry_352_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_21)) begin
+		dag_1000_entry_add_16_16_0_op0[15:0] = dag_1000_entry_418_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_22)) begin
+		dag_1000_entry_add_16_16_0_op0[15:0] = dag_1000_entry_451[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_23)) begin
+		dag_1000_entry_add_16_16_0_op0[15:0] = dag_1000_entry_445_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_24)) begin
+		dag_1000_entry_add_16_16_0_op0[15:0] = dag_1000_entry_481_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_25)) begin
+		dag_1000_entry_add_16_16_0_op0[15:0] = dag_1000_entry_514_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_42)) begin
+		dag_1000_entry_add_16_16_0_op0[15:0] = dag_1000_entry_618[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_44)) begin
+		dag_1000_entry_add_16_16_0_op0[15:0] = dag_1000_entry_665_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_45)) begin
+		dag_1000_entry_add_16_16_0_op0[15:0] = dag_1000_entry_681_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_46)) begin
+		dag_1000_entry_add_16_16_0_op0[15:0] = dag_1000_entry_744_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_47)) begin
+		dag_1000_entry_add_16_16_0_op0[15:0] = dag_1000_entry_829[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_64)) begin
+		dag_1000_entry_add_16_16_0_op0[15:0] = dag_1000_entry_853_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_66)) begin
+		dag_1000_entry_add_16_16_0_op0[15:0] = dag_1000_entry_932_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_67)) begin
+		dag_1000_entry_add_16_16_0_op0[15:0] = dag_1000_entry_206_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_68)) begin
+		dag_1000_entry_add_16_16_0_op0[15:0] = dag_1000_entry_445_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_69)) begin
+		dag_1000_entry_add_16_16_0_op0[15:0] = dag_1000_entry_590_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_70)) begin
+		dag_1000_entry_add_16_16_0_op0[15:0] = dag_1000_entry_619_reg;
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_71)) begin
+		dag_1000_entry_add_16_16_0_op0[15:0] = dag_1000_entry_596_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_72)) begin
+		dag_1000_entry_add_16_16_0_op0[15:0] = dag_1000_entry_681_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_73)) begin
+		dag_1000_entry_add_16_16_0_op0[15:0] = dag_1000_entry_859_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_74)) begin
+		dag_1000_entry_add_16_16_0_op0[15:0] = dag_1000_entry_914_reg[15:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_1000_BB_0_S_75)) */ begin
+		dag_1000_entry_add_16_16_0_op0[15:0] = dag_1000_entry_937_reg[15:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_0)) begin
+		dag_1000_entry_add_16_16_0_op1[15:0] = arg_2[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_1)) begin
+		dag_1000_entry_add_16_16_0_op1[15:0] = dag_1000_entry_14_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_6)) begin
+		dag_1000_entry_add_16_16_0_op1[15:0] = dag_1000_entry_81[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_7)) begin
+		dag_1000_entry_add_16_16_0_op1[15:0] = dag_1000_entry_88_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_8)) begin
+		dag_1000_entry_add_16_16_0_op1[15:0] = dag_1000_entry_117_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_9)) begin
+		dag_1000_entry_add_16_16_0_op1[15:0] = dag_1000_entry_128_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_10)) begin
+		dag_1000_entry_add_16_16_0_op1[15:0] = dag_1000_entry_180_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_11)) begin
+		dag_1000_entry_add_16_16_0_op1[15:0] = dag_1000_entry_199_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_12)) begin
+		dag_1000_entry_add_16_16_0_op1[15:0] = dag_1000_entry_194_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_13)) begin
+		dag_1000_entry_add_16_16_0_op1[15:0] = dag_1000_entry_220_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_14)) begin
+		dag_1000_entry_add_16_16_0_op1[15:0] = dag_1000_entry_249_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_15)) begin
+		dag_1000_entry_add_16_16_0_op1[15:0] = dag_1000_entry_298_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_16)) begin
+		dag_1000_entry_add_16_16_0_op1[15:0] = dag_1000_entry_305_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_17)) begin
+		dag_1000_entry_add_16_16_0_op1[15:0] = dag_1000_entry_352[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_18)) begin
+		dag_1000_entry_add_16_16_0_op1[15:0] = dag_1000_entry_352_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_19)) begin
+		dag_1000_entry_add_16_16_0_op1[15:0] = dag_1000_entry_368_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_20)) begin
+		dag_1000_entry_add_16_16_0_op1[15:0] = dag_1000_entry_352_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_21)) begin
+		dag_1000_entry_add_16_16_0_op1[15:0] = dag_1000_entry_432_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_22)) begin
+		dag_1000_entry_add_16_16_0_op1[15:0] = dag_1000_entry_446[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_23)) begin
+		dag_1000_entry_add_16_16_0_op1[15:0] = dag_1000_entry_446_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_24)) begin
+		dag_1000_entry_add_16_16_0_op1[15:0] = dag_1000_entry_485[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_25)) begin
+		dag_1000_entry_add_16_16_0_op1[15:0] = dag_1000_entry_537[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_42)) begin
+		dag_1000_entry_add_16_16_0_op1[15:0] = dag_1000_entry_637_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_44)) begin
+		dag_1000_entry_add_16_16_0_op1[15:0] = dag_1000_entry_661_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_45)) begin
+		dag_1000_entry_add_16_16_0_op1[15:0] = dag_1000_entry_698_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_46)) begin
+		dag_1000_entry_add_16_16_0_op1[15:0] = dag_1000_entry_737_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_47)) begin
+		dag_1000_entry_add_16_16_0_op1[15:0] = dag_1000_entry_851[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_64)) begin
+		dag_1000_entry_add_16_16_0_op1[15:0] = dag_1000_entry_861_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_66)) begin
+		dag_1000_entry_add_16_16_0_op1[15:0] = dag_1000_entry_929[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_67)) begin
+		dag_1000_entry_add_16_16_0_op1[15:0] = dag_1000_entry_207_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_68)) begin
+		dag_1000_entry_add_16_16_0_op1[15:0] = dag_1000_entry_453_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_69)) begin
+		dag_1000_entry_add_16_16_0_op1[15:0] = dag_1000_entry_569_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_70)) begin
+		dag_1000_entry_add_16_16_0_op1[15:0] = dag_1000_entry_622_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_71)) begin
+		dag_1000_entry_add_16_16_0_op1[15:0] = dag_1000_entry_619_reg;
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_72)) begin
+		dag_1000_entry_add_16_16_0_op1[15:0] = dag_1000_entry_681_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_73)) begin
+		dag_1000_entry_add_16_16_0_op1[15:0] = dag_1000_entry_867[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_74)) begin
+		dag_1000_entry_add_16_16_0_op1[15:0] = dag_1000_entry_929_reg[15:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_1000_BB_0_S_75)) */ begin
+		dag_1000_entry_add_16_16_0_op1[15:0] = dag_1000_entry_937_reg[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_add_16_16_0[15:0] = (dag_1000_entry_add_16_16_0_op0 + dag_1000_entry_add_16_16_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_0)) begin
+		dag_1000_entry_add_16_16_1_op0[15:0] = arg_3[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_1)) begin
+		dag_1000_entry_add_16_16_1_op0[15:0] = dag_1000_entry_35[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_2)) begin
+		dag_1000_entry_add_16_16_1_op0[15:0] = dag_1000_entry_58_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_5)) begin
+		dag_1000_entry_add_16_16_1_op0[15:0] = dag_1000_entry_48[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_6)) begin
+		dag_1000_entry_add_16_16_1_op0[15:0] = dag_1000_entry_81[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_7)) begin
+		dag_1000_entry_add_16_16_1_op0[15:0] = dag_1000_entry_112[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_8)) begin
+		dag_1000_entry_add_16_16_1_op0[15:0] = dag_1000_entry_115_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_9)) begin
+		dag_1000_entry_add_16_16_1_op0[15:0] = dag_1000_entry_193_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_10)) begin
+		dag_1000_entry_add_16_16_1_op0[15:0] = dag_1000_entry_189_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_11)) begin
+		dag_1000_entry_add_16_16_1_op0[15:0] = dag_1000_entry_213[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_12)) begin
+		dag_1000_entry_add_16_16_1_op0[15:0] = dag_1000_entry_218_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_13)) begin
+		dag_1000_entry_add_16_16_1_op0[15:0] = dag_1000_entry_235_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_14)) begin
+		dag_1000_entry_add_16_16_1_op0[15:0] = dag_1000_entry_264_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_15)) begin
+		dag_1000_entry_add_16_16_1_op0[15:0] = dag_1000_entry_310_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_16)) begin
+		dag_1000_entry_add_16_16_1_op0[15:0] = dag_1000_entry_321[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_17)) begin
+		dag_1000_entry_add_16_16_1_op0[15:0] = dag_1000_entry_310_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_18)) begin
+		dag_1000_entry_add_16_16_1_op0[15:0] = dag_1000_entry_365_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_19)) begin
+		dag_1000_entry_add_16_16_1_op0[15:0] = dag_1000_entry_365_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_20)) begin
+		dag_1000_entry_add_16_16_1_op0[15:0] = dag_1000_entry_425[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_21)) begin
+		dag_1000_entry_add_16_16_1_op0[15:0] = dag_1000_entry_431_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_22)) begin
+		dag_1000_entry_add_16_16_1_op0[15:0] = dag_1000_entry_431_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_24)) begin
+		dag_1000_entry_add_16_16_1_op0[15:0] = dag_1000_entry_496[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_25)) begin
+		dag_1000_entry_add_16_16_1_op0[15:0] = dag_1000_entry_552[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_43)) begin
+		dag_1000_entry_add_16_16_1_op0[15:0] = dag_1000_entry_658_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_44)) begin
+		dag_1000_entry_add_16_16_1_op0[15:0] = dag_1000_entry_678[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_45)) begin
+		dag_1000_entry_add_16_16_1_op0[15:0] = dag_1000_entry_698_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_46)) begin
+		dag_1000_entry_add_16_16_1_op0[15:0] = dag_1000_entry_764[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_63)) begin
+		dag_1000_entry_add_16_16_1_op0[15:0] = dag_1000_entry_909[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_65)) begin
+		dag_1000_entry_add_16_16_1_op0[15:0] = dag_1000_entry_911[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_66)) begin
+		dag_1000_entry_add_16_16_1_op0[15:0] = dag_1000_entry_955[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_67)) begin
+		dag_1000_entry_add_16_16_1_op0[15:0] = dag_1000_entry_955_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_68)) begin
+		dag_1000_entry_add_16_16_1_op0[15:0] = dag_1000_entry_558_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_69)) begin
+		dag_1000_entry_add_16_16_1_op0[15:0] = dag_1000_entry_565_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_70)) begin
+		dag_1000_entry_add_16_16_1_op0[15:0] = dag_1000_entry_577_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_72)) begin
+		dag_1000_entry_add_16_16_1_op0[15:0] = dag_1000_entry_631_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_73)) begin
+		dag_1000_entry_add_16_16_1_op0[15:0] = dag_1000_entry_837_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_74)) begin
+		dag_1000_entry_add_16_16_1_op0[15:0] = dag_1000_entry_929_reg[15:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_1000_BB_0_S_76)) */ begin
+		dag_1000_entry_add_16_16_1_op0[15:0] = dag_1000_entry_973_reg[15:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_0)) begin
+		dag_1000_entry_add_16_16_1_op1[15:0] = arg_2[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_1)) begin
+		dag_1000_entry_add_16_16_1_op1[15:0] = dag_1000_entry_19_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_2)) begin
+		dag_1000_entry_add_16_16_1_op1[15:0] = dag_1000_entry_19_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_5)) begin
+		dag_1000_entry_add_16_16_1_op1[15:0] = dag_1000_entry_35_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_6)) begin
+		dag_1000_entry_add_16_16_1_op1[15:0] = dag_1000_entry_85_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_7)) begin
+		dag_1000_entry_add_16_16_1_op1[15:0] = dag_1000_entry_112[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_8)) begin
+		dag_1000_entry_add_16_16_1_op1[15:0] = dag_1000_entry_130_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_9)) begin
+		dag_1000_entry_add_16_16_1_op1[15:0] = dag_1000_entry_175_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_10)) begin
+		dag_1000_entry_add_16_16_1_op1[15:0] = dag_1000_entry_202_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_11)) begin
+		dag_1000_entry_add_16_16_1_op1[15:0] = dag_1000_entry_194_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_12)) begin
+		dag_1000_entry_add_16_16_1_op1[15:0] = dag_1000_entry_213_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_13)) begin
+		dag_1000_entry_add_16_16_1_op1[15:0] = dag_1000_entry_254[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_14)) begin
+		dag_1000_entry_add_16_16_1_op1[15:0] = dag_1000_entry_290_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_15)) begin
+		dag_1000_entry_add_16_16_1_op1[15:0] = dag_1000_entry_304[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_16)) begin
+		dag_1000_entry_add_16_16_1_op1[15:0] = dag_1000_entry_322_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_17)) begin
+		dag_1000_entry_add_16_16_1_op1[15:0] = dag_1000_entry_323_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_18)) begin
+		dag_1000_entry_add_16_16_1_op1[15:0] = dag_1000_entry_352_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_19)) begin
+		dag_1000_entry_add_16_16_1_op1[15:0] = dag_1000_entry_368_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_20)) begin
+		dag_1000_entry_add_16_16_1_op1[15:0] = dag_1000_entry_413_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_21)) begin
+		dag_1000_entry_add_16_16_1_op1[15:0] = dag_1000_entry_425_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_22)) begin
+		dag_1000_entry_add_16_16_1_op1[15:0] = dag_1000_entry_437_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_24)) begin
+		dag_1000_entry_add_16_16_1_op1[15:0] = dag_1000_entry_496[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_25)) begin
+		dag_1000_entry_add_16_16_1_op1[15:0] = dag_1000_entry_549[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_43)) begin
+		dag_1000_entry_add_16_16_1_op1[15:0] = dag_1000_entry_659[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_44)) begin
+		dag_1000_entry_add_16_16_1_op1[15:0] = dag_1000_entry_674[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_45)) begin
+		dag_1000_entry_add_16_16_1_op1[15:0] = dag_1000_entry_742_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_46)) begin
+		dag_1000_entry_add_16_16_1_op1[15:0] = dag_1000_entry_750[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_63)) begin
+		dag_1000_entry_add_16_16_1_op1[15:0] = dag_1000_entry_909[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_65)) begin
+		dag_1000_entry_add_16_16_1_op1[15:0] = dag_1000_entry_901_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_66)) begin
+		dag_1000_entry_add_16_16_1_op1[15:0] = dag_1000_entry_955[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_67)) begin
+		dag_1000_entry_add_16_16_1_op1[15:0] = dag_1000_entry_971_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_68)) begin
+		dag_1000_entry_add_16_16_1_op1[15:0] = dag_1000_entry_556_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_69)) begin
+		dag_1000_entry_add_16_16_1_op1[15:0] = dag_1000_entry_552_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_70)) begin
+		dag_1000_entry_add_16_16_1_op1[15:0] = dag_1000_entry_585_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_72)) begin
+		dag_1000_entry_add_16_16_1_op1[15:0] = dag_1000_entry_641[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_73)) begin
+		dag_1000_entry_add_16_16_1_op1[15:0] = dag_1000_entry_827_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_74)) begin
+		dag_1000_entry_add_16_16_1_op1[15:0] = dag_1000_entry_928_reg[15:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_1000_BB_0_S_76)) */ begin
+		dag_1000_entry_add_16_16_1_op1[15:0] = dag_1000_entry_975[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_add_16_16_1[15:0] = (dag_1000_entry_add_16_16_1_op0 + dag_1000_entry_add_16_16_1_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_1)) begin
+		dag_1000_entry_mul_16_16_0_op0[15:0] = dag_1000_entry_35[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_3)) begin
+		dag_1000_entry_mul_16_16_0_op0[15:0] = dag_1000_entry_47[63:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_4)) begin
+		dag_1000_entry_mul_16_16_0_op0[15:0] = dag_1000_entry_72_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_5)) begin
+		dag_1000_entry_mul_16_16_0_op0[15:0] = dag_1000_entry_78_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_6)) begin
+		dag_1000_entry_mul_16_16_0_op0[15:0] = dag_1000_entry_78_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_7)) begin
+		dag_1000_entry_mul_16_16_0_op0[15:0] = dag_1000_entry_116[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_13)) begin
+		dag_1000_entry_mul_16_16_0_op0[15:0] = dag_1000_entry_264[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_16)) begin
+		dag_1000_entry_mul_16_16_0_op0[15:0] = dag_1000_entry_321[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_17)) begin
+		dag_1000_entry_mul_16_16_0_op0[15:0] = dag_1000_entry_349[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_18)) begin
+		dag_1000_entry_mul_16_16_0_op0[15:0] = dag_1000_entry_334_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_19)) begin
+		dag_1000_entry_mul_16_16_0_op0[15:0] = dag_1000_entry_369[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_20)) begin
+		dag_1000_entry_mul_16_16_0_op0[15:0] = dag_1000_entry_399_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_21)) begin
+		dag_1000_entry_mul_16_16_0_op0[15:0] = dag_1000_entry_421_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_22)) begin
+		dag_1000_entry_mul_16_16_0_op0[15:0] = dag_1000_entry_441_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_23)) begin
+		dag_1000_entry_mul_16_16_0_op0[15:0] = dag_1000_entry_453_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_24)) begin
+		dag_1000_entry_mul_16_16_0_op0[15:0] = dag_1000_entry_471_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_25)) begin
+		dag_1000_entry_mul_16_16_0_op0[15:0] = dag_1000_entry_470_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_26)) begin
+		dag_1000_entry_mul_16_16_0_op0[15:0] = dag_1000_entry_499_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_27)) begin
+		dag_1000_entry_mul_16_16_0_op0[15:0] = dag_1000_entry_549_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_42)) begin
+		dag_1000_entry_mul_16_16_0_op0[15:0] = dag_1000_entry_649[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_43)) begin
+		dag_1000_entry_mul_16_16_0_op0[15:0] = dag_1000_entry_665[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_44)) begin
+		dag_1000_entry_mul_16_16_0_op0[15:0] = dag_1000_entry_698[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_45)) begin
+		dag_1000_entry_mul_16_16_0_op0[15:0] = dag_1000_entry_729[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_46)) begin
+		dag_1000_entry_mul_16_16_0_op0[15:0] = dag_1000_entry_742_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_47)) begin
+		dag_1000_entry_mul_16_16_0_op0[15:0] = dag_1000_entry_769_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_48)) begin
+		dag_1000_entry_mul_16_16_0_op0[15:0] = dag_1000_entry_828_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_49)) begin
+		dag_1000_entry_mul_16_16_0_op0[15:0] = dag_1000_entry_861_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_65)) begin
+		dag_1000_entry_mul_16_16_0_op0[15:0] = dag_1000_entry_911[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_66)) begin
+		dag_1000_entry_mul_16_16_0_op0[15:0] = dag_1000_entry_899_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_67)) begin
+		dag_1000_entry_mul_16_16_0_op0[15:0] = dag_1000_entry_112_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_68)) begin
+		dag_1000_entry_mul_16_16_0_op0[15:0] = dag_1000_entry_794_reg[15:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_1000_BB_0_S_74)) */ begin
+		dag_1000_entry_mul_16_16_0_op0[15:0] = dag_1000_entry_933[15:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_1)) begin
+		dag_1000_entry_mul_16_16_0_op1[15:0] = dag_1000_entry_37_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_3)) begin
+		dag_1000_entry_mul_16_16_0_op1[15:0] = dag_1000_entry_70_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_4)) begin
+		dag_1000_entry_mul_16_16_0_op1[15:0] = dag_1000_entry_73[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_5)) begin
+		dag_1000_entry_mul_16_16_0_op1[15:0] = dag_1000_entry_74[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_6)) begin
+		dag_1000_entry_mul_16_16_0_op1[15:0] = dag_1000_entry_82[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_7)) begin
+		dag_1000_entry_mul_16_16_0_op1[15:0] = dag_1000_entry_106[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_13)) begin
+		dag_1000_entry_mul_16_16_0_op1[15:0] = dag_1000_entry_270_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_16)) begin
+		dag_1000_entry_mul_16_16_0_op1[15:0] = dag_1000_entry_323[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_17)) begin
+		dag_1000_entry_mul_16_16_0_op1[15:0] = dag_1000_entry_325_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_18)) begin
+		dag_1000_entry_mul_16_16_0_op1[15:0] = dag_1000_entry_360_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_19)) begin
+		dag_1000_entry_mul_16_16_0_op1[15:0] = dag_1000_entry_351_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_20)) begin
+		dag_1000_entry_mul_16_16_0_op1[15:0] = dag_1000_entry_413_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_21)) begin
+		dag_1000_entry_mul_16_16_0_op1[15:0] = dag_1000_entry_418_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_22)) begin
+		dag_1000_entry_mul_16_16_0_op1[15:0] = dag_1000_entry_437_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_23)) begin
+		dag_1000_entry_mul_16_16_0_op1[15:0] = dag_1000_entry_453_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_24)) begin
+		dag_1000_entry_mul_16_16_0_op1[15:0] = dag_1000_entry_481_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_25)) begin
+		dag_1000_entry_mul_16_16_0_op1[15:0] = dag_1000_entry_473_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_26)) begin
+		dag_1000_entry_mul_16_16_0_op1[15:0] = dag_1000_entry_516_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_27)) begin
+		dag_1000_entry_mul_16_16_0_op1[15:0] = dag_1000_entry_562_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_42)) begin
+		dag_1000_entry_mul_16_16_0_op1[15:0] = dag_1000_entry_622[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_43)) begin
+		dag_1000_entry_mul_16_16_0_op1[15:0] = dag_1000_entry_659[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_44)) begin
+		dag_1000_entry_mul_16_16_0_op1[15:0] = dag_1000_entry_680_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_45)) begin
+		dag_1000_entry_mul_16_16_0_op1[15:0] = dag_1000_entry_729[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_46)) begin
+		dag_1000_entry_mul_16_16_0_op1[15:0] = dag_1000_entry_712_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_47)) begin
+		dag_1000_entry_mul_16_16_0_op1[15:0] = dag_1000_entry_802_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_48)) begin
+		dag_1000_entry_mul_16_16_0_op1[15:0] = dag_1000_entry_828_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_49)) begin
+		dag_1000_entry_mul_16_16_0_op1[15:0] = dag_1000_entry_871_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_65)) begin
+		dag_1000_entry_mul_16_16_0_op1[15:0] = dag_1000_entry_906_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_66)) begin
+		dag_1000_entry_mul_16_16_0_op1[15:0] = dag_1000_entry_890_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_67)) begin
+		dag_1000_entry_mul_16_16_0_op1[15:0] = dag_1000_entry_117_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_68)) begin
+		dag_1000_entry_mul_16_16_0_op1[15:0] = dag_1000_entry_806_reg[15:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_1000_BB_0_S_74)) */ begin
+		dag_1000_entry_mul_16_16_0_op1[15:0] = dag_1000_entry_930[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_mul_16_16_0[15:0] = (dag_1000_entry_mul_16_16_0_op0 * dag_1000_entry_mul_16_16_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_2)) begin
+		dag_1000_entry_mul_32_32_0_op0[31:0] = dag_1000_entry_40[63:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_6)) begin
+		dag_1000_entry_mul_32_32_0_op0[31:0] = dag_1000_entry_63[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_7)) begin
+		dag_1000_entry_mul_32_32_0_op0[31:0] = dag_1000_entry_61_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_9)) begin
+		dag_1000_entry_mul_32_32_0_op0[31:0] = dag_1000_entry_108_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_10)) begin
+		dag_1000_entry_mul_32_32_0_op0[31:0] = dag_1000_entry_129_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_11)) begin
+		dag_1000_entry_mul_32_32_0_op0[31:0] = dag_1000_entry_139_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_14)) begin
+		dag_1000_entry_mul_32_32_0_op0[31:0] = dag_1000_entry_153_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_19)) begin
+		dag_1000_entry_mul_32_32_0_op0[31:0] = dag_1000_entry_226[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_26)) begin
+		dag_1000_entry_mul_32_32_0_op0[31:0] = dag_1000_entry_296_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_27)) begin
+		dag_1000_entry_mul_32_32_0_op0[31:0] = dag_1000_entry_306_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_28)) begin
+		dag_1000_entry_mul_32_32_0_op0[31:0] = dag_1000_entry_296_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_29)) begin
+		dag_1000_entry_mul_32_32_0_op0[31:0] = dag_1000_entry_307_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_30)) begin
+		dag_1000_entry_mul_32_32_0_op0[31:0] = dag_1000_entry_341_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_31)) begin
+		dag_1000_entry_mul_32_32_0_op0[31:0] = dag_1000_entry_348_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_32)) begin
+		dag_1000_entry_mul_32_32_0_op0[31:0] = dag_1000_entry_382_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_33)) begin
+		dag_1000_entry_mul_32_32_0_op0[31:0] = dag_1000_entry_386_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_37)) begin
+		dag_1000_entry_mul_32_32_0_op0[31:0] = dag_1000_entry_465_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_38)) begin
+		dag_1000_entry_mul_32_32_0_op0[31:0] = dag_1000_entry_483[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_39)) begin
+		dag_1000_entry_mul_32_32_0_op0[31:0] = dag_1000_entry_498_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_45)) begin
+		dag_1000_entry_mul_32_32_0_op0[31:0] = dag_1000_entry_607_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_46)) begin
+		dag_1000_entry_mul_32_32_0_op0[31:0] = dag_1000_entry_635_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_47)) begin
+		dag_1000_entry_mul_32_32_0_op0[31:0] = dag_1000_entry_620_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_48)) begin
+		dag_1000_entry_mul_32_32_0_op0[31:0] = dag_1000_entry_670_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_49)) begin
+		dag_1000_entry_mul_32_32_0_op0[31:0] = dag_1000_entry_689_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_51)) begin
+		dag_1000_entry_mul_32_32_0_op0[31:0] = dag_1000_entry_771_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_53)) begin
+		dag_1000_entry_mul_32_32_0_op0[31:0] = dag_1000_entry_790_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_54)) begin
+		dag_1000_entry_mul_32_32_0_op0[31:0] = dag_1000_entry_685_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_55)) begin
+		dag_1000_entry_mul_32_32_0_op0[31:0] = dag_1000_entry_815_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_68)) begin
+		dag_1000_entry_mul_32_32_0_op0[31:0] = dag_1000_entry_869_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_69)) begin
+		dag_1000_entry_mul_32_32_0_op0[31:0] = dag_1000_entry_915_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_70)) begin
+		dag_1000_entry_mul_32_32_0_op0[31:0] = dag_1000_entry_923_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_71)) begin
+		dag_1000_entry_mul_32_32_0_op0[31:0] = dag_1000_entry_533[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_72)) begin
+		dag_1000_entry_mul_32_32_0_op0[31:0] = dag_1000_entry_762_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_73)) begin
+		dag_1000_entry_mul_32_32_0_op0[31:0] = dag_1000_entry_999_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_74)) begin
+		dag_1000_entry_mul_32_32_0_op0[31:0] = dag_1000_entry_54_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_75)) begin
+		dag_1000_entry_mul_32_32_0_op0[31:0] = dag_1000_entry_145[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_76)) begin
+		dag_1000_entry_mul_32_32_0_op0[31:0] = dag_1000_entry_376_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_78)) begin
+		dag_1000_entry_mul_32_32_0_op0[31:0] = dag_1000_entry_434[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_79)) begin
+		dag_1000_entry_mul_32_32_0_op0[31:0] = dag_1000_entry_535_reg;
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_80)) begin
+		dag_1000_entry_mul_32_32_0_op0[31:0] = dag_1000_entry_635_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_81)) begin
+		dag_1000_entry_mul_32_32_0_op0[31:0] = dag_1000_entry_775_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_1000_BB_0_S_82)) */ begin
+		dag_1000_entry_mul_32_32_0_op0[31:0] = dag_1000_entry_990_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_2)) begin
+		dag_1000_entry_mul_32_32_0_op1[31:0] = dag_1000_entry_38_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_6)) begin
+		dag_1000_entry_mul_32_32_0_op1[31:0] = dag_1000_entry_61_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_7)) begin
+		dag_1000_entry_mul_32_32_0_op1[31:0] = dag_1000_entry_63_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_9)) begin
+		dag_1000_entry_mul_32_32_0_op1[31:0] = dag_1000_entry_119_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_10)) begin
+		dag_1000_entry_mul_32_32_0_op1[31:0] = dag_1000_entry_111_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_11)) begin
+		dag_1000_entry_mul_32_32_0_op1[31:0] = dag_1000_entry_139_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_14)) begin
+		dag_1000_entry_mul_32_32_0_op1[31:0] = dag_1000_entry_149[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_19)) begin
+		dag_1000_entry_mul_32_32_0_op1[31:0] = dag_1000_entry_215_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_26)) begin
+		dag_1000_entry_mul_32_32_0_op1[31:0] = dag_1000_entry_283[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_27)) begin
+		dag_1000_entry_mul_32_32_0_op1[31:0] = dag_1000_entry_285_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_28)) begin
+		dag_1000_entry_mul_32_32_0_op1[31:0] = dag_1000_entry_303_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_29)) begin
+		dag_1000_entry_mul_32_32_0_op1[31:0] = dag_1000_entry_306_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_30)) begin
+		dag_1000_entry_mul_32_32_0_op1[31:0] = dag_1000_entry_329_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_31)) begin
+		dag_1000_entry_mul_32_32_0_op1[31:0] = dag_1000_entry_362_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_32)) begin
+		dag_1000_entry_mul_32_32_0_op1[31:0] = dag_1000_entry_364_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_33)) begin
+		dag_1000_entry_mul_32_32_0_op1[31:0] = dag_1000_entry_385_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_37)) begin
+		dag_1000_entry_mul_32_32_0_op1[31:0] = dag_1000_entry_474[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_38)) begin
+		dag_1000_entry_mul_32_32_0_op1[31:0] = dag_1000_entry_483[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_39)) begin
+		dag_1000_entry_mul_32_32_0_op1[31:0] = dag_1000_entry_492_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_45)) begin
+		dag_1000_entry_mul_32_32_0_op1[31:0] = dag_1000_entry_575_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_46)) begin
+		dag_1000_entry_mul_32_32_0_op1[31:0] = dag_1000_entry_626_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_47)) begin
+		dag_1000_entry_mul_32_32_0_op1[31:0] = dag_1000_entry_638[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_48)) begin
+		dag_1000_entry_mul_32_32_0_op1[31:0] = dag_1000_entry_661_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_49)) begin
+		dag_1000_entry_mul_32_32_0_op1[31:0] = dag_1000_entry_719_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_51)) begin
+		dag_1000_entry_mul_32_32_0_op1[31:0] = dag_1000_entry_758[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_53)) begin
+		dag_1000_entry_mul_32_32_0_op1[31:0] = dag_1000_entry_791[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_54)) begin
+		dag_1000_entry_mul_32_32_0_op1[31:0] = dag_1000_entry_685_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_55)) begin
+		dag_1000_entry_mul_32_32_0_op1[31:0] = dag_1000_entry_813_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_68)) begin
+		dag_1000_entry_mul_32_32_0_op1[31:0] = dag_1000_entry_884[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_69)) begin
+		dag_1000_entry_mul_32_32_0_op1[31:0] = dag_1000_entry_948_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_70)) begin
+		dag_1000_entry_mul_32_32_0_op1[31:0] = dag_1000_entry_953_reg[8:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_71)) begin
+		dag_1000_entry_mul_32_32_0_op1[31:0] = dag_1000_entry_530_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_72)) begin
+		dag_1000_entry_mul_32_32_0_op1[31:0] = dag_1000_entry_758_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_73)) begin
+		dag_1000_entry_mul_32_32_0_op1[31:0] = dag_1000_entry_984_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_74)) begin
+		dag_1000_entry_mul_32_32_0_op1[31:0] = dag_1000_entry_54_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_75)) begin
+		dag_1000_entry_mul_32_32_0_op1[31:0] = dag_1000_entry_156_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_76)) begin
+		dag_1000_entry_mul_32_32_0_op1[31:0] = dag_1000_entry_391_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_78)) begin
+		dag_1000_entry_mul_32_32_0_op1[31:0] = dag_1000_entry_444_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_79)) begin
+		dag_1000_entry_mul_32_32_0_op1[31:0] = dag_1000_entry_542_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_80)) begin
+		dag_1000_entry_mul_32_32_0_op1[31:0] = dag_1000_entry_621_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_81)) begin
+		dag_1000_entry_mul_32_32_0_op1[31:0] = dag_1000_entry_796_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_1000_BB_0_S_82)) */ begin
+		dag_1000_entry_mul_32_32_0_op1[31:0] = dag_1000_entry_974_reg[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_mul_32_32_0[31:0] = (dag_1000_entry_mul_32_32_0_op0 * dag_1000_entry_mul_32_32_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_3)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_84[63:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_5)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_102_reg[16:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_8)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_77[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_9)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_113_reg[16:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_10)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_111_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_11)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_127_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_12)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_127_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_13)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_108_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_14)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_131_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_15)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_156_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_16)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_177_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_17)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_187_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_18)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_200_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_19)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_210_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_20)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_209_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_21)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_225_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_22)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_225_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_23)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_248_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_24)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_255_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_25)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_282[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_26)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_306[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_27)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_307_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_28)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_309_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_31)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_373[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_32)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_385[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_33)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_385_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_34)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_391_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_35)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_414_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_36)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_424_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_37)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_455_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_38)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_491_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_39)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_492_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_40)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_513_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_41)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_506_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_42)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_518_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_43)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_540_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_44)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_543_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_45)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_613_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_46)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_608_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_47)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_707[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_48)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_717_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_50)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_719_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_51)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_757_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_52)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_771_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_53)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_787_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_54)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_727[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_56)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_796_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_57)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_805[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_58)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_803_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_59)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_804_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_60)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_832_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_61)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_838_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_62)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_868_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_63)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_868_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_64)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_889_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_65)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_889_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_66)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_889_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_67)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_296_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_68)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_874_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_70)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_985_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_71)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_518_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_72)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_972_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_73)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_977_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_74)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_94_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_75)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_129_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_76)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_341_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_77)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_370_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_78)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_385_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_79)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_589_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_80)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_581_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_81)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_672_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_82)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_727_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_83)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_697_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_84)) begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_857_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_1000_BB_0_S_85)) */ begin
+		dag_1000_entry_add_32_32_0_op0[31:0] = dag_1000_entry_995_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_3)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_86[63:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_5)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_107[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_8)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_90_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_9)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_135_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_10)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_110_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_11)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_119_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_12)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_133_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_13)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_123_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_14)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_141_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_15)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_152_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_16)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_198_reg;
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_17)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_177_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_18)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_208_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_19)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_214_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_20)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_226_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_21)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_225_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_22)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_234_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_23)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_243_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_24)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_241_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_25)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_278_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_26)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_303[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_27)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_309[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_28)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_328_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_31)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_359_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_32)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_376_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_33)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_382_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_34)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_391_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_35)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_426_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_36)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_426_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_37)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_442_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_38)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_474_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_39)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_498_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_40)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_491_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_41)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_511[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_42)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_532_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_43)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_535_reg;
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_44)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_543_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_45)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_607_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_46)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_607_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_47)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_707[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_48)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_697[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_50)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_730_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_51)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_732_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_52)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_776_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_53)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_789_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_54)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_720_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_56)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_803[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_57)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_818_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_58)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_811_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_59)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_824_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_60)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_824_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_61)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_847_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_62)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_886_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_63)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_886_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_64)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_909_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_65)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_896_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_66)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_923_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_67)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_309_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_68)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_847_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_70)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_988[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_71)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_532_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_72)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_965_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_73)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_935_reg;
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_74)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_108_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_75)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_129_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_76)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_367_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_77)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_376_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_78)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_410_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_79)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_589_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_80)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_575_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_81)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_662_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_82)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_707_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_83)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_717_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_84)) begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_848_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_1000_BB_0_S_85)) */ begin
+		dag_1000_entry_add_32_32_0_op1[31:0] = dag_1000_entry_984_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_add_32_32_0[31:0] = (dag_1000_entry_add_32_32_0_op0 + dag_1000_entry_add_32_32_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_3)) begin
+		dag_1000_entry_and_32_32_0_op0[31:0] = dag_1000_entry_53_reg[23:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_4)) begin
+		dag_1000_entry_and_32_32_0_op0[31:0] = dag_1000_entry_25_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_5)) begin
+		dag_1000_entry_and_32_32_0_op0[31:0] = dag_1000_entry_25_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_6)) begin
+		dag_1000_entry_and_32_32_0_op0[31:0] = dag_1000_entry_27_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_7)) begin
+		dag_1000_entry_and_32_32_0_op0[31:0] = dag_1000_entry_54_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_8)) begin
+		dag_1000_entry_and_32_32_0_op0[31:0] = dag_1000_entry_63_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_14)) begin
+		dag_1000_entry_and_32_32_0_op0[31:0] = dag_1000_entry_187[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_17)) begin
+		dag_1000_entry_and_32_32_0_op0[31:0] = dag_1000_entry_208[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_21)) begin
+		dag_1000_entry_and_32_32_0_op0[31:0] = dag_1000_entry_234[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_22)) begin
+		dag_1000_entry_and_32_32_0_op0[31:0] = dag_1000_entry_234_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_24)) begin
+		dag_1000_entry_and_32_32_0_op0[31:0] = dag_1000_entry_260[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_25)) begin
+		dag_1000_entry_and_32_32_0_op0[31:0] = dag_1000_entry_260_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_26)) begin
+		dag_1000_entry_and_32_32_0_op0[31:0] = dag_1000_entry_271_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_28)) begin
+		dag_1000_entry_and_32_32_0_op0[31:0] = dag_1000_entry_341[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_31)) begin
+		dag_1000_entry_and_32_32_0_op0[31:0] = dag_1000_entry_329_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_32)) begin
+		dag_1000_entry_and_32_32_0_op0[31:0] = dag_1000_entry_373_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_34)) begin
+		dag_1000_entry_and_32_32_0_op0[31:0] = dag_1000_entry_426[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_37)) begin
+		dag_1000_entry_and_32_32_0_op0[31:0] = dag_1000_entry_459[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_38)) begin
+		dag_1000_entry_and_32_32_0_op0[31:0] = dag_1000_entry_465_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_39)) begin
+		dag_1000_entry_and_32_32_0_op0[31:0] = dag_1000_entry_474_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_40)) begin
+		dag_1000_entry_and_32_32_0_op0[31:0] = dag_1000_entry_503_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_41)) begin
+		dag_1000_entry_and_32_32_0_op0[31:0] = dag_1000_entry_517_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_42)) begin
+		dag_1000_entry_and_32_32_0_op0[31:0] = dag_1000_entry_530_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_44)) begin
+		dag_1000_entry_and_32_32_0_op0[31:0] = dag_1000_entry_581[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_45)) begin
+		dag_1000_entry_and_32_32_0_op0[31:0] = dag_1000_entry_607_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_46)) begin
+		dag_1000_entry_and_32_32_0_op0[31:0] = dag_1000_entry_626_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_47)) begin
+		dag_1000_entry_and_32_32_0_op0[31:0] = dag_1000_entry_627_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_50)) begin
+		dag_1000_entry_and_32_32_0_op0[31:0] = dag_1000_entry_777_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_53)) begin
+		dag_1000_entry_and_32_32_0_op0[31:0] = dag_1000_entry_804_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_54)) begin
+		dag_1000_entry_and_32_32_0_op0[31:0] = dag_1000_entry_757_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_55)) begin
+		dag_1000_entry_and_32_32_0_op0[31:0] = dag_1000_entry_771_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_56)) begin
+		dag_1000_entry_and_32_32_0_op0[31:0] = dag_1000_entry_796_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_57)) begin
+		dag_1000_entry_and_32_32_0_op0[31:0] = dag_1000_entry_789_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_59)) begin
+		dag_1000_entry_and_32_32_0_op0[31:0] = dag_1000_entry_833_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_60)) begin
+		dag_1000_entry_and_32_32_0_op0[31:0] = dag_1000_entry_847_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_63)) begin
+		dag_1000_entry_and_32_32_0_op0[31:0] = dag_1000_entry_896[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_68)) begin
+		dag_1000_entry_and_32_32_0_op0[31:0] = dag_1000_entry_927_reg;
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_70)) begin
+		dag_1000_entry_and_32_32_0_op0[31:0] = dag_1000_entry_972[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_71)) begin
+		dag_1000_entry_and_32_32_0_op0[31:0] = dag_1000_entry_160_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_72)) begin
+		dag_1000_entry_and_32_32_0_op0[31:0] = dag_1000_entry_160_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_73)) begin
+		dag_1000_entry_and_32_32_0_op0[31:0] = dag_1000_entry_214_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_74)) begin
+		dag_1000_entry_and_32_32_0_op0[31:0] = dag_1000_entry_243_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_75)) begin
+		dag_1000_entry_and_32_32_0_op0[31:0] = dag_1000_entry_291_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_76)) begin
+		dag_1000_entry_and_32_32_0_op0[31:0] = dag_1000_entry_444_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_77)) begin
+		dag_1000_entry_and_32_32_0_op0[31:0] = dag_1000_entry_475_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_78)) begin
+		dag_1000_entry_and_32_32_0_op0[31:0] = dag_1000_entry_543_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_1000_BB_0_S_82)) */ begin
+		dag_1000_entry_and_32_32_0_op0[31:0] = dag_1000_entry_719_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_3)) begin
+		dag_1000_entry_and_32_32_0_op1[31:0] = dag_1000_entry_84[63:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_4)) begin
+		dag_1000_entry_and_32_32_0_op1[31:0] = arg_4[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_5)) begin
+		dag_1000_entry_and_32_32_0_op1[31:0] = dag_1000_entry_9_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_6)) begin
+		dag_1000_entry_and_32_32_0_op1[31:0] = dag_1000_entry_31_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_7)) begin
+		dag_1000_entry_and_32_32_0_op1[31:0] = dag_1000_entry_50_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_8)) begin
+		dag_1000_entry_and_32_32_0_op1[31:0] = dag_1000_entry_61_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_14)) begin
+		dag_1000_entry_and_32_32_0_op1[31:0] = dag_1000_entry_190[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_17)) begin
+		dag_1000_entry_and_32_32_0_op1[31:0] = dag_1000_entry_208[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_21)) begin
+		dag_1000_entry_and_32_32_0_op1[31:0] = dag_1000_entry_225_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_22)) begin
+		dag_1000_entry_and_32_32_0_op1[31:0] = dag_1000_entry_242_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_24)) begin
+		dag_1000_entry_and_32_32_0_op1[31:0] = dag_1000_entry_252_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_25)) begin
+		dag_1000_entry_and_32_32_0_op1[31:0] = dag_1000_entry_268_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_26)) begin
+		dag_1000_entry_and_32_32_0_op1[31:0] = dag_1000_entry_271_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_28)) begin
+		dag_1000_entry_and_32_32_0_op1[31:0] = dag_1000_entry_346[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_31)) begin
+		dag_1000_entry_and_32_32_0_op1[31:0] = dag_1000_entry_363[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_32)) begin
+		dag_1000_entry_and_32_32_0_op1[31:0] = dag_1000_entry_363_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_34)) begin
+		dag_1000_entry_and_32_32_0_op1[31:0] = dag_1000_entry_426[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_37)) begin
+		dag_1000_entry_and_32_32_0_op1[31:0] = dag_1000_entry_440_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_38)) begin
+		dag_1000_entry_and_32_32_0_op1[31:0] = dag_1000_entry_459_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_39)) begin
+		dag_1000_entry_and_32_32_0_op1[31:0] = dag_1000_entry_465_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_40)) begin
+		dag_1000_entry_and_32_32_0_op1[31:0] = dag_1000_entry_506_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_41)) begin
+		dag_1000_entry_and_32_32_0_op1[31:0] = dag_1000_entry_531_reg;
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_42)) begin
+		dag_1000_entry_and_32_32_0_op1[31:0] = dag_1000_entry_541[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_44)) begin
+		dag_1000_entry_and_32_32_0_op1[31:0] = dag_1000_entry_593_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_45)) begin
+		dag_1000_entry_and_32_32_0_op1[31:0] = dag_1000_entry_589_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_46)) begin
+		dag_1000_entry_and_32_32_0_op1[31:0] = dag_1000_entry_621_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_47)) begin
+		dag_1000_entry_and_32_32_0_op1[31:0] = dag_1000_entry_620_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_50)) begin
+		dag_1000_entry_and_32_32_0_op1[31:0] = dag_1000_entry_777_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_53)) begin
+		dag_1000_entry_and_32_32_0_op1[31:0] = dag_1000_entry_791[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_54)) begin
+		dag_1000_entry_and_32_32_0_op1[31:0] = dag_1000_entry_755[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_55)) begin
+		dag_1000_entry_and_32_32_0_op1[31:0] = dag_1000_entry_762_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_56)) begin
+		dag_1000_entry_and_32_32_0_op1[31:0] = dag_1000_entry_789_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_57)) begin
+		dag_1000_entry_and_32_32_0_op1[31:0] = dag_1000_entry_787_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_59)) begin
+		dag_1000_entry_and_32_32_0_op1[31:0] = dag_1000_entry_831[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_60)) begin
+		dag_1000_entry_and_32_32_0_op1[31:0] = dag_1000_entry_833_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_63)) begin
+		dag_1000_entry_and_32_32_0_op1[31:0] = dag_1000_entry_875_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_68)) begin
+		dag_1000_entry_and_32_32_0_op1[31:0] = dag_1000_entry_897[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_70)) begin
+		dag_1000_entry_and_32_32_0_op1[31:0] = dag_1000_entry_956_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_71)) begin
+		dag_1000_entry_and_32_32_0_op1[31:0] = dag_1000_entry_152_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_72)) begin
+		dag_1000_entry_and_32_32_0_op1[31:0] = dag_1000_entry_153_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_73)) begin
+		dag_1000_entry_and_32_32_0_op1[31:0] = dag_1000_entry_209_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_74)) begin
+		dag_1000_entry_and_32_32_0_op1[31:0] = dag_1000_entry_242_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_75)) begin
+		dag_1000_entry_and_32_32_0_op1[31:0] = dag_1000_entry_291_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_76)) begin
+		dag_1000_entry_and_32_32_0_op1[31:0] = dag_1000_entry_440_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_77)) begin
+		dag_1000_entry_and_32_32_0_op1[31:0] = dag_1000_entry_465_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_78)) begin
+		dag_1000_entry_and_32_32_0_op1[31:0] = dag_1000_entry_543_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_1000_BB_0_S_82)) */ begin
+		dag_1000_entry_and_32_32_0_op1[31:0] = dag_1000_entry_728[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_and_32_32_0[31:0] = (dag_1000_entry_and_32_32_0_op0 & dag_1000_entry_and_32_32_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_5)) begin
+		dag_1000_entry_or_16_16_0_op0[15:0] = dag_1000_entry_72_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_6)) begin
+		dag_1000_entry_or_16_16_0_op0[15:0] = dag_1000_entry_55_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_7)) begin
+		dag_1000_entry_or_16_16_0_op0[15:0] = dag_1000_entry_150[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_8)) begin
+		dag_1000_entry_or_16_16_0_op0[15:0] = dag_1000_entry_163[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_9)) begin
+		dag_1000_entry_or_16_16_0_op0[15:0] = dag_1000_entry_194[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_14)) begin
+		dag_1000_entry_or_16_16_0_op0[15:0] = dag_1000_entry_288_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_15)) begin
+		dag_1000_entry_or_16_16_0_op0[15:0] = dag_1000_entry_305_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_20)) begin
+		dag_1000_entry_or_16_16_0_op0[15:0] = dag_1000_entry_425[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_23)) begin
+		dag_1000_entry_or_16_16_0_op0[15:0] = dag_1000_entry_457[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_24)) begin
+		dag_1000_entry_or_16_16_0_op0[15:0] = dag_1000_entry_456_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_25)) begin
+		dag_1000_entry_or_16_16_0_op0[15:0] = dag_1000_entry_485_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_41)) begin
+		dag_1000_entry_or_16_16_0_op0[15:0] = dag_1000_entry_535[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_42)) begin
+		dag_1000_entry_or_16_16_0_op0[15:0] = dag_1000_entry_569_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_43)) begin
+		dag_1000_entry_or_16_16_0_op0[15:0] = dag_1000_entry_654_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_44)) begin
+		dag_1000_entry_or_16_16_0_op0[15:0] = dag_1000_entry_673_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_45)) begin
+		dag_1000_entry_or_16_16_0_op0[15:0] = dag_1000_entry_698_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_46)) begin
+		dag_1000_entry_or_16_16_0_op0[15:0] = dag_1000_entry_783[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_47)) begin
+		dag_1000_entry_or_16_16_0_op0[15:0] = dag_1000_entry_827[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_48)) begin
+		dag_1000_entry_or_16_16_0_op0[15:0] = dag_1000_entry_878[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_64)) begin
+		dag_1000_entry_or_16_16_0_op0[15:0] = dag_1000_entry_885[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_65)) begin
+		dag_1000_entry_or_16_16_0_op0[15:0] = dag_1000_entry_890_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_66)) begin
+		dag_1000_entry_or_16_16_0_op0[15:0] = dag_1000_entry_928_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_67)) begin
+		dag_1000_entry_or_16_16_0_op0[15:0] = dag_1000_entry_959_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_68)) begin
+		dag_1000_entry_or_16_16_0_op0[15:0] = dag_1000_entry_146_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_69)) begin
+		dag_1000_entry_or_16_16_0_op0[15:0] = dag_1000_entry_199_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_70)) begin
+		dag_1000_entry_or_16_16_0_op0[15:0] = dag_1000_entry_509_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_71)) begin
+		dag_1000_entry_or_16_16_0_op0[15:0] = dag_1000_entry_572_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_72)) begin
+		dag_1000_entry_or_16_16_0_op0[15:0] = dag_1000_entry_596_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_73)) begin
+		dag_1000_entry_or_16_16_0_op0[15:0] = dag_1000_entry_649_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_74)) begin
+		dag_1000_entry_or_16_16_0_op0[15:0] = dag_1000_entry_878_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_75)) begin
+		dag_1000_entry_or_16_16_0_op0[15:0] = dag_1000_entry_973_reg[15:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_1000_BB_0_S_76)) */ begin
+		dag_1000_entry_or_16_16_0_op0[15:0] = dag_1000_entry_997_reg[15:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_5)) begin
+		dag_1000_entry_or_16_16_0_op1[15:0] = dag_1000_entry_48[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_6)) begin
+		dag_1000_entry_or_16_16_0_op1[15:0] = dag_1000_entry_78_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_7)) begin
+		dag_1000_entry_or_16_16_0_op1[15:0] = dag_1000_entry_124[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_8)) begin
+		dag_1000_entry_or_16_16_0_op1[15:0] = dag_1000_entry_175_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_9)) begin
+		dag_1000_entry_or_16_16_0_op1[15:0] = dag_1000_entry_189_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_14)) begin
+		dag_1000_entry_or_16_16_0_op1[15:0] = dag_1000_entry_277[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_15)) begin
+		dag_1000_entry_or_16_16_0_op1[15:0] = dag_1000_entry_299_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_20)) begin
+		dag_1000_entry_or_16_16_0_op1[15:0] = dag_1000_entry_399_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_23)) begin
+		dag_1000_entry_or_16_16_0_op1[15:0] = dag_1000_entry_457[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_24)) begin
+		dag_1000_entry_or_16_16_0_op1[15:0] = dag_1000_entry_466_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_25)) begin
+		dag_1000_entry_or_16_16_0_op1[15:0] = dag_1000_entry_499[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_41)) begin
+		dag_1000_entry_or_16_16_0_op1[15:0] = dag_1000_entry_552_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_42)) begin
+		dag_1000_entry_or_16_16_0_op1[15:0] = dag_1000_entry_585_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_43)) begin
+		dag_1000_entry_or_16_16_0_op1[15:0] = dag_1000_entry_658_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_44)) begin
+		dag_1000_entry_or_16_16_0_op1[15:0] = dag_1000_entry_657_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_45)) begin
+		dag_1000_entry_or_16_16_0_op1[15:0] = dag_1000_entry_726_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_46)) begin
+		dag_1000_entry_or_16_16_0_op1[15:0] = dag_1000_entry_772_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_47)) begin
+		dag_1000_entry_or_16_16_0_op1[15:0] = dag_1000_entry_810[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_48)) begin
+		dag_1000_entry_or_16_16_0_op1[15:0] = dag_1000_entry_861[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_64)) begin
+		dag_1000_entry_or_16_16_0_op1[15:0] = dag_1000_entry_878_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_65)) begin
+		dag_1000_entry_or_16_16_0_op1[15:0] = dag_1000_entry_899_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_66)) begin
+		dag_1000_entry_or_16_16_0_op1[15:0] = dag_1000_entry_914_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_67)) begin
+		dag_1000_entry_or_16_16_0_op1[15:0] = dag_1000_entry_955_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_68)) begin
+		dag_1000_entry_or_16_16_0_op1[15:0] = dag_1000_entry_136_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_69)) begin
+		dag_1000_entry_or_16_16_0_op1[15:0] = dag_1000_entry_213_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_70)) begin
+		dag_1000_entry_or_16_16_0_op1[15:0] = dag_1000_entry_496_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_71)) begin
+		dag_1000_entry_or_16_16_0_op1[15:0] = dag_1000_entry_573_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_72)) begin
+		dag_1000_entry_or_16_16_0_op1[15:0] = dag_1000_entry_618_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_73)) begin
+		dag_1000_entry_or_16_16_0_op1[15:0] = dag_1000_entry_665_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_74)) begin
+		dag_1000_entry_or_16_16_0_op1[15:0] = dag_1000_entry_861_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_1000_BB_0_S_75)) begin
+		dag_1000_entry_or_16_16_0_op1[15:0] = dag_1000_entry_979_reg[15:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_1000_BB_0_S_76)) */ begin
+		dag_1000_entry_or_16_16_0_op1[15:0] = dag_1000_entry_996[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_1000_entry_or_16_16_0[15:0] = (dag_1000_entry_or_16_16_0_op0 | dag_1000_entry_or_16_16_0_op1);
+end
+
+always @ (*) begin
+	dag_1000_entry_18[7:0] = dag_1000_entry_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_28[63:0] = (dag_1000_entry_21 + dag_1000_entry_10);
+end
+
+always @ (*) begin
+	dag_1000_entry_30[63:0] = (dag_1000_entry_21 - dag_1000_entry_11);
+end
+
+always @ (*) begin
+	dag_1000_entry_24[63:0] = (dag_1000_entry_10_reg * arg_6);
+end
+
+always @ (*) begin
+	dag_1000_entry_52[15:0] = (dag_1000_entry_38 ^ dag_1000_entry_35);
+end
+
+always @ (*) begin
+	dag_1000_entry_80[63:0] = (dag_1000_entry_60 ^ dag_1000_entry_53);
+end
+
+always @ (*) begin
+	dag_1000_entry_57[63:0] = (dag_1000_entry_47 ^ dag_1000_entry_45_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_71[63:0] = (dag_1000_entry_41_reg + dag_1000_entry_47);
+end
+
+always @ (*) begin
+	dag_1000_entry_89[63:0] = (dag_1000_entry_70_reg ^ dag_1000_entry_86);
+end
+
+always @ (*) begin
+	dag_1000_entry_91[15:0] = (dag_1000_entry_73_reg ^ dag_1000_entry_82);
+end
+
+always @ (*) begin
+	dag_1000_entry_97[15:0] = (dag_1000_entry_82 ^ dag_1000_entry_93);
+end
+
+always @ (*) begin
+	dag_1000_entry_162[7:0] = (dag_1000_entry_137 ^ dag_1000_entry_147_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_144[31:0] = (dag_1000_entry_133 - dag_1000_entry_129_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_217[63:0] = (dag_1000_entry_176_reg & dag_1000_entry_178_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_250[63:0] = (dag_1000_entry_239_reg - dag_1000_entry_197);
+end
+
+always @ (*) begin
+	dag_1000_entry_316[63:0] = (dag_1000_entry_292 | dag_1000_entry_292);
+end
+
+always @ (*) begin
+	dag_1000_entry_286[63:0] = (dag_1000_entry_256 + dag_1000_entry_258_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_317[63:0] = (dag_1000_entry_301_reg * dag_1000_entry_301_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_195[31:0] = (dag_1000_entry_187_reg ^ dag_1000_entry_177);
+end
+
+always @ (*) begin
+	dag_1000_entry_401[63:0] = (dag_1000_entry_375 - dag_1000_entry_390);
+end
+
+always @ (*) begin
+	dag_1000_entry_468[7:0] = (dag_1000_entry_429_reg ^ dag_1000_entry_464);
+end
+
+always @ (*) begin
+	dag_1000_entry_477[63:0] = (dag_1000_entry_435 + dag_1000_entry_405);
+end
+
+always @ (*) begin
+	dag_1000_entry_497[63:0] = (dag_1000_entry_472 + dag_1000_entry_472);
+end
+
+always @ (*) begin
+	dag_1000_entry_460[7:0] = (dag_1000_entry_420_reg ^ dag_1000_entry_447);
+end
+
+always @ (*) begin
+	dag_1000_entry_493[63:0] = (dag_1000_entry_443_reg - dag_1000_entry_488_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_551[7:0] = (dag_1000_entry_527_reg ^ dag_1000_entry_512);
+end
+
+always @ (*) begin
+	dag_1000_entry_462[15:0] = (dag_1000_entry_457 - dag_1000_entry_448_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_538[63:0] = (dag_1000_entry_522 ^ dag_1000_entry_525_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_261[31:0] = (dag_1000_entry_255_reg ^ dag_1000_entry_260);
+end
+
+always @ (*) begin
+	dag_1000_entry_495[15:0] = (dag_1000_entry_481_reg ^ dag_1000_entry_485);
+end
+
+always @ (*) begin
+	dag_1000_entry_548[63:0] = (dag_1000_entry_525_reg * dag_1000_entry_544_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_640[7:0] = (dag_1000_entry_624 - dag_1000_entry_633_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_576[63:0] = (dag_1000_entry_544_reg + dag_1000_entry_574_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_615[63:0] = (dag_1000_entry_599 + dag_1000_entry_599);
+end
+
+always @ (*) begin
+	dag_1000_entry_611[63:0] = (dag_1000_entry_602_reg * dag_1000_entry_609_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_612[63:0] = (dag_1000_entry_599_reg + dag_1000_entry_609_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_708[7:0] = (dag_1000_entry_696 - dag_1000_entry_696);
+end
+
+always @ (*) begin
+	dag_1000_entry_743[7:0] = (dag_1000_entry_733 - dag_1000_entry_736_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_430[31:0] = (dag_1000_entry_428 - dag_1000_entry_414);
+end
+
+always @ (*) begin
+	dag_1000_entry_520[31:0] = (dag_1000_entry_517_reg - dag_1000_entry_511);
+end
+
+always @ (*) begin
+	dag_1000_entry_598[63:0] = (dag_1000_entry_597 ^ dag_1000_entry_580_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_600[63:0] = (dag_1000_entry_588_reg - dag_1000_entry_597);
+end
+
+always @ (*) begin
+	dag_1000_entry_623[63:0] = (dag_1000_entry_609_reg + dag_1000_entry_603);
+end
+
+always @ (*) begin
+	dag_1000_entry_92[7:0] = dag_1000_entry_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_700[15:0] = (dag_1000_entry_692 - dag_1000_entry_680_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_98[7:0] = dag_1000_entry_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_186[7:0] = dag_1000_entry_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_204[7:0] = (dag_1000_entry_196 ^ dag_1000_entry_180_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_490[7:0] = dag_1000_entry_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_677[31:0] = (dag_1000_entry_670 ^ dag_1000_entry_655);
+end
+
+always @ (*) begin
+	dag_1000_entry_246[7:0] = dag_1000_entry_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_315[7:0] = dag_1000_entry_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_335[63:0] = (dag_1000_entry_312 + dag_1000_entry_320_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_416[7:0] = dag_1000_entry_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_587[7:0] = dag_1000_entry_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_392[7:0] = dag_1000_entry_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_630[7:0] = dag_1000_entry_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_710[63:0] = (dag_1000_entry_694_reg + dag_1000_entry_709_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_746[63:0] = (dag_1000_entry_738 + dag_1000_entry_722);
+end
+
+always @ (*) begin
+	dag_1000_entry_767[63:0] = (dag_1000_entry_751 & dag_1000_entry_753);
+end
+
+always @ (*) begin
+	dag_1000_entry_402[7:0] = dag_1000_entry_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_784[63:0] = (dag_1000_entry_753_reg * dag_1000_entry_764_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_850[7:0] = dag_1000_entry_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_855[7:0] = dag_1000_entry_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_919[7:0] = dag_1000_entry_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_986[7:0] = dag_1000_entry_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_946[7:0] = (dag_1000_entry_939_reg - dag_1000_entry_922);
+end
+
+always @ (*) begin
+	dag_1000_entry_994[7:0] = dag_1000_entry_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_893[63:0] = (dag_1000_entry_872 | dag_1000_entry_872);
+end
+
+always @ (*) begin
+	dag_1000_entry_846[63:0] = (dag_1000_entry_820_reg | dag_1000_entry_841);
+end
+
+always @ (*) begin
+	dag_1000_entry_903[63:0] = (dag_1000_entry_879_reg * dag_1000_entry_876_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_934[63:0] = (dag_1000_entry_926 + dag_1000_entry_921);
+end
+
+always @ (*) begin
+	dag_1000_entry_940[63:0] = (dag_1000_entry_917_reg * dag_1000_entry_924_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_966[63:0] = (dag_1000_entry_962 & dag_1000_entry_949);
+end
+
+always @ (*) begin
+	dag_1000_entry_1001[63:0] = (dag_1000_entry_976_reg + dag_1000_entry_969_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_229[31:0] = dag_1000_entry_or_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_941[15:0] = (dag_1000_entry_918 - dag_1000_entry_928_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_211[15:0] = dag_1000_entry_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_154[15:0] = dag_1000_entry_or_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_400[15:0] = dag_1000_entry_and_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_463[15:0] = dag_1000_entry_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_826[15:0] = dag_1000_entry_mul_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_950[31:0] = dag_1000_entry_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_245[15:0] = dag_1000_entry_or_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_366[63:0] = (dag_1000_entry_343_reg & dag_1000_entry_343_reg);
+end
+
+always @ (*) begin
+	dag_1000_entry_591[15:0] = dag_1000_entry_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_989[7:0] = dag_1000_entry_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_521[15:0] = dag_1000_entry_or_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_614[15:0] = dag_1000_entry_add_16_16_1[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_166[31:0] = dag_1000_entry_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_601[15:0] = dag_1000_entry_or_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_643[15:0] = dag_1000_entry_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_182[31:0] = dag_1000_entry_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_647[15:0] = dag_1000_entry_add_16_16_1[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_693[15:0] = dag_1000_entry_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_216[31:0] = dag_1000_entry_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_667[15:0] = dag_1000_entry_or_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_887[15:0] = dag_1000_entry_and_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_888[15:0] = dag_1000_entry_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_66[31:0] = dag_1000_entry_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_122[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_257[31:0] = dag_1000_entry_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_891[15:0] = dag_1000_entry_or_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_952[15:0] = dag_1000_entry_add_16_16_1[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_170[31:0] = dag_1000_entry_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_297[31:0] = dag_1000_entry_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_944[15:0] = dag_1000_entry_and_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_967[15:0] = dag_1000_entry_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_992[63:0] = (dag_1000_entry_976_reg ^ dag_1000_entry_987);
+end
+
+always @ (*) begin
+	dag_1000_entry_406[31:0] = dag_1000_entry_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_449[31:0] = dag_1000_entry_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_991[15:0] = dag_1000_entry_add_16_16_1[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_1005[15:0] = dag_1000_entry_or_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_411[31:0] = dag_1000_entry_or_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_482[31:0] = dag_1000_entry_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_422[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_458[31:0] = dag_1000_entry_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_563[31:0] = dag_1000_entry_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_561[31:0] = dag_1000_entry_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_594[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_734[31:0] = dag_1000_entry_or_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_606[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_642[31:0] = dag_1000_entry_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_676[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_801[31:0] = dag_1000_entry_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_735[31:0] = dag_1000_entry_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_759[31:0] = (dag_1000_entry_757_reg ^ dag_1000_entry_731);
+end
+
+always @ (*) begin
+	dag_1000_entry_882[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_1000_entry_1002[31:0] = dag_1000_entry_add_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS)) begin
+		finish <= 1'd0;
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_85)) begin
+		finish <= 1'd1;
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS)) begin
+		return_val[63:0] <= 64'd0;
+	end
+	if ((cur_state == BPHLS_F_dag_1000_BB_0_S_85)) begin
+		return_val[63:0] <= dag_1000_entry_1010_reg[63:0];
+	end
+end
+
+endmodule
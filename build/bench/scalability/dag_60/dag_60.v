@@ -0,0 +1,1095 @@
+module dag_60
+(
+	input wire  clk,
+	input wire  reset,
+	input wire  start,
+	output reg  finish,
+	output reg [63:0] return_val,
+	input wire [7:0] arg_0,
+	input wire [7:0] arg_1,
+	input wire [15:0] arg_2,
+	input wire [15:0] arg_3,
+	input wire [31:0] arg_4,
+	input wire [31:0] arg_5,
+	input wire [63:0] arg_6,
+	input wire [63:0] arg_7
+);
+
+parameter [2:0] BPHLS = 3'd0;
+parameter [2:0] BPHLS_F_dag_60_BB_0_S_0 = 3'd1;
+parameter [2:0] BPHLS_F_dag_60_BB_0_S_1 = 3'd2;
+parameter [2:0] BPHLS_F_dag_60_BB_0_S_2 = 3'd3;
+parameter [2:0] BPHLS_F_dag_60_BB_0_S_3 = 3'd4;
+parameter [2:0] BPHLS_F_dag_60_BB_0_S_4 = 3'd5;
+
+reg [2:0] cur_state;
+reg [2:0] next_state;
+reg [15:0] dag_60_entry_8;
+reg [15:0] dag_60_entry_8_reg;
+reg [31:0] dag_60_entry_9;
+reg [31:0] dag_60_entry_9_reg;
+reg [63:0] dag_60_entry_10;
+reg [63:0] dag_60_entry_10_reg;
+reg [7:0] dag_60_entry_11;
+reg [7:0] dag_60_entry_11_reg;
+reg [7:0] dag_60_entry_12;
+reg [7:0] dag_60_entry_12_reg;
+reg [31:0] dag_60_entry_13;
+reg [31:0] dag_60_entry_13_reg;
+reg [15:0] dag_60_entry_14;
+reg [15:0] dag_60_entry_14_reg;
+reg [7:0] dag_60_entry_15;
+reg [7:0] dag_60_entry_15_reg;
+reg [15:0] dag_60_entry_16;
+reg [15:0] dag_60_entry_16_reg;
+reg [63:0] dag_60_entry_17;
+reg [63:0] dag_60_entry_17_reg;
+reg [15:0] dag_60_entry_19;
+reg [15:0] dag_60_entry_19_reg;
+reg [7:0] dag_60_entry_20;
+reg [7:0] dag_60_entry_20_reg;
+reg [63:0] dag_60_entry_21;
+reg  dag_60_entry_21_reg;
+reg [7:0] dag_60_entry_22;
+reg [7:0] dag_60_entry_22_reg;
+reg [7:0] dag_60_entry_23;
+reg [7:0] dag_60_entry_23_reg;
+reg [31:0] dag_60_entry_25;
+reg [31:0] dag_60_entry_25_reg;
+reg [31:0] dag_60_entry_26;
+reg [31:0] dag_60_entry_26_reg;
+reg [31:0] dag_60_entry_27;
+reg [31:0] dag_60_entry_27_reg;
+reg [15:0] dag_60_entry_29;
+reg [15:0] dag_60_entry_29_reg;
+reg [31:0] dag_60_entry_31;
+reg [31:0] dag_60_entry_31_reg;
+reg [7:0] dag_60_entry_32;
+reg [7:0] dag_60_entry_32_reg;
+reg [63:0] dag_60_entry_33;
+reg [7:0] dag_60_entry_33_reg;
+reg [31:0] dag_60_entry_34;
+reg [31:0] dag_60_entry_34_reg;
+reg [15:0] dag_60_entry_35;
+reg [15:0] dag_60_entry_35_reg;
+reg [63:0] dag_60_entry_36;
+reg [63:0] dag_60_entry_36_reg;
+reg [7:0] dag_60_entry_37;
+reg [7:0] dag_60_entry_37_reg;
+reg [15:0] dag_60_entry_38;
+reg [15:0] dag_60_entry_38_reg;
+reg [31:0] dag_60_entry_39;
+reg [31:0] dag_60_entry_39_reg;
+reg [63:0] dag_60_entry_40;
+reg [7:0] dag_60_entry_40_reg;
+reg [63:0] dag_60_entry_41;
+reg [63:0] dag_60_entry_41_reg;
+reg [7:0] dag_60_entry_42;
+reg [7:0] dag_60_entry_42_reg;
+reg [31:0] dag_60_entry_43;
+reg [31:0] dag_60_entry_43_reg;
+reg [7:0] dag_60_entry_44;
+reg [7:0] dag_60_entry_44_reg;
+reg [63:0] dag_60_entry_45;
+reg  dag_60_entry_45_reg;
+reg [7:0] dag_60_entry_46;
+reg [7:0] dag_60_entry_46_reg;
+reg [63:0] dag_60_entry_47;
+reg [7:0] dag_60_entry_47_reg;
+reg [63:0] dag_60_entry_51;
+reg [63:0] dag_60_entry_51_reg;
+reg [31:0] dag_60_entry_54;
+reg [31:0] dag_60_entry_54_reg;
+reg [7:0] dag_60_entry_56;
+reg [7:0] dag_60_entry_56_reg;
+reg [15:0] dag_60_entry_58;
+reg [15:0] dag_60_entry_58_reg;
+reg [63:0] dag_60_entry_60;
+reg [63:0] dag_60_entry_60_reg;
+reg [31:0] dag_60_entry_61;
+reg [31:0] dag_60_entry_61_reg;
+reg [31:0] dag_60_entry_63;
+reg [31:0] dag_60_entry_63_reg;
+reg [31:0] dag_60_entry_66;
+reg [31:0] dag_60_entry_66_reg;
+reg [7:0] dag_60_entry_67;
+reg [7:0] dag_60_entry_67_reg;
+reg [63:0] dag_60_entry_68;
+reg [15:0] dag_60_entry_68_reg;
+reg [63:0] dag_60_entry_69;
+reg [31:0] dag_60_entry_69_reg;
+reg [63:0] dag_60_entry_70;
+reg [63:0] dag_60_entry_70_reg;
+reg [15:0] dag_60_entry_and_16_16_0_op0;
+reg [15:0] dag_60_entry_and_16_16_0_op1;
+reg [15:0] dag_60_entry_and_16_16_0;
+reg [7:0] dag_60_entry_mul_8_8_0_op0;
+reg [7:0] dag_60_entry_mul_8_8_0_op1;
+reg [7:0] dag_60_entry_mul_8_8_0;
+reg [7:0] dag_60_entry_or_8_8_0_op0;
+reg [7:0] dag_60_entry_or_8_8_0_op1;
+reg [7:0] dag_60_entry_or_8_8_0;
+reg [7:0] dag_60_entry_add_8_8_0_op0;
+reg [7:0] dag_60_entry_add_8_8_0_op1;
+reg [7:0] dag_60_entry_add_8_8_0;
+reg [7:0] dag_60_entry_add_8_8_1_op0;
+reg [7:0] dag_60_entry_add_8_8_1_op1;
+reg [7:0] dag_60_entry_add_8_8_1;
+reg [7:0] dag_60_entry_and_8_8_0_op0;
+reg [7:0] dag_60_entry_and_8_8_0_op1;
+reg [7:0] dag_60_entry_and_8_8_0;
+reg [31:0] dag_60_entry_and_32_32_0_op0;
+reg [31:0] dag_60_entry_and_32_32_0_op1;
+reg [31:0] dag_60_entry_and_32_32_0;
+reg [31:0] dag_60_entry_or_32_32_0_op0;
+reg [31:0] dag_60_entry_or_32_32_0_op1;
+reg [31:0] dag_60_entry_or_32_32_0;
+reg [15:0] dag_60_entry_add_16_16_0_op0;
+reg [15:0] dag_60_entry_add_16_16_0_op1;
+reg [15:0] dag_60_entry_add_16_16_0;
+reg [15:0] dag_60_entry_add_16_16_1_op0;
+reg [15:0] dag_60_entry_add_16_16_1_op1;
+reg [15:0] dag_60_entry_add_16_16_1;
+reg [31:0] dag_60_entry_mul_32_32_0_op0;
+reg [31:0] dag_60_entry_mul_32_32_0_op1;
+reg [31:0] dag_60_entry_mul_32_32_0;
+reg [15:0] dag_60_entry_mul_16_16_0_op0;
+reg [7:0] dag_60_entry_mul_16_16_0_op1;
+reg [15:0] dag_60_entry_mul_16_16_0;
+reg [7:0] dag_60_entry_18;
+reg [63:0] dag_60_entry_28;
+reg [63:0] dag_60_entry_30;
+reg [31:0] dag_60_entry_50;
+reg [63:0] dag_60_entry_24;
+reg [15:0] dag_60_entry_52;
+reg [15:0] dag_60_entry_55;
+reg [15:0] dag_60_entry_48;
+reg [63:0] dag_60_entry_53;
+reg [7:0] dag_60_entry_59;
+reg [63:0] dag_60_entry_57;
+reg [7:0] dag_60_entry_62;
+reg [31:0] dag_60_entry_64;
+reg [7:0] dag_60_entry_49;
+reg [31:0] dag_60_entry_65;
+
+/* FSM BEGIN ---------------------------------------------------------------*/
+
+always @ (posedge clk) begin
+	if (reset == 1'b1) begin
+		cur_state <= BPHLS;
+	end else begin 
+		cur_state <= next_state;
+	end
+end
+
+always @ (*) begin
+	next_state = cur_state;
+
+	case (cur_state)
+	BPHLS:
+		if ((start == 1'd1)) begin
+			next_state = BPHLS_F_dag_60_BB_0_S_0;
+		end
+	BPHLS_F_dag_60_BB_0_S_0:
+		next_state = BPHLS_F_dag_60_BB_0_S_1;
+	BPHLS_F_dag_60_BB_0_S_1:
+		next_state = BPHLS_F_dag_60_BB_0_S_2;
+	BPHLS_F_dag_60_BB_0_S_2:
+		next_state = BPHLS_F_dag_60_BB_0_S_3;
+	BPHLS_F_dag_60_BB_0_S_3:
+		next_state = BPHLS_F_dag_60_BB_0_S_4;
+	BPHLS_F_dag_60_BB_0_S_4:
+		next_state = BPHLS;
+	default:
+		next_state = cur_state;
+	endcase
+end
+
+/* FSM END -----------------------------------------------------------------*/
+
+always @ (*) begin
+	dag_60_entry_8[15:0] = dag_60_entry_add_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_0)) begin
+		dag_60_entry_8_reg[15:0] <= dag_60_entry_8[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_1)) begin
+		dag_60_entry_8_reg[15:0] <= dag_60_entry_35[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_60_entry_9[31:0] = dag_60_entry_or_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_0)) begin
+		dag_60_entry_9_reg[31:0] <= dag_60_entry_9[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_60_entry_10[63:0] = (arg_7 ^ arg_6);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_0)) begin
+		dag_60_entry_10_reg[63:0] <= dag_60_entry_10[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_60_entry_11[7:0] = dag_60_entry_mul_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_0)) begin
+		dag_60_entry_11_reg[7:0] <= dag_60_entry_11[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_2)) begin
+		dag_60_entry_11_reg[7:0] <= dag_60_entry_32[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_1)) begin
+		dag_60_entry_11_reg[7:0] <= dag_60_entry_67[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_60_entry_12[7:0] = dag_60_entry_and_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_0)) begin
+		dag_60_entry_12_reg[7:0] <= dag_60_entry_12[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_2)) begin
+		dag_60_entry_12_reg[7:0] <= dag_60_entry_44[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_60_entry_13[31:0] = (arg_5 ^ arg_3);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_0)) begin
+		dag_60_entry_13_reg[31:0] <= dag_60_entry_13[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_60_entry_14[15:0] = dag_60_entry_and_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_0)) begin
+		dag_60_entry_14_reg[15:0] <= dag_60_entry_14[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_60_entry_15[7:0] = (dag_60_entry_11 - dag_60_entry_12);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_0)) begin
+		dag_60_entry_15_reg[7:0] <= dag_60_entry_15[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_60_entry_16[15:0] = dag_60_entry_add_16_16_1[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_0)) begin
+		dag_60_entry_16_reg[15:0] <= dag_60_entry_16[15:0];
+	end
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_1)) begin
+		dag_60_entry_16_reg[15:0] <= dag_60_entry_58[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_60_entry_17[63:0] = (arg_7 + arg_6);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_0)) begin
+		dag_60_entry_17_reg[63:0] <= dag_60_entry_17[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_60_entry_19[15:0] = (dag_60_entry_14 ^ dag_60_entry_16);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_0)) begin
+		dag_60_entry_19_reg[15:0] <= dag_60_entry_19[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_60_entry_20[7:0] = dag_60_entry_or_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_1)) begin
+		dag_60_entry_20_reg[7:0] <= dag_60_entry_20[7:0];
+	end
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_0)) begin
+		dag_60_entry_20_reg[7:0] <= dag_60_entry_22[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_60_entry_21[63:0] = (dag_60_entry_17 - dag_60_entry_17);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_0)) begin
+		dag_60_entry_21_reg <= dag_60_entry_21;
+	end
+end
+
+always @ (*) begin
+	dag_60_entry_22[7:0] = dag_60_entry_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_60_entry_22_reg[7:0] = dag_60_entry_20_reg[7:0];
+end
+
+always @ (*) begin
+	dag_60_entry_23[7:0] = dag_60_entry_add_8_8_1[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_0)) begin
+		dag_60_entry_23_reg[7:0] <= dag_60_entry_23[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_60_entry_25[31:0] = (arg_5 - arg_4);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_0)) begin
+		dag_60_entry_25_reg[31:0] <= dag_60_entry_25[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_60_entry_26[31:0] = dag_60_entry_and_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_0)) begin
+		dag_60_entry_26_reg[31:0] <= dag_60_entry_26[31:0];
+	end
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_2)) begin
+		dag_60_entry_26_reg[31:0] <= dag_60_entry_63[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_60_entry_27[31:0] = dag_60_entry_and_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_1)) begin
+		dag_60_entry_27_reg[31:0] <= dag_60_entry_27[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_60_entry_29[15:0] = dag_60_entry_and_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_1)) begin
+		dag_60_entry_29_reg[15:0] <= dag_60_entry_29[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_60_entry_31[31:0] = (dag_60_entry_9 ^ arg_5);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_0)) begin
+		dag_60_entry_31_reg[31:0] <= dag_60_entry_31[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_60_entry_32[7:0] = dag_60_entry_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_60_entry_32_reg[7:0] = dag_60_entry_11_reg[7:0];
+end
+
+always @ (*) begin
+	dag_60_entry_33[63:0] = (dag_60_entry_17 & dag_60_entry_22);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_0)) begin
+		dag_60_entry_33_reg[7:0] <= dag_60_entry_33[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_60_entry_34[31:0] = (dag_60_entry_26 ^ dag_60_entry_9);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_0)) begin
+		dag_60_entry_34_reg[31:0] <= dag_60_entry_34[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_60_entry_35[15:0] = dag_60_entry_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_60_entry_35_reg[15:0] = dag_60_entry_8_reg[15:0];
+end
+
+always @ (*) begin
+	dag_60_entry_36[63:0] = (dag_60_entry_17 | dag_60_entry_10);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_0)) begin
+		dag_60_entry_36_reg[63:0] <= dag_60_entry_36[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_60_entry_37[7:0] = (dag_60_entry_12 ^ dag_60_entry_22);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_0)) begin
+		dag_60_entry_37_reg[7:0] <= dag_60_entry_37[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_60_entry_38[15:0] = dag_60_entry_mul_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_1)) begin
+		dag_60_entry_38_reg[15:0] <= dag_60_entry_38[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_60_entry_39[31:0] = (dag_60_entry_26_reg ^ dag_60_entry_27);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_1)) begin
+		dag_60_entry_39_reg[31:0] <= dag_60_entry_39[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_60_entry_40[63:0] = dag_60_entry_or_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_2)) begin
+		dag_60_entry_40_reg[7:0] <= dag_60_entry_40[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_60_entry_41[63:0] = (dag_60_entry_36 ^ dag_60_entry_31);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_0)) begin
+		dag_60_entry_41_reg[63:0] <= dag_60_entry_41[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_60_entry_42[7:0] = dag_60_entry_and_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_1)) begin
+		dag_60_entry_42_reg[7:0] <= dag_60_entry_42[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_60_entry_43[31:0] = (dag_60_entry_39 - dag_60_entry_13_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_1)) begin
+		dag_60_entry_43_reg[31:0] <= dag_60_entry_43[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_60_entry_44[7:0] = dag_60_entry_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_60_entry_44_reg[7:0] = dag_60_entry_12_reg[7:0];
+end
+
+always @ (*) begin
+	dag_60_entry_45[63:0] = (dag_60_entry_41_reg * dag_60_entry_21_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_1)) begin
+		dag_60_entry_45_reg <= dag_60_entry_45;
+	end
+end
+
+always @ (*) begin
+	dag_60_entry_46[7:0] = dag_60_entry_add_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_1)) begin
+		dag_60_entry_46_reg[7:0] <= dag_60_entry_46[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_60_entry_47[63:0] = dag_60_entry_or_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_3)) begin
+		dag_60_entry_47_reg[7:0] <= dag_60_entry_47[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_60_entry_51[63:0] = (dag_60_entry_45_reg ^ dag_60_entry_41_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_2)) begin
+		dag_60_entry_51_reg[63:0] <= dag_60_entry_51[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_60_entry_54[31:0] = dag_60_entry_or_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_1)) begin
+		dag_60_entry_54_reg[31:0] <= dag_60_entry_54[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_60_entry_56[7:0] = dag_60_entry_add_8_8_1[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_2)) begin
+		dag_60_entry_56_reg[7:0] <= dag_60_entry_56[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_60_entry_58[15:0] = dag_60_entry_add_16_16_1[15:0];
+end
+
+always @ (*) begin
+	dag_60_entry_58_reg[15:0] = dag_60_entry_16_reg[15:0];
+end
+
+always @ (*) begin
+	dag_60_entry_60[63:0] = (dag_60_entry_45_reg + dag_60_entry_51);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_2)) begin
+		dag_60_entry_60_reg[63:0] <= dag_60_entry_60[63:0];
+	end
+end
+
+always @ (*) begin
+	dag_60_entry_61[31:0] = (dag_60_entry_34_reg ^ dag_60_entry_27);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_1)) begin
+		dag_60_entry_61_reg[31:0] <= dag_60_entry_61[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_60_entry_63[31:0] = dag_60_entry_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_60_entry_63_reg[31:0] = dag_60_entry_26_reg[31:0];
+end
+
+always @ (*) begin
+	dag_60_entry_66[31:0] = dag_60_entry_mul_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_1)) begin
+		dag_60_entry_66_reg[31:0] <= dag_60_entry_66[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_60_entry_67[7:0] = dag_60_entry_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_60_entry_67_reg[7:0] = dag_60_entry_11_reg[7:0];
+end
+
+always @ (*) begin
+	dag_60_entry_68[63:0] = (dag_60_entry_67 ^ dag_60_entry_58);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_1)) begin
+		dag_60_entry_68_reg[15:0] <= dag_60_entry_68[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_60_entry_69[63:0] = (dag_60_entry_68_reg ^ dag_60_entry_66_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_2)) begin
+		dag_60_entry_69_reg[31:0] <= dag_60_entry_69[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_60_entry_70[63:0] = (dag_60_entry_69 ^ dag_60_entry_60);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_2)) begin
+		dag_60_entry_70_reg[63:0] <= dag_60_entry_70[63:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_0)) begin
+		dag_60_entry_and_16_16_0_op0[15:0] = dag_60_entry_8[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_60_BB_0_S_1)) begin
+		dag_60_entry_and_16_16_0_op0[15:0] = arg_3[15:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_60_BB_0_S_2)) */ begin
+		dag_60_entry_and_16_16_0_op0[15:0] = dag_60_entry_19_reg[15:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_0)) begin
+		dag_60_entry_and_16_16_0_op1[15:0] = dag_60_entry_8[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_60_BB_0_S_1)) begin
+		dag_60_entry_and_16_16_0_op1[15:0] = dag_60_entry_19_reg[15:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_60_BB_0_S_2)) */ begin
+		dag_60_entry_and_16_16_0_op1[15:0] = dag_60_entry_35_reg[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_60_entry_and_16_16_0[15:0] = (dag_60_entry_and_16_16_0_op0 & dag_60_entry_and_16_16_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_0)) begin
+		dag_60_entry_mul_8_8_0_op0[7:0] = arg_1[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_60_BB_0_S_1)) begin
+		dag_60_entry_mul_8_8_0_op0[7:0] = dag_60_entry_37_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_60_BB_0_S_2)) */ begin
+		dag_60_entry_mul_8_8_0_op0[7:0] = arg_1[7:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_0)) begin
+		dag_60_entry_mul_8_8_0_op1[7:0] = arg_0[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_60_BB_0_S_1)) begin
+		dag_60_entry_mul_8_8_0_op1[7:0] = dag_60_entry_37_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_60_BB_0_S_2)) */ begin
+		dag_60_entry_mul_8_8_0_op1[7:0] = dag_60_entry_20_reg[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_60_entry_mul_8_8_0[7:0] = (dag_60_entry_mul_8_8_0_op0 * dag_60_entry_mul_8_8_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_0)) begin
+		dag_60_entry_or_8_8_0_op0[7:0] = dag_60_entry_11[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_60_BB_0_S_1)) begin
+		dag_60_entry_or_8_8_0_op0[7:0] = dag_60_entry_12_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_60_BB_0_S_2)) begin
+		dag_60_entry_or_8_8_0_op0[7:0] = dag_60_entry_33_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_60_BB_0_S_3)) begin
+		dag_60_entry_or_8_8_0_op0[7:0] = dag_60_entry_40_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_60_BB_0_S_4)) */ begin
+		dag_60_entry_or_8_8_0_op0[7:0] = dag_60_entry_20_reg[7:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_0)) begin
+		dag_60_entry_or_8_8_0_op1[7:0] = arg_1[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_60_BB_0_S_1)) begin
+		dag_60_entry_or_8_8_0_op1[7:0] = arg_1[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_60_BB_0_S_2)) begin
+		dag_60_entry_or_8_8_0_op1[7:0] = dag_60_entry_33_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_60_BB_0_S_3)) begin
+		dag_60_entry_or_8_8_0_op1[7:0] = dag_60_entry_32_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_60_BB_0_S_4)) */ begin
+		dag_60_entry_or_8_8_0_op1[7:0] = dag_60_entry_44_reg[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_60_entry_or_8_8_0[7:0] = (dag_60_entry_or_8_8_0_op0 | dag_60_entry_or_8_8_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_0)) begin
+		dag_60_entry_add_8_8_0_op0[7:0] = arg_0[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_60_BB_0_S_1)) begin
+		dag_60_entry_add_8_8_0_op0[7:0] = dag_60_entry_37_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_60_BB_0_S_2)) */ begin
+		dag_60_entry_add_8_8_0_op0[7:0] = dag_60_entry_46_reg[7:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_0)) begin
+		dag_60_entry_add_8_8_0_op1[7:0] = arg_0[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_60_BB_0_S_1)) begin
+		dag_60_entry_add_8_8_0_op1[7:0] = dag_60_entry_42[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_60_BB_0_S_2)) */ begin
+		dag_60_entry_add_8_8_0_op1[7:0] = dag_60_entry_42_reg[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_60_entry_add_8_8_0[7:0] = (dag_60_entry_add_8_8_0_op0 + dag_60_entry_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_0)) begin
+		dag_60_entry_add_8_8_1_op0[7:0] = dag_60_entry_12[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_60_BB_0_S_2)) */ begin
+		dag_60_entry_add_8_8_1_op0[7:0] = dag_60_entry_23_reg[7:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_0)) begin
+		dag_60_entry_add_8_8_1_op1[7:0] = dag_60_entry_12[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_60_BB_0_S_2)) */ begin
+		dag_60_entry_add_8_8_1_op1[7:0] = dag_60_entry_44[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_60_entry_add_8_8_1[7:0] = (dag_60_entry_add_8_8_1_op0 + dag_60_entry_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_0)) begin
+		dag_60_entry_and_8_8_0_op0[7:0] = dag_60_entry_11[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_60_BB_0_S_1)) begin
+		dag_60_entry_and_8_8_0_op0[7:0] = dag_60_entry_12_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_60_BB_0_S_2)) begin
+		dag_60_entry_and_8_8_0_op0[7:0] = dag_60_entry_23_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_60_BB_0_S_3)) */ begin
+		dag_60_entry_and_8_8_0_op0[7:0] = dag_60_entry_56_reg[7:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_0)) begin
+		dag_60_entry_and_8_8_0_op1[7:0] = dag_60_entry_11[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_60_BB_0_S_1)) begin
+		dag_60_entry_and_8_8_0_op1[7:0] = dag_60_entry_12_reg[7:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_60_BB_0_S_2)) begin
+		dag_60_entry_and_8_8_0_op1[7:0] = dag_60_entry_15_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_60_BB_0_S_3)) */ begin
+		dag_60_entry_and_8_8_0_op1[7:0] = dag_60_entry_32_reg[7:0];
+	end
+end
+
+always @ (*) begin
+	dag_60_entry_and_8_8_0[7:0] = (dag_60_entry_and_8_8_0_op0 & dag_60_entry_and_8_8_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_0)) begin
+		dag_60_entry_and_32_32_0_op0[31:0] = dag_60_entry_25[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_60_BB_0_S_1)) begin
+		dag_60_entry_and_32_32_0_op0[31:0] = dag_60_entry_25_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_60_BB_0_S_2)) */ begin
+		dag_60_entry_and_32_32_0_op0[31:0] = dag_60_entry_27_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_0)) begin
+		dag_60_entry_and_32_32_0_op1[31:0] = arg_4[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_60_BB_0_S_1)) begin
+		dag_60_entry_and_32_32_0_op1[31:0] = dag_60_entry_9_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_60_BB_0_S_2)) */ begin
+		dag_60_entry_and_32_32_0_op1[31:0] = dag_60_entry_31_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_60_entry_and_32_32_0[31:0] = (dag_60_entry_and_32_32_0_op0 & dag_60_entry_and_32_32_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_0)) begin
+		dag_60_entry_or_32_32_0_op0[31:0] = arg_4[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_60_BB_0_S_1)) */ begin
+		dag_60_entry_or_32_32_0_op0[31:0] = dag_60_entry_43[31:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_0)) begin
+		dag_60_entry_or_32_32_0_op1[31:0] = arg_1[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_60_BB_0_S_1)) */ begin
+		dag_60_entry_or_32_32_0_op1[31:0] = dag_60_entry_27[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_60_entry_or_32_32_0[31:0] = (dag_60_entry_or_32_32_0_op0 | dag_60_entry_or_32_32_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_0)) begin
+		dag_60_entry_add_16_16_0_op0[15:0] = arg_2[15:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_60_BB_0_S_1)) */ begin
+		dag_60_entry_add_16_16_0_op0[15:0] = arg_2[15:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_0)) begin
+		dag_60_entry_add_16_16_0_op1[15:0] = arg_2[15:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_60_BB_0_S_1)) */ begin
+		dag_60_entry_add_16_16_0_op1[15:0] = dag_60_entry_14_reg[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_60_entry_add_16_16_0[15:0] = (dag_60_entry_add_16_16_0_op0 + dag_60_entry_add_16_16_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_0)) begin
+		dag_60_entry_add_16_16_1_op0[15:0] = arg_3[15:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_60_BB_0_S_1)) */ begin
+		dag_60_entry_add_16_16_1_op0[15:0] = dag_60_entry_35[15:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_0)) begin
+		dag_60_entry_add_16_16_1_op1[15:0] = arg_2[15:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_60_BB_0_S_1)) */ begin
+		dag_60_entry_add_16_16_1_op1[15:0] = dag_60_entry_19_reg[15:0];
+	end
+end
+
+always @ (*) begin
+	dag_60_entry_add_16_16_1[15:0] = (dag_60_entry_add_16_16_1_op0 + dag_60_entry_add_16_16_1_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_1)) begin
+		dag_60_entry_mul_32_32_0_op0[31:0] = dag_60_entry_54[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_60_BB_0_S_2)) begin
+		dag_60_entry_mul_32_32_0_op0[31:0] = dag_60_entry_40[63:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_60_BB_0_S_3)) begin
+		dag_60_entry_mul_32_32_0_op0[31:0] = dag_60_entry_63_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_60_BB_0_S_4)) */ begin
+		dag_60_entry_mul_32_32_0_op0[31:0] = dag_60_entry_61_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_1)) begin
+		dag_60_entry_mul_32_32_0_op1[31:0] = dag_60_entry_54[31:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_60_BB_0_S_2)) begin
+		dag_60_entry_mul_32_32_0_op1[31:0] = dag_60_entry_38_reg[15:0];
+	end
+	else if ((cur_state == BPHLS_F_dag_60_BB_0_S_3)) begin
+		dag_60_entry_mul_32_32_0_op1[31:0] = dag_60_entry_61_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_dag_60_BB_0_S_4)) */ begin
+		dag_60_entry_mul_32_32_0_op1[31:0] = dag_60_entry_63_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	dag_60_entry_mul_32_32_0[31:0] = (dag_60_entry_mul_32_32_0_op0 * dag_60_entry_mul_32_32_0_op1);
+end
+
+always @ (*) begin
+	dag_60_entry_mul_16_16_0_op0[15:0] = dag_60_entry_35[15:0];
+end
+
+always @ (*) begin
+	dag_60_entry_mul_16_16_0_op1[7:0] = dag_60_entry_37_reg[7:0];
+end
+
+always @ (*) begin
+	dag_60_entry_mul_16_16_0[15:0] = (dag_60_entry_mul_16_16_0_op0 * dag_60_entry_mul_16_16_0_op1);
+end
+
+always @ (*) begin
+	dag_60_entry_18[7:0] = dag_60_entry_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_60_entry_28[63:0] = (dag_60_entry_21 + dag_60_entry_10);
+end
+
+always @ (*) begin
+	dag_60_entry_30[63:0] = (dag_60_entry_21 - dag_60_entry_11);
+end
+
+always @ (*) begin
+	dag_60_entry_50[31:0] = (dag_60_entry_26 - dag_60_entry_31);
+end
+
+always @ (*) begin
+	dag_60_entry_24[63:0] = (dag_60_entry_10_reg * arg_6);
+end
+
+always @ (*) begin
+	dag_60_entry_52[15:0] = (dag_60_entry_38 ^ dag_60_entry_35);
+end
+
+always @ (*) begin
+	dag_60_entry_55[15:0] = (dag_60_entry_14_reg ^ dag_60_entry_29);
+end
+
+always @ (*) begin
+	dag_60_entry_48[15:0] = dag_60_entry_and_16_16_0[15:0];
+end
+
+always @ (*) begin
+	dag_60_entry_53[63:0] = dag_60_entry_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_60_entry_59[7:0] = dag_60_entry_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_60_entry_57[63:0] = (dag_60_entry_47 ^ dag_60_entry_45_reg);
+end
+
+always @ (*) begin
+	dag_60_entry_62[7:0] = dag_60_entry_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_60_entry_64[31:0] = dag_60_entry_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	dag_60_entry_49[7:0] = dag_60_entry_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	dag_60_entry_65[31:0] = dag_60_entry_mul_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS)) begin
+		finish <= 1'd0;
+	end
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_4)) begin
+		finish <= 1'd1;
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS)) begin
+		return_val[63:0] <= 64'd0;
+	end
+	if ((cur_state == BPHLS_F_dag_60_BB_0_S_4)) begin
+		return_val[63:0] <= dag_60_entry_70_reg[63:0];
+	end
+end
+
+endmodule
@@ -0,0 +1,49 @@
+; ModuleID = 'loops_10'
+source_filename = "loops_10"
+
+define i64 @loops_10(i8 %0, i8 %1, i16 %2, i16 %3, i32 %4, i32 %5, i64 %6, i64 %7) {
+entry:
+  br label %loop0
+
+loop0:                                            ; preds = %exit1, %entry
+  %8 = phi i32 [ 0, %entry ], [ %30, %exit1 ]
+  %9 = phi i64 [ %7, %entry ], [ %25, %exit1 ]
+  br label %loop1
+
+loop1:                                            ; preds = %exit2, %loop0
+  %10 = phi i32 [ 0, %loop0 ], [ %28, %exit2 ]
+  %11 = phi i64 [ %9, %loop0 ], [ %25, %exit2 ]
+  br label %loop2
+
+loop2:                                            ; preds = %loop2, %loop1
+  %12 = phi i32 [ 0, %loop1 ], [ %26, %loop2 ]
+  %13 = phi i64 [ %11, %loop1 ], [ %25, %loop2 ]
+  %14 = add i16 %2, %2
+  %15 = zext i8 %1 to i32
+  %16 = or i32 %4, %15
+  %17 = xor i64 %7, %7
+  %18 = mul i8 %1, %0
+  %19 = and i8 %18, %18
+  %20 = zext i16 %3 to i32
+  %21 = xor i32 %5, %20
+  %22 = and i16 %14, %14
+  %23 = sub i8 %18, %19
+  %24 = zext i8 %23 to i64
+  %25 = add i64 %13, %24
+  %26 = add i32 %12, 1
+  %27 = icmp ult i32 %26, 4
+  br i1 %27, label %loop2, label %exit2
+
+exit2:                                            ; preds = %loop2
+  %28 = add i32 %10, 1
+  %29 = icmp ult i32 %28, 4
+  br i1 %29, label %loop1, label %exit1
+
+exit1:                                            ; preds = %exit2
+  %30 = add i32 %8, 1
+  %31 = icmp ult i32 %30, 4
+  br i1 %31, label %loop0, label %exit0
+
+exit0:                                            ; preds = %exit1
+  ret i64 %25
+}
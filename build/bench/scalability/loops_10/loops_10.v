@@ -0,0 +1,538 @@
+module loops_10
+(
+	input wire  clk,
+	input wire  reset,
+	input wire  start,
+	output reg  finish,
+	output reg [63:0] return_val,
+	input wire [7:0] arg_0,
+	input wire [7:0] arg_1,
+	input wire [15:0] arg_2,
+	input wire [15:0] arg_3,
+	input wire [31:0] arg_4,
+	input wire [31:0] arg_5,
+	input wire [63:0] arg_6,
+	input wire [63:0] arg_7
+);
+
+parameter [3:0] BPHLS = 4'd0;
+parameter [3:0] BPHLS_F_loops_10_BB_0_S_0 = 4'd1;
+parameter [3:0] BPHLS_F_loops_10_BB_1_S_0 = 4'd2;
+parameter [3:0] BPHLS_F_loops_10_BB_2_S_0 = 4'd3;
+parameter [3:0] BPHLS_F_loops_10_BB_2_S_1 = 4'd4;
+parameter [3:0] BPHLS_F_loops_10_BB_3_S_0 = 4'd5;
+parameter [3:0] BPHLS_F_loops_10_BB_3_S_1 = 4'd6;
+parameter [3:0] BPHLS_F_loops_10_BB_4_S_0 = 4'd7;
+parameter [3:0] BPHLS_F_loops_10_BB_4_S_1 = 4'd8;
+parameter [3:0] BPHLS_F_loops_10_BB_5_S_0 = 4'd9;
+
+reg [3:0] cur_state;
+reg [3:0] next_state;
+wire [1:0] loops_10_loop0_8;
+reg [1:0] loops_10_loop0_8_reg;
+wire [63:0] loops_10_loop0_9;
+reg [63:0] loops_10_loop0_9_reg;
+wire [1:0] loops_10_loop1_10;
+reg [1:0] loops_10_loop1_10_reg;
+wire [63:0] loops_10_loop1_11;
+reg [63:0] loops_10_loop1_11_reg;
+wire [1:0] loops_10_loop2_12;
+reg [1:0] loops_10_loop2_12_reg;
+wire [63:0] loops_10_loop2_13;
+reg [63:0] loops_10_loop2_13_reg;
+reg [15:0] loops_10_loop2_14;
+reg [15:0] bp_reg_1;
+reg [15:0] loops_10_loop2_14_reg;
+reg [7:0] loops_10_loop2_17;
+reg [7:0] bp_reg_2;
+reg [7:0] loops_10_loop2_17_reg;
+reg [7:0] loops_10_loop2_18;
+reg [7:0] bp_reg_3;
+reg [7:0] loops_10_loop2_18_reg;
+reg [7:0] loops_10_loop2_21;
+reg [7:0] bp_reg_4;
+reg [7:0] loops_10_loop2_21_reg;
+reg [63:0] loops_10_loop2_22;
+reg [63:0] bp_reg_0;
+reg [63:0] loops_10_loop2_22_reg;
+reg [31:0] loops_10_loop2_23;
+reg [2:0] bp_reg_5;
+reg [2:0] loops_10_loop2_23_reg;
+reg  loops_10_loop2_24;
+reg  bp_reg_8;
+reg  loops_10_loop2_24_reg;
+reg [31:0] loops_10_exit2_25;
+reg [2:0] bp_reg_6;
+reg [2:0] loops_10_exit2_25_reg;
+reg  loops_10_exit2_26;
+reg  loops_10_exit2_26_reg;
+reg [31:0] loops_10_exit1_27;
+reg [2:0] bp_reg_7;
+reg [2:0] loops_10_exit1_27_reg;
+reg  loops_10_exit1_28;
+reg  loops_10_exit1_28_reg;
+reg [15:0] loops_10_loop2_and_16_16_0_op0;
+reg [15:0] loops_10_loop2_and_16_16_0_op1;
+reg [15:0] loops_10_loop2_and_16_16_0;
+reg [2:0] loops_10_loop2_icmp_8_0_op0;
+reg [2:0] loops_10_loop2_icmp_8_0_op1;
+reg  loops_10_loop2_icmp_8_0;
+reg [7:0] loops_10_loop2_mul_8_8_0_op0;
+reg [7:0] loops_10_loop2_mul_8_8_0_op1;
+reg [7:0] loops_10_loop2_mul_8_8_0;
+reg [1:0] loops_10_loop2_add_8_8_0_op0;
+reg  loops_10_loop2_add_8_8_0_op1;
+reg [2:0] loops_10_loop2_add_8_8_0;
+reg [7:0] loops_10_loop2_and_8_8_0_op0;
+reg [7:0] loops_10_loop2_and_8_8_0_op1;
+reg [7:0] loops_10_loop2_and_8_8_0;
+reg [31:0] loops_10_loop2_or_32_32_0_op0;
+reg [7:0] loops_10_loop2_or_32_32_0_op1;
+reg [31:0] loops_10_loop2_or_32_32_0;
+reg [15:0] loops_10_loop2_add_16_16_0_op0;
+reg [15:0] loops_10_loop2_add_16_16_0_op1;
+reg [15:0] loops_10_loop2_add_16_16_0;
+reg [2:0] loops_10_exit2_icmp_8_0_op0;
+reg [2:0] loops_10_exit2_icmp_8_0_op1;
+reg  loops_10_exit2_icmp_8_0;
+reg [1:0] loops_10_exit2_add_8_8_0_op0;
+reg  loops_10_exit2_add_8_8_0_op1;
+reg [2:0] loops_10_exit2_add_8_8_0;
+reg [2:0] loops_10_exit1_icmp_8_0_op0;
+reg [2:0] loops_10_exit1_icmp_8_0_op1;
+reg  loops_10_exit1_icmp_8_0;
+reg [1:0] loops_10_exit1_add_8_8_0_op0;
+reg  loops_10_exit1_add_8_8_0_op1;
+reg [2:0] loops_10_exit1_add_8_8_0;
+reg [31:0] loops_10_loop2_15;
+reg [63:0] loops_10_loop2_16;
+reg [31:0] loops_10_loop2_19;
+reg [15:0] loops_10_loop2_20;
+
+/* FSM BEGIN ---------------------------------------------------------------*/
+
+always @ (posedge clk) begin
+	if (reset == 1'b1) begin
+		cur_state <= BPHLS;
+	end else begin 
+		cur_state <= next_state;
+	end
+end
+
+always @ (*) begin
+	next_state = cur_state;
+
+	case (cur_state)
+	BPHLS:
+		if ((start == 1'd1)) begin
+			next_state = BPHLS_F_loops_10_BB_0_S_0;
+		end
+	BPHLS_F_loops_10_BB_0_S_0:
+		next_state = BPHLS_F_loops_10_BB_1_S_0;
+	BPHLS_F_loops_10_BB_1_S_0:
+		next_state = BPHLS_F_loops_10_BB_2_S_0;
+	BPHLS_F_loops_10_BB_2_S_0:
+		next_state = BPHLS_F_loops_10_BB_2_S_1;
+	BPHLS_F_loops_10_BB_2_S_1:
+		if ((loops_10_loop2_24_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_10_BB_2_S_0;
+		end
+		else if ((loops_10_loop2_24_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_10_BB_3_S_0;
+		end
+	BPHLS_F_loops_10_BB_3_S_0:
+		next_state = BPHLS_F_loops_10_BB_3_S_1;
+	BPHLS_F_loops_10_BB_3_S_1:
+		if ((loops_10_exit2_26_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_10_BB_1_S_0;
+		end
+		else if ((loops_10_exit2_26_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_10_BB_4_S_0;
+		end
+	BPHLS_F_loops_10_BB_4_S_0:
+		next_state = BPHLS_F_loops_10_BB_4_S_1;
+	BPHLS_F_loops_10_BB_4_S_1:
+		if ((loops_10_exit1_28_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_10_BB_0_S_0;
+		end
+		else if ((loops_10_exit1_28_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_10_BB_5_S_0;
+		end
+	BPHLS_F_loops_10_BB_5_S_0:
+		next_state = BPHLS;
+	default:
+		next_state = cur_state;
+	endcase
+end
+
+/* FSM END -----------------------------------------------------------------*/
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS) & (start == 1'd1))) begin
+		loops_10_loop0_8_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_10_BB_4_S_1) & (loops_10_exit1_28_reg == 1'd1))) begin
+		loops_10_loop0_8_reg[1:0] <= loops_10_exit1_27_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS) & (start == 1'd1))) begin
+		loops_10_loop0_9_reg[63:0] <= arg_7[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_10_BB_4_S_1) & (loops_10_exit1_28_reg == 1'd1))) begin
+		loops_10_loop0_9_reg[63:0] <= loops_10_loop2_22_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_10_BB_0_S_0)) begin
+		loops_10_loop1_10_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_10_BB_3_S_1) & (loops_10_exit2_26_reg == 1'd1))) begin
+		loops_10_loop1_10_reg[1:0] <= loops_10_exit2_25_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_10_BB_0_S_0)) begin
+		loops_10_loop1_11_reg[63:0] <= loops_10_loop0_9_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_10_BB_3_S_1) & (loops_10_exit2_26_reg == 1'd1))) begin
+		loops_10_loop1_11_reg[63:0] <= loops_10_loop2_22_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_10_BB_1_S_0)) begin
+		loops_10_loop2_12_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_10_BB_2_S_1) & (loops_10_loop2_24_reg == 1'd1))) begin
+		loops_10_loop2_12_reg[1:0] <= loops_10_loop2_23_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_10_BB_1_S_0)) begin
+		loops_10_loop2_13_reg[63:0] <= loops_10_loop1_11_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_10_BB_2_S_1) & (loops_10_loop2_24_reg == 1'd1))) begin
+		loops_10_loop2_13_reg[63:0] <= loops_10_loop2_22_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_10_loop2_14[15:0] = loops_10_loop2_add_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_10_BB_2_S_0)) begin
+		bp_reg_1[15:0] <= loops_10_loop2_14[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_10_loop2_14_reg[15:0] = bp_reg_1[15:0];
+end
+
+always @ (*) begin
+	loops_10_loop2_17[7:0] = loops_10_loop2_mul_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_10_BB_2_S_0)) begin
+		bp_reg_2[7:0] <= loops_10_loop2_17[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_10_loop2_17_reg[7:0] = bp_reg_2[7:0];
+end
+
+always @ (*) begin
+	loops_10_loop2_18[7:0] = loops_10_loop2_and_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_10_BB_2_S_0)) begin
+		bp_reg_3[7:0] <= loops_10_loop2_18[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_10_loop2_18_reg[7:0] = bp_reg_3[7:0];
+end
+
+always @ (*) begin
+	loops_10_loop2_21[7:0] = (loops_10_loop2_17 - loops_10_loop2_18);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_10_BB_2_S_0)) begin
+		bp_reg_4[7:0] <= loops_10_loop2_21[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_10_loop2_21_reg[7:0] = bp_reg_4[7:0];
+end
+
+always @ (*) begin
+	loops_10_loop2_22[63:0] = (loops_10_loop2_13_reg + loops_10_loop2_21);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_10_BB_2_S_0)) begin
+		bp_reg_0[63:0] <= loops_10_loop2_22[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_10_loop2_22_reg[63:0] = bp_reg_0[63:0];
+end
+
+always @ (*) begin
+	loops_10_loop2_23[31:0] = loops_10_loop2_add_8_8_0[2:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_10_BB_2_S_0)) begin
+		bp_reg_5[2:0] <= loops_10_loop2_23[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_10_BB_3_S_0)) begin
+		bp_reg_5[0:0] <= loops_10_exit2_26;
+	end
+end
+
+always @ (*) begin
+	loops_10_loop2_23_reg[2:0] = bp_reg_5[2:0];
+end
+
+always @ (*) begin
+	loops_10_loop2_24 = loops_10_loop2_icmp_8_0;
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_10_BB_2_S_0)) begin
+		bp_reg_8 <= loops_10_loop2_24;
+	end
+end
+
+always @ (*) begin
+	loops_10_loop2_24_reg = bp_reg_8;
+end
+
+always @ (*) begin
+	loops_10_exit2_25[31:0] = loops_10_exit2_add_8_8_0[2:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_10_BB_3_S_0)) begin
+		bp_reg_6[2:0] <= loops_10_exit2_25[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_10_BB_4_S_0)) begin
+		bp_reg_6[0:0] <= loops_10_exit1_28;
+	end
+end
+
+always @ (*) begin
+	loops_10_exit2_25_reg[2:0] = bp_reg_6[2:0];
+end
+
+always @ (*) begin
+	loops_10_exit2_26 = loops_10_exit2_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_10_exit2_26_reg = bp_reg_5[0:0];
+end
+
+always @ (*) begin
+	loops_10_exit1_27[31:0] = loops_10_exit1_add_8_8_0[2:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_10_BB_4_S_0)) begin
+		bp_reg_7[2:0] <= loops_10_exit1_27[2:0];
+	end
+end
+
+always @ (*) begin
+	loops_10_exit1_27_reg[2:0] = bp_reg_7[2:0];
+end
+
+always @ (*) begin
+	loops_10_exit1_28 = loops_10_exit1_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_10_exit1_28_reg = bp_reg_6[0:0];
+end
+
+always @ (*) begin
+	loops_10_loop2_and_16_16_0_op0[15:0] = loops_10_loop2_14[15:0];
+end
+
+always @ (*) begin
+	loops_10_loop2_and_16_16_0_op1[15:0] = loops_10_loop2_14[15:0];
+end
+
+always @ (*) begin
+	loops_10_loop2_and_16_16_0[15:0] = (loops_10_loop2_and_16_16_0_op0 & loops_10_loop2_and_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_10_loop2_icmp_8_0_op0[2:0] = loops_10_loop2_23[31:0];
+end
+
+always @ (*) begin
+	loops_10_loop2_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_10_loop2_icmp_8_0 = (loops_10_loop2_icmp_8_0_op0 < loops_10_loop2_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_10_loop2_mul_8_8_0_op0[7:0] = arg_1[7:0];
+end
+
+always @ (*) begin
+	loops_10_loop2_mul_8_8_0_op1[7:0] = arg_0[7:0];
+end
+
+always @ (*) begin
+	loops_10_loop2_mul_8_8_0[7:0] = (loops_10_loop2_mul_8_8_0_op0 * loops_10_loop2_mul_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_10_loop2_add_8_8_0_op0[1:0] = loops_10_loop2_12_reg[1:0];
+end
+
+always @ (*) begin
+	loops_10_loop2_add_8_8_0_op1 = 32'd1;
+end
+
+always @ (*) begin
+	loops_10_loop2_add_8_8_0[2:0] = (loops_10_loop2_add_8_8_0_op0 + loops_10_loop2_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_10_loop2_and_8_8_0_op0[7:0] = loops_10_loop2_17[7:0];
+end
+
+always @ (*) begin
+	loops_10_loop2_and_8_8_0_op1[7:0] = loops_10_loop2_17[7:0];
+end
+
+always @ (*) begin
+	loops_10_loop2_and_8_8_0[7:0] = (loops_10_loop2_and_8_8_0_op0 & loops_10_loop2_and_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_10_loop2_or_32_32_0_op0[31:0] = arg_4[31:0];
+end
+
+always @ (*) begin
+	loops_10_loop2_or_32_32_0_op1[7:0] = arg_1[7:0];
+end
+
+always @ (*) begin
+	loops_10_loop2_or_32_32_0[31:0] = (loops_10_loop2_or_32_32_0_op0 | loops_10_loop2_or_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_10_loop2_add_16_16_0_op0[15:0] = arg_2[15:0];
+end
+
+always @ (*) begin
+	loops_10_loop2_add_16_16_0_op1[15:0] = arg_2[15:0];
+end
+
+always @ (*) begin
+	loops_10_loop2_add_16_16_0[15:0] = (loops_10_loop2_add_16_16_0_op0 + loops_10_loop2_add_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_10_exit2_icmp_8_0_op0[2:0] = loops_10_exit2_25[31:0];
+end
+
+always @ (*) begin
+	loops_10_exit2_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_10_exit2_icmp_8_0 = (loops_10_exit2_icmp_8_0_op0 < loops_10_exit2_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_10_exit2_add_8_8_0_op0[1:0] = loops_10_loop1_10_reg[1:0];
+end
+
+always @ (*) begin
+	loops_10_exit2_add_8_8_0_op1 = 32'd1;
+end
+
+always @ (*) begin
+	loops_10_exit2_add_8_8_0[2:0] = (loops_10_exit2_add_8_8_0_op0 + loops_10_exit2_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_10_exit1_icmp_8_0_op0[2:0] = loops_10_exit1_27[31:0];
+end
+
+always @ (*) begin
+	loops_10_exit1_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_10_exit1_icmp_8_0 = (loops_10_exit1_icmp_8_0_op0 < loops_10_exit1_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_10_exit1_add_8_8_0_op0[1:0] = loops_10_loop0_8_reg[1:0];
+end
+
+always @ (*) begin
+	loops_10_exit1_add_8_8_0_op1 = 32'd1;
+end
+
+always @ (*) begin
+	loops_10_exit1_add_8_8_0[2:0] = (loops_10_exit1_add_8_8_0_op0 + loops_10_exit1_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_10_loop2_15[31:0] = loops_10_loop2_or_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_10_loop2_16[63:0] = (arg_7 ^ arg_7);
+end
+
+always @ (*) begin
+	loops_10_loop2_19[31:0] = (arg_5 ^ arg_3);
+end
+
+always @ (*) begin
+	loops_10_loop2_20[15:0] = loops_10_loop2_and_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS)) begin
+		finish <= 1'd0;
+	end
+	if ((cur_state == BPHLS_F_loops_10_BB_5_S_0)) begin
+		finish <= 1'd1;
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS)) begin
+		return_val[63:0] <= 64'd0;
+	end
+	if ((cur_state == BPHLS_F_loops_10_BB_5_S_0)) begin
+		return_val[63:0] <= loops_10_loop2_22_reg[63:0];
+	end
+end
+
+endmodule
@@ -0,0 +1,1833 @@
+module loops_100
+(
+	input wire  clk,
+	input wire  reset,
+	input wire  start,
+	output reg  finish,
+	output reg [63:0] return_val,
+	input wire [7:0] arg_0,
+	input wire [7:0] arg_1,
+	input wire [15:0] arg_2,
+	input wire [15:0] arg_3,
+	input wire [31:0] arg_4,
+	input wire [31:0] arg_5,
+	input wire [63:0] arg_6,
+	input wire [63:0] arg_7
+);
+
+parameter [5:0] BPHLS = 6'd0;
+parameter [5:0] BPHLS_F_loops_100_BB_0_S_0 = 6'd1;
+parameter [5:0] BPHLS_F_loops_100_BB_1_S_0 = 6'd2;
+parameter [5:0] BPHLS_F_loops_100_BB_2_S_0 = 6'd3;
+parameter [5:0] BPHLS_F_loops_100_BB_2_S_1 = 6'd4;
+parameter [5:0] BPHLS_F_loops_100_BB_3_S_0 = 6'd5;
+parameter [5:0] BPHLS_F_loops_100_BB_3_S_1 = 6'd6;
+parameter [5:0] BPHLS_F_loops_100_BB_4_S_0 = 6'd7;
+parameter [5:0] BPHLS_F_loops_100_BB_4_S_1 = 6'd8;
+parameter [5:0] BPHLS_F_loops_100_BB_5_S_0 = 6'd9;
+parameter [5:0] BPHLS_F_loops_100_BB_6_S_0 = 6'd10;
+parameter [5:0] BPHLS_F_loops_100_BB_7_S_0 = 6'd11;
+parameter [5:0] BPHLS_F_loops_100_BB_7_S_1 = 6'd12;
+parameter [5:0] BPHLS_F_loops_100_BB_7_S_2 = 6'd13;
+parameter [5:0] BPHLS_F_loops_100_BB_8_S_0 = 6'd14;
+parameter [5:0] BPHLS_F_loops_100_BB_8_S_1 = 6'd15;
+parameter [5:0] BPHLS_F_loops_100_BB_9_S_0 = 6'd16;
+parameter [5:0] BPHLS_F_loops_100_BB_9_S_1 = 6'd17;
+parameter [5:0] BPHLS_F_loops_100_BB_10_S_0 = 6'd18;
+parameter [5:0] BPHLS_F_loops_100_BB_11_S_0 = 6'd19;
+parameter [5:0] BPHLS_F_loops_100_BB_12_S_0 = 6'd20;
+parameter [5:0] BPHLS_F_loops_100_BB_12_S_1 = 6'd21;
+parameter [5:0] BPHLS_F_loops_100_BB_13_S_0 = 6'd22;
+parameter [5:0] BPHLS_F_loops_100_BB_13_S_1 = 6'd23;
+parameter [5:0] BPHLS_F_loops_100_BB_14_S_0 = 6'd24;
+parameter [5:0] BPHLS_F_loops_100_BB_14_S_1 = 6'd25;
+parameter [5:0] BPHLS_F_loops_100_BB_15_S_0 = 6'd26;
+parameter [5:0] BPHLS_F_loops_100_BB_16_S_0 = 6'd27;
+parameter [5:0] BPHLS_F_loops_100_BB_17_S_0 = 6'd28;
+parameter [5:0] BPHLS_F_loops_100_BB_17_S_1 = 6'd29;
+parameter [5:0] BPHLS_F_loops_100_BB_18_S_0 = 6'd30;
+parameter [5:0] BPHLS_F_loops_100_BB_18_S_1 = 6'd31;
+parameter [5:0] BPHLS_F_loops_100_BB_19_S_0 = 6'd32;
+parameter [5:0] BPHLS_F_loops_100_BB_19_S_1 = 6'd33;
+parameter [5:0] BPHLS_F_loops_100_BB_20_S_0 = 6'd34;
+
+reg [5:0] cur_state;
+reg [5:0] next_state;
+wire [1:0] loops_100_loop0_8;
+reg [1:0] loops_100_loop0_8_reg;
+wire [63:0] loops_100_loop0_9;
+reg [63:0] loops_100_loop0_9_reg;
+wire [1:0] loops_100_loop1_10;
+reg [1:0] loops_100_loop1_10_reg;
+wire [63:0] loops_100_loop1_11;
+reg [63:0] loops_100_loop1_11_reg;
+wire [1:0] loops_100_loop2_12;
+reg [1:0] loops_100_loop2_12_reg;
+wire [63:0] loops_100_loop2_13;
+reg [63:0] loops_100_loop2_13_reg;
+reg [15:0] loops_100_loop2_14;
+reg [15:0] bp_reg_4;
+reg [15:0] loops_100_loop2_14_reg;
+reg [31:0] loops_100_loop2_15;
+reg [31:0] bp_reg_2;
+reg [31:0] loops_100_loop2_15_reg;
+reg [7:0] loops_100_loop2_17;
+reg [7:0] bp_reg_7;
+reg [7:0] loops_100_loop2_17_reg;
+reg [7:0] loops_100_loop2_18;
+reg [7:0] bp_reg_8;
+reg [7:0] loops_100_loop2_18_reg;
+reg [15:0] loops_100_loop2_20;
+reg [15:0] bp_reg_5;
+reg [15:0] loops_100_loop2_20_reg;
+reg [7:0] loops_100_loop2_21;
+reg [7:0] bp_reg_9;
+reg [7:0] loops_100_loop2_21_reg;
+reg [63:0] loops_100_loop2_22;
+reg [63:0] bp_reg_0;
+reg [63:0] loops_100_loop2_22_reg;
+reg [31:0] loops_100_loop2_23;
+reg [2:0] bp_reg_11;
+reg [2:0] loops_100_loop2_23_reg;
+reg  loops_100_loop2_24;
+reg  bp_reg_17;
+reg  loops_100_loop2_24_reg;
+reg [31:0] loops_100_exit2_25;
+reg [2:0] bp_reg_12;
+reg [2:0] loops_100_exit2_25_reg;
+reg  loops_100_exit2_26;
+reg  loops_100_exit2_26_reg;
+reg [31:0] loops_100_exit1_27;
+reg [2:0] bp_reg_13;
+reg [2:0] loops_100_exit1_27_reg;
+reg  loops_100_exit1_28;
+reg  loops_100_exit1_28_reg;
+wire [1:0] loops_100_loop01_29;
+reg [1:0] loops_100_loop01_29_reg;
+wire [63:0] loops_100_loop01_30;
+reg [63:0] loops_100_loop01_30_reg;
+wire [1:0] loops_100_loop12_31;
+reg [1:0] loops_100_loop12_31_reg;
+wire [63:0] loops_100_loop12_32;
+reg [63:0] loops_100_loop12_32_reg;
+wire [1:0] loops_100_loop23_33;
+reg [1:0] loops_100_loop23_33_reg;
+wire [63:0] loops_100_loop23_34;
+reg [63:0] loops_100_loop23_34_reg;
+reg [15:0] loops_100_loop23_35;
+reg [15:0] loops_100_loop23_35_reg;
+reg [63:0] loops_100_loop23_36;
+reg [63:0] loops_100_loop23_36_reg;
+reg [15:0] loops_100_loop23_38;
+reg [15:0] bp_reg_6;
+reg [15:0] loops_100_loop23_38_reg;
+reg [7:0] loops_100_loop23_39;
+reg [7:0] bp_reg_10;
+reg [7:0] loops_100_loop23_39_reg;
+reg [63:0] loops_100_loop23_40;
+reg [63:0] bp_reg_1;
+reg [63:0] loops_100_loop23_40_reg;
+reg [7:0] loops_100_loop23_41;
+reg [7:0] loops_100_loop23_41_reg;
+reg [7:0] loops_100_loop23_42;
+reg [31:0] bp_reg_3;
+reg [7:0] loops_100_loop23_42_reg;
+reg [63:0] loops_100_loop23_43;
+reg [63:0] loops_100_loop23_43_reg;
+reg [31:0] loops_100_loop23_44;
+reg [2:0] loops_100_loop23_44_reg;
+reg  loops_100_loop23_45;
+reg  loops_100_loop23_45_reg;
+reg [31:0] loops_100_exit24_46;
+reg [2:0] loops_100_exit24_46_reg;
+reg  loops_100_exit24_47;
+reg  loops_100_exit24_47_reg;
+reg [31:0] loops_100_exit15_48;
+reg [2:0] bp_reg_14;
+reg [2:0] loops_100_exit15_48_reg;
+reg  loops_100_exit15_49;
+reg  loops_100_exit15_49_reg;
+wire [1:0] loops_100_loop07_50;
+reg [1:0] loops_100_loop07_50_reg;
+wire [63:0] loops_100_loop07_51;
+reg [63:0] loops_100_loop07_51_reg;
+wire [1:0] loops_100_loop18_52;
+reg [1:0] loops_100_loop18_52_reg;
+wire [63:0] loops_100_loop18_53;
+reg [63:0] loops_100_loop18_53_reg;
+wire [1:0] loops_100_loop29_54;
+reg [1:0] loops_100_loop29_54_reg;
+wire [63:0] loops_100_loop29_55;
+reg [63:0] loops_100_loop29_55_reg;
+reg [31:0] loops_100_loop29_57;
+reg [31:0] loops_100_loop29_57_reg;
+reg [31:0] loops_100_loop29_58;
+reg [31:0] loops_100_loop29_58_reg;
+reg [31:0] loops_100_loop29_59;
+reg [31:0] loops_100_loop29_59_reg;
+reg [31:0] loops_100_loop29_63;
+reg [31:0] loops_100_loop29_63_reg;
+reg [63:0] loops_100_loop29_64;
+reg [63:0] loops_100_loop29_64_reg;
+reg [31:0] loops_100_loop29_65;
+reg [2:0] loops_100_loop29_65_reg;
+reg  loops_100_loop29_66;
+reg  bp_reg_18;
+reg  loops_100_loop29_66_reg;
+reg [31:0] loops_100_exit210_67;
+reg [2:0] loops_100_exit210_67_reg;
+reg  loops_100_exit210_68;
+reg  bp_reg_19;
+reg  loops_100_exit210_68_reg;
+reg [31:0] loops_100_exit111_69;
+reg [2:0] bp_reg_15;
+reg [2:0] loops_100_exit111_69_reg;
+reg  loops_100_exit111_70;
+reg  loops_100_exit111_70_reg;
+wire [1:0] loops_100_loop013_71;
+reg [1:0] loops_100_loop013_71_reg;
+wire [63:0] loops_100_loop013_72;
+reg [63:0] loops_100_loop013_72_reg;
+wire [1:0] loops_100_loop114_73;
+reg [1:0] loops_100_loop114_73_reg;
+wire [63:0] loops_100_loop114_74;
+reg [63:0] loops_100_loop114_74_reg;
+wire [1:0] loops_100_loop215_75;
+reg [1:0] loops_100_loop215_75_reg;
+wire [63:0] loops_100_loop215_76;
+reg [63:0] loops_100_loop215_76_reg;
+reg [15:0] loops_100_loop215_80;
+reg [15:0] loops_100_loop215_80_reg;
+reg [7:0] loops_100_loop215_82;
+reg [7:0] loops_100_loop215_82_reg;
+reg [31:0] loops_100_loop215_84;
+reg [31:0] loops_100_loop215_84_reg;
+reg [63:0] loops_100_loop215_85;
+reg [63:0] loops_100_loop215_85_reg;
+reg [31:0] loops_100_loop215_86;
+reg [2:0] loops_100_loop215_86_reg;
+reg  loops_100_loop215_87;
+reg  loops_100_loop215_87_reg;
+reg [31:0] loops_100_exit216_88;
+reg [2:0] loops_100_exit216_88_reg;
+reg  loops_100_exit216_89;
+reg  loops_100_exit216_89_reg;
+reg [31:0] loops_100_exit117_90;
+reg [2:0] bp_reg_16;
+reg [2:0] loops_100_exit117_90_reg;
+reg  loops_100_exit117_91;
+reg  loops_100_exit117_91_reg;
+reg [15:0] loops_100_loop2_and_16_16_0_op0;
+reg [15:0] loops_100_loop2_and_16_16_0_op1;
+reg [15:0] loops_100_loop2_and_16_16_0;
+reg [2:0] loops_100_loop2_icmp_8_0_op0;
+reg [2:0] loops_100_loop2_icmp_8_0_op1;
+reg  loops_100_loop2_icmp_8_0;
+reg [7:0] loops_100_loop2_mul_8_8_0_op0;
+reg [7:0] loops_100_loop2_mul_8_8_0_op1;
+reg [7:0] loops_100_loop2_mul_8_8_0;
+reg [7:0] loops_100_loop2_add_8_8_0_op0;
+reg [7:0] loops_100_loop2_add_8_8_0_op1;
+reg [7:0] loops_100_loop2_add_8_8_0;
+reg [7:0] loops_100_loop2_and_8_8_0_op0;
+reg [7:0] loops_100_loop2_and_8_8_0_op1;
+reg [7:0] loops_100_loop2_and_8_8_0;
+reg [31:0] loops_100_loop2_or_32_32_0_op0;
+reg [7:0] loops_100_loop2_or_32_32_0_op1;
+reg [31:0] loops_100_loop2_or_32_32_0;
+reg [15:0] loops_100_loop2_add_16_16_0_op0;
+reg [15:0] loops_100_loop2_add_16_16_0_op1;
+reg [15:0] loops_100_loop2_add_16_16_0;
+reg [2:0] loops_100_exit2_icmp_8_0_op0;
+reg [2:0] loops_100_exit2_icmp_8_0_op1;
+reg  loops_100_exit2_icmp_8_0;
+reg [7:0] loops_100_exit2_add_8_8_0_op0;
+reg [7:0] loops_100_exit2_add_8_8_0_op1;
+reg [7:0] loops_100_exit2_add_8_8_0;
+reg [2:0] loops_100_exit1_icmp_8_0_op0;
+reg [2:0] loops_100_exit1_icmp_8_0_op1;
+reg  loops_100_exit1_icmp_8_0;
+reg [7:0] loops_100_exit1_add_8_8_0_op0;
+reg [7:0] loops_100_exit1_add_8_8_0_op1;
+reg [7:0] loops_100_exit1_add_8_8_0;
+reg [7:0] loops_100_loop23_or_8_8_0_op0;
+reg [7:0] loops_100_loop23_or_8_8_0_op1;
+reg [7:0] loops_100_loop23_or_8_8_0;
+reg [7:0] loops_100_loop23_add_8_8_0_op0;
+reg [7:0] loops_100_loop23_add_8_8_0_op1;
+reg [7:0] loops_100_loop23_add_8_8_0;
+reg [7:0] loops_100_loop23_add_8_8_1_op0;
+reg [7:0] loops_100_loop23_add_8_8_1_op1;
+reg [7:0] loops_100_loop23_add_8_8_1;
+reg [15:0] loops_100_loop23_add_16_16_0_op0;
+reg [15:0] loops_100_loop23_add_16_16_0_op1;
+reg [15:0] loops_100_loop23_add_16_16_0;
+reg [2:0] loops_100_loop23_icmp_8_0_op0;
+reg [2:0] loops_100_loop23_icmp_8_0_op1;
+reg  loops_100_loop23_icmp_8_0;
+reg [2:0] loops_100_exit24_icmp_8_0_op0;
+reg [2:0] loops_100_exit24_icmp_8_0_op1;
+reg  loops_100_exit24_icmp_8_0;
+reg [7:0] loops_100_exit24_add_8_8_1_op0;
+reg [7:0] loops_100_exit24_add_8_8_1_op1;
+reg [7:0] loops_100_exit24_add_8_8_1;
+reg [2:0] loops_100_exit15_icmp_8_0_op0;
+reg [2:0] loops_100_exit15_icmp_8_0_op1;
+reg  loops_100_exit15_icmp_8_0;
+reg [7:0] loops_100_exit15_add_8_8_0_op0;
+reg [7:0] loops_100_exit15_add_8_8_0_op1;
+reg [7:0] loops_100_exit15_add_8_8_0;
+reg [15:0] loops_100_loop29_and_16_16_0_op0;
+reg [15:0] loops_100_loop29_and_16_16_0_op1;
+reg [15:0] loops_100_loop29_and_16_16_0;
+reg [2:0] loops_100_loop29_icmp_8_0_op0;
+reg [2:0] loops_100_loop29_icmp_8_0_op1;
+reg  loops_100_loop29_icmp_8_0;
+reg [7:0] loops_100_loop29_add_8_8_1_op0;
+reg [7:0] loops_100_loop29_add_8_8_1_op1;
+reg [7:0] loops_100_loop29_add_8_8_1;
+reg [31:0] loops_100_loop29_and_32_32_0_op0;
+reg [31:0] loops_100_loop29_and_32_32_0_op1;
+reg [31:0] loops_100_loop29_and_32_32_0;
+reg [2:0] loops_100_exit210_icmp_8_0_op0;
+reg [2:0] loops_100_exit210_icmp_8_0_op1;
+reg  loops_100_exit210_icmp_8_0;
+reg [7:0] loops_100_exit210_add_8_8_0_op0;
+reg [7:0] loops_100_exit210_add_8_8_0_op1;
+reg [7:0] loops_100_exit210_add_8_8_0;
+reg [2:0] loops_100_exit111_icmp_8_0_op0;
+reg [2:0] loops_100_exit111_icmp_8_0_op1;
+reg  loops_100_exit111_icmp_8_0;
+reg [7:0] loops_100_exit111_add_8_8_1_op0;
+reg [7:0] loops_100_exit111_add_8_8_1_op1;
+reg [7:0] loops_100_exit111_add_8_8_1;
+reg [2:0] loops_100_loop215_icmp_8_0_op0;
+reg [2:0] loops_100_loop215_icmp_8_0_op1;
+reg  loops_100_loop215_icmp_8_0;
+reg [7:0] loops_100_loop215_mul_8_8_0_op0;
+reg [7:0] loops_100_loop215_mul_8_8_0_op1;
+reg [7:0] loops_100_loop215_mul_8_8_0;
+reg [7:0] loops_100_loop215_add_8_8_0_op0;
+reg [7:0] loops_100_loop215_add_8_8_0_op1;
+reg [7:0] loops_100_loop215_add_8_8_0;
+reg [15:0] loops_100_loop215_add_16_16_0_op0;
+reg [15:0] loops_100_loop215_add_16_16_0_op1;
+reg [15:0] loops_100_loop215_add_16_16_0;
+reg [15:0] loops_100_loop215_mul_16_16_0_op0;
+reg [7:0] loops_100_loop215_mul_16_16_0_op1;
+reg [15:0] loops_100_loop215_mul_16_16_0;
+reg [2:0] loops_100_exit216_icmp_8_0_op0;
+reg [2:0] loops_100_exit216_icmp_8_0_op1;
+reg  loops_100_exit216_icmp_8_0;
+reg [7:0] loops_100_exit216_add_8_8_1_op0;
+reg [7:0] loops_100_exit216_add_8_8_1_op1;
+reg [7:0] loops_100_exit216_add_8_8_1;
+reg [2:0] loops_100_exit117_icmp_8_0_op0;
+reg [2:0] loops_100_exit117_icmp_8_0_op1;
+reg  loops_100_exit117_icmp_8_0;
+reg [7:0] loops_100_exit117_add_8_8_0_op0;
+reg [7:0] loops_100_exit117_add_8_8_0_op1;
+reg [7:0] loops_100_exit117_add_8_8_0;
+reg [63:0] loops_100_loop2_16;
+reg [31:0] loops_100_loop2_19;
+reg [7:0] loops_100_loop23_37;
+reg [63:0] loops_100_loop29_56;
+reg [63:0] loops_100_loop29_60;
+reg [15:0] loops_100_loop29_61;
+reg [63:0] loops_100_loop29_62;
+reg [7:0] loops_100_loop215_77;
+reg [63:0] loops_100_loop215_78;
+reg [31:0] loops_100_loop215_79;
+reg [63:0] loops_100_loop215_81;
+reg [15:0] loops_100_loop215_83;
+
+/* FSM BEGIN ---------------------------------------------------------------*/
+
+always @ (posedge clk) begin
+	if (reset == 1'b1) begin
+		cur_state <= BPHLS;
+	end else begin 
+		cur_state <= next_state;
+	end
+end
+
+always @ (*) begin
+	next_state = cur_state;
+
+	case (cur_state)
+	BPHLS:
+		if ((start == 1'd1)) begin
+			next_state = BPHLS_F_loops_100_BB_0_S_0;
+		end
+	BPHLS_F_loops_100_BB_0_S_0:
+		next_state = BPHLS_F_loops_100_BB_1_S_0;
+	BPHLS_F_loops_100_BB_10_S_0:
+		next_state = BPHLS_F_loops_100_BB_11_S_0;
+	BPHLS_F_loops_100_BB_11_S_0:
+		next_state = BPHLS_F_loops_100_BB_12_S_0;
+	BPHLS_F_loops_100_BB_12_S_0:
+		next_state = BPHLS_F_loops_100_BB_12_S_1;
+	BPHLS_F_loops_100_BB_12_S_1:
+		if ((loops_100_loop29_66_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_100_BB_12_S_0;
+		end
+		else if ((loops_100_loop29_66_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_100_BB_13_S_0;
+		end
+	BPHLS_F_loops_100_BB_13_S_0:
+		next_state = BPHLS_F_loops_100_BB_13_S_1;
+	BPHLS_F_loops_100_BB_13_S_1:
+		if ((loops_100_exit210_68_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_100_BB_11_S_0;
+		end
+		else if ((loops_100_exit210_68_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_100_BB_14_S_0;
+		end
+	BPHLS_F_loops_100_BB_14_S_0:
+		next_state = BPHLS_F_loops_100_BB_14_S_1;
+	BPHLS_F_loops_100_BB_14_S_1:
+		if ((loops_100_exit111_70_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_100_BB_10_S_0;
+		end
+		else if ((loops_100_exit111_70_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_100_BB_15_S_0;
+		end
+	BPHLS_F_loops_100_BB_15_S_0:
+		next_state = BPHLS_F_loops_100_BB_16_S_0;
+	BPHLS_F_loops_100_BB_16_S_0:
+		next_state = BPHLS_F_loops_100_BB_17_S_0;
+	BPHLS_F_loops_100_BB_17_S_0:
+		next_state = BPHLS_F_loops_100_BB_17_S_1;
+	BPHLS_F_loops_100_BB_17_S_1:
+		if ((loops_100_loop215_87_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_100_BB_17_S_0;
+		end
+		else if ((loops_100_loop215_87_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_100_BB_18_S_0;
+		end
+	BPHLS_F_loops_100_BB_18_S_0:
+		next_state = BPHLS_F_loops_100_BB_18_S_1;
+	BPHLS_F_loops_100_BB_18_S_1:
+		if ((loops_100_exit216_89_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_100_BB_16_S_0;
+		end
+		else if ((loops_100_exit216_89_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_100_BB_19_S_0;
+		end
+	BPHLS_F_loops_100_BB_19_S_0:
+		next_state = BPHLS_F_loops_100_BB_19_S_1;
+	BPHLS_F_loops_100_BB_19_S_1:
+		if ((loops_100_exit117_91_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_100_BB_15_S_0;
+		end
+		else if ((loops_100_exit117_91_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_100_BB_20_S_0;
+		end
+	BPHLS_F_loops_100_BB_1_S_0:
+		next_state = BPHLS_F_loops_100_BB_2_S_0;
+	BPHLS_F_loops_100_BB_20_S_0:
+		next_state = BPHLS;
+	BPHLS_F_loops_100_BB_2_S_0:
+		next_state = BPHLS_F_loops_100_BB_2_S_1;
+	BPHLS_F_loops_100_BB_2_S_1:
+		if ((loops_100_loop2_24_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_100_BB_2_S_0;
+		end
+		else if ((loops_100_loop2_24_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_100_BB_3_S_0;
+		end
+	BPHLS_F_loops_100_BB_3_S_0:
+		next_state = BPHLS_F_loops_100_BB_3_S_1;
+	BPHLS_F_loops_100_BB_3_S_1:
+		if ((loops_100_exit2_26_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_100_BB_1_S_0;
+		end
+		else if ((loops_100_exit2_26_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_100_BB_4_S_0;
+		end
+	BPHLS_F_loops_100_BB_4_S_0:
+		next_state = BPHLS_F_loops_100_BB_4_S_1;
+	BPHLS_F_loops_100_BB_4_S_1:
+		if ((loops_100_exit1_28_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_100_BB_0_S_0;
+		end
+		else if ((loops_100_exit1_28_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_100_BB_5_S_0;
+		end
+	BPHLS_F_loops_100_BB_5_S_0:
+		next_state = BPHLS_F_loops_100_BB_6_S_0;
+	BPHLS_F_loops_100_BB_6_S_0:
+		next_state = BPHLS_F_loops_100_BB_7_S_0;
+	BPHLS_F_loops_100_BB_7_S_0:
+		next_state = BPHLS_F_loops_100_BB_7_S_1;
+	BPHLS_F_loops_100_BB_7_S_1:
+		next_state = BPHLS_F_loops_100_BB_7_S_2;
+	BPHLS_F_loops_100_BB_7_S_2:
+		if ((loops_100_loop23_45_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_100_BB_7_S_0;
+		end
+		else if ((loops_100_loop23_45_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_100_BB_8_S_0;
+		end
+	BPHLS_F_loops_100_BB_8_S_0:
+		next_state = BPHLS_F_loops_100_BB_8_S_1;
+	BPHLS_F_loops_100_BB_8_S_1:
+		if ((loops_100_exit24_47_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_100_BB_6_S_0;
+		end
+		else if ((loops_100_exit24_47_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_100_BB_9_S_0;
+		end
+	BPHLS_F_loops_100_BB_9_S_0:
+		next_state = BPHLS_F_loops_100_BB_9_S_1;
+	BPHLS_F_loops_100_BB_9_S_1:
+		if ((loops_100_exit15_49_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_100_BB_5_S_0;
+		end
+		else if ((loops_100_exit15_49_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_100_BB_10_S_0;
+		end
+	default:
+		next_state = cur_state;
+	endcase
+end
+
+/* FSM END -----------------------------------------------------------------*/
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS) & (start == 1'd1))) begin
+		loops_100_loop0_8_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_100_BB_4_S_1) & (loops_100_exit1_28_reg == 1'd1))) begin
+		loops_100_loop0_8_reg[1:0] <= loops_100_exit1_27_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS) & (start == 1'd1))) begin
+		loops_100_loop0_9_reg[63:0] <= arg_7[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_100_BB_4_S_1) & (loops_100_exit1_28_reg == 1'd1))) begin
+		loops_100_loop0_9_reg[63:0] <= loops_100_loop2_22_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_100_BB_0_S_0)) begin
+		loops_100_loop1_10_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_100_BB_3_S_1) & (loops_100_exit2_26_reg == 1'd1))) begin
+		loops_100_loop1_10_reg[1:0] <= loops_100_exit2_25_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_100_BB_0_S_0)) begin
+		loops_100_loop1_11_reg[63:0] <= loops_100_loop0_9_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_100_BB_3_S_1) & (loops_100_exit2_26_reg == 1'd1))) begin
+		loops_100_loop1_11_reg[63:0] <= loops_100_loop2_22_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_100_BB_1_S_0)) begin
+		loops_100_loop2_12_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_100_BB_2_S_1) & (loops_100_loop2_24_reg == 1'd1))) begin
+		loops_100_loop2_12_reg[1:0] <= loops_100_loop2_23_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_100_BB_1_S_0)) begin
+		loops_100_loop2_13_reg[63:0] <= loops_100_loop1_11_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_100_BB_2_S_1) & (loops_100_loop2_24_reg == 1'd1))) begin
+		loops_100_loop2_13_reg[63:0] <= loops_100_loop2_22_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_100_loop2_14[15:0] = loops_100_loop2_add_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_100_BB_2_S_0)) begin
+		bp_reg_4[15:0] <= loops_100_loop2_14[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_100_loop2_14_reg[15:0] = bp_reg_4[15:0];
+end
+
+always @ (*) begin
+	loops_100_loop2_15[31:0] = loops_100_loop2_or_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_100_BB_2_S_0)) begin
+		bp_reg_2[31:0] <= loops_100_loop2_15[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_100_loop2_15_reg[31:0] = bp_reg_2[31:0];
+end
+
+always @ (*) begin
+	loops_100_loop2_17[7:0] = loops_100_loop2_mul_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_100_BB_2_S_0)) begin
+		bp_reg_7[7:0] <= loops_100_loop2_17[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_100_BB_17_S_0)) begin
+		bp_reg_7[6:6] <= loops_100_loop215_87;
+	end
+end
+
+always @ (*) begin
+	loops_100_loop2_17_reg[7:0] = bp_reg_7[7:0];
+end
+
+always @ (*) begin
+	loops_100_loop2_18[7:0] = loops_100_loop2_and_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_100_BB_2_S_0)) begin
+		bp_reg_8[7:0] <= loops_100_loop2_18[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_100_loop2_18_reg[7:0] = bp_reg_8[7:0];
+end
+
+always @ (*) begin
+	loops_100_loop2_20[15:0] = loops_100_loop2_and_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_100_BB_2_S_0)) begin
+		bp_reg_5[15:0] <= loops_100_loop2_20[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_100_loop2_20_reg[15:0] = bp_reg_5[15:0];
+end
+
+always @ (*) begin
+	loops_100_loop2_21[7:0] = (loops_100_loop2_17 - loops_100_loop2_18);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_100_BB_2_S_0)) begin
+		bp_reg_9[7:0] <= loops_100_loop2_21[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_100_loop2_21_reg[7:0] = bp_reg_9[7:0];
+end
+
+always @ (*) begin
+	loops_100_loop2_22[63:0] = (loops_100_loop2_13_reg + loops_100_loop2_21);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_100_BB_2_S_0)) begin
+		bp_reg_0[63:0] <= loops_100_loop2_22[63:0];
+	end
+	if ((cur_state == BPHLS_F_loops_100_BB_7_S_0)) begin
+		bp_reg_0[21:6] <= loops_100_loop23_35[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_100_BB_7_S_1)) begin
+		bp_reg_0[13:6] <= loops_100_loop23_41[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_100_BB_7_S_1)) begin
+		bp_reg_0[5:3] <= loops_100_loop23_44[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_100_BB_7_S_1)) begin
+		bp_reg_0[14:14] <= loops_100_loop23_45;
+	end
+	if ((cur_state == BPHLS_F_loops_100_BB_8_S_0)) begin
+		bp_reg_0[2:0] <= loops_100_exit24_46[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_100_BB_8_S_0)) begin
+		bp_reg_0[3:3] <= loops_100_exit24_47;
+	end
+	if ((cur_state == BPHLS_F_loops_100_BB_9_S_0)) begin
+		bp_reg_0[0:0] <= loops_100_exit15_49;
+	end
+	if ((cur_state == BPHLS_F_loops_100_BB_17_S_0)) begin
+		bp_reg_0[29:14] <= loops_100_loop215_80[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_100_BB_17_S_0)) begin
+		bp_reg_0[37:30] <= loops_100_loop215_82[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_100_BB_17_S_0)) begin
+		bp_reg_0[5:3] <= loops_100_loop215_86[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_100_BB_18_S_0)) begin
+		bp_reg_0[2:0] <= loops_100_exit216_88[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_100_BB_18_S_0)) begin
+		bp_reg_0[3:3] <= loops_100_exit216_89;
+	end
+	if ((cur_state == BPHLS_F_loops_100_BB_19_S_0)) begin
+		bp_reg_0[0:0] <= loops_100_exit117_91;
+	end
+end
+
+always @ (*) begin
+	loops_100_loop2_22_reg[63:0] = bp_reg_0[63:0];
+end
+
+always @ (*) begin
+	loops_100_loop2_23[31:0] = loops_100_loop2_add_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_100_BB_2_S_0)) begin
+		bp_reg_11[2:0] <= loops_100_loop2_23[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_100_BB_3_S_0)) begin
+		bp_reg_11[0:0] <= loops_100_exit2_26;
+	end
+end
+
+always @ (*) begin
+	loops_100_loop2_23_reg[2:0] = bp_reg_11[2:0];
+end
+
+always @ (*) begin
+	loops_100_loop2_24 = loops_100_loop2_icmp_8_0;
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_100_BB_2_S_0)) begin
+		bp_reg_17 <= loops_100_loop2_24;
+	end
+end
+
+always @ (*) begin
+	loops_100_loop2_24_reg = bp_reg_17;
+end
+
+always @ (*) begin
+	loops_100_exit2_25[31:0] = loops_100_exit2_add_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_100_BB_3_S_0)) begin
+		bp_reg_12[2:0] <= loops_100_exit2_25[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_100_BB_4_S_0)) begin
+		bp_reg_12[0:0] <= loops_100_exit1_28;
+	end
+	if ((cur_state == BPHLS_F_loops_100_BB_12_S_0)) begin
+		bp_reg_12[2:0] <= loops_100_loop29_65[2:0];
+	end
+end
+
+always @ (*) begin
+	loops_100_exit2_25_reg[2:0] = bp_reg_12[2:0];
+end
+
+always @ (*) begin
+	loops_100_exit2_26 = loops_100_exit2_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_100_exit2_26_reg = bp_reg_11[0:0];
+end
+
+always @ (*) begin
+	loops_100_exit1_27[31:0] = loops_100_exit1_add_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_100_BB_4_S_0)) begin
+		bp_reg_13[2:0] <= loops_100_exit1_27[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_100_BB_13_S_0)) begin
+		bp_reg_13[2:0] <= loops_100_exit210_67[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_100_BB_14_S_0)) begin
+		bp_reg_13[0:0] <= loops_100_exit111_70;
+	end
+end
+
+always @ (*) begin
+	loops_100_exit1_27_reg[2:0] = bp_reg_13[2:0];
+end
+
+always @ (*) begin
+	loops_100_exit1_28 = loops_100_exit1_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_100_exit1_28_reg = bp_reg_12[0:0];
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_100_BB_4_S_1) & (loops_100_exit1_28_reg == 1'd0))) begin
+		loops_100_loop01_29_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_100_BB_9_S_1) & (loops_100_exit15_49_reg == 1'd1))) begin
+		loops_100_loop01_29_reg[1:0] <= loops_100_exit15_48_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_100_BB_4_S_1) & (loops_100_exit1_28_reg == 1'd0))) begin
+		loops_100_loop01_30_reg[63:0] <= loops_100_loop2_22_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_100_BB_9_S_1) & (loops_100_exit15_49_reg == 1'd1))) begin
+		loops_100_loop01_30_reg[63:0] <= loops_100_loop23_43_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_100_BB_5_S_0)) begin
+		loops_100_loop12_31_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_100_BB_8_S_1) & (loops_100_exit24_47_reg == 1'd1))) begin
+		loops_100_loop12_31_reg[1:0] <= loops_100_exit24_46_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_100_BB_5_S_0)) begin
+		loops_100_loop12_32_reg[63:0] <= loops_100_loop01_30_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_100_BB_8_S_1) & (loops_100_exit24_47_reg == 1'd1))) begin
+		loops_100_loop12_32_reg[63:0] <= loops_100_loop23_43_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_100_BB_6_S_0)) begin
+		loops_100_loop23_33_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_100_BB_7_S_2) & (loops_100_loop23_45_reg == 1'd1))) begin
+		loops_100_loop23_33_reg[1:0] <= loops_100_loop23_44_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_100_BB_6_S_0)) begin
+		loops_100_loop23_34_reg[63:0] <= loops_100_loop12_32_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_100_BB_7_S_2) & (loops_100_loop23_45_reg == 1'd1))) begin
+		loops_100_loop23_34_reg[63:0] <= loops_100_loop23_43_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_100_loop23_35[15:0] = loops_100_loop23_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	loops_100_loop23_35_reg[15:0] = bp_reg_0[21:6];
+end
+
+always @ (*) begin
+	loops_100_loop23_36[63:0] = (arg_7 + arg_7);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_100_BB_7_S_0)) begin
+		loops_100_loop23_36_reg[63:0] <= loops_100_loop23_36[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_100_loop23_38[15:0] = (loops_100_loop2_20_reg ^ loops_100_loop23_35);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_100_BB_7_S_0)) begin
+		bp_reg_6[15:0] <= loops_100_loop23_38[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_100_loop23_38_reg[15:0] = bp_reg_6[15:0];
+end
+
+always @ (*) begin
+	loops_100_loop23_39[7:0] = loops_100_loop23_or_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_100_BB_7_S_0)) begin
+		bp_reg_10[7:0] <= loops_100_loop23_39[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_100_loop23_39_reg[7:0] = bp_reg_10[7:0];
+end
+
+always @ (*) begin
+	loops_100_loop23_40[63:0] = (loops_100_loop23_36 - loops_100_loop23_34_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_100_BB_7_S_0)) begin
+		bp_reg_1[63:0] <= loops_100_loop23_40[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_100_loop23_40_reg[63:0] = bp_reg_1[63:0];
+end
+
+always @ (*) begin
+	loops_100_loop23_41[7:0] = loops_100_loop23_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_100_loop23_41_reg[7:0] = bp_reg_0[13:6];
+end
+
+always @ (*) begin
+	loops_100_loop23_42[7:0] = loops_100_loop23_add_8_8_1[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_100_BB_7_S_0)) begin
+		bp_reg_3[15:8] <= loops_100_loop23_42[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_100_BB_12_S_0)) begin
+		bp_reg_3[31:0] <= loops_100_loop29_63[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_100_loop23_42_reg[7:0] = bp_reg_3[15:8];
+end
+
+always @ (*) begin
+	loops_100_loop23_43[63:0] = (loops_100_loop23_34_reg + loops_100_loop23_42);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_100_BB_7_S_0)) begin
+		loops_100_loop23_43_reg[63:0] <= loops_100_loop23_43[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_100_loop23_44[31:0] = loops_100_loop23_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_100_loop23_44_reg[2:0] = bp_reg_0[5:3];
+end
+
+always @ (*) begin
+	loops_100_loop23_45 = loops_100_loop23_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_100_loop23_45_reg = bp_reg_0[14:14];
+end
+
+always @ (*) begin
+	loops_100_exit24_46[31:0] = loops_100_exit24_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_100_exit24_46_reg[2:0] = bp_reg_0[2:0];
+end
+
+always @ (*) begin
+	loops_100_exit24_47 = loops_100_exit24_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_100_exit24_47_reg = bp_reg_0[3:3];
+end
+
+always @ (*) begin
+	loops_100_exit15_48[31:0] = loops_100_exit15_add_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_100_BB_9_S_0)) begin
+		bp_reg_14[2:0] <= loops_100_exit15_48[2:0];
+	end
+end
+
+always @ (*) begin
+	loops_100_exit15_48_reg[2:0] = bp_reg_14[2:0];
+end
+
+always @ (*) begin
+	loops_100_exit15_49 = loops_100_exit15_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_100_exit15_49_reg = bp_reg_0[0:0];
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_100_BB_9_S_1) & (loops_100_exit15_49_reg == 1'd0))) begin
+		loops_100_loop07_50_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_100_BB_14_S_1) & (loops_100_exit111_70_reg == 1'd1))) begin
+		loops_100_loop07_50_reg[1:0] <= loops_100_exit111_69_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_100_BB_9_S_1) & (loops_100_exit15_49_reg == 1'd0))) begin
+		loops_100_loop07_51_reg[63:0] <= loops_100_loop23_43_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_100_BB_14_S_1) & (loops_100_exit111_70_reg == 1'd1))) begin
+		loops_100_loop07_51_reg[63:0] <= loops_100_loop29_64_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_100_BB_10_S_0)) begin
+		loops_100_loop18_52_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_100_BB_13_S_1) & (loops_100_exit210_68_reg == 1'd1))) begin
+		loops_100_loop18_52_reg[1:0] <= loops_100_exit210_67_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_100_BB_10_S_0)) begin
+		loops_100_loop18_53_reg[63:0] <= loops_100_loop07_51_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_100_BB_13_S_1) & (loops_100_exit210_68_reg == 1'd1))) begin
+		loops_100_loop18_53_reg[63:0] <= loops_100_loop29_64_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_100_BB_11_S_0)) begin
+		loops_100_loop29_54_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_100_BB_12_S_1) & (loops_100_loop29_66_reg == 1'd1))) begin
+		loops_100_loop29_54_reg[1:0] <= loops_100_loop29_65_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_100_BB_11_S_0)) begin
+		loops_100_loop29_55_reg[63:0] <= loops_100_loop18_53_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_100_BB_12_S_1) & (loops_100_loop29_66_reg == 1'd1))) begin
+		loops_100_loop29_55_reg[63:0] <= loops_100_loop29_64_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_100_loop29_57[31:0] = (arg_5 - arg_4);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_100_BB_12_S_0)) begin
+		loops_100_loop29_57_reg[31:0] <= loops_100_loop29_57[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_100_loop29_58[31:0] = loops_100_loop29_and_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_100_BB_12_S_0)) begin
+		loops_100_loop29_58_reg[31:0] <= loops_100_loop29_58[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_100_loop29_59[31:0] = loops_100_loop29_and_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_100_BB_12_S_1)) begin
+		loops_100_loop29_59_reg[31:0] <= loops_100_loop29_59[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_100_loop29_63[31:0] = (loops_100_loop2_15_reg ^ arg_5);
+end
+
+always @ (*) begin
+	loops_100_loop29_63_reg[31:0] = bp_reg_3[31:0];
+end
+
+always @ (*) begin
+	loops_100_loop29_64[63:0] = (loops_100_loop29_55_reg + loops_100_loop29_63);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_100_BB_12_S_0)) begin
+		loops_100_loop29_64_reg[63:0] <= loops_100_loop29_64[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_100_loop29_65[31:0] = loops_100_loop29_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_100_loop29_65_reg[2:0] = bp_reg_12[2:0];
+end
+
+always @ (*) begin
+	loops_100_loop29_66 = loops_100_loop29_icmp_8_0;
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_100_BB_12_S_0)) begin
+		bp_reg_18 <= loops_100_loop29_66;
+	end
+end
+
+always @ (*) begin
+	loops_100_loop29_66_reg = bp_reg_18;
+end
+
+always @ (*) begin
+	loops_100_exit210_67[31:0] = loops_100_exit210_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_100_exit210_67_reg[2:0] = bp_reg_13[2:0];
+end
+
+always @ (*) begin
+	loops_100_exit210_68 = loops_100_exit210_icmp_8_0;
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_100_BB_13_S_0)) begin
+		bp_reg_19 <= loops_100_exit210_68;
+	end
+end
+
+always @ (*) begin
+	loops_100_exit210_68_reg = bp_reg_19;
+end
+
+always @ (*) begin
+	loops_100_exit111_69[31:0] = loops_100_exit111_add_8_8_1[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_100_BB_14_S_0)) begin
+		bp_reg_15[2:0] <= loops_100_exit111_69[2:0];
+	end
+end
+
+always @ (*) begin
+	loops_100_exit111_69_reg[2:0] = bp_reg_15[2:0];
+end
+
+always @ (*) begin
+	loops_100_exit111_70 = loops_100_exit111_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_100_exit111_70_reg = bp_reg_13[0:0];
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_100_BB_14_S_1) & (loops_100_exit111_70_reg == 1'd0))) begin
+		loops_100_loop013_71_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_100_BB_19_S_1) & (loops_100_exit117_91_reg == 1'd1))) begin
+		loops_100_loop013_71_reg[1:0] <= loops_100_exit117_90_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_100_BB_14_S_1) & (loops_100_exit111_70_reg == 1'd0))) begin
+		loops_100_loop013_72_reg[63:0] <= loops_100_loop29_64_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_100_BB_19_S_1) & (loops_100_exit117_91_reg == 1'd1))) begin
+		loops_100_loop013_72_reg[63:0] <= loops_100_loop215_85_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_100_BB_15_S_0)) begin
+		loops_100_loop114_73_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_100_BB_18_S_1) & (loops_100_exit216_89_reg == 1'd1))) begin
+		loops_100_loop114_73_reg[1:0] <= loops_100_exit216_88_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_100_BB_15_S_0)) begin
+		loops_100_loop114_74_reg[63:0] <= loops_100_loop013_72_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_100_BB_18_S_1) & (loops_100_exit216_89_reg == 1'd1))) begin
+		loops_100_loop114_74_reg[63:0] <= loops_100_loop215_85_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_100_BB_16_S_0)) begin
+		loops_100_loop215_75_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_100_BB_17_S_1) & (loops_100_loop215_87_reg == 1'd1))) begin
+		loops_100_loop215_75_reg[1:0] <= loops_100_loop215_86_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_100_BB_16_S_0)) begin
+		loops_100_loop215_76_reg[63:0] <= loops_100_loop114_74_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_100_BB_17_S_1) & (loops_100_loop215_87_reg == 1'd1))) begin
+		loops_100_loop215_76_reg[63:0] <= loops_100_loop215_85_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_100_loop215_80[15:0] = loops_100_loop215_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	loops_100_loop215_80_reg[15:0] = bp_reg_0[29:14];
+end
+
+always @ (*) begin
+	loops_100_loop215_82[7:0] = (loops_100_loop2_18_reg ^ loops_100_loop23_41_reg);
+end
+
+always @ (*) begin
+	loops_100_loop215_82_reg[7:0] = bp_reg_0[37:30];
+end
+
+always @ (*) begin
+	loops_100_loop215_84[31:0] = (loops_100_loop29_58_reg ^ loops_100_loop29_59_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_100_BB_17_S_0)) begin
+		loops_100_loop215_84_reg[31:0] <= loops_100_loop215_84[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_100_loop215_85[63:0] = (loops_100_loop215_76_reg + loops_100_loop215_84);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_100_BB_17_S_0)) begin
+		loops_100_loop215_85_reg[63:0] <= loops_100_loop215_85[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_100_loop215_86[31:0] = loops_100_loop215_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_100_loop215_86_reg[2:0] = bp_reg_0[5:3];
+end
+
+always @ (*) begin
+	loops_100_loop215_87 = loops_100_loop215_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_100_loop215_87_reg = bp_reg_7[6:6];
+end
+
+always @ (*) begin
+	loops_100_exit216_88[31:0] = loops_100_exit216_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_100_exit216_88_reg[2:0] = bp_reg_0[2:0];
+end
+
+always @ (*) begin
+	loops_100_exit216_89 = loops_100_exit216_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_100_exit216_89_reg = bp_reg_0[3:3];
+end
+
+always @ (*) begin
+	loops_100_exit117_90[31:0] = loops_100_exit117_add_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_100_BB_19_S_0)) begin
+		bp_reg_16[2:0] <= loops_100_exit117_90[2:0];
+	end
+end
+
+always @ (*) begin
+	loops_100_exit117_90_reg[2:0] = bp_reg_16[2:0];
+end
+
+always @ (*) begin
+	loops_100_exit117_91 = loops_100_exit117_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_100_exit117_91_reg = bp_reg_0[0:0];
+end
+
+always @ (*) begin
+	loops_100_loop2_and_16_16_0_op0[15:0] = loops_100_loop2_14[15:0];
+end
+
+always @ (*) begin
+	loops_100_loop2_and_16_16_0_op1[15:0] = loops_100_loop2_14[15:0];
+end
+
+always @ (*) begin
+	loops_100_loop2_and_16_16_0[15:0] = (loops_100_loop2_and_16_16_0_op0 & loops_100_loop2_and_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_100_loop2_icmp_8_0_op0[2:0] = loops_100_loop2_23[31:0];
+end
+
+always @ (*) begin
+	loops_100_loop2_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_100_loop2_icmp_8_0 = (loops_100_loop2_icmp_8_0_op0 < loops_100_loop2_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_100_loop2_mul_8_8_0_op0[7:0] = arg_1[7:0];
+end
+
+always @ (*) begin
+	loops_100_loop2_mul_8_8_0_op1[7:0] = arg_0[7:0];
+end
+
+always @ (*) begin
+	loops_100_loop2_mul_8_8_0[7:0] = (loops_100_loop2_mul_8_8_0_op0 * loops_100_loop2_mul_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_100_loop2_add_8_8_0_op0[7:0] = loops_100_loop2_12_reg[1:0];
+end
+
+always @ (*) begin
+	loops_100_loop2_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_100_loop2_add_8_8_0[7:0] = (loops_100_loop2_add_8_8_0_op0 + loops_100_loop2_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_100_loop2_and_8_8_0_op0[7:0] = loops_100_loop2_17[7:0];
+end
+
+always @ (*) begin
+	loops_100_loop2_and_8_8_0_op1[7:0] = loops_100_loop2_17[7:0];
+end
+
+always @ (*) begin
+	loops_100_loop2_and_8_8_0[7:0] = (loops_100_loop2_and_8_8_0_op0 & loops_100_loop2_and_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_100_loop2_or_32_32_0_op0[31:0] = arg_4[31:0];
+end
+
+always @ (*) begin
+	loops_100_loop2_or_32_32_0_op1[7:0] = arg_1[7:0];
+end
+
+always @ (*) begin
+	loops_100_loop2_or_32_32_0[31:0] = (loops_100_loop2_or_32_32_0_op0 | loops_100_loop2_or_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_100_loop2_add_16_16_0_op0[15:0] = arg_2[15:0];
+end
+
+always @ (*) begin
+	loops_100_loop2_add_16_16_0_op1[15:0] = arg_2[15:0];
+end
+
+always @ (*) begin
+	loops_100_loop2_add_16_16_0[15:0] = (loops_100_loop2_add_16_16_0_op0 + loops_100_loop2_add_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_100_exit2_icmp_8_0_op0[2:0] = loops_100_exit2_25[31:0];
+end
+
+always @ (*) begin
+	loops_100_exit2_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_100_exit2_icmp_8_0 = (loops_100_exit2_icmp_8_0_op0 < loops_100_exit2_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_100_exit2_add_8_8_0_op0[7:0] = loops_100_loop1_10_reg[1:0];
+end
+
+always @ (*) begin
+	loops_100_exit2_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_100_exit2_add_8_8_0[7:0] = (loops_100_exit2_add_8_8_0_op0 + loops_100_exit2_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_100_exit1_icmp_8_0_op0[2:0] = loops_100_exit1_27[31:0];
+end
+
+always @ (*) begin
+	loops_100_exit1_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_100_exit1_icmp_8_0 = (loops_100_exit1_icmp_8_0_op0 < loops_100_exit1_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_100_exit1_add_8_8_0_op0[7:0] = loops_100_loop0_8_reg[1:0];
+end
+
+always @ (*) begin
+	loops_100_exit1_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_100_exit1_add_8_8_0[7:0] = (loops_100_exit1_add_8_8_0_op0 + loops_100_exit1_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_100_BB_7_S_0)) begin
+		loops_100_loop23_or_8_8_0_op0[7:0] = loops_100_loop2_18_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_100_BB_7_S_1)) */ begin
+		loops_100_loop23_or_8_8_0_op0[7:0] = loops_100_loop2_17_reg[7:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_100_BB_7_S_0)) begin
+		loops_100_loop23_or_8_8_0_op1[7:0] = arg_1[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_100_BB_7_S_1)) */ begin
+		loops_100_loop23_or_8_8_0_op1[7:0] = arg_1[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_100_loop23_or_8_8_0[7:0] = (loops_100_loop23_or_8_8_0_op0 | loops_100_loop23_or_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_100_loop23_add_8_8_0_op0[7:0] = arg_0[7:0];
+end
+
+always @ (*) begin
+	loops_100_loop23_add_8_8_0_op1[7:0] = arg_0[7:0];
+end
+
+always @ (*) begin
+	loops_100_loop23_add_8_8_0[7:0] = (loops_100_loop23_add_8_8_0_op0 + loops_100_loop23_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_100_BB_7_S_0)) begin
+		loops_100_loop23_add_8_8_1_op0[7:0] = loops_100_loop2_18_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_100_BB_7_S_1)) */ begin
+		loops_100_loop23_add_8_8_1_op0[7:0] = loops_100_loop23_33_reg[1:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_100_BB_7_S_0)) begin
+		loops_100_loop23_add_8_8_1_op1[7:0] = loops_100_loop2_18_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_100_BB_7_S_1)) */ begin
+		loops_100_loop23_add_8_8_1_op1[7:0] = 32'd1;
+	end
+end
+
+always @ (*) begin
+	loops_100_loop23_add_8_8_1[7:0] = (loops_100_loop23_add_8_8_1_op0 + loops_100_loop23_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_100_loop23_add_16_16_0_op0[15:0] = arg_3[15:0];
+end
+
+always @ (*) begin
+	loops_100_loop23_add_16_16_0_op1[15:0] = arg_2[15:0];
+end
+
+always @ (*) begin
+	loops_100_loop23_add_16_16_0[15:0] = (loops_100_loop23_add_16_16_0_op0 + loops_100_loop23_add_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_100_loop23_icmp_8_0_op0[2:0] = loops_100_loop23_44[31:0];
+end
+
+always @ (*) begin
+	loops_100_loop23_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_100_loop23_icmp_8_0 = (loops_100_loop23_icmp_8_0_op0 < loops_100_loop23_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_100_exit24_icmp_8_0_op0[2:0] = loops_100_exit24_46[31:0];
+end
+
+always @ (*) begin
+	loops_100_exit24_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_100_exit24_icmp_8_0 = (loops_100_exit24_icmp_8_0_op0 < loops_100_exit24_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_100_exit24_add_8_8_1_op0[7:0] = loops_100_loop12_31_reg[1:0];
+end
+
+always @ (*) begin
+	loops_100_exit24_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_100_exit24_add_8_8_1[7:0] = (loops_100_exit24_add_8_8_1_op0 + loops_100_exit24_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_100_exit15_icmp_8_0_op0[2:0] = loops_100_exit15_48[31:0];
+end
+
+always @ (*) begin
+	loops_100_exit15_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_100_exit15_icmp_8_0 = (loops_100_exit15_icmp_8_0_op0 < loops_100_exit15_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_100_exit15_add_8_8_0_op0[7:0] = loops_100_loop01_29_reg[1:0];
+end
+
+always @ (*) begin
+	loops_100_exit15_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_100_exit15_add_8_8_0[7:0] = (loops_100_exit15_add_8_8_0_op0 + loops_100_exit15_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_100_loop29_and_16_16_0_op0[15:0] = arg_3[15:0];
+end
+
+always @ (*) begin
+	loops_100_loop29_and_16_16_0_op1[15:0] = loops_100_loop23_38_reg[15:0];
+end
+
+always @ (*) begin
+	loops_100_loop29_and_16_16_0[15:0] = (loops_100_loop29_and_16_16_0_op0 & loops_100_loop29_and_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_100_loop29_icmp_8_0_op0[2:0] = loops_100_loop29_65[31:0];
+end
+
+always @ (*) begin
+	loops_100_loop29_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_100_loop29_icmp_8_0 = (loops_100_loop29_icmp_8_0_op0 < loops_100_loop29_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_100_loop29_add_8_8_1_op0[7:0] = loops_100_loop29_54_reg[1:0];
+end
+
+always @ (*) begin
+	loops_100_loop29_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_100_loop29_add_8_8_1[7:0] = (loops_100_loop29_add_8_8_1_op0 + loops_100_loop29_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_100_BB_12_S_0)) begin
+		loops_100_loop29_and_32_32_0_op0[31:0] = loops_100_loop29_57[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_100_BB_12_S_1)) */ begin
+		loops_100_loop29_and_32_32_0_op0[31:0] = loops_100_loop29_57_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_100_BB_12_S_0)) begin
+		loops_100_loop29_and_32_32_0_op1[31:0] = arg_4[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_100_BB_12_S_1)) */ begin
+		loops_100_loop29_and_32_32_0_op1[31:0] = loops_100_loop2_15_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_100_loop29_and_32_32_0[31:0] = (loops_100_loop29_and_32_32_0_op0 & loops_100_loop29_and_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_100_exit210_icmp_8_0_op0[2:0] = loops_100_exit210_67[31:0];
+end
+
+always @ (*) begin
+	loops_100_exit210_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_100_exit210_icmp_8_0 = (loops_100_exit210_icmp_8_0_op0 < loops_100_exit210_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_100_exit210_add_8_8_0_op0[7:0] = loops_100_loop18_52_reg[1:0];
+end
+
+always @ (*) begin
+	loops_100_exit210_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_100_exit210_add_8_8_0[7:0] = (loops_100_exit210_add_8_8_0_op0 + loops_100_exit210_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_100_exit111_icmp_8_0_op0[2:0] = loops_100_exit111_69[31:0];
+end
+
+always @ (*) begin
+	loops_100_exit111_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_100_exit111_icmp_8_0 = (loops_100_exit111_icmp_8_0_op0 < loops_100_exit111_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_100_exit111_add_8_8_1_op0[7:0] = loops_100_loop07_50_reg[1:0];
+end
+
+always @ (*) begin
+	loops_100_exit111_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_100_exit111_add_8_8_1[7:0] = (loops_100_exit111_add_8_8_1_op0 + loops_100_exit111_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_100_loop215_icmp_8_0_op0[2:0] = loops_100_loop215_86[31:0];
+end
+
+always @ (*) begin
+	loops_100_loop215_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_100_loop215_icmp_8_0 = (loops_100_loop215_icmp_8_0_op0 < loops_100_loop215_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_100_loop215_mul_8_8_0_op0[7:0] = arg_1[7:0];
+end
+
+always @ (*) begin
+	loops_100_loop215_mul_8_8_0_op1[7:0] = loops_100_loop23_39_reg[7:0];
+end
+
+always @ (*) begin
+	loops_100_loop215_mul_8_8_0[7:0] = (loops_100_loop215_mul_8_8_0_op0 * loops_100_loop215_mul_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_100_loop215_add_8_8_0_op0[7:0] = loops_100_loop215_75_reg[1:0];
+end
+
+always @ (*) begin
+	loops_100_loop215_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_100_loop215_add_8_8_0[7:0] = (loops_100_loop215_add_8_8_0_op0 + loops_100_loop215_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_100_loop215_add_16_16_0_op0[15:0] = arg_2[15:0];
+end
+
+always @ (*) begin
+	loops_100_loop215_add_16_16_0_op1[15:0] = loops_100_loop2_20_reg[15:0];
+end
+
+always @ (*) begin
+	loops_100_loop215_add_16_16_0[15:0] = (loops_100_loop215_add_16_16_0_op0 + loops_100_loop215_add_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_100_loop215_mul_16_16_0_op0[15:0] = loops_100_loop215_80[15:0];
+end
+
+always @ (*) begin
+	loops_100_loop215_mul_16_16_0_op1[7:0] = loops_100_loop215_82[7:0];
+end
+
+always @ (*) begin
+	loops_100_loop215_mul_16_16_0[15:0] = (loops_100_loop215_mul_16_16_0_op0 * loops_100_loop215_mul_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_100_exit216_icmp_8_0_op0[2:0] = loops_100_exit216_88[31:0];
+end
+
+always @ (*) begin
+	loops_100_exit216_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_100_exit216_icmp_8_0 = (loops_100_exit216_icmp_8_0_op0 < loops_100_exit216_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_100_exit216_add_8_8_1_op0[7:0] = loops_100_loop114_73_reg[1:0];
+end
+
+always @ (*) begin
+	loops_100_exit216_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_100_exit216_add_8_8_1[7:0] = (loops_100_exit216_add_8_8_1_op0 + loops_100_exit216_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_100_exit117_icmp_8_0_op0[2:0] = loops_100_exit117_90[31:0];
+end
+
+always @ (*) begin
+	loops_100_exit117_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_100_exit117_icmp_8_0 = (loops_100_exit117_icmp_8_0_op0 < loops_100_exit117_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_100_exit117_add_8_8_0_op0[7:0] = loops_100_loop013_71_reg[1:0];
+end
+
+always @ (*) begin
+	loops_100_exit117_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_100_exit117_add_8_8_0[7:0] = (loops_100_exit117_add_8_8_0_op0 + loops_100_exit117_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_100_loop2_16[63:0] = (arg_7 ^ arg_7);
+end
+
+always @ (*) begin
+	loops_100_loop2_19[31:0] = (arg_5 ^ arg_3);
+end
+
+always @ (*) begin
+	loops_100_loop23_37[7:0] = loops_100_loop23_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_100_loop29_56[63:0] = (loops_100_loop23_34_reg * arg_6);
+end
+
+always @ (*) begin
+	loops_100_loop29_60[63:0] = (loops_100_loop23_40_reg + loops_100_loop23_34_reg);
+end
+
+always @ (*) begin
+	loops_100_loop29_61[15:0] = loops_100_loop29_and_16_16_0[15:0];
+end
+
+always @ (*) begin
+	loops_100_loop29_62[63:0] = (loops_100_loop23_40_reg - loops_100_loop2_17_reg);
+end
+
+always @ (*) begin
+	loops_100_loop215_77[7:0] = loops_100_loop215_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_100_loop215_78[63:0] = (loops_100_loop29_55_reg & loops_100_loop23_41_reg);
+end
+
+always @ (*) begin
+	loops_100_loop215_79[31:0] = (loops_100_loop29_58_reg ^ loops_100_loop2_15_reg);
+end
+
+always @ (*) begin
+	loops_100_loop215_81[63:0] = (loops_100_loop29_55_reg | loops_100_loop23_40_reg);
+end
+
+always @ (*) begin
+	loops_100_loop215_83[15:0] = loops_100_loop215_mul_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS)) begin
+		finish <= 1'd0;
+	end
+	if ((cur_state == BPHLS_F_loops_100_BB_20_S_0)) begin
+		finish <= 1'd1;
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS)) begin
+		return_val[63:0] <= 64'd0;
+	end
+	if ((cur_state == BPHLS_F_loops_100_BB_20_S_0)) begin
+		return_val[63:0] <= loops_100_loop215_85_reg[63:0];
+	end
+end
+
+endmodule
@@ -0,0 +1,1621 @@
+; ModuleID = 'loops_1000'
+source_filename = "loops_1000"
+
+define i64 @loops_1000(i8 %0, i8 %1, i16 %2, i16 %3, i32 %4, i32 %5, i64 %6, i64 %7) {
+entry:
+  br label %loop0
+
+loop0:                                            ; preds = %exit1, %entry
+  %8 = phi i32 [ 0, %entry ], [ %30, %exit1 ]
+  %9 = phi i64 [ %7, %entry ], [ %25, %exit1 ]
+  br label %loop1
+
+loop1:                                            ; preds = %exit2, %loop0
+  %10 = phi i32 [ 0, %loop0 ], [ %28, %exit2 ]
+  %11 = phi i64 [ %9, %loop0 ], [ %25, %exit2 ]
+  br label %loop2
+
+loop2:                                            ; preds = %loop2, %loop1
+  %12 = phi i32 [ 0, %loop1 ], [ %26, %loop2 ]
+  %13 = phi i64 [ %11, %loop1 ], [ %25, %loop2 ]
+  %14 = add i16 %2, %2
+  %15 = zext i8 %1 to i32
+  %16 = or i32 %4, %15
+  %17 = xor i64 %7, %7
+  %18 = mul i8 %1, %0
+  %19 = and i8 %18, %18
+  %20 = zext i16 %3 to i32
+  %21 = xor i32 %5, %20
+  %22 = and i16 %14, %14
+  %23 = sub i8 %18, %19
+  %24 = zext i8 %23 to i64
+  %25 = add i64 %13, %24
+  %26 = add i32 %12, 1
+  %27 = icmp ult i32 %26, 4
+  br i1 %27, label %loop2, label %exit2
+
+exit2:                                            ; preds = %loop2
+  %28 = add i32 %10, 1
+  %29 = icmp ult i32 %28, 4
+  br i1 %29, label %loop1, label %exit1
+
+exit1:                                            ; preds = %exit2
+  %30 = add i32 %8, 1
+  %31 = icmp ult i32 %30, 4
+  br i1 %31, label %loop0, label %exit0
+
+exit0:                                            ; preds = %exit1
+  br label %loop01
+
+loop01:                                           ; preds = %exit15, %exit0
+  %32 = phi i32 [ 0, %exit0 ], [ %52, %exit15 ]
+  %33 = phi i64 [ %25, %exit0 ], [ %47, %exit15 ]
+  br label %loop12
+
+loop12:                                           ; preds = %exit24, %loop01
+  %34 = phi i32 [ 0, %loop01 ], [ %50, %exit24 ]
+  %35 = phi i64 [ %33, %loop01 ], [ %47, %exit24 ]
+  br label %loop23
+
+loop23:                                           ; preds = %loop23, %loop12
+  %36 = phi i32 [ 0, %loop12 ], [ %48, %loop23 ]
+  %37 = phi i64 [ %35, %loop12 ], [ %47, %loop23 ]
+  %38 = add i16 %3, %2
+  %39 = add i64 %7, %7
+  %40 = add i8 %0, %0
+  %41 = xor i16 %22, %38
+  %42 = or i8 %19, %1
+  %43 = sub i64 %39, %37
+  %44 = or i8 %18, %1
+  %45 = add i8 %19, %19
+  %46 = zext i8 %45 to i64
+  %47 = add i64 %37, %46
+  %48 = add i32 %36, 1
+  %49 = icmp ult i32 %48, 4
+  br i1 %49, label %loop23, label %exit24
+
+exit24:                                           ; preds = %loop23
+  %50 = add i32 %34, 1
+  %51 = icmp ult i32 %50, 4
+  br i1 %51, label %loop12, label %exit15
+
+exit15:                                           ; preds = %exit24
+  %52 = add i32 %32, 1
+  %53 = icmp ult i32 %52, 4
+  br i1 %53, label %loop01, label %exit06
+
+exit06:                                           ; preds = %exit15
+  br label %loop07
+
+loop07:                                           ; preds = %exit111, %exit06
+  %54 = phi i32 [ 0, %exit06 ], [ %75, %exit111 ]
+  %55 = phi i64 [ %47, %exit06 ], [ %70, %exit111 ]
+  br label %loop18
+
+loop18:                                           ; preds = %exit210, %loop07
+  %56 = phi i32 [ 0, %loop07 ], [ %73, %exit210 ]
+  %57 = phi i64 [ %55, %loop07 ], [ %70, %exit210 ]
+  br label %loop29
+
+loop29:                                           ; preds = %loop29, %loop18
+  %58 = phi i32 [ 0, %loop18 ], [ %71, %loop29 ]
+  %59 = phi i64 [ %57, %loop18 ], [ %70, %loop29 ]
+  %60 = mul i64 %37, %6
+  %61 = sub i32 %5, %4
+  %62 = and i32 %61, %4
+  %63 = and i32 %61, %16
+  %64 = add i64 %43, %37
+  %65 = and i16 %3, %41
+  %66 = zext i8 %18 to i64
+  %67 = sub i64 %43, %66
+  %68 = xor i32 %16, %5
+  %69 = zext i32 %68 to i64
+  %70 = add i64 %59, %69
+  %71 = add i32 %58, 1
+  %72 = icmp ult i32 %71, 4
+  br i1 %72, label %loop29, label %exit210
+
+exit210:                                          ; preds = %loop29
+  %73 = add i32 %56, 1
+  %74 = icmp ult i32 %73, 4
+  br i1 %74, label %loop18, label %exit111
+
+exit111:                                          ; preds = %exit210
+  %75 = add i32 %54, 1
+  %76 = icmp ult i32 %75, 4
+  br i1 %76, label %loop07, label %exit012
+
+exit012:                                          ; preds = %exit111
+  br label %loop013
+
+loop013:                                          ; preds = %exit117, %exit012
+  %77 = phi i32 [ 0, %exit012 ], [ %99, %exit117 ]
+  %78 = phi i64 [ %70, %exit012 ], [ %94, %exit117 ]
+  br label %loop114
+
+loop114:                                          ; preds = %exit216, %loop013
+  %79 = phi i32 [ 0, %loop013 ], [ %97, %exit216 ]
+  %80 = phi i64 [ %78, %loop013 ], [ %94, %exit216 ]
+  br label %loop215
+
+loop215:                                          ; preds = %loop215, %loop114
+  %81 = phi i32 [ 0, %loop114 ], [ %95, %loop215 ]
+  %82 = phi i64 [ %80, %loop114 ], [ %94, %loop215 ]
+  %83 = mul i8 %1, %42
+  %84 = zext i8 %44 to i64
+  %85 = and i64 %59, %84
+  %86 = xor i32 %62, %16
+  %87 = add i16 %2, %22
+  %88 = or i64 %59, %43
+  %89 = xor i8 %19, %44
+  %90 = zext i8 %89 to i16
+  %91 = mul i16 %87, %90
+  %92 = xor i32 %62, %63
+  %93 = zext i32 %92 to i64
+  %94 = add i64 %82, %93
+  %95 = add i32 %81, 1
+  %96 = icmp ult i32 %95, 4
+  br i1 %96, label %loop215, label %exit216
+
+exit216:                                          ; preds = %loop215
+  %97 = add i32 %79, 1
+  %98 = icmp ult i32 %97, 4
+  br i1 %98, label %loop114, label %exit117
+
+exit117:                                          ; preds = %exit216
+  %99 = add i32 %77, 1
+  %100 = icmp ult i32 %99, 4
+  br i1 %100, label %loop013, label %exit018
+
+exit018:                                          ; preds = %exit117
+  br label %loop019
+
+loop019:                                          ; preds = %exit123, %exit018
+  %101 = phi i32 [ 0, %exit018 ], [ %122, %exit123 ]
+  %102 = phi i64 [ %94, %exit018 ], [ %117, %exit123 ]
+  br label %loop120
+
+loop120:                                          ; preds = %exit222, %loop019
+  %103 = phi i32 [ 0, %loop019 ], [ %120, %exit222 ]
+  %104 = phi i64 [ %102, %loop019 ], [ %117, %exit222 ]
+  br label %loop221
+
+loop221:                                          ; preds = %loop221, %loop120
+  %105 = phi i32 [ 0, %loop120 ], [ %118, %loop221 ]
+  %106 = phi i64 [ %104, %loop120 ], [ %117, %loop221 ]
+  %107 = or i64 %88, %88
+  %108 = zext i32 %68 to i64
+  %109 = xor i64 %106, %108
+  %110 = and i8 %19, %19
+  %111 = sub i32 %92, %21
+  %112 = and i8 %45, %23
+  %113 = mul i64 %109, %64
+  %114 = add i8 %89, %110
+  %115 = zext i8 %83 to i64
+  %116 = or i64 %107, %115
+  %117 = add i64 %106, %116
+  %118 = add i32 %105, 1
+  %119 = icmp ult i32 %118, 4
+  br i1 %119, label %loop221, label %exit222
+
+exit222:                                          ; preds = %loop221
+  %120 = add i32 %103, 1
+  %121 = icmp ult i32 %120, 4
+  br i1 %121, label %loop120, label %exit123
+
+exit123:                                          ; preds = %exit222
+  %122 = add i32 %101, 1
+  %123 = icmp ult i32 %122, 4
+  br i1 %123, label %loop019, label %exit024
+
+exit024:                                          ; preds = %exit123
+  br label %loop025
+
+loop025:                                          ; preds = %exit129, %exit024
+  %124 = phi i32 [ 0, %exit024 ], [ %145, %exit129 ]
+  %125 = phi i64 [ %117, %exit024 ], [ %140, %exit129 ]
+  br label %loop126
+
+loop126:                                          ; preds = %exit228, %loop025
+  %126 = phi i32 [ 0, %loop025 ], [ %143, %exit228 ]
+  %127 = phi i64 [ %125, %loop025 ], [ %140, %exit228 ]
+  br label %loop227
+
+loop227:                                          ; preds = %loop227, %loop126
+  %128 = phi i32 [ 0, %loop126 ], [ %141, %loop227 ]
+  %129 = phi i64 [ %127, %loop126 ], [ %140, %loop227 ]
+  %130 = and i16 %41, %87
+  %131 = or i8 %42, %112
+  %132 = sub i32 %62, %68
+  %133 = xor i64 %116, %113
+  %134 = xor i16 %91, %87
+  %135 = zext i16 %91 to i64
+  %136 = mul i64 %109, %135
+  %137 = or i32 %111, %63
+  %138 = xor i16 %22, %65
+  %139 = zext i16 %138 to i64
+  %140 = add i64 %129, %139
+  %141 = add i32 %128, 1
+  %142 = icmp ult i32 %141, 4
+  br i1 %142, label %loop227, label %exit228
+
+exit228:                                          ; preds = %loop227
+  %143 = add i32 %126, 1
+  %144 = icmp ult i32 %143, 4
+  br i1 %144, label %loop126, label %exit129
+
+exit129:                                          ; preds = %exit228
+  %145 = add i32 %124, 1
+  %146 = icmp ult i32 %145, 4
+  br i1 %146, label %loop025, label %exit030
+
+exit030:                                          ; preds = %exit129
+  br label %loop031
+
+loop031:                                          ; preds = %exit135, %exit030
+  %147 = phi i32 [ 0, %exit030 ], [ %167, %exit135 ]
+  %148 = phi i64 [ %140, %exit030 ], [ %162, %exit135 ]
+  br label %loop132
+
+loop132:                                          ; preds = %exit234, %loop031
+  %149 = phi i32 [ 0, %loop031 ], [ %165, %exit234 ]
+  %150 = phi i64 [ %148, %loop031 ], [ %162, %exit234 ]
+  br label %loop233
+
+loop233:                                          ; preds = %loop233, %loop132
+  %151 = phi i32 [ 0, %loop132 ], [ %163, %loop233 ]
+  %152 = phi i64 [ %150, %loop132 ], [ %162, %loop233 ]
+  %153 = add i8 %45, %112
+  %154 = xor i64 %133, %129
+  %155 = add i16 %87, %41
+  %156 = add i8 %114, %110
+  %157 = add i64 %129, %136
+  %158 = xor i32 %86, %63
+  %159 = and i8 %153, %83
+  %160 = and i32 %63, %68
+  %161 = zext i32 %160 to i64
+  %162 = add i64 %152, %161
+  %163 = add i32 %151, 1
+  %164 = icmp ult i32 %163, 4
+  br i1 %164, label %loop233, label %exit234
+
+exit234:                                          ; preds = %loop233
+  %165 = add i32 %149, 1
+  %166 = icmp ult i32 %165, 4
+  br i1 %166, label %loop132, label %exit135
+
+exit135:                                          ; preds = %exit234
+  %167 = add i32 %147, 1
+  %168 = icmp ult i32 %167, 4
+  br i1 %168, label %loop031, label %exit036
+
+exit036:                                          ; preds = %exit135
+  br label %loop037
+
+loop037:                                          ; preds = %exit141, %exit036
+  %169 = phi i32 [ 0, %exit036 ], [ %188, %exit141 ]
+  %170 = phi i64 [ %162, %exit036 ], [ %183, %exit141 ]
+  br label %loop138
+
+loop138:                                          ; preds = %exit240, %loop037
+  %171 = phi i32 [ 0, %loop037 ], [ %186, %exit240 ]
+  %172 = phi i64 [ %170, %loop037 ], [ %183, %exit240 ]
+  br label %loop239
+
+loop239:                                          ; preds = %loop239, %loop138
+  %173 = phi i32 [ 0, %loop138 ], [ %184, %loop239 ]
+  %174 = phi i64 [ %172, %loop138 ], [ %183, %loop239 ]
+  %175 = mul i32 %160, %158
+  %176 = mul i32 %158, %160
+  %177 = mul i32 %137, %137
+  %178 = mul i8 %89, %89
+  %179 = xor i32 %176, %175
+  %180 = and i32 %137, %132
+  %181 = sub i64 %116, %133
+  %182 = add i64 %129, %136
+  %183 = add i64 %174, %182
+  %184 = add i32 %173, 1
+  %185 = icmp ult i32 %184, 4
+  br i1 %185, label %loop239, label %exit240
+
+exit240:                                          ; preds = %loop239
+  %186 = add i32 %171, 1
+  %187 = icmp ult i32 %186, 4
+  br i1 %187, label %loop138, label %exit141
+
+exit141:                                          ; preds = %exit240
+  %188 = add i32 %169, 1
+  %189 = icmp ult i32 %188, 4
+  br i1 %189, label %loop037, label %exit042
+
+exit042:                                          ; preds = %exit141
+  br label %loop043
+
+loop043:                                          ; preds = %exit147, %exit042
+  %190 = phi i32 [ 0, %exit042 ], [ %210, %exit147 ]
+  %191 = phi i64 [ %183, %exit042 ], [ %205, %exit147 ]
+  br label %loop144
+
+loop144:                                          ; preds = %exit246, %loop043
+  %192 = phi i32 [ 0, %loop043 ], [ %208, %exit246 ]
+  %193 = phi i64 [ %191, %loop043 ], [ %205, %exit246 ]
+  br label %loop245
+
+loop245:                                          ; preds = %loop245, %loop144
+  %194 = phi i32 [ 0, %loop144 ], [ %206, %loop245 ]
+  %195 = phi i64 [ %193, %loop144 ], [ %205, %loop245 ]
+  %196 = add i16 %155, %41
+  %197 = xor i16 %155, %138
+  %198 = add i16 %130, %87
+  %199 = and i8 %153, %156
+  %200 = and i32 %160, %158
+  %201 = xor i32 %176, %200
+  %202 = mul i16 %196, %197
+  %203 = or i16 %196, %130
+  %204 = zext i16 %203 to i64
+  %205 = add i64 %195, %204
+  %206 = add i32 %194, 1
+  %207 = icmp ult i32 %206, 4
+  br i1 %207, label %loop245, label %exit246
+
+exit246:                                          ; preds = %loop245
+  %208 = add i32 %192, 1
+  %209 = icmp ult i32 %208, 4
+  br i1 %209, label %loop144, label %exit147
+
+exit147:                                          ; preds = %exit246
+  %210 = add i32 %190, 1
+  %211 = icmp ult i32 %210, 4
+  br i1 %211, label %loop043, label %exit048
+
+exit048:                                          ; preds = %exit147
+  br label %loop049
+
+loop049:                                          ; preds = %exit153, %exit048
+  %212 = phi i32 [ 0, %exit048 ], [ %232, %exit153 ]
+  %213 = phi i64 [ %205, %exit048 ], [ %227, %exit153 ]
+  br label %loop150
+
+loop150:                                          ; preds = %exit252, %loop049
+  %214 = phi i32 [ 0, %loop049 ], [ %230, %exit252 ]
+  %215 = phi i64 [ %213, %loop049 ], [ %227, %exit252 ]
+  br label %loop251
+
+loop251:                                          ; preds = %loop251, %loop150
+  %216 = phi i32 [ 0, %loop150 ], [ %228, %loop251 ]
+  %217 = phi i64 [ %215, %loop150 ], [ %227, %loop251 ]
+  %218 = xor i64 %182, %174
+  %219 = or i16 %138, %202
+  %220 = add i16 %197, %219
+  %221 = sub i8 %112, %112
+  %222 = mul i64 %154, %195
+  %223 = mul i16 %202, %198
+  %224 = and i64 %174, %222
+  %225 = sub i8 %131, %178
+  %226 = zext i8 %225 to i64
+  %227 = add i64 %217, %226
+  %228 = add i32 %216, 1
+  %229 = icmp ult i32 %228, 4
+  br i1 %229, label %loop251, label %exit252
+
+exit252:                                          ; preds = %loop251
+  %230 = add i32 %214, 1
+  %231 = icmp ult i32 %230, 4
+  br i1 %231, label %loop150, label %exit153
+
+exit153:                                          ; preds = %exit252
+  %232 = add i32 %212, 1
+  %233 = icmp ult i32 %232, 4
+  br i1 %233, label %loop049, label %exit054
+
+exit054:                                          ; preds = %exit153
+  br label %loop055
+
+loop055:                                          ; preds = %exit159, %exit054
+  %234 = phi i32 [ 0, %exit054 ], [ %253, %exit159 ]
+  %235 = phi i64 [ %227, %exit054 ], [ %248, %exit159 ]
+  br label %loop156
+
+loop156:                                          ; preds = %exit258, %loop055
+  %236 = phi i32 [ 0, %loop055 ], [ %251, %exit258 ]
+  %237 = phi i64 [ %235, %loop055 ], [ %248, %exit258 ]
+  br label %loop257
+
+loop257:                                          ; preds = %loop257, %loop156
+  %238 = phi i32 [ 0, %loop156 ], [ %249, %loop257 ]
+  %239 = phi i64 [ %237, %loop156 ], [ %248, %loop257 ]
+  %240 = xor i16 %202, %203
+  %241 = xor i64 %217, %239
+  %242 = or i32 %160, %180
+  %243 = xor i16 %197, %220
+  %244 = and i8 %156, %156
+  %245 = mul i16 %202, %220
+  %246 = xor i32 %175, %242
+  %247 = and i64 %239, %217
+  %248 = add i64 %239, %247
+  %249 = add i32 %238, 1
+  %250 = icmp ult i32 %249, 4
+  br i1 %250, label %loop257, label %exit258
+
+exit258:                                          ; preds = %loop257
+  %251 = add i32 %236, 1
+  %252 = icmp ult i32 %251, 4
+  br i1 %252, label %loop156, label %exit159
+
+exit159:                                          ; preds = %exit258
+  %253 = add i32 %234, 1
+  %254 = icmp ult i32 %253, 4
+  br i1 %254, label %loop055, label %exit060
+
+exit060:                                          ; preds = %exit159
+  br label %loop061
+
+loop061:                                          ; preds = %exit165, %exit060
+  %255 = phi i32 [ 0, %exit060 ], [ %275, %exit165 ]
+  %256 = phi i64 [ %248, %exit060 ], [ %270, %exit165 ]
+  br label %loop162
+
+loop162:                                          ; preds = %exit264, %loop061
+  %257 = phi i32 [ 0, %loop061 ], [ %273, %exit264 ]
+  %258 = phi i64 [ %256, %loop061 ], [ %270, %exit264 ]
+  br label %loop263
+
+loop263:                                          ; preds = %loop263, %loop162
+  %259 = phi i32 [ 0, %loop162 ], [ %271, %loop263 ]
+  %260 = phi i64 [ %258, %loop162 ], [ %270, %loop263 ]
+  %261 = add i64 %260, %217
+  %262 = xor i16 %220, %245
+  %263 = mul i8 %221, %199
+  %264 = add i16 %219, %223
+  %265 = add i8 %159, %225
+  %266 = sub i16 %240, %220
+  %267 = add i64 %239, %241
+  %268 = xor i8 %221, %225
+  %269 = zext i8 %268 to i64
+  %270 = add i64 %260, %269
+  %271 = add i32 %259, 1
+  %272 = icmp ult i32 %271, 4
+  br i1 %272, label %loop263, label %exit264
+
+exit264:                                          ; preds = %loop263
+  %273 = add i32 %257, 1
+  %274 = icmp ult i32 %273, 4
+  br i1 %274, label %loop162, label %exit165
+
+exit165:                                          ; preds = %exit264
+  %275 = add i32 %255, 1
+  %276 = icmp ult i32 %275, 4
+  br i1 %276, label %loop061, label %exit066
+
+exit066:                                          ; preds = %exit165
+  br label %loop067
+
+loop067:                                          ; preds = %exit171, %exit066
+  %277 = phi i32 [ 0, %exit066 ], [ %297, %exit171 ]
+  %278 = phi i64 [ %270, %exit066 ], [ %292, %exit171 ]
+  br label %loop168
+
+loop168:                                          ; preds = %exit270, %loop067
+  %279 = phi i32 [ 0, %loop067 ], [ %295, %exit270 ]
+  %280 = phi i64 [ %278, %loop067 ], [ %292, %exit270 ]
+  br label %loop269
+
+loop269:                                          ; preds = %loop269, %loop168
+  %281 = phi i32 [ 0, %loop168 ], [ %293, %loop269 ]
+  %282 = phi i64 [ %280, %loop168 ], [ %292, %loop269 ]
+  %283 = or i8 %221, %265
+  %284 = sub i32 %201, %246
+  %285 = add i16 %245, %240
+  %286 = xor i8 %199, %283
+  %287 = sub i32 %201, %284
+  %288 = sub i16 %264, %266
+  %289 = or i32 %179, %246
+  %290 = add i32 %201, %242
+  %291 = zext i32 %290 to i64
+  %292 = add i64 %282, %291
+  %293 = add i32 %281, 1
+  %294 = icmp ult i32 %293, 4
+  br i1 %294, label %loop269, label %exit270
+
+exit270:                                          ; preds = %loop269
+  %295 = add i32 %279, 1
+  %296 = icmp ult i32 %295, 4
+  br i1 %296, label %loop168, label %exit171
+
+exit171:                                          ; preds = %exit270
+  %297 = add i32 %277, 1
+  %298 = icmp ult i32 %297, 4
+  br i1 %298, label %loop067, label %exit072
+
+exit072:                                          ; preds = %exit171
+  br label %loop073
+
+loop073:                                          ; preds = %exit177, %exit072
+  %299 = phi i32 [ 0, %exit072 ], [ %320, %exit177 ]
+  %300 = phi i64 [ %292, %exit072 ], [ %315, %exit177 ]
+  br label %loop174
+
+loop174:                                          ; preds = %exit276, %loop073
+  %301 = phi i32 [ 0, %loop073 ], [ %318, %exit276 ]
+  %302 = phi i64 [ %300, %loop073 ], [ %315, %exit276 ]
+  br label %loop275
+
+loop275:                                          ; preds = %loop275, %loop174
+  %303 = phi i32 [ 0, %loop174 ], [ %316, %loop275 ]
+  %304 = phi i64 [ %302, %loop174 ], [ %315, %loop275 ]
+  %305 = sub i16 %288, %285
+  %306 = zext i8 %286 to i64
+  %307 = add i64 %304, %306
+  %308 = sub i8 %268, %225
+  %309 = add i16 %305, %305
+  %310 = xor i16 %288, %305
+  %311 = mul i16 %310, %285
+  %312 = mul i8 %283, %283
+  %313 = xor i32 %246, %201
+  %314 = zext i32 %313 to i64
+  %315 = add i64 %304, %314
+  %316 = add i32 %303, 1
+  %317 = icmp ult i32 %316, 4
+  br i1 %317, label %loop275, label %exit276
+
+exit276:                                          ; preds = %loop275
+  %318 = add i32 %301, 1
+  %319 = icmp ult i32 %318, 4
+  br i1 %319, label %loop174, label %exit177
+
+exit177:                                          ; preds = %exit276
+  %320 = add i32 %299, 1
+  %321 = icmp ult i32 %320, 4
+  br i1 %321, label %loop073, label %exit078
+
+exit078:                                          ; preds = %exit177
+  br label %loop079
+
+loop079:                                          ; preds = %exit183, %exit078
+  %322 = phi i32 [ 0, %exit078 ], [ %342, %exit183 ]
+  %323 = phi i64 [ %315, %exit078 ], [ %337, %exit183 ]
+  br label %loop180
+
+loop180:                                          ; preds = %exit282, %loop079
+  %324 = phi i32 [ 0, %loop079 ], [ %340, %exit282 ]
+  %325 = phi i64 [ %323, %loop079 ], [ %337, %exit282 ]
+  br label %loop281
+
+loop281:                                          ; preds = %loop281, %loop180
+  %326 = phi i32 [ 0, %loop180 ], [ %338, %loop281 ]
+  %327 = phi i64 [ %325, %loop180 ], [ %337, %loop281 ]
+  %328 = mul i8 %268, %312
+  %329 = add i8 %265, %283
+  %330 = add i32 %246, %287
+  %331 = xor i16 %266, %288
+  %332 = sub i16 %285, %266
+  %333 = add i8 %312, %329
+  %334 = add i8 %333, %308
+  %335 = add i32 %290, %289
+  %336 = zext i32 %335 to i64
+  %337 = add i64 %327, %336
+  %338 = add i32 %326, 1
+  %339 = icmp ult i32 %338, 4
+  br i1 %339, label %loop281, label %exit282
+
+exit282:                                          ; preds = %loop281
+  %340 = add i32 %324, 1
+  %341 = icmp ult i32 %340, 4
+  br i1 %341, label %loop180, label %exit183
+
+exit183:                                          ; preds = %exit282
+  %342 = add i32 %322, 1
+  %343 = icmp ult i32 %342, 4
+  br i1 %343, label %loop079, label %exit084
+
+exit084:                                          ; preds = %exit183
+  br label %loop085
+
+loop085:                                          ; preds = %exit189, %exit084
+  %344 = phi i32 [ 0, %exit084 ], [ %365, %exit189 ]
+  %345 = phi i64 [ %337, %exit084 ], [ %360, %exit189 ]
+  br label %loop186
+
+loop186:                                          ; preds = %exit288, %loop085
+  %346 = phi i32 [ 0, %loop085 ], [ %363, %exit288 ]
+  %347 = phi i64 [ %345, %loop085 ], [ %360, %exit288 ]
+  br label %loop287
+
+loop287:                                          ; preds = %loop287, %loop186
+  %348 = phi i32 [ 0, %loop186 ], [ %361, %loop287 ]
+  %349 = phi i64 [ %347, %loop186 ], [ %360, %loop287 ]
+  %350 = add i16 %288, %311
+  %351 = mul i32 %287, %313
+  %352 = sub i8 %308, %328
+  %353 = add i32 %335, %313
+  %354 = zext i16 %331 to i32
+  %355 = add i32 %287, %354
+  %356 = mul i32 %351, %290
+  %357 = add i8 %329, %312
+  %358 = or i8 %357, %333
+  %359 = zext i8 %358 to i64
+  %360 = add i64 %349, %359
+  %361 = add i32 %348, 1
+  %362 = icmp ult i32 %361, 4
+  br i1 %362, label %loop287, label %exit288
+
+exit288:                                          ; preds = %loop287
+  %363 = add i32 %346, 1
+  %364 = icmp ult i32 %363, 4
+  br i1 %364, label %loop186, label %exit189
+
+exit189:                                          ; preds = %exit288
+  %365 = add i32 %344, 1
+  %366 = icmp ult i32 %365, 4
+  br i1 %366, label %loop085, label %exit090
+
+exit090:                                          ; preds = %exit189
+  br label %loop091
+
+loop091:                                          ; preds = %exit195, %exit090
+  %367 = phi i32 [ 0, %exit090 ], [ %387, %exit195 ]
+  %368 = phi i64 [ %360, %exit090 ], [ %382, %exit195 ]
+  br label %loop192
+
+loop192:                                          ; preds = %exit294, %loop091
+  %369 = phi i32 [ 0, %loop091 ], [ %385, %exit294 ]
+  %370 = phi i64 [ %368, %loop091 ], [ %382, %exit294 ]
+  br label %loop293
+
+loop293:                                          ; preds = %loop293, %loop192
+  %371 = phi i32 [ 0, %loop192 ], [ %383, %loop293 ]
+  %372 = phi i64 [ %370, %loop192 ], [ %382, %loop293 ]
+  %373 = mul i16 %305, %311
+  %374 = mul i8 %334, %358
+  %375 = mul i64 %372, %327
+  %376 = xor i32 %290, %351
+  %377 = and i8 %352, %374
+  %378 = add i32 %335, %356
+  %379 = or i64 %282, %375
+  %380 = zext i16 %310 to i64
+  %381 = mul i64 %379, %380
+  %382 = add i64 %372, %381
+  %383 = add i32 %371, 1
+  %384 = icmp ult i32 %383, 4
+  br i1 %384, label %loop293, label %exit294
+
+exit294:                                          ; preds = %loop293
+  %385 = add i32 %369, 1
+  %386 = icmp ult i32 %385, 4
+  br i1 %386, label %loop192, label %exit195
+
+exit195:                                          ; preds = %exit294
+  %387 = add i32 %367, 1
+  %388 = icmp ult i32 %387, 4
+  br i1 %388, label %loop091, label %exit096
+
+exit096:                                          ; preds = %exit195
+  br label %loop097
+
+loop097:                                          ; preds = %exit1101, %exit096
+  %389 = phi i32 [ 0, %exit096 ], [ %410, %exit1101 ]
+  %390 = phi i64 [ %382, %exit096 ], [ %405, %exit1101 ]
+  br label %loop198
+
+loop198:                                          ; preds = %exit2100, %loop097
+  %391 = phi i32 [ 0, %loop097 ], [ %408, %exit2100 ]
+  %392 = phi i64 [ %390, %loop097 ], [ %405, %exit2100 ]
+  br label %loop299
+
+loop299:                                          ; preds = %loop299, %loop198
+  %393 = phi i32 [ 0, %loop198 ], [ %406, %loop299 ]
+  %394 = phi i64 [ %392, %loop198 ], [ %405, %loop299 ]
+  %395 = sub i32 %356, %351
+  %396 = add i32 %351, %351
+  %397 = add i64 %394, %375
+  %398 = zext i8 %352 to i16
+  %399 = add i16 %309, %398
+  %400 = and i8 %329, %352
+  %401 = mul i64 %349, %394
+  %402 = add i32 %353, %378
+  %403 = and i16 %310, %332
+  %404 = zext i16 %403 to i64
+  %405 = add i64 %394, %404
+  %406 = add i32 %393, 1
+  %407 = icmp ult i32 %406, 4
+  br i1 %407, label %loop299, label %exit2100
+
+exit2100:                                         ; preds = %loop299
+  %408 = add i32 %391, 1
+  %409 = icmp ult i32 %408, 4
+  br i1 %409, label %loop198, label %exit1101
+
+exit1101:                                         ; preds = %exit2100
+  %410 = add i32 %389, 1
+  %411 = icmp ult i32 %410, 4
+  br i1 %411, label %loop097, label %exit0102
+
+exit0102:                                         ; preds = %exit1101
+  br label %loop0103
+
+loop0103:                                         ; preds = %exit1107, %exit0102
+  %412 = phi i32 [ 0, %exit0102 ], [ %431, %exit1107 ]
+  %413 = phi i64 [ %405, %exit0102 ], [ %426, %exit1107 ]
+  br label %loop1104
+
+loop1104:                                         ; preds = %exit2106, %loop0103
+  %414 = phi i32 [ 0, %loop0103 ], [ %429, %exit2106 ]
+  %415 = phi i64 [ %413, %loop0103 ], [ %426, %exit2106 ]
+  br label %loop2105
+
+loop2105:                                         ; preds = %loop2105, %loop1104
+  %416 = phi i32 [ 0, %loop1104 ], [ %427, %loop2105 ]
+  %417 = phi i64 [ %415, %loop1104 ], [ %426, %loop2105 ]
+  %418 = or i8 %333, %374
+  %419 = add i16 %403, %350
+  %420 = xor i32 %402, %355
+  %421 = mul i32 %376, %376
+  %422 = or i16 %399, %373
+  %423 = mul i8 %374, %334
+  %424 = mul i32 %421, %402
+  %425 = xor i64 %372, %417
+  %426 = add i64 %417, %425
+  %427 = add i32 %416, 1
+  %428 = icmp ult i32 %427, 4
+  br i1 %428, label %loop2105, label %exit2106
+
+exit2106:                                         ; preds = %loop2105
+  %429 = add i32 %414, 1
+  %430 = icmp ult i32 %429, 4
+  br i1 %430, label %loop1104, label %exit1107
+
+exit1107:                                         ; preds = %exit2106
+  %431 = add i32 %412, 1
+  %432 = icmp ult i32 %431, 4
+  br i1 %432, label %loop0103, label %exit0108
+
+exit0108:                                         ; preds = %exit1107
+  br label %loop0109
+
+loop0109:                                         ; preds = %exit1113, %exit0108
+  %433 = phi i32 [ 0, %exit0108 ], [ %453, %exit1113 ]
+  %434 = phi i64 [ %426, %exit0108 ], [ %448, %exit1113 ]
+  br label %loop1110
+
+loop1110:                                         ; preds = %exit2112, %loop0109
+  %435 = phi i32 [ 0, %loop0109 ], [ %451, %exit2112 ]
+  %436 = phi i64 [ %434, %loop0109 ], [ %448, %exit2112 ]
+  br label %loop2111
+
+loop2111:                                         ; preds = %loop2111, %loop1110
+  %437 = phi i32 [ 0, %loop1110 ], [ %449, %loop2111 ]
+  %438 = phi i64 [ %436, %loop1110 ], [ %448, %loop2111 ]
+  %439 = sub i64 %438, %397
+  %440 = xor i32 %420, %402
+  %441 = sub i32 %420, %378
+  %442 = or i64 %381, %439
+  %443 = xor i8 %374, %400
+  %444 = sub i16 %399, %403
+  %445 = or i8 %418, %357
+  %446 = and i32 %441, %420
+  %447 = zext i32 %446 to i64
+  %448 = add i64 %438, %447
+  %449 = add i32 %437, 1
+  %450 = icmp ult i32 %449, 4
+  br i1 %450, label %loop2111, label %exit2112
+
+exit2112:                                         ; preds = %loop2111
+  %451 = add i32 %435, 1
+  %452 = icmp ult i32 %451, 4
+  br i1 %452, label %loop1110, label %exit1113
+
+exit1113:                                         ; preds = %exit2112
+  %453 = add i32 %433, 1
+  %454 = icmp ult i32 %453, 4
+  br i1 %454, label %loop0109, label %exit0114
+
+exit0114:                                         ; preds = %exit1113
+  br label %loop0115
+
+loop0115:                                         ; preds = %exit1119, %exit0114
+  %455 = phi i32 [ 0, %exit0114 ], [ %478, %exit1119 ]
+  %456 = phi i64 [ %448, %exit0114 ], [ %473, %exit1119 ]
+  br label %loop1116
+
+loop1116:                                         ; preds = %exit2118, %loop0115
+  %457 = phi i32 [ 0, %loop0115 ], [ %476, %exit2118 ]
+  %458 = phi i64 [ %456, %loop0115 ], [ %473, %exit2118 ]
+  br label %loop2117
+
+loop2117:                                         ; preds = %loop2117, %loop1116
+  %459 = phi i32 [ 0, %loop1116 ], [ %474, %loop2117 ]
+  %460 = phi i64 [ %458, %loop1116 ], [ %473, %loop2117 ]
+  %461 = zext i8 %358 to i64
+  %462 = add i64 %425, %461
+  %463 = xor i64 %401, %401
+  %464 = mul i32 %396, %424
+  %465 = zext i16 %403 to i64
+  %466 = add i64 %439, %465
+  %467 = zext i16 %399 to i64
+  %468 = add i64 %460, %467
+  %469 = or i16 %403, %332
+  %470 = add i64 %468, %462
+  %471 = xor i16 %469, %469
+  %472 = zext i16 %471 to i64
+  %473 = add i64 %460, %472
+  %474 = add i32 %459, 1
+  %475 = icmp ult i32 %474, 4
+  br i1 %475, label %loop2117, label %exit2118
+
+exit2118:                                         ; preds = %loop2117
+  %476 = add i32 %457, 1
+  %477 = icmp ult i32 %476, 4
+  br i1 %477, label %loop1116, label %exit1119
+
+exit1119:                                         ; preds = %exit2118
+  %478 = add i32 %455, 1
+  %479 = icmp ult i32 %478, 4
+  br i1 %479, label %loop0115, label %exit0120
+
+exit0120:                                         ; preds = %exit1119
+  br label %loop0121
+
+loop0121:                                         ; preds = %exit1125, %exit0120
+  %480 = phi i32 [ 0, %exit0120 ], [ %499, %exit1125 ]
+  %481 = phi i64 [ %473, %exit0120 ], [ %494, %exit1125 ]
+  br label %loop1122
+
+loop1122:                                         ; preds = %exit2124, %loop0121
+  %482 = phi i32 [ 0, %loop0121 ], [ %497, %exit2124 ]
+  %483 = phi i64 [ %481, %loop0121 ], [ %494, %exit2124 ]
+  br label %loop2123
+
+loop2123:                                         ; preds = %loop2123, %loop1122
+  %484 = phi i32 [ 0, %loop1122 ], [ %495, %loop2123 ]
+  %485 = phi i64 [ %483, %loop1122 ], [ %494, %loop2123 ]
+  %486 = mul i64 %463, %442
+  %487 = add i32 %424, %420
+  %488 = sub i64 %468, %485
+  %489 = sub i8 %423, %358
+  %490 = add i8 %374, %400
+  %491 = or i16 %444, %471
+  %492 = and i32 %441, %421
+  %493 = add i64 %463, %468
+  %494 = add i64 %485, %493
+  %495 = add i32 %484, 1
+  %496 = icmp ult i32 %495, 4
+  br i1 %496, label %loop2123, label %exit2124
+
+exit2124:                                         ; preds = %loop2123
+  %497 = add i32 %482, 1
+  %498 = icmp ult i32 %497, 4
+  br i1 %498, label %loop1122, label %exit1125
+
+exit1125:                                         ; preds = %exit2124
+  %499 = add i32 %480, 1
+  %500 = icmp ult i32 %499, 4
+  br i1 %500, label %loop0121, label %exit0126
+
+exit0126:                                         ; preds = %exit1125
+  br label %loop0127
+
+loop0127:                                         ; preds = %exit1131, %exit0126
+  %501 = phi i32 [ 0, %exit0126 ], [ %522, %exit1131 ]
+  %502 = phi i64 [ %494, %exit0126 ], [ %517, %exit1131 ]
+  br label %loop1128
+
+loop1128:                                         ; preds = %exit2130, %loop0127
+  %503 = phi i32 [ 0, %loop0127 ], [ %520, %exit2130 ]
+  %504 = phi i64 [ %502, %loop0127 ], [ %517, %exit2130 ]
+  br label %loop2129
+
+loop2129:                                         ; preds = %loop2129, %loop1128
+  %505 = phi i32 [ 0, %loop1128 ], [ %518, %loop2129 ]
+  %506 = phi i64 [ %504, %loop1128 ], [ %517, %loop2129 ]
+  %507 = zext i16 %491 to i64
+  %508 = and i64 %468, %507
+  %509 = add i64 %470, %486
+  %510 = and i8 %377, %489
+  %511 = or i32 %441, %440
+  %512 = or i8 %400, %423
+  %513 = xor i16 %403, %399
+  %514 = sub i32 %440, %441
+  %515 = sub i16 %403, %419
+  %516 = zext i16 %515 to i64
+  %517 = add i64 %506, %516
+  %518 = add i32 %505, 1
+  %519 = icmp ult i32 %518, 4
+  br i1 %519, label %loop2129, label %exit2130
+
+exit2130:                                         ; preds = %loop2129
+  %520 = add i32 %503, 1
+  %521 = icmp ult i32 %520, 4
+  br i1 %521, label %loop1128, label %exit1131
+
+exit1131:                                         ; preds = %exit2130
+  %522 = add i32 %501, 1
+  %523 = icmp ult i32 %522, 4
+  br i1 %523, label %loop0127, label %exit0132
+
+exit0132:                                         ; preds = %exit1131
+  br label %loop0133
+
+loop0133:                                         ; preds = %exit1137, %exit0132
+  %524 = phi i32 [ 0, %exit0132 ], [ %545, %exit1137 ]
+  %525 = phi i64 [ %517, %exit0132 ], [ %540, %exit1137 ]
+  br label %loop1134
+
+loop1134:                                         ; preds = %exit2136, %loop0133
+  %526 = phi i32 [ 0, %loop0133 ], [ %543, %exit2136 ]
+  %527 = phi i64 [ %525, %loop0133 ], [ %540, %exit2136 ]
+  br label %loop2135
+
+loop2135:                                         ; preds = %loop2135, %loop1134
+  %528 = phi i32 [ 0, %loop1134 ], [ %541, %loop2135 ]
+  %529 = phi i64 [ %527, %loop1134 ], [ %540, %loop2135 ]
+  %530 = or i8 %489, %512
+  %531 = sub i16 %491, %513
+  %532 = add i16 %531, %471
+  %533 = xor i32 %511, %487
+  %534 = mul i8 %512, %445
+  %535 = sub i64 %506, %493
+  %536 = sub i32 %514, %514
+  %537 = zext i8 %490 to i16
+  %538 = add i16 %515, %537
+  %539 = zext i16 %538 to i64
+  %540 = add i64 %529, %539
+  %541 = add i32 %528, 1
+  %542 = icmp ult i32 %541, 4
+  br i1 %542, label %loop2135, label %exit2136
+
+exit2136:                                         ; preds = %loop2135
+  %543 = add i32 %526, 1
+  %544 = icmp ult i32 %543, 4
+  br i1 %544, label %loop1134, label %exit1137
+
+exit1137:                                         ; preds = %exit2136
+  %545 = add i32 %524, 1
+  %546 = icmp ult i32 %545, 4
+  br i1 %546, label %loop0133, label %exit0138
+
+exit0138:                                         ; preds = %exit1137
+  br label %loop0139
+
+loop0139:                                         ; preds = %exit1143, %exit0138
+  %547 = phi i32 [ 0, %exit0138 ], [ %568, %exit1143 ]
+  %548 = phi i64 [ %540, %exit0138 ], [ %563, %exit1143 ]
+  br label %loop1140
+
+loop1140:                                         ; preds = %exit2142, %loop0139
+  %549 = phi i32 [ 0, %loop0139 ], [ %566, %exit2142 ]
+  %550 = phi i64 [ %548, %loop0139 ], [ %563, %exit2142 ]
+  br label %loop2141
+
+loop2141:                                         ; preds = %loop2141, %loop1140
+  %551 = phi i32 [ 0, %loop1140 ], [ %564, %loop2141 ]
+  %552 = phi i64 [ %550, %loop1140 ], [ %563, %loop2141 ]
+  %553 = and i32 %511, %514
+  %554 = add i8 %490, %512
+  %555 = add i8 %489, %512
+  %556 = add i32 %487, %536
+  %557 = xor i8 %534, %490
+  %558 = mul i8 %490, %555
+  %559 = or i16 %532, %513
+  %560 = zext i8 %555 to i16
+  %561 = add i16 %513, %560
+  %562 = zext i16 %561 to i64
+  %563 = add i64 %552, %562
+  %564 = add i32 %551, 1
+  %565 = icmp ult i32 %564, 4
+  br i1 %565, label %loop2141, label %exit2142
+
+exit2142:                                         ; preds = %loop2141
+  %566 = add i32 %549, 1
+  %567 = icmp ult i32 %566, 4
+  br i1 %567, label %loop1140, label %exit1143
+
+exit1143:                                         ; preds = %exit2142
+  %568 = add i32 %547, 1
+  %569 = icmp ult i32 %568, 4
+  br i1 %569, label %loop0139, label %exit0144
+
+exit0144:                                         ; preds = %exit1143
+  br label %loop0145
+
+loop0145:                                         ; preds = %exit1149, %exit0144
+  %570 = phi i32 [ 0, %exit0144 ], [ %590, %exit1149 ]
+  %571 = phi i64 [ %563, %exit0144 ], [ %585, %exit1149 ]
+  br label %loop1146
+
+loop1146:                                         ; preds = %exit2148, %loop0145
+  %572 = phi i32 [ 0, %loop0145 ], [ %588, %exit2148 ]
+  %573 = phi i64 [ %571, %loop0145 ], [ %585, %exit2148 ]
+  br label %loop2147
+
+loop2147:                                         ; preds = %loop2147, %loop1146
+  %574 = phi i32 [ 0, %loop1146 ], [ %586, %loop2147 ]
+  %575 = phi i64 [ %573, %loop1146 ], [ %585, %loop2147 ]
+  %576 = add i32 %511, %487
+  %577 = and i32 %576, %576
+  %578 = add i32 %553, %576
+  %579 = add i16 %559, %561
+  %580 = mul i8 %558, %555
+  %581 = add i16 %532, %538
+  %582 = or i32 %556, %556
+  %583 = or i32 %556, %556
+  %584 = zext i32 %583 to i64
+  %585 = add i64 %575, %584
+  %586 = add i32 %574, 1
+  %587 = icmp ult i32 %586, 4
+  br i1 %587, label %loop2147, label %exit2148
+
+exit2148:                                         ; preds = %loop2147
+  %588 = add i32 %572, 1
+  %589 = icmp ult i32 %588, 4
+  br i1 %589, label %loop1146, label %exit1149
+
+exit1149:                                         ; preds = %exit2148
+  %590 = add i32 %570, 1
+  %591 = icmp ult i32 %590, 4
+  br i1 %591, label %loop0145, label %exit0150
+
+exit0150:                                         ; preds = %exit1149
+  br label %loop0151
+
+loop0151:                                         ; preds = %exit1155, %exit0150
+  %592 = phi i32 [ 0, %exit0150 ], [ %611, %exit1155 ]
+  %593 = phi i64 [ %585, %exit0150 ], [ %606, %exit1155 ]
+  br label %loop1152
+
+loop1152:                                         ; preds = %exit2154, %loop0151
+  %594 = phi i32 [ 0, %loop0151 ], [ %609, %exit2154 ]
+  %595 = phi i64 [ %593, %loop0151 ], [ %606, %exit2154 ]
+  br label %loop2153
+
+loop2153:                                         ; preds = %loop2153, %loop1152
+  %596 = phi i32 [ 0, %loop1152 ], [ %607, %loop2153 ]
+  %597 = phi i64 [ %595, %loop1152 ], [ %606, %loop2153 ]
+  %598 = and i32 %582, %577
+  %599 = and i64 %509, %529
+  %600 = sub i16 %515, %561
+  %601 = sub i8 %580, %558
+  %602 = add i16 %581, %532
+  %603 = or i8 %601, %530
+  %604 = add i8 %558, %555
+  %605 = mul i64 %552, %535
+  %606 = add i64 %597, %605
+  %607 = add i32 %596, 1
+  %608 = icmp ult i32 %607, 4
+  br i1 %608, label %loop2153, label %exit2154
+
+exit2154:                                         ; preds = %loop2153
+  %609 = add i32 %594, 1
+  %610 = icmp ult i32 %609, 4
+  br i1 %610, label %loop1152, label %exit1155
+
+exit1155:                                         ; preds = %exit2154
+  %611 = add i32 %592, 1
+  %612 = icmp ult i32 %611, 4
+  br i1 %612, label %loop0151, label %exit0156
+
+exit0156:                                         ; preds = %exit1155
+  br label %loop0157
+
+loop0157:                                         ; preds = %exit1161, %exit0156
+  %613 = phi i32 [ 0, %exit0156 ], [ %633, %exit1161 ]
+  %614 = phi i64 [ %606, %exit0156 ], [ %628, %exit1161 ]
+  br label %loop1158
+
+loop1158:                                         ; preds = %exit2160, %loop0157
+  %615 = phi i32 [ 0, %loop0157 ], [ %631, %exit2160 ]
+  %616 = phi i64 [ %614, %loop0157 ], [ %628, %exit2160 ]
+  br label %loop2159
+
+loop2159:                                         ; preds = %loop2159, %loop1158
+  %617 = phi i32 [ 0, %loop1158 ], [ %629, %loop2159 ]
+  %618 = phi i64 [ %616, %loop1158 ], [ %628, %loop2159 ]
+  %619 = sub i8 %555, %554
+  %620 = or i32 %576, %556
+  %621 = add i32 %578, %582
+  %622 = and i8 %604, %555
+  %623 = add i8 %601, %580
+  %624 = or i32 %582, %577
+  %625 = xor i8 %558, %604
+  %626 = add i8 %622, %622
+  %627 = zext i8 %626 to i64
+  %628 = add i64 %618, %627
+  %629 = add i32 %617, 1
+  %630 = icmp ult i32 %629, 4
+  br i1 %630, label %loop2159, label %exit2160
+
+exit2160:                                         ; preds = %loop2159
+  %631 = add i32 %615, 1
+  %632 = icmp ult i32 %631, 4
+  br i1 %632, label %loop1158, label %exit1161
+
+exit1161:                                         ; preds = %exit2160
+  %633 = add i32 %613, 1
+  %634 = icmp ult i32 %633, 4
+  br i1 %634, label %loop0157, label %exit0162
+
+exit0162:                                         ; preds = %exit1161
+  br label %loop0163
+
+loop0163:                                         ; preds = %exit1167, %exit0162
+  %635 = phi i32 [ 0, %exit0162 ], [ %654, %exit1167 ]
+  %636 = phi i64 [ %628, %exit0162 ], [ %649, %exit1167 ]
+  br label %loop1164
+
+loop1164:                                         ; preds = %exit2166, %loop0163
+  %637 = phi i32 [ 0, %loop0163 ], [ %652, %exit2166 ]
+  %638 = phi i64 [ %636, %loop0163 ], [ %649, %exit2166 ]
+  br label %loop2165
+
+loop2165:                                         ; preds = %loop2165, %loop1164
+  %639 = phi i32 [ 0, %loop1164 ], [ %650, %loop2165 ]
+  %640 = phi i64 [ %638, %loop1164 ], [ %649, %loop2165 ]
+  %641 = add i32 %577, %621
+  %642 = add i8 %623, %625
+  %643 = add i32 %620, %620
+  %644 = add i16 %602, %532
+  %645 = mul i64 %599, %640
+  %646 = add i64 %640, %640
+  %647 = add i32 %620, %643
+  %648 = sub i64 %597, %597
+  %649 = add i64 %640, %648
+  %650 = add i32 %639, 1
+  %651 = icmp ult i32 %650, 4
+  br i1 %651, label %loop2165, label %exit2166
+
+exit2166:                                         ; preds = %loop2165
+  %652 = add i32 %637, 1
+  %653 = icmp ult i32 %652, 4
+  br i1 %653, label %loop1164, label %exit1167
+
+exit1167:                                         ; preds = %exit2166
+  %654 = add i32 %635, 1
+  %655 = icmp ult i32 %654, 4
+  br i1 %655, label %loop0163, label %exit0168
+
+exit0168:                                         ; preds = %exit1167
+  br label %loop0169
+
+loop0169:                                         ; preds = %exit1173, %exit0168
+  %656 = phi i32 [ 0, %exit0168 ], [ %676, %exit1173 ]
+  %657 = phi i64 [ %649, %exit0168 ], [ %671, %exit1173 ]
+  br label %loop1170
+
+loop1170:                                         ; preds = %exit2172, %loop0169
+  %658 = phi i32 [ 0, %loop0169 ], [ %674, %exit2172 ]
+  %659 = phi i64 [ %657, %loop0169 ], [ %671, %exit2172 ]
+  br label %loop2171
+
+loop2171:                                         ; preds = %loop2171, %loop1170
+  %660 = phi i32 [ 0, %loop1170 ], [ %672, %loop2171 ]
+  %661 = phi i64 [ %659, %loop1170 ], [ %671, %loop2171 ]
+  %662 = xor i64 %648, %648
+  %663 = mul i32 %621, %583
+  %664 = or i32 %641, %621
+  %665 = and i32 %643, %620
+  %666 = sub i32 %641, %647
+  %667 = or i16 %538, %581
+  %668 = add i8 %603, %626
+  %669 = and i16 %559, %602
+  %670 = zext i16 %669 to i64
+  %671 = add i64 %661, %670
+  %672 = add i32 %660, 1
+  %673 = icmp ult i32 %672, 4
+  br i1 %673, label %loop2171, label %exit2172
+
+exit2172:                                         ; preds = %loop2171
+  %674 = add i32 %658, 1
+  %675 = icmp ult i32 %674, 4
+  br i1 %675, label %loop1170, label %exit1173
+
+exit1173:                                         ; preds = %exit2172
+  %676 = add i32 %656, 1
+  %677 = icmp ult i32 %676, 4
+  br i1 %677, label %loop0169, label %exit0174
+
+exit0174:                                         ; preds = %exit1173
+  br label %loop0175
+
+loop0175:                                         ; preds = %exit1179, %exit0174
+  %678 = phi i32 [ 0, %exit0174 ], [ %698, %exit1179 ]
+  %679 = phi i64 [ %671, %exit0174 ], [ %693, %exit1179 ]
+  br label %loop1176
+
+loop1176:                                         ; preds = %exit2178, %loop0175
+  %680 = phi i32 [ 0, %loop0175 ], [ %696, %exit2178 ]
+  %681 = phi i64 [ %679, %loop0175 ], [ %693, %exit2178 ]
+  br label %loop2177
+
+loop2177:                                         ; preds = %loop2177, %loop1176
+  %682 = phi i32 [ 0, %loop1176 ], [ %694, %loop2177 ]
+  %683 = phi i64 [ %681, %loop1176 ], [ %693, %loop2177 ]
+  %684 = xor i32 %665, %665
+  %685 = add i16 %600, %581
+  %686 = sub i64 %662, %640
+  %687 = or i64 %646, %683
+  %688 = and i32 %643, %664
+  %689 = add i8 %619, %623
+  %690 = add i16 %669, %602
+  %691 = add i32 %684, %665
+  %692 = zext i32 %691 to i64
+  %693 = add i64 %683, %692
+  %694 = add i32 %682, 1
+  %695 = icmp ult i32 %694, 4
+  br i1 %695, label %loop2177, label %exit2178
+
+exit2178:                                         ; preds = %loop2177
+  %696 = add i32 %680, 1
+  %697 = icmp ult i32 %696, 4
+  br i1 %697, label %loop1176, label %exit1179
+
+exit1179:                                         ; preds = %exit2178
+  %698 = add i32 %678, 1
+  %699 = icmp ult i32 %698, 4
+  br i1 %699, label %loop0175, label %exit0180
+
+exit0180:                                         ; preds = %exit1179
+  br label %loop0181
+
+loop0181:                                         ; preds = %exit1185, %exit0180
+  %700 = phi i32 [ 0, %exit0180 ], [ %719, %exit1185 ]
+  %701 = phi i64 [ %693, %exit0180 ], [ %714, %exit1185 ]
+  br label %loop1182
+
+loop1182:                                         ; preds = %exit2184, %loop0181
+  %702 = phi i32 [ 0, %loop0181 ], [ %717, %exit2184 ]
+  %703 = phi i64 [ %701, %loop0181 ], [ %714, %exit2184 ]
+  br label %loop2183
+
+loop2183:                                         ; preds = %loop2183, %loop1182
+  %704 = phi i32 [ 0, %loop1182 ], [ %715, %loop2183 ]
+  %705 = phi i64 [ %703, %loop1182 ], [ %714, %loop2183 ]
+  %706 = xor i64 %661, %705
+  %707 = and i32 %665, %664
+  %708 = xor i64 %705, %648
+  %709 = mul i8 %626, %626
+  %710 = add i32 %691, %663
+  %711 = xor i32 %691, %710
+  %712 = add i64 %708, %686
+  %713 = xor i64 %712, %686
+  %714 = add i64 %705, %713
+  %715 = add i32 %704, 1
+  %716 = icmp ult i32 %715, 4
+  br i1 %716, label %loop2183, label %exit2184
+
+exit2184:                                         ; preds = %loop2183
+  %717 = add i32 %702, 1
+  %718 = icmp ult i32 %717, 4
+  br i1 %718, label %loop1182, label %exit1185
+
+exit1185:                                         ; preds = %exit2184
+  %719 = add i32 %700, 1
+  %720 = icmp ult i32 %719, 4
+  br i1 %720, label %loop0181, label %exit0186
+
+exit0186:                                         ; preds = %exit1185
+  br label %loop0187
+
+loop0187:                                         ; preds = %exit1191, %exit0186
+  %721 = phi i32 [ 0, %exit0186 ], [ %741, %exit1191 ]
+  %722 = phi i64 [ %714, %exit0186 ], [ %736, %exit1191 ]
+  br label %loop1188
+
+loop1188:                                         ; preds = %exit2190, %loop0187
+  %723 = phi i32 [ 0, %loop0187 ], [ %739, %exit2190 ]
+  %724 = phi i64 [ %722, %loop0187 ], [ %736, %exit2190 ]
+  br label %loop2189
+
+loop2189:                                         ; preds = %loop2189, %loop1188
+  %725 = phi i32 [ 0, %loop1188 ], [ %737, %loop2189 ]
+  %726 = phi i64 [ %724, %loop1188 ], [ %736, %loop2189 ]
+  %727 = add i16 %644, %690
+  %728 = add i64 %687, %686
+  %729 = sub i8 %689, %622
+  %730 = and i8 %625, %623
+  %731 = and i32 %710, %688
+  %732 = add i8 %642, %709
+  %733 = and i8 %689, %729
+  %734 = or i32 %684, %666
+  %735 = zext i32 %734 to i64
+  %736 = add i64 %726, %735
+  %737 = add i32 %725, 1
+  %738 = icmp ult i32 %737, 4
+  br i1 %738, label %loop2189, label %exit2190
+
+exit2190:                                         ; preds = %loop2189
+  %739 = add i32 %723, 1
+  %740 = icmp ult i32 %739, 4
+  br i1 %740, label %loop1188, label %exit1191
+
+exit1191:                                         ; preds = %exit2190
+  %741 = add i32 %721, 1
+  %742 = icmp ult i32 %741, 4
+  br i1 %742, label %loop0187, label %exit0192
+
+exit0192:                                         ; preds = %exit1191
+  br label %loop0193
+
+loop0193:                                         ; preds = %exit1197, %exit0192
+  %743 = phi i32 [ 0, %exit0192 ], [ %763, %exit1197 ]
+  %744 = phi i64 [ %736, %exit0192 ], [ %758, %exit1197 ]
+  br label %loop1194
+
+loop1194:                                         ; preds = %exit2196, %loop0193
+  %745 = phi i32 [ 0, %loop0193 ], [ %761, %exit2196 ]
+  %746 = phi i64 [ %744, %loop0193 ], [ %758, %exit2196 ]
+  br label %loop2195
+
+loop2195:                                         ; preds = %loop2195, %loop1194
+  %747 = phi i32 [ 0, %loop1194 ], [ %759, %loop2195 ]
+  %748 = phi i64 [ %746, %loop1194 ], [ %758, %loop2195 ]
+  %749 = xor i16 %669, %644
+  %750 = sub i8 %733, %729
+  %751 = and i32 %710, %731
+  %752 = sub i16 %644, %669
+  %753 = mul i8 %733, %709
+  %754 = add i16 %749, %685
+  %755 = xor i32 %688, %734
+  %756 = sub i16 %754, %727
+  %757 = zext i16 %756 to i64
+  %758 = add i64 %748, %757
+  %759 = add i32 %747, 1
+  %760 = icmp ult i32 %759, 4
+  br i1 %760, label %loop2195, label %exit2196
+
+exit2196:                                         ; preds = %loop2195
+  %761 = add i32 %745, 1
+  %762 = icmp ult i32 %761, 4
+  br i1 %762, label %loop1194, label %exit1197
+
+exit1197:                                         ; preds = %exit2196
+  %763 = add i32 %743, 1
+  %764 = icmp ult i32 %763, 4
+  br i1 %764, label %loop0193, label %exit0198
+
+exit0198:                                         ; preds = %exit1197
+  br label %loop0199
+
+loop0199:                                         ; preds = %exit1203, %exit0198
+  %765 = phi i32 [ 0, %exit0198 ], [ %785, %exit1203 ]
+  %766 = phi i64 [ %758, %exit0198 ], [ %780, %exit1203 ]
+  br label %loop1200
+
+loop1200:                                         ; preds = %exit2202, %loop0199
+  %767 = phi i32 [ 0, %loop0199 ], [ %783, %exit2202 ]
+  %768 = phi i64 [ %766, %loop0199 ], [ %780, %exit2202 ]
+  br label %loop2201
+
+loop2201:                                         ; preds = %loop2201, %loop1200
+  %769 = phi i32 [ 0, %loop1200 ], [ %781, %loop2201 ]
+  %770 = phi i64 [ %768, %loop1200 ], [ %780, %loop2201 ]
+  %771 = sub i64 %706, %728
+  %772 = or i32 %755, %731
+  %773 = or i32 %772, %751
+  %774 = and i32 %734, %734
+  %775 = zext i8 %733 to i16
+  %776 = mul i16 %727, %775
+  %777 = sub i8 %689, %709
+  %778 = add i64 %713, %726
+  %779 = xor i64 %771, %713
+  %780 = add i64 %770, %779
+  %781 = add i32 %769, 1
+  %782 = icmp ult i32 %781, 4
+  br i1 %782, label %loop2201, label %exit2202
+
+exit2202:                                         ; preds = %loop2201
+  %783 = add i32 %767, 1
+  %784 = icmp ult i32 %783, 4
+  br i1 %784, label %loop1200, label %exit1203
+
+exit1203:                                         ; preds = %exit2202
+  %785 = add i32 %765, 1
+  %786 = icmp ult i32 %785, 4
+  br i1 %786, label %loop0199, label %exit0204
+
+exit0204:                                         ; preds = %exit1203
+  br label %loop0205
+
+loop0205:                                         ; preds = %exit1209, %exit0204
+  %787 = phi i32 [ 0, %exit0204 ], [ %809, %exit1209 ]
+  %788 = phi i64 [ %780, %exit0204 ], [ %804, %exit1209 ]
+  br label %loop1206
+
+loop1206:                                         ; preds = %exit2208, %loop0205
+  %789 = phi i32 [ 0, %loop0205 ], [ %807, %exit2208 ]
+  %790 = phi i64 [ %788, %loop0205 ], [ %804, %exit2208 ]
+  br label %loop2207
+
+loop2207:                                         ; preds = %loop2207, %loop1206
+  %791 = phi i32 [ 0, %loop1206 ], [ %805, %loop2207 ]
+  %792 = phi i64 [ %790, %loop1206 ], [ %804, %loop2207 ]
+  %793 = sub i16 %776, %749
+  %794 = add i8 %730, %732
+  %795 = xor i16 %727, %752
+  %796 = sub i32 %773, %734
+  %797 = add i64 %748, %770
+  %798 = zext i8 %750 to i64
+  %799 = and i64 %778, %798
+  %800 = add i16 %727, %795
+  %801 = zext i8 %729 to i32
+  %802 = xor i32 %774, %801
+  %803 = zext i32 %802 to i64
+  %804 = add i64 %792, %803
+  %805 = add i32 %791, 1
+  %806 = icmp ult i32 %805, 4
+  br i1 %806, label %loop2207, label %exit2208
+
+exit2208:                                         ; preds = %loop2207
+  %807 = add i32 %789, 1
+  %808 = icmp ult i32 %807, 4
+  br i1 %808, label %loop1206, label %exit1209
+
+exit1209:                                         ; preds = %exit2208
+  %809 = add i32 %787, 1
+  %810 = icmp ult i32 %809, 4
+  br i1 %810, label %loop0205, label %exit0210
+
+exit0210:                                         ; preds = %exit1209
+  br label %loop0211
+
+loop0211:                                         ; preds = %exit1215, %exit0210
+  %811 = phi i32 [ 0, %exit0210 ], [ %832, %exit1215 ]
+  %812 = phi i64 [ %804, %exit0210 ], [ %827, %exit1215 ]
+  br label %loop1212
+
+loop1212:                                         ; preds = %exit2214, %loop0211
+  %813 = phi i32 [ 0, %loop0211 ], [ %830, %exit2214 ]
+  %814 = phi i64 [ %812, %loop0211 ], [ %827, %exit2214 ]
+  br label %loop2213
+
+loop2213:                                         ; preds = %loop2213, %loop1212
+  %815 = phi i32 [ 0, %loop1212 ], [ %828, %loop2213 ]
+  %816 = phi i64 [ %814, %loop1212 ], [ %827, %loop2213 ]
+  %817 = add i32 %773, %755
+  %818 = and i32 %796, %796
+  %819 = xor i16 %756, %800
+  %820 = or i16 %793, %754
+  %821 = add i64 %797, %799
+  %822 = or i64 %816, %821
+  %823 = zext i16 %795 to i64
+  %824 = add i64 %778, %823
+  %825 = xor i32 %802, %773
+  %826 = zext i32 %825 to i64
+  %827 = add i64 %816, %826
+  %828 = add i32 %815, 1
+  %829 = icmp ult i32 %828, 4
+  br i1 %829, label %loop2213, label %exit2214
+
+exit2214:                                         ; preds = %loop2213
+  %830 = add i32 %813, 1
+  %831 = icmp ult i32 %830, 4
+  br i1 %831, label %loop1212, label %exit1215
+
+exit1215:                                         ; preds = %exit2214
+  %832 = add i32 %811, 1
+  %833 = icmp ult i32 %832, 4
+  br i1 %833, label %loop0211, label %exit0216
+
+exit0216:                                         ; preds = %exit1215
+  br label %loop0217
+
+loop0217:                                         ; preds = %exit1221, %exit0216
+  %834 = phi i32 [ 0, %exit0216 ], [ %855, %exit1221 ]
+  %835 = phi i64 [ %827, %exit0216 ], [ %850, %exit1221 ]
+  br label %loop1218
+
+loop1218:                                         ; preds = %exit2220, %loop0217
+  %836 = phi i32 [ 0, %loop0217 ], [ %853, %exit2220 ]
+  %837 = phi i64 [ %835, %loop0217 ], [ %850, %exit2220 ]
+  br label %loop2219
+
+loop2219:                                         ; preds = %loop2219, %loop1218
+  %838 = phi i32 [ 0, %loop1218 ], [ %851, %loop2219 ]
+  %839 = phi i64 [ %837, %loop1218 ], [ %850, %loop2219 ]
+  %840 = add i16 %800, %819
+  %841 = sub i16 %756, %820
+  %842 = mul i32 %817, %774
+  %843 = sub i32 %842, %774
+  %844 = add i8 %733, %750
+  %845 = zext i8 %777 to i32
+  %846 = mul i32 %842, %845
+  %847 = xor i16 %793, %795
+  %848 = mul i32 %817, %825
+  %849 = zext i32 %848 to i64
+  %850 = add i64 %839, %849
+  %851 = add i32 %838, 1
+  %852 = icmp ult i32 %851, 4
+  br i1 %852, label %loop2219, label %exit2220
+
+exit2220:                                         ; preds = %loop2219
+  %853 = add i32 %836, 1
+  %854 = icmp ult i32 %853, 4
+  br i1 %854, label %loop1218, label %exit1221
+
+exit1221:                                         ; preds = %exit2220
+  %855 = add i32 %834, 1
+  %856 = icmp ult i32 %855, 4
+  br i1 %856, label %loop0217, label %exit0222
+
+exit0222:                                         ; preds = %exit1221
+  br label %loop0223
+
+loop0223:                                         ; preds = %exit1227, %exit0222
+  %857 = phi i32 [ 0, %exit0222 ], [ %877, %exit1227 ]
+  %858 = phi i64 [ %850, %exit0222 ], [ %872, %exit1227 ]
+  br label %loop1224
+
+loop1224:                                         ; preds = %exit2226, %loop0223
+  %859 = phi i32 [ 0, %loop0223 ], [ %875, %exit2226 ]
+  %860 = phi i64 [ %858, %loop0223 ], [ %872, %exit2226 ]
+  br label %loop2225
+
+loop2225:                                         ; preds = %loop2225, %loop1224
+  %861 = phi i32 [ 0, %loop1224 ], [ %873, %loop2225 ]
+  %862 = phi i64 [ %860, %loop1224 ], [ %872, %loop2225 ]
+  %863 = or i64 %822, %822
+  %864 = add i16 %847, %840
+  %865 = sub i8 %844, %844
+  %866 = and i8 %777, %733
+  %867 = or i64 %821, %821
+  %868 = mul i64 %839, %839
+  %869 = add i8 %753, %794
+  %870 = add i32 %843, %846
+  %871 = zext i32 %870 to i64
+  %872 = add i64 %862, %871
+  %873 = add i32 %861, 1
+  %874 = icmp ult i32 %873, 4
+  br i1 %874, label %loop2225, label %exit2226
+
+exit2226:                                         ; preds = %loop2225
+  %875 = add i32 %859, 1
+  %876 = icmp ult i32 %875, 4
+  br i1 %876, label %loop1224, label %exit1227
+
+exit1227:                                         ; preds = %exit2226
+  %877 = add i32 %857, 1
+  %878 = icmp ult i32 %877, 4
+  br i1 %878, label %loop0223, label %exit0228
+
+exit0228:                                         ; preds = %exit1227
+  br label %loop0229
+
+loop0229:                                         ; preds = %exit1233, %exit0228
+  %879 = phi i32 [ 0, %exit0228 ], [ %900, %exit1233 ]
+  %880 = phi i64 [ %872, %exit0228 ], [ %895, %exit1233 ]
+  br label %loop1230
+
+loop1230:                                         ; preds = %exit2232, %loop0229
+  %881 = phi i32 [ 0, %loop0229 ], [ %898, %exit2232 ]
+  %882 = phi i64 [ %880, %loop0229 ], [ %895, %exit2232 ]
+  br label %loop2231
+
+loop2231:                                         ; preds = %loop2231, %loop1230
+  %883 = phi i32 [ 0, %loop1230 ], [ %896, %loop2231 ]
+  %884 = phi i64 [ %882, %loop1230 ], [ %895, %loop2231 ]
+  %885 = zext i16 %820 to i64
+  %886 = add i64 %863, %885
+  %887 = add i16 %864, %841
+  %888 = or i16 %841, %820
+  %889 = add i16 %887, %888
+  %890 = add i32 %817, %846
+  %891 = mul i16 %887, %889
+  %892 = or i8 %753, %750
+  %893 = add i8 %892, %844
+  %894 = zext i8 %893 to i64
+  %895 = add i64 %884, %894
+  %896 = add i32 %883, 1
+  %897 = icmp ult i32 %896, 4
+  br i1 %897, label %loop2231, label %exit2232
+
+exit2232:                                         ; preds = %loop2231
+  %898 = add i32 %881, 1
+  %899 = icmp ult i32 %898, 4
+  br i1 %899, label %loop1230, label %exit1233
+
+exit1233:                                         ; preds = %exit2232
+  %900 = add i32 %879, 1
+  %901 = icmp ult i32 %900, 4
+  br i1 %901, label %loop0229, label %exit0234
+
+exit0234:                                         ; preds = %exit1233
+  ret i64 %895
+}
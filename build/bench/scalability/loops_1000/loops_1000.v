@@ -0,0 +1,17760 @@
+module loops_1000
+(
+	input wire  clk,
+	input wire  reset,
+	input wire  start,
+	output reg  finish,
+	output reg [63:0] return_val,
+	input wire [7:0] arg_0,
+	input wire [7:0] arg_1,
+	input wire [15:0] arg_2,
+	input wire [15:0] arg_3,
+	input wire [31:0] arg_4,
+	input wire [31:0] arg_5,
+	input wire [63:0] arg_6,
+	input wire [63:0] arg_7
+);
+
+parameter [8:0] BPHLS = 9'd0;
+parameter [8:0] BPHLS_F_loops_1000_BB_0_S_0 = 9'd1;
+parameter [8:0] BPHLS_F_loops_1000_BB_1_S_0 = 9'd2;
+parameter [8:0] BPHLS_F_loops_1000_BB_2_S_0 = 9'd3;
+parameter [8:0] BPHLS_F_loops_1000_BB_2_S_1 = 9'd4;
+parameter [8:0] BPHLS_F_loops_1000_BB_3_S_0 = 9'd5;
+parameter [8:0] BPHLS_F_loops_1000_BB_3_S_1 = 9'd6;
+parameter [8:0] BPHLS_F_loops_1000_BB_4_S_0 = 9'd7;
+parameter [8:0] BPHLS_F_loops_1000_BB_4_S_1 = 9'd8;
+parameter [8:0] BPHLS_F_loops_1000_BB_5_S_0 = 9'd9;
+parameter [8:0] BPHLS_F_loops_1000_BB_6_S_0 = 9'd10;
+parameter [8:0] BPHLS_F_loops_1000_BB_7_S_0 = 9'd11;
+parameter [8:0] BPHLS_F_loops_1000_BB_7_S_1 = 9'd12;
+parameter [8:0] BPHLS_F_loops_1000_BB_7_S_2 = 9'd13;
+parameter [8:0] BPHLS_F_loops_1000_BB_8_S_0 = 9'd14;
+parameter [8:0] BPHLS_F_loops_1000_BB_8_S_1 = 9'd15;
+parameter [8:0] BPHLS_F_loops_1000_BB_9_S_0 = 9'd16;
+parameter [8:0] BPHLS_F_loops_1000_BB_9_S_1 = 9'd17;
+parameter [8:0] BPHLS_F_loops_1000_BB_10_S_0 = 9'd18;
+parameter [8:0] BPHLS_F_loops_1000_BB_11_S_0 = 9'd19;
+parameter [8:0] BPHLS_F_loops_1000_BB_12_S_0 = 9'd20;
+parameter [8:0] BPHLS_F_loops_1000_BB_12_S_1 = 9'd21;
+parameter [8:0] BPHLS_F_loops_1000_BB_13_S_0 = 9'd22;
+parameter [8:0] BPHLS_F_loops_1000_BB_13_S_1 = 9'd23;
+parameter [8:0] BPHLS_F_loops_1000_BB_14_S_0 = 9'd24;
+parameter [8:0] BPHLS_F_loops_1000_BB_14_S_1 = 9'd25;
+parameter [8:0] BPHLS_F_loops_1000_BB_15_S_0 = 9'd26;
+parameter [8:0] BPHLS_F_loops_1000_BB_16_S_0 = 9'd27;
+parameter [8:0] BPHLS_F_loops_1000_BB_17_S_0 = 9'd28;
+parameter [8:0] BPHLS_F_loops_1000_BB_17_S_1 = 9'd29;
+parameter [8:0] BPHLS_F_loops_1000_BB_18_S_0 = 9'd30;
+parameter [8:0] BPHLS_F_loops_1000_BB_18_S_1 = 9'd31;
+parameter [8:0] BPHLS_F_loops_1000_BB_19_S_0 = 9'd32;
+parameter [8:0] BPHLS_F_loops_1000_BB_19_S_1 = 9'd33;
+parameter [8:0] BPHLS_F_loops_1000_BB_20_S_0 = 9'd34;
+parameter [8:0] BPHLS_F_loops_1000_BB_21_S_0 = 9'd35;
+parameter [8:0] BPHLS_F_loops_1000_BB_22_S_0 = 9'd36;
+parameter [8:0] BPHLS_F_loops_1000_BB_22_S_1 = 9'd37;
+parameter [8:0] BPHLS_F_loops_1000_BB_23_S_0 = 9'd38;
+parameter [8:0] BPHLS_F_loops_1000_BB_23_S_1 = 9'd39;
+parameter [8:0] BPHLS_F_loops_1000_BB_24_S_0 = 9'd40;
+parameter [8:0] BPHLS_F_loops_1000_BB_24_S_1 = 9'd41;
+parameter [8:0] BPHLS_F_loops_1000_BB_25_S_0 = 9'd42;
+parameter [8:0] BPHLS_F_loops_1000_BB_26_S_0 = 9'd43;
+parameter [8:0] BPHLS_F_loops_1000_BB_27_S_0 = 9'd44;
+parameter [8:0] BPHLS_F_loops_1000_BB_27_S_1 = 9'd45;
+parameter [8:0] BPHLS_F_loops_1000_BB_28_S_0 = 9'd46;
+parameter [8:0] BPHLS_F_loops_1000_BB_28_S_1 = 9'd47;
+parameter [8:0] BPHLS_F_loops_1000_BB_29_S_0 = 9'd48;
+parameter [8:0] BPHLS_F_loops_1000_BB_29_S_1 = 9'd49;
+parameter [8:0] BPHLS_F_loops_1000_BB_30_S_0 = 9'd50;
+parameter [8:0] BPHLS_F_loops_1000_BB_31_S_0 = 9'd51;
+parameter [8:0] BPHLS_F_loops_1000_BB_32_S_0 = 9'd52;
+parameter [8:0] BPHLS_F_loops_1000_BB_32_S_1 = 9'd53;
+parameter [8:0] BPHLS_F_loops_1000_BB_32_S_2 = 9'd54;
+parameter [8:0] BPHLS_F_loops_1000_BB_33_S_0 = 9'd55;
+parameter [8:0] BPHLS_F_loops_1000_BB_33_S_1 = 9'd56;
+parameter [8:0] BPHLS_F_loops_1000_BB_34_S_0 = 9'd57;
+parameter [8:0] BPHLS_F_loops_1000_BB_34_S_1 = 9'd58;
+parameter [8:0] BPHLS_F_loops_1000_BB_35_S_0 = 9'd59;
+parameter [8:0] BPHLS_F_loops_1000_BB_36_S_0 = 9'd60;
+parameter [8:0] BPHLS_F_loops_1000_BB_37_S_0 = 9'd61;
+parameter [8:0] BPHLS_F_loops_1000_BB_37_S_1 = 9'd62;
+parameter [8:0] BPHLS_F_loops_1000_BB_37_S_2 = 9'd63;
+parameter [8:0] BPHLS_F_loops_1000_BB_38_S_0 = 9'd64;
+parameter [8:0] BPHLS_F_loops_1000_BB_38_S_1 = 9'd65;
+parameter [8:0] BPHLS_F_loops_1000_BB_39_S_0 = 9'd66;
+parameter [8:0] BPHLS_F_loops_1000_BB_39_S_1 = 9'd67;
+parameter [8:0] BPHLS_F_loops_1000_BB_40_S_0 = 9'd68;
+parameter [8:0] BPHLS_F_loops_1000_BB_41_S_0 = 9'd69;
+parameter [8:0] BPHLS_F_loops_1000_BB_42_S_0 = 9'd70;
+parameter [8:0] BPHLS_F_loops_1000_BB_42_S_1 = 9'd71;
+parameter [8:0] BPHLS_F_loops_1000_BB_43_S_0 = 9'd72;
+parameter [8:0] BPHLS_F_loops_1000_BB_43_S_1 = 9'd73;
+parameter [8:0] BPHLS_F_loops_1000_BB_44_S_0 = 9'd74;
+parameter [8:0] BPHLS_F_loops_1000_BB_44_S_1 = 9'd75;
+parameter [8:0] BPHLS_F_loops_1000_BB_45_S_0 = 9'd76;
+parameter [8:0] BPHLS_F_loops_1000_BB_46_S_0 = 9'd77;
+parameter [8:0] BPHLS_F_loops_1000_BB_47_S_0 = 9'd78;
+parameter [8:0] BPHLS_F_loops_1000_BB_47_S_1 = 9'd79;
+parameter [8:0] BPHLS_F_loops_1000_BB_48_S_0 = 9'd80;
+parameter [8:0] BPHLS_F_loops_1000_BB_48_S_1 = 9'd81;
+parameter [8:0] BPHLS_F_loops_1000_BB_49_S_0 = 9'd82;
+parameter [8:0] BPHLS_F_loops_1000_BB_49_S_1 = 9'd83;
+parameter [8:0] BPHLS_F_loops_1000_BB_50_S_0 = 9'd84;
+parameter [8:0] BPHLS_F_loops_1000_BB_51_S_0 = 9'd85;
+parameter [8:0] BPHLS_F_loops_1000_BB_52_S_0 = 9'd86;
+parameter [8:0] BPHLS_F_loops_1000_BB_52_S_1 = 9'd87;
+parameter [8:0] BPHLS_F_loops_1000_BB_53_S_0 = 9'd88;
+parameter [8:0] BPHLS_F_loops_1000_BB_53_S_1 = 9'd89;
+parameter [8:0] BPHLS_F_loops_1000_BB_54_S_0 = 9'd90;
+parameter [8:0] BPHLS_F_loops_1000_BB_54_S_1 = 9'd91;
+parameter [8:0] BPHLS_F_loops_1000_BB_55_S_0 = 9'd92;
+parameter [8:0] BPHLS_F_loops_1000_BB_56_S_0 = 9'd93;
+parameter [8:0] BPHLS_F_loops_1000_BB_57_S_0 = 9'd94;
+parameter [8:0] BPHLS_F_loops_1000_BB_57_S_1 = 9'd95;
+parameter [8:0] BPHLS_F_loops_1000_BB_58_S_0 = 9'd96;
+parameter [8:0] BPHLS_F_loops_1000_BB_58_S_1 = 9'd97;
+parameter [8:0] BPHLS_F_loops_1000_BB_59_S_0 = 9'd98;
+parameter [8:0] BPHLS_F_loops_1000_BB_59_S_1 = 9'd99;
+parameter [8:0] BPHLS_F_loops_1000_BB_60_S_0 = 9'd100;
+parameter [8:0] BPHLS_F_loops_1000_BB_61_S_0 = 9'd101;
+parameter [8:0] BPHLS_F_loops_1000_BB_62_S_0 = 9'd102;
+parameter [8:0] BPHLS_F_loops_1000_BB_62_S_1 = 9'd103;
+parameter [8:0] BPHLS_F_loops_1000_BB_63_S_0 = 9'd104;
+parameter [8:0] BPHLS_F_loops_1000_BB_63_S_1 = 9'd105;
+parameter [8:0] BPHLS_F_loops_1000_BB_64_S_0 = 9'd106;
+parameter [8:0] BPHLS_F_loops_1000_BB_64_S_1 = 9'd107;
+parameter [8:0] BPHLS_F_loops_1000_BB_65_S_0 = 9'd108;
+parameter [8:0] BPHLS_F_loops_1000_BB_66_S_0 = 9'd109;
+parameter [8:0] BPHLS_F_loops_1000_BB_67_S_0 = 9'd110;
+parameter [8:0] BPHLS_F_loops_1000_BB_67_S_1 = 9'd111;
+parameter [8:0] BPHLS_F_loops_1000_BB_68_S_0 = 9'd112;
+parameter [8:0] BPHLS_F_loops_1000_BB_68_S_1 = 9'd113;
+parameter [8:0] BPHLS_F_loops_1000_BB_69_S_0 = 9'd114;
+parameter [8:0] BPHLS_F_loops_1000_BB_69_S_1 = 9'd115;
+parameter [8:0] BPHLS_F_loops_1000_BB_70_S_0 = 9'd116;
+parameter [8:0] BPHLS_F_loops_1000_BB_71_S_0 = 9'd117;
+parameter [8:0] BPHLS_F_loops_1000_BB_72_S_0 = 9'd118;
+parameter [8:0] BPHLS_F_loops_1000_BB_72_S_1 = 9'd119;
+parameter [8:0] BPHLS_F_loops_1000_BB_73_S_0 = 9'd120;
+parameter [8:0] BPHLS_F_loops_1000_BB_73_S_1 = 9'd121;
+parameter [8:0] BPHLS_F_loops_1000_BB_74_S_0 = 9'd122;
+parameter [8:0] BPHLS_F_loops_1000_BB_74_S_1 = 9'd123;
+parameter [8:0] BPHLS_F_loops_1000_BB_75_S_0 = 9'd124;
+parameter [8:0] BPHLS_F_loops_1000_BB_76_S_0 = 9'd125;
+parameter [8:0] BPHLS_F_loops_1000_BB_77_S_0 = 9'd126;
+parameter [8:0] BPHLS_F_loops_1000_BB_77_S_1 = 9'd127;
+parameter [8:0] BPHLS_F_loops_1000_BB_78_S_0 = 9'd128;
+parameter [8:0] BPHLS_F_loops_1000_BB_78_S_1 = 9'd129;
+parameter [8:0] BPHLS_F_loops_1000_BB_79_S_0 = 9'd130;
+parameter [8:0] BPHLS_F_loops_1000_BB_79_S_1 = 9'd131;
+parameter [8:0] BPHLS_F_loops_1000_BB_80_S_0 = 9'd132;
+parameter [8:0] BPHLS_F_loops_1000_BB_81_S_0 = 9'd133;
+parameter [8:0] BPHLS_F_loops_1000_BB_82_S_0 = 9'd134;
+parameter [8:0] BPHLS_F_loops_1000_BB_82_S_1 = 9'd135;
+parameter [8:0] BPHLS_F_loops_1000_BB_82_S_2 = 9'd136;
+parameter [8:0] BPHLS_F_loops_1000_BB_82_S_3 = 9'd137;
+parameter [8:0] BPHLS_F_loops_1000_BB_83_S_0 = 9'd138;
+parameter [8:0] BPHLS_F_loops_1000_BB_83_S_1 = 9'd139;
+parameter [8:0] BPHLS_F_loops_1000_BB_84_S_0 = 9'd140;
+parameter [8:0] BPHLS_F_loops_1000_BB_84_S_1 = 9'd141;
+parameter [8:0] BPHLS_F_loops_1000_BB_85_S_0 = 9'd142;
+parameter [8:0] BPHLS_F_loops_1000_BB_86_S_0 = 9'd143;
+parameter [8:0] BPHLS_F_loops_1000_BB_87_S_0 = 9'd144;
+parameter [8:0] BPHLS_F_loops_1000_BB_87_S_1 = 9'd145;
+parameter [8:0] BPHLS_F_loops_1000_BB_88_S_0 = 9'd146;
+parameter [8:0] BPHLS_F_loops_1000_BB_88_S_1 = 9'd147;
+parameter [8:0] BPHLS_F_loops_1000_BB_89_S_0 = 9'd148;
+parameter [8:0] BPHLS_F_loops_1000_BB_89_S_1 = 9'd149;
+parameter [8:0] BPHLS_F_loops_1000_BB_90_S_0 = 9'd150;
+parameter [8:0] BPHLS_F_loops_1000_BB_91_S_0 = 9'd151;
+parameter [8:0] BPHLS_F_loops_1000_BB_92_S_0 = 9'd152;
+parameter [8:0] BPHLS_F_loops_1000_BB_92_S_1 = 9'd153;
+parameter [8:0] BPHLS_F_loops_1000_BB_93_S_0 = 9'd154;
+parameter [8:0] BPHLS_F_loops_1000_BB_93_S_1 = 9'd155;
+parameter [8:0] BPHLS_F_loops_1000_BB_94_S_0 = 9'd156;
+parameter [8:0] BPHLS_F_loops_1000_BB_94_S_1 = 9'd157;
+parameter [8:0] BPHLS_F_loops_1000_BB_95_S_0 = 9'd158;
+parameter [8:0] BPHLS_F_loops_1000_BB_96_S_0 = 9'd159;
+parameter [8:0] BPHLS_F_loops_1000_BB_97_S_0 = 9'd160;
+parameter [8:0] BPHLS_F_loops_1000_BB_97_S_1 = 9'd161;
+parameter [8:0] BPHLS_F_loops_1000_BB_98_S_0 = 9'd162;
+parameter [8:0] BPHLS_F_loops_1000_BB_98_S_1 = 9'd163;
+parameter [8:0] BPHLS_F_loops_1000_BB_99_S_0 = 9'd164;
+parameter [8:0] BPHLS_F_loops_1000_BB_99_S_1 = 9'd165;
+parameter [8:0] BPHLS_F_loops_1000_BB_100_S_0 = 9'd166;
+parameter [8:0] BPHLS_F_loops_1000_BB_101_S_0 = 9'd167;
+parameter [8:0] BPHLS_F_loops_1000_BB_102_S_0 = 9'd168;
+parameter [8:0] BPHLS_F_loops_1000_BB_102_S_1 = 9'd169;
+parameter [8:0] BPHLS_F_loops_1000_BB_103_S_0 = 9'd170;
+parameter [8:0] BPHLS_F_loops_1000_BB_103_S_1 = 9'd171;
+parameter [8:0] BPHLS_F_loops_1000_BB_104_S_0 = 9'd172;
+parameter [8:0] BPHLS_F_loops_1000_BB_104_S_1 = 9'd173;
+parameter [8:0] BPHLS_F_loops_1000_BB_105_S_0 = 9'd174;
+parameter [8:0] BPHLS_F_loops_1000_BB_106_S_0 = 9'd175;
+parameter [8:0] BPHLS_F_loops_1000_BB_107_S_0 = 9'd176;
+parameter [8:0] BPHLS_F_loops_1000_BB_107_S_1 = 9'd177;
+parameter [8:0] BPHLS_F_loops_1000_BB_108_S_0 = 9'd178;
+parameter [8:0] BPHLS_F_loops_1000_BB_108_S_1 = 9'd179;
+parameter [8:0] BPHLS_F_loops_1000_BB_109_S_0 = 9'd180;
+parameter [8:0] BPHLS_F_loops_1000_BB_109_S_1 = 9'd181;
+parameter [8:0] BPHLS_F_loops_1000_BB_110_S_0 = 9'd182;
+parameter [8:0] BPHLS_F_loops_1000_BB_111_S_0 = 9'd183;
+parameter [8:0] BPHLS_F_loops_1000_BB_112_S_0 = 9'd184;
+parameter [8:0] BPHLS_F_loops_1000_BB_112_S_1 = 9'd185;
+parameter [8:0] BPHLS_F_loops_1000_BB_113_S_0 = 9'd186;
+parameter [8:0] BPHLS_F_loops_1000_BB_113_S_1 = 9'd187;
+parameter [8:0] BPHLS_F_loops_1000_BB_114_S_0 = 9'd188;
+parameter [8:0] BPHLS_F_loops_1000_BB_114_S_1 = 9'd189;
+parameter [8:0] BPHLS_F_loops_1000_BB_115_S_0 = 9'd190;
+parameter [8:0] BPHLS_F_loops_1000_BB_116_S_0 = 9'd191;
+parameter [8:0] BPHLS_F_loops_1000_BB_117_S_0 = 9'd192;
+parameter [8:0] BPHLS_F_loops_1000_BB_117_S_1 = 9'd193;
+parameter [8:0] BPHLS_F_loops_1000_BB_118_S_0 = 9'd194;
+parameter [8:0] BPHLS_F_loops_1000_BB_118_S_1 = 9'd195;
+parameter [8:0] BPHLS_F_loops_1000_BB_119_S_0 = 9'd196;
+parameter [8:0] BPHLS_F_loops_1000_BB_119_S_1 = 9'd197;
+parameter [8:0] BPHLS_F_loops_1000_BB_120_S_0 = 9'd198;
+parameter [8:0] BPHLS_F_loops_1000_BB_121_S_0 = 9'd199;
+parameter [8:0] BPHLS_F_loops_1000_BB_122_S_0 = 9'd200;
+parameter [8:0] BPHLS_F_loops_1000_BB_122_S_1 = 9'd201;
+parameter [8:0] BPHLS_F_loops_1000_BB_122_S_2 = 9'd202;
+parameter [8:0] BPHLS_F_loops_1000_BB_123_S_0 = 9'd203;
+parameter [8:0] BPHLS_F_loops_1000_BB_123_S_1 = 9'd204;
+parameter [8:0] BPHLS_F_loops_1000_BB_124_S_0 = 9'd205;
+parameter [8:0] BPHLS_F_loops_1000_BB_124_S_1 = 9'd206;
+parameter [8:0] BPHLS_F_loops_1000_BB_125_S_0 = 9'd207;
+parameter [8:0] BPHLS_F_loops_1000_BB_126_S_0 = 9'd208;
+parameter [8:0] BPHLS_F_loops_1000_BB_127_S_0 = 9'd209;
+parameter [8:0] BPHLS_F_loops_1000_BB_127_S_1 = 9'd210;
+parameter [8:0] BPHLS_F_loops_1000_BB_128_S_0 = 9'd211;
+parameter [8:0] BPHLS_F_loops_1000_BB_128_S_1 = 9'd212;
+parameter [8:0] BPHLS_F_loops_1000_BB_129_S_0 = 9'd213;
+parameter [8:0] BPHLS_F_loops_1000_BB_129_S_1 = 9'd214;
+parameter [8:0] BPHLS_F_loops_1000_BB_130_S_0 = 9'd215;
+parameter [8:0] BPHLS_F_loops_1000_BB_131_S_0 = 9'd216;
+parameter [8:0] BPHLS_F_loops_1000_BB_132_S_0 = 9'd217;
+parameter [8:0] BPHLS_F_loops_1000_BB_132_S_1 = 9'd218;
+parameter [8:0] BPHLS_F_loops_1000_BB_133_S_0 = 9'd219;
+parameter [8:0] BPHLS_F_loops_1000_BB_133_S_1 = 9'd220;
+parameter [8:0] BPHLS_F_loops_1000_BB_134_S_0 = 9'd221;
+parameter [8:0] BPHLS_F_loops_1000_BB_134_S_1 = 9'd222;
+parameter [8:0] BPHLS_F_loops_1000_BB_135_S_0 = 9'd223;
+parameter [8:0] BPHLS_F_loops_1000_BB_136_S_0 = 9'd224;
+parameter [8:0] BPHLS_F_loops_1000_BB_137_S_0 = 9'd225;
+parameter [8:0] BPHLS_F_loops_1000_BB_137_S_1 = 9'd226;
+parameter [8:0] BPHLS_F_loops_1000_BB_138_S_0 = 9'd227;
+parameter [8:0] BPHLS_F_loops_1000_BB_138_S_1 = 9'd228;
+parameter [8:0] BPHLS_F_loops_1000_BB_139_S_0 = 9'd229;
+parameter [8:0] BPHLS_F_loops_1000_BB_139_S_1 = 9'd230;
+parameter [8:0] BPHLS_F_loops_1000_BB_140_S_0 = 9'd231;
+parameter [8:0] BPHLS_F_loops_1000_BB_141_S_0 = 9'd232;
+parameter [8:0] BPHLS_F_loops_1000_BB_142_S_0 = 9'd233;
+parameter [8:0] BPHLS_F_loops_1000_BB_142_S_1 = 9'd234;
+parameter [8:0] BPHLS_F_loops_1000_BB_142_S_2 = 9'd235;
+parameter [8:0] BPHLS_F_loops_1000_BB_143_S_0 = 9'd236;
+parameter [8:0] BPHLS_F_loops_1000_BB_143_S_1 = 9'd237;
+parameter [8:0] BPHLS_F_loops_1000_BB_144_S_0 = 9'd238;
+parameter [8:0] BPHLS_F_loops_1000_BB_144_S_1 = 9'd239;
+parameter [8:0] BPHLS_F_loops_1000_BB_145_S_0 = 9'd240;
+parameter [8:0] BPHLS_F_loops_1000_BB_146_S_0 = 9'd241;
+parameter [8:0] BPHLS_F_loops_1000_BB_147_S_0 = 9'd242;
+parameter [8:0] BPHLS_F_loops_1000_BB_147_S_1 = 9'd243;
+parameter [8:0] BPHLS_F_loops_1000_BB_148_S_0 = 9'd244;
+parameter [8:0] BPHLS_F_loops_1000_BB_148_S_1 = 9'd245;
+parameter [8:0] BPHLS_F_loops_1000_BB_149_S_0 = 9'd246;
+parameter [8:0] BPHLS_F_loops_1000_BB_149_S_1 = 9'd247;
+parameter [8:0] BPHLS_F_loops_1000_BB_150_S_0 = 9'd248;
+parameter [8:0] BPHLS_F_loops_1000_BB_151_S_0 = 9'd249;
+parameter [8:0] BPHLS_F_loops_1000_BB_152_S_0 = 9'd250;
+parameter [8:0] BPHLS_F_loops_1000_BB_152_S_1 = 9'd251;
+parameter [8:0] BPHLS_F_loops_1000_BB_153_S_0 = 9'd252;
+parameter [8:0] BPHLS_F_loops_1000_BB_153_S_1 = 9'd253;
+parameter [8:0] BPHLS_F_loops_1000_BB_154_S_0 = 9'd254;
+parameter [8:0] BPHLS_F_loops_1000_BB_154_S_1 = 9'd255;
+parameter [8:0] BPHLS_F_loops_1000_BB_155_S_0 = 9'd256;
+parameter [8:0] BPHLS_F_loops_1000_BB_156_S_0 = 9'd257;
+parameter [8:0] BPHLS_F_loops_1000_BB_157_S_0 = 9'd258;
+parameter [8:0] BPHLS_F_loops_1000_BB_157_S_1 = 9'd259;
+parameter [8:0] BPHLS_F_loops_1000_BB_158_S_0 = 9'd260;
+parameter [8:0] BPHLS_F_loops_1000_BB_158_S_1 = 9'd261;
+parameter [8:0] BPHLS_F_loops_1000_BB_159_S_0 = 9'd262;
+parameter [8:0] BPHLS_F_loops_1000_BB_159_S_1 = 9'd263;
+parameter [8:0] BPHLS_F_loops_1000_BB_160_S_0 = 9'd264;
+parameter [8:0] BPHLS_F_loops_1000_BB_161_S_0 = 9'd265;
+parameter [8:0] BPHLS_F_loops_1000_BB_162_S_0 = 9'd266;
+parameter [8:0] BPHLS_F_loops_1000_BB_162_S_1 = 9'd267;
+parameter [8:0] BPHLS_F_loops_1000_BB_163_S_0 = 9'd268;
+parameter [8:0] BPHLS_F_loops_1000_BB_163_S_1 = 9'd269;
+parameter [8:0] BPHLS_F_loops_1000_BB_164_S_0 = 9'd270;
+parameter [8:0] BPHLS_F_loops_1000_BB_164_S_1 = 9'd271;
+parameter [8:0] BPHLS_F_loops_1000_BB_165_S_0 = 9'd272;
+parameter [8:0] BPHLS_F_loops_1000_BB_166_S_0 = 9'd273;
+parameter [8:0] BPHLS_F_loops_1000_BB_167_S_0 = 9'd274;
+parameter [8:0] BPHLS_F_loops_1000_BB_167_S_1 = 9'd275;
+parameter [8:0] BPHLS_F_loops_1000_BB_168_S_0 = 9'd276;
+parameter [8:0] BPHLS_F_loops_1000_BB_168_S_1 = 9'd277;
+parameter [8:0] BPHLS_F_loops_1000_BB_169_S_0 = 9'd278;
+parameter [8:0] BPHLS_F_loops_1000_BB_169_S_1 = 9'd279;
+parameter [8:0] BPHLS_F_loops_1000_BB_170_S_0 = 9'd280;
+parameter [8:0] BPHLS_F_loops_1000_BB_171_S_0 = 9'd281;
+parameter [8:0] BPHLS_F_loops_1000_BB_172_S_0 = 9'd282;
+parameter [8:0] BPHLS_F_loops_1000_BB_172_S_1 = 9'd283;
+parameter [8:0] BPHLS_F_loops_1000_BB_173_S_0 = 9'd284;
+parameter [8:0] BPHLS_F_loops_1000_BB_173_S_1 = 9'd285;
+parameter [8:0] BPHLS_F_loops_1000_BB_174_S_0 = 9'd286;
+parameter [8:0] BPHLS_F_loops_1000_BB_174_S_1 = 9'd287;
+parameter [8:0] BPHLS_F_loops_1000_BB_175_S_0 = 9'd288;
+parameter [8:0] BPHLS_F_loops_1000_BB_176_S_0 = 9'd289;
+parameter [8:0] BPHLS_F_loops_1000_BB_177_S_0 = 9'd290;
+parameter [8:0] BPHLS_F_loops_1000_BB_177_S_1 = 9'd291;
+parameter [8:0] BPHLS_F_loops_1000_BB_178_S_0 = 9'd292;
+parameter [8:0] BPHLS_F_loops_1000_BB_178_S_1 = 9'd293;
+parameter [8:0] BPHLS_F_loops_1000_BB_179_S_0 = 9'd294;
+parameter [8:0] BPHLS_F_loops_1000_BB_179_S_1 = 9'd295;
+parameter [8:0] BPHLS_F_loops_1000_BB_180_S_0 = 9'd296;
+parameter [8:0] BPHLS_F_loops_1000_BB_181_S_0 = 9'd297;
+parameter [8:0] BPHLS_F_loops_1000_BB_182_S_0 = 9'd298;
+parameter [8:0] BPHLS_F_loops_1000_BB_182_S_1 = 9'd299;
+parameter [8:0] BPHLS_F_loops_1000_BB_183_S_0 = 9'd300;
+parameter [8:0] BPHLS_F_loops_1000_BB_183_S_1 = 9'd301;
+parameter [8:0] BPHLS_F_loops_1000_BB_184_S_0 = 9'd302;
+parameter [8:0] BPHLS_F_loops_1000_BB_184_S_1 = 9'd303;
+parameter [8:0] BPHLS_F_loops_1000_BB_185_S_0 = 9'd304;
+parameter [8:0] BPHLS_F_loops_1000_BB_186_S_0 = 9'd305;
+parameter [8:0] BPHLS_F_loops_1000_BB_187_S_0 = 9'd306;
+parameter [8:0] BPHLS_F_loops_1000_BB_187_S_1 = 9'd307;
+parameter [8:0] BPHLS_F_loops_1000_BB_187_S_2 = 9'd308;
+parameter [8:0] BPHLS_F_loops_1000_BB_188_S_0 = 9'd309;
+parameter [8:0] BPHLS_F_loops_1000_BB_188_S_1 = 9'd310;
+parameter [8:0] BPHLS_F_loops_1000_BB_189_S_0 = 9'd311;
+parameter [8:0] BPHLS_F_loops_1000_BB_189_S_1 = 9'd312;
+parameter [8:0] BPHLS_F_loops_1000_BB_190_S_0 = 9'd313;
+parameter [8:0] BPHLS_F_loops_1000_BB_191_S_0 = 9'd314;
+parameter [8:0] BPHLS_F_loops_1000_BB_192_S_0 = 9'd315;
+parameter [8:0] BPHLS_F_loops_1000_BB_192_S_1 = 9'd316;
+parameter [8:0] BPHLS_F_loops_1000_BB_193_S_0 = 9'd317;
+parameter [8:0] BPHLS_F_loops_1000_BB_193_S_1 = 9'd318;
+parameter [8:0] BPHLS_F_loops_1000_BB_194_S_0 = 9'd319;
+parameter [8:0] BPHLS_F_loops_1000_BB_194_S_1 = 9'd320;
+parameter [8:0] BPHLS_F_loops_1000_BB_195_S_0 = 9'd321;
+parameter [8:0] BPHLS_F_loops_1000_BB_196_S_0 = 9'd322;
+parameter [8:0] BPHLS_F_loops_1000_BB_197_S_0 = 9'd323;
+parameter [8:0] BPHLS_F_loops_1000_BB_197_S_1 = 9'd324;
+parameter [8:0] BPHLS_F_loops_1000_BB_198_S_0 = 9'd325;
+parameter [8:0] BPHLS_F_loops_1000_BB_198_S_1 = 9'd326;
+parameter [8:0] BPHLS_F_loops_1000_BB_199_S_0 = 9'd327;
+parameter [8:0] BPHLS_F_loops_1000_BB_199_S_1 = 9'd328;
+parameter [8:0] BPHLS_F_loops_1000_BB_200_S_0 = 9'd329;
+
+reg [8:0] cur_state;
+reg [8:0] next_state;
+wire [1:0] loops_1000_loop0_8;
+reg [1:0] loops_1000_loop0_8_reg;
+wire [63:0] loops_1000_loop0_9;
+reg [63:0] loops_1000_loop0_9_reg;
+wire [1:0] loops_1000_loop1_10;
+reg [1:0] loops_1000_loop1_10_reg;
+wire [63:0] loops_1000_loop1_11;
+reg [63:0] loops_1000_loop1_11_reg;
+wire [1:0] loops_1000_loop2_12;
+reg [1:0] loops_1000_loop2_12_reg;
+wire [63:0] loops_1000_loop2_13;
+reg [63:0] loops_1000_loop2_13_reg;
+reg [15:0] loops_1000_loop2_14;
+reg [88:0] bp_reg_0;
+reg [15:0] loops_1000_loop2_14_reg;
+reg [31:0] loops_1000_loop2_15;
+reg [255:0] bp_reg_1;
+reg [31:0] loops_1000_loop2_15_reg;
+reg [7:0] loops_1000_loop2_17;
+reg [7:0] loops_1000_loop2_17_reg;
+reg [7:0] loops_1000_loop2_18;
+reg [7:0] loops_1000_loop2_18_reg;
+reg [31:0] loops_1000_loop2_19;
+reg [31:0] loops_1000_loop2_19_reg;
+reg [15:0] loops_1000_loop2_20;
+reg [15:0] loops_1000_loop2_20_reg;
+reg [7:0] loops_1000_loop2_21;
+reg [7:0] loops_1000_loop2_21_reg;
+reg [63:0] loops_1000_loop2_22;
+reg [63:0] loops_1000_loop2_22_reg;
+reg [31:0] loops_1000_loop2_23;
+reg [2:0] loops_1000_loop2_23_reg;
+reg  loops_1000_loop2_24;
+reg  loops_1000_loop2_24_reg;
+reg [31:0] loops_1000_exit2_25;
+reg [2:0] loops_1000_exit2_25_reg;
+reg  loops_1000_exit2_26;
+reg  loops_1000_exit2_26_reg;
+reg [31:0] loops_1000_exit1_27;
+reg [2:0] loops_1000_exit1_27_reg;
+reg  loops_1000_exit1_28;
+reg  loops_1000_exit1_28_reg;
+wire [1:0] loops_1000_loop01_29;
+reg [1:0] loops_1000_loop01_29_reg;
+wire [63:0] loops_1000_loop01_30;
+reg [63:0] loops_1000_loop01_30_reg;
+wire [1:0] loops_1000_loop12_31;
+reg [1:0] loops_1000_loop12_31_reg;
+wire [63:0] loops_1000_loop12_32;
+reg [63:0] loops_1000_loop12_32_reg;
+wire [1:0] loops_1000_loop23_33;
+reg [1:0] loops_1000_loop23_33_reg;
+wire [63:0] loops_1000_loop23_34;
+reg [63:0] loops_1000_loop23_34_reg;
+reg [15:0] loops_1000_loop23_35;
+reg [15:0] loops_1000_loop23_35_reg;
+reg [63:0] loops_1000_loop23_36;
+reg [63:0] loops_1000_loop23_36_reg;
+reg [15:0] loops_1000_loop23_38;
+reg [15:0] loops_1000_loop23_38_reg;
+reg [7:0] loops_1000_loop23_39;
+reg [7:0] loops_1000_loop23_39_reg;
+reg [63:0] loops_1000_loop23_40;
+reg [63:0] loops_1000_loop23_40_reg;
+reg [7:0] loops_1000_loop23_41;
+reg [7:0] loops_1000_loop23_41_reg;
+reg [7:0] loops_1000_loop23_42;
+reg [7:0] bp_reg_10;
+reg [7:0] loops_1000_loop23_42_reg;
+reg [63:0] loops_1000_loop23_43;
+reg [63:0] loops_1000_loop23_43_reg;
+reg [31:0] loops_1000_loop23_44;
+reg [2:0] loops_1000_loop23_44_reg;
+reg  loops_1000_loop23_45;
+reg  loops_1000_loop23_45_reg;
+reg [31:0] loops_1000_exit24_46;
+reg [2:0] loops_1000_exit24_46_reg;
+reg  loops_1000_exit24_47;
+reg  loops_1000_exit24_47_reg;
+reg [31:0] loops_1000_exit15_48;
+reg [2:0] loops_1000_exit15_48_reg;
+reg  loops_1000_exit15_49;
+reg  loops_1000_exit15_49_reg;
+wire [1:0] loops_1000_loop07_50;
+reg [1:0] loops_1000_loop07_50_reg;
+wire [63:0] loops_1000_loop07_51;
+reg [63:0] loops_1000_loop07_51_reg;
+wire [1:0] loops_1000_loop18_52;
+reg [1:0] loops_1000_loop18_52_reg;
+wire [63:0] loops_1000_loop18_53;
+reg [63:0] loops_1000_loop18_53_reg;
+wire [1:0] loops_1000_loop29_54;
+reg [1:0] loops_1000_loop29_54_reg;
+wire [63:0] loops_1000_loop29_55;
+reg [63:0] loops_1000_loop29_55_reg;
+reg [31:0] loops_1000_loop29_57;
+reg [31:0] loops_1000_loop29_57_reg;
+reg [31:0] loops_1000_loop29_58;
+reg [31:0] loops_1000_loop29_58_reg;
+reg [31:0] loops_1000_loop29_59;
+reg [31:0] loops_1000_loop29_59_reg;
+reg [63:0] loops_1000_loop29_60;
+reg [63:0] loops_1000_loop29_60_reg;
+reg [15:0] loops_1000_loop29_61;
+reg [55:0] bp_reg_4;
+reg [15:0] loops_1000_loop29_61_reg;
+reg [31:0] loops_1000_loop29_63;
+reg [31:0] loops_1000_loop29_63_reg;
+reg [63:0] loops_1000_loop29_64;
+reg [63:0] loops_1000_loop29_64_reg;
+reg [31:0] loops_1000_loop29_65;
+reg [2:0] loops_1000_loop29_65_reg;
+reg  loops_1000_loop29_66;
+reg  loops_1000_loop29_66_reg;
+reg [31:0] loops_1000_exit210_67;
+reg [2:0] loops_1000_exit210_67_reg;
+reg  loops_1000_exit210_68;
+reg  loops_1000_exit210_68_reg;
+reg [31:0] loops_1000_exit111_69;
+reg [2:0] loops_1000_exit111_69_reg;
+reg  loops_1000_exit111_70;
+reg  loops_1000_exit111_70_reg;
+wire [1:0] loops_1000_loop013_71;
+reg [1:0] loops_1000_loop013_71_reg;
+wire [63:0] loops_1000_loop013_72;
+reg [63:0] loops_1000_loop013_72_reg;
+wire [1:0] loops_1000_loop114_73;
+reg [1:0] loops_1000_loop114_73_reg;
+wire [63:0] loops_1000_loop114_74;
+reg [63:0] loops_1000_loop114_74_reg;
+wire [1:0] loops_1000_loop215_75;
+reg [1:0] loops_1000_loop215_75_reg;
+wire [63:0] loops_1000_loop215_76;
+reg [63:0] loops_1000_loop215_76_reg;
+reg [7:0] loops_1000_loop215_77;
+reg [7:0] loops_1000_loop215_77_reg;
+reg [31:0] loops_1000_loop215_79;
+reg [31:0] loops_1000_loop215_79_reg;
+reg [15:0] loops_1000_loop215_80;
+reg [15:0] loops_1000_loop215_80_reg;
+reg [63:0] loops_1000_loop215_81;
+reg [63:0] loops_1000_loop215_81_reg;
+reg [7:0] loops_1000_loop215_82;
+reg [193:0] bp_reg_2;
+reg [7:0] loops_1000_loop215_82_reg;
+reg [15:0] loops_1000_loop215_83;
+reg [15:0] loops_1000_loop215_83_reg;
+reg [31:0] loops_1000_loop215_84;
+reg [31:0] loops_1000_loop215_84_reg;
+reg [63:0] loops_1000_loop215_85;
+reg [63:0] loops_1000_loop215_85_reg;
+reg [31:0] loops_1000_loop215_86;
+reg [2:0] loops_1000_loop215_86_reg;
+reg  loops_1000_loop215_87;
+reg  loops_1000_loop215_87_reg;
+reg [31:0] loops_1000_exit216_88;
+reg [2:0] loops_1000_exit216_88_reg;
+reg  loops_1000_exit216_89;
+reg  loops_1000_exit216_89_reg;
+reg [31:0] loops_1000_exit117_90;
+reg [31:0] bp_reg_6;
+reg [2:0] loops_1000_exit117_90_reg;
+reg  loops_1000_exit117_91;
+reg  loops_1000_exit117_91_reg;
+wire [1:0] loops_1000_loop019_92;
+reg [1:0] loops_1000_loop019_92_reg;
+wire [63:0] loops_1000_loop019_93;
+reg [63:0] loops_1000_loop019_93_reg;
+wire [1:0] loops_1000_loop120_94;
+reg [1:0] loops_1000_loop120_94_reg;
+wire [63:0] loops_1000_loop120_95;
+reg [63:0] loops_1000_loop120_95_reg;
+wire [1:0] loops_1000_loop221_96;
+reg [1:0] loops_1000_loop221_96_reg;
+wire [63:0] loops_1000_loop221_97;
+reg [63:0] loops_1000_loop221_97_reg;
+reg [63:0] loops_1000_loop221_98;
+reg [63:0] loops_1000_loop221_98_reg;
+reg [63:0] loops_1000_loop221_99;
+reg [63:0] loops_1000_loop221_99_reg;
+reg [7:0] loops_1000_loop221_100;
+reg [7:0] bp_reg_11;
+reg [7:0] loops_1000_loop221_100_reg;
+reg [31:0] loops_1000_loop221_101;
+reg [31:0] loops_1000_loop221_101_reg;
+reg [7:0] loops_1000_loop221_102;
+reg [7:0] loops_1000_loop221_102_reg;
+reg [63:0] loops_1000_loop221_103;
+reg [63:0] loops_1000_loop221_103_reg;
+reg [7:0] loops_1000_loop221_104;
+reg [7:0] loops_1000_loop221_104_reg;
+reg [63:0] loops_1000_loop221_105;
+reg [63:0] loops_1000_loop221_105_reg;
+reg [63:0] loops_1000_loop221_106;
+reg [63:0] loops_1000_loop221_106_reg;
+reg [31:0] loops_1000_loop221_107;
+reg [2:0] loops_1000_loop221_107_reg;
+reg  loops_1000_loop221_108;
+reg  bp_reg_17;
+reg  loops_1000_loop221_108_reg;
+reg [31:0] loops_1000_exit222_109;
+reg [2:0] loops_1000_exit222_109_reg;
+reg  loops_1000_exit222_110;
+reg  bp_reg_18;
+reg  loops_1000_exit222_110_reg;
+reg [31:0] loops_1000_exit123_111;
+reg [2:0] loops_1000_exit123_111_reg;
+reg  loops_1000_exit123_112;
+reg  loops_1000_exit123_112_reg;
+wire [1:0] loops_1000_loop025_113;
+reg [1:0] loops_1000_loop025_113_reg;
+wire [63:0] loops_1000_loop025_114;
+reg [63:0] loops_1000_loop025_114_reg;
+wire [1:0] loops_1000_loop126_115;
+reg [1:0] loops_1000_loop126_115_reg;
+wire [63:0] loops_1000_loop126_116;
+reg [63:0] loops_1000_loop126_116_reg;
+wire [1:0] loops_1000_loop227_117;
+reg [1:0] loops_1000_loop227_117_reg;
+wire [63:0] loops_1000_loop227_118;
+reg [63:0] loops_1000_loop227_118_reg;
+reg [15:0] loops_1000_loop227_119;
+reg [15:0] loops_1000_loop227_119_reg;
+reg [7:0] loops_1000_loop227_120;
+reg [7:0] loops_1000_loop227_120_reg;
+reg [31:0] loops_1000_loop227_121;
+reg [31:0] loops_1000_loop227_121_reg;
+reg [63:0] loops_1000_loop227_122;
+reg [63:0] loops_1000_loop227_122_reg;
+reg [63:0] loops_1000_loop227_124;
+reg [63:0] loops_1000_loop227_124_reg;
+reg [31:0] loops_1000_loop227_125;
+reg [31:0] loops_1000_loop227_125_reg;
+reg [15:0] loops_1000_loop227_126;
+reg [15:0] loops_1000_loop227_126_reg;
+reg [63:0] loops_1000_loop227_127;
+reg [63:0] loops_1000_loop227_127_reg;
+reg [31:0] loops_1000_loop227_128;
+reg [2:0] loops_1000_loop227_128_reg;
+reg  loops_1000_loop227_129;
+reg  loops_1000_loop227_129_reg;
+reg [31:0] loops_1000_exit228_130;
+reg [2:0] loops_1000_exit228_130_reg;
+reg  loops_1000_exit228_131;
+reg  loops_1000_exit228_131_reg;
+reg [31:0] loops_1000_exit129_132;
+reg [88:0] bp_reg_3;
+reg [2:0] loops_1000_exit129_132_reg;
+reg  loops_1000_exit129_133;
+reg  loops_1000_exit129_133_reg;
+wire [1:0] loops_1000_loop031_134;
+reg [1:0] loops_1000_loop031_134_reg;
+wire [63:0] loops_1000_loop031_135;
+reg [63:0] loops_1000_loop031_135_reg;
+wire [1:0] loops_1000_loop132_136;
+reg [1:0] loops_1000_loop132_136_reg;
+wire [63:0] loops_1000_loop132_137;
+reg [63:0] loops_1000_loop132_137_reg;
+wire [1:0] loops_1000_loop233_138;
+reg [1:0] loops_1000_loop233_138_reg;
+wire [63:0] loops_1000_loop233_139;
+reg [63:0] loops_1000_loop233_139_reg;
+reg [7:0] loops_1000_loop233_140;
+reg [7:0] loops_1000_loop233_140_reg;
+reg [63:0] loops_1000_loop233_141;
+reg [63:0] loops_1000_loop233_141_reg;
+reg [15:0] loops_1000_loop233_142;
+reg [15:0] loops_1000_loop233_142_reg;
+reg [7:0] loops_1000_loop233_143;
+reg [7:0] loops_1000_loop233_143_reg;
+reg [31:0] loops_1000_loop233_145;
+reg [31:0] loops_1000_loop233_145_reg;
+reg [7:0] loops_1000_loop233_146;
+reg [7:0] loops_1000_loop233_146_reg;
+reg [31:0] loops_1000_loop233_147;
+reg [31:0] loops_1000_loop233_147_reg;
+reg [63:0] loops_1000_loop233_148;
+reg [63:0] loops_1000_loop233_148_reg;
+reg [31:0] loops_1000_loop233_149;
+reg [2:0] loops_1000_loop233_149_reg;
+reg  loops_1000_loop233_150;
+reg  loops_1000_loop233_150_reg;
+reg [31:0] loops_1000_exit234_151;
+reg [2:0] loops_1000_exit234_151_reg;
+reg  loops_1000_exit234_152;
+reg  loops_1000_exit234_152_reg;
+reg [31:0] loops_1000_exit135_153;
+reg [2:0] loops_1000_exit135_153_reg;
+reg  loops_1000_exit135_154;
+reg  loops_1000_exit135_154_reg;
+wire [1:0] loops_1000_loop037_155;
+reg [1:0] loops_1000_loop037_155_reg;
+wire [63:0] loops_1000_loop037_156;
+reg [63:0] loops_1000_loop037_156_reg;
+wire [1:0] loops_1000_loop138_157;
+reg [1:0] loops_1000_loop138_157_reg;
+wire [63:0] loops_1000_loop138_158;
+reg [63:0] loops_1000_loop138_158_reg;
+wire [1:0] loops_1000_loop239_159;
+reg [1:0] loops_1000_loop239_159_reg;
+wire [63:0] loops_1000_loop239_160;
+reg [63:0] loops_1000_loop239_160_reg;
+reg [31:0] loops_1000_loop239_161;
+reg [31:0] loops_1000_loop239_161_reg;
+reg [31:0] loops_1000_loop239_162;
+reg [31:0] loops_1000_loop239_162_reg;
+reg [7:0] loops_1000_loop239_164;
+reg [7:0] loops_1000_loop239_164_reg;
+reg [31:0] loops_1000_loop239_165;
+reg [31:0] loops_1000_loop239_165_reg;
+reg [31:0] loops_1000_loop239_166;
+reg [31:0] loops_1000_loop239_166_reg;
+reg [63:0] loops_1000_loop239_168;
+reg [63:0] loops_1000_loop239_168_reg;
+reg [63:0] loops_1000_loop239_169;
+reg [63:0] loops_1000_loop239_169_reg;
+reg [31:0] loops_1000_loop239_170;
+reg [2:0] loops_1000_loop239_170_reg;
+reg  loops_1000_loop239_171;
+reg  loops_1000_loop239_171_reg;
+reg [31:0] loops_1000_exit240_172;
+reg [2:0] loops_1000_exit240_172_reg;
+reg  loops_1000_exit240_173;
+reg  loops_1000_exit240_173_reg;
+reg [31:0] loops_1000_exit141_174;
+reg [2:0] loops_1000_exit141_174_reg;
+reg  loops_1000_exit141_175;
+reg  loops_1000_exit141_175_reg;
+wire [1:0] loops_1000_loop043_176;
+reg [1:0] loops_1000_loop043_176_reg;
+wire [63:0] loops_1000_loop043_177;
+reg [63:0] loops_1000_loop043_177_reg;
+wire [1:0] loops_1000_loop144_178;
+reg [1:0] loops_1000_loop144_178_reg;
+wire [63:0] loops_1000_loop144_179;
+reg [63:0] loops_1000_loop144_179_reg;
+wire [1:0] loops_1000_loop245_180;
+reg [1:0] loops_1000_loop245_180_reg;
+wire [63:0] loops_1000_loop245_181;
+reg [63:0] loops_1000_loop245_181_reg;
+reg [15:0] loops_1000_loop245_182;
+reg [15:0] loops_1000_loop245_182_reg;
+reg [15:0] loops_1000_loop245_183;
+reg [15:0] loops_1000_loop245_183_reg;
+reg [15:0] loops_1000_loop245_184;
+reg [15:0] loops_1000_loop245_184_reg;
+reg [7:0] loops_1000_loop245_185;
+reg [7:0] bp_reg_12;
+reg [7:0] loops_1000_loop245_185_reg;
+reg [31:0] loops_1000_loop245_186;
+reg [31:0] bp_reg_5;
+reg [31:0] loops_1000_loop245_186_reg;
+reg [31:0] loops_1000_loop245_187;
+reg [31:0] loops_1000_loop245_187_reg;
+reg [15:0] loops_1000_loop245_188;
+reg [15:0] loops_1000_loop245_188_reg;
+reg [15:0] loops_1000_loop245_189;
+reg [15:0] loops_1000_loop245_189_reg;
+reg [63:0] loops_1000_loop245_190;
+reg [63:0] loops_1000_loop245_190_reg;
+reg [31:0] loops_1000_loop245_191;
+reg [2:0] loops_1000_loop245_191_reg;
+reg  loops_1000_loop245_192;
+reg  loops_1000_loop245_192_reg;
+reg [31:0] loops_1000_exit246_193;
+reg [2:0] loops_1000_exit246_193_reg;
+reg  loops_1000_exit246_194;
+reg  loops_1000_exit246_194_reg;
+reg [31:0] loops_1000_exit147_195;
+reg [2:0] loops_1000_exit147_195_reg;
+reg  loops_1000_exit147_196;
+reg  loops_1000_exit147_196_reg;
+wire [1:0] loops_1000_loop049_197;
+reg [1:0] loops_1000_loop049_197_reg;
+wire [63:0] loops_1000_loop049_198;
+reg [63:0] loops_1000_loop049_198_reg;
+wire [1:0] loops_1000_loop150_199;
+reg [1:0] loops_1000_loop150_199_reg;
+wire [63:0] loops_1000_loop150_200;
+reg [63:0] loops_1000_loop150_200_reg;
+wire [1:0] loops_1000_loop251_201;
+reg [1:0] loops_1000_loop251_201_reg;
+wire [63:0] loops_1000_loop251_202;
+reg [63:0] loops_1000_loop251_202_reg;
+reg [15:0] loops_1000_loop251_204;
+reg [15:0] loops_1000_loop251_204_reg;
+reg [15:0] loops_1000_loop251_205;
+reg [15:0] loops_1000_loop251_205_reg;
+reg [7:0] loops_1000_loop251_206;
+reg  loops_1000_loop251_206_reg;
+reg [63:0] loops_1000_loop251_207;
+reg [63:0] loops_1000_loop251_207_reg;
+reg [15:0] loops_1000_loop251_208;
+reg [15:0] loops_1000_loop251_208_reg;
+reg [7:0] loops_1000_loop251_210;
+reg [18:0] bp_reg_9;
+reg [7:0] loops_1000_loop251_210_reg;
+reg [63:0] loops_1000_loop251_211;
+reg [63:0] loops_1000_loop251_211_reg;
+reg [31:0] loops_1000_loop251_212;
+reg [2:0] loops_1000_loop251_212_reg;
+reg  loops_1000_loop251_213;
+reg  loops_1000_loop251_213_reg;
+reg [31:0] loops_1000_exit252_214;
+reg [2:0] loops_1000_exit252_214_reg;
+reg  loops_1000_exit252_215;
+reg  loops_1000_exit252_215_reg;
+reg [31:0] loops_1000_exit153_216;
+reg [10:0] bp_reg_13;
+reg [2:0] loops_1000_exit153_216_reg;
+reg  loops_1000_exit153_217;
+reg  loops_1000_exit153_217_reg;
+wire [1:0] loops_1000_loop055_218;
+reg [1:0] loops_1000_loop055_218_reg;
+wire [63:0] loops_1000_loop055_219;
+reg [63:0] loops_1000_loop055_219_reg;
+wire [1:0] loops_1000_loop156_220;
+reg [1:0] loops_1000_loop156_220_reg;
+wire [63:0] loops_1000_loop156_221;
+reg [63:0] loops_1000_loop156_221_reg;
+wire [1:0] loops_1000_loop257_222;
+reg [1:0] loops_1000_loop257_222_reg;
+wire [63:0] loops_1000_loop257_223;
+reg [63:0] loops_1000_loop257_223_reg;
+reg [15:0] loops_1000_loop257_224;
+reg [15:0] loops_1000_loop257_224_reg;
+reg [63:0] loops_1000_loop257_225;
+reg [63:0] loops_1000_loop257_225_reg;
+reg [31:0] loops_1000_loop257_226;
+reg [31:0] loops_1000_loop257_226_reg;
+reg [15:0] loops_1000_loop257_229;
+reg [15:0] loops_1000_loop257_229_reg;
+reg [31:0] loops_1000_loop257_230;
+reg [31:0] loops_1000_loop257_230_reg;
+reg [63:0] loops_1000_loop257_231;
+reg [63:0] loops_1000_loop257_231_reg;
+reg [63:0] loops_1000_loop257_232;
+reg [63:0] loops_1000_loop257_232_reg;
+reg [31:0] loops_1000_loop257_233;
+reg [2:0] loops_1000_loop257_233_reg;
+reg  loops_1000_loop257_234;
+reg [7:0] bp_reg_15;
+reg  loops_1000_loop257_234_reg;
+reg [31:0] loops_1000_exit258_235;
+reg [2:0] loops_1000_exit258_235_reg;
+reg  loops_1000_exit258_236;
+reg  loops_1000_exit258_236_reg;
+reg [31:0] loops_1000_exit159_237;
+reg [2:0] loops_1000_exit159_237_reg;
+reg  loops_1000_exit159_238;
+reg  loops_1000_exit159_238_reg;
+wire [1:0] loops_1000_loop061_239;
+reg [1:0] loops_1000_loop061_239_reg;
+wire [63:0] loops_1000_loop061_240;
+reg [63:0] loops_1000_loop061_240_reg;
+wire [1:0] loops_1000_loop162_241;
+reg [1:0] loops_1000_loop162_241_reg;
+wire [63:0] loops_1000_loop162_242;
+reg [63:0] loops_1000_loop162_242_reg;
+wire [1:0] loops_1000_loop263_243;
+reg [1:0] loops_1000_loop263_243_reg;
+wire [63:0] loops_1000_loop263_244;
+reg [63:0] loops_1000_loop263_244_reg;
+reg [15:0] loops_1000_loop263_248;
+reg [15:0] loops_1000_loop263_248_reg;
+reg [7:0] loops_1000_loop263_249;
+reg [7:0] loops_1000_loop263_249_reg;
+reg [15:0] loops_1000_loop263_250;
+reg [15:0] loops_1000_loop263_250_reg;
+reg [7:0] loops_1000_loop263_252;
+reg [7:0] loops_1000_loop263_252_reg;
+reg [63:0] loops_1000_loop263_253;
+reg [63:0] loops_1000_loop263_253_reg;
+reg [31:0] loops_1000_loop263_254;
+reg [2:0] loops_1000_loop263_254_reg;
+reg  loops_1000_loop263_255;
+reg  loops_1000_loop263_255_reg;
+reg [31:0] loops_1000_exit264_256;
+reg [2:0] loops_1000_exit264_256_reg;
+reg  loops_1000_exit264_257;
+reg  loops_1000_exit264_257_reg;
+reg [31:0] loops_1000_exit165_258;
+reg [7:0] loops_1000_exit165_258_reg;
+reg  loops_1000_exit165_259;
+reg  loops_1000_exit165_259_reg;
+wire [1:0] loops_1000_loop067_260;
+reg [1:0] loops_1000_loop067_260_reg;
+wire [63:0] loops_1000_loop067_261;
+reg [63:0] loops_1000_loop067_261_reg;
+wire [1:0] loops_1000_loop168_262;
+reg [1:0] loops_1000_loop168_262_reg;
+wire [63:0] loops_1000_loop168_263;
+reg [63:0] loops_1000_loop168_263_reg;
+wire [1:0] loops_1000_loop269_264;
+reg [1:0] loops_1000_loop269_264_reg;
+wire [63:0] loops_1000_loop269_265;
+reg [63:0] loops_1000_loop269_265_reg;
+reg [7:0] loops_1000_loop269_266;
+reg [7:0] loops_1000_loop269_266_reg;
+reg [31:0] loops_1000_loop269_267;
+reg [31:0] loops_1000_loop269_267_reg;
+reg [15:0] loops_1000_loop269_268;
+reg [15:0] loops_1000_loop269_268_reg;
+reg [7:0] loops_1000_loop269_269;
+reg [7:0] loops_1000_loop269_269_reg;
+reg [31:0] loops_1000_loop269_270;
+reg [31:0] loops_1000_loop269_270_reg;
+reg [15:0] loops_1000_loop269_271;
+reg [15:0] loops_1000_loop269_271_reg;
+reg [31:0] loops_1000_loop269_272;
+reg [31:0] loops_1000_loop269_272_reg;
+reg [31:0] loops_1000_loop269_273;
+reg [31:0] loops_1000_loop269_273_reg;
+reg [63:0] loops_1000_loop269_274;
+reg [63:0] loops_1000_loop269_274_reg;
+reg [31:0] loops_1000_loop269_275;
+reg [2:0] loops_1000_loop269_275_reg;
+reg  loops_1000_loop269_276;
+reg  loops_1000_loop269_276_reg;
+reg [31:0] loops_1000_exit270_277;
+reg [2:0] loops_1000_exit270_277_reg;
+reg  loops_1000_exit270_278;
+reg  loops_1000_exit270_278_reg;
+reg [31:0] loops_1000_exit171_279;
+reg [2:0] loops_1000_exit171_279_reg;
+reg  loops_1000_exit171_280;
+reg  loops_1000_exit171_280_reg;
+wire [1:0] loops_1000_loop073_281;
+reg [1:0] loops_1000_loop073_281_reg;
+wire [63:0] loops_1000_loop073_282;
+reg [63:0] loops_1000_loop073_282_reg;
+wire [1:0] loops_1000_loop174_283;
+reg [1:0] loops_1000_loop174_283_reg;
+wire [63:0] loops_1000_loop174_284;
+reg [63:0] loops_1000_loop174_284_reg;
+wire [1:0] loops_1000_loop275_285;
+reg [1:0] loops_1000_loop275_285_reg;
+wire [63:0] loops_1000_loop275_286;
+reg [63:0] loops_1000_loop275_286_reg;
+reg [15:0] loops_1000_loop275_287;
+reg [15:0] loops_1000_loop275_287_reg;
+reg [7:0] loops_1000_loop275_289;
+reg [7:0] loops_1000_loop275_289_reg;
+reg [15:0] loops_1000_loop275_290;
+reg [15:0] loops_1000_loop275_290_reg;
+reg [15:0] loops_1000_loop275_291;
+reg [15:0] loops_1000_loop275_291_reg;
+reg [15:0] loops_1000_loop275_292;
+reg [15:0] loops_1000_loop275_292_reg;
+reg [7:0] loops_1000_loop275_293;
+reg [7:0] loops_1000_loop275_293_reg;
+reg [31:0] loops_1000_loop275_294;
+reg [31:0] loops_1000_loop275_294_reg;
+reg [63:0] loops_1000_loop275_295;
+reg [63:0] loops_1000_loop275_295_reg;
+reg [31:0] loops_1000_loop275_296;
+reg [2:0] loops_1000_loop275_296_reg;
+reg  loops_1000_loop275_297;
+reg  loops_1000_loop275_297_reg;
+reg [31:0] loops_1000_exit276_298;
+reg [2:0] loops_1000_exit276_298_reg;
+reg  loops_1000_exit276_299;
+reg  loops_1000_exit276_299_reg;
+reg [31:0] loops_1000_exit177_300;
+reg [2:0] loops_1000_exit177_300_reg;
+reg  loops_1000_exit177_301;
+reg  loops_1000_exit177_301_reg;
+wire [1:0] loops_1000_loop079_302;
+reg [1:0] loops_1000_loop079_302_reg;
+wire [63:0] loops_1000_loop079_303;
+reg [63:0] loops_1000_loop079_303_reg;
+wire [1:0] loops_1000_loop180_304;
+reg [1:0] loops_1000_loop180_304_reg;
+wire [63:0] loops_1000_loop180_305;
+reg [63:0] loops_1000_loop180_305_reg;
+wire [1:0] loops_1000_loop281_306;
+reg [1:0] loops_1000_loop281_306_reg;
+wire [63:0] loops_1000_loop281_307;
+reg [63:0] loops_1000_loop281_307_reg;
+reg [7:0] loops_1000_loop281_308;
+reg [7:0] loops_1000_loop281_308_reg;
+reg [7:0] loops_1000_loop281_309;
+reg [7:0] loops_1000_loop281_309_reg;
+reg [15:0] loops_1000_loop281_311;
+reg [15:0] loops_1000_loop281_311_reg;
+reg [15:0] loops_1000_loop281_312;
+reg [15:0] loops_1000_loop281_312_reg;
+reg [7:0] loops_1000_loop281_313;
+reg [7:0] loops_1000_loop281_313_reg;
+reg [7:0] loops_1000_loop281_314;
+reg [7:0] loops_1000_loop281_314_reg;
+reg [31:0] loops_1000_loop281_315;
+reg [31:0] loops_1000_loop281_315_reg;
+reg [63:0] loops_1000_loop281_316;
+reg [63:0] loops_1000_loop281_316_reg;
+reg [31:0] loops_1000_loop281_317;
+reg [2:0] loops_1000_loop281_317_reg;
+reg  loops_1000_loop281_318;
+reg  bp_reg_19;
+reg  loops_1000_loop281_318_reg;
+reg [31:0] loops_1000_exit282_319;
+reg [2:0] loops_1000_exit282_319_reg;
+reg  loops_1000_exit282_320;
+reg [7:0] bp_reg_14;
+reg  loops_1000_exit282_320_reg;
+reg [31:0] loops_1000_exit183_321;
+reg [2:0] loops_1000_exit183_321_reg;
+reg  loops_1000_exit183_322;
+reg  loops_1000_exit183_322_reg;
+wire [1:0] loops_1000_loop085_323;
+reg [1:0] loops_1000_loop085_323_reg;
+wire [63:0] loops_1000_loop085_324;
+reg [63:0] loops_1000_loop085_324_reg;
+wire [1:0] loops_1000_loop186_325;
+reg [1:0] loops_1000_loop186_325_reg;
+wire [63:0] loops_1000_loop186_326;
+reg [63:0] loops_1000_loop186_326_reg;
+wire [1:0] loops_1000_loop287_327;
+reg [1:0] loops_1000_loop287_327_reg;
+wire [63:0] loops_1000_loop287_328;
+reg [63:0] loops_1000_loop287_328_reg;
+reg [15:0] loops_1000_loop287_329;
+reg [15:0] loops_1000_loop287_329_reg;
+reg [31:0] loops_1000_loop287_330;
+reg [31:0] loops_1000_loop287_330_reg;
+reg [7:0] loops_1000_loop287_331;
+reg [7:0] loops_1000_loop287_331_reg;
+reg [31:0] loops_1000_loop287_332;
+reg [31:0] loops_1000_loop287_332_reg;
+reg [31:0] loops_1000_loop287_333;
+reg [31:0] loops_1000_loop287_333_reg;
+reg [31:0] loops_1000_loop287_334;
+reg [31:0] loops_1000_loop287_334_reg;
+reg [7:0] loops_1000_loop287_335;
+reg [7:0] loops_1000_loop287_335_reg;
+reg [7:0] loops_1000_loop287_336;
+reg [7:0] loops_1000_loop287_336_reg;
+reg [63:0] loops_1000_loop287_337;
+reg [63:0] loops_1000_loop287_337_reg;
+reg [31:0] loops_1000_loop287_338;
+reg [2:0] loops_1000_loop287_338_reg;
+reg  loops_1000_loop287_339;
+reg  loops_1000_loop287_339_reg;
+reg [31:0] loops_1000_exit288_340;
+reg [2:0] loops_1000_exit288_340_reg;
+reg  loops_1000_exit288_341;
+reg  loops_1000_exit288_341_reg;
+reg [31:0] loops_1000_exit189_342;
+reg [2:0] loops_1000_exit189_342_reg;
+reg  loops_1000_exit189_343;
+reg  loops_1000_exit189_343_reg;
+wire [1:0] loops_1000_loop091_344;
+reg [1:0] loops_1000_loop091_344_reg;
+wire [63:0] loops_1000_loop091_345;
+reg [63:0] loops_1000_loop091_345_reg;
+wire [1:0] loops_1000_loop192_346;
+reg [1:0] loops_1000_loop192_346_reg;
+wire [63:0] loops_1000_loop192_347;
+reg [63:0] loops_1000_loop192_347_reg;
+wire [1:0] loops_1000_loop293_348;
+reg [1:0] loops_1000_loop293_348_reg;
+wire [63:0] loops_1000_loop293_349;
+reg [63:0] loops_1000_loop293_349_reg;
+reg [15:0] loops_1000_loop293_350;
+reg [15:0] loops_1000_loop293_350_reg;
+reg [7:0] loops_1000_loop293_351;
+reg [7:0] loops_1000_loop293_351_reg;
+reg [63:0] loops_1000_loop293_352;
+reg [63:0] loops_1000_loop293_352_reg;
+reg [31:0] loops_1000_loop293_353;
+reg [31:0] loops_1000_loop293_353_reg;
+reg [7:0] loops_1000_loop293_354;
+reg [7:0] loops_1000_loop293_354_reg;
+reg [31:0] loops_1000_loop293_355;
+reg [31:0] loops_1000_loop293_355_reg;
+reg [63:0] loops_1000_loop293_356;
+reg [63:0] loops_1000_loop293_356_reg;
+reg [63:0] loops_1000_loop293_357;
+reg [63:0] loops_1000_loop293_357_reg;
+reg [63:0] loops_1000_loop293_358;
+reg [63:0] loops_1000_loop293_358_reg;
+reg [31:0] loops_1000_loop293_359;
+reg [7:0] loops_1000_loop293_359_reg;
+reg  loops_1000_loop293_360;
+reg  bp_reg_20;
+reg  loops_1000_loop293_360_reg;
+reg [31:0] loops_1000_exit294_361;
+reg [2:0] loops_1000_exit294_361_reg;
+reg  loops_1000_exit294_362;
+reg  loops_1000_exit294_362_reg;
+reg [31:0] loops_1000_exit195_363;
+reg [2:0] loops_1000_exit195_363_reg;
+reg  loops_1000_exit195_364;
+reg  loops_1000_exit195_364_reg;
+wire [1:0] loops_1000_loop097_365;
+reg [1:0] loops_1000_loop097_365_reg;
+wire [63:0] loops_1000_loop097_366;
+reg [63:0] loops_1000_loop097_366_reg;
+wire [1:0] loops_1000_loop198_367;
+reg [1:0] loops_1000_loop198_367_reg;
+wire [63:0] loops_1000_loop198_368;
+reg [63:0] loops_1000_loop198_368_reg;
+wire [1:0] loops_1000_loop299_369;
+reg [1:0] loops_1000_loop299_369_reg;
+wire [63:0] loops_1000_loop299_370;
+reg [63:0] loops_1000_loop299_370_reg;
+reg [31:0] loops_1000_loop299_372;
+reg [31:0] loops_1000_loop299_372_reg;
+reg [63:0] loops_1000_loop299_373;
+reg [63:0] loops_1000_loop299_373_reg;
+reg [15:0] loops_1000_loop299_374;
+reg [15:0] loops_1000_loop299_374_reg;
+reg [7:0] loops_1000_loop299_375;
+reg [7:0] loops_1000_loop299_375_reg;
+reg [63:0] loops_1000_loop299_376;
+reg [63:0] loops_1000_loop299_376_reg;
+reg [31:0] loops_1000_loop299_377;
+reg [31:0] loops_1000_loop299_377_reg;
+reg [15:0] loops_1000_loop299_378;
+reg [15:0] loops_1000_loop299_378_reg;
+reg [63:0] loops_1000_loop299_379;
+reg [63:0] loops_1000_loop299_379_reg;
+reg [31:0] loops_1000_loop299_380;
+reg [2:0] loops_1000_loop299_380_reg;
+reg  loops_1000_loop299_381;
+reg  loops_1000_loop299_381_reg;
+reg [31:0] loops_1000_exit2100_382;
+reg [2:0] loops_1000_exit2100_382_reg;
+reg  loops_1000_exit2100_383;
+reg  loops_1000_exit2100_383_reg;
+reg [31:0] loops_1000_exit1101_384;
+reg [2:0] loops_1000_exit1101_384_reg;
+reg  loops_1000_exit1101_385;
+reg  loops_1000_exit1101_385_reg;
+wire [1:0] loops_1000_loop0103_386;
+reg [1:0] loops_1000_loop0103_386_reg;
+wire [63:0] loops_1000_loop0103_387;
+reg [63:0] loops_1000_loop0103_387_reg;
+wire [1:0] loops_1000_loop1104_388;
+reg [1:0] loops_1000_loop1104_388_reg;
+wire [63:0] loops_1000_loop1104_389;
+reg [63:0] loops_1000_loop1104_389_reg;
+wire [1:0] loops_1000_loop2105_390;
+reg [1:0] loops_1000_loop2105_390_reg;
+wire [63:0] loops_1000_loop2105_391;
+reg [63:0] loops_1000_loop2105_391_reg;
+reg [7:0] loops_1000_loop2105_392;
+reg [7:0] loops_1000_loop2105_392_reg;
+reg [15:0] loops_1000_loop2105_393;
+reg [15:0] loops_1000_loop2105_393_reg;
+reg [31:0] loops_1000_loop2105_394;
+reg [31:0] loops_1000_loop2105_394_reg;
+reg [31:0] loops_1000_loop2105_395;
+reg [31:0] loops_1000_loop2105_395_reg;
+reg [7:0] loops_1000_loop2105_397;
+reg [7:0] loops_1000_loop2105_397_reg;
+reg [31:0] loops_1000_loop2105_398;
+reg [31:0] loops_1000_loop2105_398_reg;
+reg [63:0] loops_1000_loop2105_399;
+reg [63:0] loops_1000_loop2105_399_reg;
+reg [63:0] loops_1000_loop2105_400;
+reg [63:0] loops_1000_loop2105_400_reg;
+reg [31:0] loops_1000_loop2105_401;
+reg [2:0] loops_1000_loop2105_401_reg;
+reg  loops_1000_loop2105_402;
+reg  loops_1000_loop2105_402_reg;
+reg [31:0] loops_1000_exit2106_403;
+reg [2:0] loops_1000_exit2106_403_reg;
+reg  loops_1000_exit2106_404;
+reg  loops_1000_exit2106_404_reg;
+reg [31:0] loops_1000_exit1107_405;
+reg [2:0] loops_1000_exit1107_405_reg;
+reg  loops_1000_exit1107_406;
+reg  loops_1000_exit1107_406_reg;
+wire [1:0] loops_1000_loop0109_407;
+reg [1:0] loops_1000_loop0109_407_reg;
+wire [63:0] loops_1000_loop0109_408;
+reg [63:0] loops_1000_loop0109_408_reg;
+wire [1:0] loops_1000_loop1110_409;
+reg [1:0] loops_1000_loop1110_409_reg;
+wire [63:0] loops_1000_loop1110_410;
+reg [63:0] loops_1000_loop1110_410_reg;
+wire [1:0] loops_1000_loop2111_411;
+reg [1:0] loops_1000_loop2111_411_reg;
+wire [63:0] loops_1000_loop2111_412;
+reg [63:0] loops_1000_loop2111_412_reg;
+reg [63:0] loops_1000_loop2111_413;
+reg [63:0] loops_1000_loop2111_413_reg;
+reg [31:0] loops_1000_loop2111_414;
+reg [31:0] loops_1000_loop2111_414_reg;
+reg [31:0] loops_1000_loop2111_415;
+reg [31:0] loops_1000_loop2111_415_reg;
+reg [63:0] loops_1000_loop2111_416;
+reg [63:0] loops_1000_loop2111_416_reg;
+reg [15:0] loops_1000_loop2111_418;
+reg [15:0] loops_1000_loop2111_418_reg;
+reg [7:0] loops_1000_loop2111_419;
+reg [7:0] loops_1000_loop2111_419_reg;
+reg [31:0] loops_1000_loop2111_420;
+reg [31:0] bp_reg_7;
+reg [31:0] loops_1000_loop2111_420_reg;
+reg [63:0] loops_1000_loop2111_421;
+reg [63:0] loops_1000_loop2111_421_reg;
+reg [31:0] loops_1000_loop2111_422;
+reg [2:0] loops_1000_loop2111_422_reg;
+reg  loops_1000_loop2111_423;
+reg  bp_reg_21;
+reg  loops_1000_loop2111_423_reg;
+reg [31:0] loops_1000_exit2112_424;
+reg [2:0] loops_1000_exit2112_424_reg;
+reg  loops_1000_exit2112_425;
+reg  loops_1000_exit2112_425_reg;
+reg [31:0] loops_1000_exit1113_426;
+reg [2:0] loops_1000_exit1113_426_reg;
+reg  loops_1000_exit1113_427;
+reg  loops_1000_exit1113_427_reg;
+wire [1:0] loops_1000_loop0115_428;
+reg [1:0] loops_1000_loop0115_428_reg;
+wire [63:0] loops_1000_loop0115_429;
+reg [63:0] loops_1000_loop0115_429_reg;
+wire [1:0] loops_1000_loop1116_430;
+reg [1:0] loops_1000_loop1116_430_reg;
+wire [63:0] loops_1000_loop1116_431;
+reg [63:0] loops_1000_loop1116_431_reg;
+wire [1:0] loops_1000_loop2117_432;
+reg [1:0] loops_1000_loop2117_432_reg;
+wire [63:0] loops_1000_loop2117_433;
+reg [63:0] loops_1000_loop2117_433_reg;
+reg [63:0] loops_1000_loop2117_434;
+reg [63:0] loops_1000_loop2117_434_reg;
+reg [63:0] loops_1000_loop2117_435;
+reg [63:0] loops_1000_loop2117_435_reg;
+reg [63:0] loops_1000_loop2117_438;
+reg [63:0] loops_1000_loop2117_438_reg;
+reg [15:0] loops_1000_loop2117_439;
+reg [15:0] loops_1000_loop2117_439_reg;
+reg [63:0] loops_1000_loop2117_440;
+reg [63:0] loops_1000_loop2117_440_reg;
+reg [15:0] loops_1000_loop2117_441;
+reg [15:0] bp_reg_8;
+reg [15:0] loops_1000_loop2117_441_reg;
+reg [63:0] loops_1000_loop2117_442;
+reg [63:0] loops_1000_loop2117_442_reg;
+reg [31:0] loops_1000_loop2117_443;
+reg [2:0] loops_1000_loop2117_443_reg;
+reg  loops_1000_loop2117_444;
+reg  bp_reg_22;
+reg  loops_1000_loop2117_444_reg;
+reg [31:0] loops_1000_exit2118_445;
+reg [2:0] loops_1000_exit2118_445_reg;
+reg  loops_1000_exit2118_446;
+reg  loops_1000_exit2118_446_reg;
+reg [31:0] loops_1000_exit1119_447;
+reg [2:0] bp_reg_16;
+reg [2:0] loops_1000_exit1119_447_reg;
+reg  loops_1000_exit1119_448;
+reg  loops_1000_exit1119_448_reg;
+wire [1:0] loops_1000_loop0121_449;
+reg [1:0] loops_1000_loop0121_449_reg;
+wire [63:0] loops_1000_loop0121_450;
+reg [63:0] loops_1000_loop0121_450_reg;
+wire [1:0] loops_1000_loop1122_451;
+reg [1:0] loops_1000_loop1122_451_reg;
+wire [63:0] loops_1000_loop1122_452;
+reg [63:0] loops_1000_loop1122_452_reg;
+wire [1:0] loops_1000_loop2123_453;
+reg [1:0] loops_1000_loop2123_453_reg;
+wire [63:0] loops_1000_loop2123_454;
+reg [63:0] loops_1000_loop2123_454_reg;
+reg [63:0] loops_1000_loop2123_455;
+reg [63:0] loops_1000_loop2123_455_reg;
+reg [31:0] loops_1000_loop2123_456;
+reg [31:0] loops_1000_loop2123_456_reg;
+reg [7:0] loops_1000_loop2123_458;
+reg [7:0] loops_1000_loop2123_458_reg;
+reg [7:0] loops_1000_loop2123_459;
+reg [7:0] loops_1000_loop2123_459_reg;
+reg [15:0] loops_1000_loop2123_460;
+reg [15:0] loops_1000_loop2123_460_reg;
+reg [63:0] loops_1000_loop2123_462;
+reg [63:0] loops_1000_loop2123_462_reg;
+reg [63:0] loops_1000_loop2123_463;
+reg [63:0] loops_1000_loop2123_463_reg;
+reg [31:0] loops_1000_loop2123_464;
+reg [2:0] loops_1000_loop2123_464_reg;
+reg  loops_1000_loop2123_465;
+reg  bp_reg_23;
+reg  loops_1000_loop2123_465_reg;
+reg [31:0] loops_1000_exit2124_466;
+reg [2:0] loops_1000_exit2124_466_reg;
+reg  loops_1000_exit2124_467;
+reg  loops_1000_exit2124_467_reg;
+reg [31:0] loops_1000_exit1125_468;
+reg [2:0] loops_1000_exit1125_468_reg;
+reg  loops_1000_exit1125_469;
+reg  loops_1000_exit1125_469_reg;
+wire [1:0] loops_1000_loop0127_470;
+reg [1:0] loops_1000_loop0127_470_reg;
+wire [63:0] loops_1000_loop0127_471;
+reg [63:0] loops_1000_loop0127_471_reg;
+wire [1:0] loops_1000_loop1128_472;
+reg [1:0] loops_1000_loop1128_472_reg;
+wire [63:0] loops_1000_loop1128_473;
+reg [63:0] loops_1000_loop1128_473_reg;
+wire [1:0] loops_1000_loop2129_474;
+reg [1:0] loops_1000_loop2129_474_reg;
+wire [63:0] loops_1000_loop2129_475;
+reg [63:0] loops_1000_loop2129_475_reg;
+reg [63:0] loops_1000_loop2129_477;
+reg [63:0] loops_1000_loop2129_477_reg;
+reg [31:0] loops_1000_loop2129_479;
+reg [31:0] loops_1000_loop2129_479_reg;
+reg [7:0] loops_1000_loop2129_480;
+reg [7:0] loops_1000_loop2129_480_reg;
+reg [15:0] loops_1000_loop2129_481;
+reg [15:0] loops_1000_loop2129_481_reg;
+reg [31:0] loops_1000_loop2129_482;
+reg [31:0] loops_1000_loop2129_482_reg;
+reg [15:0] loops_1000_loop2129_483;
+reg [15:0] loops_1000_loop2129_483_reg;
+reg [63:0] loops_1000_loop2129_484;
+reg [63:0] loops_1000_loop2129_484_reg;
+reg [31:0] loops_1000_loop2129_485;
+reg [2:0] loops_1000_loop2129_485_reg;
+reg  loops_1000_loop2129_486;
+reg  loops_1000_loop2129_486_reg;
+reg [31:0] loops_1000_exit2130_487;
+reg [2:0] loops_1000_exit2130_487_reg;
+reg  loops_1000_exit2130_488;
+reg  loops_1000_exit2130_488_reg;
+reg [31:0] loops_1000_exit1131_489;
+reg [2:0] loops_1000_exit1131_489_reg;
+reg  loops_1000_exit1131_490;
+reg  loops_1000_exit1131_490_reg;
+wire [1:0] loops_1000_loop0133_491;
+reg [1:0] loops_1000_loop0133_491_reg;
+wire [63:0] loops_1000_loop0133_492;
+reg [63:0] loops_1000_loop0133_492_reg;
+wire [1:0] loops_1000_loop1134_493;
+reg [1:0] loops_1000_loop1134_493_reg;
+wire [63:0] loops_1000_loop1134_494;
+reg [63:0] loops_1000_loop1134_494_reg;
+wire [1:0] loops_1000_loop2135_495;
+reg [1:0] loops_1000_loop2135_495_reg;
+wire [63:0] loops_1000_loop2135_496;
+reg [63:0] loops_1000_loop2135_496_reg;
+reg [7:0] loops_1000_loop2135_497;
+reg [7:0] loops_1000_loop2135_497_reg;
+reg [15:0] loops_1000_loop2135_498;
+reg [15:0] loops_1000_loop2135_498_reg;
+reg [15:0] loops_1000_loop2135_499;
+reg [15:0] loops_1000_loop2135_499_reg;
+reg [7:0] loops_1000_loop2135_501;
+reg [7:0] loops_1000_loop2135_501_reg;
+reg [63:0] loops_1000_loop2135_502;
+reg [63:0] loops_1000_loop2135_502_reg;
+reg [31:0] loops_1000_loop2135_503;
+reg  loops_1000_loop2135_503_reg;
+reg [15:0] loops_1000_loop2135_504;
+reg [15:0] loops_1000_loop2135_504_reg;
+reg [63:0] loops_1000_loop2135_505;
+reg [63:0] loops_1000_loop2135_505_reg;
+reg [31:0] loops_1000_loop2135_506;
+reg [2:0] loops_1000_loop2135_506_reg;
+reg  loops_1000_loop2135_507;
+reg  loops_1000_loop2135_507_reg;
+reg [31:0] loops_1000_exit2136_508;
+reg [2:0] loops_1000_exit2136_508_reg;
+reg  loops_1000_exit2136_509;
+reg  loops_1000_exit2136_509_reg;
+reg [31:0] loops_1000_exit1137_510;
+reg [2:0] loops_1000_exit1137_510_reg;
+reg  loops_1000_exit1137_511;
+reg  loops_1000_exit1137_511_reg;
+wire [1:0] loops_1000_loop0139_512;
+reg [1:0] loops_1000_loop0139_512_reg;
+wire [63:0] loops_1000_loop0139_513;
+reg [63:0] loops_1000_loop0139_513_reg;
+wire [1:0] loops_1000_loop1140_514;
+reg [1:0] loops_1000_loop1140_514_reg;
+wire [63:0] loops_1000_loop1140_515;
+reg [63:0] loops_1000_loop1140_515_reg;
+wire [1:0] loops_1000_loop2141_516;
+reg [1:0] loops_1000_loop2141_516_reg;
+wire [63:0] loops_1000_loop2141_517;
+reg [63:0] loops_1000_loop2141_517_reg;
+reg [31:0] loops_1000_loop2141_518;
+reg [31:0] loops_1000_loop2141_518_reg;
+reg [7:0] loops_1000_loop2141_519;
+reg [7:0] loops_1000_loop2141_519_reg;
+reg [7:0] loops_1000_loop2141_520;
+reg [7:0] loops_1000_loop2141_520_reg;
+reg [31:0] loops_1000_loop2141_521;
+reg [31:0] loops_1000_loop2141_521_reg;
+reg [7:0] loops_1000_loop2141_523;
+reg [7:0] loops_1000_loop2141_523_reg;
+reg [15:0] loops_1000_loop2141_524;
+reg [15:0] loops_1000_loop2141_524_reg;
+reg [15:0] loops_1000_loop2141_525;
+reg [15:0] loops_1000_loop2141_525_reg;
+reg [63:0] loops_1000_loop2141_526;
+reg [63:0] loops_1000_loop2141_526_reg;
+reg [31:0] loops_1000_loop2141_527;
+reg [2:0] loops_1000_loop2141_527_reg;
+reg  loops_1000_loop2141_528;
+reg  loops_1000_loop2141_528_reg;
+reg [31:0] loops_1000_exit2142_529;
+reg [2:0] loops_1000_exit2142_529_reg;
+reg  loops_1000_exit2142_530;
+reg  loops_1000_exit2142_530_reg;
+reg [31:0] loops_1000_exit1143_531;
+reg [2:0] loops_1000_exit1143_531_reg;
+reg  loops_1000_exit1143_532;
+reg  loops_1000_exit1143_532_reg;
+wire [1:0] loops_1000_loop0145_533;
+reg [1:0] loops_1000_loop0145_533_reg;
+wire [63:0] loops_1000_loop0145_534;
+reg [63:0] loops_1000_loop0145_534_reg;
+wire [1:0] loops_1000_loop1146_535;
+reg [1:0] loops_1000_loop1146_535_reg;
+wire [63:0] loops_1000_loop1146_536;
+reg [63:0] loops_1000_loop1146_536_reg;
+wire [1:0] loops_1000_loop2147_537;
+reg [1:0] loops_1000_loop2147_537_reg;
+wire [63:0] loops_1000_loop2147_538;
+reg [63:0] loops_1000_loop2147_538_reg;
+reg [31:0] loops_1000_loop2147_539;
+reg [31:0] loops_1000_loop2147_539_reg;
+reg [31:0] loops_1000_loop2147_540;
+reg [31:0] loops_1000_loop2147_540_reg;
+reg [31:0] loops_1000_loop2147_541;
+reg [31:0] loops_1000_loop2147_541_reg;
+reg [7:0] loops_1000_loop2147_543;
+reg [7:0] loops_1000_loop2147_543_reg;
+reg [15:0] loops_1000_loop2147_544;
+reg [15:0] loops_1000_loop2147_544_reg;
+reg [31:0] loops_1000_loop2147_545;
+reg [31:0] loops_1000_loop2147_545_reg;
+reg [31:0] loops_1000_loop2147_546;
+reg [31:0] loops_1000_loop2147_546_reg;
+reg [63:0] loops_1000_loop2147_547;
+reg [63:0] loops_1000_loop2147_547_reg;
+reg [31:0] loops_1000_loop2147_548;
+reg [2:0] loops_1000_loop2147_548_reg;
+reg  loops_1000_loop2147_549;
+reg  loops_1000_loop2147_549_reg;
+reg [31:0] loops_1000_exit2148_550;
+reg [2:0] loops_1000_exit2148_550_reg;
+reg  loops_1000_exit2148_551;
+reg  loops_1000_exit2148_551_reg;
+reg [31:0] loops_1000_exit1149_552;
+reg [2:0] loops_1000_exit1149_552_reg;
+reg  loops_1000_exit1149_553;
+reg  loops_1000_exit1149_553_reg;
+wire [1:0] loops_1000_loop0151_554;
+reg [1:0] loops_1000_loop0151_554_reg;
+wire [63:0] loops_1000_loop0151_555;
+reg [63:0] loops_1000_loop0151_555_reg;
+wire [1:0] loops_1000_loop1152_556;
+reg [1:0] loops_1000_loop1152_556_reg;
+wire [63:0] loops_1000_loop1152_557;
+reg [63:0] loops_1000_loop1152_557_reg;
+wire [1:0] loops_1000_loop2153_558;
+reg [1:0] loops_1000_loop2153_558_reg;
+wire [63:0] loops_1000_loop2153_559;
+reg [63:0] loops_1000_loop2153_559_reg;
+reg [63:0] loops_1000_loop2153_561;
+reg [63:0] loops_1000_loop2153_561_reg;
+reg [15:0] loops_1000_loop2153_562;
+reg [15:0] loops_1000_loop2153_562_reg;
+reg [7:0] loops_1000_loop2153_563;
+reg [7:0] loops_1000_loop2153_563_reg;
+reg [15:0] loops_1000_loop2153_564;
+reg [15:0] loops_1000_loop2153_564_reg;
+reg [7:0] loops_1000_loop2153_565;
+reg [7:0] loops_1000_loop2153_565_reg;
+reg [7:0] loops_1000_loop2153_566;
+reg [7:0] loops_1000_loop2153_566_reg;
+reg [63:0] loops_1000_loop2153_567;
+reg [63:0] loops_1000_loop2153_567_reg;
+reg [63:0] loops_1000_loop2153_568;
+reg [63:0] loops_1000_loop2153_568_reg;
+reg [31:0] loops_1000_loop2153_569;
+reg [2:0] loops_1000_loop2153_569_reg;
+reg  loops_1000_loop2153_570;
+reg  loops_1000_loop2153_570_reg;
+reg [31:0] loops_1000_exit2154_571;
+reg [2:0] loops_1000_exit2154_571_reg;
+reg  loops_1000_exit2154_572;
+reg  loops_1000_exit2154_572_reg;
+reg [31:0] loops_1000_exit1155_573;
+reg [2:0] loops_1000_exit1155_573_reg;
+reg  loops_1000_exit1155_574;
+reg  loops_1000_exit1155_574_reg;
+wire [1:0] loops_1000_loop0157_575;
+reg [1:0] loops_1000_loop0157_575_reg;
+wire [63:0] loops_1000_loop0157_576;
+reg [63:0] loops_1000_loop0157_576_reg;
+wire [1:0] loops_1000_loop1158_577;
+reg [1:0] loops_1000_loop1158_577_reg;
+wire [63:0] loops_1000_loop1158_578;
+reg [63:0] loops_1000_loop1158_578_reg;
+wire [1:0] loops_1000_loop2159_579;
+reg [1:0] loops_1000_loop2159_579_reg;
+wire [63:0] loops_1000_loop2159_580;
+reg [63:0] loops_1000_loop2159_580_reg;
+reg [7:0] loops_1000_loop2159_581;
+reg [7:0] loops_1000_loop2159_581_reg;
+reg [31:0] loops_1000_loop2159_582;
+reg [31:0] loops_1000_loop2159_582_reg;
+reg [31:0] loops_1000_loop2159_583;
+reg [31:0] loops_1000_loop2159_583_reg;
+reg [7:0] loops_1000_loop2159_584;
+reg [7:0] loops_1000_loop2159_584_reg;
+reg [7:0] loops_1000_loop2159_585;
+reg [7:0] loops_1000_loop2159_585_reg;
+reg [7:0] loops_1000_loop2159_587;
+reg [7:0] loops_1000_loop2159_587_reg;
+reg [7:0] loops_1000_loop2159_588;
+reg [7:0] loops_1000_loop2159_588_reg;
+reg [63:0] loops_1000_loop2159_589;
+reg [63:0] loops_1000_loop2159_589_reg;
+reg [31:0] loops_1000_loop2159_590;
+reg [2:0] loops_1000_loop2159_590_reg;
+reg  loops_1000_loop2159_591;
+reg  loops_1000_loop2159_591_reg;
+reg [31:0] loops_1000_exit2160_592;
+reg [2:0] loops_1000_exit2160_592_reg;
+reg  loops_1000_exit2160_593;
+reg  loops_1000_exit2160_593_reg;
+reg [31:0] loops_1000_exit1161_594;
+reg [2:0] loops_1000_exit1161_594_reg;
+reg  loops_1000_exit1161_595;
+reg  loops_1000_exit1161_595_reg;
+wire [1:0] loops_1000_loop0163_596;
+reg [1:0] loops_1000_loop0163_596_reg;
+wire [63:0] loops_1000_loop0163_597;
+reg [63:0] loops_1000_loop0163_597_reg;
+wire [1:0] loops_1000_loop1164_598;
+reg [1:0] loops_1000_loop1164_598_reg;
+wire [63:0] loops_1000_loop1164_599;
+reg [63:0] loops_1000_loop1164_599_reg;
+wire [1:0] loops_1000_loop2165_600;
+reg [1:0] loops_1000_loop2165_600_reg;
+wire [63:0] loops_1000_loop2165_601;
+reg [63:0] loops_1000_loop2165_601_reg;
+reg [31:0] loops_1000_loop2165_602;
+reg [31:0] loops_1000_loop2165_602_reg;
+reg [7:0] loops_1000_loop2165_603;
+reg [7:0] loops_1000_loop2165_603_reg;
+reg [31:0] loops_1000_loop2165_604;
+reg [31:0] loops_1000_loop2165_604_reg;
+reg [15:0] loops_1000_loop2165_605;
+reg [15:0] loops_1000_loop2165_605_reg;
+reg [63:0] loops_1000_loop2165_607;
+reg [63:0] loops_1000_loop2165_607_reg;
+reg [31:0] loops_1000_loop2165_608;
+reg [31:0] loops_1000_loop2165_608_reg;
+reg [63:0] loops_1000_loop2165_609;
+reg  bp_reg_24;
+reg  loops_1000_loop2165_609_reg;
+reg [63:0] loops_1000_loop2165_610;
+reg [63:0] loops_1000_loop2165_610_reg;
+reg [31:0] loops_1000_loop2165_611;
+reg [2:0] loops_1000_loop2165_611_reg;
+reg  loops_1000_loop2165_612;
+reg  bp_reg_25;
+reg  loops_1000_loop2165_612_reg;
+reg [31:0] loops_1000_exit2166_613;
+reg [2:0] loops_1000_exit2166_613_reg;
+reg  loops_1000_exit2166_614;
+reg  loops_1000_exit2166_614_reg;
+reg [31:0] loops_1000_exit1167_615;
+reg [2:0] loops_1000_exit1167_615_reg;
+reg  loops_1000_exit1167_616;
+reg  loops_1000_exit1167_616_reg;
+wire [1:0] loops_1000_loop0169_617;
+reg [1:0] loops_1000_loop0169_617_reg;
+wire [63:0] loops_1000_loop0169_618;
+reg [63:0] loops_1000_loop0169_618_reg;
+wire [1:0] loops_1000_loop1170_619;
+reg [1:0] loops_1000_loop1170_619_reg;
+wire [63:0] loops_1000_loop1170_620;
+reg [63:0] loops_1000_loop1170_620_reg;
+wire [1:0] loops_1000_loop2171_621;
+reg [1:0] loops_1000_loop2171_621_reg;
+wire [63:0] loops_1000_loop2171_622;
+reg [63:0] loops_1000_loop2171_622_reg;
+reg [63:0] loops_1000_loop2171_623;
+reg  loops_1000_loop2171_623_reg;
+reg [31:0] loops_1000_loop2171_624;
+reg [31:0] loops_1000_loop2171_624_reg;
+reg [31:0] loops_1000_loop2171_625;
+reg [31:0] loops_1000_loop2171_625_reg;
+reg [31:0] loops_1000_loop2171_626;
+reg [31:0] loops_1000_loop2171_626_reg;
+reg [31:0] loops_1000_loop2171_627;
+reg [31:0] loops_1000_loop2171_627_reg;
+reg [15:0] loops_1000_loop2171_630;
+reg [15:0] loops_1000_loop2171_630_reg;
+reg [63:0] loops_1000_loop2171_631;
+reg [63:0] loops_1000_loop2171_631_reg;
+reg [31:0] loops_1000_loop2171_632;
+reg [2:0] loops_1000_loop2171_632_reg;
+reg  loops_1000_loop2171_633;
+reg  loops_1000_loop2171_633_reg;
+reg [31:0] loops_1000_exit2172_634;
+reg [2:0] loops_1000_exit2172_634_reg;
+reg  loops_1000_exit2172_635;
+reg  loops_1000_exit2172_635_reg;
+reg [31:0] loops_1000_exit1173_636;
+reg [2:0] loops_1000_exit1173_636_reg;
+reg  loops_1000_exit1173_637;
+reg  loops_1000_exit1173_637_reg;
+wire [1:0] loops_1000_loop0175_638;
+reg [1:0] loops_1000_loop0175_638_reg;
+wire [63:0] loops_1000_loop0175_639;
+reg [63:0] loops_1000_loop0175_639_reg;
+wire [1:0] loops_1000_loop1176_640;
+reg [1:0] loops_1000_loop1176_640_reg;
+wire [63:0] loops_1000_loop1176_641;
+reg [63:0] loops_1000_loop1176_641_reg;
+wire [1:0] loops_1000_loop2177_642;
+reg [1:0] loops_1000_loop2177_642_reg;
+wire [63:0] loops_1000_loop2177_643;
+reg [63:0] loops_1000_loop2177_643_reg;
+reg [31:0] loops_1000_loop2177_644;
+reg [31:0] loops_1000_loop2177_644_reg;
+reg [15:0] loops_1000_loop2177_645;
+reg [15:0] loops_1000_loop2177_645_reg;
+reg [63:0] loops_1000_loop2177_646;
+reg [63:0] loops_1000_loop2177_646_reg;
+reg [63:0] loops_1000_loop2177_647;
+reg [63:0] loops_1000_loop2177_647_reg;
+reg [31:0] loops_1000_loop2177_648;
+reg [31:0] loops_1000_loop2177_648_reg;
+reg [7:0] loops_1000_loop2177_649;
+reg [7:0] loops_1000_loop2177_649_reg;
+reg [15:0] loops_1000_loop2177_650;
+reg [15:0] loops_1000_loop2177_650_reg;
+reg [31:0] loops_1000_loop2177_651;
+reg [31:0] loops_1000_loop2177_651_reg;
+reg [63:0] loops_1000_loop2177_652;
+reg [63:0] loops_1000_loop2177_652_reg;
+reg [31:0] loops_1000_loop2177_653;
+reg [2:0] loops_1000_loop2177_653_reg;
+reg  loops_1000_loop2177_654;
+reg  loops_1000_loop2177_654_reg;
+reg [31:0] loops_1000_exit2178_655;
+reg [2:0] loops_1000_exit2178_655_reg;
+reg  loops_1000_exit2178_656;
+reg  loops_1000_exit2178_656_reg;
+reg [31:0] loops_1000_exit1179_657;
+reg [2:0] loops_1000_exit1179_657_reg;
+reg  loops_1000_exit1179_658;
+reg  loops_1000_exit1179_658_reg;
+wire [1:0] loops_1000_loop0181_659;
+reg [1:0] loops_1000_loop0181_659_reg;
+wire [63:0] loops_1000_loop0181_660;
+reg [63:0] loops_1000_loop0181_660_reg;
+wire [1:0] loops_1000_loop1182_661;
+reg [1:0] loops_1000_loop1182_661_reg;
+wire [63:0] loops_1000_loop1182_662;
+reg [63:0] loops_1000_loop1182_662_reg;
+wire [1:0] loops_1000_loop2183_663;
+reg [1:0] loops_1000_loop2183_663_reg;
+wire [63:0] loops_1000_loop2183_664;
+reg [63:0] loops_1000_loop2183_664_reg;
+reg [63:0] loops_1000_loop2183_665;
+reg [63:0] loops_1000_loop2183_665_reg;
+reg [63:0] loops_1000_loop2183_667;
+reg [63:0] loops_1000_loop2183_667_reg;
+reg [7:0] loops_1000_loop2183_668;
+reg [7:0] loops_1000_loop2183_668_reg;
+reg [31:0] loops_1000_loop2183_669;
+reg [31:0] loops_1000_loop2183_669_reg;
+reg [63:0] loops_1000_loop2183_671;
+reg [63:0] loops_1000_loop2183_671_reg;
+reg [63:0] loops_1000_loop2183_672;
+reg [63:0] loops_1000_loop2183_672_reg;
+reg [63:0] loops_1000_loop2183_673;
+reg [63:0] loops_1000_loop2183_673_reg;
+reg [31:0] loops_1000_loop2183_674;
+reg [2:0] loops_1000_loop2183_674_reg;
+reg  loops_1000_loop2183_675;
+reg  loops_1000_loop2183_675_reg;
+reg [31:0] loops_1000_exit2184_676;
+reg [2:0] loops_1000_exit2184_676_reg;
+reg  loops_1000_exit2184_677;
+reg  loops_1000_exit2184_677_reg;
+reg [31:0] loops_1000_exit1185_678;
+reg [2:0] loops_1000_exit1185_678_reg;
+reg  loops_1000_exit1185_679;
+reg  loops_1000_exit1185_679_reg;
+wire [1:0] loops_1000_loop0187_680;
+reg [1:0] loops_1000_loop0187_680_reg;
+wire [63:0] loops_1000_loop0187_681;
+reg [63:0] loops_1000_loop0187_681_reg;
+wire [1:0] loops_1000_loop1188_682;
+reg [1:0] loops_1000_loop1188_682_reg;
+wire [63:0] loops_1000_loop1188_683;
+reg [63:0] loops_1000_loop1188_683_reg;
+wire [1:0] loops_1000_loop2189_684;
+reg [1:0] loops_1000_loop2189_684_reg;
+wire [63:0] loops_1000_loop2189_685;
+reg [63:0] loops_1000_loop2189_685_reg;
+reg [15:0] loops_1000_loop2189_686;
+reg [15:0] loops_1000_loop2189_686_reg;
+reg [63:0] loops_1000_loop2189_687;
+reg [63:0] loops_1000_loop2189_687_reg;
+reg [7:0] loops_1000_loop2189_688;
+reg [7:0] loops_1000_loop2189_688_reg;
+reg [7:0] loops_1000_loop2189_689;
+reg [7:0] loops_1000_loop2189_689_reg;
+reg [31:0] loops_1000_loop2189_690;
+reg [31:0] loops_1000_loop2189_690_reg;
+reg [7:0] loops_1000_loop2189_691;
+reg [7:0] loops_1000_loop2189_691_reg;
+reg [7:0] loops_1000_loop2189_692;
+reg [7:0] loops_1000_loop2189_692_reg;
+reg [31:0] loops_1000_loop2189_693;
+reg [31:0] loops_1000_loop2189_693_reg;
+reg [63:0] loops_1000_loop2189_694;
+reg [63:0] loops_1000_loop2189_694_reg;
+reg [31:0] loops_1000_loop2189_695;
+reg [2:0] loops_1000_loop2189_695_reg;
+reg  loops_1000_loop2189_696;
+reg  loops_1000_loop2189_696_reg;
+reg [31:0] loops_1000_exit2190_697;
+reg [2:0] loops_1000_exit2190_697_reg;
+reg  loops_1000_exit2190_698;
+reg  loops_1000_exit2190_698_reg;
+reg [31:0] loops_1000_exit1191_699;
+reg [2:0] loops_1000_exit1191_699_reg;
+reg  loops_1000_exit1191_700;
+reg  loops_1000_exit1191_700_reg;
+wire [1:0] loops_1000_loop0193_701;
+reg [1:0] loops_1000_loop0193_701_reg;
+wire [63:0] loops_1000_loop0193_702;
+reg [63:0] loops_1000_loop0193_702_reg;
+wire [1:0] loops_1000_loop1194_703;
+reg [1:0] loops_1000_loop1194_703_reg;
+wire [63:0] loops_1000_loop1194_704;
+reg [63:0] loops_1000_loop1194_704_reg;
+wire [1:0] loops_1000_loop2195_705;
+reg [1:0] loops_1000_loop2195_705_reg;
+wire [63:0] loops_1000_loop2195_706;
+reg [63:0] loops_1000_loop2195_706_reg;
+reg [15:0] loops_1000_loop2195_707;
+reg [15:0] loops_1000_loop2195_707_reg;
+reg [7:0] loops_1000_loop2195_708;
+reg [7:0] loops_1000_loop2195_708_reg;
+reg [31:0] loops_1000_loop2195_709;
+reg [31:0] loops_1000_loop2195_709_reg;
+reg [15:0] loops_1000_loop2195_710;
+reg [15:0] loops_1000_loop2195_710_reg;
+reg [7:0] loops_1000_loop2195_711;
+reg [7:0] loops_1000_loop2195_711_reg;
+reg [15:0] loops_1000_loop2195_712;
+reg [15:0] loops_1000_loop2195_712_reg;
+reg [31:0] loops_1000_loop2195_713;
+reg [31:0] loops_1000_loop2195_713_reg;
+reg [15:0] loops_1000_loop2195_714;
+reg [15:0] loops_1000_loop2195_714_reg;
+reg [63:0] loops_1000_loop2195_715;
+reg [63:0] loops_1000_loop2195_715_reg;
+reg [31:0] loops_1000_loop2195_716;
+reg [2:0] loops_1000_loop2195_716_reg;
+reg  loops_1000_loop2195_717;
+reg  bp_reg_26;
+reg  loops_1000_loop2195_717_reg;
+reg [31:0] loops_1000_exit2196_718;
+reg [2:0] loops_1000_exit2196_718_reg;
+reg  loops_1000_exit2196_719;
+reg  loops_1000_exit2196_719_reg;
+reg [31:0] loops_1000_exit1197_720;
+reg [2:0] loops_1000_exit1197_720_reg;
+reg  loops_1000_exit1197_721;
+reg  loops_1000_exit1197_721_reg;
+wire [1:0] loops_1000_loop0199_722;
+reg [1:0] loops_1000_loop0199_722_reg;
+wire [63:0] loops_1000_loop0199_723;
+reg [63:0] loops_1000_loop0199_723_reg;
+wire [1:0] loops_1000_loop1200_724;
+reg [1:0] loops_1000_loop1200_724_reg;
+wire [63:0] loops_1000_loop1200_725;
+reg [63:0] loops_1000_loop1200_725_reg;
+wire [1:0] loops_1000_loop2201_726;
+reg [1:0] loops_1000_loop2201_726_reg;
+wire [63:0] loops_1000_loop2201_727;
+reg [63:0] loops_1000_loop2201_727_reg;
+reg [63:0] loops_1000_loop2201_728;
+reg [63:0] loops_1000_loop2201_728_reg;
+reg [31:0] loops_1000_loop2201_729;
+reg [31:0] loops_1000_loop2201_729_reg;
+reg [31:0] loops_1000_loop2201_730;
+reg [31:0] loops_1000_loop2201_730_reg;
+reg [31:0] loops_1000_loop2201_731;
+reg [31:0] loops_1000_loop2201_731_reg;
+reg [15:0] loops_1000_loop2201_732;
+reg [15:0] loops_1000_loop2201_732_reg;
+reg [7:0] loops_1000_loop2201_733;
+reg [7:0] loops_1000_loop2201_733_reg;
+reg [63:0] loops_1000_loop2201_734;
+reg [63:0] loops_1000_loop2201_734_reg;
+reg [63:0] loops_1000_loop2201_735;
+reg [63:0] loops_1000_loop2201_735_reg;
+reg [63:0] loops_1000_loop2201_736;
+reg [63:0] loops_1000_loop2201_736_reg;
+reg [31:0] loops_1000_loop2201_737;
+reg [2:0] loops_1000_loop2201_737_reg;
+reg  loops_1000_loop2201_738;
+reg  loops_1000_loop2201_738_reg;
+reg [31:0] loops_1000_exit2202_739;
+reg [2:0] loops_1000_exit2202_739_reg;
+reg  loops_1000_exit2202_740;
+reg  bp_reg_27;
+reg  loops_1000_exit2202_740_reg;
+reg [31:0] loops_1000_exit1203_741;
+reg [2:0] loops_1000_exit1203_741_reg;
+reg  loops_1000_exit1203_742;
+reg  loops_1000_exit1203_742_reg;
+wire [1:0] loops_1000_loop0205_743;
+reg [1:0] loops_1000_loop0205_743_reg;
+wire [63:0] loops_1000_loop0205_744;
+reg [63:0] loops_1000_loop0205_744_reg;
+wire [1:0] loops_1000_loop1206_745;
+reg [1:0] loops_1000_loop1206_745_reg;
+wire [63:0] loops_1000_loop1206_746;
+reg [63:0] loops_1000_loop1206_746_reg;
+wire [1:0] loops_1000_loop2207_747;
+reg [1:0] loops_1000_loop2207_747_reg;
+wire [63:0] loops_1000_loop2207_748;
+reg [63:0] loops_1000_loop2207_748_reg;
+reg [15:0] loops_1000_loop2207_749;
+reg [15:0] loops_1000_loop2207_749_reg;
+reg [7:0] loops_1000_loop2207_750;
+reg [7:0] loops_1000_loop2207_750_reg;
+reg [15:0] loops_1000_loop2207_751;
+reg [15:0] loops_1000_loop2207_751_reg;
+reg [31:0] loops_1000_loop2207_752;
+reg [31:0] loops_1000_loop2207_752_reg;
+reg [63:0] loops_1000_loop2207_753;
+reg [63:0] loops_1000_loop2207_753_reg;
+reg [63:0] loops_1000_loop2207_754;
+reg [7:0] loops_1000_loop2207_754_reg;
+reg [15:0] loops_1000_loop2207_755;
+reg [15:0] loops_1000_loop2207_755_reg;
+reg [31:0] loops_1000_loop2207_756;
+reg [31:0] loops_1000_loop2207_756_reg;
+reg [63:0] loops_1000_loop2207_757;
+reg [63:0] loops_1000_loop2207_757_reg;
+reg [31:0] loops_1000_loop2207_758;
+reg [2:0] loops_1000_loop2207_758_reg;
+reg  loops_1000_loop2207_759;
+reg  loops_1000_loop2207_759_reg;
+reg [31:0] loops_1000_exit2208_760;
+reg [2:0] loops_1000_exit2208_760_reg;
+reg  loops_1000_exit2208_761;
+reg  loops_1000_exit2208_761_reg;
+reg [31:0] loops_1000_exit1209_762;
+reg [2:0] loops_1000_exit1209_762_reg;
+reg  loops_1000_exit1209_763;
+reg  loops_1000_exit1209_763_reg;
+wire [1:0] loops_1000_loop0211_764;
+reg [1:0] loops_1000_loop0211_764_reg;
+wire [63:0] loops_1000_loop0211_765;
+reg [63:0] loops_1000_loop0211_765_reg;
+wire [1:0] loops_1000_loop1212_766;
+reg [1:0] loops_1000_loop1212_766_reg;
+wire [63:0] loops_1000_loop1212_767;
+reg [63:0] loops_1000_loop1212_767_reg;
+wire [1:0] loops_1000_loop2213_768;
+reg [1:0] loops_1000_loop2213_768_reg;
+wire [63:0] loops_1000_loop2213_769;
+reg [63:0] loops_1000_loop2213_769_reg;
+reg [31:0] loops_1000_loop2213_770;
+reg [31:0] loops_1000_loop2213_770_reg;
+reg [15:0] loops_1000_loop2213_772;
+reg [15:0] loops_1000_loop2213_772_reg;
+reg [15:0] loops_1000_loop2213_773;
+reg [15:0] loops_1000_loop2213_773_reg;
+reg [63:0] loops_1000_loop2213_774;
+reg [63:0] loops_1000_loop2213_774_reg;
+reg [63:0] loops_1000_loop2213_775;
+reg [63:0] loops_1000_loop2213_775_reg;
+reg [31:0] loops_1000_loop2213_777;
+reg [31:0] loops_1000_loop2213_777_reg;
+reg [63:0] loops_1000_loop2213_778;
+reg [63:0] loops_1000_loop2213_778_reg;
+reg [31:0] loops_1000_loop2213_779;
+reg [2:0] loops_1000_loop2213_779_reg;
+reg  loops_1000_loop2213_780;
+reg  loops_1000_loop2213_780_reg;
+reg [31:0] loops_1000_exit2214_781;
+reg [2:0] loops_1000_exit2214_781_reg;
+reg  loops_1000_exit2214_782;
+reg  loops_1000_exit2214_782_reg;
+reg [31:0] loops_1000_exit1215_783;
+reg [2:0] loops_1000_exit1215_783_reg;
+reg  loops_1000_exit1215_784;
+reg  loops_1000_exit1215_784_reg;
+wire [1:0] loops_1000_loop0217_785;
+reg [1:0] loops_1000_loop0217_785_reg;
+wire [63:0] loops_1000_loop0217_786;
+reg [63:0] loops_1000_loop0217_786_reg;
+wire [1:0] loops_1000_loop1218_787;
+reg [1:0] loops_1000_loop1218_787_reg;
+wire [63:0] loops_1000_loop1218_788;
+reg [63:0] loops_1000_loop1218_788_reg;
+wire [1:0] loops_1000_loop2219_789;
+reg [1:0] loops_1000_loop2219_789_reg;
+wire [63:0] loops_1000_loop2219_790;
+reg [63:0] loops_1000_loop2219_790_reg;
+reg [15:0] loops_1000_loop2219_791;
+reg [15:0] loops_1000_loop2219_791_reg;
+reg [15:0] loops_1000_loop2219_792;
+reg [15:0] loops_1000_loop2219_792_reg;
+reg [31:0] loops_1000_loop2219_793;
+reg [31:0] loops_1000_loop2219_793_reg;
+reg [31:0] loops_1000_loop2219_794;
+reg [31:0] loops_1000_loop2219_794_reg;
+reg [7:0] loops_1000_loop2219_795;
+reg [7:0] loops_1000_loop2219_795_reg;
+reg [31:0] loops_1000_loop2219_796;
+reg [31:0] loops_1000_loop2219_796_reg;
+reg [15:0] loops_1000_loop2219_797;
+reg [15:0] loops_1000_loop2219_797_reg;
+reg [31:0] loops_1000_loop2219_798;
+reg [31:0] loops_1000_loop2219_798_reg;
+reg [63:0] loops_1000_loop2219_799;
+reg [63:0] loops_1000_loop2219_799_reg;
+reg [31:0] loops_1000_loop2219_800;
+reg [2:0] loops_1000_loop2219_800_reg;
+reg  loops_1000_loop2219_801;
+reg  loops_1000_loop2219_801_reg;
+reg [31:0] loops_1000_exit2220_802;
+reg [2:0] loops_1000_exit2220_802_reg;
+reg  loops_1000_exit2220_803;
+reg  loops_1000_exit2220_803_reg;
+reg [31:0] loops_1000_exit1221_804;
+reg [2:0] loops_1000_exit1221_804_reg;
+reg  loops_1000_exit1221_805;
+reg  loops_1000_exit1221_805_reg;
+wire [1:0] loops_1000_loop0223_806;
+reg [1:0] loops_1000_loop0223_806_reg;
+wire [63:0] loops_1000_loop0223_807;
+reg [63:0] loops_1000_loop0223_807_reg;
+wire [1:0] loops_1000_loop1224_808;
+reg [1:0] loops_1000_loop1224_808_reg;
+wire [63:0] loops_1000_loop1224_809;
+reg [63:0] loops_1000_loop1224_809_reg;
+wire [1:0] loops_1000_loop2225_810;
+reg [1:0] loops_1000_loop2225_810_reg;
+wire [63:0] loops_1000_loop2225_811;
+reg [63:0] loops_1000_loop2225_811_reg;
+reg [63:0] loops_1000_loop2225_812;
+reg [63:0] loops_1000_loop2225_812_reg;
+reg [15:0] loops_1000_loop2225_813;
+reg [15:0] loops_1000_loop2225_813_reg;
+reg [31:0] loops_1000_loop2225_819;
+reg [31:0] loops_1000_loop2225_819_reg;
+reg [63:0] loops_1000_loop2225_820;
+reg [63:0] loops_1000_loop2225_820_reg;
+reg [31:0] loops_1000_loop2225_821;
+reg [2:0] loops_1000_loop2225_821_reg;
+reg  loops_1000_loop2225_822;
+reg  loops_1000_loop2225_822_reg;
+reg [31:0] loops_1000_exit2226_823;
+reg [2:0] loops_1000_exit2226_823_reg;
+reg  loops_1000_exit2226_824;
+reg  loops_1000_exit2226_824_reg;
+reg [31:0] loops_1000_exit1227_825;
+reg [2:0] loops_1000_exit1227_825_reg;
+reg  loops_1000_exit1227_826;
+reg  loops_1000_exit1227_826_reg;
+wire [1:0] loops_1000_loop0229_827;
+reg [1:0] loops_1000_loop0229_827_reg;
+wire [63:0] loops_1000_loop0229_828;
+reg [63:0] loops_1000_loop0229_828_reg;
+wire [1:0] loops_1000_loop1230_829;
+reg [1:0] loops_1000_loop1230_829_reg;
+wire [63:0] loops_1000_loop1230_830;
+reg [63:0] loops_1000_loop1230_830_reg;
+wire [1:0] loops_1000_loop2231_831;
+reg [1:0] loops_1000_loop2231_831_reg;
+wire [63:0] loops_1000_loop2231_832;
+reg [63:0] loops_1000_loop2231_832_reg;
+reg [15:0] loops_1000_loop2231_834;
+reg [15:0] loops_1000_loop2231_834_reg;
+reg [15:0] loops_1000_loop2231_835;
+reg [15:0] loops_1000_loop2231_835_reg;
+reg [15:0] loops_1000_loop2231_836;
+reg [15:0] loops_1000_loop2231_836_reg;
+reg [7:0] loops_1000_loop2231_839;
+reg [7:0] loops_1000_loop2231_839_reg;
+reg [7:0] loops_1000_loop2231_840;
+reg [7:0] loops_1000_loop2231_840_reg;
+reg [63:0] loops_1000_loop2231_841;
+reg [63:0] loops_1000_loop2231_841_reg;
+reg [31:0] loops_1000_loop2231_842;
+reg [2:0] loops_1000_loop2231_842_reg;
+reg  loops_1000_loop2231_843;
+reg  loops_1000_loop2231_843_reg;
+reg [31:0] loops_1000_exit2232_844;
+reg [2:0] loops_1000_exit2232_844_reg;
+reg  loops_1000_exit2232_845;
+reg  loops_1000_exit2232_845_reg;
+reg [31:0] loops_1000_exit1233_846;
+reg [2:0] loops_1000_exit1233_846_reg;
+reg  loops_1000_exit1233_847;
+reg  loops_1000_exit1233_847_reg;
+reg [2:0] loops_1000_loop2_icmp_8_0_op0;
+reg [2:0] loops_1000_loop2_icmp_8_0_op1;
+reg  loops_1000_loop2_icmp_8_0;
+reg [7:0] loops_1000_loop2_add_8_8_0_op0;
+reg [7:0] loops_1000_loop2_add_8_8_0_op1;
+reg [7:0] loops_1000_loop2_add_8_8_0;
+reg [7:0] loops_1000_loop2_mul_8_8_0_op0;
+reg [7:0] loops_1000_loop2_mul_8_8_0_op1;
+reg [7:0] loops_1000_loop2_mul_8_8_0;
+reg [7:0] loops_1000_loop2_and_8_8_0_op0;
+reg [7:0] loops_1000_loop2_and_8_8_0_op1;
+reg [7:0] loops_1000_loop2_and_8_8_0;
+reg [31:0] loops_1000_loop2_or_32_32_0_op0;
+reg [31:0] loops_1000_loop2_or_32_32_0_op1;
+reg [31:0] loops_1000_loop2_or_32_32_0;
+reg [15:0] loops_1000_loop2_add_16_16_0_op0;
+reg [15:0] loops_1000_loop2_add_16_16_0_op1;
+reg [15:0] loops_1000_loop2_add_16_16_0;
+reg [15:0] loops_1000_loop2_and_16_16_0_op0;
+reg [15:0] loops_1000_loop2_and_16_16_0_op1;
+reg [15:0] loops_1000_loop2_and_16_16_0;
+reg [2:0] loops_1000_exit2_icmp_8_0_op0;
+reg [2:0] loops_1000_exit2_icmp_8_0_op1;
+reg  loops_1000_exit2_icmp_8_0;
+reg [7:0] loops_1000_exit2_add_8_8_0_op0;
+reg [7:0] loops_1000_exit2_add_8_8_0_op1;
+reg [7:0] loops_1000_exit2_add_8_8_0;
+reg [2:0] loops_1000_exit1_icmp_8_0_op0;
+reg [2:0] loops_1000_exit1_icmp_8_0_op1;
+reg  loops_1000_exit1_icmp_8_0;
+reg [7:0] loops_1000_exit1_add_8_8_0_op0;
+reg [7:0] loops_1000_exit1_add_8_8_0_op1;
+reg [7:0] loops_1000_exit1_add_8_8_0;
+reg [7:0] loops_1000_loop23_or_8_8_0_op0;
+reg [7:0] loops_1000_loop23_or_8_8_0_op1;
+reg [7:0] loops_1000_loop23_or_8_8_0;
+reg [7:0] loops_1000_loop23_add_8_8_0_op0;
+reg [7:0] loops_1000_loop23_add_8_8_0_op1;
+reg [7:0] loops_1000_loop23_add_8_8_0;
+reg [7:0] loops_1000_loop23_add_8_8_1_op0;
+reg [7:0] loops_1000_loop23_add_8_8_1_op1;
+reg [7:0] loops_1000_loop23_add_8_8_1;
+reg [15:0] loops_1000_loop23_add_16_16_0_op0;
+reg [15:0] loops_1000_loop23_add_16_16_0_op1;
+reg [15:0] loops_1000_loop23_add_16_16_0;
+reg [2:0] loops_1000_loop23_icmp_8_0_op0;
+reg [2:0] loops_1000_loop23_icmp_8_0_op1;
+reg  loops_1000_loop23_icmp_8_0;
+reg [2:0] loops_1000_exit24_icmp_8_0_op0;
+reg [2:0] loops_1000_exit24_icmp_8_0_op1;
+reg  loops_1000_exit24_icmp_8_0;
+reg [7:0] loops_1000_exit24_add_8_8_1_op0;
+reg [7:0] loops_1000_exit24_add_8_8_1_op1;
+reg [7:0] loops_1000_exit24_add_8_8_1;
+reg [2:0] loops_1000_exit15_icmp_8_0_op0;
+reg [2:0] loops_1000_exit15_icmp_8_0_op1;
+reg  loops_1000_exit15_icmp_8_0;
+reg [7:0] loops_1000_exit15_add_8_8_0_op0;
+reg [7:0] loops_1000_exit15_add_8_8_0_op1;
+reg [7:0] loops_1000_exit15_add_8_8_0;
+reg [2:0] loops_1000_loop29_icmp_8_0_op0;
+reg [2:0] loops_1000_loop29_icmp_8_0_op1;
+reg  loops_1000_loop29_icmp_8_0;
+reg [7:0] loops_1000_loop29_add_8_8_1_op0;
+reg [7:0] loops_1000_loop29_add_8_8_1_op1;
+reg [7:0] loops_1000_loop29_add_8_8_1;
+reg [31:0] loops_1000_loop29_and_32_32_0_op0;
+reg [31:0] loops_1000_loop29_and_32_32_0_op1;
+reg [31:0] loops_1000_loop29_and_32_32_0;
+reg [15:0] loops_1000_loop29_and_16_16_0_op0;
+reg [15:0] loops_1000_loop29_and_16_16_0_op1;
+reg [15:0] loops_1000_loop29_and_16_16_0;
+reg [2:0] loops_1000_exit210_icmp_8_0_op0;
+reg [2:0] loops_1000_exit210_icmp_8_0_op1;
+reg  loops_1000_exit210_icmp_8_0;
+reg [7:0] loops_1000_exit210_add_8_8_0_op0;
+reg [7:0] loops_1000_exit210_add_8_8_0_op1;
+reg [7:0] loops_1000_exit210_add_8_8_0;
+reg [2:0] loops_1000_exit111_icmp_8_0_op0;
+reg [2:0] loops_1000_exit111_icmp_8_0_op1;
+reg  loops_1000_exit111_icmp_8_0;
+reg [7:0] loops_1000_exit111_add_8_8_1_op0;
+reg [7:0] loops_1000_exit111_add_8_8_1_op1;
+reg [7:0] loops_1000_exit111_add_8_8_1;
+reg [2:0] loops_1000_loop215_icmp_8_0_op0;
+reg [2:0] loops_1000_loop215_icmp_8_0_op1;
+reg  loops_1000_loop215_icmp_8_0;
+reg [7:0] loops_1000_loop215_add_8_8_0_op0;
+reg [7:0] loops_1000_loop215_add_8_8_0_op1;
+reg [7:0] loops_1000_loop215_add_8_8_0;
+reg [7:0] loops_1000_loop215_mul_8_8_0_op0;
+reg [7:0] loops_1000_loop215_mul_8_8_0_op1;
+reg [7:0] loops_1000_loop215_mul_8_8_0;
+reg [15:0] loops_1000_loop215_add_16_16_0_op0;
+reg [15:0] loops_1000_loop215_add_16_16_0_op1;
+reg [15:0] loops_1000_loop215_add_16_16_0;
+reg [15:0] loops_1000_loop215_mul_16_16_0_op0;
+reg [15:0] loops_1000_loop215_mul_16_16_0_op1;
+reg [15:0] loops_1000_loop215_mul_16_16_0;
+reg [2:0] loops_1000_exit216_icmp_8_0_op0;
+reg [2:0] loops_1000_exit216_icmp_8_0_op1;
+reg  loops_1000_exit216_icmp_8_0;
+reg [7:0] loops_1000_exit216_add_8_8_1_op0;
+reg [7:0] loops_1000_exit216_add_8_8_1_op1;
+reg [7:0] loops_1000_exit216_add_8_8_1;
+reg [2:0] loops_1000_exit117_icmp_8_0_op0;
+reg [2:0] loops_1000_exit117_icmp_8_0_op1;
+reg  loops_1000_exit117_icmp_8_0;
+reg [7:0] loops_1000_exit117_add_8_8_0_op0;
+reg [7:0] loops_1000_exit117_add_8_8_0_op1;
+reg [7:0] loops_1000_exit117_add_8_8_0;
+reg [2:0] loops_1000_loop221_icmp_8_0_op0;
+reg [2:0] loops_1000_loop221_icmp_8_0_op1;
+reg  loops_1000_loop221_icmp_8_0;
+reg [7:0] loops_1000_loop221_add_8_8_1_op0;
+reg [7:0] loops_1000_loop221_add_8_8_1_op1;
+reg [7:0] loops_1000_loop221_add_8_8_1;
+reg [7:0] loops_1000_loop221_add_8_8_0_op0;
+reg [7:0] loops_1000_loop221_add_8_8_0_op1;
+reg [7:0] loops_1000_loop221_add_8_8_0;
+reg [7:0] loops_1000_loop221_and_8_8_0_op0;
+reg [7:0] loops_1000_loop221_and_8_8_0_op1;
+reg [7:0] loops_1000_loop221_and_8_8_0;
+reg [2:0] loops_1000_exit222_icmp_8_0_op0;
+reg [2:0] loops_1000_exit222_icmp_8_0_op1;
+reg  loops_1000_exit222_icmp_8_0;
+reg [7:0] loops_1000_exit222_add_8_8_0_op0;
+reg [7:0] loops_1000_exit222_add_8_8_0_op1;
+reg [7:0] loops_1000_exit222_add_8_8_0;
+reg [2:0] loops_1000_exit123_icmp_8_0_op0;
+reg [2:0] loops_1000_exit123_icmp_8_0_op1;
+reg  loops_1000_exit123_icmp_8_0;
+reg [7:0] loops_1000_exit123_add_8_8_1_op0;
+reg [7:0] loops_1000_exit123_add_8_8_1_op1;
+reg [7:0] loops_1000_exit123_add_8_8_1;
+reg [7:0] loops_1000_loop227_or_8_8_0_op0;
+reg [7:0] loops_1000_loop227_or_8_8_0_op1;
+reg [7:0] loops_1000_loop227_or_8_8_0;
+reg [2:0] loops_1000_loop227_icmp_8_0_op0;
+reg [2:0] loops_1000_loop227_icmp_8_0_op1;
+reg  loops_1000_loop227_icmp_8_0;
+reg [7:0] loops_1000_loop227_add_8_8_0_op0;
+reg [7:0] loops_1000_loop227_add_8_8_0_op1;
+reg [7:0] loops_1000_loop227_add_8_8_0;
+reg [31:0] loops_1000_loop227_or_32_32_0_op0;
+reg [31:0] loops_1000_loop227_or_32_32_0_op1;
+reg [31:0] loops_1000_loop227_or_32_32_0;
+reg [15:0] loops_1000_loop227_and_16_16_0_op0;
+reg [15:0] loops_1000_loop227_and_16_16_0_op1;
+reg [15:0] loops_1000_loop227_and_16_16_0;
+reg [2:0] loops_1000_exit228_icmp_8_0_op0;
+reg [2:0] loops_1000_exit228_icmp_8_0_op1;
+reg  loops_1000_exit228_icmp_8_0;
+reg [7:0] loops_1000_exit228_add_8_8_1_op0;
+reg [7:0] loops_1000_exit228_add_8_8_1_op1;
+reg [7:0] loops_1000_exit228_add_8_8_1;
+reg [2:0] loops_1000_exit129_icmp_8_0_op0;
+reg [2:0] loops_1000_exit129_icmp_8_0_op1;
+reg  loops_1000_exit129_icmp_8_0;
+reg [7:0] loops_1000_exit129_add_8_8_0_op0;
+reg [7:0] loops_1000_exit129_add_8_8_0_op1;
+reg [7:0] loops_1000_exit129_add_8_8_0;
+reg [7:0] loops_1000_loop233_add_8_8_0_op0;
+reg [7:0] loops_1000_loop233_add_8_8_0_op1;
+reg [7:0] loops_1000_loop233_add_8_8_0;
+reg [7:0] loops_1000_loop233_add_8_8_1_op0;
+reg [7:0] loops_1000_loop233_add_8_8_1_op1;
+reg [7:0] loops_1000_loop233_add_8_8_1;
+reg [31:0] loops_1000_loop233_and_32_32_0_op0;
+reg [31:0] loops_1000_loop233_and_32_32_0_op1;
+reg [31:0] loops_1000_loop233_and_32_32_0;
+reg [7:0] loops_1000_loop233_and_8_8_0_op0;
+reg [7:0] loops_1000_loop233_and_8_8_0_op1;
+reg [7:0] loops_1000_loop233_and_8_8_0;
+reg [15:0] loops_1000_loop233_add_16_16_0_op0;
+reg [15:0] loops_1000_loop233_add_16_16_0_op1;
+reg [15:0] loops_1000_loop233_add_16_16_0;
+reg [2:0] loops_1000_loop233_icmp_8_0_op0;
+reg [2:0] loops_1000_loop233_icmp_8_0_op1;
+reg  loops_1000_loop233_icmp_8_0;
+reg [2:0] loops_1000_exit234_icmp_8_0_op0;
+reg [2:0] loops_1000_exit234_icmp_8_0_op1;
+reg  loops_1000_exit234_icmp_8_0;
+reg [7:0] loops_1000_exit234_add_8_8_1_op0;
+reg [7:0] loops_1000_exit234_add_8_8_1_op1;
+reg [7:0] loops_1000_exit234_add_8_8_1;
+reg [2:0] loops_1000_exit135_icmp_8_0_op0;
+reg [2:0] loops_1000_exit135_icmp_8_0_op1;
+reg  loops_1000_exit135_icmp_8_0;
+reg [7:0] loops_1000_exit135_add_8_8_0_op0;
+reg [7:0] loops_1000_exit135_add_8_8_0_op1;
+reg [7:0] loops_1000_exit135_add_8_8_0;
+reg [2:0] loops_1000_loop239_icmp_8_0_op0;
+reg [2:0] loops_1000_loop239_icmp_8_0_op1;
+reg  loops_1000_loop239_icmp_8_0;
+reg [7:0] loops_1000_loop239_add_8_8_1_op0;
+reg [7:0] loops_1000_loop239_add_8_8_1_op1;
+reg [7:0] loops_1000_loop239_add_8_8_1;
+reg [31:0] loops_1000_loop239_mul_32_32_0_op0;
+reg [31:0] loops_1000_loop239_mul_32_32_0_op1;
+reg [31:0] loops_1000_loop239_mul_32_32_0;
+reg [7:0] loops_1000_loop239_mul_8_8_0_op0;
+reg [7:0] loops_1000_loop239_mul_8_8_0_op1;
+reg [7:0] loops_1000_loop239_mul_8_8_0;
+reg [31:0] loops_1000_loop239_and_32_32_0_op0;
+reg [31:0] loops_1000_loop239_and_32_32_0_op1;
+reg [31:0] loops_1000_loop239_and_32_32_0;
+reg [2:0] loops_1000_exit240_icmp_8_0_op0;
+reg [2:0] loops_1000_exit240_icmp_8_0_op1;
+reg  loops_1000_exit240_icmp_8_0;
+reg [7:0] loops_1000_exit240_add_8_8_0_op0;
+reg [7:0] loops_1000_exit240_add_8_8_0_op1;
+reg [7:0] loops_1000_exit240_add_8_8_0;
+reg [2:0] loops_1000_exit141_icmp_8_0_op0;
+reg [2:0] loops_1000_exit141_icmp_8_0_op1;
+reg  loops_1000_exit141_icmp_8_0;
+reg [7:0] loops_1000_exit141_add_8_8_1_op0;
+reg [7:0] loops_1000_exit141_add_8_8_1_op1;
+reg [7:0] loops_1000_exit141_add_8_8_1;
+reg [2:0] loops_1000_loop245_icmp_8_0_op0;
+reg [2:0] loops_1000_loop245_icmp_8_0_op1;
+reg  loops_1000_loop245_icmp_8_0;
+reg [7:0] loops_1000_loop245_add_8_8_0_op0;
+reg [7:0] loops_1000_loop245_add_8_8_0_op1;
+reg [7:0] loops_1000_loop245_add_8_8_0;
+reg [31:0] loops_1000_loop245_and_32_32_0_op0;
+reg [31:0] loops_1000_loop245_and_32_32_0_op1;
+reg [31:0] loops_1000_loop245_and_32_32_0;
+reg [7:0] loops_1000_loop245_and_8_8_0_op0;
+reg [7:0] loops_1000_loop245_and_8_8_0_op1;
+reg [7:0] loops_1000_loop245_and_8_8_0;
+reg [15:0] loops_1000_loop245_or_16_16_0_op0;
+reg [15:0] loops_1000_loop245_or_16_16_0_op1;
+reg [15:0] loops_1000_loop245_or_16_16_0;
+reg [15:0] loops_1000_loop245_add_16_16_0_op0;
+reg [15:0] loops_1000_loop245_add_16_16_0_op1;
+reg [15:0] loops_1000_loop245_add_16_16_0;
+reg [15:0] loops_1000_loop245_add_16_16_1_op0;
+reg [15:0] loops_1000_loop245_add_16_16_1_op1;
+reg [15:0] loops_1000_loop245_add_16_16_1;
+reg [15:0] loops_1000_loop245_mul_16_16_0_op0;
+reg [15:0] loops_1000_loop245_mul_16_16_0_op1;
+reg [15:0] loops_1000_loop245_mul_16_16_0;
+reg [2:0] loops_1000_exit246_icmp_8_0_op0;
+reg [2:0] loops_1000_exit246_icmp_8_0_op1;
+reg  loops_1000_exit246_icmp_8_0;
+reg [7:0] loops_1000_exit246_add_8_8_1_op0;
+reg [7:0] loops_1000_exit246_add_8_8_1_op1;
+reg [7:0] loops_1000_exit246_add_8_8_1;
+reg [2:0] loops_1000_exit147_icmp_8_0_op0;
+reg [2:0] loops_1000_exit147_icmp_8_0_op1;
+reg  loops_1000_exit147_icmp_8_0;
+reg [7:0] loops_1000_exit147_add_8_8_0_op0;
+reg [7:0] loops_1000_exit147_add_8_8_0_op1;
+reg [7:0] loops_1000_exit147_add_8_8_0;
+reg [2:0] loops_1000_loop251_icmp_8_0_op0;
+reg [2:0] loops_1000_loop251_icmp_8_0_op1;
+reg  loops_1000_loop251_icmp_8_0;
+reg [7:0] loops_1000_loop251_add_8_8_1_op0;
+reg [7:0] loops_1000_loop251_add_8_8_1_op1;
+reg [7:0] loops_1000_loop251_add_8_8_1;
+reg [15:0] loops_1000_loop251_or_16_16_0_op0;
+reg [15:0] loops_1000_loop251_or_16_16_0_op1;
+reg [15:0] loops_1000_loop251_or_16_16_0;
+reg [15:0] loops_1000_loop251_add_16_16_1_op0;
+reg [15:0] loops_1000_loop251_add_16_16_1_op1;
+reg [15:0] loops_1000_loop251_add_16_16_1;
+reg [15:0] loops_1000_loop251_mul_16_16_0_op0;
+reg [15:0] loops_1000_loop251_mul_16_16_0_op1;
+reg [15:0] loops_1000_loop251_mul_16_16_0;
+reg [2:0] loops_1000_exit252_icmp_8_0_op0;
+reg [2:0] loops_1000_exit252_icmp_8_0_op1;
+reg  loops_1000_exit252_icmp_8_0;
+reg [7:0] loops_1000_exit252_add_8_8_0_op0;
+reg [7:0] loops_1000_exit252_add_8_8_0_op1;
+reg [7:0] loops_1000_exit252_add_8_8_0;
+reg [2:0] loops_1000_exit153_icmp_8_0_op0;
+reg [2:0] loops_1000_exit153_icmp_8_0_op1;
+reg  loops_1000_exit153_icmp_8_0;
+reg [7:0] loops_1000_exit153_add_8_8_1_op0;
+reg [7:0] loops_1000_exit153_add_8_8_1_op1;
+reg [7:0] loops_1000_exit153_add_8_8_1;
+reg [2:0] loops_1000_loop257_icmp_8_0_op0;
+reg [2:0] loops_1000_loop257_icmp_8_0_op1;
+reg  loops_1000_loop257_icmp_8_0;
+reg [7:0] loops_1000_loop257_add_8_8_0_op0;
+reg [7:0] loops_1000_loop257_add_8_8_0_op1;
+reg [7:0] loops_1000_loop257_add_8_8_0;
+reg [7:0] loops_1000_loop257_and_8_8_0_op0;
+reg [7:0] loops_1000_loop257_and_8_8_0_op1;
+reg [7:0] loops_1000_loop257_and_8_8_0;
+reg [31:0] loops_1000_loop257_or_32_32_0_op0;
+reg [31:0] loops_1000_loop257_or_32_32_0_op1;
+reg [31:0] loops_1000_loop257_or_32_32_0;
+reg [15:0] loops_1000_loop257_mul_16_16_0_op0;
+reg [15:0] loops_1000_loop257_mul_16_16_0_op1;
+reg [15:0] loops_1000_loop257_mul_16_16_0;
+reg [2:0] loops_1000_exit258_icmp_8_0_op0;
+reg [2:0] loops_1000_exit258_icmp_8_0_op1;
+reg  loops_1000_exit258_icmp_8_0;
+reg [7:0] loops_1000_exit258_add_8_8_1_op0;
+reg [7:0] loops_1000_exit258_add_8_8_1_op1;
+reg [7:0] loops_1000_exit258_add_8_8_1;
+reg [2:0] loops_1000_exit159_icmp_8_0_op0;
+reg [2:0] loops_1000_exit159_icmp_8_0_op1;
+reg  loops_1000_exit159_icmp_8_0;
+reg [7:0] loops_1000_exit159_add_8_8_0_op0;
+reg [7:0] loops_1000_exit159_add_8_8_0_op1;
+reg [7:0] loops_1000_exit159_add_8_8_0;
+reg [2:0] loops_1000_loop263_icmp_8_0_op0;
+reg [2:0] loops_1000_loop263_icmp_8_0_op1;
+reg  loops_1000_loop263_icmp_8_0;
+reg [7:0] loops_1000_loop263_add_8_8_1_op0;
+reg [7:0] loops_1000_loop263_add_8_8_1_op1;
+reg [7:0] loops_1000_loop263_add_8_8_1;
+reg [7:0] loops_1000_loop263_add_8_8_0_op0;
+reg [7:0] loops_1000_loop263_add_8_8_0_op1;
+reg [7:0] loops_1000_loop263_add_8_8_0;
+reg [7:0] loops_1000_loop263_mul_8_8_0_op0;
+reg [7:0] loops_1000_loop263_mul_8_8_0_op1;
+reg [7:0] loops_1000_loop263_mul_8_8_0;
+reg [15:0] loops_1000_loop263_add_16_16_1_op0;
+reg [15:0] loops_1000_loop263_add_16_16_1_op1;
+reg [15:0] loops_1000_loop263_add_16_16_1;
+reg [2:0] loops_1000_exit264_icmp_8_0_op0;
+reg [2:0] loops_1000_exit264_icmp_8_0_op1;
+reg  loops_1000_exit264_icmp_8_0;
+reg [7:0] loops_1000_exit264_add_8_8_0_op0;
+reg [7:0] loops_1000_exit264_add_8_8_0_op1;
+reg [7:0] loops_1000_exit264_add_8_8_0;
+reg [2:0] loops_1000_exit165_icmp_8_0_op0;
+reg [2:0] loops_1000_exit165_icmp_8_0_op1;
+reg  loops_1000_exit165_icmp_8_0;
+reg [7:0] loops_1000_exit165_add_8_8_1_op0;
+reg [7:0] loops_1000_exit165_add_8_8_1_op1;
+reg [7:0] loops_1000_exit165_add_8_8_1;
+reg [7:0] loops_1000_loop269_or_8_8_0_op0;
+reg [7:0] loops_1000_loop269_or_8_8_0_op1;
+reg [7:0] loops_1000_loop269_or_8_8_0;
+reg [2:0] loops_1000_loop269_icmp_8_0_op0;
+reg [2:0] loops_1000_loop269_icmp_8_0_op1;
+reg  loops_1000_loop269_icmp_8_0;
+reg [7:0] loops_1000_loop269_add_8_8_0_op0;
+reg [7:0] loops_1000_loop269_add_8_8_0_op1;
+reg [7:0] loops_1000_loop269_add_8_8_0;
+reg [31:0] loops_1000_loop269_add_32_32_0_op0;
+reg [31:0] loops_1000_loop269_add_32_32_0_op1;
+reg [31:0] loops_1000_loop269_add_32_32_0;
+reg [31:0] loops_1000_loop269_or_32_32_0_op0;
+reg [31:0] loops_1000_loop269_or_32_32_0_op1;
+reg [31:0] loops_1000_loop269_or_32_32_0;
+reg [15:0] loops_1000_loop269_add_16_16_0_op0;
+reg [15:0] loops_1000_loop269_add_16_16_0_op1;
+reg [15:0] loops_1000_loop269_add_16_16_0;
+reg [2:0] loops_1000_exit270_icmp_8_0_op0;
+reg [2:0] loops_1000_exit270_icmp_8_0_op1;
+reg  loops_1000_exit270_icmp_8_0;
+reg [7:0] loops_1000_exit270_add_8_8_1_op0;
+reg [7:0] loops_1000_exit270_add_8_8_1_op1;
+reg [7:0] loops_1000_exit270_add_8_8_1;
+reg [2:0] loops_1000_exit171_icmp_8_0_op0;
+reg [2:0] loops_1000_exit171_icmp_8_0_op1;
+reg  loops_1000_exit171_icmp_8_0;
+reg [7:0] loops_1000_exit171_add_8_8_0_op0;
+reg [7:0] loops_1000_exit171_add_8_8_0_op1;
+reg [7:0] loops_1000_exit171_add_8_8_0;
+reg [2:0] loops_1000_loop275_icmp_8_0_op0;
+reg [2:0] loops_1000_loop275_icmp_8_0_op1;
+reg  loops_1000_loop275_icmp_8_0;
+reg [7:0] loops_1000_loop275_add_8_8_1_op0;
+reg [7:0] loops_1000_loop275_add_8_8_1_op1;
+reg [7:0] loops_1000_loop275_add_8_8_1;
+reg [7:0] loops_1000_loop275_mul_8_8_0_op0;
+reg [7:0] loops_1000_loop275_mul_8_8_0_op1;
+reg [7:0] loops_1000_loop275_mul_8_8_0;
+reg [15:0] loops_1000_loop275_add_16_16_1_op0;
+reg [15:0] loops_1000_loop275_add_16_16_1_op1;
+reg [15:0] loops_1000_loop275_add_16_16_1;
+reg [15:0] loops_1000_loop275_mul_16_16_0_op0;
+reg [15:0] loops_1000_loop275_mul_16_16_0_op1;
+reg [15:0] loops_1000_loop275_mul_16_16_0;
+reg [2:0] loops_1000_exit276_icmp_8_0_op0;
+reg [2:0] loops_1000_exit276_icmp_8_0_op1;
+reg  loops_1000_exit276_icmp_8_0;
+reg [7:0] loops_1000_exit276_add_8_8_0_op0;
+reg [7:0] loops_1000_exit276_add_8_8_0_op1;
+reg [7:0] loops_1000_exit276_add_8_8_0;
+reg [2:0] loops_1000_exit177_icmp_8_0_op0;
+reg [2:0] loops_1000_exit177_icmp_8_0_op1;
+reg  loops_1000_exit177_icmp_8_0;
+reg [7:0] loops_1000_exit177_add_8_8_1_op0;
+reg [7:0] loops_1000_exit177_add_8_8_1_op1;
+reg [7:0] loops_1000_exit177_add_8_8_1;
+reg [2:0] loops_1000_loop281_icmp_8_0_op0;
+reg [2:0] loops_1000_loop281_icmp_8_0_op1;
+reg  loops_1000_loop281_icmp_8_0;
+reg [7:0] loops_1000_loop281_add_8_8_0_op0;
+reg [7:0] loops_1000_loop281_add_8_8_0_op1;
+reg [7:0] loops_1000_loop281_add_8_8_0;
+reg [7:0] loops_1000_loop281_add_8_8_1_op0;
+reg [7:0] loops_1000_loop281_add_8_8_1_op1;
+reg [7:0] loops_1000_loop281_add_8_8_1;
+reg [31:0] loops_1000_loop281_add_32_32_0_op0;
+reg [31:0] loops_1000_loop281_add_32_32_0_op1;
+reg [31:0] loops_1000_loop281_add_32_32_0;
+reg [7:0] loops_1000_loop281_mul_8_8_0_op0;
+reg [7:0] loops_1000_loop281_mul_8_8_0_op1;
+reg [7:0] loops_1000_loop281_mul_8_8_0;
+reg [2:0] loops_1000_exit282_icmp_8_0_op0;
+reg [2:0] loops_1000_exit282_icmp_8_0_op1;
+reg  loops_1000_exit282_icmp_8_0;
+reg [7:0] loops_1000_exit282_add_8_8_1_op0;
+reg [7:0] loops_1000_exit282_add_8_8_1_op1;
+reg [7:0] loops_1000_exit282_add_8_8_1;
+reg [2:0] loops_1000_exit183_icmp_8_0_op0;
+reg [2:0] loops_1000_exit183_icmp_8_0_op1;
+reg  loops_1000_exit183_icmp_8_0;
+reg [7:0] loops_1000_exit183_add_8_8_0_op0;
+reg [7:0] loops_1000_exit183_add_8_8_0_op1;
+reg [7:0] loops_1000_exit183_add_8_8_0;
+reg [7:0] loops_1000_loop287_or_8_8_0_op0;
+reg [7:0] loops_1000_loop287_or_8_8_0_op1;
+reg [7:0] loops_1000_loop287_or_8_8_0;
+reg [2:0] loops_1000_loop287_icmp_8_0_op0;
+reg [2:0] loops_1000_loop287_icmp_8_0_op1;
+reg  loops_1000_loop287_icmp_8_0;
+reg [7:0] loops_1000_loop287_add_8_8_1_op0;
+reg [7:0] loops_1000_loop287_add_8_8_1_op1;
+reg [7:0] loops_1000_loop287_add_8_8_1;
+reg [7:0] loops_1000_loop287_add_8_8_0_op0;
+reg [7:0] loops_1000_loop287_add_8_8_0_op1;
+reg [7:0] loops_1000_loop287_add_8_8_0;
+reg [31:0] loops_1000_loop287_add_32_32_0_op0;
+reg [31:0] loops_1000_loop287_add_32_32_0_op1;
+reg [31:0] loops_1000_loop287_add_32_32_0;
+reg [31:0] loops_1000_loop287_mul_32_32_0_op0;
+reg [31:0] loops_1000_loop287_mul_32_32_0_op1;
+reg [31:0] loops_1000_loop287_mul_32_32_0;
+reg [15:0] loops_1000_loop287_add_16_16_0_op0;
+reg [15:0] loops_1000_loop287_add_16_16_0_op1;
+reg [15:0] loops_1000_loop287_add_16_16_0;
+reg [2:0] loops_1000_exit288_icmp_8_0_op0;
+reg [2:0] loops_1000_exit288_icmp_8_0_op1;
+reg  loops_1000_exit288_icmp_8_0;
+reg [7:0] loops_1000_exit288_add_8_8_1_op0;
+reg [7:0] loops_1000_exit288_add_8_8_1_op1;
+reg [7:0] loops_1000_exit288_add_8_8_1;
+reg [2:0] loops_1000_exit189_icmp_8_0_op0;
+reg [2:0] loops_1000_exit189_icmp_8_0_op1;
+reg  loops_1000_exit189_icmp_8_0;
+reg [7:0] loops_1000_exit189_add_8_8_1_op0;
+reg [7:0] loops_1000_exit189_add_8_8_1_op1;
+reg [7:0] loops_1000_exit189_add_8_8_1;
+reg [2:0] loops_1000_loop293_icmp_8_0_op0;
+reg [2:0] loops_1000_loop293_icmp_8_0_op1;
+reg  loops_1000_loop293_icmp_8_0;
+reg [7:0] loops_1000_loop293_add_8_8_0_op0;
+reg [7:0] loops_1000_loop293_add_8_8_0_op1;
+reg [7:0] loops_1000_loop293_add_8_8_0;
+reg [31:0] loops_1000_loop293_add_32_32_0_op0;
+reg [31:0] loops_1000_loop293_add_32_32_0_op1;
+reg [31:0] loops_1000_loop293_add_32_32_0;
+reg [7:0] loops_1000_loop293_mul_8_8_0_op0;
+reg [7:0] loops_1000_loop293_mul_8_8_0_op1;
+reg [7:0] loops_1000_loop293_mul_8_8_0;
+reg [7:0] loops_1000_loop293_and_8_8_0_op0;
+reg [7:0] loops_1000_loop293_and_8_8_0_op1;
+reg [7:0] loops_1000_loop293_and_8_8_0;
+reg [15:0] loops_1000_loop293_mul_16_16_0_op0;
+reg [15:0] loops_1000_loop293_mul_16_16_0_op1;
+reg [15:0] loops_1000_loop293_mul_16_16_0;
+reg [2:0] loops_1000_exit294_icmp_8_0_op0;
+reg [2:0] loops_1000_exit294_icmp_8_0_op1;
+reg  loops_1000_exit294_icmp_8_0;
+reg [7:0] loops_1000_exit294_add_8_8_1_op0;
+reg [7:0] loops_1000_exit294_add_8_8_1_op1;
+reg [7:0] loops_1000_exit294_add_8_8_1;
+reg [2:0] loops_1000_exit195_icmp_8_0_op0;
+reg [2:0] loops_1000_exit195_icmp_8_0_op1;
+reg  loops_1000_exit195_icmp_8_0;
+reg [7:0] loops_1000_exit195_add_8_8_0_op0;
+reg [7:0] loops_1000_exit195_add_8_8_0_op1;
+reg [7:0] loops_1000_exit195_add_8_8_0;
+reg [2:0] loops_1000_loop299_icmp_8_0_op0;
+reg [2:0] loops_1000_loop299_icmp_8_0_op1;
+reg  loops_1000_loop299_icmp_8_0;
+reg [7:0] loops_1000_loop299_add_8_8_1_op0;
+reg [7:0] loops_1000_loop299_add_8_8_1_op1;
+reg [7:0] loops_1000_loop299_add_8_8_1;
+reg [31:0] loops_1000_loop299_add_32_32_0_op0;
+reg [31:0] loops_1000_loop299_add_32_32_0_op1;
+reg [31:0] loops_1000_loop299_add_32_32_0;
+reg [7:0] loops_1000_loop299_and_8_8_0_op0;
+reg [7:0] loops_1000_loop299_and_8_8_0_op1;
+reg [7:0] loops_1000_loop299_and_8_8_0;
+reg [15:0] loops_1000_loop299_add_16_16_1_op0;
+reg [15:0] loops_1000_loop299_add_16_16_1_op1;
+reg [15:0] loops_1000_loop299_add_16_16_1;
+reg [15:0] loops_1000_loop299_and_16_16_0_op0;
+reg [15:0] loops_1000_loop299_and_16_16_0_op1;
+reg [15:0] loops_1000_loop299_and_16_16_0;
+reg [2:0] loops_1000_exit2100_icmp_8_0_op0;
+reg [2:0] loops_1000_exit2100_icmp_8_0_op1;
+reg  loops_1000_exit2100_icmp_8_0;
+reg [7:0] loops_1000_exit2100_add_8_8_0_op0;
+reg [7:0] loops_1000_exit2100_add_8_8_0_op1;
+reg [7:0] loops_1000_exit2100_add_8_8_0;
+reg [2:0] loops_1000_exit1101_icmp_8_0_op0;
+reg [2:0] loops_1000_exit1101_icmp_8_0_op1;
+reg  loops_1000_exit1101_icmp_8_0;
+reg [7:0] loops_1000_exit1101_add_8_8_1_op0;
+reg [7:0] loops_1000_exit1101_add_8_8_1_op1;
+reg [7:0] loops_1000_exit1101_add_8_8_1;
+reg [7:0] loops_1000_loop2105_or_8_8_0_op0;
+reg [7:0] loops_1000_loop2105_or_8_8_0_op1;
+reg [7:0] loops_1000_loop2105_or_8_8_0;
+reg [2:0] loops_1000_loop2105_icmp_8_0_op0;
+reg [2:0] loops_1000_loop2105_icmp_8_0_op1;
+reg  loops_1000_loop2105_icmp_8_0;
+reg [7:0] loops_1000_loop2105_add_8_8_0_op0;
+reg [7:0] loops_1000_loop2105_add_8_8_0_op1;
+reg [7:0] loops_1000_loop2105_add_8_8_0;
+reg [31:0] loops_1000_loop2105_mul_32_32_0_op0;
+reg [31:0] loops_1000_loop2105_mul_32_32_0_op1;
+reg [31:0] loops_1000_loop2105_mul_32_32_0;
+reg [7:0] loops_1000_loop2105_mul_8_8_0_op0;
+reg [7:0] loops_1000_loop2105_mul_8_8_0_op1;
+reg [7:0] loops_1000_loop2105_mul_8_8_0;
+reg [15:0] loops_1000_loop2105_or_16_16_0_op0;
+reg [15:0] loops_1000_loop2105_or_16_16_0_op1;
+reg [15:0] loops_1000_loop2105_or_16_16_0;
+reg [15:0] loops_1000_loop2105_add_16_16_0_op0;
+reg [15:0] loops_1000_loop2105_add_16_16_0_op1;
+reg [15:0] loops_1000_loop2105_add_16_16_0;
+reg [2:0] loops_1000_exit2106_icmp_8_0_op0;
+reg [2:0] loops_1000_exit2106_icmp_8_0_op1;
+reg  loops_1000_exit2106_icmp_8_0;
+reg [7:0] loops_1000_exit2106_add_8_8_1_op0;
+reg [7:0] loops_1000_exit2106_add_8_8_1_op1;
+reg [7:0] loops_1000_exit2106_add_8_8_1;
+reg [2:0] loops_1000_exit1107_icmp_8_0_op0;
+reg [2:0] loops_1000_exit1107_icmp_8_0_op1;
+reg  loops_1000_exit1107_icmp_8_0;
+reg [7:0] loops_1000_exit1107_add_8_8_0_op0;
+reg [7:0] loops_1000_exit1107_add_8_8_0_op1;
+reg [7:0] loops_1000_exit1107_add_8_8_0;
+reg [7:0] loops_1000_loop2111_or_8_8_0_op0;
+reg [7:0] loops_1000_loop2111_or_8_8_0_op1;
+reg [7:0] loops_1000_loop2111_or_8_8_0;
+reg [2:0] loops_1000_loop2111_icmp_8_0_op0;
+reg [2:0] loops_1000_loop2111_icmp_8_0_op1;
+reg  loops_1000_loop2111_icmp_8_0;
+reg [7:0] loops_1000_loop2111_add_8_8_1_op0;
+reg [7:0] loops_1000_loop2111_add_8_8_1_op1;
+reg [7:0] loops_1000_loop2111_add_8_8_1;
+reg [31:0] loops_1000_loop2111_and_32_32_0_op0;
+reg [31:0] loops_1000_loop2111_and_32_32_0_op1;
+reg [31:0] loops_1000_loop2111_and_32_32_0;
+reg [2:0] loops_1000_exit2112_icmp_8_0_op0;
+reg [2:0] loops_1000_exit2112_icmp_8_0_op1;
+reg  loops_1000_exit2112_icmp_8_0;
+reg [7:0] loops_1000_exit2112_add_8_8_0_op0;
+reg [7:0] loops_1000_exit2112_add_8_8_0_op1;
+reg [7:0] loops_1000_exit2112_add_8_8_0;
+reg [2:0] loops_1000_exit1113_icmp_8_0_op0;
+reg [2:0] loops_1000_exit1113_icmp_8_0_op1;
+reg  loops_1000_exit1113_icmp_8_0;
+reg [7:0] loops_1000_exit1113_add_8_8_1_op0;
+reg [7:0] loops_1000_exit1113_add_8_8_1_op1;
+reg [7:0] loops_1000_exit1113_add_8_8_1;
+reg [2:0] loops_1000_loop2117_icmp_8_0_op0;
+reg [2:0] loops_1000_loop2117_icmp_8_0_op1;
+reg  loops_1000_loop2117_icmp_8_0;
+reg [7:0] loops_1000_loop2117_add_8_8_0_op0;
+reg [7:0] loops_1000_loop2117_add_8_8_0_op1;
+reg [7:0] loops_1000_loop2117_add_8_8_0;
+reg [31:0] loops_1000_loop2117_mul_32_32_0_op0;
+reg [31:0] loops_1000_loop2117_mul_32_32_0_op1;
+reg [31:0] loops_1000_loop2117_mul_32_32_0;
+reg [15:0] loops_1000_loop2117_or_16_16_0_op0;
+reg [15:0] loops_1000_loop2117_or_16_16_0_op1;
+reg [15:0] loops_1000_loop2117_or_16_16_0;
+reg [2:0] loops_1000_exit2118_icmp_8_0_op0;
+reg [2:0] loops_1000_exit2118_icmp_8_0_op1;
+reg  loops_1000_exit2118_icmp_8_0;
+reg [7:0] loops_1000_exit2118_add_8_8_1_op0;
+reg [7:0] loops_1000_exit2118_add_8_8_1_op1;
+reg [7:0] loops_1000_exit2118_add_8_8_1;
+reg [2:0] loops_1000_exit1119_icmp_8_0_op0;
+reg [2:0] loops_1000_exit1119_icmp_8_0_op1;
+reg  loops_1000_exit1119_icmp_8_0;
+reg [7:0] loops_1000_exit1119_add_8_8_0_op0;
+reg [7:0] loops_1000_exit1119_add_8_8_0_op1;
+reg [7:0] loops_1000_exit1119_add_8_8_0;
+reg [2:0] loops_1000_loop2123_icmp_8_0_op0;
+reg [2:0] loops_1000_loop2123_icmp_8_0_op1;
+reg  loops_1000_loop2123_icmp_8_0;
+reg [7:0] loops_1000_loop2123_add_8_8_1_op0;
+reg [7:0] loops_1000_loop2123_add_8_8_1_op1;
+reg [7:0] loops_1000_loop2123_add_8_8_1;
+reg [7:0] loops_1000_loop2123_add_8_8_0_op0;
+reg [7:0] loops_1000_loop2123_add_8_8_0_op1;
+reg [7:0] loops_1000_loop2123_add_8_8_0;
+reg [31:0] loops_1000_loop2123_add_32_32_0_op0;
+reg [31:0] loops_1000_loop2123_add_32_32_0_op1;
+reg [31:0] loops_1000_loop2123_add_32_32_0;
+reg [31:0] loops_1000_loop2123_and_32_32_0_op0;
+reg [31:0] loops_1000_loop2123_and_32_32_0_op1;
+reg [31:0] loops_1000_loop2123_and_32_32_0;
+reg [15:0] loops_1000_loop2123_or_16_16_0_op0;
+reg [15:0] loops_1000_loop2123_or_16_16_0_op1;
+reg [15:0] loops_1000_loop2123_or_16_16_0;
+reg [2:0] loops_1000_exit2124_icmp_8_0_op0;
+reg [2:0] loops_1000_exit2124_icmp_8_0_op1;
+reg  loops_1000_exit2124_icmp_8_0;
+reg [7:0] loops_1000_exit2124_add_8_8_0_op0;
+reg [7:0] loops_1000_exit2124_add_8_8_0_op1;
+reg [7:0] loops_1000_exit2124_add_8_8_0;
+reg [2:0] loops_1000_exit1125_icmp_8_0_op0;
+reg [2:0] loops_1000_exit1125_icmp_8_0_op1;
+reg  loops_1000_exit1125_icmp_8_0;
+reg [7:0] loops_1000_exit1125_add_8_8_1_op0;
+reg [7:0] loops_1000_exit1125_add_8_8_1_op1;
+reg [7:0] loops_1000_exit1125_add_8_8_1;
+reg [7:0] loops_1000_loop2129_or_8_8_0_op0;
+reg [7:0] loops_1000_loop2129_or_8_8_0_op1;
+reg [7:0] loops_1000_loop2129_or_8_8_0;
+reg [2:0] loops_1000_loop2129_icmp_8_0_op0;
+reg [2:0] loops_1000_loop2129_icmp_8_0_op1;
+reg  loops_1000_loop2129_icmp_8_0;
+reg [7:0] loops_1000_loop2129_add_8_8_0_op0;
+reg [7:0] loops_1000_loop2129_add_8_8_0_op1;
+reg [7:0] loops_1000_loop2129_add_8_8_0;
+reg [7:0] loops_1000_loop2129_and_8_8_0_op0;
+reg [7:0] loops_1000_loop2129_and_8_8_0_op1;
+reg [7:0] loops_1000_loop2129_and_8_8_0;
+reg [31:0] loops_1000_loop2129_or_32_32_0_op0;
+reg [31:0] loops_1000_loop2129_or_32_32_0_op1;
+reg [31:0] loops_1000_loop2129_or_32_32_0;
+reg [2:0] loops_1000_exit2130_icmp_8_0_op0;
+reg [2:0] loops_1000_exit2130_icmp_8_0_op1;
+reg  loops_1000_exit2130_icmp_8_0;
+reg [7:0] loops_1000_exit2130_add_8_8_1_op0;
+reg [7:0] loops_1000_exit2130_add_8_8_1_op1;
+reg [7:0] loops_1000_exit2130_add_8_8_1;
+reg [2:0] loops_1000_exit1131_icmp_8_0_op0;
+reg [2:0] loops_1000_exit1131_icmp_8_0_op1;
+reg  loops_1000_exit1131_icmp_8_0;
+reg [7:0] loops_1000_exit1131_add_8_8_0_op0;
+reg [7:0] loops_1000_exit1131_add_8_8_0_op1;
+reg [7:0] loops_1000_exit1131_add_8_8_0;
+reg [7:0] loops_1000_loop2135_or_8_8_0_op0;
+reg [7:0] loops_1000_loop2135_or_8_8_0_op1;
+reg [7:0] loops_1000_loop2135_or_8_8_0;
+reg [2:0] loops_1000_loop2135_icmp_8_0_op0;
+reg [2:0] loops_1000_loop2135_icmp_8_0_op1;
+reg  loops_1000_loop2135_icmp_8_0;
+reg [7:0] loops_1000_loop2135_add_8_8_1_op0;
+reg [7:0] loops_1000_loop2135_add_8_8_1_op1;
+reg [7:0] loops_1000_loop2135_add_8_8_1;
+reg [7:0] loops_1000_loop2135_mul_8_8_0_op0;
+reg [7:0] loops_1000_loop2135_mul_8_8_0_op1;
+reg [7:0] loops_1000_loop2135_mul_8_8_0;
+reg [15:0] loops_1000_loop2135_add_16_16_1_op0;
+reg [15:0] loops_1000_loop2135_add_16_16_1_op1;
+reg [15:0] loops_1000_loop2135_add_16_16_1;
+reg [15:0] loops_1000_loop2135_add_16_16_0_op0;
+reg [15:0] loops_1000_loop2135_add_16_16_0_op1;
+reg [15:0] loops_1000_loop2135_add_16_16_0;
+reg [2:0] loops_1000_exit2136_icmp_8_0_op0;
+reg [2:0] loops_1000_exit2136_icmp_8_0_op1;
+reg  loops_1000_exit2136_icmp_8_0;
+reg [7:0] loops_1000_exit2136_add_8_8_0_op0;
+reg [7:0] loops_1000_exit2136_add_8_8_0_op1;
+reg [7:0] loops_1000_exit2136_add_8_8_0;
+reg [2:0] loops_1000_exit1137_icmp_8_0_op0;
+reg [2:0] loops_1000_exit1137_icmp_8_0_op1;
+reg  loops_1000_exit1137_icmp_8_0;
+reg [7:0] loops_1000_exit1137_add_8_8_1_op0;
+reg [7:0] loops_1000_exit1137_add_8_8_1_op1;
+reg [7:0] loops_1000_exit1137_add_8_8_1;
+reg [7:0] loops_1000_loop2141_add_8_8_0_op0;
+reg [7:0] loops_1000_loop2141_add_8_8_0_op1;
+reg [7:0] loops_1000_loop2141_add_8_8_0;
+reg [7:0] loops_1000_loop2141_add_8_8_1_op0;
+reg [7:0] loops_1000_loop2141_add_8_8_1_op1;
+reg [7:0] loops_1000_loop2141_add_8_8_1;
+reg [31:0] loops_1000_loop2141_add_32_32_0_op0;
+reg [31:0] loops_1000_loop2141_add_32_32_0_op1;
+reg [31:0] loops_1000_loop2141_add_32_32_0;
+reg [7:0] loops_1000_loop2141_mul_8_8_0_op0;
+reg [7:0] loops_1000_loop2141_mul_8_8_0_op1;
+reg [7:0] loops_1000_loop2141_mul_8_8_0;
+reg [31:0] loops_1000_loop2141_and_32_32_0_op0;
+reg [31:0] loops_1000_loop2141_and_32_32_0_op1;
+reg [31:0] loops_1000_loop2141_and_32_32_0;
+reg [15:0] loops_1000_loop2141_or_16_16_0_op0;
+reg [15:0] loops_1000_loop2141_or_16_16_0_op1;
+reg [15:0] loops_1000_loop2141_or_16_16_0;
+reg [15:0] loops_1000_loop2141_add_16_16_1_op0;
+reg [15:0] loops_1000_loop2141_add_16_16_1_op1;
+reg [15:0] loops_1000_loop2141_add_16_16_1;
+reg [2:0] loops_1000_loop2141_icmp_8_0_op0;
+reg [2:0] loops_1000_loop2141_icmp_8_0_op1;
+reg  loops_1000_loop2141_icmp_8_0;
+reg [2:0] loops_1000_exit2142_icmp_8_0_op0;
+reg [2:0] loops_1000_exit2142_icmp_8_0_op1;
+reg  loops_1000_exit2142_icmp_8_0;
+reg [7:0] loops_1000_exit2142_add_8_8_1_op0;
+reg [7:0] loops_1000_exit2142_add_8_8_1_op1;
+reg [7:0] loops_1000_exit2142_add_8_8_1;
+reg [2:0] loops_1000_exit1143_icmp_8_0_op0;
+reg [2:0] loops_1000_exit1143_icmp_8_0_op1;
+reg  loops_1000_exit1143_icmp_8_0;
+reg [7:0] loops_1000_exit1143_add_8_8_0_op0;
+reg [7:0] loops_1000_exit1143_add_8_8_0_op1;
+reg [7:0] loops_1000_exit1143_add_8_8_0;
+reg [2:0] loops_1000_loop2147_icmp_8_0_op0;
+reg [2:0] loops_1000_loop2147_icmp_8_0_op1;
+reg  loops_1000_loop2147_icmp_8_0;
+reg [7:0] loops_1000_loop2147_add_8_8_1_op0;
+reg [7:0] loops_1000_loop2147_add_8_8_1_op1;
+reg [7:0] loops_1000_loop2147_add_8_8_1;
+reg [31:0] loops_1000_loop2147_add_32_32_0_op0;
+reg [31:0] loops_1000_loop2147_add_32_32_0_op1;
+reg [31:0] loops_1000_loop2147_add_32_32_0;
+reg [7:0] loops_1000_loop2147_mul_8_8_0_op0;
+reg [7:0] loops_1000_loop2147_mul_8_8_0_op1;
+reg [7:0] loops_1000_loop2147_mul_8_8_0;
+reg [31:0] loops_1000_loop2147_and_32_32_0_op0;
+reg [31:0] loops_1000_loop2147_and_32_32_0_op1;
+reg [31:0] loops_1000_loop2147_and_32_32_0;
+reg [31:0] loops_1000_loop2147_or_32_32_0_op0;
+reg [31:0] loops_1000_loop2147_or_32_32_0_op1;
+reg [31:0] loops_1000_loop2147_or_32_32_0;
+reg [15:0] loops_1000_loop2147_add_16_16_0_op0;
+reg [15:0] loops_1000_loop2147_add_16_16_0_op1;
+reg [15:0] loops_1000_loop2147_add_16_16_0;
+reg [15:0] loops_1000_loop2147_add_16_16_1_op0;
+reg [15:0] loops_1000_loop2147_add_16_16_1_op1;
+reg [15:0] loops_1000_loop2147_add_16_16_1;
+reg [2:0] loops_1000_exit2148_icmp_8_0_op0;
+reg [2:0] loops_1000_exit2148_icmp_8_0_op1;
+reg  loops_1000_exit2148_icmp_8_0;
+reg [7:0] loops_1000_exit2148_add_8_8_0_op0;
+reg [7:0] loops_1000_exit2148_add_8_8_0_op1;
+reg [7:0] loops_1000_exit2148_add_8_8_0;
+reg [2:0] loops_1000_exit1149_icmp_8_0_op0;
+reg [2:0] loops_1000_exit1149_icmp_8_0_op1;
+reg  loops_1000_exit1149_icmp_8_0;
+reg [7:0] loops_1000_exit1149_add_8_8_1_op0;
+reg [7:0] loops_1000_exit1149_add_8_8_1_op1;
+reg [7:0] loops_1000_exit1149_add_8_8_1;
+reg [7:0] loops_1000_loop2153_or_8_8_0_op0;
+reg [7:0] loops_1000_loop2153_or_8_8_0_op1;
+reg [7:0] loops_1000_loop2153_or_8_8_0;
+reg [2:0] loops_1000_loop2153_icmp_8_0_op0;
+reg [2:0] loops_1000_loop2153_icmp_8_0_op1;
+reg  loops_1000_loop2153_icmp_8_0;
+reg [7:0] loops_1000_loop2153_add_8_8_0_op0;
+reg [7:0] loops_1000_loop2153_add_8_8_0_op1;
+reg [7:0] loops_1000_loop2153_add_8_8_0;
+reg [7:0] loops_1000_loop2153_add_8_8_1_op0;
+reg [7:0] loops_1000_loop2153_add_8_8_1_op1;
+reg [7:0] loops_1000_loop2153_add_8_8_1;
+reg [31:0] loops_1000_loop2153_and_32_32_0_op0;
+reg [31:0] loops_1000_loop2153_and_32_32_0_op1;
+reg [31:0] loops_1000_loop2153_and_32_32_0;
+reg [15:0] loops_1000_loop2153_add_16_16_1_op0;
+reg [15:0] loops_1000_loop2153_add_16_16_1_op1;
+reg [15:0] loops_1000_loop2153_add_16_16_1;
+reg [2:0] loops_1000_exit2154_icmp_8_0_op0;
+reg [2:0] loops_1000_exit2154_icmp_8_0_op1;
+reg  loops_1000_exit2154_icmp_8_0;
+reg [7:0] loops_1000_exit2154_add_8_8_1_op0;
+reg [7:0] loops_1000_exit2154_add_8_8_1_op1;
+reg [7:0] loops_1000_exit2154_add_8_8_1;
+reg [2:0] loops_1000_exit1155_icmp_8_0_op0;
+reg [2:0] loops_1000_exit1155_icmp_8_0_op1;
+reg  loops_1000_exit1155_icmp_8_0;
+reg [7:0] loops_1000_exit1155_add_8_8_0_op0;
+reg [7:0] loops_1000_exit1155_add_8_8_0_op1;
+reg [7:0] loops_1000_exit1155_add_8_8_0;
+reg [2:0] loops_1000_loop2159_icmp_8_0_op0;
+reg [2:0] loops_1000_loop2159_icmp_8_0_op1;
+reg  loops_1000_loop2159_icmp_8_0;
+reg [7:0] loops_1000_loop2159_add_8_8_1_op0;
+reg [7:0] loops_1000_loop2159_add_8_8_1_op1;
+reg [7:0] loops_1000_loop2159_add_8_8_1;
+reg [7:0] loops_1000_loop2159_add_8_8_0_op0;
+reg [7:0] loops_1000_loop2159_add_8_8_0_op1;
+reg [7:0] loops_1000_loop2159_add_8_8_0;
+reg [31:0] loops_1000_loop2159_add_32_32_0_op0;
+reg [31:0] loops_1000_loop2159_add_32_32_0_op1;
+reg [31:0] loops_1000_loop2159_add_32_32_0;
+reg [7:0] loops_1000_loop2159_and_8_8_0_op0;
+reg [7:0] loops_1000_loop2159_and_8_8_0_op1;
+reg [7:0] loops_1000_loop2159_and_8_8_0;
+reg [31:0] loops_1000_loop2159_or_32_32_0_op0;
+reg [31:0] loops_1000_loop2159_or_32_32_0_op1;
+reg [31:0] loops_1000_loop2159_or_32_32_0;
+reg [2:0] loops_1000_exit2160_icmp_8_0_op0;
+reg [2:0] loops_1000_exit2160_icmp_8_0_op1;
+reg  loops_1000_exit2160_icmp_8_0;
+reg [7:0] loops_1000_exit2160_add_8_8_1_op0;
+reg [7:0] loops_1000_exit2160_add_8_8_1_op1;
+reg [7:0] loops_1000_exit2160_add_8_8_1;
+reg [2:0] loops_1000_exit1161_icmp_8_0_op0;
+reg [2:0] loops_1000_exit1161_icmp_8_0_op1;
+reg  loops_1000_exit1161_icmp_8_0;
+reg [7:0] loops_1000_exit1161_add_8_8_0_op0;
+reg [7:0] loops_1000_exit1161_add_8_8_0_op1;
+reg [7:0] loops_1000_exit1161_add_8_8_0;
+reg [2:0] loops_1000_loop2165_icmp_8_0_op0;
+reg [2:0] loops_1000_loop2165_icmp_8_0_op1;
+reg  loops_1000_loop2165_icmp_8_0;
+reg [7:0] loops_1000_loop2165_add_8_8_1_op0;
+reg [7:0] loops_1000_loop2165_add_8_8_1_op1;
+reg [7:0] loops_1000_loop2165_add_8_8_1;
+reg [7:0] loops_1000_loop2165_add_8_8_0_op0;
+reg [7:0] loops_1000_loop2165_add_8_8_0_op1;
+reg [7:0] loops_1000_loop2165_add_8_8_0;
+reg [31:0] loops_1000_loop2165_add_32_32_0_op0;
+reg [31:0] loops_1000_loop2165_add_32_32_0_op1;
+reg [31:0] loops_1000_loop2165_add_32_32_0;
+reg [15:0] loops_1000_loop2165_add_16_16_1_op0;
+reg [15:0] loops_1000_loop2165_add_16_16_1_op1;
+reg [15:0] loops_1000_loop2165_add_16_16_1;
+reg [2:0] loops_1000_exit2166_icmp_8_0_op0;
+reg [2:0] loops_1000_exit2166_icmp_8_0_op1;
+reg  loops_1000_exit2166_icmp_8_0;
+reg [7:0] loops_1000_exit2166_add_8_8_0_op0;
+reg [7:0] loops_1000_exit2166_add_8_8_0_op1;
+reg [7:0] loops_1000_exit2166_add_8_8_0;
+reg [2:0] loops_1000_exit1167_icmp_8_0_op0;
+reg [2:0] loops_1000_exit1167_icmp_8_0_op1;
+reg  loops_1000_exit1167_icmp_8_0;
+reg [7:0] loops_1000_exit1167_add_8_8_1_op0;
+reg [7:0] loops_1000_exit1167_add_8_8_1_op1;
+reg [7:0] loops_1000_exit1167_add_8_8_1;
+reg [2:0] loops_1000_loop2171_icmp_8_0_op0;
+reg [2:0] loops_1000_loop2171_icmp_8_0_op1;
+reg  loops_1000_loop2171_icmp_8_0;
+reg [7:0] loops_1000_loop2171_add_8_8_0_op0;
+reg [7:0] loops_1000_loop2171_add_8_8_0_op1;
+reg [7:0] loops_1000_loop2171_add_8_8_0;
+reg [7:0] loops_1000_loop2171_add_8_8_1_op0;
+reg [7:0] loops_1000_loop2171_add_8_8_1_op1;
+reg [7:0] loops_1000_loop2171_add_8_8_1;
+reg [31:0] loops_1000_loop2171_mul_32_32_0_op0;
+reg [31:0] loops_1000_loop2171_mul_32_32_0_op1;
+reg [31:0] loops_1000_loop2171_mul_32_32_0;
+reg [31:0] loops_1000_loop2171_and_32_32_0_op0;
+reg [31:0] loops_1000_loop2171_and_32_32_0_op1;
+reg [31:0] loops_1000_loop2171_and_32_32_0;
+reg [15:0] loops_1000_loop2171_or_16_16_0_op0;
+reg [15:0] loops_1000_loop2171_or_16_16_0_op1;
+reg [15:0] loops_1000_loop2171_or_16_16_0;
+reg [31:0] loops_1000_loop2171_or_32_32_0_op0;
+reg [31:0] loops_1000_loop2171_or_32_32_0_op1;
+reg [31:0] loops_1000_loop2171_or_32_32_0;
+reg [15:0] loops_1000_loop2171_and_16_16_0_op0;
+reg [15:0] loops_1000_loop2171_and_16_16_0_op1;
+reg [15:0] loops_1000_loop2171_and_16_16_0;
+reg [2:0] loops_1000_exit2172_icmp_8_0_op0;
+reg [2:0] loops_1000_exit2172_icmp_8_0_op1;
+reg  loops_1000_exit2172_icmp_8_0;
+reg [7:0] loops_1000_exit2172_add_8_8_1_op0;
+reg [7:0] loops_1000_exit2172_add_8_8_1_op1;
+reg [7:0] loops_1000_exit2172_add_8_8_1;
+reg [2:0] loops_1000_exit1173_icmp_8_0_op0;
+reg [2:0] loops_1000_exit1173_icmp_8_0_op1;
+reg  loops_1000_exit1173_icmp_8_0;
+reg [7:0] loops_1000_exit1173_add_8_8_0_op0;
+reg [7:0] loops_1000_exit1173_add_8_8_0_op1;
+reg [7:0] loops_1000_exit1173_add_8_8_0;
+reg [2:0] loops_1000_loop2177_icmp_8_0_op0;
+reg [2:0] loops_1000_loop2177_icmp_8_0_op1;
+reg  loops_1000_loop2177_icmp_8_0;
+reg [7:0] loops_1000_loop2177_add_8_8_1_op0;
+reg [7:0] loops_1000_loop2177_add_8_8_1_op1;
+reg [7:0] loops_1000_loop2177_add_8_8_1;
+reg [7:0] loops_1000_loop2177_add_8_8_0_op0;
+reg [7:0] loops_1000_loop2177_add_8_8_0_op1;
+reg [7:0] loops_1000_loop2177_add_8_8_0;
+reg [31:0] loops_1000_loop2177_add_32_32_0_op0;
+reg [31:0] loops_1000_loop2177_add_32_32_0_op1;
+reg [31:0] loops_1000_loop2177_add_32_32_0;
+reg [31:0] loops_1000_loop2177_and_32_32_0_op0;
+reg [31:0] loops_1000_loop2177_and_32_32_0_op1;
+reg [31:0] loops_1000_loop2177_and_32_32_0;
+reg [15:0] loops_1000_loop2177_add_16_16_1_op0;
+reg [15:0] loops_1000_loop2177_add_16_16_1_op1;
+reg [15:0] loops_1000_loop2177_add_16_16_1;
+reg [15:0] loops_1000_loop2177_add_16_16_0_op0;
+reg [15:0] loops_1000_loop2177_add_16_16_0_op1;
+reg [15:0] loops_1000_loop2177_add_16_16_0;
+reg [2:0] loops_1000_exit2178_icmp_8_0_op0;
+reg [2:0] loops_1000_exit2178_icmp_8_0_op1;
+reg  loops_1000_exit2178_icmp_8_0;
+reg [7:0] loops_1000_exit2178_add_8_8_1_op0;
+reg [7:0] loops_1000_exit2178_add_8_8_1_op1;
+reg [7:0] loops_1000_exit2178_add_8_8_1;
+reg [2:0] loops_1000_exit1179_icmp_8_0_op0;
+reg [2:0] loops_1000_exit1179_icmp_8_0_op1;
+reg  loops_1000_exit1179_icmp_8_0;
+reg [7:0] loops_1000_exit1179_add_8_8_0_op0;
+reg [7:0] loops_1000_exit1179_add_8_8_0_op1;
+reg [7:0] loops_1000_exit1179_add_8_8_0;
+reg [2:0] loops_1000_loop2183_icmp_8_0_op0;
+reg [2:0] loops_1000_loop2183_icmp_8_0_op1;
+reg  loops_1000_loop2183_icmp_8_0;
+reg [7:0] loops_1000_loop2183_add_8_8_1_op0;
+reg [7:0] loops_1000_loop2183_add_8_8_1_op1;
+reg [7:0] loops_1000_loop2183_add_8_8_1;
+reg [31:0] loops_1000_loop2183_add_32_32_0_op0;
+reg [31:0] loops_1000_loop2183_add_32_32_0_op1;
+reg [31:0] loops_1000_loop2183_add_32_32_0;
+reg [7:0] loops_1000_loop2183_mul_8_8_0_op0;
+reg [7:0] loops_1000_loop2183_mul_8_8_0_op1;
+reg [7:0] loops_1000_loop2183_mul_8_8_0;
+reg [31:0] loops_1000_loop2183_and_32_32_0_op0;
+reg [31:0] loops_1000_loop2183_and_32_32_0_op1;
+reg [31:0] loops_1000_loop2183_and_32_32_0;
+reg [2:0] loops_1000_exit2184_icmp_8_0_op0;
+reg [2:0] loops_1000_exit2184_icmp_8_0_op1;
+reg  loops_1000_exit2184_icmp_8_0;
+reg [7:0] loops_1000_exit2184_add_8_8_0_op0;
+reg [7:0] loops_1000_exit2184_add_8_8_0_op1;
+reg [7:0] loops_1000_exit2184_add_8_8_0;
+reg [2:0] loops_1000_exit1185_icmp_8_0_op0;
+reg [2:0] loops_1000_exit1185_icmp_8_0_op1;
+reg  loops_1000_exit1185_icmp_8_0;
+reg [7:0] loops_1000_exit1185_add_8_8_1_op0;
+reg [7:0] loops_1000_exit1185_add_8_8_1_op1;
+reg [7:0] loops_1000_exit1185_add_8_8_1;
+reg [2:0] loops_1000_loop2189_icmp_8_0_op0;
+reg [2:0] loops_1000_loop2189_icmp_8_0_op1;
+reg  loops_1000_loop2189_icmp_8_0;
+reg [7:0] loops_1000_loop2189_add_8_8_0_op0;
+reg [7:0] loops_1000_loop2189_add_8_8_0_op1;
+reg [7:0] loops_1000_loop2189_add_8_8_0;
+reg [7:0] loops_1000_loop2189_add_8_8_1_op0;
+reg [7:0] loops_1000_loop2189_add_8_8_1_op1;
+reg [7:0] loops_1000_loop2189_add_8_8_1;
+reg [31:0] loops_1000_loop2189_and_32_32_0_op0;
+reg [31:0] loops_1000_loop2189_and_32_32_0_op1;
+reg [31:0] loops_1000_loop2189_and_32_32_0;
+reg [7:0] loops_1000_loop2189_and_8_8_0_op0;
+reg [7:0] loops_1000_loop2189_and_8_8_0_op1;
+reg [7:0] loops_1000_loop2189_and_8_8_0;
+reg [31:0] loops_1000_loop2189_or_32_32_0_op0;
+reg [31:0] loops_1000_loop2189_or_32_32_0_op1;
+reg [31:0] loops_1000_loop2189_or_32_32_0;
+reg [15:0] loops_1000_loop2189_add_16_16_0_op0;
+reg [15:0] loops_1000_loop2189_add_16_16_0_op1;
+reg [15:0] loops_1000_loop2189_add_16_16_0;
+reg [2:0] loops_1000_exit2190_icmp_8_0_op0;
+reg [2:0] loops_1000_exit2190_icmp_8_0_op1;
+reg  loops_1000_exit2190_icmp_8_0;
+reg [7:0] loops_1000_exit2190_add_8_8_1_op0;
+reg [7:0] loops_1000_exit2190_add_8_8_1_op1;
+reg [7:0] loops_1000_exit2190_add_8_8_1;
+reg [2:0] loops_1000_exit1191_icmp_8_0_op0;
+reg [2:0] loops_1000_exit1191_icmp_8_0_op1;
+reg  loops_1000_exit1191_icmp_8_0;
+reg [7:0] loops_1000_exit1191_add_8_8_0_op0;
+reg [7:0] loops_1000_exit1191_add_8_8_0_op1;
+reg [7:0] loops_1000_exit1191_add_8_8_0;
+reg [2:0] loops_1000_loop2195_icmp_8_0_op0;
+reg [2:0] loops_1000_loop2195_icmp_8_0_op1;
+reg  loops_1000_loop2195_icmp_8_0;
+reg [7:0] loops_1000_loop2195_add_8_8_1_op0;
+reg [7:0] loops_1000_loop2195_add_8_8_1_op1;
+reg [7:0] loops_1000_loop2195_add_8_8_1;
+reg [7:0] loops_1000_loop2195_mul_8_8_0_op0;
+reg [7:0] loops_1000_loop2195_mul_8_8_0_op1;
+reg [7:0] loops_1000_loop2195_mul_8_8_0;
+reg [31:0] loops_1000_loop2195_and_32_32_0_op0;
+reg [31:0] loops_1000_loop2195_and_32_32_0_op1;
+reg [31:0] loops_1000_loop2195_and_32_32_0;
+reg [15:0] loops_1000_loop2195_add_16_16_1_op0;
+reg [15:0] loops_1000_loop2195_add_16_16_1_op1;
+reg [15:0] loops_1000_loop2195_add_16_16_1;
+reg [2:0] loops_1000_exit2196_icmp_8_0_op0;
+reg [2:0] loops_1000_exit2196_icmp_8_0_op1;
+reg  loops_1000_exit2196_icmp_8_0;
+reg [7:0] loops_1000_exit2196_add_8_8_0_op0;
+reg [7:0] loops_1000_exit2196_add_8_8_0_op1;
+reg [7:0] loops_1000_exit2196_add_8_8_0;
+reg [2:0] loops_1000_exit1197_icmp_8_0_op0;
+reg [2:0] loops_1000_exit1197_icmp_8_0_op1;
+reg  loops_1000_exit1197_icmp_8_0;
+reg [7:0] loops_1000_exit1197_add_8_8_1_op0;
+reg [7:0] loops_1000_exit1197_add_8_8_1_op1;
+reg [7:0] loops_1000_exit1197_add_8_8_1;
+reg [2:0] loops_1000_loop2201_icmp_8_0_op0;
+reg [2:0] loops_1000_loop2201_icmp_8_0_op1;
+reg  loops_1000_loop2201_icmp_8_0;
+reg [7:0] loops_1000_loop2201_add_8_8_0_op0;
+reg [7:0] loops_1000_loop2201_add_8_8_0_op1;
+reg [7:0] loops_1000_loop2201_add_8_8_0;
+reg [31:0] loops_1000_loop2201_and_32_32_0_op0;
+reg [31:0] loops_1000_loop2201_and_32_32_0_op1;
+reg [31:0] loops_1000_loop2201_and_32_32_0;
+reg [31:0] loops_1000_loop2201_or_32_32_0_op0;
+reg [31:0] loops_1000_loop2201_or_32_32_0_op1;
+reg [31:0] loops_1000_loop2201_or_32_32_0;
+reg [15:0] loops_1000_loop2201_mul_16_16_0_op0;
+reg [15:0] loops_1000_loop2201_mul_16_16_0_op1;
+reg [15:0] loops_1000_loop2201_mul_16_16_0;
+reg [2:0] loops_1000_exit2202_icmp_8_0_op0;
+reg [2:0] loops_1000_exit2202_icmp_8_0_op1;
+reg  loops_1000_exit2202_icmp_8_0;
+reg [7:0] loops_1000_exit2202_add_8_8_1_op0;
+reg [7:0] loops_1000_exit2202_add_8_8_1_op1;
+reg [7:0] loops_1000_exit2202_add_8_8_1;
+reg [2:0] loops_1000_exit1203_icmp_8_0_op0;
+reg [2:0] loops_1000_exit1203_icmp_8_0_op1;
+reg  loops_1000_exit1203_icmp_8_0;
+reg [7:0] loops_1000_exit1203_add_8_8_0_op0;
+reg [7:0] loops_1000_exit1203_add_8_8_0_op1;
+reg [7:0] loops_1000_exit1203_add_8_8_0;
+reg [2:0] loops_1000_loop2207_icmp_8_0_op0;
+reg [2:0] loops_1000_loop2207_icmp_8_0_op1;
+reg  loops_1000_loop2207_icmp_8_0;
+reg [7:0] loops_1000_loop2207_add_8_8_1_op0;
+reg [7:0] loops_1000_loop2207_add_8_8_1_op1;
+reg [7:0] loops_1000_loop2207_add_8_8_1;
+reg [7:0] loops_1000_loop2207_add_8_8_0_op0;
+reg [7:0] loops_1000_loop2207_add_8_8_0_op1;
+reg [7:0] loops_1000_loop2207_add_8_8_0;
+reg [15:0] loops_1000_loop2207_add_16_16_0_op0;
+reg [15:0] loops_1000_loop2207_add_16_16_0_op1;
+reg [15:0] loops_1000_loop2207_add_16_16_0;
+reg [2:0] loops_1000_exit2208_icmp_8_0_op0;
+reg [2:0] loops_1000_exit2208_icmp_8_0_op1;
+reg  loops_1000_exit2208_icmp_8_0;
+reg [7:0] loops_1000_exit2208_add_8_8_0_op0;
+reg [7:0] loops_1000_exit2208_add_8_8_0_op1;
+reg [7:0] loops_1000_exit2208_add_8_8_0;
+reg [2:0] loops_1000_exit1209_icmp_8_0_op0;
+reg [2:0] loops_1000_exit1209_icmp_8_0_op1;
+reg  loops_1000_exit1209_icmp_8_0;
+reg [7:0] loops_1000_exit1209_add_8_8_1_op0;
+reg [7:0] loops_1000_exit1209_add_8_8_1_op1;
+reg [7:0] loops_1000_exit1209_add_8_8_1;
+reg [2:0] loops_1000_loop2213_icmp_8_0_op0;
+reg [2:0] loops_1000_loop2213_icmp_8_0_op1;
+reg  loops_1000_loop2213_icmp_8_0;
+reg [7:0] loops_1000_loop2213_add_8_8_0_op0;
+reg [7:0] loops_1000_loop2213_add_8_8_0_op1;
+reg [7:0] loops_1000_loop2213_add_8_8_0;
+reg [31:0] loops_1000_loop2213_add_32_32_0_op0;
+reg [31:0] loops_1000_loop2213_add_32_32_0_op1;
+reg [31:0] loops_1000_loop2213_add_32_32_0;
+reg [31:0] loops_1000_loop2213_and_32_32_0_op0;
+reg [31:0] loops_1000_loop2213_and_32_32_0_op1;
+reg [31:0] loops_1000_loop2213_and_32_32_0;
+reg [15:0] loops_1000_loop2213_or_16_16_0_op0;
+reg [15:0] loops_1000_loop2213_or_16_16_0_op1;
+reg [15:0] loops_1000_loop2213_or_16_16_0;
+reg [2:0] loops_1000_exit2214_icmp_8_0_op0;
+reg [2:0] loops_1000_exit2214_icmp_8_0_op1;
+reg  loops_1000_exit2214_icmp_8_0;
+reg [7:0] loops_1000_exit2214_add_8_8_1_op0;
+reg [7:0] loops_1000_exit2214_add_8_8_1_op1;
+reg [7:0] loops_1000_exit2214_add_8_8_1;
+reg [2:0] loops_1000_exit1215_icmp_8_0_op0;
+reg [2:0] loops_1000_exit1215_icmp_8_0_op1;
+reg  loops_1000_exit1215_icmp_8_0;
+reg [7:0] loops_1000_exit1215_add_8_8_0_op0;
+reg [7:0] loops_1000_exit1215_add_8_8_0_op1;
+reg [7:0] loops_1000_exit1215_add_8_8_0;
+reg [2:0] loops_1000_loop2219_icmp_8_0_op0;
+reg [2:0] loops_1000_loop2219_icmp_8_0_op1;
+reg  loops_1000_loop2219_icmp_8_0;
+reg [7:0] loops_1000_loop2219_add_8_8_1_op0;
+reg [7:0] loops_1000_loop2219_add_8_8_1_op1;
+reg [7:0] loops_1000_loop2219_add_8_8_1;
+reg [7:0] loops_1000_loop2219_add_8_8_0_op0;
+reg [7:0] loops_1000_loop2219_add_8_8_0_op1;
+reg [7:0] loops_1000_loop2219_add_8_8_0;
+reg [31:0] loops_1000_loop2219_mul_32_32_0_op0;
+reg [31:0] loops_1000_loop2219_mul_32_32_0_op1;
+reg [31:0] loops_1000_loop2219_mul_32_32_0;
+reg [15:0] loops_1000_loop2219_add_16_16_1_op0;
+reg [15:0] loops_1000_loop2219_add_16_16_1_op1;
+reg [15:0] loops_1000_loop2219_add_16_16_1;
+reg [2:0] loops_1000_exit2220_icmp_8_0_op0;
+reg [2:0] loops_1000_exit2220_icmp_8_0_op1;
+reg  loops_1000_exit2220_icmp_8_0;
+reg [7:0] loops_1000_exit2220_add_8_8_0_op0;
+reg [7:0] loops_1000_exit2220_add_8_8_0_op1;
+reg [7:0] loops_1000_exit2220_add_8_8_0;
+reg [2:0] loops_1000_exit1221_icmp_8_0_op0;
+reg [2:0] loops_1000_exit1221_icmp_8_0_op1;
+reg  loops_1000_exit1221_icmp_8_0;
+reg [7:0] loops_1000_exit1221_add_8_8_1_op0;
+reg [7:0] loops_1000_exit1221_add_8_8_1_op1;
+reg [7:0] loops_1000_exit1221_add_8_8_1;
+reg [2:0] loops_1000_loop2225_icmp_8_0_op0;
+reg [2:0] loops_1000_loop2225_icmp_8_0_op1;
+reg  loops_1000_loop2225_icmp_8_0;
+reg [7:0] loops_1000_loop2225_add_8_8_0_op0;
+reg [7:0] loops_1000_loop2225_add_8_8_0_op1;
+reg [7:0] loops_1000_loop2225_add_8_8_0;
+reg [7:0] loops_1000_loop2225_add_8_8_1_op0;
+reg [7:0] loops_1000_loop2225_add_8_8_1_op1;
+reg [7:0] loops_1000_loop2225_add_8_8_1;
+reg [31:0] loops_1000_loop2225_add_32_32_0_op0;
+reg [31:0] loops_1000_loop2225_add_32_32_0_op1;
+reg [31:0] loops_1000_loop2225_add_32_32_0;
+reg [7:0] loops_1000_loop2225_and_8_8_0_op0;
+reg [7:0] loops_1000_loop2225_and_8_8_0_op1;
+reg [7:0] loops_1000_loop2225_and_8_8_0;
+reg [15:0] loops_1000_loop2225_add_16_16_0_op0;
+reg [15:0] loops_1000_loop2225_add_16_16_0_op1;
+reg [15:0] loops_1000_loop2225_add_16_16_0;
+reg [2:0] loops_1000_exit2226_icmp_8_0_op0;
+reg [2:0] loops_1000_exit2226_icmp_8_0_op1;
+reg  loops_1000_exit2226_icmp_8_0;
+reg [7:0] loops_1000_exit2226_add_8_8_1_op0;
+reg [7:0] loops_1000_exit2226_add_8_8_1_op1;
+reg [7:0] loops_1000_exit2226_add_8_8_1;
+reg [2:0] loops_1000_exit1227_icmp_8_0_op0;
+reg [2:0] loops_1000_exit1227_icmp_8_0_op1;
+reg  loops_1000_exit1227_icmp_8_0;
+reg [7:0] loops_1000_exit1227_add_8_8_0_op0;
+reg [7:0] loops_1000_exit1227_add_8_8_0_op1;
+reg [7:0] loops_1000_exit1227_add_8_8_0;
+reg [7:0] loops_1000_loop2231_or_8_8_0_op0;
+reg [7:0] loops_1000_loop2231_or_8_8_0_op1;
+reg [7:0] loops_1000_loop2231_or_8_8_0;
+reg [2:0] loops_1000_loop2231_icmp_8_0_op0;
+reg [2:0] loops_1000_loop2231_icmp_8_0_op1;
+reg  loops_1000_loop2231_icmp_8_0;
+reg [7:0] loops_1000_loop2231_add_8_8_1_op0;
+reg [7:0] loops_1000_loop2231_add_8_8_1_op1;
+reg [7:0] loops_1000_loop2231_add_8_8_1;
+reg [7:0] loops_1000_loop2231_add_8_8_0_op0;
+reg [7:0] loops_1000_loop2231_add_8_8_0_op1;
+reg [7:0] loops_1000_loop2231_add_8_8_0;
+reg [31:0] loops_1000_loop2231_add_32_32_0_op0;
+reg [31:0] loops_1000_loop2231_add_32_32_0_op1;
+reg [31:0] loops_1000_loop2231_add_32_32_0;
+reg [15:0] loops_1000_loop2231_or_16_16_0_op0;
+reg [15:0] loops_1000_loop2231_or_16_16_0_op1;
+reg [15:0] loops_1000_loop2231_or_16_16_0;
+reg [15:0] loops_1000_loop2231_add_16_16_1_op0;
+reg [15:0] loops_1000_loop2231_add_16_16_1_op1;
+reg [15:0] loops_1000_loop2231_add_16_16_1;
+reg [15:0] loops_1000_loop2231_add_16_16_0_op0;
+reg [15:0] loops_1000_loop2231_add_16_16_0_op1;
+reg [15:0] loops_1000_loop2231_add_16_16_0;
+reg [15:0] loops_1000_loop2231_mul_16_16_0_op0;
+reg [15:0] loops_1000_loop2231_mul_16_16_0_op1;
+reg [15:0] loops_1000_loop2231_mul_16_16_0;
+reg [2:0] loops_1000_exit2232_icmp_8_0_op0;
+reg [2:0] loops_1000_exit2232_icmp_8_0_op1;
+reg  loops_1000_exit2232_icmp_8_0;
+reg [7:0] loops_1000_exit2232_add_8_8_0_op0;
+reg [7:0] loops_1000_exit2232_add_8_8_0_op1;
+reg [7:0] loops_1000_exit2232_add_8_8_0;
+reg [2:0] loops_1000_exit1233_icmp_8_0_op0;
+reg [2:0] loops_1000_exit1233_icmp_8_0_op1;
+reg  loops_1000_exit1233_icmp_8_0;
+reg [7:0] loops_1000_exit1233_add_8_8_1_op0;
+reg [7:0] loops_1000_exit1233_add_8_8_1_op1;
+reg [7:0] loops_1000_exit1233_add_8_8_1;
+reg [63:0] loops_1000_loop2_16;
+reg [7:0] loops_1000_loop23_37;
+reg [63:0] loops_1000_loop29_56;
+reg [63:0] loops_1000_loop29_62;
+reg [63:0] loops_1000_loop215_78;
+reg [15:0] loops_1000_loop227_123;
+reg [63:0] loops_1000_loop233_144;
+reg [63:0] loops_1000_loop239_167;
+reg [31:0] loops_1000_loop239_163;
+reg [63:0] loops_1000_loop251_203;
+reg [63:0] loops_1000_loop251_209;
+reg [15:0] loops_1000_loop257_227;
+reg [7:0] loops_1000_loop257_228;
+reg [63:0] loops_1000_loop263_245;
+reg [15:0] loops_1000_loop263_246;
+reg [7:0] loops_1000_loop263_247;
+reg [63:0] loops_1000_loop263_251;
+reg [63:0] loops_1000_loop275_288;
+reg [31:0] loops_1000_loop281_310;
+reg [31:0] loops_1000_loop299_371;
+reg [15:0] loops_1000_loop2105_396;
+reg [7:0] loops_1000_loop2111_417;
+reg [31:0] loops_1000_loop2117_436;
+reg [63:0] loops_1000_loop2117_437;
+reg [63:0] loops_1000_loop2123_457;
+reg [31:0] loops_1000_loop2123_461;
+reg [63:0] loops_1000_loop2129_476;
+reg [7:0] loops_1000_loop2129_478;
+reg [31:0] loops_1000_loop2135_500;
+reg [7:0] loops_1000_loop2141_522;
+reg [15:0] loops_1000_loop2147_542;
+reg [31:0] loops_1000_loop2153_560;
+reg [31:0] loops_1000_loop2159_586;
+reg [63:0] loops_1000_loop2165_606;
+reg [15:0] loops_1000_loop2171_628;
+reg [7:0] loops_1000_loop2171_629;
+reg [31:0] loops_1000_loop2183_666;
+reg [31:0] loops_1000_loop2183_670;
+reg [31:0] loops_1000_loop2213_771;
+reg [63:0] loops_1000_loop2213_776;
+reg [7:0] loops_1000_loop2225_814;
+reg [7:0] loops_1000_loop2225_815;
+reg [63:0] loops_1000_loop2225_816;
+reg [63:0] loops_1000_loop2225_817;
+reg [7:0] loops_1000_loop2225_818;
+reg [63:0] loops_1000_loop2231_833;
+reg [31:0] loops_1000_loop2231_837;
+reg [15:0] loops_1000_loop2231_838;
+
+/* FSM BEGIN ---------------------------------------------------------------*/
+
+always @ (posedge clk) begin
+	if (reset == 1'b1) begin
+		cur_state <= BPHLS;
+	end else begin 
+		cur_state <= next_state;
+	end
+end
+
+always @ (*) begin
+	next_state = cur_state;
+
+	case (cur_state)
+	BPHLS:
+		if ((start == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_0_S_0;
+		end
+	BPHLS_F_loops_1000_BB_0_S_0:
+		next_state = BPHLS_F_loops_1000_BB_1_S_0;
+	BPHLS_F_loops_1000_BB_100_S_0:
+		next_state = BPHLS_F_loops_1000_BB_101_S_0;
+	BPHLS_F_loops_1000_BB_101_S_0:
+		next_state = BPHLS_F_loops_1000_BB_102_S_0;
+	BPHLS_F_loops_1000_BB_102_S_0:
+		next_state = BPHLS_F_loops_1000_BB_102_S_1;
+	BPHLS_F_loops_1000_BB_102_S_1:
+		if ((loops_1000_loop2117_444_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_102_S_0;
+		end
+		else if ((loops_1000_loop2117_444_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_103_S_0;
+		end
+	BPHLS_F_loops_1000_BB_103_S_0:
+		next_state = BPHLS_F_loops_1000_BB_103_S_1;
+	BPHLS_F_loops_1000_BB_103_S_1:
+		if ((loops_1000_exit2118_446_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_101_S_0;
+		end
+		else if ((loops_1000_exit2118_446_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_104_S_0;
+		end
+	BPHLS_F_loops_1000_BB_104_S_0:
+		next_state = BPHLS_F_loops_1000_BB_104_S_1;
+	BPHLS_F_loops_1000_BB_104_S_1:
+		if ((loops_1000_exit1119_448_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_100_S_0;
+		end
+		else if ((loops_1000_exit1119_448_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_105_S_0;
+		end
+	BPHLS_F_loops_1000_BB_105_S_0:
+		next_state = BPHLS_F_loops_1000_BB_106_S_0;
+	BPHLS_F_loops_1000_BB_106_S_0:
+		next_state = BPHLS_F_loops_1000_BB_107_S_0;
+	BPHLS_F_loops_1000_BB_107_S_0:
+		next_state = BPHLS_F_loops_1000_BB_107_S_1;
+	BPHLS_F_loops_1000_BB_107_S_1:
+		if ((loops_1000_loop2123_465_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_107_S_0;
+		end
+		else if ((loops_1000_loop2123_465_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_108_S_0;
+		end
+	BPHLS_F_loops_1000_BB_108_S_0:
+		next_state = BPHLS_F_loops_1000_BB_108_S_1;
+	BPHLS_F_loops_1000_BB_108_S_1:
+		if ((loops_1000_exit2124_467_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_106_S_0;
+		end
+		else if ((loops_1000_exit2124_467_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_109_S_0;
+		end
+	BPHLS_F_loops_1000_BB_109_S_0:
+		next_state = BPHLS_F_loops_1000_BB_109_S_1;
+	BPHLS_F_loops_1000_BB_109_S_1:
+		if ((loops_1000_exit1125_469_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_105_S_0;
+		end
+		else if ((loops_1000_exit1125_469_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_110_S_0;
+		end
+	BPHLS_F_loops_1000_BB_10_S_0:
+		next_state = BPHLS_F_loops_1000_BB_11_S_0;
+	BPHLS_F_loops_1000_BB_110_S_0:
+		next_state = BPHLS_F_loops_1000_BB_111_S_0;
+	BPHLS_F_loops_1000_BB_111_S_0:
+		next_state = BPHLS_F_loops_1000_BB_112_S_0;
+	BPHLS_F_loops_1000_BB_112_S_0:
+		next_state = BPHLS_F_loops_1000_BB_112_S_1;
+	BPHLS_F_loops_1000_BB_112_S_1:
+		if ((loops_1000_loop2129_486_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_112_S_0;
+		end
+		else if ((loops_1000_loop2129_486_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_113_S_0;
+		end
+	BPHLS_F_loops_1000_BB_113_S_0:
+		next_state = BPHLS_F_loops_1000_BB_113_S_1;
+	BPHLS_F_loops_1000_BB_113_S_1:
+		if ((loops_1000_exit2130_488_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_111_S_0;
+		end
+		else if ((loops_1000_exit2130_488_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_114_S_0;
+		end
+	BPHLS_F_loops_1000_BB_114_S_0:
+		next_state = BPHLS_F_loops_1000_BB_114_S_1;
+	BPHLS_F_loops_1000_BB_114_S_1:
+		if ((loops_1000_exit1131_490_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_110_S_0;
+		end
+		else if ((loops_1000_exit1131_490_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_115_S_0;
+		end
+	BPHLS_F_loops_1000_BB_115_S_0:
+		next_state = BPHLS_F_loops_1000_BB_116_S_0;
+	BPHLS_F_loops_1000_BB_116_S_0:
+		next_state = BPHLS_F_loops_1000_BB_117_S_0;
+	BPHLS_F_loops_1000_BB_117_S_0:
+		next_state = BPHLS_F_loops_1000_BB_117_S_1;
+	BPHLS_F_loops_1000_BB_117_S_1:
+		if ((loops_1000_loop2135_507_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_117_S_0;
+		end
+		else if ((loops_1000_loop2135_507_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_118_S_0;
+		end
+	BPHLS_F_loops_1000_BB_118_S_0:
+		next_state = BPHLS_F_loops_1000_BB_118_S_1;
+	BPHLS_F_loops_1000_BB_118_S_1:
+		if ((loops_1000_exit2136_509_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_116_S_0;
+		end
+		else if ((loops_1000_exit2136_509_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_119_S_0;
+		end
+	BPHLS_F_loops_1000_BB_119_S_0:
+		next_state = BPHLS_F_loops_1000_BB_119_S_1;
+	BPHLS_F_loops_1000_BB_119_S_1:
+		if ((loops_1000_exit1137_511_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_115_S_0;
+		end
+		else if ((loops_1000_exit1137_511_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_120_S_0;
+		end
+	BPHLS_F_loops_1000_BB_11_S_0:
+		next_state = BPHLS_F_loops_1000_BB_12_S_0;
+	BPHLS_F_loops_1000_BB_120_S_0:
+		next_state = BPHLS_F_loops_1000_BB_121_S_0;
+	BPHLS_F_loops_1000_BB_121_S_0:
+		next_state = BPHLS_F_loops_1000_BB_122_S_0;
+	BPHLS_F_loops_1000_BB_122_S_0:
+		next_state = BPHLS_F_loops_1000_BB_122_S_1;
+	BPHLS_F_loops_1000_BB_122_S_1:
+		next_state = BPHLS_F_loops_1000_BB_122_S_2;
+	BPHLS_F_loops_1000_BB_122_S_2:
+		if ((loops_1000_loop2141_528_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_122_S_0;
+		end
+		else if ((loops_1000_loop2141_528_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_123_S_0;
+		end
+	BPHLS_F_loops_1000_BB_123_S_0:
+		next_state = BPHLS_F_loops_1000_BB_123_S_1;
+	BPHLS_F_loops_1000_BB_123_S_1:
+		if ((loops_1000_exit2142_530_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_121_S_0;
+		end
+		else if ((loops_1000_exit2142_530_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_124_S_0;
+		end
+	BPHLS_F_loops_1000_BB_124_S_0:
+		next_state = BPHLS_F_loops_1000_BB_124_S_1;
+	BPHLS_F_loops_1000_BB_124_S_1:
+		if ((loops_1000_exit1143_532_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_120_S_0;
+		end
+		else if ((loops_1000_exit1143_532_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_125_S_0;
+		end
+	BPHLS_F_loops_1000_BB_125_S_0:
+		next_state = BPHLS_F_loops_1000_BB_126_S_0;
+	BPHLS_F_loops_1000_BB_126_S_0:
+		next_state = BPHLS_F_loops_1000_BB_127_S_0;
+	BPHLS_F_loops_1000_BB_127_S_0:
+		next_state = BPHLS_F_loops_1000_BB_127_S_1;
+	BPHLS_F_loops_1000_BB_127_S_1:
+		if ((loops_1000_loop2147_549_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_127_S_0;
+		end
+		else if ((loops_1000_loop2147_549_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_128_S_0;
+		end
+	BPHLS_F_loops_1000_BB_128_S_0:
+		next_state = BPHLS_F_loops_1000_BB_128_S_1;
+	BPHLS_F_loops_1000_BB_128_S_1:
+		if ((loops_1000_exit2148_551_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_126_S_0;
+		end
+		else if ((loops_1000_exit2148_551_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_129_S_0;
+		end
+	BPHLS_F_loops_1000_BB_129_S_0:
+		next_state = BPHLS_F_loops_1000_BB_129_S_1;
+	BPHLS_F_loops_1000_BB_129_S_1:
+		if ((loops_1000_exit1149_553_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_125_S_0;
+		end
+		else if ((loops_1000_exit1149_553_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_130_S_0;
+		end
+	BPHLS_F_loops_1000_BB_12_S_0:
+		next_state = BPHLS_F_loops_1000_BB_12_S_1;
+	BPHLS_F_loops_1000_BB_12_S_1:
+		if ((loops_1000_loop29_66_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_12_S_0;
+		end
+		else if ((loops_1000_loop29_66_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_13_S_0;
+		end
+	BPHLS_F_loops_1000_BB_130_S_0:
+		next_state = BPHLS_F_loops_1000_BB_131_S_0;
+	BPHLS_F_loops_1000_BB_131_S_0:
+		next_state = BPHLS_F_loops_1000_BB_132_S_0;
+	BPHLS_F_loops_1000_BB_132_S_0:
+		next_state = BPHLS_F_loops_1000_BB_132_S_1;
+	BPHLS_F_loops_1000_BB_132_S_1:
+		if ((loops_1000_loop2153_570_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_132_S_0;
+		end
+		else if ((loops_1000_loop2153_570_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_133_S_0;
+		end
+	BPHLS_F_loops_1000_BB_133_S_0:
+		next_state = BPHLS_F_loops_1000_BB_133_S_1;
+	BPHLS_F_loops_1000_BB_133_S_1:
+		if ((loops_1000_exit2154_572_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_131_S_0;
+		end
+		else if ((loops_1000_exit2154_572_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_134_S_0;
+		end
+	BPHLS_F_loops_1000_BB_134_S_0:
+		next_state = BPHLS_F_loops_1000_BB_134_S_1;
+	BPHLS_F_loops_1000_BB_134_S_1:
+		if ((loops_1000_exit1155_574_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_130_S_0;
+		end
+		else if ((loops_1000_exit1155_574_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_135_S_0;
+		end
+	BPHLS_F_loops_1000_BB_135_S_0:
+		next_state = BPHLS_F_loops_1000_BB_136_S_0;
+	BPHLS_F_loops_1000_BB_136_S_0:
+		next_state = BPHLS_F_loops_1000_BB_137_S_0;
+	BPHLS_F_loops_1000_BB_137_S_0:
+		next_state = BPHLS_F_loops_1000_BB_137_S_1;
+	BPHLS_F_loops_1000_BB_137_S_1:
+		if ((loops_1000_loop2159_591_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_137_S_0;
+		end
+		else if ((loops_1000_loop2159_591_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_138_S_0;
+		end
+	BPHLS_F_loops_1000_BB_138_S_0:
+		next_state = BPHLS_F_loops_1000_BB_138_S_1;
+	BPHLS_F_loops_1000_BB_138_S_1:
+		if ((loops_1000_exit2160_593_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_136_S_0;
+		end
+		else if ((loops_1000_exit2160_593_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_139_S_0;
+		end
+	BPHLS_F_loops_1000_BB_139_S_0:
+		next_state = BPHLS_F_loops_1000_BB_139_S_1;
+	BPHLS_F_loops_1000_BB_139_S_1:
+		if ((loops_1000_exit1161_595_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_135_S_0;
+		end
+		else if ((loops_1000_exit1161_595_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_140_S_0;
+		end
+	BPHLS_F_loops_1000_BB_13_S_0:
+		next_state = BPHLS_F_loops_1000_BB_13_S_1;
+	BPHLS_F_loops_1000_BB_13_S_1:
+		if ((loops_1000_exit210_68_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_11_S_0;
+		end
+		else if ((loops_1000_exit210_68_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_14_S_0;
+		end
+	BPHLS_F_loops_1000_BB_140_S_0:
+		next_state = BPHLS_F_loops_1000_BB_141_S_0;
+	BPHLS_F_loops_1000_BB_141_S_0:
+		next_state = BPHLS_F_loops_1000_BB_142_S_0;
+	BPHLS_F_loops_1000_BB_142_S_0:
+		next_state = BPHLS_F_loops_1000_BB_142_S_1;
+	BPHLS_F_loops_1000_BB_142_S_1:
+		next_state = BPHLS_F_loops_1000_BB_142_S_2;
+	BPHLS_F_loops_1000_BB_142_S_2:
+		if ((loops_1000_loop2165_612_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_142_S_0;
+		end
+		else if ((loops_1000_loop2165_612_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_143_S_0;
+		end
+	BPHLS_F_loops_1000_BB_143_S_0:
+		next_state = BPHLS_F_loops_1000_BB_143_S_1;
+	BPHLS_F_loops_1000_BB_143_S_1:
+		if ((loops_1000_exit2166_614_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_141_S_0;
+		end
+		else if ((loops_1000_exit2166_614_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_144_S_0;
+		end
+	BPHLS_F_loops_1000_BB_144_S_0:
+		next_state = BPHLS_F_loops_1000_BB_144_S_1;
+	BPHLS_F_loops_1000_BB_144_S_1:
+		if ((loops_1000_exit1167_616_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_140_S_0;
+		end
+		else if ((loops_1000_exit1167_616_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_145_S_0;
+		end
+	BPHLS_F_loops_1000_BB_145_S_0:
+		next_state = BPHLS_F_loops_1000_BB_146_S_0;
+	BPHLS_F_loops_1000_BB_146_S_0:
+		next_state = BPHLS_F_loops_1000_BB_147_S_0;
+	BPHLS_F_loops_1000_BB_147_S_0:
+		next_state = BPHLS_F_loops_1000_BB_147_S_1;
+	BPHLS_F_loops_1000_BB_147_S_1:
+		if ((loops_1000_loop2171_633_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_147_S_0;
+		end
+		else if ((loops_1000_loop2171_633_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_148_S_0;
+		end
+	BPHLS_F_loops_1000_BB_148_S_0:
+		next_state = BPHLS_F_loops_1000_BB_148_S_1;
+	BPHLS_F_loops_1000_BB_148_S_1:
+		if ((loops_1000_exit2172_635_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_146_S_0;
+		end
+		else if ((loops_1000_exit2172_635_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_149_S_0;
+		end
+	BPHLS_F_loops_1000_BB_149_S_0:
+		next_state = BPHLS_F_loops_1000_BB_149_S_1;
+	BPHLS_F_loops_1000_BB_149_S_1:
+		if ((loops_1000_exit1173_637_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_145_S_0;
+		end
+		else if ((loops_1000_exit1173_637_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_150_S_0;
+		end
+	BPHLS_F_loops_1000_BB_14_S_0:
+		next_state = BPHLS_F_loops_1000_BB_14_S_1;
+	BPHLS_F_loops_1000_BB_14_S_1:
+		if ((loops_1000_exit111_70_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_10_S_0;
+		end
+		else if ((loops_1000_exit111_70_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_15_S_0;
+		end
+	BPHLS_F_loops_1000_BB_150_S_0:
+		next_state = BPHLS_F_loops_1000_BB_151_S_0;
+	BPHLS_F_loops_1000_BB_151_S_0:
+		next_state = BPHLS_F_loops_1000_BB_152_S_0;
+	BPHLS_F_loops_1000_BB_152_S_0:
+		next_state = BPHLS_F_loops_1000_BB_152_S_1;
+	BPHLS_F_loops_1000_BB_152_S_1:
+		if ((loops_1000_loop2177_654_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_152_S_0;
+		end
+		else if ((loops_1000_loop2177_654_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_153_S_0;
+		end
+	BPHLS_F_loops_1000_BB_153_S_0:
+		next_state = BPHLS_F_loops_1000_BB_153_S_1;
+	BPHLS_F_loops_1000_BB_153_S_1:
+		if ((loops_1000_exit2178_656_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_151_S_0;
+		end
+		else if ((loops_1000_exit2178_656_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_154_S_0;
+		end
+	BPHLS_F_loops_1000_BB_154_S_0:
+		next_state = BPHLS_F_loops_1000_BB_154_S_1;
+	BPHLS_F_loops_1000_BB_154_S_1:
+		if ((loops_1000_exit1179_658_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_150_S_0;
+		end
+		else if ((loops_1000_exit1179_658_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_155_S_0;
+		end
+	BPHLS_F_loops_1000_BB_155_S_0:
+		next_state = BPHLS_F_loops_1000_BB_156_S_0;
+	BPHLS_F_loops_1000_BB_156_S_0:
+		next_state = BPHLS_F_loops_1000_BB_157_S_0;
+	BPHLS_F_loops_1000_BB_157_S_0:
+		next_state = BPHLS_F_loops_1000_BB_157_S_1;
+	BPHLS_F_loops_1000_BB_157_S_1:
+		if ((loops_1000_loop2183_675_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_157_S_0;
+		end
+		else if ((loops_1000_loop2183_675_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_158_S_0;
+		end
+	BPHLS_F_loops_1000_BB_158_S_0:
+		next_state = BPHLS_F_loops_1000_BB_158_S_1;
+	BPHLS_F_loops_1000_BB_158_S_1:
+		if ((loops_1000_exit2184_677_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_156_S_0;
+		end
+		else if ((loops_1000_exit2184_677_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_159_S_0;
+		end
+	BPHLS_F_loops_1000_BB_159_S_0:
+		next_state = BPHLS_F_loops_1000_BB_159_S_1;
+	BPHLS_F_loops_1000_BB_159_S_1:
+		if ((loops_1000_exit1185_679_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_155_S_0;
+		end
+		else if ((loops_1000_exit1185_679_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_160_S_0;
+		end
+	BPHLS_F_loops_1000_BB_15_S_0:
+		next_state = BPHLS_F_loops_1000_BB_16_S_0;
+	BPHLS_F_loops_1000_BB_160_S_0:
+		next_state = BPHLS_F_loops_1000_BB_161_S_0;
+	BPHLS_F_loops_1000_BB_161_S_0:
+		next_state = BPHLS_F_loops_1000_BB_162_S_0;
+	BPHLS_F_loops_1000_BB_162_S_0:
+		next_state = BPHLS_F_loops_1000_BB_162_S_1;
+	BPHLS_F_loops_1000_BB_162_S_1:
+		if ((loops_1000_loop2189_696_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_162_S_0;
+		end
+		else if ((loops_1000_loop2189_696_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_163_S_0;
+		end
+	BPHLS_F_loops_1000_BB_163_S_0:
+		next_state = BPHLS_F_loops_1000_BB_163_S_1;
+	BPHLS_F_loops_1000_BB_163_S_1:
+		if ((loops_1000_exit2190_698_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_161_S_0;
+		end
+		else if ((loops_1000_exit2190_698_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_164_S_0;
+		end
+	BPHLS_F_loops_1000_BB_164_S_0:
+		next_state = BPHLS_F_loops_1000_BB_164_S_1;
+	BPHLS_F_loops_1000_BB_164_S_1:
+		if ((loops_1000_exit1191_700_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_160_S_0;
+		end
+		else if ((loops_1000_exit1191_700_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_165_S_0;
+		end
+	BPHLS_F_loops_1000_BB_165_S_0:
+		next_state = BPHLS_F_loops_1000_BB_166_S_0;
+	BPHLS_F_loops_1000_BB_166_S_0:
+		next_state = BPHLS_F_loops_1000_BB_167_S_0;
+	BPHLS_F_loops_1000_BB_167_S_0:
+		next_state = BPHLS_F_loops_1000_BB_167_S_1;
+	BPHLS_F_loops_1000_BB_167_S_1:
+		if ((loops_1000_loop2195_717_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_167_S_0;
+		end
+		else if ((loops_1000_loop2195_717_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_168_S_0;
+		end
+	BPHLS_F_loops_1000_BB_168_S_0:
+		next_state = BPHLS_F_loops_1000_BB_168_S_1;
+	BPHLS_F_loops_1000_BB_168_S_1:
+		if ((loops_1000_exit2196_719_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_166_S_0;
+		end
+		else if ((loops_1000_exit2196_719_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_169_S_0;
+		end
+	BPHLS_F_loops_1000_BB_169_S_0:
+		next_state = BPHLS_F_loops_1000_BB_169_S_1;
+	BPHLS_F_loops_1000_BB_169_S_1:
+		if ((loops_1000_exit1197_721_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_165_S_0;
+		end
+		else if ((loops_1000_exit1197_721_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_170_S_0;
+		end
+	BPHLS_F_loops_1000_BB_16_S_0:
+		next_state = BPHLS_F_loops_1000_BB_17_S_0;
+	BPHLS_F_loops_1000_BB_170_S_0:
+		next_state = BPHLS_F_loops_1000_BB_171_S_0;
+	BPHLS_F_loops_1000_BB_171_S_0:
+		next_state = BPHLS_F_loops_1000_BB_172_S_0;
+	BPHLS_F_loops_1000_BB_172_S_0:
+		next_state = BPHLS_F_loops_1000_BB_172_S_1;
+	BPHLS_F_loops_1000_BB_172_S_1:
+		if ((loops_1000_loop2201_738_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_172_S_0;
+		end
+		else if ((loops_1000_loop2201_738_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_173_S_0;
+		end
+	BPHLS_F_loops_1000_BB_173_S_0:
+		next_state = BPHLS_F_loops_1000_BB_173_S_1;
+	BPHLS_F_loops_1000_BB_173_S_1:
+		if ((loops_1000_exit2202_740_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_171_S_0;
+		end
+		else if ((loops_1000_exit2202_740_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_174_S_0;
+		end
+	BPHLS_F_loops_1000_BB_174_S_0:
+		next_state = BPHLS_F_loops_1000_BB_174_S_1;
+	BPHLS_F_loops_1000_BB_174_S_1:
+		if ((loops_1000_exit1203_742_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_170_S_0;
+		end
+		else if ((loops_1000_exit1203_742_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_175_S_0;
+		end
+	BPHLS_F_loops_1000_BB_175_S_0:
+		next_state = BPHLS_F_loops_1000_BB_176_S_0;
+	BPHLS_F_loops_1000_BB_176_S_0:
+		next_state = BPHLS_F_loops_1000_BB_177_S_0;
+	BPHLS_F_loops_1000_BB_177_S_0:
+		next_state = BPHLS_F_loops_1000_BB_177_S_1;
+	BPHLS_F_loops_1000_BB_177_S_1:
+		if ((loops_1000_loop2207_759_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_177_S_0;
+		end
+		else if ((loops_1000_loop2207_759_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_178_S_0;
+		end
+	BPHLS_F_loops_1000_BB_178_S_0:
+		next_state = BPHLS_F_loops_1000_BB_178_S_1;
+	BPHLS_F_loops_1000_BB_178_S_1:
+		if ((loops_1000_exit2208_761_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_176_S_0;
+		end
+		else if ((loops_1000_exit2208_761_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_179_S_0;
+		end
+	BPHLS_F_loops_1000_BB_179_S_0:
+		next_state = BPHLS_F_loops_1000_BB_179_S_1;
+	BPHLS_F_loops_1000_BB_179_S_1:
+		if ((loops_1000_exit1209_763_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_175_S_0;
+		end
+		else if ((loops_1000_exit1209_763_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_180_S_0;
+		end
+	BPHLS_F_loops_1000_BB_17_S_0:
+		next_state = BPHLS_F_loops_1000_BB_17_S_1;
+	BPHLS_F_loops_1000_BB_17_S_1:
+		if ((loops_1000_loop215_87_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_17_S_0;
+		end
+		else if ((loops_1000_loop215_87_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_18_S_0;
+		end
+	BPHLS_F_loops_1000_BB_180_S_0:
+		next_state = BPHLS_F_loops_1000_BB_181_S_0;
+	BPHLS_F_loops_1000_BB_181_S_0:
+		next_state = BPHLS_F_loops_1000_BB_182_S_0;
+	BPHLS_F_loops_1000_BB_182_S_0:
+		next_state = BPHLS_F_loops_1000_BB_182_S_1;
+	BPHLS_F_loops_1000_BB_182_S_1:
+		if ((loops_1000_loop2213_780_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_182_S_0;
+		end
+		else if ((loops_1000_loop2213_780_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_183_S_0;
+		end
+	BPHLS_F_loops_1000_BB_183_S_0:
+		next_state = BPHLS_F_loops_1000_BB_183_S_1;
+	BPHLS_F_loops_1000_BB_183_S_1:
+		if ((loops_1000_exit2214_782_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_181_S_0;
+		end
+		else if ((loops_1000_exit2214_782_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_184_S_0;
+		end
+	BPHLS_F_loops_1000_BB_184_S_0:
+		next_state = BPHLS_F_loops_1000_BB_184_S_1;
+	BPHLS_F_loops_1000_BB_184_S_1:
+		if ((loops_1000_exit1215_784_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_180_S_0;
+		end
+		else if ((loops_1000_exit1215_784_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_185_S_0;
+		end
+	BPHLS_F_loops_1000_BB_185_S_0:
+		next_state = BPHLS_F_loops_1000_BB_186_S_0;
+	BPHLS_F_loops_1000_BB_186_S_0:
+		next_state = BPHLS_F_loops_1000_BB_187_S_0;
+	BPHLS_F_loops_1000_BB_187_S_0:
+		next_state = BPHLS_F_loops_1000_BB_187_S_1;
+	BPHLS_F_loops_1000_BB_187_S_1:
+		next_state = BPHLS_F_loops_1000_BB_187_S_2;
+	BPHLS_F_loops_1000_BB_187_S_2:
+		if ((loops_1000_loop2219_801_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_187_S_0;
+		end
+		else if ((loops_1000_loop2219_801_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_188_S_0;
+		end
+	BPHLS_F_loops_1000_BB_188_S_0:
+		next_state = BPHLS_F_loops_1000_BB_188_S_1;
+	BPHLS_F_loops_1000_BB_188_S_1:
+		if ((loops_1000_exit2220_803_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_186_S_0;
+		end
+		else if ((loops_1000_exit2220_803_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_189_S_0;
+		end
+	BPHLS_F_loops_1000_BB_189_S_0:
+		next_state = BPHLS_F_loops_1000_BB_189_S_1;
+	BPHLS_F_loops_1000_BB_189_S_1:
+		if ((loops_1000_exit1221_805_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_185_S_0;
+		end
+		else if ((loops_1000_exit1221_805_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_190_S_0;
+		end
+	BPHLS_F_loops_1000_BB_18_S_0:
+		next_state = BPHLS_F_loops_1000_BB_18_S_1;
+	BPHLS_F_loops_1000_BB_18_S_1:
+		if ((loops_1000_exit216_89_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_16_S_0;
+		end
+		else if ((loops_1000_exit216_89_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_19_S_0;
+		end
+	BPHLS_F_loops_1000_BB_190_S_0:
+		next_state = BPHLS_F_loops_1000_BB_191_S_0;
+	BPHLS_F_loops_1000_BB_191_S_0:
+		next_state = BPHLS_F_loops_1000_BB_192_S_0;
+	BPHLS_F_loops_1000_BB_192_S_0:
+		next_state = BPHLS_F_loops_1000_BB_192_S_1;
+	BPHLS_F_loops_1000_BB_192_S_1:
+		if ((loops_1000_loop2225_822_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_192_S_0;
+		end
+		else if ((loops_1000_loop2225_822_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_193_S_0;
+		end
+	BPHLS_F_loops_1000_BB_193_S_0:
+		next_state = BPHLS_F_loops_1000_BB_193_S_1;
+	BPHLS_F_loops_1000_BB_193_S_1:
+		if ((loops_1000_exit2226_824_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_191_S_0;
+		end
+		else if ((loops_1000_exit2226_824_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_194_S_0;
+		end
+	BPHLS_F_loops_1000_BB_194_S_0:
+		next_state = BPHLS_F_loops_1000_BB_194_S_1;
+	BPHLS_F_loops_1000_BB_194_S_1:
+		if ((loops_1000_exit1227_826_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_190_S_0;
+		end
+		else if ((loops_1000_exit1227_826_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_195_S_0;
+		end
+	BPHLS_F_loops_1000_BB_195_S_0:
+		next_state = BPHLS_F_loops_1000_BB_196_S_0;
+	BPHLS_F_loops_1000_BB_196_S_0:
+		next_state = BPHLS_F_loops_1000_BB_197_S_0;
+	BPHLS_F_loops_1000_BB_197_S_0:
+		next_state = BPHLS_F_loops_1000_BB_197_S_1;
+	BPHLS_F_loops_1000_BB_197_S_1:
+		if ((loops_1000_loop2231_843_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_197_S_0;
+		end
+		else if ((loops_1000_loop2231_843_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_198_S_0;
+		end
+	BPHLS_F_loops_1000_BB_198_S_0:
+		next_state = BPHLS_F_loops_1000_BB_198_S_1;
+	BPHLS_F_loops_1000_BB_198_S_1:
+		if ((loops_1000_exit2232_845_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_196_S_0;
+		end
+		else if ((loops_1000_exit2232_845_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_199_S_0;
+		end
+	BPHLS_F_loops_1000_BB_199_S_0:
+		next_state = BPHLS_F_loops_1000_BB_199_S_1;
+	BPHLS_F_loops_1000_BB_199_S_1:
+		if ((loops_1000_exit1233_847_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_195_S_0;
+		end
+		else if ((loops_1000_exit1233_847_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_200_S_0;
+		end
+	BPHLS_F_loops_1000_BB_19_S_0:
+		next_state = BPHLS_F_loops_1000_BB_19_S_1;
+	BPHLS_F_loops_1000_BB_19_S_1:
+		if ((loops_1000_exit117_91_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_15_S_0;
+		end
+		else if ((loops_1000_exit117_91_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_20_S_0;
+		end
+	BPHLS_F_loops_1000_BB_1_S_0:
+		next_state = BPHLS_F_loops_1000_BB_2_S_0;
+	BPHLS_F_loops_1000_BB_200_S_0:
+		next_state = BPHLS;
+	BPHLS_F_loops_1000_BB_20_S_0:
+		next_state = BPHLS_F_loops_1000_BB_21_S_0;
+	BPHLS_F_loops_1000_BB_21_S_0:
+		next_state = BPHLS_F_loops_1000_BB_22_S_0;
+	BPHLS_F_loops_1000_BB_22_S_0:
+		next_state = BPHLS_F_loops_1000_BB_22_S_1;
+	BPHLS_F_loops_1000_BB_22_S_1:
+		if ((loops_1000_loop221_108_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_22_S_0;
+		end
+		else if ((loops_1000_loop221_108_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_23_S_0;
+		end
+	BPHLS_F_loops_1000_BB_23_S_0:
+		next_state = BPHLS_F_loops_1000_BB_23_S_1;
+	BPHLS_F_loops_1000_BB_23_S_1:
+		if ((loops_1000_exit222_110_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_21_S_0;
+		end
+		else if ((loops_1000_exit222_110_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_24_S_0;
+		end
+	BPHLS_F_loops_1000_BB_24_S_0:
+		next_state = BPHLS_F_loops_1000_BB_24_S_1;
+	BPHLS_F_loops_1000_BB_24_S_1:
+		if ((loops_1000_exit123_112_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_20_S_0;
+		end
+		else if ((loops_1000_exit123_112_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_25_S_0;
+		end
+	BPHLS_F_loops_1000_BB_25_S_0:
+		next_state = BPHLS_F_loops_1000_BB_26_S_0;
+	BPHLS_F_loops_1000_BB_26_S_0:
+		next_state = BPHLS_F_loops_1000_BB_27_S_0;
+	BPHLS_F_loops_1000_BB_27_S_0:
+		next_state = BPHLS_F_loops_1000_BB_27_S_1;
+	BPHLS_F_loops_1000_BB_27_S_1:
+		if ((loops_1000_loop227_129_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_27_S_0;
+		end
+		else if ((loops_1000_loop227_129_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_28_S_0;
+		end
+	BPHLS_F_loops_1000_BB_28_S_0:
+		next_state = BPHLS_F_loops_1000_BB_28_S_1;
+	BPHLS_F_loops_1000_BB_28_S_1:
+		if ((loops_1000_exit228_131_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_26_S_0;
+		end
+		else if ((loops_1000_exit228_131_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_29_S_0;
+		end
+	BPHLS_F_loops_1000_BB_29_S_0:
+		next_state = BPHLS_F_loops_1000_BB_29_S_1;
+	BPHLS_F_loops_1000_BB_29_S_1:
+		if ((loops_1000_exit129_133_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_25_S_0;
+		end
+		else if ((loops_1000_exit129_133_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_30_S_0;
+		end
+	BPHLS_F_loops_1000_BB_2_S_0:
+		next_state = BPHLS_F_loops_1000_BB_2_S_1;
+	BPHLS_F_loops_1000_BB_2_S_1:
+		if ((loops_1000_loop2_24_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_2_S_0;
+		end
+		else if ((loops_1000_loop2_24_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_3_S_0;
+		end
+	BPHLS_F_loops_1000_BB_30_S_0:
+		next_state = BPHLS_F_loops_1000_BB_31_S_0;
+	BPHLS_F_loops_1000_BB_31_S_0:
+		next_state = BPHLS_F_loops_1000_BB_32_S_0;
+	BPHLS_F_loops_1000_BB_32_S_0:
+		next_state = BPHLS_F_loops_1000_BB_32_S_1;
+	BPHLS_F_loops_1000_BB_32_S_1:
+		next_state = BPHLS_F_loops_1000_BB_32_S_2;
+	BPHLS_F_loops_1000_BB_32_S_2:
+		if ((loops_1000_loop233_150_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_32_S_0;
+		end
+		else if ((loops_1000_loop233_150_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_33_S_0;
+		end
+	BPHLS_F_loops_1000_BB_33_S_0:
+		next_state = BPHLS_F_loops_1000_BB_33_S_1;
+	BPHLS_F_loops_1000_BB_33_S_1:
+		if ((loops_1000_exit234_152_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_31_S_0;
+		end
+		else if ((loops_1000_exit234_152_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_34_S_0;
+		end
+	BPHLS_F_loops_1000_BB_34_S_0:
+		next_state = BPHLS_F_loops_1000_BB_34_S_1;
+	BPHLS_F_loops_1000_BB_34_S_1:
+		if ((loops_1000_exit135_154_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_30_S_0;
+		end
+		else if ((loops_1000_exit135_154_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_35_S_0;
+		end
+	BPHLS_F_loops_1000_BB_35_S_0:
+		next_state = BPHLS_F_loops_1000_BB_36_S_0;
+	BPHLS_F_loops_1000_BB_36_S_0:
+		next_state = BPHLS_F_loops_1000_BB_37_S_0;
+	BPHLS_F_loops_1000_BB_37_S_0:
+		next_state = BPHLS_F_loops_1000_BB_37_S_1;
+	BPHLS_F_loops_1000_BB_37_S_1:
+		next_state = BPHLS_F_loops_1000_BB_37_S_2;
+	BPHLS_F_loops_1000_BB_37_S_2:
+		if ((loops_1000_loop239_171_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_37_S_0;
+		end
+		else if ((loops_1000_loop239_171_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_38_S_0;
+		end
+	BPHLS_F_loops_1000_BB_38_S_0:
+		next_state = BPHLS_F_loops_1000_BB_38_S_1;
+	BPHLS_F_loops_1000_BB_38_S_1:
+		if ((loops_1000_exit240_173_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_36_S_0;
+		end
+		else if ((loops_1000_exit240_173_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_39_S_0;
+		end
+	BPHLS_F_loops_1000_BB_39_S_0:
+		next_state = BPHLS_F_loops_1000_BB_39_S_1;
+	BPHLS_F_loops_1000_BB_39_S_1:
+		if ((loops_1000_exit141_175_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_35_S_0;
+		end
+		else if ((loops_1000_exit141_175_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_40_S_0;
+		end
+	BPHLS_F_loops_1000_BB_3_S_0:
+		next_state = BPHLS_F_loops_1000_BB_3_S_1;
+	BPHLS_F_loops_1000_BB_3_S_1:
+		if ((loops_1000_exit2_26_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_1_S_0;
+		end
+		else if ((loops_1000_exit2_26_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_4_S_0;
+		end
+	BPHLS_F_loops_1000_BB_40_S_0:
+		next_state = BPHLS_F_loops_1000_BB_41_S_0;
+	BPHLS_F_loops_1000_BB_41_S_0:
+		next_state = BPHLS_F_loops_1000_BB_42_S_0;
+	BPHLS_F_loops_1000_BB_42_S_0:
+		next_state = BPHLS_F_loops_1000_BB_42_S_1;
+	BPHLS_F_loops_1000_BB_42_S_1:
+		if ((loops_1000_loop245_192_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_42_S_0;
+		end
+		else if ((loops_1000_loop245_192_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_43_S_0;
+		end
+	BPHLS_F_loops_1000_BB_43_S_0:
+		next_state = BPHLS_F_loops_1000_BB_43_S_1;
+	BPHLS_F_loops_1000_BB_43_S_1:
+		if ((loops_1000_exit246_194_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_41_S_0;
+		end
+		else if ((loops_1000_exit246_194_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_44_S_0;
+		end
+	BPHLS_F_loops_1000_BB_44_S_0:
+		next_state = BPHLS_F_loops_1000_BB_44_S_1;
+	BPHLS_F_loops_1000_BB_44_S_1:
+		if ((loops_1000_exit147_196_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_40_S_0;
+		end
+		else if ((loops_1000_exit147_196_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_45_S_0;
+		end
+	BPHLS_F_loops_1000_BB_45_S_0:
+		next_state = BPHLS_F_loops_1000_BB_46_S_0;
+	BPHLS_F_loops_1000_BB_46_S_0:
+		next_state = BPHLS_F_loops_1000_BB_47_S_0;
+	BPHLS_F_loops_1000_BB_47_S_0:
+		next_state = BPHLS_F_loops_1000_BB_47_S_1;
+	BPHLS_F_loops_1000_BB_47_S_1:
+		if ((loops_1000_loop251_213_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_47_S_0;
+		end
+		else if ((loops_1000_loop251_213_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_48_S_0;
+		end
+	BPHLS_F_loops_1000_BB_48_S_0:
+		next_state = BPHLS_F_loops_1000_BB_48_S_1;
+	BPHLS_F_loops_1000_BB_48_S_1:
+		if ((loops_1000_exit252_215_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_46_S_0;
+		end
+		else if ((loops_1000_exit252_215_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_49_S_0;
+		end
+	BPHLS_F_loops_1000_BB_49_S_0:
+		next_state = BPHLS_F_loops_1000_BB_49_S_1;
+	BPHLS_F_loops_1000_BB_49_S_1:
+		if ((loops_1000_exit153_217_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_45_S_0;
+		end
+		else if ((loops_1000_exit153_217_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_50_S_0;
+		end
+	BPHLS_F_loops_1000_BB_4_S_0:
+		next_state = BPHLS_F_loops_1000_BB_4_S_1;
+	BPHLS_F_loops_1000_BB_4_S_1:
+		if ((loops_1000_exit1_28_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_0_S_0;
+		end
+		else if ((loops_1000_exit1_28_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_5_S_0;
+		end
+	BPHLS_F_loops_1000_BB_50_S_0:
+		next_state = BPHLS_F_loops_1000_BB_51_S_0;
+	BPHLS_F_loops_1000_BB_51_S_0:
+		next_state = BPHLS_F_loops_1000_BB_52_S_0;
+	BPHLS_F_loops_1000_BB_52_S_0:
+		next_state = BPHLS_F_loops_1000_BB_52_S_1;
+	BPHLS_F_loops_1000_BB_52_S_1:
+		if ((loops_1000_loop257_234_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_52_S_0;
+		end
+		else if ((loops_1000_loop257_234_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_53_S_0;
+		end
+	BPHLS_F_loops_1000_BB_53_S_0:
+		next_state = BPHLS_F_loops_1000_BB_53_S_1;
+	BPHLS_F_loops_1000_BB_53_S_1:
+		if ((loops_1000_exit258_236_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_51_S_0;
+		end
+		else if ((loops_1000_exit258_236_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_54_S_0;
+		end
+	BPHLS_F_loops_1000_BB_54_S_0:
+		next_state = BPHLS_F_loops_1000_BB_54_S_1;
+	BPHLS_F_loops_1000_BB_54_S_1:
+		if ((loops_1000_exit159_238_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_50_S_0;
+		end
+		else if ((loops_1000_exit159_238_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_55_S_0;
+		end
+	BPHLS_F_loops_1000_BB_55_S_0:
+		next_state = BPHLS_F_loops_1000_BB_56_S_0;
+	BPHLS_F_loops_1000_BB_56_S_0:
+		next_state = BPHLS_F_loops_1000_BB_57_S_0;
+	BPHLS_F_loops_1000_BB_57_S_0:
+		next_state = BPHLS_F_loops_1000_BB_57_S_1;
+	BPHLS_F_loops_1000_BB_57_S_1:
+		if ((loops_1000_loop263_255_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_57_S_0;
+		end
+		else if ((loops_1000_loop263_255_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_58_S_0;
+		end
+	BPHLS_F_loops_1000_BB_58_S_0:
+		next_state = BPHLS_F_loops_1000_BB_58_S_1;
+	BPHLS_F_loops_1000_BB_58_S_1:
+		if ((loops_1000_exit264_257_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_56_S_0;
+		end
+		else if ((loops_1000_exit264_257_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_59_S_0;
+		end
+	BPHLS_F_loops_1000_BB_59_S_0:
+		next_state = BPHLS_F_loops_1000_BB_59_S_1;
+	BPHLS_F_loops_1000_BB_59_S_1:
+		if ((loops_1000_exit165_259_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_55_S_0;
+		end
+		else if ((loops_1000_exit165_259_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_60_S_0;
+		end
+	BPHLS_F_loops_1000_BB_5_S_0:
+		next_state = BPHLS_F_loops_1000_BB_6_S_0;
+	BPHLS_F_loops_1000_BB_60_S_0:
+		next_state = BPHLS_F_loops_1000_BB_61_S_0;
+	BPHLS_F_loops_1000_BB_61_S_0:
+		next_state = BPHLS_F_loops_1000_BB_62_S_0;
+	BPHLS_F_loops_1000_BB_62_S_0:
+		next_state = BPHLS_F_loops_1000_BB_62_S_1;
+	BPHLS_F_loops_1000_BB_62_S_1:
+		if ((loops_1000_loop269_276_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_62_S_0;
+		end
+		else if ((loops_1000_loop269_276_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_63_S_0;
+		end
+	BPHLS_F_loops_1000_BB_63_S_0:
+		next_state = BPHLS_F_loops_1000_BB_63_S_1;
+	BPHLS_F_loops_1000_BB_63_S_1:
+		if ((loops_1000_exit270_278_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_61_S_0;
+		end
+		else if ((loops_1000_exit270_278_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_64_S_0;
+		end
+	BPHLS_F_loops_1000_BB_64_S_0:
+		next_state = BPHLS_F_loops_1000_BB_64_S_1;
+	BPHLS_F_loops_1000_BB_64_S_1:
+		if ((loops_1000_exit171_280_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_60_S_0;
+		end
+		else if ((loops_1000_exit171_280_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_65_S_0;
+		end
+	BPHLS_F_loops_1000_BB_65_S_0:
+		next_state = BPHLS_F_loops_1000_BB_66_S_0;
+	BPHLS_F_loops_1000_BB_66_S_0:
+		next_state = BPHLS_F_loops_1000_BB_67_S_0;
+	BPHLS_F_loops_1000_BB_67_S_0:
+		next_state = BPHLS_F_loops_1000_BB_67_S_1;
+	BPHLS_F_loops_1000_BB_67_S_1:
+		if ((loops_1000_loop275_297_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_67_S_0;
+		end
+		else if ((loops_1000_loop275_297_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_68_S_0;
+		end
+	BPHLS_F_loops_1000_BB_68_S_0:
+		next_state = BPHLS_F_loops_1000_BB_68_S_1;
+	BPHLS_F_loops_1000_BB_68_S_1:
+		if ((loops_1000_exit276_299_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_66_S_0;
+		end
+		else if ((loops_1000_exit276_299_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_69_S_0;
+		end
+	BPHLS_F_loops_1000_BB_69_S_0:
+		next_state = BPHLS_F_loops_1000_BB_69_S_1;
+	BPHLS_F_loops_1000_BB_69_S_1:
+		if ((loops_1000_exit177_301_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_65_S_0;
+		end
+		else if ((loops_1000_exit177_301_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_70_S_0;
+		end
+	BPHLS_F_loops_1000_BB_6_S_0:
+		next_state = BPHLS_F_loops_1000_BB_7_S_0;
+	BPHLS_F_loops_1000_BB_70_S_0:
+		next_state = BPHLS_F_loops_1000_BB_71_S_0;
+	BPHLS_F_loops_1000_BB_71_S_0:
+		next_state = BPHLS_F_loops_1000_BB_72_S_0;
+	BPHLS_F_loops_1000_BB_72_S_0:
+		next_state = BPHLS_F_loops_1000_BB_72_S_1;
+	BPHLS_F_loops_1000_BB_72_S_1:
+		if ((loops_1000_loop281_318_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_72_S_0;
+		end
+		else if ((loops_1000_loop281_318_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_73_S_0;
+		end
+	BPHLS_F_loops_1000_BB_73_S_0:
+		next_state = BPHLS_F_loops_1000_BB_73_S_1;
+	BPHLS_F_loops_1000_BB_73_S_1:
+		if ((loops_1000_exit282_320_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_71_S_0;
+		end
+		else if ((loops_1000_exit282_320_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_74_S_0;
+		end
+	BPHLS_F_loops_1000_BB_74_S_0:
+		next_state = BPHLS_F_loops_1000_BB_74_S_1;
+	BPHLS_F_loops_1000_BB_74_S_1:
+		if ((loops_1000_exit183_322_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_70_S_0;
+		end
+		else if ((loops_1000_exit183_322_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_75_S_0;
+		end
+	BPHLS_F_loops_1000_BB_75_S_0:
+		next_state = BPHLS_F_loops_1000_BB_76_S_0;
+	BPHLS_F_loops_1000_BB_76_S_0:
+		next_state = BPHLS_F_loops_1000_BB_77_S_0;
+	BPHLS_F_loops_1000_BB_77_S_0:
+		next_state = BPHLS_F_loops_1000_BB_77_S_1;
+	BPHLS_F_loops_1000_BB_77_S_1:
+		if ((loops_1000_loop287_339_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_77_S_0;
+		end
+		else if ((loops_1000_loop287_339_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_78_S_0;
+		end
+	BPHLS_F_loops_1000_BB_78_S_0:
+		next_state = BPHLS_F_loops_1000_BB_78_S_1;
+	BPHLS_F_loops_1000_BB_78_S_1:
+		if ((loops_1000_exit288_341_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_76_S_0;
+		end
+		else if ((loops_1000_exit288_341_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_79_S_0;
+		end
+	BPHLS_F_loops_1000_BB_79_S_0:
+		next_state = BPHLS_F_loops_1000_BB_79_S_1;
+	BPHLS_F_loops_1000_BB_79_S_1:
+		if ((loops_1000_exit189_343_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_75_S_0;
+		end
+		else if ((loops_1000_exit189_343_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_80_S_0;
+		end
+	BPHLS_F_loops_1000_BB_7_S_0:
+		next_state = BPHLS_F_loops_1000_BB_7_S_1;
+	BPHLS_F_loops_1000_BB_7_S_1:
+		next_state = BPHLS_F_loops_1000_BB_7_S_2;
+	BPHLS_F_loops_1000_BB_7_S_2:
+		if ((loops_1000_loop23_45_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_7_S_0;
+		end
+		else if ((loops_1000_loop23_45_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_8_S_0;
+		end
+	BPHLS_F_loops_1000_BB_80_S_0:
+		next_state = BPHLS_F_loops_1000_BB_81_S_0;
+	BPHLS_F_loops_1000_BB_81_S_0:
+		next_state = BPHLS_F_loops_1000_BB_82_S_0;
+	BPHLS_F_loops_1000_BB_82_S_0:
+		next_state = BPHLS_F_loops_1000_BB_82_S_1;
+	BPHLS_F_loops_1000_BB_82_S_1:
+		next_state = BPHLS_F_loops_1000_BB_82_S_2;
+	BPHLS_F_loops_1000_BB_82_S_2:
+		next_state = BPHLS_F_loops_1000_BB_82_S_3;
+	BPHLS_F_loops_1000_BB_82_S_3:
+		if ((loops_1000_loop293_360_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_82_S_0;
+		end
+		else if ((loops_1000_loop293_360_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_83_S_0;
+		end
+	BPHLS_F_loops_1000_BB_83_S_0:
+		next_state = BPHLS_F_loops_1000_BB_83_S_1;
+	BPHLS_F_loops_1000_BB_83_S_1:
+		if ((loops_1000_exit294_362_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_81_S_0;
+		end
+		else if ((loops_1000_exit294_362_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_84_S_0;
+		end
+	BPHLS_F_loops_1000_BB_84_S_0:
+		next_state = BPHLS_F_loops_1000_BB_84_S_1;
+	BPHLS_F_loops_1000_BB_84_S_1:
+		if ((loops_1000_exit195_364_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_80_S_0;
+		end
+		else if ((loops_1000_exit195_364_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_85_S_0;
+		end
+	BPHLS_F_loops_1000_BB_85_S_0:
+		next_state = BPHLS_F_loops_1000_BB_86_S_0;
+	BPHLS_F_loops_1000_BB_86_S_0:
+		next_state = BPHLS_F_loops_1000_BB_87_S_0;
+	BPHLS_F_loops_1000_BB_87_S_0:
+		next_state = BPHLS_F_loops_1000_BB_87_S_1;
+	BPHLS_F_loops_1000_BB_87_S_1:
+		if ((loops_1000_loop299_381_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_87_S_0;
+		end
+		else if ((loops_1000_loop299_381_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_88_S_0;
+		end
+	BPHLS_F_loops_1000_BB_88_S_0:
+		next_state = BPHLS_F_loops_1000_BB_88_S_1;
+	BPHLS_F_loops_1000_BB_88_S_1:
+		if ((loops_1000_exit2100_383_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_86_S_0;
+		end
+		else if ((loops_1000_exit2100_383_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_89_S_0;
+		end
+	BPHLS_F_loops_1000_BB_89_S_0:
+		next_state = BPHLS_F_loops_1000_BB_89_S_1;
+	BPHLS_F_loops_1000_BB_89_S_1:
+		if ((loops_1000_exit1101_385_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_85_S_0;
+		end
+		else if ((loops_1000_exit1101_385_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_90_S_0;
+		end
+	BPHLS_F_loops_1000_BB_8_S_0:
+		next_state = BPHLS_F_loops_1000_BB_8_S_1;
+	BPHLS_F_loops_1000_BB_8_S_1:
+		if ((loops_1000_exit24_47_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_6_S_0;
+		end
+		else if ((loops_1000_exit24_47_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_9_S_0;
+		end
+	BPHLS_F_loops_1000_BB_90_S_0:
+		next_state = BPHLS_F_loops_1000_BB_91_S_0;
+	BPHLS_F_loops_1000_BB_91_S_0:
+		next_state = BPHLS_F_loops_1000_BB_92_S_0;
+	BPHLS_F_loops_1000_BB_92_S_0:
+		next_state = BPHLS_F_loops_1000_BB_92_S_1;
+	BPHLS_F_loops_1000_BB_92_S_1:
+		if ((loops_1000_loop2105_402_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_92_S_0;
+		end
+		else if ((loops_1000_loop2105_402_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_93_S_0;
+		end
+	BPHLS_F_loops_1000_BB_93_S_0:
+		next_state = BPHLS_F_loops_1000_BB_93_S_1;
+	BPHLS_F_loops_1000_BB_93_S_1:
+		if ((loops_1000_exit2106_404_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_91_S_0;
+		end
+		else if ((loops_1000_exit2106_404_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_94_S_0;
+		end
+	BPHLS_F_loops_1000_BB_94_S_0:
+		next_state = BPHLS_F_loops_1000_BB_94_S_1;
+	BPHLS_F_loops_1000_BB_94_S_1:
+		if ((loops_1000_exit1107_406_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_90_S_0;
+		end
+		else if ((loops_1000_exit1107_406_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_95_S_0;
+		end
+	BPHLS_F_loops_1000_BB_95_S_0:
+		next_state = BPHLS_F_loops_1000_BB_96_S_0;
+	BPHLS_F_loops_1000_BB_96_S_0:
+		next_state = BPHLS_F_loops_1000_BB_97_S_0;
+	BPHLS_F_loops_1000_BB_97_S_0:
+		next_state = BPHLS_F_loops_1000_BB_97_S_1;
+	BPHLS_F_loops_1000_BB_97_S_1:
+		if ((loops_1000_loop2111_423_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_97_S_0;
+		end
+		else if ((loops_1000_loop2111_423_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_98_S_0;
+		end
+	BPHLS_F_loops_1000_BB_98_S_0:
+		next_state = BPHLS_F_loops_1000_BB_98_S_1;
+	BPHLS_F_loops_1000_BB_98_S_1:
+		if ((loops_1000_exit2112_425_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_96_S_0;
+		end
+		else if ((loops_1000_exit2112_425_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_99_S_0;
+		end
+	BPHLS_F_loops_1000_BB_99_S_0:
+		next_state = BPHLS_F_loops_1000_BB_99_S_1;
+	BPHLS_F_loops_1000_BB_99_S_1:
+		if ((loops_1000_exit1113_427_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_95_S_0;
+		end
+		else if ((loops_1000_exit1113_427_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_100_S_0;
+		end
+	BPHLS_F_loops_1000_BB_9_S_0:
+		next_state = BPHLS_F_loops_1000_BB_9_S_1;
+	BPHLS_F_loops_1000_BB_9_S_1:
+		if ((loops_1000_exit15_49_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_1000_BB_5_S_0;
+		end
+		else if ((loops_1000_exit15_49_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_1000_BB_10_S_0;
+		end
+	default:
+		next_state = cur_state;
+	endcase
+end
+
+/* FSM END -----------------------------------------------------------------*/
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS) & (start == 1'd1))) begin
+		loops_1000_loop0_8_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_4_S_1) & (loops_1000_exit1_28_reg == 1'd1))) begin
+		loops_1000_loop0_8_reg[1:0] <= loops_1000_exit1_27_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS) & (start == 1'd1))) begin
+		loops_1000_loop0_9_reg[63:0] <= arg_7[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_4_S_1) & (loops_1000_exit1_28_reg == 1'd1))) begin
+		loops_1000_loop0_9_reg[63:0] <= loops_1000_loop2_22_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_0_S_0)) begin
+		loops_1000_loop1_10_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_3_S_1) & (loops_1000_exit2_26_reg == 1'd1))) begin
+		loops_1000_loop1_10_reg[1:0] <= loops_1000_exit2_25_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_0_S_0)) begin
+		loops_1000_loop1_11_reg[63:0] <= loops_1000_loop0_9_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_3_S_1) & (loops_1000_exit2_26_reg == 1'd1))) begin
+		loops_1000_loop1_11_reg[63:0] <= loops_1000_loop2_22_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_1_S_0)) begin
+		loops_1000_loop2_12_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_2_S_1) & (loops_1000_loop2_24_reg == 1'd1))) begin
+		loops_1000_loop2_12_reg[1:0] <= loops_1000_loop2_23_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_1_S_0)) begin
+		loops_1000_loop2_13_reg[63:0] <= loops_1000_loop1_11_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_2_S_1) & (loops_1000_loop2_24_reg == 1'd1))) begin
+		loops_1000_loop2_13_reg[63:0] <= loops_1000_loop2_22_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2_14[15:0] = loops_1000_loop2_add_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_2_S_0)) begin
+		bp_reg_0[88:73] <= loops_1000_loop2_14[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_2_S_0)) begin
+		bp_reg_0[63:0] <= loops_1000_loop2_22[63:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_2_S_0)) begin
+		bp_reg_0[72:70] <= loops_1000_loop2_23[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_3_S_0)) begin
+		bp_reg_0[69:67] <= loops_1000_exit2_25[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_3_S_0)) begin
+		bp_reg_0[70:70] <= loops_1000_exit2_26;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_4_S_0)) begin
+		bp_reg_0[66:64] <= loops_1000_exit1_27[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_4_S_0)) begin
+		bp_reg_0[67:67] <= loops_1000_exit1_28;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_7_S_0)) begin
+		bp_reg_0[21:6] <= loops_1000_loop23_35[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_7_S_1)) begin
+		bp_reg_0[13:6] <= loops_1000_loop23_41[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_7_S_1)) begin
+		bp_reg_0[5:3] <= loops_1000_loop23_44[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_7_S_1)) begin
+		bp_reg_0[14:14] <= loops_1000_loop23_45;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_8_S_0)) begin
+		bp_reg_0[2:0] <= loops_1000_exit24_46[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_8_S_0)) begin
+		bp_reg_0[3:3] <= loops_1000_exit24_47;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_9_S_0)) begin
+		bp_reg_0[0:0] <= loops_1000_exit15_49;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_12_S_0)) begin
+		bp_reg_0[69:67] <= loops_1000_loop29_65[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_13_S_0)) begin
+		bp_reg_0[66:64] <= loops_1000_exit210_67[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_14_S_0)) begin
+		bp_reg_0[64:64] <= loops_1000_exit111_70;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_17_S_0)) begin
+		bp_reg_0[21:14] <= loops_1000_loop215_77[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_17_S_0)) begin
+		bp_reg_0[53:22] <= loops_1000_loop215_79[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_17_S_0)) begin
+		bp_reg_0[5:3] <= loops_1000_loop215_86[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_18_S_0)) begin
+		bp_reg_0[2:0] <= loops_1000_exit216_88[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_18_S_0)) begin
+		bp_reg_0[3:3] <= loops_1000_exit216_89;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_19_S_0)) begin
+		bp_reg_0[0:0] <= loops_1000_exit117_91;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_22_S_0)) begin
+		bp_reg_0[11:9] <= loops_1000_loop221_107[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_23_S_0)) begin
+		bp_reg_0[8:6] <= loops_1000_exit222_109[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_24_S_0)) begin
+		bp_reg_0[6:6] <= loops_1000_exit123_112;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_27_S_0)) begin
+		bp_reg_0[5:3] <= loops_1000_loop227_128[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_28_S_0)) begin
+		bp_reg_0[2:0] <= loops_1000_exit228_130[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_28_S_0)) begin
+		bp_reg_0[3:3] <= loops_1000_exit228_131;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_29_S_0)) begin
+		bp_reg_0[0:0] <= loops_1000_exit129_133;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_33_S_0)) begin
+		bp_reg_0[8:6] <= loops_1000_exit234_151[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_34_S_0)) begin
+		bp_reg_0[6:6] <= loops_1000_exit135_154;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_37_S_0)) begin
+		bp_reg_0[45:14] <= loops_1000_loop239_161[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_37_S_0)) begin
+		bp_reg_0[53:46] <= loops_1000_loop239_164[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_37_S_0)) begin
+		bp_reg_0[5:3] <= loops_1000_loop239_170[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_38_S_0)) begin
+		bp_reg_0[2:0] <= loops_1000_exit240_172[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_38_S_0)) begin
+		bp_reg_0[3:3] <= loops_1000_exit240_173;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_39_S_0)) begin
+		bp_reg_0[0:0] <= loops_1000_exit141_175;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_43_S_0)) begin
+		bp_reg_0[8:6] <= loops_1000_exit246_193[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_44_S_0)) begin
+		bp_reg_0[6:6] <= loops_1000_exit147_196;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_47_S_0)) begin
+		bp_reg_0[5:3] <= loops_1000_loop251_212[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_48_S_0)) begin
+		bp_reg_0[2:0] <= loops_1000_exit252_214[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_48_S_0)) begin
+		bp_reg_0[3:3] <= loops_1000_exit252_215;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_49_S_0)) begin
+		bp_reg_0[0:0] <= loops_1000_exit153_217;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_52_S_0)) begin
+		bp_reg_0[11:9] <= loops_1000_loop257_233[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_53_S_0)) begin
+		bp_reg_0[8:6] <= loops_1000_exit258_235[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_53_S_0)) begin
+		bp_reg_0[9:9] <= loops_1000_exit258_236;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_54_S_0)) begin
+		bp_reg_0[6:6] <= loops_1000_exit159_238;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_57_S_0)) begin
+		bp_reg_0[29:14] <= loops_1000_loop263_248[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_57_S_0)) begin
+		bp_reg_0[37:30] <= loops_1000_loop263_249[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_57_S_0)) begin
+		bp_reg_0[82:75] <= loops_1000_loop263_252[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_57_S_0)) begin
+		bp_reg_0[5:3] <= loops_1000_loop263_254[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_57_S_0)) begin
+		bp_reg_0[83:83] <= loops_1000_loop263_255;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_58_S_0)) begin
+		bp_reg_0[2:0] <= loops_1000_exit264_256[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_58_S_0)) begin
+		bp_reg_0[3:3] <= loops_1000_exit264_257;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_59_S_0)) begin
+		bp_reg_0[0:0] <= loops_1000_exit165_259;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_62_S_0)) begin
+		bp_reg_0[61:54] <= loops_1000_loop269_266[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_62_S_0)) begin
+		bp_reg_0[11:9] <= loops_1000_loop269_275[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_63_S_0)) begin
+		bp_reg_0[8:6] <= loops_1000_exit270_277[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_63_S_0)) begin
+		bp_reg_0[9:9] <= loops_1000_exit270_278;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_64_S_0)) begin
+		bp_reg_0[6:6] <= loops_1000_exit171_280;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_67_S_0)) begin
+		bp_reg_0[27:12] <= loops_1000_loop275_287[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_67_S_0)) begin
+		bp_reg_0[5:3] <= loops_1000_loop275_296[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_68_S_0)) begin
+		bp_reg_0[2:0] <= loops_1000_exit276_298[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_68_S_0)) begin
+		bp_reg_0[3:3] <= loops_1000_exit276_299;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_69_S_0)) begin
+		bp_reg_0[0:0] <= loops_1000_exit177_301;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_72_S_0)) begin
+		bp_reg_0[11:9] <= loops_1000_loop281_317[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_73_S_0)) begin
+		bp_reg_0[8:6] <= loops_1000_exit282_319[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_74_S_0)) begin
+		bp_reg_0[6:6] <= loops_1000_exit183_322;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_77_S_0)) begin
+		bp_reg_0[45:30] <= loops_1000_loop287_329[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_77_S_0)) begin
+		bp_reg_0[5:3] <= loops_1000_loop287_338[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_78_S_0)) begin
+		bp_reg_0[2:0] <= loops_1000_exit288_340[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_79_S_0)) begin
+		bp_reg_0[0:0] <= loops_1000_exit189_343;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_83_S_0)) begin
+		bp_reg_0[8:6] <= loops_1000_exit294_361[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_83_S_0)) begin
+		bp_reg_0[28:28] <= loops_1000_exit294_362;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_84_S_0)) begin
+		bp_reg_0[6:6] <= loops_1000_exit195_364;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_87_S_0)) begin
+		bp_reg_0[14:12] <= loops_1000_loop299_380[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_88_S_0)) begin
+		bp_reg_0[2:0] <= loops_1000_exit2100_382[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_89_S_0)) begin
+		bp_reg_0[0:0] <= loops_1000_exit1101_385;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_92_S_0)) begin
+		bp_reg_0[59:52] <= loops_1000_loop2105_392[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_93_S_0)) begin
+		bp_reg_0[8:6] <= loops_1000_exit2106_403[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_94_S_0)) begin
+		bp_reg_0[6:6] <= loops_1000_exit1107_406;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_97_S_0)) begin
+		bp_reg_0[5:3] <= loops_1000_loop2111_422[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_98_S_0)) begin
+		bp_reg_0[2:0] <= loops_1000_exit2112_424[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_98_S_0)) begin
+		bp_reg_0[3:3] <= loops_1000_exit2112_425;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_99_S_0)) begin
+		bp_reg_0[0:0] <= loops_1000_exit1113_427;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_102_S_0)) begin
+		bp_reg_0[14:12] <= loops_1000_loop2117_443[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_103_S_0)) begin
+		bp_reg_0[8:6] <= loops_1000_exit2118_445[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_103_S_0)) begin
+		bp_reg_0[12:12] <= loops_1000_exit2118_446;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_104_S_0)) begin
+		bp_reg_0[6:6] <= loops_1000_exit1119_448;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_107_S_0)) begin
+		bp_reg_0[5:3] <= loops_1000_loop2123_464[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_108_S_0)) begin
+		bp_reg_0[2:0] <= loops_1000_exit2124_466[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_108_S_0)) begin
+		bp_reg_0[3:3] <= loops_1000_exit2124_467;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_109_S_0)) begin
+		bp_reg_0[0:0] <= loops_1000_exit1125_469;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_112_S_0)) begin
+		bp_reg_0[14:12] <= loops_1000_loop2129_485[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_113_S_0)) begin
+		bp_reg_0[8:6] <= loops_1000_exit2130_487[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_113_S_0)) begin
+		bp_reg_0[12:12] <= loops_1000_exit2130_488;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_114_S_0)) begin
+		bp_reg_0[6:6] <= loops_1000_exit1131_490;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_117_S_0)) begin
+		bp_reg_0[70:63] <= loops_1000_loop2135_501[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_117_S_0)) begin
+		bp_reg_0[5:3] <= loops_1000_loop2135_506[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_118_S_0)) begin
+		bp_reg_0[2:0] <= loops_1000_exit2136_508[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_118_S_0)) begin
+		bp_reg_0[3:3] <= loops_1000_exit2136_509;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_119_S_0)) begin
+		bp_reg_0[0:0] <= loops_1000_exit1137_511;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_122_S_1)) begin
+		bp_reg_0[14:12] <= loops_1000_loop2141_527[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_123_S_0)) begin
+		bp_reg_0[8:6] <= loops_1000_exit2142_529[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_123_S_0)) begin
+		bp_reg_0[12:12] <= loops_1000_exit2142_530;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_124_S_0)) begin
+		bp_reg_0[6:6] <= loops_1000_exit1143_532;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_127_S_0)) begin
+		bp_reg_0[5:3] <= loops_1000_loop2147_548[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_128_S_0)) begin
+		bp_reg_0[2:0] <= loops_1000_exit2148_550[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_129_S_0)) begin
+		bp_reg_0[0:0] <= loops_1000_exit1149_553;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_132_S_0)) begin
+		bp_reg_0[14:12] <= loops_1000_loop2153_569[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_133_S_0)) begin
+		bp_reg_0[8:6] <= loops_1000_exit2154_571[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_133_S_0)) begin
+		bp_reg_0[12:12] <= loops_1000_exit2154_572;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_134_S_0)) begin
+		bp_reg_0[6:6] <= loops_1000_exit1155_574;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_137_S_0)) begin
+		bp_reg_0[11:9] <= loops_1000_loop2159_590[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_138_S_0)) begin
+		bp_reg_0[2:0] <= loops_1000_exit2160_592[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_139_S_0)) begin
+		bp_reg_0[0:0] <= loops_1000_exit1161_595;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_142_S_0)) begin
+		bp_reg_0[8:6] <= loops_1000_loop2165_611[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_143_S_0)) begin
+		bp_reg_0[5:3] <= loops_1000_exit2166_613[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_144_S_0)) begin
+		bp_reg_0[3:3] <= loops_1000_exit1167_616;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_147_S_0)) begin
+		bp_reg_0[41:41] <= loops_1000_loop2171_623;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_147_S_0)) begin
+		bp_reg_0[40:38] <= loops_1000_loop2171_632[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_148_S_0)) begin
+		bp_reg_0[2:0] <= loops_1000_exit2172_634[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_148_S_0)) begin
+		bp_reg_0[38:38] <= loops_1000_exit2172_635;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_149_S_0)) begin
+		bp_reg_0[0:0] <= loops_1000_exit1173_637;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_152_S_0)) begin
+		bp_reg_0[83:68] <= loops_1000_loop2177_645[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_152_S_0)) begin
+		bp_reg_0[8:6] <= loops_1000_loop2177_653[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_153_S_0)) begin
+		bp_reg_0[5:3] <= loops_1000_exit2178_655[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_153_S_0)) begin
+		bp_reg_0[6:6] <= loops_1000_exit2178_656;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_154_S_0)) begin
+		bp_reg_0[3:3] <= loops_1000_exit1179_658;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_157_S_0)) begin
+		bp_reg_0[17:15] <= loops_1000_loop2183_674[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_158_S_0)) begin
+		bp_reg_0[2:0] <= loops_1000_exit2184_676[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_158_S_0)) begin
+		bp_reg_0[15:15] <= loops_1000_exit2184_677;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_159_S_0)) begin
+		bp_reg_0[0:0] <= loops_1000_exit1185_679;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_162_S_0)) begin
+		bp_reg_0[8:6] <= loops_1000_loop2189_695[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_163_S_0)) begin
+		bp_reg_0[5:3] <= loops_1000_exit2190_697[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_164_S_0)) begin
+		bp_reg_0[3:3] <= loops_1000_exit1191_700;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_167_S_0)) begin
+		bp_reg_0[14:12] <= loops_1000_loop2195_716[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_168_S_0)) begin
+		bp_reg_0[2:0] <= loops_1000_exit2196_718[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_168_S_0)) begin
+		bp_reg_0[12:12] <= loops_1000_exit2196_719;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_169_S_0)) begin
+		bp_reg_0[0:0] <= loops_1000_exit1197_721;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_172_S_0)) begin
+		bp_reg_0[70:68] <= loops_1000_loop2201_737[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_173_S_0)) begin
+		bp_reg_0[5:3] <= loops_1000_exit2202_739[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_174_S_0)) begin
+		bp_reg_0[3:3] <= loops_1000_exit1203_742;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_177_S_0)) begin
+		bp_reg_0[14:12] <= loops_1000_loop2207_758[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_178_S_0)) begin
+		bp_reg_0[2:0] <= loops_1000_exit2208_760[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_178_S_0)) begin
+		bp_reg_0[12:12] <= loops_1000_exit2208_761;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_179_S_0)) begin
+		bp_reg_0[0:0] <= loops_1000_exit1209_763;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_182_S_0)) begin
+		bp_reg_0[11:9] <= loops_1000_loop2213_779[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_183_S_0)) begin
+		bp_reg_0[5:3] <= loops_1000_exit2214_781[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_183_S_0)) begin
+		bp_reg_0[9:9] <= loops_1000_exit2214_782;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_184_S_0)) begin
+		bp_reg_0[3:3] <= loops_1000_exit1215_784;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_187_S_0)) begin
+		bp_reg_0[83:68] <= loops_1000_loop2219_791[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_187_S_0)) begin
+		bp_reg_0[14:12] <= loops_1000_loop2219_800[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_188_S_0)) begin
+		bp_reg_0[2:0] <= loops_1000_exit2220_802[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_189_S_0)) begin
+		bp_reg_0[0:0] <= loops_1000_exit1221_805;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_192_S_0)) begin
+		bp_reg_0[11:9] <= loops_1000_loop2225_821[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_193_S_0)) begin
+		bp_reg_0[5:3] <= loops_1000_exit2226_823[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_193_S_0)) begin
+		bp_reg_0[9:9] <= loops_1000_exit2226_824;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_194_S_0)) begin
+		bp_reg_0[3:3] <= loops_1000_exit1227_826;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_197_S_0)) begin
+		bp_reg_0[82:67] <= loops_1000_loop2231_834[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_197_S_0)) begin
+		bp_reg_0[8:6] <= loops_1000_loop2231_842[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_198_S_0)) begin
+		bp_reg_0[2:0] <= loops_1000_exit2232_844[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_198_S_0)) begin
+		bp_reg_0[6:6] <= loops_1000_exit2232_845;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_199_S_0)) begin
+		bp_reg_0[0:0] <= loops_1000_exit1233_847;
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2_14_reg[15:0] = bp_reg_0[88:73];
+end
+
+always @ (*) begin
+	loops_1000_loop2_15[31:0] = loops_1000_loop2_or_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_2_S_0)) begin
+		bp_reg_1[31:0] <= loops_1000_loop2_15[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_2_S_0)) begin
+		bp_reg_1[39:32] <= loops_1000_loop2_17[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_2_S_0)) begin
+		bp_reg_1[47:40] <= loops_1000_loop2_18[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_2_S_0)) begin
+		bp_reg_1[79:48] <= loops_1000_loop2_19[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_2_S_0)) begin
+		bp_reg_1[95:80] <= loops_1000_loop2_20[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_2_S_0)) begin
+		bp_reg_1[103:96] <= loops_1000_loop2_21[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_2_S_0)) begin
+		bp_reg_1[104:104] <= loops_1000_loop2_24;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_7_S_0)) begin
+		bp_reg_1[183:168] <= loops_1000_loop23_38[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_7_S_0)) begin
+		bp_reg_1[191:184] <= loops_1000_loop23_39[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_7_S_0)) begin
+		bp_reg_1[255:192] <= loops_1000_loop23_40[63:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_9_S_0)) begin
+		bp_reg_1[145:143] <= loops_1000_exit15_48[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_13_S_0)) begin
+		bp_reg_1[114:114] <= loops_1000_exit210_68;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_14_S_0)) begin
+		bp_reg_1[153:151] <= loops_1000_exit111_69[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_27_S_0)) begin
+		bp_reg_1[53:38] <= loops_1000_loop227_119[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_27_S_0)) begin
+		bp_reg_1[61:54] <= loops_1000_loop227_120[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_32_S_0)) begin
+		bp_reg_1[10:3] <= loops_1000_loop233_140[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_32_S_0)) begin
+		bp_reg_1[196:189] <= loops_1000_loop233_143[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_32_S_0)) begin
+		bp_reg_1[228:197] <= loops_1000_loop233_145[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_32_S_0)) begin
+		bp_reg_1[236:229] <= loops_1000_loop233_146[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_32_S_1)) begin
+		bp_reg_1[2:0] <= loops_1000_loop233_149[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_33_S_0)) begin
+		bp_reg_1[0:0] <= loops_1000_exit234_152;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_42_S_0)) begin
+		bp_reg_1[77:62] <= loops_1000_loop245_182[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_42_S_0)) begin
+		bp_reg_1[2:0] <= loops_1000_loop245_191[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_43_S_0)) begin
+		bp_reg_1[0:0] <= loops_1000_exit246_194;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_47_S_0)) begin
+		bp_reg_1[46:46] <= loops_1000_loop251_206;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_54_S_0)) begin
+		bp_reg_1[218:216] <= loops_1000_exit159_237[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_62_S_0)) begin
+		bp_reg_1[64:57] <= loops_1000_loop269_269[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_62_S_0)) begin
+		bp_reg_1[194:179] <= loops_1000_loop269_271[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_64_S_0)) begin
+		bp_reg_1[178:176] <= loops_1000_exit171_279[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_67_S_0)) begin
+		bp_reg_1[130:123] <= loops_1000_loop275_293[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_67_S_0)) begin
+		bp_reg_1[162:131] <= loops_1000_loop275_294[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_67_S_0)) begin
+		bp_reg_1[163:163] <= loops_1000_loop275_297;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_72_S_0)) begin
+		bp_reg_1[16:9] <= loops_1000_loop281_309[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_72_S_0)) begin
+		bp_reg_1[32:17] <= loops_1000_loop281_311[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_77_S_0)) begin
+		bp_reg_1[221:214] <= loops_1000_loop287_335[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_77_S_0)) begin
+		bp_reg_1[229:222] <= loops_1000_loop287_336[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_82_S_0)) begin
+		bp_reg_1[27:20] <= loops_1000_loop293_351[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_92_S_0)) begin
+		bp_reg_1[85:78] <= loops_1000_loop2105_397[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_92_S_0)) begin
+		bp_reg_1[198:198] <= loops_1000_loop2105_402;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_107_S_0)) begin
+		bp_reg_1[125:94] <= loops_1000_loop2123_456[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_107_S_0)) begin
+		bp_reg_1[133:126] <= loops_1000_loop2123_458[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_107_S_0)) begin
+		bp_reg_1[141:134] <= loops_1000_loop2123_459[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_107_S_0)) begin
+		bp_reg_1[157:142] <= loops_1000_loop2123_460[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_112_S_0)) begin
+		bp_reg_1[218:211] <= loops_1000_loop2129_480[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_122_S_0)) begin
+		bp_reg_1[173:142] <= loops_1000_loop2141_518[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_122_S_0)) begin
+		bp_reg_1[181:174] <= loops_1000_loop2141_519[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_122_S_0)) begin
+		bp_reg_1[189:182] <= loops_1000_loop2141_520[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_127_S_0)) begin
+		bp_reg_1[245:238] <= loops_1000_loop2147_543[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_132_S_0)) begin
+		bp_reg_1[170:155] <= loops_1000_loop2153_562[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_137_S_0)) begin
+		bp_reg_1[37:6] <= loops_1000_loop2159_583[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_137_S_0)) begin
+		bp_reg_1[45:38] <= loops_1000_loop2159_584[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_137_S_0)) begin
+		bp_reg_1[81:81] <= loops_1000_loop2159_591;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_138_S_0)) begin
+		bp_reg_1[86:86] <= loops_1000_exit2160_593;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_142_S_0)) begin
+		bp_reg_1[191:176] <= loops_1000_loop2165_605[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_147_S_0)) begin
+		bp_reg_1[118:87] <= loops_1000_loop2171_625[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_162_S_0)) begin
+		bp_reg_1[142:135] <= loops_1000_loop2189_688[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_162_S_0)) begin
+		bp_reg_1[150:143] <= loops_1000_loop2189_689[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_167_S_0)) begin
+		bp_reg_1[34:19] <= loops_1000_loop2195_710[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_167_S_0)) begin
+		bp_reg_1[42:35] <= loops_1000_loop2195_711[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_177_S_0)) begin
+		bp_reg_1[17:2] <= loops_1000_loop2207_751[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_177_S_0)) begin
+		bp_reg_1[210:203] <= loops_1000_loop2207_754[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_187_S_0)) begin
+		bp_reg_1[90:59] <= loops_1000_loop2219_793[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_187_S_0)) begin
+		bp_reg_1[122:91] <= loops_1000_loop2219_794[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_187_S_0)) begin
+		bp_reg_1[130:123] <= loops_1000_loop2219_795[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_187_S_1)) begin
+		bp_reg_1[194:163] <= loops_1000_loop2219_798[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_187_S_0)) begin
+		bp_reg_1[163:163] <= loops_1000_loop2219_801;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_188_S_0)) begin
+		bp_reg_1[88:88] <= loops_1000_exit2220_803;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_192_S_0)) begin
+		bp_reg_1[255:240] <= loops_1000_loop2225_813[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_194_S_0)) begin
+		bp_reg_1[227:225] <= loops_1000_exit1227_825[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_197_S_0)) begin
+		bp_reg_1[111:96] <= loops_1000_loop2231_836[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_197_S_0)) begin
+		bp_reg_1[119:112] <= loops_1000_loop2231_839[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_197_S_0)) begin
+		bp_reg_1[152:152] <= loops_1000_loop2231_843;
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2_15_reg[31:0] = bp_reg_1[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2_17[7:0] = loops_1000_loop2_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2_17_reg[7:0] = bp_reg_1[39:32];
+end
+
+always @ (*) begin
+	loops_1000_loop2_18[7:0] = loops_1000_loop2_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2_18_reg[7:0] = bp_reg_1[47:40];
+end
+
+always @ (*) begin
+	loops_1000_loop2_19[31:0] = (arg_5 ^ arg_3);
+end
+
+always @ (*) begin
+	loops_1000_loop2_19_reg[31:0] = bp_reg_1[79:48];
+end
+
+always @ (*) begin
+	loops_1000_loop2_20[15:0] = loops_1000_loop2_and_16_16_0[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2_20_reg[15:0] = bp_reg_1[95:80];
+end
+
+always @ (*) begin
+	loops_1000_loop2_21[7:0] = (loops_1000_loop2_17 - loops_1000_loop2_18);
+end
+
+always @ (*) begin
+	loops_1000_loop2_21_reg[7:0] = bp_reg_1[103:96];
+end
+
+always @ (*) begin
+	loops_1000_loop2_22[63:0] = (loops_1000_loop2_13_reg + loops_1000_loop2_21);
+end
+
+always @ (*) begin
+	loops_1000_loop2_22_reg[63:0] = bp_reg_0[63:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2_23[31:0] = loops_1000_loop2_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2_23_reg[2:0] = bp_reg_0[72:70];
+end
+
+always @ (*) begin
+	loops_1000_loop2_24 = loops_1000_loop2_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_loop2_24_reg = bp_reg_1[104:104];
+end
+
+always @ (*) begin
+	loops_1000_exit2_25[31:0] = loops_1000_exit2_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2_25_reg[2:0] = bp_reg_0[69:67];
+end
+
+always @ (*) begin
+	loops_1000_exit2_26 = loops_1000_exit2_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit2_26_reg = bp_reg_0[70:70];
+end
+
+always @ (*) begin
+	loops_1000_exit1_27[31:0] = loops_1000_exit1_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1_27_reg[2:0] = bp_reg_0[66:64];
+end
+
+always @ (*) begin
+	loops_1000_exit1_28 = loops_1000_exit1_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit1_28_reg = bp_reg_0[67:67];
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_4_S_1) & (loops_1000_exit1_28_reg == 1'd0))) begin
+		loops_1000_loop01_29_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_9_S_1) & (loops_1000_exit15_49_reg == 1'd1))) begin
+		loops_1000_loop01_29_reg[1:0] <= loops_1000_exit15_48_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_4_S_1) & (loops_1000_exit1_28_reg == 1'd0))) begin
+		loops_1000_loop01_30_reg[63:0] <= loops_1000_loop2_22_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_9_S_1) & (loops_1000_exit15_49_reg == 1'd1))) begin
+		loops_1000_loop01_30_reg[63:0] <= loops_1000_loop23_43_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_5_S_0)) begin
+		loops_1000_loop12_31_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_8_S_1) & (loops_1000_exit24_47_reg == 1'd1))) begin
+		loops_1000_loop12_31_reg[1:0] <= loops_1000_exit24_46_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_5_S_0)) begin
+		loops_1000_loop12_32_reg[63:0] <= loops_1000_loop01_30_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_8_S_1) & (loops_1000_exit24_47_reg == 1'd1))) begin
+		loops_1000_loop12_32_reg[63:0] <= loops_1000_loop23_43_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_6_S_0)) begin
+		loops_1000_loop23_33_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_7_S_2) & (loops_1000_loop23_45_reg == 1'd1))) begin
+		loops_1000_loop23_33_reg[1:0] <= loops_1000_loop23_44_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_6_S_0)) begin
+		loops_1000_loop23_34_reg[63:0] <= loops_1000_loop12_32_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_7_S_2) & (loops_1000_loop23_45_reg == 1'd1))) begin
+		loops_1000_loop23_34_reg[63:0] <= loops_1000_loop23_43_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop23_35[15:0] = loops_1000_loop23_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop23_35_reg[15:0] = bp_reg_0[21:6];
+end
+
+always @ (*) begin
+	loops_1000_loop23_36[63:0] = (arg_7 + arg_7);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_7_S_0)) begin
+		loops_1000_loop23_36_reg[63:0] <= loops_1000_loop23_36[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop23_38[15:0] = (loops_1000_loop2_20_reg ^ loops_1000_loop23_35);
+end
+
+always @ (*) begin
+	loops_1000_loop23_38_reg[15:0] = bp_reg_1[183:168];
+end
+
+always @ (*) begin
+	loops_1000_loop23_39[7:0] = loops_1000_loop23_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop23_39_reg[7:0] = bp_reg_1[191:184];
+end
+
+always @ (*) begin
+	loops_1000_loop23_40[63:0] = (loops_1000_loop23_36 - loops_1000_loop23_34_reg);
+end
+
+always @ (*) begin
+	loops_1000_loop23_40_reg[63:0] = bp_reg_1[255:192];
+end
+
+always @ (*) begin
+	loops_1000_loop23_41[7:0] = loops_1000_loop23_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop23_41_reg[7:0] = bp_reg_0[13:6];
+end
+
+always @ (*) begin
+	loops_1000_loop23_42[7:0] = loops_1000_loop23_add_8_8_1[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_7_S_0)) begin
+		bp_reg_10[7:0] <= loops_1000_loop23_42[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_77_S_0)) begin
+		bp_reg_10[0:0] <= loops_1000_loop287_339;
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop23_42_reg[7:0] = bp_reg_10[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop23_43[63:0] = (loops_1000_loop23_34_reg + loops_1000_loop23_42);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_7_S_0)) begin
+		loops_1000_loop23_43_reg[63:0] <= loops_1000_loop23_43[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop23_44[31:0] = loops_1000_loop23_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop23_44_reg[2:0] = bp_reg_0[5:3];
+end
+
+always @ (*) begin
+	loops_1000_loop23_45 = loops_1000_loop23_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_loop23_45_reg = bp_reg_0[14:14];
+end
+
+always @ (*) begin
+	loops_1000_exit24_46[31:0] = loops_1000_exit24_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit24_46_reg[2:0] = bp_reg_0[2:0];
+end
+
+always @ (*) begin
+	loops_1000_exit24_47 = loops_1000_exit24_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit24_47_reg = bp_reg_0[3:3];
+end
+
+always @ (*) begin
+	loops_1000_exit15_48[31:0] = loops_1000_exit15_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit15_48_reg[2:0] = bp_reg_1[145:143];
+end
+
+always @ (*) begin
+	loops_1000_exit15_49 = loops_1000_exit15_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit15_49_reg = bp_reg_0[0:0];
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_9_S_1) & (loops_1000_exit15_49_reg == 1'd0))) begin
+		loops_1000_loop07_50_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_14_S_1) & (loops_1000_exit111_70_reg == 1'd1))) begin
+		loops_1000_loop07_50_reg[1:0] <= loops_1000_exit111_69_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_9_S_1) & (loops_1000_exit15_49_reg == 1'd0))) begin
+		loops_1000_loop07_51_reg[63:0] <= loops_1000_loop23_43_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_14_S_1) & (loops_1000_exit111_70_reg == 1'd1))) begin
+		loops_1000_loop07_51_reg[63:0] <= loops_1000_loop29_64_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_10_S_0)) begin
+		loops_1000_loop18_52_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_13_S_1) & (loops_1000_exit210_68_reg == 1'd1))) begin
+		loops_1000_loop18_52_reg[1:0] <= loops_1000_exit210_67_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_10_S_0)) begin
+		loops_1000_loop18_53_reg[63:0] <= loops_1000_loop07_51_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_13_S_1) & (loops_1000_exit210_68_reg == 1'd1))) begin
+		loops_1000_loop18_53_reg[63:0] <= loops_1000_loop29_64_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_11_S_0)) begin
+		loops_1000_loop29_54_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_12_S_1) & (loops_1000_loop29_66_reg == 1'd1))) begin
+		loops_1000_loop29_54_reg[1:0] <= loops_1000_loop29_65_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_11_S_0)) begin
+		loops_1000_loop29_55_reg[63:0] <= loops_1000_loop18_53_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_12_S_1) & (loops_1000_loop29_66_reg == 1'd1))) begin
+		loops_1000_loop29_55_reg[63:0] <= loops_1000_loop29_64_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop29_57[31:0] = (arg_5 - arg_4);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_12_S_0)) begin
+		loops_1000_loop29_57_reg[31:0] <= loops_1000_loop29_57[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop29_58[31:0] = loops_1000_loop29_and_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_12_S_0)) begin
+		loops_1000_loop29_58_reg[31:0] <= loops_1000_loop29_58[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_32_S_0)) begin
+		loops_1000_loop29_58_reg[31:0] <= loops_1000_loop233_147[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_127_S_0)) begin
+		loops_1000_loop29_58_reg[31:0] <= loops_1000_loop2147_540[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_147_S_0)) begin
+		loops_1000_loop29_58_reg[31:0] <= loops_1000_loop2171_626[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_162_S_0)) begin
+		loops_1000_loop29_58_reg[31:0] <= loops_1000_loop2189_690[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop29_59[31:0] = loops_1000_loop29_and_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_12_S_1)) begin
+		loops_1000_loop29_59_reg[31:0] <= loops_1000_loop29_59[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_37_S_0)) begin
+		loops_1000_loop29_59_reg[31:0] <= loops_1000_loop239_166[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_167_S_0)) begin
+		loops_1000_loop29_59_reg[31:0] <= loops_1000_loop2195_709[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop29_60[63:0] = (loops_1000_loop23_40_reg + loops_1000_loop23_34_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_12_S_0)) begin
+		loops_1000_loop29_60_reg[63:0] <= loops_1000_loop29_60[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop29_61[15:0] = loops_1000_loop29_and_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_12_S_0)) begin
+		bp_reg_4[15:0] <= loops_1000_loop29_61[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_12_S_0)) begin
+		bp_reg_4[47:16] <= loops_1000_loop29_63[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_12_S_0)) begin
+		bp_reg_4[48:48] <= loops_1000_loop29_66;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_32_S_1)) begin
+		bp_reg_4[13:13] <= loops_1000_loop233_150;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_62_S_0)) begin
+		bp_reg_4[3:3] <= loops_1000_loop269_276;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_69_S_0)) begin
+		bp_reg_4[31:29] <= loops_1000_exit177_300[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_72_S_1)) begin
+		bp_reg_4[10:3] <= loops_1000_loop281_314[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_78_S_0)) begin
+		bp_reg_4[39:39] <= loops_1000_exit288_341;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_109_S_0)) begin
+		bp_reg_4[17:15] <= loops_1000_exit1125_468[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_112_S_0)) begin
+		bp_reg_4[13:13] <= loops_1000_loop2129_486;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_117_S_0)) begin
+		bp_reg_4[10:10] <= loops_1000_loop2135_507;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_122_S_0)) begin
+		bp_reg_4[39:32] <= loops_1000_loop2141_523[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_122_S_0)) begin
+		bp_reg_4[55:40] <= loops_1000_loop2141_524[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_164_S_0)) begin
+		bp_reg_4[39:37] <= loops_1000_exit1191_699[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_174_S_0)) begin
+		bp_reg_4[23:21] <= loops_1000_exit1203_741[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_199_S_0)) begin
+		bp_reg_4[9:7] <= loops_1000_exit1233_846[2:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop29_61_reg[15:0] = bp_reg_4[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop29_63[31:0] = (loops_1000_loop2_15_reg ^ arg_5);
+end
+
+always @ (*) begin
+	loops_1000_loop29_63_reg[31:0] = bp_reg_4[47:16];
+end
+
+always @ (*) begin
+	loops_1000_loop29_64[63:0] = (loops_1000_loop29_55_reg + loops_1000_loop29_63);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_12_S_0)) begin
+		loops_1000_loop29_64_reg[63:0] <= loops_1000_loop29_64[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop29_65[31:0] = loops_1000_loop29_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop29_65_reg[2:0] = bp_reg_0[69:67];
+end
+
+always @ (*) begin
+	loops_1000_loop29_66 = loops_1000_loop29_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_loop29_66_reg = bp_reg_4[48:48];
+end
+
+always @ (*) begin
+	loops_1000_exit210_67[31:0] = loops_1000_exit210_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit210_67_reg[2:0] = bp_reg_0[66:64];
+end
+
+always @ (*) begin
+	loops_1000_exit210_68 = loops_1000_exit210_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit210_68_reg = bp_reg_1[114:114];
+end
+
+always @ (*) begin
+	loops_1000_exit111_69[31:0] = loops_1000_exit111_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit111_69_reg[2:0] = bp_reg_1[153:151];
+end
+
+always @ (*) begin
+	loops_1000_exit111_70 = loops_1000_exit111_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit111_70_reg = bp_reg_0[64:64];
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_14_S_1) & (loops_1000_exit111_70_reg == 1'd0))) begin
+		loops_1000_loop013_71_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_19_S_1) & (loops_1000_exit117_91_reg == 1'd1))) begin
+		loops_1000_loop013_71_reg[1:0] <= loops_1000_exit117_90_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_14_S_1) & (loops_1000_exit111_70_reg == 1'd0))) begin
+		loops_1000_loop013_72_reg[63:0] <= loops_1000_loop29_64_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_19_S_1) & (loops_1000_exit117_91_reg == 1'd1))) begin
+		loops_1000_loop013_72_reg[63:0] <= loops_1000_loop215_85_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_15_S_0)) begin
+		loops_1000_loop114_73_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_18_S_1) & (loops_1000_exit216_89_reg == 1'd1))) begin
+		loops_1000_loop114_73_reg[1:0] <= loops_1000_exit216_88_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_15_S_0)) begin
+		loops_1000_loop114_74_reg[63:0] <= loops_1000_loop013_72_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_18_S_1) & (loops_1000_exit216_89_reg == 1'd1))) begin
+		loops_1000_loop114_74_reg[63:0] <= loops_1000_loop215_85_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_16_S_0)) begin
+		loops_1000_loop215_75_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_17_S_1) & (loops_1000_loop215_87_reg == 1'd1))) begin
+		loops_1000_loop215_75_reg[1:0] <= loops_1000_loop215_86_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_16_S_0)) begin
+		loops_1000_loop215_76_reg[63:0] <= loops_1000_loop114_74_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_17_S_1) & (loops_1000_loop215_87_reg == 1'd1))) begin
+		loops_1000_loop215_76_reg[63:0] <= loops_1000_loop215_85_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop215_77[7:0] = loops_1000_loop215_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop215_77_reg[7:0] = bp_reg_0[21:14];
+end
+
+always @ (*) begin
+	loops_1000_loop215_79[31:0] = (loops_1000_loop29_58_reg ^ loops_1000_loop2_15_reg);
+end
+
+always @ (*) begin
+	loops_1000_loop215_79_reg[31:0] = bp_reg_0[53:22];
+end
+
+always @ (*) begin
+	loops_1000_loop215_80[15:0] = loops_1000_loop215_add_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_17_S_0)) begin
+		loops_1000_loop215_80_reg[15:0] <= loops_1000_loop215_80[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_62_S_0)) begin
+		loops_1000_loop215_80_reg[15:0] <= loops_1000_loop269_268[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_92_S_0)) begin
+		loops_1000_loop215_80_reg[15:0] <= loops_1000_loop2105_393[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_117_S_0)) begin
+		loops_1000_loop215_80_reg[15:0] <= loops_1000_loop2135_504[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_162_S_0)) begin
+		loops_1000_loop215_80_reg[15:0] <= loops_1000_loop2189_686[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop215_81[63:0] = (loops_1000_loop29_55_reg | loops_1000_loop23_40_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_17_S_0)) begin
+		loops_1000_loop215_81_reg[63:0] <= loops_1000_loop215_81[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop215_82[7:0] = (loops_1000_loop2_18_reg ^ loops_1000_loop23_41_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_17_S_0)) begin
+		bp_reg_2[9:2] <= loops_1000_loop215_82[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_17_S_0)) begin
+		bp_reg_2[25:10] <= loops_1000_loop215_83[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_17_S_0)) begin
+		bp_reg_2[57:26] <= loops_1000_loop215_84[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_17_S_0)) begin
+		bp_reg_2[58:58] <= loops_1000_loop215_87;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_22_S_0)) begin
+		bp_reg_2[129:122] <= loops_1000_loop221_104[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_22_S_0)) begin
+		bp_reg_2[193:130] <= loops_1000_loop221_105[63:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_24_S_0)) begin
+		bp_reg_2[115:113] <= loops_1000_exit123_111[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_27_S_0)) begin
+		bp_reg_2[62:31] <= loops_1000_loop227_125[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_27_S_0)) begin
+		bp_reg_2[78:63] <= loops_1000_loop227_126[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_27_S_0)) begin
+		bp_reg_2[79:79] <= loops_1000_loop227_129;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_37_S_1)) begin
+		bp_reg_2[121:90] <= loops_1000_loop239_162[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_37_S_0)) begin
+		bp_reg_2[90:90] <= loops_1000_loop239_171;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_39_S_0)) begin
+		bp_reg_2[20:18] <= loops_1000_exit141_174[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_84_S_0)) begin
+		bp_reg_2[19:17] <= loops_1000_exit195_363[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_87_S_0)) begin
+		bp_reg_2[169:154] <= loops_1000_loop299_378[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_87_S_0)) begin
+		bp_reg_2[170:170] <= loops_1000_loop299_381;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_89_S_0)) begin
+		bp_reg_2[123:121] <= loops_1000_exit1101_384[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_99_S_0)) begin
+		bp_reg_2[107:105] <= loops_1000_exit1113_426[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_102_S_0)) begin
+		bp_reg_2[75:60] <= loops_1000_loop2117_439[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_114_S_0)) begin
+		bp_reg_2[141:139] <= loops_1000_exit1131_489[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_127_S_1)) begin
+		bp_reg_2[54:23] <= loops_1000_loop2147_546[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_128_S_0)) begin
+		bp_reg_2[55:55] <= loops_1000_exit2148_551;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_129_S_0)) begin
+		bp_reg_2[12:10] <= loops_1000_exit1149_552[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_132_S_0)) begin
+		bp_reg_2[146:146] <= loops_1000_loop2153_570;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_134_S_0)) begin
+		bp_reg_2[115:113] <= loops_1000_exit1155_573[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_139_S_0)) begin
+		bp_reg_2[139:137] <= loops_1000_exit1161_594[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_149_S_0)) begin
+		bp_reg_2[84:82] <= loops_1000_exit1173_636[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_152_S_0)) begin
+		bp_reg_2[31:0] <= loops_1000_loop2177_648[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_152_S_0)) begin
+		bp_reg_2[39:32] <= loops_1000_loop2177_649[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_152_S_0)) begin
+		bp_reg_2[55:40] <= loops_1000_loop2177_650[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_152_S_0)) begin
+		bp_reg_2[124:124] <= loops_1000_loop2177_654;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_154_S_0)) begin
+		bp_reg_2[117:115] <= loops_1000_exit1179_657[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_159_S_0)) begin
+		bp_reg_2[181:179] <= loops_1000_exit1185_678[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_162_S_0)) begin
+		bp_reg_2[73:66] <= loops_1000_loop2189_691[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_162_S_0)) begin
+		bp_reg_2[105:74] <= loops_1000_loop2189_693[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_162_S_0)) begin
+		bp_reg_2[106:106] <= loops_1000_loop2189_696;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_163_S_0)) begin
+		bp_reg_2[111:111] <= loops_1000_exit2190_698;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_169_S_0)) begin
+		bp_reg_2[171:169] <= loops_1000_exit1197_720[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_172_S_0)) begin
+		bp_reg_2[185:122] <= loops_1000_loop2201_735[63:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_172_S_0)) begin
+		bp_reg_2[186:186] <= loops_1000_loop2201_738;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_182_S_0)) begin
+		bp_reg_2[146:146] <= loops_1000_loop2213_780;
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop215_82_reg[7:0] = bp_reg_2[9:2];
+end
+
+always @ (*) begin
+	loops_1000_loop215_83[15:0] = loops_1000_loop215_mul_16_16_0[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop215_83_reg[15:0] = bp_reg_2[25:10];
+end
+
+always @ (*) begin
+	loops_1000_loop215_84[31:0] = (loops_1000_loop29_58_reg ^ loops_1000_loop29_59_reg);
+end
+
+always @ (*) begin
+	loops_1000_loop215_84_reg[31:0] = bp_reg_2[57:26];
+end
+
+always @ (*) begin
+	loops_1000_loop215_85[63:0] = (loops_1000_loop215_76_reg + loops_1000_loop215_84);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_17_S_0)) begin
+		loops_1000_loop215_85_reg[63:0] <= loops_1000_loop215_85[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop215_86[31:0] = loops_1000_loop215_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop215_86_reg[2:0] = bp_reg_0[5:3];
+end
+
+always @ (*) begin
+	loops_1000_loop215_87 = loops_1000_loop215_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_loop215_87_reg = bp_reg_2[58:58];
+end
+
+always @ (*) begin
+	loops_1000_exit216_88[31:0] = loops_1000_exit216_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit216_88_reg[2:0] = bp_reg_0[2:0];
+end
+
+always @ (*) begin
+	loops_1000_exit216_89 = loops_1000_exit216_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit216_89_reg = bp_reg_0[3:3];
+end
+
+always @ (*) begin
+	loops_1000_exit117_90[31:0] = loops_1000_exit117_add_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_19_S_0)) begin
+		bp_reg_6[28:26] <= loops_1000_exit117_90[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_42_S_0)) begin
+		bp_reg_6[29:14] <= loops_1000_loop245_189[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_42_S_0)) begin
+		bp_reg_6[30:30] <= loops_1000_loop245_192;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_82_S_0)) begin
+		bp_reg_6[31:0] <= loops_1000_loop293_355[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_119_S_0)) begin
+		bp_reg_6[23:21] <= loops_1000_exit1137_510[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_122_S_0)) begin
+		bp_reg_6[15:0] <= loops_1000_loop2141_525[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_122_S_1)) begin
+		bp_reg_6[16:16] <= loops_1000_loop2141_528;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_144_S_0)) begin
+		bp_reg_6[15:13] <= loops_1000_exit1167_615[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_179_S_0)) begin
+		bp_reg_6[3:1] <= loops_1000_exit1209_762[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_184_S_0)) begin
+		bp_reg_6[31:29] <= loops_1000_exit1215_783[2:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_exit117_90_reg[2:0] = bp_reg_6[28:26];
+end
+
+always @ (*) begin
+	loops_1000_exit117_91 = loops_1000_exit117_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit117_91_reg = bp_reg_0[0:0];
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_19_S_1) & (loops_1000_exit117_91_reg == 1'd0))) begin
+		loops_1000_loop019_92_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_24_S_1) & (loops_1000_exit123_112_reg == 1'd1))) begin
+		loops_1000_loop019_92_reg[1:0] <= loops_1000_exit123_111_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_19_S_1) & (loops_1000_exit117_91_reg == 1'd0))) begin
+		loops_1000_loop019_93_reg[63:0] <= loops_1000_loop215_85_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_24_S_1) & (loops_1000_exit123_112_reg == 1'd1))) begin
+		loops_1000_loop019_93_reg[63:0] <= loops_1000_loop221_106_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_20_S_0)) begin
+		loops_1000_loop120_94_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_23_S_1) & (loops_1000_exit222_110_reg == 1'd1))) begin
+		loops_1000_loop120_94_reg[1:0] <= loops_1000_exit222_109_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_20_S_0)) begin
+		loops_1000_loop120_95_reg[63:0] <= loops_1000_loop019_93_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_23_S_1) & (loops_1000_exit222_110_reg == 1'd1))) begin
+		loops_1000_loop120_95_reg[63:0] <= loops_1000_loop221_106_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_21_S_0)) begin
+		loops_1000_loop221_96_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_22_S_1) & (loops_1000_loop221_108_reg == 1'd1))) begin
+		loops_1000_loop221_96_reg[1:0] <= loops_1000_loop221_107_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_21_S_0)) begin
+		loops_1000_loop221_97_reg[63:0] <= loops_1000_loop120_95_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_22_S_1) & (loops_1000_loop221_108_reg == 1'd1))) begin
+		loops_1000_loop221_97_reg[63:0] <= loops_1000_loop221_106_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop221_98[63:0] = (loops_1000_loop215_81_reg | loops_1000_loop215_81_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_22_S_0)) begin
+		loops_1000_loop221_98_reg[63:0] <= loops_1000_loop221_98[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop221_99[63:0] = (loops_1000_loop221_97_reg ^ loops_1000_loop29_63_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_22_S_0)) begin
+		loops_1000_loop221_99_reg[63:0] <= loops_1000_loop221_99[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop221_100[7:0] = loops_1000_loop221_and_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_22_S_0)) begin
+		bp_reg_11[7:0] <= loops_1000_loop221_100[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_74_S_0)) begin
+		bp_reg_11[4:2] <= loops_1000_exit183_321[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_127_S_0)) begin
+		bp_reg_11[6:6] <= loops_1000_loop2147_549;
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop221_100_reg[7:0] = bp_reg_11[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop221_101[31:0] = (loops_1000_loop215_84_reg - loops_1000_loop2_19_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_22_S_0)) begin
+		loops_1000_loop221_101_reg[31:0] <= loops_1000_loop221_101[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop221_102[7:0] = loops_1000_loop221_and_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_22_S_1)) begin
+		loops_1000_loop221_102_reg[7:0] <= loops_1000_loop221_102[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_82_S_0)) begin
+		loops_1000_loop221_102_reg[7:0] <= loops_1000_loop293_354[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_162_S_1)) begin
+		loops_1000_loop221_102_reg[7:0] <= loops_1000_loop2189_692[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop221_103[63:0] = (loops_1000_loop221_99_reg * loops_1000_loop29_60_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_22_S_1)) begin
+		loops_1000_loop221_103_reg[63:0] <= loops_1000_loop221_103[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop221_104[7:0] = loops_1000_loop221_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop221_104_reg[7:0] = bp_reg_2[129:122];
+end
+
+always @ (*) begin
+	loops_1000_loop221_105[63:0] = (loops_1000_loop221_98 | loops_1000_loop215_77_reg);
+end
+
+always @ (*) begin
+	loops_1000_loop221_105_reg[63:0] = bp_reg_2[193:130];
+end
+
+always @ (*) begin
+	loops_1000_loop221_106[63:0] = (loops_1000_loop221_97_reg + loops_1000_loop221_105);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_22_S_0)) begin
+		loops_1000_loop221_106_reg[63:0] <= loops_1000_loop221_106[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop221_107[31:0] = loops_1000_loop221_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop221_107_reg[2:0] = bp_reg_0[11:9];
+end
+
+always @ (*) begin
+	loops_1000_loop221_108 = loops_1000_loop221_icmp_8_0;
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_22_S_0)) begin
+		bp_reg_17 <= loops_1000_loop221_108;
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop221_108_reg = bp_reg_17;
+end
+
+always @ (*) begin
+	loops_1000_exit222_109[31:0] = loops_1000_exit222_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit222_109_reg[2:0] = bp_reg_0[8:6];
+end
+
+always @ (*) begin
+	loops_1000_exit222_110 = loops_1000_exit222_icmp_8_0;
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_23_S_0)) begin
+		bp_reg_18 <= loops_1000_exit222_110;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_88_S_0)) begin
+		bp_reg_18 <= loops_1000_exit2100_383;
+	end
+end
+
+always @ (*) begin
+	loops_1000_exit222_110_reg = bp_reg_18;
+end
+
+always @ (*) begin
+	loops_1000_exit123_111[31:0] = loops_1000_exit123_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit123_111_reg[2:0] = bp_reg_2[115:113];
+end
+
+always @ (*) begin
+	loops_1000_exit123_112 = loops_1000_exit123_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit123_112_reg = bp_reg_0[6:6];
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_24_S_1) & (loops_1000_exit123_112_reg == 1'd0))) begin
+		loops_1000_loop025_113_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_29_S_1) & (loops_1000_exit129_133_reg == 1'd1))) begin
+		loops_1000_loop025_113_reg[1:0] <= loops_1000_exit129_132_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_24_S_1) & (loops_1000_exit123_112_reg == 1'd0))) begin
+		loops_1000_loop025_114_reg[63:0] <= loops_1000_loop221_106_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_29_S_1) & (loops_1000_exit129_133_reg == 1'd1))) begin
+		loops_1000_loop025_114_reg[63:0] <= loops_1000_loop227_127_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_25_S_0)) begin
+		loops_1000_loop126_115_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_28_S_1) & (loops_1000_exit228_131_reg == 1'd1))) begin
+		loops_1000_loop126_115_reg[1:0] <= loops_1000_exit228_130_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_25_S_0)) begin
+		loops_1000_loop126_116_reg[63:0] <= loops_1000_loop025_114_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_28_S_1) & (loops_1000_exit228_131_reg == 1'd1))) begin
+		loops_1000_loop126_116_reg[63:0] <= loops_1000_loop227_127_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_26_S_0)) begin
+		loops_1000_loop227_117_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_27_S_1) & (loops_1000_loop227_129_reg == 1'd1))) begin
+		loops_1000_loop227_117_reg[1:0] <= loops_1000_loop227_128_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_26_S_0)) begin
+		loops_1000_loop227_118_reg[63:0] <= loops_1000_loop126_116_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_27_S_1) & (loops_1000_loop227_129_reg == 1'd1))) begin
+		loops_1000_loop227_118_reg[63:0] <= loops_1000_loop227_127_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop227_119[15:0] = loops_1000_loop227_and_16_16_0[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop227_119_reg[15:0] = bp_reg_1[53:38];
+end
+
+always @ (*) begin
+	loops_1000_loop227_120[7:0] = loops_1000_loop227_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop227_120_reg[7:0] = bp_reg_1[61:54];
+end
+
+always @ (*) begin
+	loops_1000_loop227_121[31:0] = (loops_1000_loop29_58_reg - loops_1000_loop29_63_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_27_S_0)) begin
+		loops_1000_loop227_121_reg[31:0] <= loops_1000_loop227_121[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop227_122[63:0] = (loops_1000_loop221_105_reg ^ loops_1000_loop221_103_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_27_S_0)) begin
+		loops_1000_loop227_122_reg[63:0] <= loops_1000_loop227_122[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop227_124[63:0] = (loops_1000_loop221_99_reg * loops_1000_loop215_83_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_27_S_0)) begin
+		loops_1000_loop227_124_reg[63:0] <= loops_1000_loop227_124[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop227_125[31:0] = loops_1000_loop227_or_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop227_125_reg[31:0] = bp_reg_2[62:31];
+end
+
+always @ (*) begin
+	loops_1000_loop227_126[15:0] = (loops_1000_loop2_20_reg ^ loops_1000_loop29_61_reg);
+end
+
+always @ (*) begin
+	loops_1000_loop227_126_reg[15:0] = bp_reg_2[78:63];
+end
+
+always @ (*) begin
+	loops_1000_loop227_127[63:0] = (loops_1000_loop227_118_reg + loops_1000_loop227_126);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_27_S_0)) begin
+		loops_1000_loop227_127_reg[63:0] <= loops_1000_loop227_127[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop227_128[31:0] = loops_1000_loop227_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop227_128_reg[2:0] = bp_reg_0[5:3];
+end
+
+always @ (*) begin
+	loops_1000_loop227_129 = loops_1000_loop227_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_loop227_129_reg = bp_reg_2[79:79];
+end
+
+always @ (*) begin
+	loops_1000_exit228_130[31:0] = loops_1000_exit228_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit228_130_reg[2:0] = bp_reg_0[2:0];
+end
+
+always @ (*) begin
+	loops_1000_exit228_131 = loops_1000_exit228_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit228_131_reg = bp_reg_0[3:3];
+end
+
+always @ (*) begin
+	loops_1000_exit129_132[31:0] = loops_1000_exit129_add_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_29_S_0)) begin
+		bp_reg_3[58:56] <= loops_1000_exit129_132[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_34_S_0)) begin
+		bp_reg_3[82:80] <= loops_1000_exit135_153[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_44_S_0)) begin
+		bp_reg_3[74:72] <= loops_1000_exit147_195[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_94_S_0)) begin
+		bp_reg_3[58:56] <= loops_1000_exit1107_405[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_97_S_0)) begin
+		bp_reg_3[64:1] <= loops_1000_loop2111_416[63:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_97_S_0)) begin
+		bp_reg_3[80:65] <= loops_1000_loop2111_418[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_97_S_0)) begin
+		bp_reg_3[88:81] <= loops_1000_loop2111_419[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_157_S_0)) begin
+		bp_reg_3[65:2] <= loops_1000_loop2183_672[63:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_157_S_0)) begin
+		bp_reg_3[66:66] <= loops_1000_loop2183_675;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_189_S_0)) begin
+		bp_reg_3[2:0] <= loops_1000_exit1221_804[2:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_exit129_132_reg[2:0] = bp_reg_3[58:56];
+end
+
+always @ (*) begin
+	loops_1000_exit129_133 = loops_1000_exit129_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit129_133_reg = bp_reg_0[0:0];
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_29_S_1) & (loops_1000_exit129_133_reg == 1'd0))) begin
+		loops_1000_loop031_134_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_34_S_1) & (loops_1000_exit135_154_reg == 1'd1))) begin
+		loops_1000_loop031_134_reg[1:0] <= loops_1000_exit135_153_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_29_S_1) & (loops_1000_exit129_133_reg == 1'd0))) begin
+		loops_1000_loop031_135_reg[63:0] <= loops_1000_loop227_127_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_34_S_1) & (loops_1000_exit135_154_reg == 1'd1))) begin
+		loops_1000_loop031_135_reg[63:0] <= loops_1000_loop233_148_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_30_S_0)) begin
+		loops_1000_loop132_136_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_33_S_1) & (loops_1000_exit234_152_reg == 1'd1))) begin
+		loops_1000_loop132_136_reg[1:0] <= loops_1000_exit234_151_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_30_S_0)) begin
+		loops_1000_loop132_137_reg[63:0] <= loops_1000_loop031_135_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_33_S_1) & (loops_1000_exit234_152_reg == 1'd1))) begin
+		loops_1000_loop132_137_reg[63:0] <= loops_1000_loop233_148_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_31_S_0)) begin
+		loops_1000_loop233_138_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_32_S_2) & (loops_1000_loop233_150_reg == 1'd1))) begin
+		loops_1000_loop233_138_reg[1:0] <= loops_1000_loop233_149_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_31_S_0)) begin
+		loops_1000_loop233_139_reg[63:0] <= loops_1000_loop132_137_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_32_S_2) & (loops_1000_loop233_150_reg == 1'd1))) begin
+		loops_1000_loop233_139_reg[63:0] <= loops_1000_loop233_148_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop233_140[7:0] = loops_1000_loop233_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop233_140_reg[7:0] = bp_reg_1[10:3];
+end
+
+always @ (*) begin
+	loops_1000_loop233_141[63:0] = (loops_1000_loop227_122_reg ^ loops_1000_loop227_118_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_32_S_0)) begin
+		loops_1000_loop233_141_reg[63:0] <= loops_1000_loop233_141[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop233_142[15:0] = loops_1000_loop233_add_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_32_S_0)) begin
+		loops_1000_loop233_142_reg[15:0] <= loops_1000_loop233_142[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_177_S_0)) begin
+		loops_1000_loop233_142_reg[15:0] <= loops_1000_loop2207_755[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop233_143[7:0] = loops_1000_loop233_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop233_143_reg[7:0] = bp_reg_1[196:189];
+end
+
+always @ (*) begin
+	loops_1000_loop233_145[31:0] = (loops_1000_loop215_79_reg ^ loops_1000_loop29_59_reg);
+end
+
+always @ (*) begin
+	loops_1000_loop233_145_reg[31:0] = bp_reg_1[228:197];
+end
+
+always @ (*) begin
+	loops_1000_loop233_146[7:0] = loops_1000_loop233_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop233_146_reg[7:0] = bp_reg_1[236:229];
+end
+
+always @ (*) begin
+	loops_1000_loop233_147[31:0] = loops_1000_loop233_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop233_147_reg[31:0] = loops_1000_loop29_58_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop233_148[63:0] = (loops_1000_loop233_139_reg + loops_1000_loop233_147);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_32_S_0)) begin
+		loops_1000_loop233_148_reg[63:0] <= loops_1000_loop233_148[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop233_149[31:0] = loops_1000_loop233_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop233_149_reg[2:0] = bp_reg_1[2:0];
+end
+
+always @ (*) begin
+	loops_1000_loop233_150 = loops_1000_loop233_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_loop233_150_reg = bp_reg_4[13:13];
+end
+
+always @ (*) begin
+	loops_1000_exit234_151[31:0] = loops_1000_exit234_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit234_151_reg[2:0] = bp_reg_0[8:6];
+end
+
+always @ (*) begin
+	loops_1000_exit234_152 = loops_1000_exit234_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit234_152_reg = bp_reg_1[0:0];
+end
+
+always @ (*) begin
+	loops_1000_exit135_153[31:0] = loops_1000_exit135_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit135_153_reg[2:0] = bp_reg_3[82:80];
+end
+
+always @ (*) begin
+	loops_1000_exit135_154 = loops_1000_exit135_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit135_154_reg = bp_reg_0[6:6];
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_34_S_1) & (loops_1000_exit135_154_reg == 1'd0))) begin
+		loops_1000_loop037_155_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_39_S_1) & (loops_1000_exit141_175_reg == 1'd1))) begin
+		loops_1000_loop037_155_reg[1:0] <= loops_1000_exit141_174_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_34_S_1) & (loops_1000_exit135_154_reg == 1'd0))) begin
+		loops_1000_loop037_156_reg[63:0] <= loops_1000_loop233_148_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_39_S_1) & (loops_1000_exit141_175_reg == 1'd1))) begin
+		loops_1000_loop037_156_reg[63:0] <= loops_1000_loop239_169_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_35_S_0)) begin
+		loops_1000_loop138_157_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_38_S_1) & (loops_1000_exit240_173_reg == 1'd1))) begin
+		loops_1000_loop138_157_reg[1:0] <= loops_1000_exit240_172_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_35_S_0)) begin
+		loops_1000_loop138_158_reg[63:0] <= loops_1000_loop037_156_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_38_S_1) & (loops_1000_exit240_173_reg == 1'd1))) begin
+		loops_1000_loop138_158_reg[63:0] <= loops_1000_loop239_169_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_36_S_0)) begin
+		loops_1000_loop239_159_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_37_S_2) & (loops_1000_loop239_171_reg == 1'd1))) begin
+		loops_1000_loop239_159_reg[1:0] <= loops_1000_loop239_170_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_36_S_0)) begin
+		loops_1000_loop239_160_reg[63:0] <= loops_1000_loop138_158_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_37_S_2) & (loops_1000_loop239_171_reg == 1'd1))) begin
+		loops_1000_loop239_160_reg[63:0] <= loops_1000_loop239_169_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop239_161[31:0] = loops_1000_loop239_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop239_161_reg[31:0] = bp_reg_0[45:14];
+end
+
+always @ (*) begin
+	loops_1000_loop239_162[31:0] = loops_1000_loop239_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop239_162_reg[31:0] = bp_reg_2[121:90];
+end
+
+always @ (*) begin
+	loops_1000_loop239_164[7:0] = loops_1000_loop239_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop239_164_reg[7:0] = bp_reg_0[53:46];
+end
+
+always @ (*) begin
+	loops_1000_loop239_165[31:0] = (loops_1000_loop239_162 ^ loops_1000_loop239_161_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_37_S_1)) begin
+		loops_1000_loop239_165_reg[31:0] <= loops_1000_loop239_165[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop239_166[31:0] = loops_1000_loop239_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop239_166_reg[31:0] = loops_1000_loop29_59_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop239_168[63:0] = (loops_1000_loop227_118_reg + loops_1000_loop227_124_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_37_S_0)) begin
+		loops_1000_loop239_168_reg[63:0] <= loops_1000_loop239_168[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop239_169[63:0] = (loops_1000_loop239_160_reg + loops_1000_loop239_168);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_37_S_0)) begin
+		loops_1000_loop239_169_reg[63:0] <= loops_1000_loop239_169[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop239_170[31:0] = loops_1000_loop239_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop239_170_reg[2:0] = bp_reg_0[5:3];
+end
+
+always @ (*) begin
+	loops_1000_loop239_171 = loops_1000_loop239_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_loop239_171_reg = bp_reg_2[90:90];
+end
+
+always @ (*) begin
+	loops_1000_exit240_172[31:0] = loops_1000_exit240_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit240_172_reg[2:0] = bp_reg_0[2:0];
+end
+
+always @ (*) begin
+	loops_1000_exit240_173 = loops_1000_exit240_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit240_173_reg = bp_reg_0[3:3];
+end
+
+always @ (*) begin
+	loops_1000_exit141_174[31:0] = loops_1000_exit141_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit141_174_reg[2:0] = bp_reg_2[20:18];
+end
+
+always @ (*) begin
+	loops_1000_exit141_175 = loops_1000_exit141_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit141_175_reg = bp_reg_0[0:0];
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_39_S_1) & (loops_1000_exit141_175_reg == 1'd0))) begin
+		loops_1000_loop043_176_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_44_S_1) & (loops_1000_exit147_196_reg == 1'd1))) begin
+		loops_1000_loop043_176_reg[1:0] <= loops_1000_exit147_195_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_39_S_1) & (loops_1000_exit141_175_reg == 1'd0))) begin
+		loops_1000_loop043_177_reg[63:0] <= loops_1000_loop239_169_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_44_S_1) & (loops_1000_exit147_196_reg == 1'd1))) begin
+		loops_1000_loop043_177_reg[63:0] <= loops_1000_loop245_190_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_40_S_0)) begin
+		loops_1000_loop144_178_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_43_S_1) & (loops_1000_exit246_194_reg == 1'd1))) begin
+		loops_1000_loop144_178_reg[1:0] <= loops_1000_exit246_193_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_40_S_0)) begin
+		loops_1000_loop144_179_reg[63:0] <= loops_1000_loop043_177_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_43_S_1) & (loops_1000_exit246_194_reg == 1'd1))) begin
+		loops_1000_loop144_179_reg[63:0] <= loops_1000_loop245_190_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_41_S_0)) begin
+		loops_1000_loop245_180_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_42_S_1) & (loops_1000_loop245_192_reg == 1'd1))) begin
+		loops_1000_loop245_180_reg[1:0] <= loops_1000_loop245_191_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_41_S_0)) begin
+		loops_1000_loop245_181_reg[63:0] <= loops_1000_loop144_179_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_42_S_1) & (loops_1000_loop245_192_reg == 1'd1))) begin
+		loops_1000_loop245_181_reg[63:0] <= loops_1000_loop245_190_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop245_182[15:0] = loops_1000_loop245_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop245_182_reg[15:0] = bp_reg_1[77:62];
+end
+
+always @ (*) begin
+	loops_1000_loop245_183[15:0] = (loops_1000_loop233_142_reg ^ loops_1000_loop227_126_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_42_S_0)) begin
+		loops_1000_loop245_183_reg[15:0] <= loops_1000_loop245_183[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop245_184[15:0] = loops_1000_loop245_add_16_16_1[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_42_S_0)) begin
+		loops_1000_loop245_184_reg[15:0] <= loops_1000_loop245_184[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_67_S_0)) begin
+		loops_1000_loop245_184_reg[15:0] <= loops_1000_loop275_290[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_117_S_0)) begin
+		loops_1000_loop245_184_reg[15:0] <= loops_1000_loop2135_499[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_167_S_0)) begin
+		loops_1000_loop245_184_reg[15:0] <= loops_1000_loop2195_712[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop245_185[7:0] = loops_1000_loop245_and_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_42_S_0)) begin
+		bp_reg_12[7:0] <= loops_1000_loop245_185[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop245_185_reg[7:0] = bp_reg_12[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop245_186[31:0] = loops_1000_loop245_and_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_42_S_0)) begin
+		bp_reg_5[31:0] <= loops_1000_loop245_186[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_93_S_0)) begin
+		bp_reg_5[20:20] <= loops_1000_exit2106_404;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_117_S_0)) begin
+		bp_reg_5[2:2] <= loops_1000_loop2135_503;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_147_S_0)) begin
+		bp_reg_5[25:25] <= loops_1000_loop2171_633;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_177_S_0)) begin
+		bp_reg_5[29:29] <= loops_1000_loop2207_759;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_192_S_0)) begin
+		bp_reg_5[26:26] <= loops_1000_loop2225_822;
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop245_186_reg[31:0] = bp_reg_5[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop245_187[31:0] = (loops_1000_loop239_162_reg ^ loops_1000_loop245_186);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_42_S_0)) begin
+		loops_1000_loop245_187_reg[31:0] <= loops_1000_loop245_187[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop245_188[15:0] = loops_1000_loop245_mul_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_42_S_0)) begin
+		loops_1000_loop245_188_reg[15:0] <= loops_1000_loop245_188[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_67_S_0)) begin
+		loops_1000_loop245_188_reg[15:0] <= loops_1000_loop275_292[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop245_189[15:0] = loops_1000_loop245_or_16_16_0[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop245_189_reg[15:0] = bp_reg_6[29:14];
+end
+
+always @ (*) begin
+	loops_1000_loop245_190[63:0] = (loops_1000_loop245_181_reg + loops_1000_loop245_189);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_42_S_0)) begin
+		loops_1000_loop245_190_reg[63:0] <= loops_1000_loop245_190[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop245_191[31:0] = loops_1000_loop245_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop245_191_reg[2:0] = bp_reg_1[2:0];
+end
+
+always @ (*) begin
+	loops_1000_loop245_192 = loops_1000_loop245_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_loop245_192_reg = bp_reg_6[30:30];
+end
+
+always @ (*) begin
+	loops_1000_exit246_193[31:0] = loops_1000_exit246_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit246_193_reg[2:0] = bp_reg_0[8:6];
+end
+
+always @ (*) begin
+	loops_1000_exit246_194 = loops_1000_exit246_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit246_194_reg = bp_reg_1[0:0];
+end
+
+always @ (*) begin
+	loops_1000_exit147_195[31:0] = loops_1000_exit147_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit147_195_reg[2:0] = bp_reg_3[74:72];
+end
+
+always @ (*) begin
+	loops_1000_exit147_196 = loops_1000_exit147_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit147_196_reg = bp_reg_0[6:6];
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_44_S_1) & (loops_1000_exit147_196_reg == 1'd0))) begin
+		loops_1000_loop049_197_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_49_S_1) & (loops_1000_exit153_217_reg == 1'd1))) begin
+		loops_1000_loop049_197_reg[1:0] <= loops_1000_exit153_216_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_44_S_1) & (loops_1000_exit147_196_reg == 1'd0))) begin
+		loops_1000_loop049_198_reg[63:0] <= loops_1000_loop245_190_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_49_S_1) & (loops_1000_exit153_217_reg == 1'd1))) begin
+		loops_1000_loop049_198_reg[63:0] <= loops_1000_loop251_211_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_45_S_0)) begin
+		loops_1000_loop150_199_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_48_S_1) & (loops_1000_exit252_215_reg == 1'd1))) begin
+		loops_1000_loop150_199_reg[1:0] <= loops_1000_exit252_214_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_45_S_0)) begin
+		loops_1000_loop150_200_reg[63:0] <= loops_1000_loop049_198_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_48_S_1) & (loops_1000_exit252_215_reg == 1'd1))) begin
+		loops_1000_loop150_200_reg[63:0] <= loops_1000_loop251_211_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_46_S_0)) begin
+		loops_1000_loop251_201_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_47_S_1) & (loops_1000_loop251_213_reg == 1'd1))) begin
+		loops_1000_loop251_201_reg[1:0] <= loops_1000_loop251_212_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_46_S_0)) begin
+		loops_1000_loop251_202_reg[63:0] <= loops_1000_loop150_200_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_47_S_1) & (loops_1000_loop251_213_reg == 1'd1))) begin
+		loops_1000_loop251_202_reg[63:0] <= loops_1000_loop251_211_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop251_204[15:0] = loops_1000_loop251_or_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_47_S_0)) begin
+		loops_1000_loop251_204_reg[15:0] <= loops_1000_loop251_204[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_182_S_0)) begin
+		loops_1000_loop251_204_reg[15:0] <= loops_1000_loop2213_773[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop251_205[15:0] = loops_1000_loop251_add_16_16_1[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_47_S_0)) begin
+		loops_1000_loop251_205_reg[15:0] <= loops_1000_loop251_205[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_87_S_0)) begin
+		loops_1000_loop251_205_reg[15:0] <= loops_1000_loop299_374[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_127_S_0)) begin
+		loops_1000_loop251_205_reg[15:0] <= loops_1000_loop2147_544[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop251_206[7:0] = (loops_1000_loop221_102_reg - loops_1000_loop221_102_reg);
+end
+
+always @ (*) begin
+	loops_1000_loop251_206_reg = bp_reg_1[46:46];
+end
+
+always @ (*) begin
+	loops_1000_loop251_207[63:0] = (loops_1000_loop233_141_reg * loops_1000_loop245_181_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_47_S_0)) begin
+		loops_1000_loop251_207_reg[63:0] <= loops_1000_loop251_207[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop251_208[15:0] = loops_1000_loop251_mul_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_47_S_0)) begin
+		loops_1000_loop251_208_reg[15:0] <= loops_1000_loop251_208[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_82_S_0)) begin
+		loops_1000_loop251_208_reg[15:0] <= loops_1000_loop293_350[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop251_210[7:0] = (loops_1000_loop227_120_reg - loops_1000_loop239_164_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_47_S_0)) begin
+		bp_reg_9[10:3] <= loops_1000_loop251_210[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_47_S_0)) begin
+		bp_reg_9[11:11] <= loops_1000_loop251_213;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_79_S_0)) begin
+		bp_reg_9[3:1] <= loops_1000_exit189_342[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_87_S_0)) begin
+		bp_reg_9[14:7] <= loops_1000_loop299_375[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_132_S_0)) begin
+		bp_reg_9[7:0] <= loops_1000_loop2153_566[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_172_S_0)) begin
+		bp_reg_9[18:3] <= loops_1000_loop2201_732[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop251_210_reg[7:0] = bp_reg_9[10:3];
+end
+
+always @ (*) begin
+	loops_1000_loop251_211[63:0] = (loops_1000_loop251_202_reg + loops_1000_loop251_210);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_47_S_0)) begin
+		loops_1000_loop251_211_reg[63:0] <= loops_1000_loop251_211[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop251_212[31:0] = loops_1000_loop251_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop251_212_reg[2:0] = bp_reg_0[5:3];
+end
+
+always @ (*) begin
+	loops_1000_loop251_213 = loops_1000_loop251_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_loop251_213_reg = bp_reg_9[11:11];
+end
+
+always @ (*) begin
+	loops_1000_exit252_214[31:0] = loops_1000_exit252_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit252_214_reg[2:0] = bp_reg_0[2:0];
+end
+
+always @ (*) begin
+	loops_1000_exit252_215 = loops_1000_exit252_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit252_215_reg = bp_reg_0[3:3];
+end
+
+always @ (*) begin
+	loops_1000_exit153_216[31:0] = loops_1000_exit153_add_8_8_1[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_49_S_0)) begin
+		bp_reg_13[4:2] <= loops_1000_exit153_216[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_124_S_0)) begin
+		bp_reg_13[2:0] <= loops_1000_exit1143_531[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_132_S_0)) begin
+		bp_reg_13[10:3] <= loops_1000_loop2153_565[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_exit153_216_reg[2:0] = bp_reg_13[4:2];
+end
+
+always @ (*) begin
+	loops_1000_exit153_217 = loops_1000_exit153_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit153_217_reg = bp_reg_0[0:0];
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_49_S_1) & (loops_1000_exit153_217_reg == 1'd0))) begin
+		loops_1000_loop055_218_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_54_S_1) & (loops_1000_exit159_238_reg == 1'd1))) begin
+		loops_1000_loop055_218_reg[1:0] <= loops_1000_exit159_237_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_49_S_1) & (loops_1000_exit153_217_reg == 1'd0))) begin
+		loops_1000_loop055_219_reg[63:0] <= loops_1000_loop251_211_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_54_S_1) & (loops_1000_exit159_238_reg == 1'd1))) begin
+		loops_1000_loop055_219_reg[63:0] <= loops_1000_loop257_232_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_50_S_0)) begin
+		loops_1000_loop156_220_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_53_S_1) & (loops_1000_exit258_236_reg == 1'd1))) begin
+		loops_1000_loop156_220_reg[1:0] <= loops_1000_exit258_235_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_50_S_0)) begin
+		loops_1000_loop156_221_reg[63:0] <= loops_1000_loop055_219_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_53_S_1) & (loops_1000_exit258_236_reg == 1'd1))) begin
+		loops_1000_loop156_221_reg[63:0] <= loops_1000_loop257_232_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_51_S_0)) begin
+		loops_1000_loop257_222_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_52_S_1) & (loops_1000_loop257_234_reg == 1'd1))) begin
+		loops_1000_loop257_222_reg[1:0] <= loops_1000_loop257_233_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_51_S_0)) begin
+		loops_1000_loop257_223_reg[63:0] <= loops_1000_loop156_221_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_52_S_1) & (loops_1000_loop257_234_reg == 1'd1))) begin
+		loops_1000_loop257_223_reg[63:0] <= loops_1000_loop257_232_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop257_224[15:0] = (loops_1000_loop245_188_reg ^ loops_1000_loop245_189_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_52_S_0)) begin
+		loops_1000_loop257_224_reg[15:0] <= loops_1000_loop257_224[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop257_225[63:0] = (loops_1000_loop251_202_reg ^ loops_1000_loop257_223_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_52_S_0)) begin
+		loops_1000_loop257_225_reg[63:0] <= loops_1000_loop257_225[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop257_226[31:0] = loops_1000_loop257_or_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_52_S_0)) begin
+		loops_1000_loop257_226_reg[31:0] <= loops_1000_loop257_226[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_112_S_0)) begin
+		loops_1000_loop257_226_reg[31:0] <= loops_1000_loop2129_479[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_137_S_0)) begin
+		loops_1000_loop257_226_reg[31:0] <= loops_1000_loop2159_582[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_172_S_0)) begin
+		loops_1000_loop257_226_reg[31:0] <= loops_1000_loop2201_729[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop257_229[15:0] = loops_1000_loop257_mul_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_52_S_0)) begin
+		loops_1000_loop257_229_reg[15:0] <= loops_1000_loop257_229[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop257_230[31:0] = (loops_1000_loop239_161_reg ^ loops_1000_loop257_226);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_52_S_0)) begin
+		loops_1000_loop257_230_reg[31:0] <= loops_1000_loop257_230[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop257_231[63:0] = (loops_1000_loop257_223_reg & loops_1000_loop251_202_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_52_S_0)) begin
+		loops_1000_loop257_231_reg[63:0] <= loops_1000_loop257_231[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop257_232[63:0] = (loops_1000_loop257_223_reg + loops_1000_loop257_231);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_52_S_0)) begin
+		loops_1000_loop257_232_reg[63:0] <= loops_1000_loop257_232[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop257_233[31:0] = loops_1000_loop257_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop257_233_reg[2:0] = bp_reg_0[11:9];
+end
+
+always @ (*) begin
+	loops_1000_loop257_234 = loops_1000_loop257_icmp_8_0;
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_52_S_0)) begin
+		bp_reg_15[0:0] <= loops_1000_loop257_234;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_143_S_0)) begin
+		bp_reg_15[5:5] <= loops_1000_exit2166_614;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_172_S_0)) begin
+		bp_reg_15[7:0] <= loops_1000_loop2201_733[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop257_234_reg = bp_reg_15[0:0];
+end
+
+always @ (*) begin
+	loops_1000_exit258_235[31:0] = loops_1000_exit258_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit258_235_reg[2:0] = bp_reg_0[8:6];
+end
+
+always @ (*) begin
+	loops_1000_exit258_236 = loops_1000_exit258_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit258_236_reg = bp_reg_0[9:9];
+end
+
+always @ (*) begin
+	loops_1000_exit159_237[31:0] = loops_1000_exit159_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit159_237_reg[2:0] = bp_reg_1[218:216];
+end
+
+always @ (*) begin
+	loops_1000_exit159_238 = loops_1000_exit159_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit159_238_reg = bp_reg_0[6:6];
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_54_S_1) & (loops_1000_exit159_238_reg == 1'd0))) begin
+		loops_1000_loop061_239_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_59_S_1) & (loops_1000_exit165_259_reg == 1'd1))) begin
+		loops_1000_loop061_239_reg[1:0] <= loops_1000_exit165_258_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_54_S_1) & (loops_1000_exit159_238_reg == 1'd0))) begin
+		loops_1000_loop061_240_reg[63:0] <= loops_1000_loop257_232_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_59_S_1) & (loops_1000_exit165_259_reg == 1'd1))) begin
+		loops_1000_loop061_240_reg[63:0] <= loops_1000_loop263_253_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_55_S_0)) begin
+		loops_1000_loop162_241_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_58_S_1) & (loops_1000_exit264_257_reg == 1'd1))) begin
+		loops_1000_loop162_241_reg[1:0] <= loops_1000_exit264_256_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_55_S_0)) begin
+		loops_1000_loop162_242_reg[63:0] <= loops_1000_loop061_240_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_58_S_1) & (loops_1000_exit264_257_reg == 1'd1))) begin
+		loops_1000_loop162_242_reg[63:0] <= loops_1000_loop263_253_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_56_S_0)) begin
+		loops_1000_loop263_243_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_57_S_1) & (loops_1000_loop263_255_reg == 1'd1))) begin
+		loops_1000_loop263_243_reg[1:0] <= loops_1000_loop263_254_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_56_S_0)) begin
+		loops_1000_loop263_244_reg[63:0] <= loops_1000_loop162_242_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_57_S_1) & (loops_1000_loop263_255_reg == 1'd1))) begin
+		loops_1000_loop263_244_reg[63:0] <= loops_1000_loop263_253_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop263_248[15:0] = loops_1000_loop263_add_16_16_1[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop263_248_reg[15:0] = bp_reg_0[29:14];
+end
+
+always @ (*) begin
+	loops_1000_loop263_249[7:0] = loops_1000_loop263_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop263_249_reg[7:0] = bp_reg_0[37:30];
+end
+
+always @ (*) begin
+	loops_1000_loop263_250[15:0] = (loops_1000_loop257_224_reg - loops_1000_loop251_205_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_57_S_0)) begin
+		loops_1000_loop263_250_reg[15:0] <= loops_1000_loop263_250[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop263_252[7:0] = (loops_1000_loop251_206_reg ^ loops_1000_loop251_210_reg);
+end
+
+always @ (*) begin
+	loops_1000_loop263_252_reg[7:0] = bp_reg_0[82:75];
+end
+
+always @ (*) begin
+	loops_1000_loop263_253[63:0] = (loops_1000_loop263_244_reg + loops_1000_loop263_252);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_57_S_0)) begin
+		loops_1000_loop263_253_reg[63:0] <= loops_1000_loop263_253[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop263_254[31:0] = loops_1000_loop263_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop263_254_reg[2:0] = bp_reg_0[5:3];
+end
+
+always @ (*) begin
+	loops_1000_loop263_255 = loops_1000_loop263_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_loop263_255_reg = bp_reg_0[83:83];
+end
+
+always @ (*) begin
+	loops_1000_exit264_256[31:0] = loops_1000_exit264_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit264_256_reg[2:0] = bp_reg_0[2:0];
+end
+
+always @ (*) begin
+	loops_1000_exit264_257 = loops_1000_exit264_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit264_257_reg = bp_reg_0[3:3];
+end
+
+always @ (*) begin
+	loops_1000_exit165_258[31:0] = loops_1000_exit165_add_8_8_1[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_59_S_0)) begin
+		loops_1000_exit165_258_reg[7:0] <= loops_1000_exit165_258[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_72_S_1)) begin
+		loops_1000_exit165_258_reg[7:0] <= loops_1000_loop281_313[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_137_S_0)) begin
+		loops_1000_exit165_258_reg[7:0] <= loops_1000_loop2159_585[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_177_S_0)) begin
+		loops_1000_exit165_258_reg[7:0] <= loops_1000_loop2207_750[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_197_S_0)) begin
+		loops_1000_exit165_258_reg[7:0] <= loops_1000_loop2231_840[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_exit165_259 = loops_1000_exit165_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit165_259_reg = bp_reg_0[0:0];
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_59_S_1) & (loops_1000_exit165_259_reg == 1'd0))) begin
+		loops_1000_loop067_260_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_64_S_1) & (loops_1000_exit171_280_reg == 1'd1))) begin
+		loops_1000_loop067_260_reg[1:0] <= loops_1000_exit171_279_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_59_S_1) & (loops_1000_exit165_259_reg == 1'd0))) begin
+		loops_1000_loop067_261_reg[63:0] <= loops_1000_loop263_253_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_64_S_1) & (loops_1000_exit171_280_reg == 1'd1))) begin
+		loops_1000_loop067_261_reg[63:0] <= loops_1000_loop269_274_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_60_S_0)) begin
+		loops_1000_loop168_262_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_63_S_1) & (loops_1000_exit270_278_reg == 1'd1))) begin
+		loops_1000_loop168_262_reg[1:0] <= loops_1000_exit270_277_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_60_S_0)) begin
+		loops_1000_loop168_263_reg[63:0] <= loops_1000_loop067_261_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_63_S_1) & (loops_1000_exit270_278_reg == 1'd1))) begin
+		loops_1000_loop168_263_reg[63:0] <= loops_1000_loop269_274_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_61_S_0)) begin
+		loops_1000_loop269_264_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_62_S_1) & (loops_1000_loop269_276_reg == 1'd1))) begin
+		loops_1000_loop269_264_reg[1:0] <= loops_1000_loop269_275_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_61_S_0)) begin
+		loops_1000_loop269_265_reg[63:0] <= loops_1000_loop168_263_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_62_S_1) & (loops_1000_loop269_276_reg == 1'd1))) begin
+		loops_1000_loop269_265_reg[63:0] <= loops_1000_loop269_274_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop269_266[7:0] = loops_1000_loop269_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop269_266_reg[7:0] = bp_reg_0[61:54];
+end
+
+always @ (*) begin
+	loops_1000_loop269_267[31:0] = (loops_1000_loop245_187_reg - loops_1000_loop257_230_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_62_S_0)) begin
+		loops_1000_loop269_267_reg[31:0] <= loops_1000_loop269_267[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop269_268[15:0] = loops_1000_loop269_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop269_268_reg[15:0] = loops_1000_loop215_80_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop269_269[7:0] = (loops_1000_loop245_185_reg ^ loops_1000_loop269_266);
+end
+
+always @ (*) begin
+	loops_1000_loop269_269_reg[7:0] = bp_reg_1[64:57];
+end
+
+always @ (*) begin
+	loops_1000_loop269_270[31:0] = (loops_1000_loop245_187_reg - loops_1000_loop269_267);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_62_S_0)) begin
+		loops_1000_loop269_270_reg[31:0] <= loops_1000_loop269_270[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop269_271[15:0] = (loops_1000_loop263_248_reg - loops_1000_loop263_250_reg);
+end
+
+always @ (*) begin
+	loops_1000_loop269_271_reg[15:0] = bp_reg_1[194:179];
+end
+
+always @ (*) begin
+	loops_1000_loop269_272[31:0] = loops_1000_loop269_or_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_62_S_0)) begin
+		loops_1000_loop269_272_reg[31:0] <= loops_1000_loop269_272[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_127_S_0)) begin
+		loops_1000_loop269_272_reg[31:0] <= loops_1000_loop2147_545[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_172_S_1)) begin
+		loops_1000_loop269_272_reg[31:0] <= loops_1000_loop2201_730[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop269_273[31:0] = loops_1000_loop269_add_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_62_S_0)) begin
+		loops_1000_loop269_273_reg[31:0] <= loops_1000_loop269_273[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_87_S_0)) begin
+		loops_1000_loop269_273_reg[31:0] <= loops_1000_loop299_372[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_122_S_0)) begin
+		loops_1000_loop269_273_reg[31:0] <= loops_1000_loop2141_521[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_142_S_0)) begin
+		loops_1000_loop269_273_reg[31:0] <= loops_1000_loop2165_602[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_152_S_0)) begin
+		loops_1000_loop269_273_reg[31:0] <= loops_1000_loop2177_651[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_182_S_0)) begin
+		loops_1000_loop269_273_reg[31:0] <= loops_1000_loop2213_770[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop269_274[63:0] = (loops_1000_loop269_265_reg + loops_1000_loop269_273);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_62_S_0)) begin
+		loops_1000_loop269_274_reg[63:0] <= loops_1000_loop269_274[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop269_275[31:0] = loops_1000_loop269_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop269_275_reg[2:0] = bp_reg_0[11:9];
+end
+
+always @ (*) begin
+	loops_1000_loop269_276 = loops_1000_loop269_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_loop269_276_reg = bp_reg_4[3:3];
+end
+
+always @ (*) begin
+	loops_1000_exit270_277[31:0] = loops_1000_exit270_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit270_277_reg[2:0] = bp_reg_0[8:6];
+end
+
+always @ (*) begin
+	loops_1000_exit270_278 = loops_1000_exit270_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit270_278_reg = bp_reg_0[9:9];
+end
+
+always @ (*) begin
+	loops_1000_exit171_279[31:0] = loops_1000_exit171_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit171_279_reg[2:0] = bp_reg_1[178:176];
+end
+
+always @ (*) begin
+	loops_1000_exit171_280 = loops_1000_exit171_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit171_280_reg = bp_reg_0[6:6];
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_64_S_1) & (loops_1000_exit171_280_reg == 1'd0))) begin
+		loops_1000_loop073_281_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_69_S_1) & (loops_1000_exit177_301_reg == 1'd1))) begin
+		loops_1000_loop073_281_reg[1:0] <= loops_1000_exit177_300_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_64_S_1) & (loops_1000_exit171_280_reg == 1'd0))) begin
+		loops_1000_loop073_282_reg[63:0] <= loops_1000_loop269_274_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_69_S_1) & (loops_1000_exit177_301_reg == 1'd1))) begin
+		loops_1000_loop073_282_reg[63:0] <= loops_1000_loop275_295_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_65_S_0)) begin
+		loops_1000_loop174_283_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_68_S_1) & (loops_1000_exit276_299_reg == 1'd1))) begin
+		loops_1000_loop174_283_reg[1:0] <= loops_1000_exit276_298_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_65_S_0)) begin
+		loops_1000_loop174_284_reg[63:0] <= loops_1000_loop073_282_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_68_S_1) & (loops_1000_exit276_299_reg == 1'd1))) begin
+		loops_1000_loop174_284_reg[63:0] <= loops_1000_loop275_295_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_66_S_0)) begin
+		loops_1000_loop275_285_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_67_S_1) & (loops_1000_loop275_297_reg == 1'd1))) begin
+		loops_1000_loop275_285_reg[1:0] <= loops_1000_loop275_296_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_66_S_0)) begin
+		loops_1000_loop275_286_reg[63:0] <= loops_1000_loop174_284_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_67_S_1) & (loops_1000_loop275_297_reg == 1'd1))) begin
+		loops_1000_loop275_286_reg[63:0] <= loops_1000_loop275_295_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop275_287[15:0] = (loops_1000_loop269_271_reg - loops_1000_loop269_268_reg);
+end
+
+always @ (*) begin
+	loops_1000_loop275_287_reg[15:0] = bp_reg_0[27:12];
+end
+
+always @ (*) begin
+	loops_1000_loop275_289[7:0] = (loops_1000_loop263_252_reg - loops_1000_loop251_210_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_67_S_0)) begin
+		loops_1000_loop275_289_reg[7:0] <= loops_1000_loop275_289[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop275_290[15:0] = loops_1000_loop275_add_16_16_1[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop275_290_reg[15:0] = loops_1000_loop245_184_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop275_291[15:0] = (loops_1000_loop269_271_reg ^ loops_1000_loop275_287);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_67_S_0)) begin
+		loops_1000_loop275_291_reg[15:0] <= loops_1000_loop275_291[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop275_292[15:0] = loops_1000_loop275_mul_16_16_0[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop275_292_reg[15:0] = loops_1000_loop245_188_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop275_293[7:0] = loops_1000_loop275_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop275_293_reg[7:0] = bp_reg_1[130:123];
+end
+
+always @ (*) begin
+	loops_1000_loop275_294[31:0] = (loops_1000_loop257_230_reg ^ loops_1000_loop245_187_reg);
+end
+
+always @ (*) begin
+	loops_1000_loop275_294_reg[31:0] = bp_reg_1[162:131];
+end
+
+always @ (*) begin
+	loops_1000_loop275_295[63:0] = (loops_1000_loop275_286_reg + loops_1000_loop275_294);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_67_S_0)) begin
+		loops_1000_loop275_295_reg[63:0] <= loops_1000_loop275_295[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop275_296[31:0] = loops_1000_loop275_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop275_296_reg[2:0] = bp_reg_0[5:3];
+end
+
+always @ (*) begin
+	loops_1000_loop275_297 = loops_1000_loop275_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_loop275_297_reg = bp_reg_1[163:163];
+end
+
+always @ (*) begin
+	loops_1000_exit276_298[31:0] = loops_1000_exit276_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit276_298_reg[2:0] = bp_reg_0[2:0];
+end
+
+always @ (*) begin
+	loops_1000_exit276_299 = loops_1000_exit276_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit276_299_reg = bp_reg_0[3:3];
+end
+
+always @ (*) begin
+	loops_1000_exit177_300[31:0] = loops_1000_exit177_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit177_300_reg[2:0] = bp_reg_4[31:29];
+end
+
+always @ (*) begin
+	loops_1000_exit177_301 = loops_1000_exit177_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit177_301_reg = bp_reg_0[0:0];
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_69_S_1) & (loops_1000_exit177_301_reg == 1'd0))) begin
+		loops_1000_loop079_302_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_74_S_1) & (loops_1000_exit183_322_reg == 1'd1))) begin
+		loops_1000_loop079_302_reg[1:0] <= loops_1000_exit183_321_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_69_S_1) & (loops_1000_exit177_301_reg == 1'd0))) begin
+		loops_1000_loop079_303_reg[63:0] <= loops_1000_loop275_295_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_74_S_1) & (loops_1000_exit183_322_reg == 1'd1))) begin
+		loops_1000_loop079_303_reg[63:0] <= loops_1000_loop281_316_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_70_S_0)) begin
+		loops_1000_loop180_304_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_73_S_1) & (loops_1000_exit282_320_reg == 1'd1))) begin
+		loops_1000_loop180_304_reg[1:0] <= loops_1000_exit282_319_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_70_S_0)) begin
+		loops_1000_loop180_305_reg[63:0] <= loops_1000_loop079_303_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_73_S_1) & (loops_1000_exit282_320_reg == 1'd1))) begin
+		loops_1000_loop180_305_reg[63:0] <= loops_1000_loop281_316_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_71_S_0)) begin
+		loops_1000_loop281_306_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_72_S_1) & (loops_1000_loop281_318_reg == 1'd1))) begin
+		loops_1000_loop281_306_reg[1:0] <= loops_1000_loop281_317_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_71_S_0)) begin
+		loops_1000_loop281_307_reg[63:0] <= loops_1000_loop180_305_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_72_S_1) & (loops_1000_loop281_318_reg == 1'd1))) begin
+		loops_1000_loop281_307_reg[63:0] <= loops_1000_loop281_316[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop281_308[7:0] = loops_1000_loop281_mul_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_72_S_0)) begin
+		loops_1000_loop281_308_reg[7:0] <= loops_1000_loop281_308[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop281_309[7:0] = loops_1000_loop281_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop281_309_reg[7:0] = bp_reg_1[16:9];
+end
+
+always @ (*) begin
+	loops_1000_loop281_311[15:0] = (loops_1000_loop263_250_reg ^ loops_1000_loop269_271_reg);
+end
+
+always @ (*) begin
+	loops_1000_loop281_311_reg[15:0] = bp_reg_1[32:17];
+end
+
+always @ (*) begin
+	loops_1000_loop281_312[15:0] = (loops_1000_loop269_268_reg - loops_1000_loop263_250_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_72_S_0)) begin
+		loops_1000_loop281_312_reg[15:0] <= loops_1000_loop281_312[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop281_313[7:0] = loops_1000_loop281_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop281_313_reg[7:0] = loops_1000_exit165_258_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop281_314[7:0] = loops_1000_loop281_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop281_314_reg[7:0] = bp_reg_4[10:3];
+end
+
+always @ (*) begin
+	loops_1000_loop281_315[31:0] = loops_1000_loop281_add_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_72_S_1)) begin
+		loops_1000_loop281_315_reg[31:0] <= loops_1000_loop281_315[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_87_S_1)) begin
+		loops_1000_loop281_315_reg[31:0] <= loops_1000_loop299_377[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_127_S_0)) begin
+		loops_1000_loop281_315_reg[31:0] <= loops_1000_loop2147_539[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_142_S_1)) begin
+		loops_1000_loop281_315_reg[31:0] <= loops_1000_loop2165_604[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_157_S_0)) begin
+		loops_1000_loop281_315_reg[31:0] <= loops_1000_loop2183_669[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_192_S_0)) begin
+		loops_1000_loop281_315_reg[31:0] <= loops_1000_loop2225_819[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop281_316[63:0] = (loops_1000_loop281_307_reg + loops_1000_loop281_315);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_72_S_1)) begin
+		loops_1000_loop281_316_reg[63:0] <= loops_1000_loop281_316[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop281_317[31:0] = loops_1000_loop281_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop281_317_reg[2:0] = bp_reg_0[11:9];
+end
+
+always @ (*) begin
+	loops_1000_loop281_318 = loops_1000_loop281_icmp_8_0;
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_72_S_0)) begin
+		bp_reg_19 <= loops_1000_loop281_318;
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop281_318_reg = bp_reg_19;
+end
+
+always @ (*) begin
+	loops_1000_exit282_319[31:0] = loops_1000_exit282_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit282_319_reg[2:0] = bp_reg_0[8:6];
+end
+
+always @ (*) begin
+	loops_1000_exit282_320 = loops_1000_exit282_icmp_8_0;
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_73_S_0)) begin
+		bp_reg_14[2:2] <= loops_1000_exit282_320;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_157_S_0)) begin
+		bp_reg_14[7:0] <= loops_1000_loop2183_668[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_exit282_320_reg = bp_reg_14[2:2];
+end
+
+always @ (*) begin
+	loops_1000_exit183_321[31:0] = loops_1000_exit183_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit183_321_reg[2:0] = bp_reg_11[4:2];
+end
+
+always @ (*) begin
+	loops_1000_exit183_322 = loops_1000_exit183_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit183_322_reg = bp_reg_0[6:6];
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_74_S_1) & (loops_1000_exit183_322_reg == 1'd0))) begin
+		loops_1000_loop085_323_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_79_S_1) & (loops_1000_exit189_343_reg == 1'd1))) begin
+		loops_1000_loop085_323_reg[1:0] <= loops_1000_exit189_342_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_74_S_1) & (loops_1000_exit183_322_reg == 1'd0))) begin
+		loops_1000_loop085_324_reg[63:0] <= loops_1000_loop281_316_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_79_S_1) & (loops_1000_exit189_343_reg == 1'd1))) begin
+		loops_1000_loop085_324_reg[63:0] <= loops_1000_loop287_337_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_75_S_0)) begin
+		loops_1000_loop186_325_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_78_S_1) & (loops_1000_exit288_341_reg == 1'd1))) begin
+		loops_1000_loop186_325_reg[1:0] <= loops_1000_exit288_340_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_75_S_0)) begin
+		loops_1000_loop186_326_reg[63:0] <= loops_1000_loop085_324_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_78_S_1) & (loops_1000_exit288_341_reg == 1'd1))) begin
+		loops_1000_loop186_326_reg[63:0] <= loops_1000_loop287_337_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_76_S_0)) begin
+		loops_1000_loop287_327_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_77_S_1) & (loops_1000_loop287_339_reg == 1'd1))) begin
+		loops_1000_loop287_327_reg[1:0] <= loops_1000_loop287_338_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_76_S_0)) begin
+		loops_1000_loop287_328_reg[63:0] <= loops_1000_loop186_326_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_77_S_1) & (loops_1000_loop287_339_reg == 1'd1))) begin
+		loops_1000_loop287_328_reg[63:0] <= loops_1000_loop287_337_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop287_329[15:0] = loops_1000_loop287_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop287_329_reg[15:0] = bp_reg_0[45:30];
+end
+
+always @ (*) begin
+	loops_1000_loop287_330[31:0] = loops_1000_loop287_mul_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_77_S_0)) begin
+		loops_1000_loop287_330_reg[31:0] <= loops_1000_loop287_330[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_92_S_0)) begin
+		loops_1000_loop287_330_reg[31:0] <= loops_1000_loop2105_395[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_147_S_0)) begin
+		loops_1000_loop287_330_reg[31:0] <= loops_1000_loop2171_624[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_187_S_2)) begin
+		loops_1000_loop287_330_reg[31:0] <= loops_1000_loop2219_796[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop287_331[7:0] = (loops_1000_loop275_289_reg - loops_1000_loop281_308_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_77_S_0)) begin
+		loops_1000_loop287_331_reg[7:0] <= loops_1000_loop287_331[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop287_332[31:0] = loops_1000_loop287_add_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_77_S_0)) begin
+		loops_1000_loop287_332_reg[31:0] <= loops_1000_loop287_332[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_127_S_1)) begin
+		loops_1000_loop287_332_reg[31:0] <= loops_1000_loop2147_541[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_142_S_2)) begin
+		loops_1000_loop287_332_reg[31:0] <= loops_1000_loop2165_608[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop287_333[31:0] = loops_1000_loop287_add_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_77_S_1)) begin
+		loops_1000_loop287_333_reg[31:0] <= loops_1000_loop287_333[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop287_334[31:0] = loops_1000_loop287_mul_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_77_S_1)) begin
+		loops_1000_loop287_334_reg[31:0] <= loops_1000_loop287_334[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_92_S_1)) begin
+		loops_1000_loop287_334_reg[31:0] <= loops_1000_loop2105_398[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop287_335[7:0] = loops_1000_loop287_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop287_335_reg[7:0] = bp_reg_1[221:214];
+end
+
+always @ (*) begin
+	loops_1000_loop287_336[7:0] = loops_1000_loop287_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop287_336_reg[7:0] = bp_reg_1[229:222];
+end
+
+always @ (*) begin
+	loops_1000_loop287_337[63:0] = (loops_1000_loop287_328_reg + loops_1000_loop287_336);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_77_S_0)) begin
+		loops_1000_loop287_337_reg[63:0] <= loops_1000_loop287_337[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop287_338[31:0] = loops_1000_loop287_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop287_338_reg[2:0] = bp_reg_0[5:3];
+end
+
+always @ (*) begin
+	loops_1000_loop287_339 = loops_1000_loop287_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_loop287_339_reg = bp_reg_10[0:0];
+end
+
+always @ (*) begin
+	loops_1000_exit288_340[31:0] = loops_1000_exit288_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit288_340_reg[2:0] = bp_reg_0[2:0];
+end
+
+always @ (*) begin
+	loops_1000_exit288_341 = loops_1000_exit288_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit288_341_reg = bp_reg_4[39:39];
+end
+
+always @ (*) begin
+	loops_1000_exit189_342[31:0] = loops_1000_exit189_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit189_342_reg[2:0] = bp_reg_9[3:1];
+end
+
+always @ (*) begin
+	loops_1000_exit189_343 = loops_1000_exit189_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit189_343_reg = bp_reg_0[0:0];
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_79_S_1) & (loops_1000_exit189_343_reg == 1'd0))) begin
+		loops_1000_loop091_344_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_84_S_1) & (loops_1000_exit195_364_reg == 1'd1))) begin
+		loops_1000_loop091_344_reg[1:0] <= loops_1000_exit195_363_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_79_S_1) & (loops_1000_exit189_343_reg == 1'd0))) begin
+		loops_1000_loop091_345_reg[63:0] <= loops_1000_loop287_337_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_84_S_1) & (loops_1000_exit195_364_reg == 1'd1))) begin
+		loops_1000_loop091_345_reg[63:0] <= loops_1000_loop293_358_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_80_S_0)) begin
+		loops_1000_loop192_346_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_83_S_1) & (loops_1000_exit294_362_reg == 1'd1))) begin
+		loops_1000_loop192_346_reg[1:0] <= loops_1000_exit294_361_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_80_S_0)) begin
+		loops_1000_loop192_347_reg[63:0] <= loops_1000_loop091_345_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_83_S_1) & (loops_1000_exit294_362_reg == 1'd1))) begin
+		loops_1000_loop192_347_reg[63:0] <= loops_1000_loop293_358_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_81_S_0)) begin
+		loops_1000_loop293_348_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_82_S_3) & (loops_1000_loop293_360_reg == 1'd1))) begin
+		loops_1000_loop293_348_reg[1:0] <= loops_1000_loop293_359_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_81_S_0)) begin
+		loops_1000_loop293_349_reg[63:0] <= loops_1000_loop192_347_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_82_S_3) & (loops_1000_loop293_360_reg == 1'd1))) begin
+		loops_1000_loop293_349_reg[63:0] <= loops_1000_loop293_358[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop293_350[15:0] = loops_1000_loop293_mul_16_16_0[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop293_350_reg[15:0] = loops_1000_loop251_208_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop293_351[7:0] = loops_1000_loop293_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop293_351_reg[7:0] = bp_reg_1[27:20];
+end
+
+always @ (*) begin
+	loops_1000_loop293_352[63:0] = (loops_1000_loop293_349_reg * loops_1000_loop281_307_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_82_S_0)) begin
+		loops_1000_loop293_352_reg[63:0] <= loops_1000_loop293_352[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop293_353[31:0] = (loops_1000_loop269_273_reg ^ loops_1000_loop287_330_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_82_S_0)) begin
+		loops_1000_loop293_353_reg[31:0] <= loops_1000_loop293_353[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop293_354[7:0] = loops_1000_loop293_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop293_354_reg[7:0] = loops_1000_loop221_102_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop293_355[31:0] = loops_1000_loop293_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop293_355_reg[31:0] = bp_reg_6[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop293_356[63:0] = (loops_1000_loop269_265_reg | loops_1000_loop293_352_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_82_S_1)) begin
+		loops_1000_loop293_356_reg[63:0] <= loops_1000_loop293_356[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop293_357[63:0] = (loops_1000_loop293_356_reg * loops_1000_loop275_291_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_82_S_2)) begin
+		loops_1000_loop293_357_reg[63:0] <= loops_1000_loop293_357[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop293_358[63:0] = (loops_1000_loop293_349_reg + loops_1000_loop293_357_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_82_S_3)) begin
+		loops_1000_loop293_358_reg[63:0] <= loops_1000_loop293_358[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop293_359[31:0] = loops_1000_loop293_add_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_82_S_0)) begin
+		loops_1000_loop293_359_reg[7:0] <= loops_1000_loop293_359[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_92_S_0)) begin
+		loops_1000_loop293_359_reg[7:0] <= loops_1000_loop2105_401[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_137_S_1)) begin
+		loops_1000_loop293_359_reg[7:0] <= loops_1000_loop2159_588[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop293_360 = loops_1000_loop293_icmp_8_0;
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_82_S_0)) begin
+		bp_reg_20 <= loops_1000_loop293_360;
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop293_360_reg = bp_reg_20;
+end
+
+always @ (*) begin
+	loops_1000_exit294_361[31:0] = loops_1000_exit294_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit294_361_reg[2:0] = bp_reg_0[8:6];
+end
+
+always @ (*) begin
+	loops_1000_exit294_362 = loops_1000_exit294_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit294_362_reg = bp_reg_0[28:28];
+end
+
+always @ (*) begin
+	loops_1000_exit195_363[31:0] = loops_1000_exit195_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit195_363_reg[2:0] = bp_reg_2[19:17];
+end
+
+always @ (*) begin
+	loops_1000_exit195_364 = loops_1000_exit195_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit195_364_reg = bp_reg_0[6:6];
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_84_S_1) & (loops_1000_exit195_364_reg == 1'd0))) begin
+		loops_1000_loop097_365_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_89_S_1) & (loops_1000_exit1101_385_reg == 1'd1))) begin
+		loops_1000_loop097_365_reg[1:0] <= loops_1000_exit1101_384_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_84_S_1) & (loops_1000_exit195_364_reg == 1'd0))) begin
+		loops_1000_loop097_366_reg[63:0] <= loops_1000_loop293_358_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_89_S_1) & (loops_1000_exit1101_385_reg == 1'd1))) begin
+		loops_1000_loop097_366_reg[63:0] <= loops_1000_loop299_379_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_85_S_0)) begin
+		loops_1000_loop198_367_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_88_S_1) & (loops_1000_exit2100_383_reg == 1'd1))) begin
+		loops_1000_loop198_367_reg[1:0] <= loops_1000_exit2100_382_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_85_S_0)) begin
+		loops_1000_loop198_368_reg[63:0] <= loops_1000_loop097_366_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_88_S_1) & (loops_1000_exit2100_383_reg == 1'd1))) begin
+		loops_1000_loop198_368_reg[63:0] <= loops_1000_loop299_379_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_86_S_0)) begin
+		loops_1000_loop299_369_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_87_S_1) & (loops_1000_loop299_381_reg == 1'd1))) begin
+		loops_1000_loop299_369_reg[1:0] <= loops_1000_loop299_380_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_86_S_0)) begin
+		loops_1000_loop299_370_reg[63:0] <= loops_1000_loop198_368_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_87_S_1) & (loops_1000_loop299_381_reg == 1'd1))) begin
+		loops_1000_loop299_370_reg[63:0] <= loops_1000_loop299_379_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop299_372[31:0] = loops_1000_loop299_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop299_372_reg[31:0] = loops_1000_loop269_273_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop299_373[63:0] = (loops_1000_loop299_370_reg + loops_1000_loop293_352_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_87_S_0)) begin
+		loops_1000_loop299_373_reg[63:0] <= loops_1000_loop299_373[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop299_374[15:0] = loops_1000_loop299_add_16_16_1[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop299_374_reg[15:0] = loops_1000_loop251_205_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop299_375[7:0] = loops_1000_loop299_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop299_375_reg[7:0] = bp_reg_9[14:7];
+end
+
+always @ (*) begin
+	loops_1000_loop299_376[63:0] = (loops_1000_loop287_328_reg * loops_1000_loop299_370_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_87_S_0)) begin
+		loops_1000_loop299_376_reg[63:0] <= loops_1000_loop299_376[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop299_377[31:0] = loops_1000_loop299_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop299_377_reg[31:0] = loops_1000_loop281_315_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop299_378[15:0] = loops_1000_loop299_and_16_16_0[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop299_378_reg[15:0] = bp_reg_2[169:154];
+end
+
+always @ (*) begin
+	loops_1000_loop299_379[63:0] = (loops_1000_loop299_370_reg + loops_1000_loop299_378);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_87_S_0)) begin
+		loops_1000_loop299_379_reg[63:0] <= loops_1000_loop299_379[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop299_380[31:0] = loops_1000_loop299_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop299_380_reg[2:0] = bp_reg_0[14:12];
+end
+
+always @ (*) begin
+	loops_1000_loop299_381 = loops_1000_loop299_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_loop299_381_reg = bp_reg_2[170:170];
+end
+
+always @ (*) begin
+	loops_1000_exit2100_382[31:0] = loops_1000_exit2100_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2100_382_reg[2:0] = bp_reg_0[2:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2100_383 = loops_1000_exit2100_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit2100_383_reg = bp_reg_18;
+end
+
+always @ (*) begin
+	loops_1000_exit1101_384[31:0] = loops_1000_exit1101_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1101_384_reg[2:0] = bp_reg_2[123:121];
+end
+
+always @ (*) begin
+	loops_1000_exit1101_385 = loops_1000_exit1101_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit1101_385_reg = bp_reg_0[0:0];
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_89_S_1) & (loops_1000_exit1101_385_reg == 1'd0))) begin
+		loops_1000_loop0103_386_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_94_S_1) & (loops_1000_exit1107_406_reg == 1'd1))) begin
+		loops_1000_loop0103_386_reg[1:0] <= loops_1000_exit1107_405_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_89_S_1) & (loops_1000_exit1101_385_reg == 1'd0))) begin
+		loops_1000_loop0103_387_reg[63:0] <= loops_1000_loop299_379_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_94_S_1) & (loops_1000_exit1107_406_reg == 1'd1))) begin
+		loops_1000_loop0103_387_reg[63:0] <= loops_1000_loop2105_400_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_90_S_0)) begin
+		loops_1000_loop1104_388_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_93_S_1) & (loops_1000_exit2106_404_reg == 1'd1))) begin
+		loops_1000_loop1104_388_reg[1:0] <= loops_1000_exit2106_403_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_90_S_0)) begin
+		loops_1000_loop1104_389_reg[63:0] <= loops_1000_loop0103_387_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_93_S_1) & (loops_1000_exit2106_404_reg == 1'd1))) begin
+		loops_1000_loop1104_389_reg[63:0] <= loops_1000_loop2105_400_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_91_S_0)) begin
+		loops_1000_loop2105_390_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_92_S_1) & (loops_1000_loop2105_402_reg == 1'd1))) begin
+		loops_1000_loop2105_390_reg[1:0] <= loops_1000_loop2105_401_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_91_S_0)) begin
+		loops_1000_loop2105_391_reg[63:0] <= loops_1000_loop1104_389_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_92_S_1) & (loops_1000_loop2105_402_reg == 1'd1))) begin
+		loops_1000_loop2105_391_reg[63:0] <= loops_1000_loop2105_400_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2105_392[7:0] = loops_1000_loop2105_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2105_392_reg[7:0] = bp_reg_0[59:52];
+end
+
+always @ (*) begin
+	loops_1000_loop2105_393[15:0] = loops_1000_loop2105_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2105_393_reg[15:0] = loops_1000_loop215_80_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2105_394[31:0] = (loops_1000_loop299_377_reg ^ loops_1000_loop287_333_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_92_S_0)) begin
+		loops_1000_loop2105_394_reg[31:0] <= loops_1000_loop2105_394[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2105_395[31:0] = loops_1000_loop2105_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2105_395_reg[31:0] = loops_1000_loop287_330_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2105_397[7:0] = loops_1000_loop2105_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2105_397_reg[7:0] = bp_reg_1[85:78];
+end
+
+always @ (*) begin
+	loops_1000_loop2105_398[31:0] = loops_1000_loop2105_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2105_398_reg[31:0] = loops_1000_loop287_334_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2105_399[63:0] = (loops_1000_loop293_349_reg ^ loops_1000_loop2105_391_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_92_S_0)) begin
+		loops_1000_loop2105_399_reg[63:0] <= loops_1000_loop2105_399[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2105_400[63:0] = (loops_1000_loop2105_391_reg + loops_1000_loop2105_399);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_92_S_0)) begin
+		loops_1000_loop2105_400_reg[63:0] <= loops_1000_loop2105_400[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2105_401[31:0] = loops_1000_loop2105_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2105_401_reg[2:0] = loops_1000_loop293_359_reg[2:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2105_402 = loops_1000_loop2105_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_loop2105_402_reg = bp_reg_1[198:198];
+end
+
+always @ (*) begin
+	loops_1000_exit2106_403[31:0] = loops_1000_exit2106_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2106_403_reg[2:0] = bp_reg_0[8:6];
+end
+
+always @ (*) begin
+	loops_1000_exit2106_404 = loops_1000_exit2106_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit2106_404_reg = bp_reg_5[20:20];
+end
+
+always @ (*) begin
+	loops_1000_exit1107_405[31:0] = loops_1000_exit1107_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1107_405_reg[2:0] = bp_reg_3[58:56];
+end
+
+always @ (*) begin
+	loops_1000_exit1107_406 = loops_1000_exit1107_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit1107_406_reg = bp_reg_0[6:6];
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_94_S_1) & (loops_1000_exit1107_406_reg == 1'd0))) begin
+		loops_1000_loop0109_407_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_99_S_1) & (loops_1000_exit1113_427_reg == 1'd1))) begin
+		loops_1000_loop0109_407_reg[1:0] <= loops_1000_exit1113_426_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_94_S_1) & (loops_1000_exit1107_406_reg == 1'd0))) begin
+		loops_1000_loop0109_408_reg[63:0] <= loops_1000_loop2105_400_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_99_S_1) & (loops_1000_exit1113_427_reg == 1'd1))) begin
+		loops_1000_loop0109_408_reg[63:0] <= loops_1000_loop2111_421_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_95_S_0)) begin
+		loops_1000_loop1110_409_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_98_S_1) & (loops_1000_exit2112_425_reg == 1'd1))) begin
+		loops_1000_loop1110_409_reg[1:0] <= loops_1000_exit2112_424_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_95_S_0)) begin
+		loops_1000_loop1110_410_reg[63:0] <= loops_1000_loop0109_408_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_98_S_1) & (loops_1000_exit2112_425_reg == 1'd1))) begin
+		loops_1000_loop1110_410_reg[63:0] <= loops_1000_loop2111_421_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_96_S_0)) begin
+		loops_1000_loop2111_411_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_97_S_1) & (loops_1000_loop2111_423_reg == 1'd1))) begin
+		loops_1000_loop2111_411_reg[1:0] <= loops_1000_loop2111_422_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_96_S_0)) begin
+		loops_1000_loop2111_412_reg[63:0] <= loops_1000_loop1110_410_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_97_S_1) & (loops_1000_loop2111_423_reg == 1'd1))) begin
+		loops_1000_loop2111_412_reg[63:0] <= loops_1000_loop2111_421_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2111_413[63:0] = (loops_1000_loop2111_412_reg - loops_1000_loop299_373_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_97_S_0)) begin
+		loops_1000_loop2111_413_reg[63:0] <= loops_1000_loop2111_413[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2111_414[31:0] = (loops_1000_loop2105_394_reg ^ loops_1000_loop299_377_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_97_S_0)) begin
+		loops_1000_loop2111_414_reg[31:0] <= loops_1000_loop2111_414[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2111_415[31:0] = (loops_1000_loop2105_394_reg - loops_1000_loop293_355_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_97_S_0)) begin
+		loops_1000_loop2111_415_reg[31:0] <= loops_1000_loop2111_415[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2111_416[63:0] = (loops_1000_loop293_357_reg | loops_1000_loop2111_413);
+end
+
+always @ (*) begin
+	loops_1000_loop2111_416_reg[63:0] = bp_reg_3[64:1];
+end
+
+always @ (*) begin
+	loops_1000_loop2111_418[15:0] = (loops_1000_loop299_374_reg - loops_1000_loop299_378_reg);
+end
+
+always @ (*) begin
+	loops_1000_loop2111_418_reg[15:0] = bp_reg_3[80:65];
+end
+
+always @ (*) begin
+	loops_1000_loop2111_419[7:0] = loops_1000_loop2111_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2111_419_reg[7:0] = bp_reg_3[88:81];
+end
+
+always @ (*) begin
+	loops_1000_loop2111_420[31:0] = loops_1000_loop2111_and_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_97_S_0)) begin
+		bp_reg_7[31:0] <= loops_1000_loop2111_420[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2111_420_reg[31:0] = bp_reg_7[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2111_421[63:0] = (loops_1000_loop2111_412_reg + loops_1000_loop2111_420);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_97_S_0)) begin
+		loops_1000_loop2111_421_reg[63:0] <= loops_1000_loop2111_421[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2111_422[31:0] = loops_1000_loop2111_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2111_422_reg[2:0] = bp_reg_0[5:3];
+end
+
+always @ (*) begin
+	loops_1000_loop2111_423 = loops_1000_loop2111_icmp_8_0;
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_97_S_0)) begin
+		bp_reg_21 <= loops_1000_loop2111_423;
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2111_423_reg = bp_reg_21;
+end
+
+always @ (*) begin
+	loops_1000_exit2112_424[31:0] = loops_1000_exit2112_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2112_424_reg[2:0] = bp_reg_0[2:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2112_425 = loops_1000_exit2112_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit2112_425_reg = bp_reg_0[3:3];
+end
+
+always @ (*) begin
+	loops_1000_exit1113_426[31:0] = loops_1000_exit1113_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1113_426_reg[2:0] = bp_reg_2[107:105];
+end
+
+always @ (*) begin
+	loops_1000_exit1113_427 = loops_1000_exit1113_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit1113_427_reg = bp_reg_0[0:0];
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_99_S_1) & (loops_1000_exit1113_427_reg == 1'd0))) begin
+		loops_1000_loop0115_428_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_104_S_1) & (loops_1000_exit1119_448_reg == 1'd1))) begin
+		loops_1000_loop0115_428_reg[1:0] <= loops_1000_exit1119_447_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_99_S_1) & (loops_1000_exit1113_427_reg == 1'd0))) begin
+		loops_1000_loop0115_429_reg[63:0] <= loops_1000_loop2111_421_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_104_S_1) & (loops_1000_exit1119_448_reg == 1'd1))) begin
+		loops_1000_loop0115_429_reg[63:0] <= loops_1000_loop2117_442_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_100_S_0)) begin
+		loops_1000_loop1116_430_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_103_S_1) & (loops_1000_exit2118_446_reg == 1'd1))) begin
+		loops_1000_loop1116_430_reg[1:0] <= loops_1000_exit2118_445_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_100_S_0)) begin
+		loops_1000_loop1116_431_reg[63:0] <= loops_1000_loop0115_429_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_103_S_1) & (loops_1000_exit2118_446_reg == 1'd1))) begin
+		loops_1000_loop1116_431_reg[63:0] <= loops_1000_loop2117_442_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_101_S_0)) begin
+		loops_1000_loop2117_432_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_102_S_1) & (loops_1000_loop2117_444_reg == 1'd1))) begin
+		loops_1000_loop2117_432_reg[1:0] <= loops_1000_loop2117_443_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_101_S_0)) begin
+		loops_1000_loop2117_433_reg[63:0] <= loops_1000_loop1116_431_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_102_S_1) & (loops_1000_loop2117_444_reg == 1'd1))) begin
+		loops_1000_loop2117_433_reg[63:0] <= loops_1000_loop2117_442_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2117_434[63:0] = (loops_1000_loop2105_399_reg + loops_1000_loop287_336_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_102_S_0)) begin
+		loops_1000_loop2117_434_reg[63:0] <= loops_1000_loop2117_434[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2117_435[63:0] = (loops_1000_loop299_376_reg ^ loops_1000_loop299_376_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_102_S_0)) begin
+		loops_1000_loop2117_435_reg[63:0] <= loops_1000_loop2117_435[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2117_438[63:0] = (loops_1000_loop2117_433_reg + loops_1000_loop299_374_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_102_S_0)) begin
+		loops_1000_loop2117_438_reg[63:0] <= loops_1000_loop2117_438[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2117_439[15:0] = loops_1000_loop2117_or_16_16_0[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2117_439_reg[15:0] = bp_reg_2[75:60];
+end
+
+always @ (*) begin
+	loops_1000_loop2117_440[63:0] = (loops_1000_loop2117_438 + loops_1000_loop2117_434);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_102_S_0)) begin
+		loops_1000_loop2117_440_reg[63:0] <= loops_1000_loop2117_440[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2117_441[15:0] = (loops_1000_loop2117_439 ^ loops_1000_loop2117_439);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_102_S_0)) begin
+		bp_reg_8[15:0] <= loops_1000_loop2117_441[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2117_441_reg[15:0] = bp_reg_8[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2117_442[63:0] = (loops_1000_loop2117_433_reg + loops_1000_loop2117_441);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_102_S_0)) begin
+		loops_1000_loop2117_442_reg[63:0] <= loops_1000_loop2117_442[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2117_443[31:0] = loops_1000_loop2117_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2117_443_reg[2:0] = bp_reg_0[14:12];
+end
+
+always @ (*) begin
+	loops_1000_loop2117_444 = loops_1000_loop2117_icmp_8_0;
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_102_S_0)) begin
+		bp_reg_22 <= loops_1000_loop2117_444;
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2117_444_reg = bp_reg_22;
+end
+
+always @ (*) begin
+	loops_1000_exit2118_445[31:0] = loops_1000_exit2118_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2118_445_reg[2:0] = bp_reg_0[8:6];
+end
+
+always @ (*) begin
+	loops_1000_exit2118_446 = loops_1000_exit2118_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit2118_446_reg = bp_reg_0[12:12];
+end
+
+always @ (*) begin
+	loops_1000_exit1119_447[31:0] = loops_1000_exit1119_add_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_104_S_0)) begin
+		bp_reg_16[2:0] <= loops_1000_exit1119_447[2:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_exit1119_447_reg[2:0] = bp_reg_16[2:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1119_448 = loops_1000_exit1119_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit1119_448_reg = bp_reg_0[6:6];
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_104_S_1) & (loops_1000_exit1119_448_reg == 1'd0))) begin
+		loops_1000_loop0121_449_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_109_S_1) & (loops_1000_exit1125_469_reg == 1'd1))) begin
+		loops_1000_loop0121_449_reg[1:0] <= loops_1000_exit1125_468_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_104_S_1) & (loops_1000_exit1119_448_reg == 1'd0))) begin
+		loops_1000_loop0121_450_reg[63:0] <= loops_1000_loop2117_442_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_109_S_1) & (loops_1000_exit1125_469_reg == 1'd1))) begin
+		loops_1000_loop0121_450_reg[63:0] <= loops_1000_loop2123_463_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_105_S_0)) begin
+		loops_1000_loop1122_451_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_108_S_1) & (loops_1000_exit2124_467_reg == 1'd1))) begin
+		loops_1000_loop1122_451_reg[1:0] <= loops_1000_exit2124_466_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_105_S_0)) begin
+		loops_1000_loop1122_452_reg[63:0] <= loops_1000_loop0121_450_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_108_S_1) & (loops_1000_exit2124_467_reg == 1'd1))) begin
+		loops_1000_loop1122_452_reg[63:0] <= loops_1000_loop2123_463_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_106_S_0)) begin
+		loops_1000_loop2123_453_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_107_S_1) & (loops_1000_loop2123_465_reg == 1'd1))) begin
+		loops_1000_loop2123_453_reg[1:0] <= loops_1000_loop2123_464_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_106_S_0)) begin
+		loops_1000_loop2123_454_reg[63:0] <= loops_1000_loop1122_452_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_107_S_1) & (loops_1000_loop2123_465_reg == 1'd1))) begin
+		loops_1000_loop2123_454_reg[63:0] <= loops_1000_loop2123_463_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2123_455[63:0] = (loops_1000_loop2117_435_reg * loops_1000_loop2111_416_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_107_S_0)) begin
+		loops_1000_loop2123_455_reg[63:0] <= loops_1000_loop2123_455[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2123_456[31:0] = loops_1000_loop2123_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2123_456_reg[31:0] = bp_reg_1[125:94];
+end
+
+always @ (*) begin
+	loops_1000_loop2123_458[7:0] = (loops_1000_loop2105_397_reg - loops_1000_loop287_336_reg);
+end
+
+always @ (*) begin
+	loops_1000_loop2123_458_reg[7:0] = bp_reg_1[133:126];
+end
+
+always @ (*) begin
+	loops_1000_loop2123_459[7:0] = loops_1000_loop2123_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2123_459_reg[7:0] = bp_reg_1[141:134];
+end
+
+always @ (*) begin
+	loops_1000_loop2123_460[15:0] = loops_1000_loop2123_or_16_16_0[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2123_460_reg[15:0] = bp_reg_1[157:142];
+end
+
+always @ (*) begin
+	loops_1000_loop2123_462[63:0] = (loops_1000_loop2117_435_reg + loops_1000_loop2117_438_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_107_S_0)) begin
+		loops_1000_loop2123_462_reg[63:0] <= loops_1000_loop2123_462[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2123_463[63:0] = (loops_1000_loop2123_454_reg + loops_1000_loop2123_462);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_107_S_0)) begin
+		loops_1000_loop2123_463_reg[63:0] <= loops_1000_loop2123_463[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2123_464[31:0] = loops_1000_loop2123_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2123_464_reg[2:0] = bp_reg_0[5:3];
+end
+
+always @ (*) begin
+	loops_1000_loop2123_465 = loops_1000_loop2123_icmp_8_0;
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_107_S_0)) begin
+		bp_reg_23 <= loops_1000_loop2123_465;
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2123_465_reg = bp_reg_23;
+end
+
+always @ (*) begin
+	loops_1000_exit2124_466[31:0] = loops_1000_exit2124_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2124_466_reg[2:0] = bp_reg_0[2:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2124_467 = loops_1000_exit2124_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit2124_467_reg = bp_reg_0[3:3];
+end
+
+always @ (*) begin
+	loops_1000_exit1125_468[31:0] = loops_1000_exit1125_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1125_468_reg[2:0] = bp_reg_4[17:15];
+end
+
+always @ (*) begin
+	loops_1000_exit1125_469 = loops_1000_exit1125_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit1125_469_reg = bp_reg_0[0:0];
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_109_S_1) & (loops_1000_exit1125_469_reg == 1'd0))) begin
+		loops_1000_loop0127_470_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_114_S_1) & (loops_1000_exit1131_490_reg == 1'd1))) begin
+		loops_1000_loop0127_470_reg[1:0] <= loops_1000_exit1131_489_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_109_S_1) & (loops_1000_exit1125_469_reg == 1'd0))) begin
+		loops_1000_loop0127_471_reg[63:0] <= loops_1000_loop2123_463_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_114_S_1) & (loops_1000_exit1131_490_reg == 1'd1))) begin
+		loops_1000_loop0127_471_reg[63:0] <= loops_1000_loop2129_484_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_110_S_0)) begin
+		loops_1000_loop1128_472_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_113_S_1) & (loops_1000_exit2130_488_reg == 1'd1))) begin
+		loops_1000_loop1128_472_reg[1:0] <= loops_1000_exit2130_487_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_110_S_0)) begin
+		loops_1000_loop1128_473_reg[63:0] <= loops_1000_loop0127_471_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_113_S_1) & (loops_1000_exit2130_488_reg == 1'd1))) begin
+		loops_1000_loop1128_473_reg[63:0] <= loops_1000_loop2129_484_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_111_S_0)) begin
+		loops_1000_loop2129_474_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_112_S_1) & (loops_1000_loop2129_486_reg == 1'd1))) begin
+		loops_1000_loop2129_474_reg[1:0] <= loops_1000_loop2129_485_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_111_S_0)) begin
+		loops_1000_loop2129_475_reg[63:0] <= loops_1000_loop1128_473_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_112_S_1) & (loops_1000_loop2129_486_reg == 1'd1))) begin
+		loops_1000_loop2129_475_reg[63:0] <= loops_1000_loop2129_484_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2129_477[63:0] = (loops_1000_loop2117_440_reg + loops_1000_loop2123_455_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_112_S_0)) begin
+		loops_1000_loop2129_477_reg[63:0] <= loops_1000_loop2129_477[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2129_479[31:0] = loops_1000_loop2129_or_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2129_479_reg[31:0] = loops_1000_loop257_226_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2129_480[7:0] = loops_1000_loop2129_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2129_480_reg[7:0] = bp_reg_1[218:211];
+end
+
+always @ (*) begin
+	loops_1000_loop2129_481[15:0] = (loops_1000_loop299_378_reg ^ loops_1000_loop299_374_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_112_S_0)) begin
+		loops_1000_loop2129_481_reg[15:0] <= loops_1000_loop2129_481[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2129_482[31:0] = (loops_1000_loop2111_414_reg - loops_1000_loop2111_415_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_112_S_0)) begin
+		loops_1000_loop2129_482_reg[31:0] <= loops_1000_loop2129_482[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2129_483[15:0] = (loops_1000_loop299_378_reg - loops_1000_loop2105_393_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_112_S_0)) begin
+		loops_1000_loop2129_483_reg[15:0] <= loops_1000_loop2129_483[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2129_484[63:0] = (loops_1000_loop2129_475_reg + loops_1000_loop2129_483);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_112_S_0)) begin
+		loops_1000_loop2129_484_reg[63:0] <= loops_1000_loop2129_484[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2129_485[31:0] = loops_1000_loop2129_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2129_485_reg[2:0] = bp_reg_0[14:12];
+end
+
+always @ (*) begin
+	loops_1000_loop2129_486 = loops_1000_loop2129_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_loop2129_486_reg = bp_reg_4[13:13];
+end
+
+always @ (*) begin
+	loops_1000_exit2130_487[31:0] = loops_1000_exit2130_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2130_487_reg[2:0] = bp_reg_0[8:6];
+end
+
+always @ (*) begin
+	loops_1000_exit2130_488 = loops_1000_exit2130_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit2130_488_reg = bp_reg_0[12:12];
+end
+
+always @ (*) begin
+	loops_1000_exit1131_489[31:0] = loops_1000_exit1131_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1131_489_reg[2:0] = bp_reg_2[141:139];
+end
+
+always @ (*) begin
+	loops_1000_exit1131_490 = loops_1000_exit1131_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit1131_490_reg = bp_reg_0[6:6];
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_114_S_1) & (loops_1000_exit1131_490_reg == 1'd0))) begin
+		loops_1000_loop0133_491_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_119_S_1) & (loops_1000_exit1137_511_reg == 1'd1))) begin
+		loops_1000_loop0133_491_reg[1:0] <= loops_1000_exit1137_510_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_114_S_1) & (loops_1000_exit1131_490_reg == 1'd0))) begin
+		loops_1000_loop0133_492_reg[63:0] <= loops_1000_loop2129_484_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_119_S_1) & (loops_1000_exit1137_511_reg == 1'd1))) begin
+		loops_1000_loop0133_492_reg[63:0] <= loops_1000_loop2135_505_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_115_S_0)) begin
+		loops_1000_loop1134_493_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_118_S_1) & (loops_1000_exit2136_509_reg == 1'd1))) begin
+		loops_1000_loop1134_493_reg[1:0] <= loops_1000_exit2136_508_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_115_S_0)) begin
+		loops_1000_loop1134_494_reg[63:0] <= loops_1000_loop0133_492_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_118_S_1) & (loops_1000_exit2136_509_reg == 1'd1))) begin
+		loops_1000_loop1134_494_reg[63:0] <= loops_1000_loop2135_505_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_116_S_0)) begin
+		loops_1000_loop2135_495_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_117_S_1) & (loops_1000_loop2135_507_reg == 1'd1))) begin
+		loops_1000_loop2135_495_reg[1:0] <= loops_1000_loop2135_506_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_116_S_0)) begin
+		loops_1000_loop2135_496_reg[63:0] <= loops_1000_loop1134_494_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_117_S_1) & (loops_1000_loop2135_507_reg == 1'd1))) begin
+		loops_1000_loop2135_496_reg[63:0] <= loops_1000_loop2135_505_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2135_497[7:0] = loops_1000_loop2135_or_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_117_S_0)) begin
+		loops_1000_loop2135_497_reg[7:0] <= loops_1000_loop2135_497[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2135_498[15:0] = (loops_1000_loop2123_460_reg - loops_1000_loop2129_481_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_117_S_0)) begin
+		loops_1000_loop2135_498_reg[15:0] <= loops_1000_loop2135_498[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2135_499[15:0] = loops_1000_loop2135_add_16_16_1[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2135_499_reg[15:0] = loops_1000_loop245_184_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2135_501[7:0] = loops_1000_loop2135_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2135_501_reg[7:0] = bp_reg_0[70:63];
+end
+
+always @ (*) begin
+	loops_1000_loop2135_502[63:0] = (loops_1000_loop2129_475_reg - loops_1000_loop2123_462_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_117_S_0)) begin
+		loops_1000_loop2135_502_reg[63:0] <= loops_1000_loop2135_502[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2135_503[31:0] = (loops_1000_loop2129_482_reg - loops_1000_loop2129_482_reg);
+end
+
+always @ (*) begin
+	loops_1000_loop2135_503_reg = bp_reg_5[2:2];
+end
+
+always @ (*) begin
+	loops_1000_loop2135_504[15:0] = loops_1000_loop2135_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2135_504_reg[15:0] = loops_1000_loop215_80_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2135_505[63:0] = (loops_1000_loop2135_496_reg + loops_1000_loop2135_504);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_117_S_0)) begin
+		loops_1000_loop2135_505_reg[63:0] <= loops_1000_loop2135_505[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2135_506[31:0] = loops_1000_loop2135_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2135_506_reg[2:0] = bp_reg_0[5:3];
+end
+
+always @ (*) begin
+	loops_1000_loop2135_507 = loops_1000_loop2135_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_loop2135_507_reg = bp_reg_4[10:10];
+end
+
+always @ (*) begin
+	loops_1000_exit2136_508[31:0] = loops_1000_exit2136_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2136_508_reg[2:0] = bp_reg_0[2:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2136_509 = loops_1000_exit2136_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit2136_509_reg = bp_reg_0[3:3];
+end
+
+always @ (*) begin
+	loops_1000_exit1137_510[31:0] = loops_1000_exit1137_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1137_510_reg[2:0] = bp_reg_6[23:21];
+end
+
+always @ (*) begin
+	loops_1000_exit1137_511 = loops_1000_exit1137_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit1137_511_reg = bp_reg_0[0:0];
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_119_S_1) & (loops_1000_exit1137_511_reg == 1'd0))) begin
+		loops_1000_loop0139_512_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_124_S_1) & (loops_1000_exit1143_532_reg == 1'd1))) begin
+		loops_1000_loop0139_512_reg[1:0] <= loops_1000_exit1143_531_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_119_S_1) & (loops_1000_exit1137_511_reg == 1'd0))) begin
+		loops_1000_loop0139_513_reg[63:0] <= loops_1000_loop2135_505_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_124_S_1) & (loops_1000_exit1143_532_reg == 1'd1))) begin
+		loops_1000_loop0139_513_reg[63:0] <= loops_1000_loop2141_526_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_120_S_0)) begin
+		loops_1000_loop1140_514_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_123_S_1) & (loops_1000_exit2142_530_reg == 1'd1))) begin
+		loops_1000_loop1140_514_reg[1:0] <= loops_1000_exit2142_529_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_120_S_0)) begin
+		loops_1000_loop1140_515_reg[63:0] <= loops_1000_loop0139_513_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_123_S_1) & (loops_1000_exit2142_530_reg == 1'd1))) begin
+		loops_1000_loop1140_515_reg[63:0] <= loops_1000_loop2141_526_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_121_S_0)) begin
+		loops_1000_loop2141_516_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_122_S_2) & (loops_1000_loop2141_528_reg == 1'd1))) begin
+		loops_1000_loop2141_516_reg[1:0] <= loops_1000_loop2141_527_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_121_S_0)) begin
+		loops_1000_loop2141_517_reg[63:0] <= loops_1000_loop1140_515_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_122_S_2) & (loops_1000_loop2141_528_reg == 1'd1))) begin
+		loops_1000_loop2141_517_reg[63:0] <= loops_1000_loop2141_526_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2141_518[31:0] = loops_1000_loop2141_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2141_518_reg[31:0] = bp_reg_1[173:142];
+end
+
+always @ (*) begin
+	loops_1000_loop2141_519[7:0] = loops_1000_loop2141_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2141_519_reg[7:0] = bp_reg_1[181:174];
+end
+
+always @ (*) begin
+	loops_1000_loop2141_520[7:0] = loops_1000_loop2141_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2141_520_reg[7:0] = bp_reg_1[189:182];
+end
+
+always @ (*) begin
+	loops_1000_loop2141_521[31:0] = loops_1000_loop2141_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2141_521_reg[31:0] = loops_1000_loop269_273_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2141_523[7:0] = loops_1000_loop2141_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2141_523_reg[7:0] = bp_reg_4[39:32];
+end
+
+always @ (*) begin
+	loops_1000_loop2141_524[15:0] = loops_1000_loop2141_or_16_16_0[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2141_524_reg[15:0] = bp_reg_4[55:40];
+end
+
+always @ (*) begin
+	loops_1000_loop2141_525[15:0] = loops_1000_loop2141_add_16_16_1[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2141_525_reg[15:0] = bp_reg_6[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2141_526[63:0] = (loops_1000_loop2141_517_reg + loops_1000_loop2141_525);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_122_S_0)) begin
+		loops_1000_loop2141_526_reg[63:0] <= loops_1000_loop2141_526[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2141_527[31:0] = loops_1000_loop2141_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2141_527_reg[2:0] = bp_reg_0[14:12];
+end
+
+always @ (*) begin
+	loops_1000_loop2141_528 = loops_1000_loop2141_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_loop2141_528_reg = bp_reg_6[16:16];
+end
+
+always @ (*) begin
+	loops_1000_exit2142_529[31:0] = loops_1000_exit2142_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2142_529_reg[2:0] = bp_reg_0[8:6];
+end
+
+always @ (*) begin
+	loops_1000_exit2142_530 = loops_1000_exit2142_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit2142_530_reg = bp_reg_0[12:12];
+end
+
+always @ (*) begin
+	loops_1000_exit1143_531[31:0] = loops_1000_exit1143_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1143_531_reg[2:0] = bp_reg_13[2:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1143_532 = loops_1000_exit1143_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit1143_532_reg = bp_reg_0[6:6];
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_124_S_1) & (loops_1000_exit1143_532_reg == 1'd0))) begin
+		loops_1000_loop0145_533_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_129_S_1) & (loops_1000_exit1149_553_reg == 1'd1))) begin
+		loops_1000_loop0145_533_reg[1:0] <= loops_1000_exit1149_552_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_124_S_1) & (loops_1000_exit1143_532_reg == 1'd0))) begin
+		loops_1000_loop0145_534_reg[63:0] <= loops_1000_loop2141_526_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_129_S_1) & (loops_1000_exit1149_553_reg == 1'd1))) begin
+		loops_1000_loop0145_534_reg[63:0] <= loops_1000_loop2147_547_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_125_S_0)) begin
+		loops_1000_loop1146_535_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_128_S_1) & (loops_1000_exit2148_551_reg == 1'd1))) begin
+		loops_1000_loop1146_535_reg[1:0] <= loops_1000_exit2148_550_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_125_S_0)) begin
+		loops_1000_loop1146_536_reg[63:0] <= loops_1000_loop0145_534_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_128_S_1) & (loops_1000_exit2148_551_reg == 1'd1))) begin
+		loops_1000_loop1146_536_reg[63:0] <= loops_1000_loop2147_547_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_126_S_0)) begin
+		loops_1000_loop2147_537_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_127_S_1) & (loops_1000_loop2147_549_reg == 1'd1))) begin
+		loops_1000_loop2147_537_reg[1:0] <= loops_1000_loop2147_548_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_126_S_0)) begin
+		loops_1000_loop2147_538_reg[63:0] <= loops_1000_loop1146_536_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_127_S_1) & (loops_1000_loop2147_549_reg == 1'd1))) begin
+		loops_1000_loop2147_538_reg[63:0] <= loops_1000_loop2147_547[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2147_539[31:0] = loops_1000_loop2147_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2147_539_reg[31:0] = loops_1000_loop281_315_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2147_540[31:0] = loops_1000_loop2147_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2147_540_reg[31:0] = loops_1000_loop29_58_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2147_541[31:0] = loops_1000_loop2147_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2147_541_reg[31:0] = loops_1000_loop287_332_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2147_543[7:0] = loops_1000_loop2147_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2147_543_reg[7:0] = bp_reg_1[245:238];
+end
+
+always @ (*) begin
+	loops_1000_loop2147_544[15:0] = loops_1000_loop2147_add_16_16_1[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2147_544_reg[15:0] = loops_1000_loop251_205_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2147_545[31:0] = loops_1000_loop2147_or_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2147_545_reg[31:0] = loops_1000_loop269_272_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2147_546[31:0] = loops_1000_loop2147_or_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2147_546_reg[31:0] = bp_reg_2[54:23];
+end
+
+always @ (*) begin
+	loops_1000_loop2147_547[63:0] = (loops_1000_loop2147_538_reg + loops_1000_loop2147_546);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_127_S_1)) begin
+		loops_1000_loop2147_547_reg[63:0] <= loops_1000_loop2147_547[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2147_548[31:0] = loops_1000_loop2147_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2147_548_reg[2:0] = bp_reg_0[5:3];
+end
+
+always @ (*) begin
+	loops_1000_loop2147_549 = loops_1000_loop2147_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_loop2147_549_reg = bp_reg_11[6:6];
+end
+
+always @ (*) begin
+	loops_1000_exit2148_550[31:0] = loops_1000_exit2148_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2148_550_reg[2:0] = bp_reg_0[2:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2148_551 = loops_1000_exit2148_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit2148_551_reg = bp_reg_2[55:55];
+end
+
+always @ (*) begin
+	loops_1000_exit1149_552[31:0] = loops_1000_exit1149_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1149_552_reg[2:0] = bp_reg_2[12:10];
+end
+
+always @ (*) begin
+	loops_1000_exit1149_553 = loops_1000_exit1149_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit1149_553_reg = bp_reg_0[0:0];
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_129_S_1) & (loops_1000_exit1149_553_reg == 1'd0))) begin
+		loops_1000_loop0151_554_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_134_S_1) & (loops_1000_exit1155_574_reg == 1'd1))) begin
+		loops_1000_loop0151_554_reg[1:0] <= loops_1000_exit1155_573_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_129_S_1) & (loops_1000_exit1149_553_reg == 1'd0))) begin
+		loops_1000_loop0151_555_reg[63:0] <= loops_1000_loop2147_547_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_134_S_1) & (loops_1000_exit1155_574_reg == 1'd1))) begin
+		loops_1000_loop0151_555_reg[63:0] <= loops_1000_loop2153_568_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_130_S_0)) begin
+		loops_1000_loop1152_556_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_133_S_1) & (loops_1000_exit2154_572_reg == 1'd1))) begin
+		loops_1000_loop1152_556_reg[1:0] <= loops_1000_exit2154_571_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_130_S_0)) begin
+		loops_1000_loop1152_557_reg[63:0] <= loops_1000_loop0151_555_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_133_S_1) & (loops_1000_exit2154_572_reg == 1'd1))) begin
+		loops_1000_loop1152_557_reg[63:0] <= loops_1000_loop2153_568_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_131_S_0)) begin
+		loops_1000_loop2153_558_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_132_S_1) & (loops_1000_loop2153_570_reg == 1'd1))) begin
+		loops_1000_loop2153_558_reg[1:0] <= loops_1000_loop2153_569_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_131_S_0)) begin
+		loops_1000_loop2153_559_reg[63:0] <= loops_1000_loop1152_557_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_132_S_1) & (loops_1000_loop2153_570_reg == 1'd1))) begin
+		loops_1000_loop2153_559_reg[63:0] <= loops_1000_loop2153_568[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2153_561[63:0] = (loops_1000_loop2129_477_reg & loops_1000_loop2135_496_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_132_S_0)) begin
+		loops_1000_loop2153_561_reg[63:0] <= loops_1000_loop2153_561[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2153_562[15:0] = (loops_1000_loop2129_483_reg - loops_1000_loop2141_525_reg);
+end
+
+always @ (*) begin
+	loops_1000_loop2153_562_reg[15:0] = bp_reg_1[170:155];
+end
+
+always @ (*) begin
+	loops_1000_loop2153_563[7:0] = (loops_1000_loop2147_543_reg - loops_1000_loop2141_523_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_132_S_0)) begin
+		loops_1000_loop2153_563_reg[7:0] <= loops_1000_loop2153_563[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2153_564[15:0] = loops_1000_loop2153_add_16_16_1[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_132_S_0)) begin
+		loops_1000_loop2153_564_reg[15:0] <= loops_1000_loop2153_564[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2153_565[7:0] = loops_1000_loop2153_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2153_565_reg[7:0] = bp_reg_13[10:3];
+end
+
+always @ (*) begin
+	loops_1000_loop2153_566[7:0] = loops_1000_loop2153_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2153_566_reg[7:0] = bp_reg_9[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2153_567[63:0] = (loops_1000_loop2141_517_reg * loops_1000_loop2135_502_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_132_S_0)) begin
+		loops_1000_loop2153_567_reg[63:0] <= loops_1000_loop2153_567[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2153_568[63:0] = (loops_1000_loop2153_559_reg + loops_1000_loop2153_567_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_132_S_1)) begin
+		loops_1000_loop2153_568_reg[63:0] <= loops_1000_loop2153_568[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2153_569[31:0] = loops_1000_loop2153_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2153_569_reg[2:0] = bp_reg_0[14:12];
+end
+
+always @ (*) begin
+	loops_1000_loop2153_570 = loops_1000_loop2153_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_loop2153_570_reg = bp_reg_2[146:146];
+end
+
+always @ (*) begin
+	loops_1000_exit2154_571[31:0] = loops_1000_exit2154_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2154_571_reg[2:0] = bp_reg_0[8:6];
+end
+
+always @ (*) begin
+	loops_1000_exit2154_572 = loops_1000_exit2154_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit2154_572_reg = bp_reg_0[12:12];
+end
+
+always @ (*) begin
+	loops_1000_exit1155_573[31:0] = loops_1000_exit1155_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1155_573_reg[2:0] = bp_reg_2[115:113];
+end
+
+always @ (*) begin
+	loops_1000_exit1155_574 = loops_1000_exit1155_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit1155_574_reg = bp_reg_0[6:6];
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_134_S_1) & (loops_1000_exit1155_574_reg == 1'd0))) begin
+		loops_1000_loop0157_575_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_139_S_1) & (loops_1000_exit1161_595_reg == 1'd1))) begin
+		loops_1000_loop0157_575_reg[1:0] <= loops_1000_exit1161_594_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_134_S_1) & (loops_1000_exit1155_574_reg == 1'd0))) begin
+		loops_1000_loop0157_576_reg[63:0] <= loops_1000_loop2153_568_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_139_S_1) & (loops_1000_exit1161_595_reg == 1'd1))) begin
+		loops_1000_loop0157_576_reg[63:0] <= loops_1000_loop2159_589_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_135_S_0)) begin
+		loops_1000_loop1158_577_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_138_S_1) & (loops_1000_exit2160_593_reg == 1'd1))) begin
+		loops_1000_loop1158_577_reg[1:0] <= loops_1000_exit2160_592_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_135_S_0)) begin
+		loops_1000_loop1158_578_reg[63:0] <= loops_1000_loop0157_576_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_138_S_1) & (loops_1000_exit2160_593_reg == 1'd1))) begin
+		loops_1000_loop1158_578_reg[63:0] <= loops_1000_loop2159_589_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_136_S_0)) begin
+		loops_1000_loop2159_579_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_137_S_1) & (loops_1000_loop2159_591_reg == 1'd1))) begin
+		loops_1000_loop2159_579_reg[1:0] <= loops_1000_loop2159_590_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_136_S_0)) begin
+		loops_1000_loop2159_580_reg[63:0] <= loops_1000_loop1158_578_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_137_S_1) & (loops_1000_loop2159_591_reg == 1'd1))) begin
+		loops_1000_loop2159_580_reg[63:0] <= loops_1000_loop2159_589[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2159_581[7:0] = (loops_1000_loop2141_520_reg - loops_1000_loop2141_519_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_137_S_0)) begin
+		loops_1000_loop2159_581_reg[7:0] <= loops_1000_loop2159_581[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2159_582[31:0] = loops_1000_loop2159_or_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2159_582_reg[31:0] = loops_1000_loop257_226_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2159_583[31:0] = loops_1000_loop2159_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2159_583_reg[31:0] = bp_reg_1[37:6];
+end
+
+always @ (*) begin
+	loops_1000_loop2159_584[7:0] = loops_1000_loop2159_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2159_584_reg[7:0] = bp_reg_1[45:38];
+end
+
+always @ (*) begin
+	loops_1000_loop2159_585[7:0] = loops_1000_loop2159_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2159_585_reg[7:0] = loops_1000_exit165_258_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2159_587[7:0] = (loops_1000_loop2141_523_reg ^ loops_1000_loop2153_566_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_137_S_0)) begin
+		loops_1000_loop2159_587_reg[7:0] <= loops_1000_loop2159_587[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2159_588[7:0] = loops_1000_loop2159_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2159_588_reg[7:0] = loops_1000_loop293_359_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2159_589[63:0] = (loops_1000_loop2159_580_reg + loops_1000_loop2159_588);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_137_S_1)) begin
+		loops_1000_loop2159_589_reg[63:0] <= loops_1000_loop2159_589[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2159_590[31:0] = loops_1000_loop2159_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2159_590_reg[2:0] = bp_reg_0[11:9];
+end
+
+always @ (*) begin
+	loops_1000_loop2159_591 = loops_1000_loop2159_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_loop2159_591_reg = bp_reg_1[81:81];
+end
+
+always @ (*) begin
+	loops_1000_exit2160_592[31:0] = loops_1000_exit2160_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2160_592_reg[2:0] = bp_reg_0[2:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2160_593 = loops_1000_exit2160_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit2160_593_reg = bp_reg_1[86:86];
+end
+
+always @ (*) begin
+	loops_1000_exit1161_594[31:0] = loops_1000_exit1161_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1161_594_reg[2:0] = bp_reg_2[139:137];
+end
+
+always @ (*) begin
+	loops_1000_exit1161_595 = loops_1000_exit1161_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit1161_595_reg = bp_reg_0[0:0];
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_139_S_1) & (loops_1000_exit1161_595_reg == 1'd0))) begin
+		loops_1000_loop0163_596_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_144_S_1) & (loops_1000_exit1167_616_reg == 1'd1))) begin
+		loops_1000_loop0163_596_reg[1:0] <= loops_1000_exit1167_615_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_139_S_1) & (loops_1000_exit1161_595_reg == 1'd0))) begin
+		loops_1000_loop0163_597_reg[63:0] <= loops_1000_loop2159_589_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_144_S_1) & (loops_1000_exit1167_616_reg == 1'd1))) begin
+		loops_1000_loop0163_597_reg[63:0] <= loops_1000_loop2165_610_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_140_S_0)) begin
+		loops_1000_loop1164_598_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_143_S_1) & (loops_1000_exit2166_614_reg == 1'd1))) begin
+		loops_1000_loop1164_598_reg[1:0] <= loops_1000_exit2166_613_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_140_S_0)) begin
+		loops_1000_loop1164_599_reg[63:0] <= loops_1000_loop0163_597_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_143_S_1) & (loops_1000_exit2166_614_reg == 1'd1))) begin
+		loops_1000_loop1164_599_reg[63:0] <= loops_1000_loop2165_610_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_141_S_0)) begin
+		loops_1000_loop2165_600_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_142_S_2) & (loops_1000_loop2165_612_reg == 1'd1))) begin
+		loops_1000_loop2165_600_reg[1:0] <= loops_1000_loop2165_611_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_141_S_0)) begin
+		loops_1000_loop2165_601_reg[63:0] <= loops_1000_loop1164_599_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_142_S_2) & (loops_1000_loop2165_612_reg == 1'd1))) begin
+		loops_1000_loop2165_601_reg[63:0] <= loops_1000_loop2165_610_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2165_602[31:0] = loops_1000_loop2165_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2165_602_reg[31:0] = loops_1000_loop269_273_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2165_603[7:0] = loops_1000_loop2165_add_8_8_1[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_142_S_0)) begin
+		loops_1000_loop2165_603_reg[7:0] <= loops_1000_loop2165_603[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2165_604[31:0] = loops_1000_loop2165_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2165_604_reg[31:0] = loops_1000_loop281_315_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2165_605[15:0] = loops_1000_loop2165_add_16_16_1[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2165_605_reg[15:0] = bp_reg_1[191:176];
+end
+
+always @ (*) begin
+	loops_1000_loop2165_607[63:0] = (loops_1000_loop2165_601_reg + loops_1000_loop2165_601_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_142_S_0)) begin
+		loops_1000_loop2165_607_reg[63:0] <= loops_1000_loop2165_607[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2165_608[31:0] = loops_1000_loop2165_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2165_608_reg[31:0] = loops_1000_loop287_332_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2165_609[63:0] = (loops_1000_loop2153_559_reg - loops_1000_loop2153_559_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_142_S_0)) begin
+		bp_reg_24 <= loops_1000_loop2165_609;
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2165_609_reg = bp_reg_24;
+end
+
+always @ (*) begin
+	loops_1000_loop2165_610[63:0] = (loops_1000_loop2165_601_reg + loops_1000_loop2165_609);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_142_S_0)) begin
+		loops_1000_loop2165_610_reg[63:0] <= loops_1000_loop2165_610[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2165_611[31:0] = loops_1000_loop2165_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2165_611_reg[2:0] = bp_reg_0[8:6];
+end
+
+always @ (*) begin
+	loops_1000_loop2165_612 = loops_1000_loop2165_icmp_8_0;
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_142_S_0)) begin
+		bp_reg_25 <= loops_1000_loop2165_612;
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2165_612_reg = bp_reg_25;
+end
+
+always @ (*) begin
+	loops_1000_exit2166_613[31:0] = loops_1000_exit2166_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2166_613_reg[2:0] = bp_reg_0[5:3];
+end
+
+always @ (*) begin
+	loops_1000_exit2166_614 = loops_1000_exit2166_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit2166_614_reg = bp_reg_15[5:5];
+end
+
+always @ (*) begin
+	loops_1000_exit1167_615[31:0] = loops_1000_exit1167_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1167_615_reg[2:0] = bp_reg_6[15:13];
+end
+
+always @ (*) begin
+	loops_1000_exit1167_616 = loops_1000_exit1167_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit1167_616_reg = bp_reg_0[3:3];
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_144_S_1) & (loops_1000_exit1167_616_reg == 1'd0))) begin
+		loops_1000_loop0169_617_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_149_S_1) & (loops_1000_exit1173_637_reg == 1'd1))) begin
+		loops_1000_loop0169_617_reg[1:0] <= loops_1000_exit1173_636_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_144_S_1) & (loops_1000_exit1167_616_reg == 1'd0))) begin
+		loops_1000_loop0169_618_reg[63:0] <= loops_1000_loop2165_610_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_149_S_1) & (loops_1000_exit1173_637_reg == 1'd1))) begin
+		loops_1000_loop0169_618_reg[63:0] <= loops_1000_loop2171_631_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_145_S_0)) begin
+		loops_1000_loop1170_619_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_148_S_1) & (loops_1000_exit2172_635_reg == 1'd1))) begin
+		loops_1000_loop1170_619_reg[1:0] <= loops_1000_exit2172_634_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_145_S_0)) begin
+		loops_1000_loop1170_620_reg[63:0] <= loops_1000_loop0169_618_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_148_S_1) & (loops_1000_exit2172_635_reg == 1'd1))) begin
+		loops_1000_loop1170_620_reg[63:0] <= loops_1000_loop2171_631_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_146_S_0)) begin
+		loops_1000_loop2171_621_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_147_S_1) & (loops_1000_loop2171_633_reg == 1'd1))) begin
+		loops_1000_loop2171_621_reg[1:0] <= loops_1000_loop2171_632_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_146_S_0)) begin
+		loops_1000_loop2171_622_reg[63:0] <= loops_1000_loop1170_620_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_147_S_1) & (loops_1000_loop2171_633_reg == 1'd1))) begin
+		loops_1000_loop2171_622_reg[63:0] <= loops_1000_loop2171_631_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2171_623[63:0] = (loops_1000_loop2165_609_reg ^ loops_1000_loop2165_609_reg);
+end
+
+always @ (*) begin
+	loops_1000_loop2171_623_reg = bp_reg_0[41:41];
+end
+
+always @ (*) begin
+	loops_1000_loop2171_624[31:0] = loops_1000_loop2171_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2171_624_reg[31:0] = loops_1000_loop287_330_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2171_625[31:0] = loops_1000_loop2171_or_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2171_625_reg[31:0] = bp_reg_1[118:87];
+end
+
+always @ (*) begin
+	loops_1000_loop2171_626[31:0] = loops_1000_loop2171_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2171_626_reg[31:0] = loops_1000_loop29_58_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2171_627[31:0] = (loops_1000_loop2165_602_reg - loops_1000_loop2165_608_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_147_S_0)) begin
+		loops_1000_loop2171_627_reg[31:0] <= loops_1000_loop2171_627[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2171_630[15:0] = loops_1000_loop2171_and_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_147_S_0)) begin
+		loops_1000_loop2171_630_reg[15:0] <= loops_1000_loop2171_630[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2171_631[63:0] = (loops_1000_loop2171_622_reg + loops_1000_loop2171_630);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_147_S_0)) begin
+		loops_1000_loop2171_631_reg[63:0] <= loops_1000_loop2171_631[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2171_632[31:0] = loops_1000_loop2171_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2171_632_reg[2:0] = bp_reg_0[40:38];
+end
+
+always @ (*) begin
+	loops_1000_loop2171_633 = loops_1000_loop2171_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_loop2171_633_reg = bp_reg_5[25:25];
+end
+
+always @ (*) begin
+	loops_1000_exit2172_634[31:0] = loops_1000_exit2172_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2172_634_reg[2:0] = bp_reg_0[2:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2172_635 = loops_1000_exit2172_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit2172_635_reg = bp_reg_0[38:38];
+end
+
+always @ (*) begin
+	loops_1000_exit1173_636[31:0] = loops_1000_exit1173_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1173_636_reg[2:0] = bp_reg_2[84:82];
+end
+
+always @ (*) begin
+	loops_1000_exit1173_637 = loops_1000_exit1173_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit1173_637_reg = bp_reg_0[0:0];
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_149_S_1) & (loops_1000_exit1173_637_reg == 1'd0))) begin
+		loops_1000_loop0175_638_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_154_S_1) & (loops_1000_exit1179_658_reg == 1'd1))) begin
+		loops_1000_loop0175_638_reg[1:0] <= loops_1000_exit1179_657_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_149_S_1) & (loops_1000_exit1173_637_reg == 1'd0))) begin
+		loops_1000_loop0175_639_reg[63:0] <= loops_1000_loop2171_631_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_154_S_1) & (loops_1000_exit1179_658_reg == 1'd1))) begin
+		loops_1000_loop0175_639_reg[63:0] <= loops_1000_loop2177_652_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_150_S_0)) begin
+		loops_1000_loop1176_640_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_153_S_1) & (loops_1000_exit2178_656_reg == 1'd1))) begin
+		loops_1000_loop1176_640_reg[1:0] <= loops_1000_exit2178_655_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_150_S_0)) begin
+		loops_1000_loop1176_641_reg[63:0] <= loops_1000_loop0175_639_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_153_S_1) & (loops_1000_exit2178_656_reg == 1'd1))) begin
+		loops_1000_loop1176_641_reg[63:0] <= loops_1000_loop2177_652_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_151_S_0)) begin
+		loops_1000_loop2177_642_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_152_S_1) & (loops_1000_loop2177_654_reg == 1'd1))) begin
+		loops_1000_loop2177_642_reg[1:0] <= loops_1000_loop2177_653_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_151_S_0)) begin
+		loops_1000_loop2177_643_reg[63:0] <= loops_1000_loop1176_641_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_152_S_1) & (loops_1000_loop2177_654_reg == 1'd1))) begin
+		loops_1000_loop2177_643_reg[63:0] <= loops_1000_loop2177_652_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2177_644[31:0] = (loops_1000_loop2171_626_reg ^ loops_1000_loop2171_626_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_152_S_0)) begin
+		loops_1000_loop2177_644_reg[31:0] <= loops_1000_loop2177_644[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2177_645[15:0] = loops_1000_loop2177_add_16_16_1[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2177_645_reg[15:0] = bp_reg_0[83:68];
+end
+
+always @ (*) begin
+	loops_1000_loop2177_646[63:0] = (loops_1000_loop2171_623_reg - loops_1000_loop2165_601_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_152_S_0)) begin
+		loops_1000_loop2177_646_reg[63:0] <= loops_1000_loop2177_646[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2177_647[63:0] = (loops_1000_loop2165_607_reg | loops_1000_loop2177_643_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_152_S_0)) begin
+		loops_1000_loop2177_647_reg[63:0] <= loops_1000_loop2177_647[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2177_648[31:0] = loops_1000_loop2177_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2177_648_reg[31:0] = bp_reg_2[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2177_649[7:0] = loops_1000_loop2177_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2177_649_reg[7:0] = bp_reg_2[39:32];
+end
+
+always @ (*) begin
+	loops_1000_loop2177_650[15:0] = loops_1000_loop2177_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2177_650_reg[15:0] = bp_reg_2[55:40];
+end
+
+always @ (*) begin
+	loops_1000_loop2177_651[31:0] = loops_1000_loop2177_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2177_651_reg[31:0] = loops_1000_loop269_273_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2177_652[63:0] = (loops_1000_loop2177_643_reg + loops_1000_loop2177_651);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_152_S_0)) begin
+		loops_1000_loop2177_652_reg[63:0] <= loops_1000_loop2177_652[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2177_653[31:0] = loops_1000_loop2177_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2177_653_reg[2:0] = bp_reg_0[8:6];
+end
+
+always @ (*) begin
+	loops_1000_loop2177_654 = loops_1000_loop2177_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_loop2177_654_reg = bp_reg_2[124:124];
+end
+
+always @ (*) begin
+	loops_1000_exit2178_655[31:0] = loops_1000_exit2178_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2178_655_reg[2:0] = bp_reg_0[5:3];
+end
+
+always @ (*) begin
+	loops_1000_exit2178_656 = loops_1000_exit2178_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit2178_656_reg = bp_reg_0[6:6];
+end
+
+always @ (*) begin
+	loops_1000_exit1179_657[31:0] = loops_1000_exit1179_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1179_657_reg[2:0] = bp_reg_2[117:115];
+end
+
+always @ (*) begin
+	loops_1000_exit1179_658 = loops_1000_exit1179_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit1179_658_reg = bp_reg_0[3:3];
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_154_S_1) & (loops_1000_exit1179_658_reg == 1'd0))) begin
+		loops_1000_loop0181_659_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_159_S_1) & (loops_1000_exit1185_679_reg == 1'd1))) begin
+		loops_1000_loop0181_659_reg[1:0] <= loops_1000_exit1185_678_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_154_S_1) & (loops_1000_exit1179_658_reg == 1'd0))) begin
+		loops_1000_loop0181_660_reg[63:0] <= loops_1000_loop2177_652_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_159_S_1) & (loops_1000_exit1185_679_reg == 1'd1))) begin
+		loops_1000_loop0181_660_reg[63:0] <= loops_1000_loop2183_673_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_155_S_0)) begin
+		loops_1000_loop1182_661_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_158_S_1) & (loops_1000_exit2184_677_reg == 1'd1))) begin
+		loops_1000_loop1182_661_reg[1:0] <= loops_1000_exit2184_676_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_155_S_0)) begin
+		loops_1000_loop1182_662_reg[63:0] <= loops_1000_loop0181_660_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_158_S_1) & (loops_1000_exit2184_677_reg == 1'd1))) begin
+		loops_1000_loop1182_662_reg[63:0] <= loops_1000_loop2183_673_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_156_S_0)) begin
+		loops_1000_loop2183_663_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_157_S_1) & (loops_1000_loop2183_675_reg == 1'd1))) begin
+		loops_1000_loop2183_663_reg[1:0] <= loops_1000_loop2183_674_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_156_S_0)) begin
+		loops_1000_loop2183_664_reg[63:0] <= loops_1000_loop1182_662_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_157_S_1) & (loops_1000_loop2183_675_reg == 1'd1))) begin
+		loops_1000_loop2183_664_reg[63:0] <= loops_1000_loop2183_673_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2183_665[63:0] = (loops_1000_loop2171_622_reg ^ loops_1000_loop2183_664_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_157_S_0)) begin
+		loops_1000_loop2183_665_reg[63:0] <= loops_1000_loop2183_665[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2183_667[63:0] = (loops_1000_loop2183_664_reg ^ loops_1000_loop2165_609_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_157_S_0)) begin
+		loops_1000_loop2183_667_reg[63:0] <= loops_1000_loop2183_667[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2183_668[7:0] = loops_1000_loop2183_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2183_668_reg[7:0] = bp_reg_14[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2183_669[31:0] = loops_1000_loop2183_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2183_669_reg[31:0] = loops_1000_loop281_315_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2183_671[63:0] = (loops_1000_loop2183_667 + loops_1000_loop2177_646_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_157_S_0)) begin
+		loops_1000_loop2183_671_reg[63:0] <= loops_1000_loop2183_671[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2183_672[63:0] = (loops_1000_loop2183_671 ^ loops_1000_loop2177_646_reg);
+end
+
+always @ (*) begin
+	loops_1000_loop2183_672_reg[63:0] = bp_reg_3[65:2];
+end
+
+always @ (*) begin
+	loops_1000_loop2183_673[63:0] = (loops_1000_loop2183_664_reg + loops_1000_loop2183_672);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_157_S_0)) begin
+		loops_1000_loop2183_673_reg[63:0] <= loops_1000_loop2183_673[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2183_674[31:0] = loops_1000_loop2183_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2183_674_reg[2:0] = bp_reg_0[17:15];
+end
+
+always @ (*) begin
+	loops_1000_loop2183_675 = loops_1000_loop2183_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_loop2183_675_reg = bp_reg_3[66:66];
+end
+
+always @ (*) begin
+	loops_1000_exit2184_676[31:0] = loops_1000_exit2184_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2184_676_reg[2:0] = bp_reg_0[2:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2184_677 = loops_1000_exit2184_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit2184_677_reg = bp_reg_0[15:15];
+end
+
+always @ (*) begin
+	loops_1000_exit1185_678[31:0] = loops_1000_exit1185_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1185_678_reg[2:0] = bp_reg_2[181:179];
+end
+
+always @ (*) begin
+	loops_1000_exit1185_679 = loops_1000_exit1185_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit1185_679_reg = bp_reg_0[0:0];
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_159_S_1) & (loops_1000_exit1185_679_reg == 1'd0))) begin
+		loops_1000_loop0187_680_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_164_S_1) & (loops_1000_exit1191_700_reg == 1'd1))) begin
+		loops_1000_loop0187_680_reg[1:0] <= loops_1000_exit1191_699_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_159_S_1) & (loops_1000_exit1185_679_reg == 1'd0))) begin
+		loops_1000_loop0187_681_reg[63:0] <= loops_1000_loop2183_673_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_164_S_1) & (loops_1000_exit1191_700_reg == 1'd1))) begin
+		loops_1000_loop0187_681_reg[63:0] <= loops_1000_loop2189_694_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_160_S_0)) begin
+		loops_1000_loop1188_682_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_163_S_1) & (loops_1000_exit2190_698_reg == 1'd1))) begin
+		loops_1000_loop1188_682_reg[1:0] <= loops_1000_exit2190_697_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_160_S_0)) begin
+		loops_1000_loop1188_683_reg[63:0] <= loops_1000_loop0187_681_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_163_S_1) & (loops_1000_exit2190_698_reg == 1'd1))) begin
+		loops_1000_loop1188_683_reg[63:0] <= loops_1000_loop2189_694_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_161_S_0)) begin
+		loops_1000_loop2189_684_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_162_S_1) & (loops_1000_loop2189_696_reg == 1'd1))) begin
+		loops_1000_loop2189_684_reg[1:0] <= loops_1000_loop2189_695_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_161_S_0)) begin
+		loops_1000_loop2189_685_reg[63:0] <= loops_1000_loop1188_683_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_162_S_1) & (loops_1000_loop2189_696_reg == 1'd1))) begin
+		loops_1000_loop2189_685_reg[63:0] <= loops_1000_loop2189_694_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2189_686[15:0] = loops_1000_loop2189_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2189_686_reg[15:0] = loops_1000_loop215_80_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2189_687[63:0] = (loops_1000_loop2177_647_reg + loops_1000_loop2177_646_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_162_S_0)) begin
+		loops_1000_loop2189_687_reg[63:0] <= loops_1000_loop2189_687[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2189_688[7:0] = (loops_1000_loop2177_649_reg - loops_1000_loop2159_584_reg);
+end
+
+always @ (*) begin
+	loops_1000_loop2189_688_reg[7:0] = bp_reg_1[142:135];
+end
+
+always @ (*) begin
+	loops_1000_loop2189_689[7:0] = loops_1000_loop2189_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2189_689_reg[7:0] = bp_reg_1[150:143];
+end
+
+always @ (*) begin
+	loops_1000_loop2189_690[31:0] = loops_1000_loop2189_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2189_690_reg[31:0] = loops_1000_loop29_58_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2189_691[7:0] = loops_1000_loop2189_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2189_691_reg[7:0] = bp_reg_2[73:66];
+end
+
+always @ (*) begin
+	loops_1000_loop2189_692[7:0] = loops_1000_loop2189_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2189_692_reg[7:0] = loops_1000_loop221_102_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2189_693[31:0] = loops_1000_loop2189_or_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2189_693_reg[31:0] = bp_reg_2[105:74];
+end
+
+always @ (*) begin
+	loops_1000_loop2189_694[63:0] = (loops_1000_loop2189_685_reg + loops_1000_loop2189_693);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_162_S_0)) begin
+		loops_1000_loop2189_694_reg[63:0] <= loops_1000_loop2189_694[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2189_695[31:0] = loops_1000_loop2189_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2189_695_reg[2:0] = bp_reg_0[8:6];
+end
+
+always @ (*) begin
+	loops_1000_loop2189_696 = loops_1000_loop2189_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_loop2189_696_reg = bp_reg_2[106:106];
+end
+
+always @ (*) begin
+	loops_1000_exit2190_697[31:0] = loops_1000_exit2190_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2190_697_reg[2:0] = bp_reg_0[5:3];
+end
+
+always @ (*) begin
+	loops_1000_exit2190_698 = loops_1000_exit2190_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit2190_698_reg = bp_reg_2[111:111];
+end
+
+always @ (*) begin
+	loops_1000_exit1191_699[31:0] = loops_1000_exit1191_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1191_699_reg[2:0] = bp_reg_4[39:37];
+end
+
+always @ (*) begin
+	loops_1000_exit1191_700 = loops_1000_exit1191_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit1191_700_reg = bp_reg_0[3:3];
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_164_S_1) & (loops_1000_exit1191_700_reg == 1'd0))) begin
+		loops_1000_loop0193_701_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_169_S_1) & (loops_1000_exit1197_721_reg == 1'd1))) begin
+		loops_1000_loop0193_701_reg[1:0] <= loops_1000_exit1197_720_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_164_S_1) & (loops_1000_exit1191_700_reg == 1'd0))) begin
+		loops_1000_loop0193_702_reg[63:0] <= loops_1000_loop2189_694_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_169_S_1) & (loops_1000_exit1197_721_reg == 1'd1))) begin
+		loops_1000_loop0193_702_reg[63:0] <= loops_1000_loop2195_715_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_165_S_0)) begin
+		loops_1000_loop1194_703_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_168_S_1) & (loops_1000_exit2196_719_reg == 1'd1))) begin
+		loops_1000_loop1194_703_reg[1:0] <= loops_1000_exit2196_718_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_165_S_0)) begin
+		loops_1000_loop1194_704_reg[63:0] <= loops_1000_loop0193_702_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_168_S_1) & (loops_1000_exit2196_719_reg == 1'd1))) begin
+		loops_1000_loop1194_704_reg[63:0] <= loops_1000_loop2195_715_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_166_S_0)) begin
+		loops_1000_loop2195_705_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_167_S_1) & (loops_1000_loop2195_717_reg == 1'd1))) begin
+		loops_1000_loop2195_705_reg[1:0] <= loops_1000_loop2195_716_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_166_S_0)) begin
+		loops_1000_loop2195_706_reg[63:0] <= loops_1000_loop1194_704_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_167_S_1) & (loops_1000_loop2195_717_reg == 1'd1))) begin
+		loops_1000_loop2195_706_reg[63:0] <= loops_1000_loop2195_715_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2195_707[15:0] = (loops_1000_loop2171_630_reg ^ loops_1000_loop2165_605_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_167_S_0)) begin
+		loops_1000_loop2195_707_reg[15:0] <= loops_1000_loop2195_707[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2195_708[7:0] = (loops_1000_loop2189_692_reg - loops_1000_loop2189_688_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_167_S_0)) begin
+		loops_1000_loop2195_708_reg[7:0] <= loops_1000_loop2195_708[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2195_709[31:0] = loops_1000_loop2195_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2195_709_reg[31:0] = loops_1000_loop29_59_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2195_710[15:0] = (loops_1000_loop2165_605_reg - loops_1000_loop2171_630_reg);
+end
+
+always @ (*) begin
+	loops_1000_loop2195_710_reg[15:0] = bp_reg_1[34:19];
+end
+
+always @ (*) begin
+	loops_1000_loop2195_711[7:0] = loops_1000_loop2195_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2195_711_reg[7:0] = bp_reg_1[42:35];
+end
+
+always @ (*) begin
+	loops_1000_loop2195_712[15:0] = loops_1000_loop2195_add_16_16_1[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2195_712_reg[15:0] = loops_1000_loop245_184_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2195_713[31:0] = (loops_1000_loop2177_648_reg ^ loops_1000_loop2189_693_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_167_S_0)) begin
+		loops_1000_loop2195_713_reg[31:0] <= loops_1000_loop2195_713[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2195_714[15:0] = (loops_1000_loop2195_712 - loops_1000_loop2189_686_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_167_S_0)) begin
+		loops_1000_loop2195_714_reg[15:0] <= loops_1000_loop2195_714[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2195_715[63:0] = (loops_1000_loop2195_706_reg + loops_1000_loop2195_714);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_167_S_0)) begin
+		loops_1000_loop2195_715_reg[63:0] <= loops_1000_loop2195_715[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2195_716[31:0] = loops_1000_loop2195_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2195_716_reg[2:0] = bp_reg_0[14:12];
+end
+
+always @ (*) begin
+	loops_1000_loop2195_717 = loops_1000_loop2195_icmp_8_0;
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_167_S_0)) begin
+		bp_reg_26 <= loops_1000_loop2195_717;
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2195_717_reg = bp_reg_26;
+end
+
+always @ (*) begin
+	loops_1000_exit2196_718[31:0] = loops_1000_exit2196_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2196_718_reg[2:0] = bp_reg_0[2:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2196_719 = loops_1000_exit2196_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit2196_719_reg = bp_reg_0[12:12];
+end
+
+always @ (*) begin
+	loops_1000_exit1197_720[31:0] = loops_1000_exit1197_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1197_720_reg[2:0] = bp_reg_2[171:169];
+end
+
+always @ (*) begin
+	loops_1000_exit1197_721 = loops_1000_exit1197_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit1197_721_reg = bp_reg_0[0:0];
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_169_S_1) & (loops_1000_exit1197_721_reg == 1'd0))) begin
+		loops_1000_loop0199_722_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_174_S_1) & (loops_1000_exit1203_742_reg == 1'd1))) begin
+		loops_1000_loop0199_722_reg[1:0] <= loops_1000_exit1203_741_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_169_S_1) & (loops_1000_exit1197_721_reg == 1'd0))) begin
+		loops_1000_loop0199_723_reg[63:0] <= loops_1000_loop2195_715_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_174_S_1) & (loops_1000_exit1203_742_reg == 1'd1))) begin
+		loops_1000_loop0199_723_reg[63:0] <= loops_1000_loop2201_736_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_170_S_0)) begin
+		loops_1000_loop1200_724_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_173_S_1) & (loops_1000_exit2202_740_reg == 1'd1))) begin
+		loops_1000_loop1200_724_reg[1:0] <= loops_1000_exit2202_739_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_170_S_0)) begin
+		loops_1000_loop1200_725_reg[63:0] <= loops_1000_loop0199_723_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_173_S_1) & (loops_1000_exit2202_740_reg == 1'd1))) begin
+		loops_1000_loop1200_725_reg[63:0] <= loops_1000_loop2201_736_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_171_S_0)) begin
+		loops_1000_loop2201_726_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_172_S_1) & (loops_1000_loop2201_738_reg == 1'd1))) begin
+		loops_1000_loop2201_726_reg[1:0] <= loops_1000_loop2201_737_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_171_S_0)) begin
+		loops_1000_loop2201_727_reg[63:0] <= loops_1000_loop1200_725_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_172_S_1) & (loops_1000_loop2201_738_reg == 1'd1))) begin
+		loops_1000_loop2201_727_reg[63:0] <= loops_1000_loop2201_736_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2201_728[63:0] = (loops_1000_loop2183_665_reg - loops_1000_loop2189_687_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_172_S_0)) begin
+		loops_1000_loop2201_728_reg[63:0] <= loops_1000_loop2201_728[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2201_729[31:0] = loops_1000_loop2201_or_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2201_729_reg[31:0] = loops_1000_loop257_226_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2201_730[31:0] = loops_1000_loop2201_or_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2201_730_reg[31:0] = loops_1000_loop269_272_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2201_731[31:0] = loops_1000_loop2201_and_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_172_S_0)) begin
+		loops_1000_loop2201_731_reg[31:0] <= loops_1000_loop2201_731[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2201_732[15:0] = loops_1000_loop2201_mul_16_16_0[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2201_732_reg[15:0] = bp_reg_9[18:3];
+end
+
+always @ (*) begin
+	loops_1000_loop2201_733[7:0] = (loops_1000_loop2177_649_reg - loops_1000_loop2183_668_reg);
+end
+
+always @ (*) begin
+	loops_1000_loop2201_733_reg[7:0] = bp_reg_15[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2201_734[63:0] = (loops_1000_loop2183_672_reg + loops_1000_loop2189_685_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_172_S_0)) begin
+		loops_1000_loop2201_734_reg[63:0] <= loops_1000_loop2201_734[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2201_735[63:0] = (loops_1000_loop2201_728 ^ loops_1000_loop2183_672_reg);
+end
+
+always @ (*) begin
+	loops_1000_loop2201_735_reg[63:0] = bp_reg_2[185:122];
+end
+
+always @ (*) begin
+	loops_1000_loop2201_736[63:0] = (loops_1000_loop2201_727_reg + loops_1000_loop2201_735);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_172_S_0)) begin
+		loops_1000_loop2201_736_reg[63:0] <= loops_1000_loop2201_736[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2201_737[31:0] = loops_1000_loop2201_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2201_737_reg[2:0] = bp_reg_0[70:68];
+end
+
+always @ (*) begin
+	loops_1000_loop2201_738 = loops_1000_loop2201_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_loop2201_738_reg = bp_reg_2[186:186];
+end
+
+always @ (*) begin
+	loops_1000_exit2202_739[31:0] = loops_1000_exit2202_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2202_739_reg[2:0] = bp_reg_0[5:3];
+end
+
+always @ (*) begin
+	loops_1000_exit2202_740 = loops_1000_exit2202_icmp_8_0;
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_173_S_0)) begin
+		bp_reg_27 <= loops_1000_exit2202_740;
+	end
+end
+
+always @ (*) begin
+	loops_1000_exit2202_740_reg = bp_reg_27;
+end
+
+always @ (*) begin
+	loops_1000_exit1203_741[31:0] = loops_1000_exit1203_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1203_741_reg[2:0] = bp_reg_4[23:21];
+end
+
+always @ (*) begin
+	loops_1000_exit1203_742 = loops_1000_exit1203_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit1203_742_reg = bp_reg_0[3:3];
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_174_S_1) & (loops_1000_exit1203_742_reg == 1'd0))) begin
+		loops_1000_loop0205_743_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_179_S_1) & (loops_1000_exit1209_763_reg == 1'd1))) begin
+		loops_1000_loop0205_743_reg[1:0] <= loops_1000_exit1209_762_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_174_S_1) & (loops_1000_exit1203_742_reg == 1'd0))) begin
+		loops_1000_loop0205_744_reg[63:0] <= loops_1000_loop2201_736_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_179_S_1) & (loops_1000_exit1209_763_reg == 1'd1))) begin
+		loops_1000_loop0205_744_reg[63:0] <= loops_1000_loop2207_757_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_175_S_0)) begin
+		loops_1000_loop1206_745_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_178_S_1) & (loops_1000_exit2208_761_reg == 1'd1))) begin
+		loops_1000_loop1206_745_reg[1:0] <= loops_1000_exit2208_760_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_175_S_0)) begin
+		loops_1000_loop1206_746_reg[63:0] <= loops_1000_loop0205_744_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_178_S_1) & (loops_1000_exit2208_761_reg == 1'd1))) begin
+		loops_1000_loop1206_746_reg[63:0] <= loops_1000_loop2207_757_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_176_S_0)) begin
+		loops_1000_loop2207_747_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_177_S_1) & (loops_1000_loop2207_759_reg == 1'd1))) begin
+		loops_1000_loop2207_747_reg[1:0] <= loops_1000_loop2207_758_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_176_S_0)) begin
+		loops_1000_loop2207_748_reg[63:0] <= loops_1000_loop1206_746_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_177_S_1) & (loops_1000_loop2207_759_reg == 1'd1))) begin
+		loops_1000_loop2207_748_reg[63:0] <= loops_1000_loop2207_757_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2207_749[15:0] = (loops_1000_loop2201_732_reg - loops_1000_loop2195_707_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_177_S_0)) begin
+		loops_1000_loop2207_749_reg[15:0] <= loops_1000_loop2207_749[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2207_750[7:0] = loops_1000_loop2207_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2207_750_reg[7:0] = loops_1000_exit165_258_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2207_751[15:0] = (loops_1000_loop2189_686_reg ^ loops_1000_loop2195_710_reg);
+end
+
+always @ (*) begin
+	loops_1000_loop2207_751_reg[15:0] = bp_reg_1[17:2];
+end
+
+always @ (*) begin
+	loops_1000_loop2207_752[31:0] = (loops_1000_loop2201_730_reg - loops_1000_loop2189_693_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_177_S_0)) begin
+		loops_1000_loop2207_752_reg[31:0] <= loops_1000_loop2207_752[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2207_753[63:0] = (loops_1000_loop2195_706_reg + loops_1000_loop2201_727_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_177_S_0)) begin
+		loops_1000_loop2207_753_reg[63:0] <= loops_1000_loop2207_753[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2207_754[63:0] = (loops_1000_loop2201_734_reg & loops_1000_loop2195_708_reg);
+end
+
+always @ (*) begin
+	loops_1000_loop2207_754_reg[7:0] = bp_reg_1[210:203];
+end
+
+always @ (*) begin
+	loops_1000_loop2207_755[15:0] = loops_1000_loop2207_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2207_755_reg[15:0] = loops_1000_loop233_142_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2207_756[31:0] = (loops_1000_loop2201_731_reg ^ loops_1000_loop2189_688_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_177_S_0)) begin
+		loops_1000_loop2207_756_reg[31:0] <= loops_1000_loop2207_756[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2207_757[63:0] = (loops_1000_loop2207_748_reg + loops_1000_loop2207_756);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_177_S_0)) begin
+		loops_1000_loop2207_757_reg[63:0] <= loops_1000_loop2207_757[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2207_758[31:0] = loops_1000_loop2207_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2207_758_reg[2:0] = bp_reg_0[14:12];
+end
+
+always @ (*) begin
+	loops_1000_loop2207_759 = loops_1000_loop2207_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_loop2207_759_reg = bp_reg_5[29:29];
+end
+
+always @ (*) begin
+	loops_1000_exit2208_760[31:0] = loops_1000_exit2208_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2208_760_reg[2:0] = bp_reg_0[2:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2208_761 = loops_1000_exit2208_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit2208_761_reg = bp_reg_0[12:12];
+end
+
+always @ (*) begin
+	loops_1000_exit1209_762[31:0] = loops_1000_exit1209_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1209_762_reg[2:0] = bp_reg_6[3:1];
+end
+
+always @ (*) begin
+	loops_1000_exit1209_763 = loops_1000_exit1209_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit1209_763_reg = bp_reg_0[0:0];
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_179_S_1) & (loops_1000_exit1209_763_reg == 1'd0))) begin
+		loops_1000_loop0211_764_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_184_S_1) & (loops_1000_exit1215_784_reg == 1'd1))) begin
+		loops_1000_loop0211_764_reg[1:0] <= loops_1000_exit1215_783_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_179_S_1) & (loops_1000_exit1209_763_reg == 1'd0))) begin
+		loops_1000_loop0211_765_reg[63:0] <= loops_1000_loop2207_757_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_184_S_1) & (loops_1000_exit1215_784_reg == 1'd1))) begin
+		loops_1000_loop0211_765_reg[63:0] <= loops_1000_loop2213_778_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_180_S_0)) begin
+		loops_1000_loop1212_766_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_183_S_1) & (loops_1000_exit2214_782_reg == 1'd1))) begin
+		loops_1000_loop1212_766_reg[1:0] <= loops_1000_exit2214_781_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_180_S_0)) begin
+		loops_1000_loop1212_767_reg[63:0] <= loops_1000_loop0211_765_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_183_S_1) & (loops_1000_exit2214_782_reg == 1'd1))) begin
+		loops_1000_loop1212_767_reg[63:0] <= loops_1000_loop2213_778_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_181_S_0)) begin
+		loops_1000_loop2213_768_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_182_S_1) & (loops_1000_loop2213_780_reg == 1'd1))) begin
+		loops_1000_loop2213_768_reg[1:0] <= loops_1000_loop2213_779_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_181_S_0)) begin
+		loops_1000_loop2213_769_reg[63:0] <= loops_1000_loop1212_767_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_182_S_1) & (loops_1000_loop2213_780_reg == 1'd1))) begin
+		loops_1000_loop2213_769_reg[63:0] <= loops_1000_loop2213_778_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2213_770[31:0] = loops_1000_loop2213_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2213_770_reg[31:0] = loops_1000_loop269_273_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2213_772[15:0] = (loops_1000_loop2195_714_reg ^ loops_1000_loop2207_755_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_182_S_0)) begin
+		loops_1000_loop2213_772_reg[15:0] <= loops_1000_loop2213_772[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2213_773[15:0] = loops_1000_loop2213_or_16_16_0[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2213_773_reg[15:0] = loops_1000_loop251_204_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2213_774[63:0] = (loops_1000_loop2207_753_reg + loops_1000_loop2207_754_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_182_S_0)) begin
+		loops_1000_loop2213_774_reg[63:0] <= loops_1000_loop2213_774[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2213_775[63:0] = (loops_1000_loop2213_769_reg | loops_1000_loop2213_774);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_182_S_0)) begin
+		loops_1000_loop2213_775_reg[63:0] <= loops_1000_loop2213_775[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2213_777[31:0] = (loops_1000_loop2207_756_reg ^ loops_1000_loop2201_730_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_182_S_0)) begin
+		loops_1000_loop2213_777_reg[31:0] <= loops_1000_loop2213_777[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2213_778[63:0] = (loops_1000_loop2213_769_reg + loops_1000_loop2213_777);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_182_S_0)) begin
+		loops_1000_loop2213_778_reg[63:0] <= loops_1000_loop2213_778[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2213_779[31:0] = loops_1000_loop2213_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2213_779_reg[2:0] = bp_reg_0[11:9];
+end
+
+always @ (*) begin
+	loops_1000_loop2213_780 = loops_1000_loop2213_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_loop2213_780_reg = bp_reg_2[146:146];
+end
+
+always @ (*) begin
+	loops_1000_exit2214_781[31:0] = loops_1000_exit2214_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2214_781_reg[2:0] = bp_reg_0[5:3];
+end
+
+always @ (*) begin
+	loops_1000_exit2214_782 = loops_1000_exit2214_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit2214_782_reg = bp_reg_0[9:9];
+end
+
+always @ (*) begin
+	loops_1000_exit1215_783[31:0] = loops_1000_exit1215_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1215_783_reg[2:0] = bp_reg_6[31:29];
+end
+
+always @ (*) begin
+	loops_1000_exit1215_784 = loops_1000_exit1215_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit1215_784_reg = bp_reg_0[3:3];
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_184_S_1) & (loops_1000_exit1215_784_reg == 1'd0))) begin
+		loops_1000_loop0217_785_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_189_S_1) & (loops_1000_exit1221_805_reg == 1'd1))) begin
+		loops_1000_loop0217_785_reg[1:0] <= loops_1000_exit1221_804_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_184_S_1) & (loops_1000_exit1215_784_reg == 1'd0))) begin
+		loops_1000_loop0217_786_reg[63:0] <= loops_1000_loop2213_778_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_189_S_1) & (loops_1000_exit1221_805_reg == 1'd1))) begin
+		loops_1000_loop0217_786_reg[63:0] <= loops_1000_loop2219_799_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_185_S_0)) begin
+		loops_1000_loop1218_787_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_188_S_1) & (loops_1000_exit2220_803_reg == 1'd1))) begin
+		loops_1000_loop1218_787_reg[1:0] <= loops_1000_exit2220_802_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_185_S_0)) begin
+		loops_1000_loop1218_788_reg[63:0] <= loops_1000_loop0217_786_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_188_S_1) & (loops_1000_exit2220_803_reg == 1'd1))) begin
+		loops_1000_loop1218_788_reg[63:0] <= loops_1000_loop2219_799_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_186_S_0)) begin
+		loops_1000_loop2219_789_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_187_S_2) & (loops_1000_loop2219_801_reg == 1'd1))) begin
+		loops_1000_loop2219_789_reg[1:0] <= loops_1000_loop2219_800_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_186_S_0)) begin
+		loops_1000_loop2219_790_reg[63:0] <= loops_1000_loop1218_788_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_187_S_2) & (loops_1000_loop2219_801_reg == 1'd1))) begin
+		loops_1000_loop2219_790_reg[63:0] <= loops_1000_loop2219_799_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2219_791[15:0] = loops_1000_loop2219_add_16_16_1[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2219_791_reg[15:0] = bp_reg_0[83:68];
+end
+
+always @ (*) begin
+	loops_1000_loop2219_792[15:0] = (loops_1000_loop2195_714_reg - loops_1000_loop2213_773_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_187_S_0)) begin
+		loops_1000_loop2219_792_reg[15:0] <= loops_1000_loop2219_792[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2219_793[31:0] = loops_1000_loop2219_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2219_793_reg[31:0] = bp_reg_1[90:59];
+end
+
+always @ (*) begin
+	loops_1000_loop2219_794[31:0] = (loops_1000_loop2219_793 - loops_1000_loop2201_731_reg);
+end
+
+always @ (*) begin
+	loops_1000_loop2219_794_reg[31:0] = bp_reg_1[122:91];
+end
+
+always @ (*) begin
+	loops_1000_loop2219_795[7:0] = loops_1000_loop2219_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2219_795_reg[7:0] = bp_reg_1[130:123];
+end
+
+always @ (*) begin
+	loops_1000_loop2219_796[31:0] = loops_1000_loop2219_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2219_796_reg[31:0] = loops_1000_loop287_330_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2219_797[15:0] = (loops_1000_loop2207_749_reg ^ loops_1000_loop2207_751_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_187_S_0)) begin
+		loops_1000_loop2219_797_reg[15:0] <= loops_1000_loop2219_797[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2219_798[31:0] = loops_1000_loop2219_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2219_798_reg[31:0] = bp_reg_1[194:163];
+end
+
+always @ (*) begin
+	loops_1000_loop2219_799[63:0] = (loops_1000_loop2219_790_reg + loops_1000_loop2219_798);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_187_S_1)) begin
+		loops_1000_loop2219_799_reg[63:0] <= loops_1000_loop2219_799[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2219_800[31:0] = loops_1000_loop2219_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2219_800_reg[2:0] = bp_reg_0[14:12];
+end
+
+always @ (*) begin
+	loops_1000_loop2219_801 = loops_1000_loop2219_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_loop2219_801_reg = bp_reg_1[163:163];
+end
+
+always @ (*) begin
+	loops_1000_exit2220_802[31:0] = loops_1000_exit2220_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2220_802_reg[2:0] = bp_reg_0[2:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2220_803 = loops_1000_exit2220_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit2220_803_reg = bp_reg_1[88:88];
+end
+
+always @ (*) begin
+	loops_1000_exit1221_804[31:0] = loops_1000_exit1221_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1221_804_reg[2:0] = bp_reg_3[2:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1221_805 = loops_1000_exit1221_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit1221_805_reg = bp_reg_0[0:0];
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_189_S_1) & (loops_1000_exit1221_805_reg == 1'd0))) begin
+		loops_1000_loop0223_806_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_194_S_1) & (loops_1000_exit1227_826_reg == 1'd1))) begin
+		loops_1000_loop0223_806_reg[1:0] <= loops_1000_exit1227_825_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_189_S_1) & (loops_1000_exit1221_805_reg == 1'd0))) begin
+		loops_1000_loop0223_807_reg[63:0] <= loops_1000_loop2219_799_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_194_S_1) & (loops_1000_exit1227_826_reg == 1'd1))) begin
+		loops_1000_loop0223_807_reg[63:0] <= loops_1000_loop2225_820_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_190_S_0)) begin
+		loops_1000_loop1224_808_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_193_S_1) & (loops_1000_exit2226_824_reg == 1'd1))) begin
+		loops_1000_loop1224_808_reg[1:0] <= loops_1000_exit2226_823_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_190_S_0)) begin
+		loops_1000_loop1224_809_reg[63:0] <= loops_1000_loop0223_807_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_193_S_1) & (loops_1000_exit2226_824_reg == 1'd1))) begin
+		loops_1000_loop1224_809_reg[63:0] <= loops_1000_loop2225_820_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_191_S_0)) begin
+		loops_1000_loop2225_810_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_192_S_1) & (loops_1000_loop2225_822_reg == 1'd1))) begin
+		loops_1000_loop2225_810_reg[1:0] <= loops_1000_loop2225_821_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_191_S_0)) begin
+		loops_1000_loop2225_811_reg[63:0] <= loops_1000_loop1224_809_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_192_S_1) & (loops_1000_loop2225_822_reg == 1'd1))) begin
+		loops_1000_loop2225_811_reg[63:0] <= loops_1000_loop2225_820_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2225_812[63:0] = (loops_1000_loop2213_775_reg | loops_1000_loop2213_775_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_192_S_0)) begin
+		loops_1000_loop2225_812_reg[63:0] <= loops_1000_loop2225_812[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2225_813[15:0] = loops_1000_loop2225_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2225_813_reg[15:0] = bp_reg_1[255:240];
+end
+
+always @ (*) begin
+	loops_1000_loop2225_819[31:0] = loops_1000_loop2225_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2225_819_reg[31:0] = loops_1000_loop281_315_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2225_820[63:0] = (loops_1000_loop2225_811_reg + loops_1000_loop2225_819);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_192_S_0)) begin
+		loops_1000_loop2225_820_reg[63:0] <= loops_1000_loop2225_820[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2225_821[31:0] = loops_1000_loop2225_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2225_821_reg[2:0] = bp_reg_0[11:9];
+end
+
+always @ (*) begin
+	loops_1000_loop2225_822 = loops_1000_loop2225_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_loop2225_822_reg = bp_reg_5[26:26];
+end
+
+always @ (*) begin
+	loops_1000_exit2226_823[31:0] = loops_1000_exit2226_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2226_823_reg[2:0] = bp_reg_0[5:3];
+end
+
+always @ (*) begin
+	loops_1000_exit2226_824 = loops_1000_exit2226_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit2226_824_reg = bp_reg_0[9:9];
+end
+
+always @ (*) begin
+	loops_1000_exit1227_825[31:0] = loops_1000_exit1227_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1227_825_reg[2:0] = bp_reg_1[227:225];
+end
+
+always @ (*) begin
+	loops_1000_exit1227_826 = loops_1000_exit1227_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit1227_826_reg = bp_reg_0[3:3];
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_194_S_1) & (loops_1000_exit1227_826_reg == 1'd0))) begin
+		loops_1000_loop0229_827_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_199_S_1) & (loops_1000_exit1233_847_reg == 1'd1))) begin
+		loops_1000_loop0229_827_reg[1:0] <= loops_1000_exit1233_846_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_1000_BB_194_S_1) & (loops_1000_exit1227_826_reg == 1'd0))) begin
+		loops_1000_loop0229_828_reg[63:0] <= loops_1000_loop2225_820_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_199_S_1) & (loops_1000_exit1233_847_reg == 1'd1))) begin
+		loops_1000_loop0229_828_reg[63:0] <= loops_1000_loop2231_841_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_195_S_0)) begin
+		loops_1000_loop1230_829_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_198_S_1) & (loops_1000_exit2232_845_reg == 1'd1))) begin
+		loops_1000_loop1230_829_reg[1:0] <= loops_1000_exit2232_844_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_195_S_0)) begin
+		loops_1000_loop1230_830_reg[63:0] <= loops_1000_loop0229_828_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_198_S_1) & (loops_1000_exit2232_845_reg == 1'd1))) begin
+		loops_1000_loop1230_830_reg[63:0] <= loops_1000_loop2231_841_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_196_S_0)) begin
+		loops_1000_loop2231_831_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_197_S_1) & (loops_1000_loop2231_843_reg == 1'd1))) begin
+		loops_1000_loop2231_831_reg[1:0] <= loops_1000_loop2231_842_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_196_S_0)) begin
+		loops_1000_loop2231_832_reg[63:0] <= loops_1000_loop1230_830_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_1000_BB_197_S_1) & (loops_1000_loop2231_843_reg == 1'd1))) begin
+		loops_1000_loop2231_832_reg[63:0] <= loops_1000_loop2231_841_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2231_834[15:0] = loops_1000_loop2231_add_16_16_1[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2231_834_reg[15:0] = bp_reg_0[82:67];
+end
+
+always @ (*) begin
+	loops_1000_loop2231_835[15:0] = loops_1000_loop2231_or_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_197_S_0)) begin
+		loops_1000_loop2231_835_reg[15:0] <= loops_1000_loop2231_835[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2231_836[15:0] = loops_1000_loop2231_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2231_836_reg[15:0] = bp_reg_1[111:96];
+end
+
+always @ (*) begin
+	loops_1000_loop2231_839[7:0] = loops_1000_loop2231_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2231_839_reg[7:0] = bp_reg_1[119:112];
+end
+
+always @ (*) begin
+	loops_1000_loop2231_840[7:0] = loops_1000_loop2231_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2231_840_reg[7:0] = loops_1000_exit165_258_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2231_841[63:0] = (loops_1000_loop2231_832_reg + loops_1000_loop2231_840);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_197_S_0)) begin
+		loops_1000_loop2231_841_reg[63:0] <= loops_1000_loop2231_841[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2231_842[31:0] = loops_1000_loop2231_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2231_842_reg[2:0] = bp_reg_0[8:6];
+end
+
+always @ (*) begin
+	loops_1000_loop2231_843 = loops_1000_loop2231_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_loop2231_843_reg = bp_reg_1[152:152];
+end
+
+always @ (*) begin
+	loops_1000_exit2232_844[31:0] = loops_1000_exit2232_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2232_844_reg[2:0] = bp_reg_0[2:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2232_845 = loops_1000_exit2232_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit2232_845_reg = bp_reg_0[6:6];
+end
+
+always @ (*) begin
+	loops_1000_exit1233_846[31:0] = loops_1000_exit1233_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1233_846_reg[2:0] = bp_reg_4[9:7];
+end
+
+always @ (*) begin
+	loops_1000_exit1233_847 = loops_1000_exit1233_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_1000_exit1233_847_reg = bp_reg_0[0:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2_icmp_8_0_op0[2:0] = loops_1000_loop2_23[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_loop2_icmp_8_0 = (loops_1000_loop2_icmp_8_0_op0 < loops_1000_loop2_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2_add_8_8_0_op0[7:0] = loops_1000_loop2_12_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_loop2_add_8_8_0[7:0] = (loops_1000_loop2_add_8_8_0_op0 + loops_1000_loop2_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2_mul_8_8_0_op0[7:0] = arg_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2_mul_8_8_0_op1[7:0] = arg_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2_mul_8_8_0[7:0] = (loops_1000_loop2_mul_8_8_0_op0 * loops_1000_loop2_mul_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2_and_8_8_0_op0[7:0] = loops_1000_loop2_17[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2_and_8_8_0_op1[7:0] = loops_1000_loop2_17[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2_and_8_8_0[7:0] = (loops_1000_loop2_and_8_8_0_op0 & loops_1000_loop2_and_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2_or_32_32_0_op0[31:0] = arg_4[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2_or_32_32_0_op1[31:0] = arg_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2_or_32_32_0[31:0] = (loops_1000_loop2_or_32_32_0_op0 | loops_1000_loop2_or_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2_add_16_16_0_op0[15:0] = arg_2[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2_add_16_16_0_op1[15:0] = arg_2[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2_add_16_16_0[15:0] = (loops_1000_loop2_add_16_16_0_op0 + loops_1000_loop2_add_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2_and_16_16_0_op0[15:0] = loops_1000_loop2_14[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2_and_16_16_0_op1[15:0] = loops_1000_loop2_14[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2_and_16_16_0[15:0] = (loops_1000_loop2_and_16_16_0_op0 & loops_1000_loop2_and_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit2_icmp_8_0_op0[2:0] = loops_1000_exit2_25[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit2_icmp_8_0 = (loops_1000_exit2_icmp_8_0_op0 < loops_1000_exit2_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit2_add_8_8_0_op0[7:0] = loops_1000_loop1_10_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit2_add_8_8_0[7:0] = (loops_1000_exit2_add_8_8_0_op0 + loops_1000_exit2_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit1_icmp_8_0_op0[2:0] = loops_1000_exit1_27[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit1_icmp_8_0 = (loops_1000_exit1_icmp_8_0_op0 < loops_1000_exit1_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit1_add_8_8_0_op0[7:0] = loops_1000_loop0_8_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit1_add_8_8_0[7:0] = (loops_1000_exit1_add_8_8_0_op0 + loops_1000_exit1_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_7_S_0)) begin
+		loops_1000_loop23_or_8_8_0_op0[7:0] = loops_1000_loop2_18_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_1000_BB_7_S_1)) */ begin
+		loops_1000_loop23_or_8_8_0_op0[7:0] = loops_1000_loop2_17_reg[7:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_7_S_0)) begin
+		loops_1000_loop23_or_8_8_0_op1[7:0] = arg_1[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_1000_BB_7_S_1)) */ begin
+		loops_1000_loop23_or_8_8_0_op1[7:0] = arg_1[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop23_or_8_8_0[7:0] = (loops_1000_loop23_or_8_8_0_op0 | loops_1000_loop23_or_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop23_add_8_8_0_op0[7:0] = arg_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop23_add_8_8_0_op1[7:0] = arg_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop23_add_8_8_0[7:0] = (loops_1000_loop23_add_8_8_0_op0 + loops_1000_loop23_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_7_S_0)) begin
+		loops_1000_loop23_add_8_8_1_op0[7:0] = loops_1000_loop2_18_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_1000_BB_7_S_1)) */ begin
+		loops_1000_loop23_add_8_8_1_op0[7:0] = loops_1000_loop23_33_reg[1:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_7_S_0)) begin
+		loops_1000_loop23_add_8_8_1_op1[7:0] = loops_1000_loop2_18_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_1000_BB_7_S_1)) */ begin
+		loops_1000_loop23_add_8_8_1_op1[7:0] = 32'd1;
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop23_add_8_8_1[7:0] = (loops_1000_loop23_add_8_8_1_op0 + loops_1000_loop23_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop23_add_16_16_0_op0[15:0] = arg_3[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop23_add_16_16_0_op1[15:0] = arg_2[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop23_add_16_16_0[15:0] = (loops_1000_loop23_add_16_16_0_op0 + loops_1000_loop23_add_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop23_icmp_8_0_op0[2:0] = loops_1000_loop23_44[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop23_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_loop23_icmp_8_0 = (loops_1000_loop23_icmp_8_0_op0 < loops_1000_loop23_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit24_icmp_8_0_op0[2:0] = loops_1000_exit24_46[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit24_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit24_icmp_8_0 = (loops_1000_exit24_icmp_8_0_op0 < loops_1000_exit24_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit24_add_8_8_1_op0[7:0] = loops_1000_loop12_31_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit24_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit24_add_8_8_1[7:0] = (loops_1000_exit24_add_8_8_1_op0 + loops_1000_exit24_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit15_icmp_8_0_op0[2:0] = loops_1000_exit15_48[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit15_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit15_icmp_8_0 = (loops_1000_exit15_icmp_8_0_op0 < loops_1000_exit15_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit15_add_8_8_0_op0[7:0] = loops_1000_loop01_29_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit15_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit15_add_8_8_0[7:0] = (loops_1000_exit15_add_8_8_0_op0 + loops_1000_exit15_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop29_icmp_8_0_op0[2:0] = loops_1000_loop29_65[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop29_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_loop29_icmp_8_0 = (loops_1000_loop29_icmp_8_0_op0 < loops_1000_loop29_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop29_add_8_8_1_op0[7:0] = loops_1000_loop29_54_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_loop29_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_loop29_add_8_8_1[7:0] = (loops_1000_loop29_add_8_8_1_op0 + loops_1000_loop29_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_12_S_0)) begin
+		loops_1000_loop29_and_32_32_0_op0[31:0] = loops_1000_loop29_57[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_1000_BB_12_S_1)) */ begin
+		loops_1000_loop29_and_32_32_0_op0[31:0] = loops_1000_loop29_57_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_12_S_0)) begin
+		loops_1000_loop29_and_32_32_0_op1[31:0] = arg_4[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_1000_BB_12_S_1)) */ begin
+		loops_1000_loop29_and_32_32_0_op1[31:0] = loops_1000_loop2_15_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop29_and_32_32_0[31:0] = (loops_1000_loop29_and_32_32_0_op0 & loops_1000_loop29_and_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop29_and_16_16_0_op0[15:0] = arg_3[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop29_and_16_16_0_op1[15:0] = loops_1000_loop23_38_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop29_and_16_16_0[15:0] = (loops_1000_loop29_and_16_16_0_op0 & loops_1000_loop29_and_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit210_icmp_8_0_op0[2:0] = loops_1000_exit210_67[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit210_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit210_icmp_8_0 = (loops_1000_exit210_icmp_8_0_op0 < loops_1000_exit210_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit210_add_8_8_0_op0[7:0] = loops_1000_loop18_52_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit210_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit210_add_8_8_0[7:0] = (loops_1000_exit210_add_8_8_0_op0 + loops_1000_exit210_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit111_icmp_8_0_op0[2:0] = loops_1000_exit111_69[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit111_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit111_icmp_8_0 = (loops_1000_exit111_icmp_8_0_op0 < loops_1000_exit111_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit111_add_8_8_1_op0[7:0] = loops_1000_loop07_50_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit111_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit111_add_8_8_1[7:0] = (loops_1000_exit111_add_8_8_1_op0 + loops_1000_exit111_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop215_icmp_8_0_op0[2:0] = loops_1000_loop215_86[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop215_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_loop215_icmp_8_0 = (loops_1000_loop215_icmp_8_0_op0 < loops_1000_loop215_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop215_add_8_8_0_op0[7:0] = loops_1000_loop215_75_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_loop215_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_loop215_add_8_8_0[7:0] = (loops_1000_loop215_add_8_8_0_op0 + loops_1000_loop215_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop215_mul_8_8_0_op0[7:0] = arg_1[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop215_mul_8_8_0_op1[7:0] = loops_1000_loop23_39_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop215_mul_8_8_0[7:0] = (loops_1000_loop215_mul_8_8_0_op0 * loops_1000_loop215_mul_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop215_add_16_16_0_op0[15:0] = arg_2[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop215_add_16_16_0_op1[15:0] = loops_1000_loop2_20_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop215_add_16_16_0[15:0] = (loops_1000_loop215_add_16_16_0_op0 + loops_1000_loop215_add_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop215_mul_16_16_0_op0[15:0] = loops_1000_loop215_80[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop215_mul_16_16_0_op1[15:0] = loops_1000_loop215_82[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop215_mul_16_16_0[15:0] = (loops_1000_loop215_mul_16_16_0_op0 * loops_1000_loop215_mul_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit216_icmp_8_0_op0[2:0] = loops_1000_exit216_88[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit216_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit216_icmp_8_0 = (loops_1000_exit216_icmp_8_0_op0 < loops_1000_exit216_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit216_add_8_8_1_op0[7:0] = loops_1000_loop114_73_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit216_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit216_add_8_8_1[7:0] = (loops_1000_exit216_add_8_8_1_op0 + loops_1000_exit216_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit117_icmp_8_0_op0[2:0] = loops_1000_exit117_90[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit117_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit117_icmp_8_0 = (loops_1000_exit117_icmp_8_0_op0 < loops_1000_exit117_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit117_add_8_8_0_op0[7:0] = loops_1000_loop013_71_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit117_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit117_add_8_8_0[7:0] = (loops_1000_exit117_add_8_8_0_op0 + loops_1000_exit117_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop221_icmp_8_0_op0[2:0] = loops_1000_loop221_107[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop221_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_loop221_icmp_8_0 = (loops_1000_loop221_icmp_8_0_op0 < loops_1000_loop221_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop221_add_8_8_1_op0[7:0] = loops_1000_loop215_82_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop221_add_8_8_1_op1[7:0] = loops_1000_loop221_100[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop221_add_8_8_1[7:0] = (loops_1000_loop221_add_8_8_1_op0 + loops_1000_loop221_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop221_add_8_8_0_op0[7:0] = loops_1000_loop221_96_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_loop221_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_loop221_add_8_8_0[7:0] = (loops_1000_loop221_add_8_8_0_op0 + loops_1000_loop221_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_22_S_0)) begin
+		loops_1000_loop221_and_8_8_0_op0[7:0] = loops_1000_loop2_18_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_1000_BB_22_S_1)) */ begin
+		loops_1000_loop221_and_8_8_0_op0[7:0] = loops_1000_loop23_42_reg[7:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_22_S_0)) begin
+		loops_1000_loop221_and_8_8_0_op1[7:0] = loops_1000_loop2_18_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_1000_BB_22_S_1)) */ begin
+		loops_1000_loop221_and_8_8_0_op1[7:0] = loops_1000_loop2_21_reg[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop221_and_8_8_0[7:0] = (loops_1000_loop221_and_8_8_0_op0 & loops_1000_loop221_and_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit222_icmp_8_0_op0[2:0] = loops_1000_exit222_109[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit222_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit222_icmp_8_0 = (loops_1000_exit222_icmp_8_0_op0 < loops_1000_exit222_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit222_add_8_8_0_op0[7:0] = loops_1000_loop120_94_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit222_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit222_add_8_8_0[7:0] = (loops_1000_exit222_add_8_8_0_op0 + loops_1000_exit222_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit123_icmp_8_0_op0[2:0] = loops_1000_exit123_111[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit123_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit123_icmp_8_0 = (loops_1000_exit123_icmp_8_0_op0 < loops_1000_exit123_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit123_add_8_8_1_op0[7:0] = loops_1000_loop019_92_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit123_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit123_add_8_8_1[7:0] = (loops_1000_exit123_add_8_8_1_op0 + loops_1000_exit123_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop227_or_8_8_0_op0[7:0] = loops_1000_loop23_39_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop227_or_8_8_0_op1[7:0] = loops_1000_loop221_102_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop227_or_8_8_0[7:0] = (loops_1000_loop227_or_8_8_0_op0 | loops_1000_loop227_or_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop227_icmp_8_0_op0[2:0] = loops_1000_loop227_128[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop227_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_loop227_icmp_8_0 = (loops_1000_loop227_icmp_8_0_op0 < loops_1000_loop227_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop227_add_8_8_0_op0[7:0] = loops_1000_loop227_117_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_loop227_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_loop227_add_8_8_0[7:0] = (loops_1000_loop227_add_8_8_0_op0 + loops_1000_loop227_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop227_or_32_32_0_op0[31:0] = loops_1000_loop221_101_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop227_or_32_32_0_op1[31:0] = loops_1000_loop29_59_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop227_or_32_32_0[31:0] = (loops_1000_loop227_or_32_32_0_op0 | loops_1000_loop227_or_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop227_and_16_16_0_op0[15:0] = loops_1000_loop23_38_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop227_and_16_16_0_op1[15:0] = loops_1000_loop215_80_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop227_and_16_16_0[15:0] = (loops_1000_loop227_and_16_16_0_op0 & loops_1000_loop227_and_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit228_icmp_8_0_op0[2:0] = loops_1000_exit228_130[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit228_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit228_icmp_8_0 = (loops_1000_exit228_icmp_8_0_op0 < loops_1000_exit228_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit228_add_8_8_1_op0[7:0] = loops_1000_loop126_115_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit228_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit228_add_8_8_1[7:0] = (loops_1000_exit228_add_8_8_1_op0 + loops_1000_exit228_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit129_icmp_8_0_op0[2:0] = loops_1000_exit129_132[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit129_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit129_icmp_8_0 = (loops_1000_exit129_icmp_8_0_op0 < loops_1000_exit129_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit129_add_8_8_0_op0[7:0] = loops_1000_loop025_113_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit129_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit129_add_8_8_0[7:0] = (loops_1000_exit129_add_8_8_0_op0 + loops_1000_exit129_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop233_add_8_8_0_op0[7:0] = loops_1000_loop23_42_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop233_add_8_8_0_op1[7:0] = loops_1000_loop221_102_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop233_add_8_8_0[7:0] = (loops_1000_loop233_add_8_8_0_op0 + loops_1000_loop233_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_32_S_0)) begin
+		loops_1000_loop233_add_8_8_1_op0[7:0] = loops_1000_loop221_104_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_1000_BB_32_S_1)) */ begin
+		loops_1000_loop233_add_8_8_1_op0[7:0] = loops_1000_loop233_138_reg[1:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_32_S_0)) begin
+		loops_1000_loop233_add_8_8_1_op1[7:0] = loops_1000_loop221_100_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_1000_BB_32_S_1)) */ begin
+		loops_1000_loop233_add_8_8_1_op1[7:0] = 32'd1;
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop233_add_8_8_1[7:0] = (loops_1000_loop233_add_8_8_1_op0 + loops_1000_loop233_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop233_and_32_32_0_op0[31:0] = loops_1000_loop29_59_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop233_and_32_32_0_op1[31:0] = loops_1000_loop29_63_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop233_and_32_32_0[31:0] = (loops_1000_loop233_and_32_32_0_op0 & loops_1000_loop233_and_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop233_and_8_8_0_op0[7:0] = loops_1000_loop233_140[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop233_and_8_8_0_op1[7:0] = loops_1000_loop215_77_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop233_and_8_8_0[7:0] = (loops_1000_loop233_and_8_8_0_op0 & loops_1000_loop233_and_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop233_add_16_16_0_op0[15:0] = loops_1000_loop215_80_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop233_add_16_16_0_op1[15:0] = loops_1000_loop23_38_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop233_add_16_16_0[15:0] = (loops_1000_loop233_add_16_16_0_op0 + loops_1000_loop233_add_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop233_icmp_8_0_op0[2:0] = loops_1000_loop233_149[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop233_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_loop233_icmp_8_0 = (loops_1000_loop233_icmp_8_0_op0 < loops_1000_loop233_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit234_icmp_8_0_op0[2:0] = loops_1000_exit234_151[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit234_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit234_icmp_8_0 = (loops_1000_exit234_icmp_8_0_op0 < loops_1000_exit234_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit234_add_8_8_1_op0[7:0] = loops_1000_loop132_136_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit234_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit234_add_8_8_1[7:0] = (loops_1000_exit234_add_8_8_1_op0 + loops_1000_exit234_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit135_icmp_8_0_op0[2:0] = loops_1000_exit135_153[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit135_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit135_icmp_8_0 = (loops_1000_exit135_icmp_8_0_op0 < loops_1000_exit135_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit135_add_8_8_0_op0[7:0] = loops_1000_loop031_134_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit135_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit135_add_8_8_0[7:0] = (loops_1000_exit135_add_8_8_0_op0 + loops_1000_exit135_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop239_icmp_8_0_op0[2:0] = loops_1000_loop239_170[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop239_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_loop239_icmp_8_0 = (loops_1000_loop239_icmp_8_0_op0 < loops_1000_loop239_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop239_add_8_8_1_op0[7:0] = loops_1000_loop239_159_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_loop239_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_loop239_add_8_8_1[7:0] = (loops_1000_loop239_add_8_8_1_op0 + loops_1000_loop239_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_37_S_0)) begin
+		loops_1000_loop239_mul_32_32_0_op0[31:0] = loops_1000_loop233_147_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_loops_1000_BB_37_S_1)) begin
+		loops_1000_loop239_mul_32_32_0_op0[31:0] = loops_1000_loop233_145_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_1000_BB_37_S_2)) */ begin
+		loops_1000_loop239_mul_32_32_0_op0[31:0] = loops_1000_loop227_125_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_37_S_0)) begin
+		loops_1000_loop239_mul_32_32_0_op1[31:0] = loops_1000_loop233_145_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_loops_1000_BB_37_S_1)) begin
+		loops_1000_loop239_mul_32_32_0_op1[31:0] = loops_1000_loop233_147_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_1000_BB_37_S_2)) */ begin
+		loops_1000_loop239_mul_32_32_0_op1[31:0] = loops_1000_loop227_125_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop239_mul_32_32_0[31:0] = (loops_1000_loop239_mul_32_32_0_op0 * loops_1000_loop239_mul_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop239_mul_8_8_0_op0[7:0] = loops_1000_loop215_82_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop239_mul_8_8_0_op1[7:0] = loops_1000_loop215_82_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop239_mul_8_8_0[7:0] = (loops_1000_loop239_mul_8_8_0_op0 * loops_1000_loop239_mul_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop239_and_32_32_0_op0[31:0] = loops_1000_loop227_125_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop239_and_32_32_0_op1[31:0] = loops_1000_loop227_121_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop239_and_32_32_0[31:0] = (loops_1000_loop239_and_32_32_0_op0 & loops_1000_loop239_and_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit240_icmp_8_0_op0[2:0] = loops_1000_exit240_172[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit240_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit240_icmp_8_0 = (loops_1000_exit240_icmp_8_0_op0 < loops_1000_exit240_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit240_add_8_8_0_op0[7:0] = loops_1000_loop138_157_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit240_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit240_add_8_8_0[7:0] = (loops_1000_exit240_add_8_8_0_op0 + loops_1000_exit240_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit141_icmp_8_0_op0[2:0] = loops_1000_exit141_174[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit141_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit141_icmp_8_0 = (loops_1000_exit141_icmp_8_0_op0 < loops_1000_exit141_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit141_add_8_8_1_op0[7:0] = loops_1000_loop037_155_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit141_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit141_add_8_8_1[7:0] = (loops_1000_exit141_add_8_8_1_op0 + loops_1000_exit141_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop245_icmp_8_0_op0[2:0] = loops_1000_loop245_191[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop245_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_loop245_icmp_8_0 = (loops_1000_loop245_icmp_8_0_op0 < loops_1000_loop245_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop245_add_8_8_0_op0[7:0] = loops_1000_loop245_180_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_loop245_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_loop245_add_8_8_0[7:0] = (loops_1000_loop245_add_8_8_0_op0 + loops_1000_loop245_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop245_and_32_32_0_op0[31:0] = loops_1000_loop233_147_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop245_and_32_32_0_op1[31:0] = loops_1000_loop233_145_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop245_and_32_32_0[31:0] = (loops_1000_loop245_and_32_32_0_op0 & loops_1000_loop245_and_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop245_and_8_8_0_op0[7:0] = loops_1000_loop233_140_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop245_and_8_8_0_op1[7:0] = loops_1000_loop233_143_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop245_and_8_8_0[7:0] = (loops_1000_loop245_and_8_8_0_op0 & loops_1000_loop245_and_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop245_or_16_16_0_op0[15:0] = loops_1000_loop245_182[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop245_or_16_16_0_op1[15:0] = loops_1000_loop227_119_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop245_or_16_16_0[15:0] = (loops_1000_loop245_or_16_16_0_op0 | loops_1000_loop245_or_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop245_add_16_16_0_op0[15:0] = loops_1000_loop233_142_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop245_add_16_16_0_op1[15:0] = loops_1000_loop23_38_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop245_add_16_16_0[15:0] = (loops_1000_loop245_add_16_16_0_op0 + loops_1000_loop245_add_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop245_add_16_16_1_op0[15:0] = loops_1000_loop227_119_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop245_add_16_16_1_op1[15:0] = loops_1000_loop215_80_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop245_add_16_16_1[15:0] = (loops_1000_loop245_add_16_16_1_op0 + loops_1000_loop245_add_16_16_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop245_mul_16_16_0_op0[15:0] = loops_1000_loop245_182[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop245_mul_16_16_0_op1[15:0] = loops_1000_loop245_183[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop245_mul_16_16_0[15:0] = (loops_1000_loop245_mul_16_16_0_op0 * loops_1000_loop245_mul_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit246_icmp_8_0_op0[2:0] = loops_1000_exit246_193[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit246_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit246_icmp_8_0 = (loops_1000_exit246_icmp_8_0_op0 < loops_1000_exit246_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit246_add_8_8_1_op0[7:0] = loops_1000_loop144_178_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit246_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit246_add_8_8_1[7:0] = (loops_1000_exit246_add_8_8_1_op0 + loops_1000_exit246_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit147_icmp_8_0_op0[2:0] = loops_1000_exit147_195[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit147_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit147_icmp_8_0 = (loops_1000_exit147_icmp_8_0_op0 < loops_1000_exit147_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit147_add_8_8_0_op0[7:0] = loops_1000_loop043_176_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit147_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit147_add_8_8_0[7:0] = (loops_1000_exit147_add_8_8_0_op0 + loops_1000_exit147_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop251_icmp_8_0_op0[2:0] = loops_1000_loop251_212[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop251_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_loop251_icmp_8_0 = (loops_1000_loop251_icmp_8_0_op0 < loops_1000_loop251_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop251_add_8_8_1_op0[7:0] = loops_1000_loop251_201_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_loop251_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_loop251_add_8_8_1[7:0] = (loops_1000_loop251_add_8_8_1_op0 + loops_1000_loop251_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop251_or_16_16_0_op0[15:0] = loops_1000_loop227_126_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop251_or_16_16_0_op1[15:0] = loops_1000_loop245_188_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop251_or_16_16_0[15:0] = (loops_1000_loop251_or_16_16_0_op0 | loops_1000_loop251_or_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop251_add_16_16_1_op0[15:0] = loops_1000_loop245_183_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop251_add_16_16_1_op1[15:0] = loops_1000_loop251_204[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop251_add_16_16_1[15:0] = (loops_1000_loop251_add_16_16_1_op0 + loops_1000_loop251_add_16_16_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop251_mul_16_16_0_op0[15:0] = loops_1000_loop245_188_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop251_mul_16_16_0_op1[15:0] = loops_1000_loop245_184_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop251_mul_16_16_0[15:0] = (loops_1000_loop251_mul_16_16_0_op0 * loops_1000_loop251_mul_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit252_icmp_8_0_op0[2:0] = loops_1000_exit252_214[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit252_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit252_icmp_8_0 = (loops_1000_exit252_icmp_8_0_op0 < loops_1000_exit252_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit252_add_8_8_0_op0[7:0] = loops_1000_loop150_199_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit252_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit252_add_8_8_0[7:0] = (loops_1000_exit252_add_8_8_0_op0 + loops_1000_exit252_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit153_icmp_8_0_op0[2:0] = loops_1000_exit153_216[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit153_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit153_icmp_8_0 = (loops_1000_exit153_icmp_8_0_op0 < loops_1000_exit153_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit153_add_8_8_1_op0[7:0] = loops_1000_loop049_197_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit153_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit153_add_8_8_1[7:0] = (loops_1000_exit153_add_8_8_1_op0 + loops_1000_exit153_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop257_icmp_8_0_op0[2:0] = loops_1000_loop257_233[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop257_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_loop257_icmp_8_0 = (loops_1000_loop257_icmp_8_0_op0 < loops_1000_loop257_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop257_add_8_8_0_op0[7:0] = loops_1000_loop257_222_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_loop257_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_loop257_add_8_8_0[7:0] = (loops_1000_loop257_add_8_8_0_op0 + loops_1000_loop257_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop257_and_8_8_0_op0[7:0] = loops_1000_loop233_143_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop257_and_8_8_0_op1[7:0] = loops_1000_loop233_143_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop257_and_8_8_0[7:0] = (loops_1000_loop257_and_8_8_0_op0 & loops_1000_loop257_and_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop257_or_32_32_0_op0[31:0] = loops_1000_loop233_147_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop257_or_32_32_0_op1[31:0] = loops_1000_loop239_166_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop257_or_32_32_0[31:0] = (loops_1000_loop257_or_32_32_0_op0 | loops_1000_loop257_or_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop257_mul_16_16_0_op0[15:0] = loops_1000_loop245_188_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop257_mul_16_16_0_op1[15:0] = loops_1000_loop251_205_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop257_mul_16_16_0[15:0] = (loops_1000_loop257_mul_16_16_0_op0 * loops_1000_loop257_mul_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit258_icmp_8_0_op0[2:0] = loops_1000_exit258_235[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit258_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit258_icmp_8_0 = (loops_1000_exit258_icmp_8_0_op0 < loops_1000_exit258_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit258_add_8_8_1_op0[7:0] = loops_1000_loop156_220_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit258_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit258_add_8_8_1[7:0] = (loops_1000_exit258_add_8_8_1_op0 + loops_1000_exit258_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit159_icmp_8_0_op0[2:0] = loops_1000_exit159_237[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit159_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit159_icmp_8_0 = (loops_1000_exit159_icmp_8_0_op0 < loops_1000_exit159_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit159_add_8_8_0_op0[7:0] = loops_1000_loop055_218_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit159_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit159_add_8_8_0[7:0] = (loops_1000_exit159_add_8_8_0_op0 + loops_1000_exit159_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop263_icmp_8_0_op0[2:0] = loops_1000_loop263_254[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop263_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_loop263_icmp_8_0 = (loops_1000_loop263_icmp_8_0_op0 < loops_1000_loop263_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop263_add_8_8_1_op0[7:0] = loops_1000_loop233_146_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop263_add_8_8_1_op1[7:0] = loops_1000_loop251_210_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop263_add_8_8_1[7:0] = (loops_1000_loop263_add_8_8_1_op0 + loops_1000_loop263_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop263_add_8_8_0_op0[7:0] = loops_1000_loop263_243_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_loop263_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_loop263_add_8_8_0[7:0] = (loops_1000_loop263_add_8_8_0_op0 + loops_1000_loop263_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop263_mul_8_8_0_op0[7:0] = loops_1000_loop251_206_reg;
+end
+
+always @ (*) begin
+	loops_1000_loop263_mul_8_8_0_op1[7:0] = loops_1000_loop245_185_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop263_mul_8_8_0[7:0] = (loops_1000_loop263_mul_8_8_0_op0 * loops_1000_loop263_mul_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop263_add_16_16_1_op0[15:0] = loops_1000_loop251_204_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop263_add_16_16_1_op1[15:0] = loops_1000_loop251_208_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop263_add_16_16_1[15:0] = (loops_1000_loop263_add_16_16_1_op0 + loops_1000_loop263_add_16_16_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit264_icmp_8_0_op0[2:0] = loops_1000_exit264_256[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit264_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit264_icmp_8_0 = (loops_1000_exit264_icmp_8_0_op0 < loops_1000_exit264_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit264_add_8_8_0_op0[7:0] = loops_1000_loop162_241_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit264_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit264_add_8_8_0[7:0] = (loops_1000_exit264_add_8_8_0_op0 + loops_1000_exit264_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit165_icmp_8_0_op0[2:0] = loops_1000_exit165_258[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit165_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit165_icmp_8_0 = (loops_1000_exit165_icmp_8_0_op0 < loops_1000_exit165_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit165_add_8_8_1_op0[7:0] = loops_1000_loop061_239_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit165_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit165_add_8_8_1[7:0] = (loops_1000_exit165_add_8_8_1_op0 + loops_1000_exit165_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop269_or_8_8_0_op0[7:0] = loops_1000_loop251_206_reg;
+end
+
+always @ (*) begin
+	loops_1000_loop269_or_8_8_0_op1[7:0] = loops_1000_loop263_249_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop269_or_8_8_0[7:0] = (loops_1000_loop269_or_8_8_0_op0 | loops_1000_loop269_or_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop269_icmp_8_0_op0[2:0] = loops_1000_loop269_275[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop269_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_loop269_icmp_8_0 = (loops_1000_loop269_icmp_8_0_op0 < loops_1000_loop269_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop269_add_8_8_0_op0[7:0] = loops_1000_loop269_264_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_loop269_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_loop269_add_8_8_0[7:0] = (loops_1000_loop269_add_8_8_0_op0 + loops_1000_loop269_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop269_add_32_32_0_op0[31:0] = loops_1000_loop245_187_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop269_add_32_32_0_op1[31:0] = loops_1000_loop257_226_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop269_add_32_32_0[31:0] = (loops_1000_loop269_add_32_32_0_op0 + loops_1000_loop269_add_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop269_or_32_32_0_op0[31:0] = loops_1000_loop239_165_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop269_or_32_32_0_op1[31:0] = loops_1000_loop257_230_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop269_or_32_32_0[31:0] = (loops_1000_loop269_or_32_32_0_op0 | loops_1000_loop269_or_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop269_add_16_16_0_op0[15:0] = loops_1000_loop257_229_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop269_add_16_16_0_op1[15:0] = loops_1000_loop257_224_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop269_add_16_16_0[15:0] = (loops_1000_loop269_add_16_16_0_op0 + loops_1000_loop269_add_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit270_icmp_8_0_op0[2:0] = loops_1000_exit270_277[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit270_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit270_icmp_8_0 = (loops_1000_exit270_icmp_8_0_op0 < loops_1000_exit270_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit270_add_8_8_1_op0[7:0] = loops_1000_loop168_262_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit270_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit270_add_8_8_1[7:0] = (loops_1000_exit270_add_8_8_1_op0 + loops_1000_exit270_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit171_icmp_8_0_op0[2:0] = loops_1000_exit171_279[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit171_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit171_icmp_8_0 = (loops_1000_exit171_icmp_8_0_op0 < loops_1000_exit171_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit171_add_8_8_0_op0[7:0] = loops_1000_loop067_260_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit171_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit171_add_8_8_0[7:0] = (loops_1000_exit171_add_8_8_0_op0 + loops_1000_exit171_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop275_icmp_8_0_op0[2:0] = loops_1000_loop275_296[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop275_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_loop275_icmp_8_0 = (loops_1000_loop275_icmp_8_0_op0 < loops_1000_loop275_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop275_add_8_8_1_op0[7:0] = loops_1000_loop275_285_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_loop275_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_loop275_add_8_8_1[7:0] = (loops_1000_loop275_add_8_8_1_op0 + loops_1000_loop275_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop275_mul_8_8_0_op0[7:0] = loops_1000_loop269_266_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop275_mul_8_8_0_op1[7:0] = loops_1000_loop269_266_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop275_mul_8_8_0[7:0] = (loops_1000_loop275_mul_8_8_0_op0 * loops_1000_loop275_mul_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop275_add_16_16_1_op0[15:0] = loops_1000_loop275_287[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop275_add_16_16_1_op1[15:0] = loops_1000_loop275_287[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop275_add_16_16_1[15:0] = (loops_1000_loop275_add_16_16_1_op0 + loops_1000_loop275_add_16_16_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop275_mul_16_16_0_op0[15:0] = loops_1000_loop275_291[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop275_mul_16_16_0_op1[15:0] = loops_1000_loop269_268_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop275_mul_16_16_0[15:0] = (loops_1000_loop275_mul_16_16_0_op0 * loops_1000_loop275_mul_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit276_icmp_8_0_op0[2:0] = loops_1000_exit276_298[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit276_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit276_icmp_8_0 = (loops_1000_exit276_icmp_8_0_op0 < loops_1000_exit276_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit276_add_8_8_0_op0[7:0] = loops_1000_loop174_283_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit276_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit276_add_8_8_0[7:0] = (loops_1000_exit276_add_8_8_0_op0 + loops_1000_exit276_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit177_icmp_8_0_op0[2:0] = loops_1000_exit177_300[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit177_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit177_icmp_8_0 = (loops_1000_exit177_icmp_8_0_op0 < loops_1000_exit177_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit177_add_8_8_1_op0[7:0] = loops_1000_loop073_281_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit177_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit177_add_8_8_1[7:0] = (loops_1000_exit177_add_8_8_1_op0 + loops_1000_exit177_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop281_icmp_8_0_op0[2:0] = loops_1000_loop281_317[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop281_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_loop281_icmp_8_0 = (loops_1000_loop281_icmp_8_0_op0 < loops_1000_loop281_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_72_S_0)) begin
+		loops_1000_loop281_add_8_8_0_op0[7:0] = loops_1000_loop263_249_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_1000_BB_72_S_1)) */ begin
+		loops_1000_loop281_add_8_8_0_op0[7:0] = loops_1000_loop281_313[7:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_72_S_0)) begin
+		loops_1000_loop281_add_8_8_0_op1[7:0] = loops_1000_loop269_266_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_1000_BB_72_S_1)) */ begin
+		loops_1000_loop281_add_8_8_0_op1[7:0] = loops_1000_loop275_289_reg[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop281_add_8_8_0[7:0] = (loops_1000_loop281_add_8_8_0_op0 + loops_1000_loop281_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_72_S_0)) begin
+		loops_1000_loop281_add_8_8_1_op0[7:0] = loops_1000_loop281_306_reg[1:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_1000_BB_72_S_1)) */ begin
+		loops_1000_loop281_add_8_8_1_op0[7:0] = loops_1000_loop275_293_reg[7:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_72_S_0)) begin
+		loops_1000_loop281_add_8_8_1_op1[7:0] = 32'd1;
+	end
+	else /* if ((cur_state == BPHLS_F_loops_1000_BB_72_S_1)) */ begin
+		loops_1000_loop281_add_8_8_1_op1[7:0] = loops_1000_loop281_309_reg[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop281_add_8_8_1[7:0] = (loops_1000_loop281_add_8_8_1_op0 + loops_1000_loop281_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_72_S_0)) begin
+		loops_1000_loop281_add_32_32_0_op0[31:0] = loops_1000_loop257_230_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_1000_BB_72_S_1)) */ begin
+		loops_1000_loop281_add_32_32_0_op0[31:0] = loops_1000_loop269_273_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_72_S_0)) begin
+		loops_1000_loop281_add_32_32_0_op1[31:0] = loops_1000_loop269_270_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_1000_BB_72_S_1)) */ begin
+		loops_1000_loop281_add_32_32_0_op1[31:0] = loops_1000_loop269_272_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop281_add_32_32_0[31:0] = (loops_1000_loop281_add_32_32_0_op0 + loops_1000_loop281_add_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop281_mul_8_8_0_op0[7:0] = loops_1000_loop263_252_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop281_mul_8_8_0_op1[7:0] = loops_1000_loop275_293_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop281_mul_8_8_0[7:0] = (loops_1000_loop281_mul_8_8_0_op0 * loops_1000_loop281_mul_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit282_icmp_8_0_op0[2:0] = loops_1000_exit282_319[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit282_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit282_icmp_8_0 = (loops_1000_exit282_icmp_8_0_op0 < loops_1000_exit282_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit282_add_8_8_1_op0[7:0] = loops_1000_loop180_304_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit282_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit282_add_8_8_1[7:0] = (loops_1000_exit282_add_8_8_1_op0 + loops_1000_exit282_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit183_icmp_8_0_op0[2:0] = loops_1000_exit183_321[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit183_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit183_icmp_8_0 = (loops_1000_exit183_icmp_8_0_op0 < loops_1000_exit183_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit183_add_8_8_0_op0[7:0] = loops_1000_loop079_302_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit183_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit183_add_8_8_0[7:0] = (loops_1000_exit183_add_8_8_0_op0 + loops_1000_exit183_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop287_or_8_8_0_op0[7:0] = loops_1000_loop287_335[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop287_or_8_8_0_op1[7:0] = loops_1000_loop281_313_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop287_or_8_8_0[7:0] = (loops_1000_loop287_or_8_8_0_op0 | loops_1000_loop287_or_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop287_icmp_8_0_op0[2:0] = loops_1000_loop287_338[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop287_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_loop287_icmp_8_0 = (loops_1000_loop287_icmp_8_0_op0 < loops_1000_loop287_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop287_add_8_8_1_op0[7:0] = loops_1000_loop281_309_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop287_add_8_8_1_op1[7:0] = loops_1000_loop275_293_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop287_add_8_8_1[7:0] = (loops_1000_loop287_add_8_8_1_op0 + loops_1000_loop287_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop287_add_8_8_0_op0[7:0] = loops_1000_loop287_327_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_loop287_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_loop287_add_8_8_0[7:0] = (loops_1000_loop287_add_8_8_0_op0 + loops_1000_loop287_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_77_S_0)) begin
+		loops_1000_loop287_add_32_32_0_op0[31:0] = loops_1000_loop281_315_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_1000_BB_77_S_1)) */ begin
+		loops_1000_loop287_add_32_32_0_op0[31:0] = loops_1000_loop269_270_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_77_S_0)) begin
+		loops_1000_loop287_add_32_32_0_op1[31:0] = loops_1000_loop275_294_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_1000_BB_77_S_1)) */ begin
+		loops_1000_loop287_add_32_32_0_op1[31:0] = loops_1000_loop281_311_reg[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop287_add_32_32_0[31:0] = (loops_1000_loop287_add_32_32_0_op0 + loops_1000_loop287_add_32_32_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_77_S_0)) begin
+		loops_1000_loop287_mul_32_32_0_op0[31:0] = loops_1000_loop269_270_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_1000_BB_77_S_1)) */ begin
+		loops_1000_loop287_mul_32_32_0_op0[31:0] = loops_1000_loop287_330_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_77_S_0)) begin
+		loops_1000_loop287_mul_32_32_0_op1[31:0] = loops_1000_loop275_294_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_1000_BB_77_S_1)) */ begin
+		loops_1000_loop287_mul_32_32_0_op1[31:0] = loops_1000_loop269_273_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop287_mul_32_32_0[31:0] = (loops_1000_loop287_mul_32_32_0_op0 * loops_1000_loop287_mul_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop287_add_16_16_0_op0[15:0] = loops_1000_loop269_271_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop287_add_16_16_0_op1[15:0] = loops_1000_loop275_292_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop287_add_16_16_0[15:0] = (loops_1000_loop287_add_16_16_0_op0 + loops_1000_loop287_add_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit288_icmp_8_0_op0[2:0] = loops_1000_exit288_340[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit288_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit288_icmp_8_0 = (loops_1000_exit288_icmp_8_0_op0 < loops_1000_exit288_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit288_add_8_8_1_op0[7:0] = loops_1000_loop186_325_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit288_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit288_add_8_8_1[7:0] = (loops_1000_exit288_add_8_8_1_op0 + loops_1000_exit288_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit189_icmp_8_0_op0[2:0] = loops_1000_exit189_342[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit189_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit189_icmp_8_0 = (loops_1000_exit189_icmp_8_0_op0 < loops_1000_exit189_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit189_add_8_8_1_op0[7:0] = loops_1000_loop085_323_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit189_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit189_add_8_8_1[7:0] = (loops_1000_exit189_add_8_8_1_op0 + loops_1000_exit189_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop293_icmp_8_0_op0[2:0] = loops_1000_loop293_359[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop293_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_loop293_icmp_8_0 = (loops_1000_loop293_icmp_8_0_op0 < loops_1000_loop293_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop293_add_8_8_0_op0[7:0] = loops_1000_loop293_348_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_loop293_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_loop293_add_8_8_0[7:0] = (loops_1000_loop293_add_8_8_0_op0 + loops_1000_loop293_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop293_add_32_32_0_op0[31:0] = loops_1000_loop281_315_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop293_add_32_32_0_op1[31:0] = loops_1000_loop287_334_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop293_add_32_32_0[31:0] = (loops_1000_loop293_add_32_32_0_op0 + loops_1000_loop293_add_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop293_mul_8_8_0_op0[7:0] = loops_1000_loop281_314_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop293_mul_8_8_0_op1[7:0] = loops_1000_loop287_336_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop293_mul_8_8_0[7:0] = (loops_1000_loop293_mul_8_8_0_op0 * loops_1000_loop293_mul_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop293_and_8_8_0_op0[7:0] = loops_1000_loop287_331_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop293_and_8_8_0_op1[7:0] = loops_1000_loop293_351[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop293_and_8_8_0[7:0] = (loops_1000_loop293_and_8_8_0_op0 & loops_1000_loop293_and_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop293_mul_16_16_0_op0[15:0] = loops_1000_loop275_287_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop293_mul_16_16_0_op1[15:0] = loops_1000_loop275_292_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop293_mul_16_16_0[15:0] = (loops_1000_loop293_mul_16_16_0_op0 * loops_1000_loop293_mul_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit294_icmp_8_0_op0[2:0] = loops_1000_exit294_361[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit294_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit294_icmp_8_0 = (loops_1000_exit294_icmp_8_0_op0 < loops_1000_exit294_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit294_add_8_8_1_op0[7:0] = loops_1000_loop192_346_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit294_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit294_add_8_8_1[7:0] = (loops_1000_exit294_add_8_8_1_op0 + loops_1000_exit294_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit195_icmp_8_0_op0[2:0] = loops_1000_exit195_363[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit195_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit195_icmp_8_0 = (loops_1000_exit195_icmp_8_0_op0 < loops_1000_exit195_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit195_add_8_8_0_op0[7:0] = loops_1000_loop091_344_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit195_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit195_add_8_8_0[7:0] = (loops_1000_exit195_add_8_8_0_op0 + loops_1000_exit195_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop299_icmp_8_0_op0[2:0] = loops_1000_loop299_380[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop299_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_loop299_icmp_8_0 = (loops_1000_loop299_icmp_8_0_op0 < loops_1000_loop299_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop299_add_8_8_1_op0[7:0] = loops_1000_loop299_369_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_loop299_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_loop299_add_8_8_1[7:0] = (loops_1000_loop299_add_8_8_1_op0 + loops_1000_loop299_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_87_S_0)) begin
+		loops_1000_loop299_add_32_32_0_op0[31:0] = loops_1000_loop287_330_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_1000_BB_87_S_1)) */ begin
+		loops_1000_loop299_add_32_32_0_op0[31:0] = loops_1000_loop287_332_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_87_S_0)) begin
+		loops_1000_loop299_add_32_32_0_op1[31:0] = loops_1000_loop287_330_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_1000_BB_87_S_1)) */ begin
+		loops_1000_loop299_add_32_32_0_op1[31:0] = loops_1000_loop293_355_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop299_add_32_32_0[31:0] = (loops_1000_loop299_add_32_32_0_op0 + loops_1000_loop299_add_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop299_and_8_8_0_op0[7:0] = loops_1000_loop281_309_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop299_and_8_8_0_op1[7:0] = loops_1000_loop287_331_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop299_and_8_8_0[7:0] = (loops_1000_loop299_and_8_8_0_op0 & loops_1000_loop299_and_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop299_add_16_16_1_op0[15:0] = loops_1000_loop275_290_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop299_add_16_16_1_op1[15:0] = loops_1000_loop287_331_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop299_add_16_16_1[15:0] = (loops_1000_loop299_add_16_16_1_op0 + loops_1000_loop299_add_16_16_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop299_and_16_16_0_op0[15:0] = loops_1000_loop275_291_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop299_and_16_16_0_op1[15:0] = loops_1000_loop281_312_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop299_and_16_16_0[15:0] = (loops_1000_loop299_and_16_16_0_op0 & loops_1000_loop299_and_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit2100_icmp_8_0_op0[2:0] = loops_1000_exit2100_382[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2100_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit2100_icmp_8_0 = (loops_1000_exit2100_icmp_8_0_op0 < loops_1000_exit2100_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit2100_add_8_8_0_op0[7:0] = loops_1000_loop198_367_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2100_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit2100_add_8_8_0[7:0] = (loops_1000_exit2100_add_8_8_0_op0 + loops_1000_exit2100_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit1101_icmp_8_0_op0[2:0] = loops_1000_exit1101_384[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1101_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit1101_icmp_8_0 = (loops_1000_exit1101_icmp_8_0_op0 < loops_1000_exit1101_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit1101_add_8_8_1_op0[7:0] = loops_1000_loop097_365_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1101_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit1101_add_8_8_1[7:0] = (loops_1000_exit1101_add_8_8_1_op0 + loops_1000_exit1101_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2105_or_8_8_0_op0[7:0] = loops_1000_loop281_313_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2105_or_8_8_0_op1[7:0] = loops_1000_loop293_351_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2105_or_8_8_0[7:0] = (loops_1000_loop2105_or_8_8_0_op0 | loops_1000_loop2105_or_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2105_icmp_8_0_op0[2:0] = loops_1000_loop2105_401[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2105_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_loop2105_icmp_8_0 = (loops_1000_loop2105_icmp_8_0_op0 < loops_1000_loop2105_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2105_add_8_8_0_op0[7:0] = loops_1000_loop2105_390_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2105_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_loop2105_add_8_8_0[7:0] = (loops_1000_loop2105_add_8_8_0_op0 + loops_1000_loop2105_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_92_S_0)) begin
+		loops_1000_loop2105_mul_32_32_0_op0[31:0] = loops_1000_loop293_353_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_1000_BB_92_S_1)) */ begin
+		loops_1000_loop2105_mul_32_32_0_op0[31:0] = loops_1000_loop2105_395_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_92_S_0)) begin
+		loops_1000_loop2105_mul_32_32_0_op1[31:0] = loops_1000_loop293_353_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_1000_BB_92_S_1)) */ begin
+		loops_1000_loop2105_mul_32_32_0_op1[31:0] = loops_1000_loop299_377_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2105_mul_32_32_0[31:0] = (loops_1000_loop2105_mul_32_32_0_op0 * loops_1000_loop2105_mul_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2105_mul_8_8_0_op0[7:0] = loops_1000_loop293_351_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2105_mul_8_8_0_op1[7:0] = loops_1000_loop281_314_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2105_mul_8_8_0[7:0] = (loops_1000_loop2105_mul_8_8_0_op0 * loops_1000_loop2105_mul_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2105_or_16_16_0_op0[15:0] = loops_1000_loop299_374_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2105_or_16_16_0_op1[15:0] = loops_1000_loop293_350_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2105_or_16_16_0[15:0] = (loops_1000_loop2105_or_16_16_0_op0 | loops_1000_loop2105_or_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2105_add_16_16_0_op0[15:0] = loops_1000_loop299_378_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2105_add_16_16_0_op1[15:0] = loops_1000_loop287_329_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2105_add_16_16_0[15:0] = (loops_1000_loop2105_add_16_16_0_op0 + loops_1000_loop2105_add_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit2106_icmp_8_0_op0[2:0] = loops_1000_exit2106_403[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2106_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit2106_icmp_8_0 = (loops_1000_exit2106_icmp_8_0_op0 < loops_1000_exit2106_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit2106_add_8_8_1_op0[7:0] = loops_1000_loop1104_388_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2106_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit2106_add_8_8_1[7:0] = (loops_1000_exit2106_add_8_8_1_op0 + loops_1000_exit2106_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit1107_icmp_8_0_op0[2:0] = loops_1000_exit1107_405[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1107_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit1107_icmp_8_0 = (loops_1000_exit1107_icmp_8_0_op0 < loops_1000_exit1107_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit1107_add_8_8_0_op0[7:0] = loops_1000_loop0103_386_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1107_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit1107_add_8_8_0[7:0] = (loops_1000_exit1107_add_8_8_0_op0 + loops_1000_exit1107_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2111_or_8_8_0_op0[7:0] = loops_1000_loop2105_392_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2111_or_8_8_0_op1[7:0] = loops_1000_loop287_335_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2111_or_8_8_0[7:0] = (loops_1000_loop2111_or_8_8_0_op0 | loops_1000_loop2111_or_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2111_icmp_8_0_op0[2:0] = loops_1000_loop2111_422[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2111_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_loop2111_icmp_8_0 = (loops_1000_loop2111_icmp_8_0_op0 < loops_1000_loop2111_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2111_add_8_8_1_op0[7:0] = loops_1000_loop2111_411_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2111_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_loop2111_add_8_8_1[7:0] = (loops_1000_loop2111_add_8_8_1_op0 + loops_1000_loop2111_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2111_and_32_32_0_op0[31:0] = loops_1000_loop2111_415[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2111_and_32_32_0_op1[31:0] = loops_1000_loop2105_394_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2111_and_32_32_0[31:0] = (loops_1000_loop2111_and_32_32_0_op0 & loops_1000_loop2111_and_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit2112_icmp_8_0_op0[2:0] = loops_1000_exit2112_424[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2112_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit2112_icmp_8_0 = (loops_1000_exit2112_icmp_8_0_op0 < loops_1000_exit2112_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit2112_add_8_8_0_op0[7:0] = loops_1000_loop1110_409_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2112_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit2112_add_8_8_0[7:0] = (loops_1000_exit2112_add_8_8_0_op0 + loops_1000_exit2112_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit1113_icmp_8_0_op0[2:0] = loops_1000_exit1113_426[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1113_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit1113_icmp_8_0 = (loops_1000_exit1113_icmp_8_0_op0 < loops_1000_exit1113_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit1113_add_8_8_1_op0[7:0] = loops_1000_loop0109_407_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1113_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit1113_add_8_8_1[7:0] = (loops_1000_exit1113_add_8_8_1_op0 + loops_1000_exit1113_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2117_icmp_8_0_op0[2:0] = loops_1000_loop2117_443[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2117_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_loop2117_icmp_8_0 = (loops_1000_loop2117_icmp_8_0_op0 < loops_1000_loop2117_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2117_add_8_8_0_op0[7:0] = loops_1000_loop2117_432_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2117_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_loop2117_add_8_8_0[7:0] = (loops_1000_loop2117_add_8_8_0_op0 + loops_1000_loop2117_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2117_mul_32_32_0_op0[31:0] = loops_1000_loop299_372_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2117_mul_32_32_0_op1[31:0] = loops_1000_loop2105_398_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2117_mul_32_32_0[31:0] = (loops_1000_loop2117_mul_32_32_0_op0 * loops_1000_loop2117_mul_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2117_or_16_16_0_op0[15:0] = loops_1000_loop299_378_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2117_or_16_16_0_op1[15:0] = loops_1000_loop281_312_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2117_or_16_16_0[15:0] = (loops_1000_loop2117_or_16_16_0_op0 | loops_1000_loop2117_or_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit2118_icmp_8_0_op0[2:0] = loops_1000_exit2118_445[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2118_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit2118_icmp_8_0 = (loops_1000_exit2118_icmp_8_0_op0 < loops_1000_exit2118_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit2118_add_8_8_1_op0[7:0] = loops_1000_loop1116_430_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2118_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit2118_add_8_8_1[7:0] = (loops_1000_exit2118_add_8_8_1_op0 + loops_1000_exit2118_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit1119_icmp_8_0_op0[2:0] = loops_1000_exit1119_447[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1119_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit1119_icmp_8_0 = (loops_1000_exit1119_icmp_8_0_op0 < loops_1000_exit1119_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit1119_add_8_8_0_op0[7:0] = loops_1000_loop0115_428_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1119_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit1119_add_8_8_0[7:0] = (loops_1000_exit1119_add_8_8_0_op0 + loops_1000_exit1119_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2123_icmp_8_0_op0[2:0] = loops_1000_loop2123_464[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2123_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_loop2123_icmp_8_0 = (loops_1000_loop2123_icmp_8_0_op0 < loops_1000_loop2123_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2123_add_8_8_1_op0[7:0] = loops_1000_loop293_351_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2123_add_8_8_1_op1[7:0] = loops_1000_loop299_375_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2123_add_8_8_1[7:0] = (loops_1000_loop2123_add_8_8_1_op0 + loops_1000_loop2123_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2123_add_8_8_0_op0[7:0] = loops_1000_loop2123_453_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2123_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_loop2123_add_8_8_0[7:0] = (loops_1000_loop2123_add_8_8_0_op0 + loops_1000_loop2123_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2123_add_32_32_0_op0[31:0] = loops_1000_loop2105_398_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2123_add_32_32_0_op1[31:0] = loops_1000_loop2105_394_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2123_add_32_32_0[31:0] = (loops_1000_loop2123_add_32_32_0_op0 + loops_1000_loop2123_add_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2123_and_32_32_0_op0[31:0] = loops_1000_loop2111_415_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2123_and_32_32_0_op1[31:0] = loops_1000_loop2105_395_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2123_and_32_32_0[31:0] = (loops_1000_loop2123_and_32_32_0_op0 & loops_1000_loop2123_and_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2123_or_16_16_0_op0[15:0] = loops_1000_loop2111_418_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2123_or_16_16_0_op1[15:0] = loops_1000_loop2117_441_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2123_or_16_16_0[15:0] = (loops_1000_loop2123_or_16_16_0_op0 | loops_1000_loop2123_or_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit2124_icmp_8_0_op0[2:0] = loops_1000_exit2124_466[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2124_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit2124_icmp_8_0 = (loops_1000_exit2124_icmp_8_0_op0 < loops_1000_exit2124_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit2124_add_8_8_0_op0[7:0] = loops_1000_loop1122_451_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2124_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit2124_add_8_8_0[7:0] = (loops_1000_exit2124_add_8_8_0_op0 + loops_1000_exit2124_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit1125_icmp_8_0_op0[2:0] = loops_1000_exit1125_468[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1125_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit1125_icmp_8_0 = (loops_1000_exit1125_icmp_8_0_op0 < loops_1000_exit1125_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit1125_add_8_8_1_op0[7:0] = loops_1000_loop0121_449_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1125_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit1125_add_8_8_1[7:0] = (loops_1000_exit1125_add_8_8_1_op0 + loops_1000_exit1125_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2129_or_8_8_0_op0[7:0] = loops_1000_loop299_375_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2129_or_8_8_0_op1[7:0] = loops_1000_loop2105_397_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2129_or_8_8_0[7:0] = (loops_1000_loop2129_or_8_8_0_op0 | loops_1000_loop2129_or_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2129_icmp_8_0_op0[2:0] = loops_1000_loop2129_485[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2129_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_loop2129_icmp_8_0 = (loops_1000_loop2129_icmp_8_0_op0 < loops_1000_loop2129_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2129_add_8_8_0_op0[7:0] = loops_1000_loop2129_474_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2129_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_loop2129_add_8_8_0[7:0] = (loops_1000_loop2129_add_8_8_0_op0 + loops_1000_loop2129_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2129_and_8_8_0_op0[7:0] = loops_1000_loop293_354_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2129_and_8_8_0_op1[7:0] = loops_1000_loop2123_458_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2129_and_8_8_0[7:0] = (loops_1000_loop2129_and_8_8_0_op0 & loops_1000_loop2129_and_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2129_or_32_32_0_op0[31:0] = loops_1000_loop2111_415_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2129_or_32_32_0_op1[31:0] = loops_1000_loop2111_414_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2129_or_32_32_0[31:0] = (loops_1000_loop2129_or_32_32_0_op0 | loops_1000_loop2129_or_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit2130_icmp_8_0_op0[2:0] = loops_1000_exit2130_487[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2130_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit2130_icmp_8_0 = (loops_1000_exit2130_icmp_8_0_op0 < loops_1000_exit2130_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit2130_add_8_8_1_op0[7:0] = loops_1000_loop1128_472_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2130_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit2130_add_8_8_1[7:0] = (loops_1000_exit2130_add_8_8_1_op0 + loops_1000_exit2130_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit1131_icmp_8_0_op0[2:0] = loops_1000_exit1131_489[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1131_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit1131_icmp_8_0 = (loops_1000_exit1131_icmp_8_0_op0 < loops_1000_exit1131_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit1131_add_8_8_0_op0[7:0] = loops_1000_loop0127_470_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1131_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit1131_add_8_8_0[7:0] = (loops_1000_exit1131_add_8_8_0_op0 + loops_1000_exit1131_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2135_or_8_8_0_op0[7:0] = loops_1000_loop2123_458_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2135_or_8_8_0_op1[7:0] = loops_1000_loop2129_480_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2135_or_8_8_0[7:0] = (loops_1000_loop2135_or_8_8_0_op0 | loops_1000_loop2135_or_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2135_icmp_8_0_op0[2:0] = loops_1000_loop2135_506[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2135_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_loop2135_icmp_8_0 = (loops_1000_loop2135_icmp_8_0_op0 < loops_1000_loop2135_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2135_add_8_8_1_op0[7:0] = loops_1000_loop2135_495_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2135_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_loop2135_add_8_8_1[7:0] = (loops_1000_loop2135_add_8_8_1_op0 + loops_1000_loop2135_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2135_mul_8_8_0_op0[7:0] = loops_1000_loop2129_480_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2135_mul_8_8_0_op1[7:0] = loops_1000_loop2111_419_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2135_mul_8_8_0[7:0] = (loops_1000_loop2135_mul_8_8_0_op0 * loops_1000_loop2135_mul_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2135_add_16_16_1_op0[15:0] = loops_1000_loop2135_498[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2135_add_16_16_1_op1[15:0] = loops_1000_loop2117_441_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2135_add_16_16_1[15:0] = (loops_1000_loop2135_add_16_16_1_op0 + loops_1000_loop2135_add_16_16_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2135_add_16_16_0_op0[15:0] = loops_1000_loop2129_483_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2135_add_16_16_0_op1[15:0] = loops_1000_loop2123_459_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2135_add_16_16_0[15:0] = (loops_1000_loop2135_add_16_16_0_op0 + loops_1000_loop2135_add_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit2136_icmp_8_0_op0[2:0] = loops_1000_exit2136_508[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2136_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit2136_icmp_8_0 = (loops_1000_exit2136_icmp_8_0_op0 < loops_1000_exit2136_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit2136_add_8_8_0_op0[7:0] = loops_1000_loop1134_493_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2136_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit2136_add_8_8_0[7:0] = (loops_1000_exit2136_add_8_8_0_op0 + loops_1000_exit2136_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit1137_icmp_8_0_op0[2:0] = loops_1000_exit1137_510[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1137_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit1137_icmp_8_0 = (loops_1000_exit1137_icmp_8_0_op0 < loops_1000_exit1137_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit1137_add_8_8_1_op0[7:0] = loops_1000_loop0133_491_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1137_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit1137_add_8_8_1[7:0] = (loops_1000_exit1137_add_8_8_1_op0 + loops_1000_exit1137_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_122_S_0)) begin
+		loops_1000_loop2141_add_8_8_0_op0[7:0] = loops_1000_loop2123_459_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_1000_BB_122_S_1)) */ begin
+		loops_1000_loop2141_add_8_8_0_op0[7:0] = loops_1000_loop2141_516_reg[1:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_122_S_0)) begin
+		loops_1000_loop2141_add_8_8_0_op1[7:0] = loops_1000_loop2129_480_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_1000_BB_122_S_1)) */ begin
+		loops_1000_loop2141_add_8_8_0_op1[7:0] = 32'd1;
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2141_add_8_8_0[7:0] = (loops_1000_loop2141_add_8_8_0_op0 + loops_1000_loop2141_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2141_add_8_8_1_op0[7:0] = loops_1000_loop2123_458_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2141_add_8_8_1_op1[7:0] = loops_1000_loop2129_480_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2141_add_8_8_1[7:0] = (loops_1000_loop2141_add_8_8_1_op0 + loops_1000_loop2141_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2141_add_32_32_0_op0[31:0] = loops_1000_loop2123_456_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2141_add_32_32_0_op1[31:0] = loops_1000_loop2135_503_reg;
+end
+
+always @ (*) begin
+	loops_1000_loop2141_add_32_32_0[31:0] = (loops_1000_loop2141_add_32_32_0_op0 + loops_1000_loop2141_add_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2141_mul_8_8_0_op0[7:0] = loops_1000_loop2123_459_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2141_mul_8_8_0_op1[7:0] = loops_1000_loop2141_520[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2141_mul_8_8_0[7:0] = (loops_1000_loop2141_mul_8_8_0_op0 * loops_1000_loop2141_mul_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2141_and_32_32_0_op0[31:0] = loops_1000_loop2129_479_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2141_and_32_32_0_op1[31:0] = loops_1000_loop2129_482_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2141_and_32_32_0[31:0] = (loops_1000_loop2141_and_32_32_0_op0 & loops_1000_loop2141_and_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2141_or_16_16_0_op0[15:0] = loops_1000_loop2135_499_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2141_or_16_16_0_op1[15:0] = loops_1000_loop2129_481_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2141_or_16_16_0[15:0] = (loops_1000_loop2141_or_16_16_0_op0 | loops_1000_loop2141_or_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2141_add_16_16_1_op0[15:0] = loops_1000_loop2129_481_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2141_add_16_16_1_op1[15:0] = loops_1000_loop2141_520[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2141_add_16_16_1[15:0] = (loops_1000_loop2141_add_16_16_1_op0 + loops_1000_loop2141_add_16_16_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2141_icmp_8_0_op0[2:0] = loops_1000_loop2141_527[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2141_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_loop2141_icmp_8_0 = (loops_1000_loop2141_icmp_8_0_op0 < loops_1000_loop2141_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit2142_icmp_8_0_op0[2:0] = loops_1000_exit2142_529[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2142_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit2142_icmp_8_0 = (loops_1000_exit2142_icmp_8_0_op0 < loops_1000_exit2142_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit2142_add_8_8_1_op0[7:0] = loops_1000_loop1140_514_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2142_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit2142_add_8_8_1[7:0] = (loops_1000_exit2142_add_8_8_1_op0 + loops_1000_exit2142_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit1143_icmp_8_0_op0[2:0] = loops_1000_exit1143_531[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1143_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit1143_icmp_8_0 = (loops_1000_exit1143_icmp_8_0_op0 < loops_1000_exit1143_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit1143_add_8_8_0_op0[7:0] = loops_1000_loop0139_512_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1143_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit1143_add_8_8_0[7:0] = (loops_1000_exit1143_add_8_8_0_op0 + loops_1000_exit1143_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2147_icmp_8_0_op0[2:0] = loops_1000_loop2147_548[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2147_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_loop2147_icmp_8_0 = (loops_1000_loop2147_icmp_8_0_op0 < loops_1000_loop2147_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2147_add_8_8_1_op0[7:0] = loops_1000_loop2147_537_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2147_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_loop2147_add_8_8_1[7:0] = (loops_1000_loop2147_add_8_8_1_op0 + loops_1000_loop2147_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_127_S_0)) begin
+		loops_1000_loop2147_add_32_32_0_op0[31:0] = loops_1000_loop2129_479_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_1000_BB_127_S_1)) */ begin
+		loops_1000_loop2147_add_32_32_0_op0[31:0] = loops_1000_loop2141_518_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_127_S_0)) begin
+		loops_1000_loop2147_add_32_32_0_op1[31:0] = loops_1000_loop2123_456_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_1000_BB_127_S_1)) */ begin
+		loops_1000_loop2147_add_32_32_0_op1[31:0] = loops_1000_loop2147_539_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2147_add_32_32_0[31:0] = (loops_1000_loop2147_add_32_32_0_op0 + loops_1000_loop2147_add_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2147_mul_8_8_0_op0[7:0] = loops_1000_loop2141_523_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2147_mul_8_8_0_op1[7:0] = loops_1000_loop2141_520_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2147_mul_8_8_0[7:0] = (loops_1000_loop2147_mul_8_8_0_op0 * loops_1000_loop2147_mul_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2147_and_32_32_0_op0[31:0] = loops_1000_loop2147_539[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2147_and_32_32_0_op1[31:0] = loops_1000_loop2147_539[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2147_and_32_32_0[31:0] = (loops_1000_loop2147_and_32_32_0_op0 & loops_1000_loop2147_and_32_32_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_127_S_0)) begin
+		loops_1000_loop2147_or_32_32_0_op0[31:0] = loops_1000_loop2141_521_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_1000_BB_127_S_1)) */ begin
+		loops_1000_loop2147_or_32_32_0_op0[31:0] = loops_1000_loop2141_521_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_127_S_0)) begin
+		loops_1000_loop2147_or_32_32_0_op1[31:0] = loops_1000_loop2141_521_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_1000_BB_127_S_1)) */ begin
+		loops_1000_loop2147_or_32_32_0_op1[31:0] = loops_1000_loop2141_521_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2147_or_32_32_0[31:0] = (loops_1000_loop2147_or_32_32_0_op0 | loops_1000_loop2147_or_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2147_add_16_16_0_op0[15:0] = loops_1000_loop2141_524_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2147_add_16_16_0_op1[15:0] = loops_1000_loop2141_525_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2147_add_16_16_0[15:0] = (loops_1000_loop2147_add_16_16_0_op0 + loops_1000_loop2147_add_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2147_add_16_16_1_op0[15:0] = loops_1000_loop2135_499_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2147_add_16_16_1_op1[15:0] = loops_1000_loop2135_504_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2147_add_16_16_1[15:0] = (loops_1000_loop2147_add_16_16_1_op0 + loops_1000_loop2147_add_16_16_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit2148_icmp_8_0_op0[2:0] = loops_1000_exit2148_550[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2148_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit2148_icmp_8_0 = (loops_1000_exit2148_icmp_8_0_op0 < loops_1000_exit2148_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit2148_add_8_8_0_op0[7:0] = loops_1000_loop1146_535_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2148_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit2148_add_8_8_0[7:0] = (loops_1000_exit2148_add_8_8_0_op0 + loops_1000_exit2148_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit1149_icmp_8_0_op0[2:0] = loops_1000_exit1149_552[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1149_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit1149_icmp_8_0 = (loops_1000_exit1149_icmp_8_0_op0 < loops_1000_exit1149_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit1149_add_8_8_1_op0[7:0] = loops_1000_loop0145_533_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1149_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit1149_add_8_8_1[7:0] = (loops_1000_exit1149_add_8_8_1_op0 + loops_1000_exit1149_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2153_or_8_8_0_op0[7:0] = loops_1000_loop2153_563[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2153_or_8_8_0_op1[7:0] = loops_1000_loop2135_497_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2153_or_8_8_0[7:0] = (loops_1000_loop2153_or_8_8_0_op0 | loops_1000_loop2153_or_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2153_icmp_8_0_op0[2:0] = loops_1000_loop2153_569[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2153_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_loop2153_icmp_8_0 = (loops_1000_loop2153_icmp_8_0_op0 < loops_1000_loop2153_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2153_add_8_8_0_op0[7:0] = loops_1000_loop2141_523_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2153_add_8_8_0_op1[7:0] = loops_1000_loop2141_520_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2153_add_8_8_0[7:0] = (loops_1000_loop2153_add_8_8_0_op0 + loops_1000_loop2153_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2153_add_8_8_1_op0[7:0] = loops_1000_loop2153_558_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2153_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_loop2153_add_8_8_1[7:0] = (loops_1000_loop2153_add_8_8_1_op0 + loops_1000_loop2153_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2153_and_32_32_0_op0[31:0] = loops_1000_loop2147_545_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2153_and_32_32_0_op1[31:0] = loops_1000_loop2147_540_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2153_and_32_32_0[31:0] = (loops_1000_loop2153_and_32_32_0_op0 & loops_1000_loop2153_and_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2153_add_16_16_1_op0[15:0] = loops_1000_loop2147_544_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2153_add_16_16_1_op1[15:0] = loops_1000_loop2135_499_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2153_add_16_16_1[15:0] = (loops_1000_loop2153_add_16_16_1_op0 + loops_1000_loop2153_add_16_16_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit2154_icmp_8_0_op0[2:0] = loops_1000_exit2154_571[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2154_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit2154_icmp_8_0 = (loops_1000_exit2154_icmp_8_0_op0 < loops_1000_exit2154_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit2154_add_8_8_1_op0[7:0] = loops_1000_loop1152_556_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2154_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit2154_add_8_8_1[7:0] = (loops_1000_exit2154_add_8_8_1_op0 + loops_1000_exit2154_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit1155_icmp_8_0_op0[2:0] = loops_1000_exit1155_573[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1155_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit1155_icmp_8_0 = (loops_1000_exit1155_icmp_8_0_op0 < loops_1000_exit1155_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit1155_add_8_8_0_op0[7:0] = loops_1000_loop0151_554_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1155_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit1155_add_8_8_0[7:0] = (loops_1000_exit1155_add_8_8_0_op0 + loops_1000_exit1155_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2159_icmp_8_0_op0[2:0] = loops_1000_loop2159_590[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2159_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_loop2159_icmp_8_0 = (loops_1000_loop2159_icmp_8_0_op0 < loops_1000_loop2159_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2159_add_8_8_1_op0[7:0] = loops_1000_loop2153_563_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2159_add_8_8_1_op1[7:0] = loops_1000_loop2147_543_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2159_add_8_8_1[7:0] = (loops_1000_loop2159_add_8_8_1_op0 + loops_1000_loop2159_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_137_S_0)) begin
+		loops_1000_loop2159_add_8_8_0_op0[7:0] = loops_1000_loop2159_579_reg[1:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_1000_BB_137_S_1)) */ begin
+		loops_1000_loop2159_add_8_8_0_op0[7:0] = loops_1000_loop2159_584_reg[7:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_137_S_0)) begin
+		loops_1000_loop2159_add_8_8_0_op1[7:0] = 32'd1;
+	end
+	else /* if ((cur_state == BPHLS_F_loops_1000_BB_137_S_1)) */ begin
+		loops_1000_loop2159_add_8_8_0_op1[7:0] = loops_1000_loop2159_584_reg[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2159_add_8_8_0[7:0] = (loops_1000_loop2159_add_8_8_0_op0 + loops_1000_loop2159_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2159_add_32_32_0_op0[31:0] = loops_1000_loop2147_541_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2159_add_32_32_0_op1[31:0] = loops_1000_loop2147_545_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2159_add_32_32_0[31:0] = (loops_1000_loop2159_add_32_32_0_op0 + loops_1000_loop2159_add_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2159_and_8_8_0_op0[7:0] = loops_1000_loop2153_566_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2159_and_8_8_0_op1[7:0] = loops_1000_loop2141_520_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2159_and_8_8_0[7:0] = (loops_1000_loop2159_and_8_8_0_op0 & loops_1000_loop2159_and_8_8_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_137_S_0)) begin
+		loops_1000_loop2159_or_32_32_0_op0[31:0] = loops_1000_loop2147_539_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_1000_BB_137_S_1)) */ begin
+		loops_1000_loop2159_or_32_32_0_op0[31:0] = loops_1000_loop2147_545_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_137_S_0)) begin
+		loops_1000_loop2159_or_32_32_0_op1[31:0] = loops_1000_loop2141_521_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_1000_BB_137_S_1)) */ begin
+		loops_1000_loop2159_or_32_32_0_op1[31:0] = loops_1000_loop2147_540_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2159_or_32_32_0[31:0] = (loops_1000_loop2159_or_32_32_0_op0 | loops_1000_loop2159_or_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit2160_icmp_8_0_op0[2:0] = loops_1000_exit2160_592[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2160_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit2160_icmp_8_0 = (loops_1000_exit2160_icmp_8_0_op0 < loops_1000_exit2160_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit2160_add_8_8_1_op0[7:0] = loops_1000_loop1158_577_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2160_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit2160_add_8_8_1[7:0] = (loops_1000_exit2160_add_8_8_1_op0 + loops_1000_exit2160_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit1161_icmp_8_0_op0[2:0] = loops_1000_exit1161_594[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1161_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit1161_icmp_8_0 = (loops_1000_exit1161_icmp_8_0_op0 < loops_1000_exit1161_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit1161_add_8_8_0_op0[7:0] = loops_1000_loop0157_575_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1161_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit1161_add_8_8_0[7:0] = (loops_1000_exit1161_add_8_8_0_op0 + loops_1000_exit1161_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2165_icmp_8_0_op0[2:0] = loops_1000_loop2165_611[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2165_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_loop2165_icmp_8_0 = (loops_1000_loop2165_icmp_8_0_op0 < loops_1000_loop2165_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2165_add_8_8_1_op0[7:0] = loops_1000_loop2159_585_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2165_add_8_8_1_op1[7:0] = loops_1000_loop2159_587_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2165_add_8_8_1[7:0] = (loops_1000_loop2165_add_8_8_1_op0 + loops_1000_loop2165_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2165_add_8_8_0_op0[7:0] = loops_1000_loop2165_600_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2165_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_loop2165_add_8_8_0[7:0] = (loops_1000_loop2165_add_8_8_0_op0 + loops_1000_loop2165_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_142_S_0)) begin
+		loops_1000_loop2165_add_32_32_0_op0[31:0] = loops_1000_loop2147_540_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_loops_1000_BB_142_S_1)) begin
+		loops_1000_loop2165_add_32_32_0_op0[31:0] = loops_1000_loop2159_582_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_1000_BB_142_S_2)) */ begin
+		loops_1000_loop2165_add_32_32_0_op0[31:0] = loops_1000_loop2159_582_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_142_S_0)) begin
+		loops_1000_loop2165_add_32_32_0_op1[31:0] = loops_1000_loop2159_583_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_loops_1000_BB_142_S_1)) begin
+		loops_1000_loop2165_add_32_32_0_op1[31:0] = loops_1000_loop2159_582_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_1000_BB_142_S_2)) */ begin
+		loops_1000_loop2165_add_32_32_0_op1[31:0] = loops_1000_loop2165_604_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2165_add_32_32_0[31:0] = (loops_1000_loop2165_add_32_32_0_op0 + loops_1000_loop2165_add_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2165_add_16_16_1_op0[15:0] = loops_1000_loop2153_564_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2165_add_16_16_1_op1[15:0] = loops_1000_loop2135_499_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2165_add_16_16_1[15:0] = (loops_1000_loop2165_add_16_16_1_op0 + loops_1000_loop2165_add_16_16_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit2166_icmp_8_0_op0[2:0] = loops_1000_exit2166_613[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2166_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit2166_icmp_8_0 = (loops_1000_exit2166_icmp_8_0_op0 < loops_1000_exit2166_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit2166_add_8_8_0_op0[7:0] = loops_1000_loop1164_598_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2166_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit2166_add_8_8_0[7:0] = (loops_1000_exit2166_add_8_8_0_op0 + loops_1000_exit2166_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit1167_icmp_8_0_op0[2:0] = loops_1000_exit1167_615[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1167_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit1167_icmp_8_0 = (loops_1000_exit1167_icmp_8_0_op0 < loops_1000_exit1167_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit1167_add_8_8_1_op0[7:0] = loops_1000_loop0163_596_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1167_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit1167_add_8_8_1[7:0] = (loops_1000_exit1167_add_8_8_1_op0 + loops_1000_exit1167_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2171_icmp_8_0_op0[2:0] = loops_1000_loop2171_632[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2171_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_loop2171_icmp_8_0 = (loops_1000_loop2171_icmp_8_0_op0 < loops_1000_loop2171_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2171_add_8_8_0_op0[7:0] = loops_1000_loop2153_565_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2171_add_8_8_0_op1[7:0] = loops_1000_loop2159_588_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2171_add_8_8_0[7:0] = (loops_1000_loop2171_add_8_8_0_op0 + loops_1000_loop2171_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2171_add_8_8_1_op0[7:0] = loops_1000_loop2171_621_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2171_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_loop2171_add_8_8_1[7:0] = (loops_1000_loop2171_add_8_8_1_op0 + loops_1000_loop2171_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2171_mul_32_32_0_op0[31:0] = loops_1000_loop2159_583_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2171_mul_32_32_0_op1[31:0] = loops_1000_loop2147_546_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2171_mul_32_32_0[31:0] = (loops_1000_loop2171_mul_32_32_0_op0 * loops_1000_loop2171_mul_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2171_and_32_32_0_op0[31:0] = loops_1000_loop2165_604_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2171_and_32_32_0_op1[31:0] = loops_1000_loop2159_582_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2171_and_32_32_0[31:0] = (loops_1000_loop2171_and_32_32_0_op0 & loops_1000_loop2171_and_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2171_or_16_16_0_op0[15:0] = loops_1000_loop2135_504_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2171_or_16_16_0_op1[15:0] = loops_1000_loop2147_544_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2171_or_16_16_0[15:0] = (loops_1000_loop2171_or_16_16_0_op0 | loops_1000_loop2171_or_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2171_or_32_32_0_op0[31:0] = loops_1000_loop2165_602_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2171_or_32_32_0_op1[31:0] = loops_1000_loop2159_583_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2171_or_32_32_0[31:0] = (loops_1000_loop2171_or_32_32_0_op0 | loops_1000_loop2171_or_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2171_and_16_16_0_op0[15:0] = loops_1000_loop2141_524_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2171_and_16_16_0_op1[15:0] = loops_1000_loop2153_564_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2171_and_16_16_0[15:0] = (loops_1000_loop2171_and_16_16_0_op0 & loops_1000_loop2171_and_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit2172_icmp_8_0_op0[2:0] = loops_1000_exit2172_634[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2172_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit2172_icmp_8_0 = (loops_1000_exit2172_icmp_8_0_op0 < loops_1000_exit2172_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit2172_add_8_8_1_op0[7:0] = loops_1000_loop1170_619_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2172_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit2172_add_8_8_1[7:0] = (loops_1000_exit2172_add_8_8_1_op0 + loops_1000_exit2172_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit1173_icmp_8_0_op0[2:0] = loops_1000_exit1173_636[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1173_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit1173_icmp_8_0 = (loops_1000_exit1173_icmp_8_0_op0 < loops_1000_exit1173_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit1173_add_8_8_0_op0[7:0] = loops_1000_loop0169_617_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1173_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit1173_add_8_8_0[7:0] = (loops_1000_exit1173_add_8_8_0_op0 + loops_1000_exit1173_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2177_icmp_8_0_op0[2:0] = loops_1000_loop2177_653[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2177_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_loop2177_icmp_8_0 = (loops_1000_loop2177_icmp_8_0_op0 < loops_1000_loop2177_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2177_add_8_8_1_op0[7:0] = loops_1000_loop2159_581_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2177_add_8_8_1_op1[7:0] = loops_1000_loop2159_585_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2177_add_8_8_1[7:0] = (loops_1000_loop2177_add_8_8_1_op0 + loops_1000_loop2177_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2177_add_8_8_0_op0[7:0] = loops_1000_loop2177_642_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2177_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_loop2177_add_8_8_0[7:0] = (loops_1000_loop2177_add_8_8_0_op0 + loops_1000_loop2177_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2177_add_32_32_0_op0[31:0] = loops_1000_loop2177_644[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2177_add_32_32_0_op1[31:0] = loops_1000_loop2171_626_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2177_add_32_32_0[31:0] = (loops_1000_loop2177_add_32_32_0_op0 + loops_1000_loop2177_add_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2177_and_32_32_0_op0[31:0] = loops_1000_loop2165_604_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2177_and_32_32_0_op1[31:0] = loops_1000_loop2171_625_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2177_and_32_32_0[31:0] = (loops_1000_loop2177_and_32_32_0_op0 & loops_1000_loop2177_and_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2177_add_16_16_1_op0[15:0] = loops_1000_loop2153_562_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2177_add_16_16_1_op1[15:0] = loops_1000_loop2147_544_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2177_add_16_16_1[15:0] = (loops_1000_loop2177_add_16_16_1_op0 + loops_1000_loop2177_add_16_16_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2177_add_16_16_0_op0[15:0] = loops_1000_loop2171_630_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2177_add_16_16_0_op1[15:0] = loops_1000_loop2153_564_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2177_add_16_16_0[15:0] = (loops_1000_loop2177_add_16_16_0_op0 + loops_1000_loop2177_add_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit2178_icmp_8_0_op0[2:0] = loops_1000_exit2178_655[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2178_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit2178_icmp_8_0 = (loops_1000_exit2178_icmp_8_0_op0 < loops_1000_exit2178_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit2178_add_8_8_1_op0[7:0] = loops_1000_loop1176_640_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2178_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit2178_add_8_8_1[7:0] = (loops_1000_exit2178_add_8_8_1_op0 + loops_1000_exit2178_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit1179_icmp_8_0_op0[2:0] = loops_1000_exit1179_657[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1179_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit1179_icmp_8_0 = (loops_1000_exit1179_icmp_8_0_op0 < loops_1000_exit1179_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit1179_add_8_8_0_op0[7:0] = loops_1000_loop0175_638_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1179_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit1179_add_8_8_0[7:0] = (loops_1000_exit1179_add_8_8_0_op0 + loops_1000_exit1179_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2183_icmp_8_0_op0[2:0] = loops_1000_loop2183_674[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2183_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_loop2183_icmp_8_0 = (loops_1000_loop2183_icmp_8_0_op0 < loops_1000_loop2183_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2183_add_8_8_1_op0[7:0] = loops_1000_loop2183_663_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2183_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_loop2183_add_8_8_1[7:0] = (loops_1000_loop2183_add_8_8_1_op0 + loops_1000_loop2183_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2183_add_32_32_0_op0[31:0] = loops_1000_loop2177_651_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2183_add_32_32_0_op1[31:0] = loops_1000_loop2171_624_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2183_add_32_32_0[31:0] = (loops_1000_loop2183_add_32_32_0_op0 + loops_1000_loop2183_add_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2183_mul_8_8_0_op0[7:0] = loops_1000_loop2159_588_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2183_mul_8_8_0_op1[7:0] = loops_1000_loop2159_588_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2183_mul_8_8_0[7:0] = (loops_1000_loop2183_mul_8_8_0_op0 * loops_1000_loop2183_mul_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2183_and_32_32_0_op0[31:0] = loops_1000_loop2171_626_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2183_and_32_32_0_op1[31:0] = loops_1000_loop2171_625_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2183_and_32_32_0[31:0] = (loops_1000_loop2183_and_32_32_0_op0 & loops_1000_loop2183_and_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit2184_icmp_8_0_op0[2:0] = loops_1000_exit2184_676[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2184_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit2184_icmp_8_0 = (loops_1000_exit2184_icmp_8_0_op0 < loops_1000_exit2184_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit2184_add_8_8_0_op0[7:0] = loops_1000_loop1182_661_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2184_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit2184_add_8_8_0[7:0] = (loops_1000_exit2184_add_8_8_0_op0 + loops_1000_exit2184_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit1185_icmp_8_0_op0[2:0] = loops_1000_exit1185_678[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1185_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit1185_icmp_8_0 = (loops_1000_exit1185_icmp_8_0_op0 < loops_1000_exit1185_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit1185_add_8_8_1_op0[7:0] = loops_1000_loop0181_659_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1185_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit1185_add_8_8_1[7:0] = (loops_1000_exit1185_add_8_8_1_op0 + loops_1000_exit1185_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2189_icmp_8_0_op0[2:0] = loops_1000_loop2189_695[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2189_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_loop2189_icmp_8_0 = (loops_1000_loop2189_icmp_8_0_op0 < loops_1000_loop2189_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2189_add_8_8_0_op0[7:0] = loops_1000_loop2165_603_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2189_add_8_8_0_op1[7:0] = loops_1000_loop2183_668_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2189_add_8_8_0[7:0] = (loops_1000_loop2189_add_8_8_0_op0 + loops_1000_loop2189_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2189_add_8_8_1_op0[7:0] = loops_1000_loop2189_684_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2189_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_loop2189_add_8_8_1[7:0] = (loops_1000_loop2189_add_8_8_1_op0 + loops_1000_loop2189_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2189_and_32_32_0_op0[31:0] = loops_1000_loop2183_669_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2189_and_32_32_0_op1[31:0] = loops_1000_loop2177_648_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2189_and_32_32_0[31:0] = (loops_1000_loop2189_and_32_32_0_op0 & loops_1000_loop2189_and_32_32_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_162_S_0)) begin
+		loops_1000_loop2189_and_8_8_0_op0[7:0] = loops_1000_loop2159_587_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_1000_BB_162_S_1)) */ begin
+		loops_1000_loop2189_and_8_8_0_op0[7:0] = loops_1000_loop2177_649_reg[7:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_162_S_0)) begin
+		loops_1000_loop2189_and_8_8_0_op1[7:0] = loops_1000_loop2159_585_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_1000_BB_162_S_1)) */ begin
+		loops_1000_loop2189_and_8_8_0_op1[7:0] = loops_1000_loop2189_688_reg[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2189_and_8_8_0[7:0] = (loops_1000_loop2189_and_8_8_0_op0 & loops_1000_loop2189_and_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2189_or_32_32_0_op0[31:0] = loops_1000_loop2177_644_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2189_or_32_32_0_op1[31:0] = loops_1000_loop2171_627_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2189_or_32_32_0[31:0] = (loops_1000_loop2189_or_32_32_0_op0 | loops_1000_loop2189_or_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2189_add_16_16_0_op0[15:0] = loops_1000_loop2165_605_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2189_add_16_16_0_op1[15:0] = loops_1000_loop2177_650_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2189_add_16_16_0[15:0] = (loops_1000_loop2189_add_16_16_0_op0 + loops_1000_loop2189_add_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit2190_icmp_8_0_op0[2:0] = loops_1000_exit2190_697[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2190_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit2190_icmp_8_0 = (loops_1000_exit2190_icmp_8_0_op0 < loops_1000_exit2190_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit2190_add_8_8_1_op0[7:0] = loops_1000_loop1188_682_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2190_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit2190_add_8_8_1[7:0] = (loops_1000_exit2190_add_8_8_1_op0 + loops_1000_exit2190_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit1191_icmp_8_0_op0[2:0] = loops_1000_exit1191_699[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1191_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit1191_icmp_8_0 = (loops_1000_exit1191_icmp_8_0_op0 < loops_1000_exit1191_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit1191_add_8_8_0_op0[7:0] = loops_1000_loop0187_680_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1191_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit1191_add_8_8_0[7:0] = (loops_1000_exit1191_add_8_8_0_op0 + loops_1000_exit1191_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2195_icmp_8_0_op0[2:0] = loops_1000_loop2195_716[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2195_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_loop2195_icmp_8_0 = (loops_1000_loop2195_icmp_8_0_op0 < loops_1000_loop2195_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2195_add_8_8_1_op0[7:0] = loops_1000_loop2195_705_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2195_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_loop2195_add_8_8_1[7:0] = (loops_1000_loop2195_add_8_8_1_op0 + loops_1000_loop2195_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2195_mul_8_8_0_op0[7:0] = loops_1000_loop2189_692_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2195_mul_8_8_0_op1[7:0] = loops_1000_loop2183_668_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2195_mul_8_8_0[7:0] = (loops_1000_loop2195_mul_8_8_0_op0 * loops_1000_loop2195_mul_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2195_and_32_32_0_op0[31:0] = loops_1000_loop2183_669_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2195_and_32_32_0_op1[31:0] = loops_1000_loop2189_690_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2195_and_32_32_0[31:0] = (loops_1000_loop2195_and_32_32_0_op0 & loops_1000_loop2195_and_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2195_add_16_16_1_op0[15:0] = loops_1000_loop2195_707[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2195_add_16_16_1_op1[15:0] = loops_1000_loop2177_645_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2195_add_16_16_1[15:0] = (loops_1000_loop2195_add_16_16_1_op0 + loops_1000_loop2195_add_16_16_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit2196_icmp_8_0_op0[2:0] = loops_1000_exit2196_718[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2196_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit2196_icmp_8_0 = (loops_1000_exit2196_icmp_8_0_op0 < loops_1000_exit2196_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit2196_add_8_8_0_op0[7:0] = loops_1000_loop1194_703_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2196_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit2196_add_8_8_0[7:0] = (loops_1000_exit2196_add_8_8_0_op0 + loops_1000_exit2196_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit1197_icmp_8_0_op0[2:0] = loops_1000_exit1197_720[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1197_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit1197_icmp_8_0 = (loops_1000_exit1197_icmp_8_0_op0 < loops_1000_exit1197_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit1197_add_8_8_1_op0[7:0] = loops_1000_loop0193_701_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1197_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit1197_add_8_8_1[7:0] = (loops_1000_exit1197_add_8_8_1_op0 + loops_1000_exit1197_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2201_icmp_8_0_op0[2:0] = loops_1000_loop2201_737[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2201_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_loop2201_icmp_8_0 = (loops_1000_loop2201_icmp_8_0_op0 < loops_1000_loop2201_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2201_add_8_8_0_op0[7:0] = loops_1000_loop2201_726_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2201_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_loop2201_add_8_8_0[7:0] = (loops_1000_loop2201_add_8_8_0_op0 + loops_1000_loop2201_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2201_and_32_32_0_op0[31:0] = loops_1000_loop2189_693_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2201_and_32_32_0_op1[31:0] = loops_1000_loop2189_693_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2201_and_32_32_0[31:0] = (loops_1000_loop2201_and_32_32_0_op0 & loops_1000_loop2201_and_32_32_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_172_S_0)) begin
+		loops_1000_loop2201_or_32_32_0_op0[31:0] = loops_1000_loop2195_713_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_1000_BB_172_S_1)) */ begin
+		loops_1000_loop2201_or_32_32_0_op0[31:0] = loops_1000_loop2201_729_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_172_S_0)) begin
+		loops_1000_loop2201_or_32_32_0_op1[31:0] = loops_1000_loop2189_690_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_1000_BB_172_S_1)) */ begin
+		loops_1000_loop2201_or_32_32_0_op1[31:0] = loops_1000_loop2195_709_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2201_or_32_32_0[31:0] = (loops_1000_loop2201_or_32_32_0_op0 | loops_1000_loop2201_or_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2201_mul_16_16_0_op0[15:0] = loops_1000_loop2189_686_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2201_mul_16_16_0_op1[15:0] = loops_1000_loop2189_692_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2201_mul_16_16_0[15:0] = (loops_1000_loop2201_mul_16_16_0_op0 * loops_1000_loop2201_mul_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit2202_icmp_8_0_op0[2:0] = loops_1000_exit2202_739[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2202_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit2202_icmp_8_0 = (loops_1000_exit2202_icmp_8_0_op0 < loops_1000_exit2202_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit2202_add_8_8_1_op0[7:0] = loops_1000_loop1200_724_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2202_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit2202_add_8_8_1[7:0] = (loops_1000_exit2202_add_8_8_1_op0 + loops_1000_exit2202_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit1203_icmp_8_0_op0[2:0] = loops_1000_exit1203_741[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1203_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit1203_icmp_8_0 = (loops_1000_exit1203_icmp_8_0_op0 < loops_1000_exit1203_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit1203_add_8_8_0_op0[7:0] = loops_1000_loop0199_722_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1203_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit1203_add_8_8_0[7:0] = (loops_1000_exit1203_add_8_8_0_op0 + loops_1000_exit1203_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2207_icmp_8_0_op0[2:0] = loops_1000_loop2207_758[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2207_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_loop2207_icmp_8_0 = (loops_1000_loop2207_icmp_8_0_op0 < loops_1000_loop2207_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2207_add_8_8_1_op0[7:0] = loops_1000_loop2189_689_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2207_add_8_8_1_op1[7:0] = loops_1000_loop2189_691_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2207_add_8_8_1[7:0] = (loops_1000_loop2207_add_8_8_1_op0 + loops_1000_loop2207_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2207_add_8_8_0_op0[7:0] = loops_1000_loop2207_747_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2207_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_loop2207_add_8_8_0[7:0] = (loops_1000_loop2207_add_8_8_0_op0 + loops_1000_loop2207_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2207_add_16_16_0_op0[15:0] = loops_1000_loop2189_686_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2207_add_16_16_0_op1[15:0] = loops_1000_loop2207_751[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2207_add_16_16_0[15:0] = (loops_1000_loop2207_add_16_16_0_op0 + loops_1000_loop2207_add_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit2208_icmp_8_0_op0[2:0] = loops_1000_exit2208_760[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2208_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit2208_icmp_8_0 = (loops_1000_exit2208_icmp_8_0_op0 < loops_1000_exit2208_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit2208_add_8_8_0_op0[7:0] = loops_1000_loop1206_745_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2208_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit2208_add_8_8_0[7:0] = (loops_1000_exit2208_add_8_8_0_op0 + loops_1000_exit2208_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit1209_icmp_8_0_op0[2:0] = loops_1000_exit1209_762[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1209_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit1209_icmp_8_0 = (loops_1000_exit1209_icmp_8_0_op0 < loops_1000_exit1209_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit1209_add_8_8_1_op0[7:0] = loops_1000_loop0205_743_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1209_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit1209_add_8_8_1[7:0] = (loops_1000_exit1209_add_8_8_1_op0 + loops_1000_exit1209_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2213_icmp_8_0_op0[2:0] = loops_1000_loop2213_779[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2213_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_loop2213_icmp_8_0 = (loops_1000_loop2213_icmp_8_0_op0 < loops_1000_loop2213_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2213_add_8_8_0_op0[7:0] = loops_1000_loop2213_768_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2213_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_loop2213_add_8_8_0[7:0] = (loops_1000_loop2213_add_8_8_0_op0 + loops_1000_loop2213_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2213_add_32_32_0_op0[31:0] = loops_1000_loop2201_730_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2213_add_32_32_0_op1[31:0] = loops_1000_loop2195_713_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2213_add_32_32_0[31:0] = (loops_1000_loop2213_add_32_32_0_op0 + loops_1000_loop2213_add_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2213_and_32_32_0_op0[31:0] = loops_1000_loop2207_752_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2213_and_32_32_0_op1[31:0] = loops_1000_loop2207_752_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2213_and_32_32_0[31:0] = (loops_1000_loop2213_and_32_32_0_op0 & loops_1000_loop2213_and_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2213_or_16_16_0_op0[15:0] = loops_1000_loop2207_749_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2213_or_16_16_0_op1[15:0] = loops_1000_loop2195_712_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2213_or_16_16_0[15:0] = (loops_1000_loop2213_or_16_16_0_op0 | loops_1000_loop2213_or_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit2214_icmp_8_0_op0[2:0] = loops_1000_exit2214_781[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2214_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit2214_icmp_8_0 = (loops_1000_exit2214_icmp_8_0_op0 < loops_1000_exit2214_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit2214_add_8_8_1_op0[7:0] = loops_1000_loop1212_766_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2214_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit2214_add_8_8_1[7:0] = (loops_1000_exit2214_add_8_8_1_op0 + loops_1000_exit2214_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit1215_icmp_8_0_op0[2:0] = loops_1000_exit1215_783[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1215_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit1215_icmp_8_0 = (loops_1000_exit1215_icmp_8_0_op0 < loops_1000_exit1215_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit1215_add_8_8_0_op0[7:0] = loops_1000_loop0211_764_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1215_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit1215_add_8_8_0[7:0] = (loops_1000_exit1215_add_8_8_0_op0 + loops_1000_exit1215_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2219_icmp_8_0_op0[2:0] = loops_1000_loop2219_800[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2219_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_loop2219_icmp_8_0 = (loops_1000_loop2219_icmp_8_0_op0 < loops_1000_loop2219_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2219_add_8_8_1_op0[7:0] = loops_1000_loop2189_692_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2219_add_8_8_1_op1[7:0] = loops_1000_loop2195_708_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2219_add_8_8_1[7:0] = (loops_1000_loop2219_add_8_8_1_op0 + loops_1000_loop2219_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2219_add_8_8_0_op0[7:0] = loops_1000_loop2219_789_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2219_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_loop2219_add_8_8_0[7:0] = (loops_1000_loop2219_add_8_8_0_op0 + loops_1000_loop2219_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_187_S_0)) begin
+		loops_1000_loop2219_mul_32_32_0_op0[31:0] = loops_1000_loop2213_770_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_loops_1000_BB_187_S_1)) begin
+		loops_1000_loop2219_mul_32_32_0_op0[31:0] = loops_1000_loop2213_770_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_1000_BB_187_S_2)) */ begin
+		loops_1000_loop2219_mul_32_32_0_op0[31:0] = loops_1000_loop2219_793_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_1000_BB_187_S_0)) begin
+		loops_1000_loop2219_mul_32_32_0_op1[31:0] = loops_1000_loop2201_731_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_loops_1000_BB_187_S_1)) begin
+		loops_1000_loop2219_mul_32_32_0_op1[31:0] = loops_1000_loop2213_777_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_1000_BB_187_S_2)) */ begin
+		loops_1000_loop2219_mul_32_32_0_op1[31:0] = loops_1000_loop2201_733_reg[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_1000_loop2219_mul_32_32_0[31:0] = (loops_1000_loop2219_mul_32_32_0_op0 * loops_1000_loop2219_mul_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2219_add_16_16_1_op0[15:0] = loops_1000_loop2207_755_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2219_add_16_16_1_op1[15:0] = loops_1000_loop2213_772_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2219_add_16_16_1[15:0] = (loops_1000_loop2219_add_16_16_1_op0 + loops_1000_loop2219_add_16_16_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit2220_icmp_8_0_op0[2:0] = loops_1000_exit2220_802[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2220_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit2220_icmp_8_0 = (loops_1000_exit2220_icmp_8_0_op0 < loops_1000_exit2220_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit2220_add_8_8_0_op0[7:0] = loops_1000_loop1218_787_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2220_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit2220_add_8_8_0[7:0] = (loops_1000_exit2220_add_8_8_0_op0 + loops_1000_exit2220_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit1221_icmp_8_0_op0[2:0] = loops_1000_exit1221_804[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1221_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit1221_icmp_8_0 = (loops_1000_exit1221_icmp_8_0_op0 < loops_1000_exit1221_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit1221_add_8_8_1_op0[7:0] = loops_1000_loop0217_785_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1221_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit1221_add_8_8_1[7:0] = (loops_1000_exit1221_add_8_8_1_op0 + loops_1000_exit1221_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2225_icmp_8_0_op0[2:0] = loops_1000_loop2225_821[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2225_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_loop2225_icmp_8_0 = (loops_1000_loop2225_icmp_8_0_op0 < loops_1000_loop2225_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2225_add_8_8_0_op0[7:0] = loops_1000_loop2195_711_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2225_add_8_8_0_op1[7:0] = loops_1000_loop2207_750_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2225_add_8_8_0[7:0] = (loops_1000_loop2225_add_8_8_0_op0 + loops_1000_loop2225_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2225_add_8_8_1_op0[7:0] = loops_1000_loop2225_810_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2225_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_loop2225_add_8_8_1[7:0] = (loops_1000_loop2225_add_8_8_1_op0 + loops_1000_loop2225_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2225_add_32_32_0_op0[31:0] = loops_1000_loop2219_794_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2225_add_32_32_0_op1[31:0] = loops_1000_loop2219_796_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2225_add_32_32_0[31:0] = (loops_1000_loop2225_add_32_32_0_op0 + loops_1000_loop2225_add_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2225_and_8_8_0_op0[7:0] = loops_1000_loop2201_733_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2225_and_8_8_0_op1[7:0] = loops_1000_loop2189_692_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2225_and_8_8_0[7:0] = (loops_1000_loop2225_and_8_8_0_op0 & loops_1000_loop2225_and_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2225_add_16_16_0_op0[15:0] = loops_1000_loop2219_797_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2225_add_16_16_0_op1[15:0] = loops_1000_loop2219_791_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2225_add_16_16_0[15:0] = (loops_1000_loop2225_add_16_16_0_op0 + loops_1000_loop2225_add_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit2226_icmp_8_0_op0[2:0] = loops_1000_exit2226_823[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2226_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit2226_icmp_8_0 = (loops_1000_exit2226_icmp_8_0_op0 < loops_1000_exit2226_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit2226_add_8_8_1_op0[7:0] = loops_1000_loop1224_808_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2226_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit2226_add_8_8_1[7:0] = (loops_1000_exit2226_add_8_8_1_op0 + loops_1000_exit2226_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit1227_icmp_8_0_op0[2:0] = loops_1000_exit1227_825[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1227_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit1227_icmp_8_0 = (loops_1000_exit1227_icmp_8_0_op0 < loops_1000_exit1227_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit1227_add_8_8_0_op0[7:0] = loops_1000_loop0223_806_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1227_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit1227_add_8_8_0[7:0] = (loops_1000_exit1227_add_8_8_0_op0 + loops_1000_exit1227_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2231_or_8_8_0_op0[7:0] = loops_1000_loop2195_711_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2231_or_8_8_0_op1[7:0] = loops_1000_loop2195_708_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2231_or_8_8_0[7:0] = (loops_1000_loop2231_or_8_8_0_op0 | loops_1000_loop2231_or_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2231_icmp_8_0_op0[2:0] = loops_1000_loop2231_842[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2231_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_loop2231_icmp_8_0 = (loops_1000_loop2231_icmp_8_0_op0 < loops_1000_loop2231_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2231_add_8_8_1_op0[7:0] = loops_1000_loop2231_839[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2231_add_8_8_1_op1[7:0] = loops_1000_loop2219_795_reg[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2231_add_8_8_1[7:0] = (loops_1000_loop2231_add_8_8_1_op0 + loops_1000_loop2231_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2231_add_8_8_0_op0[7:0] = loops_1000_loop2231_831_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2231_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_loop2231_add_8_8_0[7:0] = (loops_1000_loop2231_add_8_8_0_op0 + loops_1000_loop2231_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2231_add_32_32_0_op0[31:0] = loops_1000_loop2213_770_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2231_add_32_32_0_op1[31:0] = loops_1000_loop2219_796_reg[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2231_add_32_32_0[31:0] = (loops_1000_loop2231_add_32_32_0_op0 + loops_1000_loop2231_add_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2231_or_16_16_0_op0[15:0] = loops_1000_loop2219_792_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2231_or_16_16_0_op1[15:0] = loops_1000_loop2213_773_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2231_or_16_16_0[15:0] = (loops_1000_loop2231_or_16_16_0_op0 | loops_1000_loop2231_or_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2231_add_16_16_1_op0[15:0] = loops_1000_loop2225_813_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2231_add_16_16_1_op1[15:0] = loops_1000_loop2219_792_reg[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2231_add_16_16_1[15:0] = (loops_1000_loop2231_add_16_16_1_op0 + loops_1000_loop2231_add_16_16_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2231_add_16_16_0_op0[15:0] = loops_1000_loop2231_834[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2231_add_16_16_0_op1[15:0] = loops_1000_loop2231_835[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2231_add_16_16_0[15:0] = (loops_1000_loop2231_add_16_16_0_op0 + loops_1000_loop2231_add_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2231_mul_16_16_0_op0[15:0] = loops_1000_loop2231_834[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2231_mul_16_16_0_op1[15:0] = loops_1000_loop2231_836[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2231_mul_16_16_0[15:0] = (loops_1000_loop2231_mul_16_16_0_op0 * loops_1000_loop2231_mul_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit2232_icmp_8_0_op0[2:0] = loops_1000_exit2232_844[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2232_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit2232_icmp_8_0 = (loops_1000_exit2232_icmp_8_0_op0 < loops_1000_exit2232_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit2232_add_8_8_0_op0[7:0] = loops_1000_loop1230_829_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit2232_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit2232_add_8_8_0[7:0] = (loops_1000_exit2232_add_8_8_0_op0 + loops_1000_exit2232_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit1233_icmp_8_0_op0[2:0] = loops_1000_exit1233_846[31:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1233_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_1000_exit1233_icmp_8_0 = (loops_1000_exit1233_icmp_8_0_op0 < loops_1000_exit1233_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_1000_exit1233_add_8_8_1_op0[7:0] = loops_1000_loop0229_827_reg[1:0];
+end
+
+always @ (*) begin
+	loops_1000_exit1233_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_1000_exit1233_add_8_8_1[7:0] = (loops_1000_exit1233_add_8_8_1_op0 + loops_1000_exit1233_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_1000_loop2_16[63:0] = (arg_7 ^ arg_7);
+end
+
+always @ (*) begin
+	loops_1000_loop23_37[7:0] = loops_1000_loop23_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop29_56[63:0] = (loops_1000_loop23_34_reg * arg_6);
+end
+
+always @ (*) begin
+	loops_1000_loop29_62[63:0] = (loops_1000_loop23_40_reg - loops_1000_loop2_17_reg);
+end
+
+always @ (*) begin
+	loops_1000_loop215_78[63:0] = (loops_1000_loop29_55_reg & loops_1000_loop23_41_reg);
+end
+
+always @ (*) begin
+	loops_1000_loop227_123[15:0] = (loops_1000_loop215_83_reg ^ loops_1000_loop215_80_reg);
+end
+
+always @ (*) begin
+	loops_1000_loop233_144[63:0] = (loops_1000_loop227_118_reg + loops_1000_loop227_124_reg);
+end
+
+always @ (*) begin
+	loops_1000_loop239_167[63:0] = (loops_1000_loop221_105_reg - loops_1000_loop227_122_reg);
+end
+
+always @ (*) begin
+	loops_1000_loop239_163[31:0] = loops_1000_loop239_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop251_203[63:0] = (loops_1000_loop239_168_reg ^ loops_1000_loop239_160_reg);
+end
+
+always @ (*) begin
+	loops_1000_loop251_209[63:0] = (loops_1000_loop239_160_reg & loops_1000_loop251_207_reg);
+end
+
+always @ (*) begin
+	loops_1000_loop257_227[15:0] = (loops_1000_loop245_183_reg ^ loops_1000_loop251_205_reg);
+end
+
+always @ (*) begin
+	loops_1000_loop257_228[7:0] = loops_1000_loop257_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop263_245[63:0] = (loops_1000_loop263_244_reg + loops_1000_loop251_202_reg);
+end
+
+always @ (*) begin
+	loops_1000_loop263_246[15:0] = (loops_1000_loop251_205_reg ^ loops_1000_loop257_229_reg);
+end
+
+always @ (*) begin
+	loops_1000_loop263_247[7:0] = loops_1000_loop263_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop263_251[63:0] = (loops_1000_loop257_223_reg + loops_1000_loop257_225_reg);
+end
+
+always @ (*) begin
+	loops_1000_loop275_288[63:0] = (loops_1000_loop275_286_reg + loops_1000_loop269_269_reg);
+end
+
+always @ (*) begin
+	loops_1000_loop281_310[31:0] = loops_1000_loop281_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop299_371[31:0] = (loops_1000_loop287_334_reg - loops_1000_loop287_330_reg);
+end
+
+always @ (*) begin
+	loops_1000_loop2105_396[15:0] = loops_1000_loop2105_or_16_16_0[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2111_417[7:0] = (loops_1000_loop293_351_reg ^ loops_1000_loop299_375_reg);
+end
+
+always @ (*) begin
+	loops_1000_loop2117_436[31:0] = loops_1000_loop2117_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2117_437[63:0] = (loops_1000_loop2111_413_reg + loops_1000_loop299_378_reg);
+end
+
+always @ (*) begin
+	loops_1000_loop2123_457[63:0] = (loops_1000_loop2117_438_reg - loops_1000_loop2123_454_reg);
+end
+
+always @ (*) begin
+	loops_1000_loop2123_461[31:0] = loops_1000_loop2123_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2129_476[63:0] = (loops_1000_loop2117_438_reg & loops_1000_loop2123_460_reg);
+end
+
+always @ (*) begin
+	loops_1000_loop2129_478[7:0] = loops_1000_loop2129_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2135_500[31:0] = (loops_1000_loop2129_479_reg ^ loops_1000_loop2123_456_reg);
+end
+
+always @ (*) begin
+	loops_1000_loop2141_522[7:0] = (loops_1000_loop2135_501_reg ^ loops_1000_loop2123_459_reg);
+end
+
+always @ (*) begin
+	loops_1000_loop2147_542[15:0] = loops_1000_loop2147_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2153_560[31:0] = loops_1000_loop2153_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2159_586[31:0] = loops_1000_loop2159_or_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2165_606[63:0] = (loops_1000_loop2153_561_reg * loops_1000_loop2165_601_reg);
+end
+
+always @ (*) begin
+	loops_1000_loop2171_628[15:0] = loops_1000_loop2171_or_16_16_0[15:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2171_629[7:0] = loops_1000_loop2171_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2183_666[31:0] = loops_1000_loop2183_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2183_670[31:0] = (loops_1000_loop2177_651_reg ^ loops_1000_loop2183_669);
+end
+
+always @ (*) begin
+	loops_1000_loop2213_771[31:0] = loops_1000_loop2213_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2213_776[63:0] = (loops_1000_loop2201_734_reg + loops_1000_loop2207_751_reg);
+end
+
+always @ (*) begin
+	loops_1000_loop2225_814[7:0] = (loops_1000_loop2219_795_reg - loops_1000_loop2219_795_reg);
+end
+
+always @ (*) begin
+	loops_1000_loop2225_815[7:0] = loops_1000_loop2225_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2225_816[63:0] = (loops_1000_loop2213_774_reg | loops_1000_loop2213_774_reg);
+end
+
+always @ (*) begin
+	loops_1000_loop2225_817[63:0] = (loops_1000_loop2219_790_reg * loops_1000_loop2219_790_reg);
+end
+
+always @ (*) begin
+	loops_1000_loop2225_818[7:0] = loops_1000_loop2225_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2231_833[63:0] = (loops_1000_loop2225_812_reg + loops_1000_loop2213_773_reg);
+end
+
+always @ (*) begin
+	loops_1000_loop2231_837[31:0] = loops_1000_loop2231_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_1000_loop2231_838[15:0] = loops_1000_loop2231_mul_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS)) begin
+		finish <= 1'd0;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_200_S_0)) begin
+		finish <= 1'd1;
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS)) begin
+		return_val[63:0] <= 64'd0;
+	end
+	if ((cur_state == BPHLS_F_loops_1000_BB_200_S_0)) begin
+		return_val[63:0] <= loops_1000_loop2231_841_reg[63:0];
+	end
+end
+
+endmodule
@@ -0,0 +1,492 @@
+; ModuleID = 'loops_300'
+source_filename = "loops_300"
+
+define i64 @loops_300(i8 %0, i8 %1, i16 %2, i16 %3, i32 %4, i32 %5, i64 %6, i64 %7) {
+entry:
+  br label %loop0
+
+loop0:                                            ; preds = %exit1, %entry
+  %8 = phi i32 [ 0, %entry ], [ %30, %exit1 ]
+  %9 = phi i64 [ %7, %entry ], [ %25, %exit1 ]
+  br label %loop1
+
+loop1:                                            ; preds = %exit2, %loop0
+  %10 = phi i32 [ 0, %loop0 ], [ %28, %exit2 ]
+  %11 = phi i64 [ %9, %loop0 ], [ %25, %exit2 ]
+  br label %loop2
+
+loop2:                                            ; preds = %loop2, %loop1
+  %12 = phi i32 [ 0, %loop1 ], [ %26, %loop2 ]
+  %13 = phi i64 [ %11, %loop1 ], [ %25, %loop2 ]
+  %14 = add i16 %2, %2
+  %15 = zext i8 %1 to i32
+  %16 = or i32 %4, %15
+  %17 = xor i64 %7, %7
+  %18 = mul i8 %1, %0
+  %19 = and i8 %18, %18
+  %20 = zext i16 %3 to i32
+  %21 = xor i32 %5, %20
+  %22 = and i16 %14, %14
+  %23 = sub i8 %18, %19
+  %24 = zext i8 %23 to i64
+  %25 = add i64 %13, %24
+  %26 = add i32 %12, 1
+  %27 = icmp ult i32 %26, 4
+  br i1 %27, label %loop2, label %exit2
+
+exit2:                                            ; preds = %loop2
+  %28 = add i32 %10, 1
+  %29 = icmp ult i32 %28, 4
+  br i1 %29, label %loop1, label %exit1
+
+exit1:                                            ; preds = %exit2
+  %30 = add i32 %8, 1
+  %31 = icmp ult i32 %30, 4
+  br i1 %31, label %loop0, label %exit0
+
+exit0:                                            ; preds = %exit1
+  br label %loop01
+
+loop01:                                           ; preds = %exit15, %exit0
+  %32 = phi i32 [ 0, %exit0 ], [ %52, %exit15 ]
+  %33 = phi i64 [ %25, %exit0 ], [ %47, %exit15 ]
+  br label %loop12
+
+loop12:                                           ; preds = %exit24, %loop01
+  %34 = phi i32 [ 0, %loop01 ], [ %50, %exit24 ]
+  %35 = phi i64 [ %33, %loop01 ], [ %47, %exit24 ]
+  br label %loop23
+
+loop23:                                           ; preds = %loop23, %loop12
+  %36 = phi i32 [ 0, %loop12 ], [ %48, %loop23 ]
+  %37 = phi i64 [ %35, %loop12 ], [ %47, %loop23 ]
+  %38 = add i16 %3, %2
+  %39 = add i64 %7, %7
+  %40 = add i8 %0, %0
+  %41 = xor i16 %22, %38
+  %42 = or i8 %19, %1
+  %43 = sub i64 %39, %37
+  %44 = or i8 %18, %1
+  %45 = add i8 %19, %19
+  %46 = zext i8 %45 to i64
+  %47 = add i64 %37, %46
+  %48 = add i32 %36, 1
+  %49 = icmp ult i32 %48, 4
+  br i1 %49, label %loop23, label %exit24
+
+exit24:                                           ; preds = %loop23
+  %50 = add i32 %34, 1
+  %51 = icmp ult i32 %50, 4
+  br i1 %51, label %loop12, label %exit15
+
+exit15:                                           ; preds = %exit24
+  %52 = add i32 %32, 1
+  %53 = icmp ult i32 %52, 4
+  br i1 %53, label %loop01, label %exit06
+
+exit06:                                           ; preds = %exit15
+  br label %loop07
+
+loop07:                                           ; preds = %exit111, %exit06
+  %54 = phi i32 [ 0, %exit06 ], [ %75, %exit111 ]
+  %55 = phi i64 [ %47, %exit06 ], [ %70, %exit111 ]
+  br label %loop18
+
+loop18:                                           ; preds = %exit210, %loop07
+  %56 = phi i32 [ 0, %loop07 ], [ %73, %exit210 ]
+  %57 = phi i64 [ %55, %loop07 ], [ %70, %exit210 ]
+  br label %loop29
+
+loop29:                                           ; preds = %loop29, %loop18
+  %58 = phi i32 [ 0, %loop18 ], [ %71, %loop29 ]
+  %59 = phi i64 [ %57, %loop18 ], [ %70, %loop29 ]
+  %60 = mul i64 %37, %6
+  %61 = sub i32 %5, %4
+  %62 = and i32 %61, %4
+  %63 = and i32 %61, %16
+  %64 = add i64 %43, %37
+  %65 = and i16 %3, %41
+  %66 = zext i8 %18 to i64
+  %67 = sub i64 %43, %66
+  %68 = xor i32 %16, %5
+  %69 = zext i32 %68 to i64
+  %70 = add i64 %59, %69
+  %71 = add i32 %58, 1
+  %72 = icmp ult i32 %71, 4
+  br i1 %72, label %loop29, label %exit210
+
+exit210:                                          ; preds = %loop29
+  %73 = add i32 %56, 1
+  %74 = icmp ult i32 %73, 4
+  br i1 %74, label %loop18, label %exit111
+
+exit111:                                          ; preds = %exit210
+  %75 = add i32 %54, 1
+  %76 = icmp ult i32 %75, 4
+  br i1 %76, label %loop07, label %exit012
+
+exit012:                                          ; preds = %exit111
+  br label %loop013
+
+loop013:                                          ; preds = %exit117, %exit012
+  %77 = phi i32 [ 0, %exit012 ], [ %99, %exit117 ]
+  %78 = phi i64 [ %70, %exit012 ], [ %94, %exit117 ]
+  br label %loop114
+
+loop114:                                          ; preds = %exit216, %loop013
+  %79 = phi i32 [ 0, %loop013 ], [ %97, %exit216 ]
+  %80 = phi i64 [ %78, %loop013 ], [ %94, %exit216 ]
+  br label %loop215
+
+loop215:                                          ; preds = %loop215, %loop114
+  %81 = phi i32 [ 0, %loop114 ], [ %95, %loop215 ]
+  %82 = phi i64 [ %80, %loop114 ], [ %94, %loop215 ]
+  %83 = mul i8 %1, %42
+  %84 = zext i8 %44 to i64
+  %85 = and i64 %59, %84
+  %86 = xor i32 %62, %16
+  %87 = add i16 %2, %22
+  %88 = or i64 %59, %43
+  %89 = xor i8 %19, %44
+  %90 = zext i8 %89 to i16
+  %91 = mul i16 %87, %90
+  %92 = xor i32 %62, %63
+  %93 = zext i32 %92 to i64
+  %94 = add i64 %82, %93
+  %95 = add i32 %81, 1
+  %96 = icmp ult i32 %95, 4
+  br i1 %96, label %loop215, label %exit216
+
+exit216:                                          ; preds = %loop215
+  %97 = add i32 %79, 1
+  %98 = icmp ult i32 %97, 4
+  br i1 %98, label %loop114, label %exit117
+
+exit117:                                          ; preds = %exit216
+  %99 = add i32 %77, 1
+  %100 = icmp ult i32 %99, 4
+  br i1 %100, label %loop013, label %exit018
+
+exit018:                                          ; preds = %exit117
+  br label %loop019
+
+loop019:                                          ; preds = %exit123, %exit018
+  %101 = phi i32 [ 0, %exit018 ], [ %122, %exit123 ]
+  %102 = phi i64 [ %94, %exit018 ], [ %117, %exit123 ]
+  br label %loop120
+
+loop120:                                          ; preds = %exit222, %loop019
+  %103 = phi i32 [ 0, %loop019 ], [ %120, %exit222 ]
+  %104 = phi i64 [ %102, %loop019 ], [ %117, %exit222 ]
+  br label %loop221
+
+loop221:                                          ; preds = %loop221, %loop120
+  %105 = phi i32 [ 0, %loop120 ], [ %118, %loop221 ]
+  %106 = phi i64 [ %104, %loop120 ], [ %117, %loop221 ]
+  %107 = or i64 %88, %88
+  %108 = zext i32 %68 to i64
+  %109 = xor i64 %106, %108
+  %110 = and i8 %19, %19
+  %111 = sub i32 %92, %21
+  %112 = and i8 %45, %23
+  %113 = mul i64 %109, %64
+  %114 = add i8 %89, %110
+  %115 = zext i8 %83 to i64
+  %116 = or i64 %107, %115
+  %117 = add i64 %106, %116
+  %118 = add i32 %105, 1
+  %119 = icmp ult i32 %118, 4
+  br i1 %119, label %loop221, label %exit222
+
+exit222:                                          ; preds = %loop221
+  %120 = add i32 %103, 1
+  %121 = icmp ult i32 %120, 4
+  br i1 %121, label %loop120, label %exit123
+
+exit123:                                          ; preds = %exit222
+  %122 = add i32 %101, 1
+  %123 = icmp ult i32 %122, 4
+  br i1 %123, label %loop019, label %exit024
+
+exit024:                                          ; preds = %exit123
+  br label %loop025
+
+loop025:                                          ; preds = %exit129, %exit024
+  %124 = phi i32 [ 0, %exit024 ], [ %145, %exit129 ]
+  %125 = phi i64 [ %117, %exit024 ], [ %140, %exit129 ]
+  br label %loop126
+
+loop126:                                          ; preds = %exit228, %loop025
+  %126 = phi i32 [ 0, %loop025 ], [ %143, %exit228 ]
+  %127 = phi i64 [ %125, %loop025 ], [ %140, %exit228 ]
+  br label %loop227
+
+loop227:                                          ; preds = %loop227, %loop126
+  %128 = phi i32 [ 0, %loop126 ], [ %141, %loop227 ]
+  %129 = phi i64 [ %127, %loop126 ], [ %140, %loop227 ]
+  %130 = and i16 %41, %87
+  %131 = or i8 %42, %112
+  %132 = sub i32 %62, %68
+  %133 = xor i64 %116, %113
+  %134 = xor i16 %91, %87
+  %135 = zext i16 %91 to i64
+  %136 = mul i64 %109, %135
+  %137 = or i32 %111, %63
+  %138 = xor i16 %22, %65
+  %139 = zext i16 %138 to i64
+  %140 = add i64 %129, %139
+  %141 = add i32 %128, 1
+  %142 = icmp ult i32 %141, 4
+  br i1 %142, label %loop227, label %exit228
+
+exit228:                                          ; preds = %loop227
+  %143 = add i32 %126, 1
+  %144 = icmp ult i32 %143, 4
+  br i1 %144, label %loop126, label %exit129
+
+exit129:                                          ; preds = %exit228
+  %145 = add i32 %124, 1
+  %146 = icmp ult i32 %145, 4
+  br i1 %146, label %loop025, label %exit030
+
+exit030:                                          ; preds = %exit129
+  br label %loop031
+
+loop031:                                          ; preds = %exit135, %exit030
+  %147 = phi i32 [ 0, %exit030 ], [ %167, %exit135 ]
+  %148 = phi i64 [ %140, %exit030 ], [ %162, %exit135 ]
+  br label %loop132
+
+loop132:                                          ; preds = %exit234, %loop031
+  %149 = phi i32 [ 0, %loop031 ], [ %165, %exit234 ]
+  %150 = phi i64 [ %148, %loop031 ], [ %162, %exit234 ]
+  br label %loop233
+
+loop233:                                          ; preds = %loop233, %loop132
+  %151 = phi i32 [ 0, %loop132 ], [ %163, %loop233 ]
+  %152 = phi i64 [ %150, %loop132 ], [ %162, %loop233 ]
+  %153 = add i8 %45, %112
+  %154 = xor i64 %133, %129
+  %155 = add i16 %87, %41
+  %156 = add i8 %114, %110
+  %157 = add i64 %129, %136
+  %158 = xor i32 %86, %63
+  %159 = and i8 %153, %83
+  %160 = and i32 %63, %68
+  %161 = zext i32 %160 to i64
+  %162 = add i64 %152, %161
+  %163 = add i32 %151, 1
+  %164 = icmp ult i32 %163, 4
+  br i1 %164, label %loop233, label %exit234
+
+exit234:                                          ; preds = %loop233
+  %165 = add i32 %149, 1
+  %166 = icmp ult i32 %165, 4
+  br i1 %166, label %loop132, label %exit135
+
+exit135:                                          ; preds = %exit234
+  %167 = add i32 %147, 1
+  %168 = icmp ult i32 %167, 4
+  br i1 %168, label %loop031, label %exit036
+
+exit036:                                          ; preds = %exit135
+  br label %loop037
+
+loop037:                                          ; preds = %exit141, %exit036
+  %169 = phi i32 [ 0, %exit036 ], [ %188, %exit141 ]
+  %170 = phi i64 [ %162, %exit036 ], [ %183, %exit141 ]
+  br label %loop138
+
+loop138:                                          ; preds = %exit240, %loop037
+  %171 = phi i32 [ 0, %loop037 ], [ %186, %exit240 ]
+  %172 = phi i64 [ %170, %loop037 ], [ %183, %exit240 ]
+  br label %loop239
+
+loop239:                                          ; preds = %loop239, %loop138
+  %173 = phi i32 [ 0, %loop138 ], [ %184, %loop239 ]
+  %174 = phi i64 [ %172, %loop138 ], [ %183, %loop239 ]
+  %175 = mul i32 %160, %158
+  %176 = mul i32 %158, %160
+  %177 = mul i32 %137, %137
+  %178 = mul i8 %89, %89
+  %179 = xor i32 %176, %175
+  %180 = and i32 %137, %132
+  %181 = sub i64 %116, %133
+  %182 = add i64 %129, %136
+  %183 = add i64 %174, %182
+  %184 = add i32 %173, 1
+  %185 = icmp ult i32 %184, 4
+  br i1 %185, label %loop239, label %exit240
+
+exit240:                                          ; preds = %loop239
+  %186 = add i32 %171, 1
+  %187 = icmp ult i32 %186, 4
+  br i1 %187, label %loop138, label %exit141
+
+exit141:                                          ; preds = %exit240
+  %188 = add i32 %169, 1
+  %189 = icmp ult i32 %188, 4
+  br i1 %189, label %loop037, label %exit042
+
+exit042:                                          ; preds = %exit141
+  br label %loop043
+
+loop043:                                          ; preds = %exit147, %exit042
+  %190 = phi i32 [ 0, %exit042 ], [ %210, %exit147 ]
+  %191 = phi i64 [ %183, %exit042 ], [ %205, %exit147 ]
+  br label %loop144
+
+loop144:                                          ; preds = %exit246, %loop043
+  %192 = phi i32 [ 0, %loop043 ], [ %208, %exit246 ]
+  %193 = phi i64 [ %191, %loop043 ], [ %205, %exit246 ]
+  br label %loop245
+
+loop245:                                          ; preds = %loop245, %loop144
+  %194 = phi i32 [ 0, %loop144 ], [ %206, %loop245 ]
+  %195 = phi i64 [ %193, %loop144 ], [ %205, %loop245 ]
+  %196 = add i16 %155, %41
+  %197 = xor i16 %155, %138
+  %198 = add i16 %130, %87
+  %199 = and i8 %153, %156
+  %200 = and i32 %160, %158
+  %201 = xor i32 %176, %200
+  %202 = mul i16 %196, %197
+  %203 = or i16 %196, %130
+  %204 = zext i16 %203 to i64
+  %205 = add i64 %195, %204
+  %206 = add i32 %194, 1
+  %207 = icmp ult i32 %206, 4
+  br i1 %207, label %loop245, label %exit246
+
+exit246:                                          ; preds = %loop245
+  %208 = add i32 %192, 1
+  %209 = icmp ult i32 %208, 4
+  br i1 %209, label %loop144, label %exit147
+
+exit147:                                          ; preds = %exit246
+  %210 = add i32 %190, 1
+  %211 = icmp ult i32 %210, 4
+  br i1 %211, label %loop043, label %exit048
+
+exit048:                                          ; preds = %exit147
+  br label %loop049
+
+loop049:                                          ; preds = %exit153, %exit048
+  %212 = phi i32 [ 0, %exit048 ], [ %232, %exit153 ]
+  %213 = phi i64 [ %205, %exit048 ], [ %227, %exit153 ]
+  br label %loop150
+
+loop150:                                          ; preds = %exit252, %loop049
+  %214 = phi i32 [ 0, %loop049 ], [ %230, %exit252 ]
+  %215 = phi i64 [ %213, %loop049 ], [ %227, %exit252 ]
+  br label %loop251
+
+loop251:                                          ; preds = %loop251, %loop150
+  %216 = phi i32 [ 0, %loop150 ], [ %228, %loop251 ]
+  %217 = phi i64 [ %215, %loop150 ], [ %227, %loop251 ]
+  %218 = xor i64 %182, %174
+  %219 = or i16 %138, %202
+  %220 = add i16 %197, %219
+  %221 = sub i8 %112, %112
+  %222 = mul i64 %154, %195
+  %223 = mul i16 %202, %198
+  %224 = and i64 %174, %222
+  %225 = sub i8 %131, %178
+  %226 = zext i8 %225 to i64
+  %227 = add i64 %217, %226
+  %228 = add i32 %216, 1
+  %229 = icmp ult i32 %228, 4
+  br i1 %229, label %loop251, label %exit252
+
+exit252:                                          ; preds = %loop251
+  %230 = add i32 %214, 1
+  %231 = icmp ult i32 %230, 4
+  br i1 %231, label %loop150, label %exit153
+
+exit153:                                          ; preds = %exit252
+  %232 = add i32 %212, 1
+  %233 = icmp ult i32 %232, 4
+  br i1 %233, label %loop049, label %exit054
+
+exit054:                                          ; preds = %exit153
+  br label %loop055
+
+loop055:                                          ; preds = %exit159, %exit054
+  %234 = phi i32 [ 0, %exit054 ], [ %253, %exit159 ]
+  %235 = phi i64 [ %227, %exit054 ], [ %248, %exit159 ]
+  br label %loop156
+
+loop156:                                          ; preds = %exit258, %loop055
+  %236 = phi i32 [ 0, %loop055 ], [ %251, %exit258 ]
+  %237 = phi i64 [ %235, %loop055 ], [ %248, %exit258 ]
+  br label %loop257
+
+loop257:                                          ; preds = %loop257, %loop156
+  %238 = phi i32 [ 0, %loop156 ], [ %249, %loop257 ]
+  %239 = phi i64 [ %237, %loop156 ], [ %248, %loop257 ]
+  %240 = xor i16 %202, %203
+  %241 = xor i64 %217, %239
+  %242 = or i32 %160, %180
+  %243 = xor i16 %197, %220
+  %244 = and i8 %156, %156
+  %245 = mul i16 %202, %220
+  %246 = xor i32 %175, %242
+  %247 = and i64 %239, %217
+  %248 = add i64 %239, %247
+  %249 = add i32 %238, 1
+  %250 = icmp ult i32 %249, 4
+  br i1 %250, label %loop257, label %exit258
+
+exit258:                                          ; preds = %loop257
+  %251 = add i32 %236, 1
+  %252 = icmp ult i32 %251, 4
+  br i1 %252, label %loop156, label %exit159
+
+exit159:                                          ; preds = %exit258
+  %253 = add i32 %234, 1
+  %254 = icmp ult i32 %253, 4
+  br i1 %254, label %loop055, label %exit060
+
+exit060:                                          ; preds = %exit159
+  br label %loop061
+
+loop061:                                          ; preds = %exit165, %exit060
+  %255 = phi i32 [ 0, %exit060 ], [ %275, %exit165 ]
+  %256 = phi i64 [ %248, %exit060 ], [ %270, %exit165 ]
+  br label %loop162
+
+loop162:                                          ; preds = %exit264, %loop061
+  %257 = phi i32 [ 0, %loop061 ], [ %273, %exit264 ]
+  %258 = phi i64 [ %256, %loop061 ], [ %270, %exit264 ]
+  br label %loop263
+
+loop263:                                          ; preds = %loop263, %loop162
+  %259 = phi i32 [ 0, %loop162 ], [ %271, %loop263 ]
+  %260 = phi i64 [ %258, %loop162 ], [ %270, %loop263 ]
+  %261 = add i64 %260, %217
+  %262 = xor i16 %220, %245
+  %263 = mul i8 %221, %199
+  %264 = add i16 %219, %223
+  %265 = add i8 %159, %225
+  %266 = sub i16 %240, %220
+  %267 = add i64 %239, %241
+  %268 = xor i8 %221, %225
+  %269 = zext i8 %268 to i64
+  %270 = add i64 %260, %269
+  %271 = add i32 %259, 1
+  %272 = icmp ult i32 %271, 4
+  br i1 %272, label %loop263, label %exit264
+
+exit264:                                          ; preds = %loop263
+  %273 = add i32 %257, 1
+  %274 = icmp ult i32 %273, 4
+  br i1 %274, label %loop162, label %exit165
+
+exit165:                                          ; preds = %exit264
+  %275 = add i32 %255, 1
+  %276 = icmp ult i32 %275, 4
+  br i1 %276, label %loop061, label %exit066
+
+exit066:                                          ; preds = %exit165
+  ret i64 %270
+}
@@ -0,0 +1,5164 @@
+module loops_300
+(
+	input wire  clk,
+	input wire  reset,
+	input wire  start,
+	output reg  finish,
+	output reg [63:0] return_val,
+	input wire [7:0] arg_0,
+	input wire [7:0] arg_1,
+	input wire [15:0] arg_2,
+	input wire [15:0] arg_3,
+	input wire [31:0] arg_4,
+	input wire [31:0] arg_5,
+	input wire [63:0] arg_6,
+	input wire [63:0] arg_7
+);
+
+parameter [6:0] BPHLS = 7'd0;
+parameter [6:0] BPHLS_F_loops_300_BB_0_S_0 = 7'd1;
+parameter [6:0] BPHLS_F_loops_300_BB_1_S_0 = 7'd2;
+parameter [6:0] BPHLS_F_loops_300_BB_2_S_0 = 7'd3;
+parameter [6:0] BPHLS_F_loops_300_BB_2_S_1 = 7'd4;
+parameter [6:0] BPHLS_F_loops_300_BB_3_S_0 = 7'd5;
+parameter [6:0] BPHLS_F_loops_300_BB_3_S_1 = 7'd6;
+parameter [6:0] BPHLS_F_loops_300_BB_4_S_0 = 7'd7;
+parameter [6:0] BPHLS_F_loops_300_BB_4_S_1 = 7'd8;
+parameter [6:0] BPHLS_F_loops_300_BB_5_S_0 = 7'd9;
+parameter [6:0] BPHLS_F_loops_300_BB_6_S_0 = 7'd10;
+parameter [6:0] BPHLS_F_loops_300_BB_7_S_0 = 7'd11;
+parameter [6:0] BPHLS_F_loops_300_BB_7_S_1 = 7'd12;
+parameter [6:0] BPHLS_F_loops_300_BB_7_S_2 = 7'd13;
+parameter [6:0] BPHLS_F_loops_300_BB_8_S_0 = 7'd14;
+parameter [6:0] BPHLS_F_loops_300_BB_8_S_1 = 7'd15;
+parameter [6:0] BPHLS_F_loops_300_BB_9_S_0 = 7'd16;
+parameter [6:0] BPHLS_F_loops_300_BB_9_S_1 = 7'd17;
+parameter [6:0] BPHLS_F_loops_300_BB_10_S_0 = 7'd18;
+parameter [6:0] BPHLS_F_loops_300_BB_11_S_0 = 7'd19;
+parameter [6:0] BPHLS_F_loops_300_BB_12_S_0 = 7'd20;
+parameter [6:0] BPHLS_F_loops_300_BB_12_S_1 = 7'd21;
+parameter [6:0] BPHLS_F_loops_300_BB_13_S_0 = 7'd22;
+parameter [6:0] BPHLS_F_loops_300_BB_13_S_1 = 7'd23;
+parameter [6:0] BPHLS_F_loops_300_BB_14_S_0 = 7'd24;
+parameter [6:0] BPHLS_F_loops_300_BB_14_S_1 = 7'd25;
+parameter [6:0] BPHLS_F_loops_300_BB_15_S_0 = 7'd26;
+parameter [6:0] BPHLS_F_loops_300_BB_16_S_0 = 7'd27;
+parameter [6:0] BPHLS_F_loops_300_BB_17_S_0 = 7'd28;
+parameter [6:0] BPHLS_F_loops_300_BB_17_S_1 = 7'd29;
+parameter [6:0] BPHLS_F_loops_300_BB_18_S_0 = 7'd30;
+parameter [6:0] BPHLS_F_loops_300_BB_18_S_1 = 7'd31;
+parameter [6:0] BPHLS_F_loops_300_BB_19_S_0 = 7'd32;
+parameter [6:0] BPHLS_F_loops_300_BB_19_S_1 = 7'd33;
+parameter [6:0] BPHLS_F_loops_300_BB_20_S_0 = 7'd34;
+parameter [6:0] BPHLS_F_loops_300_BB_21_S_0 = 7'd35;
+parameter [6:0] BPHLS_F_loops_300_BB_22_S_0 = 7'd36;
+parameter [6:0] BPHLS_F_loops_300_BB_22_S_1 = 7'd37;
+parameter [6:0] BPHLS_F_loops_300_BB_23_S_0 = 7'd38;
+parameter [6:0] BPHLS_F_loops_300_BB_23_S_1 = 7'd39;
+parameter [6:0] BPHLS_F_loops_300_BB_24_S_0 = 7'd40;
+parameter [6:0] BPHLS_F_loops_300_BB_24_S_1 = 7'd41;
+parameter [6:0] BPHLS_F_loops_300_BB_25_S_0 = 7'd42;
+parameter [6:0] BPHLS_F_loops_300_BB_26_S_0 = 7'd43;
+parameter [6:0] BPHLS_F_loops_300_BB_27_S_0 = 7'd44;
+parameter [6:0] BPHLS_F_loops_300_BB_27_S_1 = 7'd45;
+parameter [6:0] BPHLS_F_loops_300_BB_28_S_0 = 7'd46;
+parameter [6:0] BPHLS_F_loops_300_BB_28_S_1 = 7'd47;
+parameter [6:0] BPHLS_F_loops_300_BB_29_S_0 = 7'd48;
+parameter [6:0] BPHLS_F_loops_300_BB_29_S_1 = 7'd49;
+parameter [6:0] BPHLS_F_loops_300_BB_30_S_0 = 7'd50;
+parameter [6:0] BPHLS_F_loops_300_BB_31_S_0 = 7'd51;
+parameter [6:0] BPHLS_F_loops_300_BB_32_S_0 = 7'd52;
+parameter [6:0] BPHLS_F_loops_300_BB_32_S_1 = 7'd53;
+parameter [6:0] BPHLS_F_loops_300_BB_32_S_2 = 7'd54;
+parameter [6:0] BPHLS_F_loops_300_BB_33_S_0 = 7'd55;
+parameter [6:0] BPHLS_F_loops_300_BB_33_S_1 = 7'd56;
+parameter [6:0] BPHLS_F_loops_300_BB_34_S_0 = 7'd57;
+parameter [6:0] BPHLS_F_loops_300_BB_34_S_1 = 7'd58;
+parameter [6:0] BPHLS_F_loops_300_BB_35_S_0 = 7'd59;
+parameter [6:0] BPHLS_F_loops_300_BB_36_S_0 = 7'd60;
+parameter [6:0] BPHLS_F_loops_300_BB_37_S_0 = 7'd61;
+parameter [6:0] BPHLS_F_loops_300_BB_37_S_1 = 7'd62;
+parameter [6:0] BPHLS_F_loops_300_BB_37_S_2 = 7'd63;
+parameter [6:0] BPHLS_F_loops_300_BB_38_S_0 = 7'd64;
+parameter [6:0] BPHLS_F_loops_300_BB_38_S_1 = 7'd65;
+parameter [6:0] BPHLS_F_loops_300_BB_39_S_0 = 7'd66;
+parameter [6:0] BPHLS_F_loops_300_BB_39_S_1 = 7'd67;
+parameter [6:0] BPHLS_F_loops_300_BB_40_S_0 = 7'd68;
+parameter [6:0] BPHLS_F_loops_300_BB_41_S_0 = 7'd69;
+parameter [6:0] BPHLS_F_loops_300_BB_42_S_0 = 7'd70;
+parameter [6:0] BPHLS_F_loops_300_BB_42_S_1 = 7'd71;
+parameter [6:0] BPHLS_F_loops_300_BB_43_S_0 = 7'd72;
+parameter [6:0] BPHLS_F_loops_300_BB_43_S_1 = 7'd73;
+parameter [6:0] BPHLS_F_loops_300_BB_44_S_0 = 7'd74;
+parameter [6:0] BPHLS_F_loops_300_BB_44_S_1 = 7'd75;
+parameter [6:0] BPHLS_F_loops_300_BB_45_S_0 = 7'd76;
+parameter [6:0] BPHLS_F_loops_300_BB_46_S_0 = 7'd77;
+parameter [6:0] BPHLS_F_loops_300_BB_47_S_0 = 7'd78;
+parameter [6:0] BPHLS_F_loops_300_BB_47_S_1 = 7'd79;
+parameter [6:0] BPHLS_F_loops_300_BB_48_S_0 = 7'd80;
+parameter [6:0] BPHLS_F_loops_300_BB_48_S_1 = 7'd81;
+parameter [6:0] BPHLS_F_loops_300_BB_49_S_0 = 7'd82;
+parameter [6:0] BPHLS_F_loops_300_BB_49_S_1 = 7'd83;
+parameter [6:0] BPHLS_F_loops_300_BB_50_S_0 = 7'd84;
+parameter [6:0] BPHLS_F_loops_300_BB_51_S_0 = 7'd85;
+parameter [6:0] BPHLS_F_loops_300_BB_52_S_0 = 7'd86;
+parameter [6:0] BPHLS_F_loops_300_BB_52_S_1 = 7'd87;
+parameter [6:0] BPHLS_F_loops_300_BB_53_S_0 = 7'd88;
+parameter [6:0] BPHLS_F_loops_300_BB_53_S_1 = 7'd89;
+parameter [6:0] BPHLS_F_loops_300_BB_54_S_0 = 7'd90;
+parameter [6:0] BPHLS_F_loops_300_BB_54_S_1 = 7'd91;
+parameter [6:0] BPHLS_F_loops_300_BB_55_S_0 = 7'd92;
+parameter [6:0] BPHLS_F_loops_300_BB_56_S_0 = 7'd93;
+parameter [6:0] BPHLS_F_loops_300_BB_57_S_0 = 7'd94;
+parameter [6:0] BPHLS_F_loops_300_BB_57_S_1 = 7'd95;
+parameter [6:0] BPHLS_F_loops_300_BB_58_S_0 = 7'd96;
+parameter [6:0] BPHLS_F_loops_300_BB_58_S_1 = 7'd97;
+parameter [6:0] BPHLS_F_loops_300_BB_59_S_0 = 7'd98;
+parameter [6:0] BPHLS_F_loops_300_BB_59_S_1 = 7'd99;
+parameter [6:0] BPHLS_F_loops_300_BB_60_S_0 = 7'd100;
+
+reg [6:0] cur_state;
+reg [6:0] next_state;
+wire [1:0] loops_300_loop0_8;
+reg [1:0] loops_300_loop0_8_reg;
+wire [63:0] loops_300_loop0_9;
+reg [63:0] loops_300_loop0_9_reg;
+wire [1:0] loops_300_loop1_10;
+reg [1:0] loops_300_loop1_10_reg;
+wire [63:0] loops_300_loop1_11;
+reg [63:0] loops_300_loop1_11_reg;
+wire [1:0] loops_300_loop2_12;
+reg [1:0] loops_300_loop2_12_reg;
+wire [63:0] loops_300_loop2_13;
+reg [63:0] loops_300_loop2_13_reg;
+reg [15:0] loops_300_loop2_14;
+reg [15:0] loops_300_loop2_14_reg;
+reg [31:0] loops_300_loop2_15;
+reg [31:0] loops_300_loop2_15_reg;
+reg [7:0] loops_300_loop2_17;
+reg [7:0] loops_300_loop2_17_reg;
+reg [7:0] loops_300_loop2_18;
+reg [7:0] loops_300_loop2_18_reg;
+reg [31:0] loops_300_loop2_19;
+reg [31:0] loops_300_loop2_19_reg;
+reg [15:0] loops_300_loop2_20;
+reg [15:0] loops_300_loop2_20_reg;
+reg [7:0] loops_300_loop2_21;
+reg [7:0] loops_300_loop2_21_reg;
+reg [63:0] loops_300_loop2_22;
+reg [63:0] loops_300_loop2_22_reg;
+reg [31:0] loops_300_loop2_23;
+reg [7:0] loops_300_loop2_23_reg;
+reg  loops_300_loop2_24;
+reg  loops_300_loop2_24_reg;
+reg [31:0] loops_300_exit2_25;
+reg [2:0] loops_300_exit2_25_reg;
+reg  loops_300_exit2_26;
+reg  loops_300_exit2_26_reg;
+reg [31:0] loops_300_exit1_27;
+reg [2:0] loops_300_exit1_27_reg;
+reg  loops_300_exit1_28;
+reg  loops_300_exit1_28_reg;
+wire [1:0] loops_300_loop01_29;
+reg [1:0] loops_300_loop01_29_reg;
+wire [63:0] loops_300_loop01_30;
+reg [63:0] loops_300_loop01_30_reg;
+wire [1:0] loops_300_loop12_31;
+reg [1:0] loops_300_loop12_31_reg;
+wire [63:0] loops_300_loop12_32;
+reg [63:0] loops_300_loop12_32_reg;
+wire [1:0] loops_300_loop23_33;
+reg [1:0] loops_300_loop23_33_reg;
+wire [63:0] loops_300_loop23_34;
+reg [63:0] loops_300_loop23_34_reg;
+reg [15:0] loops_300_loop23_35;
+reg [15:0] loops_300_loop23_35_reg;
+reg [63:0] loops_300_loop23_36;
+reg [63:0] loops_300_loop23_36_reg;
+reg [15:0] loops_300_loop23_38;
+reg [15:0] loops_300_loop23_38_reg;
+reg [7:0] loops_300_loop23_39;
+reg [7:0] loops_300_loop23_39_reg;
+reg [63:0] loops_300_loop23_40;
+reg [63:0] loops_300_loop23_40_reg;
+reg [7:0] loops_300_loop23_41;
+reg [7:0] loops_300_loop23_41_reg;
+reg [7:0] loops_300_loop23_42;
+reg [7:0] loops_300_loop23_42_reg;
+reg [63:0] loops_300_loop23_43;
+reg [63:0] loops_300_loop23_43_reg;
+reg [31:0] loops_300_loop23_44;
+reg [7:0] loops_300_loop23_44_reg;
+reg  loops_300_loop23_45;
+reg  loops_300_loop23_45_reg;
+reg [31:0] loops_300_exit24_46;
+reg [2:0] loops_300_exit24_46_reg;
+reg  loops_300_exit24_47;
+reg  loops_300_exit24_47_reg;
+reg [31:0] loops_300_exit15_48;
+reg [2:0] loops_300_exit15_48_reg;
+reg  loops_300_exit15_49;
+reg  loops_300_exit15_49_reg;
+wire [1:0] loops_300_loop07_50;
+reg [1:0] loops_300_loop07_50_reg;
+wire [63:0] loops_300_loop07_51;
+reg [63:0] loops_300_loop07_51_reg;
+wire [1:0] loops_300_loop18_52;
+reg [1:0] loops_300_loop18_52_reg;
+wire [63:0] loops_300_loop18_53;
+reg [63:0] loops_300_loop18_53_reg;
+wire [1:0] loops_300_loop29_54;
+reg [1:0] loops_300_loop29_54_reg;
+wire [63:0] loops_300_loop29_55;
+reg [63:0] loops_300_loop29_55_reg;
+reg [31:0] loops_300_loop29_57;
+reg [31:0] loops_300_loop29_57_reg;
+reg [31:0] loops_300_loop29_58;
+reg [31:0] loops_300_loop29_58_reg;
+reg [31:0] loops_300_loop29_59;
+reg [31:0] loops_300_loop29_59_reg;
+reg [63:0] loops_300_loop29_60;
+reg [63:0] loops_300_loop29_60_reg;
+reg [15:0] loops_300_loop29_61;
+reg [15:0] loops_300_loop29_61_reg;
+reg [31:0] loops_300_loop29_63;
+reg [31:0] loops_300_loop29_63_reg;
+reg [63:0] loops_300_loop29_64;
+reg [63:0] loops_300_loop29_64_reg;
+reg [31:0] loops_300_loop29_65;
+reg [2:0] loops_300_loop29_65_reg;
+reg  loops_300_loop29_66;
+reg  loops_300_loop29_66_reg;
+reg [31:0] loops_300_exit210_67;
+reg [2:0] loops_300_exit210_67_reg;
+reg  loops_300_exit210_68;
+reg  loops_300_exit210_68_reg;
+reg [31:0] loops_300_exit111_69;
+reg [2:0] loops_300_exit111_69_reg;
+reg  loops_300_exit111_70;
+reg  loops_300_exit111_70_reg;
+wire [1:0] loops_300_loop013_71;
+reg [1:0] loops_300_loop013_71_reg;
+wire [63:0] loops_300_loop013_72;
+reg [63:0] loops_300_loop013_72_reg;
+wire [1:0] loops_300_loop114_73;
+reg [1:0] loops_300_loop114_73_reg;
+wire [63:0] loops_300_loop114_74;
+reg [63:0] loops_300_loop114_74_reg;
+wire [1:0] loops_300_loop215_75;
+reg [1:0] loops_300_loop215_75_reg;
+wire [63:0] loops_300_loop215_76;
+reg [63:0] loops_300_loop215_76_reg;
+reg [7:0] loops_300_loop215_77;
+reg [7:0] loops_300_loop215_77_reg;
+reg [31:0] loops_300_loop215_79;
+reg [31:0] loops_300_loop215_79_reg;
+reg [15:0] loops_300_loop215_80;
+reg [15:0] loops_300_loop215_80_reg;
+reg [63:0] loops_300_loop215_81;
+reg [63:0] loops_300_loop215_81_reg;
+reg [7:0] loops_300_loop215_82;
+reg [7:0] loops_300_loop215_82_reg;
+reg [15:0] loops_300_loop215_83;
+reg [15:0] loops_300_loop215_83_reg;
+reg [31:0] loops_300_loop215_84;
+reg [31:0] loops_300_loop215_84_reg;
+reg [63:0] loops_300_loop215_85;
+reg [63:0] loops_300_loop215_85_reg;
+reg [31:0] loops_300_loop215_86;
+reg [2:0] loops_300_loop215_86_reg;
+reg  loops_300_loop215_87;
+reg  loops_300_loop215_87_reg;
+reg [31:0] loops_300_exit216_88;
+reg [2:0] loops_300_exit216_88_reg;
+reg  loops_300_exit216_89;
+reg  loops_300_exit216_89_reg;
+reg [31:0] loops_300_exit117_90;
+reg [2:0] loops_300_exit117_90_reg;
+reg  loops_300_exit117_91;
+reg  loops_300_exit117_91_reg;
+wire [1:0] loops_300_loop019_92;
+reg [1:0] loops_300_loop019_92_reg;
+wire [63:0] loops_300_loop019_93;
+reg [63:0] loops_300_loop019_93_reg;
+wire [1:0] loops_300_loop120_94;
+reg [1:0] loops_300_loop120_94_reg;
+wire [63:0] loops_300_loop120_95;
+reg [63:0] loops_300_loop120_95_reg;
+wire [1:0] loops_300_loop221_96;
+reg [1:0] loops_300_loop221_96_reg;
+wire [63:0] loops_300_loop221_97;
+reg [63:0] loops_300_loop221_97_reg;
+reg [63:0] loops_300_loop221_98;
+reg [63:0] loops_300_loop221_98_reg;
+reg [63:0] loops_300_loop221_99;
+reg [63:0] loops_300_loop221_99_reg;
+reg [7:0] loops_300_loop221_100;
+reg [7:0] loops_300_loop221_100_reg;
+reg [31:0] loops_300_loop221_101;
+reg [31:0] loops_300_loop221_101_reg;
+reg [7:0] loops_300_loop221_102;
+reg [7:0] loops_300_loop221_102_reg;
+reg [63:0] loops_300_loop221_103;
+reg [63:0] loops_300_loop221_103_reg;
+reg [7:0] loops_300_loop221_104;
+reg [7:0] loops_300_loop221_104_reg;
+reg [63:0] loops_300_loop221_105;
+reg [63:0] loops_300_loop221_105_reg;
+reg [63:0] loops_300_loop221_106;
+reg [63:0] loops_300_loop221_106_reg;
+reg [31:0] loops_300_loop221_107;
+reg [2:0] loops_300_loop221_107_reg;
+reg  loops_300_loop221_108;
+reg  loops_300_loop221_108_reg;
+reg [31:0] loops_300_exit222_109;
+reg [2:0] loops_300_exit222_109_reg;
+reg  loops_300_exit222_110;
+reg  loops_300_exit222_110_reg;
+reg [31:0] loops_300_exit123_111;
+reg [7:0] loops_300_exit123_111_reg;
+reg  loops_300_exit123_112;
+reg  loops_300_exit123_112_reg;
+wire [1:0] loops_300_loop025_113;
+reg [1:0] loops_300_loop025_113_reg;
+wire [63:0] loops_300_loop025_114;
+reg [63:0] loops_300_loop025_114_reg;
+wire [1:0] loops_300_loop126_115;
+reg [1:0] loops_300_loop126_115_reg;
+wire [63:0] loops_300_loop126_116;
+reg [63:0] loops_300_loop126_116_reg;
+wire [1:0] loops_300_loop227_117;
+reg [1:0] loops_300_loop227_117_reg;
+wire [63:0] loops_300_loop227_118;
+reg [63:0] loops_300_loop227_118_reg;
+reg [15:0] loops_300_loop227_119;
+reg [15:0] loops_300_loop227_119_reg;
+reg [7:0] loops_300_loop227_120;
+reg [7:0] loops_300_loop227_120_reg;
+reg [31:0] loops_300_loop227_121;
+reg [31:0] loops_300_loop227_121_reg;
+reg [63:0] loops_300_loop227_122;
+reg [63:0] loops_300_loop227_122_reg;
+reg [63:0] loops_300_loop227_124;
+reg [63:0] loops_300_loop227_124_reg;
+reg [31:0] loops_300_loop227_125;
+reg [31:0] loops_300_loop227_125_reg;
+reg [15:0] loops_300_loop227_126;
+reg [15:0] loops_300_loop227_126_reg;
+reg [63:0] loops_300_loop227_127;
+reg [63:0] loops_300_loop227_127_reg;
+reg [31:0] loops_300_loop227_128;
+reg [2:0] loops_300_loop227_128_reg;
+reg  loops_300_loop227_129;
+reg  loops_300_loop227_129_reg;
+reg [31:0] loops_300_exit228_130;
+reg [2:0] loops_300_exit228_130_reg;
+reg  loops_300_exit228_131;
+reg  loops_300_exit228_131_reg;
+reg [31:0] loops_300_exit129_132;
+reg [2:0] loops_300_exit129_132_reg;
+reg  loops_300_exit129_133;
+reg  loops_300_exit129_133_reg;
+wire [1:0] loops_300_loop031_134;
+reg [1:0] loops_300_loop031_134_reg;
+wire [63:0] loops_300_loop031_135;
+reg [63:0] loops_300_loop031_135_reg;
+wire [1:0] loops_300_loop132_136;
+reg [1:0] loops_300_loop132_136_reg;
+wire [63:0] loops_300_loop132_137;
+reg [63:0] loops_300_loop132_137_reg;
+wire [1:0] loops_300_loop233_138;
+reg [1:0] loops_300_loop233_138_reg;
+wire [63:0] loops_300_loop233_139;
+reg [63:0] loops_300_loop233_139_reg;
+reg [7:0] loops_300_loop233_140;
+reg [7:0] loops_300_loop233_140_reg;
+reg [63:0] loops_300_loop233_141;
+reg [63:0] loops_300_loop233_141_reg;
+reg [15:0] loops_300_loop233_142;
+reg [15:0] loops_300_loop233_142_reg;
+reg [7:0] loops_300_loop233_143;
+reg [7:0] loops_300_loop233_143_reg;
+reg [31:0] loops_300_loop233_145;
+reg [31:0] loops_300_loop233_145_reg;
+reg [7:0] loops_300_loop233_146;
+reg [7:0] loops_300_loop233_146_reg;
+reg [31:0] loops_300_loop233_147;
+reg [31:0] loops_300_loop233_147_reg;
+reg [63:0] loops_300_loop233_148;
+reg [63:0] loops_300_loop233_148_reg;
+reg [31:0] loops_300_loop233_149;
+reg [2:0] loops_300_loop233_149_reg;
+reg  loops_300_loop233_150;
+reg  loops_300_loop233_150_reg;
+reg [31:0] loops_300_exit234_151;
+reg [2:0] loops_300_exit234_151_reg;
+reg  loops_300_exit234_152;
+reg  loops_300_exit234_152_reg;
+reg [31:0] loops_300_exit135_153;
+reg [2:0] loops_300_exit135_153_reg;
+reg  loops_300_exit135_154;
+reg  loops_300_exit135_154_reg;
+wire [1:0] loops_300_loop037_155;
+reg [1:0] loops_300_loop037_155_reg;
+wire [63:0] loops_300_loop037_156;
+reg [63:0] loops_300_loop037_156_reg;
+wire [1:0] loops_300_loop138_157;
+reg [1:0] loops_300_loop138_157_reg;
+wire [63:0] loops_300_loop138_158;
+reg [63:0] loops_300_loop138_158_reg;
+wire [1:0] loops_300_loop239_159;
+reg [1:0] loops_300_loop239_159_reg;
+wire [63:0] loops_300_loop239_160;
+reg [63:0] loops_300_loop239_160_reg;
+reg [31:0] loops_300_loop239_161;
+reg [31:0] loops_300_loop239_161_reg;
+reg [31:0] loops_300_loop239_162;
+reg [31:0] loops_300_loop239_162_reg;
+reg [7:0] loops_300_loop239_164;
+reg [7:0] loops_300_loop239_164_reg;
+reg [31:0] loops_300_loop239_166;
+reg [31:0] loops_300_loop239_166_reg;
+reg [63:0] loops_300_loop239_168;
+reg [63:0] loops_300_loop239_168_reg;
+reg [63:0] loops_300_loop239_169;
+reg [63:0] loops_300_loop239_169_reg;
+reg [31:0] loops_300_loop239_170;
+reg [2:0] loops_300_loop239_170_reg;
+reg  loops_300_loop239_171;
+reg  loops_300_loop239_171_reg;
+reg [31:0] loops_300_exit240_172;
+reg [2:0] loops_300_exit240_172_reg;
+reg  loops_300_exit240_173;
+reg  loops_300_exit240_173_reg;
+reg [31:0] loops_300_exit141_174;
+reg [2:0] loops_300_exit141_174_reg;
+reg  loops_300_exit141_175;
+reg  loops_300_exit141_175_reg;
+wire [1:0] loops_300_loop043_176;
+reg [1:0] loops_300_loop043_176_reg;
+wire [63:0] loops_300_loop043_177;
+reg [63:0] loops_300_loop043_177_reg;
+wire [1:0] loops_300_loop144_178;
+reg [1:0] loops_300_loop144_178_reg;
+wire [63:0] loops_300_loop144_179;
+reg [63:0] loops_300_loop144_179_reg;
+wire [1:0] loops_300_loop245_180;
+reg [1:0] loops_300_loop245_180_reg;
+wire [63:0] loops_300_loop245_181;
+reg [63:0] loops_300_loop245_181_reg;
+reg [15:0] loops_300_loop245_182;
+reg [15:0] loops_300_loop245_182_reg;
+reg [15:0] loops_300_loop245_183;
+reg [15:0] loops_300_loop245_183_reg;
+reg [15:0] loops_300_loop245_184;
+reg [15:0] loops_300_loop245_184_reg;
+reg [7:0] loops_300_loop245_185;
+reg [7:0] loops_300_loop245_185_reg;
+reg [31:0] loops_300_loop245_186;
+reg [31:0] loops_300_loop245_186_reg;
+reg [15:0] loops_300_loop245_188;
+reg [15:0] loops_300_loop245_188_reg;
+reg [15:0] loops_300_loop245_189;
+reg [15:0] loops_300_loop245_189_reg;
+reg [63:0] loops_300_loop245_190;
+reg [63:0] loops_300_loop245_190_reg;
+reg [31:0] loops_300_loop245_191;
+reg [2:0] loops_300_loop245_191_reg;
+reg  loops_300_loop245_192;
+reg  loops_300_loop245_192_reg;
+reg [31:0] loops_300_exit246_193;
+reg [2:0] loops_300_exit246_193_reg;
+reg  loops_300_exit246_194;
+reg  loops_300_exit246_194_reg;
+reg [31:0] loops_300_exit147_195;
+reg [2:0] loops_300_exit147_195_reg;
+reg  loops_300_exit147_196;
+reg  loops_300_exit147_196_reg;
+wire [1:0] loops_300_loop049_197;
+reg [1:0] loops_300_loop049_197_reg;
+wire [63:0] loops_300_loop049_198;
+reg [63:0] loops_300_loop049_198_reg;
+wire [1:0] loops_300_loop150_199;
+reg [1:0] loops_300_loop150_199_reg;
+wire [63:0] loops_300_loop150_200;
+reg [63:0] loops_300_loop150_200_reg;
+wire [1:0] loops_300_loop251_201;
+reg [1:0] loops_300_loop251_201_reg;
+wire [63:0] loops_300_loop251_202;
+reg [63:0] loops_300_loop251_202_reg;
+reg [15:0] loops_300_loop251_204;
+reg [15:0] loops_300_loop251_204_reg;
+reg [15:0] loops_300_loop251_205;
+reg [15:0] loops_300_loop251_205_reg;
+reg [7:0] loops_300_loop251_206;
+reg  loops_300_loop251_206_reg;
+reg [63:0] loops_300_loop251_207;
+reg [63:0] loops_300_loop251_207_reg;
+reg [15:0] loops_300_loop251_208;
+reg [15:0] loops_300_loop251_208_reg;
+reg [7:0] loops_300_loop251_210;
+reg [7:0] loops_300_loop251_210_reg;
+reg [63:0] loops_300_loop251_211;
+reg [63:0] loops_300_loop251_211_reg;
+reg [31:0] loops_300_loop251_212;
+reg [2:0] loops_300_loop251_212_reg;
+reg  loops_300_loop251_213;
+reg  loops_300_loop251_213_reg;
+reg [31:0] loops_300_exit252_214;
+reg [2:0] loops_300_exit252_214_reg;
+reg  loops_300_exit252_215;
+reg  loops_300_exit252_215_reg;
+reg [31:0] loops_300_exit153_216;
+reg [2:0] loops_300_exit153_216_reg;
+reg  loops_300_exit153_217;
+reg  loops_300_exit153_217_reg;
+wire [1:0] loops_300_loop055_218;
+reg [1:0] loops_300_loop055_218_reg;
+wire [63:0] loops_300_loop055_219;
+reg [63:0] loops_300_loop055_219_reg;
+wire [1:0] loops_300_loop156_220;
+reg [1:0] loops_300_loop156_220_reg;
+wire [63:0] loops_300_loop156_221;
+reg [63:0] loops_300_loop156_221_reg;
+wire [1:0] loops_300_loop257_222;
+reg [1:0] loops_300_loop257_222_reg;
+wire [63:0] loops_300_loop257_223;
+reg [63:0] loops_300_loop257_223_reg;
+reg [15:0] loops_300_loop257_224;
+reg [15:0] loops_300_loop257_224_reg;
+reg [63:0] loops_300_loop257_225;
+reg [63:0] loops_300_loop257_225_reg;
+reg [31:0] loops_300_loop257_226;
+reg [31:0] loops_300_loop257_226_reg;
+reg [15:0] loops_300_loop257_229;
+reg [15:0] loops_300_loop257_229_reg;
+reg [63:0] loops_300_loop257_231;
+reg [63:0] loops_300_loop257_231_reg;
+reg [63:0] loops_300_loop257_232;
+reg [63:0] loops_300_loop257_232_reg;
+reg [31:0] loops_300_loop257_233;
+reg [2:0] loops_300_loop257_233_reg;
+reg  loops_300_loop257_234;
+reg  loops_300_loop257_234_reg;
+reg [31:0] loops_300_exit258_235;
+reg [2:0] loops_300_exit258_235_reg;
+reg  loops_300_exit258_236;
+reg  loops_300_exit258_236_reg;
+reg [31:0] loops_300_exit159_237;
+reg [2:0] loops_300_exit159_237_reg;
+reg  loops_300_exit159_238;
+reg  loops_300_exit159_238_reg;
+wire [1:0] loops_300_loop061_239;
+reg [1:0] loops_300_loop061_239_reg;
+wire [63:0] loops_300_loop061_240;
+reg [63:0] loops_300_loop061_240_reg;
+wire [1:0] loops_300_loop162_241;
+reg [1:0] loops_300_loop162_241_reg;
+wire [63:0] loops_300_loop162_242;
+reg [63:0] loops_300_loop162_242_reg;
+wire [1:0] loops_300_loop263_243;
+reg [1:0] loops_300_loop263_243_reg;
+wire [63:0] loops_300_loop263_244;
+reg [63:0] loops_300_loop263_244_reg;
+reg [7:0] loops_300_loop263_252;
+reg [7:0] loops_300_loop263_252_reg;
+reg [63:0] loops_300_loop263_253;
+reg [63:0] loops_300_loop263_253_reg;
+reg [31:0] loops_300_loop263_254;
+reg [2:0] loops_300_loop263_254_reg;
+reg  loops_300_loop263_255;
+reg  loops_300_loop263_255_reg;
+reg [31:0] loops_300_exit264_256;
+reg [2:0] loops_300_exit264_256_reg;
+reg  loops_300_exit264_257;
+reg  loops_300_exit264_257_reg;
+reg [31:0] loops_300_exit165_258;
+reg [2:0] loops_300_exit165_258_reg;
+reg  loops_300_exit165_259;
+reg  loops_300_exit165_259_reg;
+reg [15:0] loops_300_loop2_and_16_16_0_op0;
+reg [15:0] loops_300_loop2_and_16_16_0_op1;
+reg [15:0] loops_300_loop2_and_16_16_0;
+reg [2:0] loops_300_loop2_icmp_8_0_op0;
+reg [2:0] loops_300_loop2_icmp_8_0_op1;
+reg  loops_300_loop2_icmp_8_0;
+reg [7:0] loops_300_loop2_mul_8_8_0_op0;
+reg [7:0] loops_300_loop2_mul_8_8_0_op1;
+reg [7:0] loops_300_loop2_mul_8_8_0;
+reg [7:0] loops_300_loop2_add_8_8_0_op0;
+reg [7:0] loops_300_loop2_add_8_8_0_op1;
+reg [7:0] loops_300_loop2_add_8_8_0;
+reg [7:0] loops_300_loop2_and_8_8_0_op0;
+reg [7:0] loops_300_loop2_and_8_8_0_op1;
+reg [7:0] loops_300_loop2_and_8_8_0;
+reg [31:0] loops_300_loop2_or_32_32_0_op0;
+reg [31:0] loops_300_loop2_or_32_32_0_op1;
+reg [31:0] loops_300_loop2_or_32_32_0;
+reg [15:0] loops_300_loop2_add_16_16_0_op0;
+reg [15:0] loops_300_loop2_add_16_16_0_op1;
+reg [15:0] loops_300_loop2_add_16_16_0;
+reg [2:0] loops_300_exit2_icmp_8_0_op0;
+reg [2:0] loops_300_exit2_icmp_8_0_op1;
+reg  loops_300_exit2_icmp_8_0;
+reg [7:0] loops_300_exit2_add_8_8_0_op0;
+reg [7:0] loops_300_exit2_add_8_8_0_op1;
+reg [7:0] loops_300_exit2_add_8_8_0;
+reg [2:0] loops_300_exit1_icmp_8_0_op0;
+reg [2:0] loops_300_exit1_icmp_8_0_op1;
+reg  loops_300_exit1_icmp_8_0;
+reg [7:0] loops_300_exit1_add_8_8_0_op0;
+reg [7:0] loops_300_exit1_add_8_8_0_op1;
+reg [7:0] loops_300_exit1_add_8_8_0;
+reg [7:0] loops_300_loop23_or_8_8_0_op0;
+reg [7:0] loops_300_loop23_or_8_8_0_op1;
+reg [7:0] loops_300_loop23_or_8_8_0;
+reg [7:0] loops_300_loop23_add_8_8_0_op0;
+reg [7:0] loops_300_loop23_add_8_8_0_op1;
+reg [7:0] loops_300_loop23_add_8_8_0;
+reg [7:0] loops_300_loop23_add_8_8_1_op0;
+reg [7:0] loops_300_loop23_add_8_8_1_op1;
+reg [7:0] loops_300_loop23_add_8_8_1;
+reg [15:0] loops_300_loop23_add_16_16_0_op0;
+reg [15:0] loops_300_loop23_add_16_16_0_op1;
+reg [15:0] loops_300_loop23_add_16_16_0;
+reg [2:0] loops_300_loop23_icmp_8_0_op0;
+reg [2:0] loops_300_loop23_icmp_8_0_op1;
+reg  loops_300_loop23_icmp_8_0;
+reg [2:0] loops_300_exit24_icmp_8_0_op0;
+reg [2:0] loops_300_exit24_icmp_8_0_op1;
+reg  loops_300_exit24_icmp_8_0;
+reg [7:0] loops_300_exit24_add_8_8_1_op0;
+reg [7:0] loops_300_exit24_add_8_8_1_op1;
+reg [7:0] loops_300_exit24_add_8_8_1;
+reg [2:0] loops_300_exit15_icmp_8_0_op0;
+reg [2:0] loops_300_exit15_icmp_8_0_op1;
+reg  loops_300_exit15_icmp_8_0;
+reg [7:0] loops_300_exit15_add_8_8_0_op0;
+reg [7:0] loops_300_exit15_add_8_8_0_op1;
+reg [7:0] loops_300_exit15_add_8_8_0;
+reg [15:0] loops_300_loop29_and_16_16_0_op0;
+reg [15:0] loops_300_loop29_and_16_16_0_op1;
+reg [15:0] loops_300_loop29_and_16_16_0;
+reg [2:0] loops_300_loop29_icmp_8_0_op0;
+reg [2:0] loops_300_loop29_icmp_8_0_op1;
+reg  loops_300_loop29_icmp_8_0;
+reg [7:0] loops_300_loop29_add_8_8_1_op0;
+reg [7:0] loops_300_loop29_add_8_8_1_op1;
+reg [7:0] loops_300_loop29_add_8_8_1;
+reg [31:0] loops_300_loop29_and_32_32_0_op0;
+reg [31:0] loops_300_loop29_and_32_32_0_op1;
+reg [31:0] loops_300_loop29_and_32_32_0;
+reg [2:0] loops_300_exit210_icmp_8_0_op0;
+reg [2:0] loops_300_exit210_icmp_8_0_op1;
+reg  loops_300_exit210_icmp_8_0;
+reg [7:0] loops_300_exit210_add_8_8_0_op0;
+reg [7:0] loops_300_exit210_add_8_8_0_op1;
+reg [7:0] loops_300_exit210_add_8_8_0;
+reg [2:0] loops_300_exit111_icmp_8_0_op0;
+reg [2:0] loops_300_exit111_icmp_8_0_op1;
+reg  loops_300_exit111_icmp_8_0;
+reg [7:0] loops_300_exit111_add_8_8_1_op0;
+reg [7:0] loops_300_exit111_add_8_8_1_op1;
+reg [7:0] loops_300_exit111_add_8_8_1;
+reg [2:0] loops_300_loop215_icmp_8_0_op0;
+reg [2:0] loops_300_loop215_icmp_8_0_op1;
+reg  loops_300_loop215_icmp_8_0;
+reg [7:0] loops_300_loop215_mul_8_8_0_op0;
+reg [7:0] loops_300_loop215_mul_8_8_0_op1;
+reg [7:0] loops_300_loop215_mul_8_8_0;
+reg [7:0] loops_300_loop215_add_8_8_0_op0;
+reg [7:0] loops_300_loop215_add_8_8_0_op1;
+reg [7:0] loops_300_loop215_add_8_8_0;
+reg [15:0] loops_300_loop215_add_16_16_0_op0;
+reg [15:0] loops_300_loop215_add_16_16_0_op1;
+reg [15:0] loops_300_loop215_add_16_16_0;
+reg [15:0] loops_300_loop215_mul_16_16_0_op0;
+reg [15:0] loops_300_loop215_mul_16_16_0_op1;
+reg [15:0] loops_300_loop215_mul_16_16_0;
+reg [2:0] loops_300_exit216_icmp_8_0_op0;
+reg [2:0] loops_300_exit216_icmp_8_0_op1;
+reg  loops_300_exit216_icmp_8_0;
+reg [7:0] loops_300_exit216_add_8_8_1_op0;
+reg [7:0] loops_300_exit216_add_8_8_1_op1;
+reg [7:0] loops_300_exit216_add_8_8_1;
+reg [2:0] loops_300_exit117_icmp_8_0_op0;
+reg [2:0] loops_300_exit117_icmp_8_0_op1;
+reg  loops_300_exit117_icmp_8_0;
+reg [7:0] loops_300_exit117_add_8_8_0_op0;
+reg [7:0] loops_300_exit117_add_8_8_0_op1;
+reg [7:0] loops_300_exit117_add_8_8_0;
+reg [2:0] loops_300_loop221_icmp_8_0_op0;
+reg [2:0] loops_300_loop221_icmp_8_0_op1;
+reg  loops_300_loop221_icmp_8_0;
+reg [7:0] loops_300_loop221_add_8_8_1_op0;
+reg [7:0] loops_300_loop221_add_8_8_1_op1;
+reg [7:0] loops_300_loop221_add_8_8_1;
+reg [7:0] loops_300_loop221_add_8_8_0_op0;
+reg [7:0] loops_300_loop221_add_8_8_0_op1;
+reg [7:0] loops_300_loop221_add_8_8_0;
+reg [7:0] loops_300_loop221_and_8_8_0_op0;
+reg [7:0] loops_300_loop221_and_8_8_0_op1;
+reg [7:0] loops_300_loop221_and_8_8_0;
+reg [2:0] loops_300_exit222_icmp_8_0_op0;
+reg [2:0] loops_300_exit222_icmp_8_0_op1;
+reg  loops_300_exit222_icmp_8_0;
+reg [7:0] loops_300_exit222_add_8_8_0_op0;
+reg [7:0] loops_300_exit222_add_8_8_0_op1;
+reg [7:0] loops_300_exit222_add_8_8_0;
+reg [2:0] loops_300_exit123_icmp_8_0_op0;
+reg [2:0] loops_300_exit123_icmp_8_0_op1;
+reg  loops_300_exit123_icmp_8_0;
+reg [7:0] loops_300_exit123_add_8_8_1_op0;
+reg [7:0] loops_300_exit123_add_8_8_1_op1;
+reg [7:0] loops_300_exit123_add_8_8_1;
+reg [15:0] loops_300_loop227_and_16_16_0_op0;
+reg [15:0] loops_300_loop227_and_16_16_0_op1;
+reg [15:0] loops_300_loop227_and_16_16_0;
+reg [2:0] loops_300_loop227_icmp_8_0_op0;
+reg [2:0] loops_300_loop227_icmp_8_0_op1;
+reg  loops_300_loop227_icmp_8_0;
+reg [7:0] loops_300_loop227_or_8_8_0_op0;
+reg [7:0] loops_300_loop227_or_8_8_0_op1;
+reg [7:0] loops_300_loop227_or_8_8_0;
+reg [7:0] loops_300_loop227_add_8_8_0_op0;
+reg [7:0] loops_300_loop227_add_8_8_0_op1;
+reg [7:0] loops_300_loop227_add_8_8_0;
+reg [31:0] loops_300_loop227_or_32_32_0_op0;
+reg [31:0] loops_300_loop227_or_32_32_0_op1;
+reg [31:0] loops_300_loop227_or_32_32_0;
+reg [2:0] loops_300_exit228_icmp_8_0_op0;
+reg [2:0] loops_300_exit228_icmp_8_0_op1;
+reg  loops_300_exit228_icmp_8_0;
+reg [7:0] loops_300_exit228_add_8_8_1_op0;
+reg [7:0] loops_300_exit228_add_8_8_1_op1;
+reg [7:0] loops_300_exit228_add_8_8_1;
+reg [2:0] loops_300_exit129_icmp_8_0_op0;
+reg [2:0] loops_300_exit129_icmp_8_0_op1;
+reg  loops_300_exit129_icmp_8_0;
+reg [7:0] loops_300_exit129_add_8_8_0_op0;
+reg [7:0] loops_300_exit129_add_8_8_0_op1;
+reg [7:0] loops_300_exit129_add_8_8_0;
+reg [7:0] loops_300_loop233_add_8_8_0_op0;
+reg [7:0] loops_300_loop233_add_8_8_0_op1;
+reg [7:0] loops_300_loop233_add_8_8_0;
+reg [7:0] loops_300_loop233_add_8_8_1_op0;
+reg [7:0] loops_300_loop233_add_8_8_1_op1;
+reg [7:0] loops_300_loop233_add_8_8_1;
+reg [31:0] loops_300_loop233_and_32_32_0_op0;
+reg [31:0] loops_300_loop233_and_32_32_0_op1;
+reg [31:0] loops_300_loop233_and_32_32_0;
+reg [7:0] loops_300_loop233_and_8_8_0_op0;
+reg [7:0] loops_300_loop233_and_8_8_0_op1;
+reg [7:0] loops_300_loop233_and_8_8_0;
+reg [15:0] loops_300_loop233_add_16_16_0_op0;
+reg [15:0] loops_300_loop233_add_16_16_0_op1;
+reg [15:0] loops_300_loop233_add_16_16_0;
+reg [2:0] loops_300_loop233_icmp_8_0_op0;
+reg [2:0] loops_300_loop233_icmp_8_0_op1;
+reg  loops_300_loop233_icmp_8_0;
+reg [2:0] loops_300_exit234_icmp_8_0_op0;
+reg [2:0] loops_300_exit234_icmp_8_0_op1;
+reg  loops_300_exit234_icmp_8_0;
+reg [7:0] loops_300_exit234_add_8_8_1_op0;
+reg [7:0] loops_300_exit234_add_8_8_1_op1;
+reg [7:0] loops_300_exit234_add_8_8_1;
+reg [2:0] loops_300_exit135_icmp_8_0_op0;
+reg [2:0] loops_300_exit135_icmp_8_0_op1;
+reg  loops_300_exit135_icmp_8_0;
+reg [7:0] loops_300_exit135_add_8_8_0_op0;
+reg [7:0] loops_300_exit135_add_8_8_0_op1;
+reg [7:0] loops_300_exit135_add_8_8_0;
+reg [2:0] loops_300_loop239_icmp_8_0_op0;
+reg [2:0] loops_300_loop239_icmp_8_0_op1;
+reg  loops_300_loop239_icmp_8_0;
+reg [7:0] loops_300_loop239_mul_8_8_0_op0;
+reg [7:0] loops_300_loop239_mul_8_8_0_op1;
+reg [7:0] loops_300_loop239_mul_8_8_0;
+reg [31:0] loops_300_loop239_mul_32_32_0_op0;
+reg [31:0] loops_300_loop239_mul_32_32_0_op1;
+reg [31:0] loops_300_loop239_mul_32_32_0;
+reg [7:0] loops_300_loop239_add_8_8_1_op0;
+reg [7:0] loops_300_loop239_add_8_8_1_op1;
+reg [7:0] loops_300_loop239_add_8_8_1;
+reg [31:0] loops_300_loop239_and_32_32_0_op0;
+reg [31:0] loops_300_loop239_and_32_32_0_op1;
+reg [31:0] loops_300_loop239_and_32_32_0;
+reg [2:0] loops_300_exit240_icmp_8_0_op0;
+reg [2:0] loops_300_exit240_icmp_8_0_op1;
+reg  loops_300_exit240_icmp_8_0;
+reg [7:0] loops_300_exit240_add_8_8_0_op0;
+reg [7:0] loops_300_exit240_add_8_8_0_op1;
+reg [7:0] loops_300_exit240_add_8_8_0;
+reg [2:0] loops_300_exit141_icmp_8_0_op0;
+reg [2:0] loops_300_exit141_icmp_8_0_op1;
+reg  loops_300_exit141_icmp_8_0;
+reg [7:0] loops_300_exit141_add_8_8_1_op0;
+reg [7:0] loops_300_exit141_add_8_8_1_op1;
+reg [7:0] loops_300_exit141_add_8_8_1;
+reg [2:0] loops_300_loop245_icmp_8_0_op0;
+reg [2:0] loops_300_loop245_icmp_8_0_op1;
+reg  loops_300_loop245_icmp_8_0;
+reg [15:0] loops_300_loop245_or_16_16_0_op0;
+reg [15:0] loops_300_loop245_or_16_16_0_op1;
+reg [15:0] loops_300_loop245_or_16_16_0;
+reg [7:0] loops_300_loop245_add_8_8_0_op0;
+reg [7:0] loops_300_loop245_add_8_8_0_op1;
+reg [7:0] loops_300_loop245_add_8_8_0;
+reg [31:0] loops_300_loop245_and_32_32_0_op0;
+reg [31:0] loops_300_loop245_and_32_32_0_op1;
+reg [31:0] loops_300_loop245_and_32_32_0;
+reg [7:0] loops_300_loop245_and_8_8_0_op0;
+reg [7:0] loops_300_loop245_and_8_8_0_op1;
+reg [7:0] loops_300_loop245_and_8_8_0;
+reg [15:0] loops_300_loop245_add_16_16_0_op0;
+reg [15:0] loops_300_loop245_add_16_16_0_op1;
+reg [15:0] loops_300_loop245_add_16_16_0;
+reg [15:0] loops_300_loop245_add_16_16_1_op0;
+reg [15:0] loops_300_loop245_add_16_16_1_op1;
+reg [15:0] loops_300_loop245_add_16_16_1;
+reg [15:0] loops_300_loop245_mul_16_16_0_op0;
+reg [15:0] loops_300_loop245_mul_16_16_0_op1;
+reg [15:0] loops_300_loop245_mul_16_16_0;
+reg [2:0] loops_300_exit246_icmp_8_0_op0;
+reg [2:0] loops_300_exit246_icmp_8_0_op1;
+reg  loops_300_exit246_icmp_8_0;
+reg [7:0] loops_300_exit246_add_8_8_1_op0;
+reg [7:0] loops_300_exit246_add_8_8_1_op1;
+reg [7:0] loops_300_exit246_add_8_8_1;
+reg [2:0] loops_300_exit147_icmp_8_0_op0;
+reg [2:0] loops_300_exit147_icmp_8_0_op1;
+reg  loops_300_exit147_icmp_8_0;
+reg [7:0] loops_300_exit147_add_8_8_0_op0;
+reg [7:0] loops_300_exit147_add_8_8_0_op1;
+reg [7:0] loops_300_exit147_add_8_8_0;
+reg [2:0] loops_300_loop251_icmp_8_0_op0;
+reg [2:0] loops_300_loop251_icmp_8_0_op1;
+reg  loops_300_loop251_icmp_8_0;
+reg [15:0] loops_300_loop251_or_16_16_0_op0;
+reg [15:0] loops_300_loop251_or_16_16_0_op1;
+reg [15:0] loops_300_loop251_or_16_16_0;
+reg [7:0] loops_300_loop251_add_8_8_1_op0;
+reg [7:0] loops_300_loop251_add_8_8_1_op1;
+reg [7:0] loops_300_loop251_add_8_8_1;
+reg [15:0] loops_300_loop251_add_16_16_1_op0;
+reg [15:0] loops_300_loop251_add_16_16_1_op1;
+reg [15:0] loops_300_loop251_add_16_16_1;
+reg [15:0] loops_300_loop251_mul_16_16_0_op0;
+reg [15:0] loops_300_loop251_mul_16_16_0_op1;
+reg [15:0] loops_300_loop251_mul_16_16_0;
+reg [2:0] loops_300_exit252_icmp_8_0_op0;
+reg [2:0] loops_300_exit252_icmp_8_0_op1;
+reg  loops_300_exit252_icmp_8_0;
+reg [7:0] loops_300_exit252_add_8_8_0_op0;
+reg [7:0] loops_300_exit252_add_8_8_0_op1;
+reg [7:0] loops_300_exit252_add_8_8_0;
+reg [2:0] loops_300_exit153_icmp_8_0_op0;
+reg [2:0] loops_300_exit153_icmp_8_0_op1;
+reg  loops_300_exit153_icmp_8_0;
+reg [7:0] loops_300_exit153_add_8_8_1_op0;
+reg [7:0] loops_300_exit153_add_8_8_1_op1;
+reg [7:0] loops_300_exit153_add_8_8_1;
+reg [2:0] loops_300_loop257_icmp_8_0_op0;
+reg [2:0] loops_300_loop257_icmp_8_0_op1;
+reg  loops_300_loop257_icmp_8_0;
+reg [7:0] loops_300_loop257_add_8_8_0_op0;
+reg [7:0] loops_300_loop257_add_8_8_0_op1;
+reg [7:0] loops_300_loop257_add_8_8_0;
+reg [7:0] loops_300_loop257_and_8_8_0_op0;
+reg [7:0] loops_300_loop257_and_8_8_0_op1;
+reg [7:0] loops_300_loop257_and_8_8_0;
+reg [31:0] loops_300_loop257_or_32_32_0_op0;
+reg [31:0] loops_300_loop257_or_32_32_0_op1;
+reg [31:0] loops_300_loop257_or_32_32_0;
+reg [15:0] loops_300_loop257_mul_16_16_0_op0;
+reg [15:0] loops_300_loop257_mul_16_16_0_op1;
+reg [15:0] loops_300_loop257_mul_16_16_0;
+reg [2:0] loops_300_exit258_icmp_8_0_op0;
+reg [2:0] loops_300_exit258_icmp_8_0_op1;
+reg  loops_300_exit258_icmp_8_0;
+reg [7:0] loops_300_exit258_add_8_8_1_op0;
+reg [7:0] loops_300_exit258_add_8_8_1_op1;
+reg [7:0] loops_300_exit258_add_8_8_1;
+reg [2:0] loops_300_exit159_icmp_8_0_op0;
+reg [2:0] loops_300_exit159_icmp_8_0_op1;
+reg  loops_300_exit159_icmp_8_0;
+reg [7:0] loops_300_exit159_add_8_8_0_op0;
+reg [7:0] loops_300_exit159_add_8_8_0_op1;
+reg [7:0] loops_300_exit159_add_8_8_0;
+reg [2:0] loops_300_loop263_icmp_8_0_op0;
+reg [2:0] loops_300_loop263_icmp_8_0_op1;
+reg  loops_300_loop263_icmp_8_0;
+reg [7:0] loops_300_loop263_mul_8_8_0_op0;
+reg [7:0] loops_300_loop263_mul_8_8_0_op1;
+reg [7:0] loops_300_loop263_mul_8_8_0;
+reg [7:0] loops_300_loop263_add_8_8_1_op0;
+reg [7:0] loops_300_loop263_add_8_8_1_op1;
+reg [7:0] loops_300_loop263_add_8_8_1;
+reg [7:0] loops_300_loop263_add_8_8_0_op0;
+reg [7:0] loops_300_loop263_add_8_8_0_op1;
+reg [7:0] loops_300_loop263_add_8_8_0;
+reg [15:0] loops_300_loop263_add_16_16_1_op0;
+reg [15:0] loops_300_loop263_add_16_16_1_op1;
+reg [15:0] loops_300_loop263_add_16_16_1;
+reg [2:0] loops_300_exit264_icmp_8_0_op0;
+reg [2:0] loops_300_exit264_icmp_8_0_op1;
+reg  loops_300_exit264_icmp_8_0;
+reg [7:0] loops_300_exit264_add_8_8_0_op0;
+reg [7:0] loops_300_exit264_add_8_8_0_op1;
+reg [7:0] loops_300_exit264_add_8_8_0;
+reg [2:0] loops_300_exit165_icmp_8_0_op0;
+reg [2:0] loops_300_exit165_icmp_8_0_op1;
+reg  loops_300_exit165_icmp_8_0;
+reg [7:0] loops_300_exit165_add_8_8_1_op0;
+reg [7:0] loops_300_exit165_add_8_8_1_op1;
+reg [7:0] loops_300_exit165_add_8_8_1;
+reg [63:0] loops_300_loop2_16;
+reg [7:0] loops_300_loop23_37;
+reg [63:0] loops_300_loop29_56;
+reg [63:0] loops_300_loop29_62;
+reg [63:0] loops_300_loop215_78;
+reg [15:0] loops_300_loop227_123;
+reg [63:0] loops_300_loop233_144;
+reg [63:0] loops_300_loop239_167;
+reg [31:0] loops_300_loop239_165;
+reg [31:0] loops_300_loop239_163;
+reg [31:0] loops_300_loop245_187;
+reg [63:0] loops_300_loop251_203;
+reg [63:0] loops_300_loop251_209;
+reg [15:0] loops_300_loop257_227;
+reg [7:0] loops_300_loop257_228;
+reg [31:0] loops_300_loop257_230;
+reg [63:0] loops_300_loop263_245;
+reg [15:0] loops_300_loop263_246;
+reg [7:0] loops_300_loop263_247;
+reg [15:0] loops_300_loop263_248;
+reg [7:0] loops_300_loop263_249;
+reg [15:0] loops_300_loop263_250;
+reg [63:0] loops_300_loop263_251;
+
+/* FSM BEGIN ---------------------------------------------------------------*/
+
+always @ (posedge clk) begin
+	if (reset == 1'b1) begin
+		cur_state <= BPHLS;
+	end else begin 
+		cur_state <= next_state;
+	end
+end
+
+always @ (*) begin
+	next_state = cur_state;
+
+	case (cur_state)
+	BPHLS:
+		if ((start == 1'd1)) begin
+			next_state = BPHLS_F_loops_300_BB_0_S_0;
+		end
+	BPHLS_F_loops_300_BB_0_S_0:
+		next_state = BPHLS_F_loops_300_BB_1_S_0;
+	BPHLS_F_loops_300_BB_10_S_0:
+		next_state = BPHLS_F_loops_300_BB_11_S_0;
+	BPHLS_F_loops_300_BB_11_S_0:
+		next_state = BPHLS_F_loops_300_BB_12_S_0;
+	BPHLS_F_loops_300_BB_12_S_0:
+		next_state = BPHLS_F_loops_300_BB_12_S_1;
+	BPHLS_F_loops_300_BB_12_S_1:
+		if ((loops_300_loop29_66_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_300_BB_12_S_0;
+		end
+		else if ((loops_300_loop29_66_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_300_BB_13_S_0;
+		end
+	BPHLS_F_loops_300_BB_13_S_0:
+		next_state = BPHLS_F_loops_300_BB_13_S_1;
+	BPHLS_F_loops_300_BB_13_S_1:
+		if ((loops_300_exit210_68_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_300_BB_11_S_0;
+		end
+		else if ((loops_300_exit210_68_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_300_BB_14_S_0;
+		end
+	BPHLS_F_loops_300_BB_14_S_0:
+		next_state = BPHLS_F_loops_300_BB_14_S_1;
+	BPHLS_F_loops_300_BB_14_S_1:
+		if ((loops_300_exit111_70_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_300_BB_10_S_0;
+		end
+		else if ((loops_300_exit111_70_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_300_BB_15_S_0;
+		end
+	BPHLS_F_loops_300_BB_15_S_0:
+		next_state = BPHLS_F_loops_300_BB_16_S_0;
+	BPHLS_F_loops_300_BB_16_S_0:
+		next_state = BPHLS_F_loops_300_BB_17_S_0;
+	BPHLS_F_loops_300_BB_17_S_0:
+		next_state = BPHLS_F_loops_300_BB_17_S_1;
+	BPHLS_F_loops_300_BB_17_S_1:
+		if ((loops_300_loop215_87_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_300_BB_17_S_0;
+		end
+		else if ((loops_300_loop215_87_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_300_BB_18_S_0;
+		end
+	BPHLS_F_loops_300_BB_18_S_0:
+		next_state = BPHLS_F_loops_300_BB_18_S_1;
+	BPHLS_F_loops_300_BB_18_S_1:
+		if ((loops_300_exit216_89_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_300_BB_16_S_0;
+		end
+		else if ((loops_300_exit216_89_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_300_BB_19_S_0;
+		end
+	BPHLS_F_loops_300_BB_19_S_0:
+		next_state = BPHLS_F_loops_300_BB_19_S_1;
+	BPHLS_F_loops_300_BB_19_S_1:
+		if ((loops_300_exit117_91_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_300_BB_15_S_0;
+		end
+		else if ((loops_300_exit117_91_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_300_BB_20_S_0;
+		end
+	BPHLS_F_loops_300_BB_1_S_0:
+		next_state = BPHLS_F_loops_300_BB_2_S_0;
+	BPHLS_F_loops_300_BB_20_S_0:
+		next_state = BPHLS_F_loops_300_BB_21_S_0;
+	BPHLS_F_loops_300_BB_21_S_0:
+		next_state = BPHLS_F_loops_300_BB_22_S_0;
+	BPHLS_F_loops_300_BB_22_S_0:
+		next_state = BPHLS_F_loops_300_BB_22_S_1;
+	BPHLS_F_loops_300_BB_22_S_1:
+		if ((loops_300_loop221_108_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_300_BB_22_S_0;
+		end
+		else if ((loops_300_loop221_108_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_300_BB_23_S_0;
+		end
+	BPHLS_F_loops_300_BB_23_S_0:
+		next_state = BPHLS_F_loops_300_BB_23_S_1;
+	BPHLS_F_loops_300_BB_23_S_1:
+		if ((loops_300_exit222_110_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_300_BB_21_S_0;
+		end
+		else if ((loops_300_exit222_110_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_300_BB_24_S_0;
+		end
+	BPHLS_F_loops_300_BB_24_S_0:
+		next_state = BPHLS_F_loops_300_BB_24_S_1;
+	BPHLS_F_loops_300_BB_24_S_1:
+		if ((loops_300_exit123_112_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_300_BB_20_S_0;
+		end
+		else if ((loops_300_exit123_112_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_300_BB_25_S_0;
+		end
+	BPHLS_F_loops_300_BB_25_S_0:
+		next_state = BPHLS_F_loops_300_BB_26_S_0;
+	BPHLS_F_loops_300_BB_26_S_0:
+		next_state = BPHLS_F_loops_300_BB_27_S_0;
+	BPHLS_F_loops_300_BB_27_S_0:
+		next_state = BPHLS_F_loops_300_BB_27_S_1;
+	BPHLS_F_loops_300_BB_27_S_1:
+		if ((loops_300_loop227_129_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_300_BB_27_S_0;
+		end
+		else if ((loops_300_loop227_129_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_300_BB_28_S_0;
+		end
+	BPHLS_F_loops_300_BB_28_S_0:
+		next_state = BPHLS_F_loops_300_BB_28_S_1;
+	BPHLS_F_loops_300_BB_28_S_1:
+		if ((loops_300_exit228_131_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_300_BB_26_S_0;
+		end
+		else if ((loops_300_exit228_131_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_300_BB_29_S_0;
+		end
+	BPHLS_F_loops_300_BB_29_S_0:
+		next_state = BPHLS_F_loops_300_BB_29_S_1;
+	BPHLS_F_loops_300_BB_29_S_1:
+		if ((loops_300_exit129_133_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_300_BB_25_S_0;
+		end
+		else if ((loops_300_exit129_133_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_300_BB_30_S_0;
+		end
+	BPHLS_F_loops_300_BB_2_S_0:
+		next_state = BPHLS_F_loops_300_BB_2_S_1;
+	BPHLS_F_loops_300_BB_2_S_1:
+		if ((loops_300_loop2_24_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_300_BB_2_S_0;
+		end
+		else if ((loops_300_loop2_24_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_300_BB_3_S_0;
+		end
+	BPHLS_F_loops_300_BB_30_S_0:
+		next_state = BPHLS_F_loops_300_BB_31_S_0;
+	BPHLS_F_loops_300_BB_31_S_0:
+		next_state = BPHLS_F_loops_300_BB_32_S_0;
+	BPHLS_F_loops_300_BB_32_S_0:
+		next_state = BPHLS_F_loops_300_BB_32_S_1;
+	BPHLS_F_loops_300_BB_32_S_1:
+		next_state = BPHLS_F_loops_300_BB_32_S_2;
+	BPHLS_F_loops_300_BB_32_S_2:
+		if ((loops_300_loop233_150_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_300_BB_32_S_0;
+		end
+		else if ((loops_300_loop233_150_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_300_BB_33_S_0;
+		end
+	BPHLS_F_loops_300_BB_33_S_0:
+		next_state = BPHLS_F_loops_300_BB_33_S_1;
+	BPHLS_F_loops_300_BB_33_S_1:
+		if ((loops_300_exit234_152_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_300_BB_31_S_0;
+		end
+		else if ((loops_300_exit234_152_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_300_BB_34_S_0;
+		end
+	BPHLS_F_loops_300_BB_34_S_0:
+		next_state = BPHLS_F_loops_300_BB_34_S_1;
+	BPHLS_F_loops_300_BB_34_S_1:
+		if ((loops_300_exit135_154_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_300_BB_30_S_0;
+		end
+		else if ((loops_300_exit135_154_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_300_BB_35_S_0;
+		end
+	BPHLS_F_loops_300_BB_35_S_0:
+		next_state = BPHLS_F_loops_300_BB_36_S_0;
+	BPHLS_F_loops_300_BB_36_S_0:
+		next_state = BPHLS_F_loops_300_BB_37_S_0;
+	BPHLS_F_loops_300_BB_37_S_0:
+		next_state = BPHLS_F_loops_300_BB_37_S_1;
+	BPHLS_F_loops_300_BB_37_S_1:
+		next_state = BPHLS_F_loops_300_BB_37_S_2;
+	BPHLS_F_loops_300_BB_37_S_2:
+		if ((loops_300_loop239_171_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_300_BB_37_S_0;
+		end
+		else if ((loops_300_loop239_171_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_300_BB_38_S_0;
+		end
+	BPHLS_F_loops_300_BB_38_S_0:
+		next_state = BPHLS_F_loops_300_BB_38_S_1;
+	BPHLS_F_loops_300_BB_38_S_1:
+		if ((loops_300_exit240_173_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_300_BB_36_S_0;
+		end
+		else if ((loops_300_exit240_173_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_300_BB_39_S_0;
+		end
+	BPHLS_F_loops_300_BB_39_S_0:
+		next_state = BPHLS_F_loops_300_BB_39_S_1;
+	BPHLS_F_loops_300_BB_39_S_1:
+		if ((loops_300_exit141_175_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_300_BB_35_S_0;
+		end
+		else if ((loops_300_exit141_175_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_300_BB_40_S_0;
+		end
+	BPHLS_F_loops_300_BB_3_S_0:
+		next_state = BPHLS_F_loops_300_BB_3_S_1;
+	BPHLS_F_loops_300_BB_3_S_1:
+		if ((loops_300_exit2_26_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_300_BB_1_S_0;
+		end
+		else if ((loops_300_exit2_26_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_300_BB_4_S_0;
+		end
+	BPHLS_F_loops_300_BB_40_S_0:
+		next_state = BPHLS_F_loops_300_BB_41_S_0;
+	BPHLS_F_loops_300_BB_41_S_0:
+		next_state = BPHLS_F_loops_300_BB_42_S_0;
+	BPHLS_F_loops_300_BB_42_S_0:
+		next_state = BPHLS_F_loops_300_BB_42_S_1;
+	BPHLS_F_loops_300_BB_42_S_1:
+		if ((loops_300_loop245_192_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_300_BB_42_S_0;
+		end
+		else if ((loops_300_loop245_192_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_300_BB_43_S_0;
+		end
+	BPHLS_F_loops_300_BB_43_S_0:
+		next_state = BPHLS_F_loops_300_BB_43_S_1;
+	BPHLS_F_loops_300_BB_43_S_1:
+		if ((loops_300_exit246_194_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_300_BB_41_S_0;
+		end
+		else if ((loops_300_exit246_194_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_300_BB_44_S_0;
+		end
+	BPHLS_F_loops_300_BB_44_S_0:
+		next_state = BPHLS_F_loops_300_BB_44_S_1;
+	BPHLS_F_loops_300_BB_44_S_1:
+		if ((loops_300_exit147_196_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_300_BB_40_S_0;
+		end
+		else if ((loops_300_exit147_196_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_300_BB_45_S_0;
+		end
+	BPHLS_F_loops_300_BB_45_S_0:
+		next_state = BPHLS_F_loops_300_BB_46_S_0;
+	BPHLS_F_loops_300_BB_46_S_0:
+		next_state = BPHLS_F_loops_300_BB_47_S_0;
+	BPHLS_F_loops_300_BB_47_S_0:
+		next_state = BPHLS_F_loops_300_BB_47_S_1;
+	BPHLS_F_loops_300_BB_47_S_1:
+		if ((loops_300_loop251_213_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_300_BB_47_S_0;
+		end
+		else if ((loops_300_loop251_213_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_300_BB_48_S_0;
+		end
+	BPHLS_F_loops_300_BB_48_S_0:
+		next_state = BPHLS_F_loops_300_BB_48_S_1;
+	BPHLS_F_loops_300_BB_48_S_1:
+		if ((loops_300_exit252_215_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_300_BB_46_S_0;
+		end
+		else if ((loops_300_exit252_215_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_300_BB_49_S_0;
+		end
+	BPHLS_F_loops_300_BB_49_S_0:
+		next_state = BPHLS_F_loops_300_BB_49_S_1;
+	BPHLS_F_loops_300_BB_49_S_1:
+		if ((loops_300_exit153_217_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_300_BB_45_S_0;
+		end
+		else if ((loops_300_exit153_217_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_300_BB_50_S_0;
+		end
+	BPHLS_F_loops_300_BB_4_S_0:
+		next_state = BPHLS_F_loops_300_BB_4_S_1;
+	BPHLS_F_loops_300_BB_4_S_1:
+		if ((loops_300_exit1_28_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_300_BB_0_S_0;
+		end
+		else if ((loops_300_exit1_28_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_300_BB_5_S_0;
+		end
+	BPHLS_F_loops_300_BB_50_S_0:
+		next_state = BPHLS_F_loops_300_BB_51_S_0;
+	BPHLS_F_loops_300_BB_51_S_0:
+		next_state = BPHLS_F_loops_300_BB_52_S_0;
+	BPHLS_F_loops_300_BB_52_S_0:
+		next_state = BPHLS_F_loops_300_BB_52_S_1;
+	BPHLS_F_loops_300_BB_52_S_1:
+		if ((loops_300_loop257_234_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_300_BB_52_S_0;
+		end
+		else if ((loops_300_loop257_234_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_300_BB_53_S_0;
+		end
+	BPHLS_F_loops_300_BB_53_S_0:
+		next_state = BPHLS_F_loops_300_BB_53_S_1;
+	BPHLS_F_loops_300_BB_53_S_1:
+		if ((loops_300_exit258_236_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_300_BB_51_S_0;
+		end
+		else if ((loops_300_exit258_236_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_300_BB_54_S_0;
+		end
+	BPHLS_F_loops_300_BB_54_S_0:
+		next_state = BPHLS_F_loops_300_BB_54_S_1;
+	BPHLS_F_loops_300_BB_54_S_1:
+		if ((loops_300_exit159_238_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_300_BB_50_S_0;
+		end
+		else if ((loops_300_exit159_238_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_300_BB_55_S_0;
+		end
+	BPHLS_F_loops_300_BB_55_S_0:
+		next_state = BPHLS_F_loops_300_BB_56_S_0;
+	BPHLS_F_loops_300_BB_56_S_0:
+		next_state = BPHLS_F_loops_300_BB_57_S_0;
+	BPHLS_F_loops_300_BB_57_S_0:
+		next_state = BPHLS_F_loops_300_BB_57_S_1;
+	BPHLS_F_loops_300_BB_57_S_1:
+		if ((loops_300_loop263_255_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_300_BB_57_S_0;
+		end
+		else if ((loops_300_loop263_255_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_300_BB_58_S_0;
+		end
+	BPHLS_F_loops_300_BB_58_S_0:
+		next_state = BPHLS_F_loops_300_BB_58_S_1;
+	BPHLS_F_loops_300_BB_58_S_1:
+		if ((loops_300_exit264_257_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_300_BB_56_S_0;
+		end
+		else if ((loops_300_exit264_257_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_300_BB_59_S_0;
+		end
+	BPHLS_F_loops_300_BB_59_S_0:
+		next_state = BPHLS_F_loops_300_BB_59_S_1;
+	BPHLS_F_loops_300_BB_59_S_1:
+		if ((loops_300_exit165_259_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_300_BB_55_S_0;
+		end
+		else if ((loops_300_exit165_259_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_300_BB_60_S_0;
+		end
+	BPHLS_F_loops_300_BB_5_S_0:
+		next_state = BPHLS_F_loops_300_BB_6_S_0;
+	BPHLS_F_loops_300_BB_60_S_0:
+		next_state = BPHLS;
+	BPHLS_F_loops_300_BB_6_S_0:
+		next_state = BPHLS_F_loops_300_BB_7_S_0;
+	BPHLS_F_loops_300_BB_7_S_0:
+		next_state = BPHLS_F_loops_300_BB_7_S_1;
+	BPHLS_F_loops_300_BB_7_S_1:
+		next_state = BPHLS_F_loops_300_BB_7_S_2;
+	BPHLS_F_loops_300_BB_7_S_2:
+		if ((loops_300_loop23_45_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_300_BB_7_S_0;
+		end
+		else if ((loops_300_loop23_45_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_300_BB_8_S_0;
+		end
+	BPHLS_F_loops_300_BB_8_S_0:
+		next_state = BPHLS_F_loops_300_BB_8_S_1;
+	BPHLS_F_loops_300_BB_8_S_1:
+		if ((loops_300_exit24_47_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_300_BB_6_S_0;
+		end
+		else if ((loops_300_exit24_47_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_300_BB_9_S_0;
+		end
+	BPHLS_F_loops_300_BB_9_S_0:
+		next_state = BPHLS_F_loops_300_BB_9_S_1;
+	BPHLS_F_loops_300_BB_9_S_1:
+		if ((loops_300_exit15_49_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_300_BB_5_S_0;
+		end
+		else if ((loops_300_exit15_49_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_300_BB_10_S_0;
+		end
+	default:
+		next_state = cur_state;
+	endcase
+end
+
+/* FSM END -----------------------------------------------------------------*/
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS) & (start == 1'd1))) begin
+		loops_300_loop0_8_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_4_S_1) & (loops_300_exit1_28_reg == 1'd1))) begin
+		loops_300_loop0_8_reg[1:0] <= loops_300_exit1_27_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS) & (start == 1'd1))) begin
+		loops_300_loop0_9_reg[63:0] <= arg_7[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_4_S_1) & (loops_300_exit1_28_reg == 1'd1))) begin
+		loops_300_loop0_9_reg[63:0] <= loops_300_loop2_22_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_0_S_0)) begin
+		loops_300_loop1_10_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_3_S_1) & (loops_300_exit2_26_reg == 1'd1))) begin
+		loops_300_loop1_10_reg[1:0] <= loops_300_exit2_25_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_0_S_0)) begin
+		loops_300_loop1_11_reg[63:0] <= loops_300_loop0_9_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_3_S_1) & (loops_300_exit2_26_reg == 1'd1))) begin
+		loops_300_loop1_11_reg[63:0] <= loops_300_loop2_22_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_1_S_0)) begin
+		loops_300_loop2_12_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_2_S_1) & (loops_300_loop2_24_reg == 1'd1))) begin
+		loops_300_loop2_12_reg[1:0] <= loops_300_loop2_23_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_1_S_0)) begin
+		loops_300_loop2_13_reg[63:0] <= loops_300_loop1_11_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_2_S_1) & (loops_300_loop2_24_reg == 1'd1))) begin
+		loops_300_loop2_13_reg[63:0] <= loops_300_loop2_22_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop2_14[15:0] = loops_300_loop2_add_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_2_S_0)) begin
+		loops_300_loop2_14_reg[15:0] <= loops_300_loop2_14[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_7_S_0)) begin
+		loops_300_loop2_14_reg[15:0] <= loops_300_loop23_35[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_17_S_0)) begin
+		loops_300_loop2_14_reg[15:0] <= loops_300_loop215_80[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop2_15[31:0] = loops_300_loop2_or_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_2_S_0)) begin
+		loops_300_loop2_15_reg[31:0] <= loops_300_loop2_15[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_27_S_0)) begin
+		loops_300_loop2_15_reg[31:0] <= loops_300_loop227_125[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_52_S_0)) begin
+		loops_300_loop2_15_reg[31:0] <= loops_300_loop257_226[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop2_17[7:0] = loops_300_loop2_mul_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_2_S_0)) begin
+		loops_300_loop2_17_reg[7:0] <= loops_300_loop2_17[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_17_S_0)) begin
+		loops_300_loop2_17_reg[7:0] <= loops_300_loop215_77[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_37_S_0)) begin
+		loops_300_loop2_17_reg[7:0] <= loops_300_loop239_164[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop2_18[7:0] = loops_300_loop2_and_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_2_S_0)) begin
+		loops_300_loop2_18_reg[7:0] <= loops_300_loop2_18[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_32_S_0)) begin
+		loops_300_loop2_18_reg[7:0] <= loops_300_loop233_146[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop2_19[31:0] = (arg_5 ^ arg_3);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_2_S_0)) begin
+		loops_300_loop2_19_reg[31:0] <= loops_300_loop2_19[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop2_20[15:0] = loops_300_loop2_and_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_2_S_0)) begin
+		loops_300_loop2_20_reg[15:0] <= loops_300_loop2_20[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop2_21[7:0] = (loops_300_loop2_17 - loops_300_loop2_18);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_2_S_0)) begin
+		loops_300_loop2_21_reg[7:0] <= loops_300_loop2_21[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop2_22[63:0] = (loops_300_loop2_13_reg + loops_300_loop2_21);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_2_S_0)) begin
+		loops_300_loop2_22_reg[63:0] <= loops_300_loop2_22[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop2_23[31:0] = loops_300_loop2_add_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_2_S_0)) begin
+		loops_300_loop2_23_reg[7:0] <= loops_300_loop2_23[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_3_S_0)) begin
+		loops_300_loop2_23_reg[7:0] <= loops_300_exit2_25[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_4_S_0)) begin
+		loops_300_loop2_23_reg[7:0] <= loops_300_exit1_27[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_9_S_0)) begin
+		loops_300_loop2_23_reg[7:0] <= loops_300_exit15_48[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_13_S_0)) begin
+		loops_300_loop2_23_reg[7:0] <= loops_300_exit210_67[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_17_S_0)) begin
+		loops_300_loop2_23_reg[7:0] <= loops_300_loop215_86[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_19_S_0)) begin
+		loops_300_loop2_23_reg[7:0] <= loops_300_exit117_90[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_22_S_0)) begin
+		loops_300_loop2_23_reg[7:0] <= loops_300_loop221_107[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_23_S_0)) begin
+		loops_300_loop2_23_reg[7:0] <= loops_300_exit222_109[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_27_S_0)) begin
+		loops_300_loop2_23_reg[7:0] <= loops_300_loop227_128[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_29_S_0)) begin
+		loops_300_loop2_23_reg[7:0] <= loops_300_exit129_132[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_32_S_0)) begin
+		loops_300_loop2_23_reg[7:0] <= loops_300_loop233_140[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_48_S_0)) begin
+		loops_300_loop2_23_reg[7:0] <= loops_300_exit252_214[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_52_S_0)) begin
+		loops_300_loop2_23_reg[7:0] <= loops_300_loop257_233[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_54_S_0)) begin
+		loops_300_loop2_23_reg[7:0] <= loops_300_exit159_237[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_57_S_0)) begin
+		loops_300_loop2_23_reg[7:0] <= loops_300_loop263_254[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_58_S_0)) begin
+		loops_300_loop2_23_reg[7:0] <= loops_300_exit264_256[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop2_24 = loops_300_loop2_icmp_8_0;
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_2_S_0)) begin
+		loops_300_loop2_24_reg <= loops_300_loop2_24;
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_3_S_0)) begin
+		loops_300_loop2_24_reg <= loops_300_exit2_26;
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_4_S_0)) begin
+		loops_300_loop2_24_reg <= loops_300_exit1_28;
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_7_S_1)) begin
+		loops_300_loop2_24_reg <= loops_300_loop23_45;
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_8_S_0)) begin
+		loops_300_loop2_24_reg <= loops_300_exit24_47;
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_9_S_0)) begin
+		loops_300_loop2_24_reg <= loops_300_exit15_49;
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_12_S_0)) begin
+		loops_300_loop2_24_reg <= loops_300_loop29_66;
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_13_S_0)) begin
+		loops_300_loop2_24_reg <= loops_300_exit210_68;
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_14_S_0)) begin
+		loops_300_loop2_24_reg <= loops_300_exit111_70;
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_17_S_0)) begin
+		loops_300_loop2_24_reg <= loops_300_loop215_87;
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_18_S_0)) begin
+		loops_300_loop2_24_reg <= loops_300_exit216_89;
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_19_S_0)) begin
+		loops_300_loop2_24_reg <= loops_300_exit117_91;
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_22_S_0)) begin
+		loops_300_loop2_24_reg <= loops_300_loop221_108;
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_23_S_0)) begin
+		loops_300_loop2_24_reg <= loops_300_exit222_110;
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_24_S_0)) begin
+		loops_300_loop2_24_reg <= loops_300_exit123_112;
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_27_S_0)) begin
+		loops_300_loop2_24_reg <= loops_300_loop227_129;
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_28_S_0)) begin
+		loops_300_loop2_24_reg <= loops_300_exit228_131;
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_29_S_0)) begin
+		loops_300_loop2_24_reg <= loops_300_exit129_133;
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_32_S_1)) begin
+		loops_300_loop2_24_reg <= loops_300_loop233_150;
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_33_S_0)) begin
+		loops_300_loop2_24_reg <= loops_300_exit234_152;
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_34_S_0)) begin
+		loops_300_loop2_24_reg <= loops_300_exit135_154;
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_37_S_0)) begin
+		loops_300_loop2_24_reg <= loops_300_loop239_171;
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_38_S_0)) begin
+		loops_300_loop2_24_reg <= loops_300_exit240_173;
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_39_S_0)) begin
+		loops_300_loop2_24_reg <= loops_300_exit141_175;
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_42_S_0)) begin
+		loops_300_loop2_24_reg <= loops_300_loop245_192;
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_43_S_0)) begin
+		loops_300_loop2_24_reg <= loops_300_exit246_194;
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_44_S_0)) begin
+		loops_300_loop2_24_reg <= loops_300_exit147_196;
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_47_S_0)) begin
+		loops_300_loop2_24_reg <= loops_300_loop251_213;
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_48_S_0)) begin
+		loops_300_loop2_24_reg <= loops_300_exit252_215;
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_49_S_0)) begin
+		loops_300_loop2_24_reg <= loops_300_exit153_217;
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_52_S_0)) begin
+		loops_300_loop2_24_reg <= loops_300_loop257_234;
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_53_S_0)) begin
+		loops_300_loop2_24_reg <= loops_300_exit258_236;
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_54_S_0)) begin
+		loops_300_loop2_24_reg <= loops_300_exit159_238;
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_57_S_0)) begin
+		loops_300_loop2_24_reg <= loops_300_loop263_255;
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_58_S_0)) begin
+		loops_300_loop2_24_reg <= loops_300_exit264_257;
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_59_S_0)) begin
+		loops_300_loop2_24_reg <= loops_300_exit165_259;
+	end
+end
+
+always @ (*) begin
+	loops_300_exit2_25[31:0] = loops_300_exit2_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_300_exit2_25_reg[2:0] = loops_300_loop2_23_reg[2:0];
+end
+
+always @ (*) begin
+	loops_300_exit2_26 = loops_300_exit2_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_300_exit2_26_reg = loops_300_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_300_exit1_27[31:0] = loops_300_exit1_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_300_exit1_27_reg[2:0] = loops_300_loop2_23_reg[2:0];
+end
+
+always @ (*) begin
+	loops_300_exit1_28 = loops_300_exit1_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_300_exit1_28_reg = loops_300_loop2_24_reg;
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_300_BB_4_S_1) & (loops_300_exit1_28_reg == 1'd0))) begin
+		loops_300_loop01_29_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_9_S_1) & (loops_300_exit15_49_reg == 1'd1))) begin
+		loops_300_loop01_29_reg[1:0] <= loops_300_exit15_48_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_300_BB_4_S_1) & (loops_300_exit1_28_reg == 1'd0))) begin
+		loops_300_loop01_30_reg[63:0] <= loops_300_loop2_22_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_9_S_1) & (loops_300_exit15_49_reg == 1'd1))) begin
+		loops_300_loop01_30_reg[63:0] <= loops_300_loop23_43_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_5_S_0)) begin
+		loops_300_loop12_31_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_8_S_1) & (loops_300_exit24_47_reg == 1'd1))) begin
+		loops_300_loop12_31_reg[1:0] <= loops_300_exit24_46_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_5_S_0)) begin
+		loops_300_loop12_32_reg[63:0] <= loops_300_loop01_30_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_8_S_1) & (loops_300_exit24_47_reg == 1'd1))) begin
+		loops_300_loop12_32_reg[63:0] <= loops_300_loop23_43_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_6_S_0)) begin
+		loops_300_loop23_33_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_7_S_2) & (loops_300_loop23_45_reg == 1'd1))) begin
+		loops_300_loop23_33_reg[1:0] <= loops_300_loop23_44_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_6_S_0)) begin
+		loops_300_loop23_34_reg[63:0] <= loops_300_loop12_32_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_7_S_2) & (loops_300_loop23_45_reg == 1'd1))) begin
+		loops_300_loop23_34_reg[63:0] <= loops_300_loop23_43_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop23_35[15:0] = loops_300_loop23_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	loops_300_loop23_35_reg[15:0] = loops_300_loop2_14_reg[15:0];
+end
+
+always @ (*) begin
+	loops_300_loop23_36[63:0] = (arg_7 + arg_7);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_7_S_0)) begin
+		loops_300_loop23_36_reg[63:0] <= loops_300_loop23_36[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop23_38[15:0] = (loops_300_loop2_20_reg ^ loops_300_loop23_35);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_7_S_0)) begin
+		loops_300_loop23_38_reg[15:0] <= loops_300_loop23_38[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop23_39[7:0] = loops_300_loop23_or_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_7_S_0)) begin
+		loops_300_loop23_39_reg[7:0] <= loops_300_loop23_39[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop23_40[63:0] = (loops_300_loop23_36 - loops_300_loop23_34_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_7_S_0)) begin
+		loops_300_loop23_40_reg[63:0] <= loops_300_loop23_40[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop23_41[7:0] = loops_300_loop23_or_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_7_S_1)) begin
+		loops_300_loop23_41_reg[7:0] <= loops_300_loop23_41[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_27_S_0)) begin
+		loops_300_loop23_41_reg[7:0] <= loops_300_loop227_120[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop23_42[7:0] = loops_300_loop23_add_8_8_1[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_7_S_0)) begin
+		loops_300_loop23_42_reg[7:0] <= loops_300_loop23_42[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_37_S_0)) begin
+		loops_300_loop23_42_reg[7:0] <= loops_300_loop239_170[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_39_S_0)) begin
+		loops_300_loop23_42_reg[7:0] <= loops_300_exit141_174[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_43_S_0)) begin
+		loops_300_loop23_42_reg[7:0] <= loops_300_exit246_193[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_47_S_0)) begin
+		loops_300_loop23_42_reg[7:0] <= loops_300_loop251_212[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_49_S_0)) begin
+		loops_300_loop23_42_reg[7:0] <= loops_300_exit153_216[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_53_S_0)) begin
+		loops_300_loop23_42_reg[7:0] <= loops_300_exit258_235[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_59_S_0)) begin
+		loops_300_loop23_42_reg[7:0] <= loops_300_exit165_258[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop23_43[63:0] = (loops_300_loop23_34_reg + loops_300_loop23_42);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_7_S_0)) begin
+		loops_300_loop23_43_reg[63:0] <= loops_300_loop23_43[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop23_44[31:0] = loops_300_loop23_add_8_8_1[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_7_S_1)) begin
+		loops_300_loop23_44_reg[7:0] <= loops_300_loop23_44[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_8_S_0)) begin
+		loops_300_loop23_44_reg[7:0] <= loops_300_exit24_46[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_12_S_0)) begin
+		loops_300_loop23_44_reg[7:0] <= loops_300_loop29_65[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_14_S_0)) begin
+		loops_300_loop23_44_reg[7:0] <= loops_300_exit111_69[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_18_S_0)) begin
+		loops_300_loop23_44_reg[7:0] <= loops_300_exit216_88[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_22_S_0)) begin
+		loops_300_loop23_44_reg[7:0] <= loops_300_loop221_104[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop23_45 = loops_300_loop23_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_300_loop23_45_reg = loops_300_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_300_exit24_46[31:0] = loops_300_exit24_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_300_exit24_46_reg[2:0] = loops_300_loop23_44_reg[2:0];
+end
+
+always @ (*) begin
+	loops_300_exit24_47 = loops_300_exit24_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_300_exit24_47_reg = loops_300_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_300_exit15_48[31:0] = loops_300_exit15_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_300_exit15_48_reg[2:0] = loops_300_loop2_23_reg[2:0];
+end
+
+always @ (*) begin
+	loops_300_exit15_49 = loops_300_exit15_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_300_exit15_49_reg = loops_300_loop2_24_reg;
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_300_BB_9_S_1) & (loops_300_exit15_49_reg == 1'd0))) begin
+		loops_300_loop07_50_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_14_S_1) & (loops_300_exit111_70_reg == 1'd1))) begin
+		loops_300_loop07_50_reg[1:0] <= loops_300_exit111_69_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_300_BB_9_S_1) & (loops_300_exit15_49_reg == 1'd0))) begin
+		loops_300_loop07_51_reg[63:0] <= loops_300_loop23_43_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_14_S_1) & (loops_300_exit111_70_reg == 1'd1))) begin
+		loops_300_loop07_51_reg[63:0] <= loops_300_loop29_64_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_10_S_0)) begin
+		loops_300_loop18_52_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_13_S_1) & (loops_300_exit210_68_reg == 1'd1))) begin
+		loops_300_loop18_52_reg[1:0] <= loops_300_exit210_67_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_10_S_0)) begin
+		loops_300_loop18_53_reg[63:0] <= loops_300_loop07_51_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_13_S_1) & (loops_300_exit210_68_reg == 1'd1))) begin
+		loops_300_loop18_53_reg[63:0] <= loops_300_loop29_64_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_11_S_0)) begin
+		loops_300_loop29_54_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_12_S_1) & (loops_300_loop29_66_reg == 1'd1))) begin
+		loops_300_loop29_54_reg[1:0] <= loops_300_loop29_65_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_11_S_0)) begin
+		loops_300_loop29_55_reg[63:0] <= loops_300_loop18_53_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_12_S_1) & (loops_300_loop29_66_reg == 1'd1))) begin
+		loops_300_loop29_55_reg[63:0] <= loops_300_loop29_64_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop29_57[31:0] = (arg_5 - arg_4);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_12_S_0)) begin
+		loops_300_loop29_57_reg[31:0] <= loops_300_loop29_57[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop29_58[31:0] = loops_300_loop29_and_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_12_S_0)) begin
+		loops_300_loop29_58_reg[31:0] <= loops_300_loop29_58[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_32_S_0)) begin
+		loops_300_loop29_58_reg[31:0] <= loops_300_loop233_147[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop29_59[31:0] = loops_300_loop29_and_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_12_S_1)) begin
+		loops_300_loop29_59_reg[31:0] <= loops_300_loop29_59[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_37_S_0)) begin
+		loops_300_loop29_59_reg[31:0] <= loops_300_loop239_166[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop29_60[63:0] = (loops_300_loop23_40_reg + loops_300_loop23_34_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_12_S_0)) begin
+		loops_300_loop29_60_reg[63:0] <= loops_300_loop29_60[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop29_61[15:0] = loops_300_loop29_and_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_12_S_0)) begin
+		loops_300_loop29_61_reg[15:0] <= loops_300_loop29_61[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop29_63[31:0] = (loops_300_loop2_15_reg ^ arg_5);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_12_S_0)) begin
+		loops_300_loop29_63_reg[31:0] <= loops_300_loop29_63[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop29_64[63:0] = (loops_300_loop29_55_reg + loops_300_loop29_63);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_12_S_0)) begin
+		loops_300_loop29_64_reg[63:0] <= loops_300_loop29_64[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop29_65[31:0] = loops_300_loop29_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop29_65_reg[2:0] = loops_300_loop23_44_reg[2:0];
+end
+
+always @ (*) begin
+	loops_300_loop29_66 = loops_300_loop29_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_300_loop29_66_reg = loops_300_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_300_exit210_67[31:0] = loops_300_exit210_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_300_exit210_67_reg[2:0] = loops_300_loop2_23_reg[2:0];
+end
+
+always @ (*) begin
+	loops_300_exit210_68 = loops_300_exit210_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_300_exit210_68_reg = loops_300_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_300_exit111_69[31:0] = loops_300_exit111_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_300_exit111_69_reg[2:0] = loops_300_loop23_44_reg[2:0];
+end
+
+always @ (*) begin
+	loops_300_exit111_70 = loops_300_exit111_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_300_exit111_70_reg = loops_300_loop2_24_reg;
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_300_BB_14_S_1) & (loops_300_exit111_70_reg == 1'd0))) begin
+		loops_300_loop013_71_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_19_S_1) & (loops_300_exit117_91_reg == 1'd1))) begin
+		loops_300_loop013_71_reg[1:0] <= loops_300_exit117_90_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_300_BB_14_S_1) & (loops_300_exit111_70_reg == 1'd0))) begin
+		loops_300_loop013_72_reg[63:0] <= loops_300_loop29_64_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_19_S_1) & (loops_300_exit117_91_reg == 1'd1))) begin
+		loops_300_loop013_72_reg[63:0] <= loops_300_loop215_85_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_15_S_0)) begin
+		loops_300_loop114_73_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_18_S_1) & (loops_300_exit216_89_reg == 1'd1))) begin
+		loops_300_loop114_73_reg[1:0] <= loops_300_exit216_88_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_15_S_0)) begin
+		loops_300_loop114_74_reg[63:0] <= loops_300_loop013_72_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_18_S_1) & (loops_300_exit216_89_reg == 1'd1))) begin
+		loops_300_loop114_74_reg[63:0] <= loops_300_loop215_85_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_16_S_0)) begin
+		loops_300_loop215_75_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_17_S_1) & (loops_300_loop215_87_reg == 1'd1))) begin
+		loops_300_loop215_75_reg[1:0] <= loops_300_loop215_86_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_16_S_0)) begin
+		loops_300_loop215_76_reg[63:0] <= loops_300_loop114_74_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_17_S_1) & (loops_300_loop215_87_reg == 1'd1))) begin
+		loops_300_loop215_76_reg[63:0] <= loops_300_loop215_85_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop215_77[7:0] = loops_300_loop215_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop215_77_reg[7:0] = loops_300_loop2_17_reg[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop215_79[31:0] = (loops_300_loop29_58_reg ^ loops_300_loop2_15_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_17_S_0)) begin
+		loops_300_loop215_79_reg[31:0] <= loops_300_loop215_79[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop215_80[15:0] = loops_300_loop215_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	loops_300_loop215_80_reg[15:0] = loops_300_loop2_14_reg[15:0];
+end
+
+always @ (*) begin
+	loops_300_loop215_81[63:0] = (loops_300_loop29_55_reg | loops_300_loop23_40_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_17_S_0)) begin
+		loops_300_loop215_81_reg[63:0] <= loops_300_loop215_81[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop215_82[7:0] = (loops_300_loop2_18_reg ^ loops_300_loop23_41_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_17_S_0)) begin
+		loops_300_loop215_82_reg[7:0] <= loops_300_loop215_82[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop215_83[15:0] = loops_300_loop215_mul_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_17_S_0)) begin
+		loops_300_loop215_83_reg[15:0] <= loops_300_loop215_83[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_42_S_0)) begin
+		loops_300_loop215_83_reg[15:0] <= loops_300_loop245_188[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop215_84[31:0] = (loops_300_loop29_58_reg ^ loops_300_loop29_59_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_17_S_0)) begin
+		loops_300_loop215_84_reg[31:0] <= loops_300_loop215_84[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop215_85[63:0] = (loops_300_loop215_76_reg + loops_300_loop215_84);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_17_S_0)) begin
+		loops_300_loop215_85_reg[63:0] <= loops_300_loop215_85[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop215_86[31:0] = loops_300_loop215_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop215_86_reg[2:0] = loops_300_loop2_23_reg[2:0];
+end
+
+always @ (*) begin
+	loops_300_loop215_87 = loops_300_loop215_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_300_loop215_87_reg = loops_300_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_300_exit216_88[31:0] = loops_300_exit216_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_300_exit216_88_reg[2:0] = loops_300_loop23_44_reg[2:0];
+end
+
+always @ (*) begin
+	loops_300_exit216_89 = loops_300_exit216_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_300_exit216_89_reg = loops_300_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_300_exit117_90[31:0] = loops_300_exit117_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_300_exit117_90_reg[2:0] = loops_300_loop2_23_reg[2:0];
+end
+
+always @ (*) begin
+	loops_300_exit117_91 = loops_300_exit117_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_300_exit117_91_reg = loops_300_loop2_24_reg;
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_300_BB_19_S_1) & (loops_300_exit117_91_reg == 1'd0))) begin
+		loops_300_loop019_92_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_24_S_1) & (loops_300_exit123_112_reg == 1'd1))) begin
+		loops_300_loop019_92_reg[1:0] <= loops_300_exit123_111_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_300_BB_19_S_1) & (loops_300_exit117_91_reg == 1'd0))) begin
+		loops_300_loop019_93_reg[63:0] <= loops_300_loop215_85_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_24_S_1) & (loops_300_exit123_112_reg == 1'd1))) begin
+		loops_300_loop019_93_reg[63:0] <= loops_300_loop221_106_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_20_S_0)) begin
+		loops_300_loop120_94_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_23_S_1) & (loops_300_exit222_110_reg == 1'd1))) begin
+		loops_300_loop120_94_reg[1:0] <= loops_300_exit222_109_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_20_S_0)) begin
+		loops_300_loop120_95_reg[63:0] <= loops_300_loop019_93_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_23_S_1) & (loops_300_exit222_110_reg == 1'd1))) begin
+		loops_300_loop120_95_reg[63:0] <= loops_300_loop221_106_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_21_S_0)) begin
+		loops_300_loop221_96_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_22_S_1) & (loops_300_loop221_108_reg == 1'd1))) begin
+		loops_300_loop221_96_reg[1:0] <= loops_300_loop221_107_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_21_S_0)) begin
+		loops_300_loop221_97_reg[63:0] <= loops_300_loop120_95_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_22_S_1) & (loops_300_loop221_108_reg == 1'd1))) begin
+		loops_300_loop221_97_reg[63:0] <= loops_300_loop221_106_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop221_98[63:0] = (loops_300_loop215_81_reg | loops_300_loop215_81_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_22_S_0)) begin
+		loops_300_loop221_98_reg[63:0] <= loops_300_loop221_98[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop221_99[63:0] = (loops_300_loop221_97_reg ^ loops_300_loop29_63_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_22_S_0)) begin
+		loops_300_loop221_99_reg[63:0] <= loops_300_loop221_99[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop221_100[7:0] = loops_300_loop221_and_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_22_S_0)) begin
+		loops_300_loop221_100_reg[7:0] <= loops_300_loop221_100[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_42_S_0)) begin
+		loops_300_loop221_100_reg[7:0] <= loops_300_loop245_185[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop221_101[31:0] = (loops_300_loop215_84_reg - loops_300_loop2_19_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_22_S_0)) begin
+		loops_300_loop221_101_reg[31:0] <= loops_300_loop221_101[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop221_102[7:0] = loops_300_loop221_and_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_22_S_1)) begin
+		loops_300_loop221_102_reg[7:0] <= loops_300_loop221_102[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop221_103[63:0] = (loops_300_loop221_99_reg * loops_300_loop29_60_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_22_S_1)) begin
+		loops_300_loop221_103_reg[63:0] <= loops_300_loop221_103[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop221_104[7:0] = loops_300_loop221_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop221_104_reg[7:0] = loops_300_loop23_44_reg[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop221_105[63:0] = (loops_300_loop221_98 | loops_300_loop215_77_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_22_S_0)) begin
+		loops_300_loop221_105_reg[63:0] <= loops_300_loop221_105[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop221_106[63:0] = (loops_300_loop221_97_reg + loops_300_loop221_105);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_22_S_0)) begin
+		loops_300_loop221_106_reg[63:0] <= loops_300_loop221_106[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop221_107[31:0] = loops_300_loop221_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop221_107_reg[2:0] = loops_300_loop2_23_reg[2:0];
+end
+
+always @ (*) begin
+	loops_300_loop221_108 = loops_300_loop221_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_300_loop221_108_reg = loops_300_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_300_exit222_109[31:0] = loops_300_exit222_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_300_exit222_109_reg[2:0] = loops_300_loop2_23_reg[2:0];
+end
+
+always @ (*) begin
+	loops_300_exit222_110 = loops_300_exit222_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_300_exit222_110_reg = loops_300_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_300_exit123_111[31:0] = loops_300_exit123_add_8_8_1[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_24_S_0)) begin
+		loops_300_exit123_111_reg[7:0] <= loops_300_exit123_111[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_28_S_0)) begin
+		loops_300_exit123_111_reg[7:0] <= loops_300_exit228_130[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_32_S_0)) begin
+		loops_300_exit123_111_reg[7:0] <= loops_300_loop233_143[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_exit123_112 = loops_300_exit123_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_300_exit123_112_reg = loops_300_loop2_24_reg;
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_300_BB_24_S_1) & (loops_300_exit123_112_reg == 1'd0))) begin
+		loops_300_loop025_113_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_29_S_1) & (loops_300_exit129_133_reg == 1'd1))) begin
+		loops_300_loop025_113_reg[1:0] <= loops_300_exit129_132_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_300_BB_24_S_1) & (loops_300_exit123_112_reg == 1'd0))) begin
+		loops_300_loop025_114_reg[63:0] <= loops_300_loop221_106_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_29_S_1) & (loops_300_exit129_133_reg == 1'd1))) begin
+		loops_300_loop025_114_reg[63:0] <= loops_300_loop227_127_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_25_S_0)) begin
+		loops_300_loop126_115_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_28_S_1) & (loops_300_exit228_131_reg == 1'd1))) begin
+		loops_300_loop126_115_reg[1:0] <= loops_300_exit228_130_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_25_S_0)) begin
+		loops_300_loop126_116_reg[63:0] <= loops_300_loop025_114_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_28_S_1) & (loops_300_exit228_131_reg == 1'd1))) begin
+		loops_300_loop126_116_reg[63:0] <= loops_300_loop227_127_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_26_S_0)) begin
+		loops_300_loop227_117_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_27_S_1) & (loops_300_loop227_129_reg == 1'd1))) begin
+		loops_300_loop227_117_reg[1:0] <= loops_300_loop227_128_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_26_S_0)) begin
+		loops_300_loop227_118_reg[63:0] <= loops_300_loop126_116_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_27_S_1) & (loops_300_loop227_129_reg == 1'd1))) begin
+		loops_300_loop227_118_reg[63:0] <= loops_300_loop227_127_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop227_119[15:0] = loops_300_loop227_and_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_27_S_0)) begin
+		loops_300_loop227_119_reg[15:0] <= loops_300_loop227_119[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop227_120[7:0] = loops_300_loop227_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop227_120_reg[7:0] = loops_300_loop23_41_reg[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop227_121[31:0] = (loops_300_loop29_58_reg - loops_300_loop29_63_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_27_S_0)) begin
+		loops_300_loop227_121_reg[31:0] <= loops_300_loop227_121[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop227_122[63:0] = (loops_300_loop221_105_reg ^ loops_300_loop221_103_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_27_S_0)) begin
+		loops_300_loop227_122_reg[63:0] <= loops_300_loop227_122[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop227_124[63:0] = (loops_300_loop221_99_reg * loops_300_loop215_83_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_27_S_0)) begin
+		loops_300_loop227_124_reg[63:0] <= loops_300_loop227_124[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop227_125[31:0] = loops_300_loop227_or_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_300_loop227_125_reg[31:0] = loops_300_loop2_15_reg[31:0];
+end
+
+always @ (*) begin
+	loops_300_loop227_126[15:0] = (loops_300_loop2_20_reg ^ loops_300_loop29_61_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_27_S_0)) begin
+		loops_300_loop227_126_reg[15:0] <= loops_300_loop227_126[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop227_127[63:0] = (loops_300_loop227_118_reg + loops_300_loop227_126);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_27_S_0)) begin
+		loops_300_loop227_127_reg[63:0] <= loops_300_loop227_127[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop227_128[31:0] = loops_300_loop227_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop227_128_reg[2:0] = loops_300_loop2_23_reg[2:0];
+end
+
+always @ (*) begin
+	loops_300_loop227_129 = loops_300_loop227_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_300_loop227_129_reg = loops_300_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_300_exit228_130[31:0] = loops_300_exit228_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_300_exit228_130_reg[2:0] = loops_300_exit123_111_reg[2:0];
+end
+
+always @ (*) begin
+	loops_300_exit228_131 = loops_300_exit228_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_300_exit228_131_reg = loops_300_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_300_exit129_132[31:0] = loops_300_exit129_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_300_exit129_132_reg[2:0] = loops_300_loop2_23_reg[2:0];
+end
+
+always @ (*) begin
+	loops_300_exit129_133 = loops_300_exit129_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_300_exit129_133_reg = loops_300_loop2_24_reg;
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_300_BB_29_S_1) & (loops_300_exit129_133_reg == 1'd0))) begin
+		loops_300_loop031_134_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_34_S_1) & (loops_300_exit135_154_reg == 1'd1))) begin
+		loops_300_loop031_134_reg[1:0] <= loops_300_exit135_153_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_300_BB_29_S_1) & (loops_300_exit129_133_reg == 1'd0))) begin
+		loops_300_loop031_135_reg[63:0] <= loops_300_loop227_127_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_34_S_1) & (loops_300_exit135_154_reg == 1'd1))) begin
+		loops_300_loop031_135_reg[63:0] <= loops_300_loop233_148_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_30_S_0)) begin
+		loops_300_loop132_136_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_33_S_1) & (loops_300_exit234_152_reg == 1'd1))) begin
+		loops_300_loop132_136_reg[1:0] <= loops_300_exit234_151_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_30_S_0)) begin
+		loops_300_loop132_137_reg[63:0] <= loops_300_loop031_135_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_33_S_1) & (loops_300_exit234_152_reg == 1'd1))) begin
+		loops_300_loop132_137_reg[63:0] <= loops_300_loop233_148_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_31_S_0)) begin
+		loops_300_loop233_138_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_32_S_2) & (loops_300_loop233_150_reg == 1'd1))) begin
+		loops_300_loop233_138_reg[1:0] <= loops_300_loop233_149_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_31_S_0)) begin
+		loops_300_loop233_139_reg[63:0] <= loops_300_loop132_137_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_32_S_2) & (loops_300_loop233_150_reg == 1'd1))) begin
+		loops_300_loop233_139_reg[63:0] <= loops_300_loop233_148_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop233_140[7:0] = loops_300_loop233_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop233_140_reg[7:0] = loops_300_loop2_23_reg[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop233_141[63:0] = (loops_300_loop227_122_reg ^ loops_300_loop227_118_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_32_S_0)) begin
+		loops_300_loop233_141_reg[63:0] <= loops_300_loop233_141[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop233_142[15:0] = loops_300_loop233_add_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_32_S_0)) begin
+		loops_300_loop233_142_reg[15:0] <= loops_300_loop233_142[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop233_143[7:0] = loops_300_loop233_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop233_143_reg[7:0] = loops_300_exit123_111_reg[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop233_145[31:0] = (loops_300_loop215_79_reg ^ loops_300_loop29_59_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_32_S_0)) begin
+		loops_300_loop233_145_reg[31:0] <= loops_300_loop233_145[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop233_146[7:0] = loops_300_loop233_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop233_146_reg[7:0] = loops_300_loop2_18_reg[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop233_147[31:0] = loops_300_loop233_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_300_loop233_147_reg[31:0] = loops_300_loop29_58_reg[31:0];
+end
+
+always @ (*) begin
+	loops_300_loop233_148[63:0] = (loops_300_loop233_139_reg + loops_300_loop233_147);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_32_S_0)) begin
+		loops_300_loop233_148_reg[63:0] <= loops_300_loop233_148[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop233_149[31:0] = loops_300_loop233_add_8_8_1[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_32_S_1)) begin
+		loops_300_loop233_149_reg[2:0] <= loops_300_loop233_149[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_33_S_0)) begin
+		loops_300_loop233_149_reg[2:0] <= loops_300_exit234_151[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop233_150 = loops_300_loop233_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_300_loop233_150_reg = loops_300_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_300_exit234_151[31:0] = loops_300_exit234_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_300_exit234_151_reg[2:0] = loops_300_loop233_149_reg[2:0];
+end
+
+always @ (*) begin
+	loops_300_exit234_152 = loops_300_exit234_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_300_exit234_152_reg = loops_300_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_300_exit135_153[31:0] = loops_300_exit135_add_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_34_S_0)) begin
+		loops_300_exit135_153_reg[2:0] <= loops_300_exit135_153[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_38_S_0)) begin
+		loops_300_exit135_153_reg[2:0] <= loops_300_exit240_172[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_42_S_0)) begin
+		loops_300_exit135_153_reg[2:0] <= loops_300_loop245_191[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_44_S_0)) begin
+		loops_300_exit135_153_reg[2:0] <= loops_300_exit147_195[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_exit135_154 = loops_300_exit135_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_300_exit135_154_reg = loops_300_loop2_24_reg;
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_300_BB_34_S_1) & (loops_300_exit135_154_reg == 1'd0))) begin
+		loops_300_loop037_155_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_39_S_1) & (loops_300_exit141_175_reg == 1'd1))) begin
+		loops_300_loop037_155_reg[1:0] <= loops_300_exit141_174_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_300_BB_34_S_1) & (loops_300_exit135_154_reg == 1'd0))) begin
+		loops_300_loop037_156_reg[63:0] <= loops_300_loop233_148_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_39_S_1) & (loops_300_exit141_175_reg == 1'd1))) begin
+		loops_300_loop037_156_reg[63:0] <= loops_300_loop239_169_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_35_S_0)) begin
+		loops_300_loop138_157_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_38_S_1) & (loops_300_exit240_173_reg == 1'd1))) begin
+		loops_300_loop138_157_reg[1:0] <= loops_300_exit240_172_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_35_S_0)) begin
+		loops_300_loop138_158_reg[63:0] <= loops_300_loop037_156_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_38_S_1) & (loops_300_exit240_173_reg == 1'd1))) begin
+		loops_300_loop138_158_reg[63:0] <= loops_300_loop239_169_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_36_S_0)) begin
+		loops_300_loop239_159_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_37_S_2) & (loops_300_loop239_171_reg == 1'd1))) begin
+		loops_300_loop239_159_reg[1:0] <= loops_300_loop239_170_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_36_S_0)) begin
+		loops_300_loop239_160_reg[63:0] <= loops_300_loop138_158_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_37_S_2) & (loops_300_loop239_171_reg == 1'd1))) begin
+		loops_300_loop239_160_reg[63:0] <= loops_300_loop239_169_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop239_161[31:0] = loops_300_loop239_mul_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_37_S_0)) begin
+		loops_300_loop239_161_reg[31:0] <= loops_300_loop239_161[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop239_162[31:0] = loops_300_loop239_mul_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_37_S_1)) begin
+		loops_300_loop239_162_reg[31:0] <= loops_300_loop239_162[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop239_164[7:0] = loops_300_loop239_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop239_164_reg[7:0] = loops_300_loop2_17_reg[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop239_166[31:0] = loops_300_loop239_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_300_loop239_166_reg[31:0] = loops_300_loop29_59_reg[31:0];
+end
+
+always @ (*) begin
+	loops_300_loop239_168[63:0] = (loops_300_loop227_118_reg + loops_300_loop227_124_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_37_S_0)) begin
+		loops_300_loop239_168_reg[63:0] <= loops_300_loop239_168[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop239_169[63:0] = (loops_300_loop239_160_reg + loops_300_loop239_168);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_37_S_0)) begin
+		loops_300_loop239_169_reg[63:0] <= loops_300_loop239_169[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop239_170[31:0] = loops_300_loop239_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop239_170_reg[2:0] = loops_300_loop23_42_reg[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop239_171 = loops_300_loop239_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_300_loop239_171_reg = loops_300_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_300_exit240_172[31:0] = loops_300_exit240_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_300_exit240_172_reg[2:0] = loops_300_exit135_153_reg[2:0];
+end
+
+always @ (*) begin
+	loops_300_exit240_173 = loops_300_exit240_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_300_exit240_173_reg = loops_300_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_300_exit141_174[31:0] = loops_300_exit141_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_300_exit141_174_reg[2:0] = loops_300_loop23_42_reg[7:0];
+end
+
+always @ (*) begin
+	loops_300_exit141_175 = loops_300_exit141_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_300_exit141_175_reg = loops_300_loop2_24_reg;
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_300_BB_39_S_1) & (loops_300_exit141_175_reg == 1'd0))) begin
+		loops_300_loop043_176_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_44_S_1) & (loops_300_exit147_196_reg == 1'd1))) begin
+		loops_300_loop043_176_reg[1:0] <= loops_300_exit147_195_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_300_BB_39_S_1) & (loops_300_exit141_175_reg == 1'd0))) begin
+		loops_300_loop043_177_reg[63:0] <= loops_300_loop239_169_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_44_S_1) & (loops_300_exit147_196_reg == 1'd1))) begin
+		loops_300_loop043_177_reg[63:0] <= loops_300_loop245_190_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_40_S_0)) begin
+		loops_300_loop144_178_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_43_S_1) & (loops_300_exit246_194_reg == 1'd1))) begin
+		loops_300_loop144_178_reg[1:0] <= loops_300_exit246_193_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_40_S_0)) begin
+		loops_300_loop144_179_reg[63:0] <= loops_300_loop043_177_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_43_S_1) & (loops_300_exit246_194_reg == 1'd1))) begin
+		loops_300_loop144_179_reg[63:0] <= loops_300_loop245_190_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_41_S_0)) begin
+		loops_300_loop245_180_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_42_S_1) & (loops_300_loop245_192_reg == 1'd1))) begin
+		loops_300_loop245_180_reg[1:0] <= loops_300_loop245_191_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_41_S_0)) begin
+		loops_300_loop245_181_reg[63:0] <= loops_300_loop144_179_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_42_S_1) & (loops_300_loop245_192_reg == 1'd1))) begin
+		loops_300_loop245_181_reg[63:0] <= loops_300_loop245_190_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop245_182[15:0] = loops_300_loop245_add_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_42_S_0)) begin
+		loops_300_loop245_182_reg[15:0] <= loops_300_loop245_182[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop245_183[15:0] = (loops_300_loop233_142_reg ^ loops_300_loop227_126_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_42_S_0)) begin
+		loops_300_loop245_183_reg[15:0] <= loops_300_loop245_183[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop245_184[15:0] = loops_300_loop245_add_16_16_1[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_42_S_0)) begin
+		loops_300_loop245_184_reg[15:0] <= loops_300_loop245_184[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop245_185[7:0] = loops_300_loop245_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop245_185_reg[7:0] = loops_300_loop221_100_reg[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop245_186[31:0] = loops_300_loop245_and_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_42_S_0)) begin
+		loops_300_loop245_186_reg[31:0] <= loops_300_loop245_186[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop245_188[15:0] = loops_300_loop245_mul_16_16_0[15:0];
+end
+
+always @ (*) begin
+	loops_300_loop245_188_reg[15:0] = loops_300_loop215_83_reg[15:0];
+end
+
+always @ (*) begin
+	loops_300_loop245_189[15:0] = loops_300_loop245_or_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_42_S_0)) begin
+		loops_300_loop245_189_reg[15:0] <= loops_300_loop245_189[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop245_190[63:0] = (loops_300_loop245_181_reg + loops_300_loop245_189);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_42_S_0)) begin
+		loops_300_loop245_190_reg[63:0] <= loops_300_loop245_190[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop245_191[31:0] = loops_300_loop245_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop245_191_reg[2:0] = loops_300_exit135_153_reg[2:0];
+end
+
+always @ (*) begin
+	loops_300_loop245_192 = loops_300_loop245_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_300_loop245_192_reg = loops_300_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_300_exit246_193[31:0] = loops_300_exit246_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_300_exit246_193_reg[2:0] = loops_300_loop23_42_reg[7:0];
+end
+
+always @ (*) begin
+	loops_300_exit246_194 = loops_300_exit246_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_300_exit246_194_reg = loops_300_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_300_exit147_195[31:0] = loops_300_exit147_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_300_exit147_195_reg[2:0] = loops_300_exit135_153_reg[2:0];
+end
+
+always @ (*) begin
+	loops_300_exit147_196 = loops_300_exit147_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_300_exit147_196_reg = loops_300_loop2_24_reg;
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_300_BB_44_S_1) & (loops_300_exit147_196_reg == 1'd0))) begin
+		loops_300_loop049_197_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_49_S_1) & (loops_300_exit153_217_reg == 1'd1))) begin
+		loops_300_loop049_197_reg[1:0] <= loops_300_exit153_216_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_300_BB_44_S_1) & (loops_300_exit147_196_reg == 1'd0))) begin
+		loops_300_loop049_198_reg[63:0] <= loops_300_loop245_190_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_49_S_1) & (loops_300_exit153_217_reg == 1'd1))) begin
+		loops_300_loop049_198_reg[63:0] <= loops_300_loop251_211_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_45_S_0)) begin
+		loops_300_loop150_199_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_48_S_1) & (loops_300_exit252_215_reg == 1'd1))) begin
+		loops_300_loop150_199_reg[1:0] <= loops_300_exit252_214_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_45_S_0)) begin
+		loops_300_loop150_200_reg[63:0] <= loops_300_loop049_198_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_48_S_1) & (loops_300_exit252_215_reg == 1'd1))) begin
+		loops_300_loop150_200_reg[63:0] <= loops_300_loop251_211_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_46_S_0)) begin
+		loops_300_loop251_201_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_47_S_1) & (loops_300_loop251_213_reg == 1'd1))) begin
+		loops_300_loop251_201_reg[1:0] <= loops_300_loop251_212_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_46_S_0)) begin
+		loops_300_loop251_202_reg[63:0] <= loops_300_loop150_200_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_47_S_1) & (loops_300_loop251_213_reg == 1'd1))) begin
+		loops_300_loop251_202_reg[63:0] <= loops_300_loop251_211_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop251_204[15:0] = loops_300_loop251_or_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_47_S_0)) begin
+		loops_300_loop251_204_reg[15:0] <= loops_300_loop251_204[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop251_205[15:0] = loops_300_loop251_add_16_16_1[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_47_S_0)) begin
+		loops_300_loop251_205_reg[15:0] <= loops_300_loop251_205[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop251_206[7:0] = (loops_300_loop221_102_reg - loops_300_loop221_102_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_47_S_0)) begin
+		loops_300_loop251_206_reg <= loops_300_loop251_206;
+	end
+end
+
+always @ (*) begin
+	loops_300_loop251_207[63:0] = (loops_300_loop233_141_reg * loops_300_loop245_181_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_47_S_0)) begin
+		loops_300_loop251_207_reg[63:0] <= loops_300_loop251_207[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop251_208[15:0] = loops_300_loop251_mul_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_47_S_0)) begin
+		loops_300_loop251_208_reg[15:0] <= loops_300_loop251_208[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop251_210[7:0] = (loops_300_loop227_120_reg - loops_300_loop239_164_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_47_S_0)) begin
+		loops_300_loop251_210_reg[7:0] <= loops_300_loop251_210[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop251_211[63:0] = (loops_300_loop251_202_reg + loops_300_loop251_210);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_47_S_0)) begin
+		loops_300_loop251_211_reg[63:0] <= loops_300_loop251_211[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop251_212[31:0] = loops_300_loop251_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop251_212_reg[2:0] = loops_300_loop23_42_reg[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop251_213 = loops_300_loop251_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_300_loop251_213_reg = loops_300_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_300_exit252_214[31:0] = loops_300_exit252_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_300_exit252_214_reg[2:0] = loops_300_loop2_23_reg[7:0];
+end
+
+always @ (*) begin
+	loops_300_exit252_215 = loops_300_exit252_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_300_exit252_215_reg = loops_300_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_300_exit153_216[31:0] = loops_300_exit153_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_300_exit153_216_reg[2:0] = loops_300_loop23_42_reg[7:0];
+end
+
+always @ (*) begin
+	loops_300_exit153_217 = loops_300_exit153_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_300_exit153_217_reg = loops_300_loop2_24_reg;
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_300_BB_49_S_1) & (loops_300_exit153_217_reg == 1'd0))) begin
+		loops_300_loop055_218_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_54_S_1) & (loops_300_exit159_238_reg == 1'd1))) begin
+		loops_300_loop055_218_reg[1:0] <= loops_300_exit159_237_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_300_BB_49_S_1) & (loops_300_exit153_217_reg == 1'd0))) begin
+		loops_300_loop055_219_reg[63:0] <= loops_300_loop251_211_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_54_S_1) & (loops_300_exit159_238_reg == 1'd1))) begin
+		loops_300_loop055_219_reg[63:0] <= loops_300_loop257_232_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_50_S_0)) begin
+		loops_300_loop156_220_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_53_S_1) & (loops_300_exit258_236_reg == 1'd1))) begin
+		loops_300_loop156_220_reg[1:0] <= loops_300_exit258_235_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_50_S_0)) begin
+		loops_300_loop156_221_reg[63:0] <= loops_300_loop055_219_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_53_S_1) & (loops_300_exit258_236_reg == 1'd1))) begin
+		loops_300_loop156_221_reg[63:0] <= loops_300_loop257_232_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_51_S_0)) begin
+		loops_300_loop257_222_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_52_S_1) & (loops_300_loop257_234_reg == 1'd1))) begin
+		loops_300_loop257_222_reg[1:0] <= loops_300_loop257_233_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_51_S_0)) begin
+		loops_300_loop257_223_reg[63:0] <= loops_300_loop156_221_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_52_S_1) & (loops_300_loop257_234_reg == 1'd1))) begin
+		loops_300_loop257_223_reg[63:0] <= loops_300_loop257_232_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop257_224[15:0] = (loops_300_loop245_188_reg ^ loops_300_loop245_189_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_52_S_0)) begin
+		loops_300_loop257_224_reg[15:0] <= loops_300_loop257_224[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop257_225[63:0] = (loops_300_loop251_202_reg ^ loops_300_loop257_223_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_52_S_0)) begin
+		loops_300_loop257_225_reg[63:0] <= loops_300_loop257_225[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop257_226[31:0] = loops_300_loop257_or_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_300_loop257_226_reg[31:0] = loops_300_loop2_15_reg[31:0];
+end
+
+always @ (*) begin
+	loops_300_loop257_229[15:0] = loops_300_loop257_mul_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_52_S_0)) begin
+		loops_300_loop257_229_reg[15:0] <= loops_300_loop257_229[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop257_231[63:0] = (loops_300_loop257_223_reg & loops_300_loop251_202_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_52_S_0)) begin
+		loops_300_loop257_231_reg[63:0] <= loops_300_loop257_231[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop257_232[63:0] = (loops_300_loop257_223_reg + loops_300_loop257_231);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_52_S_0)) begin
+		loops_300_loop257_232_reg[63:0] <= loops_300_loop257_232[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop257_233[31:0] = loops_300_loop257_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop257_233_reg[2:0] = loops_300_loop2_23_reg[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop257_234 = loops_300_loop257_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_300_loop257_234_reg = loops_300_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_300_exit258_235[31:0] = loops_300_exit258_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_300_exit258_235_reg[2:0] = loops_300_loop23_42_reg[7:0];
+end
+
+always @ (*) begin
+	loops_300_exit258_236 = loops_300_exit258_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_300_exit258_236_reg = loops_300_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_300_exit159_237[31:0] = loops_300_exit159_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_300_exit159_237_reg[2:0] = loops_300_loop2_23_reg[7:0];
+end
+
+always @ (*) begin
+	loops_300_exit159_238 = loops_300_exit159_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_300_exit159_238_reg = loops_300_loop2_24_reg;
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_300_BB_54_S_1) & (loops_300_exit159_238_reg == 1'd0))) begin
+		loops_300_loop061_239_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_59_S_1) & (loops_300_exit165_259_reg == 1'd1))) begin
+		loops_300_loop061_239_reg[1:0] <= loops_300_exit165_258_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_300_BB_54_S_1) & (loops_300_exit159_238_reg == 1'd0))) begin
+		loops_300_loop061_240_reg[63:0] <= loops_300_loop257_232_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_59_S_1) & (loops_300_exit165_259_reg == 1'd1))) begin
+		loops_300_loop061_240_reg[63:0] <= loops_300_loop263_253_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_55_S_0)) begin
+		loops_300_loop162_241_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_58_S_1) & (loops_300_exit264_257_reg == 1'd1))) begin
+		loops_300_loop162_241_reg[1:0] <= loops_300_exit264_256_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_55_S_0)) begin
+		loops_300_loop162_242_reg[63:0] <= loops_300_loop061_240_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_58_S_1) & (loops_300_exit264_257_reg == 1'd1))) begin
+		loops_300_loop162_242_reg[63:0] <= loops_300_loop263_253_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_56_S_0)) begin
+		loops_300_loop263_243_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_57_S_1) & (loops_300_loop263_255_reg == 1'd1))) begin
+		loops_300_loop263_243_reg[1:0] <= loops_300_loop263_254_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_56_S_0)) begin
+		loops_300_loop263_244_reg[63:0] <= loops_300_loop162_242_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_300_BB_57_S_1) & (loops_300_loop263_255_reg == 1'd1))) begin
+		loops_300_loop263_244_reg[63:0] <= loops_300_loop263_253_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop263_252[7:0] = (loops_300_loop251_206_reg ^ loops_300_loop251_210_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_57_S_0)) begin
+		loops_300_loop263_252_reg[7:0] <= loops_300_loop263_252[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop263_253[63:0] = (loops_300_loop263_244_reg + loops_300_loop263_252);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_57_S_0)) begin
+		loops_300_loop263_253_reg[63:0] <= loops_300_loop263_253[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop263_254[31:0] = loops_300_loop263_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop263_254_reg[2:0] = loops_300_loop2_23_reg[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop263_255 = loops_300_loop263_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_300_loop263_255_reg = loops_300_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_300_exit264_256[31:0] = loops_300_exit264_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_300_exit264_256_reg[2:0] = loops_300_loop2_23_reg[7:0];
+end
+
+always @ (*) begin
+	loops_300_exit264_257 = loops_300_exit264_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_300_exit264_257_reg = loops_300_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_300_exit165_258[31:0] = loops_300_exit165_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_300_exit165_258_reg[2:0] = loops_300_loop23_42_reg[7:0];
+end
+
+always @ (*) begin
+	loops_300_exit165_259 = loops_300_exit165_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_300_exit165_259_reg = loops_300_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_300_loop2_and_16_16_0_op0[15:0] = loops_300_loop2_14[15:0];
+end
+
+always @ (*) begin
+	loops_300_loop2_and_16_16_0_op1[15:0] = loops_300_loop2_14[15:0];
+end
+
+always @ (*) begin
+	loops_300_loop2_and_16_16_0[15:0] = (loops_300_loop2_and_16_16_0_op0 & loops_300_loop2_and_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_300_loop2_icmp_8_0_op0[2:0] = loops_300_loop2_23[31:0];
+end
+
+always @ (*) begin
+	loops_300_loop2_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_300_loop2_icmp_8_0 = (loops_300_loop2_icmp_8_0_op0 < loops_300_loop2_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_loop2_mul_8_8_0_op0[7:0] = arg_1[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop2_mul_8_8_0_op1[7:0] = arg_0[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop2_mul_8_8_0[7:0] = (loops_300_loop2_mul_8_8_0_op0 * loops_300_loop2_mul_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_loop2_add_8_8_0_op0[7:0] = loops_300_loop2_12_reg[1:0];
+end
+
+always @ (*) begin
+	loops_300_loop2_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_300_loop2_add_8_8_0[7:0] = (loops_300_loop2_add_8_8_0_op0 + loops_300_loop2_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_loop2_and_8_8_0_op0[7:0] = loops_300_loop2_17[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop2_and_8_8_0_op1[7:0] = loops_300_loop2_17[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop2_and_8_8_0[7:0] = (loops_300_loop2_and_8_8_0_op0 & loops_300_loop2_and_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_loop2_or_32_32_0_op0[31:0] = arg_4[31:0];
+end
+
+always @ (*) begin
+	loops_300_loop2_or_32_32_0_op1[31:0] = arg_1[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop2_or_32_32_0[31:0] = (loops_300_loop2_or_32_32_0_op0 | loops_300_loop2_or_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_300_loop2_add_16_16_0_op0[15:0] = arg_2[15:0];
+end
+
+always @ (*) begin
+	loops_300_loop2_add_16_16_0_op1[15:0] = arg_2[15:0];
+end
+
+always @ (*) begin
+	loops_300_loop2_add_16_16_0[15:0] = (loops_300_loop2_add_16_16_0_op0 + loops_300_loop2_add_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_300_exit2_icmp_8_0_op0[2:0] = loops_300_exit2_25[31:0];
+end
+
+always @ (*) begin
+	loops_300_exit2_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_300_exit2_icmp_8_0 = (loops_300_exit2_icmp_8_0_op0 < loops_300_exit2_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_exit2_add_8_8_0_op0[7:0] = loops_300_loop1_10_reg[1:0];
+end
+
+always @ (*) begin
+	loops_300_exit2_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_300_exit2_add_8_8_0[7:0] = (loops_300_exit2_add_8_8_0_op0 + loops_300_exit2_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_exit1_icmp_8_0_op0[2:0] = loops_300_exit1_27[31:0];
+end
+
+always @ (*) begin
+	loops_300_exit1_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_300_exit1_icmp_8_0 = (loops_300_exit1_icmp_8_0_op0 < loops_300_exit1_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_exit1_add_8_8_0_op0[7:0] = loops_300_loop0_8_reg[1:0];
+end
+
+always @ (*) begin
+	loops_300_exit1_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_300_exit1_add_8_8_0[7:0] = (loops_300_exit1_add_8_8_0_op0 + loops_300_exit1_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_7_S_0)) begin
+		loops_300_loop23_or_8_8_0_op0[7:0] = loops_300_loop2_18_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_300_BB_7_S_1)) */ begin
+		loops_300_loop23_or_8_8_0_op0[7:0] = loops_300_loop2_17_reg[7:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_7_S_0)) begin
+		loops_300_loop23_or_8_8_0_op1[7:0] = arg_1[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_300_BB_7_S_1)) */ begin
+		loops_300_loop23_or_8_8_0_op1[7:0] = arg_1[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop23_or_8_8_0[7:0] = (loops_300_loop23_or_8_8_0_op0 | loops_300_loop23_or_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_loop23_add_8_8_0_op0[7:0] = arg_0[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop23_add_8_8_0_op1[7:0] = arg_0[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop23_add_8_8_0[7:0] = (loops_300_loop23_add_8_8_0_op0 + loops_300_loop23_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_7_S_0)) begin
+		loops_300_loop23_add_8_8_1_op0[7:0] = loops_300_loop2_18_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_300_BB_7_S_1)) */ begin
+		loops_300_loop23_add_8_8_1_op0[7:0] = loops_300_loop23_33_reg[1:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_7_S_0)) begin
+		loops_300_loop23_add_8_8_1_op1[7:0] = loops_300_loop2_18_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_300_BB_7_S_1)) */ begin
+		loops_300_loop23_add_8_8_1_op1[7:0] = 32'd1;
+	end
+end
+
+always @ (*) begin
+	loops_300_loop23_add_8_8_1[7:0] = (loops_300_loop23_add_8_8_1_op0 + loops_300_loop23_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_300_loop23_add_16_16_0_op0[15:0] = arg_3[15:0];
+end
+
+always @ (*) begin
+	loops_300_loop23_add_16_16_0_op1[15:0] = arg_2[15:0];
+end
+
+always @ (*) begin
+	loops_300_loop23_add_16_16_0[15:0] = (loops_300_loop23_add_16_16_0_op0 + loops_300_loop23_add_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_300_loop23_icmp_8_0_op0[2:0] = loops_300_loop23_44[31:0];
+end
+
+always @ (*) begin
+	loops_300_loop23_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_300_loop23_icmp_8_0 = (loops_300_loop23_icmp_8_0_op0 < loops_300_loop23_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_exit24_icmp_8_0_op0[2:0] = loops_300_exit24_46[31:0];
+end
+
+always @ (*) begin
+	loops_300_exit24_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_300_exit24_icmp_8_0 = (loops_300_exit24_icmp_8_0_op0 < loops_300_exit24_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_exit24_add_8_8_1_op0[7:0] = loops_300_loop12_31_reg[1:0];
+end
+
+always @ (*) begin
+	loops_300_exit24_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_300_exit24_add_8_8_1[7:0] = (loops_300_exit24_add_8_8_1_op0 + loops_300_exit24_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_300_exit15_icmp_8_0_op0[2:0] = loops_300_exit15_48[31:0];
+end
+
+always @ (*) begin
+	loops_300_exit15_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_300_exit15_icmp_8_0 = (loops_300_exit15_icmp_8_0_op0 < loops_300_exit15_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_exit15_add_8_8_0_op0[7:0] = loops_300_loop01_29_reg[1:0];
+end
+
+always @ (*) begin
+	loops_300_exit15_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_300_exit15_add_8_8_0[7:0] = (loops_300_exit15_add_8_8_0_op0 + loops_300_exit15_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_loop29_and_16_16_0_op0[15:0] = arg_3[15:0];
+end
+
+always @ (*) begin
+	loops_300_loop29_and_16_16_0_op1[15:0] = loops_300_loop23_38_reg[15:0];
+end
+
+always @ (*) begin
+	loops_300_loop29_and_16_16_0[15:0] = (loops_300_loop29_and_16_16_0_op0 & loops_300_loop29_and_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_300_loop29_icmp_8_0_op0[2:0] = loops_300_loop29_65[31:0];
+end
+
+always @ (*) begin
+	loops_300_loop29_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_300_loop29_icmp_8_0 = (loops_300_loop29_icmp_8_0_op0 < loops_300_loop29_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_loop29_add_8_8_1_op0[7:0] = loops_300_loop29_54_reg[1:0];
+end
+
+always @ (*) begin
+	loops_300_loop29_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_300_loop29_add_8_8_1[7:0] = (loops_300_loop29_add_8_8_1_op0 + loops_300_loop29_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_12_S_0)) begin
+		loops_300_loop29_and_32_32_0_op0[31:0] = loops_300_loop29_57[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_300_BB_12_S_1)) */ begin
+		loops_300_loop29_and_32_32_0_op0[31:0] = loops_300_loop29_57_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_12_S_0)) begin
+		loops_300_loop29_and_32_32_0_op1[31:0] = arg_4[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_300_BB_12_S_1)) */ begin
+		loops_300_loop29_and_32_32_0_op1[31:0] = loops_300_loop2_15_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop29_and_32_32_0[31:0] = (loops_300_loop29_and_32_32_0_op0 & loops_300_loop29_and_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_300_exit210_icmp_8_0_op0[2:0] = loops_300_exit210_67[31:0];
+end
+
+always @ (*) begin
+	loops_300_exit210_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_300_exit210_icmp_8_0 = (loops_300_exit210_icmp_8_0_op0 < loops_300_exit210_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_exit210_add_8_8_0_op0[7:0] = loops_300_loop18_52_reg[1:0];
+end
+
+always @ (*) begin
+	loops_300_exit210_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_300_exit210_add_8_8_0[7:0] = (loops_300_exit210_add_8_8_0_op0 + loops_300_exit210_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_exit111_icmp_8_0_op0[2:0] = loops_300_exit111_69[31:0];
+end
+
+always @ (*) begin
+	loops_300_exit111_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_300_exit111_icmp_8_0 = (loops_300_exit111_icmp_8_0_op0 < loops_300_exit111_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_exit111_add_8_8_1_op0[7:0] = loops_300_loop07_50_reg[1:0];
+end
+
+always @ (*) begin
+	loops_300_exit111_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_300_exit111_add_8_8_1[7:0] = (loops_300_exit111_add_8_8_1_op0 + loops_300_exit111_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_300_loop215_icmp_8_0_op0[2:0] = loops_300_loop215_86[31:0];
+end
+
+always @ (*) begin
+	loops_300_loop215_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_300_loop215_icmp_8_0 = (loops_300_loop215_icmp_8_0_op0 < loops_300_loop215_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_loop215_mul_8_8_0_op0[7:0] = arg_1[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop215_mul_8_8_0_op1[7:0] = loops_300_loop23_39_reg[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop215_mul_8_8_0[7:0] = (loops_300_loop215_mul_8_8_0_op0 * loops_300_loop215_mul_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_loop215_add_8_8_0_op0[7:0] = loops_300_loop215_75_reg[1:0];
+end
+
+always @ (*) begin
+	loops_300_loop215_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_300_loop215_add_8_8_0[7:0] = (loops_300_loop215_add_8_8_0_op0 + loops_300_loop215_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_loop215_add_16_16_0_op0[15:0] = arg_2[15:0];
+end
+
+always @ (*) begin
+	loops_300_loop215_add_16_16_0_op1[15:0] = loops_300_loop2_20_reg[15:0];
+end
+
+always @ (*) begin
+	loops_300_loop215_add_16_16_0[15:0] = (loops_300_loop215_add_16_16_0_op0 + loops_300_loop215_add_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_300_loop215_mul_16_16_0_op0[15:0] = loops_300_loop215_80[15:0];
+end
+
+always @ (*) begin
+	loops_300_loop215_mul_16_16_0_op1[15:0] = loops_300_loop215_82[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop215_mul_16_16_0[15:0] = (loops_300_loop215_mul_16_16_0_op0 * loops_300_loop215_mul_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_300_exit216_icmp_8_0_op0[2:0] = loops_300_exit216_88[31:0];
+end
+
+always @ (*) begin
+	loops_300_exit216_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_300_exit216_icmp_8_0 = (loops_300_exit216_icmp_8_0_op0 < loops_300_exit216_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_exit216_add_8_8_1_op0[7:0] = loops_300_loop114_73_reg[1:0];
+end
+
+always @ (*) begin
+	loops_300_exit216_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_300_exit216_add_8_8_1[7:0] = (loops_300_exit216_add_8_8_1_op0 + loops_300_exit216_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_300_exit117_icmp_8_0_op0[2:0] = loops_300_exit117_90[31:0];
+end
+
+always @ (*) begin
+	loops_300_exit117_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_300_exit117_icmp_8_0 = (loops_300_exit117_icmp_8_0_op0 < loops_300_exit117_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_exit117_add_8_8_0_op0[7:0] = loops_300_loop013_71_reg[1:0];
+end
+
+always @ (*) begin
+	loops_300_exit117_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_300_exit117_add_8_8_0[7:0] = (loops_300_exit117_add_8_8_0_op0 + loops_300_exit117_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_loop221_icmp_8_0_op0[2:0] = loops_300_loop221_107[31:0];
+end
+
+always @ (*) begin
+	loops_300_loop221_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_300_loop221_icmp_8_0 = (loops_300_loop221_icmp_8_0_op0 < loops_300_loop221_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_loop221_add_8_8_1_op0[7:0] = loops_300_loop215_82_reg[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop221_add_8_8_1_op1[7:0] = loops_300_loop221_100[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop221_add_8_8_1[7:0] = (loops_300_loop221_add_8_8_1_op0 + loops_300_loop221_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_300_loop221_add_8_8_0_op0[7:0] = loops_300_loop221_96_reg[1:0];
+end
+
+always @ (*) begin
+	loops_300_loop221_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_300_loop221_add_8_8_0[7:0] = (loops_300_loop221_add_8_8_0_op0 + loops_300_loop221_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_22_S_0)) begin
+		loops_300_loop221_and_8_8_0_op0[7:0] = loops_300_loop2_18_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_300_BB_22_S_1)) */ begin
+		loops_300_loop221_and_8_8_0_op0[7:0] = loops_300_loop23_42_reg[7:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_22_S_0)) begin
+		loops_300_loop221_and_8_8_0_op1[7:0] = loops_300_loop2_18_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_300_BB_22_S_1)) */ begin
+		loops_300_loop221_and_8_8_0_op1[7:0] = loops_300_loop2_21_reg[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop221_and_8_8_0[7:0] = (loops_300_loop221_and_8_8_0_op0 & loops_300_loop221_and_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_exit222_icmp_8_0_op0[2:0] = loops_300_exit222_109[31:0];
+end
+
+always @ (*) begin
+	loops_300_exit222_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_300_exit222_icmp_8_0 = (loops_300_exit222_icmp_8_0_op0 < loops_300_exit222_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_exit222_add_8_8_0_op0[7:0] = loops_300_loop120_94_reg[1:0];
+end
+
+always @ (*) begin
+	loops_300_exit222_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_300_exit222_add_8_8_0[7:0] = (loops_300_exit222_add_8_8_0_op0 + loops_300_exit222_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_exit123_icmp_8_0_op0[2:0] = loops_300_exit123_111[31:0];
+end
+
+always @ (*) begin
+	loops_300_exit123_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_300_exit123_icmp_8_0 = (loops_300_exit123_icmp_8_0_op0 < loops_300_exit123_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_exit123_add_8_8_1_op0[7:0] = loops_300_loop019_92_reg[1:0];
+end
+
+always @ (*) begin
+	loops_300_exit123_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_300_exit123_add_8_8_1[7:0] = (loops_300_exit123_add_8_8_1_op0 + loops_300_exit123_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_300_loop227_and_16_16_0_op0[15:0] = loops_300_loop23_38_reg[15:0];
+end
+
+always @ (*) begin
+	loops_300_loop227_and_16_16_0_op1[15:0] = loops_300_loop215_80_reg[15:0];
+end
+
+always @ (*) begin
+	loops_300_loop227_and_16_16_0[15:0] = (loops_300_loop227_and_16_16_0_op0 & loops_300_loop227_and_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_300_loop227_icmp_8_0_op0[2:0] = loops_300_loop227_128[31:0];
+end
+
+always @ (*) begin
+	loops_300_loop227_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_300_loop227_icmp_8_0 = (loops_300_loop227_icmp_8_0_op0 < loops_300_loop227_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_loop227_or_8_8_0_op0[7:0] = loops_300_loop23_39_reg[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop227_or_8_8_0_op1[7:0] = loops_300_loop221_102_reg[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop227_or_8_8_0[7:0] = (loops_300_loop227_or_8_8_0_op0 | loops_300_loop227_or_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_loop227_add_8_8_0_op0[7:0] = loops_300_loop227_117_reg[1:0];
+end
+
+always @ (*) begin
+	loops_300_loop227_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_300_loop227_add_8_8_0[7:0] = (loops_300_loop227_add_8_8_0_op0 + loops_300_loop227_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_loop227_or_32_32_0_op0[31:0] = loops_300_loop221_101_reg[31:0];
+end
+
+always @ (*) begin
+	loops_300_loop227_or_32_32_0_op1[31:0] = loops_300_loop29_59_reg[31:0];
+end
+
+always @ (*) begin
+	loops_300_loop227_or_32_32_0[31:0] = (loops_300_loop227_or_32_32_0_op0 | loops_300_loop227_or_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_300_exit228_icmp_8_0_op0[2:0] = loops_300_exit228_130[31:0];
+end
+
+always @ (*) begin
+	loops_300_exit228_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_300_exit228_icmp_8_0 = (loops_300_exit228_icmp_8_0_op0 < loops_300_exit228_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_exit228_add_8_8_1_op0[7:0] = loops_300_loop126_115_reg[1:0];
+end
+
+always @ (*) begin
+	loops_300_exit228_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_300_exit228_add_8_8_1[7:0] = (loops_300_exit228_add_8_8_1_op0 + loops_300_exit228_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_300_exit129_icmp_8_0_op0[2:0] = loops_300_exit129_132[31:0];
+end
+
+always @ (*) begin
+	loops_300_exit129_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_300_exit129_icmp_8_0 = (loops_300_exit129_icmp_8_0_op0 < loops_300_exit129_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_exit129_add_8_8_0_op0[7:0] = loops_300_loop025_113_reg[1:0];
+end
+
+always @ (*) begin
+	loops_300_exit129_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_300_exit129_add_8_8_0[7:0] = (loops_300_exit129_add_8_8_0_op0 + loops_300_exit129_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_loop233_add_8_8_0_op0[7:0] = loops_300_loop23_42_reg[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop233_add_8_8_0_op1[7:0] = loops_300_loop221_102_reg[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop233_add_8_8_0[7:0] = (loops_300_loop233_add_8_8_0_op0 + loops_300_loop233_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_32_S_0)) begin
+		loops_300_loop233_add_8_8_1_op0[7:0] = loops_300_loop221_104_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_300_BB_32_S_1)) */ begin
+		loops_300_loop233_add_8_8_1_op0[7:0] = loops_300_loop233_138_reg[1:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_32_S_0)) begin
+		loops_300_loop233_add_8_8_1_op1[7:0] = loops_300_loop221_100_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_300_BB_32_S_1)) */ begin
+		loops_300_loop233_add_8_8_1_op1[7:0] = 32'd1;
+	end
+end
+
+always @ (*) begin
+	loops_300_loop233_add_8_8_1[7:0] = (loops_300_loop233_add_8_8_1_op0 + loops_300_loop233_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_300_loop233_and_32_32_0_op0[31:0] = loops_300_loop29_59_reg[31:0];
+end
+
+always @ (*) begin
+	loops_300_loop233_and_32_32_0_op1[31:0] = loops_300_loop29_63_reg[31:0];
+end
+
+always @ (*) begin
+	loops_300_loop233_and_32_32_0[31:0] = (loops_300_loop233_and_32_32_0_op0 & loops_300_loop233_and_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_300_loop233_and_8_8_0_op0[7:0] = loops_300_loop233_140[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop233_and_8_8_0_op1[7:0] = loops_300_loop215_77_reg[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop233_and_8_8_0[7:0] = (loops_300_loop233_and_8_8_0_op0 & loops_300_loop233_and_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_loop233_add_16_16_0_op0[15:0] = loops_300_loop215_80_reg[15:0];
+end
+
+always @ (*) begin
+	loops_300_loop233_add_16_16_0_op1[15:0] = loops_300_loop23_38_reg[15:0];
+end
+
+always @ (*) begin
+	loops_300_loop233_add_16_16_0[15:0] = (loops_300_loop233_add_16_16_0_op0 + loops_300_loop233_add_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_300_loop233_icmp_8_0_op0[2:0] = loops_300_loop233_149[31:0];
+end
+
+always @ (*) begin
+	loops_300_loop233_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_300_loop233_icmp_8_0 = (loops_300_loop233_icmp_8_0_op0 < loops_300_loop233_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_exit234_icmp_8_0_op0[2:0] = loops_300_exit234_151[31:0];
+end
+
+always @ (*) begin
+	loops_300_exit234_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_300_exit234_icmp_8_0 = (loops_300_exit234_icmp_8_0_op0 < loops_300_exit234_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_exit234_add_8_8_1_op0[7:0] = loops_300_loop132_136_reg[1:0];
+end
+
+always @ (*) begin
+	loops_300_exit234_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_300_exit234_add_8_8_1[7:0] = (loops_300_exit234_add_8_8_1_op0 + loops_300_exit234_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_300_exit135_icmp_8_0_op0[2:0] = loops_300_exit135_153[31:0];
+end
+
+always @ (*) begin
+	loops_300_exit135_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_300_exit135_icmp_8_0 = (loops_300_exit135_icmp_8_0_op0 < loops_300_exit135_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_exit135_add_8_8_0_op0[7:0] = loops_300_loop031_134_reg[1:0];
+end
+
+always @ (*) begin
+	loops_300_exit135_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_300_exit135_add_8_8_0[7:0] = (loops_300_exit135_add_8_8_0_op0 + loops_300_exit135_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_loop239_icmp_8_0_op0[2:0] = loops_300_loop239_170[31:0];
+end
+
+always @ (*) begin
+	loops_300_loop239_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_300_loop239_icmp_8_0 = (loops_300_loop239_icmp_8_0_op0 < loops_300_loop239_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_loop239_mul_8_8_0_op0[7:0] = loops_300_loop215_82_reg[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop239_mul_8_8_0_op1[7:0] = loops_300_loop215_82_reg[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop239_mul_8_8_0[7:0] = (loops_300_loop239_mul_8_8_0_op0 * loops_300_loop239_mul_8_8_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_37_S_0)) begin
+		loops_300_loop239_mul_32_32_0_op0[31:0] = loops_300_loop233_147_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_loops_300_BB_37_S_1)) begin
+		loops_300_loop239_mul_32_32_0_op0[31:0] = loops_300_loop233_145_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_300_BB_37_S_2)) */ begin
+		loops_300_loop239_mul_32_32_0_op0[31:0] = loops_300_loop227_125_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_300_BB_37_S_0)) begin
+		loops_300_loop239_mul_32_32_0_op1[31:0] = loops_300_loop233_145_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_loops_300_BB_37_S_1)) begin
+		loops_300_loop239_mul_32_32_0_op1[31:0] = loops_300_loop233_147_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_300_BB_37_S_2)) */ begin
+		loops_300_loop239_mul_32_32_0_op1[31:0] = loops_300_loop227_125_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_300_loop239_mul_32_32_0[31:0] = (loops_300_loop239_mul_32_32_0_op0 * loops_300_loop239_mul_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_300_loop239_add_8_8_1_op0[7:0] = loops_300_loop239_159_reg[1:0];
+end
+
+always @ (*) begin
+	loops_300_loop239_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_300_loop239_add_8_8_1[7:0] = (loops_300_loop239_add_8_8_1_op0 + loops_300_loop239_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_300_loop239_and_32_32_0_op0[31:0] = loops_300_loop227_125_reg[31:0];
+end
+
+always @ (*) begin
+	loops_300_loop239_and_32_32_0_op1[31:0] = loops_300_loop227_121_reg[31:0];
+end
+
+always @ (*) begin
+	loops_300_loop239_and_32_32_0[31:0] = (loops_300_loop239_and_32_32_0_op0 & loops_300_loop239_and_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_300_exit240_icmp_8_0_op0[2:0] = loops_300_exit240_172[31:0];
+end
+
+always @ (*) begin
+	loops_300_exit240_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_300_exit240_icmp_8_0 = (loops_300_exit240_icmp_8_0_op0 < loops_300_exit240_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_exit240_add_8_8_0_op0[7:0] = loops_300_loop138_157_reg[1:0];
+end
+
+always @ (*) begin
+	loops_300_exit240_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_300_exit240_add_8_8_0[7:0] = (loops_300_exit240_add_8_8_0_op0 + loops_300_exit240_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_exit141_icmp_8_0_op0[2:0] = loops_300_exit141_174[31:0];
+end
+
+always @ (*) begin
+	loops_300_exit141_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_300_exit141_icmp_8_0 = (loops_300_exit141_icmp_8_0_op0 < loops_300_exit141_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_exit141_add_8_8_1_op0[7:0] = loops_300_loop037_155_reg[1:0];
+end
+
+always @ (*) begin
+	loops_300_exit141_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_300_exit141_add_8_8_1[7:0] = (loops_300_exit141_add_8_8_1_op0 + loops_300_exit141_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_300_loop245_icmp_8_0_op0[2:0] = loops_300_loop245_191[31:0];
+end
+
+always @ (*) begin
+	loops_300_loop245_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_300_loop245_icmp_8_0 = (loops_300_loop245_icmp_8_0_op0 < loops_300_loop245_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_loop245_or_16_16_0_op0[15:0] = loops_300_loop245_182[15:0];
+end
+
+always @ (*) begin
+	loops_300_loop245_or_16_16_0_op1[15:0] = loops_300_loop227_119_reg[15:0];
+end
+
+always @ (*) begin
+	loops_300_loop245_or_16_16_0[15:0] = (loops_300_loop245_or_16_16_0_op0 | loops_300_loop245_or_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_300_loop245_add_8_8_0_op0[7:0] = loops_300_loop245_180_reg[1:0];
+end
+
+always @ (*) begin
+	loops_300_loop245_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_300_loop245_add_8_8_0[7:0] = (loops_300_loop245_add_8_8_0_op0 + loops_300_loop245_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_loop245_and_32_32_0_op0[31:0] = loops_300_loop233_147_reg[31:0];
+end
+
+always @ (*) begin
+	loops_300_loop245_and_32_32_0_op1[31:0] = loops_300_loop233_145_reg[31:0];
+end
+
+always @ (*) begin
+	loops_300_loop245_and_32_32_0[31:0] = (loops_300_loop245_and_32_32_0_op0 & loops_300_loop245_and_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_300_loop245_and_8_8_0_op0[7:0] = loops_300_loop233_140_reg[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop245_and_8_8_0_op1[7:0] = loops_300_loop233_143_reg[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop245_and_8_8_0[7:0] = (loops_300_loop245_and_8_8_0_op0 & loops_300_loop245_and_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_loop245_add_16_16_0_op0[15:0] = loops_300_loop233_142_reg[15:0];
+end
+
+always @ (*) begin
+	loops_300_loop245_add_16_16_0_op1[15:0] = loops_300_loop23_38_reg[15:0];
+end
+
+always @ (*) begin
+	loops_300_loop245_add_16_16_0[15:0] = (loops_300_loop245_add_16_16_0_op0 + loops_300_loop245_add_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_300_loop245_add_16_16_1_op0[15:0] = loops_300_loop227_119_reg[15:0];
+end
+
+always @ (*) begin
+	loops_300_loop245_add_16_16_1_op1[15:0] = loops_300_loop215_80_reg[15:0];
+end
+
+always @ (*) begin
+	loops_300_loop245_add_16_16_1[15:0] = (loops_300_loop245_add_16_16_1_op0 + loops_300_loop245_add_16_16_1_op1);
+end
+
+always @ (*) begin
+	loops_300_loop245_mul_16_16_0_op0[15:0] = loops_300_loop245_182[15:0];
+end
+
+always @ (*) begin
+	loops_300_loop245_mul_16_16_0_op1[15:0] = loops_300_loop245_183[15:0];
+end
+
+always @ (*) begin
+	loops_300_loop245_mul_16_16_0[15:0] = (loops_300_loop245_mul_16_16_0_op0 * loops_300_loop245_mul_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_300_exit246_icmp_8_0_op0[2:0] = loops_300_exit246_193[31:0];
+end
+
+always @ (*) begin
+	loops_300_exit246_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_300_exit246_icmp_8_0 = (loops_300_exit246_icmp_8_0_op0 < loops_300_exit246_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_exit246_add_8_8_1_op0[7:0] = loops_300_loop144_178_reg[1:0];
+end
+
+always @ (*) begin
+	loops_300_exit246_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_300_exit246_add_8_8_1[7:0] = (loops_300_exit246_add_8_8_1_op0 + loops_300_exit246_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_300_exit147_icmp_8_0_op0[2:0] = loops_300_exit147_195[31:0];
+end
+
+always @ (*) begin
+	loops_300_exit147_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_300_exit147_icmp_8_0 = (loops_300_exit147_icmp_8_0_op0 < loops_300_exit147_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_exit147_add_8_8_0_op0[7:0] = loops_300_loop043_176_reg[1:0];
+end
+
+always @ (*) begin
+	loops_300_exit147_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_300_exit147_add_8_8_0[7:0] = (loops_300_exit147_add_8_8_0_op0 + loops_300_exit147_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_loop251_icmp_8_0_op0[2:0] = loops_300_loop251_212[31:0];
+end
+
+always @ (*) begin
+	loops_300_loop251_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_300_loop251_icmp_8_0 = (loops_300_loop251_icmp_8_0_op0 < loops_300_loop251_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_loop251_or_16_16_0_op0[15:0] = loops_300_loop227_126_reg[15:0];
+end
+
+always @ (*) begin
+	loops_300_loop251_or_16_16_0_op1[15:0] = loops_300_loop245_188_reg[15:0];
+end
+
+always @ (*) begin
+	loops_300_loop251_or_16_16_0[15:0] = (loops_300_loop251_or_16_16_0_op0 | loops_300_loop251_or_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_300_loop251_add_8_8_1_op0[7:0] = loops_300_loop251_201_reg[1:0];
+end
+
+always @ (*) begin
+	loops_300_loop251_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_300_loop251_add_8_8_1[7:0] = (loops_300_loop251_add_8_8_1_op0 + loops_300_loop251_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_300_loop251_add_16_16_1_op0[15:0] = loops_300_loop245_183_reg[15:0];
+end
+
+always @ (*) begin
+	loops_300_loop251_add_16_16_1_op1[15:0] = loops_300_loop251_204[15:0];
+end
+
+always @ (*) begin
+	loops_300_loop251_add_16_16_1[15:0] = (loops_300_loop251_add_16_16_1_op0 + loops_300_loop251_add_16_16_1_op1);
+end
+
+always @ (*) begin
+	loops_300_loop251_mul_16_16_0_op0[15:0] = loops_300_loop245_188_reg[15:0];
+end
+
+always @ (*) begin
+	loops_300_loop251_mul_16_16_0_op1[15:0] = loops_300_loop245_184_reg[15:0];
+end
+
+always @ (*) begin
+	loops_300_loop251_mul_16_16_0[15:0] = (loops_300_loop251_mul_16_16_0_op0 * loops_300_loop251_mul_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_300_exit252_icmp_8_0_op0[2:0] = loops_300_exit252_214[31:0];
+end
+
+always @ (*) begin
+	loops_300_exit252_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_300_exit252_icmp_8_0 = (loops_300_exit252_icmp_8_0_op0 < loops_300_exit252_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_exit252_add_8_8_0_op0[7:0] = loops_300_loop150_199_reg[1:0];
+end
+
+always @ (*) begin
+	loops_300_exit252_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_300_exit252_add_8_8_0[7:0] = (loops_300_exit252_add_8_8_0_op0 + loops_300_exit252_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_exit153_icmp_8_0_op0[2:0] = loops_300_exit153_216[31:0];
+end
+
+always @ (*) begin
+	loops_300_exit153_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_300_exit153_icmp_8_0 = (loops_300_exit153_icmp_8_0_op0 < loops_300_exit153_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_exit153_add_8_8_1_op0[7:0] = loops_300_loop049_197_reg[1:0];
+end
+
+always @ (*) begin
+	loops_300_exit153_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_300_exit153_add_8_8_1[7:0] = (loops_300_exit153_add_8_8_1_op0 + loops_300_exit153_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_300_loop257_icmp_8_0_op0[2:0] = loops_300_loop257_233[31:0];
+end
+
+always @ (*) begin
+	loops_300_loop257_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_300_loop257_icmp_8_0 = (loops_300_loop257_icmp_8_0_op0 < loops_300_loop257_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_loop257_add_8_8_0_op0[7:0] = loops_300_loop257_222_reg[1:0];
+end
+
+always @ (*) begin
+	loops_300_loop257_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_300_loop257_add_8_8_0[7:0] = (loops_300_loop257_add_8_8_0_op0 + loops_300_loop257_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_loop257_and_8_8_0_op0[7:0] = loops_300_loop233_143_reg[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop257_and_8_8_0_op1[7:0] = loops_300_loop233_143_reg[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop257_and_8_8_0[7:0] = (loops_300_loop257_and_8_8_0_op0 & loops_300_loop257_and_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_loop257_or_32_32_0_op0[31:0] = loops_300_loop233_147_reg[31:0];
+end
+
+always @ (*) begin
+	loops_300_loop257_or_32_32_0_op1[31:0] = loops_300_loop239_166_reg[31:0];
+end
+
+always @ (*) begin
+	loops_300_loop257_or_32_32_0[31:0] = (loops_300_loop257_or_32_32_0_op0 | loops_300_loop257_or_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_300_loop257_mul_16_16_0_op0[15:0] = loops_300_loop245_188_reg[15:0];
+end
+
+always @ (*) begin
+	loops_300_loop257_mul_16_16_0_op1[15:0] = loops_300_loop251_205_reg[15:0];
+end
+
+always @ (*) begin
+	loops_300_loop257_mul_16_16_0[15:0] = (loops_300_loop257_mul_16_16_0_op0 * loops_300_loop257_mul_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_300_exit258_icmp_8_0_op0[2:0] = loops_300_exit258_235[31:0];
+end
+
+always @ (*) begin
+	loops_300_exit258_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_300_exit258_icmp_8_0 = (loops_300_exit258_icmp_8_0_op0 < loops_300_exit258_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_exit258_add_8_8_1_op0[7:0] = loops_300_loop156_220_reg[1:0];
+end
+
+always @ (*) begin
+	loops_300_exit258_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_300_exit258_add_8_8_1[7:0] = (loops_300_exit258_add_8_8_1_op0 + loops_300_exit258_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_300_exit159_icmp_8_0_op0[2:0] = loops_300_exit159_237[31:0];
+end
+
+always @ (*) begin
+	loops_300_exit159_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_300_exit159_icmp_8_0 = (loops_300_exit159_icmp_8_0_op0 < loops_300_exit159_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_exit159_add_8_8_0_op0[7:0] = loops_300_loop055_218_reg[1:0];
+end
+
+always @ (*) begin
+	loops_300_exit159_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_300_exit159_add_8_8_0[7:0] = (loops_300_exit159_add_8_8_0_op0 + loops_300_exit159_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_loop263_icmp_8_0_op0[2:0] = loops_300_loop263_254[31:0];
+end
+
+always @ (*) begin
+	loops_300_loop263_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_300_loop263_icmp_8_0 = (loops_300_loop263_icmp_8_0_op0 < loops_300_loop263_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_loop263_mul_8_8_0_op0[7:0] = loops_300_loop251_206_reg;
+end
+
+always @ (*) begin
+	loops_300_loop263_mul_8_8_0_op1[7:0] = loops_300_loop245_185_reg[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop263_mul_8_8_0[7:0] = (loops_300_loop263_mul_8_8_0_op0 * loops_300_loop263_mul_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_loop263_add_8_8_1_op0[7:0] = loops_300_loop233_146_reg[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop263_add_8_8_1_op1[7:0] = loops_300_loop251_210_reg[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop263_add_8_8_1[7:0] = (loops_300_loop263_add_8_8_1_op0 + loops_300_loop263_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_300_loop263_add_8_8_0_op0[7:0] = loops_300_loop263_243_reg[1:0];
+end
+
+always @ (*) begin
+	loops_300_loop263_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_300_loop263_add_8_8_0[7:0] = (loops_300_loop263_add_8_8_0_op0 + loops_300_loop263_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_loop263_add_16_16_1_op0[15:0] = loops_300_loop251_204_reg[15:0];
+end
+
+always @ (*) begin
+	loops_300_loop263_add_16_16_1_op1[15:0] = loops_300_loop251_208_reg[15:0];
+end
+
+always @ (*) begin
+	loops_300_loop263_add_16_16_1[15:0] = (loops_300_loop263_add_16_16_1_op0 + loops_300_loop263_add_16_16_1_op1);
+end
+
+always @ (*) begin
+	loops_300_exit264_icmp_8_0_op0[2:0] = loops_300_exit264_256[31:0];
+end
+
+always @ (*) begin
+	loops_300_exit264_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_300_exit264_icmp_8_0 = (loops_300_exit264_icmp_8_0_op0 < loops_300_exit264_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_exit264_add_8_8_0_op0[7:0] = loops_300_loop162_241_reg[1:0];
+end
+
+always @ (*) begin
+	loops_300_exit264_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_300_exit264_add_8_8_0[7:0] = (loops_300_exit264_add_8_8_0_op0 + loops_300_exit264_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_exit165_icmp_8_0_op0[2:0] = loops_300_exit165_258[31:0];
+end
+
+always @ (*) begin
+	loops_300_exit165_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_300_exit165_icmp_8_0 = (loops_300_exit165_icmp_8_0_op0 < loops_300_exit165_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_300_exit165_add_8_8_1_op0[7:0] = loops_300_loop061_239_reg[1:0];
+end
+
+always @ (*) begin
+	loops_300_exit165_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_300_exit165_add_8_8_1[7:0] = (loops_300_exit165_add_8_8_1_op0 + loops_300_exit165_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_300_loop2_16[63:0] = (arg_7 ^ arg_7);
+end
+
+always @ (*) begin
+	loops_300_loop23_37[7:0] = loops_300_loop23_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop29_56[63:0] = (loops_300_loop23_34_reg * arg_6);
+end
+
+always @ (*) begin
+	loops_300_loop29_62[63:0] = (loops_300_loop23_40_reg - loops_300_loop2_17_reg);
+end
+
+always @ (*) begin
+	loops_300_loop215_78[63:0] = (loops_300_loop29_55_reg & loops_300_loop23_41_reg);
+end
+
+always @ (*) begin
+	loops_300_loop227_123[15:0] = (loops_300_loop215_83_reg ^ loops_300_loop215_80_reg);
+end
+
+always @ (*) begin
+	loops_300_loop233_144[63:0] = (loops_300_loop227_118_reg + loops_300_loop227_124_reg);
+end
+
+always @ (*) begin
+	loops_300_loop239_167[63:0] = (loops_300_loop221_105_reg - loops_300_loop227_122_reg);
+end
+
+always @ (*) begin
+	loops_300_loop239_165[31:0] = (loops_300_loop239_162 ^ loops_300_loop239_161_reg);
+end
+
+always @ (*) begin
+	loops_300_loop239_163[31:0] = loops_300_loop239_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_300_loop245_187[31:0] = (loops_300_loop239_162_reg ^ loops_300_loop245_186);
+end
+
+always @ (*) begin
+	loops_300_loop251_203[63:0] = (loops_300_loop239_168_reg ^ loops_300_loop239_160_reg);
+end
+
+always @ (*) begin
+	loops_300_loop251_209[63:0] = (loops_300_loop239_160_reg & loops_300_loop251_207_reg);
+end
+
+always @ (*) begin
+	loops_300_loop257_227[15:0] = (loops_300_loop245_183_reg ^ loops_300_loop251_205_reg);
+end
+
+always @ (*) begin
+	loops_300_loop257_228[7:0] = loops_300_loop257_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop257_230[31:0] = (loops_300_loop239_161_reg ^ loops_300_loop257_226);
+end
+
+always @ (*) begin
+	loops_300_loop263_245[63:0] = (loops_300_loop263_244_reg + loops_300_loop251_202_reg);
+end
+
+always @ (*) begin
+	loops_300_loop263_246[15:0] = (loops_300_loop251_205_reg ^ loops_300_loop257_229_reg);
+end
+
+always @ (*) begin
+	loops_300_loop263_247[7:0] = loops_300_loop263_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop263_248[15:0] = loops_300_loop263_add_16_16_1[15:0];
+end
+
+always @ (*) begin
+	loops_300_loop263_249[7:0] = loops_300_loop263_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_300_loop263_250[15:0] = (loops_300_loop257_224_reg - loops_300_loop251_205_reg);
+end
+
+always @ (*) begin
+	loops_300_loop263_251[63:0] = (loops_300_loop257_223_reg + loops_300_loop257_225_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS)) begin
+		finish <= 1'd0;
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_60_S_0)) begin
+		finish <= 1'd1;
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS)) begin
+		return_val[63:0] <= 64'd0;
+	end
+	if ((cur_state == BPHLS_F_loops_300_BB_60_S_0)) begin
+		return_val[63:0] <= loops_300_loop263_253_reg[63:0];
+	end
+end
+
+endmodule
@@ -0,0 +1,10408 @@
+module loops_600
+(
+	input wire  clk,
+	input wire  reset,
+	input wire  start,
+	output reg  finish,
+	output reg [63:0] return_val,
+	input wire [7:0] arg_0,
+	input wire [7:0] arg_1,
+	input wire [15:0] arg_2,
+	input wire [15:0] arg_3,
+	input wire [31:0] arg_4,
+	input wire [31:0] arg_5,
+	input wire [63:0] arg_6,
+	input wire [63:0] arg_7
+);
+
+parameter [7:0] BPHLS = 8'd0;
+parameter [7:0] BPHLS_F_loops_600_BB_0_S_0 = 8'd1;
+parameter [7:0] BPHLS_F_loops_600_BB_1_S_0 = 8'd2;
+parameter [7:0] BPHLS_F_loops_600_BB_2_S_0 = 8'd3;
+parameter [7:0] BPHLS_F_loops_600_BB_2_S_1 = 8'd4;
+parameter [7:0] BPHLS_F_loops_600_BB_3_S_0 = 8'd5;
+parameter [7:0] BPHLS_F_loops_600_BB_3_S_1 = 8'd6;
+parameter [7:0] BPHLS_F_loops_600_BB_4_S_0 = 8'd7;
+parameter [7:0] BPHLS_F_loops_600_BB_4_S_1 = 8'd8;
+parameter [7:0] BPHLS_F_loops_600_BB_5_S_0 = 8'd9;
+parameter [7:0] BPHLS_F_loops_600_BB_6_S_0 = 8'd10;
+parameter [7:0] BPHLS_F_loops_600_BB_7_S_0 = 8'd11;
+parameter [7:0] BPHLS_F_loops_600_BB_7_S_1 = 8'd12;
+parameter [7:0] BPHLS_F_loops_600_BB_7_S_2 = 8'd13;
+parameter [7:0] BPHLS_F_loops_600_BB_8_S_0 = 8'd14;
+parameter [7:0] BPHLS_F_loops_600_BB_8_S_1 = 8'd15;
+parameter [7:0] BPHLS_F_loops_600_BB_9_S_0 = 8'd16;
+parameter [7:0] BPHLS_F_loops_600_BB_9_S_1 = 8'd17;
+parameter [7:0] BPHLS_F_loops_600_BB_10_S_0 = 8'd18;
+parameter [7:0] BPHLS_F_loops_600_BB_11_S_0 = 8'd19;
+parameter [7:0] BPHLS_F_loops_600_BB_12_S_0 = 8'd20;
+parameter [7:0] BPHLS_F_loops_600_BB_12_S_1 = 8'd21;
+parameter [7:0] BPHLS_F_loops_600_BB_13_S_0 = 8'd22;
+parameter [7:0] BPHLS_F_loops_600_BB_13_S_1 = 8'd23;
+parameter [7:0] BPHLS_F_loops_600_BB_14_S_0 = 8'd24;
+parameter [7:0] BPHLS_F_loops_600_BB_14_S_1 = 8'd25;
+parameter [7:0] BPHLS_F_loops_600_BB_15_S_0 = 8'd26;
+parameter [7:0] BPHLS_F_loops_600_BB_16_S_0 = 8'd27;
+parameter [7:0] BPHLS_F_loops_600_BB_17_S_0 = 8'd28;
+parameter [7:0] BPHLS_F_loops_600_BB_17_S_1 = 8'd29;
+parameter [7:0] BPHLS_F_loops_600_BB_18_S_0 = 8'd30;
+parameter [7:0] BPHLS_F_loops_600_BB_18_S_1 = 8'd31;
+parameter [7:0] BPHLS_F_loops_600_BB_19_S_0 = 8'd32;
+parameter [7:0] BPHLS_F_loops_600_BB_19_S_1 = 8'd33;
+parameter [7:0] BPHLS_F_loops_600_BB_20_S_0 = 8'd34;
+parameter [7:0] BPHLS_F_loops_600_BB_21_S_0 = 8'd35;
+parameter [7:0] BPHLS_F_loops_600_BB_22_S_0 = 8'd36;
+parameter [7:0] BPHLS_F_loops_600_BB_22_S_1 = 8'd37;
+parameter [7:0] BPHLS_F_loops_600_BB_23_S_0 = 8'd38;
+parameter [7:0] BPHLS_F_loops_600_BB_23_S_1 = 8'd39;
+parameter [7:0] BPHLS_F_loops_600_BB_24_S_0 = 8'd40;
+parameter [7:0] BPHLS_F_loops_600_BB_24_S_1 = 8'd41;
+parameter [7:0] BPHLS_F_loops_600_BB_25_S_0 = 8'd42;
+parameter [7:0] BPHLS_F_loops_600_BB_26_S_0 = 8'd43;
+parameter [7:0] BPHLS_F_loops_600_BB_27_S_0 = 8'd44;
+parameter [7:0] BPHLS_F_loops_600_BB_27_S_1 = 8'd45;
+parameter [7:0] BPHLS_F_loops_600_BB_28_S_0 = 8'd46;
+parameter [7:0] BPHLS_F_loops_600_BB_28_S_1 = 8'd47;
+parameter [7:0] BPHLS_F_loops_600_BB_29_S_0 = 8'd48;
+parameter [7:0] BPHLS_F_loops_600_BB_29_S_1 = 8'd49;
+parameter [7:0] BPHLS_F_loops_600_BB_30_S_0 = 8'd50;
+parameter [7:0] BPHLS_F_loops_600_BB_31_S_0 = 8'd51;
+parameter [7:0] BPHLS_F_loops_600_BB_32_S_0 = 8'd52;
+parameter [7:0] BPHLS_F_loops_600_BB_32_S_1 = 8'd53;
+parameter [7:0] BPHLS_F_loops_600_BB_32_S_2 = 8'd54;
+parameter [7:0] BPHLS_F_loops_600_BB_33_S_0 = 8'd55;
+parameter [7:0] BPHLS_F_loops_600_BB_33_S_1 = 8'd56;
+parameter [7:0] BPHLS_F_loops_600_BB_34_S_0 = 8'd57;
+parameter [7:0] BPHLS_F_loops_600_BB_34_S_1 = 8'd58;
+parameter [7:0] BPHLS_F_loops_600_BB_35_S_0 = 8'd59;
+parameter [7:0] BPHLS_F_loops_600_BB_36_S_0 = 8'd60;
+parameter [7:0] BPHLS_F_loops_600_BB_37_S_0 = 8'd61;
+parameter [7:0] BPHLS_F_loops_600_BB_37_S_1 = 8'd62;
+parameter [7:0] BPHLS_F_loops_600_BB_37_S_2 = 8'd63;
+parameter [7:0] BPHLS_F_loops_600_BB_38_S_0 = 8'd64;
+parameter [7:0] BPHLS_F_loops_600_BB_38_S_1 = 8'd65;
+parameter [7:0] BPHLS_F_loops_600_BB_39_S_0 = 8'd66;
+parameter [7:0] BPHLS_F_loops_600_BB_39_S_1 = 8'd67;
+parameter [7:0] BPHLS_F_loops_600_BB_40_S_0 = 8'd68;
+parameter [7:0] BPHLS_F_loops_600_BB_41_S_0 = 8'd69;
+parameter [7:0] BPHLS_F_loops_600_BB_42_S_0 = 8'd70;
+parameter [7:0] BPHLS_F_loops_600_BB_42_S_1 = 8'd71;
+parameter [7:0] BPHLS_F_loops_600_BB_43_S_0 = 8'd72;
+parameter [7:0] BPHLS_F_loops_600_BB_43_S_1 = 8'd73;
+parameter [7:0] BPHLS_F_loops_600_BB_44_S_0 = 8'd74;
+parameter [7:0] BPHLS_F_loops_600_BB_44_S_1 = 8'd75;
+parameter [7:0] BPHLS_F_loops_600_BB_45_S_0 = 8'd76;
+parameter [7:0] BPHLS_F_loops_600_BB_46_S_0 = 8'd77;
+parameter [7:0] BPHLS_F_loops_600_BB_47_S_0 = 8'd78;
+parameter [7:0] BPHLS_F_loops_600_BB_47_S_1 = 8'd79;
+parameter [7:0] BPHLS_F_loops_600_BB_48_S_0 = 8'd80;
+parameter [7:0] BPHLS_F_loops_600_BB_48_S_1 = 8'd81;
+parameter [7:0] BPHLS_F_loops_600_BB_49_S_0 = 8'd82;
+parameter [7:0] BPHLS_F_loops_600_BB_49_S_1 = 8'd83;
+parameter [7:0] BPHLS_F_loops_600_BB_50_S_0 = 8'd84;
+parameter [7:0] BPHLS_F_loops_600_BB_51_S_0 = 8'd85;
+parameter [7:0] BPHLS_F_loops_600_BB_52_S_0 = 8'd86;
+parameter [7:0] BPHLS_F_loops_600_BB_52_S_1 = 8'd87;
+parameter [7:0] BPHLS_F_loops_600_BB_53_S_0 = 8'd88;
+parameter [7:0] BPHLS_F_loops_600_BB_53_S_1 = 8'd89;
+parameter [7:0] BPHLS_F_loops_600_BB_54_S_0 = 8'd90;
+parameter [7:0] BPHLS_F_loops_600_BB_54_S_1 = 8'd91;
+parameter [7:0] BPHLS_F_loops_600_BB_55_S_0 = 8'd92;
+parameter [7:0] BPHLS_F_loops_600_BB_56_S_0 = 8'd93;
+parameter [7:0] BPHLS_F_loops_600_BB_57_S_0 = 8'd94;
+parameter [7:0] BPHLS_F_loops_600_BB_57_S_1 = 8'd95;
+parameter [7:0] BPHLS_F_loops_600_BB_58_S_0 = 8'd96;
+parameter [7:0] BPHLS_F_loops_600_BB_58_S_1 = 8'd97;
+parameter [7:0] BPHLS_F_loops_600_BB_59_S_0 = 8'd98;
+parameter [7:0] BPHLS_F_loops_600_BB_59_S_1 = 8'd99;
+parameter [7:0] BPHLS_F_loops_600_BB_60_S_0 = 8'd100;
+parameter [7:0] BPHLS_F_loops_600_BB_61_S_0 = 8'd101;
+parameter [7:0] BPHLS_F_loops_600_BB_62_S_0 = 8'd102;
+parameter [7:0] BPHLS_F_loops_600_BB_62_S_1 = 8'd103;
+parameter [7:0] BPHLS_F_loops_600_BB_63_S_0 = 8'd104;
+parameter [7:0] BPHLS_F_loops_600_BB_63_S_1 = 8'd105;
+parameter [7:0] BPHLS_F_loops_600_BB_64_S_0 = 8'd106;
+parameter [7:0] BPHLS_F_loops_600_BB_64_S_1 = 8'd107;
+parameter [7:0] BPHLS_F_loops_600_BB_65_S_0 = 8'd108;
+parameter [7:0] BPHLS_F_loops_600_BB_66_S_0 = 8'd109;
+parameter [7:0] BPHLS_F_loops_600_BB_67_S_0 = 8'd110;
+parameter [7:0] BPHLS_F_loops_600_BB_67_S_1 = 8'd111;
+parameter [7:0] BPHLS_F_loops_600_BB_68_S_0 = 8'd112;
+parameter [7:0] BPHLS_F_loops_600_BB_68_S_1 = 8'd113;
+parameter [7:0] BPHLS_F_loops_600_BB_69_S_0 = 8'd114;
+parameter [7:0] BPHLS_F_loops_600_BB_69_S_1 = 8'd115;
+parameter [7:0] BPHLS_F_loops_600_BB_70_S_0 = 8'd116;
+parameter [7:0] BPHLS_F_loops_600_BB_71_S_0 = 8'd117;
+parameter [7:0] BPHLS_F_loops_600_BB_72_S_0 = 8'd118;
+parameter [7:0] BPHLS_F_loops_600_BB_72_S_1 = 8'd119;
+parameter [7:0] BPHLS_F_loops_600_BB_73_S_0 = 8'd120;
+parameter [7:0] BPHLS_F_loops_600_BB_73_S_1 = 8'd121;
+parameter [7:0] BPHLS_F_loops_600_BB_74_S_0 = 8'd122;
+parameter [7:0] BPHLS_F_loops_600_BB_74_S_1 = 8'd123;
+parameter [7:0] BPHLS_F_loops_600_BB_75_S_0 = 8'd124;
+parameter [7:0] BPHLS_F_loops_600_BB_76_S_0 = 8'd125;
+parameter [7:0] BPHLS_F_loops_600_BB_77_S_0 = 8'd126;
+parameter [7:0] BPHLS_F_loops_600_BB_77_S_1 = 8'd127;
+parameter [7:0] BPHLS_F_loops_600_BB_78_S_0 = 8'd128;
+parameter [7:0] BPHLS_F_loops_600_BB_78_S_1 = 8'd129;
+parameter [7:0] BPHLS_F_loops_600_BB_79_S_0 = 8'd130;
+parameter [7:0] BPHLS_F_loops_600_BB_79_S_1 = 8'd131;
+parameter [7:0] BPHLS_F_loops_600_BB_80_S_0 = 8'd132;
+parameter [7:0] BPHLS_F_loops_600_BB_81_S_0 = 8'd133;
+parameter [7:0] BPHLS_F_loops_600_BB_82_S_0 = 8'd134;
+parameter [7:0] BPHLS_F_loops_600_BB_82_S_1 = 8'd135;
+parameter [7:0] BPHLS_F_loops_600_BB_82_S_2 = 8'd136;
+parameter [7:0] BPHLS_F_loops_600_BB_82_S_3 = 8'd137;
+parameter [7:0] BPHLS_F_loops_600_BB_83_S_0 = 8'd138;
+parameter [7:0] BPHLS_F_loops_600_BB_83_S_1 = 8'd139;
+parameter [7:0] BPHLS_F_loops_600_BB_84_S_0 = 8'd140;
+parameter [7:0] BPHLS_F_loops_600_BB_84_S_1 = 8'd141;
+parameter [7:0] BPHLS_F_loops_600_BB_85_S_0 = 8'd142;
+parameter [7:0] BPHLS_F_loops_600_BB_86_S_0 = 8'd143;
+parameter [7:0] BPHLS_F_loops_600_BB_87_S_0 = 8'd144;
+parameter [7:0] BPHLS_F_loops_600_BB_87_S_1 = 8'd145;
+parameter [7:0] BPHLS_F_loops_600_BB_88_S_0 = 8'd146;
+parameter [7:0] BPHLS_F_loops_600_BB_88_S_1 = 8'd147;
+parameter [7:0] BPHLS_F_loops_600_BB_89_S_0 = 8'd148;
+parameter [7:0] BPHLS_F_loops_600_BB_89_S_1 = 8'd149;
+parameter [7:0] BPHLS_F_loops_600_BB_90_S_0 = 8'd150;
+parameter [7:0] BPHLS_F_loops_600_BB_91_S_0 = 8'd151;
+parameter [7:0] BPHLS_F_loops_600_BB_92_S_0 = 8'd152;
+parameter [7:0] BPHLS_F_loops_600_BB_92_S_1 = 8'd153;
+parameter [7:0] BPHLS_F_loops_600_BB_93_S_0 = 8'd154;
+parameter [7:0] BPHLS_F_loops_600_BB_93_S_1 = 8'd155;
+parameter [7:0] BPHLS_F_loops_600_BB_94_S_0 = 8'd156;
+parameter [7:0] BPHLS_F_loops_600_BB_94_S_1 = 8'd157;
+parameter [7:0] BPHLS_F_loops_600_BB_95_S_0 = 8'd158;
+parameter [7:0] BPHLS_F_loops_600_BB_96_S_0 = 8'd159;
+parameter [7:0] BPHLS_F_loops_600_BB_97_S_0 = 8'd160;
+parameter [7:0] BPHLS_F_loops_600_BB_97_S_1 = 8'd161;
+parameter [7:0] BPHLS_F_loops_600_BB_98_S_0 = 8'd162;
+parameter [7:0] BPHLS_F_loops_600_BB_98_S_1 = 8'd163;
+parameter [7:0] BPHLS_F_loops_600_BB_99_S_0 = 8'd164;
+parameter [7:0] BPHLS_F_loops_600_BB_99_S_1 = 8'd165;
+parameter [7:0] BPHLS_F_loops_600_BB_100_S_0 = 8'd166;
+parameter [7:0] BPHLS_F_loops_600_BB_101_S_0 = 8'd167;
+parameter [7:0] BPHLS_F_loops_600_BB_102_S_0 = 8'd168;
+parameter [7:0] BPHLS_F_loops_600_BB_102_S_1 = 8'd169;
+parameter [7:0] BPHLS_F_loops_600_BB_103_S_0 = 8'd170;
+parameter [7:0] BPHLS_F_loops_600_BB_103_S_1 = 8'd171;
+parameter [7:0] BPHLS_F_loops_600_BB_104_S_0 = 8'd172;
+parameter [7:0] BPHLS_F_loops_600_BB_104_S_1 = 8'd173;
+parameter [7:0] BPHLS_F_loops_600_BB_105_S_0 = 8'd174;
+parameter [7:0] BPHLS_F_loops_600_BB_106_S_0 = 8'd175;
+parameter [7:0] BPHLS_F_loops_600_BB_107_S_0 = 8'd176;
+parameter [7:0] BPHLS_F_loops_600_BB_107_S_1 = 8'd177;
+parameter [7:0] BPHLS_F_loops_600_BB_108_S_0 = 8'd178;
+parameter [7:0] BPHLS_F_loops_600_BB_108_S_1 = 8'd179;
+parameter [7:0] BPHLS_F_loops_600_BB_109_S_0 = 8'd180;
+parameter [7:0] BPHLS_F_loops_600_BB_109_S_1 = 8'd181;
+parameter [7:0] BPHLS_F_loops_600_BB_110_S_0 = 8'd182;
+parameter [7:0] BPHLS_F_loops_600_BB_111_S_0 = 8'd183;
+parameter [7:0] BPHLS_F_loops_600_BB_112_S_0 = 8'd184;
+parameter [7:0] BPHLS_F_loops_600_BB_112_S_1 = 8'd185;
+parameter [7:0] BPHLS_F_loops_600_BB_113_S_0 = 8'd186;
+parameter [7:0] BPHLS_F_loops_600_BB_113_S_1 = 8'd187;
+parameter [7:0] BPHLS_F_loops_600_BB_114_S_0 = 8'd188;
+parameter [7:0] BPHLS_F_loops_600_BB_114_S_1 = 8'd189;
+parameter [7:0] BPHLS_F_loops_600_BB_115_S_0 = 8'd190;
+parameter [7:0] BPHLS_F_loops_600_BB_116_S_0 = 8'd191;
+parameter [7:0] BPHLS_F_loops_600_BB_117_S_0 = 8'd192;
+parameter [7:0] BPHLS_F_loops_600_BB_117_S_1 = 8'd193;
+parameter [7:0] BPHLS_F_loops_600_BB_118_S_0 = 8'd194;
+parameter [7:0] BPHLS_F_loops_600_BB_118_S_1 = 8'd195;
+parameter [7:0] BPHLS_F_loops_600_BB_119_S_0 = 8'd196;
+parameter [7:0] BPHLS_F_loops_600_BB_119_S_1 = 8'd197;
+parameter [7:0] BPHLS_F_loops_600_BB_120_S_0 = 8'd198;
+
+reg [7:0] cur_state;
+reg [7:0] next_state;
+wire [1:0] loops_600_loop0_8;
+reg [1:0] loops_600_loop0_8_reg;
+wire [63:0] loops_600_loop0_9;
+reg [63:0] loops_600_loop0_9_reg;
+wire [1:0] loops_600_loop1_10;
+reg [1:0] loops_600_loop1_10_reg;
+wire [63:0] loops_600_loop1_11;
+reg [63:0] loops_600_loop1_11_reg;
+wire [1:0] loops_600_loop2_12;
+reg [1:0] loops_600_loop2_12_reg;
+wire [63:0] loops_600_loop2_13;
+reg [63:0] loops_600_loop2_13_reg;
+reg [15:0] loops_600_loop2_14;
+reg [15:0] loops_600_loop2_14_reg;
+reg [31:0] loops_600_loop2_15;
+reg [31:0] loops_600_loop2_15_reg;
+reg [7:0] loops_600_loop2_17;
+reg [7:0] loops_600_loop2_17_reg;
+reg [7:0] loops_600_loop2_18;
+reg [7:0] loops_600_loop2_18_reg;
+reg [31:0] loops_600_loop2_19;
+reg [31:0] loops_600_loop2_19_reg;
+reg [15:0] loops_600_loop2_20;
+reg [15:0] loops_600_loop2_20_reg;
+reg [7:0] loops_600_loop2_21;
+reg [7:0] loops_600_loop2_21_reg;
+reg [63:0] loops_600_loop2_22;
+reg [63:0] loops_600_loop2_22_reg;
+reg [31:0] loops_600_loop2_23;
+reg [7:0] loops_600_loop2_23_reg;
+reg  loops_600_loop2_24;
+reg  loops_600_loop2_24_reg;
+reg [31:0] loops_600_exit2_25;
+reg [2:0] loops_600_exit2_25_reg;
+reg  loops_600_exit2_26;
+reg  loops_600_exit2_26_reg;
+reg [31:0] loops_600_exit1_27;
+reg [2:0] loops_600_exit1_27_reg;
+reg  loops_600_exit1_28;
+reg  loops_600_exit1_28_reg;
+wire [1:0] loops_600_loop01_29;
+reg [1:0] loops_600_loop01_29_reg;
+wire [63:0] loops_600_loop01_30;
+reg [63:0] loops_600_loop01_30_reg;
+wire [1:0] loops_600_loop12_31;
+reg [1:0] loops_600_loop12_31_reg;
+wire [63:0] loops_600_loop12_32;
+reg [63:0] loops_600_loop12_32_reg;
+wire [1:0] loops_600_loop23_33;
+reg [1:0] loops_600_loop23_33_reg;
+wire [63:0] loops_600_loop23_34;
+reg [63:0] loops_600_loop23_34_reg;
+reg [15:0] loops_600_loop23_35;
+reg [15:0] loops_600_loop23_35_reg;
+reg [63:0] loops_600_loop23_36;
+reg [63:0] loops_600_loop23_36_reg;
+reg [15:0] loops_600_loop23_38;
+reg [15:0] loops_600_loop23_38_reg;
+reg [7:0] loops_600_loop23_39;
+reg [7:0] loops_600_loop23_39_reg;
+reg [63:0] loops_600_loop23_40;
+reg [63:0] loops_600_loop23_40_reg;
+reg [7:0] loops_600_loop23_41;
+reg [7:0] loops_600_loop23_41_reg;
+reg [7:0] loops_600_loop23_42;
+reg [7:0] loops_600_loop23_42_reg;
+reg [63:0] loops_600_loop23_43;
+reg [63:0] loops_600_loop23_43_reg;
+reg [31:0] loops_600_loop23_44;
+reg [7:0] loops_600_loop23_44_reg;
+reg  loops_600_loop23_45;
+reg  loops_600_loop23_45_reg;
+reg [31:0] loops_600_exit24_46;
+reg [2:0] loops_600_exit24_46_reg;
+reg  loops_600_exit24_47;
+reg  loops_600_exit24_47_reg;
+reg [31:0] loops_600_exit15_48;
+reg [2:0] loops_600_exit15_48_reg;
+reg  loops_600_exit15_49;
+reg  loops_600_exit15_49_reg;
+wire [1:0] loops_600_loop07_50;
+reg [1:0] loops_600_loop07_50_reg;
+wire [63:0] loops_600_loop07_51;
+reg [63:0] loops_600_loop07_51_reg;
+wire [1:0] loops_600_loop18_52;
+reg [1:0] loops_600_loop18_52_reg;
+wire [63:0] loops_600_loop18_53;
+reg [63:0] loops_600_loop18_53_reg;
+wire [1:0] loops_600_loop29_54;
+reg [1:0] loops_600_loop29_54_reg;
+wire [63:0] loops_600_loop29_55;
+reg [63:0] loops_600_loop29_55_reg;
+reg [31:0] loops_600_loop29_57;
+reg [31:0] loops_600_loop29_57_reg;
+reg [31:0] loops_600_loop29_58;
+reg [31:0] loops_600_loop29_58_reg;
+reg [31:0] loops_600_loop29_59;
+reg [31:0] loops_600_loop29_59_reg;
+reg [63:0] loops_600_loop29_60;
+reg [63:0] loops_600_loop29_60_reg;
+reg [15:0] loops_600_loop29_61;
+reg [15:0] loops_600_loop29_61_reg;
+reg [31:0] loops_600_loop29_63;
+reg [31:0] loops_600_loop29_63_reg;
+reg [63:0] loops_600_loop29_64;
+reg [63:0] loops_600_loop29_64_reg;
+reg [31:0] loops_600_loop29_65;
+reg [2:0] loops_600_loop29_65_reg;
+reg  loops_600_loop29_66;
+reg  loops_600_loop29_66_reg;
+reg [31:0] loops_600_exit210_67;
+reg [2:0] loops_600_exit210_67_reg;
+reg  loops_600_exit210_68;
+reg  loops_600_exit210_68_reg;
+reg [31:0] loops_600_exit111_69;
+reg [2:0] loops_600_exit111_69_reg;
+reg  loops_600_exit111_70;
+reg  loops_600_exit111_70_reg;
+wire [1:0] loops_600_loop013_71;
+reg [1:0] loops_600_loop013_71_reg;
+wire [63:0] loops_600_loop013_72;
+reg [63:0] loops_600_loop013_72_reg;
+wire [1:0] loops_600_loop114_73;
+reg [1:0] loops_600_loop114_73_reg;
+wire [63:0] loops_600_loop114_74;
+reg [63:0] loops_600_loop114_74_reg;
+wire [1:0] loops_600_loop215_75;
+reg [1:0] loops_600_loop215_75_reg;
+wire [63:0] loops_600_loop215_76;
+reg [63:0] loops_600_loop215_76_reg;
+reg [7:0] loops_600_loop215_77;
+reg [7:0] loops_600_loop215_77_reg;
+reg [31:0] loops_600_loop215_79;
+reg [31:0] loops_600_loop215_79_reg;
+reg [15:0] loops_600_loop215_80;
+reg [15:0] loops_600_loop215_80_reg;
+reg [63:0] loops_600_loop215_81;
+reg [63:0] loops_600_loop215_81_reg;
+reg [7:0] loops_600_loop215_82;
+reg [7:0] loops_600_loop215_82_reg;
+reg [15:0] loops_600_loop215_83;
+reg [15:0] loops_600_loop215_83_reg;
+reg [31:0] loops_600_loop215_84;
+reg [31:0] loops_600_loop215_84_reg;
+reg [63:0] loops_600_loop215_85;
+reg [63:0] loops_600_loop215_85_reg;
+reg [31:0] loops_600_loop215_86;
+reg [2:0] loops_600_loop215_86_reg;
+reg  loops_600_loop215_87;
+reg  loops_600_loop215_87_reg;
+reg [31:0] loops_600_exit216_88;
+reg [2:0] loops_600_exit216_88_reg;
+reg  loops_600_exit216_89;
+reg  loops_600_exit216_89_reg;
+reg [31:0] loops_600_exit117_90;
+reg [2:0] loops_600_exit117_90_reg;
+reg  loops_600_exit117_91;
+reg  loops_600_exit117_91_reg;
+wire [1:0] loops_600_loop019_92;
+reg [1:0] loops_600_loop019_92_reg;
+wire [63:0] loops_600_loop019_93;
+reg [63:0] loops_600_loop019_93_reg;
+wire [1:0] loops_600_loop120_94;
+reg [1:0] loops_600_loop120_94_reg;
+wire [63:0] loops_600_loop120_95;
+reg [63:0] loops_600_loop120_95_reg;
+wire [1:0] loops_600_loop221_96;
+reg [1:0] loops_600_loop221_96_reg;
+wire [63:0] loops_600_loop221_97;
+reg [63:0] loops_600_loop221_97_reg;
+reg [63:0] loops_600_loop221_98;
+reg [63:0] loops_600_loop221_98_reg;
+reg [63:0] loops_600_loop221_99;
+reg [63:0] loops_600_loop221_99_reg;
+reg [7:0] loops_600_loop221_100;
+reg [7:0] loops_600_loop221_100_reg;
+reg [31:0] loops_600_loop221_101;
+reg [31:0] loops_600_loop221_101_reg;
+reg [7:0] loops_600_loop221_102;
+reg [7:0] loops_600_loop221_102_reg;
+reg [63:0] loops_600_loop221_103;
+reg [63:0] loops_600_loop221_103_reg;
+reg [7:0] loops_600_loop221_104;
+reg [7:0] loops_600_loop221_104_reg;
+reg [63:0] loops_600_loop221_105;
+reg [63:0] loops_600_loop221_105_reg;
+reg [63:0] loops_600_loop221_106;
+reg [63:0] loops_600_loop221_106_reg;
+reg [31:0] loops_600_loop221_107;
+reg [2:0] loops_600_loop221_107_reg;
+reg  loops_600_loop221_108;
+reg  loops_600_loop221_108_reg;
+reg [31:0] loops_600_exit222_109;
+reg [2:0] loops_600_exit222_109_reg;
+reg  loops_600_exit222_110;
+reg  loops_600_exit222_110_reg;
+reg [31:0] loops_600_exit123_111;
+reg [7:0] loops_600_exit123_111_reg;
+reg  loops_600_exit123_112;
+reg  loops_600_exit123_112_reg;
+wire [1:0] loops_600_loop025_113;
+reg [1:0] loops_600_loop025_113_reg;
+wire [63:0] loops_600_loop025_114;
+reg [63:0] loops_600_loop025_114_reg;
+wire [1:0] loops_600_loop126_115;
+reg [1:0] loops_600_loop126_115_reg;
+wire [63:0] loops_600_loop126_116;
+reg [63:0] loops_600_loop126_116_reg;
+wire [1:0] loops_600_loop227_117;
+reg [1:0] loops_600_loop227_117_reg;
+wire [63:0] loops_600_loop227_118;
+reg [63:0] loops_600_loop227_118_reg;
+reg [15:0] loops_600_loop227_119;
+reg [15:0] loops_600_loop227_119_reg;
+reg [7:0] loops_600_loop227_120;
+reg [7:0] loops_600_loop227_120_reg;
+reg [31:0] loops_600_loop227_121;
+reg [31:0] loops_600_loop227_121_reg;
+reg [63:0] loops_600_loop227_122;
+reg [63:0] loops_600_loop227_122_reg;
+reg [63:0] loops_600_loop227_124;
+reg [63:0] loops_600_loop227_124_reg;
+reg [31:0] loops_600_loop227_125;
+reg [31:0] loops_600_loop227_125_reg;
+reg [15:0] loops_600_loop227_126;
+reg [15:0] loops_600_loop227_126_reg;
+reg [63:0] loops_600_loop227_127;
+reg [63:0] loops_600_loop227_127_reg;
+reg [31:0] loops_600_loop227_128;
+reg [2:0] loops_600_loop227_128_reg;
+reg  loops_600_loop227_129;
+reg  loops_600_loop227_129_reg;
+reg [31:0] loops_600_exit228_130;
+reg [2:0] loops_600_exit228_130_reg;
+reg  loops_600_exit228_131;
+reg  loops_600_exit228_131_reg;
+reg [31:0] loops_600_exit129_132;
+reg [2:0] loops_600_exit129_132_reg;
+reg  loops_600_exit129_133;
+reg  loops_600_exit129_133_reg;
+wire [1:0] loops_600_loop031_134;
+reg [1:0] loops_600_loop031_134_reg;
+wire [63:0] loops_600_loop031_135;
+reg [63:0] loops_600_loop031_135_reg;
+wire [1:0] loops_600_loop132_136;
+reg [1:0] loops_600_loop132_136_reg;
+wire [63:0] loops_600_loop132_137;
+reg [63:0] loops_600_loop132_137_reg;
+wire [1:0] loops_600_loop233_138;
+reg [1:0] loops_600_loop233_138_reg;
+wire [63:0] loops_600_loop233_139;
+reg [63:0] loops_600_loop233_139_reg;
+reg [7:0] loops_600_loop233_140;
+reg [7:0] loops_600_loop233_140_reg;
+reg [63:0] loops_600_loop233_141;
+reg [63:0] loops_600_loop233_141_reg;
+reg [15:0] loops_600_loop233_142;
+reg [15:0] loops_600_loop233_142_reg;
+reg [7:0] loops_600_loop233_143;
+reg [7:0] loops_600_loop233_143_reg;
+reg [31:0] loops_600_loop233_145;
+reg [31:0] loops_600_loop233_145_reg;
+reg [7:0] loops_600_loop233_146;
+reg [7:0] loops_600_loop233_146_reg;
+reg [31:0] loops_600_loop233_147;
+reg [31:0] loops_600_loop233_147_reg;
+reg [63:0] loops_600_loop233_148;
+reg [63:0] loops_600_loop233_148_reg;
+reg [31:0] loops_600_loop233_149;
+reg [2:0] loops_600_loop233_149_reg;
+reg  loops_600_loop233_150;
+reg  loops_600_loop233_150_reg;
+reg [31:0] loops_600_exit234_151;
+reg [2:0] loops_600_exit234_151_reg;
+reg  loops_600_exit234_152;
+reg  loops_600_exit234_152_reg;
+reg [31:0] loops_600_exit135_153;
+reg [7:0] loops_600_exit135_153_reg;
+reg  loops_600_exit135_154;
+reg  loops_600_exit135_154_reg;
+wire [1:0] loops_600_loop037_155;
+reg [1:0] loops_600_loop037_155_reg;
+wire [63:0] loops_600_loop037_156;
+reg [63:0] loops_600_loop037_156_reg;
+wire [1:0] loops_600_loop138_157;
+reg [1:0] loops_600_loop138_157_reg;
+wire [63:0] loops_600_loop138_158;
+reg [63:0] loops_600_loop138_158_reg;
+wire [1:0] loops_600_loop239_159;
+reg [1:0] loops_600_loop239_159_reg;
+wire [63:0] loops_600_loop239_160;
+reg [63:0] loops_600_loop239_160_reg;
+reg [31:0] loops_600_loop239_161;
+reg [31:0] loops_600_loop239_161_reg;
+reg [31:0] loops_600_loop239_162;
+reg [31:0] loops_600_loop239_162_reg;
+reg [7:0] loops_600_loop239_164;
+reg [7:0] loops_600_loop239_164_reg;
+reg [31:0] loops_600_loop239_165;
+reg [31:0] loops_600_loop239_165_reg;
+reg [31:0] loops_600_loop239_166;
+reg [31:0] loops_600_loop239_166_reg;
+reg [63:0] loops_600_loop239_168;
+reg [63:0] loops_600_loop239_168_reg;
+reg [63:0] loops_600_loop239_169;
+reg [63:0] loops_600_loop239_169_reg;
+reg [31:0] loops_600_loop239_170;
+reg [2:0] loops_600_loop239_170_reg;
+reg  loops_600_loop239_171;
+reg  loops_600_loop239_171_reg;
+reg [31:0] loops_600_exit240_172;
+reg [2:0] loops_600_exit240_172_reg;
+reg  loops_600_exit240_173;
+reg  loops_600_exit240_173_reg;
+reg [31:0] loops_600_exit141_174;
+reg [2:0] loops_600_exit141_174_reg;
+reg  loops_600_exit141_175;
+reg  loops_600_exit141_175_reg;
+wire [1:0] loops_600_loop043_176;
+reg [1:0] loops_600_loop043_176_reg;
+wire [63:0] loops_600_loop043_177;
+reg [63:0] loops_600_loop043_177_reg;
+wire [1:0] loops_600_loop144_178;
+reg [1:0] loops_600_loop144_178_reg;
+wire [63:0] loops_600_loop144_179;
+reg [63:0] loops_600_loop144_179_reg;
+wire [1:0] loops_600_loop245_180;
+reg [1:0] loops_600_loop245_180_reg;
+wire [63:0] loops_600_loop245_181;
+reg [63:0] loops_600_loop245_181_reg;
+reg [15:0] loops_600_loop245_182;
+reg [15:0] loops_600_loop245_182_reg;
+reg [15:0] loops_600_loop245_183;
+reg [15:0] loops_600_loop245_183_reg;
+reg [15:0] loops_600_loop245_184;
+reg [15:0] loops_600_loop245_184_reg;
+reg [7:0] loops_600_loop245_185;
+reg [7:0] loops_600_loop245_185_reg;
+reg [31:0] loops_600_loop245_186;
+reg [31:0] loops_600_loop245_186_reg;
+reg [31:0] loops_600_loop245_187;
+reg [31:0] loops_600_loop245_187_reg;
+reg [15:0] loops_600_loop245_188;
+reg [15:0] loops_600_loop245_188_reg;
+reg [15:0] loops_600_loop245_189;
+reg [15:0] loops_600_loop245_189_reg;
+reg [63:0] loops_600_loop245_190;
+reg [63:0] loops_600_loop245_190_reg;
+reg [31:0] loops_600_loop245_191;
+reg [2:0] loops_600_loop245_191_reg;
+reg  loops_600_loop245_192;
+reg  loops_600_loop245_192_reg;
+reg [31:0] loops_600_exit246_193;
+reg [2:0] loops_600_exit246_193_reg;
+reg  loops_600_exit246_194;
+reg  loops_600_exit246_194_reg;
+reg [31:0] loops_600_exit147_195;
+reg [2:0] loops_600_exit147_195_reg;
+reg  loops_600_exit147_196;
+reg  loops_600_exit147_196_reg;
+wire [1:0] loops_600_loop049_197;
+reg [1:0] loops_600_loop049_197_reg;
+wire [63:0] loops_600_loop049_198;
+reg [63:0] loops_600_loop049_198_reg;
+wire [1:0] loops_600_loop150_199;
+reg [1:0] loops_600_loop150_199_reg;
+wire [63:0] loops_600_loop150_200;
+reg [63:0] loops_600_loop150_200_reg;
+wire [1:0] loops_600_loop251_201;
+reg [1:0] loops_600_loop251_201_reg;
+wire [63:0] loops_600_loop251_202;
+reg [63:0] loops_600_loop251_202_reg;
+reg [15:0] loops_600_loop251_204;
+reg [15:0] loops_600_loop251_204_reg;
+reg [15:0] loops_600_loop251_205;
+reg [15:0] loops_600_loop251_205_reg;
+reg [7:0] loops_600_loop251_206;
+reg  loops_600_loop251_206_reg;
+reg [63:0] loops_600_loop251_207;
+reg [63:0] loops_600_loop251_207_reg;
+reg [15:0] loops_600_loop251_208;
+reg [15:0] loops_600_loop251_208_reg;
+reg [7:0] loops_600_loop251_210;
+reg [7:0] loops_600_loop251_210_reg;
+reg [63:0] loops_600_loop251_211;
+reg [63:0] loops_600_loop251_211_reg;
+reg [31:0] loops_600_loop251_212;
+reg [2:0] loops_600_loop251_212_reg;
+reg  loops_600_loop251_213;
+reg  loops_600_loop251_213_reg;
+reg [31:0] loops_600_exit252_214;
+reg [2:0] loops_600_exit252_214_reg;
+reg  loops_600_exit252_215;
+reg  loops_600_exit252_215_reg;
+reg [31:0] loops_600_exit153_216;
+reg [2:0] loops_600_exit153_216_reg;
+reg  loops_600_exit153_217;
+reg  loops_600_exit153_217_reg;
+wire [1:0] loops_600_loop055_218;
+reg [1:0] loops_600_loop055_218_reg;
+wire [63:0] loops_600_loop055_219;
+reg [63:0] loops_600_loop055_219_reg;
+wire [1:0] loops_600_loop156_220;
+reg [1:0] loops_600_loop156_220_reg;
+wire [63:0] loops_600_loop156_221;
+reg [63:0] loops_600_loop156_221_reg;
+wire [1:0] loops_600_loop257_222;
+reg [1:0] loops_600_loop257_222_reg;
+wire [63:0] loops_600_loop257_223;
+reg [63:0] loops_600_loop257_223_reg;
+reg [15:0] loops_600_loop257_224;
+reg [15:0] loops_600_loop257_224_reg;
+reg [63:0] loops_600_loop257_225;
+reg [63:0] loops_600_loop257_225_reg;
+reg [31:0] loops_600_loop257_226;
+reg [31:0] loops_600_loop257_226_reg;
+reg [15:0] loops_600_loop257_229;
+reg [15:0] loops_600_loop257_229_reg;
+reg [31:0] loops_600_loop257_230;
+reg [31:0] loops_600_loop257_230_reg;
+reg [63:0] loops_600_loop257_231;
+reg [63:0] loops_600_loop257_231_reg;
+reg [63:0] loops_600_loop257_232;
+reg [63:0] loops_600_loop257_232_reg;
+reg [31:0] loops_600_loop257_233;
+reg [2:0] loops_600_loop257_233_reg;
+reg  loops_600_loop257_234;
+reg  loops_600_loop257_234_reg;
+reg [31:0] loops_600_exit258_235;
+reg [2:0] loops_600_exit258_235_reg;
+reg  loops_600_exit258_236;
+reg  loops_600_exit258_236_reg;
+reg [31:0] loops_600_exit159_237;
+reg [2:0] loops_600_exit159_237_reg;
+reg  loops_600_exit159_238;
+reg  loops_600_exit159_238_reg;
+wire [1:0] loops_600_loop061_239;
+reg [1:0] loops_600_loop061_239_reg;
+wire [63:0] loops_600_loop061_240;
+reg [63:0] loops_600_loop061_240_reg;
+wire [1:0] loops_600_loop162_241;
+reg [1:0] loops_600_loop162_241_reg;
+wire [63:0] loops_600_loop162_242;
+reg [63:0] loops_600_loop162_242_reg;
+wire [1:0] loops_600_loop263_243;
+reg [1:0] loops_600_loop263_243_reg;
+wire [63:0] loops_600_loop263_244;
+reg [63:0] loops_600_loop263_244_reg;
+reg [15:0] loops_600_loop263_248;
+reg [15:0] loops_600_loop263_248_reg;
+reg [7:0] loops_600_loop263_249;
+reg [7:0] loops_600_loop263_249_reg;
+reg [15:0] loops_600_loop263_250;
+reg [15:0] loops_600_loop263_250_reg;
+reg [7:0] loops_600_loop263_252;
+reg [7:0] loops_600_loop263_252_reg;
+reg [63:0] loops_600_loop263_253;
+reg [63:0] loops_600_loop263_253_reg;
+reg [31:0] loops_600_loop263_254;
+reg [2:0] loops_600_loop263_254_reg;
+reg  loops_600_loop263_255;
+reg  loops_600_loop263_255_reg;
+reg [31:0] loops_600_exit264_256;
+reg [2:0] loops_600_exit264_256_reg;
+reg  loops_600_exit264_257;
+reg  loops_600_exit264_257_reg;
+reg [31:0] loops_600_exit165_258;
+reg [2:0] loops_600_exit165_258_reg;
+reg  loops_600_exit165_259;
+reg  loops_600_exit165_259_reg;
+wire [1:0] loops_600_loop067_260;
+reg [1:0] loops_600_loop067_260_reg;
+wire [63:0] loops_600_loop067_261;
+reg [63:0] loops_600_loop067_261_reg;
+wire [1:0] loops_600_loop168_262;
+reg [1:0] loops_600_loop168_262_reg;
+wire [63:0] loops_600_loop168_263;
+reg [63:0] loops_600_loop168_263_reg;
+wire [1:0] loops_600_loop269_264;
+reg [1:0] loops_600_loop269_264_reg;
+wire [63:0] loops_600_loop269_265;
+reg [63:0] loops_600_loop269_265_reg;
+reg [7:0] loops_600_loop269_266;
+reg [7:0] loops_600_loop269_266_reg;
+reg [31:0] loops_600_loop269_267;
+reg [31:0] loops_600_loop269_267_reg;
+reg [15:0] loops_600_loop269_268;
+reg [15:0] loops_600_loop269_268_reg;
+reg [7:0] loops_600_loop269_269;
+reg [7:0] loops_600_loop269_269_reg;
+reg [31:0] loops_600_loop269_270;
+reg [31:0] loops_600_loop269_270_reg;
+reg [15:0] loops_600_loop269_271;
+reg [15:0] loops_600_loop269_271_reg;
+reg [31:0] loops_600_loop269_272;
+reg [31:0] loops_600_loop269_272_reg;
+reg [31:0] loops_600_loop269_273;
+reg [31:0] loops_600_loop269_273_reg;
+reg [63:0] loops_600_loop269_274;
+reg [63:0] loops_600_loop269_274_reg;
+reg [31:0] loops_600_loop269_275;
+reg [2:0] loops_600_loop269_275_reg;
+reg  loops_600_loop269_276;
+reg  loops_600_loop269_276_reg;
+reg [31:0] loops_600_exit270_277;
+reg [2:0] loops_600_exit270_277_reg;
+reg  loops_600_exit270_278;
+reg  loops_600_exit270_278_reg;
+reg [31:0] loops_600_exit171_279;
+reg [2:0] loops_600_exit171_279_reg;
+reg  loops_600_exit171_280;
+reg  loops_600_exit171_280_reg;
+wire [1:0] loops_600_loop073_281;
+reg [1:0] loops_600_loop073_281_reg;
+wire [63:0] loops_600_loop073_282;
+reg [63:0] loops_600_loop073_282_reg;
+wire [1:0] loops_600_loop174_283;
+reg [1:0] loops_600_loop174_283_reg;
+wire [63:0] loops_600_loop174_284;
+reg [63:0] loops_600_loop174_284_reg;
+wire [1:0] loops_600_loop275_285;
+reg [1:0] loops_600_loop275_285_reg;
+wire [63:0] loops_600_loop275_286;
+reg [63:0] loops_600_loop275_286_reg;
+reg [15:0] loops_600_loop275_287;
+reg [15:0] loops_600_loop275_287_reg;
+reg [7:0] loops_600_loop275_289;
+reg [7:0] loops_600_loop275_289_reg;
+reg [15:0] loops_600_loop275_290;
+reg [15:0] loops_600_loop275_290_reg;
+reg [15:0] loops_600_loop275_291;
+reg [15:0] loops_600_loop275_291_reg;
+reg [15:0] loops_600_loop275_292;
+reg [15:0] loops_600_loop275_292_reg;
+reg [7:0] loops_600_loop275_293;
+reg [7:0] loops_600_loop275_293_reg;
+reg [31:0] loops_600_loop275_294;
+reg [31:0] loops_600_loop275_294_reg;
+reg [63:0] loops_600_loop275_295;
+reg [63:0] loops_600_loop275_295_reg;
+reg [31:0] loops_600_loop275_296;
+reg [2:0] loops_600_loop275_296_reg;
+reg  loops_600_loop275_297;
+reg  loops_600_loop275_297_reg;
+reg [31:0] loops_600_exit276_298;
+reg [2:0] loops_600_exit276_298_reg;
+reg  loops_600_exit276_299;
+reg  loops_600_exit276_299_reg;
+reg [31:0] loops_600_exit177_300;
+reg [2:0] loops_600_exit177_300_reg;
+reg  loops_600_exit177_301;
+reg  loops_600_exit177_301_reg;
+wire [1:0] loops_600_loop079_302;
+reg [1:0] loops_600_loop079_302_reg;
+wire [63:0] loops_600_loop079_303;
+reg [63:0] loops_600_loop079_303_reg;
+wire [1:0] loops_600_loop180_304;
+reg [1:0] loops_600_loop180_304_reg;
+wire [63:0] loops_600_loop180_305;
+reg [63:0] loops_600_loop180_305_reg;
+wire [1:0] loops_600_loop281_306;
+reg [1:0] loops_600_loop281_306_reg;
+wire [63:0] loops_600_loop281_307;
+reg [63:0] loops_600_loop281_307_reg;
+reg [7:0] loops_600_loop281_308;
+reg [7:0] loops_600_loop281_308_reg;
+reg [7:0] loops_600_loop281_309;
+reg [7:0] loops_600_loop281_309_reg;
+reg [15:0] loops_600_loop281_311;
+reg [15:0] loops_600_loop281_311_reg;
+reg [15:0] loops_600_loop281_312;
+reg [15:0] loops_600_loop281_312_reg;
+reg [7:0] loops_600_loop281_313;
+reg [7:0] loops_600_loop281_313_reg;
+reg [7:0] loops_600_loop281_314;
+reg [7:0] loops_600_loop281_314_reg;
+reg [31:0] loops_600_loop281_315;
+reg [31:0] loops_600_loop281_315_reg;
+reg [63:0] loops_600_loop281_316;
+reg [63:0] loops_600_loop281_316_reg;
+reg [31:0] loops_600_loop281_317;
+reg [2:0] loops_600_loop281_317_reg;
+reg  loops_600_loop281_318;
+reg  loops_600_loop281_318_reg;
+reg [31:0] loops_600_exit282_319;
+reg [2:0] loops_600_exit282_319_reg;
+reg  loops_600_exit282_320;
+reg  loops_600_exit282_320_reg;
+reg [31:0] loops_600_exit183_321;
+reg [2:0] loops_600_exit183_321_reg;
+reg  loops_600_exit183_322;
+reg  loops_600_exit183_322_reg;
+wire [1:0] loops_600_loop085_323;
+reg [1:0] loops_600_loop085_323_reg;
+wire [63:0] loops_600_loop085_324;
+reg [63:0] loops_600_loop085_324_reg;
+wire [1:0] loops_600_loop186_325;
+reg [1:0] loops_600_loop186_325_reg;
+wire [63:0] loops_600_loop186_326;
+reg [63:0] loops_600_loop186_326_reg;
+wire [1:0] loops_600_loop287_327;
+reg [1:0] loops_600_loop287_327_reg;
+wire [63:0] loops_600_loop287_328;
+reg [63:0] loops_600_loop287_328_reg;
+reg [15:0] loops_600_loop287_329;
+reg [15:0] loops_600_loop287_329_reg;
+reg [31:0] loops_600_loop287_330;
+reg [31:0] loops_600_loop287_330_reg;
+reg [7:0] loops_600_loop287_331;
+reg [7:0] loops_600_loop287_331_reg;
+reg [31:0] loops_600_loop287_332;
+reg [31:0] loops_600_loop287_332_reg;
+reg [31:0] loops_600_loop287_333;
+reg [31:0] loops_600_loop287_333_reg;
+reg [31:0] loops_600_loop287_334;
+reg [31:0] loops_600_loop287_334_reg;
+reg [7:0] loops_600_loop287_335;
+reg [7:0] loops_600_loop287_335_reg;
+reg [7:0] loops_600_loop287_336;
+reg [7:0] loops_600_loop287_336_reg;
+reg [63:0] loops_600_loop287_337;
+reg [63:0] loops_600_loop287_337_reg;
+reg [31:0] loops_600_loop287_338;
+reg [2:0] loops_600_loop287_338_reg;
+reg  loops_600_loop287_339;
+reg  loops_600_loop287_339_reg;
+reg [31:0] loops_600_exit288_340;
+reg [2:0] loops_600_exit288_340_reg;
+reg  loops_600_exit288_341;
+reg  loops_600_exit288_341_reg;
+reg [31:0] loops_600_exit189_342;
+reg [2:0] loops_600_exit189_342_reg;
+reg  loops_600_exit189_343;
+reg  loops_600_exit189_343_reg;
+wire [1:0] loops_600_loop091_344;
+reg [1:0] loops_600_loop091_344_reg;
+wire [63:0] loops_600_loop091_345;
+reg [63:0] loops_600_loop091_345_reg;
+wire [1:0] loops_600_loop192_346;
+reg [1:0] loops_600_loop192_346_reg;
+wire [63:0] loops_600_loop192_347;
+reg [63:0] loops_600_loop192_347_reg;
+wire [1:0] loops_600_loop293_348;
+reg [1:0] loops_600_loop293_348_reg;
+wire [63:0] loops_600_loop293_349;
+reg [63:0] loops_600_loop293_349_reg;
+reg [15:0] loops_600_loop293_350;
+reg [15:0] loops_600_loop293_350_reg;
+reg [7:0] loops_600_loop293_351;
+reg [7:0] loops_600_loop293_351_reg;
+reg [63:0] loops_600_loop293_352;
+reg [63:0] loops_600_loop293_352_reg;
+reg [31:0] loops_600_loop293_353;
+reg [31:0] loops_600_loop293_353_reg;
+reg [7:0] loops_600_loop293_354;
+reg [7:0] loops_600_loop293_354_reg;
+reg [31:0] loops_600_loop293_355;
+reg [31:0] loops_600_loop293_355_reg;
+reg [63:0] loops_600_loop293_356;
+reg [63:0] loops_600_loop293_356_reg;
+reg [63:0] loops_600_loop293_357;
+reg [63:0] loops_600_loop293_357_reg;
+reg [63:0] loops_600_loop293_358;
+reg [63:0] loops_600_loop293_358_reg;
+reg [31:0] loops_600_loop293_359;
+reg [2:0] loops_600_loop293_359_reg;
+reg  loops_600_loop293_360;
+reg  loops_600_loop293_360_reg;
+reg [31:0] loops_600_exit294_361;
+reg [2:0] loops_600_exit294_361_reg;
+reg  loops_600_exit294_362;
+reg  loops_600_exit294_362_reg;
+reg [31:0] loops_600_exit195_363;
+reg [2:0] loops_600_exit195_363_reg;
+reg  loops_600_exit195_364;
+reg  loops_600_exit195_364_reg;
+wire [1:0] loops_600_loop097_365;
+reg [1:0] loops_600_loop097_365_reg;
+wire [63:0] loops_600_loop097_366;
+reg [63:0] loops_600_loop097_366_reg;
+wire [1:0] loops_600_loop198_367;
+reg [1:0] loops_600_loop198_367_reg;
+wire [63:0] loops_600_loop198_368;
+reg [63:0] loops_600_loop198_368_reg;
+wire [1:0] loops_600_loop299_369;
+reg [1:0] loops_600_loop299_369_reg;
+wire [63:0] loops_600_loop299_370;
+reg [63:0] loops_600_loop299_370_reg;
+reg [31:0] loops_600_loop299_372;
+reg [31:0] loops_600_loop299_372_reg;
+reg [63:0] loops_600_loop299_373;
+reg [63:0] loops_600_loop299_373_reg;
+reg [15:0] loops_600_loop299_374;
+reg [15:0] loops_600_loop299_374_reg;
+reg [7:0] loops_600_loop299_375;
+reg [7:0] loops_600_loop299_375_reg;
+reg [63:0] loops_600_loop299_376;
+reg [63:0] loops_600_loop299_376_reg;
+reg [31:0] loops_600_loop299_377;
+reg [31:0] loops_600_loop299_377_reg;
+reg [15:0] loops_600_loop299_378;
+reg [15:0] loops_600_loop299_378_reg;
+reg [63:0] loops_600_loop299_379;
+reg [63:0] loops_600_loop299_379_reg;
+reg [31:0] loops_600_loop299_380;
+reg [2:0] loops_600_loop299_380_reg;
+reg  loops_600_loop299_381;
+reg  loops_600_loop299_381_reg;
+reg [31:0] loops_600_exit2100_382;
+reg [2:0] loops_600_exit2100_382_reg;
+reg  loops_600_exit2100_383;
+reg  loops_600_exit2100_383_reg;
+reg [31:0] loops_600_exit1101_384;
+reg [2:0] loops_600_exit1101_384_reg;
+reg  loops_600_exit1101_385;
+reg  loops_600_exit1101_385_reg;
+wire [1:0] loops_600_loop0103_386;
+reg [1:0] loops_600_loop0103_386_reg;
+wire [63:0] loops_600_loop0103_387;
+reg [63:0] loops_600_loop0103_387_reg;
+wire [1:0] loops_600_loop1104_388;
+reg [1:0] loops_600_loop1104_388_reg;
+wire [63:0] loops_600_loop1104_389;
+reg [63:0] loops_600_loop1104_389_reg;
+wire [1:0] loops_600_loop2105_390;
+reg [1:0] loops_600_loop2105_390_reg;
+wire [63:0] loops_600_loop2105_391;
+reg [63:0] loops_600_loop2105_391_reg;
+reg [7:0] loops_600_loop2105_392;
+reg [7:0] loops_600_loop2105_392_reg;
+reg [15:0] loops_600_loop2105_393;
+reg [15:0] loops_600_loop2105_393_reg;
+reg [31:0] loops_600_loop2105_394;
+reg [31:0] loops_600_loop2105_394_reg;
+reg [31:0] loops_600_loop2105_395;
+reg [31:0] loops_600_loop2105_395_reg;
+reg [7:0] loops_600_loop2105_397;
+reg [7:0] loops_600_loop2105_397_reg;
+reg [31:0] loops_600_loop2105_398;
+reg [31:0] loops_600_loop2105_398_reg;
+reg [63:0] loops_600_loop2105_399;
+reg [63:0] loops_600_loop2105_399_reg;
+reg [63:0] loops_600_loop2105_400;
+reg [63:0] loops_600_loop2105_400_reg;
+reg [31:0] loops_600_loop2105_401;
+reg [2:0] loops_600_loop2105_401_reg;
+reg  loops_600_loop2105_402;
+reg  loops_600_loop2105_402_reg;
+reg [31:0] loops_600_exit2106_403;
+reg [2:0] loops_600_exit2106_403_reg;
+reg  loops_600_exit2106_404;
+reg  loops_600_exit2106_404_reg;
+reg [31:0] loops_600_exit1107_405;
+reg [2:0] loops_600_exit1107_405_reg;
+reg  loops_600_exit1107_406;
+reg  loops_600_exit1107_406_reg;
+wire [1:0] loops_600_loop0109_407;
+reg [1:0] loops_600_loop0109_407_reg;
+wire [63:0] loops_600_loop0109_408;
+reg [63:0] loops_600_loop0109_408_reg;
+wire [1:0] loops_600_loop1110_409;
+reg [1:0] loops_600_loop1110_409_reg;
+wire [63:0] loops_600_loop1110_410;
+reg [63:0] loops_600_loop1110_410_reg;
+wire [1:0] loops_600_loop2111_411;
+reg [1:0] loops_600_loop2111_411_reg;
+wire [63:0] loops_600_loop2111_412;
+reg [63:0] loops_600_loop2111_412_reg;
+reg [63:0] loops_600_loop2111_413;
+reg [63:0] loops_600_loop2111_413_reg;
+reg [31:0] loops_600_loop2111_414;
+reg [31:0] loops_600_loop2111_414_reg;
+reg [31:0] loops_600_loop2111_415;
+reg [31:0] loops_600_loop2111_415_reg;
+reg [63:0] loops_600_loop2111_416;
+reg [63:0] loops_600_loop2111_416_reg;
+reg [15:0] loops_600_loop2111_418;
+reg [15:0] loops_600_loop2111_418_reg;
+reg [7:0] loops_600_loop2111_419;
+reg [7:0] loops_600_loop2111_419_reg;
+reg [31:0] loops_600_loop2111_420;
+reg [31:0] loops_600_loop2111_420_reg;
+reg [63:0] loops_600_loop2111_421;
+reg [63:0] loops_600_loop2111_421_reg;
+reg [31:0] loops_600_loop2111_422;
+reg [2:0] loops_600_loop2111_422_reg;
+reg  loops_600_loop2111_423;
+reg  loops_600_loop2111_423_reg;
+reg [31:0] loops_600_exit2112_424;
+reg [2:0] loops_600_exit2112_424_reg;
+reg  loops_600_exit2112_425;
+reg  loops_600_exit2112_425_reg;
+reg [31:0] loops_600_exit1113_426;
+reg [2:0] loops_600_exit1113_426_reg;
+reg  loops_600_exit1113_427;
+reg  loops_600_exit1113_427_reg;
+wire [1:0] loops_600_loop0115_428;
+reg [1:0] loops_600_loop0115_428_reg;
+wire [63:0] loops_600_loop0115_429;
+reg [63:0] loops_600_loop0115_429_reg;
+wire [1:0] loops_600_loop1116_430;
+reg [1:0] loops_600_loop1116_430_reg;
+wire [63:0] loops_600_loop1116_431;
+reg [63:0] loops_600_loop1116_431_reg;
+wire [1:0] loops_600_loop2117_432;
+reg [1:0] loops_600_loop2117_432_reg;
+wire [63:0] loops_600_loop2117_433;
+reg [63:0] loops_600_loop2117_433_reg;
+reg [63:0] loops_600_loop2117_434;
+reg [63:0] loops_600_loop2117_434_reg;
+reg [63:0] loops_600_loop2117_435;
+reg [63:0] loops_600_loop2117_435_reg;
+reg [63:0] loops_600_loop2117_438;
+reg [63:0] loops_600_loop2117_438_reg;
+reg [15:0] loops_600_loop2117_439;
+reg [15:0] loops_600_loop2117_439_reg;
+reg [63:0] loops_600_loop2117_440;
+reg [63:0] loops_600_loop2117_440_reg;
+reg [15:0] loops_600_loop2117_441;
+reg [15:0] loops_600_loop2117_441_reg;
+reg [63:0] loops_600_loop2117_442;
+reg [63:0] loops_600_loop2117_442_reg;
+reg [31:0] loops_600_loop2117_443;
+reg [2:0] loops_600_loop2117_443_reg;
+reg  loops_600_loop2117_444;
+reg  loops_600_loop2117_444_reg;
+reg [31:0] loops_600_exit2118_445;
+reg [2:0] loops_600_exit2118_445_reg;
+reg  loops_600_exit2118_446;
+reg  loops_600_exit2118_446_reg;
+reg [31:0] loops_600_exit1119_447;
+reg [2:0] loops_600_exit1119_447_reg;
+reg  loops_600_exit1119_448;
+reg  loops_600_exit1119_448_reg;
+wire [1:0] loops_600_loop0121_449;
+reg [1:0] loops_600_loop0121_449_reg;
+wire [63:0] loops_600_loop0121_450;
+reg [63:0] loops_600_loop0121_450_reg;
+wire [1:0] loops_600_loop1122_451;
+reg [1:0] loops_600_loop1122_451_reg;
+wire [63:0] loops_600_loop1122_452;
+reg [63:0] loops_600_loop1122_452_reg;
+wire [1:0] loops_600_loop2123_453;
+reg [1:0] loops_600_loop2123_453_reg;
+wire [63:0] loops_600_loop2123_454;
+reg [63:0] loops_600_loop2123_454_reg;
+reg [63:0] loops_600_loop2123_455;
+reg [63:0] loops_600_loop2123_455_reg;
+reg [31:0] loops_600_loop2123_456;
+reg [31:0] loops_600_loop2123_456_reg;
+reg [7:0] loops_600_loop2123_458;
+reg [7:0] loops_600_loop2123_458_reg;
+reg [7:0] loops_600_loop2123_459;
+reg [7:0] loops_600_loop2123_459_reg;
+reg [15:0] loops_600_loop2123_460;
+reg [15:0] loops_600_loop2123_460_reg;
+reg [63:0] loops_600_loop2123_462;
+reg [63:0] loops_600_loop2123_462_reg;
+reg [63:0] loops_600_loop2123_463;
+reg [63:0] loops_600_loop2123_463_reg;
+reg [31:0] loops_600_loop2123_464;
+reg [2:0] loops_600_loop2123_464_reg;
+reg  loops_600_loop2123_465;
+reg  loops_600_loop2123_465_reg;
+reg [31:0] loops_600_exit2124_466;
+reg [2:0] loops_600_exit2124_466_reg;
+reg  loops_600_exit2124_467;
+reg  loops_600_exit2124_467_reg;
+reg [31:0] loops_600_exit1125_468;
+reg [2:0] loops_600_exit1125_468_reg;
+reg  loops_600_exit1125_469;
+reg  loops_600_exit1125_469_reg;
+wire [1:0] loops_600_loop0127_470;
+reg [1:0] loops_600_loop0127_470_reg;
+wire [63:0] loops_600_loop0127_471;
+reg [63:0] loops_600_loop0127_471_reg;
+wire [1:0] loops_600_loop1128_472;
+reg [1:0] loops_600_loop1128_472_reg;
+wire [63:0] loops_600_loop1128_473;
+reg [63:0] loops_600_loop1128_473_reg;
+wire [1:0] loops_600_loop2129_474;
+reg [1:0] loops_600_loop2129_474_reg;
+wire [63:0] loops_600_loop2129_475;
+reg [63:0] loops_600_loop2129_475_reg;
+reg [31:0] loops_600_loop2129_479;
+reg [31:0] loops_600_loop2129_479_reg;
+reg [7:0] loops_600_loop2129_480;
+reg [7:0] loops_600_loop2129_480_reg;
+reg [15:0] loops_600_loop2129_481;
+reg [15:0] loops_600_loop2129_481_reg;
+reg [31:0] loops_600_loop2129_482;
+reg [31:0] loops_600_loop2129_482_reg;
+reg [15:0] loops_600_loop2129_483;
+reg [15:0] loops_600_loop2129_483_reg;
+reg [63:0] loops_600_loop2129_484;
+reg [63:0] loops_600_loop2129_484_reg;
+reg [31:0] loops_600_loop2129_485;
+reg [2:0] loops_600_loop2129_485_reg;
+reg  loops_600_loop2129_486;
+reg  loops_600_loop2129_486_reg;
+reg [31:0] loops_600_exit2130_487;
+reg [2:0] loops_600_exit2130_487_reg;
+reg  loops_600_exit2130_488;
+reg  loops_600_exit2130_488_reg;
+reg [31:0] loops_600_exit1131_489;
+reg [2:0] loops_600_exit1131_489_reg;
+reg  loops_600_exit1131_490;
+reg  loops_600_exit1131_490_reg;
+wire [1:0] loops_600_loop0133_491;
+reg [1:0] loops_600_loop0133_491_reg;
+wire [63:0] loops_600_loop0133_492;
+reg [63:0] loops_600_loop0133_492_reg;
+wire [1:0] loops_600_loop1134_493;
+reg [1:0] loops_600_loop1134_493_reg;
+wire [63:0] loops_600_loop1134_494;
+reg [63:0] loops_600_loop1134_494_reg;
+wire [1:0] loops_600_loop2135_495;
+reg [1:0] loops_600_loop2135_495_reg;
+wire [63:0] loops_600_loop2135_496;
+reg [63:0] loops_600_loop2135_496_reg;
+reg [15:0] loops_600_loop2135_498;
+reg [15:0] loops_600_loop2135_498_reg;
+reg [15:0] loops_600_loop2135_504;
+reg [15:0] loops_600_loop2135_504_reg;
+reg [63:0] loops_600_loop2135_505;
+reg [63:0] loops_600_loop2135_505_reg;
+reg [31:0] loops_600_loop2135_506;
+reg [2:0] loops_600_loop2135_506_reg;
+reg  loops_600_loop2135_507;
+reg  loops_600_loop2135_507_reg;
+reg [31:0] loops_600_exit2136_508;
+reg [2:0] loops_600_exit2136_508_reg;
+reg  loops_600_exit2136_509;
+reg  loops_600_exit2136_509_reg;
+reg [31:0] loops_600_exit1137_510;
+reg [2:0] loops_600_exit1137_510_reg;
+reg  loops_600_exit1137_511;
+reg  loops_600_exit1137_511_reg;
+reg [15:0] loops_600_loop2_and_16_16_0_op0;
+reg [15:0] loops_600_loop2_and_16_16_0_op1;
+reg [15:0] loops_600_loop2_and_16_16_0;
+reg [2:0] loops_600_loop2_icmp_8_0_op0;
+reg [2:0] loops_600_loop2_icmp_8_0_op1;
+reg  loops_600_loop2_icmp_8_0;
+reg [7:0] loops_600_loop2_mul_8_8_0_op0;
+reg [7:0] loops_600_loop2_mul_8_8_0_op1;
+reg [7:0] loops_600_loop2_mul_8_8_0;
+reg [7:0] loops_600_loop2_add_8_8_0_op0;
+reg [7:0] loops_600_loop2_add_8_8_0_op1;
+reg [7:0] loops_600_loop2_add_8_8_0;
+reg [7:0] loops_600_loop2_and_8_8_0_op0;
+reg [7:0] loops_600_loop2_and_8_8_0_op1;
+reg [7:0] loops_600_loop2_and_8_8_0;
+reg [31:0] loops_600_loop2_or_32_32_0_op0;
+reg [31:0] loops_600_loop2_or_32_32_0_op1;
+reg [31:0] loops_600_loop2_or_32_32_0;
+reg [15:0] loops_600_loop2_add_16_16_0_op0;
+reg [15:0] loops_600_loop2_add_16_16_0_op1;
+reg [15:0] loops_600_loop2_add_16_16_0;
+reg [2:0] loops_600_exit2_icmp_8_0_op0;
+reg [2:0] loops_600_exit2_icmp_8_0_op1;
+reg  loops_600_exit2_icmp_8_0;
+reg [7:0] loops_600_exit2_add_8_8_0_op0;
+reg [7:0] loops_600_exit2_add_8_8_0_op1;
+reg [7:0] loops_600_exit2_add_8_8_0;
+reg [2:0] loops_600_exit1_icmp_8_0_op0;
+reg [2:0] loops_600_exit1_icmp_8_0_op1;
+reg  loops_600_exit1_icmp_8_0;
+reg [7:0] loops_600_exit1_add_8_8_0_op0;
+reg [7:0] loops_600_exit1_add_8_8_0_op1;
+reg [7:0] loops_600_exit1_add_8_8_0;
+reg [7:0] loops_600_loop23_or_8_8_0_op0;
+reg [7:0] loops_600_loop23_or_8_8_0_op1;
+reg [7:0] loops_600_loop23_or_8_8_0;
+reg [7:0] loops_600_loop23_add_8_8_0_op0;
+reg [7:0] loops_600_loop23_add_8_8_0_op1;
+reg [7:0] loops_600_loop23_add_8_8_0;
+reg [7:0] loops_600_loop23_add_8_8_1_op0;
+reg [7:0] loops_600_loop23_add_8_8_1_op1;
+reg [7:0] loops_600_loop23_add_8_8_1;
+reg [15:0] loops_600_loop23_add_16_16_0_op0;
+reg [15:0] loops_600_loop23_add_16_16_0_op1;
+reg [15:0] loops_600_loop23_add_16_16_0;
+reg [2:0] loops_600_loop23_icmp_8_0_op0;
+reg [2:0] loops_600_loop23_icmp_8_0_op1;
+reg  loops_600_loop23_icmp_8_0;
+reg [2:0] loops_600_exit24_icmp_8_0_op0;
+reg [2:0] loops_600_exit24_icmp_8_0_op1;
+reg  loops_600_exit24_icmp_8_0;
+reg [7:0] loops_600_exit24_add_8_8_1_op0;
+reg [7:0] loops_600_exit24_add_8_8_1_op1;
+reg [7:0] loops_600_exit24_add_8_8_1;
+reg [2:0] loops_600_exit15_icmp_8_0_op0;
+reg [2:0] loops_600_exit15_icmp_8_0_op1;
+reg  loops_600_exit15_icmp_8_0;
+reg [7:0] loops_600_exit15_add_8_8_0_op0;
+reg [7:0] loops_600_exit15_add_8_8_0_op1;
+reg [7:0] loops_600_exit15_add_8_8_0;
+reg [15:0] loops_600_loop29_and_16_16_0_op0;
+reg [15:0] loops_600_loop29_and_16_16_0_op1;
+reg [15:0] loops_600_loop29_and_16_16_0;
+reg [2:0] loops_600_loop29_icmp_8_0_op0;
+reg [2:0] loops_600_loop29_icmp_8_0_op1;
+reg  loops_600_loop29_icmp_8_0;
+reg [7:0] loops_600_loop29_add_8_8_1_op0;
+reg [7:0] loops_600_loop29_add_8_8_1_op1;
+reg [7:0] loops_600_loop29_add_8_8_1;
+reg [31:0] loops_600_loop29_and_32_32_0_op0;
+reg [31:0] loops_600_loop29_and_32_32_0_op1;
+reg [31:0] loops_600_loop29_and_32_32_0;
+reg [2:0] loops_600_exit210_icmp_8_0_op0;
+reg [2:0] loops_600_exit210_icmp_8_0_op1;
+reg  loops_600_exit210_icmp_8_0;
+reg [7:0] loops_600_exit210_add_8_8_0_op0;
+reg [7:0] loops_600_exit210_add_8_8_0_op1;
+reg [7:0] loops_600_exit210_add_8_8_0;
+reg [2:0] loops_600_exit111_icmp_8_0_op0;
+reg [2:0] loops_600_exit111_icmp_8_0_op1;
+reg  loops_600_exit111_icmp_8_0;
+reg [7:0] loops_600_exit111_add_8_8_1_op0;
+reg [7:0] loops_600_exit111_add_8_8_1_op1;
+reg [7:0] loops_600_exit111_add_8_8_1;
+reg [2:0] loops_600_loop215_icmp_8_0_op0;
+reg [2:0] loops_600_loop215_icmp_8_0_op1;
+reg  loops_600_loop215_icmp_8_0;
+reg [7:0] loops_600_loop215_mul_8_8_0_op0;
+reg [7:0] loops_600_loop215_mul_8_8_0_op1;
+reg [7:0] loops_600_loop215_mul_8_8_0;
+reg [7:0] loops_600_loop215_add_8_8_0_op0;
+reg [7:0] loops_600_loop215_add_8_8_0_op1;
+reg [7:0] loops_600_loop215_add_8_8_0;
+reg [15:0] loops_600_loop215_add_16_16_0_op0;
+reg [15:0] loops_600_loop215_add_16_16_0_op1;
+reg [15:0] loops_600_loop215_add_16_16_0;
+reg [15:0] loops_600_loop215_mul_16_16_0_op0;
+reg [15:0] loops_600_loop215_mul_16_16_0_op1;
+reg [15:0] loops_600_loop215_mul_16_16_0;
+reg [2:0] loops_600_exit216_icmp_8_0_op0;
+reg [2:0] loops_600_exit216_icmp_8_0_op1;
+reg  loops_600_exit216_icmp_8_0;
+reg [7:0] loops_600_exit216_add_8_8_1_op0;
+reg [7:0] loops_600_exit216_add_8_8_1_op1;
+reg [7:0] loops_600_exit216_add_8_8_1;
+reg [2:0] loops_600_exit117_icmp_8_0_op0;
+reg [2:0] loops_600_exit117_icmp_8_0_op1;
+reg  loops_600_exit117_icmp_8_0;
+reg [7:0] loops_600_exit117_add_8_8_0_op0;
+reg [7:0] loops_600_exit117_add_8_8_0_op1;
+reg [7:0] loops_600_exit117_add_8_8_0;
+reg [2:0] loops_600_loop221_icmp_8_0_op0;
+reg [2:0] loops_600_loop221_icmp_8_0_op1;
+reg  loops_600_loop221_icmp_8_0;
+reg [7:0] loops_600_loop221_add_8_8_1_op0;
+reg [7:0] loops_600_loop221_add_8_8_1_op1;
+reg [7:0] loops_600_loop221_add_8_8_1;
+reg [7:0] loops_600_loop221_add_8_8_0_op0;
+reg [7:0] loops_600_loop221_add_8_8_0_op1;
+reg [7:0] loops_600_loop221_add_8_8_0;
+reg [7:0] loops_600_loop221_and_8_8_0_op0;
+reg [7:0] loops_600_loop221_and_8_8_0_op1;
+reg [7:0] loops_600_loop221_and_8_8_0;
+reg [2:0] loops_600_exit222_icmp_8_0_op0;
+reg [2:0] loops_600_exit222_icmp_8_0_op1;
+reg  loops_600_exit222_icmp_8_0;
+reg [7:0] loops_600_exit222_add_8_8_0_op0;
+reg [7:0] loops_600_exit222_add_8_8_0_op1;
+reg [7:0] loops_600_exit222_add_8_8_0;
+reg [2:0] loops_600_exit123_icmp_8_0_op0;
+reg [2:0] loops_600_exit123_icmp_8_0_op1;
+reg  loops_600_exit123_icmp_8_0;
+reg [7:0] loops_600_exit123_add_8_8_1_op0;
+reg [7:0] loops_600_exit123_add_8_8_1_op1;
+reg [7:0] loops_600_exit123_add_8_8_1;
+reg [15:0] loops_600_loop227_and_16_16_0_op0;
+reg [15:0] loops_600_loop227_and_16_16_0_op1;
+reg [15:0] loops_600_loop227_and_16_16_0;
+reg [2:0] loops_600_loop227_icmp_8_0_op0;
+reg [2:0] loops_600_loop227_icmp_8_0_op1;
+reg  loops_600_loop227_icmp_8_0;
+reg [7:0] loops_600_loop227_or_8_8_0_op0;
+reg [7:0] loops_600_loop227_or_8_8_0_op1;
+reg [7:0] loops_600_loop227_or_8_8_0;
+reg [7:0] loops_600_loop227_add_8_8_0_op0;
+reg [7:0] loops_600_loop227_add_8_8_0_op1;
+reg [7:0] loops_600_loop227_add_8_8_0;
+reg [31:0] loops_600_loop227_or_32_32_0_op0;
+reg [31:0] loops_600_loop227_or_32_32_0_op1;
+reg [31:0] loops_600_loop227_or_32_32_0;
+reg [2:0] loops_600_exit228_icmp_8_0_op0;
+reg [2:0] loops_600_exit228_icmp_8_0_op1;
+reg  loops_600_exit228_icmp_8_0;
+reg [7:0] loops_600_exit228_add_8_8_1_op0;
+reg [7:0] loops_600_exit228_add_8_8_1_op1;
+reg [7:0] loops_600_exit228_add_8_8_1;
+reg [2:0] loops_600_exit129_icmp_8_0_op0;
+reg [2:0] loops_600_exit129_icmp_8_0_op1;
+reg  loops_600_exit129_icmp_8_0;
+reg [7:0] loops_600_exit129_add_8_8_0_op0;
+reg [7:0] loops_600_exit129_add_8_8_0_op1;
+reg [7:0] loops_600_exit129_add_8_8_0;
+reg [7:0] loops_600_loop233_add_8_8_0_op0;
+reg [7:0] loops_600_loop233_add_8_8_0_op1;
+reg [7:0] loops_600_loop233_add_8_8_0;
+reg [7:0] loops_600_loop233_add_8_8_1_op0;
+reg [7:0] loops_600_loop233_add_8_8_1_op1;
+reg [7:0] loops_600_loop233_add_8_8_1;
+reg [31:0] loops_600_loop233_and_32_32_0_op0;
+reg [31:0] loops_600_loop233_and_32_32_0_op1;
+reg [31:0] loops_600_loop233_and_32_32_0;
+reg [7:0] loops_600_loop233_and_8_8_0_op0;
+reg [7:0] loops_600_loop233_and_8_8_0_op1;
+reg [7:0] loops_600_loop233_and_8_8_0;
+reg [15:0] loops_600_loop233_add_16_16_0_op0;
+reg [15:0] loops_600_loop233_add_16_16_0_op1;
+reg [15:0] loops_600_loop233_add_16_16_0;
+reg [2:0] loops_600_loop233_icmp_8_0_op0;
+reg [2:0] loops_600_loop233_icmp_8_0_op1;
+reg  loops_600_loop233_icmp_8_0;
+reg [2:0] loops_600_exit234_icmp_8_0_op0;
+reg [2:0] loops_600_exit234_icmp_8_0_op1;
+reg  loops_600_exit234_icmp_8_0;
+reg [7:0] loops_600_exit234_add_8_8_1_op0;
+reg [7:0] loops_600_exit234_add_8_8_1_op1;
+reg [7:0] loops_600_exit234_add_8_8_1;
+reg [2:0] loops_600_exit135_icmp_8_0_op0;
+reg [2:0] loops_600_exit135_icmp_8_0_op1;
+reg  loops_600_exit135_icmp_8_0;
+reg [7:0] loops_600_exit135_add_8_8_0_op0;
+reg [7:0] loops_600_exit135_add_8_8_0_op1;
+reg [7:0] loops_600_exit135_add_8_8_0;
+reg [2:0] loops_600_loop239_icmp_8_0_op0;
+reg [2:0] loops_600_loop239_icmp_8_0_op1;
+reg  loops_600_loop239_icmp_8_0;
+reg [7:0] loops_600_loop239_mul_8_8_0_op0;
+reg [7:0] loops_600_loop239_mul_8_8_0_op1;
+reg [7:0] loops_600_loop239_mul_8_8_0;
+reg [31:0] loops_600_loop239_mul_32_32_0_op0;
+reg [31:0] loops_600_loop239_mul_32_32_0_op1;
+reg [31:0] loops_600_loop239_mul_32_32_0;
+reg [7:0] loops_600_loop239_add_8_8_1_op0;
+reg [7:0] loops_600_loop239_add_8_8_1_op1;
+reg [7:0] loops_600_loop239_add_8_8_1;
+reg [31:0] loops_600_loop239_and_32_32_0_op0;
+reg [31:0] loops_600_loop239_and_32_32_0_op1;
+reg [31:0] loops_600_loop239_and_32_32_0;
+reg [2:0] loops_600_exit240_icmp_8_0_op0;
+reg [2:0] loops_600_exit240_icmp_8_0_op1;
+reg  loops_600_exit240_icmp_8_0;
+reg [7:0] loops_600_exit240_add_8_8_0_op0;
+reg [7:0] loops_600_exit240_add_8_8_0_op1;
+reg [7:0] loops_600_exit240_add_8_8_0;
+reg [2:0] loops_600_exit141_icmp_8_0_op0;
+reg [2:0] loops_600_exit141_icmp_8_0_op1;
+reg  loops_600_exit141_icmp_8_0;
+reg [7:0] loops_600_exit141_add_8_8_1_op0;
+reg [7:0] loops_600_exit141_add_8_8_1_op1;
+reg [7:0] loops_600_exit141_add_8_8_1;
+reg [2:0] loops_600_loop245_icmp_8_0_op0;
+reg [2:0] loops_600_loop245_icmp_8_0_op1;
+reg  loops_600_loop245_icmp_8_0;
+reg [15:0] loops_600_loop245_or_16_16_0_op0;
+reg [15:0] loops_600_loop245_or_16_16_0_op1;
+reg [15:0] loops_600_loop245_or_16_16_0;
+reg [7:0] loops_600_loop245_add_8_8_0_op0;
+reg [7:0] loops_600_loop245_add_8_8_0_op1;
+reg [7:0] loops_600_loop245_add_8_8_0;
+reg [31:0] loops_600_loop245_and_32_32_0_op0;
+reg [31:0] loops_600_loop245_and_32_32_0_op1;
+reg [31:0] loops_600_loop245_and_32_32_0;
+reg [7:0] loops_600_loop245_and_8_8_0_op0;
+reg [7:0] loops_600_loop245_and_8_8_0_op1;
+reg [7:0] loops_600_loop245_and_8_8_0;
+reg [15:0] loops_600_loop245_add_16_16_0_op0;
+reg [15:0] loops_600_loop245_add_16_16_0_op1;
+reg [15:0] loops_600_loop245_add_16_16_0;
+reg [15:0] loops_600_loop245_add_16_16_1_op0;
+reg [15:0] loops_600_loop245_add_16_16_1_op1;
+reg [15:0] loops_600_loop245_add_16_16_1;
+reg [15:0] loops_600_loop245_mul_16_16_0_op0;
+reg [15:0] loops_600_loop245_mul_16_16_0_op1;
+reg [15:0] loops_600_loop245_mul_16_16_0;
+reg [2:0] loops_600_exit246_icmp_8_0_op0;
+reg [2:0] loops_600_exit246_icmp_8_0_op1;
+reg  loops_600_exit246_icmp_8_0;
+reg [7:0] loops_600_exit246_add_8_8_1_op0;
+reg [7:0] loops_600_exit246_add_8_8_1_op1;
+reg [7:0] loops_600_exit246_add_8_8_1;
+reg [2:0] loops_600_exit147_icmp_8_0_op0;
+reg [2:0] loops_600_exit147_icmp_8_0_op1;
+reg  loops_600_exit147_icmp_8_0;
+reg [7:0] loops_600_exit147_add_8_8_0_op0;
+reg [7:0] loops_600_exit147_add_8_8_0_op1;
+reg [7:0] loops_600_exit147_add_8_8_0;
+reg [2:0] loops_600_loop251_icmp_8_0_op0;
+reg [2:0] loops_600_loop251_icmp_8_0_op1;
+reg  loops_600_loop251_icmp_8_0;
+reg [15:0] loops_600_loop251_or_16_16_0_op0;
+reg [15:0] loops_600_loop251_or_16_16_0_op1;
+reg [15:0] loops_600_loop251_or_16_16_0;
+reg [7:0] loops_600_loop251_add_8_8_1_op0;
+reg [7:0] loops_600_loop251_add_8_8_1_op1;
+reg [7:0] loops_600_loop251_add_8_8_1;
+reg [15:0] loops_600_loop251_add_16_16_1_op0;
+reg [15:0] loops_600_loop251_add_16_16_1_op1;
+reg [15:0] loops_600_loop251_add_16_16_1;
+reg [15:0] loops_600_loop251_mul_16_16_0_op0;
+reg [15:0] loops_600_loop251_mul_16_16_0_op1;
+reg [15:0] loops_600_loop251_mul_16_16_0;
+reg [2:0] loops_600_exit252_icmp_8_0_op0;
+reg [2:0] loops_600_exit252_icmp_8_0_op1;
+reg  loops_600_exit252_icmp_8_0;
+reg [7:0] loops_600_exit252_add_8_8_0_op0;
+reg [7:0] loops_600_exit252_add_8_8_0_op1;
+reg [7:0] loops_600_exit252_add_8_8_0;
+reg [2:0] loops_600_exit153_icmp_8_0_op0;
+reg [2:0] loops_600_exit153_icmp_8_0_op1;
+reg  loops_600_exit153_icmp_8_0;
+reg [7:0] loops_600_exit153_add_8_8_1_op0;
+reg [7:0] loops_600_exit153_add_8_8_1_op1;
+reg [7:0] loops_600_exit153_add_8_8_1;
+reg [2:0] loops_600_loop257_icmp_8_0_op0;
+reg [2:0] loops_600_loop257_icmp_8_0_op1;
+reg  loops_600_loop257_icmp_8_0;
+reg [7:0] loops_600_loop257_add_8_8_0_op0;
+reg [7:0] loops_600_loop257_add_8_8_0_op1;
+reg [7:0] loops_600_loop257_add_8_8_0;
+reg [7:0] loops_600_loop257_and_8_8_0_op0;
+reg [7:0] loops_600_loop257_and_8_8_0_op1;
+reg [7:0] loops_600_loop257_and_8_8_0;
+reg [31:0] loops_600_loop257_or_32_32_0_op0;
+reg [31:0] loops_600_loop257_or_32_32_0_op1;
+reg [31:0] loops_600_loop257_or_32_32_0;
+reg [15:0] loops_600_loop257_mul_16_16_0_op0;
+reg [15:0] loops_600_loop257_mul_16_16_0_op1;
+reg [15:0] loops_600_loop257_mul_16_16_0;
+reg [2:0] loops_600_exit258_icmp_8_0_op0;
+reg [2:0] loops_600_exit258_icmp_8_0_op1;
+reg  loops_600_exit258_icmp_8_0;
+reg [7:0] loops_600_exit258_add_8_8_1_op0;
+reg [7:0] loops_600_exit258_add_8_8_1_op1;
+reg [7:0] loops_600_exit258_add_8_8_1;
+reg [2:0] loops_600_exit159_icmp_8_0_op0;
+reg [2:0] loops_600_exit159_icmp_8_0_op1;
+reg  loops_600_exit159_icmp_8_0;
+reg [7:0] loops_600_exit159_add_8_8_0_op0;
+reg [7:0] loops_600_exit159_add_8_8_0_op1;
+reg [7:0] loops_600_exit159_add_8_8_0;
+reg [2:0] loops_600_loop263_icmp_8_0_op0;
+reg [2:0] loops_600_loop263_icmp_8_0_op1;
+reg  loops_600_loop263_icmp_8_0;
+reg [7:0] loops_600_loop263_mul_8_8_0_op0;
+reg [7:0] loops_600_loop263_mul_8_8_0_op1;
+reg [7:0] loops_600_loop263_mul_8_8_0;
+reg [7:0] loops_600_loop263_add_8_8_1_op0;
+reg [7:0] loops_600_loop263_add_8_8_1_op1;
+reg [7:0] loops_600_loop263_add_8_8_1;
+reg [7:0] loops_600_loop263_add_8_8_0_op0;
+reg [7:0] loops_600_loop263_add_8_8_0_op1;
+reg [7:0] loops_600_loop263_add_8_8_0;
+reg [15:0] loops_600_loop263_add_16_16_1_op0;
+reg [15:0] loops_600_loop263_add_16_16_1_op1;
+reg [15:0] loops_600_loop263_add_16_16_1;
+reg [2:0] loops_600_exit264_icmp_8_0_op0;
+reg [2:0] loops_600_exit264_icmp_8_0_op1;
+reg  loops_600_exit264_icmp_8_0;
+reg [7:0] loops_600_exit264_add_8_8_0_op0;
+reg [7:0] loops_600_exit264_add_8_8_0_op1;
+reg [7:0] loops_600_exit264_add_8_8_0;
+reg [2:0] loops_600_exit165_icmp_8_0_op0;
+reg [2:0] loops_600_exit165_icmp_8_0_op1;
+reg  loops_600_exit165_icmp_8_0;
+reg [7:0] loops_600_exit165_add_8_8_1_op0;
+reg [7:0] loops_600_exit165_add_8_8_1_op1;
+reg [7:0] loops_600_exit165_add_8_8_1;
+reg [2:0] loops_600_loop269_icmp_8_0_op0;
+reg [2:0] loops_600_loop269_icmp_8_0_op1;
+reg  loops_600_loop269_icmp_8_0;
+reg [7:0] loops_600_loop269_or_8_8_0_op0;
+reg [7:0] loops_600_loop269_or_8_8_0_op1;
+reg [7:0] loops_600_loop269_or_8_8_0;
+reg [31:0] loops_600_loop269_add_32_32_0_op0;
+reg [31:0] loops_600_loop269_add_32_32_0_op1;
+reg [31:0] loops_600_loop269_add_32_32_0;
+reg [7:0] loops_600_loop269_add_8_8_0_op0;
+reg [7:0] loops_600_loop269_add_8_8_0_op1;
+reg [7:0] loops_600_loop269_add_8_8_0;
+reg [31:0] loops_600_loop269_or_32_32_0_op0;
+reg [31:0] loops_600_loop269_or_32_32_0_op1;
+reg [31:0] loops_600_loop269_or_32_32_0;
+reg [15:0] loops_600_loop269_add_16_16_0_op0;
+reg [15:0] loops_600_loop269_add_16_16_0_op1;
+reg [15:0] loops_600_loop269_add_16_16_0;
+reg [2:0] loops_600_exit270_icmp_8_0_op0;
+reg [2:0] loops_600_exit270_icmp_8_0_op1;
+reg  loops_600_exit270_icmp_8_0;
+reg [7:0] loops_600_exit270_add_8_8_1_op0;
+reg [7:0] loops_600_exit270_add_8_8_1_op1;
+reg [7:0] loops_600_exit270_add_8_8_1;
+reg [2:0] loops_600_exit171_icmp_8_0_op0;
+reg [2:0] loops_600_exit171_icmp_8_0_op1;
+reg  loops_600_exit171_icmp_8_0;
+reg [7:0] loops_600_exit171_add_8_8_0_op0;
+reg [7:0] loops_600_exit171_add_8_8_0_op1;
+reg [7:0] loops_600_exit171_add_8_8_0;
+reg [2:0] loops_600_loop275_icmp_8_0_op0;
+reg [2:0] loops_600_loop275_icmp_8_0_op1;
+reg  loops_600_loop275_icmp_8_0;
+reg [7:0] loops_600_loop275_mul_8_8_0_op0;
+reg [7:0] loops_600_loop275_mul_8_8_0_op1;
+reg [7:0] loops_600_loop275_mul_8_8_0;
+reg [7:0] loops_600_loop275_add_8_8_1_op0;
+reg [7:0] loops_600_loop275_add_8_8_1_op1;
+reg [7:0] loops_600_loop275_add_8_8_1;
+reg [15:0] loops_600_loop275_add_16_16_1_op0;
+reg [15:0] loops_600_loop275_add_16_16_1_op1;
+reg [15:0] loops_600_loop275_add_16_16_1;
+reg [15:0] loops_600_loop275_mul_16_16_0_op0;
+reg [15:0] loops_600_loop275_mul_16_16_0_op1;
+reg [15:0] loops_600_loop275_mul_16_16_0;
+reg [2:0] loops_600_exit276_icmp_8_0_op0;
+reg [2:0] loops_600_exit276_icmp_8_0_op1;
+reg  loops_600_exit276_icmp_8_0;
+reg [7:0] loops_600_exit276_add_8_8_0_op0;
+reg [7:0] loops_600_exit276_add_8_8_0_op1;
+reg [7:0] loops_600_exit276_add_8_8_0;
+reg [2:0] loops_600_exit177_icmp_8_0_op0;
+reg [2:0] loops_600_exit177_icmp_8_0_op1;
+reg  loops_600_exit177_icmp_8_0;
+reg [7:0] loops_600_exit177_add_8_8_1_op0;
+reg [7:0] loops_600_exit177_add_8_8_1_op1;
+reg [7:0] loops_600_exit177_add_8_8_1;
+reg [2:0] loops_600_loop281_icmp_8_0_op0;
+reg [2:0] loops_600_loop281_icmp_8_0_op1;
+reg  loops_600_loop281_icmp_8_0;
+reg [7:0] loops_600_loop281_mul_8_8_0_op0;
+reg [7:0] loops_600_loop281_mul_8_8_0_op1;
+reg [7:0] loops_600_loop281_mul_8_8_0;
+reg [31:0] loops_600_loop281_add_32_32_0_op0;
+reg [31:0] loops_600_loop281_add_32_32_0_op1;
+reg [31:0] loops_600_loop281_add_32_32_0;
+reg [7:0] loops_600_loop281_add_8_8_0_op0;
+reg [7:0] loops_600_loop281_add_8_8_0_op1;
+reg [7:0] loops_600_loop281_add_8_8_0;
+reg [7:0] loops_600_loop281_add_8_8_1_op0;
+reg [7:0] loops_600_loop281_add_8_8_1_op1;
+reg [7:0] loops_600_loop281_add_8_8_1;
+reg [2:0] loops_600_exit282_icmp_8_0_op0;
+reg [2:0] loops_600_exit282_icmp_8_0_op1;
+reg  loops_600_exit282_icmp_8_0;
+reg [7:0] loops_600_exit282_add_8_8_1_op0;
+reg [7:0] loops_600_exit282_add_8_8_1_op1;
+reg [7:0] loops_600_exit282_add_8_8_1;
+reg [2:0] loops_600_exit183_icmp_8_0_op0;
+reg [2:0] loops_600_exit183_icmp_8_0_op1;
+reg  loops_600_exit183_icmp_8_0;
+reg [7:0] loops_600_exit183_add_8_8_0_op0;
+reg [7:0] loops_600_exit183_add_8_8_0_op1;
+reg [7:0] loops_600_exit183_add_8_8_0;
+reg [2:0] loops_600_loop287_icmp_8_0_op0;
+reg [2:0] loops_600_loop287_icmp_8_0_op1;
+reg  loops_600_loop287_icmp_8_0;
+reg [7:0] loops_600_loop287_or_8_8_0_op0;
+reg [7:0] loops_600_loop287_or_8_8_0_op1;
+reg [7:0] loops_600_loop287_or_8_8_0;
+reg [31:0] loops_600_loop287_add_32_32_0_op0;
+reg [31:0] loops_600_loop287_add_32_32_0_op1;
+reg [31:0] loops_600_loop287_add_32_32_0;
+reg [31:0] loops_600_loop287_mul_32_32_0_op0;
+reg [31:0] loops_600_loop287_mul_32_32_0_op1;
+reg [31:0] loops_600_loop287_mul_32_32_0;
+reg [7:0] loops_600_loop287_add_8_8_1_op0;
+reg [7:0] loops_600_loop287_add_8_8_1_op1;
+reg [7:0] loops_600_loop287_add_8_8_1;
+reg [7:0] loops_600_loop287_add_8_8_0_op0;
+reg [7:0] loops_600_loop287_add_8_8_0_op1;
+reg [7:0] loops_600_loop287_add_8_8_0;
+reg [15:0] loops_600_loop287_add_16_16_0_op0;
+reg [15:0] loops_600_loop287_add_16_16_0_op1;
+reg [15:0] loops_600_loop287_add_16_16_0;
+reg [2:0] loops_600_exit288_icmp_8_0_op0;
+reg [2:0] loops_600_exit288_icmp_8_0_op1;
+reg  loops_600_exit288_icmp_8_0;
+reg [7:0] loops_600_exit288_add_8_8_1_op0;
+reg [7:0] loops_600_exit288_add_8_8_1_op1;
+reg [7:0] loops_600_exit288_add_8_8_1;
+reg [2:0] loops_600_exit189_icmp_8_0_op0;
+reg [2:0] loops_600_exit189_icmp_8_0_op1;
+reg  loops_600_exit189_icmp_8_0;
+reg [7:0] loops_600_exit189_add_8_8_1_op0;
+reg [7:0] loops_600_exit189_add_8_8_1_op1;
+reg [7:0] loops_600_exit189_add_8_8_1;
+reg [2:0] loops_600_loop293_icmp_8_0_op0;
+reg [2:0] loops_600_loop293_icmp_8_0_op1;
+reg  loops_600_loop293_icmp_8_0;
+reg [7:0] loops_600_loop293_mul_8_8_0_op0;
+reg [7:0] loops_600_loop293_mul_8_8_0_op1;
+reg [7:0] loops_600_loop293_mul_8_8_0;
+reg [31:0] loops_600_loop293_add_32_32_0_op0;
+reg [31:0] loops_600_loop293_add_32_32_0_op1;
+reg [31:0] loops_600_loop293_add_32_32_0;
+reg [7:0] loops_600_loop293_add_8_8_0_op0;
+reg [7:0] loops_600_loop293_add_8_8_0_op1;
+reg [7:0] loops_600_loop293_add_8_8_0;
+reg [7:0] loops_600_loop293_and_8_8_0_op0;
+reg [7:0] loops_600_loop293_and_8_8_0_op1;
+reg [7:0] loops_600_loop293_and_8_8_0;
+reg [15:0] loops_600_loop293_mul_16_16_0_op0;
+reg [15:0] loops_600_loop293_mul_16_16_0_op1;
+reg [15:0] loops_600_loop293_mul_16_16_0;
+reg [2:0] loops_600_exit294_icmp_8_0_op0;
+reg [2:0] loops_600_exit294_icmp_8_0_op1;
+reg  loops_600_exit294_icmp_8_0;
+reg [7:0] loops_600_exit294_add_8_8_1_op0;
+reg [7:0] loops_600_exit294_add_8_8_1_op1;
+reg [7:0] loops_600_exit294_add_8_8_1;
+reg [2:0] loops_600_exit195_icmp_8_0_op0;
+reg [2:0] loops_600_exit195_icmp_8_0_op1;
+reg  loops_600_exit195_icmp_8_0;
+reg [7:0] loops_600_exit195_add_8_8_0_op0;
+reg [7:0] loops_600_exit195_add_8_8_0_op1;
+reg [7:0] loops_600_exit195_add_8_8_0;
+reg [15:0] loops_600_loop299_and_16_16_0_op0;
+reg [15:0] loops_600_loop299_and_16_16_0_op1;
+reg [15:0] loops_600_loop299_and_16_16_0;
+reg [2:0] loops_600_loop299_icmp_8_0_op0;
+reg [2:0] loops_600_loop299_icmp_8_0_op1;
+reg  loops_600_loop299_icmp_8_0;
+reg [31:0] loops_600_loop299_add_32_32_0_op0;
+reg [31:0] loops_600_loop299_add_32_32_0_op1;
+reg [31:0] loops_600_loop299_add_32_32_0;
+reg [7:0] loops_600_loop299_add_8_8_1_op0;
+reg [7:0] loops_600_loop299_add_8_8_1_op1;
+reg [7:0] loops_600_loop299_add_8_8_1;
+reg [7:0] loops_600_loop299_and_8_8_0_op0;
+reg [7:0] loops_600_loop299_and_8_8_0_op1;
+reg [7:0] loops_600_loop299_and_8_8_0;
+reg [15:0] loops_600_loop299_add_16_16_1_op0;
+reg [15:0] loops_600_loop299_add_16_16_1_op1;
+reg [15:0] loops_600_loop299_add_16_16_1;
+reg [2:0] loops_600_exit2100_icmp_8_0_op0;
+reg [2:0] loops_600_exit2100_icmp_8_0_op1;
+reg  loops_600_exit2100_icmp_8_0;
+reg [7:0] loops_600_exit2100_add_8_8_0_op0;
+reg [7:0] loops_600_exit2100_add_8_8_0_op1;
+reg [7:0] loops_600_exit2100_add_8_8_0;
+reg [2:0] loops_600_exit1101_icmp_8_0_op0;
+reg [2:0] loops_600_exit1101_icmp_8_0_op1;
+reg  loops_600_exit1101_icmp_8_0;
+reg [7:0] loops_600_exit1101_add_8_8_1_op0;
+reg [7:0] loops_600_exit1101_add_8_8_1_op1;
+reg [7:0] loops_600_exit1101_add_8_8_1;
+reg [2:0] loops_600_loop2105_icmp_8_0_op0;
+reg [2:0] loops_600_loop2105_icmp_8_0_op1;
+reg  loops_600_loop2105_icmp_8_0;
+reg [7:0] loops_600_loop2105_mul_8_8_0_op0;
+reg [7:0] loops_600_loop2105_mul_8_8_0_op1;
+reg [7:0] loops_600_loop2105_mul_8_8_0;
+reg [7:0] loops_600_loop2105_or_8_8_0_op0;
+reg [7:0] loops_600_loop2105_or_8_8_0_op1;
+reg [7:0] loops_600_loop2105_or_8_8_0;
+reg [31:0] loops_600_loop2105_mul_32_32_0_op0;
+reg [31:0] loops_600_loop2105_mul_32_32_0_op1;
+reg [31:0] loops_600_loop2105_mul_32_32_0;
+reg [15:0] loops_600_loop2105_or_16_16_0_op0;
+reg [15:0] loops_600_loop2105_or_16_16_0_op1;
+reg [15:0] loops_600_loop2105_or_16_16_0;
+reg [7:0] loops_600_loop2105_add_8_8_0_op0;
+reg [7:0] loops_600_loop2105_add_8_8_0_op1;
+reg [7:0] loops_600_loop2105_add_8_8_0;
+reg [15:0] loops_600_loop2105_add_16_16_0_op0;
+reg [15:0] loops_600_loop2105_add_16_16_0_op1;
+reg [15:0] loops_600_loop2105_add_16_16_0;
+reg [2:0] loops_600_exit2106_icmp_8_0_op0;
+reg [2:0] loops_600_exit2106_icmp_8_0_op1;
+reg  loops_600_exit2106_icmp_8_0;
+reg [7:0] loops_600_exit2106_add_8_8_1_op0;
+reg [7:0] loops_600_exit2106_add_8_8_1_op1;
+reg [7:0] loops_600_exit2106_add_8_8_1;
+reg [2:0] loops_600_exit1107_icmp_8_0_op0;
+reg [2:0] loops_600_exit1107_icmp_8_0_op1;
+reg  loops_600_exit1107_icmp_8_0;
+reg [7:0] loops_600_exit1107_add_8_8_0_op0;
+reg [7:0] loops_600_exit1107_add_8_8_0_op1;
+reg [7:0] loops_600_exit1107_add_8_8_0;
+reg [2:0] loops_600_loop2111_icmp_8_0_op0;
+reg [2:0] loops_600_loop2111_icmp_8_0_op1;
+reg  loops_600_loop2111_icmp_8_0;
+reg [7:0] loops_600_loop2111_or_8_8_0_op0;
+reg [7:0] loops_600_loop2111_or_8_8_0_op1;
+reg [7:0] loops_600_loop2111_or_8_8_0;
+reg [7:0] loops_600_loop2111_add_8_8_1_op0;
+reg [7:0] loops_600_loop2111_add_8_8_1_op1;
+reg [7:0] loops_600_loop2111_add_8_8_1;
+reg [31:0] loops_600_loop2111_and_32_32_0_op0;
+reg [31:0] loops_600_loop2111_and_32_32_0_op1;
+reg [31:0] loops_600_loop2111_and_32_32_0;
+reg [2:0] loops_600_exit2112_icmp_8_0_op0;
+reg [2:0] loops_600_exit2112_icmp_8_0_op1;
+reg  loops_600_exit2112_icmp_8_0;
+reg [7:0] loops_600_exit2112_add_8_8_0_op0;
+reg [7:0] loops_600_exit2112_add_8_8_0_op1;
+reg [7:0] loops_600_exit2112_add_8_8_0;
+reg [2:0] loops_600_exit1113_icmp_8_0_op0;
+reg [2:0] loops_600_exit1113_icmp_8_0_op1;
+reg  loops_600_exit1113_icmp_8_0;
+reg [7:0] loops_600_exit1113_add_8_8_1_op0;
+reg [7:0] loops_600_exit1113_add_8_8_1_op1;
+reg [7:0] loops_600_exit1113_add_8_8_1;
+reg [2:0] loops_600_loop2117_icmp_8_0_op0;
+reg [2:0] loops_600_loop2117_icmp_8_0_op1;
+reg  loops_600_loop2117_icmp_8_0;
+reg [31:0] loops_600_loop2117_mul_32_32_0_op0;
+reg [31:0] loops_600_loop2117_mul_32_32_0_op1;
+reg [31:0] loops_600_loop2117_mul_32_32_0;
+reg [15:0] loops_600_loop2117_or_16_16_0_op0;
+reg [15:0] loops_600_loop2117_or_16_16_0_op1;
+reg [15:0] loops_600_loop2117_or_16_16_0;
+reg [7:0] loops_600_loop2117_add_8_8_0_op0;
+reg [7:0] loops_600_loop2117_add_8_8_0_op1;
+reg [7:0] loops_600_loop2117_add_8_8_0;
+reg [2:0] loops_600_exit2118_icmp_8_0_op0;
+reg [2:0] loops_600_exit2118_icmp_8_0_op1;
+reg  loops_600_exit2118_icmp_8_0;
+reg [7:0] loops_600_exit2118_add_8_8_1_op0;
+reg [7:0] loops_600_exit2118_add_8_8_1_op1;
+reg [7:0] loops_600_exit2118_add_8_8_1;
+reg [2:0] loops_600_exit1119_icmp_8_0_op0;
+reg [2:0] loops_600_exit1119_icmp_8_0_op1;
+reg  loops_600_exit1119_icmp_8_0;
+reg [7:0] loops_600_exit1119_add_8_8_0_op0;
+reg [7:0] loops_600_exit1119_add_8_8_0_op1;
+reg [7:0] loops_600_exit1119_add_8_8_0;
+reg [2:0] loops_600_loop2123_icmp_8_0_op0;
+reg [2:0] loops_600_loop2123_icmp_8_0_op1;
+reg  loops_600_loop2123_icmp_8_0;
+reg [31:0] loops_600_loop2123_add_32_32_0_op0;
+reg [31:0] loops_600_loop2123_add_32_32_0_op1;
+reg [31:0] loops_600_loop2123_add_32_32_0;
+reg [15:0] loops_600_loop2123_or_16_16_0_op0;
+reg [15:0] loops_600_loop2123_or_16_16_0_op1;
+reg [15:0] loops_600_loop2123_or_16_16_0;
+reg [7:0] loops_600_loop2123_add_8_8_1_op0;
+reg [7:0] loops_600_loop2123_add_8_8_1_op1;
+reg [7:0] loops_600_loop2123_add_8_8_1;
+reg [7:0] loops_600_loop2123_add_8_8_0_op0;
+reg [7:0] loops_600_loop2123_add_8_8_0_op1;
+reg [7:0] loops_600_loop2123_add_8_8_0;
+reg [31:0] loops_600_loop2123_and_32_32_0_op0;
+reg [31:0] loops_600_loop2123_and_32_32_0_op1;
+reg [31:0] loops_600_loop2123_and_32_32_0;
+reg [2:0] loops_600_exit2124_icmp_8_0_op0;
+reg [2:0] loops_600_exit2124_icmp_8_0_op1;
+reg  loops_600_exit2124_icmp_8_0;
+reg [7:0] loops_600_exit2124_add_8_8_0_op0;
+reg [7:0] loops_600_exit2124_add_8_8_0_op1;
+reg [7:0] loops_600_exit2124_add_8_8_0;
+reg [2:0] loops_600_exit1125_icmp_8_0_op0;
+reg [2:0] loops_600_exit1125_icmp_8_0_op1;
+reg  loops_600_exit1125_icmp_8_0;
+reg [7:0] loops_600_exit1125_add_8_8_1_op0;
+reg [7:0] loops_600_exit1125_add_8_8_1_op1;
+reg [7:0] loops_600_exit1125_add_8_8_1;
+reg [2:0] loops_600_loop2129_icmp_8_0_op0;
+reg [2:0] loops_600_loop2129_icmp_8_0_op1;
+reg  loops_600_loop2129_icmp_8_0;
+reg [7:0] loops_600_loop2129_or_8_8_0_op0;
+reg [7:0] loops_600_loop2129_or_8_8_0_op1;
+reg [7:0] loops_600_loop2129_or_8_8_0;
+reg [7:0] loops_600_loop2129_add_8_8_0_op0;
+reg [7:0] loops_600_loop2129_add_8_8_0_op1;
+reg [7:0] loops_600_loop2129_add_8_8_0;
+reg [7:0] loops_600_loop2129_and_8_8_0_op0;
+reg [7:0] loops_600_loop2129_and_8_8_0_op1;
+reg [7:0] loops_600_loop2129_and_8_8_0;
+reg [31:0] loops_600_loop2129_or_32_32_0_op0;
+reg [31:0] loops_600_loop2129_or_32_32_0_op1;
+reg [31:0] loops_600_loop2129_or_32_32_0;
+reg [2:0] loops_600_exit2130_icmp_8_0_op0;
+reg [2:0] loops_600_exit2130_icmp_8_0_op1;
+reg  loops_600_exit2130_icmp_8_0;
+reg [7:0] loops_600_exit2130_add_8_8_1_op0;
+reg [7:0] loops_600_exit2130_add_8_8_1_op1;
+reg [7:0] loops_600_exit2130_add_8_8_1;
+reg [2:0] loops_600_exit1131_icmp_8_0_op0;
+reg [2:0] loops_600_exit1131_icmp_8_0_op1;
+reg  loops_600_exit1131_icmp_8_0;
+reg [7:0] loops_600_exit1131_add_8_8_0_op0;
+reg [7:0] loops_600_exit1131_add_8_8_0_op1;
+reg [7:0] loops_600_exit1131_add_8_8_0;
+reg [2:0] loops_600_loop2135_icmp_8_0_op0;
+reg [2:0] loops_600_loop2135_icmp_8_0_op1;
+reg  loops_600_loop2135_icmp_8_0;
+reg [7:0] loops_600_loop2135_mul_8_8_0_op0;
+reg [7:0] loops_600_loop2135_mul_8_8_0_op1;
+reg [7:0] loops_600_loop2135_mul_8_8_0;
+reg [7:0] loops_600_loop2135_or_8_8_0_op0;
+reg [7:0] loops_600_loop2135_or_8_8_0_op1;
+reg [7:0] loops_600_loop2135_or_8_8_0;
+reg [7:0] loops_600_loop2135_add_8_8_1_op0;
+reg [7:0] loops_600_loop2135_add_8_8_1_op1;
+reg [7:0] loops_600_loop2135_add_8_8_1;
+reg [15:0] loops_600_loop2135_add_16_16_1_op0;
+reg [15:0] loops_600_loop2135_add_16_16_1_op1;
+reg [15:0] loops_600_loop2135_add_16_16_1;
+reg [15:0] loops_600_loop2135_add_16_16_0_op0;
+reg [15:0] loops_600_loop2135_add_16_16_0_op1;
+reg [15:0] loops_600_loop2135_add_16_16_0;
+reg [2:0] loops_600_exit2136_icmp_8_0_op0;
+reg [2:0] loops_600_exit2136_icmp_8_0_op1;
+reg  loops_600_exit2136_icmp_8_0;
+reg [7:0] loops_600_exit2136_add_8_8_0_op0;
+reg [7:0] loops_600_exit2136_add_8_8_0_op1;
+reg [7:0] loops_600_exit2136_add_8_8_0;
+reg [2:0] loops_600_exit1137_icmp_8_0_op0;
+reg [2:0] loops_600_exit1137_icmp_8_0_op1;
+reg  loops_600_exit1137_icmp_8_0;
+reg [7:0] loops_600_exit1137_add_8_8_1_op0;
+reg [7:0] loops_600_exit1137_add_8_8_1_op1;
+reg [7:0] loops_600_exit1137_add_8_8_1;
+reg [63:0] loops_600_loop2_16;
+reg [7:0] loops_600_loop23_37;
+reg [63:0] loops_600_loop29_56;
+reg [63:0] loops_600_loop29_62;
+reg [63:0] loops_600_loop215_78;
+reg [15:0] loops_600_loop227_123;
+reg [63:0] loops_600_loop233_144;
+reg [63:0] loops_600_loop239_167;
+reg [31:0] loops_600_loop239_163;
+reg [63:0] loops_600_loop251_203;
+reg [63:0] loops_600_loop251_209;
+reg [15:0] loops_600_loop257_227;
+reg [7:0] loops_600_loop257_228;
+reg [63:0] loops_600_loop263_245;
+reg [15:0] loops_600_loop263_246;
+reg [7:0] loops_600_loop263_247;
+reg [63:0] loops_600_loop263_251;
+reg [63:0] loops_600_loop275_288;
+reg [31:0] loops_600_loop281_310;
+reg [31:0] loops_600_loop299_371;
+reg [15:0] loops_600_loop2105_396;
+reg [7:0] loops_600_loop2111_417;
+reg [31:0] loops_600_loop2117_436;
+reg [63:0] loops_600_loop2117_437;
+reg [63:0] loops_600_loop2123_457;
+reg [31:0] loops_600_loop2123_461;
+reg [63:0] loops_600_loop2129_476;
+reg [63:0] loops_600_loop2129_477;
+reg [7:0] loops_600_loop2129_478;
+reg [7:0] loops_600_loop2135_497;
+reg [15:0] loops_600_loop2135_499;
+reg [31:0] loops_600_loop2135_500;
+reg [7:0] loops_600_loop2135_501;
+reg [63:0] loops_600_loop2135_502;
+reg [31:0] loops_600_loop2135_503;
+
+/* FSM BEGIN ---------------------------------------------------------------*/
+
+always @ (posedge clk) begin
+	if (reset == 1'b1) begin
+		cur_state <= BPHLS;
+	end else begin 
+		cur_state <= next_state;
+	end
+end
+
+always @ (*) begin
+	next_state = cur_state;
+
+	case (cur_state)
+	BPHLS:
+		if ((start == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_0_S_0;
+		end
+	BPHLS_F_loops_600_BB_0_S_0:
+		next_state = BPHLS_F_loops_600_BB_1_S_0;
+	BPHLS_F_loops_600_BB_100_S_0:
+		next_state = BPHLS_F_loops_600_BB_101_S_0;
+	BPHLS_F_loops_600_BB_101_S_0:
+		next_state = BPHLS_F_loops_600_BB_102_S_0;
+	BPHLS_F_loops_600_BB_102_S_0:
+		next_state = BPHLS_F_loops_600_BB_102_S_1;
+	BPHLS_F_loops_600_BB_102_S_1:
+		if ((loops_600_loop2117_444_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_102_S_0;
+		end
+		else if ((loops_600_loop2117_444_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_103_S_0;
+		end
+	BPHLS_F_loops_600_BB_103_S_0:
+		next_state = BPHLS_F_loops_600_BB_103_S_1;
+	BPHLS_F_loops_600_BB_103_S_1:
+		if ((loops_600_exit2118_446_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_101_S_0;
+		end
+		else if ((loops_600_exit2118_446_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_104_S_0;
+		end
+	BPHLS_F_loops_600_BB_104_S_0:
+		next_state = BPHLS_F_loops_600_BB_104_S_1;
+	BPHLS_F_loops_600_BB_104_S_1:
+		if ((loops_600_exit1119_448_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_100_S_0;
+		end
+		else if ((loops_600_exit1119_448_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_105_S_0;
+		end
+	BPHLS_F_loops_600_BB_105_S_0:
+		next_state = BPHLS_F_loops_600_BB_106_S_0;
+	BPHLS_F_loops_600_BB_106_S_0:
+		next_state = BPHLS_F_loops_600_BB_107_S_0;
+	BPHLS_F_loops_600_BB_107_S_0:
+		next_state = BPHLS_F_loops_600_BB_107_S_1;
+	BPHLS_F_loops_600_BB_107_S_1:
+		if ((loops_600_loop2123_465_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_107_S_0;
+		end
+		else if ((loops_600_loop2123_465_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_108_S_0;
+		end
+	BPHLS_F_loops_600_BB_108_S_0:
+		next_state = BPHLS_F_loops_600_BB_108_S_1;
+	BPHLS_F_loops_600_BB_108_S_1:
+		if ((loops_600_exit2124_467_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_106_S_0;
+		end
+		else if ((loops_600_exit2124_467_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_109_S_0;
+		end
+	BPHLS_F_loops_600_BB_109_S_0:
+		next_state = BPHLS_F_loops_600_BB_109_S_1;
+	BPHLS_F_loops_600_BB_109_S_1:
+		if ((loops_600_exit1125_469_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_105_S_0;
+		end
+		else if ((loops_600_exit1125_469_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_110_S_0;
+		end
+	BPHLS_F_loops_600_BB_10_S_0:
+		next_state = BPHLS_F_loops_600_BB_11_S_0;
+	BPHLS_F_loops_600_BB_110_S_0:
+		next_state = BPHLS_F_loops_600_BB_111_S_0;
+	BPHLS_F_loops_600_BB_111_S_0:
+		next_state = BPHLS_F_loops_600_BB_112_S_0;
+	BPHLS_F_loops_600_BB_112_S_0:
+		next_state = BPHLS_F_loops_600_BB_112_S_1;
+	BPHLS_F_loops_600_BB_112_S_1:
+		if ((loops_600_loop2129_486_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_112_S_0;
+		end
+		else if ((loops_600_loop2129_486_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_113_S_0;
+		end
+	BPHLS_F_loops_600_BB_113_S_0:
+		next_state = BPHLS_F_loops_600_BB_113_S_1;
+	BPHLS_F_loops_600_BB_113_S_1:
+		if ((loops_600_exit2130_488_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_111_S_0;
+		end
+		else if ((loops_600_exit2130_488_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_114_S_0;
+		end
+	BPHLS_F_loops_600_BB_114_S_0:
+		next_state = BPHLS_F_loops_600_BB_114_S_1;
+	BPHLS_F_loops_600_BB_114_S_1:
+		if ((loops_600_exit1131_490_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_110_S_0;
+		end
+		else if ((loops_600_exit1131_490_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_115_S_0;
+		end
+	BPHLS_F_loops_600_BB_115_S_0:
+		next_state = BPHLS_F_loops_600_BB_116_S_0;
+	BPHLS_F_loops_600_BB_116_S_0:
+		next_state = BPHLS_F_loops_600_BB_117_S_0;
+	BPHLS_F_loops_600_BB_117_S_0:
+		next_state = BPHLS_F_loops_600_BB_117_S_1;
+	BPHLS_F_loops_600_BB_117_S_1:
+		if ((loops_600_loop2135_507_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_117_S_0;
+		end
+		else if ((loops_600_loop2135_507_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_118_S_0;
+		end
+	BPHLS_F_loops_600_BB_118_S_0:
+		next_state = BPHLS_F_loops_600_BB_118_S_1;
+	BPHLS_F_loops_600_BB_118_S_1:
+		if ((loops_600_exit2136_509_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_116_S_0;
+		end
+		else if ((loops_600_exit2136_509_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_119_S_0;
+		end
+	BPHLS_F_loops_600_BB_119_S_0:
+		next_state = BPHLS_F_loops_600_BB_119_S_1;
+	BPHLS_F_loops_600_BB_119_S_1:
+		if ((loops_600_exit1137_511_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_115_S_0;
+		end
+		else if ((loops_600_exit1137_511_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_120_S_0;
+		end
+	BPHLS_F_loops_600_BB_11_S_0:
+		next_state = BPHLS_F_loops_600_BB_12_S_0;
+	BPHLS_F_loops_600_BB_120_S_0:
+		next_state = BPHLS;
+	BPHLS_F_loops_600_BB_12_S_0:
+		next_state = BPHLS_F_loops_600_BB_12_S_1;
+	BPHLS_F_loops_600_BB_12_S_1:
+		if ((loops_600_loop29_66_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_12_S_0;
+		end
+		else if ((loops_600_loop29_66_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_13_S_0;
+		end
+	BPHLS_F_loops_600_BB_13_S_0:
+		next_state = BPHLS_F_loops_600_BB_13_S_1;
+	BPHLS_F_loops_600_BB_13_S_1:
+		if ((loops_600_exit210_68_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_11_S_0;
+		end
+		else if ((loops_600_exit210_68_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_14_S_0;
+		end
+	BPHLS_F_loops_600_BB_14_S_0:
+		next_state = BPHLS_F_loops_600_BB_14_S_1;
+	BPHLS_F_loops_600_BB_14_S_1:
+		if ((loops_600_exit111_70_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_10_S_0;
+		end
+		else if ((loops_600_exit111_70_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_15_S_0;
+		end
+	BPHLS_F_loops_600_BB_15_S_0:
+		next_state = BPHLS_F_loops_600_BB_16_S_0;
+	BPHLS_F_loops_600_BB_16_S_0:
+		next_state = BPHLS_F_loops_600_BB_17_S_0;
+	BPHLS_F_loops_600_BB_17_S_0:
+		next_state = BPHLS_F_loops_600_BB_17_S_1;
+	BPHLS_F_loops_600_BB_17_S_1:
+		if ((loops_600_loop215_87_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_17_S_0;
+		end
+		else if ((loops_600_loop215_87_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_18_S_0;
+		end
+	BPHLS_F_loops_600_BB_18_S_0:
+		next_state = BPHLS_F_loops_600_BB_18_S_1;
+	BPHLS_F_loops_600_BB_18_S_1:
+		if ((loops_600_exit216_89_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_16_S_0;
+		end
+		else if ((loops_600_exit216_89_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_19_S_0;
+		end
+	BPHLS_F_loops_600_BB_19_S_0:
+		next_state = BPHLS_F_loops_600_BB_19_S_1;
+	BPHLS_F_loops_600_BB_19_S_1:
+		if ((loops_600_exit117_91_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_15_S_0;
+		end
+		else if ((loops_600_exit117_91_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_20_S_0;
+		end
+	BPHLS_F_loops_600_BB_1_S_0:
+		next_state = BPHLS_F_loops_600_BB_2_S_0;
+	BPHLS_F_loops_600_BB_20_S_0:
+		next_state = BPHLS_F_loops_600_BB_21_S_0;
+	BPHLS_F_loops_600_BB_21_S_0:
+		next_state = BPHLS_F_loops_600_BB_22_S_0;
+	BPHLS_F_loops_600_BB_22_S_0:
+		next_state = BPHLS_F_loops_600_BB_22_S_1;
+	BPHLS_F_loops_600_BB_22_S_1:
+		if ((loops_600_loop221_108_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_22_S_0;
+		end
+		else if ((loops_600_loop221_108_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_23_S_0;
+		end
+	BPHLS_F_loops_600_BB_23_S_0:
+		next_state = BPHLS_F_loops_600_BB_23_S_1;
+	BPHLS_F_loops_600_BB_23_S_1:
+		if ((loops_600_exit222_110_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_21_S_0;
+		end
+		else if ((loops_600_exit222_110_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_24_S_0;
+		end
+	BPHLS_F_loops_600_BB_24_S_0:
+		next_state = BPHLS_F_loops_600_BB_24_S_1;
+	BPHLS_F_loops_600_BB_24_S_1:
+		if ((loops_600_exit123_112_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_20_S_0;
+		end
+		else if ((loops_600_exit123_112_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_25_S_0;
+		end
+	BPHLS_F_loops_600_BB_25_S_0:
+		next_state = BPHLS_F_loops_600_BB_26_S_0;
+	BPHLS_F_loops_600_BB_26_S_0:
+		next_state = BPHLS_F_loops_600_BB_27_S_0;
+	BPHLS_F_loops_600_BB_27_S_0:
+		next_state = BPHLS_F_loops_600_BB_27_S_1;
+	BPHLS_F_loops_600_BB_27_S_1:
+		if ((loops_600_loop227_129_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_27_S_0;
+		end
+		else if ((loops_600_loop227_129_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_28_S_0;
+		end
+	BPHLS_F_loops_600_BB_28_S_0:
+		next_state = BPHLS_F_loops_600_BB_28_S_1;
+	BPHLS_F_loops_600_BB_28_S_1:
+		if ((loops_600_exit228_131_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_26_S_0;
+		end
+		else if ((loops_600_exit228_131_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_29_S_0;
+		end
+	BPHLS_F_loops_600_BB_29_S_0:
+		next_state = BPHLS_F_loops_600_BB_29_S_1;
+	BPHLS_F_loops_600_BB_29_S_1:
+		if ((loops_600_exit129_133_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_25_S_0;
+		end
+		else if ((loops_600_exit129_133_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_30_S_0;
+		end
+	BPHLS_F_loops_600_BB_2_S_0:
+		next_state = BPHLS_F_loops_600_BB_2_S_1;
+	BPHLS_F_loops_600_BB_2_S_1:
+		if ((loops_600_loop2_24_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_2_S_0;
+		end
+		else if ((loops_600_loop2_24_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_3_S_0;
+		end
+	BPHLS_F_loops_600_BB_30_S_0:
+		next_state = BPHLS_F_loops_600_BB_31_S_0;
+	BPHLS_F_loops_600_BB_31_S_0:
+		next_state = BPHLS_F_loops_600_BB_32_S_0;
+	BPHLS_F_loops_600_BB_32_S_0:
+		next_state = BPHLS_F_loops_600_BB_32_S_1;
+	BPHLS_F_loops_600_BB_32_S_1:
+		next_state = BPHLS_F_loops_600_BB_32_S_2;
+	BPHLS_F_loops_600_BB_32_S_2:
+		if ((loops_600_loop233_150_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_32_S_0;
+		end
+		else if ((loops_600_loop233_150_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_33_S_0;
+		end
+	BPHLS_F_loops_600_BB_33_S_0:
+		next_state = BPHLS_F_loops_600_BB_33_S_1;
+	BPHLS_F_loops_600_BB_33_S_1:
+		if ((loops_600_exit234_152_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_31_S_0;
+		end
+		else if ((loops_600_exit234_152_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_34_S_0;
+		end
+	BPHLS_F_loops_600_BB_34_S_0:
+		next_state = BPHLS_F_loops_600_BB_34_S_1;
+	BPHLS_F_loops_600_BB_34_S_1:
+		if ((loops_600_exit135_154_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_30_S_0;
+		end
+		else if ((loops_600_exit135_154_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_35_S_0;
+		end
+	BPHLS_F_loops_600_BB_35_S_0:
+		next_state = BPHLS_F_loops_600_BB_36_S_0;
+	BPHLS_F_loops_600_BB_36_S_0:
+		next_state = BPHLS_F_loops_600_BB_37_S_0;
+	BPHLS_F_loops_600_BB_37_S_0:
+		next_state = BPHLS_F_loops_600_BB_37_S_1;
+	BPHLS_F_loops_600_BB_37_S_1:
+		next_state = BPHLS_F_loops_600_BB_37_S_2;
+	BPHLS_F_loops_600_BB_37_S_2:
+		if ((loops_600_loop239_171_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_37_S_0;
+		end
+		else if ((loops_600_loop239_171_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_38_S_0;
+		end
+	BPHLS_F_loops_600_BB_38_S_0:
+		next_state = BPHLS_F_loops_600_BB_38_S_1;
+	BPHLS_F_loops_600_BB_38_S_1:
+		if ((loops_600_exit240_173_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_36_S_0;
+		end
+		else if ((loops_600_exit240_173_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_39_S_0;
+		end
+	BPHLS_F_loops_600_BB_39_S_0:
+		next_state = BPHLS_F_loops_600_BB_39_S_1;
+	BPHLS_F_loops_600_BB_39_S_1:
+		if ((loops_600_exit141_175_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_35_S_0;
+		end
+		else if ((loops_600_exit141_175_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_40_S_0;
+		end
+	BPHLS_F_loops_600_BB_3_S_0:
+		next_state = BPHLS_F_loops_600_BB_3_S_1;
+	BPHLS_F_loops_600_BB_3_S_1:
+		if ((loops_600_exit2_26_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_1_S_0;
+		end
+		else if ((loops_600_exit2_26_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_4_S_0;
+		end
+	BPHLS_F_loops_600_BB_40_S_0:
+		next_state = BPHLS_F_loops_600_BB_41_S_0;
+	BPHLS_F_loops_600_BB_41_S_0:
+		next_state = BPHLS_F_loops_600_BB_42_S_0;
+	BPHLS_F_loops_600_BB_42_S_0:
+		next_state = BPHLS_F_loops_600_BB_42_S_1;
+	BPHLS_F_loops_600_BB_42_S_1:
+		if ((loops_600_loop245_192_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_42_S_0;
+		end
+		else if ((loops_600_loop245_192_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_43_S_0;
+		end
+	BPHLS_F_loops_600_BB_43_S_0:
+		next_state = BPHLS_F_loops_600_BB_43_S_1;
+	BPHLS_F_loops_600_BB_43_S_1:
+		if ((loops_600_exit246_194_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_41_S_0;
+		end
+		else if ((loops_600_exit246_194_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_44_S_0;
+		end
+	BPHLS_F_loops_600_BB_44_S_0:
+		next_state = BPHLS_F_loops_600_BB_44_S_1;
+	BPHLS_F_loops_600_BB_44_S_1:
+		if ((loops_600_exit147_196_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_40_S_0;
+		end
+		else if ((loops_600_exit147_196_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_45_S_0;
+		end
+	BPHLS_F_loops_600_BB_45_S_0:
+		next_state = BPHLS_F_loops_600_BB_46_S_0;
+	BPHLS_F_loops_600_BB_46_S_0:
+		next_state = BPHLS_F_loops_600_BB_47_S_0;
+	BPHLS_F_loops_600_BB_47_S_0:
+		next_state = BPHLS_F_loops_600_BB_47_S_1;
+	BPHLS_F_loops_600_BB_47_S_1:
+		if ((loops_600_loop251_213_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_47_S_0;
+		end
+		else if ((loops_600_loop251_213_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_48_S_0;
+		end
+	BPHLS_F_loops_600_BB_48_S_0:
+		next_state = BPHLS_F_loops_600_BB_48_S_1;
+	BPHLS_F_loops_600_BB_48_S_1:
+		if ((loops_600_exit252_215_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_46_S_0;
+		end
+		else if ((loops_600_exit252_215_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_49_S_0;
+		end
+	BPHLS_F_loops_600_BB_49_S_0:
+		next_state = BPHLS_F_loops_600_BB_49_S_1;
+	BPHLS_F_loops_600_BB_49_S_1:
+		if ((loops_600_exit153_217_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_45_S_0;
+		end
+		else if ((loops_600_exit153_217_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_50_S_0;
+		end
+	BPHLS_F_loops_600_BB_4_S_0:
+		next_state = BPHLS_F_loops_600_BB_4_S_1;
+	BPHLS_F_loops_600_BB_4_S_1:
+		if ((loops_600_exit1_28_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_0_S_0;
+		end
+		else if ((loops_600_exit1_28_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_5_S_0;
+		end
+	BPHLS_F_loops_600_BB_50_S_0:
+		next_state = BPHLS_F_loops_600_BB_51_S_0;
+	BPHLS_F_loops_600_BB_51_S_0:
+		next_state = BPHLS_F_loops_600_BB_52_S_0;
+	BPHLS_F_loops_600_BB_52_S_0:
+		next_state = BPHLS_F_loops_600_BB_52_S_1;
+	BPHLS_F_loops_600_BB_52_S_1:
+		if ((loops_600_loop257_234_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_52_S_0;
+		end
+		else if ((loops_600_loop257_234_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_53_S_0;
+		end
+	BPHLS_F_loops_600_BB_53_S_0:
+		next_state = BPHLS_F_loops_600_BB_53_S_1;
+	BPHLS_F_loops_600_BB_53_S_1:
+		if ((loops_600_exit258_236_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_51_S_0;
+		end
+		else if ((loops_600_exit258_236_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_54_S_0;
+		end
+	BPHLS_F_loops_600_BB_54_S_0:
+		next_state = BPHLS_F_loops_600_BB_54_S_1;
+	BPHLS_F_loops_600_BB_54_S_1:
+		if ((loops_600_exit159_238_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_50_S_0;
+		end
+		else if ((loops_600_exit159_238_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_55_S_0;
+		end
+	BPHLS_F_loops_600_BB_55_S_0:
+		next_state = BPHLS_F_loops_600_BB_56_S_0;
+	BPHLS_F_loops_600_BB_56_S_0:
+		next_state = BPHLS_F_loops_600_BB_57_S_0;
+	BPHLS_F_loops_600_BB_57_S_0:
+		next_state = BPHLS_F_loops_600_BB_57_S_1;
+	BPHLS_F_loops_600_BB_57_S_1:
+		if ((loops_600_loop263_255_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_57_S_0;
+		end
+		else if ((loops_600_loop263_255_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_58_S_0;
+		end
+	BPHLS_F_loops_600_BB_58_S_0:
+		next_state = BPHLS_F_loops_600_BB_58_S_1;
+	BPHLS_F_loops_600_BB_58_S_1:
+		if ((loops_600_exit264_257_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_56_S_0;
+		end
+		else if ((loops_600_exit264_257_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_59_S_0;
+		end
+	BPHLS_F_loops_600_BB_59_S_0:
+		next_state = BPHLS_F_loops_600_BB_59_S_1;
+	BPHLS_F_loops_600_BB_59_S_1:
+		if ((loops_600_exit165_259_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_55_S_0;
+		end
+		else if ((loops_600_exit165_259_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_60_S_0;
+		end
+	BPHLS_F_loops_600_BB_5_S_0:
+		next_state = BPHLS_F_loops_600_BB_6_S_0;
+	BPHLS_F_loops_600_BB_60_S_0:
+		next_state = BPHLS_F_loops_600_BB_61_S_0;
+	BPHLS_F_loops_600_BB_61_S_0:
+		next_state = BPHLS_F_loops_600_BB_62_S_0;
+	BPHLS_F_loops_600_BB_62_S_0:
+		next_state = BPHLS_F_loops_600_BB_62_S_1;
+	BPHLS_F_loops_600_BB_62_S_1:
+		if ((loops_600_loop269_276_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_62_S_0;
+		end
+		else if ((loops_600_loop269_276_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_63_S_0;
+		end
+	BPHLS_F_loops_600_BB_63_S_0:
+		next_state = BPHLS_F_loops_600_BB_63_S_1;
+	BPHLS_F_loops_600_BB_63_S_1:
+		if ((loops_600_exit270_278_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_61_S_0;
+		end
+		else if ((loops_600_exit270_278_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_64_S_0;
+		end
+	BPHLS_F_loops_600_BB_64_S_0:
+		next_state = BPHLS_F_loops_600_BB_64_S_1;
+	BPHLS_F_loops_600_BB_64_S_1:
+		if ((loops_600_exit171_280_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_60_S_0;
+		end
+		else if ((loops_600_exit171_280_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_65_S_0;
+		end
+	BPHLS_F_loops_600_BB_65_S_0:
+		next_state = BPHLS_F_loops_600_BB_66_S_0;
+	BPHLS_F_loops_600_BB_66_S_0:
+		next_state = BPHLS_F_loops_600_BB_67_S_0;
+	BPHLS_F_loops_600_BB_67_S_0:
+		next_state = BPHLS_F_loops_600_BB_67_S_1;
+	BPHLS_F_loops_600_BB_67_S_1:
+		if ((loops_600_loop275_297_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_67_S_0;
+		end
+		else if ((loops_600_loop275_297_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_68_S_0;
+		end
+	BPHLS_F_loops_600_BB_68_S_0:
+		next_state = BPHLS_F_loops_600_BB_68_S_1;
+	BPHLS_F_loops_600_BB_68_S_1:
+		if ((loops_600_exit276_299_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_66_S_0;
+		end
+		else if ((loops_600_exit276_299_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_69_S_0;
+		end
+	BPHLS_F_loops_600_BB_69_S_0:
+		next_state = BPHLS_F_loops_600_BB_69_S_1;
+	BPHLS_F_loops_600_BB_69_S_1:
+		if ((loops_600_exit177_301_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_65_S_0;
+		end
+		else if ((loops_600_exit177_301_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_70_S_0;
+		end
+	BPHLS_F_loops_600_BB_6_S_0:
+		next_state = BPHLS_F_loops_600_BB_7_S_0;
+	BPHLS_F_loops_600_BB_70_S_0:
+		next_state = BPHLS_F_loops_600_BB_71_S_0;
+	BPHLS_F_loops_600_BB_71_S_0:
+		next_state = BPHLS_F_loops_600_BB_72_S_0;
+	BPHLS_F_loops_600_BB_72_S_0:
+		next_state = BPHLS_F_loops_600_BB_72_S_1;
+	BPHLS_F_loops_600_BB_72_S_1:
+		if ((loops_600_loop281_318_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_72_S_0;
+		end
+		else if ((loops_600_loop281_318_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_73_S_0;
+		end
+	BPHLS_F_loops_600_BB_73_S_0:
+		next_state = BPHLS_F_loops_600_BB_73_S_1;
+	BPHLS_F_loops_600_BB_73_S_1:
+		if ((loops_600_exit282_320_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_71_S_0;
+		end
+		else if ((loops_600_exit282_320_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_74_S_0;
+		end
+	BPHLS_F_loops_600_BB_74_S_0:
+		next_state = BPHLS_F_loops_600_BB_74_S_1;
+	BPHLS_F_loops_600_BB_74_S_1:
+		if ((loops_600_exit183_322_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_70_S_0;
+		end
+		else if ((loops_600_exit183_322_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_75_S_0;
+		end
+	BPHLS_F_loops_600_BB_75_S_0:
+		next_state = BPHLS_F_loops_600_BB_76_S_0;
+	BPHLS_F_loops_600_BB_76_S_0:
+		next_state = BPHLS_F_loops_600_BB_77_S_0;
+	BPHLS_F_loops_600_BB_77_S_0:
+		next_state = BPHLS_F_loops_600_BB_77_S_1;
+	BPHLS_F_loops_600_BB_77_S_1:
+		if ((loops_600_loop287_339_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_77_S_0;
+		end
+		else if ((loops_600_loop287_339_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_78_S_0;
+		end
+	BPHLS_F_loops_600_BB_78_S_0:
+		next_state = BPHLS_F_loops_600_BB_78_S_1;
+	BPHLS_F_loops_600_BB_78_S_1:
+		if ((loops_600_exit288_341_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_76_S_0;
+		end
+		else if ((loops_600_exit288_341_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_79_S_0;
+		end
+	BPHLS_F_loops_600_BB_79_S_0:
+		next_state = BPHLS_F_loops_600_BB_79_S_1;
+	BPHLS_F_loops_600_BB_79_S_1:
+		if ((loops_600_exit189_343_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_75_S_0;
+		end
+		else if ((loops_600_exit189_343_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_80_S_0;
+		end
+	BPHLS_F_loops_600_BB_7_S_0:
+		next_state = BPHLS_F_loops_600_BB_7_S_1;
+	BPHLS_F_loops_600_BB_7_S_1:
+		next_state = BPHLS_F_loops_600_BB_7_S_2;
+	BPHLS_F_loops_600_BB_7_S_2:
+		if ((loops_600_loop23_45_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_7_S_0;
+		end
+		else if ((loops_600_loop23_45_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_8_S_0;
+		end
+	BPHLS_F_loops_600_BB_80_S_0:
+		next_state = BPHLS_F_loops_600_BB_81_S_0;
+	BPHLS_F_loops_600_BB_81_S_0:
+		next_state = BPHLS_F_loops_600_BB_82_S_0;
+	BPHLS_F_loops_600_BB_82_S_0:
+		next_state = BPHLS_F_loops_600_BB_82_S_1;
+	BPHLS_F_loops_600_BB_82_S_1:
+		next_state = BPHLS_F_loops_600_BB_82_S_2;
+	BPHLS_F_loops_600_BB_82_S_2:
+		next_state = BPHLS_F_loops_600_BB_82_S_3;
+	BPHLS_F_loops_600_BB_82_S_3:
+		if ((loops_600_loop293_360_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_82_S_0;
+		end
+		else if ((loops_600_loop293_360_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_83_S_0;
+		end
+	BPHLS_F_loops_600_BB_83_S_0:
+		next_state = BPHLS_F_loops_600_BB_83_S_1;
+	BPHLS_F_loops_600_BB_83_S_1:
+		if ((loops_600_exit294_362_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_81_S_0;
+		end
+		else if ((loops_600_exit294_362_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_84_S_0;
+		end
+	BPHLS_F_loops_600_BB_84_S_0:
+		next_state = BPHLS_F_loops_600_BB_84_S_1;
+	BPHLS_F_loops_600_BB_84_S_1:
+		if ((loops_600_exit195_364_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_80_S_0;
+		end
+		else if ((loops_600_exit195_364_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_85_S_0;
+		end
+	BPHLS_F_loops_600_BB_85_S_0:
+		next_state = BPHLS_F_loops_600_BB_86_S_0;
+	BPHLS_F_loops_600_BB_86_S_0:
+		next_state = BPHLS_F_loops_600_BB_87_S_0;
+	BPHLS_F_loops_600_BB_87_S_0:
+		next_state = BPHLS_F_loops_600_BB_87_S_1;
+	BPHLS_F_loops_600_BB_87_S_1:
+		if ((loops_600_loop299_381_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_87_S_0;
+		end
+		else if ((loops_600_loop299_381_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_88_S_0;
+		end
+	BPHLS_F_loops_600_BB_88_S_0:
+		next_state = BPHLS_F_loops_600_BB_88_S_1;
+	BPHLS_F_loops_600_BB_88_S_1:
+		if ((loops_600_exit2100_383_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_86_S_0;
+		end
+		else if ((loops_600_exit2100_383_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_89_S_0;
+		end
+	BPHLS_F_loops_600_BB_89_S_0:
+		next_state = BPHLS_F_loops_600_BB_89_S_1;
+	BPHLS_F_loops_600_BB_89_S_1:
+		if ((loops_600_exit1101_385_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_85_S_0;
+		end
+		else if ((loops_600_exit1101_385_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_90_S_0;
+		end
+	BPHLS_F_loops_600_BB_8_S_0:
+		next_state = BPHLS_F_loops_600_BB_8_S_1;
+	BPHLS_F_loops_600_BB_8_S_1:
+		if ((loops_600_exit24_47_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_6_S_0;
+		end
+		else if ((loops_600_exit24_47_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_9_S_0;
+		end
+	BPHLS_F_loops_600_BB_90_S_0:
+		next_state = BPHLS_F_loops_600_BB_91_S_0;
+	BPHLS_F_loops_600_BB_91_S_0:
+		next_state = BPHLS_F_loops_600_BB_92_S_0;
+	BPHLS_F_loops_600_BB_92_S_0:
+		next_state = BPHLS_F_loops_600_BB_92_S_1;
+	BPHLS_F_loops_600_BB_92_S_1:
+		if ((loops_600_loop2105_402_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_92_S_0;
+		end
+		else if ((loops_600_loop2105_402_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_93_S_0;
+		end
+	BPHLS_F_loops_600_BB_93_S_0:
+		next_state = BPHLS_F_loops_600_BB_93_S_1;
+	BPHLS_F_loops_600_BB_93_S_1:
+		if ((loops_600_exit2106_404_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_91_S_0;
+		end
+		else if ((loops_600_exit2106_404_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_94_S_0;
+		end
+	BPHLS_F_loops_600_BB_94_S_0:
+		next_state = BPHLS_F_loops_600_BB_94_S_1;
+	BPHLS_F_loops_600_BB_94_S_1:
+		if ((loops_600_exit1107_406_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_90_S_0;
+		end
+		else if ((loops_600_exit1107_406_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_95_S_0;
+		end
+	BPHLS_F_loops_600_BB_95_S_0:
+		next_state = BPHLS_F_loops_600_BB_96_S_0;
+	BPHLS_F_loops_600_BB_96_S_0:
+		next_state = BPHLS_F_loops_600_BB_97_S_0;
+	BPHLS_F_loops_600_BB_97_S_0:
+		next_state = BPHLS_F_loops_600_BB_97_S_1;
+	BPHLS_F_loops_600_BB_97_S_1:
+		if ((loops_600_loop2111_423_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_97_S_0;
+		end
+		else if ((loops_600_loop2111_423_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_98_S_0;
+		end
+	BPHLS_F_loops_600_BB_98_S_0:
+		next_state = BPHLS_F_loops_600_BB_98_S_1;
+	BPHLS_F_loops_600_BB_98_S_1:
+		if ((loops_600_exit2112_425_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_96_S_0;
+		end
+		else if ((loops_600_exit2112_425_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_99_S_0;
+		end
+	BPHLS_F_loops_600_BB_99_S_0:
+		next_state = BPHLS_F_loops_600_BB_99_S_1;
+	BPHLS_F_loops_600_BB_99_S_1:
+		if ((loops_600_exit1113_427_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_95_S_0;
+		end
+		else if ((loops_600_exit1113_427_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_100_S_0;
+		end
+	BPHLS_F_loops_600_BB_9_S_0:
+		next_state = BPHLS_F_loops_600_BB_9_S_1;
+	BPHLS_F_loops_600_BB_9_S_1:
+		if ((loops_600_exit15_49_reg == 1'd1)) begin
+			next_state = BPHLS_F_loops_600_BB_5_S_0;
+		end
+		else if ((loops_600_exit15_49_reg == 1'd0)) begin
+			next_state = BPHLS_F_loops_600_BB_10_S_0;
+		end
+	default:
+		next_state = cur_state;
+	endcase
+end
+
+/* FSM END -----------------------------------------------------------------*/
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS) & (start == 1'd1))) begin
+		loops_600_loop0_8_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_4_S_1) & (loops_600_exit1_28_reg == 1'd1))) begin
+		loops_600_loop0_8_reg[1:0] <= loops_600_exit1_27_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS) & (start == 1'd1))) begin
+		loops_600_loop0_9_reg[63:0] <= arg_7[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_4_S_1) & (loops_600_exit1_28_reg == 1'd1))) begin
+		loops_600_loop0_9_reg[63:0] <= loops_600_loop2_22_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_0_S_0)) begin
+		loops_600_loop1_10_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_3_S_1) & (loops_600_exit2_26_reg == 1'd1))) begin
+		loops_600_loop1_10_reg[1:0] <= loops_600_exit2_25_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_0_S_0)) begin
+		loops_600_loop1_11_reg[63:0] <= loops_600_loop0_9_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_3_S_1) & (loops_600_exit2_26_reg == 1'd1))) begin
+		loops_600_loop1_11_reg[63:0] <= loops_600_loop2_22_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_1_S_0)) begin
+		loops_600_loop2_12_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_2_S_1) & (loops_600_loop2_24_reg == 1'd1))) begin
+		loops_600_loop2_12_reg[1:0] <= loops_600_loop2_23_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_1_S_0)) begin
+		loops_600_loop2_13_reg[63:0] <= loops_600_loop1_11_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_2_S_1) & (loops_600_loop2_24_reg == 1'd1))) begin
+		loops_600_loop2_13_reg[63:0] <= loops_600_loop2_22_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop2_14[15:0] = loops_600_loop2_add_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_2_S_0)) begin
+		loops_600_loop2_14_reg[15:0] <= loops_600_loop2_14[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_7_S_0)) begin
+		loops_600_loop2_14_reg[15:0] <= loops_600_loop23_35[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_17_S_0)) begin
+		loops_600_loop2_14_reg[15:0] <= loops_600_loop215_80[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_62_S_0)) begin
+		loops_600_loop2_14_reg[15:0] <= loops_600_loop269_268[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_77_S_0)) begin
+		loops_600_loop2_14_reg[15:0] <= loops_600_loop287_329[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_117_S_0)) begin
+		loops_600_loop2_14_reg[15:0] <= loops_600_loop2135_504[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop2_15[31:0] = loops_600_loop2_or_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_2_S_0)) begin
+		loops_600_loop2_15_reg[31:0] <= loops_600_loop2_15[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_27_S_0)) begin
+		loops_600_loop2_15_reg[31:0] <= loops_600_loop227_125[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_52_S_0)) begin
+		loops_600_loop2_15_reg[31:0] <= loops_600_loop257_226[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_112_S_0)) begin
+		loops_600_loop2_15_reg[31:0] <= loops_600_loop2129_479[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop2_17[7:0] = loops_600_loop2_mul_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_2_S_0)) begin
+		loops_600_loop2_17_reg[7:0] <= loops_600_loop2_17[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_17_S_0)) begin
+		loops_600_loop2_17_reg[7:0] <= loops_600_loop215_77[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_37_S_0)) begin
+		loops_600_loop2_17_reg[7:0] <= loops_600_loop239_164[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_67_S_0)) begin
+		loops_600_loop2_17_reg[7:0] <= loops_600_loop275_293[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_82_S_0)) begin
+		loops_600_loop2_17_reg[7:0] <= loops_600_loop293_351[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop2_18[7:0] = loops_600_loop2_and_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_2_S_0)) begin
+		loops_600_loop2_18_reg[7:0] <= loops_600_loop2_18[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_32_S_0)) begin
+		loops_600_loop2_18_reg[7:0] <= loops_600_loop233_146[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_82_S_0)) begin
+		loops_600_loop2_18_reg[7:0] <= loops_600_loop293_354[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop2_19[31:0] = (arg_5 ^ arg_3);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_2_S_0)) begin
+		loops_600_loop2_19_reg[31:0] <= loops_600_loop2_19[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop2_20[15:0] = loops_600_loop2_and_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_2_S_0)) begin
+		loops_600_loop2_20_reg[15:0] <= loops_600_loop2_20[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_87_S_0)) begin
+		loops_600_loop2_20_reg[15:0] <= loops_600_loop299_378[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop2_21[7:0] = (loops_600_loop2_17 - loops_600_loop2_18);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_2_S_0)) begin
+		loops_600_loop2_21_reg[7:0] <= loops_600_loop2_21[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop2_22[63:0] = (loops_600_loop2_13_reg + loops_600_loop2_21);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_2_S_0)) begin
+		loops_600_loop2_22_reg[63:0] <= loops_600_loop2_22[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop2_23[31:0] = loops_600_loop2_add_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_2_S_0)) begin
+		loops_600_loop2_23_reg[7:0] <= loops_600_loop2_23[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_3_S_0)) begin
+		loops_600_loop2_23_reg[7:0] <= loops_600_exit2_25[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_4_S_0)) begin
+		loops_600_loop2_23_reg[7:0] <= loops_600_exit1_27[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_9_S_0)) begin
+		loops_600_loop2_23_reg[7:0] <= loops_600_exit15_48[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_13_S_0)) begin
+		loops_600_loop2_23_reg[7:0] <= loops_600_exit210_67[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_17_S_0)) begin
+		loops_600_loop2_23_reg[7:0] <= loops_600_loop215_86[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_19_S_0)) begin
+		loops_600_loop2_23_reg[7:0] <= loops_600_exit117_90[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_22_S_0)) begin
+		loops_600_loop2_23_reg[7:0] <= loops_600_loop221_107[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_23_S_0)) begin
+		loops_600_loop2_23_reg[7:0] <= loops_600_exit222_109[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_27_S_0)) begin
+		loops_600_loop2_23_reg[7:0] <= loops_600_loop227_128[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_29_S_0)) begin
+		loops_600_loop2_23_reg[7:0] <= loops_600_exit129_132[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_32_S_0)) begin
+		loops_600_loop2_23_reg[7:0] <= loops_600_loop233_140[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_48_S_0)) begin
+		loops_600_loop2_23_reg[7:0] <= loops_600_exit252_214[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_52_S_0)) begin
+		loops_600_loop2_23_reg[7:0] <= loops_600_loop257_233[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_54_S_0)) begin
+		loops_600_loop2_23_reg[7:0] <= loops_600_exit159_237[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_57_S_0)) begin
+		loops_600_loop2_23_reg[7:0] <= loops_600_loop263_254[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_58_S_0)) begin
+		loops_600_loop2_23_reg[7:0] <= loops_600_exit264_256[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_62_S_0)) begin
+		loops_600_loop2_23_reg[7:0] <= loops_600_loop269_275[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_64_S_0)) begin
+		loops_600_loop2_23_reg[7:0] <= loops_600_exit171_279[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_68_S_0)) begin
+		loops_600_loop2_23_reg[7:0] <= loops_600_exit276_298[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_72_S_0)) begin
+		loops_600_loop2_23_reg[7:0] <= loops_600_loop281_309[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_92_S_0)) begin
+		loops_600_loop2_23_reg[7:0] <= loops_600_loop2105_401[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_94_S_0)) begin
+		loops_600_loop2_23_reg[7:0] <= loops_600_exit1107_405[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_98_S_0)) begin
+		loops_600_loop2_23_reg[7:0] <= loops_600_exit2112_424[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_102_S_0)) begin
+		loops_600_loop2_23_reg[7:0] <= loops_600_loop2117_443[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_104_S_0)) begin
+		loops_600_loop2_23_reg[7:0] <= loops_600_exit1119_447[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_107_S_0)) begin
+		loops_600_loop2_23_reg[7:0] <= loops_600_loop2123_464[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_108_S_0)) begin
+		loops_600_loop2_23_reg[7:0] <= loops_600_exit2124_466[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_112_S_0)) begin
+		loops_600_loop2_23_reg[7:0] <= loops_600_loop2129_485[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_114_S_0)) begin
+		loops_600_loop2_23_reg[7:0] <= loops_600_exit1131_489[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_118_S_0)) begin
+		loops_600_loop2_23_reg[7:0] <= loops_600_exit2136_508[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop2_24 = loops_600_loop2_icmp_8_0;
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_2_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_loop2_24;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_3_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_exit2_26;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_4_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_exit1_28;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_7_S_1)) begin
+		loops_600_loop2_24_reg <= loops_600_loop23_45;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_8_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_exit24_47;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_9_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_exit15_49;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_12_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_loop29_66;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_13_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_exit210_68;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_14_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_exit111_70;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_17_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_loop215_87;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_18_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_exit216_89;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_19_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_exit117_91;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_22_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_loop221_108;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_23_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_exit222_110;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_24_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_exit123_112;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_27_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_loop227_129;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_28_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_exit228_131;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_29_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_exit129_133;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_32_S_1)) begin
+		loops_600_loop2_24_reg <= loops_600_loop233_150;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_33_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_exit234_152;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_34_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_exit135_154;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_37_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_loop239_171;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_38_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_exit240_173;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_39_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_exit141_175;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_42_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_loop245_192;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_43_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_exit246_194;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_44_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_exit147_196;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_47_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_loop251_213;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_48_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_exit252_215;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_49_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_exit153_217;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_52_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_loop257_234;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_53_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_exit258_236;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_54_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_exit159_238;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_57_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_loop263_255;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_58_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_exit264_257;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_59_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_exit165_259;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_62_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_loop269_276;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_63_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_exit270_278;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_64_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_exit171_280;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_67_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_loop275_297;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_68_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_exit276_299;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_69_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_exit177_301;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_72_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_loop281_318;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_73_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_exit282_320;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_74_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_exit183_322;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_77_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_loop287_339;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_78_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_exit288_341;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_79_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_exit189_343;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_82_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_loop293_360;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_83_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_exit294_362;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_84_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_exit195_364;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_87_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_loop299_381;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_88_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_exit2100_383;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_89_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_exit1101_385;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_92_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_loop2105_402;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_93_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_exit2106_404;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_94_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_exit1107_406;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_97_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_loop2111_423;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_98_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_exit2112_425;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_99_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_exit1113_427;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_102_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_loop2117_444;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_103_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_exit2118_446;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_104_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_exit1119_448;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_107_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_loop2123_465;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_108_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_exit2124_467;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_109_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_exit1125_469;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_112_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_loop2129_486;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_113_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_exit2130_488;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_114_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_exit1131_490;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_117_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_loop2135_507;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_118_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_exit2136_509;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_119_S_0)) begin
+		loops_600_loop2_24_reg <= loops_600_exit1137_511;
+	end
+end
+
+always @ (*) begin
+	loops_600_exit2_25[31:0] = loops_600_exit2_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit2_25_reg[2:0] = loops_600_loop2_23_reg[2:0];
+end
+
+always @ (*) begin
+	loops_600_exit2_26 = loops_600_exit2_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_exit2_26_reg = loops_600_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_600_exit1_27[31:0] = loops_600_exit1_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit1_27_reg[2:0] = loops_600_loop2_23_reg[2:0];
+end
+
+always @ (*) begin
+	loops_600_exit1_28 = loops_600_exit1_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_exit1_28_reg = loops_600_loop2_24_reg;
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_600_BB_4_S_1) & (loops_600_exit1_28_reg == 1'd0))) begin
+		loops_600_loop01_29_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_9_S_1) & (loops_600_exit15_49_reg == 1'd1))) begin
+		loops_600_loop01_29_reg[1:0] <= loops_600_exit15_48_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_600_BB_4_S_1) & (loops_600_exit1_28_reg == 1'd0))) begin
+		loops_600_loop01_30_reg[63:0] <= loops_600_loop2_22_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_9_S_1) & (loops_600_exit15_49_reg == 1'd1))) begin
+		loops_600_loop01_30_reg[63:0] <= loops_600_loop23_43_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_5_S_0)) begin
+		loops_600_loop12_31_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_8_S_1) & (loops_600_exit24_47_reg == 1'd1))) begin
+		loops_600_loop12_31_reg[1:0] <= loops_600_exit24_46_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_5_S_0)) begin
+		loops_600_loop12_32_reg[63:0] <= loops_600_loop01_30_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_8_S_1) & (loops_600_exit24_47_reg == 1'd1))) begin
+		loops_600_loop12_32_reg[63:0] <= loops_600_loop23_43_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_6_S_0)) begin
+		loops_600_loop23_33_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_7_S_2) & (loops_600_loop23_45_reg == 1'd1))) begin
+		loops_600_loop23_33_reg[1:0] <= loops_600_loop23_44_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_6_S_0)) begin
+		loops_600_loop23_34_reg[63:0] <= loops_600_loop12_32_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_7_S_2) & (loops_600_loop23_45_reg == 1'd1))) begin
+		loops_600_loop23_34_reg[63:0] <= loops_600_loop23_43_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop23_35[15:0] = loops_600_loop23_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop23_35_reg[15:0] = loops_600_loop2_14_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop23_36[63:0] = (arg_7 + arg_7);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_7_S_0)) begin
+		loops_600_loop23_36_reg[63:0] <= loops_600_loop23_36[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop23_38[15:0] = (loops_600_loop2_20_reg ^ loops_600_loop23_35);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_7_S_0)) begin
+		loops_600_loop23_38_reg[15:0] <= loops_600_loop23_38[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop23_39[7:0] = loops_600_loop23_or_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_7_S_0)) begin
+		loops_600_loop23_39_reg[7:0] <= loops_600_loop23_39[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_62_S_0)) begin
+		loops_600_loop23_39_reg[7:0] <= loops_600_loop269_266[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_77_S_0)) begin
+		loops_600_loop23_39_reg[7:0] <= loops_600_loop287_336[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_112_S_0)) begin
+		loops_600_loop23_39_reg[7:0] <= loops_600_loop2129_480[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop23_40[63:0] = (loops_600_loop23_36 - loops_600_loop23_34_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_7_S_0)) begin
+		loops_600_loop23_40_reg[63:0] <= loops_600_loop23_40[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop23_41[7:0] = loops_600_loop23_or_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_7_S_1)) begin
+		loops_600_loop23_41_reg[7:0] <= loops_600_loop23_41[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_27_S_0)) begin
+		loops_600_loop23_41_reg[7:0] <= loops_600_loop227_120[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_92_S_0)) begin
+		loops_600_loop23_41_reg[7:0] <= loops_600_loop2105_392[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop23_42[7:0] = loops_600_loop23_add_8_8_1[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_7_S_0)) begin
+		loops_600_loop23_42_reg[7:0] <= loops_600_loop23_42[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_37_S_0)) begin
+		loops_600_loop23_42_reg[7:0] <= loops_600_loop239_170[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_39_S_0)) begin
+		loops_600_loop23_42_reg[7:0] <= loops_600_exit141_174[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_43_S_0)) begin
+		loops_600_loop23_42_reg[7:0] <= loops_600_exit246_193[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_47_S_0)) begin
+		loops_600_loop23_42_reg[7:0] <= loops_600_loop251_212[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_49_S_0)) begin
+		loops_600_loop23_42_reg[7:0] <= loops_600_exit153_216[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_53_S_0)) begin
+		loops_600_loop23_42_reg[7:0] <= loops_600_exit258_235[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_57_S_0)) begin
+		loops_600_loop23_42_reg[7:0] <= loops_600_loop263_249[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_77_S_0)) begin
+		loops_600_loop23_42_reg[7:0] <= loops_600_loop287_335[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_103_S_0)) begin
+		loops_600_loop23_42_reg[7:0] <= loops_600_exit2118_445[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_107_S_0)) begin
+		loops_600_loop23_42_reg[7:0] <= loops_600_loop2123_459[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop23_43[63:0] = (loops_600_loop23_34_reg + loops_600_loop23_42);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_7_S_0)) begin
+		loops_600_loop23_43_reg[63:0] <= loops_600_loop23_43[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop23_44[31:0] = loops_600_loop23_add_8_8_1[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_7_S_1)) begin
+		loops_600_loop23_44_reg[7:0] <= loops_600_loop23_44[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_8_S_0)) begin
+		loops_600_loop23_44_reg[7:0] <= loops_600_exit24_46[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_12_S_0)) begin
+		loops_600_loop23_44_reg[7:0] <= loops_600_loop29_65[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_14_S_0)) begin
+		loops_600_loop23_44_reg[7:0] <= loops_600_exit111_69[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_18_S_0)) begin
+		loops_600_loop23_44_reg[7:0] <= loops_600_exit216_88[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_22_S_0)) begin
+		loops_600_loop23_44_reg[7:0] <= loops_600_loop221_104[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_59_S_0)) begin
+		loops_600_loop23_44_reg[7:0] <= loops_600_exit165_258[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_63_S_0)) begin
+		loops_600_loop23_44_reg[7:0] <= loops_600_exit270_277[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_67_S_0)) begin
+		loops_600_loop23_44_reg[7:0] <= loops_600_loop275_296[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_69_S_0)) begin
+		loops_600_loop23_44_reg[7:0] <= loops_600_exit177_300[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_72_S_1)) begin
+		loops_600_loop23_44_reg[7:0] <= loops_600_loop281_313[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_72_S_0)) begin
+		loops_600_loop23_44_reg[7:0] <= loops_600_loop281_317[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_97_S_0)) begin
+		loops_600_loop23_44_reg[7:0] <= loops_600_loop2111_422[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_99_S_0)) begin
+		loops_600_loop23_44_reg[7:0] <= loops_600_exit1113_426[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_109_S_0)) begin
+		loops_600_loop23_44_reg[7:0] <= loops_600_exit1125_468[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_113_S_0)) begin
+		loops_600_loop23_44_reg[7:0] <= loops_600_exit2130_487[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_117_S_0)) begin
+		loops_600_loop23_44_reg[7:0] <= loops_600_loop2135_506[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_119_S_0)) begin
+		loops_600_loop23_44_reg[7:0] <= loops_600_exit1137_510[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop23_45 = loops_600_loop23_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_loop23_45_reg = loops_600_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_600_exit24_46[31:0] = loops_600_exit24_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit24_46_reg[2:0] = loops_600_loop23_44_reg[2:0];
+end
+
+always @ (*) begin
+	loops_600_exit24_47 = loops_600_exit24_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_exit24_47_reg = loops_600_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_600_exit15_48[31:0] = loops_600_exit15_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit15_48_reg[2:0] = loops_600_loop2_23_reg[2:0];
+end
+
+always @ (*) begin
+	loops_600_exit15_49 = loops_600_exit15_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_exit15_49_reg = loops_600_loop2_24_reg;
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_600_BB_9_S_1) & (loops_600_exit15_49_reg == 1'd0))) begin
+		loops_600_loop07_50_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_14_S_1) & (loops_600_exit111_70_reg == 1'd1))) begin
+		loops_600_loop07_50_reg[1:0] <= loops_600_exit111_69_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_600_BB_9_S_1) & (loops_600_exit15_49_reg == 1'd0))) begin
+		loops_600_loop07_51_reg[63:0] <= loops_600_loop23_43_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_14_S_1) & (loops_600_exit111_70_reg == 1'd1))) begin
+		loops_600_loop07_51_reg[63:0] <= loops_600_loop29_64_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_10_S_0)) begin
+		loops_600_loop18_52_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_13_S_1) & (loops_600_exit210_68_reg == 1'd1))) begin
+		loops_600_loop18_52_reg[1:0] <= loops_600_exit210_67_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_10_S_0)) begin
+		loops_600_loop18_53_reg[63:0] <= loops_600_loop07_51_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_13_S_1) & (loops_600_exit210_68_reg == 1'd1))) begin
+		loops_600_loop18_53_reg[63:0] <= loops_600_loop29_64_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_11_S_0)) begin
+		loops_600_loop29_54_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_12_S_1) & (loops_600_loop29_66_reg == 1'd1))) begin
+		loops_600_loop29_54_reg[1:0] <= loops_600_loop29_65_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_11_S_0)) begin
+		loops_600_loop29_55_reg[63:0] <= loops_600_loop18_53_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_12_S_1) & (loops_600_loop29_66_reg == 1'd1))) begin
+		loops_600_loop29_55_reg[63:0] <= loops_600_loop29_64_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop29_57[31:0] = (arg_5 - arg_4);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_12_S_0)) begin
+		loops_600_loop29_57_reg[31:0] <= loops_600_loop29_57[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop29_58[31:0] = loops_600_loop29_and_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_12_S_0)) begin
+		loops_600_loop29_58_reg[31:0] <= loops_600_loop29_58[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_32_S_0)) begin
+		loops_600_loop29_58_reg[31:0] <= loops_600_loop233_147[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_97_S_0)) begin
+		loops_600_loop29_58_reg[31:0] <= loops_600_loop2111_420[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop29_59[31:0] = loops_600_loop29_and_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_12_S_1)) begin
+		loops_600_loop29_59_reg[31:0] <= loops_600_loop29_59[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_37_S_0)) begin
+		loops_600_loop29_59_reg[31:0] <= loops_600_loop239_166[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop29_60[63:0] = (loops_600_loop23_40_reg + loops_600_loop23_34_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_12_S_0)) begin
+		loops_600_loop29_60_reg[63:0] <= loops_600_loop29_60[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop29_61[15:0] = loops_600_loop29_and_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_12_S_0)) begin
+		loops_600_loop29_61_reg[15:0] <= loops_600_loop29_61[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop29_63[31:0] = (loops_600_loop2_15_reg ^ arg_5);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_12_S_0)) begin
+		loops_600_loop29_63_reg[31:0] <= loops_600_loop29_63[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop29_64[63:0] = (loops_600_loop29_55_reg + loops_600_loop29_63);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_12_S_0)) begin
+		loops_600_loop29_64_reg[63:0] <= loops_600_loop29_64[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop29_65[31:0] = loops_600_loop29_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop29_65_reg[2:0] = loops_600_loop23_44_reg[2:0];
+end
+
+always @ (*) begin
+	loops_600_loop29_66 = loops_600_loop29_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_loop29_66_reg = loops_600_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_600_exit210_67[31:0] = loops_600_exit210_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit210_67_reg[2:0] = loops_600_loop2_23_reg[2:0];
+end
+
+always @ (*) begin
+	loops_600_exit210_68 = loops_600_exit210_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_exit210_68_reg = loops_600_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_600_exit111_69[31:0] = loops_600_exit111_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit111_69_reg[2:0] = loops_600_loop23_44_reg[2:0];
+end
+
+always @ (*) begin
+	loops_600_exit111_70 = loops_600_exit111_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_exit111_70_reg = loops_600_loop2_24_reg;
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_600_BB_14_S_1) & (loops_600_exit111_70_reg == 1'd0))) begin
+		loops_600_loop013_71_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_19_S_1) & (loops_600_exit117_91_reg == 1'd1))) begin
+		loops_600_loop013_71_reg[1:0] <= loops_600_exit117_90_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_600_BB_14_S_1) & (loops_600_exit111_70_reg == 1'd0))) begin
+		loops_600_loop013_72_reg[63:0] <= loops_600_loop29_64_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_19_S_1) & (loops_600_exit117_91_reg == 1'd1))) begin
+		loops_600_loop013_72_reg[63:0] <= loops_600_loop215_85_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_15_S_0)) begin
+		loops_600_loop114_73_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_18_S_1) & (loops_600_exit216_89_reg == 1'd1))) begin
+		loops_600_loop114_73_reg[1:0] <= loops_600_exit216_88_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_15_S_0)) begin
+		loops_600_loop114_74_reg[63:0] <= loops_600_loop013_72_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_18_S_1) & (loops_600_exit216_89_reg == 1'd1))) begin
+		loops_600_loop114_74_reg[63:0] <= loops_600_loop215_85_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_16_S_0)) begin
+		loops_600_loop215_75_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_17_S_1) & (loops_600_loop215_87_reg == 1'd1))) begin
+		loops_600_loop215_75_reg[1:0] <= loops_600_loop215_86_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_16_S_0)) begin
+		loops_600_loop215_76_reg[63:0] <= loops_600_loop114_74_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_17_S_1) & (loops_600_loop215_87_reg == 1'd1))) begin
+		loops_600_loop215_76_reg[63:0] <= loops_600_loop215_85_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop215_77[7:0] = loops_600_loop215_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop215_77_reg[7:0] = loops_600_loop2_17_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop215_79[31:0] = (loops_600_loop29_58_reg ^ loops_600_loop2_15_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_17_S_0)) begin
+		loops_600_loop215_79_reg[31:0] <= loops_600_loop215_79[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop215_80[15:0] = loops_600_loop215_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop215_80_reg[15:0] = loops_600_loop2_14_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop215_81[63:0] = (loops_600_loop29_55_reg | loops_600_loop23_40_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_17_S_0)) begin
+		loops_600_loop215_81_reg[63:0] <= loops_600_loop215_81[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop215_82[7:0] = (loops_600_loop2_18_reg ^ loops_600_loop23_41_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_17_S_0)) begin
+		loops_600_loop215_82_reg[7:0] <= loops_600_loop215_82[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop215_83[15:0] = loops_600_loop215_mul_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_17_S_0)) begin
+		loops_600_loop215_83_reg[15:0] <= loops_600_loop215_83[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_42_S_0)) begin
+		loops_600_loop215_83_reg[15:0] <= loops_600_loop245_188[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_67_S_0)) begin
+		loops_600_loop215_83_reg[15:0] <= loops_600_loop275_292[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop215_84[31:0] = (loops_600_loop29_58_reg ^ loops_600_loop29_59_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_17_S_0)) begin
+		loops_600_loop215_84_reg[31:0] <= loops_600_loop215_84[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop215_85[63:0] = (loops_600_loop215_76_reg + loops_600_loop215_84);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_17_S_0)) begin
+		loops_600_loop215_85_reg[63:0] <= loops_600_loop215_85[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop215_86[31:0] = loops_600_loop215_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop215_86_reg[2:0] = loops_600_loop2_23_reg[2:0];
+end
+
+always @ (*) begin
+	loops_600_loop215_87 = loops_600_loop215_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_loop215_87_reg = loops_600_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_600_exit216_88[31:0] = loops_600_exit216_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit216_88_reg[2:0] = loops_600_loop23_44_reg[2:0];
+end
+
+always @ (*) begin
+	loops_600_exit216_89 = loops_600_exit216_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_exit216_89_reg = loops_600_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_600_exit117_90[31:0] = loops_600_exit117_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit117_90_reg[2:0] = loops_600_loop2_23_reg[2:0];
+end
+
+always @ (*) begin
+	loops_600_exit117_91 = loops_600_exit117_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_exit117_91_reg = loops_600_loop2_24_reg;
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_600_BB_19_S_1) & (loops_600_exit117_91_reg == 1'd0))) begin
+		loops_600_loop019_92_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_24_S_1) & (loops_600_exit123_112_reg == 1'd1))) begin
+		loops_600_loop019_92_reg[1:0] <= loops_600_exit123_111_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_600_BB_19_S_1) & (loops_600_exit117_91_reg == 1'd0))) begin
+		loops_600_loop019_93_reg[63:0] <= loops_600_loop215_85_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_24_S_1) & (loops_600_exit123_112_reg == 1'd1))) begin
+		loops_600_loop019_93_reg[63:0] <= loops_600_loop221_106_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_20_S_0)) begin
+		loops_600_loop120_94_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_23_S_1) & (loops_600_exit222_110_reg == 1'd1))) begin
+		loops_600_loop120_94_reg[1:0] <= loops_600_exit222_109_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_20_S_0)) begin
+		loops_600_loop120_95_reg[63:0] <= loops_600_loop019_93_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_23_S_1) & (loops_600_exit222_110_reg == 1'd1))) begin
+		loops_600_loop120_95_reg[63:0] <= loops_600_loop221_106_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_21_S_0)) begin
+		loops_600_loop221_96_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_22_S_1) & (loops_600_loop221_108_reg == 1'd1))) begin
+		loops_600_loop221_96_reg[1:0] <= loops_600_loop221_107_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_21_S_0)) begin
+		loops_600_loop221_97_reg[63:0] <= loops_600_loop120_95_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_22_S_1) & (loops_600_loop221_108_reg == 1'd1))) begin
+		loops_600_loop221_97_reg[63:0] <= loops_600_loop221_106_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop221_98[63:0] = (loops_600_loop215_81_reg | loops_600_loop215_81_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_22_S_0)) begin
+		loops_600_loop221_98_reg[63:0] <= loops_600_loop221_98[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop221_99[63:0] = (loops_600_loop221_97_reg ^ loops_600_loop29_63_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_22_S_0)) begin
+		loops_600_loop221_99_reg[63:0] <= loops_600_loop221_99[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop221_100[7:0] = loops_600_loop221_and_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_22_S_0)) begin
+		loops_600_loop221_100_reg[7:0] <= loops_600_loop221_100[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_42_S_0)) begin
+		loops_600_loop221_100_reg[7:0] <= loops_600_loop245_185[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_87_S_0)) begin
+		loops_600_loop221_100_reg[7:0] <= loops_600_loop299_375[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop221_101[31:0] = (loops_600_loop215_84_reg - loops_600_loop2_19_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_22_S_0)) begin
+		loops_600_loop221_101_reg[31:0] <= loops_600_loop221_101[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop221_102[7:0] = loops_600_loop221_and_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_22_S_1)) begin
+		loops_600_loop221_102_reg[7:0] <= loops_600_loop221_102[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop221_103[63:0] = (loops_600_loop221_99_reg * loops_600_loop29_60_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_22_S_1)) begin
+		loops_600_loop221_103_reg[63:0] <= loops_600_loop221_103[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop221_104[7:0] = loops_600_loop221_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop221_104_reg[7:0] = loops_600_loop23_44_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop221_105[63:0] = (loops_600_loop221_98 | loops_600_loop215_77_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_22_S_0)) begin
+		loops_600_loop221_105_reg[63:0] <= loops_600_loop221_105[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop221_106[63:0] = (loops_600_loop221_97_reg + loops_600_loop221_105);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_22_S_0)) begin
+		loops_600_loop221_106_reg[63:0] <= loops_600_loop221_106[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop221_107[31:0] = loops_600_loop221_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop221_107_reg[2:0] = loops_600_loop2_23_reg[2:0];
+end
+
+always @ (*) begin
+	loops_600_loop221_108 = loops_600_loop221_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_loop221_108_reg = loops_600_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_600_exit222_109[31:0] = loops_600_exit222_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit222_109_reg[2:0] = loops_600_loop2_23_reg[2:0];
+end
+
+always @ (*) begin
+	loops_600_exit222_110 = loops_600_exit222_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_exit222_110_reg = loops_600_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_600_exit123_111[31:0] = loops_600_exit123_add_8_8_1[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_24_S_0)) begin
+		loops_600_exit123_111_reg[7:0] <= loops_600_exit123_111[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_28_S_0)) begin
+		loops_600_exit123_111_reg[7:0] <= loops_600_exit228_130[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_32_S_0)) begin
+		loops_600_exit123_111_reg[7:0] <= loops_600_loop233_143[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_73_S_0)) begin
+		loops_600_exit123_111_reg[7:0] <= loops_600_exit282_319[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_78_S_0)) begin
+		loops_600_exit123_111_reg[7:0] <= loops_600_exit288_340[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_79_S_0)) begin
+		loops_600_exit123_111_reg[7:0] <= loops_600_exit189_342[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_83_S_0)) begin
+		loops_600_exit123_111_reg[7:0] <= loops_600_exit294_361[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_87_S_0)) begin
+		loops_600_exit123_111_reg[7:0] <= loops_600_loop299_380[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_89_S_0)) begin
+		loops_600_exit123_111_reg[7:0] <= loops_600_exit1101_384[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_93_S_0)) begin
+		loops_600_exit123_111_reg[7:0] <= loops_600_exit2106_403[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_exit123_112 = loops_600_exit123_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_exit123_112_reg = loops_600_loop2_24_reg;
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_600_BB_24_S_1) & (loops_600_exit123_112_reg == 1'd0))) begin
+		loops_600_loop025_113_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_29_S_1) & (loops_600_exit129_133_reg == 1'd1))) begin
+		loops_600_loop025_113_reg[1:0] <= loops_600_exit129_132_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_600_BB_24_S_1) & (loops_600_exit123_112_reg == 1'd0))) begin
+		loops_600_loop025_114_reg[63:0] <= loops_600_loop221_106_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_29_S_1) & (loops_600_exit129_133_reg == 1'd1))) begin
+		loops_600_loop025_114_reg[63:0] <= loops_600_loop227_127_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_25_S_0)) begin
+		loops_600_loop126_115_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_28_S_1) & (loops_600_exit228_131_reg == 1'd1))) begin
+		loops_600_loop126_115_reg[1:0] <= loops_600_exit228_130_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_25_S_0)) begin
+		loops_600_loop126_116_reg[63:0] <= loops_600_loop025_114_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_28_S_1) & (loops_600_exit228_131_reg == 1'd1))) begin
+		loops_600_loop126_116_reg[63:0] <= loops_600_loop227_127_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_26_S_0)) begin
+		loops_600_loop227_117_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_27_S_1) & (loops_600_loop227_129_reg == 1'd1))) begin
+		loops_600_loop227_117_reg[1:0] <= loops_600_loop227_128_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_26_S_0)) begin
+		loops_600_loop227_118_reg[63:0] <= loops_600_loop126_116_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_27_S_1) & (loops_600_loop227_129_reg == 1'd1))) begin
+		loops_600_loop227_118_reg[63:0] <= loops_600_loop227_127_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop227_119[15:0] = loops_600_loop227_and_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_27_S_0)) begin
+		loops_600_loop227_119_reg[15:0] <= loops_600_loop227_119[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop227_120[7:0] = loops_600_loop227_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop227_120_reg[7:0] = loops_600_loop23_41_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop227_121[31:0] = (loops_600_loop29_58_reg - loops_600_loop29_63_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_27_S_0)) begin
+		loops_600_loop227_121_reg[31:0] <= loops_600_loop227_121[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop227_122[63:0] = (loops_600_loop221_105_reg ^ loops_600_loop221_103_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_27_S_0)) begin
+		loops_600_loop227_122_reg[63:0] <= loops_600_loop227_122[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop227_124[63:0] = (loops_600_loop221_99_reg * loops_600_loop215_83_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_27_S_0)) begin
+		loops_600_loop227_124_reg[63:0] <= loops_600_loop227_124[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop227_125[31:0] = loops_600_loop227_or_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop227_125_reg[31:0] = loops_600_loop2_15_reg[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop227_126[15:0] = (loops_600_loop2_20_reg ^ loops_600_loop29_61_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_27_S_0)) begin
+		loops_600_loop227_126_reg[15:0] <= loops_600_loop227_126[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop227_127[63:0] = (loops_600_loop227_118_reg + loops_600_loop227_126);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_27_S_0)) begin
+		loops_600_loop227_127_reg[63:0] <= loops_600_loop227_127[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop227_128[31:0] = loops_600_loop227_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop227_128_reg[2:0] = loops_600_loop2_23_reg[2:0];
+end
+
+always @ (*) begin
+	loops_600_loop227_129 = loops_600_loop227_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_loop227_129_reg = loops_600_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_600_exit228_130[31:0] = loops_600_exit228_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit228_130_reg[2:0] = loops_600_exit123_111_reg[2:0];
+end
+
+always @ (*) begin
+	loops_600_exit228_131 = loops_600_exit228_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_exit228_131_reg = loops_600_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_600_exit129_132[31:0] = loops_600_exit129_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit129_132_reg[2:0] = loops_600_loop2_23_reg[2:0];
+end
+
+always @ (*) begin
+	loops_600_exit129_133 = loops_600_exit129_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_exit129_133_reg = loops_600_loop2_24_reg;
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_600_BB_29_S_1) & (loops_600_exit129_133_reg == 1'd0))) begin
+		loops_600_loop031_134_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_34_S_1) & (loops_600_exit135_154_reg == 1'd1))) begin
+		loops_600_loop031_134_reg[1:0] <= loops_600_exit135_153_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_600_BB_29_S_1) & (loops_600_exit129_133_reg == 1'd0))) begin
+		loops_600_loop031_135_reg[63:0] <= loops_600_loop227_127_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_34_S_1) & (loops_600_exit135_154_reg == 1'd1))) begin
+		loops_600_loop031_135_reg[63:0] <= loops_600_loop233_148_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_30_S_0)) begin
+		loops_600_loop132_136_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_33_S_1) & (loops_600_exit234_152_reg == 1'd1))) begin
+		loops_600_loop132_136_reg[1:0] <= loops_600_exit234_151_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_30_S_0)) begin
+		loops_600_loop132_137_reg[63:0] <= loops_600_loop031_135_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_33_S_1) & (loops_600_exit234_152_reg == 1'd1))) begin
+		loops_600_loop132_137_reg[63:0] <= loops_600_loop233_148_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_31_S_0)) begin
+		loops_600_loop233_138_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_32_S_2) & (loops_600_loop233_150_reg == 1'd1))) begin
+		loops_600_loop233_138_reg[1:0] <= loops_600_loop233_149_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_31_S_0)) begin
+		loops_600_loop233_139_reg[63:0] <= loops_600_loop132_137_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_32_S_2) & (loops_600_loop233_150_reg == 1'd1))) begin
+		loops_600_loop233_139_reg[63:0] <= loops_600_loop233_148_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop233_140[7:0] = loops_600_loop233_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop233_140_reg[7:0] = loops_600_loop2_23_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop233_141[63:0] = (loops_600_loop227_122_reg ^ loops_600_loop227_118_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_32_S_0)) begin
+		loops_600_loop233_141_reg[63:0] <= loops_600_loop233_141[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop233_142[15:0] = loops_600_loop233_add_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_32_S_0)) begin
+		loops_600_loop233_142_reg[15:0] <= loops_600_loop233_142[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_92_S_0)) begin
+		loops_600_loop233_142_reg[15:0] <= loops_600_loop2105_393[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop233_143[7:0] = loops_600_loop233_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop233_143_reg[7:0] = loops_600_exit123_111_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop233_145[31:0] = (loops_600_loop215_79_reg ^ loops_600_loop29_59_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_32_S_0)) begin
+		loops_600_loop233_145_reg[31:0] <= loops_600_loop233_145[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop233_146[7:0] = loops_600_loop233_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop233_146_reg[7:0] = loops_600_loop2_18_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop233_147[31:0] = loops_600_loop233_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop233_147_reg[31:0] = loops_600_loop29_58_reg[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop233_148[63:0] = (loops_600_loop233_139_reg + loops_600_loop233_147);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_32_S_0)) begin
+		loops_600_loop233_148_reg[63:0] <= loops_600_loop233_148[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop233_149[31:0] = loops_600_loop233_add_8_8_1[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_32_S_1)) begin
+		loops_600_loop233_149_reg[2:0] <= loops_600_loop233_149[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_33_S_0)) begin
+		loops_600_loop233_149_reg[2:0] <= loops_600_exit234_151[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop233_150 = loops_600_loop233_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_loop233_150_reg = loops_600_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_600_exit234_151[31:0] = loops_600_exit234_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit234_151_reg[2:0] = loops_600_loop233_149_reg[2:0];
+end
+
+always @ (*) begin
+	loops_600_exit234_152 = loops_600_exit234_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_exit234_152_reg = loops_600_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_600_exit135_153[31:0] = loops_600_exit135_add_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_34_S_0)) begin
+		loops_600_exit135_153_reg[7:0] <= loops_600_exit135_153[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_38_S_0)) begin
+		loops_600_exit135_153_reg[7:0] <= loops_600_exit240_172[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_42_S_0)) begin
+		loops_600_exit135_153_reg[7:0] <= loops_600_loop245_191[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_44_S_0)) begin
+		loops_600_exit135_153_reg[7:0] <= loops_600_exit147_195[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_72_S_1)) begin
+		loops_600_exit135_153_reg[7:0] <= loops_600_loop281_314[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_exit135_154 = loops_600_exit135_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_exit135_154_reg = loops_600_loop2_24_reg;
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_600_BB_34_S_1) & (loops_600_exit135_154_reg == 1'd0))) begin
+		loops_600_loop037_155_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_39_S_1) & (loops_600_exit141_175_reg == 1'd1))) begin
+		loops_600_loop037_155_reg[1:0] <= loops_600_exit141_174_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_600_BB_34_S_1) & (loops_600_exit135_154_reg == 1'd0))) begin
+		loops_600_loop037_156_reg[63:0] <= loops_600_loop233_148_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_39_S_1) & (loops_600_exit141_175_reg == 1'd1))) begin
+		loops_600_loop037_156_reg[63:0] <= loops_600_loop239_169_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_35_S_0)) begin
+		loops_600_loop138_157_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_38_S_1) & (loops_600_exit240_173_reg == 1'd1))) begin
+		loops_600_loop138_157_reg[1:0] <= loops_600_exit240_172_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_35_S_0)) begin
+		loops_600_loop138_158_reg[63:0] <= loops_600_loop037_156_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_38_S_1) & (loops_600_exit240_173_reg == 1'd1))) begin
+		loops_600_loop138_158_reg[63:0] <= loops_600_loop239_169_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_36_S_0)) begin
+		loops_600_loop239_159_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_37_S_2) & (loops_600_loop239_171_reg == 1'd1))) begin
+		loops_600_loop239_159_reg[1:0] <= loops_600_loop239_170_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_36_S_0)) begin
+		loops_600_loop239_160_reg[63:0] <= loops_600_loop138_158_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_37_S_2) & (loops_600_loop239_171_reg == 1'd1))) begin
+		loops_600_loop239_160_reg[63:0] <= loops_600_loop239_169_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop239_161[31:0] = loops_600_loop239_mul_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_37_S_0)) begin
+		loops_600_loop239_161_reg[31:0] <= loops_600_loop239_161[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_77_S_0)) begin
+		loops_600_loop239_161_reg[31:0] <= loops_600_loop287_330[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_92_S_0)) begin
+		loops_600_loop239_161_reg[31:0] <= loops_600_loop2105_395[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop239_162[31:0] = loops_600_loop239_mul_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_37_S_1)) begin
+		loops_600_loop239_162_reg[31:0] <= loops_600_loop239_162[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_77_S_1)) begin
+		loops_600_loop239_162_reg[31:0] <= loops_600_loop287_334[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_92_S_1)) begin
+		loops_600_loop239_162_reg[31:0] <= loops_600_loop2105_398[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop239_164[7:0] = loops_600_loop239_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop239_164_reg[7:0] = loops_600_loop2_17_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop239_165[31:0] = (loops_600_loop239_162 ^ loops_600_loop239_161_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_37_S_1)) begin
+		loops_600_loop239_165_reg[31:0] <= loops_600_loop239_165[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop239_166[31:0] = loops_600_loop239_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop239_166_reg[31:0] = loops_600_loop29_59_reg[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop239_168[63:0] = (loops_600_loop227_118_reg + loops_600_loop227_124_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_37_S_0)) begin
+		loops_600_loop239_168_reg[63:0] <= loops_600_loop239_168[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop239_169[63:0] = (loops_600_loop239_160_reg + loops_600_loop239_168);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_37_S_0)) begin
+		loops_600_loop239_169_reg[63:0] <= loops_600_loop239_169[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop239_170[31:0] = loops_600_loop239_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop239_170_reg[2:0] = loops_600_loop23_42_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop239_171 = loops_600_loop239_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_loop239_171_reg = loops_600_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_600_exit240_172[31:0] = loops_600_exit240_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit240_172_reg[2:0] = loops_600_exit135_153_reg[2:0];
+end
+
+always @ (*) begin
+	loops_600_exit240_173 = loops_600_exit240_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_exit240_173_reg = loops_600_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_600_exit141_174[31:0] = loops_600_exit141_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit141_174_reg[2:0] = loops_600_loop23_42_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit141_175 = loops_600_exit141_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_exit141_175_reg = loops_600_loop2_24_reg;
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_600_BB_39_S_1) & (loops_600_exit141_175_reg == 1'd0))) begin
+		loops_600_loop043_176_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_44_S_1) & (loops_600_exit147_196_reg == 1'd1))) begin
+		loops_600_loop043_176_reg[1:0] <= loops_600_exit147_195_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_600_BB_39_S_1) & (loops_600_exit141_175_reg == 1'd0))) begin
+		loops_600_loop043_177_reg[63:0] <= loops_600_loop239_169_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_44_S_1) & (loops_600_exit147_196_reg == 1'd1))) begin
+		loops_600_loop043_177_reg[63:0] <= loops_600_loop245_190_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_40_S_0)) begin
+		loops_600_loop144_178_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_43_S_1) & (loops_600_exit246_194_reg == 1'd1))) begin
+		loops_600_loop144_178_reg[1:0] <= loops_600_exit246_193_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_40_S_0)) begin
+		loops_600_loop144_179_reg[63:0] <= loops_600_loop043_177_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_43_S_1) & (loops_600_exit246_194_reg == 1'd1))) begin
+		loops_600_loop144_179_reg[63:0] <= loops_600_loop245_190_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_41_S_0)) begin
+		loops_600_loop245_180_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_42_S_1) & (loops_600_loop245_192_reg == 1'd1))) begin
+		loops_600_loop245_180_reg[1:0] <= loops_600_loop245_191_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_41_S_0)) begin
+		loops_600_loop245_181_reg[63:0] <= loops_600_loop144_179_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_42_S_1) & (loops_600_loop245_192_reg == 1'd1))) begin
+		loops_600_loop245_181_reg[63:0] <= loops_600_loop245_190_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop245_182[15:0] = loops_600_loop245_add_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_42_S_0)) begin
+		loops_600_loop245_182_reg[15:0] <= loops_600_loop245_182[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop245_183[15:0] = (loops_600_loop233_142_reg ^ loops_600_loop227_126_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_42_S_0)) begin
+		loops_600_loop245_183_reg[15:0] <= loops_600_loop245_183[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop245_184[15:0] = loops_600_loop245_add_16_16_1[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_42_S_0)) begin
+		loops_600_loop245_184_reg[15:0] <= loops_600_loop245_184[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_57_S_0)) begin
+		loops_600_loop245_184_reg[15:0] <= loops_600_loop263_248[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_67_S_0)) begin
+		loops_600_loop245_184_reg[15:0] <= loops_600_loop275_290[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop245_185[7:0] = loops_600_loop245_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop245_185_reg[7:0] = loops_600_loop221_100_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop245_186[31:0] = loops_600_loop245_and_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_42_S_0)) begin
+		loops_600_loop245_186_reg[31:0] <= loops_600_loop245_186[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop245_187[31:0] = (loops_600_loop239_162_reg ^ loops_600_loop245_186);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_42_S_0)) begin
+		loops_600_loop245_187_reg[31:0] <= loops_600_loop245_187[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop245_188[15:0] = loops_600_loop245_mul_16_16_0[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop245_188_reg[15:0] = loops_600_loop215_83_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop245_189[15:0] = loops_600_loop245_or_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_42_S_0)) begin
+		loops_600_loop245_189_reg[15:0] <= loops_600_loop245_189[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_102_S_0)) begin
+		loops_600_loop245_189_reg[15:0] <= loops_600_loop2117_439[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_107_S_0)) begin
+		loops_600_loop245_189_reg[15:0] <= loops_600_loop2123_460[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop245_190[63:0] = (loops_600_loop245_181_reg + loops_600_loop245_189);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_42_S_0)) begin
+		loops_600_loop245_190_reg[63:0] <= loops_600_loop245_190[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop245_191[31:0] = loops_600_loop245_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop245_191_reg[2:0] = loops_600_exit135_153_reg[2:0];
+end
+
+always @ (*) begin
+	loops_600_loop245_192 = loops_600_loop245_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_loop245_192_reg = loops_600_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_600_exit246_193[31:0] = loops_600_exit246_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit246_193_reg[2:0] = loops_600_loop23_42_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit246_194 = loops_600_exit246_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_exit246_194_reg = loops_600_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_600_exit147_195[31:0] = loops_600_exit147_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit147_195_reg[2:0] = loops_600_exit135_153_reg[2:0];
+end
+
+always @ (*) begin
+	loops_600_exit147_196 = loops_600_exit147_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_exit147_196_reg = loops_600_loop2_24_reg;
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_600_BB_44_S_1) & (loops_600_exit147_196_reg == 1'd0))) begin
+		loops_600_loop049_197_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_49_S_1) & (loops_600_exit153_217_reg == 1'd1))) begin
+		loops_600_loop049_197_reg[1:0] <= loops_600_exit153_216_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_600_BB_44_S_1) & (loops_600_exit147_196_reg == 1'd0))) begin
+		loops_600_loop049_198_reg[63:0] <= loops_600_loop245_190_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_49_S_1) & (loops_600_exit153_217_reg == 1'd1))) begin
+		loops_600_loop049_198_reg[63:0] <= loops_600_loop251_211_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_45_S_0)) begin
+		loops_600_loop150_199_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_48_S_1) & (loops_600_exit252_215_reg == 1'd1))) begin
+		loops_600_loop150_199_reg[1:0] <= loops_600_exit252_214_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_45_S_0)) begin
+		loops_600_loop150_200_reg[63:0] <= loops_600_loop049_198_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_48_S_1) & (loops_600_exit252_215_reg == 1'd1))) begin
+		loops_600_loop150_200_reg[63:0] <= loops_600_loop251_211_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_46_S_0)) begin
+		loops_600_loop251_201_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_47_S_1) & (loops_600_loop251_213_reg == 1'd1))) begin
+		loops_600_loop251_201_reg[1:0] <= loops_600_loop251_212_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_46_S_0)) begin
+		loops_600_loop251_202_reg[63:0] <= loops_600_loop150_200_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_47_S_1) & (loops_600_loop251_213_reg == 1'd1))) begin
+		loops_600_loop251_202_reg[63:0] <= loops_600_loop251_211_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop251_204[15:0] = loops_600_loop251_or_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_47_S_0)) begin
+		loops_600_loop251_204_reg[15:0] <= loops_600_loop251_204[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop251_205[15:0] = loops_600_loop251_add_16_16_1[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_47_S_0)) begin
+		loops_600_loop251_205_reg[15:0] <= loops_600_loop251_205[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_87_S_0)) begin
+		loops_600_loop251_205_reg[15:0] <= loops_600_loop299_374[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop251_206[7:0] = (loops_600_loop221_102_reg - loops_600_loop221_102_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_47_S_0)) begin
+		loops_600_loop251_206_reg <= loops_600_loop251_206;
+	end
+end
+
+always @ (*) begin
+	loops_600_loop251_207[63:0] = (loops_600_loop233_141_reg * loops_600_loop245_181_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_47_S_0)) begin
+		loops_600_loop251_207_reg[63:0] <= loops_600_loop251_207[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop251_208[15:0] = loops_600_loop251_mul_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_47_S_0)) begin
+		loops_600_loop251_208_reg[15:0] <= loops_600_loop251_208[15:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_82_S_0)) begin
+		loops_600_loop251_208_reg[15:0] <= loops_600_loop293_350[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop251_210[7:0] = (loops_600_loop227_120_reg - loops_600_loop239_164_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_47_S_0)) begin
+		loops_600_loop251_210_reg[7:0] <= loops_600_loop251_210[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop251_211[63:0] = (loops_600_loop251_202_reg + loops_600_loop251_210);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_47_S_0)) begin
+		loops_600_loop251_211_reg[63:0] <= loops_600_loop251_211[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop251_212[31:0] = loops_600_loop251_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop251_212_reg[2:0] = loops_600_loop23_42_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop251_213 = loops_600_loop251_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_loop251_213_reg = loops_600_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_600_exit252_214[31:0] = loops_600_exit252_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit252_214_reg[2:0] = loops_600_loop2_23_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit252_215 = loops_600_exit252_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_exit252_215_reg = loops_600_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_600_exit153_216[31:0] = loops_600_exit153_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit153_216_reg[2:0] = loops_600_loop23_42_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit153_217 = loops_600_exit153_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_exit153_217_reg = loops_600_loop2_24_reg;
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_600_BB_49_S_1) & (loops_600_exit153_217_reg == 1'd0))) begin
+		loops_600_loop055_218_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_54_S_1) & (loops_600_exit159_238_reg == 1'd1))) begin
+		loops_600_loop055_218_reg[1:0] <= loops_600_exit159_237_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_600_BB_49_S_1) & (loops_600_exit153_217_reg == 1'd0))) begin
+		loops_600_loop055_219_reg[63:0] <= loops_600_loop251_211_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_54_S_1) & (loops_600_exit159_238_reg == 1'd1))) begin
+		loops_600_loop055_219_reg[63:0] <= loops_600_loop257_232_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_50_S_0)) begin
+		loops_600_loop156_220_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_53_S_1) & (loops_600_exit258_236_reg == 1'd1))) begin
+		loops_600_loop156_220_reg[1:0] <= loops_600_exit258_235_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_50_S_0)) begin
+		loops_600_loop156_221_reg[63:0] <= loops_600_loop055_219_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_53_S_1) & (loops_600_exit258_236_reg == 1'd1))) begin
+		loops_600_loop156_221_reg[63:0] <= loops_600_loop257_232_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_51_S_0)) begin
+		loops_600_loop257_222_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_52_S_1) & (loops_600_loop257_234_reg == 1'd1))) begin
+		loops_600_loop257_222_reg[1:0] <= loops_600_loop257_233_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_51_S_0)) begin
+		loops_600_loop257_223_reg[63:0] <= loops_600_loop156_221_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_52_S_1) & (loops_600_loop257_234_reg == 1'd1))) begin
+		loops_600_loop257_223_reg[63:0] <= loops_600_loop257_232_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop257_224[15:0] = (loops_600_loop245_188_reg ^ loops_600_loop245_189_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_52_S_0)) begin
+		loops_600_loop257_224_reg[15:0] <= loops_600_loop257_224[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop257_225[63:0] = (loops_600_loop251_202_reg ^ loops_600_loop257_223_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_52_S_0)) begin
+		loops_600_loop257_225_reg[63:0] <= loops_600_loop257_225[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop257_226[31:0] = loops_600_loop257_or_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop257_226_reg[31:0] = loops_600_loop2_15_reg[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop257_229[15:0] = loops_600_loop257_mul_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_52_S_0)) begin
+		loops_600_loop257_229_reg[15:0] <= loops_600_loop257_229[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop257_230[31:0] = (loops_600_loop239_161_reg ^ loops_600_loop257_226);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_52_S_0)) begin
+		loops_600_loop257_230_reg[31:0] <= loops_600_loop257_230[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop257_231[63:0] = (loops_600_loop257_223_reg & loops_600_loop251_202_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_52_S_0)) begin
+		loops_600_loop257_231_reg[63:0] <= loops_600_loop257_231[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop257_232[63:0] = (loops_600_loop257_223_reg + loops_600_loop257_231);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_52_S_0)) begin
+		loops_600_loop257_232_reg[63:0] <= loops_600_loop257_232[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop257_233[31:0] = loops_600_loop257_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop257_233_reg[2:0] = loops_600_loop2_23_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop257_234 = loops_600_loop257_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_loop257_234_reg = loops_600_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_600_exit258_235[31:0] = loops_600_exit258_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit258_235_reg[2:0] = loops_600_loop23_42_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit258_236 = loops_600_exit258_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_exit258_236_reg = loops_600_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_600_exit159_237[31:0] = loops_600_exit159_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit159_237_reg[2:0] = loops_600_loop2_23_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit159_238 = loops_600_exit159_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_exit159_238_reg = loops_600_loop2_24_reg;
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_600_BB_54_S_1) & (loops_600_exit159_238_reg == 1'd0))) begin
+		loops_600_loop061_239_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_59_S_1) & (loops_600_exit165_259_reg == 1'd1))) begin
+		loops_600_loop061_239_reg[1:0] <= loops_600_exit165_258_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_600_BB_54_S_1) & (loops_600_exit159_238_reg == 1'd0))) begin
+		loops_600_loop061_240_reg[63:0] <= loops_600_loop257_232_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_59_S_1) & (loops_600_exit165_259_reg == 1'd1))) begin
+		loops_600_loop061_240_reg[63:0] <= loops_600_loop263_253_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_55_S_0)) begin
+		loops_600_loop162_241_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_58_S_1) & (loops_600_exit264_257_reg == 1'd1))) begin
+		loops_600_loop162_241_reg[1:0] <= loops_600_exit264_256_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_55_S_0)) begin
+		loops_600_loop162_242_reg[63:0] <= loops_600_loop061_240_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_58_S_1) & (loops_600_exit264_257_reg == 1'd1))) begin
+		loops_600_loop162_242_reg[63:0] <= loops_600_loop263_253_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_56_S_0)) begin
+		loops_600_loop263_243_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_57_S_1) & (loops_600_loop263_255_reg == 1'd1))) begin
+		loops_600_loop263_243_reg[1:0] <= loops_600_loop263_254_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_56_S_0)) begin
+		loops_600_loop263_244_reg[63:0] <= loops_600_loop162_242_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_57_S_1) & (loops_600_loop263_255_reg == 1'd1))) begin
+		loops_600_loop263_244_reg[63:0] <= loops_600_loop263_253_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop263_248[15:0] = loops_600_loop263_add_16_16_1[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop263_248_reg[15:0] = loops_600_loop245_184_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop263_249[7:0] = loops_600_loop263_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop263_249_reg[7:0] = loops_600_loop23_42_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop263_250[15:0] = (loops_600_loop257_224_reg - loops_600_loop251_205_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_57_S_0)) begin
+		loops_600_loop263_250_reg[15:0] <= loops_600_loop263_250[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop263_252[7:0] = (loops_600_loop251_206_reg ^ loops_600_loop251_210_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_57_S_0)) begin
+		loops_600_loop263_252_reg[7:0] <= loops_600_loop263_252[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop263_253[63:0] = (loops_600_loop263_244_reg + loops_600_loop263_252);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_57_S_0)) begin
+		loops_600_loop263_253_reg[63:0] <= loops_600_loop263_253[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop263_254[31:0] = loops_600_loop263_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop263_254_reg[2:0] = loops_600_loop2_23_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop263_255 = loops_600_loop263_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_loop263_255_reg = loops_600_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_600_exit264_256[31:0] = loops_600_exit264_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit264_256_reg[2:0] = loops_600_loop2_23_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit264_257 = loops_600_exit264_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_exit264_257_reg = loops_600_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_600_exit165_258[31:0] = loops_600_exit165_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit165_258_reg[2:0] = loops_600_loop23_44_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit165_259 = loops_600_exit165_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_exit165_259_reg = loops_600_loop2_24_reg;
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_600_BB_59_S_1) & (loops_600_exit165_259_reg == 1'd0))) begin
+		loops_600_loop067_260_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_64_S_1) & (loops_600_exit171_280_reg == 1'd1))) begin
+		loops_600_loop067_260_reg[1:0] <= loops_600_exit171_279_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_600_BB_59_S_1) & (loops_600_exit165_259_reg == 1'd0))) begin
+		loops_600_loop067_261_reg[63:0] <= loops_600_loop263_253_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_64_S_1) & (loops_600_exit171_280_reg == 1'd1))) begin
+		loops_600_loop067_261_reg[63:0] <= loops_600_loop269_274_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_60_S_0)) begin
+		loops_600_loop168_262_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_63_S_1) & (loops_600_exit270_278_reg == 1'd1))) begin
+		loops_600_loop168_262_reg[1:0] <= loops_600_exit270_277_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_60_S_0)) begin
+		loops_600_loop168_263_reg[63:0] <= loops_600_loop067_261_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_63_S_1) & (loops_600_exit270_278_reg == 1'd1))) begin
+		loops_600_loop168_263_reg[63:0] <= loops_600_loop269_274_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_61_S_0)) begin
+		loops_600_loop269_264_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_62_S_1) & (loops_600_loop269_276_reg == 1'd1))) begin
+		loops_600_loop269_264_reg[1:0] <= loops_600_loop269_275_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_61_S_0)) begin
+		loops_600_loop269_265_reg[63:0] <= loops_600_loop168_263_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_62_S_1) & (loops_600_loop269_276_reg == 1'd1))) begin
+		loops_600_loop269_265_reg[63:0] <= loops_600_loop269_274_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop269_266[7:0] = loops_600_loop269_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop269_266_reg[7:0] = loops_600_loop23_39_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop269_267[31:0] = (loops_600_loop245_187_reg - loops_600_loop257_230_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_62_S_0)) begin
+		loops_600_loop269_267_reg[31:0] <= loops_600_loop269_267[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop269_268[15:0] = loops_600_loop269_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop269_268_reg[15:0] = loops_600_loop2_14_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop269_269[7:0] = (loops_600_loop245_185_reg ^ loops_600_loop269_266);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_62_S_0)) begin
+		loops_600_loop269_269_reg[7:0] <= loops_600_loop269_269[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop269_270[31:0] = (loops_600_loop245_187_reg - loops_600_loop269_267);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_62_S_0)) begin
+		loops_600_loop269_270_reg[31:0] <= loops_600_loop269_270[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop269_271[15:0] = (loops_600_loop263_248_reg - loops_600_loop263_250_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_62_S_0)) begin
+		loops_600_loop269_271_reg[15:0] <= loops_600_loop269_271[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop269_272[31:0] = loops_600_loop269_or_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_62_S_0)) begin
+		loops_600_loop269_272_reg[31:0] <= loops_600_loop269_272[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop269_273[31:0] = loops_600_loop269_add_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_62_S_0)) begin
+		loops_600_loop269_273_reg[31:0] <= loops_600_loop269_273[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_87_S_0)) begin
+		loops_600_loop269_273_reg[31:0] <= loops_600_loop299_372[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_107_S_0)) begin
+		loops_600_loop269_273_reg[31:0] <= loops_600_loop2123_456[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop269_274[63:0] = (loops_600_loop269_265_reg + loops_600_loop269_273);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_62_S_0)) begin
+		loops_600_loop269_274_reg[63:0] <= loops_600_loop269_274[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop269_275[31:0] = loops_600_loop269_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop269_275_reg[2:0] = loops_600_loop2_23_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop269_276 = loops_600_loop269_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_loop269_276_reg = loops_600_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_600_exit270_277[31:0] = loops_600_exit270_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit270_277_reg[2:0] = loops_600_loop23_44_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit270_278 = loops_600_exit270_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_exit270_278_reg = loops_600_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_600_exit171_279[31:0] = loops_600_exit171_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit171_279_reg[2:0] = loops_600_loop2_23_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit171_280 = loops_600_exit171_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_exit171_280_reg = loops_600_loop2_24_reg;
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_600_BB_64_S_1) & (loops_600_exit171_280_reg == 1'd0))) begin
+		loops_600_loop073_281_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_69_S_1) & (loops_600_exit177_301_reg == 1'd1))) begin
+		loops_600_loop073_281_reg[1:0] <= loops_600_exit177_300_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_600_BB_64_S_1) & (loops_600_exit171_280_reg == 1'd0))) begin
+		loops_600_loop073_282_reg[63:0] <= loops_600_loop269_274_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_69_S_1) & (loops_600_exit177_301_reg == 1'd1))) begin
+		loops_600_loop073_282_reg[63:0] <= loops_600_loop275_295_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_65_S_0)) begin
+		loops_600_loop174_283_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_68_S_1) & (loops_600_exit276_299_reg == 1'd1))) begin
+		loops_600_loop174_283_reg[1:0] <= loops_600_exit276_298_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_65_S_0)) begin
+		loops_600_loop174_284_reg[63:0] <= loops_600_loop073_282_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_68_S_1) & (loops_600_exit276_299_reg == 1'd1))) begin
+		loops_600_loop174_284_reg[63:0] <= loops_600_loop275_295_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_66_S_0)) begin
+		loops_600_loop275_285_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_67_S_1) & (loops_600_loop275_297_reg == 1'd1))) begin
+		loops_600_loop275_285_reg[1:0] <= loops_600_loop275_296_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_66_S_0)) begin
+		loops_600_loop275_286_reg[63:0] <= loops_600_loop174_284_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_67_S_1) & (loops_600_loop275_297_reg == 1'd1))) begin
+		loops_600_loop275_286_reg[63:0] <= loops_600_loop275_295_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop275_287[15:0] = (loops_600_loop269_271_reg - loops_600_loop269_268_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_67_S_0)) begin
+		loops_600_loop275_287_reg[15:0] <= loops_600_loop275_287[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop275_289[7:0] = (loops_600_loop263_252_reg - loops_600_loop251_210_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_67_S_0)) begin
+		loops_600_loop275_289_reg[7:0] <= loops_600_loop275_289[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop275_290[15:0] = loops_600_loop275_add_16_16_1[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop275_290_reg[15:0] = loops_600_loop245_184_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop275_291[15:0] = (loops_600_loop269_271_reg ^ loops_600_loop275_287);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_67_S_0)) begin
+		loops_600_loop275_291_reg[15:0] <= loops_600_loop275_291[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop275_292[15:0] = loops_600_loop275_mul_16_16_0[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop275_292_reg[15:0] = loops_600_loop215_83_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop275_293[7:0] = loops_600_loop275_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop275_293_reg[7:0] = loops_600_loop2_17_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop275_294[31:0] = (loops_600_loop257_230_reg ^ loops_600_loop245_187_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_67_S_0)) begin
+		loops_600_loop275_294_reg[31:0] <= loops_600_loop275_294[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop275_295[63:0] = (loops_600_loop275_286_reg + loops_600_loop275_294);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_67_S_0)) begin
+		loops_600_loop275_295_reg[63:0] <= loops_600_loop275_295[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop275_296[31:0] = loops_600_loop275_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop275_296_reg[2:0] = loops_600_loop23_44_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop275_297 = loops_600_loop275_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_loop275_297_reg = loops_600_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_600_exit276_298[31:0] = loops_600_exit276_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit276_298_reg[2:0] = loops_600_loop2_23_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit276_299 = loops_600_exit276_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_exit276_299_reg = loops_600_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_600_exit177_300[31:0] = loops_600_exit177_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit177_300_reg[2:0] = loops_600_loop23_44_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit177_301 = loops_600_exit177_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_exit177_301_reg = loops_600_loop2_24_reg;
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_600_BB_69_S_1) & (loops_600_exit177_301_reg == 1'd0))) begin
+		loops_600_loop079_302_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_74_S_1) & (loops_600_exit183_322_reg == 1'd1))) begin
+		loops_600_loop079_302_reg[1:0] <= loops_600_exit183_321_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_600_BB_69_S_1) & (loops_600_exit177_301_reg == 1'd0))) begin
+		loops_600_loop079_303_reg[63:0] <= loops_600_loop275_295_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_74_S_1) & (loops_600_exit183_322_reg == 1'd1))) begin
+		loops_600_loop079_303_reg[63:0] <= loops_600_loop281_316_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_70_S_0)) begin
+		loops_600_loop180_304_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_73_S_1) & (loops_600_exit282_320_reg == 1'd1))) begin
+		loops_600_loop180_304_reg[1:0] <= loops_600_exit282_319_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_70_S_0)) begin
+		loops_600_loop180_305_reg[63:0] <= loops_600_loop079_303_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_73_S_1) & (loops_600_exit282_320_reg == 1'd1))) begin
+		loops_600_loop180_305_reg[63:0] <= loops_600_loop281_316_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_71_S_0)) begin
+		loops_600_loop281_306_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_72_S_1) & (loops_600_loop281_318_reg == 1'd1))) begin
+		loops_600_loop281_306_reg[1:0] <= loops_600_loop281_317_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_71_S_0)) begin
+		loops_600_loop281_307_reg[63:0] <= loops_600_loop180_305_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_72_S_1) & (loops_600_loop281_318_reg == 1'd1))) begin
+		loops_600_loop281_307_reg[63:0] <= loops_600_loop281_316[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop281_308[7:0] = loops_600_loop281_mul_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_72_S_0)) begin
+		loops_600_loop281_308_reg[7:0] <= loops_600_loop281_308[7:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_92_S_0)) begin
+		loops_600_loop281_308_reg[7:0] <= loops_600_loop2105_397[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop281_309[7:0] = loops_600_loop281_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop281_309_reg[7:0] = loops_600_loop2_23_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop281_311[15:0] = (loops_600_loop263_250_reg ^ loops_600_loop269_271_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_72_S_0)) begin
+		loops_600_loop281_311_reg[15:0] <= loops_600_loop281_311[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop281_312[15:0] = (loops_600_loop269_268_reg - loops_600_loop263_250_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_72_S_0)) begin
+		loops_600_loop281_312_reg[15:0] <= loops_600_loop281_312[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop281_313[7:0] = loops_600_loop281_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop281_313_reg[7:0] = loops_600_loop23_44_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop281_314[7:0] = loops_600_loop281_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop281_314_reg[7:0] = loops_600_exit135_153_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop281_315[31:0] = loops_600_loop281_add_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_72_S_1)) begin
+		loops_600_loop281_315_reg[31:0] <= loops_600_loop281_315[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_87_S_1)) begin
+		loops_600_loop281_315_reg[31:0] <= loops_600_loop299_377[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop281_316[63:0] = (loops_600_loop281_307_reg + loops_600_loop281_315);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_72_S_1)) begin
+		loops_600_loop281_316_reg[63:0] <= loops_600_loop281_316[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop281_317[31:0] = loops_600_loop281_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop281_317_reg[2:0] = loops_600_loop23_44_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop281_318 = loops_600_loop281_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_loop281_318_reg = loops_600_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_600_exit282_319[31:0] = loops_600_exit282_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit282_319_reg[2:0] = loops_600_exit123_111_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit282_320 = loops_600_exit282_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_exit282_320_reg = loops_600_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_600_exit183_321[31:0] = loops_600_exit183_add_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_74_S_0)) begin
+		loops_600_exit183_321_reg[2:0] <= loops_600_exit183_321[2:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_77_S_0)) begin
+		loops_600_exit183_321_reg[2:0] <= loops_600_loop287_338[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_82_S_0)) begin
+		loops_600_exit183_321_reg[2:0] <= loops_600_loop293_359[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_84_S_0)) begin
+		loops_600_exit183_321_reg[2:0] <= loops_600_exit195_363[31:0];
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_88_S_0)) begin
+		loops_600_exit183_321_reg[2:0] <= loops_600_exit2100_382[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_exit183_322 = loops_600_exit183_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_exit183_322_reg = loops_600_loop2_24_reg;
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_600_BB_74_S_1) & (loops_600_exit183_322_reg == 1'd0))) begin
+		loops_600_loop085_323_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_79_S_1) & (loops_600_exit189_343_reg == 1'd1))) begin
+		loops_600_loop085_323_reg[1:0] <= loops_600_exit189_342_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_600_BB_74_S_1) & (loops_600_exit183_322_reg == 1'd0))) begin
+		loops_600_loop085_324_reg[63:0] <= loops_600_loop281_316_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_79_S_1) & (loops_600_exit189_343_reg == 1'd1))) begin
+		loops_600_loop085_324_reg[63:0] <= loops_600_loop287_337_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_75_S_0)) begin
+		loops_600_loop186_325_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_78_S_1) & (loops_600_exit288_341_reg == 1'd1))) begin
+		loops_600_loop186_325_reg[1:0] <= loops_600_exit288_340_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_75_S_0)) begin
+		loops_600_loop186_326_reg[63:0] <= loops_600_loop085_324_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_78_S_1) & (loops_600_exit288_341_reg == 1'd1))) begin
+		loops_600_loop186_326_reg[63:0] <= loops_600_loop287_337_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_76_S_0)) begin
+		loops_600_loop287_327_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_77_S_1) & (loops_600_loop287_339_reg == 1'd1))) begin
+		loops_600_loop287_327_reg[1:0] <= loops_600_loop287_338_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_76_S_0)) begin
+		loops_600_loop287_328_reg[63:0] <= loops_600_loop186_326_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_77_S_1) & (loops_600_loop287_339_reg == 1'd1))) begin
+		loops_600_loop287_328_reg[63:0] <= loops_600_loop287_337_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop287_329[15:0] = loops_600_loop287_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop287_329_reg[15:0] = loops_600_loop2_14_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop287_330[31:0] = loops_600_loop287_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop287_330_reg[31:0] = loops_600_loop239_161_reg[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop287_331[7:0] = (loops_600_loop275_289_reg - loops_600_loop281_308_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_77_S_0)) begin
+		loops_600_loop287_331_reg[7:0] <= loops_600_loop287_331[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop287_332[31:0] = loops_600_loop287_add_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_77_S_0)) begin
+		loops_600_loop287_332_reg[31:0] <= loops_600_loop287_332[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop287_333[31:0] = loops_600_loop287_add_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_77_S_1)) begin
+		loops_600_loop287_333_reg[31:0] <= loops_600_loop287_333[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop287_334[31:0] = loops_600_loop287_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop287_334_reg[31:0] = loops_600_loop239_162_reg[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop287_335[7:0] = loops_600_loop287_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop287_335_reg[7:0] = loops_600_loop23_42_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop287_336[7:0] = loops_600_loop287_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop287_336_reg[7:0] = loops_600_loop23_39_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop287_337[63:0] = (loops_600_loop287_328_reg + loops_600_loop287_336);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_77_S_0)) begin
+		loops_600_loop287_337_reg[63:0] <= loops_600_loop287_337[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop287_338[31:0] = loops_600_loop287_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop287_338_reg[2:0] = loops_600_exit183_321_reg[2:0];
+end
+
+always @ (*) begin
+	loops_600_loop287_339 = loops_600_loop287_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_loop287_339_reg = loops_600_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_600_exit288_340[31:0] = loops_600_exit288_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit288_340_reg[2:0] = loops_600_exit123_111_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit288_341 = loops_600_exit288_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_exit288_341_reg = loops_600_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_600_exit189_342[31:0] = loops_600_exit189_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit189_342_reg[2:0] = loops_600_exit123_111_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit189_343 = loops_600_exit189_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_exit189_343_reg = loops_600_loop2_24_reg;
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_600_BB_79_S_1) & (loops_600_exit189_343_reg == 1'd0))) begin
+		loops_600_loop091_344_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_84_S_1) & (loops_600_exit195_364_reg == 1'd1))) begin
+		loops_600_loop091_344_reg[1:0] <= loops_600_exit195_363_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_600_BB_79_S_1) & (loops_600_exit189_343_reg == 1'd0))) begin
+		loops_600_loop091_345_reg[63:0] <= loops_600_loop287_337_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_84_S_1) & (loops_600_exit195_364_reg == 1'd1))) begin
+		loops_600_loop091_345_reg[63:0] <= loops_600_loop293_358_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_80_S_0)) begin
+		loops_600_loop192_346_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_83_S_1) & (loops_600_exit294_362_reg == 1'd1))) begin
+		loops_600_loop192_346_reg[1:0] <= loops_600_exit294_361_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_80_S_0)) begin
+		loops_600_loop192_347_reg[63:0] <= loops_600_loop091_345_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_83_S_1) & (loops_600_exit294_362_reg == 1'd1))) begin
+		loops_600_loop192_347_reg[63:0] <= loops_600_loop293_358_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_81_S_0)) begin
+		loops_600_loop293_348_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_82_S_3) & (loops_600_loop293_360_reg == 1'd1))) begin
+		loops_600_loop293_348_reg[1:0] <= loops_600_loop293_359_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_81_S_0)) begin
+		loops_600_loop293_349_reg[63:0] <= loops_600_loop192_347_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_82_S_3) & (loops_600_loop293_360_reg == 1'd1))) begin
+		loops_600_loop293_349_reg[63:0] <= loops_600_loop293_358[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop293_350[15:0] = loops_600_loop293_mul_16_16_0[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop293_350_reg[15:0] = loops_600_loop251_208_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop293_351[7:0] = loops_600_loop293_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop293_351_reg[7:0] = loops_600_loop2_17_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop293_352[63:0] = (loops_600_loop293_349_reg * loops_600_loop281_307_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_82_S_0)) begin
+		loops_600_loop293_352_reg[63:0] <= loops_600_loop293_352[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop293_353[31:0] = (loops_600_loop269_273_reg ^ loops_600_loop287_330_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_82_S_0)) begin
+		loops_600_loop293_353_reg[31:0] <= loops_600_loop293_353[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop293_354[7:0] = loops_600_loop293_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop293_354_reg[7:0] = loops_600_loop2_18_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop293_355[31:0] = loops_600_loop293_add_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_82_S_0)) begin
+		loops_600_loop293_355_reg[31:0] <= loops_600_loop293_355[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop293_356[63:0] = (loops_600_loop269_265_reg | loops_600_loop293_352_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_82_S_1)) begin
+		loops_600_loop293_356_reg[63:0] <= loops_600_loop293_356[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop293_357[63:0] = (loops_600_loop293_356_reg * loops_600_loop275_291_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_82_S_2)) begin
+		loops_600_loop293_357_reg[63:0] <= loops_600_loop293_357[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop293_358[63:0] = (loops_600_loop293_349_reg + loops_600_loop293_357_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_82_S_3)) begin
+		loops_600_loop293_358_reg[63:0] <= loops_600_loop293_358[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop293_359[31:0] = loops_600_loop293_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop293_359_reg[2:0] = loops_600_exit183_321_reg[2:0];
+end
+
+always @ (*) begin
+	loops_600_loop293_360 = loops_600_loop293_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_loop293_360_reg = loops_600_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_600_exit294_361[31:0] = loops_600_exit294_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit294_361_reg[2:0] = loops_600_exit123_111_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit294_362 = loops_600_exit294_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_exit294_362_reg = loops_600_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_600_exit195_363[31:0] = loops_600_exit195_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit195_363_reg[2:0] = loops_600_exit183_321_reg[2:0];
+end
+
+always @ (*) begin
+	loops_600_exit195_364 = loops_600_exit195_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_exit195_364_reg = loops_600_loop2_24_reg;
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_600_BB_84_S_1) & (loops_600_exit195_364_reg == 1'd0))) begin
+		loops_600_loop097_365_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_89_S_1) & (loops_600_exit1101_385_reg == 1'd1))) begin
+		loops_600_loop097_365_reg[1:0] <= loops_600_exit1101_384_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_600_BB_84_S_1) & (loops_600_exit195_364_reg == 1'd0))) begin
+		loops_600_loop097_366_reg[63:0] <= loops_600_loop293_358_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_89_S_1) & (loops_600_exit1101_385_reg == 1'd1))) begin
+		loops_600_loop097_366_reg[63:0] <= loops_600_loop299_379_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_85_S_0)) begin
+		loops_600_loop198_367_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_88_S_1) & (loops_600_exit2100_383_reg == 1'd1))) begin
+		loops_600_loop198_367_reg[1:0] <= loops_600_exit2100_382_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_85_S_0)) begin
+		loops_600_loop198_368_reg[63:0] <= loops_600_loop097_366_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_88_S_1) & (loops_600_exit2100_383_reg == 1'd1))) begin
+		loops_600_loop198_368_reg[63:0] <= loops_600_loop299_379_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_86_S_0)) begin
+		loops_600_loop299_369_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_87_S_1) & (loops_600_loop299_381_reg == 1'd1))) begin
+		loops_600_loop299_369_reg[1:0] <= loops_600_loop299_380_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_86_S_0)) begin
+		loops_600_loop299_370_reg[63:0] <= loops_600_loop198_368_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_87_S_1) & (loops_600_loop299_381_reg == 1'd1))) begin
+		loops_600_loop299_370_reg[63:0] <= loops_600_loop299_379_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop299_372[31:0] = loops_600_loop299_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop299_372_reg[31:0] = loops_600_loop269_273_reg[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop299_373[63:0] = (loops_600_loop299_370_reg + loops_600_loop293_352_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_87_S_0)) begin
+		loops_600_loop299_373_reg[63:0] <= loops_600_loop299_373[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop299_374[15:0] = loops_600_loop299_add_16_16_1[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop299_374_reg[15:0] = loops_600_loop251_205_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop299_375[7:0] = loops_600_loop299_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop299_375_reg[7:0] = loops_600_loop221_100_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop299_376[63:0] = (loops_600_loop287_328_reg * loops_600_loop299_370_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_87_S_0)) begin
+		loops_600_loop299_376_reg[63:0] <= loops_600_loop299_376[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop299_377[31:0] = loops_600_loop299_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop299_377_reg[31:0] = loops_600_loop281_315_reg[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop299_378[15:0] = loops_600_loop299_and_16_16_0[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop299_378_reg[15:0] = loops_600_loop2_20_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop299_379[63:0] = (loops_600_loop299_370_reg + loops_600_loop299_378);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_87_S_0)) begin
+		loops_600_loop299_379_reg[63:0] <= loops_600_loop299_379[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop299_380[31:0] = loops_600_loop299_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop299_380_reg[2:0] = loops_600_exit123_111_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop299_381 = loops_600_loop299_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_loop299_381_reg = loops_600_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_600_exit2100_382[31:0] = loops_600_exit2100_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit2100_382_reg[2:0] = loops_600_exit183_321_reg[2:0];
+end
+
+always @ (*) begin
+	loops_600_exit2100_383 = loops_600_exit2100_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_exit2100_383_reg = loops_600_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_600_exit1101_384[31:0] = loops_600_exit1101_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit1101_384_reg[2:0] = loops_600_exit123_111_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit1101_385 = loops_600_exit1101_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_exit1101_385_reg = loops_600_loop2_24_reg;
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_600_BB_89_S_1) & (loops_600_exit1101_385_reg == 1'd0))) begin
+		loops_600_loop0103_386_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_94_S_1) & (loops_600_exit1107_406_reg == 1'd1))) begin
+		loops_600_loop0103_386_reg[1:0] <= loops_600_exit1107_405_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_600_BB_89_S_1) & (loops_600_exit1101_385_reg == 1'd0))) begin
+		loops_600_loop0103_387_reg[63:0] <= loops_600_loop299_379_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_94_S_1) & (loops_600_exit1107_406_reg == 1'd1))) begin
+		loops_600_loop0103_387_reg[63:0] <= loops_600_loop2105_400_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_90_S_0)) begin
+		loops_600_loop1104_388_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_93_S_1) & (loops_600_exit2106_404_reg == 1'd1))) begin
+		loops_600_loop1104_388_reg[1:0] <= loops_600_exit2106_403_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_90_S_0)) begin
+		loops_600_loop1104_389_reg[63:0] <= loops_600_loop0103_387_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_93_S_1) & (loops_600_exit2106_404_reg == 1'd1))) begin
+		loops_600_loop1104_389_reg[63:0] <= loops_600_loop2105_400_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_91_S_0)) begin
+		loops_600_loop2105_390_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_92_S_1) & (loops_600_loop2105_402_reg == 1'd1))) begin
+		loops_600_loop2105_390_reg[1:0] <= loops_600_loop2105_401_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_91_S_0)) begin
+		loops_600_loop2105_391_reg[63:0] <= loops_600_loop1104_389_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_92_S_1) & (loops_600_loop2105_402_reg == 1'd1))) begin
+		loops_600_loop2105_391_reg[63:0] <= loops_600_loop2105_400_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop2105_392[7:0] = loops_600_loop2105_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop2105_392_reg[7:0] = loops_600_loop23_41_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop2105_393[15:0] = loops_600_loop2105_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop2105_393_reg[15:0] = loops_600_loop233_142_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop2105_394[31:0] = (loops_600_loop299_377_reg ^ loops_600_loop287_333_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_92_S_0)) begin
+		loops_600_loop2105_394_reg[31:0] <= loops_600_loop2105_394[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop2105_395[31:0] = loops_600_loop2105_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop2105_395_reg[31:0] = loops_600_loop239_161_reg[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop2105_397[7:0] = loops_600_loop2105_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop2105_397_reg[7:0] = loops_600_loop281_308_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop2105_398[31:0] = loops_600_loop2105_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop2105_398_reg[31:0] = loops_600_loop239_162_reg[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop2105_399[63:0] = (loops_600_loop293_349_reg ^ loops_600_loop2105_391_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_92_S_0)) begin
+		loops_600_loop2105_399_reg[63:0] <= loops_600_loop2105_399[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop2105_400[63:0] = (loops_600_loop2105_391_reg + loops_600_loop2105_399);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_92_S_0)) begin
+		loops_600_loop2105_400_reg[63:0] <= loops_600_loop2105_400[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop2105_401[31:0] = loops_600_loop2105_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop2105_401_reg[2:0] = loops_600_loop2_23_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop2105_402 = loops_600_loop2105_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_loop2105_402_reg = loops_600_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_600_exit2106_403[31:0] = loops_600_exit2106_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit2106_403_reg[2:0] = loops_600_exit123_111_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit2106_404 = loops_600_exit2106_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_exit2106_404_reg = loops_600_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_600_exit1107_405[31:0] = loops_600_exit1107_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit1107_405_reg[2:0] = loops_600_loop2_23_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit1107_406 = loops_600_exit1107_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_exit1107_406_reg = loops_600_loop2_24_reg;
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_600_BB_94_S_1) & (loops_600_exit1107_406_reg == 1'd0))) begin
+		loops_600_loop0109_407_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_99_S_1) & (loops_600_exit1113_427_reg == 1'd1))) begin
+		loops_600_loop0109_407_reg[1:0] <= loops_600_exit1113_426_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_600_BB_94_S_1) & (loops_600_exit1107_406_reg == 1'd0))) begin
+		loops_600_loop0109_408_reg[63:0] <= loops_600_loop2105_400_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_99_S_1) & (loops_600_exit1113_427_reg == 1'd1))) begin
+		loops_600_loop0109_408_reg[63:0] <= loops_600_loop2111_421_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_95_S_0)) begin
+		loops_600_loop1110_409_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_98_S_1) & (loops_600_exit2112_425_reg == 1'd1))) begin
+		loops_600_loop1110_409_reg[1:0] <= loops_600_exit2112_424_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_95_S_0)) begin
+		loops_600_loop1110_410_reg[63:0] <= loops_600_loop0109_408_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_98_S_1) & (loops_600_exit2112_425_reg == 1'd1))) begin
+		loops_600_loop1110_410_reg[63:0] <= loops_600_loop2111_421_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_96_S_0)) begin
+		loops_600_loop2111_411_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_97_S_1) & (loops_600_loop2111_423_reg == 1'd1))) begin
+		loops_600_loop2111_411_reg[1:0] <= loops_600_loop2111_422_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_96_S_0)) begin
+		loops_600_loop2111_412_reg[63:0] <= loops_600_loop1110_410_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_97_S_1) & (loops_600_loop2111_423_reg == 1'd1))) begin
+		loops_600_loop2111_412_reg[63:0] <= loops_600_loop2111_421_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop2111_413[63:0] = (loops_600_loop2111_412_reg - loops_600_loop299_373_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_97_S_0)) begin
+		loops_600_loop2111_413_reg[63:0] <= loops_600_loop2111_413[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop2111_414[31:0] = (loops_600_loop2105_394_reg ^ loops_600_loop299_377_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_97_S_0)) begin
+		loops_600_loop2111_414_reg[31:0] <= loops_600_loop2111_414[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop2111_415[31:0] = (loops_600_loop2105_394_reg - loops_600_loop293_355_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_97_S_0)) begin
+		loops_600_loop2111_415_reg[31:0] <= loops_600_loop2111_415[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop2111_416[63:0] = (loops_600_loop293_357_reg | loops_600_loop2111_413);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_97_S_0)) begin
+		loops_600_loop2111_416_reg[63:0] <= loops_600_loop2111_416[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop2111_418[15:0] = (loops_600_loop299_374_reg - loops_600_loop299_378_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_97_S_0)) begin
+		loops_600_loop2111_418_reg[15:0] <= loops_600_loop2111_418[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop2111_419[7:0] = loops_600_loop2111_or_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_97_S_0)) begin
+		loops_600_loop2111_419_reg[7:0] <= loops_600_loop2111_419[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop2111_420[31:0] = loops_600_loop2111_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop2111_420_reg[31:0] = loops_600_loop29_58_reg[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop2111_421[63:0] = (loops_600_loop2111_412_reg + loops_600_loop2111_420);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_97_S_0)) begin
+		loops_600_loop2111_421_reg[63:0] <= loops_600_loop2111_421[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop2111_422[31:0] = loops_600_loop2111_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop2111_422_reg[2:0] = loops_600_loop23_44_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop2111_423 = loops_600_loop2111_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_loop2111_423_reg = loops_600_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_600_exit2112_424[31:0] = loops_600_exit2112_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit2112_424_reg[2:0] = loops_600_loop2_23_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit2112_425 = loops_600_exit2112_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_exit2112_425_reg = loops_600_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_600_exit1113_426[31:0] = loops_600_exit1113_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit1113_426_reg[2:0] = loops_600_loop23_44_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit1113_427 = loops_600_exit1113_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_exit1113_427_reg = loops_600_loop2_24_reg;
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_600_BB_99_S_1) & (loops_600_exit1113_427_reg == 1'd0))) begin
+		loops_600_loop0115_428_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_104_S_1) & (loops_600_exit1119_448_reg == 1'd1))) begin
+		loops_600_loop0115_428_reg[1:0] <= loops_600_exit1119_447_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_600_BB_99_S_1) & (loops_600_exit1113_427_reg == 1'd0))) begin
+		loops_600_loop0115_429_reg[63:0] <= loops_600_loop2111_421_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_104_S_1) & (loops_600_exit1119_448_reg == 1'd1))) begin
+		loops_600_loop0115_429_reg[63:0] <= loops_600_loop2117_442_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_100_S_0)) begin
+		loops_600_loop1116_430_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_103_S_1) & (loops_600_exit2118_446_reg == 1'd1))) begin
+		loops_600_loop1116_430_reg[1:0] <= loops_600_exit2118_445_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_100_S_0)) begin
+		loops_600_loop1116_431_reg[63:0] <= loops_600_loop0115_429_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_103_S_1) & (loops_600_exit2118_446_reg == 1'd1))) begin
+		loops_600_loop1116_431_reg[63:0] <= loops_600_loop2117_442_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_101_S_0)) begin
+		loops_600_loop2117_432_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_102_S_1) & (loops_600_loop2117_444_reg == 1'd1))) begin
+		loops_600_loop2117_432_reg[1:0] <= loops_600_loop2117_443_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_101_S_0)) begin
+		loops_600_loop2117_433_reg[63:0] <= loops_600_loop1116_431_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_102_S_1) & (loops_600_loop2117_444_reg == 1'd1))) begin
+		loops_600_loop2117_433_reg[63:0] <= loops_600_loop2117_442_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop2117_434[63:0] = (loops_600_loop2105_399_reg + loops_600_loop287_336_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_102_S_0)) begin
+		loops_600_loop2117_434_reg[63:0] <= loops_600_loop2117_434[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop2117_435[63:0] = (loops_600_loop299_376_reg ^ loops_600_loop299_376_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_102_S_0)) begin
+		loops_600_loop2117_435_reg[63:0] <= loops_600_loop2117_435[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop2117_438[63:0] = (loops_600_loop2117_433_reg + loops_600_loop299_374_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_102_S_0)) begin
+		loops_600_loop2117_438_reg[63:0] <= loops_600_loop2117_438[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop2117_439[15:0] = loops_600_loop2117_or_16_16_0[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop2117_439_reg[15:0] = loops_600_loop245_189_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop2117_440[63:0] = (loops_600_loop2117_438 + loops_600_loop2117_434);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_102_S_0)) begin
+		loops_600_loop2117_440_reg[63:0] <= loops_600_loop2117_440[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop2117_441[15:0] = (loops_600_loop2117_439 ^ loops_600_loop2117_439);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_102_S_0)) begin
+		loops_600_loop2117_441_reg[15:0] <= loops_600_loop2117_441[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop2117_442[63:0] = (loops_600_loop2117_433_reg + loops_600_loop2117_441);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_102_S_0)) begin
+		loops_600_loop2117_442_reg[63:0] <= loops_600_loop2117_442[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop2117_443[31:0] = loops_600_loop2117_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop2117_443_reg[2:0] = loops_600_loop2_23_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop2117_444 = loops_600_loop2117_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_loop2117_444_reg = loops_600_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_600_exit2118_445[31:0] = loops_600_exit2118_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit2118_445_reg[2:0] = loops_600_loop23_42_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit2118_446 = loops_600_exit2118_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_exit2118_446_reg = loops_600_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_600_exit1119_447[31:0] = loops_600_exit1119_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit1119_447_reg[2:0] = loops_600_loop2_23_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit1119_448 = loops_600_exit1119_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_exit1119_448_reg = loops_600_loop2_24_reg;
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_600_BB_104_S_1) & (loops_600_exit1119_448_reg == 1'd0))) begin
+		loops_600_loop0121_449_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_109_S_1) & (loops_600_exit1125_469_reg == 1'd1))) begin
+		loops_600_loop0121_449_reg[1:0] <= loops_600_exit1125_468_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_600_BB_104_S_1) & (loops_600_exit1119_448_reg == 1'd0))) begin
+		loops_600_loop0121_450_reg[63:0] <= loops_600_loop2117_442_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_109_S_1) & (loops_600_exit1125_469_reg == 1'd1))) begin
+		loops_600_loop0121_450_reg[63:0] <= loops_600_loop2123_463_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_105_S_0)) begin
+		loops_600_loop1122_451_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_108_S_1) & (loops_600_exit2124_467_reg == 1'd1))) begin
+		loops_600_loop1122_451_reg[1:0] <= loops_600_exit2124_466_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_105_S_0)) begin
+		loops_600_loop1122_452_reg[63:0] <= loops_600_loop0121_450_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_108_S_1) & (loops_600_exit2124_467_reg == 1'd1))) begin
+		loops_600_loop1122_452_reg[63:0] <= loops_600_loop2123_463_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_106_S_0)) begin
+		loops_600_loop2123_453_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_107_S_1) & (loops_600_loop2123_465_reg == 1'd1))) begin
+		loops_600_loop2123_453_reg[1:0] <= loops_600_loop2123_464_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_106_S_0)) begin
+		loops_600_loop2123_454_reg[63:0] <= loops_600_loop1122_452_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_107_S_1) & (loops_600_loop2123_465_reg == 1'd1))) begin
+		loops_600_loop2123_454_reg[63:0] <= loops_600_loop2123_463_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop2123_455[63:0] = (loops_600_loop2117_435_reg * loops_600_loop2111_416_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_107_S_0)) begin
+		loops_600_loop2123_455_reg[63:0] <= loops_600_loop2123_455[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop2123_456[31:0] = loops_600_loop2123_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop2123_456_reg[31:0] = loops_600_loop269_273_reg[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop2123_458[7:0] = (loops_600_loop2105_397_reg - loops_600_loop287_336_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_107_S_0)) begin
+		loops_600_loop2123_458_reg[7:0] <= loops_600_loop2123_458[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop2123_459[7:0] = loops_600_loop2123_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop2123_459_reg[7:0] = loops_600_loop23_42_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop2123_460[15:0] = loops_600_loop2123_or_16_16_0[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop2123_460_reg[15:0] = loops_600_loop245_189_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop2123_462[63:0] = (loops_600_loop2117_435_reg + loops_600_loop2117_438_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_107_S_0)) begin
+		loops_600_loop2123_462_reg[63:0] <= loops_600_loop2123_462[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop2123_463[63:0] = (loops_600_loop2123_454_reg + loops_600_loop2123_462);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_107_S_0)) begin
+		loops_600_loop2123_463_reg[63:0] <= loops_600_loop2123_463[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop2123_464[31:0] = loops_600_loop2123_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop2123_464_reg[2:0] = loops_600_loop2_23_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop2123_465 = loops_600_loop2123_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_loop2123_465_reg = loops_600_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_600_exit2124_466[31:0] = loops_600_exit2124_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit2124_466_reg[2:0] = loops_600_loop2_23_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit2124_467 = loops_600_exit2124_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_exit2124_467_reg = loops_600_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_600_exit1125_468[31:0] = loops_600_exit1125_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit1125_468_reg[2:0] = loops_600_loop23_44_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit1125_469 = loops_600_exit1125_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_exit1125_469_reg = loops_600_loop2_24_reg;
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_600_BB_109_S_1) & (loops_600_exit1125_469_reg == 1'd0))) begin
+		loops_600_loop0127_470_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_114_S_1) & (loops_600_exit1131_490_reg == 1'd1))) begin
+		loops_600_loop0127_470_reg[1:0] <= loops_600_exit1131_489_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_600_BB_109_S_1) & (loops_600_exit1125_469_reg == 1'd0))) begin
+		loops_600_loop0127_471_reg[63:0] <= loops_600_loop2123_463_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_114_S_1) & (loops_600_exit1131_490_reg == 1'd1))) begin
+		loops_600_loop0127_471_reg[63:0] <= loops_600_loop2129_484_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_110_S_0)) begin
+		loops_600_loop1128_472_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_113_S_1) & (loops_600_exit2130_488_reg == 1'd1))) begin
+		loops_600_loop1128_472_reg[1:0] <= loops_600_exit2130_487_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_110_S_0)) begin
+		loops_600_loop1128_473_reg[63:0] <= loops_600_loop0127_471_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_113_S_1) & (loops_600_exit2130_488_reg == 1'd1))) begin
+		loops_600_loop1128_473_reg[63:0] <= loops_600_loop2129_484_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_111_S_0)) begin
+		loops_600_loop2129_474_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_112_S_1) & (loops_600_loop2129_486_reg == 1'd1))) begin
+		loops_600_loop2129_474_reg[1:0] <= loops_600_loop2129_485_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_111_S_0)) begin
+		loops_600_loop2129_475_reg[63:0] <= loops_600_loop1128_473_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_112_S_1) & (loops_600_loop2129_486_reg == 1'd1))) begin
+		loops_600_loop2129_475_reg[63:0] <= loops_600_loop2129_484_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop2129_479[31:0] = loops_600_loop2129_or_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop2129_479_reg[31:0] = loops_600_loop2_15_reg[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop2129_480[7:0] = loops_600_loop2129_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop2129_480_reg[7:0] = loops_600_loop23_39_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop2129_481[15:0] = (loops_600_loop299_378_reg ^ loops_600_loop299_374_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_112_S_0)) begin
+		loops_600_loop2129_481_reg[15:0] <= loops_600_loop2129_481[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop2129_482[31:0] = (loops_600_loop2111_414_reg - loops_600_loop2111_415_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_112_S_0)) begin
+		loops_600_loop2129_482_reg[31:0] <= loops_600_loop2129_482[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop2129_483[15:0] = (loops_600_loop299_378_reg - loops_600_loop2105_393_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_112_S_0)) begin
+		loops_600_loop2129_483_reg[15:0] <= loops_600_loop2129_483[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop2129_484[63:0] = (loops_600_loop2129_475_reg + loops_600_loop2129_483);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_112_S_0)) begin
+		loops_600_loop2129_484_reg[63:0] <= loops_600_loop2129_484[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop2129_485[31:0] = loops_600_loop2129_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop2129_485_reg[2:0] = loops_600_loop2_23_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop2129_486 = loops_600_loop2129_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_loop2129_486_reg = loops_600_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_600_exit2130_487[31:0] = loops_600_exit2130_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit2130_487_reg[2:0] = loops_600_loop23_44_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit2130_488 = loops_600_exit2130_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_exit2130_488_reg = loops_600_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_600_exit1131_489[31:0] = loops_600_exit1131_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit1131_489_reg[2:0] = loops_600_loop2_23_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit1131_490 = loops_600_exit1131_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_exit1131_490_reg = loops_600_loop2_24_reg;
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_600_BB_114_S_1) & (loops_600_exit1131_490_reg == 1'd0))) begin
+		loops_600_loop0133_491_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_119_S_1) & (loops_600_exit1137_511_reg == 1'd1))) begin
+		loops_600_loop0133_491_reg[1:0] <= loops_600_exit1137_510_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if (((cur_state == BPHLS_F_loops_600_BB_114_S_1) & (loops_600_exit1131_490_reg == 1'd0))) begin
+		loops_600_loop0133_492_reg[63:0] <= loops_600_loop2129_484_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_119_S_1) & (loops_600_exit1137_511_reg == 1'd1))) begin
+		loops_600_loop0133_492_reg[63:0] <= loops_600_loop2135_505_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_115_S_0)) begin
+		loops_600_loop1134_493_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_118_S_1) & (loops_600_exit2136_509_reg == 1'd1))) begin
+		loops_600_loop1134_493_reg[1:0] <= loops_600_exit2136_508_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_115_S_0)) begin
+		loops_600_loop1134_494_reg[63:0] <= loops_600_loop0133_492_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_118_S_1) & (loops_600_exit2136_509_reg == 1'd1))) begin
+		loops_600_loop1134_494_reg[63:0] <= loops_600_loop2135_505_reg[63:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_116_S_0)) begin
+		loops_600_loop2135_495_reg[1:0] <= 32'd0;
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_117_S_1) & (loops_600_loop2135_507_reg == 1'd1))) begin
+		loops_600_loop2135_495_reg[1:0] <= loops_600_loop2135_506_reg[2:0];
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_116_S_0)) begin
+		loops_600_loop2135_496_reg[63:0] <= loops_600_loop1134_494_reg[63:0];
+	end
+	if (((cur_state == BPHLS_F_loops_600_BB_117_S_1) & (loops_600_loop2135_507_reg == 1'd1))) begin
+		loops_600_loop2135_496_reg[63:0] <= loops_600_loop2135_505_reg[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop2135_498[15:0] = (loops_600_loop2123_460_reg - loops_600_loop2129_481_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_117_S_0)) begin
+		loops_600_loop2135_498_reg[15:0] <= loops_600_loop2135_498[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop2135_504[15:0] = loops_600_loop2135_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop2135_504_reg[15:0] = loops_600_loop2_14_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop2135_505[63:0] = (loops_600_loop2135_496_reg + loops_600_loop2135_504);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_117_S_0)) begin
+		loops_600_loop2135_505_reg[63:0] <= loops_600_loop2135_505[63:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop2135_506[31:0] = loops_600_loop2135_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop2135_506_reg[2:0] = loops_600_loop23_44_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop2135_507 = loops_600_loop2135_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_loop2135_507_reg = loops_600_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_600_exit2136_508[31:0] = loops_600_exit2136_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit2136_508_reg[2:0] = loops_600_loop2_23_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit2136_509 = loops_600_exit2136_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_exit2136_509_reg = loops_600_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_600_exit1137_510[31:0] = loops_600_exit1137_add_8_8_1[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit1137_510_reg[2:0] = loops_600_loop23_44_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_exit1137_511 = loops_600_exit1137_icmp_8_0;
+end
+
+always @ (*) begin
+	loops_600_exit1137_511_reg = loops_600_loop2_24_reg;
+end
+
+always @ (*) begin
+	loops_600_loop2_and_16_16_0_op0[15:0] = loops_600_loop2_14[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop2_and_16_16_0_op1[15:0] = loops_600_loop2_14[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop2_and_16_16_0[15:0] = (loops_600_loop2_and_16_16_0_op0 & loops_600_loop2_and_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop2_icmp_8_0_op0[2:0] = loops_600_loop2_23[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop2_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_loop2_icmp_8_0 = (loops_600_loop2_icmp_8_0_op0 < loops_600_loop2_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop2_mul_8_8_0_op0[7:0] = arg_1[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop2_mul_8_8_0_op1[7:0] = arg_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop2_mul_8_8_0[7:0] = (loops_600_loop2_mul_8_8_0_op0 * loops_600_loop2_mul_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop2_add_8_8_0_op0[7:0] = loops_600_loop2_12_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_loop2_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_loop2_add_8_8_0[7:0] = (loops_600_loop2_add_8_8_0_op0 + loops_600_loop2_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop2_and_8_8_0_op0[7:0] = loops_600_loop2_17[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop2_and_8_8_0_op1[7:0] = loops_600_loop2_17[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop2_and_8_8_0[7:0] = (loops_600_loop2_and_8_8_0_op0 & loops_600_loop2_and_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop2_or_32_32_0_op0[31:0] = arg_4[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop2_or_32_32_0_op1[31:0] = arg_1[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop2_or_32_32_0[31:0] = (loops_600_loop2_or_32_32_0_op0 | loops_600_loop2_or_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop2_add_16_16_0_op0[15:0] = arg_2[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop2_add_16_16_0_op1[15:0] = arg_2[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop2_add_16_16_0[15:0] = (loops_600_loop2_add_16_16_0_op0 + loops_600_loop2_add_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit2_icmp_8_0_op0[2:0] = loops_600_exit2_25[31:0];
+end
+
+always @ (*) begin
+	loops_600_exit2_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_exit2_icmp_8_0 = (loops_600_exit2_icmp_8_0_op0 < loops_600_exit2_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit2_add_8_8_0_op0[7:0] = loops_600_loop1_10_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_exit2_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_exit2_add_8_8_0[7:0] = (loops_600_exit2_add_8_8_0_op0 + loops_600_exit2_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit1_icmp_8_0_op0[2:0] = loops_600_exit1_27[31:0];
+end
+
+always @ (*) begin
+	loops_600_exit1_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_exit1_icmp_8_0 = (loops_600_exit1_icmp_8_0_op0 < loops_600_exit1_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit1_add_8_8_0_op0[7:0] = loops_600_loop0_8_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_exit1_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_exit1_add_8_8_0[7:0] = (loops_600_exit1_add_8_8_0_op0 + loops_600_exit1_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_7_S_0)) begin
+		loops_600_loop23_or_8_8_0_op0[7:0] = loops_600_loop2_18_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_600_BB_7_S_1)) */ begin
+		loops_600_loop23_or_8_8_0_op0[7:0] = loops_600_loop2_17_reg[7:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_7_S_0)) begin
+		loops_600_loop23_or_8_8_0_op1[7:0] = arg_1[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_600_BB_7_S_1)) */ begin
+		loops_600_loop23_or_8_8_0_op1[7:0] = arg_1[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop23_or_8_8_0[7:0] = (loops_600_loop23_or_8_8_0_op0 | loops_600_loop23_or_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop23_add_8_8_0_op0[7:0] = arg_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop23_add_8_8_0_op1[7:0] = arg_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop23_add_8_8_0[7:0] = (loops_600_loop23_add_8_8_0_op0 + loops_600_loop23_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_7_S_0)) begin
+		loops_600_loop23_add_8_8_1_op0[7:0] = loops_600_loop2_18_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_600_BB_7_S_1)) */ begin
+		loops_600_loop23_add_8_8_1_op0[7:0] = loops_600_loop23_33_reg[1:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_7_S_0)) begin
+		loops_600_loop23_add_8_8_1_op1[7:0] = loops_600_loop2_18_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_600_BB_7_S_1)) */ begin
+		loops_600_loop23_add_8_8_1_op1[7:0] = 32'd1;
+	end
+end
+
+always @ (*) begin
+	loops_600_loop23_add_8_8_1[7:0] = (loops_600_loop23_add_8_8_1_op0 + loops_600_loop23_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_600_loop23_add_16_16_0_op0[15:0] = arg_3[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop23_add_16_16_0_op1[15:0] = arg_2[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop23_add_16_16_0[15:0] = (loops_600_loop23_add_16_16_0_op0 + loops_600_loop23_add_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop23_icmp_8_0_op0[2:0] = loops_600_loop23_44[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop23_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_loop23_icmp_8_0 = (loops_600_loop23_icmp_8_0_op0 < loops_600_loop23_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit24_icmp_8_0_op0[2:0] = loops_600_exit24_46[31:0];
+end
+
+always @ (*) begin
+	loops_600_exit24_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_exit24_icmp_8_0 = (loops_600_exit24_icmp_8_0_op0 < loops_600_exit24_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit24_add_8_8_1_op0[7:0] = loops_600_loop12_31_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_exit24_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_exit24_add_8_8_1[7:0] = (loops_600_exit24_add_8_8_1_op0 + loops_600_exit24_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_600_exit15_icmp_8_0_op0[2:0] = loops_600_exit15_48[31:0];
+end
+
+always @ (*) begin
+	loops_600_exit15_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_exit15_icmp_8_0 = (loops_600_exit15_icmp_8_0_op0 < loops_600_exit15_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit15_add_8_8_0_op0[7:0] = loops_600_loop01_29_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_exit15_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_exit15_add_8_8_0[7:0] = (loops_600_exit15_add_8_8_0_op0 + loops_600_exit15_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop29_and_16_16_0_op0[15:0] = arg_3[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop29_and_16_16_0_op1[15:0] = loops_600_loop23_38_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop29_and_16_16_0[15:0] = (loops_600_loop29_and_16_16_0_op0 & loops_600_loop29_and_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop29_icmp_8_0_op0[2:0] = loops_600_loop29_65[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop29_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_loop29_icmp_8_0 = (loops_600_loop29_icmp_8_0_op0 < loops_600_loop29_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop29_add_8_8_1_op0[7:0] = loops_600_loop29_54_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_loop29_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_loop29_add_8_8_1[7:0] = (loops_600_loop29_add_8_8_1_op0 + loops_600_loop29_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_12_S_0)) begin
+		loops_600_loop29_and_32_32_0_op0[31:0] = loops_600_loop29_57[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_600_BB_12_S_1)) */ begin
+		loops_600_loop29_and_32_32_0_op0[31:0] = loops_600_loop29_57_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_12_S_0)) begin
+		loops_600_loop29_and_32_32_0_op1[31:0] = arg_4[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_600_BB_12_S_1)) */ begin
+		loops_600_loop29_and_32_32_0_op1[31:0] = loops_600_loop2_15_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop29_and_32_32_0[31:0] = (loops_600_loop29_and_32_32_0_op0 & loops_600_loop29_and_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit210_icmp_8_0_op0[2:0] = loops_600_exit210_67[31:0];
+end
+
+always @ (*) begin
+	loops_600_exit210_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_exit210_icmp_8_0 = (loops_600_exit210_icmp_8_0_op0 < loops_600_exit210_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit210_add_8_8_0_op0[7:0] = loops_600_loop18_52_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_exit210_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_exit210_add_8_8_0[7:0] = (loops_600_exit210_add_8_8_0_op0 + loops_600_exit210_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit111_icmp_8_0_op0[2:0] = loops_600_exit111_69[31:0];
+end
+
+always @ (*) begin
+	loops_600_exit111_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_exit111_icmp_8_0 = (loops_600_exit111_icmp_8_0_op0 < loops_600_exit111_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit111_add_8_8_1_op0[7:0] = loops_600_loop07_50_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_exit111_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_exit111_add_8_8_1[7:0] = (loops_600_exit111_add_8_8_1_op0 + loops_600_exit111_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_600_loop215_icmp_8_0_op0[2:0] = loops_600_loop215_86[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop215_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_loop215_icmp_8_0 = (loops_600_loop215_icmp_8_0_op0 < loops_600_loop215_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop215_mul_8_8_0_op0[7:0] = arg_1[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop215_mul_8_8_0_op1[7:0] = loops_600_loop23_39_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop215_mul_8_8_0[7:0] = (loops_600_loop215_mul_8_8_0_op0 * loops_600_loop215_mul_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop215_add_8_8_0_op0[7:0] = loops_600_loop215_75_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_loop215_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_loop215_add_8_8_0[7:0] = (loops_600_loop215_add_8_8_0_op0 + loops_600_loop215_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop215_add_16_16_0_op0[15:0] = arg_2[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop215_add_16_16_0_op1[15:0] = loops_600_loop2_20_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop215_add_16_16_0[15:0] = (loops_600_loop215_add_16_16_0_op0 + loops_600_loop215_add_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop215_mul_16_16_0_op0[15:0] = loops_600_loop215_80[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop215_mul_16_16_0_op1[15:0] = loops_600_loop215_82[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop215_mul_16_16_0[15:0] = (loops_600_loop215_mul_16_16_0_op0 * loops_600_loop215_mul_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit216_icmp_8_0_op0[2:0] = loops_600_exit216_88[31:0];
+end
+
+always @ (*) begin
+	loops_600_exit216_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_exit216_icmp_8_0 = (loops_600_exit216_icmp_8_0_op0 < loops_600_exit216_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit216_add_8_8_1_op0[7:0] = loops_600_loop114_73_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_exit216_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_exit216_add_8_8_1[7:0] = (loops_600_exit216_add_8_8_1_op0 + loops_600_exit216_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_600_exit117_icmp_8_0_op0[2:0] = loops_600_exit117_90[31:0];
+end
+
+always @ (*) begin
+	loops_600_exit117_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_exit117_icmp_8_0 = (loops_600_exit117_icmp_8_0_op0 < loops_600_exit117_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit117_add_8_8_0_op0[7:0] = loops_600_loop013_71_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_exit117_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_exit117_add_8_8_0[7:0] = (loops_600_exit117_add_8_8_0_op0 + loops_600_exit117_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop221_icmp_8_0_op0[2:0] = loops_600_loop221_107[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop221_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_loop221_icmp_8_0 = (loops_600_loop221_icmp_8_0_op0 < loops_600_loop221_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop221_add_8_8_1_op0[7:0] = loops_600_loop215_82_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop221_add_8_8_1_op1[7:0] = loops_600_loop221_100[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop221_add_8_8_1[7:0] = (loops_600_loop221_add_8_8_1_op0 + loops_600_loop221_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_600_loop221_add_8_8_0_op0[7:0] = loops_600_loop221_96_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_loop221_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_loop221_add_8_8_0[7:0] = (loops_600_loop221_add_8_8_0_op0 + loops_600_loop221_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_22_S_0)) begin
+		loops_600_loop221_and_8_8_0_op0[7:0] = loops_600_loop2_18_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_600_BB_22_S_1)) */ begin
+		loops_600_loop221_and_8_8_0_op0[7:0] = loops_600_loop23_42_reg[7:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_22_S_0)) begin
+		loops_600_loop221_and_8_8_0_op1[7:0] = loops_600_loop2_18_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_600_BB_22_S_1)) */ begin
+		loops_600_loop221_and_8_8_0_op1[7:0] = loops_600_loop2_21_reg[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop221_and_8_8_0[7:0] = (loops_600_loop221_and_8_8_0_op0 & loops_600_loop221_and_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit222_icmp_8_0_op0[2:0] = loops_600_exit222_109[31:0];
+end
+
+always @ (*) begin
+	loops_600_exit222_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_exit222_icmp_8_0 = (loops_600_exit222_icmp_8_0_op0 < loops_600_exit222_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit222_add_8_8_0_op0[7:0] = loops_600_loop120_94_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_exit222_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_exit222_add_8_8_0[7:0] = (loops_600_exit222_add_8_8_0_op0 + loops_600_exit222_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit123_icmp_8_0_op0[2:0] = loops_600_exit123_111[31:0];
+end
+
+always @ (*) begin
+	loops_600_exit123_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_exit123_icmp_8_0 = (loops_600_exit123_icmp_8_0_op0 < loops_600_exit123_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit123_add_8_8_1_op0[7:0] = loops_600_loop019_92_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_exit123_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_exit123_add_8_8_1[7:0] = (loops_600_exit123_add_8_8_1_op0 + loops_600_exit123_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_600_loop227_and_16_16_0_op0[15:0] = loops_600_loop23_38_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop227_and_16_16_0_op1[15:0] = loops_600_loop215_80_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop227_and_16_16_0[15:0] = (loops_600_loop227_and_16_16_0_op0 & loops_600_loop227_and_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop227_icmp_8_0_op0[2:0] = loops_600_loop227_128[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop227_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_loop227_icmp_8_0 = (loops_600_loop227_icmp_8_0_op0 < loops_600_loop227_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop227_or_8_8_0_op0[7:0] = loops_600_loop23_39_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop227_or_8_8_0_op1[7:0] = loops_600_loop221_102_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop227_or_8_8_0[7:0] = (loops_600_loop227_or_8_8_0_op0 | loops_600_loop227_or_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop227_add_8_8_0_op0[7:0] = loops_600_loop227_117_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_loop227_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_loop227_add_8_8_0[7:0] = (loops_600_loop227_add_8_8_0_op0 + loops_600_loop227_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop227_or_32_32_0_op0[31:0] = loops_600_loop221_101_reg[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop227_or_32_32_0_op1[31:0] = loops_600_loop29_59_reg[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop227_or_32_32_0[31:0] = (loops_600_loop227_or_32_32_0_op0 | loops_600_loop227_or_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit228_icmp_8_0_op0[2:0] = loops_600_exit228_130[31:0];
+end
+
+always @ (*) begin
+	loops_600_exit228_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_exit228_icmp_8_0 = (loops_600_exit228_icmp_8_0_op0 < loops_600_exit228_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit228_add_8_8_1_op0[7:0] = loops_600_loop126_115_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_exit228_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_exit228_add_8_8_1[7:0] = (loops_600_exit228_add_8_8_1_op0 + loops_600_exit228_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_600_exit129_icmp_8_0_op0[2:0] = loops_600_exit129_132[31:0];
+end
+
+always @ (*) begin
+	loops_600_exit129_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_exit129_icmp_8_0 = (loops_600_exit129_icmp_8_0_op0 < loops_600_exit129_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit129_add_8_8_0_op0[7:0] = loops_600_loop025_113_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_exit129_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_exit129_add_8_8_0[7:0] = (loops_600_exit129_add_8_8_0_op0 + loops_600_exit129_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop233_add_8_8_0_op0[7:0] = loops_600_loop23_42_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop233_add_8_8_0_op1[7:0] = loops_600_loop221_102_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop233_add_8_8_0[7:0] = (loops_600_loop233_add_8_8_0_op0 + loops_600_loop233_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_32_S_0)) begin
+		loops_600_loop233_add_8_8_1_op0[7:0] = loops_600_loop221_104_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_600_BB_32_S_1)) */ begin
+		loops_600_loop233_add_8_8_1_op0[7:0] = loops_600_loop233_138_reg[1:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_32_S_0)) begin
+		loops_600_loop233_add_8_8_1_op1[7:0] = loops_600_loop221_100_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_600_BB_32_S_1)) */ begin
+		loops_600_loop233_add_8_8_1_op1[7:0] = 32'd1;
+	end
+end
+
+always @ (*) begin
+	loops_600_loop233_add_8_8_1[7:0] = (loops_600_loop233_add_8_8_1_op0 + loops_600_loop233_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_600_loop233_and_32_32_0_op0[31:0] = loops_600_loop29_59_reg[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop233_and_32_32_0_op1[31:0] = loops_600_loop29_63_reg[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop233_and_32_32_0[31:0] = (loops_600_loop233_and_32_32_0_op0 & loops_600_loop233_and_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop233_and_8_8_0_op0[7:0] = loops_600_loop233_140[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop233_and_8_8_0_op1[7:0] = loops_600_loop215_77_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop233_and_8_8_0[7:0] = (loops_600_loop233_and_8_8_0_op0 & loops_600_loop233_and_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop233_add_16_16_0_op0[15:0] = loops_600_loop215_80_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop233_add_16_16_0_op1[15:0] = loops_600_loop23_38_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop233_add_16_16_0[15:0] = (loops_600_loop233_add_16_16_0_op0 + loops_600_loop233_add_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop233_icmp_8_0_op0[2:0] = loops_600_loop233_149[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop233_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_loop233_icmp_8_0 = (loops_600_loop233_icmp_8_0_op0 < loops_600_loop233_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit234_icmp_8_0_op0[2:0] = loops_600_exit234_151[31:0];
+end
+
+always @ (*) begin
+	loops_600_exit234_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_exit234_icmp_8_0 = (loops_600_exit234_icmp_8_0_op0 < loops_600_exit234_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit234_add_8_8_1_op0[7:0] = loops_600_loop132_136_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_exit234_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_exit234_add_8_8_1[7:0] = (loops_600_exit234_add_8_8_1_op0 + loops_600_exit234_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_600_exit135_icmp_8_0_op0[2:0] = loops_600_exit135_153[31:0];
+end
+
+always @ (*) begin
+	loops_600_exit135_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_exit135_icmp_8_0 = (loops_600_exit135_icmp_8_0_op0 < loops_600_exit135_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit135_add_8_8_0_op0[7:0] = loops_600_loop031_134_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_exit135_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_exit135_add_8_8_0[7:0] = (loops_600_exit135_add_8_8_0_op0 + loops_600_exit135_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop239_icmp_8_0_op0[2:0] = loops_600_loop239_170[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop239_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_loop239_icmp_8_0 = (loops_600_loop239_icmp_8_0_op0 < loops_600_loop239_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop239_mul_8_8_0_op0[7:0] = loops_600_loop215_82_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop239_mul_8_8_0_op1[7:0] = loops_600_loop215_82_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop239_mul_8_8_0[7:0] = (loops_600_loop239_mul_8_8_0_op0 * loops_600_loop239_mul_8_8_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_37_S_0)) begin
+		loops_600_loop239_mul_32_32_0_op0[31:0] = loops_600_loop233_147_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_loops_600_BB_37_S_1)) begin
+		loops_600_loop239_mul_32_32_0_op0[31:0] = loops_600_loop233_145_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_600_BB_37_S_2)) */ begin
+		loops_600_loop239_mul_32_32_0_op0[31:0] = loops_600_loop227_125_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_37_S_0)) begin
+		loops_600_loop239_mul_32_32_0_op1[31:0] = loops_600_loop233_145_reg[31:0];
+	end
+	else if ((cur_state == BPHLS_F_loops_600_BB_37_S_1)) begin
+		loops_600_loop239_mul_32_32_0_op1[31:0] = loops_600_loop233_147_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_600_BB_37_S_2)) */ begin
+		loops_600_loop239_mul_32_32_0_op1[31:0] = loops_600_loop227_125_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop239_mul_32_32_0[31:0] = (loops_600_loop239_mul_32_32_0_op0 * loops_600_loop239_mul_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop239_add_8_8_1_op0[7:0] = loops_600_loop239_159_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_loop239_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_loop239_add_8_8_1[7:0] = (loops_600_loop239_add_8_8_1_op0 + loops_600_loop239_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_600_loop239_and_32_32_0_op0[31:0] = loops_600_loop227_125_reg[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop239_and_32_32_0_op1[31:0] = loops_600_loop227_121_reg[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop239_and_32_32_0[31:0] = (loops_600_loop239_and_32_32_0_op0 & loops_600_loop239_and_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit240_icmp_8_0_op0[2:0] = loops_600_exit240_172[31:0];
+end
+
+always @ (*) begin
+	loops_600_exit240_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_exit240_icmp_8_0 = (loops_600_exit240_icmp_8_0_op0 < loops_600_exit240_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit240_add_8_8_0_op0[7:0] = loops_600_loop138_157_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_exit240_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_exit240_add_8_8_0[7:0] = (loops_600_exit240_add_8_8_0_op0 + loops_600_exit240_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit141_icmp_8_0_op0[2:0] = loops_600_exit141_174[31:0];
+end
+
+always @ (*) begin
+	loops_600_exit141_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_exit141_icmp_8_0 = (loops_600_exit141_icmp_8_0_op0 < loops_600_exit141_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit141_add_8_8_1_op0[7:0] = loops_600_loop037_155_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_exit141_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_exit141_add_8_8_1[7:0] = (loops_600_exit141_add_8_8_1_op0 + loops_600_exit141_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_600_loop245_icmp_8_0_op0[2:0] = loops_600_loop245_191[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop245_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_loop245_icmp_8_0 = (loops_600_loop245_icmp_8_0_op0 < loops_600_loop245_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop245_or_16_16_0_op0[15:0] = loops_600_loop245_182[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop245_or_16_16_0_op1[15:0] = loops_600_loop227_119_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop245_or_16_16_0[15:0] = (loops_600_loop245_or_16_16_0_op0 | loops_600_loop245_or_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop245_add_8_8_0_op0[7:0] = loops_600_loop245_180_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_loop245_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_loop245_add_8_8_0[7:0] = (loops_600_loop245_add_8_8_0_op0 + loops_600_loop245_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop245_and_32_32_0_op0[31:0] = loops_600_loop233_147_reg[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop245_and_32_32_0_op1[31:0] = loops_600_loop233_145_reg[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop245_and_32_32_0[31:0] = (loops_600_loop245_and_32_32_0_op0 & loops_600_loop245_and_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop245_and_8_8_0_op0[7:0] = loops_600_loop233_140_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop245_and_8_8_0_op1[7:0] = loops_600_loop233_143_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop245_and_8_8_0[7:0] = (loops_600_loop245_and_8_8_0_op0 & loops_600_loop245_and_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop245_add_16_16_0_op0[15:0] = loops_600_loop233_142_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop245_add_16_16_0_op1[15:0] = loops_600_loop23_38_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop245_add_16_16_0[15:0] = (loops_600_loop245_add_16_16_0_op0 + loops_600_loop245_add_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop245_add_16_16_1_op0[15:0] = loops_600_loop227_119_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop245_add_16_16_1_op1[15:0] = loops_600_loop215_80_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop245_add_16_16_1[15:0] = (loops_600_loop245_add_16_16_1_op0 + loops_600_loop245_add_16_16_1_op1);
+end
+
+always @ (*) begin
+	loops_600_loop245_mul_16_16_0_op0[15:0] = loops_600_loop245_182[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop245_mul_16_16_0_op1[15:0] = loops_600_loop245_183[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop245_mul_16_16_0[15:0] = (loops_600_loop245_mul_16_16_0_op0 * loops_600_loop245_mul_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit246_icmp_8_0_op0[2:0] = loops_600_exit246_193[31:0];
+end
+
+always @ (*) begin
+	loops_600_exit246_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_exit246_icmp_8_0 = (loops_600_exit246_icmp_8_0_op0 < loops_600_exit246_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit246_add_8_8_1_op0[7:0] = loops_600_loop144_178_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_exit246_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_exit246_add_8_8_1[7:0] = (loops_600_exit246_add_8_8_1_op0 + loops_600_exit246_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_600_exit147_icmp_8_0_op0[2:0] = loops_600_exit147_195[31:0];
+end
+
+always @ (*) begin
+	loops_600_exit147_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_exit147_icmp_8_0 = (loops_600_exit147_icmp_8_0_op0 < loops_600_exit147_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit147_add_8_8_0_op0[7:0] = loops_600_loop043_176_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_exit147_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_exit147_add_8_8_0[7:0] = (loops_600_exit147_add_8_8_0_op0 + loops_600_exit147_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop251_icmp_8_0_op0[2:0] = loops_600_loop251_212[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop251_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_loop251_icmp_8_0 = (loops_600_loop251_icmp_8_0_op0 < loops_600_loop251_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop251_or_16_16_0_op0[15:0] = loops_600_loop227_126_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop251_or_16_16_0_op1[15:0] = loops_600_loop245_188_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop251_or_16_16_0[15:0] = (loops_600_loop251_or_16_16_0_op0 | loops_600_loop251_or_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop251_add_8_8_1_op0[7:0] = loops_600_loop251_201_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_loop251_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_loop251_add_8_8_1[7:0] = (loops_600_loop251_add_8_8_1_op0 + loops_600_loop251_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_600_loop251_add_16_16_1_op0[15:0] = loops_600_loop245_183_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop251_add_16_16_1_op1[15:0] = loops_600_loop251_204[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop251_add_16_16_1[15:0] = (loops_600_loop251_add_16_16_1_op0 + loops_600_loop251_add_16_16_1_op1);
+end
+
+always @ (*) begin
+	loops_600_loop251_mul_16_16_0_op0[15:0] = loops_600_loop245_188_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop251_mul_16_16_0_op1[15:0] = loops_600_loop245_184_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop251_mul_16_16_0[15:0] = (loops_600_loop251_mul_16_16_0_op0 * loops_600_loop251_mul_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit252_icmp_8_0_op0[2:0] = loops_600_exit252_214[31:0];
+end
+
+always @ (*) begin
+	loops_600_exit252_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_exit252_icmp_8_0 = (loops_600_exit252_icmp_8_0_op0 < loops_600_exit252_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit252_add_8_8_0_op0[7:0] = loops_600_loop150_199_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_exit252_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_exit252_add_8_8_0[7:0] = (loops_600_exit252_add_8_8_0_op0 + loops_600_exit252_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit153_icmp_8_0_op0[2:0] = loops_600_exit153_216[31:0];
+end
+
+always @ (*) begin
+	loops_600_exit153_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_exit153_icmp_8_0 = (loops_600_exit153_icmp_8_0_op0 < loops_600_exit153_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit153_add_8_8_1_op0[7:0] = loops_600_loop049_197_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_exit153_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_exit153_add_8_8_1[7:0] = (loops_600_exit153_add_8_8_1_op0 + loops_600_exit153_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_600_loop257_icmp_8_0_op0[2:0] = loops_600_loop257_233[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop257_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_loop257_icmp_8_0 = (loops_600_loop257_icmp_8_0_op0 < loops_600_loop257_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop257_add_8_8_0_op0[7:0] = loops_600_loop257_222_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_loop257_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_loop257_add_8_8_0[7:0] = (loops_600_loop257_add_8_8_0_op0 + loops_600_loop257_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop257_and_8_8_0_op0[7:0] = loops_600_loop233_143_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop257_and_8_8_0_op1[7:0] = loops_600_loop233_143_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop257_and_8_8_0[7:0] = (loops_600_loop257_and_8_8_0_op0 & loops_600_loop257_and_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop257_or_32_32_0_op0[31:0] = loops_600_loop233_147_reg[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop257_or_32_32_0_op1[31:0] = loops_600_loop239_166_reg[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop257_or_32_32_0[31:0] = (loops_600_loop257_or_32_32_0_op0 | loops_600_loop257_or_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop257_mul_16_16_0_op0[15:0] = loops_600_loop245_188_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop257_mul_16_16_0_op1[15:0] = loops_600_loop251_205_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop257_mul_16_16_0[15:0] = (loops_600_loop257_mul_16_16_0_op0 * loops_600_loop257_mul_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit258_icmp_8_0_op0[2:0] = loops_600_exit258_235[31:0];
+end
+
+always @ (*) begin
+	loops_600_exit258_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_exit258_icmp_8_0 = (loops_600_exit258_icmp_8_0_op0 < loops_600_exit258_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit258_add_8_8_1_op0[7:0] = loops_600_loop156_220_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_exit258_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_exit258_add_8_8_1[7:0] = (loops_600_exit258_add_8_8_1_op0 + loops_600_exit258_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_600_exit159_icmp_8_0_op0[2:0] = loops_600_exit159_237[31:0];
+end
+
+always @ (*) begin
+	loops_600_exit159_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_exit159_icmp_8_0 = (loops_600_exit159_icmp_8_0_op0 < loops_600_exit159_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit159_add_8_8_0_op0[7:0] = loops_600_loop055_218_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_exit159_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_exit159_add_8_8_0[7:0] = (loops_600_exit159_add_8_8_0_op0 + loops_600_exit159_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop263_icmp_8_0_op0[2:0] = loops_600_loop263_254[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop263_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_loop263_icmp_8_0 = (loops_600_loop263_icmp_8_0_op0 < loops_600_loop263_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop263_mul_8_8_0_op0[7:0] = loops_600_loop251_206_reg;
+end
+
+always @ (*) begin
+	loops_600_loop263_mul_8_8_0_op1[7:0] = loops_600_loop245_185_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop263_mul_8_8_0[7:0] = (loops_600_loop263_mul_8_8_0_op0 * loops_600_loop263_mul_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop263_add_8_8_1_op0[7:0] = loops_600_loop233_146_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop263_add_8_8_1_op1[7:0] = loops_600_loop251_210_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop263_add_8_8_1[7:0] = (loops_600_loop263_add_8_8_1_op0 + loops_600_loop263_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_600_loop263_add_8_8_0_op0[7:0] = loops_600_loop263_243_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_loop263_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_loop263_add_8_8_0[7:0] = (loops_600_loop263_add_8_8_0_op0 + loops_600_loop263_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop263_add_16_16_1_op0[15:0] = loops_600_loop251_204_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop263_add_16_16_1_op1[15:0] = loops_600_loop251_208_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop263_add_16_16_1[15:0] = (loops_600_loop263_add_16_16_1_op0 + loops_600_loop263_add_16_16_1_op1);
+end
+
+always @ (*) begin
+	loops_600_exit264_icmp_8_0_op0[2:0] = loops_600_exit264_256[31:0];
+end
+
+always @ (*) begin
+	loops_600_exit264_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_exit264_icmp_8_0 = (loops_600_exit264_icmp_8_0_op0 < loops_600_exit264_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit264_add_8_8_0_op0[7:0] = loops_600_loop162_241_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_exit264_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_exit264_add_8_8_0[7:0] = (loops_600_exit264_add_8_8_0_op0 + loops_600_exit264_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit165_icmp_8_0_op0[2:0] = loops_600_exit165_258[31:0];
+end
+
+always @ (*) begin
+	loops_600_exit165_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_exit165_icmp_8_0 = (loops_600_exit165_icmp_8_0_op0 < loops_600_exit165_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit165_add_8_8_1_op0[7:0] = loops_600_loop061_239_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_exit165_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_exit165_add_8_8_1[7:0] = (loops_600_exit165_add_8_8_1_op0 + loops_600_exit165_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_600_loop269_icmp_8_0_op0[2:0] = loops_600_loop269_275[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop269_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_loop269_icmp_8_0 = (loops_600_loop269_icmp_8_0_op0 < loops_600_loop269_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop269_or_8_8_0_op0[7:0] = loops_600_loop251_206_reg;
+end
+
+always @ (*) begin
+	loops_600_loop269_or_8_8_0_op1[7:0] = loops_600_loop263_249_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop269_or_8_8_0[7:0] = (loops_600_loop269_or_8_8_0_op0 | loops_600_loop269_or_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop269_add_32_32_0_op0[31:0] = loops_600_loop245_187_reg[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop269_add_32_32_0_op1[31:0] = loops_600_loop257_226_reg[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop269_add_32_32_0[31:0] = (loops_600_loop269_add_32_32_0_op0 + loops_600_loop269_add_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop269_add_8_8_0_op0[7:0] = loops_600_loop269_264_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_loop269_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_loop269_add_8_8_0[7:0] = (loops_600_loop269_add_8_8_0_op0 + loops_600_loop269_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop269_or_32_32_0_op0[31:0] = loops_600_loop239_165_reg[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop269_or_32_32_0_op1[31:0] = loops_600_loop257_230_reg[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop269_or_32_32_0[31:0] = (loops_600_loop269_or_32_32_0_op0 | loops_600_loop269_or_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop269_add_16_16_0_op0[15:0] = loops_600_loop257_229_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop269_add_16_16_0_op1[15:0] = loops_600_loop257_224_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop269_add_16_16_0[15:0] = (loops_600_loop269_add_16_16_0_op0 + loops_600_loop269_add_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit270_icmp_8_0_op0[2:0] = loops_600_exit270_277[31:0];
+end
+
+always @ (*) begin
+	loops_600_exit270_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_exit270_icmp_8_0 = (loops_600_exit270_icmp_8_0_op0 < loops_600_exit270_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit270_add_8_8_1_op0[7:0] = loops_600_loop168_262_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_exit270_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_exit270_add_8_8_1[7:0] = (loops_600_exit270_add_8_8_1_op0 + loops_600_exit270_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_600_exit171_icmp_8_0_op0[2:0] = loops_600_exit171_279[31:0];
+end
+
+always @ (*) begin
+	loops_600_exit171_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_exit171_icmp_8_0 = (loops_600_exit171_icmp_8_0_op0 < loops_600_exit171_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit171_add_8_8_0_op0[7:0] = loops_600_loop067_260_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_exit171_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_exit171_add_8_8_0[7:0] = (loops_600_exit171_add_8_8_0_op0 + loops_600_exit171_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop275_icmp_8_0_op0[2:0] = loops_600_loop275_296[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop275_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_loop275_icmp_8_0 = (loops_600_loop275_icmp_8_0_op0 < loops_600_loop275_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop275_mul_8_8_0_op0[7:0] = loops_600_loop269_266_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop275_mul_8_8_0_op1[7:0] = loops_600_loop269_266_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop275_mul_8_8_0[7:0] = (loops_600_loop275_mul_8_8_0_op0 * loops_600_loop275_mul_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop275_add_8_8_1_op0[7:0] = loops_600_loop275_285_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_loop275_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_loop275_add_8_8_1[7:0] = (loops_600_loop275_add_8_8_1_op0 + loops_600_loop275_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_600_loop275_add_16_16_1_op0[15:0] = loops_600_loop275_287[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop275_add_16_16_1_op1[15:0] = loops_600_loop275_287[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop275_add_16_16_1[15:0] = (loops_600_loop275_add_16_16_1_op0 + loops_600_loop275_add_16_16_1_op1);
+end
+
+always @ (*) begin
+	loops_600_loop275_mul_16_16_0_op0[15:0] = loops_600_loop275_291[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop275_mul_16_16_0_op1[15:0] = loops_600_loop269_268_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop275_mul_16_16_0[15:0] = (loops_600_loop275_mul_16_16_0_op0 * loops_600_loop275_mul_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit276_icmp_8_0_op0[2:0] = loops_600_exit276_298[31:0];
+end
+
+always @ (*) begin
+	loops_600_exit276_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_exit276_icmp_8_0 = (loops_600_exit276_icmp_8_0_op0 < loops_600_exit276_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit276_add_8_8_0_op0[7:0] = loops_600_loop174_283_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_exit276_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_exit276_add_8_8_0[7:0] = (loops_600_exit276_add_8_8_0_op0 + loops_600_exit276_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit177_icmp_8_0_op0[2:0] = loops_600_exit177_300[31:0];
+end
+
+always @ (*) begin
+	loops_600_exit177_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_exit177_icmp_8_0 = (loops_600_exit177_icmp_8_0_op0 < loops_600_exit177_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit177_add_8_8_1_op0[7:0] = loops_600_loop073_281_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_exit177_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_exit177_add_8_8_1[7:0] = (loops_600_exit177_add_8_8_1_op0 + loops_600_exit177_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_600_loop281_icmp_8_0_op0[2:0] = loops_600_loop281_317[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop281_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_loop281_icmp_8_0 = (loops_600_loop281_icmp_8_0_op0 < loops_600_loop281_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop281_mul_8_8_0_op0[7:0] = loops_600_loop263_252_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop281_mul_8_8_0_op1[7:0] = loops_600_loop275_293_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop281_mul_8_8_0[7:0] = (loops_600_loop281_mul_8_8_0_op0 * loops_600_loop281_mul_8_8_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_72_S_0)) begin
+		loops_600_loop281_add_32_32_0_op0[31:0] = loops_600_loop257_230_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_600_BB_72_S_1)) */ begin
+		loops_600_loop281_add_32_32_0_op0[31:0] = loops_600_loop269_273_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_72_S_0)) begin
+		loops_600_loop281_add_32_32_0_op1[31:0] = loops_600_loop269_270_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_600_BB_72_S_1)) */ begin
+		loops_600_loop281_add_32_32_0_op1[31:0] = loops_600_loop269_272_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop281_add_32_32_0[31:0] = (loops_600_loop281_add_32_32_0_op0 + loops_600_loop281_add_32_32_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_72_S_0)) begin
+		loops_600_loop281_add_8_8_0_op0[7:0] = loops_600_loop263_249_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_600_BB_72_S_1)) */ begin
+		loops_600_loop281_add_8_8_0_op0[7:0] = loops_600_loop281_313[7:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_72_S_0)) begin
+		loops_600_loop281_add_8_8_0_op1[7:0] = loops_600_loop269_266_reg[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_600_BB_72_S_1)) */ begin
+		loops_600_loop281_add_8_8_0_op1[7:0] = loops_600_loop275_289_reg[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop281_add_8_8_0[7:0] = (loops_600_loop281_add_8_8_0_op0 + loops_600_loop281_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_72_S_0)) begin
+		loops_600_loop281_add_8_8_1_op0[7:0] = loops_600_loop281_306_reg[1:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_600_BB_72_S_1)) */ begin
+		loops_600_loop281_add_8_8_1_op0[7:0] = loops_600_loop275_293_reg[7:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_72_S_0)) begin
+		loops_600_loop281_add_8_8_1_op1[7:0] = 32'd1;
+	end
+	else /* if ((cur_state == BPHLS_F_loops_600_BB_72_S_1)) */ begin
+		loops_600_loop281_add_8_8_1_op1[7:0] = loops_600_loop281_309_reg[7:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop281_add_8_8_1[7:0] = (loops_600_loop281_add_8_8_1_op0 + loops_600_loop281_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_600_exit282_icmp_8_0_op0[2:0] = loops_600_exit282_319[31:0];
+end
+
+always @ (*) begin
+	loops_600_exit282_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_exit282_icmp_8_0 = (loops_600_exit282_icmp_8_0_op0 < loops_600_exit282_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit282_add_8_8_1_op0[7:0] = loops_600_loop180_304_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_exit282_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_exit282_add_8_8_1[7:0] = (loops_600_exit282_add_8_8_1_op0 + loops_600_exit282_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_600_exit183_icmp_8_0_op0[2:0] = loops_600_exit183_321[31:0];
+end
+
+always @ (*) begin
+	loops_600_exit183_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_exit183_icmp_8_0 = (loops_600_exit183_icmp_8_0_op0 < loops_600_exit183_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit183_add_8_8_0_op0[7:0] = loops_600_loop079_302_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_exit183_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_exit183_add_8_8_0[7:0] = (loops_600_exit183_add_8_8_0_op0 + loops_600_exit183_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop287_icmp_8_0_op0[2:0] = loops_600_loop287_338[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop287_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_loop287_icmp_8_0 = (loops_600_loop287_icmp_8_0_op0 < loops_600_loop287_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop287_or_8_8_0_op0[7:0] = loops_600_loop287_335[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop287_or_8_8_0_op1[7:0] = loops_600_loop281_313_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop287_or_8_8_0[7:0] = (loops_600_loop287_or_8_8_0_op0 | loops_600_loop287_or_8_8_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_77_S_0)) begin
+		loops_600_loop287_add_32_32_0_op0[31:0] = loops_600_loop281_315_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_600_BB_77_S_1)) */ begin
+		loops_600_loop287_add_32_32_0_op0[31:0] = loops_600_loop269_270_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_77_S_0)) begin
+		loops_600_loop287_add_32_32_0_op1[31:0] = loops_600_loop275_294_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_600_BB_77_S_1)) */ begin
+		loops_600_loop287_add_32_32_0_op1[31:0] = loops_600_loop281_311_reg[15:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop287_add_32_32_0[31:0] = (loops_600_loop287_add_32_32_0_op0 + loops_600_loop287_add_32_32_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_77_S_0)) begin
+		loops_600_loop287_mul_32_32_0_op0[31:0] = loops_600_loop269_270_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_600_BB_77_S_1)) */ begin
+		loops_600_loop287_mul_32_32_0_op0[31:0] = loops_600_loop287_330_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_77_S_0)) begin
+		loops_600_loop287_mul_32_32_0_op1[31:0] = loops_600_loop275_294_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_600_BB_77_S_1)) */ begin
+		loops_600_loop287_mul_32_32_0_op1[31:0] = loops_600_loop269_273_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop287_mul_32_32_0[31:0] = (loops_600_loop287_mul_32_32_0_op0 * loops_600_loop287_mul_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop287_add_8_8_1_op0[7:0] = loops_600_loop281_309_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop287_add_8_8_1_op1[7:0] = loops_600_loop275_293_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop287_add_8_8_1[7:0] = (loops_600_loop287_add_8_8_1_op0 + loops_600_loop287_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_600_loop287_add_8_8_0_op0[7:0] = loops_600_loop287_327_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_loop287_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_loop287_add_8_8_0[7:0] = (loops_600_loop287_add_8_8_0_op0 + loops_600_loop287_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop287_add_16_16_0_op0[15:0] = loops_600_loop269_271_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop287_add_16_16_0_op1[15:0] = loops_600_loop275_292_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop287_add_16_16_0[15:0] = (loops_600_loop287_add_16_16_0_op0 + loops_600_loop287_add_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit288_icmp_8_0_op0[2:0] = loops_600_exit288_340[31:0];
+end
+
+always @ (*) begin
+	loops_600_exit288_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_exit288_icmp_8_0 = (loops_600_exit288_icmp_8_0_op0 < loops_600_exit288_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit288_add_8_8_1_op0[7:0] = loops_600_loop186_325_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_exit288_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_exit288_add_8_8_1[7:0] = (loops_600_exit288_add_8_8_1_op0 + loops_600_exit288_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_600_exit189_icmp_8_0_op0[2:0] = loops_600_exit189_342[31:0];
+end
+
+always @ (*) begin
+	loops_600_exit189_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_exit189_icmp_8_0 = (loops_600_exit189_icmp_8_0_op0 < loops_600_exit189_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit189_add_8_8_1_op0[7:0] = loops_600_loop085_323_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_exit189_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_exit189_add_8_8_1[7:0] = (loops_600_exit189_add_8_8_1_op0 + loops_600_exit189_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_600_loop293_icmp_8_0_op0[2:0] = loops_600_loop293_359[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop293_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_loop293_icmp_8_0 = (loops_600_loop293_icmp_8_0_op0 < loops_600_loop293_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop293_mul_8_8_0_op0[7:0] = loops_600_loop281_314_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop293_mul_8_8_0_op1[7:0] = loops_600_loop287_336_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop293_mul_8_8_0[7:0] = (loops_600_loop293_mul_8_8_0_op0 * loops_600_loop293_mul_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop293_add_32_32_0_op0[31:0] = loops_600_loop281_315_reg[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop293_add_32_32_0_op1[31:0] = loops_600_loop287_334_reg[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop293_add_32_32_0[31:0] = (loops_600_loop293_add_32_32_0_op0 + loops_600_loop293_add_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop293_add_8_8_0_op0[7:0] = loops_600_loop293_348_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_loop293_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_loop293_add_8_8_0[7:0] = (loops_600_loop293_add_8_8_0_op0 + loops_600_loop293_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop293_and_8_8_0_op0[7:0] = loops_600_loop287_331_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop293_and_8_8_0_op1[7:0] = loops_600_loop293_351[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop293_and_8_8_0[7:0] = (loops_600_loop293_and_8_8_0_op0 & loops_600_loop293_and_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop293_mul_16_16_0_op0[15:0] = loops_600_loop275_287_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop293_mul_16_16_0_op1[15:0] = loops_600_loop275_292_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop293_mul_16_16_0[15:0] = (loops_600_loop293_mul_16_16_0_op0 * loops_600_loop293_mul_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit294_icmp_8_0_op0[2:0] = loops_600_exit294_361[31:0];
+end
+
+always @ (*) begin
+	loops_600_exit294_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_exit294_icmp_8_0 = (loops_600_exit294_icmp_8_0_op0 < loops_600_exit294_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit294_add_8_8_1_op0[7:0] = loops_600_loop192_346_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_exit294_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_exit294_add_8_8_1[7:0] = (loops_600_exit294_add_8_8_1_op0 + loops_600_exit294_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_600_exit195_icmp_8_0_op0[2:0] = loops_600_exit195_363[31:0];
+end
+
+always @ (*) begin
+	loops_600_exit195_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_exit195_icmp_8_0 = (loops_600_exit195_icmp_8_0_op0 < loops_600_exit195_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit195_add_8_8_0_op0[7:0] = loops_600_loop091_344_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_exit195_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_exit195_add_8_8_0[7:0] = (loops_600_exit195_add_8_8_0_op0 + loops_600_exit195_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop299_and_16_16_0_op0[15:0] = loops_600_loop275_291_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop299_and_16_16_0_op1[15:0] = loops_600_loop281_312_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop299_and_16_16_0[15:0] = (loops_600_loop299_and_16_16_0_op0 & loops_600_loop299_and_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop299_icmp_8_0_op0[2:0] = loops_600_loop299_380[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop299_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_loop299_icmp_8_0 = (loops_600_loop299_icmp_8_0_op0 < loops_600_loop299_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_87_S_0)) begin
+		loops_600_loop299_add_32_32_0_op0[31:0] = loops_600_loop287_330_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_600_BB_87_S_1)) */ begin
+		loops_600_loop299_add_32_32_0_op0[31:0] = loops_600_loop287_332_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_87_S_0)) begin
+		loops_600_loop299_add_32_32_0_op1[31:0] = loops_600_loop287_330_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_600_BB_87_S_1)) */ begin
+		loops_600_loop299_add_32_32_0_op1[31:0] = loops_600_loop293_355_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop299_add_32_32_0[31:0] = (loops_600_loop299_add_32_32_0_op0 + loops_600_loop299_add_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop299_add_8_8_1_op0[7:0] = loops_600_loop299_369_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_loop299_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_loop299_add_8_8_1[7:0] = (loops_600_loop299_add_8_8_1_op0 + loops_600_loop299_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_600_loop299_and_8_8_0_op0[7:0] = loops_600_loop281_309_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop299_and_8_8_0_op1[7:0] = loops_600_loop287_331_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop299_and_8_8_0[7:0] = (loops_600_loop299_and_8_8_0_op0 & loops_600_loop299_and_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop299_add_16_16_1_op0[15:0] = loops_600_loop275_290_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop299_add_16_16_1_op1[15:0] = loops_600_loop287_331_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop299_add_16_16_1[15:0] = (loops_600_loop299_add_16_16_1_op0 + loops_600_loop299_add_16_16_1_op1);
+end
+
+always @ (*) begin
+	loops_600_exit2100_icmp_8_0_op0[2:0] = loops_600_exit2100_382[31:0];
+end
+
+always @ (*) begin
+	loops_600_exit2100_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_exit2100_icmp_8_0 = (loops_600_exit2100_icmp_8_0_op0 < loops_600_exit2100_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit2100_add_8_8_0_op0[7:0] = loops_600_loop198_367_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_exit2100_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_exit2100_add_8_8_0[7:0] = (loops_600_exit2100_add_8_8_0_op0 + loops_600_exit2100_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit1101_icmp_8_0_op0[2:0] = loops_600_exit1101_384[31:0];
+end
+
+always @ (*) begin
+	loops_600_exit1101_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_exit1101_icmp_8_0 = (loops_600_exit1101_icmp_8_0_op0 < loops_600_exit1101_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit1101_add_8_8_1_op0[7:0] = loops_600_loop097_365_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_exit1101_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_exit1101_add_8_8_1[7:0] = (loops_600_exit1101_add_8_8_1_op0 + loops_600_exit1101_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_600_loop2105_icmp_8_0_op0[2:0] = loops_600_loop2105_401[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop2105_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_loop2105_icmp_8_0 = (loops_600_loop2105_icmp_8_0_op0 < loops_600_loop2105_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop2105_mul_8_8_0_op0[7:0] = loops_600_loop293_351_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop2105_mul_8_8_0_op1[7:0] = loops_600_loop281_314_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop2105_mul_8_8_0[7:0] = (loops_600_loop2105_mul_8_8_0_op0 * loops_600_loop2105_mul_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop2105_or_8_8_0_op0[7:0] = loops_600_loop281_313_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop2105_or_8_8_0_op1[7:0] = loops_600_loop293_351_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop2105_or_8_8_0[7:0] = (loops_600_loop2105_or_8_8_0_op0 | loops_600_loop2105_or_8_8_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_92_S_0)) begin
+		loops_600_loop2105_mul_32_32_0_op0[31:0] = loops_600_loop293_353_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_600_BB_92_S_1)) */ begin
+		loops_600_loop2105_mul_32_32_0_op0[31:0] = loops_600_loop2105_395_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_loops_600_BB_92_S_0)) begin
+		loops_600_loop2105_mul_32_32_0_op1[31:0] = loops_600_loop293_353_reg[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_loops_600_BB_92_S_1)) */ begin
+		loops_600_loop2105_mul_32_32_0_op1[31:0] = loops_600_loop299_377_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	loops_600_loop2105_mul_32_32_0[31:0] = (loops_600_loop2105_mul_32_32_0_op0 * loops_600_loop2105_mul_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop2105_or_16_16_0_op0[15:0] = loops_600_loop299_374_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop2105_or_16_16_0_op1[15:0] = loops_600_loop293_350_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop2105_or_16_16_0[15:0] = (loops_600_loop2105_or_16_16_0_op0 | loops_600_loop2105_or_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop2105_add_8_8_0_op0[7:0] = loops_600_loop2105_390_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_loop2105_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_loop2105_add_8_8_0[7:0] = (loops_600_loop2105_add_8_8_0_op0 + loops_600_loop2105_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop2105_add_16_16_0_op0[15:0] = loops_600_loop299_378_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop2105_add_16_16_0_op1[15:0] = loops_600_loop287_329_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop2105_add_16_16_0[15:0] = (loops_600_loop2105_add_16_16_0_op0 + loops_600_loop2105_add_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit2106_icmp_8_0_op0[2:0] = loops_600_exit2106_403[31:0];
+end
+
+always @ (*) begin
+	loops_600_exit2106_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_exit2106_icmp_8_0 = (loops_600_exit2106_icmp_8_0_op0 < loops_600_exit2106_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit2106_add_8_8_1_op0[7:0] = loops_600_loop1104_388_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_exit2106_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_exit2106_add_8_8_1[7:0] = (loops_600_exit2106_add_8_8_1_op0 + loops_600_exit2106_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_600_exit1107_icmp_8_0_op0[2:0] = loops_600_exit1107_405[31:0];
+end
+
+always @ (*) begin
+	loops_600_exit1107_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_exit1107_icmp_8_0 = (loops_600_exit1107_icmp_8_0_op0 < loops_600_exit1107_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit1107_add_8_8_0_op0[7:0] = loops_600_loop0103_386_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_exit1107_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_exit1107_add_8_8_0[7:0] = (loops_600_exit1107_add_8_8_0_op0 + loops_600_exit1107_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop2111_icmp_8_0_op0[2:0] = loops_600_loop2111_422[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop2111_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_loop2111_icmp_8_0 = (loops_600_loop2111_icmp_8_0_op0 < loops_600_loop2111_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop2111_or_8_8_0_op0[7:0] = loops_600_loop2105_392_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop2111_or_8_8_0_op1[7:0] = loops_600_loop287_335_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop2111_or_8_8_0[7:0] = (loops_600_loop2111_or_8_8_0_op0 | loops_600_loop2111_or_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop2111_add_8_8_1_op0[7:0] = loops_600_loop2111_411_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_loop2111_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_loop2111_add_8_8_1[7:0] = (loops_600_loop2111_add_8_8_1_op0 + loops_600_loop2111_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_600_loop2111_and_32_32_0_op0[31:0] = loops_600_loop2111_415[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop2111_and_32_32_0_op1[31:0] = loops_600_loop2105_394_reg[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop2111_and_32_32_0[31:0] = (loops_600_loop2111_and_32_32_0_op0 & loops_600_loop2111_and_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit2112_icmp_8_0_op0[2:0] = loops_600_exit2112_424[31:0];
+end
+
+always @ (*) begin
+	loops_600_exit2112_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_exit2112_icmp_8_0 = (loops_600_exit2112_icmp_8_0_op0 < loops_600_exit2112_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit2112_add_8_8_0_op0[7:0] = loops_600_loop1110_409_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_exit2112_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_exit2112_add_8_8_0[7:0] = (loops_600_exit2112_add_8_8_0_op0 + loops_600_exit2112_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit1113_icmp_8_0_op0[2:0] = loops_600_exit1113_426[31:0];
+end
+
+always @ (*) begin
+	loops_600_exit1113_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_exit1113_icmp_8_0 = (loops_600_exit1113_icmp_8_0_op0 < loops_600_exit1113_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit1113_add_8_8_1_op0[7:0] = loops_600_loop0109_407_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_exit1113_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_exit1113_add_8_8_1[7:0] = (loops_600_exit1113_add_8_8_1_op0 + loops_600_exit1113_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_600_loop2117_icmp_8_0_op0[2:0] = loops_600_loop2117_443[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop2117_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_loop2117_icmp_8_0 = (loops_600_loop2117_icmp_8_0_op0 < loops_600_loop2117_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop2117_mul_32_32_0_op0[31:0] = loops_600_loop299_372_reg[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop2117_mul_32_32_0_op1[31:0] = loops_600_loop2105_398_reg[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop2117_mul_32_32_0[31:0] = (loops_600_loop2117_mul_32_32_0_op0 * loops_600_loop2117_mul_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop2117_or_16_16_0_op0[15:0] = loops_600_loop299_378_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop2117_or_16_16_0_op1[15:0] = loops_600_loop281_312_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop2117_or_16_16_0[15:0] = (loops_600_loop2117_or_16_16_0_op0 | loops_600_loop2117_or_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop2117_add_8_8_0_op0[7:0] = loops_600_loop2117_432_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_loop2117_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_loop2117_add_8_8_0[7:0] = (loops_600_loop2117_add_8_8_0_op0 + loops_600_loop2117_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit2118_icmp_8_0_op0[2:0] = loops_600_exit2118_445[31:0];
+end
+
+always @ (*) begin
+	loops_600_exit2118_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_exit2118_icmp_8_0 = (loops_600_exit2118_icmp_8_0_op0 < loops_600_exit2118_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit2118_add_8_8_1_op0[7:0] = loops_600_loop1116_430_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_exit2118_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_exit2118_add_8_8_1[7:0] = (loops_600_exit2118_add_8_8_1_op0 + loops_600_exit2118_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_600_exit1119_icmp_8_0_op0[2:0] = loops_600_exit1119_447[31:0];
+end
+
+always @ (*) begin
+	loops_600_exit1119_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_exit1119_icmp_8_0 = (loops_600_exit1119_icmp_8_0_op0 < loops_600_exit1119_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit1119_add_8_8_0_op0[7:0] = loops_600_loop0115_428_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_exit1119_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_exit1119_add_8_8_0[7:0] = (loops_600_exit1119_add_8_8_0_op0 + loops_600_exit1119_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop2123_icmp_8_0_op0[2:0] = loops_600_loop2123_464[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop2123_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_loop2123_icmp_8_0 = (loops_600_loop2123_icmp_8_0_op0 < loops_600_loop2123_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop2123_add_32_32_0_op0[31:0] = loops_600_loop2105_398_reg[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop2123_add_32_32_0_op1[31:0] = loops_600_loop2105_394_reg[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop2123_add_32_32_0[31:0] = (loops_600_loop2123_add_32_32_0_op0 + loops_600_loop2123_add_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop2123_or_16_16_0_op0[15:0] = loops_600_loop2111_418_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop2123_or_16_16_0_op1[15:0] = loops_600_loop2117_441_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop2123_or_16_16_0[15:0] = (loops_600_loop2123_or_16_16_0_op0 | loops_600_loop2123_or_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop2123_add_8_8_1_op0[7:0] = loops_600_loop293_351_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop2123_add_8_8_1_op1[7:0] = loops_600_loop299_375_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop2123_add_8_8_1[7:0] = (loops_600_loop2123_add_8_8_1_op0 + loops_600_loop2123_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_600_loop2123_add_8_8_0_op0[7:0] = loops_600_loop2123_453_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_loop2123_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_loop2123_add_8_8_0[7:0] = (loops_600_loop2123_add_8_8_0_op0 + loops_600_loop2123_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop2123_and_32_32_0_op0[31:0] = loops_600_loop2111_415_reg[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop2123_and_32_32_0_op1[31:0] = loops_600_loop2105_395_reg[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop2123_and_32_32_0[31:0] = (loops_600_loop2123_and_32_32_0_op0 & loops_600_loop2123_and_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit2124_icmp_8_0_op0[2:0] = loops_600_exit2124_466[31:0];
+end
+
+always @ (*) begin
+	loops_600_exit2124_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_exit2124_icmp_8_0 = (loops_600_exit2124_icmp_8_0_op0 < loops_600_exit2124_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit2124_add_8_8_0_op0[7:0] = loops_600_loop1122_451_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_exit2124_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_exit2124_add_8_8_0[7:0] = (loops_600_exit2124_add_8_8_0_op0 + loops_600_exit2124_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit1125_icmp_8_0_op0[2:0] = loops_600_exit1125_468[31:0];
+end
+
+always @ (*) begin
+	loops_600_exit1125_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_exit1125_icmp_8_0 = (loops_600_exit1125_icmp_8_0_op0 < loops_600_exit1125_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit1125_add_8_8_1_op0[7:0] = loops_600_loop0121_449_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_exit1125_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_exit1125_add_8_8_1[7:0] = (loops_600_exit1125_add_8_8_1_op0 + loops_600_exit1125_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_600_loop2129_icmp_8_0_op0[2:0] = loops_600_loop2129_485[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop2129_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_loop2129_icmp_8_0 = (loops_600_loop2129_icmp_8_0_op0 < loops_600_loop2129_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop2129_or_8_8_0_op0[7:0] = loops_600_loop299_375_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop2129_or_8_8_0_op1[7:0] = loops_600_loop2105_397_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop2129_or_8_8_0[7:0] = (loops_600_loop2129_or_8_8_0_op0 | loops_600_loop2129_or_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop2129_add_8_8_0_op0[7:0] = loops_600_loop2129_474_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_loop2129_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_loop2129_add_8_8_0[7:0] = (loops_600_loop2129_add_8_8_0_op0 + loops_600_loop2129_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop2129_and_8_8_0_op0[7:0] = loops_600_loop293_354_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop2129_and_8_8_0_op1[7:0] = loops_600_loop2123_458_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop2129_and_8_8_0[7:0] = (loops_600_loop2129_and_8_8_0_op0 & loops_600_loop2129_and_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop2129_or_32_32_0_op0[31:0] = loops_600_loop2111_415_reg[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop2129_or_32_32_0_op1[31:0] = loops_600_loop2111_414_reg[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop2129_or_32_32_0[31:0] = (loops_600_loop2129_or_32_32_0_op0 | loops_600_loop2129_or_32_32_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit2130_icmp_8_0_op0[2:0] = loops_600_exit2130_487[31:0];
+end
+
+always @ (*) begin
+	loops_600_exit2130_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_exit2130_icmp_8_0 = (loops_600_exit2130_icmp_8_0_op0 < loops_600_exit2130_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit2130_add_8_8_1_op0[7:0] = loops_600_loop1128_472_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_exit2130_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_exit2130_add_8_8_1[7:0] = (loops_600_exit2130_add_8_8_1_op0 + loops_600_exit2130_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_600_exit1131_icmp_8_0_op0[2:0] = loops_600_exit1131_489[31:0];
+end
+
+always @ (*) begin
+	loops_600_exit1131_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_exit1131_icmp_8_0 = (loops_600_exit1131_icmp_8_0_op0 < loops_600_exit1131_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit1131_add_8_8_0_op0[7:0] = loops_600_loop0127_470_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_exit1131_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_exit1131_add_8_8_0[7:0] = (loops_600_exit1131_add_8_8_0_op0 + loops_600_exit1131_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop2135_icmp_8_0_op0[2:0] = loops_600_loop2135_506[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop2135_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_loop2135_icmp_8_0 = (loops_600_loop2135_icmp_8_0_op0 < loops_600_loop2135_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop2135_mul_8_8_0_op0[7:0] = loops_600_loop2129_480_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop2135_mul_8_8_0_op1[7:0] = loops_600_loop2111_419_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop2135_mul_8_8_0[7:0] = (loops_600_loop2135_mul_8_8_0_op0 * loops_600_loop2135_mul_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop2135_or_8_8_0_op0[7:0] = loops_600_loop2123_458_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop2135_or_8_8_0_op1[7:0] = loops_600_loop2129_480_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop2135_or_8_8_0[7:0] = (loops_600_loop2135_or_8_8_0_op0 | loops_600_loop2135_or_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_loop2135_add_8_8_1_op0[7:0] = loops_600_loop2135_495_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_loop2135_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_loop2135_add_8_8_1[7:0] = (loops_600_loop2135_add_8_8_1_op0 + loops_600_loop2135_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_600_loop2135_add_16_16_1_op0[15:0] = loops_600_loop2135_498[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop2135_add_16_16_1_op1[15:0] = loops_600_loop2117_441_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop2135_add_16_16_1[15:0] = (loops_600_loop2135_add_16_16_1_op0 + loops_600_loop2135_add_16_16_1_op1);
+end
+
+always @ (*) begin
+	loops_600_loop2135_add_16_16_0_op0[15:0] = loops_600_loop2129_483_reg[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop2135_add_16_16_0_op1[15:0] = loops_600_loop2123_459_reg[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop2135_add_16_16_0[15:0] = (loops_600_loop2135_add_16_16_0_op0 + loops_600_loop2135_add_16_16_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit2136_icmp_8_0_op0[2:0] = loops_600_exit2136_508[31:0];
+end
+
+always @ (*) begin
+	loops_600_exit2136_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_exit2136_icmp_8_0 = (loops_600_exit2136_icmp_8_0_op0 < loops_600_exit2136_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit2136_add_8_8_0_op0[7:0] = loops_600_loop1134_493_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_exit2136_add_8_8_0_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_exit2136_add_8_8_0[7:0] = (loops_600_exit2136_add_8_8_0_op0 + loops_600_exit2136_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit1137_icmp_8_0_op0[2:0] = loops_600_exit1137_510[31:0];
+end
+
+always @ (*) begin
+	loops_600_exit1137_icmp_8_0_op1[2:0] = 32'd4;
+end
+
+always @ (*) begin
+	loops_600_exit1137_icmp_8_0 = (loops_600_exit1137_icmp_8_0_op0 < loops_600_exit1137_icmp_8_0_op1);
+end
+
+always @ (*) begin
+	loops_600_exit1137_add_8_8_1_op0[7:0] = loops_600_loop0133_491_reg[1:0];
+end
+
+always @ (*) begin
+	loops_600_exit1137_add_8_8_1_op1[7:0] = 32'd1;
+end
+
+always @ (*) begin
+	loops_600_exit1137_add_8_8_1[7:0] = (loops_600_exit1137_add_8_8_1_op0 + loops_600_exit1137_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	loops_600_loop2_16[63:0] = (arg_7 ^ arg_7);
+end
+
+always @ (*) begin
+	loops_600_loop23_37[7:0] = loops_600_loop23_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop29_56[63:0] = (loops_600_loop23_34_reg * arg_6);
+end
+
+always @ (*) begin
+	loops_600_loop29_62[63:0] = (loops_600_loop23_40_reg - loops_600_loop2_17_reg);
+end
+
+always @ (*) begin
+	loops_600_loop215_78[63:0] = (loops_600_loop29_55_reg & loops_600_loop23_41_reg);
+end
+
+always @ (*) begin
+	loops_600_loop227_123[15:0] = (loops_600_loop215_83_reg ^ loops_600_loop215_80_reg);
+end
+
+always @ (*) begin
+	loops_600_loop233_144[63:0] = (loops_600_loop227_118_reg + loops_600_loop227_124_reg);
+end
+
+always @ (*) begin
+	loops_600_loop239_167[63:0] = (loops_600_loop221_105_reg - loops_600_loop227_122_reg);
+end
+
+always @ (*) begin
+	loops_600_loop239_163[31:0] = loops_600_loop239_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop251_203[63:0] = (loops_600_loop239_168_reg ^ loops_600_loop239_160_reg);
+end
+
+always @ (*) begin
+	loops_600_loop251_209[63:0] = (loops_600_loop239_160_reg & loops_600_loop251_207_reg);
+end
+
+always @ (*) begin
+	loops_600_loop257_227[15:0] = (loops_600_loop245_183_reg ^ loops_600_loop251_205_reg);
+end
+
+always @ (*) begin
+	loops_600_loop257_228[7:0] = loops_600_loop257_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop263_245[63:0] = (loops_600_loop263_244_reg + loops_600_loop251_202_reg);
+end
+
+always @ (*) begin
+	loops_600_loop263_246[15:0] = (loops_600_loop251_205_reg ^ loops_600_loop257_229_reg);
+end
+
+always @ (*) begin
+	loops_600_loop263_247[7:0] = loops_600_loop263_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop263_251[63:0] = (loops_600_loop257_223_reg + loops_600_loop257_225_reg);
+end
+
+always @ (*) begin
+	loops_600_loop275_288[63:0] = (loops_600_loop275_286_reg + loops_600_loop269_269_reg);
+end
+
+always @ (*) begin
+	loops_600_loop281_310[31:0] = loops_600_loop281_add_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop299_371[31:0] = (loops_600_loop287_334_reg - loops_600_loop287_330_reg);
+end
+
+always @ (*) begin
+	loops_600_loop2105_396[15:0] = loops_600_loop2105_or_16_16_0[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop2111_417[7:0] = (loops_600_loop293_351_reg ^ loops_600_loop299_375_reg);
+end
+
+always @ (*) begin
+	loops_600_loop2117_436[31:0] = loops_600_loop2117_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop2117_437[63:0] = (loops_600_loop2111_413_reg + loops_600_loop299_378_reg);
+end
+
+always @ (*) begin
+	loops_600_loop2123_457[63:0] = (loops_600_loop2117_438_reg - loops_600_loop2123_454_reg);
+end
+
+always @ (*) begin
+	loops_600_loop2123_461[31:0] = loops_600_loop2123_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	loops_600_loop2129_476[63:0] = (loops_600_loop2117_438_reg & loops_600_loop2123_460_reg);
+end
+
+always @ (*) begin
+	loops_600_loop2129_477[63:0] = (loops_600_loop2117_440_reg + loops_600_loop2123_455_reg);
+end
+
+always @ (*) begin
+	loops_600_loop2129_478[7:0] = loops_600_loop2129_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop2135_497[7:0] = loops_600_loop2135_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop2135_499[15:0] = loops_600_loop2135_add_16_16_1[15:0];
+end
+
+always @ (*) begin
+	loops_600_loop2135_500[31:0] = (loops_600_loop2129_479_reg ^ loops_600_loop2123_456_reg);
+end
+
+always @ (*) begin
+	loops_600_loop2135_501[7:0] = loops_600_loop2135_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	loops_600_loop2135_502[63:0] = (loops_600_loop2129_475_reg - loops_600_loop2123_462_reg);
+end
+
+always @ (*) begin
+	loops_600_loop2135_503[31:0] = (loops_600_loop2129_482_reg - loops_600_loop2129_482_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS)) begin
+		finish <= 1'd0;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_120_S_0)) begin
+		finish <= 1'd1;
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS)) begin
+		return_val[63:0] <= 64'd0;
+	end
+	if ((cur_state == BPHLS_F_loops_600_BB_120_S_0)) begin
+		return_val[63:0] <= loops_600_loop2135_505_reg[63:0];
+	end
+end
+
+endmodule
@@ -0,0 +1,257 @@
+; ModuleID = 'switch_100'
+source_filename = "switch_100"
+
+define i64 @switch_100(i8 %0, i8 %1, i16 %2, i16 %3, i32 %4, i32 %5, i64 %6, i64 %7) {
+entry:
+  switch i8 %0, label %default [
+    i8 0, label %case0
+    i8 1, label %case1
+    i8 2, label %case2
+    i8 3, label %case3
+    i8 4, label %case4
+    i8 5, label %case5
+    i8 6, label %case6
+    i8 7, label %case7
+    i8 8, label %case8
+    i8 9, label %case9
+    i8 10, label %case10
+    i8 11, label %case11
+    i8 12, label %case12
+    i8 13, label %case13
+    i8 14, label %case14
+    i8 15, label %case15
+  ]
+
+merge:                                            ; preds = %default, %case15, %case14, %case13, %case12, %case11, %case10, %case9, %case8, %case7, %case6, %case5, %case4, %case3, %case2, %case1, %case0
+  %8 = phi i64 [ %19, %case0 ], [ %30, %case1 ], [ %40, %case2 ], [ %50, %case3 ], [ %60, %case4 ], [ %71, %case5 ], [ %82, %case6 ], [ %93, %case7 ], [ %104, %case8 ], [ %115, %case9 ], [ %125, %case10 ], [ %136, %case11 ], [ %146, %case12 ], [ %156, %case13 ], [ %166, %case14 ], [ %176, %case15 ], [ %186, %default ]
+  ret i64 %8
+
+case0:                                            ; preds = %entry
+  %9 = add i16 %2, %2
+  %10 = zext i8 %1 to i32
+  %11 = or i32 %4, %10
+  %12 = xor i64 %7, %6
+  %13 = mul i8 %1, %0
+  %14 = zext i8 %13 to i64
+  %15 = zext i16 %9 to i64
+  %16 = xor i64 %14, %15
+  %17 = zext i32 %11 to i64
+  %18 = xor i64 %16, %17
+  %19 = xor i64 %18, %12
+  br label %merge
+
+case1:                                            ; preds = %entry
+  %20 = and i8 %1, %1
+  %21 = zext i16 %2 to i32
+  %22 = xor i32 %4, %21
+  %23 = and i16 %3, %3
+  %24 = sub i8 %1, %20
+  %25 = zext i8 %24 to i64
+  %26 = zext i16 %23 to i64
+  %27 = xor i64 %25, %26
+  %28 = zext i32 %22 to i64
+  %29 = xor i64 %27, %28
+  %30 = xor i64 %29, %7
+  br label %merge
+
+case2:                                            ; preds = %entry
+  %31 = add i16 %2, %2
+  %32 = add i64 %6, %6
+  %33 = add i8 %0, %0
+  %34 = xor i16 %31, %31
+  %35 = zext i8 %33 to i64
+  %36 = zext i16 %34 to i64
+  %37 = xor i64 %35, %36
+  %38 = zext i32 %5 to i64
+  %39 = xor i64 %37, %38
+  %40 = xor i64 %39, %32
+  br label %merge
+
+case3:                                            ; preds = %entry
+  %41 = or i8 %1, %0
+  %42 = sub i64 %7, %7
+  %43 = or i8 %1, %0
+  %44 = add i8 %1, %1
+  %45 = zext i8 %44 to i64
+  %46 = zext i16 %3 to i64
+  %47 = xor i64 %45, %46
+  %48 = zext i32 %5 to i64
+  %49 = xor i64 %47, %48
+  %50 = xor i64 %49, %42
+  br label %merge
+
+case4:                                            ; preds = %entry
+  %51 = mul i64 %7, %6
+  %52 = sub i32 %4, %4
+  %53 = and i32 %52, %4
+  %54 = and i32 %52, %5
+  %55 = zext i8 %1 to i64
+  %56 = zext i16 %3 to i64
+  %57 = xor i64 %55, %56
+  %58 = zext i32 %54 to i64
+  %59 = xor i64 %57, %58
+  %60 = xor i64 %59, %51
+  br label %merge
+
+case5:                                            ; preds = %entry
+  %61 = add i64 %7, %6
+  %62 = and i16 %2, %3
+  %63 = zext i8 %0 to i64
+  %64 = sub i64 %7, %63
+  %65 = xor i32 %4, %4
+  %66 = zext i8 %1 to i64
+  %67 = zext i16 %62 to i64
+  %68 = xor i64 %66, %67
+  %69 = zext i32 %65 to i64
+  %70 = xor i64 %68, %69
+  %71 = xor i64 %70, %64
+  br label %merge
+
+case6:                                            ; preds = %entry
+  %72 = mul i8 %0, %1
+  %73 = zext i8 %1 to i64
+  %74 = and i64 %6, %73
+  %75 = xor i32 %5, %4
+  %76 = add i16 %2, %2
+  %77 = zext i8 %72 to i64
+  %78 = zext i16 %76 to i64
+  %79 = xor i64 %77, %78
+  %80 = zext i32 %75 to i64
+  %81 = xor i64 %79, %80
+  %82 = xor i64 %81, %74
+  br label %merge
+
+case7:                                            ; preds = %entry
+  %83 = or i64 %6, %6
+  %84 = xor i8 %0, %1
+  %85 = zext i8 %84 to i16
+  %86 = mul i16 %3, %85
+  %87 = xor i32 %5, %5
+  %88 = zext i8 %84 to i64
+  %89 = zext i16 %86 to i64
+  %90 = xor i64 %88, %89
+  %91 = zext i32 %87 to i64
+  %92 = xor i64 %90, %91
+  %93 = xor i64 %92, %83
+  br label %merge
+
+case8:                                            ; preds = %entry
+  %94 = or i64 %7, %7
+  %95 = zext i32 %5 to i64
+  %96 = xor i64 %94, %95
+  %97 = and i8 %0, %0
+  %98 = sub i32 %5, %4
+  %99 = zext i8 %97 to i64
+  %100 = zext i16 %3 to i64
+  %101 = xor i64 %99, %100
+  %102 = zext i32 %98 to i64
+  %103 = xor i64 %101, %102
+  %104 = xor i64 %103, %96
+  br label %merge
+
+case9:                                            ; preds = %entry
+  %105 = and i8 %1, %0
+  %106 = mul i64 %7, %6
+  %107 = add i8 %105, %105
+  %108 = zext i8 %1 to i64
+  %109 = or i64 %7, %108
+  %110 = zext i8 %107 to i64
+  %111 = zext i16 %3 to i64
+  %112 = xor i64 %110, %111
+  %113 = zext i32 %5 to i64
+  %114 = xor i64 %112, %113
+  %115 = xor i64 %114, %109
+  br label %merge
+
+case10:                                           ; preds = %entry
+  %116 = and i16 %3, %3
+  %117 = or i8 %0, %1
+  %118 = sub i32 %4, %5
+  %119 = xor i64 %7, %7
+  %120 = zext i8 %117 to i64
+  %121 = zext i16 %116 to i64
+  %122 = xor i64 %120, %121
+  %123 = zext i32 %118 to i64
+  %124 = xor i64 %122, %123
+  %125 = xor i64 %124, %119
+  br label %merge
+
+case11:                                           ; preds = %entry
+  %126 = xor i16 %3, %3
+  %127 = zext i16 %3 to i64
+  %128 = mul i64 %6, %127
+  %129 = or i32 %5, %4
+  %130 = xor i16 %2, %3
+  %131 = zext i8 %1 to i64
+  %132 = zext i16 %130 to i64
+  %133 = xor i64 %131, %132
+  %134 = zext i32 %129 to i64
+  %135 = xor i64 %133, %134
+  %136 = xor i64 %135, %128
+  br label %merge
+
+case12:                                           ; preds = %entry
+  %137 = add i8 %0, %1
+  %138 = xor i64 %7, %7
+  %139 = add i16 %2, %2
+  %140 = add i8 %137, %1
+  %141 = zext i8 %140 to i64
+  %142 = zext i16 %139 to i64
+  %143 = xor i64 %141, %142
+  %144 = zext i32 %5 to i64
+  %145 = xor i64 %143, %144
+  %146 = xor i64 %145, %138
+  br label %merge
+
+case13:                                           ; preds = %entry
+  %147 = add i64 %6, %7
+  %148 = xor i32 %4, %4
+  %149 = and i8 %1, %0
+  %150 = and i32 %4, %4
+  %151 = zext i8 %149 to i64
+  %152 = zext i16 %3 to i64
+  %153 = xor i64 %151, %152
+  %154 = zext i32 %150 to i64
+  %155 = xor i64 %153, %154
+  %156 = xor i64 %155, %147
+  br label %merge
+
+case14:                                           ; preds = %entry
+  %157 = mul i32 %5, %5
+  %158 = mul i32 %157, %157
+  %159 = mul i32 %5, %5
+  %160 = mul i8 %0, %0
+  %161 = zext i8 %160 to i64
+  %162 = zext i16 %3 to i64
+  %163 = xor i64 %161, %162
+  %164 = zext i32 %159 to i64
+  %165 = xor i64 %163, %164
+  %166 = xor i64 %165, %7
+  br label %merge
+
+case15:                                           ; preds = %entry
+  %167 = xor i32 %5, %5
+  %168 = and i32 %4, %4
+  %169 = sub i64 %6, %6
+  %170 = add i64 %6, %6
+  %171 = zext i8 %1 to i64
+  %172 = zext i16 %3 to i64
+  %173 = xor i64 %171, %172
+  %174 = zext i32 %168 to i64
+  %175 = xor i64 %173, %174
+  %176 = xor i64 %175, %170
+  br label %merge
+
+default:                                          ; preds = %entry
+  %177 = add i16 %3, %2
+  %178 = xor i16 %177, %177
+  %179 = add i16 %3, %2
+  %180 = and i8 %1, %1
+  %181 = zext i8 %180 to i64
+  %182 = zext i16 %179 to i64
+  %183 = xor i64 %181, %182
+  %184 = zext i32 %5 to i64
+  %185 = xor i64 %183, %184
+  %186 = xor i64 %185, %7
+  br label %merge
+}
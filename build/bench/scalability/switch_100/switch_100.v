@@ -0,0 +1,2069 @@
+module switch_100
+(
+	input wire  clk,
+	input wire  reset,
+	input wire  start,
+	output reg  finish,
+	output reg [63:0] return_val,
+	input wire [7:0] arg_0,
+	input wire [7:0] arg_1,
+	input wire [15:0] arg_2,
+	input wire [15:0] arg_3,
+	input wire [31:0] arg_4,
+	input wire [31:0] arg_5,
+	input wire [63:0] arg_6,
+	input wire [63:0] arg_7
+);
+
+parameter [4:0] BPHLS = 5'd0;
+parameter [4:0] BPHLS_F_switch_100_BB_0_S_0 = 5'd1;
+parameter [4:0] BPHLS_F_switch_100_BB_1_S_0 = 5'd2;
+parameter [4:0] BPHLS_F_switch_100_BB_2_S_0 = 5'd3;
+parameter [4:0] BPHLS_F_switch_100_BB_3_S_0 = 5'd4;
+parameter [4:0] BPHLS_F_switch_100_BB_4_S_0 = 5'd5;
+parameter [4:0] BPHLS_F_switch_100_BB_5_S_0 = 5'd6;
+parameter [4:0] BPHLS_F_switch_100_BB_5_S_1 = 5'd7;
+parameter [4:0] BPHLS_F_switch_100_BB_6_S_0 = 5'd8;
+parameter [4:0] BPHLS_F_switch_100_BB_6_S_1 = 5'd9;
+parameter [4:0] BPHLS_F_switch_100_BB_7_S_0 = 5'd10;
+parameter [4:0] BPHLS_F_switch_100_BB_8_S_0 = 5'd11;
+parameter [4:0] BPHLS_F_switch_100_BB_9_S_0 = 5'd12;
+parameter [4:0] BPHLS_F_switch_100_BB_10_S_0 = 5'd13;
+parameter [4:0] BPHLS_F_switch_100_BB_11_S_0 = 5'd14;
+parameter [4:0] BPHLS_F_switch_100_BB_12_S_0 = 5'd15;
+parameter [4:0] BPHLS_F_switch_100_BB_13_S_0 = 5'd16;
+parameter [4:0] BPHLS_F_switch_100_BB_13_S_1 = 5'd17;
+parameter [4:0] BPHLS_F_switch_100_BB_14_S_0 = 5'd18;
+parameter [4:0] BPHLS_F_switch_100_BB_15_S_0 = 5'd19;
+parameter [4:0] BPHLS_F_switch_100_BB_16_S_0 = 5'd20;
+parameter [4:0] BPHLS_F_switch_100_BB_16_S_1 = 5'd21;
+parameter [4:0] BPHLS_F_switch_100_BB_16_S_2 = 5'd22;
+parameter [4:0] BPHLS_F_switch_100_BB_17_S_0 = 5'd23;
+parameter [4:0] BPHLS_F_switch_100_BB_18_S_0 = 5'd24;
+
+reg [4:0] cur_state;
+reg [4:0] next_state;
+wire [63:0] switch_100_merge_8;
+reg [63:0] switch_100_merge_8_reg;
+reg [15:0] switch_100_case0_9;
+reg [15:0] switch_100_case0_9_reg;
+reg [31:0] switch_100_case0_10;
+reg [31:0] switch_100_case0_10_reg;
+reg [7:0] switch_100_case0_11;
+reg [7:0] switch_100_case0_11_reg;
+reg [63:0] switch_100_case0_12;
+reg [63:0] switch_100_case0_12_reg;
+reg [63:0] switch_100_case0_13;
+reg [15:0] switch_100_case0_13_reg;
+reg [63:0] switch_100_case0_14;
+reg [63:0] switch_100_case0_14_reg;
+reg [63:0] switch_100_case0_15;
+reg [63:0] switch_100_case0_15_reg;
+reg [7:0] switch_100_case1_16;
+reg [7:0] switch_100_case1_16_reg;
+reg [31:0] switch_100_case1_17;
+reg [31:0] switch_100_case1_17_reg;
+reg [15:0] switch_100_case1_18;
+reg [15:0] switch_100_case1_18_reg;
+reg [7:0] switch_100_case1_19;
+reg [7:0] switch_100_case1_19_reg;
+reg [63:0] switch_100_case1_20;
+reg [63:0] switch_100_case1_20_reg;
+reg [63:0] switch_100_case1_21;
+reg [31:0] switch_100_case1_21_reg;
+reg [63:0] switch_100_case1_22;
+reg [63:0] switch_100_case1_22_reg;
+reg [15:0] switch_100_case2_23;
+reg [15:0] switch_100_case2_23_reg;
+reg [63:0] switch_100_case2_24;
+reg [63:0] switch_100_case2_24_reg;
+reg [7:0] switch_100_case2_25;
+reg [7:0] switch_100_case2_25_reg;
+reg [15:0] switch_100_case2_26;
+reg [15:0] switch_100_case2_26_reg;
+reg [63:0] switch_100_case2_27;
+reg [31:0] switch_100_case2_27_reg;
+reg [63:0] switch_100_case2_28;
+reg [63:0] switch_100_case2_28_reg;
+reg [63:0] switch_100_case2_29;
+reg [63:0] switch_100_case2_29_reg;
+reg [63:0] switch_100_case3_31;
+reg  switch_100_case3_31_reg;
+reg [7:0] switch_100_case3_33;
+reg [7:0] switch_100_case3_33_reg;
+reg [63:0] switch_100_case3_34;
+reg [31:0] switch_100_case3_34_reg;
+reg [63:0] switch_100_case3_35;
+reg [63:0] switch_100_case3_35_reg;
+reg [63:0] switch_100_case3_36;
+reg [63:0] switch_100_case3_36_reg;
+reg [63:0] switch_100_case4_37;
+reg [63:0] switch_100_case4_37_reg;
+reg [31:0] switch_100_case4_38;
+reg  switch_100_case4_38_reg;
+reg [31:0] switch_100_case4_40;
+reg [31:0] switch_100_case4_40_reg;
+reg [63:0] switch_100_case4_41;
+reg [15:0] switch_100_case4_41_reg;
+reg [63:0] switch_100_case4_42;
+reg [63:0] switch_100_case4_42_reg;
+reg [63:0] switch_100_case4_43;
+reg [63:0] switch_100_case4_43_reg;
+reg [15:0] switch_100_case5_45;
+reg [15:0] switch_100_case5_45_reg;
+reg [63:0] switch_100_case5_46;
+reg [63:0] switch_100_case5_46_reg;
+reg [31:0] switch_100_case5_47;
+reg [31:0] switch_100_case5_47_reg;
+reg [63:0] switch_100_case5_48;
+reg [15:0] switch_100_case5_48_reg;
+reg [63:0] switch_100_case5_49;
+reg [63:0] switch_100_case5_49_reg;
+reg [63:0] switch_100_case5_50;
+reg [63:0] switch_100_case5_50_reg;
+reg [7:0] switch_100_case6_51;
+reg [7:0] switch_100_case6_51_reg;
+reg [63:0] switch_100_case6_52;
+reg [7:0] switch_100_case6_52_reg;
+reg [31:0] switch_100_case6_53;
+reg [31:0] switch_100_case6_53_reg;
+reg [15:0] switch_100_case6_54;
+reg [15:0] switch_100_case6_54_reg;
+reg [63:0] switch_100_case6_55;
+reg [15:0] switch_100_case6_55_reg;
+reg [63:0] switch_100_case6_56;
+reg [31:0] switch_100_case6_56_reg;
+reg [63:0] switch_100_case6_57;
+reg [31:0] switch_100_case6_57_reg;
+reg [63:0] switch_100_case7_58;
+reg [63:0] switch_100_case7_58_reg;
+reg [7:0] switch_100_case7_59;
+reg [7:0] switch_100_case7_59_reg;
+reg [15:0] switch_100_case7_60;
+reg [15:0] switch_100_case7_60_reg;
+reg [31:0] switch_100_case7_61;
+reg [31:0] switch_100_case7_61_reg;
+reg [63:0] switch_100_case7_62;
+reg [31:0] switch_100_case7_62_reg;
+reg [63:0] switch_100_case7_63;
+reg [63:0] switch_100_case7_63_reg;
+reg [63:0] switch_100_case7_64;
+reg [63:0] switch_100_case7_64_reg;
+reg [63:0] switch_100_case8_65;
+reg [63:0] switch_100_case8_65_reg;
+reg [7:0] switch_100_case8_66;
+reg [7:0] switch_100_case8_66_reg;
+reg [31:0] switch_100_case8_67;
+reg [31:0] switch_100_case8_67_reg;
+reg [63:0] switch_100_case8_68;
+reg [31:0] switch_100_case8_68_reg;
+reg [63:0] switch_100_case8_69;
+reg [31:0] switch_100_case8_69_reg;
+reg [63:0] switch_100_case8_70;
+reg [63:0] switch_100_case8_70_reg;
+reg [63:0] switch_100_case8_71;
+reg [63:0] switch_100_case8_71_reg;
+reg [7:0] switch_100_case9_72;
+reg [7:0] switch_100_case9_72_reg;
+reg [7:0] switch_100_case9_74;
+reg [7:0] switch_100_case9_74_reg;
+reg [63:0] switch_100_case9_75;
+reg [63:0] switch_100_case9_75_reg;
+reg [63:0] switch_100_case9_76;
+reg [31:0] switch_100_case9_76_reg;
+reg [63:0] switch_100_case9_77;
+reg [63:0] switch_100_case9_77_reg;
+reg [63:0] switch_100_case9_78;
+reg [63:0] switch_100_case9_78_reg;
+reg [15:0] switch_100_case10_79;
+reg [15:0] switch_100_case10_79_reg;
+reg [7:0] switch_100_case10_80;
+reg [7:0] switch_100_case10_80_reg;
+reg [31:0] switch_100_case10_81;
+reg [31:0] switch_100_case10_81_reg;
+reg [63:0] switch_100_case10_82;
+reg [63:0] switch_100_case10_82_reg;
+reg [63:0] switch_100_case10_83;
+reg [15:0] switch_100_case10_83_reg;
+reg [63:0] switch_100_case10_84;
+reg [63:0] switch_100_case10_84_reg;
+reg [63:0] switch_100_case10_85;
+reg [63:0] switch_100_case10_85_reg;
+reg [63:0] switch_100_case11_87;
+reg [63:0] switch_100_case11_87_reg;
+reg [31:0] switch_100_case11_88;
+reg [31:0] switch_100_case11_88_reg;
+reg [15:0] switch_100_case11_89;
+reg [15:0] switch_100_case11_89_reg;
+reg [63:0] switch_100_case11_90;
+reg [15:0] switch_100_case11_90_reg;
+reg [63:0] switch_100_case11_91;
+reg [63:0] switch_100_case11_91_reg;
+reg [63:0] switch_100_case11_92;
+reg [63:0] switch_100_case11_92_reg;
+reg [7:0] switch_100_case12_93;
+reg [7:0] switch_100_case12_93_reg;
+reg [15:0] switch_100_case12_94;
+reg [15:0] switch_100_case12_94_reg;
+reg [7:0] switch_100_case12_95;
+reg [7:0] switch_100_case12_95_reg;
+reg [63:0] switch_100_case12_96;
+reg [63:0] switch_100_case12_96_reg;
+reg [63:0] switch_100_case12_97;
+reg [63:0] switch_100_case12_97_reg;
+reg [63:0] switch_100_case12_98;
+reg [63:0] switch_100_case12_98_reg;
+reg [63:0] switch_100_case12_99;
+reg [63:0] switch_100_case12_99_reg;
+reg [63:0] switch_100_case13_100;
+reg [63:0] switch_100_case13_100_reg;
+reg [7:0] switch_100_case13_102;
+reg [7:0] switch_100_case13_102_reg;
+reg [31:0] switch_100_case13_103;
+reg [31:0] switch_100_case13_103_reg;
+reg [63:0] switch_100_case13_104;
+reg [15:0] switch_100_case13_104_reg;
+reg [63:0] switch_100_case13_105;
+reg [63:0] switch_100_case13_105_reg;
+reg [63:0] switch_100_case13_106;
+reg [63:0] switch_100_case13_106_reg;
+reg [31:0] switch_100_case14_107;
+reg [31:0] switch_100_case14_107_reg;
+reg [31:0] switch_100_case14_109;
+reg [31:0] switch_100_case14_109_reg;
+reg [7:0] switch_100_case14_110;
+reg [7:0] switch_100_case14_110_reg;
+reg [63:0] switch_100_case14_111;
+reg [63:0] switch_100_case14_111_reg;
+reg [63:0] switch_100_case14_112;
+reg [31:0] switch_100_case14_112_reg;
+reg [63:0] switch_100_case14_113;
+reg [63:0] switch_100_case14_113_reg;
+reg [31:0] switch_100_case15_115;
+reg [31:0] switch_100_case15_115_reg;
+reg [63:0] switch_100_case15_117;
+reg [63:0] switch_100_case15_117_reg;
+reg [63:0] switch_100_case15_118;
+reg [15:0] switch_100_case15_118_reg;
+reg [63:0] switch_100_case15_119;
+reg [31:0] switch_100_case15_119_reg;
+reg [63:0] switch_100_case15_120;
+reg [63:0] switch_100_case15_120_reg;
+reg [15:0] switch_100_default_121;
+reg [15:0] switch_100_default_121_reg;
+reg [15:0] switch_100_default_123;
+reg [15:0] switch_100_default_123_reg;
+reg [7:0] switch_100_default_124;
+reg [7:0] switch_100_default_124_reg;
+reg [63:0] switch_100_default_125;
+reg [63:0] switch_100_default_125_reg;
+reg [63:0] switch_100_default_126;
+reg [15:0] switch_100_default_126_reg;
+reg [63:0] switch_100_default_127;
+reg [63:0] switch_100_default_127_reg;
+reg [7:0] switch_100_case0_mul_8_8_0_op0;
+reg [7:0] switch_100_case0_mul_8_8_0_op1;
+reg [7:0] switch_100_case0_mul_8_8_0;
+reg [31:0] switch_100_case0_or_32_32_0_op0;
+reg [31:0] switch_100_case0_or_32_32_0_op1;
+reg [31:0] switch_100_case0_or_32_32_0;
+reg [15:0] switch_100_case0_add_16_16_0_op0;
+reg [15:0] switch_100_case0_add_16_16_0_op1;
+reg [15:0] switch_100_case0_add_16_16_0;
+reg [15:0] switch_100_case1_and_16_16_0_op0;
+reg [15:0] switch_100_case1_and_16_16_0_op1;
+reg [15:0] switch_100_case1_and_16_16_0;
+reg [7:0] switch_100_case1_and_8_8_0_op0;
+reg [7:0] switch_100_case1_and_8_8_0_op1;
+reg [7:0] switch_100_case1_and_8_8_0;
+reg [7:0] switch_100_case2_add_8_8_0_op0;
+reg [7:0] switch_100_case2_add_8_8_0_op1;
+reg [7:0] switch_100_case2_add_8_8_0;
+reg [15:0] switch_100_case2_add_16_16_0_op0;
+reg [15:0] switch_100_case2_add_16_16_0_op1;
+reg [15:0] switch_100_case2_add_16_16_0;
+reg [7:0] switch_100_case3_or_8_8_0_op0;
+reg [7:0] switch_100_case3_or_8_8_0_op1;
+reg [7:0] switch_100_case3_or_8_8_0;
+reg [7:0] switch_100_case3_add_8_8_0_op0;
+reg [7:0] switch_100_case3_add_8_8_0_op1;
+reg [7:0] switch_100_case3_add_8_8_0;
+reg [31:0] switch_100_case4_and_32_32_0_op0;
+reg [31:0] switch_100_case4_and_32_32_0_op1;
+reg [31:0] switch_100_case4_and_32_32_0;
+reg [15:0] switch_100_case5_and_16_16_0_op0;
+reg [15:0] switch_100_case5_and_16_16_0_op1;
+reg [15:0] switch_100_case5_and_16_16_0;
+reg [7:0] switch_100_case6_mul_8_8_0_op0;
+reg [7:0] switch_100_case6_mul_8_8_0_op1;
+reg [7:0] switch_100_case6_mul_8_8_0;
+reg [15:0] switch_100_case6_add_16_16_0_op0;
+reg [15:0] switch_100_case6_add_16_16_0_op1;
+reg [15:0] switch_100_case6_add_16_16_0;
+reg [15:0] switch_100_case7_mul_16_16_0_op0;
+reg [7:0] switch_100_case7_mul_16_16_0_op1;
+reg [15:0] switch_100_case7_mul_16_16_0;
+reg [7:0] switch_100_case8_and_8_8_0_op0;
+reg [7:0] switch_100_case8_and_8_8_0_op1;
+reg [7:0] switch_100_case8_and_8_8_0;
+reg [7:0] switch_100_case9_add_8_8_0_op0;
+reg [7:0] switch_100_case9_add_8_8_0_op1;
+reg [7:0] switch_100_case9_add_8_8_0;
+reg [7:0] switch_100_case9_and_8_8_0_op0;
+reg [7:0] switch_100_case9_and_8_8_0_op1;
+reg [7:0] switch_100_case9_and_8_8_0;
+reg [15:0] switch_100_case10_and_16_16_0_op0;
+reg [15:0] switch_100_case10_and_16_16_0_op1;
+reg [15:0] switch_100_case10_and_16_16_0;
+reg [7:0] switch_100_case10_or_8_8_0_op0;
+reg [7:0] switch_100_case10_or_8_8_0_op1;
+reg [7:0] switch_100_case10_or_8_8_0;
+reg [31:0] switch_100_case11_or_32_32_0_op0;
+reg [31:0] switch_100_case11_or_32_32_0_op1;
+reg [31:0] switch_100_case11_or_32_32_0;
+reg [7:0] switch_100_case12_add_8_8_0_op0;
+reg [7:0] switch_100_case12_add_8_8_0_op1;
+reg [7:0] switch_100_case12_add_8_8_0;
+reg [7:0] switch_100_case12_add_8_8_1_op0;
+reg [7:0] switch_100_case12_add_8_8_1_op1;
+reg [7:0] switch_100_case12_add_8_8_1;
+reg [15:0] switch_100_case12_add_16_16_0_op0;
+reg [15:0] switch_100_case12_add_16_16_0_op1;
+reg [15:0] switch_100_case12_add_16_16_0;
+reg [31:0] switch_100_case13_and_32_32_0_op0;
+reg [31:0] switch_100_case13_and_32_32_0_op1;
+reg [31:0] switch_100_case13_and_32_32_0;
+reg [7:0] switch_100_case13_and_8_8_0_op0;
+reg [7:0] switch_100_case13_and_8_8_0_op1;
+reg [7:0] switch_100_case13_and_8_8_0;
+reg [7:0] switch_100_case14_mul_8_8_0_op0;
+reg [7:0] switch_100_case14_mul_8_8_0_op1;
+reg [7:0] switch_100_case14_mul_8_8_0;
+reg [31:0] switch_100_case14_mul_32_32_0_op0;
+reg [31:0] switch_100_case14_mul_32_32_0_op1;
+reg [31:0] switch_100_case14_mul_32_32_0;
+reg [31:0] switch_100_case15_and_32_32_0_op0;
+reg [31:0] switch_100_case15_and_32_32_0_op1;
+reg [31:0] switch_100_case15_and_32_32_0;
+reg [7:0] switch_100_default_and_8_8_0_op0;
+reg [7:0] switch_100_default_and_8_8_0_op1;
+reg [7:0] switch_100_default_and_8_8_0;
+reg [15:0] switch_100_default_add_16_16_0_op0;
+reg [15:0] switch_100_default_add_16_16_0_op1;
+reg [15:0] switch_100_default_add_16_16_0;
+reg [15:0] switch_100_default_add_16_16_1_op0;
+reg [15:0] switch_100_default_add_16_16_1_op1;
+reg [15:0] switch_100_default_add_16_16_1;
+reg [7:0] switch_100_case3_30;
+reg [7:0] switch_100_case3_32;
+reg [31:0] switch_100_case4_39;
+reg [63:0] switch_100_case5_44;
+reg [63:0] switch_100_case9_73;
+reg [15:0] switch_100_case11_86;
+reg [31:0] switch_100_case13_101;
+reg [31:0] switch_100_case14_108;
+reg [31:0] switch_100_case15_114;
+reg [63:0] switch_100_case15_116;
+reg [15:0] switch_100_default_122;
+
+/* FSM BEGIN ---------------------------------------------------------------*/
+
+always @ (posedge clk) begin
+	if (reset == 1'b1) begin
+		cur_state <= BPHLS;
+	end else begin 
+		cur_state <= next_state;
+	end
+end
+
+always @ (*) begin
+	next_state = cur_state;
+
+	case (cur_state)
+	BPHLS:
+		if ((start == 1'd1)) begin
+			next_state = BPHLS_F_switch_100_BB_0_S_0;
+		end
+	BPHLS_F_switch_100_BB_0_S_0:
+		if ((arg_0 == 1'd1)) begin
+			next_state = BPHLS_F_switch_100_BB_2_S_0;
+		end
+		else if ((arg_0 == 1'd0)) begin
+			next_state = BPHLS_F_switch_100_BB_18_S_0;
+		end
+	BPHLS_F_switch_100_BB_10_S_0:
+		next_state = BPHLS_F_switch_100_BB_1_S_0;
+	BPHLS_F_switch_100_BB_11_S_0:
+		next_state = BPHLS_F_switch_100_BB_1_S_0;
+	BPHLS_F_switch_100_BB_12_S_0:
+		next_state = BPHLS_F_switch_100_BB_1_S_0;
+	BPHLS_F_switch_100_BB_13_S_0:
+		next_state = BPHLS_F_switch_100_BB_13_S_1;
+	BPHLS_F_switch_100_BB_13_S_1:
+		next_state = BPHLS_F_switch_100_BB_1_S_0;
+	BPHLS_F_switch_100_BB_14_S_0:
+		next_state = BPHLS_F_switch_100_BB_1_S_0;
+	BPHLS_F_switch_100_BB_15_S_0:
+		next_state = BPHLS_F_switch_100_BB_1_S_0;
+	BPHLS_F_switch_100_BB_16_S_0:
+		next_state = BPHLS_F_switch_100_BB_16_S_1;
+	BPHLS_F_switch_100_BB_16_S_1:
+		next_state = BPHLS_F_switch_100_BB_16_S_2;
+	BPHLS_F_switch_100_BB_16_S_2:
+		next_state = BPHLS_F_switch_100_BB_1_S_0;
+	BPHLS_F_switch_100_BB_17_S_0:
+		next_state = BPHLS_F_switch_100_BB_1_S_0;
+	BPHLS_F_switch_100_BB_18_S_0:
+		next_state = BPHLS_F_switch_100_BB_1_S_0;
+	BPHLS_F_switch_100_BB_1_S_0:
+		next_state = BPHLS;
+	BPHLS_F_switch_100_BB_2_S_0:
+		next_state = BPHLS_F_switch_100_BB_1_S_0;
+	BPHLS_F_switch_100_BB_3_S_0:
+		next_state = BPHLS_F_switch_100_BB_1_S_0;
+	BPHLS_F_switch_100_BB_4_S_0:
+		next_state = BPHLS_F_switch_100_BB_1_S_0;
+	BPHLS_F_switch_100_BB_5_S_0:
+		next_state = BPHLS_F_switch_100_BB_5_S_1;
+	BPHLS_F_switch_100_BB_5_S_1:
+		next_state = BPHLS_F_switch_100_BB_1_S_0;
+	BPHLS_F_switch_100_BB_6_S_0:
+		next_state = BPHLS_F_switch_100_BB_6_S_1;
+	BPHLS_F_switch_100_BB_6_S_1:
+		next_state = BPHLS_F_switch_100_BB_1_S_0;
+	BPHLS_F_switch_100_BB_7_S_0:
+		next_state = BPHLS_F_switch_100_BB_1_S_0;
+	BPHLS_F_switch_100_BB_8_S_0:
+		next_state = BPHLS_F_switch_100_BB_1_S_0;
+	BPHLS_F_switch_100_BB_9_S_0:
+		next_state = BPHLS_F_switch_100_BB_1_S_0;
+	default:
+		next_state = cur_state;
+	endcase
+end
+
+/* FSM END -----------------------------------------------------------------*/
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_2_S_0)) begin
+		switch_100_merge_8_reg[63:0] <= switch_100_case0_15[63:0];
+	end
+	if ((cur_state == BPHLS_F_switch_100_BB_3_S_0)) begin
+		switch_100_merge_8_reg[63:0] <= switch_100_case1_22[63:0];
+	end
+	if ((cur_state == BPHLS_F_switch_100_BB_4_S_0)) begin
+		switch_100_merge_8_reg[63:0] <= switch_100_case2_29[63:0];
+	end
+	if ((cur_state == BPHLS_F_switch_100_BB_5_S_1)) begin
+		switch_100_merge_8_reg[63:0] <= switch_100_case3_36_reg[63:0];
+	end
+	if ((cur_state == BPHLS_F_switch_100_BB_6_S_1)) begin
+		switch_100_merge_8_reg[63:0] <= switch_100_case4_43[63:0];
+	end
+	if ((cur_state == BPHLS_F_switch_100_BB_7_S_0)) begin
+		switch_100_merge_8_reg[63:0] <= switch_100_case5_50[63:0];
+	end
+	if ((cur_state == BPHLS_F_switch_100_BB_8_S_0)) begin
+		switch_100_merge_8_reg[63:0] <= switch_100_case6_57[63:0];
+	end
+	if ((cur_state == BPHLS_F_switch_100_BB_9_S_0)) begin
+		switch_100_merge_8_reg[63:0] <= switch_100_case7_64[63:0];
+	end
+	if ((cur_state == BPHLS_F_switch_100_BB_10_S_0)) begin
+		switch_100_merge_8_reg[63:0] <= switch_100_case8_71[63:0];
+	end
+	if ((cur_state == BPHLS_F_switch_100_BB_11_S_0)) begin
+		switch_100_merge_8_reg[63:0] <= switch_100_case9_78[63:0];
+	end
+	if ((cur_state == BPHLS_F_switch_100_BB_12_S_0)) begin
+		switch_100_merge_8_reg[63:0] <= switch_100_case10_85[63:0];
+	end
+	if ((cur_state == BPHLS_F_switch_100_BB_13_S_1)) begin
+		switch_100_merge_8_reg[63:0] <= switch_100_case11_92[63:0];
+	end
+	if ((cur_state == BPHLS_F_switch_100_BB_14_S_0)) begin
+		switch_100_merge_8_reg[63:0] <= switch_100_case12_99[63:0];
+	end
+	if ((cur_state == BPHLS_F_switch_100_BB_15_S_0)) begin
+		switch_100_merge_8_reg[63:0] <= switch_100_case13_106[63:0];
+	end
+	if ((cur_state == BPHLS_F_switch_100_BB_16_S_2)) begin
+		switch_100_merge_8_reg[63:0] <= switch_100_case14_113_reg[63:0];
+	end
+	if ((cur_state == BPHLS_F_switch_100_BB_17_S_0)) begin
+		switch_100_merge_8_reg[63:0] <= switch_100_case15_120[63:0];
+	end
+	if ((cur_state == BPHLS_F_switch_100_BB_18_S_0)) begin
+		switch_100_merge_8_reg[63:0] <= switch_100_default_127[63:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case0_9[15:0] = switch_100_case0_add_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_2_S_0)) begin
+		switch_100_case0_9_reg[15:0] <= switch_100_case0_9[15:0];
+	end
+	if ((cur_state == BPHLS_F_switch_100_BB_4_S_0)) begin
+		switch_100_case0_9_reg[15:0] <= switch_100_case2_23[15:0];
+	end
+	if ((cur_state == BPHLS_F_switch_100_BB_8_S_0)) begin
+		switch_100_case0_9_reg[15:0] <= switch_100_case6_54[15:0];
+	end
+	if ((cur_state == BPHLS_F_switch_100_BB_14_S_0)) begin
+		switch_100_case0_9_reg[15:0] <= switch_100_case12_94[15:0];
+	end
+	if ((cur_state == BPHLS_F_switch_100_BB_18_S_0)) begin
+		switch_100_case0_9_reg[15:0] <= switch_100_default_121[15:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case0_10[31:0] = switch_100_case0_or_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_2_S_0)) begin
+		switch_100_case0_10_reg[31:0] <= switch_100_case0_10[31:0];
+	end
+	if ((cur_state == BPHLS_F_switch_100_BB_13_S_0)) begin
+		switch_100_case0_10_reg[31:0] <= switch_100_case11_88[31:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case0_11[7:0] = switch_100_case0_mul_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_2_S_0)) begin
+		switch_100_case0_11_reg[7:0] <= switch_100_case0_11[7:0];
+	end
+	if ((cur_state == BPHLS_F_switch_100_BB_8_S_0)) begin
+		switch_100_case0_11_reg[7:0] <= switch_100_case6_51[7:0];
+	end
+	if ((cur_state == BPHLS_F_switch_100_BB_16_S_0)) begin
+		switch_100_case0_11_reg[7:0] <= switch_100_case14_110[7:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case0_12[63:0] = (arg_7 ^ arg_6);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_2_S_0)) begin
+		switch_100_case0_12_reg[63:0] <= switch_100_case0_12[63:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case0_13[63:0] = (switch_100_case0_11 ^ switch_100_case0_9);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_2_S_0)) begin
+		switch_100_case0_13_reg[15:0] <= switch_100_case0_13[15:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case0_14[63:0] = (switch_100_case0_10 ^ switch_100_case0_12);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_2_S_0)) begin
+		switch_100_case0_14_reg[63:0] <= switch_100_case0_14[63:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case0_15[63:0] = (switch_100_case0_13 ^ switch_100_case0_14);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_2_S_0)) begin
+		switch_100_case0_15_reg[63:0] <= switch_100_case0_15[63:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case1_16[7:0] = switch_100_case1_and_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_3_S_0)) begin
+		switch_100_case1_16_reg[7:0] <= switch_100_case1_16[7:0];
+	end
+	if ((cur_state == BPHLS_F_switch_100_BB_10_S_0)) begin
+		switch_100_case1_16_reg[7:0] <= switch_100_case8_66[7:0];
+	end
+	if ((cur_state == BPHLS_F_switch_100_BB_11_S_0)) begin
+		switch_100_case1_16_reg[7:0] <= switch_100_case9_72[7:0];
+	end
+	if ((cur_state == BPHLS_F_switch_100_BB_15_S_0)) begin
+		switch_100_case1_16_reg[7:0] <= switch_100_case13_102[7:0];
+	end
+	if ((cur_state == BPHLS_F_switch_100_BB_18_S_0)) begin
+		switch_100_case1_16_reg[7:0] <= switch_100_default_124[7:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case1_17[31:0] = (arg_4 ^ arg_2);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_3_S_0)) begin
+		switch_100_case1_17_reg[31:0] <= switch_100_case1_17[31:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case1_18[15:0] = switch_100_case1_and_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_3_S_0)) begin
+		switch_100_case1_18_reg[15:0] <= switch_100_case1_18[15:0];
+	end
+	if ((cur_state == BPHLS_F_switch_100_BB_7_S_0)) begin
+		switch_100_case1_18_reg[15:0] <= switch_100_case5_45[15:0];
+	end
+	if ((cur_state == BPHLS_F_switch_100_BB_12_S_0)) begin
+		switch_100_case1_18_reg[15:0] <= switch_100_case10_79[15:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case1_19[7:0] = (arg_1 - switch_100_case1_16);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_3_S_0)) begin
+		switch_100_case1_19_reg[7:0] <= switch_100_case1_19[7:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case1_20[63:0] = (arg_7 ^ switch_100_case1_18);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_3_S_0)) begin
+		switch_100_case1_20_reg[63:0] <= switch_100_case1_20[63:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case1_21[63:0] = (switch_100_case1_17 ^ switch_100_case1_19);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_3_S_0)) begin
+		switch_100_case1_21_reg[31:0] <= switch_100_case1_21[31:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case1_22[63:0] = (switch_100_case1_20 ^ switch_100_case1_21);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_3_S_0)) begin
+		switch_100_case1_22_reg[63:0] <= switch_100_case1_22[63:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case2_23[15:0] = switch_100_case2_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	switch_100_case2_23_reg[15:0] = switch_100_case0_9_reg[15:0];
+end
+
+always @ (*) begin
+	switch_100_case2_24[63:0] = (arg_6 + arg_6);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_4_S_0)) begin
+		switch_100_case2_24_reg[63:0] <= switch_100_case2_24[63:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case2_25[7:0] = switch_100_case2_add_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_4_S_0)) begin
+		switch_100_case2_25_reg[7:0] <= switch_100_case2_25[7:0];
+	end
+	if ((cur_state == BPHLS_F_switch_100_BB_5_S_0)) begin
+		switch_100_case2_25_reg[7:0] <= switch_100_case3_33[7:0];
+	end
+	if ((cur_state == BPHLS_F_switch_100_BB_11_S_0)) begin
+		switch_100_case2_25_reg[7:0] <= switch_100_case9_74[7:0];
+	end
+	if ((cur_state == BPHLS_F_switch_100_BB_14_S_0)) begin
+		switch_100_case2_25_reg[7:0] <= switch_100_case12_93[7:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case2_26[15:0] = (switch_100_case2_23 ^ switch_100_case2_23);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_4_S_0)) begin
+		switch_100_case2_26_reg[15:0] <= switch_100_case2_26[15:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case2_27[63:0] = (arg_5 ^ switch_100_case2_25);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_4_S_0)) begin
+		switch_100_case2_27_reg[31:0] <= switch_100_case2_27[31:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case2_28[63:0] = (switch_100_case2_24 ^ switch_100_case2_26);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_4_S_0)) begin
+		switch_100_case2_28_reg[63:0] <= switch_100_case2_28[63:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case2_29[63:0] = (switch_100_case2_27 ^ switch_100_case2_28);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_4_S_0)) begin
+		switch_100_case2_29_reg[63:0] <= switch_100_case2_29[63:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case3_31[63:0] = (arg_7 - arg_7);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_5_S_0)) begin
+		switch_100_case3_31_reg <= switch_100_case3_31;
+	end
+end
+
+always @ (*) begin
+	switch_100_case3_33[7:0] = switch_100_case3_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	switch_100_case3_33_reg[7:0] = switch_100_case2_25_reg[7:0];
+end
+
+always @ (*) begin
+	switch_100_case3_34[63:0] = (arg_3 ^ arg_5);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_5_S_0)) begin
+		switch_100_case3_34_reg[31:0] <= switch_100_case3_34[31:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case3_35[63:0] = (switch_100_case3_33 ^ switch_100_case3_31);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_5_S_0)) begin
+		switch_100_case3_35_reg[63:0] <= switch_100_case3_35[63:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case3_36[63:0] = (switch_100_case3_34 ^ switch_100_case3_35);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_5_S_0)) begin
+		switch_100_case3_36_reg[63:0] <= switch_100_case3_36[63:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case4_37[63:0] = (arg_7 * arg_6);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_6_S_0)) begin
+		switch_100_case4_37_reg[63:0] <= switch_100_case4_37[63:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case4_38[31:0] = (arg_4 - arg_4);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_6_S_0)) begin
+		switch_100_case4_38_reg <= switch_100_case4_38;
+	end
+end
+
+always @ (*) begin
+	switch_100_case4_40[31:0] = switch_100_case4_and_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_6_S_1)) begin
+		switch_100_case4_40_reg[31:0] <= switch_100_case4_40;
+	end
+	if ((cur_state == BPHLS_F_switch_100_BB_15_S_0)) begin
+		switch_100_case4_40_reg[31:0] <= switch_100_case13_103[31:0];
+	end
+	if ((cur_state == BPHLS_F_switch_100_BB_17_S_0)) begin
+		switch_100_case4_40_reg[31:0] <= switch_100_case15_115[31:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case4_41[63:0] = (arg_1 ^ arg_3);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_6_S_0)) begin
+		switch_100_case4_41_reg[15:0] <= switch_100_case4_41[15:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case4_42[63:0] = (switch_100_case4_37_reg ^ switch_100_case4_41_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_6_S_1)) begin
+		switch_100_case4_42_reg[63:0] <= switch_100_case4_42[63:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case4_43[63:0] = (switch_100_case4_40 ^ switch_100_case4_42);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_6_S_1)) begin
+		switch_100_case4_43_reg[63:0] <= switch_100_case4_43[63:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case5_45[15:0] = switch_100_case5_and_16_16_0[15:0];
+end
+
+always @ (*) begin
+	switch_100_case5_45_reg[15:0] = switch_100_case1_18_reg[15:0];
+end
+
+always @ (*) begin
+	switch_100_case5_46[63:0] = (arg_7 - arg_0);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_7_S_0)) begin
+		switch_100_case5_46_reg[63:0] <= switch_100_case5_46[63:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case5_47[31:0] = (arg_4 ^ arg_4);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_7_S_0)) begin
+		switch_100_case5_47_reg[31:0] <= switch_100_case5_47[31:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case5_48[63:0] = (arg_1 ^ switch_100_case5_45);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_7_S_0)) begin
+		switch_100_case5_48_reg[15:0] <= switch_100_case5_48[15:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case5_49[63:0] = (switch_100_case5_47 ^ switch_100_case5_46);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_7_S_0)) begin
+		switch_100_case5_49_reg[63:0] <= switch_100_case5_49[63:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case5_50[63:0] = (switch_100_case5_48 ^ switch_100_case5_49);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_7_S_0)) begin
+		switch_100_case5_50_reg[63:0] <= switch_100_case5_50[63:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case6_51[7:0] = switch_100_case6_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	switch_100_case6_51_reg[7:0] = switch_100_case0_11_reg[7:0];
+end
+
+always @ (*) begin
+	switch_100_case6_52[63:0] = (arg_6 & arg_1);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_8_S_0)) begin
+		switch_100_case6_52_reg[7:0] <= switch_100_case6_52[7:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case6_53[31:0] = (arg_5 ^ arg_4);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_8_S_0)) begin
+		switch_100_case6_53_reg[31:0] <= switch_100_case6_53[31:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case6_54[15:0] = switch_100_case6_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	switch_100_case6_54_reg[15:0] = switch_100_case0_9_reg[15:0];
+end
+
+always @ (*) begin
+	switch_100_case6_55[63:0] = (switch_100_case6_51 ^ switch_100_case6_54);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_8_S_0)) begin
+		switch_100_case6_55_reg[15:0] <= switch_100_case6_55[15:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case6_56[63:0] = (switch_100_case6_53 ^ switch_100_case6_52);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_8_S_0)) begin
+		switch_100_case6_56_reg[31:0] <= switch_100_case6_56[31:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case6_57[63:0] = (switch_100_case6_55 ^ switch_100_case6_56);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_8_S_0)) begin
+		switch_100_case6_57_reg[31:0] <= switch_100_case6_57[31:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case7_58[63:0] = (arg_6 | arg_6);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_9_S_0)) begin
+		switch_100_case7_58_reg[63:0] <= switch_100_case7_58[63:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case7_59[7:0] = (arg_0 ^ arg_1);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_9_S_0)) begin
+		switch_100_case7_59_reg[7:0] <= switch_100_case7_59[7:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case7_60[15:0] = switch_100_case7_mul_16_16_0[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_9_S_0)) begin
+		switch_100_case7_60_reg[15:0] <= switch_100_case7_60[15:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case7_61[31:0] = (arg_5 ^ arg_5);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_9_S_0)) begin
+		switch_100_case7_61_reg[31:0] <= switch_100_case7_61[31:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case7_62[63:0] = (switch_100_case7_59 ^ switch_100_case7_61);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_9_S_0)) begin
+		switch_100_case7_62_reg[31:0] <= switch_100_case7_62[31:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case7_63[63:0] = (switch_100_case7_58 ^ switch_100_case7_60);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_9_S_0)) begin
+		switch_100_case7_63_reg[63:0] <= switch_100_case7_63[63:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case7_64[63:0] = (switch_100_case7_62 ^ switch_100_case7_63);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_9_S_0)) begin
+		switch_100_case7_64_reg[63:0] <= switch_100_case7_64[63:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case8_65[63:0] = (arg_7 | arg_7);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_10_S_0)) begin
+		switch_100_case8_65_reg[63:0] <= switch_100_case8_65[63:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case8_66[7:0] = switch_100_case8_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	switch_100_case8_66_reg[7:0] = switch_100_case1_16_reg[7:0];
+end
+
+always @ (*) begin
+	switch_100_case8_67[31:0] = (arg_5 - arg_4);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_10_S_0)) begin
+		switch_100_case8_67_reg[31:0] <= switch_100_case8_67[31:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case8_68[63:0] = (arg_3 ^ arg_5);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_10_S_0)) begin
+		switch_100_case8_68_reg[31:0] <= switch_100_case8_68[31:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case8_69[63:0] = (switch_100_case8_66 ^ switch_100_case8_67);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_10_S_0)) begin
+		switch_100_case8_69_reg[31:0] <= switch_100_case8_69[31:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case8_70[63:0] = (switch_100_case8_65 ^ switch_100_case8_68);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_10_S_0)) begin
+		switch_100_case8_70_reg[63:0] <= switch_100_case8_70[63:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case8_71[63:0] = (switch_100_case8_69 ^ switch_100_case8_70);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_10_S_0)) begin
+		switch_100_case8_71_reg[63:0] <= switch_100_case8_71[63:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case9_72[7:0] = switch_100_case9_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	switch_100_case9_72_reg[7:0] = switch_100_case1_16_reg[7:0];
+end
+
+always @ (*) begin
+	switch_100_case9_74[7:0] = switch_100_case9_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	switch_100_case9_74_reg[7:0] = switch_100_case2_25_reg[7:0];
+end
+
+always @ (*) begin
+	switch_100_case9_75[63:0] = (arg_7 | arg_1);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_11_S_0)) begin
+		switch_100_case9_75_reg[63:0] <= switch_100_case9_75[63:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case9_76[63:0] = (arg_3 ^ arg_5);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_11_S_0)) begin
+		switch_100_case9_76_reg[31:0] <= switch_100_case9_76[31:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case9_77[63:0] = (switch_100_case9_75 ^ switch_100_case9_76);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_11_S_0)) begin
+		switch_100_case9_77_reg[63:0] <= switch_100_case9_77[63:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case9_78[63:0] = (switch_100_case9_74 ^ switch_100_case9_77);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_11_S_0)) begin
+		switch_100_case9_78_reg[63:0] <= switch_100_case9_78[63:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case10_79[15:0] = switch_100_case10_and_16_16_0[15:0];
+end
+
+always @ (*) begin
+	switch_100_case10_79_reg[15:0] = switch_100_case1_18_reg[15:0];
+end
+
+always @ (*) begin
+	switch_100_case10_80[7:0] = switch_100_case10_or_8_8_0[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_12_S_0)) begin
+		switch_100_case10_80_reg[7:0] <= switch_100_case10_80[7:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case10_81[31:0] = (arg_4 - arg_5);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_12_S_0)) begin
+		switch_100_case10_81_reg[31:0] <= switch_100_case10_81[31:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case10_82[63:0] = (arg_7 ^ arg_7);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_12_S_0)) begin
+		switch_100_case10_82_reg[63:0] <= switch_100_case10_82[63:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case10_83[63:0] = (switch_100_case10_80 ^ switch_100_case10_79);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_12_S_0)) begin
+		switch_100_case10_83_reg[15:0] <= switch_100_case10_83[15:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case10_84[63:0] = (switch_100_case10_81 ^ switch_100_case10_82);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_12_S_0)) begin
+		switch_100_case10_84_reg[63:0] <= switch_100_case10_84[63:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case10_85[63:0] = (switch_100_case10_83 ^ switch_100_case10_84);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_12_S_0)) begin
+		switch_100_case10_85_reg[63:0] <= switch_100_case10_85[63:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case11_87[63:0] = (arg_6 * arg_3);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_13_S_0)) begin
+		switch_100_case11_87_reg[63:0] <= switch_100_case11_87[63:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case11_88[31:0] = switch_100_case11_or_32_32_0[31:0];
+end
+
+always @ (*) begin
+	switch_100_case11_88_reg[31:0] = switch_100_case0_10_reg[31:0];
+end
+
+always @ (*) begin
+	switch_100_case11_89[15:0] = (arg_2 ^ arg_3);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_13_S_0)) begin
+		switch_100_case11_89_reg[15:0] <= switch_100_case11_89[15:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case11_90[63:0] = (arg_1 ^ switch_100_case11_89);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_13_S_0)) begin
+		switch_100_case11_90_reg[15:0] <= switch_100_case11_90[15:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case11_91[63:0] = (switch_100_case11_88_reg ^ switch_100_case11_87_reg);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_13_S_1)) begin
+		switch_100_case11_91_reg[63:0] <= switch_100_case11_91[63:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case11_92[63:0] = (switch_100_case11_90_reg ^ switch_100_case11_91);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_13_S_1)) begin
+		switch_100_case11_92_reg[63:0] <= switch_100_case11_92[63:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case12_93[7:0] = switch_100_case12_add_8_8_0[7:0];
+end
+
+always @ (*) begin
+	switch_100_case12_93_reg[7:0] = switch_100_case2_25_reg[7:0];
+end
+
+always @ (*) begin
+	switch_100_case12_94[15:0] = switch_100_case12_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	switch_100_case12_94_reg[15:0] = switch_100_case0_9_reg[15:0];
+end
+
+always @ (*) begin
+	switch_100_case12_95[7:0] = switch_100_case12_add_8_8_1[7:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_14_S_0)) begin
+		switch_100_case12_95_reg[7:0] <= switch_100_case12_95[7:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case12_96[63:0] = (arg_5 ^ arg_7);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_14_S_0)) begin
+		switch_100_case12_96_reg[63:0] <= switch_100_case12_96[63:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case12_97[63:0] = (arg_7 ^ switch_100_case12_94);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_14_S_0)) begin
+		switch_100_case12_97_reg[63:0] <= switch_100_case12_97[63:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case12_98[63:0] = (switch_100_case12_96 ^ switch_100_case12_95);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_14_S_0)) begin
+		switch_100_case12_98_reg[63:0] <= switch_100_case12_98[63:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case12_99[63:0] = (switch_100_case12_97 ^ switch_100_case12_98);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_14_S_0)) begin
+		switch_100_case12_99_reg[63:0] <= switch_100_case12_99[63:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case13_100[63:0] = (arg_6 + arg_7);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_15_S_0)) begin
+		switch_100_case13_100_reg[63:0] <= switch_100_case13_100[63:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case13_102[7:0] = switch_100_case13_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	switch_100_case13_102_reg[7:0] = switch_100_case1_16_reg[7:0];
+end
+
+always @ (*) begin
+	switch_100_case13_103[31:0] = switch_100_case13_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	switch_100_case13_103_reg[31:0] = switch_100_case4_40_reg[31:0];
+end
+
+always @ (*) begin
+	switch_100_case13_104[63:0] = (arg_3 ^ switch_100_case13_102);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_15_S_0)) begin
+		switch_100_case13_104_reg[15:0] <= switch_100_case13_104[15:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case13_105[63:0] = (switch_100_case13_103 ^ switch_100_case13_100);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_15_S_0)) begin
+		switch_100_case13_105_reg[63:0] <= switch_100_case13_105[63:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case13_106[63:0] = (switch_100_case13_104 ^ switch_100_case13_105);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_15_S_0)) begin
+		switch_100_case13_106_reg[63:0] <= switch_100_case13_106[63:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case14_107[31:0] = switch_100_case14_mul_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_16_S_0)) begin
+		switch_100_case14_107_reg[31:0] <= switch_100_case14_107[31:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case14_109[31:0] = switch_100_case14_mul_32_32_0[31:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_16_S_1)) begin
+		switch_100_case14_109_reg[31:0] <= switch_100_case14_109[31:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case14_110[7:0] = switch_100_case14_mul_8_8_0[7:0];
+end
+
+always @ (*) begin
+	switch_100_case14_110_reg[7:0] = switch_100_case0_11_reg[7:0];
+end
+
+always @ (*) begin
+	switch_100_case14_111[63:0] = (arg_3 ^ arg_7);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_16_S_0)) begin
+		switch_100_case14_111_reg[63:0] <= switch_100_case14_111[63:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case14_112[63:0] = (switch_100_case14_110_reg ^ switch_100_case14_109);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_16_S_1)) begin
+		switch_100_case14_112_reg[31:0] <= switch_100_case14_112[31:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case14_113[63:0] = (switch_100_case14_111_reg ^ switch_100_case14_112);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_16_S_1)) begin
+		switch_100_case14_113_reg[63:0] <= switch_100_case14_113[63:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case15_115[31:0] = switch_100_case15_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	switch_100_case15_115_reg[31:0] = switch_100_case4_40_reg[31:0];
+end
+
+always @ (*) begin
+	switch_100_case15_117[63:0] = (arg_6 + arg_6);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_17_S_0)) begin
+		switch_100_case15_117_reg[63:0] <= switch_100_case15_117[63:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case15_118[63:0] = (arg_1 ^ arg_3);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_17_S_0)) begin
+		switch_100_case15_118_reg[15:0] <= switch_100_case15_118[15:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case15_119[63:0] = (switch_100_case15_118 ^ switch_100_case15_115);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_17_S_0)) begin
+		switch_100_case15_119_reg[31:0] <= switch_100_case15_119[31:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case15_120[63:0] = (switch_100_case15_119 ^ switch_100_case15_117);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_17_S_0)) begin
+		switch_100_case15_120_reg[63:0] <= switch_100_case15_120[63:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_default_121[15:0] = switch_100_default_add_16_16_0[15:0];
+end
+
+always @ (*) begin
+	switch_100_default_121_reg[15:0] = switch_100_case0_9_reg[15:0];
+end
+
+always @ (*) begin
+	switch_100_default_123[15:0] = switch_100_default_add_16_16_1[15:0];
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_18_S_0)) begin
+		switch_100_default_123_reg[15:0] <= switch_100_default_123[15:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_default_124[7:0] = switch_100_default_and_8_8_0[7:0];
+end
+
+always @ (*) begin
+	switch_100_default_124_reg[7:0] = switch_100_case1_16_reg[7:0];
+end
+
+always @ (*) begin
+	switch_100_default_125[63:0] = (arg_5 ^ arg_7);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_18_S_0)) begin
+		switch_100_default_125_reg[63:0] <= switch_100_default_125[63:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_default_126[63:0] = (switch_100_default_124 ^ switch_100_default_123);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_18_S_0)) begin
+		switch_100_default_126_reg[15:0] <= switch_100_default_126[15:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_default_127[63:0] = (switch_100_default_125 ^ switch_100_default_126);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_18_S_0)) begin
+		switch_100_default_127_reg[63:0] <= switch_100_default_127[63:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case0_mul_8_8_0_op0[7:0] = arg_1[7:0];
+end
+
+always @ (*) begin
+	switch_100_case0_mul_8_8_0_op1[7:0] = arg_0[7:0];
+end
+
+always @ (*) begin
+	switch_100_case0_mul_8_8_0[7:0] = (switch_100_case0_mul_8_8_0_op0 * switch_100_case0_mul_8_8_0_op1);
+end
+
+always @ (*) begin
+	switch_100_case0_or_32_32_0_op0[31:0] = arg_4[31:0];
+end
+
+always @ (*) begin
+	switch_100_case0_or_32_32_0_op1[31:0] = arg_1[7:0];
+end
+
+always @ (*) begin
+	switch_100_case0_or_32_32_0[31:0] = (switch_100_case0_or_32_32_0_op0 | switch_100_case0_or_32_32_0_op1);
+end
+
+always @ (*) begin
+	switch_100_case0_add_16_16_0_op0[15:0] = arg_2[15:0];
+end
+
+always @ (*) begin
+	switch_100_case0_add_16_16_0_op1[15:0] = arg_2[15:0];
+end
+
+always @ (*) begin
+	switch_100_case0_add_16_16_0[15:0] = (switch_100_case0_add_16_16_0_op0 + switch_100_case0_add_16_16_0_op1);
+end
+
+always @ (*) begin
+	switch_100_case1_and_16_16_0_op0[15:0] = arg_3[15:0];
+end
+
+always @ (*) begin
+	switch_100_case1_and_16_16_0_op1[15:0] = arg_3[15:0];
+end
+
+always @ (*) begin
+	switch_100_case1_and_16_16_0[15:0] = (switch_100_case1_and_16_16_0_op0 & switch_100_case1_and_16_16_0_op1);
+end
+
+always @ (*) begin
+	switch_100_case1_and_8_8_0_op0[7:0] = arg_1[7:0];
+end
+
+always @ (*) begin
+	switch_100_case1_and_8_8_0_op1[7:0] = arg_1[7:0];
+end
+
+always @ (*) begin
+	switch_100_case1_and_8_8_0[7:0] = (switch_100_case1_and_8_8_0_op0 & switch_100_case1_and_8_8_0_op1);
+end
+
+always @ (*) begin
+	switch_100_case2_add_8_8_0_op0[7:0] = arg_0[7:0];
+end
+
+always @ (*) begin
+	switch_100_case2_add_8_8_0_op1[7:0] = arg_0[7:0];
+end
+
+always @ (*) begin
+	switch_100_case2_add_8_8_0[7:0] = (switch_100_case2_add_8_8_0_op0 + switch_100_case2_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	switch_100_case2_add_16_16_0_op0[15:0] = arg_2[15:0];
+end
+
+always @ (*) begin
+	switch_100_case2_add_16_16_0_op1[15:0] = arg_2[15:0];
+end
+
+always @ (*) begin
+	switch_100_case2_add_16_16_0[15:0] = (switch_100_case2_add_16_16_0_op0 + switch_100_case2_add_16_16_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_5_S_0)) begin
+		switch_100_case3_or_8_8_0_op0[7:0] = arg_1[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_switch_100_BB_5_S_1)) */ begin
+		switch_100_case3_or_8_8_0_op0[7:0] = arg_1[7:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_5_S_0)) begin
+		switch_100_case3_or_8_8_0_op1[7:0] = arg_0[7:0];
+	end
+	else /* if ((cur_state == BPHLS_F_switch_100_BB_5_S_1)) */ begin
+		switch_100_case3_or_8_8_0_op1[7:0] = arg_0[7:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case3_or_8_8_0[7:0] = (switch_100_case3_or_8_8_0_op0 | switch_100_case3_or_8_8_0_op1);
+end
+
+always @ (*) begin
+	switch_100_case3_add_8_8_0_op0[7:0] = arg_1[7:0];
+end
+
+always @ (*) begin
+	switch_100_case3_add_8_8_0_op1[7:0] = arg_1[7:0];
+end
+
+always @ (*) begin
+	switch_100_case3_add_8_8_0[7:0] = (switch_100_case3_add_8_8_0_op0 + switch_100_case3_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_6_S_0)) begin
+		switch_100_case4_and_32_32_0_op0[31:0] = switch_100_case4_38[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_switch_100_BB_6_S_1)) */ begin
+		switch_100_case4_and_32_32_0_op0[31:0] = switch_100_case4_38_reg;
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_6_S_0)) begin
+		switch_100_case4_and_32_32_0_op1[31:0] = arg_4[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_switch_100_BB_6_S_1)) */ begin
+		switch_100_case4_and_32_32_0_op1[31:0] = arg_5[31:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case4_and_32_32_0[31:0] = (switch_100_case4_and_32_32_0_op0 & switch_100_case4_and_32_32_0_op1);
+end
+
+always @ (*) begin
+	switch_100_case5_and_16_16_0_op0[15:0] = arg_2[15:0];
+end
+
+always @ (*) begin
+	switch_100_case5_and_16_16_0_op1[15:0] = arg_3[15:0];
+end
+
+always @ (*) begin
+	switch_100_case5_and_16_16_0[15:0] = (switch_100_case5_and_16_16_0_op0 & switch_100_case5_and_16_16_0_op1);
+end
+
+always @ (*) begin
+	switch_100_case6_mul_8_8_0_op0[7:0] = arg_0[7:0];
+end
+
+always @ (*) begin
+	switch_100_case6_mul_8_8_0_op1[7:0] = arg_1[7:0];
+end
+
+always @ (*) begin
+	switch_100_case6_mul_8_8_0[7:0] = (switch_100_case6_mul_8_8_0_op0 * switch_100_case6_mul_8_8_0_op1);
+end
+
+always @ (*) begin
+	switch_100_case6_add_16_16_0_op0[15:0] = arg_2[15:0];
+end
+
+always @ (*) begin
+	switch_100_case6_add_16_16_0_op1[15:0] = arg_2[15:0];
+end
+
+always @ (*) begin
+	switch_100_case6_add_16_16_0[15:0] = (switch_100_case6_add_16_16_0_op0 + switch_100_case6_add_16_16_0_op1);
+end
+
+always @ (*) begin
+	switch_100_case7_mul_16_16_0_op0[15:0] = arg_3[15:0];
+end
+
+always @ (*) begin
+	switch_100_case7_mul_16_16_0_op1[7:0] = switch_100_case7_59[7:0];
+end
+
+always @ (*) begin
+	switch_100_case7_mul_16_16_0[15:0] = (switch_100_case7_mul_16_16_0_op0 * switch_100_case7_mul_16_16_0_op1);
+end
+
+always @ (*) begin
+	switch_100_case8_and_8_8_0_op0[7:0] = arg_0[7:0];
+end
+
+always @ (*) begin
+	switch_100_case8_and_8_8_0_op1[7:0] = arg_0[7:0];
+end
+
+always @ (*) begin
+	switch_100_case8_and_8_8_0[7:0] = (switch_100_case8_and_8_8_0_op0 & switch_100_case8_and_8_8_0_op1);
+end
+
+always @ (*) begin
+	switch_100_case9_add_8_8_0_op0[7:0] = switch_100_case9_72[7:0];
+end
+
+always @ (*) begin
+	switch_100_case9_add_8_8_0_op1[7:0] = switch_100_case9_72[7:0];
+end
+
+always @ (*) begin
+	switch_100_case9_add_8_8_0[7:0] = (switch_100_case9_add_8_8_0_op0 + switch_100_case9_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	switch_100_case9_and_8_8_0_op0[7:0] = arg_1[7:0];
+end
+
+always @ (*) begin
+	switch_100_case9_and_8_8_0_op1[7:0] = arg_0[7:0];
+end
+
+always @ (*) begin
+	switch_100_case9_and_8_8_0[7:0] = (switch_100_case9_and_8_8_0_op0 & switch_100_case9_and_8_8_0_op1);
+end
+
+always @ (*) begin
+	switch_100_case10_and_16_16_0_op0[15:0] = arg_3[15:0];
+end
+
+always @ (*) begin
+	switch_100_case10_and_16_16_0_op1[15:0] = arg_3[15:0];
+end
+
+always @ (*) begin
+	switch_100_case10_and_16_16_0[15:0] = (switch_100_case10_and_16_16_0_op0 & switch_100_case10_and_16_16_0_op1);
+end
+
+always @ (*) begin
+	switch_100_case10_or_8_8_0_op0[7:0] = arg_0[7:0];
+end
+
+always @ (*) begin
+	switch_100_case10_or_8_8_0_op1[7:0] = arg_1[7:0];
+end
+
+always @ (*) begin
+	switch_100_case10_or_8_8_0[7:0] = (switch_100_case10_or_8_8_0_op0 | switch_100_case10_or_8_8_0_op1);
+end
+
+always @ (*) begin
+	switch_100_case11_or_32_32_0_op0[31:0] = arg_5[31:0];
+end
+
+always @ (*) begin
+	switch_100_case11_or_32_32_0_op1[31:0] = arg_4[31:0];
+end
+
+always @ (*) begin
+	switch_100_case11_or_32_32_0[31:0] = (switch_100_case11_or_32_32_0_op0 | switch_100_case11_or_32_32_0_op1);
+end
+
+always @ (*) begin
+	switch_100_case12_add_8_8_0_op0[7:0] = arg_0[7:0];
+end
+
+always @ (*) begin
+	switch_100_case12_add_8_8_0_op1[7:0] = arg_1[7:0];
+end
+
+always @ (*) begin
+	switch_100_case12_add_8_8_0[7:0] = (switch_100_case12_add_8_8_0_op0 + switch_100_case12_add_8_8_0_op1);
+end
+
+always @ (*) begin
+	switch_100_case12_add_8_8_1_op0[7:0] = switch_100_case12_93[7:0];
+end
+
+always @ (*) begin
+	switch_100_case12_add_8_8_1_op1[7:0] = arg_1[7:0];
+end
+
+always @ (*) begin
+	switch_100_case12_add_8_8_1[7:0] = (switch_100_case12_add_8_8_1_op0 + switch_100_case12_add_8_8_1_op1);
+end
+
+always @ (*) begin
+	switch_100_case12_add_16_16_0_op0[15:0] = arg_2[15:0];
+end
+
+always @ (*) begin
+	switch_100_case12_add_16_16_0_op1[15:0] = arg_2[15:0];
+end
+
+always @ (*) begin
+	switch_100_case12_add_16_16_0[15:0] = (switch_100_case12_add_16_16_0_op0 + switch_100_case12_add_16_16_0_op1);
+end
+
+always @ (*) begin
+	switch_100_case13_and_32_32_0_op0[31:0] = arg_4[31:0];
+end
+
+always @ (*) begin
+	switch_100_case13_and_32_32_0_op1[31:0] = arg_4[31:0];
+end
+
+always @ (*) begin
+	switch_100_case13_and_32_32_0[31:0] = (switch_100_case13_and_32_32_0_op0 & switch_100_case13_and_32_32_0_op1);
+end
+
+always @ (*) begin
+	switch_100_case13_and_8_8_0_op0[7:0] = arg_1[7:0];
+end
+
+always @ (*) begin
+	switch_100_case13_and_8_8_0_op1[7:0] = arg_0[7:0];
+end
+
+always @ (*) begin
+	switch_100_case13_and_8_8_0[7:0] = (switch_100_case13_and_8_8_0_op0 & switch_100_case13_and_8_8_0_op1);
+end
+
+always @ (*) begin
+	switch_100_case14_mul_8_8_0_op0[7:0] = arg_0[7:0];
+end
+
+always @ (*) begin
+	switch_100_case14_mul_8_8_0_op1[7:0] = arg_0[7:0];
+end
+
+always @ (*) begin
+	switch_100_case14_mul_8_8_0[7:0] = (switch_100_case14_mul_8_8_0_op0 * switch_100_case14_mul_8_8_0_op1);
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_16_S_0)) begin
+		switch_100_case14_mul_32_32_0_op0[31:0] = arg_5[31:0];
+	end
+	else if ((cur_state == BPHLS_F_switch_100_BB_16_S_1)) begin
+		switch_100_case14_mul_32_32_0_op0[31:0] = arg_5[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_switch_100_BB_16_S_2)) */ begin
+		switch_100_case14_mul_32_32_0_op0[31:0] = switch_100_case14_107_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	if ((cur_state == BPHLS_F_switch_100_BB_16_S_0)) begin
+		switch_100_case14_mul_32_32_0_op1[31:0] = arg_5[31:0];
+	end
+	else if ((cur_state == BPHLS_F_switch_100_BB_16_S_1)) begin
+		switch_100_case14_mul_32_32_0_op1[31:0] = arg_5[31:0];
+	end
+	else /* if ((cur_state == BPHLS_F_switch_100_BB_16_S_2)) */ begin
+		switch_100_case14_mul_32_32_0_op1[31:0] = switch_100_case14_107_reg[31:0];
+	end
+end
+
+always @ (*) begin
+	switch_100_case14_mul_32_32_0[31:0] = (switch_100_case14_mul_32_32_0_op0 * switch_100_case14_mul_32_32_0_op1);
+end
+
+always @ (*) begin
+	switch_100_case15_and_32_32_0_op0[31:0] = arg_4[31:0];
+end
+
+always @ (*) begin
+	switch_100_case15_and_32_32_0_op1[31:0] = arg_4[31:0];
+end
+
+always @ (*) begin
+	switch_100_case15_and_32_32_0[31:0] = (switch_100_case15_and_32_32_0_op0 & switch_100_case15_and_32_32_0_op1);
+end
+
+always @ (*) begin
+	switch_100_default_and_8_8_0_op0[7:0] = arg_1[7:0];
+end
+
+always @ (*) begin
+	switch_100_default_and_8_8_0_op1[7:0] = arg_1[7:0];
+end
+
+always @ (*) begin
+	switch_100_default_and_8_8_0[7:0] = (switch_100_default_and_8_8_0_op0 & switch_100_default_and_8_8_0_op1);
+end
+
+always @ (*) begin
+	switch_100_default_add_16_16_0_op0[15:0] = arg_3[15:0];
+end
+
+always @ (*) begin
+	switch_100_default_add_16_16_0_op1[15:0] = arg_2[15:0];
+end
+
+always @ (*) begin
+	switch_100_default_add_16_16_0[15:0] = (switch_100_default_add_16_16_0_op0 + switch_100_default_add_16_16_0_op1);
+end
+
+always @ (*) begin
+	switch_100_default_add_16_16_1_op0[15:0] = arg_3[15:0];
+end
+
+always @ (*) begin
+	switch_100_default_add_16_16_1_op1[15:0] = arg_2[15:0];
+end
+
+always @ (*) begin
+	switch_100_default_add_16_16_1[15:0] = (switch_100_default_add_16_16_1_op0 + switch_100_default_add_16_16_1_op1);
+end
+
+always @ (*) begin
+	switch_100_case3_30[7:0] = switch_100_case3_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	switch_100_case3_32[7:0] = switch_100_case3_or_8_8_0[7:0];
+end
+
+always @ (*) begin
+	switch_100_case4_39[31:0] = switch_100_case4_and_32_32_0[31:0];
+end
+
+always @ (*) begin
+	switch_100_case5_44[63:0] = (arg_7 + arg_6);
+end
+
+always @ (*) begin
+	switch_100_case9_73[63:0] = (arg_7 * arg_6);
+end
+
+always @ (*) begin
+	switch_100_case11_86[15:0] = (arg_3 ^ arg_3);
+end
+
+always @ (*) begin
+	switch_100_case13_101[31:0] = (arg_4 ^ arg_4);
+end
+
+always @ (*) begin
+	switch_100_case14_108[31:0] = switch_100_case14_mul_32_32_0[31:0];
+end
+
+always @ (*) begin
+	switch_100_case15_114[31:0] = (arg_5 ^ arg_5);
+end
+
+always @ (*) begin
+	switch_100_case15_116[63:0] = (arg_6 - arg_6);
+end
+
+always @ (*) begin
+	switch_100_default_122[15:0] = (switch_100_default_121 ^ switch_100_default_121);
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS)) begin
+		finish <= 1'd0;
+	end
+	if ((cur_state == BPHLS_F_switch_100_BB_1_S_0)) begin
+		finish <= 1'd1;
+	end
+end
+
+always @ (posedge clk) begin
+	if ((cur_state == BPHLS)) begin
+		return_val[63:0] <= 64'd0;
+	end
+	if ((cur_state == BPHLS_F_switch_100_BB_1_S_0)) begin
+		return_val[63:0] <= switch_100_merge_8_reg[63:0];
+	end
+end
+
+endmodule
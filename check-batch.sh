@@ -0,0 +1,144 @@
+#!/bin/bash
+
+# Batch compilation checks. Functions synthesized together by one batch
+# job slice, or by several threads, must give the same outputs as
+# synthesized one by one.
+
+HLS_BIN_DIR="build/bin"
+HLS_TOOL="bitpack-hls"
+
+CHECK_DIR=$(mktemp -d)
+trap "rm -rf $CHECK_DIR" EXIT
+
+N_FAILED=0
+
+# Dataflow task stage1 is a batch job of its own too, synthesized first
+cat > $CHECK_DIR/dataflow.ll << EOF
+define i32 @stage1(i8 %a, i32 %b) {
+  %x = zext i8 %a to i32
+  %y = add i32 %x, %b
+  %z = mul i32 %y, %b
+  ret i32 %z
+}
+
+define i32 @stage2(i32 %a) {
+  %x = xor i32 %a, 255
+  ret i32 %x
+}
+
+define i32 @top(i8 %p, i32 %q) {
+  %s = call i32 @stage1(i8 %p, i32 %q)
+  %t = call i32 @stage2(i32 %s)
+  ret i32 %t
+}
+EOF
+
+# Functions with extensions, rewritten by the synthesis of the earlier ones
+cat > $CHECK_DIR/kernels.ll << EOF
+define i16 @narrow(i8 %a, i8 %b, i16 %c) {
+  %x = zext i8 %a to i16
+  %y = zext i8 %b to i16
+  %s = add i16 %x, %y
+  %m = mul i16 %s, %c
+  ret i16 %m
+}
+
+define i32 @branch(i32 %a, i32 %b) {
+entry:
+  %c = icmp ult i32 %a, %b
+  br i1 %c, label %t, label %f
+t:
+  %x = sub i32 %b, %a
+  br label %e
+f:
+  %y = sub i32 %a, %b
+  br label %e
+e:
+  %r = phi i32 [ %x, %t ], [ %y, %f ]
+  ret i32 %r
+}
+
+define i32 @wide(i16 %a, i32 %b) {
+  %x = zext i16 %a to i32
+  %y = xor i32 %x, %b
+  %z = add i32 %y, %b
+  ret i32 %z
+}
+EOF
+
+# Usage: check_batch <ir file> <hls flags>...
+check_batch() {
+    local IR_FILE=$1
+    shift
+
+    local BATCH_DIR="$CHECK_DIR/batch"
+    rm -rf $BATCH_DIR
+
+    local THREADS_DIR="$CHECK_DIR/threads"
+    rm -rf $THREADS_DIR
+
+    if ! $HLS_BIN_DIR/$HLS_TOOL $IR_FILE --all -j 1 --out-dir=$BATCH_DIR "$@" > /dev/null
+    then
+        echo "FAIL: batch $IR_FILE $@"
+        N_FAILED=$((N_FAILED + 1))
+        return
+    fi
+
+    if ! $HLS_BIN_DIR/$HLS_TOOL $IR_FILE --all -j 4 --out-dir=$THREADS_DIR "$@" > /dev/null
+    then
+        echo "FAIL: threaded batch $IR_FILE $@"
+        N_FAILED=$((N_FAILED + 1))
+    elif ! diff -r $BATCH_DIR $THREADS_DIR > /dev/null
+    then
+        echo "FAIL: $IR_FILE $@: threaded batch outputs differ"
+        N_FAILED=$((N_FAILED + 1))
+    fi
+
+    for FUNC_NAME in $(sed -n 's/^define .*@\([A-Za-z0-9_]*\)(.*/\1/p' $IR_FILE)
+    do
+        local SINGLE_DIR="$CHECK_DIR/$FUNC_NAME"
+        rm -rf $SINGLE_DIR
+
+        if ! $HLS_BIN_DIR/$HLS_TOOL $IR_FILE -f $FUNC_NAME --out-dir=$SINGLE_DIR "$@" > /dev/null
+        then
+            echo "FAIL: $IR_FILE $FUNC_NAME $@"
+            N_FAILED=$((N_FAILED + 1))
+            continue
+        fi
+
+        if ! diff $BATCH_DIR/$FUNC_NAME.v $SINGLE_DIR/$FUNC_NAME.v > /dev/null
+        then
+            echo "FAIL: $IR_FILE $FUNC_NAME $@: batch module differs"
+            N_FAILED=$((N_FAILED + 1))
+        fi
+
+        # Golden vectors of the testbench
+        if [[ -f $SINGLE_DIR/$FUNC_NAME.vectors ]] \
+            && ! diff $BATCH_DIR/$FUNC_NAME.vectors $SINGLE_DIR/$FUNC_NAME.vectors > /dev/null
+        then
+            echo "FAIL: $IR_FILE $FUNC_NAME $@: batch golden vectors differ"
+            N_FAILED=$((N_FAILED + 1))
+        fi
+    done
+}
+
+check_batch $CHECK_DIR/dataflow.ll -dataflow
+check_batch $CHECK_DIR/dataflow.ll
+check_batch $CHECK_DIR/kernels.ll --sim-vectors=64
+check_batch $CHECK_DIR/kernels.ll --testbench
+
+# Outputs are named after functions, which must be unique across modules
+if $HLS_BIN_DIR/$HLS_TOOL $CHECK_DIR/kernels.ll $CHECK_DIR/kernels.ll --all \
+    --out-dir=$CHECK_DIR/duplicate > /dev/null 2>&1
+then
+    echo "FAIL: duplicate function names accepted"
+    N_FAILED=$((N_FAILED + 1))
+fi
+
+if [[ $N_FAILED -ne 0 ]]
+then
+    echo "$N_FAILED batch checks failed" >&2
+    exit 1
+fi
+
+echo "Batch checks passed"
@@ -3,4 +3,7 @@
 HLS_OUT_DIR="hls/out"
 OUT_TYPE="png"
 
-dot -T $OUT_TYPE -o $HLS_OUT_DIR/dag.$OUT_TYPE $HLS_OUT_DIR/dag.dot
+for DAG_FILE in $HLS_OUT_DIR/*.dag.dot
+do
+    dot -T $OUT_TYPE -o ${DAG_FILE%.dot}.$OUT_TYPE $DAG_FILE
+done
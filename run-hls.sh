@@ -11,7 +11,7 @@ SRC_FILE_BASENAME=$(basename $SRC_FILE)
 
 FUNC_NAME=$2
 
-IR_FILE="$SRC_FILE_BASENAME.ll"
+IR_FILE="$SRC_FILE_BASENAME.bc"
 OUT_FILE="$SRC_FILE_BASENAME.v"
 
 HLS_BIN_DIR="build/bin"
@@ -20,7 +20,7 @@ HLS_OUT_DIR="hls/out"
 
 HLS_TOOL="bitpack-hls"
 HLS_IR_FRONTEND="clang"
-HLS_IR_FRONTEND_FLAGS="-S -c -emit-llvm -O1 -o $HLS_OUT_DIR/$IR_FILE"
+HLS_IR_FRONTEND_FLAGS="-c -emit-llvm -O1 -o $HLS_OUT_DIR/$IR_FILE"
 
 $HLS_IR_FRONTEND $HLS_IR_FRONTEND_FLAGS $SRC_FILE
 $HLS_BIN_DIR/$HLS_TOOL $HLS_OUT_DIR/$IR_FILE $FUNC_NAME
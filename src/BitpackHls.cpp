@@ -1,13 +1,22 @@
 #include <iostream>
-#include <fstream>
+#include <memory>
 #include <string>
 #include <optional>
 
+#include <llvm/Support/CommandLine.h>
 #include <llvm/Support/raw_ostream.h>
 #include <llvm/Support/FormattedStream.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/FormatVariadic.h>
+#include <llvm/Support/Path.h>
+#include <llvm/Support/MemoryBuffer.h>
 
 #include <llvm/IR/Function.h>
 
+#include "scheduling/PreHlsPipeline.hpp"
+#include "scheduling/GlobalCodeMotion.hpp"
+#include "scheduling/TreeHeightReduction.hpp"
+#include "scheduling/BitwidthAnalysis.hpp"
 #include "scheduling/Dag.hpp"
 #include "scheduling/SdcScheduler.hpp"
 #include "scheduling/SchedulerMapping.hpp"
@@ -20,62 +29,308 @@
 #include "binding/Binding.hpp"
 
 #include "verilog/VerilogWriter.hpp"
+#include "verilog/TestbenchWriter.hpp"
+#include "cmodel/CppModelWriter.hpp"
+
+#include "sim/GoldenModel.hpp"
+#include "sim/BitSliceSimulator.hpp"
+#include "sim/TestVectors.hpp"
+
+#include "utility/PhaseProfile.hpp"
+#include "utility/log_utility.hpp"
 
 #include "BitpackHls.hpp"
 
 using namespace llvm;
 
-bphls::BitpackHls::BitpackHls(Function& function /*, constrains */)
+static cl::opt<bool> cpp_model(
+    "cpp-model",
+    cl::desc("Write a cycle-accurate C++ model of the module (<function>.model.hpp)"),
+    cl::init(false)
+);
+
+static cl::opt<unsigned int> sim_vectors(
+    "sim-vectors",
+    cl::desc("Simulate the module on random test vectors against the compiled function (0 - no simulation)"),
+    cl::init(0)
+);
+
+static cl::opt<bool> testbench(
+    "testbench",
+    cl::desc("Write a self-checking testbench (<function>_testbench.v) and its golden vectors (<function>.vectors)"),
+    cl::init(false)
+);
+
+static cl::opt<unsigned int> tb_vectors(
+    "tb-vectors",
+    cl::desc("Random test vectors of the testbench"),
+    cl::init(100)
+);
+
+static cl::opt<std::string> tb_inputs(
+    "tb-inputs",
+    cl::desc("Arguments of the testbench calls, one call per line (instead of random vectors)"),
+    cl::value_desc("filename"),
+    cl::init("")
+);
+
+bphls::BitpackHls::BitpackHls(Function& function,
+                              hardware::HardwareConstraints& constraints,
+                              std::string out_dir)
     : function(function),
+      constraints(constraints),
+      out_dir(out_dir),
       rtl_module(std::nullopt) {}
 
+/* Quality of results, reported with the compilation statistics */
+static void recordQor(bphls::Fsm& fsm,
+                      bphls::binding::Binding& binding,
+                      bphls::rtl::RtlModule& rtl_module)
+{
+    long long n_registers = 0;
+    long long n_mux_inputs = 0;
+
+    auto count_signal = [&](bphls::rtl::RtlSignal* signal) {
+        if (signal->isRegister()) {
+            n_registers += 1;
+        }
+
+        /* Signals with several drivers are multiplexers over them */
+        if (signal->getDriversNum() > 1) {
+            n_mux_inputs += signal->getDriversNum();
+        }
+    };
+
+    for (auto* signal : rtl_module.iter_signals()) {
+        count_signal(signal);
+    }
+
+    for (auto* port : rtl_module.iter_ports()) {
+        count_signal(port);
+    }
+
+    using bphls::utility::PhaseProfile;
+
+    PhaseProfile::record("fsm_states", fsm.getStatesNum());
+    PhaseProfile::record("registers", n_registers);
+    PhaseProfile::record("fu_instances", binding.getFuInstancesNum());
+    PhaseProfile::record("mux_inputs", n_mux_inputs);
+}
+
 bool bphls::BitpackHls::run() {
-    std::string out_buffer;
-    raw_string_ostream out_stream(out_buffer);
-    formatted_raw_ostream fmt_out_stream(out_stream);
+    const std::string out_prefix = out_dir + "/" + function.getName().str();
+
+    /* Declared first, reports after all compilation objects are released */
+    utility::PhaseProfile profile(function.getName().str(), out_prefix + ".stats.json");
 
-    Dag dag(function);
+    /* Reference copy of the function, taken before it is transformed */
+    std::unique_ptr<sim::GoldenModel> golden;
 
-    for (auto& basic_block: function) {
-        dag.exportDot(fmt_out_stream, basic_block);
+    if ((sim_vectors > 0) || testbench) {
+        profile.startPhase("golden-model");
+        golden = std::make_unique<sim::GoldenModel>(function);
+    }
+
+    profile.startPhase("pre-hls");
+    PreHlsPipeline pre_hls_pipeline(function);
+
+    if (!pre_hls_pipeline.run()) {
+        return false;
+    }
+
+    profile.startPhase("code-motion");
+    GlobalCodeMotion code_motion(function);
+    code_motion.run();
+
+    profile.startPhase("tree-height");
+    TreeHeightReduction tree_height(function, constraints);
+    tree_height.run();
+
+    profile.startPhase("bitwidth");
+    BitwidthAnalysis bitwidth(function);
+    bitwidth.run();
+
+    profile.startPhase("dag");
+    Dag dag(function, constraints);
+
+    {
+        std::error_code ec;
+        raw_fd_ostream out_stream(out_prefix + ".dag.dot", ec, sys::fs::OF_None);
+
+        if (ec) {
+            std::cerr << "Cannot open output file '" << out_prefix << ".dag.dot': "
+                << ec.message() << std::endl;
+            return false;
+        }
+
+        formatted_raw_ostream fmt_out_stream(out_stream);
 
-        std::ofstream file_out("./hls/out/dag.dot");
-        file_out << out_buffer;
+        for (auto& basic_block: function) {
+            dag.exportDot(fmt_out_stream, basic_block);
+        }
     }
 
-    SdcScheduler sched(function, dag);
+    profile.startPhase("scheduling");
+    SdcScheduler sched(function, dag, constraints);
 
     Fsm& fsm = sched.schedule().createFsm();
 
-    for (auto* state : fsm.states()) {
-        std::cout << state->getName() << std::endl;
-        state->printStateInfo();
+    if (utility::isVerbose()) {
+        for (auto* state : fsm.states()) {
+            utility::logs() << state->getName() << "\n";
+            state->printStateInfo();
+        }
     }
 
+    profile.startPhase("lifetime");
     binding::LifetimeAnalysis lva(function);
     lva.analize();
 
-    binding::Binding binding(fsm, lva);
+    profile.startPhase("binding");
+    binding::Binding binding(fsm, lva, constraints);
+    binding.assignInstructions();
 
     rtl::RtlGenerator rtl_gen(function, fsm, lva, binding);
 
-    rtl_module = &rtl_gen.generate();
+#ifdef BITPACK
+    profile.startPhase("bitpack-binding");
+    rtl_gen.performBitpackRegBinding();
+#endif
 
-    std::string hls_output_buffer;
-    llvm::raw_string_ostream hls_output(hls_output_buffer);
+    profile.startPhase("rtl");
+    rtl_module = &rtl_gen.generate();
 
-    verilog::VerilogWriter verilog_write(hls_output, *rtl_module.value());
+    recordQor(fsm, binding, *rtl_module.value());
 
-    verilog_write.print();
+    profile.startPhase("verilog");
+    hls_output_file = out_prefix + ".v";
 
     {
-        std::ofstream file_out("./hls/out/" + function.getName().str() + ".v");
-        file_out << hls_output_buffer;
+        std::error_code ec;
+        raw_fd_ostream hls_output(hls_output_file, ec, sys::fs::OF_None);
+
+        if (ec) {
+            std::cerr << "Cannot open output file '" << hls_output_file << "': "
+                << ec.message() << std::endl;
+            return false;
+        }
+
+        verilog::VerilogWriter verilog_write(hls_output, *rtl_module.value());
+
+        verilog_write.print();
     }
 
+    if (cpp_model) {
+        profile.startPhase("cpp-model");
+        const std::string model_output_file = out_prefix + ".model.hpp";
+
+        std::error_code ec;
+        raw_fd_ostream model_output(model_output_file, ec, sys::fs::OF_None);
+
+        if (ec) {
+            std::cerr << "Cannot open output file '" << model_output_file << "': "
+                << ec.message() << std::endl;
+            return false;
+        }
+
+        cmodel::CppModelWriter model_write(model_output, *rtl_module.value());
+
+        if (!model_write.print()) {
+            return false;
+        }
+    }
+
+    if (sim_vectors > 0) {
+        profile.startPhase("simulation");
+        sim::BitSliceSimulator simulator(function, *rtl_module.value(), *golden);
+        sim::TestVectors vectors(function);
+        vectors.addRandom(sim_vectors);
+
+        if (!simulator.run(vectors)) {
+            return false;
+        }
+    }
+
+    if (testbench) {
+        profile.startPhase("testbench");
+
+        if (!writeTestbench(out_prefix, *golden)) {
+            return false;
+        }
+    }
+
+    /* Function objects and arenas are released on return */
+    profile.startPhase("teardown");
+
     return true;
 }
 
-void bphls::BitpackHls::writeOut(raw_ostream& hls_out) {
+bool bphls::BitpackHls::writeTestbench(const std::string& out_prefix, sim::GoldenModel& golden) {
+    sim::TestVectors vectors(function);
+
+    if (tb_inputs.empty()) {
+        vectors.addRandom(tb_vectors);
+    } else if (!vectors.readFile(tb_inputs)) {
+        return false;
+    }
+
+    /* Expected values and latency come from the simulation of the module */
+    sim::BitSliceSimulator simulator(function, *rtl_module.value(), golden);
+
+    if (!simulator.run(vectors)) {
+        return false;
+    }
+
+    unsigned int min_latency = 0;
+    unsigned int max_latency = 0;
+    double avg_latency = 0;
 
+    if (vectors.getLatency(min_latency, avg_latency, max_latency)) {
+        std::cout << "Latency: " << function.getName().str()
+            << " min: " << min_latency
+            << " avg: " << formatv("{0:F2}", avg_latency).str()
+            << " max: " << max_latency << " cycles" << std::endl;
+    }
+
+    const std::string testbench_file = out_prefix + "_testbench.v";
+    const std::string vector_file = out_prefix + ".vectors";
+
+    std::error_code ec;
+    raw_fd_ostream testbench_output(testbench_file, ec, sys::fs::OF_None);
+
+    if (ec) {
+        std::cerr << "Cannot open output file '" << testbench_file << "': "
+            << ec.message() << std::endl;
+        return false;
+    }
+
+    raw_fd_ostream vector_output(vector_file, ec, sys::fs::OF_None);
+
+    if (ec) {
+        std::cerr << "Cannot open output file '" << vector_file << "': "
+            << ec.message() << std::endl;
+        return false;
+    }
+
+    verilog::TestbenchWriter testbench_write(testbench_output,
+                                             vector_output,
+                                             sys::path::filename(vector_file).str(),
+                                             *rtl_module.value(),
+                                             vectors);
+
+    return testbench_write.print();
+}
+
+bool bphls::BitpackHls::writeOut(raw_ostream& hls_out) {
+    auto file_buffer = MemoryBuffer::getFile(hls_output_file);
+
+    if (!file_buffer) {
+        std::cerr << "Cannot read output file '" << hls_output_file << "': "
+            << file_buffer.getError().message() << std::endl;
+        return false;
+    }
+
+    hls_out << file_buffer.get()->getBuffer();
+
+    return true;
 }
\ No newline at end of file
@@ -2,26 +2,47 @@
 #define __BITPACK_HLS_PASS_HPP__
 
 #include <optional>
+#include <string>
 
 #include <llvm/Support/raw_ostream.h>
 
 #include <llvm/IR/Function.h>   /* Compiler input */
 #include "rtl/RtlModule.hpp"    /* Compiler output */
 
+#include "hardware/HardwareConstraints.hpp"
+#include "sim/GoldenModel.hpp"
+
 namespace llvm {
     namespace bphls {
 
+/**
+ * Single function HLS flow. All compilation state is owned by the
+ * instance, so functions of one module may be synthesized concurrently
+ * as long as each one gets its own constraints object.
+ */
 class BitpackHls {
 public:
-    BitpackHls(Function& function /*, constrains */);
+    BitpackHls(Function& function,
+               hardware::HardwareConstraints& constraints,
+               std::string out_dir);
 
     bool run();
 
-    void writeOut(raw_ostream& hls_output);
+    /** Copies the Verilog file written by the last run */
+    bool writeOut(raw_ostream& hls_output);
 
 private:
     Function& function;
+    hardware::HardwareConstraints& constraints;
+    std::string out_dir;
+
     std::optional<rtl::RtlModule*> rtl_module; 
+
+    /* Verilog is streamed to the file, modules do not outlive their generator */
+    std::string hls_output_file;
+
+    /** Simulates test vectors and writes the testbench of the module with them */
+    bool writeTestbench(const std::string& out_prefix, sim::GoldenModel& golden);
 };
 
     } /* bphls */
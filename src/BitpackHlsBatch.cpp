@@ -0,0 +1,214 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <memory>
+#include <map>
+#include <mutex>
+#include <algorithm>
+
+#include <llvm/Support/CommandLine.h>
+#include <llvm/Support/SourceMgr.h>
+#include <llvm/Support/ThreadPool.h>
+#include <llvm/Support/Threading.h>
+#include <llvm/Support/FileSystem.h>
+
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include <llvm/IR/Function.h>
+
+#include "hardware/HardwareConstraints.hpp"
+#include "utility/module_utility.hpp"
+#include "BitpackHls.hpp"
+#include "DataflowHls.hpp"
+
+#include "BitpackHlsBatch.hpp"
+
+using namespace llvm;
+using namespace bphls;
+
+static cl::opt<bool> dataflow(
+    "dataflow",
+    cl::desc("Synthesize functions made of calls as concurrent tasks connected by FIFOs"),
+    cl::init(false)
+);
+
+static std::mutex log_mutex;
+
+BitpackHlsBatch::BitpackHlsBatch(std::string out_dir, unsigned int n_jobs)
+    : out_dir(out_dir),
+      n_jobs(n_jobs) {}
+
+void BitpackHlsBatch::addModule(std::string ir_file) {
+    ir_files.push_back(ir_file);
+}
+
+void BitpackHlsBatch::selectFunction(std::string function_name) {
+    selected_functions.insert(function_name);
+}
+
+static bool isSynthesizable(Function& function) {
+    return !function.isDeclaration() && !function.isIntrinsic();
+}
+
+bool BitpackHlsBatch::collectJobs() {
+    /* Function name -> module defining it */
+    std::map<std::string, std::string> found_functions;
+    bool is_unique = true;
+
+    for (auto& ir_file : ir_files) {
+        LLVMContext context;
+        SMDiagnostic err;
+
+        /* Bitcode bodies are not read, only the function list */
+        auto module = utility::loadModule(ir_file, err, context);
+
+        if (module.get() == nullptr) {
+            std::cerr << "IR module '" << ir_file << "' not found: "
+                << err.getMessage().str() << std::endl;
+            return false;
+        }
+
+        for (auto& function : *module) {
+            if (!isSynthesizable(function)) {
+                continue;
+            }
+
+            auto function_name = function.getName().str();
+
+            if (!selected_functions.empty()
+                    && (selected_functions.count(function_name) == 0))
+            {
+                continue;
+            }
+
+            /* Outputs are named after the function only */
+            auto found_iter = found_functions.find(function_name);
+
+            if (found_iter != found_functions.end()) {
+                std::cerr << "Function '" << function_name << "' is defined in both '"
+                    << found_iter->second << "' and '" << ir_file << "'" << std::endl;
+                is_unique = false;
+                continue;
+            }
+
+            jobs.emplace_back(ir_file, function_name);
+            found_functions[function_name] = ir_file;
+        }
+    }
+
+    bool all_found = true;
+    for (auto& function_name : selected_functions) {
+        if (found_functions.count(function_name) == 0) {
+            std::cerr << "Function '" << function_name << "' not found" << std::endl;
+            all_found = false;
+        }
+    }
+
+    return all_found && is_unique;
+}
+
+void BitpackHlsBatch::runSlice(std::string ir_file, std::vector<FunctionJob*> slice) {
+    LLVMContext context;
+    SMDiagnostic err;
+
+    auto module = utility::loadModule(ir_file, err, context);
+
+    if (module.get() == nullptr) {
+        std::lock_guard<std::mutex> lock(log_mutex);
+        std::cerr << "IR module '" << ir_file << "' not found: "
+            << err.getMessage().str() << std::endl;
+        return;
+    }
+
+    std::vector<std::string> function_names;
+
+    for (auto* job : slice) {
+        function_names.push_back(job->function_name);
+    }
+
+    if (!utility::materializeFunctions(*module, function_names)) {
+        return;
+    }
+
+    for (auto* job : slice) {
+        auto* parsed_function = module->getFunction(job->function_name);
+        assert(parsed_function != nullptr);
+
+        /* Synthesis rewrites the function and dataflow tasks in place, each job
+         * takes a private copy so the shared module stays as parsed */
+        auto job_module = utility::cloneFunctionModule(*parsed_function);
+        auto* function = job_module->getFunction(job->function_name);
+
+        if (dataflow && DataflowHls::isDataflowTop(*function)) {
+            DataflowHls hls(*function, out_dir);
+
+            job->status = hls.run();
+            continue;
+        }
+
+        hardware::HardwareConstraints constraints;
+        BitpackHls hls(*function, constraints, out_dir);
+
+        job->status = hls.run();
+    }
+}
+
+bool BitpackHlsBatch::run() {
+    if (!collectJobs()) {
+        return false;
+    }
+
+    if (jobs.empty()) {
+        std::cerr << "No functions to synthesize" << std::endl;
+        return false;
+    }
+
+    if (auto ec = sys::fs::create_directories(out_dir)) {
+        std::cerr << "Cannot create output directory '" << out_dir << "': "
+            << ec.message() << std::endl;
+        return false;
+    }
+
+    auto strategy = hardware_concurrency(n_jobs);
+    const unsigned int n_threads =
+        std::max(1U, std::min<unsigned int>(strategy.compute_thread_count(), jobs.size()));
+
+    {
+        ThreadPool pool(strategy);
+
+        for (auto& ir_file : ir_files) {
+            std::vector<FunctionJob*> module_jobs;
+
+            for (auto& job : jobs) {
+                if (job.ir_file == ir_file) {
+                    module_jobs.push_back(&job);
+                }
+            }
+
+            /* Round-robin module functions over at most one slice per thread */
+            const unsigned int n_slices =
+                std::min<unsigned int>(n_threads, module_jobs.size());
+
+            std::vector<std::vector<FunctionJob*>> slices(n_slices);
+            for (unsigned int i = 0; i < module_jobs.size(); i++) {
+                slices[i % n_slices].push_back(module_jobs[i]);
+            }
+
+            for (auto& slice : slices) {
+                pool.async([this, ir_file, slice]() { runSlice(ir_file, slice); });
+            }
+        }
+
+        pool.wait();
+    }
+
+    bool status = true;
+    for (auto& job : jobs) {
+        if (!job.status) {
+            std::cerr << "HLS failed: " << job.ir_file << ": " << job.function_name << std::endl;
+            status = false;
+        }
+    }
+
+    return status;
+}
@@ -0,0 +1,63 @@
+#ifndef __BITPACK_HLS_BATCH_HPP__
+#define __BITPACK_HLS_BATCH_HPP__
+
+#include <string>
+#include <vector>
+#include <set>
+
+namespace llvm {
+    namespace bphls {
+
+/**
+ * Whole-module batch compilation. Every selected function of every input
+ * module is synthesized by its own BitpackHls instance, functions are
+ * spread across a thread pool.
+ *
+ * LLVM contexts are not thread safe, so each pool task parses its own
+ * copy of the module and synthesizes a slice of the module functions.
+ * The module is therefore parsed at most once per worker thread instead
+ * of once per function. Bitcode modules are loaded lazily, a task reads
+ * only the bodies of its functions and their callees. Every function is
+ * synthesized from its own copy, so functions and dataflow tasks shared
+ * by the jobs of a slice are never seen rewritten.
+ */
+class BitpackHlsBatch {
+public:
+    BitpackHlsBatch(std::string out_dir, unsigned int n_jobs = 0);
+
+    void addModule(std::string ir_file);
+
+    /** Select function by name. No selection means all defined functions */
+    void selectFunction(std::string function_name);
+
+    bool run();
+
+private:
+    struct FunctionJob {
+        std::string ir_file;
+        std::string function_name;
+        bool status;
+
+        FunctionJob(std::string ir_file, std::string function_name)
+            : ir_file(ir_file),
+              function_name(function_name),
+              status(false) {}
+    };
+
+    std::string out_dir;
+    unsigned int n_jobs;
+
+    std::vector<std::string> ir_files;
+    std::set<std::string> selected_functions;
+
+    std::vector<FunctionJob> jobs;
+
+    bool collectJobs();
+
+    void runSlice(std::string ir_file, std::vector<FunctionJob*> slice);
+};
+
+    } /* namespace bphls */
+} /* namespace llvm */
+
+#endif /* __BITPACK_HLS_BATCH_HPP__ */
@@ -0,0 +1,72 @@
+#include <iostream>
+#include <string>
+
+#include <llvm/Support/raw_ostream.h>
+#include <llvm/Support/FileSystem.h>
+
+#include <llvm/IR/Function.h>
+
+#include "hardware/HardwareConstraints.hpp"
+#include "rtl/DataflowGenerator.hpp"
+#include "verilog/VerilogWriter.hpp"
+#include "BitpackHls.hpp"
+
+#include "DataflowHls.hpp"
+
+using namespace llvm;
+using namespace bphls;
+
+DataflowHls::DataflowHls(Function& function, std::string out_dir)
+    : function(function),
+      out_dir(out_dir) {}
+
+bool DataflowHls::isDataflowTop(Function& function) {
+    return rtl::DataflowGenerator::isDataflowFunction(function);
+}
+
+bool DataflowHls::run() {
+    const std::string function_name = function.getName().str();
+    const std::string sub_dir = out_dir + "/" + function_name;
+
+    if (auto ec = sys::fs::create_directories(sub_dir)) {
+        std::cerr << "Cannot create output directory '" << sub_dir << "': "
+            << ec.message() << std::endl;
+        return false;
+    }
+
+    const std::string hls_output_file = out_dir + "/" + function_name + ".v";
+
+    std::error_code ec;
+    raw_fd_ostream hls_output(hls_output_file, ec, sys::fs::OF_None);
+
+    if (ec) {
+        std::cerr << "Cannot open output file '" << hls_output_file << "': "
+            << ec.message() << std::endl;
+        return false;
+    }
+
+    /* Submodules first, each one is a standalone FSM module */
+    for (auto* callee : rtl::DataflowGenerator::getCallees(function)) {
+        hardware::HardwareConstraints constraints;
+        BitpackHls hls(*callee, constraints, sub_dir);
+
+        if (!hls.run()) {
+            std::cerr << "Dataflow task '" << callee->getName().str()
+                << "' of '" << function_name << "' failed" << std::endl;
+            return false;
+        }
+
+        if (!hls.writeOut(hls_output)) {
+            return false;
+        }
+        hls_output << "\n";
+    }
+
+    rtl::DataflowGenerator dataflow_gen(function);
+
+    verilog::VerilogWriter verilog_write(hls_output, dataflow_gen.generate());
+
+    verilog_write.print();
+
+    return true;
+}
@@ -0,0 +1,33 @@
+#ifndef __DATAFLOW_HLS_HPP__
+#define __DATAFLOW_HLS_HPP__
+
+#include <string>
+
+#include <llvm/IR/Function.h>
+
+namespace llvm {
+    namespace bphls {
+
+/**
+ * Dataflow HLS flow of a function made of calls. Callees are synthesized
+ * as ordinary FSM modules into "<out_dir>/<function>/", the function itself
+ * becomes a structural module instancing them, see rtl::DataflowGenerator.
+ * The whole hierarchy is written to "<out_dir>/<function>.v".
+ */
+class DataflowHls {
+public:
+    DataflowHls(Function& function, std::string out_dir);
+
+    static bool isDataflowTop(Function& function);
+
+    bool run();
+
+private:
+    Function& function;
+    std::string out_dir;
+};
+
+    } /* namespace bphls */
+} /* namespace llvm */
+
+#endif /* __DATAFLOW_HLS_HPP__ */
@@ -3,23 +3,29 @@
 #include <string>
 #include <map>
 #include <set>
+#include <vector>
+#include <climits>
+#include <algorithm>
 
 #include <llvm/IR/Instruction.h>
-
-#include "../math/HungarianMethod.hpp"
+#include <llvm/Support/MathExtras.h>
 
 #include "../hardware/HardwareConstraints.hpp"
 #include "../scheduling/fsm/FsmState.hpp"
 #include "../scheduling/fsm/Fsm.hpp"
+#include "../utility/PhaseProfile.hpp"
 #include "Binding.hpp"
 
-extern llvm::bphls::hardware::HardwareConstraints* constraints;
-
 using namespace llvm;
 using namespace bphls;
 
 void binding::Binding::assignInstructions() {
-    auto& fu_num_constrints = constraints->getFuNumConstraints();
+    auto& fu_num_constrints = constraints.getFuNumConstraints();
+
+    numberFuInstances();
+
+    instr_fu_map.clear();
+    instr_binding_idx.assign(numbering.getInstructionsNum(), NONE);
 
     std::set<Instruction*> shareable_instr;
 
@@ -34,6 +40,10 @@ void binding::Binding::assignInstructions() {
 
     AssignInfo assign_info;
 
+    assign_info.mux_inputs.assign(n_fu_insts, 0);
+    assign_info.existing_operands.resize(n_fu_insts);
+    assign_info.existing_instructions.resize(n_fu_insts);
+
     findIndependantInstructions(
         shareable_instr,
         assign_info.independant_instructions
@@ -47,8 +57,6 @@ void binding::Binding::assignInstructions() {
     // }
 
     for (auto* state : fsm.states()) {
-        state_idx_instr_lookup.clear();
-
         for (auto& fu_num : fu_num_constrints) {
             auto* fu = fu_num.first;
             auto num_constrint = fu_num.second;
@@ -61,12 +69,35 @@ void binding::Binding::assignInstructions() {
 }
 
 bool binding::Binding::exists(Instruction* instr) {
-    return instr_fu_map.count(instr) != 0;
+    auto id = numbering.getId(instr);
+
+    return (id < instr_binding_idx.size()) && (instr_binding_idx[id] != NONE);
 }
 
 binding::Binding::FuInstId& binding::Binding::getBindedFu(Instruction* instr) {
     assert(exists(instr));
-    return instr_fu_map[instr];
+    return instr_fu_map[instr_binding_idx[numbering.getId(instr)]].second;
+}
+
+void binding::Binding::numberFuInstances() {
+    fu_inst_offset.clear();
+    n_fu_insts = 0;
+
+    for (auto& fu_num : constraints.getFuNumConstraints()) {
+        if (fu_num.second.has_value()) {
+            fu_inst_offset[fu_num.first] = n_fu_insts;
+            n_fu_insts += fu_num.second.value();
+        }
+    }
+
+    fu_inst_instructions.assign(n_fu_insts, {});
+}
+
+unsigned int binding::Binding::getFuInstIdx(FuInstId fu_inst_id) {
+    auto offset_iter = fu_inst_offset.find(fu_inst_id.first);
+    assert(offset_iter != fu_inst_offset.end());
+
+    return offset_iter->second + fu_inst_id.second;
 }
 
 void binding::Binding::bindFuInState(FsmState* state,
@@ -74,12 +105,13 @@ void binding::Binding::bindFuInState(FsmState* state,
                                      unsigned int n_available,
                                      AssignInfo& assign_info)
 {
-    Table weights(n_available, std::vector<int>(n_available));
-    Table assignment(n_available, std::vector<int>(n_available));
+    /* Rows are instructions of the state, columns are unit instances */
+    bwm_weights.resize(n_available * n_available);
+    state_instructions.clear();
 
-    int instr_idx = 0;
+    unsigned int instr_idx = 0;
     for (auto* instr : state->instructions()) {
-        if (constraints->getInstructionFu(*instr) != fu) {
+        if (constraints.getInstructionFu(*instr) != fu) {
             continue;
         }
         // std::cout << "Sharing instruction: " << instr->getOpcodeName() << std::endl;
@@ -90,11 +122,10 @@ void binding::Binding::bindFuInState(FsmState* state,
             instr_idx,
             fu,
             n_available,
-            assign_info,
-            weights
+            assign_info
         );
 
-        state_idx_instr_lookup[instr_idx] = instr;
+        state_instructions.push_back(instr);
         instr_idx += 1;
     }
     
@@ -102,16 +133,14 @@ void binding::Binding::bindFuInState(FsmState* state,
     if (n_share >= 1) {
         assert(n_share <= n_available);
 
-        solveBwm(weights, assignment);
+        solveBwm(n_share, n_available);
 
-        verifyBwm(n_share, n_available, assignment);
+        verifyBwm(n_share, n_available);
 
         updateAssignment(
             n_share,
-            n_available,
             fu,
-            assign_info,
-            assignment
+            assign_info
         );
     }
 }
@@ -120,17 +149,18 @@ void binding::Binding::createWeights(Instruction* instr,
                                      unsigned int instr_idx,
                                      hardware::FunctionalUnit* fu,
                                      unsigned int n_available,
-                                     AssignInfo& assign_info,
-                                     Table& weights)
+                                     AssignInfo& assign_info)
 {
     static const int EXIST_IN_MUX_FACTOR = 1;
     static const int NEW_IN_MUX_FACTOR = 10;
     static const int OUT_SHARE_REG_FACTOR = -5;
 
 
+    unsigned int fu_offset = getFuInstIdx(std::make_pair(fu, 0));
+
     for (unsigned int fu_inst = 0; fu_inst < n_available; fu_inst++) {
         int weight = 0;
-        auto fu_inst_id = std::make_pair(fu, fu_inst);
+        unsigned int fu_inst_idx = fu_offset + fu_inst;
 
         for (auto& op : instr->operands()) {
             auto* op_instr = dyn_cast<Instruction>(&op);
@@ -139,15 +169,15 @@ void binding::Binding::createWeights(Instruction* instr,
                 continue;
             }
 
-            if (assign_info.existing_operands[fu_inst_id].count(op_instr) == 0) {
+            if (assign_info.existing_operands[fu_inst_idx].count(op_instr) == 0) {
                 weight += NEW_IN_MUX_FACTOR;
             }
         }
 
         bool is_out_reg_sharable = false;
-        for (auto* instr : assign_info.existing_instructions[fu_inst_id]) {
+        for (auto* instr : assign_info.existing_instructions[fu_inst_idx]) {
             bool is_independant =
-                assign_info.independant_instructions.count(instr) != 0;
+                assign_info.independant_instructions.contains(instr);
 
             if (is_independant) {
                 is_out_reg_sharable = true;
@@ -159,53 +189,34 @@ void binding::Binding::createWeights(Instruction* instr,
             weight += OUT_SHARE_REG_FACTOR;
         }
 
-        weight += EXIST_IN_MUX_FACTOR * assign_info.mux_inputs[fu_inst_id];
+        weight += EXIST_IN_MUX_FACTOR * assign_info.mux_inputs[fu_inst_idx];
 
-        weights[fu_inst][instr_idx] = weight;
+        bwm_weights[instr_idx * n_available + fu_inst] = weight;
     }
 }
 
-void binding::Binding::solveBwm(Table& weights, Table& assignment) {
-    hungarian_problem_t hungarian_solver;
-
-    unsigned int rows = weights.size();
-    assert(rows > 0);
-    unsigned int cols = weights[0].size();
-    assert(cols > 0);
-
-    // not necessary but good to enforce
-    assert(rows == cols);
-
-    int** matrix = tableToRawMatrix(weights, rows, cols);
-
-    /* Initialize the hungarian_problem using the cost matrix*/
-    hungarian_init(&hungarian_solver, matrix, rows, cols, HUNGARIAN_MODE_MINIMIZE_COST);
-
-    /* solve the assignement problem */
-    hungarian_solve(&hungarian_solver);
+void binding::Binding::solveBwm(unsigned int n_share, unsigned int n_available) {
+    assert(n_share > 0);
+    assert(n_share <= n_available);
 
-    for(unsigned int i = 0; i < rows; i++) {
-        for(unsigned int j = 0; j < cols; j++) {
-            assignment[i][j] = hungarian_solver.assignment[i][j];
-        }
-    }
+    utility::PhaseProfile::count("binding.assignment_solves");
 
-    /* free used memory */
-    hungarian_free(&hungarian_solver);
+    bool is_solved = bwm_solver.solve(bwm_weights.data(), n_share, n_available);
 
-    for(unsigned int i = 0; i < rows; i++) {
-        delete[] matrix[i];
-    }
-    delete[] matrix;
+    assert(is_solved && "No feasible assignment!");
+    (void)is_solved;
 }
 
-void binding::Binding::verifyBwm(unsigned int n_share, unsigned int n_available, Table& assignment) {
+void binding::Binding::verifyBwm(unsigned int n_share, unsigned int n_available) {
+    std::vector<bool> is_assigned(n_available, false);
+
     unsigned int n_assigned = 0;
-    for (unsigned int fu_inst = 0; fu_inst < n_available; fu_inst++) {
-        for (unsigned int fu_inst_shared = 0; fu_inst_shared < n_share; fu_inst_shared++) {
-            if (assignment[fu_inst][fu_inst_shared] != 0) {
-                n_assigned += 1;
-            }
+    for (unsigned int instr_idx = 0; instr_idx < n_share; instr_idx++) {
+        unsigned int fu_inst = bwm_solver.getColumn(instr_idx);
+
+        if ((fu_inst < n_available) && !is_assigned[fu_inst]) {
+            is_assigned[fu_inst] = true;
+            n_assigned += 1;
         }
     }
 
@@ -218,222 +229,227 @@ void binding::Binding::verifyBwm(unsigned int n_share, unsigned int n_available,
 }
 
 void binding::Binding::updateAssignment(unsigned int n_share,
-                                        unsigned int n_available,
                                         hardware::FunctionalUnit* fu,
-                                        AssignInfo& assign_info,
-                                        Table& assignment)
+                                        AssignInfo& assign_info)
 {
-    assert(n_share <= n_available);
+    for (unsigned int instr_idx = 0; instr_idx < n_share; instr_idx++) {
+        auto* instr = state_instructions[instr_idx];
 
-    for (unsigned int fu_inst = 0; fu_inst < n_available; fu_inst++) {
-        for (int fu_inst_shared= 0; fu_inst_shared < n_share; fu_inst_shared++) {
-            if (assignment[fu_inst][fu_inst_shared] != 0) {
-                auto* instr = state_idx_instr_lookup[fu_inst_shared];
-
-                auto fu_inst_id = std::make_pair(fu, fu_inst);
-                instr_fu_map[instr] = fu_inst_id;
-                fu_instr_set_map[fu_inst_id].push_back(instr);
-
-                unsigned int n_operands = 0;
-                for (auto& op : instr->operands()) {
-                    n_operands++;
-                    
-                    auto* operand = dyn_cast<Instruction>(&op);
-
-                    if (operand == nullptr) {
-                        continue;
-                    }
-
-                    if (assign_info.existing_operands[fu_inst_id].count(operand) == 0) {
-                        assign_info.existing_operands[fu_inst_id].insert(operand);
-                        assign_info.mux_inputs[fu_inst_id]++;
-                    }
-                }
+        FuInstId fu_inst_id = std::make_pair(fu, bwm_solver.getColumn(instr_idx));
+        unsigned int fu_inst_idx = getFuInstIdx(fu_inst_id);
+
+        auto instr_id = numbering.getId(instr);
+        assert(instr_binding_idx[instr_id] == NONE);
+
+        instr_binding_idx[instr_id] = instr_fu_map.size();
+        instr_fu_map.push_back(std::make_pair(instr, fu_inst_id));
+        fu_inst_instructions[fu_inst_idx].push_back(instr);
+
+        for (auto& op : instr->operands()) {
+            auto* operand = dyn_cast<Instruction>(&op);
 
-                assign_info.existing_instructions[fu_inst_id].insert(instr);
+            if (operand == nullptr) {
+                continue;
+            }
+
+            if (assign_info.existing_operands[fu_inst_idx].insert(operand).second) {
+                assign_info.mux_inputs[fu_inst_idx]++;
             }
         }
+
+        assign_info.existing_instructions[fu_inst_idx].push_back(instr);
     }
 }
 
 void binding::Binding::findIndependantInstructions(
     std::set<Instruction*>& instructions,
-    std::map<Instruction*, std::set<Instruction*>>& independant_instructions
+    IndependenceMatrix& independant_instructions
 ) {
-    std::map<Instruction*, std::set<BasicBlock*>> live_blocks;
-    findInstructionsLiveBlocks(instructions, live_blocks);
+    independant_instructions.reset(instructions);
 
-    for (auto libe_block : live_blocks) {
-        independant_instructions.insert(
-            std::make_pair(libe_block.first, std::set<Instruction*>())
-        );
-    }
+    auto n_instr = independant_instructions.getInstructionsNum();
 
-    findIndependantInstructionsInLiveBlocks(independant_instructions, live_blocks);
+    if (n_instr == 0) {
+        return;
+    }
 
-    for (auto& instr_instr_set : independant_instructions) {
-        auto* instr = instr_instr_set.first;
+    encodeStates(independant_instructions.getInstruction(0)->getFunction());
 
-        /* Erase instruction from its independant list */
-        independant_instructions[instr].erase(instr);
+    std::vector<LiveStates*> instr_live_states(n_instr);
+    for (unsigned int row = 0; row < n_instr; row++) {
+        instr_live_states[row] = &getLiveStates(independant_instructions.getInstruction(row));
     }
-}
 
-void binding::Binding::findInstructionsLiveBlocks(
-    std::set<Instruction*>& instructions,
-    std::map<Instruction*, std::set<BasicBlock*>>& live_blocks
-) {
-    for (auto* instr : instructions) {
-        live_blocks.insert(std::make_pair(instr, std::set<BasicBlock*>()));
-        auto instr_idx = lva.getBitPosition(instr);
-
-        for (auto bb_info : lva.iter_bb_info()) {
-            auto* basic_block = bb_info.first;
-            auto* info = bb_info.second;
-
-            bool instr_is_alive =
-                info->use.test(instr_idx)
-                    || info->def.test(instr_idx)
-                    || info->in.test(instr_idx)
-                    || info->out.test(instr_idx);
-
-            if (instr_is_alive) {
-                live_blocks[instr].insert(basic_block);
+    utility::PhaseProfile::count("binding.compat_pairs", n_instr * (n_instr - 1LL) / 2);
+
+    for (unsigned int row_a = 0; row_a < n_instr; row_a++) {
+        for (unsigned int row_b = row_a + 1; row_b < n_instr; row_b++) {
+            if (areIndependantInStates(*instr_live_states[row_a], *instr_live_states[row_b])) {
+                independant_instructions.setIndependant(row_a, row_b);
             }
         }
     }
 }
 
-void binding::Binding::findIndependantInstructionsInLiveBlocks(
-    std::map<Instruction*, std::set<Instruction*>>& independant_instructions,
-    std::map<Instruction*, std::set<BasicBlock*>>& live_blocks
-) {
-    auto end = live_blocks.end();
-    for (auto instr_bb_set_a = live_blocks.begin(); instr_bb_set_a != end; instr_bb_set_a++) {
-        for (auto instr_bb_set_b = instr_bb_set_a; instr_bb_set_b != end; instr_bb_set_b++) {
+void binding::Binding::encodeStates(Function* function) {
+    if (n_bb_words != 0) {
+        return;
+    }
 
-            auto* instr_a = instr_bb_set_a->first;
-            auto& bb_set_a = instr_bb_set_a->second;
+    createStateEncoding(function, state_encoding, bb_last_state);
 
-            auto* instr_b = instr_bb_set_b->first;
-            auto& bb_set_b = instr_bb_set_b->second;
+    n_bb_words = (numbering.getBasicBlocksNum() + 63) / 64;
+    live_states_table.resize(numbering.getInstructionsNum());
+}
 
-            // std::cout << "Instr A: " << instr_a->getOpcodeName() << std::endl;
-            // std::cout << "Instr b: " << instr_b->getOpcodeName() << std::endl;
+binding::Binding::LiveStates& binding::Binding::getLiveStates(Instruction* instr) {
+    auto& live_states = live_states_table[numbering.getId(instr)];
 
-            if (independant_instructions[instr_a].count(instr_b) != 0) {
-                continue;
-            }
+    /* Computed live states have at least one block word */
+    if (!live_states.blocks.empty()) {
+        return live_states;
+    }
 
-            /* Must be both optimized or non-optimaized */
-            if (isRegOptimized(instr_a, fsm.getEndState(instr_a))
-                    != isRegOptimized(instr_b, fsm.getEndState(instr_b)))
-            {
-                continue;
-            }
+    live_states.is_reg_optimized = isRegOptimized(instr, fsm.getEndState(instr));
+    live_states.blocks.assign(n_bb_words, 0);
+    live_states.intervals.clear();
 
-            std::set<BasicBlock*> intersection;
-            std::set_intersection(
-                bb_set_a.begin(), bb_set_a.end(),
-                bb_set_b.begin(), bb_set_b.end(),
-                std::inserter(intersection, intersection.begin())
-            );
+    std::vector<BasicBlock*> live_blocks;
+    lva.findLiveBlocks(instr, live_blocks);
 
-            if (intersection.empty()
-                    || areIndependantInStates(instr_a, instr_b, intersection))
-            {
-                /* Insreuctions are independant */
-                independant_instructions[instr_a].insert(instr_b);
-                independant_instructions[instr_b].insert(instr_a);
-            }
+    for (auto* basic_block : live_blocks) {
+        auto bb_idx = numbering.getId(basic_block);
+
+        /* Forwarding blocks bypassed by the FSM have no states */
+        if (bb_last_state[bb_idx] == NONE) {
+            continue;
         }
-    }
-}
 
-bool binding::Binding::isRegOptimized(Instruction* instr, FsmState* state) {
-    std::set<Instruction*> phi_nodes;
-    if (checkPhiSuccessors(instr, state, phi_nodes)) {
-        return false;
+        live_states.blocks[bb_idx / 64] |= (uint64_t(1) << (bb_idx % 64));
     }
 
-    if (phi_nodes.empty()) {
-        return true;
-    }
+    /* Intervals are stored in the order of the set block bits */
+    for (unsigned int word_idx = 0; word_idx < n_bb_words; word_idx++) {
+        uint64_t word = live_states.blocks[word_idx];
 
-    visitTransitionStates(state, phi_nodes);
+        while (word != 0) {
+            auto bb_idx = word_idx * 64 + countTrailingZeros(word);
+            word &= word - 1;
 
-    return phi_nodes.empty();
+            live_states.intervals.push_back(
+                getLiveInterval(instr, numbering.getBasicBlock(bb_idx))
+            );
+        }
+    }
+
+    return live_states;
 }
 
-bool binding::Binding::areIndependantInStates(Instruction* instr_a,
-                            Instruction* instr_b,
-                            std::set<BasicBlock*>& intersection)
+std::pair<unsigned int, unsigned int> binding::Binding::getLiveInterval(Instruction* instr,
+                                                                        BasicBlock* basic_block)
 {
-    std::map<FsmState*, unsigned int> state_encoding;
-    std::map<BasicBlock*, unsigned int> bb_last_state;
+    unsigned int first_state = 0;
+    unsigned int last_state = bb_last_state[numbering.getId(basic_block)];
 
-    createStateEncoding(
-        (*intersection.begin())->getParent(),
-        state_encoding,
-        bb_last_state
-    );
+    unsigned int min_state = UINT_MAX;
+    unsigned int max_state = 0;
 
-    bool are_independant = true;
+    auto add_state = [&min_state, &max_state](unsigned int state) {
+        min_state = std::min(min_state, state);
+        max_state = std::max(max_state, state);
+    };
 
-    for (auto* basic_block : intersection) {
-        assert(bb_last_state.count(basic_block) != 0);
+    /* Definition state */
+    if (instr->getParent() == basic_block) {
+        auto state_code = state_encoding[fsm.getEndState(instr)->getId()];
+        assert(state_code != NONE);
 
-        unsigned int first_state = 0;
-        unsigned int last_state = bb_last_state[basic_block];
+        add_state(state_code);
+    }
 
-        std::vector<unsigned int> instr_a_states;
-        std::vector<unsigned int> instr_b_states;
+    /* Use states, users of other blocks make the value live-out */
+    for (auto* user : instr->users()) {
+        auto* successor = dyn_cast<Instruction>(user);
 
-        addInstructionDefState(
-            basic_block,
-            instr_a,
-            instr_a_states,
-            instr_b,
-            instr_b_states,
-            state_encoding
-        );
+        if ((successor == nullptr) || (successor->getParent() != basic_block)) {
+            continue;
+        }
 
-        addInstructionUseState(
-            basic_block,
-            instr_a,
-            instr_a_states,
-            instr_b,
-            instr_b_states,
-            state_encoding,
-            last_state
-        );
+        if (successor == basic_block->getTerminator()) {
+            add_state(last_state);
+            continue;
+        }
 
-        addInstructionLiveInOut(
-            basic_block,
-            instr_a,
-            instr_a_states,
-            instr_b,
-            instr_b_states,
-            state_encoding,
-            first_state,
-            last_state
-        );
+        auto* end_state = fsm.getEndState(successor);
 
-        assert(!instr_a_states.empty());
-        assert(!instr_b_states.empty());
+        if ((end_state != nullptr) && (state_encoding[end_state->getId()] != NONE)) {
+            add_state(state_encoding[end_state->getId()]);
+        }
+    }
 
-        auto min_state_a = *std::min_element(instr_a_states.begin(), instr_a_states.end());
-        auto max_state_a = *std::max_element(instr_a_states.begin(), instr_a_states.end());
-        auto min_state_b = *std::max_element(instr_b_states.begin(), instr_b_states.end());
-        auto max_state_b = *std::max_element(instr_b_states.begin(), instr_b_states.end());
+    if (lva.isLiveOut(instr, basic_block)) {
+        add_state(last_state);
+    }
 
-        if (!((min_state_a > max_state_b) || (max_state_a < min_state_b))) {
-            are_independant = false;
-            break;
+    if (lva.isLiveIn(instr, basic_block)) {
+        add_state(first_state);
+    }
+
+    /* Only read by phi copies on the block entry */
+    if (min_state == UINT_MAX) {
+        add_state(first_state);
+    }
+
+    return std::make_pair(min_state, max_state);
+}
+
+bool binding::Binding::areIndependantInStates(LiveStates& live_states_a, LiveStates& live_states_b) {
+    /* Must be both optimized or non-optimaized */
+    if (live_states_a.is_reg_optimized != live_states_b.is_reg_optimized) {
+        return false;
+    }
+
+    /* Intervals of the blocks in preceding words */
+    unsigned int base_a = 0;
+    unsigned int base_b = 0;
+
+    for (unsigned int word_idx = 0; word_idx < n_bb_words; word_idx++) {
+        uint64_t word_a = live_states_a.blocks[word_idx];
+        uint64_t word_b = live_states_b.blocks[word_idx];
+        uint64_t common_blocks = word_a & word_b;
+
+        while (common_blocks != 0) {
+            uint64_t lower_mask = (common_blocks & -common_blocks) - 1;
+            common_blocks &= common_blocks - 1;
+
+            auto& interval_a = live_states_a.intervals[base_a + countPopulation(word_a & lower_mask)];
+            auto& interval_b = live_states_b.intervals[base_b + countPopulation(word_b & lower_mask)];
+
+            if (!((interval_a.first > interval_b.second) || (interval_a.second < interval_b.first))) {
+                return false;
+            }
         }
+
+        base_a += countPopulation(word_a);
+        base_b += countPopulation(word_b);
     }
 
-    return are_independant;
+    return true;
+}
+
+bool binding::Binding::isRegOptimized(Instruction* instr, FsmState* state) {
+    std::set<Instruction*> phi_nodes;
+    if (checkPhiSuccessors(instr, state, phi_nodes)) {
+        return false;
+    }
+
+    if (phi_nodes.empty()) {
+        return true;
+    }
+
+    visitTransitionStates(state, phi_nodes);
+
+    return phi_nodes.empty();
 }
 
 bool binding::Binding::checkPhiSuccessors(Instruction* instr,
@@ -472,7 +488,8 @@ void binding::Binding::visitTransitionStates(FsmState* state, std::set<Instructi
     auto n_transition = state->getTransitionsNum();
 
     if (n_transition > 1) {
-        for (unsigned int i = 0; i < n_transition; i++) {
+        /* Default transition is counted but not stored */
+        for (unsigned int i = 0; i + 1 < n_transition; i++) {
             auto* trans_state = state->getTransitionState(i);
 
             for (auto* instr : trans_state->instructions()) {
@@ -487,9 +504,12 @@ void binding::Binding::visitTransitionStates(FsmState* state, std::set<Instructi
 }
 
 void binding::Binding::createStateEncoding(Function* function,
-                                           std::map<FsmState*, unsigned int>& state_encoding,
-                                           std::map<BasicBlock*, unsigned int>& bb_last_state)
+                                           std::vector<unsigned int>& state_encoding,
+                                           std::vector<unsigned int>& bb_last_state)
 {
+    state_encoding.assign(fsm.getStatesNum(), NONE);
+    bb_last_state.assign(numbering.getBasicBlocksNum(), NONE);
+
     for (auto& basic_block : *function) {
         unsigned order = 0;
 
@@ -513,11 +533,14 @@ void binding::Binding::createStateEncoding(Function* function,
             }
         }
 
-        assert(cur_state != nullptr);
+        /* Forwarding blocks bypassed by the FSM have no states */
+        if (cur_state == nullptr) {
+            continue;
+        }
 
         while (cur_state != nullptr) {
-            if (state_encoding.count(cur_state) == 0) {
-                state_encoding[cur_state] = order;
+            if (state_encoding[cur_state->getId()] == NONE) {
+                state_encoding[cur_state->getId()] = order;
                 order++;
             }
 
@@ -534,107 +557,6 @@ void binding::Binding::createStateEncoding(Function* function,
             }
         }
 
-        bb_last_state[&basic_block] = order - 1;
+        bb_last_state[numbering.getId(&basic_block)] = order - 1;
     }
 }
-
-void binding::Binding::addInstructionDefState(
-    BasicBlock* basic_block,
-    Instruction* instr_a,
-    std::vector<unsigned int>& instr_a_states,
-    Instruction* instr_b,
-    std::vector<unsigned int>& instr_b_states,
-    std::map<FsmState*, unsigned int>& state_encoding
-) {
-    if (instr_a->getParent() == basic_block) {
-        assert(state_encoding.count(fsm.getEndState(instr_a)) != 0);
-        instr_a_states.push_back(state_encoding[fsm.getEndState(instr_a)]);
-    }
-
-    if (instr_b->getParent() == basic_block) {
-        assert(state_encoding.count(fsm.getEndState(instr_b)) != 0);
-        instr_b_states.push_back(state_encoding[fsm.getEndState(instr_b)]);
-    }
-}
-
-void binding::Binding::addInstructionUseState(
-    BasicBlock* basic_block,
-    Instruction* instr_a,
-    std::vector<unsigned int>& instr_a_states,
-    Instruction* instr_b,
-    std::vector<unsigned int>& instr_b_states,
-    std::map<FsmState*, unsigned int>& state_encoding,
-    unsigned int last_state
-) {
-    for (auto* user : instr_a->users()) {
-        auto* successor = dyn_cast<Instruction>(user);
-        if (successor == nullptr) {
-            continue;
-        }
-
-        if (successor == basic_block->getTerminator()) {
-            instr_a_states.push_back(last_state);
-            continue;
-        }
-
-        if (state_encoding.count(fsm.getEndState(successor)) != 0) {
-            instr_a_states.push_back(state_encoding[fsm.getEndState(successor)]);
-        }
-    }
-
-    for (auto* user : instr_b->users()) {
-        auto* successor = dyn_cast<Instruction>(user);
-        if (successor == nullptr) {
-            continue;
-        }
-
-        if (successor == basic_block->getTerminator()) {
-            instr_b_states.push_back(last_state);
-            continue;
-        }
-
-        if (state_encoding.count(fsm.getEndState(successor)) != 0) {
-            instr_b_states.push_back(state_encoding[fsm.getEndState(successor)]);
-        }
-    }
-}
-
-void binding::Binding::addInstructionLiveInOut(
-    BasicBlock* basic_block,
-    Instruction* instr_a,
-    std::vector<unsigned int>& instr_a_states,
-    Instruction* instr_b,
-    std::vector<unsigned int>& instr_b_states,
-    std::map<FsmState*, unsigned int>& state_encoding,
-    unsigned int first_state,
-    unsigned int last_state
-) {
-    auto instr_a_idx = lva.getBitPosition(instr_a);
-    auto instr_b_idx = lva.getBitPosition(instr_b);
-
-    if (lva.getInfo(basic_block)->out.test(instr_a_idx)) {
-        instr_a_states.push_back(last_state);
-    }
-    if (lva.getInfo(basic_block)->in.test(instr_a_idx)) {
-        instr_a_states.push_back(first_state);
-    }
-
-    if (lva.getInfo(basic_block)->out.test(instr_b_idx)) {
-        instr_a_states.push_back(last_state);
-    }
-    if (lva.getInfo(basic_block)->in.test(instr_b_idx)) {
-        instr_a_states.push_back(first_state);
-    }
-}
-
-int** binding::Binding::tableToRawMatrix(Table& table, unsigned int rows, unsigned int cols) {
-    int** matrix = new int*[rows];
-    for (unsigned int i = 0; i < rows; i++) {
-        matrix[i] = new int[cols];
-        for (unsigned int j = 0; j < cols; j++) {
-            matrix[i][j] = table[i][j];
-        }
-    }
-    
-    return matrix;
-}
\ No newline at end of file
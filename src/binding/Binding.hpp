@@ -4,13 +4,19 @@
 #include <set>
 #include <map>
 #include <vector>
+#include <cstdint>
 
 #include <llvm/IR/Function.h>
+#include <llvm/ADT/DenseMap.h>
+#include <llvm/ADT/DenseSet.h>
 #include <llvm/ADT/iterator_range.h>
 
 #include "../hardware/HardwareConstraints.hpp"
 #include "../scheduling/fsm/Fsm.hpp"
+#include "../utility/FunctionNumbering.hpp"
+#include "../math/AssignmentSolver.hpp"
 #include "LifetimeAnalysis.hpp"
+#include "IndependenceMatrix.hpp"
 
 namespace llvm {
     namespace bphls {
@@ -18,46 +24,94 @@ namespace llvm {
 
 class Binding {
 public:
-    Binding(Fsm& fsm, LifetimeAnalysis& lva)
+    Binding(Fsm& fsm, LifetimeAnalysis& lva, hardware::HardwareConstraints& constraints)
         : fsm(fsm),
-          lva(lva) {}
+          lva(lva),
+          constraints(constraints),
+          numbering(fsm.getNumbering()),
+          n_fu_insts(0),
+          n_bb_words(0) {}
 
     typedef std::pair<hardware::FunctionalUnit*, unsigned char> FuInstId;
-    typedef std::map<Instruction*, FuInstId> BindingMap;
+
+    /** Orders unit instances by unit creation, then by instance */
+    struct FuInstLess {
+        bool operator () (const FuInstId& first, const FuInstId& second) const {
+            return std::make_pair(first.first->id, first.second)
+                < std::make_pair(second.first->id, second.second);
+        }
+    };
+    typedef std::vector<std::pair<Instruction*, FuInstId>> BindingMap;
 
     void assignInstructions();
 
     void findIndependantInstructions(
         std::set<Instruction*>& instructions,
-        std::map<Instruction*, std::set<Instruction*>>& independant_instructions
+        IndependenceMatrix& independant_instructions
     );
 
     bool exists(Instruction* instr);
 
+    unsigned int getFuInstancesNum() { return n_fu_insts; }
+
     FuInstId& getBindedFu(Instruction* instr);
 
+    /** Bound instructions in binding order, FSM state by state */
     typedef BindingMap::iterator BindingIterator;
     iterator_range<BindingIterator> iter_binding() {
         return make_range(instr_fu_map.begin(), instr_fu_map.end());
     }
 
 private:
+    static constexpr unsigned int NONE = utility::FunctionNumbering::NONE;
+
     Fsm& fsm;
     LifetimeAnalysis& lva;
+    hardware::HardwareConstraints& constraints;
+    utility::FunctionNumbering& numbering;
 
-    typedef std::vector<std::vector<int>> Table;
-
+    /* Tables are indexed by dense unit instance index, see getFuInstIdx */
     struct AssignInfo {
-        std::map<FuInstId, int> mux_inputs;
-        std::map<Instruction*, std::set<Instruction*>> independant_instructions;
-        std::map<FuInstId, std::set<Instruction*>> existing_operands;
-        std::map<FuInstId, std::set<Instruction*>> existing_instructions;
+        std::vector<int> mux_inputs;
+        IndependenceMatrix independant_instructions;
+        std::vector<DenseSet<Instruction*>> existing_operands;
+        std::vector<std::vector<Instruction*>> existing_instructions;
+    };
+
+    /** States where an instruction value is alive, per basic block.
+     *  Intervals are kept only for the blocks set in the bitset, in
+     *  increasing block order */
+    struct LiveStates {
+        bool is_reg_optimized;
+        std::vector<uint64_t> blocks;
+        std::vector<std::pair<unsigned int /*min*/, unsigned int /*max*/>> intervals;
     };
 
     BindingMap instr_fu_map;
-    std::map<FuInstId, std::vector<Instruction*>> fu_instr_set_map;
+    std::vector<unsigned int> instr_binding_idx;
 
-    std::map<unsigned int, Instruction*> state_idx_instr_lookup;
+    /* Instances of every constrained unit are numbered consecutively */
+    DenseMap<hardware::FunctionalUnit*, unsigned int> fu_inst_offset;
+    unsigned int n_fu_insts;
+    std::vector<std::vector<Instruction*>> fu_inst_instructions;
+
+    /* Weighted bipartite matching workspace, reused by every state */
+    math::AssignmentSolver<int> bwm_solver;
+    std::vector<int> bwm_weights;
+    std::vector<Instruction*> state_instructions;
+
+    /* State encoding and live states are computed once per function, indexed
+     * by state id, basic block id and instruction id. Bypassed basic blocks
+     * have no last state (NONE) */
+    std::vector<unsigned int> state_encoding;
+    std::vector<unsigned int> bb_last_state;
+    unsigned int n_bb_words;
+
+    std::vector<LiveStates> live_states_table;
+
+    void numberFuInstances();
+
+    unsigned int getFuInstIdx(FuInstId fu_inst_id);
 
     void bindFuInState(FsmState* state,
                        hardware::FunctionalUnit* fu,
@@ -68,34 +122,25 @@ private:
                        unsigned int instr_idx,
                        hardware::FunctionalUnit* fu,
                        unsigned int n_available,
-                       AssignInfo& assign_info,
-                       Table& weights);
+                       AssignInfo& assign_info);
 
-    void solveBwm(Table& weights, Table& assignment);
+    void solveBwm(unsigned int n_share, unsigned int n_available);
 
-    void verifyBwm(unsigned int n_share, unsigned int n_available, Table& assignment);
+    void verifyBwm(unsigned int n_share, unsigned int n_available);
 
     void updateAssignment(unsigned int n_share,
-                          unsigned int n_available,
                           hardware::FunctionalUnit* fu,
-                          AssignInfo& assign_info,
-                          Table& assignment);
+                          AssignInfo& assign_info);
 
-    void findInstructionsLiveBlocks(
-        std::set<Instruction*>& instructions,
-        std::map<Instruction*, std::set<BasicBlock*>>& live_blocks
-    );
+    void encodeStates(Function* function);
 
-    void findIndependantInstructionsInLiveBlocks(
-        std::map<Instruction*, std::set<Instruction*>>& independant_instructions,
-        std::map<Instruction*, std::set<BasicBlock*>>& live_blocks
-    );
+    LiveStates& getLiveStates(Instruction* instr);
 
-    bool isRegOptimized(Instruction* instr, FsmState* state);
+    std::pair<unsigned int, unsigned int> getLiveInterval(Instruction* instr, BasicBlock* basic_block);
+
+    bool areIndependantInStates(LiveStates& live_states_a, LiveStates& live_states_b);
 
-    bool areIndependantInStates(Instruction* instr_a,
-                                Instruction* instr_b,
-                                std::set<BasicBlock*>& intersection);
+    bool isRegOptimized(Instruction* instr, FsmState* state);
 
     bool checkPhiSuccessors(Instruction* instr,
                             FsmState* state,
@@ -104,40 +149,8 @@ private:
     void visitTransitionStates(FsmState* state, std::set<Instruction*>& phi_nodes);
 
     void createStateEncoding(Function* function,
-                             std::map<FsmState*, unsigned int>& state_encoding,
-                             std::map<BasicBlock*, unsigned int>& bb_last_state);
-
-    void addInstructionDefState(
-        BasicBlock* basic_block,
-        Instruction* instr_a,
-        std::vector<unsigned int>& instr_a_states,
-        Instruction* instr_b,
-        std::vector<unsigned int>& instr_b_states,
-        std::map<FsmState*, unsigned int>& state_encoding
-    );
-
-    void addInstructionUseState(
-        BasicBlock* basic_block,
-        Instruction* instr_a,
-        std::vector<unsigned int>& instr_a_states,
-        Instruction* instr_b,
-        std::vector<unsigned int>& instr_b_states,
-        std::map<FsmState*, unsigned int>& state_encoding,
-        unsigned int last_state
-    );
-
-    void addInstructionLiveInOut(
-        BasicBlock* basic_block,
-        Instruction* instr_a,
-        std::vector<unsigned int>& instr_a_states,
-        Instruction* instr_b,
-        std::vector<unsigned int>& instr_b_states,
-        std::map<FsmState*, unsigned int>& state_encoding,
-        unsigned int first_state,
-        unsigned int last_state
-    );
-
-    int** tableToRawMatrix(Table& table, unsigned int rows, unsigned int cols);
+                             std::vector<unsigned int>& state_encoding,
+                             std::vector<unsigned int>& bb_last_state);
 };
 
         } /* namespace binding */
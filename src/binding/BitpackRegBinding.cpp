@@ -2,22 +2,35 @@
 
 #include <map>
 #include <vector>
-#include <optional>
+#include <numeric>
+#include <algorithm>
 
 #include <llvm/IR/Value.h>
 #include <llvm/IR/Function.h>
 #include <llvm/IR/BasicBlock.h>
 #include <llvm/IR/Instruction.h>
+#include <llvm/IR/Instructions.h>
 #include <llvm/Support/raw_ostream.h>
+#include <llvm/Support/CommandLine.h>
 
+#include "../utility/instruction_utility.hpp"
+#include "../utility/log_utility.hpp"
+#include "IntervalAllocator.hpp"
 #include "BitpackRegBinding.hpp"
 
 using namespace llvm;
 using namespace bphls;
 
-binding::BitpackRegBinding::BitpackRegBinding(Function& function, Fsm& fsm)
+static cl::opt<bool> bitpack_chart(
+    "bitpack-lifetime-chart",
+    cl::desc("Print lifetime charts of the bit-packing register binding"),
+    cl::init(false)
+);
+
+binding::BitpackRegBinding::BitpackRegBinding(Function& function, Fsm& fsm, LifetimeAnalysis& lva)
     : function(function),
-      fsm(fsm) {}
+      fsm(fsm),
+      lva(lva) {}
 
 binding::BitpackRegBinding::~BitpackRegBinding() {
     for (auto& var_lt : lt_table) {
@@ -72,7 +85,7 @@ binding::BitpackRegBinding::RegBitfield::RegBitfield(Reg reg)
     : reg(reg),
       bitfield(std::make_pair(reg.width - 1, 0)) {}
 
-binding::BitpackRegBinding::RegBitfield::RegBitfield(Reg reg, unsigned char msb, unsigned char lsb)
+binding::BitpackRegBinding::RegBitfield::RegBitfield(Reg reg, unsigned int msb, unsigned int lsb)
     : reg(reg),
       bitfield(std::make_pair(msb, lsb)) {}
 
@@ -88,14 +101,15 @@ binding::BitpackRegBinding::LifetimeWidthPool::LifetimeWidthPool(Value* var,
                                                                  unsigned int id)
     : id(id),
       var(var),
-      lt(lt) {}
+      lt(lt),
+      sub_reg(0) {}
 
 void binding::BitpackRegBinding::bindRegisters() {
     analyzeLifetime();
 
-#ifndef NDEBUG
-    printLifetimeTable();
-#endif
+    if (bitpack_chart) {
+        printLifetimeTable();
+    }
 
     auto pool_width = splitTableIntoEqWidthPools();
 
@@ -114,138 +128,150 @@ std::vector<binding::BitpackRegBinding::Reg>& binding::BitpackRegBinding::getReg
     return registers;
 }
 
-void binding::BitpackRegBinding::analyzeLifetime() {
-    /* For now only first basic block */
-    auto& basic_block = function.front();
+bool binding::BitpackRegBinding::isBindable(Instruction& instr) {
+    /* Phi registers are loaded by copies, pipelined values by stages */
+    return !instr.getType()->isVoidTy()
+        && !isa<AllocaInst>(instr)
+        && !isa<PHINode>(instr)
+        && !utility::isDummyCall(instr)
+        && !instr.users().empty()
+        && (fsm.getPipeline(instr.getParent()) == nullptr)
+        && (fsm.getEndState(&instr) != nullptr);
+}
 
-    unsigned int stage_idx = 0;
-    for (auto& arg : function.args()) {
-        unsigned int width =
-            static_cast<unsigned int>(arg.getType()->getPrimitiveSizeInBits());
+void binding::BitpackRegBinding::analyzeLifetime() {
+    /* States of a basic block are consecutive in the state list */
+    std::map<FsmState*, unsigned int> state_stage;
+    std::map<BasicBlock*, std::pair<unsigned int /*first*/, unsigned int /*last*/>> bb_stages;
 
-        lt_table[&arg] = new LifetimeInterval(stage_idx, stage_idx, width);
-    }
+    unsigned int stage_idx = 1;
+    for (auto* state : fsm.states()) {
+        auto* basic_block = state->getBasicBlock();
 
-    for (auto& instr : basic_block) {
-        if (instr.isTerminator()) {
+        if (basic_block == nullptr) {
             continue;
         }
 
-        unsigned int width =
-            static_cast<unsigned int>(instr.getType()->getPrimitiveSizeInBits());
+        state_stage[state] = stage_idx;
+
+        if (bb_stages.count(basic_block) == 0) {
+            bb_stages[basic_block] = std::make_pair(stage_idx, stage_idx);
+        } else {
+            bb_stages[basic_block].second = stage_idx;
+        }
 
-        lt_table[&instr] = new LifetimeInterval(width);
+        stage_idx += 1;
     }
 
-    assert(fsm.getStatesNum() > 1);
-    auto* cur_state = *fsm.states().begin();
+    for (auto& basic_block : function) {
+        for (auto& instr : basic_block) {
+            if (!isBindable(instr)) {
+                continue;
+            }
 
-    assert(cur_state != nullptr);
+            unsigned int width = utility::getBitwidth(&instr);
 
-    stage_idx += 1;
-    std::set<FsmState*> visited_states;
-    while (cur_state != nullptr) {
-        if (visited_states.count(cur_state) != 0) {
-            break;
-        }
+            /* Register is loaded at the end of the definition state */
+            unsigned int def = state_stage[fsm.getEndState(&instr)];
+            unsigned int use = def + 1;
 
-        if (!cur_state->instructions().empty()) {
-            for (auto* instr : cur_state->instructions()) {
-                if (instr->isTerminator()) {
+            for (auto* user : instr.users()) {
+                auto* user_instr = dyn_cast<Instruction>(user);
+
+                if (user_instr == nullptr) {
                     continue;
                 }
 
-                lt_table[instr]->def = stage_idx;
-
-                for (auto& op : instr->operands()) {
-                    auto* op_value = op.get();
+                if (auto* phi_node = dyn_cast<PHINode>(user_instr)) {
+                    /* Phi copies read the value on the incoming transitions */
+                    for (unsigned int i = 0; i < phi_node->getNumIncomingValues(); i++) {
+                        auto* income_basic_block = phi_node->getIncomingBlock(i);
 
-                    if (!isa<Constant>(op_value)) {
-                        lt_table[op_value]->use = stage_idx;
+                        if ((phi_node->getIncomingValue(i) == &instr)
+                                && (bb_stages.count(income_basic_block) != 0))
+                        {
+                            use = std::max(use, bb_stages[income_basic_block].second);
+                        }
                     }
+                } else if (fsm.getStartState(user_instr) != nullptr) {
+                    use = std::max(use, state_stage[fsm.getStartState(user_instr)]);
                 }
-            }
 
-            stage_idx += 1;
-        }
+                /* Branch conditions are read on the transitions out of the
+                 * last state of the block, not in the branch start state */
+                auto* user_basic_block = user_instr->getParent();
 
-        visited_states.insert(cur_state);
-        if (cur_state == cur_state->getDefaultTransition()) {
-            assert(cur_state->getTransitionsNum() == 2);
-            cur_state = cur_state->getTransitionState(0);
-        } else {
-            cur_state = cur_state->getDefaultTransition();
-        }
-    }
+                if (user_instr->isTerminator() && (bb_stages.count(user_basic_block) != 0)) {
+                    use = std::max(use, bb_stages[user_basic_block].second);
+                }
+            }
 
-    for (auto& var_lt : lt_table) {
-        auto* lt = var_lt.second;
+            /* Values crossing basic blocks live through them entirely */
+            for (auto& bb_stage : bb_stages) {
+                if (lva.isLiveIn(&instr, bb_stage.first)) {
+                    def = std::min(def, bb_stage.second.first - 1);
+                    use = std::max(use, bb_stage.second.second);
+                }
 
-        if (lt->use == 0) {
-            lt->use = stage_idx - 1;
+                if (lva.isLiveOut(&instr, bb_stage.first)) {
+                    use = std::max(use, bb_stage.second.second + 1);
+                }
+            }
+
+            lt_table.emplace_back(&instr, new LifetimeInterval(def, use, width));
         }
     }
 
-    this->n_stages = stage_idx - 1;
+    this->n_stages = stage_idx;
 }
 
-void binding::BitpackRegBinding::printLifetimeTable() {
-    std::string out_buffer;
-    raw_string_ostream out(out_buffer);
+void binding::BitpackRegBinding::printLifetimeChart(raw_ostream& out, LifetimeInterval* lt) {
+    assert(lt->use > lt->def);
 
-    out << "\n";
+    out << " Def: " << lt->def;
+    out << " Use: " << lt->use;
+    out << "\t\t|";
 
-    for (auto& var_lt : lt_table) {
-        auto* var = var_lt.first;
-        auto* lt = var_lt.second;
+    for (unsigned int i = 0; i < lt->def; i++) {
+        out << "  |";
+    }
 
-        out << "Var: ";
-        var->printAsOperand(out);
-        out << " Def: " << std::to_string(lt->def);
-        out << " Use: " << std::to_string(lt->use);
-        out << "\t\t|";
+    for (unsigned int i = lt->def; i < lt->use; i++) {
+        out << "##|";
+    }
 
-        assert(lt->use > lt->def);
+    for (unsigned int i = lt->use; i < n_stages; i++) {
+        out << "  |";
+    }
 
-        std::string def_space;
-        for (unsigned int i = 0; i < lt->def; i++) {
-            def_space += "  |";
-        }
+    out << "\n";
+}
 
-        std::string alive_space;
-        for (unsigned int i = 0; i < lt->use - lt->def; i++) {
-            alive_space += "##|";
-        }
+void binding::BitpackRegBinding::printLifetimeTable() {
+    auto& out = outs();
 
-        std::string after_use_space;
-        for (unsigned int i = 0; i < n_stages - lt->use; i++) {
-            after_use_space += "  |";
-        }
+    out << "\n";
 
-        out << def_space << alive_space << after_use_space << "\n";
+    for (auto& var_lt : lt_table) {
+        out << "Var: ";
+        var_lt.first->printAsOperand(out);
+        printLifetimeChart(out, var_lt.second);
     }
 
     out << "\n";
-
-    std::cout << out_buffer;
 }
 
 unsigned int binding::BitpackRegBinding::splitTableIntoEqWidthPools() {
-    unsigned int min_width = UINT_MAX;
+    /* Narrowed widths are not multiples of the minimal one */
+    unsigned int pool_width = 0;
 
     for (auto& var_lt : lt_table) {
-        auto width = var_lt.second->weight;
-
-        if (width < min_width) {
-            min_width = width;
-        }
+        pool_width = std::gcd(pool_width, var_lt.second->weight);
     }
 
     for (auto& var_lt : lt_table) {
         auto width = var_lt.second->weight;
-        /* For now only multiple of min width */
-        assert((width % min_width) == 0);
-        auto n_pools = width / min_width;
+        auto n_pools = width / pool_width;
 
         for (unsigned int pool_id = 0; pool_id < n_pools; pool_id++) {
             auto* new_pool = 
@@ -256,124 +282,45 @@ unsigned int binding::BitpackRegBinding::splitTableIntoEqWidthPools() {
                 );
 
             lt_pool_table.push_back(new_pool);
-            lt_pool_map[var_lt.first].push_back(new_pool);
         }
     }
 
-    return min_width;
+    return pool_width;
 }
 
-bool binding::BitpackRegBinding::defAfter(LifetimeWidthPool* first, LifetimeWidthPool* second) {
-    return first->lt->def > second->lt->def;
-}
-
-bool binding::BitpackRegBinding::defBefore(LifetimeWidthPool* first, LifetimeWidthPool* second) {
-    return first->lt->def < second->lt->def;
-}
-
-void binding::BitpackRegBinding::performLeftEdge()
-{
-    std::sort(lt_pool_table.begin(), lt_pool_table.end(), defBefore);
+void binding::BitpackRegBinding::performLeftEdge() {
+    IntervalAllocator allocator;
+    allocator.reserve(lt_pool_table.size());
 
-    std::string out_buffer;
-    raw_string_ostream out(out_buffer);
-
-    out << "\n";
-
-    for (auto& pool : lt_pool_table) {
-        auto* var = pool->var;
-        auto* lt = pool->lt;
-
-        out << "Var: ";
-        var->printAsOperand(out);
-        out << "\tID: " << std::to_string(pool->id);
-        out << " Def: " << std::to_string(lt->def);
-        out << " Use: " << std::to_string(lt->use);
-        out << "\t\t|";
-
-        assert(lt->use > lt->def);
-
-        std::string def_space;
-        for (unsigned int i = 0; i < lt->def; i++) {
-            def_space += "  |";
-        }
-
-        std::string alive_space;
-        for (unsigned int i = 0; i < lt->use - lt->def; i++) {
-            alive_space += "##|";
-        }
-
-        std::string after_use_space;
-        for (unsigned int i = 0; i < n_stages - lt->use; i++) {
-            after_use_space += "  |";
-        }
-
-        out << def_space << alive_space << after_use_space << "\n";
+    /* Pools are addressed by their dense table indices */
+    for (auto* pool : lt_pool_table) {
+        allocator.addInterval(pool->lt->def, pool->lt->use);
     }
 
-    out << "\n";
-
-    SubRegId cur_sub_reg_id = 0;
-
-    unsigned int pool_size = lt_pool_table.size();
-    for (unsigned int i = 0; i < pool_size; i++) {
-        if (sub_binding_map.size() == lt_pool_table.size()) {
-            break;
-        }
-
-        auto* cur_pool = lt_pool_table[i];
-        auto cur_pool_id = lt_pool_table[i]->id; 
-        auto* cur_var = lt_pool_table[i]->var;
-        auto* cur_lt = lt_pool_table[i]->lt;
-
-        auto last_use_edge = cur_lt->use;
-
-        if (sub_binding_map.count(cur_pool) != 0) {
-            continue;
-        } else {
-            sub_binding_map[cur_pool] = cur_sub_reg_id;
-        }
-
-        out << "Reg ID: " << std::to_string(cur_sub_reg_id);
-        out << " Var: ";
-        cur_var->printAsOperand(out);
-        out << " Pool: " << std::to_string(cur_pool_id);
-
-        for (unsigned int j = 0; j < pool_size; j++) {
-            if (sub_binding_map.size() == lt_pool_table.size()) {
-                break;
-            }
+    n_sub_regs = allocator.allocate();
 
-            auto* other_pool = lt_pool_table[j];
-            auto other_pool_id = lt_pool_table[j]->id; 
-            auto* other_var = lt_pool_table[j]->var;
-            auto* other_lt = lt_pool_table[j]->lt;
+    for (unsigned int i = 0; i < lt_pool_table.size(); i++) {
+        lt_pool_table[i]->sub_reg = allocator.getTrack(i);
+    }
 
-            if (sub_binding_map.count(other_pool) != 0) {
-                continue;
-            }
+    if (bitpack_chart) {
+        auto& out = outs();
 
-            if (other_lt->def >= last_use_edge) {
-                sub_binding_map[other_pool] = cur_sub_reg_id;
-                last_use_edge += (other_lt->use - other_lt->def);
+        out << "\n";
 
-                out << " | Var: ";
-                other_var->printAsOperand(out);
-                out << " Pool: " << std::to_string(other_pool_id);
-            }
+        for (auto* pool : lt_pool_table) {
+            out << "Reg ID: " << pool->sub_reg << " Var: ";
+            pool->var->printAsOperand(out);
+            out << "\tID: " << pool->id;
+            printLifetimeChart(out, pool->lt);
         }
 
-        cur_sub_reg_id++;
         out << "\n";
     }
-
-    n_sub_regs = cur_sub_reg_id;
-
-    std::cout << out_buffer;
 }
 
-bool binding::BitpackRegBinding::subBindingPredicate(std::pair<Value*, std::set<SubRegId>>& first,
-                                                          std::pair<Value*, std::set<SubRegId>>& second)
+bool binding::BitpackRegBinding::subBindingPredicate(const std::pair<Value*, std::set<SubRegId>>& first,
+                                                          const std::pair<Value*, std::set<SubRegId>>& second)
 {
     return first.second.size() > second.second.size();
 }
@@ -383,15 +330,16 @@ void binding::BitpackRegBinding::mergeSubRegisters(unsigned int pool_width)
     std::string out_buffer;
     raw_string_ostream out(out_buffer);
 
-    for (auto& var_pool_set : lt_pool_map) {
-        auto sub_regs = std::make_pair(var_pool_set.first, std::set<SubRegId>());
-        for (auto* pool : var_pool_set.second) {
-            sub_regs.second.insert(sub_binding_map[pool]);
+    /* Pools of a variable are consecutive in the table */
+    for (auto* pool : lt_pool_table) {
+        if (var_sub_regs.empty() || (var_sub_regs.back().first != pool->var)) {
+            var_sub_regs.emplace_back(pool->var, std::set<SubRegId>());
         }
-        var_sub_regs.push_back(sub_regs);
+
+        var_sub_regs.back().second.insert(pool->sub_reg);
     }
 
-    std::sort(
+    std::stable_sort(
         var_sub_regs.begin(),
         var_sub_regs.end(),
         subBindingPredicate
@@ -412,38 +360,38 @@ void binding::BitpackRegBinding::mergeSubRegisters(unsigned int pool_width)
     }
 #endif
 
-    /* Merge subregisters */
-    std::map<SubRegId, RegId> bitfield_reg_lookup;
-    std::map<RegId, std::set<SubRegId>> reg_bitfields;
+    /* Merge subregisters sharing a variable into registers */
+    std::map<RegId, std::vector<SubRegId>> ordered_reg_bitfields;
+    groupSubRegisters(ordered_reg_bitfields);
 
-    RegId cur_reg_id = 0;
-    for (auto& v_sr : var_sub_regs) {
-        std::optional<RegId> binded_reg = std::nullopt;
+    /* Variables with scattered subregisters keep their own registers */
+    std::map<SubRegId, unsigned int> sub_reg_pos;
+    for (auto& reg_bitfield_set : ordered_reg_bitfields) {
+        auto& sub_reg_ids = reg_bitfield_set.second;
 
-        for (auto sub_reg_id : v_sr.second) {
-            if (bitfield_reg_lookup.count(sub_reg_id) != 0) {
-                binded_reg = bitfield_reg_lookup[sub_reg_id];
-                break;
-            }
+        for (unsigned int i = 0; i < sub_reg_ids.size(); i++) {
+            sub_reg_pos[sub_reg_ids[i]] = i;
         }
+    }
 
-        if (!binded_reg.has_value()) {
-            binded_reg = cur_reg_id;
-            cur_reg_id++;
-        }
+    auto is_scattered = [&sub_reg_pos](std::pair<Value*, std::set<SubRegId>>& v_sr) {
+        auto lsb_pos = sub_reg_pos[*v_sr.second.begin()];
+        auto msb_pos = sub_reg_pos[*v_sr.second.rbegin()];
 
-        for (auto sub_reg_id : v_sr.second) {
-            bitfield_reg_lookup[sub_reg_id] = binded_reg.value();
-            reg_bitfields[binded_reg.value()].insert(sub_reg_id);
-        }
-    }
+        return (msb_pos - lsb_pos + 1) != v_sr.second.size();
+    };
 
-    n_regs = cur_reg_id;
+    var_sub_regs.erase(
+        std::remove_if(var_sub_regs.begin(), var_sub_regs.end(), is_scattered),
+        var_sub_regs.end()
+    );
+
+    groupSubRegisters(ordered_reg_bitfields);
 
 #ifndef NDEBUG
     out << "\n";
 
-    for (auto& reg_bitfield_set : reg_bitfields) {
+    for (auto& reg_bitfield_set : ordered_reg_bitfields) {
         out << "Reg ID: " << std::to_string(reg_bitfield_set.first);
         out << " SubReg ID: { ";
         for (auto reg_id : reg_bitfield_set.second) {
@@ -454,24 +402,6 @@ void binding::BitpackRegBinding::mergeSubRegisters(unsigned int pool_width)
     }
 #endif
 
-    /* Verify merging */
-    for (SubRegId id = 0; id < n_sub_regs; id++) {
-        assert(bitfield_reg_lookup.count(id) != 0 && "Sub reg was not merged");
-    }
-
-    /* Create ordered bitfield set for each register */
-    std::map<RegId, std::vector<SubRegId>> ordered_reg_bitfields;
-    for (auto& reg_bitfield_set : reg_bitfields) {
-        auto& sub_reg_ids = ordered_reg_bitfields[reg_bitfield_set.first];
-
-        sub_reg_ids.assign(
-            reg_bitfield_set.second.begin(),
-            reg_bitfield_set.second.end()
-        );
-
-        std::sort(sub_reg_ids.begin(),sub_reg_ids.end());
-    }
-
     /* Create register and its bitfields */
 
     registers.resize(n_regs);
@@ -495,10 +425,57 @@ void binding::BitpackRegBinding::mergeSubRegisters(unsigned int pool_width)
     }
 
 #ifndef NDEBUG
-    std::cout << out_buffer;
+    utility::logs() << out_buffer;
 #endif
 }
 
+void binding::BitpackRegBinding::groupSubRegisters(std::map<RegId, std::vector<SubRegId>>& reg_sub_regs) {
+    std::vector<SubRegId> sub_reg_root(n_sub_regs);
+    std::iota(sub_reg_root.begin(), sub_reg_root.end(), 0);
+
+    auto find_root = [&sub_reg_root](SubRegId id) {
+        while (sub_reg_root[id] != id) {
+            sub_reg_root[id] = sub_reg_root[sub_reg_root[id]];
+            id = sub_reg_root[id];
+        }
+
+        return id;
+    };
+
+    for (auto& v_sr : var_sub_regs) {
+        auto root = find_root(*v_sr.second.begin());
+
+        for (auto sub_reg_id : v_sr.second) {
+            sub_reg_root[find_root(sub_reg_id)] = root;
+        }
+    }
+
+    /* Registers are numbered in the order of their widest variables */
+    std::map<SubRegId, RegId> root_reg_lookup;
+    reg_sub_regs.clear();
+
+    for (auto& v_sr : var_sub_regs) {
+        auto root = find_root(*v_sr.second.begin());
+
+        if (root_reg_lookup.count(root) == 0) {
+            RegId reg_id = root_reg_lookup.size();
+            root_reg_lookup[root] = reg_id;
+        }
+
+        auto& sub_reg_ids = reg_sub_regs[root_reg_lookup[root]];
+        sub_reg_ids.insert(sub_reg_ids.end(), v_sr.second.begin(), v_sr.second.end());
+    }
+
+    for (auto& reg_sub_reg_ids : reg_sub_regs) {
+        auto& sub_reg_ids = reg_sub_reg_ids.second;
+
+        std::sort(sub_reg_ids.begin(), sub_reg_ids.end());
+        sub_reg_ids.erase(std::unique(sub_reg_ids.begin(), sub_reg_ids.end()), sub_reg_ids.end());
+    }
+
+    n_regs = root_reg_lookup.size();
+}
+
 void binding::BitpackRegBinding::mapVariablesToBitfields() {
     for (auto& v_sr : var_sub_regs) {
         auto* var = v_sr.first;
@@ -528,6 +505,6 @@ void binding::BitpackRegBinding::mapVariablesToBitfields() {
         out << ":" << std::to_string(var_bind.second.bitfield.second) << "]\n";
     }
 
-    std::cout << out_buffer;
+    utility::logs() << out_buffer;
 #endif
 }
\ No newline at end of file
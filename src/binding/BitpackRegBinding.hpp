@@ -8,16 +8,19 @@
 #include <llvm/IR/Function.h>
 #include <llvm/IR/BasicBlock.h>
 #include <llvm/IR/Instruction.h>
+#include <llvm/Support/raw_ostream.h>
 
 #include "../scheduling/fsm/Fsm.hpp"
 
+#include "LifetimeAnalysis.hpp"
+
 namespace llvm {
     namespace bphls {
         namespace binding {
 
 class BitpackRegBinding {
 public:
-    BitpackRegBinding(Function& function, Fsm& fsm);
+    BitpackRegBinding(Function& function, Fsm& fsm, LifetimeAnalysis& lva);
 
     ~BitpackRegBinding();
 
@@ -36,13 +39,13 @@ public:
     /** Binding register bitfield */
     struct RegBitfield {
         Reg reg;
-        std::pair<unsigned char /*msb*/, unsigned char /*lsb*/> bitfield;
+        std::pair<unsigned int /*msb*/, unsigned int /*lsb*/> bitfield;
 
         RegBitfield();
 
         RegBitfield(Reg reg);
 
-        RegBitfield(Reg reg, unsigned char msb, unsigned char lsb);
+        RegBitfield(Reg reg, unsigned int msb, unsigned int lsb);
 
         RegBitfield operator + (RegBitfield& other);
     };
@@ -56,6 +59,7 @@ public:
 private:
     Function& function;
     Fsm& fsm;
+    LifetimeAnalysis& lva;
 
     /** Variable lifetime interval */
     struct LifetimeInterval {
@@ -72,11 +76,14 @@ private:
         bool overlap(LifetimeInterval& other);
     };
     
+    typedef unsigned int SubRegId;
+
     /** Variable lifetime interval chunk with the given bitwidth */
     struct LifetimeWidthPool {
         unsigned int id;
         Value* var;
         LifetimeInterval* lt;
+        SubRegId sub_reg;
 
         LifetimeWidthPool(Value* var, LifetimeInterval* lt, unsigned int id);
     };
@@ -84,27 +91,24 @@ private:
     unsigned int n_stages = 0;
     unsigned int n_sub_regs = 0;
     unsigned int n_regs = 0;
-    typedef unsigned int SubRegId;
 
-    std::map<Value*, LifetimeInterval*> lt_table;
+    std::vector<std::pair<Value*, LifetimeInterval*>> lt_table;
     std::vector<LifetimeWidthPool*> lt_pool_table;
-    std::map<Value*, std::vector<LifetimeWidthPool*>> lt_pool_map;
     std::vector<std::pair<Value*, std::set<SubRegId>>> var_sub_regs;
     std::vector<Reg> registers;
     std::vector<RegBitfield> bitfields;
 
-    std::map<LifetimeWidthPool*, SubRegId> sub_binding_map;
     std::map<Value*, RegBitfield> binding_map;
 
-    static bool defAfter(LifetimeWidthPool* first, LifetimeWidthPool* second);
+    static bool subBindingPredicate(const std::pair<Value*, std::set<SubRegId>>& first,
+                                    const std::pair<Value*, std::set<SubRegId>>& second);
 
-    static bool defBefore(LifetimeWidthPool* first, LifetimeWidthPool* second);
-
-    static bool subBindingPredicate(std::pair<Value*, std::set<SubRegId>>& first,
-                                    std::pair<Value*, std::set<SubRegId>>& second);
+    bool isBindable(Instruction& instr);
 
     void analyzeLifetime();
 
+    void printLifetimeChart(raw_ostream& out, LifetimeInterval* lt);
+
     void printLifetimeTable();
 
     unsigned int splitTableIntoEqWidthPools();
@@ -113,6 +117,8 @@ private:
 
     void mergeSubRegisters(unsigned int pool_width);
 
+    void groupSubRegisters(std::map<RegId, std::vector<SubRegId>>& reg_sub_regs);
+
     void mapVariablesToBitfields();
 };
 
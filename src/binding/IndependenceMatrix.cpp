@@ -0,0 +1,42 @@
+#include <set>
+#include <vector>
+#include <cstdint>
+
+#include <llvm/IR/Instruction.h>
+
+#include "IndependenceMatrix.hpp"
+
+using namespace llvm;
+using namespace bphls;
+
+void binding::IndependenceMatrix::reset(std::set<Instruction*>& instructions) {
+    row_instructions.assign(instructions.begin(), instructions.end());
+
+    instr_row_lookup.clear();
+    for (unsigned int row = 0; row < row_instructions.size(); row++) {
+        instr_row_lookup[row_instructions[row]] = row;
+    }
+
+    n_row_words = (row_instructions.size() + 63) / 64;
+    words.assign(row_instructions.size() * n_row_words, 0);
+}
+
+void binding::IndependenceMatrix::setIndependant(unsigned int row_a, unsigned int row_b) {
+    words[row_a * n_row_words + row_b / 64] |= (uint64_t(1) << (row_b % 64));
+    words[row_b * n_row_words + row_a / 64] |= (uint64_t(1) << (row_a % 64));
+}
+
+bool binding::IndependenceMatrix::areIndependant(unsigned int row_a, unsigned int row_b) {
+    return (words[row_a * n_row_words + row_b / 64] >> (row_b % 64)) & 1;
+}
+
+bool binding::IndependenceMatrix::areIndependant(Instruction* instr_a, Instruction* instr_b) {
+    auto row_a = instr_row_lookup.find(instr_a);
+    auto row_b = instr_row_lookup.find(instr_b);
+
+    if ((row_a == instr_row_lookup.end()) || (row_b == instr_row_lookup.end())) {
+        return false;
+    }
+
+    return areIndependant(row_a->second, row_b->second);
+}
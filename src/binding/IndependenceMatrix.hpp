@@ -0,0 +1,52 @@
+#ifndef __BINDING_INDEPENDENCE_MATRIX_HPP__
+#define __BINDING_INDEPENDENCE_MATRIX_HPP__
+
+#include <set>
+#include <vector>
+#include <cstdint>
+
+#include <llvm/ADT/DenseMap.h>
+#include <llvm/IR/Instruction.h>
+
+namespace llvm {
+    namespace bphls {
+        namespace binding {
+
+/**
+ * Dense symmetric bit matrix of pairwise independent instructions, the ones
+ * whose values are never alive in the same states. Rows are indexed in the
+ * order of the instruction set and stored as 64-bit words.
+ */
+class IndependenceMatrix {
+public:
+    IndependenceMatrix()
+        : n_row_words(0) {}
+
+    void reset(std::set<Instruction*>& instructions);
+
+    unsigned int getInstructionsNum() { return row_instructions.size(); }
+
+    Instruction* getInstruction(unsigned int row) { return row_instructions[row]; }
+
+    bool contains(Instruction* instr) { return instr_row_lookup.count(instr) != 0; }
+
+    void setIndependant(unsigned int row_a, unsigned int row_b);
+
+    bool areIndependant(unsigned int row_a, unsigned int row_b);
+
+    bool areIndependant(Instruction* instr_a, Instruction* instr_b);
+
+private:
+    unsigned int n_row_words;
+
+    std::vector<Instruction*> row_instructions;
+    DenseMap<Instruction*, unsigned int> instr_row_lookup;
+
+    std::vector<uint64_t> words;
+};
+
+        } /* namespace binding */
+    } /* namespace bphls */
+} /* namespace llvm */
+
+#endif /* __BINDING_INDEPENDENCE_MATRIX_HPP__ */
@@ -0,0 +1,69 @@
+#include <queue>
+#include <vector>
+#include <numeric>
+#include <utility>
+#include <algorithm>
+#include <functional>
+
+#include "IntervalAllocator.hpp"
+
+using namespace llvm;
+using namespace bphls;
+
+binding::IntervalAllocator::IntervalAllocator()
+    : n_tracks(0) {}
+
+void binding::IntervalAllocator::reserve(unsigned int n_intervals) {
+    defs.reserve(n_intervals);
+    uses.reserve(n_intervals);
+}
+
+binding::IntervalAllocator::IntervalId binding::IntervalAllocator::addInterval(unsigned int def,
+                                                                               unsigned int use)
+{
+    defs.push_back(def);
+    uses.push_back(use);
+
+    return defs.size() - 1;
+}
+
+unsigned int binding::IntervalAllocator::allocate() {
+    typedef std::pair<unsigned int /*use*/, TrackId> BusyTrack;
+
+    std::vector<IntervalId> order(defs.size());
+    std::iota(order.begin(), order.end(), 0);
+
+    /* Ties keep insertion order, chunks of a value stay together */
+    std::stable_sort(
+        order.begin(),
+        order.end(),
+        [this](IntervalId a, IntervalId b) { return defs[a] < defs[b]; }
+    );
+
+    std::priority_queue<BusyTrack, std::vector<BusyTrack>, std::greater<BusyTrack>> busy_tracks;
+    std::priority_queue<TrackId, std::vector<TrackId>, std::greater<TrackId>> free_tracks;
+
+    interval_tracks.assign(defs.size(), 0);
+    n_tracks = 0;
+
+    for (auto id : order) {
+        while (!busy_tracks.empty() && (busy_tracks.top().first <= defs[id])) {
+            free_tracks.push(busy_tracks.top().second);
+            busy_tracks.pop();
+        }
+
+        TrackId track = n_tracks;
+
+        if (free_tracks.empty()) {
+            n_tracks++;
+        } else {
+            track = free_tracks.top();
+            free_tracks.pop();
+        }
+
+        interval_tracks[id] = track;
+        busy_tracks.emplace(uses[id], track);
+    }
+
+    return n_tracks;
+}
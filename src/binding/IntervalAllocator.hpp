@@ -0,0 +1,51 @@
+#ifndef __BINDING_INTERVAL_ALLOCATOR_HPP__
+#define __BINDING_INTERVAL_ALLOCATOR_HPP__
+
+#include <vector>
+
+namespace llvm {
+    namespace bphls {
+        namespace binding {
+
+/**
+ * Left-edge allocation of lifetime intervals to the minimal number of
+ * tracks (registers), as a sweep over the intervals sorted by definition.
+ *
+ * Busy tracks are kept in a min-heap keyed by their release time, the ones
+ * released before a definition move to a min-heap of free tracks keyed by
+ * track index, so equal intervals get consecutive tracks when possible.
+ * Interval [def, use) may share a track with one defined at use or later.
+ */
+class IntervalAllocator {
+public:
+    typedef unsigned int IntervalId;
+    typedef unsigned int TrackId;
+
+    IntervalAllocator();
+
+    void reserve(unsigned int n_intervals);
+
+    IntervalId addInterval(unsigned int def, unsigned int use);
+
+    /** Returns number of allocated tracks */
+    unsigned int allocate();
+
+    TrackId getTrack(IntervalId id) { return interval_tracks[id]; }
+
+    unsigned int getIntervalsNum() { return defs.size(); }
+
+    unsigned int getTracksNum() { return n_tracks; }
+
+private:
+    std::vector<unsigned int> defs;
+    std::vector<unsigned int> uses;
+    std::vector<TrackId> interval_tracks;
+
+    unsigned int n_tracks;
+};
+
+        } /* namespace binding */
+    } /* namespace bphls */
+} /* namespace llvm */
+
+#endif /* __BINDING_INTERVAL_ALLOCATOR_HPP__ */
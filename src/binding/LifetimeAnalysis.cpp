@@ -1,16 +1,67 @@
 #include <map>
+#include <queue>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
 
 #include <llvm/IR/CFG.h>
 #include <llvm/IR/Function.h>
 #include <llvm/IR/Instructions.h>
 #include <llvm/ADT/BitVector.h>
+#include <llvm/ADT/DenseMap.h>
+#include <llvm/ADT/DenseSet.h>
+#include <llvm/ADT/SmallVector.h>
+#include <llvm/ADT/PostOrderIterator.h>
+#include <llvm/Support/MathExtras.h>
+#include <llvm/Support/CommandLine.h>
 
 #include "LifetimeAnalysis.hpp"
 
 using namespace llvm;
 using namespace bphls;
 
+static cl::opt<unsigned int> liveness_dense_limit(
+    "liveness-dense-limit",
+    cl::desc("Largest size of dense liveness sets in MiB, larger functions use sparse SSA liveness"),
+    cl::init(256)
+);
+
+static_assert(sizeof(uintptr_t) == sizeof(uint64_t), "BitVector words must be 64-bit");
+
+static void packBits(BitVector& bits, uint64_t* words) {
+    auto bit_words = bits.getData();
+    std::copy(bit_words.begin(), bit_words.end(), words);
+}
+
+static void unpackBits(const uint64_t* words, unsigned int n_words, BitVector& bits) {
+    bits.reset();
+
+    for (unsigned int word_idx = 0; word_idx < n_words; word_idx++) {
+        for (uint64_t word = words[word_idx]; word != 0; word &= (word - 1)) {
+            bits.set(word_idx * 64 + countTrailingZeros(word));
+        }
+    }
+}
+
 void binding::LifetimeAnalysis::analize() {
+    /* Number of definitions in function */
+    uint64_t def_count = function.arg_size();
+
+    for (auto& basic_block : function) {
+        def_count += basic_block.size();
+    }
+
+    n_words = (def_count + 63) / 64;
+
+    /* Def, use, in and out sets of every basic block */
+    uint64_t dense_size = 4 * function.size() * n_words * sizeof(uint64_t);
+    is_sparse = dense_size > (uint64_t(liveness_dense_limit) << 20);
+
+    if (is_sparse) {
+        initSparseFlowMask();
+        return;
+    }
+
     /* Initialize instruction bit encoding map */
     {
         unsigned int instr_idx = 0;
@@ -28,9 +79,6 @@ void binding::LifetimeAnalysis::analize() {
         }
     }
 
-    /* Number of definitions in function */
-    auto def_count = value_bit_pos_lookup.size();
-
     /* Initialize basic block lifetime info */
     {
         for (auto& basic_block : function) {
@@ -75,39 +123,7 @@ void binding::LifetimeAnalysis::analize() {
     initFlowMask(flow_mask);
 
     /* Collect lifetime information */
-    bool is_changed = true;
-    while (is_changed) {
-        is_changed = false;
-
-        for (auto& basic_block : function) {
-            bb_info_lookup[&basic_block]->out.reset();
-
-            for (auto* succ_basic_block : successors(&basic_block)) {
-                auto flow_mask_key = std::make_pair(&basic_block, succ_basic_block);
-
-                if (flow_mask.count(flow_mask_key) != 0) {
-                    BitVector mask(bb_info_lookup[succ_basic_block]->in);
-                    mask &= (*flow_mask[flow_mask_key]);
-                    bb_info_lookup[&basic_block]->out |= mask;
-                } else {
-                    bb_info_lookup[&basic_block]->out |= bb_info_lookup[succ_basic_block]->in;
-                }
-            }
-
-            BitVector old_in(bb_info_lookup[&basic_block]->in);
-            BitVector temp_def(bb_info_lookup[&basic_block]->def);
-
-            temp_def.flip();
-            temp_def &= bb_info_lookup[&basic_block]->out;
-            temp_def |= bb_info_lookup[&basic_block]->use;
-
-            bb_info_lookup[&basic_block]->in = temp_def;
-
-            if (bb_info_lookup[&basic_block]->in != old_in) {
-                is_changed = true;
-            }
-        }
-    }
+    solveLiveness(flow_mask);
 }
 
 void binding::LifetimeAnalysis::markUses(Value* def_value) {
@@ -158,12 +174,17 @@ void binding::LifetimeAnalysis::initFlowMask(FlowMask& flow_mask) {
                 }
 
                 auto flow_mask_key = std::make_pair(income_basic_bock, &basic_block);
-                auto mask_iter = flow_mask.find(flow_mask_key);
+                auto mask_iter = flow_mask.edge_offset_lookup.find(flow_mask_key);
+
+                if (mask_iter == flow_mask.edge_offset_lookup.end()) {
+                    unsigned int offset = flow_mask.words.size();
 
-                if (mask_iter == flow_mask.end()) {
-                    flow_mask[flow_mask_key] = new BitVector(basic_block_mask);
+                    flow_mask.edge_offset_lookup[flow_mask_key] = offset;
+                    flow_mask.words.resize(offset + n_words, 0);
+                    packBits(basic_block_mask, &flow_mask.words[offset]);
                 } else {
-                    flow_mask[flow_mask_key]->set(getBitPosition(income_val));
+                    auto pos = getBitPosition(income_val);
+                    flow_mask.words[mask_iter->second + pos / 64] |= (uint64_t(1) << (pos % 64));
                 }
             }
         }
@@ -184,31 +205,355 @@ void binding::LifetimeAnalysis::initPhiFlowMask(BitVector& basic_block_mask, Bas
                 continue;
             }
 
-            auto* def_basic_block = income_instr->getParent();
+            if (isOnlyPhiIncoming(income_instr, basic_block)) {
+                basic_block_mask.reset(getBitPosition(income_val));
+            }
+        }
+    }
+}
 
-            bool is_used_in_non_phi = false;
-            for (auto* user : income_instr->users()) {
-                auto* user_instr = dyn_cast<Instruction>(user);
-                if (user_instr == nullptr) {
-                    continue;
+bool binding::LifetimeAnalysis::isOnlyPhiIncoming(Instruction* income_instr, BasicBlock& basic_block) {
+    auto* def_basic_block = income_instr->getParent();
+
+    for (auto* user : income_instr->users()) {
+        auto* user_instr = dyn_cast<Instruction>(user);
+        if (user_instr == nullptr) {
+            continue;
+        }
+
+        auto* user_basicc_block = user_instr->getParent();
+        if ((user_basicc_block == def_basic_block)
+                || (user_basicc_block != &basic_block)
+                || isa<PHINode>(user_instr))
+        {
+            continue;
+        }
+
+        return false;
+    }
+
+    return true;
+}
+
+void binding::LifetimeAnalysis::solveLiveness(FlowMask& flow_mask) {
+    static const unsigned int NO_MASK = ~0U;
+
+    /* Blocks in reverse post-order, unreachable ones last */
+    std::vector<BasicBlock*> blocks;
+    DenseMap<BasicBlock*, unsigned int> bb_idx_lookup;
+
+    for (auto* basic_block : ReversePostOrderTraversal<Function*>(&function)) {
+        bb_idx_lookup[basic_block] = blocks.size();
+        blocks.push_back(basic_block);
+    }
+
+    for (auto& basic_block : function) {
+        if (bb_idx_lookup.count(&basic_block) == 0) {
+            bb_idx_lookup[&basic_block] = blocks.size();
+            blocks.push_back(&basic_block);
+        }
+    }
+
+    unsigned int n_blocks = blocks.size();
+
+    /* Successor edges of block b are [succ_begin[b], succ_begin[b + 1]) */
+    std::vector<unsigned int> succ_begin(n_blocks + 1, 0);
+    std::vector<unsigned int> edge_succ;
+    std::vector<unsigned int> edge_mask;
+    std::vector<unsigned int> pred_begin(n_blocks + 1, 0);
+
+    for (unsigned int bb_idx = 0; bb_idx < n_blocks; bb_idx++) {
+        auto* basic_block = blocks[bb_idx];
+
+        for (auto* succ_basic_block : successors(basic_block)) {
+            auto succ_idx = bb_idx_lookup[succ_basic_block];
+            auto mask_iter =
+                flow_mask.edge_offset_lookup.find(std::make_pair(basic_block, succ_basic_block));
+
+            edge_succ.push_back(succ_idx);
+            edge_mask.push_back(
+                (mask_iter == flow_mask.edge_offset_lookup.end()) ? NO_MASK : mask_iter->second
+            );
+            pred_begin[succ_idx + 1]++;
+        }
+
+        succ_begin[bb_idx + 1] = edge_succ.size();
+    }
+
+    /* Predecessors of block b are [pred_begin[b], pred_begin[b + 1]) */
+    for (unsigned int bb_idx = 0; bb_idx < n_blocks; bb_idx++) {
+        pred_begin[bb_idx + 1] += pred_begin[bb_idx];
+    }
+
+    std::vector<unsigned int> edge_pred(edge_succ.size());
+    {
+        std::vector<unsigned int> pred_fill(pred_begin.begin(), pred_begin.end() - 1);
+
+        for (unsigned int bb_idx = 0; bb_idx < n_blocks; bb_idx++) {
+            for (auto edge = succ_begin[bb_idx]; edge < succ_begin[bb_idx + 1]; edge++) {
+                edge_pred[pred_fill[edge_succ[edge]]++] = bb_idx;
+            }
+        }
+    }
+
+    /* Live sets of all blocks, n_words words per block */
+    std::vector<uint64_t> in_words(n_blocks * n_words, 0);
+    std::vector<uint64_t> out_words(n_blocks * n_words, 0);
+
+    /* Definition and use sets are read in place */
+    std::vector<const uint64_t*> bb_def(n_blocks);
+    std::vector<const uint64_t*> bb_use(n_blocks);
+
+    for (unsigned int bb_idx = 0; bb_idx < n_blocks; bb_idx++) {
+        auto* info = bb_info_lookup[blocks[bb_idx]];
+
+        bb_def[bb_idx] = reinterpret_cast<const uint64_t*>(info->def.getData().data());
+        bb_use[bb_idx] = reinterpret_cast<const uint64_t*>(info->use.getData().data());
+    }
+
+    /* Highest index first, successors are mostly solved before predecessors */
+    std::priority_queue<unsigned int> worklist;
+    std::vector<bool> is_queued(n_blocks, true);
+
+    for (unsigned int bb_idx = 0; bb_idx < n_blocks; bb_idx++) {
+        worklist.push(bb_idx);
+    }
+
+    while (!worklist.empty()) {
+        auto bb_idx = worklist.top();
+        worklist.pop();
+        is_queued[bb_idx] = false;
+
+        uint64_t* out = &out_words[bb_idx * n_words];
+        std::fill(out, out + n_words, 0);
+
+        for (auto edge = succ_begin[bb_idx]; edge < succ_begin[bb_idx + 1]; edge++) {
+            const uint64_t* succ_in = &in_words[edge_succ[edge] * n_words];
+
+            if (edge_mask[edge] == NO_MASK) {
+                for (unsigned int word = 0; word < n_words; word++) {
+                    out[word] |= succ_in[word];
+                }
+            } else {
+                const uint64_t* mask = &flow_mask.words[edge_mask[edge]];
+
+                for (unsigned int word = 0; word < n_words; word++) {
+                    out[word] |= succ_in[word] & mask[word];
+                }
+            }
+        }
+
+        /* in = use | (out & ~def) */
+        const uint64_t* def = bb_def[bb_idx];
+        const uint64_t* use = bb_use[bb_idx];
+        uint64_t* in = &in_words[bb_idx * n_words];
+
+        bool is_changed = false;
+        for (unsigned int word = 0; word < n_words; word++) {
+            uint64_t new_in = use[word] | (out[word] & ~def[word]);
+
+            is_changed |= (new_in != in[word]);
+            in[word] = new_in;
+        }
+
+        if (!is_changed) {
+            continue;
+        }
+
+        for (auto pred = pred_begin[bb_idx]; pred < pred_begin[bb_idx + 1]; pred++) {
+            if (!is_queued[edge_pred[pred]]) {
+                is_queued[edge_pred[pred]] = true;
+                worklist.push(edge_pred[pred]);
+            }
+        }
+    }
+
+    for (unsigned int bb_idx = 0; bb_idx < n_blocks; bb_idx++) {
+        auto* info = bb_info_lookup[blocks[bb_idx]];
+
+        unpackBits(&in_words[bb_idx * n_words], n_words, info->in);
+        unpackBits(&out_words[bb_idx * n_words], n_words, info->out);
+    }
+}
+
+void binding::LifetimeAnalysis::initSparseFlowMask() {
+    for (auto& basic_block : function) {
+        for (auto& phi_node : basic_block.phis()) {
+            for (auto& income_val : phi_node.incoming_values()) {
+                auto* income_instr = dyn_cast<Instruction>(&income_val);
+
+                if ((income_instr != nullptr) && isOnlyPhiIncoming(income_instr, basic_block)) {
+                    phi_only_values.insert(std::make_pair(&basic_block, income_instr));
                 }
+            }
+        }
+
+        /* First PHI entry of an edge creates its mask, later ones pass their values */
+        for (auto& phi_node : basic_block.phis()) {
+            auto n_income_val = static_cast<unsigned int>(phi_node.getNumIncomingValues());
+
+            for (unsigned int i = 0; i < n_income_val; i++) {
+                auto* income_val = phi_node.getIncomingValue(i);
 
-                auto* user_basicc_block = user_instr->getParent();
-                if ((user_basicc_block == def_basic_block)
-                        || (user_basicc_block != &basic_block)
-                        || isa<PHINode>(user_instr))
-                {
+                if (!isa<Instruction>(income_val)) {
                     continue;
                 }
 
-                is_used_in_non_phi = true;
+                auto edge = std::make_pair(phi_node.getIncomingBlock(i), &basic_block);
+
+                if (!masked_edges.insert(edge).second) {
+                    edge_phi_values.insert(std::make_pair(edge, income_val));
+                }
             }
+        }
+    }
+}
 
-            if (!is_used_in_non_phi) {
-                basic_block_mask.reset(getBitPosition(income_val));
+bool binding::LifetimeAnalysis::flowsOnEdge(Value* val,
+                                            BasicBlock* pred_basic_block,
+                                            BasicBlock* basic_block)
+{
+    auto edge = std::make_pair(pred_basic_block, basic_block);
+
+    if (masked_edges.count(edge) == 0) {
+        return true;
+    }
+
+    if (edge_phi_values.count(std::make_pair(edge, val)) != 0) {
+        return true;
+    }
+
+    return phi_only_values.count(std::make_pair(basic_block, val)) == 0;
+}
+
+BasicBlock* binding::LifetimeAnalysis::getDefBlock(Value* val) {
+    if (auto* instr = dyn_cast<Instruction>(val)) {
+        return instr->getParent();
+    }
+
+    assert(isa<Argument>(val));
+    return &function.front();
+}
+
+binding::LifetimeAnalysis::ValueLiveness& binding::LifetimeAnalysis::getValueLiveness(Value* val) {
+    auto liveness_iter = value_liveness_lookup.find(val);
+
+    if (liveness_iter != value_liveness_lookup.end()) {
+        return liveness_iter->second;
+    }
+
+    auto& liveness = value_liveness_lookup[val];
+    auto* def_basic_block = getDefBlock(val);
+
+    SmallVector<BasicBlock*, 16> worklist;
+
+    /* Same use rules as markUses() */
+    for (auto* user : val->users()) {
+        auto* use_instr = dyn_cast<Instruction>(user);
+        if (use_instr == nullptr) {
+            continue;
+        }
+
+        auto* use_instr_bb = use_instr->getParent();
+
+        if (isa<Instruction>(val)
+                && (use_instr_bb == def_basic_block)
+                && !isa<PHINode>(use_instr))
+        {
+            continue;
+        }
+
+        liveness.use.insert(use_instr_bb);
+
+        if (liveness.in.insert(use_instr_bb).second) {
+            worklist.push_back(use_instr_bb);
+        }
+    }
+
+    /* Walk backward from the uses, stopping at the definition */
+    while (!worklist.empty()) {
+        auto* basic_block = worklist.pop_back_val();
+
+        for (auto* pred_basic_block : predecessors(basic_block)) {
+            if (!flowsOnEdge(val, pred_basic_block, basic_block)
+                    || !liveness.out.insert(pred_basic_block).second)
+            {
+                continue;
+            }
+
+            if ((pred_basic_block != def_basic_block)
+                    && liveness.in.insert(pred_basic_block).second)
+            {
+                worklist.push_back(pred_basic_block);
             }
         }
     }
+
+    return liveness;
+}
+
+bool binding::LifetimeAnalysis::isDefined(Value* val, BasicBlock* basic_block) {
+    if (is_sparse) {
+        return getDefBlock(val) == basic_block;
+    }
+
+    return getInfo(basic_block)->def.test(getBitPosition(val));
+}
+
+bool binding::LifetimeAnalysis::isUsed(Value* val, BasicBlock* basic_block) {
+    if (is_sparse) {
+        return getValueLiveness(val).use.count(basic_block) != 0;
+    }
+
+    return getInfo(basic_block)->use.test(getBitPosition(val));
+}
+
+bool binding::LifetimeAnalysis::isLiveIn(Value* val, BasicBlock* basic_block) {
+    if (is_sparse) {
+        return getValueLiveness(val).in.count(basic_block) != 0;
+    }
+
+    return getInfo(basic_block)->in.test(getBitPosition(val));
+}
+
+bool binding::LifetimeAnalysis::isLiveOut(Value* val, BasicBlock* basic_block) {
+    if (is_sparse) {
+        return getValueLiveness(val).out.count(basic_block) != 0;
+    }
+
+    return getInfo(basic_block)->out.test(getBitPosition(val));
+}
+
+void binding::LifetimeAnalysis::findLiveBlocks(Value* val, std::vector<BasicBlock*>& live_blocks) {
+    live_blocks.clear();
+
+    if (!is_sparse) {
+        auto bit_pos = getBitPosition(val);
+
+        for (auto& bb_info : bb_info_lookup) {
+            auto* info = bb_info.second;
+
+            if (info->use.test(bit_pos)
+                    || info->def.test(bit_pos)
+                    || info->in.test(bit_pos)
+                    || info->out.test(bit_pos))
+            {
+                live_blocks.push_back(bb_info.first);
+            }
+        }
+
+        return;
+    }
+
+    auto& liveness = getValueLiveness(val);
+
+    SmallPtrSet<BasicBlock*, 16> blocks;
+    blocks.insert(getDefBlock(val));
+    blocks.insert(liveness.use.begin(), liveness.use.end());
+    blocks.insert(liveness.in.begin(), liveness.in.end());
+    blocks.insert(liveness.out.begin(), liveness.out.end());
+
+    live_blocks.assign(blocks.begin(), blocks.end());
 }
 
 unsigned int binding::LifetimeAnalysis::getBitPosition(Value* val) {
@@ -217,6 +562,7 @@ unsigned int binding::LifetimeAnalysis::getBitPosition(Value* val) {
 }
 
 binding::LifetimeAnalysis::BasicBlockLifetimeInfo* binding::LifetimeAnalysis::getInfo(BasicBlock* basic_block) {
+    assert(!is_sparse && "No block info in sparse liveness!");
     assert(bb_info_lookup.count(basic_block) != 0);
     return bb_info_lookup[basic_block];
 }
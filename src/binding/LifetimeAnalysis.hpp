@@ -2,19 +2,31 @@
 #define __BINDING_LIFETIME_ANALYSIS_HPP__
 
 #include <map>
+#include <vector>
+#include <cstdint>
 
 #include <llvm/IR/Function.h>
 #include <llvm/ADT/BitVector.h>
+#include <llvm/ADT/DenseMap.h>
+#include <llvm/ADT/DenseSet.h>
+#include <llvm/ADT/SmallPtrSet.h>
 #include <llvm/ADT/iterator_range.h>
 
 namespace llvm {
     namespace bphls {
         namespace binding {
 
+/**
+ * Live-in and live-out values of basic blocks. Dense bit sets of all values
+ * are kept per block unless they would exceed the dense liveness limit, then
+ * liveness of a value is computed on demand by walking backward from its SSA
+ * uses to the definition. Both modes answer the value queries identically,
+ * block info is available in the dense mode only.
+ */
 class LifetimeAnalysis {
 public:
     LifetimeAnalysis(Function& function)
-        : function(function) {}
+        : function(function), n_words(0), is_sparse(false) {}
 
     ~LifetimeAnalysis();
 
@@ -36,6 +48,19 @@ public:
 
     void analize();
 
+    bool isSparse() { return is_sparse; }
+
+    bool isDefined(Value* val, BasicBlock* basic_block);
+
+    bool isUsed(Value* val, BasicBlock* basic_block);
+
+    bool isLiveIn(Value* val, BasicBlock* basic_block);
+
+    bool isLiveOut(Value* val, BasicBlock* basic_block);
+
+    /** Blocks where the value is defined, used, live-in or live-out */
+    void findLiveBlocks(Value* val, std::vector<BasicBlock*>& live_blocks);
+
     unsigned int getBitPosition(Value* val);
 
     BasicBlockLifetimeInfo* getInfo(BasicBlock* basic_block);
@@ -48,16 +73,53 @@ public:
 private:
     Function& function;
 
+    /* Number of 64-bit words of a definition set */
+    unsigned int n_words;
+
+    bool is_sparse;
+
     std::map<Value*, unsigned int> value_bit_pos_lookup;
     std::map<BasicBlock*, BasicBlockLifetimeInfo*> bb_info_lookup;
 
-    typedef std::map<std::pair<BasicBlock*, BasicBlock*>, BitVector*> FlowMask;
+    /** PHI flow masks of CFG edges, n_words words per masked edge */
+    struct FlowMask {
+        DenseMap<std::pair<BasicBlock*, BasicBlock*>, unsigned int /*offset*/> edge_offset_lookup;
+        std::vector<uint64_t> words;
+    };
+
+    /** Blocks where a value is used, live-in and live-out */
+    struct ValueLiveness {
+        SmallPtrSet<BasicBlock*, 4> use;
+        SmallPtrSet<BasicBlock*, 4> in;
+        SmallPtrSet<BasicBlock*, 4> out;
+    };
+
+    /* Sparse mode, value liveness is computed on the first query */
+    std::map<Value*, ValueLiveness> value_liveness_lookup;
+
+    /* Sparse PHI flow masks, a value flows over a masked edge if it is
+     * read by a later PHI entry of the edge or not blocked in the successor */
+    DenseSet<std::pair<BasicBlock*, BasicBlock*>> masked_edges;
+    DenseSet<std::pair<std::pair<BasicBlock*, BasicBlock*>, Value*>> edge_phi_values;
+    DenseSet<std::pair<BasicBlock*, Value*>> phi_only_values;
 
     void markUses(Value* def_value);
 
     void initFlowMask(FlowMask& flow_mask);
 
     void initPhiFlowMask(BitVector& basic_block_mask, BasicBlock& basic_block);
+
+    bool isOnlyPhiIncoming(Instruction* income_instr, BasicBlock& basic_block);
+
+    void solveLiveness(FlowMask& flow_mask);
+
+    void initSparseFlowMask();
+
+    bool flowsOnEdge(Value* val, BasicBlock* pred_basic_block, BasicBlock* basic_block);
+
+    BasicBlock* getDefBlock(Value* val);
+
+    ValueLiveness& getValueLiveness(Value* val);
 };
 
         } /* namespace binding */
@@ -0,0 +1,593 @@
+#include <algorithm>
+#include <cctype>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <llvm/Support/Format.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include "../rtl/SignalLevelization.hpp"
+#include "../utility/verilog_utility.hpp"
+#include "CppModelWriter.hpp"
+
+using namespace llvm;
+using namespace bphls;
+
+/* Values are computed in 64 bits and masked to the signal widths */
+static const unsigned int MAX_WIDTH = 64;
+
+static const std::string UNKNOWN_NAME = "unknown";
+
+static const std::string& getNameOr(std::optional<std::string>& name,
+                                    const std::string& fallback)
+{
+    return name.has_value() ? name.value() : fallback;
+}
+
+static bool isFsmStateSignal(rtl::RtlSignal* signal) {
+    return signal->getName() == "cur_state";
+}
+
+static bool isClockSignal(rtl::RtlSignal* signal) {
+    return signal->getName() == "clk";
+}
+
+/* Part select is printed for explicit indices only, as by VerilogWriter */
+static bool hasSlice(rtl::RtlWidth width) {
+    return width.getMsbIndex().has_value();
+}
+
+static uint64_t getMask(unsigned int width) {
+    return (width >= MAX_WIDTH) ? ~0ULL : ((1ULL << width) - 1);
+}
+
+static const char* getStorageType(unsigned int width) {
+    if (width <= 8) {
+        return "std::uint8_t";
+    } else if (width <= 16) {
+        return "std::uint16_t";
+    } else if (width <= 32) {
+        return "std::uint32_t";
+    } else {
+        return "std::uint64_t";
+    }
+}
+
+static void printHex(raw_ostream& out, uint64_t value) {
+    out << format_hex(value, 0) << "ULL";
+}
+
+bool cmodel::CppModelWriter::print() {
+    if (!isSupported()) {
+        return false;
+    }
+
+    levelizeSignals();
+
+    printHeader();
+
+    printEval();
+
+    printTick();
+
+    printDeclarations();
+
+    printFooter();
+
+    return true;
+}
+
+bool cmodel::CppModelWriter::isSupported() {
+    if (!rtl_module.iter_instances().empty()) {
+        errs() << "C++ model of module '" << rtl_module.getName()
+            << "' is not supported: module instances\n";
+        return false;
+    }
+
+    auto is_too_wide = [this](rtl::RtlSignal* signal) {
+        if (signal->getWidth().getBitwidth() <= MAX_WIDTH) {
+            return false;
+        }
+
+        errs() << "C++ model of module '" << rtl_module.getName()
+            << "' is not supported: signal '" << getNameOr(signal->getName(), UNKNOWN_NAME)
+            << "' is wider than " << MAX_WIDTH << " bits\n";
+        return true;
+    };
+
+    for (auto* port : rtl_module.iter_ports()) {
+        if (is_too_wide(port)) {
+            return false;
+        }
+    }
+
+    for (auto* signal : rtl_module.iter_signals()) {
+        if (is_too_wide(signal)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void cmodel::CppModelWriter::levelizeSignals() {
+    rtl::SignalLevelization levelization(rtl_module);
+    levelization.run();
+
+    comb_groups = std::move(levelization.getCombGroups());
+    registers = std::move(levelization.getRegisters());
+}
+
+void cmodel::CppModelWriter::printHeader() {
+    auto module_name = rtl_module.getName();
+
+    std::string guard_name = module_name;
+    std::transform(guard_name.begin(), guard_name.end(), guard_name.begin(), ::toupper);
+
+    out << "/*\n";
+    out << " * Cycle-accurate model of module " << module_name << ". Set the inputs\n";
+    out << " * and call eval(), tick() advances one clock cycle.\n";
+    out << " */\n\n";
+
+    out << "#ifndef __" << guard_name << "_MODEL_HPP__\n";
+    out << "#define __" << guard_name << "_MODEL_HPP__\n\n";
+
+    out << "#include <cstdint>\n\n";
+
+    out << "class " << module_name << "_model {\n";
+    out << "public:\n";
+    out << "    typedef std::uint64_t value_t;\n\n";
+}
+
+void cmodel::CppModelWriter::printEval() {
+    out << "    /** Settles combinational signals, call after changing the inputs */\n";
+    out << "    void eval() {\n";
+
+    for (auto& group : comb_groups) {
+        if (group.size() == 1) {
+            auto* signal = group.front();
+            printSignalDefinition(signal, getNameOr(signal->getName(), UNKNOWN_NAME), 2);
+            continue;
+        }
+
+        /* Loop of multiplexers, settles in one pass per member */
+        out << "        for (unsigned int pass = 0; pass < " << group.size() << "; pass++) {\n";
+
+        for (auto* signal : group) {
+            printSignalDefinition(signal, getNameOr(signal->getName(), UNKNOWN_NAME), 3);
+        }
+
+        out << "        }\n";
+    }
+
+    out << "    }\n\n";
+}
+
+void cmodel::CppModelWriter::printTick() {
+    out << "    /** Rising clock edge, registers latch the settled signals */\n";
+    out << "    void tick() {\n";
+
+    for (auto* signal : registers) {
+        auto& name = getNameOr(signal->getName(), UNKNOWN_NAME);
+        auto next_name = "next_" + name;
+
+        out << "        value_t " << next_name << " = " << name << ";\n";
+
+        if (isFsmStateSignal(signal)) {
+            printFsmController(signal, next_name);
+        } else {
+            printSignalDefinition(signal, next_name, 2);
+        }
+
+        out << "\n";
+    }
+
+    for (auto* signal : registers) {
+        auto& name = getNameOr(signal->getName(), UNKNOWN_NAME);
+
+        out << "        " << name << " = "
+            << getStorageType(signal->getWidth().getBitwidth()) << "(next_" << name << ");\n";
+    }
+
+    out << "\n";
+    out << "        eval();\n";
+    out << "    }\n\n";
+}
+
+void cmodel::CppModelWriter::printFsmController(rtl::RtlSignal* signal, const std::string& target) {
+    assert(isFsmStateSignal(signal));
+
+    /* Transitions grouped by source state, as in the Verilog controller */
+    std::map<std::string, std::vector<unsigned int>> fsm_cases;
+    std::vector<unsigned int> stateless_conditions;
+
+    std::string state_name;
+
+    for (unsigned int i = 0; i < signal->getConditionsNum(); i++) {
+        state_name.clear();
+        utility::getConditionStateName(signal->getCondition(i), state_name);
+
+        if (state_name.empty()) {
+            stateless_conditions.push_back(i);
+        } else {
+            fsm_cases[state_name].push_back(i);
+        }
+    }
+
+    out << "        switch (" << getNameOr(signal->getName(), UNKNOWN_NAME) << ") {\n";
+
+    std::vector<rtl::RtlSignal*> clauses;
+
+    for (auto& fsm_case : fsm_cases) {
+        out << "        case " << fsm_case.first << ":\n";
+
+        unsigned int count = 0;
+
+        for (auto i : fsm_case.second) {
+            auto* driver = signal->getDriver(i);
+
+            /* Staying in the state is the default */
+            if (driver->signal->getName() == fsm_case.first) {
+                continue;
+            }
+
+            clauses.clear();
+            utility::getCaseClauseConditions(signal->getCondition(i), clauses);
+
+            if (clauses.empty()) {
+                printAssignment(signal, driver, target, 3);
+                count += 1;
+                continue;
+            }
+
+            out << "            " << ((count == 0) ? "if (" : "else if (");
+
+            for (unsigned int j = 0; j < clauses.size(); j++) {
+                if (j != 0) {
+                    out << " && ";
+                }
+
+                printValue(clauses[j]);
+            }
+
+            out << ") {\n";
+            printAssignment(signal, driver, target, 4);
+            out << "            }\n";
+
+            count += 1;
+        }
+
+        out << "            break;\n";
+    }
+
+    out << "        default:\n";
+    out << "            break;\n";
+    out << "        }\n";
+
+    /* Reset overrides the transition */
+    for (auto i : stateless_conditions) {
+        out << "        if (";
+        printValue(signal->getCondition(i));
+        out << ") {\n";
+        printAssignment(signal, signal->getDriver(i), target, 3);
+        out << "        }\n";
+    }
+}
+
+void cmodel::CppModelWriter::printDeclarations() {
+    out << "    /* States and parameters */\n";
+
+    for (auto* param : rtl_module.iter_params()) {
+        out << "    static constexpr value_t " << getNameOr(param->getName(), UNKNOWN_NAME) << " = ";
+        printConstant(param->getValue().value_or("0"), param->getWidth().getBitwidth());
+        out << ";\n";
+    }
+
+    auto print_declaration = [this](rtl::RtlSignal* signal) {
+        out << "    " << getStorageType(signal->getWidth().getBitwidth()) << " "
+            << getNameOr(signal->getName(), UNKNOWN_NAME) << " = 0;\n";
+    };
+
+    out << "\n    /* Ports */\n";
+
+    for (auto* port : rtl_module.iter_ports()) {
+        /* Clock edges are tick() calls */
+        if (!isClockSignal(port)) {
+            print_declaration(port);
+        }
+    }
+
+    out << "\n    /* Registers and wires */\n";
+
+    for (auto* signal : rtl_module.iter_signals()) {
+        print_declaration(signal);
+    }
+}
+
+void cmodel::CppModelWriter::printFooter() {
+    auto guard_name = rtl_module.getName();
+    std::transform(guard_name.begin(), guard_name.end(), guard_name.begin(), ::toupper);
+
+    out << "};\n\n";
+    out << "#endif /* __" << guard_name << "_MODEL_HPP__ */\n";
+}
+
+void cmodel::CppModelWriter::printSignalDefinition(rtl::RtlSignal* signal,
+                                                   const std::string& target,
+                                                   unsigned int indent)
+{
+    if (signal->getDefaultDriver() != nullptr) {
+        printAssignment(signal, signal->getDefaultDriver(), target, indent);
+    }
+
+    if (signal->getConditionsNum() == 0) {
+        printAssignment(signal, signal->getDriver(0), target, indent);
+    } else {
+        printConditions(signal, target, indent);
+    }
+}
+
+void cmodel::CppModelWriter::printConditions(rtl::RtlSignal* signal,
+                                             const std::string& target,
+                                             unsigned int indent)
+{
+    unsigned int n_conditions = signal->getConditionsNum();
+
+    /* Registers keep their value and defaults are overridden in order */
+    bool no_else = signal->isRegister() || (signal->getDefaultDriver() != nullptr);
+
+    if (!no_else && (n_conditions == 1)) {
+        printAssignment(signal, signal->getDriver(0), target, indent);
+        return;
+    }
+
+    for (unsigned int i = 0; i < n_conditions; i++) {
+        printIndent(indent);
+
+        if (!no_else && (i == n_conditions - 1)) {
+            out << "else {\n";
+        } else {
+            out << ((no_else || (i == 0)) ? "if (" : "else if (");
+            printValue(signal->getCondition(i));
+            out << ") {\n";
+        }
+
+        printAssignment(signal, signal->getDriver(i), target, indent + 1);
+
+        printIndent(indent);
+        out << "}\n";
+    }
+}
+
+void cmodel::CppModelWriter::printAssignment(rtl::RtlSignal* signal,
+                                             rtl::RtlSignal::RtlSignalDriver* driver,
+                                             const std::string& target,
+                                             unsigned int indent)
+{
+    assert(driver != nullptr);
+
+    unsigned int signal_width = signal->getWidth().getBitwidth();
+    auto signal_mask = getMask(signal_width);
+    auto dest_bits = driver->dest_bits;
+
+    /* Part select of the whole signal is a plain assignment */
+    bool is_partial =
+        hasSlice(dest_bits)
+            && ((dest_bits.getLsbIndex().value() != 0)
+                    || (dest_bits.getMsbIndex().value() + 1U < signal_width));
+
+    printIndent(indent);
+
+    if (is_partial) {
+        unsigned int msb = dest_bits.getMsbIndex().value();
+        unsigned int lsb = dest_bits.getLsbIndex().value();
+
+        /* Bits above the signal are dropped, as out of range part selects */
+        if ((lsb > msb) || (lsb >= MAX_WIDTH)) {
+            out << "/* " << target << " is not written */\n";
+            return;
+        }
+
+        auto slice_mask = getMask(msb - lsb + 1);
+        auto keep_mask = ~(slice_mask << lsb) & signal_mask;
+
+        out << target << " = (" << target << " & ";
+        printHex(out, keep_mask);
+        out << ") | (((";
+        printValue(driver->signal, driver->src_bits);
+        out << ") & ";
+        printHex(out, slice_mask & (signal_mask >> lsb));
+        out << ") << " << lsb << ");\n";
+    } else {
+        out << target << " = (";
+        printValue(driver->signal, driver->src_bits);
+        out << ") & ";
+        printHex(out, signal_mask);
+        out << ";\n";
+    }
+}
+
+void cmodel::CppModelWriter::printValue(rtl::RtlSignal* signal, rtl::RtlWidth width) {
+    assert(signal != nullptr);
+
+    if (signal->isOperation()) {
+        printOperator(static_cast<rtl::RtlOperation*>(signal), width);
+        return;
+    }
+
+    auto& name = getNameOr(signal->getName(), UNKNOWN_NAME);
+
+    if (signal->getType() == "parameter") {
+        out << name;
+        return;
+    }
+
+    if (signal->getValue().has_value()) {
+        printConstant(signal->getValue().value(), signal->getWidth().getBitwidth());
+        return;
+    }
+
+    unsigned int signal_width = signal->getWidth().getBitwidth();
+
+    if (!hasSlice(width)) {
+        out << "value_t(" << name << ")";
+        return;
+    }
+
+    unsigned int msb = width.getMsbIndex().value();
+    unsigned int lsb = width.getLsbIndex().value();
+
+    if ((lsb == 0) && (msb + 1 >= signal_width)) {
+        out << "value_t(" << name << ")";
+    } else if ((lsb > msb) || (lsb >= MAX_WIDTH)) {
+        out << "value_t(0)";
+    } else {
+        out << "((value_t(" << name << ") >> " << lsb << ") & ";
+        printHex(out, getMask(msb - lsb + 1));
+        out << ")";
+    }
+}
+
+void cmodel::CppModelWriter::printOperator(rtl::RtlOperation* operation, rtl::RtlWidth width) {
+    assert(operation != nullptr);
+
+    auto opcode = operation->getOpcode();
+    unsigned int op_width = operation->getWidth().getBitwidth();
+
+    switch (operation->getOperandsNum()) {
+    case 2:
+        switch (opcode) {
+        case rtl::RtlOperation::Eq:
+        case rtl::RtlOperation::Ne:
+        case rtl::RtlOperation::Lt:
+        case rtl::RtlOperation::Le:
+        case rtl::RtlOperation::Gt:
+        case rtl::RtlOperation::Ge:
+            out << "value_t(";
+            printValue(operation->getOperand(0));
+            printOpcode(opcode);
+            printValue(operation->getOperand(1));
+            out << ")";
+            break;
+        case rtl::RtlOperation::Concat:
+            out << "((";
+            printValue(operation->getOperand(0));
+            out << " << " << operation->getOperand(1)->getWidth().getBitwidth() << ") | ";
+            printValue(operation->getOperand(1));
+            out << ")";
+            break;
+        default:
+            /* Nested operations wrap around at their own width */
+            out << "((";
+            printValue(operation->getOperand(0));
+            printOpcode(opcode);
+            printValue(operation->getOperand(1));
+            out << ") & ";
+            printHex(out, getMask(op_width));
+            out << ")";
+            break;
+        }
+        break;
+    case 1:
+        if (opcode == rtl::RtlOperation::Not) {
+            out << "(~";
+            printValue(operation->getOperand(0));
+            out << " & ";
+            printHex(out, getMask(op_width));
+            out << ")";
+        } else if (opcode == rtl::RtlOperation::SExt) {
+            unsigned int src_width = operation->getOperand(0)->getWidth().getBitwidth();
+
+            if (src_width >= op_width) {
+                printValue(operation->getOperand(0));
+            } else {
+                /* Sign bit is flipped and subtracted back */
+                auto sign_bit = 1ULL << (src_width - 1);
+
+                out << "(((";
+                printValue(operation->getOperand(0));
+                out << " ^ ";
+                printHex(out, sign_bit);
+                out << ") - ";
+                printHex(out, sign_bit);
+                out << ") & ";
+                printHex(out, getMask(op_width));
+                out << ")";
+            }
+        } else if (opcode == rtl::RtlOperation::ZExt) {
+            printValue(operation->getOperand(0), width);
+        } else {
+            llvm_unreachable("Unsupported RTL unary operation");
+        }
+        break;
+    default:
+        llvm_unreachable("Invalid RTL operation");
+    }
+}
+
+void cmodel::CppModelWriter::printOpcode(rtl::RtlOperation::Opcode opcode) {
+    switch (opcode) {
+    case rtl::RtlOperation::Add:
+        out << " + ";
+        break;
+    case rtl::RtlOperation::Sub:
+        out << " - ";
+        break;
+    case rtl::RtlOperation::Mul:
+        out << " * ";
+        break;
+    case rtl::RtlOperation::And:
+        out << " & ";
+        break;
+    case rtl::RtlOperation::Or:
+        out << " | ";
+        break;
+    case rtl::RtlOperation::Xor:
+        out << " ^ ";
+        break;
+    case rtl::RtlOperation::Eq:
+        out << " == ";
+        break;
+    case rtl::RtlOperation::Ne:
+        out << " != ";
+        break;
+    case rtl::RtlOperation::Lt:
+        out << " < ";
+        break;
+    case rtl::RtlOperation::Le:
+        out << " <= ";
+        break;
+    case rtl::RtlOperation::Gt:
+        out << " > ";
+        break;
+    case rtl::RtlOperation::Ge:
+        out << " >= ";
+        break;
+    default:
+        llvm_unreachable("Invalid operator type!");
+    }
+}
+
+void cmodel::CppModelWriter::printConstant(const std::string& value, unsigned int width) {
+    /* Sized literal, truncated to its width */
+    if (utility::isNumeric(value)) {
+        printHex(out, std::stoull(value) & getMask(width));
+        return;
+    }
+
+    /* Negative values are printed as unsized integers, sign extended */
+    if ((value.size() > 1) && (value[0] == '-') && utility::isNumeric(value.substr(1))) {
+        printHex(out, 0ULL - std::stoull(value.substr(1)));
+        return;
+    }
+
+    out << value;
+}
+
+void cmodel::CppModelWriter::printIndent(unsigned int indent) {
+    for (unsigned int i = 0; i < indent; i++) {
+        out << "    ";
+    }
+}
@@ -0,0 +1,94 @@
+#ifndef __CMODEL_CPP_MODEL_WRITER_HPP__
+#define __CMODEL_CPP_MODEL_WRITER_HPP__
+
+#include <string>
+#include <vector>
+
+#include <llvm/Support/raw_ostream.h>
+
+#include "../rtl/RtlSignal.hpp"
+#include "../rtl/RtlOperation.hpp"
+#include "../rtl/RtlModule.hpp"
+
+namespace llvm {
+    namespace bphls {
+        namespace cmodel {
+
+/**
+ * Prints an RTL module as a self-contained cycle-accurate C++ model: a class
+ * with the ports, registers and wires of the module as fixed-width integer
+ * members. eval() settles the combinational signals in topological order,
+ * tick() is a rising clock edge, registers latch the settled values and the
+ * signals settle again. The FSM controller is compiled into a switch over
+ * the current state. Signals follow the semantics of the Verilog printed by
+ * VerilogWriter.
+ *
+ * Multiplexers of different states may connect signals into loops that are
+ * never active at once, such groups are evaluated as many times as they
+ * have signals.
+ *
+ * Modules with instances or signals wider than 64 bits are not supported,
+ * print() reports them and returns false.
+ */
+class CppModelWriter {
+public:
+    CppModelWriter(raw_ostream& out, rtl::RtlModule& rtl_module)
+        : out(out),
+          rtl_module(rtl_module) {}
+
+    bool print();
+
+private:
+    raw_ostream& out;
+    rtl::RtlModule& rtl_module;
+
+    /* Combinational signals in evaluation order, grouped by loops */
+    std::vector<std::vector<rtl::RtlSignal*>> comb_groups;
+
+    std::vector<rtl::RtlSignal*> registers;
+
+    bool isSupported();
+
+    void levelizeSignals();
+
+    void printHeader();
+
+    void printEval();
+
+    void printTick();
+
+    void printDeclarations();
+
+    void printFooter();
+
+    void printFsmController(rtl::RtlSignal* signal, const std::string& target);
+
+    void printSignalDefinition(rtl::RtlSignal* signal,
+                               const std::string& target,
+                               unsigned int indent);
+
+    void printConditions(rtl::RtlSignal* signal,
+                         const std::string& target,
+                         unsigned int indent);
+
+    void printAssignment(rtl::RtlSignal* signal,
+                         rtl::RtlSignal::RtlSignalDriver* driver,
+                         const std::string& target,
+                         unsigned int indent);
+
+    void printValue(rtl::RtlSignal* signal, rtl::RtlWidth width = rtl::RtlWidth());
+
+    void printOperator(rtl::RtlOperation* operation, rtl::RtlWidth width);
+
+    void printOpcode(rtl::RtlOperation::Opcode opcode);
+
+    void printConstant(const std::string& value, unsigned int width);
+
+    void printIndent(unsigned int indent);
+};
+
+        } /* namespace cmodel */
+    } /* namespace bphls */
+} /* namespace llvm */
+
+#endif /* __CMODEL_CPP_MODEL_WRITER_HPP__ */
@@ -12,12 +12,24 @@ namespace llvm {
 struct FunctionalUnit {
     Operation op;
 
+    /* Creation order among the units of the hardware constraints */
+    unsigned int id;
+
     FunctionalUnit(float f_max = 50.0F,
                    float crit_delay = 0.0F,
                    unsigned short latency = 0,
                    unsigned short n_lut = 1,
                    unsigned short n_reg = 1)
-        : op(f_max, crit_delay, latency, n_lut, n_reg) {};
+        : op(f_max, crit_delay, latency, n_lut, n_reg),
+          id(0) {};
+};
+
+/** Orders units by creation, so that iterations over units do not depend
+ *  on their allocation addresses */
+struct FunctionalUnitLess {
+    bool operator () (const FunctionalUnit* first, const FunctionalUnit* second) const {
+        return first->id < second->id;
+    }
 };
 
         } /* namespace hardware */
@@ -4,9 +4,11 @@
 #include <tuple>
 
 #include <llvm/IR/Instruction.h>
+#include <llvm/IR/Instructions.h>
 #include <llvm/IR/Type.h>
 #include <llvm/IR/DerivedTypes.h>
 
+#include "../utility/instruction_utility.hpp"
 #include "Operation.hpp"
 #include "FunctionalUnit.hpp"
 #include "HardwareConstraints.hpp"
@@ -14,17 +16,11 @@
 using namespace llvm;
 using namespace bphls;
 
-hardware::HardwareConstraints* hardware::HardwareConstraints::constraints = nullptr;
-
-hardware::HardwareConstraints* hardware::HardwareConstraints::getHardwareConstraints() {
-    return constraints == nullptr ? new HardwareConstraints() : constraints;
-}
-
 hardware::FunctionalUnit* hardware::HardwareConstraints::getInstructionFu(Instruction& instr) {
     switch (instr.getNumOperands()) {
     case 1:
     {
-        auto bw = instr.getOperand(0)->getType()->getPrimitiveSizeInBits();
+        auto bw = utility::getFuBitwidth(instr);
 
         UnaryOperationDescriptor descr = std::make_tuple(
             instr.getOpcode(),
@@ -34,8 +30,8 @@ hardware::FunctionalUnit* hardware::HardwareConstraints::getInstructionFu(Instru
     }
     case 2:
     {
-        auto bw_0 = instr.getOperand(0)->getType()->getPrimitiveSizeInBits();
-        auto bw_1 = instr.getOperand(1)->getType()->getPrimitiveSizeInBits();
+        auto bw_0 = utility::getFuBitwidth(instr);
+        auto bw_1 = bw_0;
         BinaryOperationDescriptor descr = std::make_tuple(
             instr.getOpcode(),
             bw_0,
@@ -49,21 +45,64 @@ hardware::FunctionalUnit* hardware::HardwareConstraints::getInstructionFu(Instru
 }
 
 std::optional<unsigned int> hardware::HardwareConstraints::getFuNumConstraint(FunctionalUnit& fu) {
-    return fu_num_constraints[&fu];
+    auto fu_num_iter = fu_num_constraints.find(&fu);
+
+    if (fu_num_iter == fu_num_constraints.end()) {
+        return std::nullopt;
+    }
+
+    return fu_num_iter->second;
 }
 
-std::map<hardware::FunctionalUnit*, std::optional<unsigned int>>&
+hardware::HardwareConstraints::FuNumConstraints&
 hardware::HardwareConstraints::getFuNumConstraints() {
     return fu_num_constraints;
 }
 
+hardware::FunctionalUnit* hardware::HardwareConstraints::createFu(float f_max, float crit_delay) {
+    auto* fu = new FunctionalUnit(f_max, crit_delay);
+    fu->id = n_fus++;
+
+    return fu;
+}
+
 hardware::Operation* hardware::HardwareConstraints::getInstructionOperation(Instruction& instr) {
-    // FIXME Mock return
-    return &(*binary_op_fu_lookup.begin()).second->op;
+    auto* fu = getInstructionFu(instr);
+
+    if (fu != nullptr) {
+        return &fu->op;
+    }
+
+    if (!isa<BinaryOperator>(instr) && !isa<ICmpInst>(instr)) {
+        /* Wiring and control instructions */
+        return &default_op;
+    }
+
+    /* Unshared datapath operation, delay of the next wider class */
+    unsigned int class_width = 8;
+    while (class_width < utility::getFuBitwidth(instr)) {
+        class_width *= 2;
+    }
+
+    if (class_width <= 64) {
+        auto op_iter = binary_op_lookup.find(
+            bin_op(instr.getOpcode(), class_width, class_width)
+        );
+
+        if (op_iter != binary_op_lookup.end()) {
+            return &op_iter->second;
+        }
+    }
+
+    /* Unknown delay, the operation takes a whole state */
+    return &unknown_op;
 }
 
-hardware::HardwareConstraints::HardwareConstraints() {
-    /* Functional Units Types */
+hardware::HardwareConstraints::HardwareConstraints()
+    : max_delay(20.0F), /* 50 MHz default clock period, ns */
+      unknown_op(50.0F, max_delay)
+{
+    /* Functional Units Types, critical path delays are in ns */
     static unsigned char bin_i_width[4][4][2] = {
         {{ 8, 8}, { 8, 16}, { 8, 32}, { 8, 64}},
         {{16, 8}, {16, 16}, {16, 32}, {16, 64}},
@@ -77,11 +116,11 @@ hardware::HardwareConstraints::HardwareConstraints() {
     auto or_32_32 = bin_op(Instruction::Or, 32, 32);
     auto cmp_32_32 = bin_op(Instruction::ICmp, 32, 32);
 
-    binary_op_fu_lookup[add_32_32] = new FunctionalUnit;
-    binary_op_fu_lookup[mul_32_32] = new FunctionalUnit;
-    binary_op_fu_lookup[and_32_32] = new FunctionalUnit;
-    binary_op_fu_lookup[or_32_32] = new FunctionalUnit;
-    binary_op_fu_lookup[cmp_32_32] = new FunctionalUnit;
+    binary_op_fu_lookup[add_32_32] = createFu(50.0F, 3.5F);
+    binary_op_fu_lookup[mul_32_32] = createFu(50.0F, 14.0F);
+    binary_op_fu_lookup[and_32_32] = createFu(50.0F, 0.8F);
+    binary_op_fu_lookup[or_32_32] = createFu(50.0F, 0.8F);
+    binary_op_fu_lookup[cmp_32_32] = createFu(50.0F, 2.8F);
 
     fu_num_constraints[binary_op_fu_lookup[add_32_32]] = 1;
     fu_num_constraints[binary_op_fu_lookup[mul_32_32]] = 1;
@@ -95,11 +134,11 @@ hardware::HardwareConstraints::HardwareConstraints() {
     auto or_16_16 = bin_op(Instruction::Or, 16, 16);
     auto cmp_16_16 = bin_op(Instruction::ICmp, 16, 16);
 
-    binary_op_fu_lookup[add_16_16] = new FunctionalUnit;
-    binary_op_fu_lookup[mul_16_16] = new FunctionalUnit;
-    binary_op_fu_lookup[and_16_16] = new FunctionalUnit;
-    binary_op_fu_lookup[or_16_16] = new FunctionalUnit;
-    binary_op_fu_lookup[cmp_16_16] = new FunctionalUnit;
+    binary_op_fu_lookup[add_16_16] = createFu(50.0F, 2.5F);
+    binary_op_fu_lookup[mul_16_16] = createFu(50.0F, 9.0F);
+    binary_op_fu_lookup[and_16_16] = createFu(50.0F, 0.6F);
+    binary_op_fu_lookup[or_16_16] = createFu(50.0F, 0.6F);
+    binary_op_fu_lookup[cmp_16_16] = createFu(50.0F, 2.2F);
 
     fu_num_constraints[binary_op_fu_lookup[add_16_16]] = 2;
     fu_num_constraints[binary_op_fu_lookup[mul_16_16]] = 1;
@@ -113,11 +152,11 @@ hardware::HardwareConstraints::HardwareConstraints() {
     auto or_8_8 = bin_op(Instruction::Or, 8, 8);
     auto cmp_8_8 = bin_op(Instruction::ICmp, 8, 8);
 
-    binary_op_fu_lookup[add_8_8] = new FunctionalUnit;
-    binary_op_fu_lookup[mul_8_8] = new FunctionalUnit;
-    binary_op_fu_lookup[and_8_8] = new FunctionalUnit;
-    binary_op_fu_lookup[or_8_8] = new FunctionalUnit;
-    binary_op_fu_lookup[cmp_8_8] = new FunctionalUnit;
+    binary_op_fu_lookup[add_8_8] = createFu(50.0F, 2.0F);
+    binary_op_fu_lookup[mul_8_8] = createFu(50.0F, 6.0F);
+    binary_op_fu_lookup[and_8_8] = createFu(50.0F, 0.5F);
+    binary_op_fu_lookup[or_8_8] = createFu(50.0F, 0.5F);
+    binary_op_fu_lookup[cmp_8_8] = createFu(50.0F, 1.8F);
 
     fu_num_constraints[binary_op_fu_lookup[add_8_8]] = 2;
     fu_num_constraints[binary_op_fu_lookup[mul_8_8]] = 1;
@@ -125,6 +164,44 @@ hardware::HardwareConstraints::HardwareConstraints() {
     fu_num_constraints[binary_op_fu_lookup[or_8_8]] = 1;
     fu_num_constraints[binary_op_fu_lookup[cmp_8_8]] = 1;
 
+    /* Delays of operations not bound to functional units, e.g. narrower
+     * than a unit or without one, only used to chain them. Dividers do not
+     * fit a clock period */
+    static const unsigned char op_widths[4] = { 8, 16, 32, 64 };
+
+    static const std::tuple<unsigned int, float, float, float, float> op_delays[] = {
+        { Instruction::Add,  2.0F,  2.5F,  3.5F,  5.0F },
+        { Instruction::Sub,  2.0F,  2.5F,  3.5F,  5.0F },
+        { Instruction::Mul,  6.0F,  9.0F, 14.0F, 24.0F },
+        { Instruction::And,  0.5F,  0.6F,  0.8F,  1.0F },
+        { Instruction::Or,   0.5F,  0.6F,  0.8F,  1.0F },
+        { Instruction::Xor,  0.5F,  0.6F,  0.8F,  1.0F },
+        { Instruction::ICmp, 1.8F,  2.2F,  2.8F,  3.6F },
+        { Instruction::Shl,  1.5F,  2.0F,  2.6F,  3.2F },
+        { Instruction::LShr, 1.5F,  2.0F,  2.6F,  3.2F },
+        { Instruction::AShr, 1.5F,  2.0F,  2.6F,  3.2F },
+        { Instruction::UDiv, 12.0F, 24.0F, 48.0F, 96.0F },
+        { Instruction::SDiv, 12.0F, 24.0F, 48.0F, 96.0F },
+        { Instruction::URem, 12.0F, 24.0F, 48.0F, 96.0F },
+        { Instruction::SRem, 12.0F, 24.0F, 48.0F, 96.0F },
+    };
+
+    for (auto& op_delay : op_delays) {
+        auto opcode = std::get<0>(op_delay);
+
+        float delays[4] = {
+            std::get<1>(op_delay),
+            std::get<2>(op_delay),
+            std::get<3>(op_delay),
+            std::get<4>(op_delay),
+        };
+
+        for (unsigned int i = 0; i < 4; i++) {
+            auto op = bin_op(opcode, op_widths[i], op_widths[i]);
+            binary_op_lookup.emplace(op, Operation(50.0F, delays[i]));
+        }
+    }
+
 //     InstructionOpcode AddOpCode = (InstructionOpcode) Instruction::BinaryOps::Add;
 //     InstructionOpcode SubOpCode = (InstructionOpcode) Instruction::BinaryOps::Sub;
 //     InstructionOpcode ICmpOpCode = (InstructionOpcode) Instruction::ICmp;
@@ -159,7 +236,12 @@ hardware::HardwareConstraints::HardwareConstraints() {
 }
 
 hardware::HardwareConstraints::~HardwareConstraints() {
-    for (auto inst_op_pair : instr_fu_lookup) {
-        delete inst_op_pair.second;
+    /* Functional units are owned by the operation lookup tables */
+    for (auto& op_fu_pair : unary_op_fu_lookup) {
+        delete op_fu_pair.second;
+    }
+
+    for (auto& op_fu_pair : binary_op_fu_lookup) {
+        delete op_fu_pair.second;
     }
 }
\ No newline at end of file
@@ -16,7 +16,13 @@ namespace llvm {
 
 class HardwareConstraints {
 public:
-    static HardwareConstraints* getHardwareConstraints();
+    typedef std::map<FunctionalUnit*, std::optional<unsigned int>, FunctionalUnitLess> FuNumConstraints;
+
+    HardwareConstraints();
+
+    HardwareConstraints(const HardwareConstraints&) = delete;
+
+    HardwareConstraints& operator = (const HardwareConstraints&) = delete;
 
     Operation* getInstructionOperation(Instruction& instr);
 
@@ -24,15 +30,13 @@ public:
 
     std::optional<unsigned int> getFuNumConstraint(FunctionalUnit& fu);
 
-    std::map<FunctionalUnit*, std::optional<unsigned int>>& getFuNumConstraints();
+    FuNumConstraints& getFuNumConstraints();
 
     ~HardwareConstraints();
 
     float max_delay;
 
 private:
-    static HardwareConstraints* constraints;
-
     typedef std::tuple<
         unsigned int,   /* Opcode */
         unsigned char   /* Input Width */
@@ -54,13 +58,20 @@ private:
         return std::make_tuple(opcode, w_0);
     }
 
+    Operation default_op;
+    Operation unknown_op;
+
     std::map<UnaryOperationDescriptor, FunctionalUnit*> unary_op_fu_lookup;
     std::map<BinaryOperationDescriptor, FunctionalUnit*> binary_op_fu_lookup;
 
+    /* Datapath operations without functional units, by width class */
+    std::map<BinaryOperationDescriptor, Operation> binary_op_lookup;
+
     std::map<Instruction*, FunctionalUnit*> instr_fu_lookup;
-    std::map<FunctionalUnit*, std::optional<unsigned int>> fu_num_constraints;
+    FuNumConstraints fu_num_constraints;
+    unsigned int n_fus = 0;
 
-    HardwareConstraints();
+    FunctionalUnit* createFu(float f_max, float crit_delay);
 };
 
         } /* namespace hardware */
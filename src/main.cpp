@@ -1,53 +1,80 @@
 #include <iostream>
 #include <string>
 
-#include <llvm/Support/SourceMgr.h>
-#include <llvm/IRReader/IRReader.h>
-
-#include <llvm/IR/LLVMContext.h>
-#include <llvm/IR/Module.h>
-#include <llvm/IR/Function.h>
+#include <llvm/Support/CommandLine.h>
 
 #include "config.hpp"
 
-#include "hardware/HardwareConstraints.hpp"
-#include "BitpackHls.hpp"
+#include "BitpackHlsBatch.hpp"
+
+using namespace llvm;
 
-static const int MAIN_ARGC = 3;
 static const std::string HLS_SRC_DIR(D_HLS_SRC_DIR);
 static const std::string HLS_OUT_DIR(D_HLS_OUT_DIR);
 
-static llvm::LLVMContext llvm_context;
-static llvm::SMDiagnostic llvm_err;
-
-auto* constraints = llvm::bphls::hardware::HardwareConstraints::getHardwareConstraints();
+static cl::list<std::string> input_args(
+    cl::Positional,
+    cl::OneOrMore,
+    cl::desc("<ir file> [<function>] | <ir files>... (bitcode or textual IR)")
+);
+
+static cl::list<std::string> function_names(
+    "function",
+    cl::desc("Function to synthesize (may be repeated)"),
+    cl::value_desc("name")
+);
+
+static cl::alias function_names_alias(
+    "f",
+    cl::desc("Alias for --function"),
+    cl::aliasopt(function_names)
+);
+
+static cl::opt<bool> all_functions(
+    "all",
+    cl::desc("Synthesize every function defined in the input modules")
+);
+
+static cl::opt<unsigned int> n_jobs(
+    "j",
+    cl::desc("Number of worker threads (0 - all hardware threads)"),
+    cl::init(0)
+);
+
+static cl::opt<std::string> out_dir(
+    "out-dir",
+    cl::desc("Output directory"),
+    cl::value_desc("dir"),
+    cl::init(HLS_OUT_DIR)
+);
 
 int main(int argc, char const *argv[]) {
-    if (argc != MAIN_ARGC) {
-        std::cerr << "Illegal number of parameters" << std::endl;
-        return 1;
-    }
+    cl::ParseCommandLineOptions(argc, argv, "Bitpack HLS\n");
 
-    std::string ir_file(argv[1]);
-    std::string function_name(argv[2]);
+    llvm::bphls::BitpackHlsBatch hls(out_dir, n_jobs);
 
-    auto module = llvm::parseIRFile(ir_file, llvm_err, llvm_context);
+    const bool is_batch = all_functions || !function_names.empty();
 
-    if (module.get() == nullptr) {
-        std::cerr << "IR module not found" << std::endl;
-        return 1;
-    }
+    if (!is_batch) {
+        /* Legacy invocation: <ir file> <function> */
+        if (input_args.size() != 2) {
+            std::cerr << "Illegal number of parameters" << std::endl;
+            return 1;
+        }
 
-    auto function = module->getFunction(function_name);
+        hls.addModule(input_args[0]);
+        hls.selectFunction(input_args[1]);
+    } else {
+        for (auto& ir_file : input_args) {
+            hls.addModule(ir_file);
+        }
 
-    if (function == nullptr) {
-        std::cerr << "Function '" << function_name << "' not found" << std::endl;
-        return 1;
+        for (auto& function_name : function_names) {
+            hls.selectFunction(function_name);
+        }
     }
 
-    llvm::bphls::BitpackHls hls(*function /*, constrains */);
-
     const bool hls_status = hls.run();
 
-    return hls_status;
-}
\ No newline at end of file
+    return hls_status ? 0 : 1;
+}
@@ -0,0 +1,260 @@
+#ifndef __MATH_ASSIGNMENT_SOLVER_HPP__
+#define __MATH_ASSIGNMENT_SOLVER_HPP__
+
+#include <limits>
+#include <vector>
+#include <cassert>
+
+namespace llvm {
+    namespace bphls {
+        namespace math {
+
+/**
+ * Minimum cost assignment of every row to a distinct column, solved with
+ * Jonker-Volgenant shortest augmenting paths over row and column potentials
+ * in O(rows^2 * cols) time. Rows whose cheapest column is still free after
+ * the initial row reduction are assigned without augmenting, and paths end
+ * at a free column as soon as one is reachable at the shortest distance.
+ *
+ * Costs are a flat row-major buffer of rows x cols (rows <= cols) entries,
+ * entries equal to FORBIDDEN are never assigned. Allowed entries are packed
+ * per row before solving, so sparse rows relax only their own columns. All
+ * buffers are kept between solves and only grow, repeated solves of similar
+ * sizes do not allocate.
+ */
+template <typename Cost>
+class AssignmentSolver {
+public:
+    typedef unsigned int Index;
+
+    static constexpr Cost FORBIDDEN = std::numeric_limits<Cost>::max();
+
+    AssignmentSolver()
+        : n_rows(0), n_cols(0), total_cost(0) {}
+
+    /** Returns false if there is no assignment avoiding forbidden entries */
+    bool solve(const Cost* costs, Index rows, Index cols);
+
+    Index getColumn(Index row) { return row_cols[row]; }
+
+    Cost getCost() { return total_cost; }
+
+private:
+    static constexpr Cost INF = std::numeric_limits<Cost>::max();
+    static constexpr Index NONE = std::numeric_limits<Index>::max();
+
+    Index n_rows;
+    Index n_cols;
+    Cost total_cost;
+
+    /* Allowed entries of row r are [row_begin[r], row_begin[r + 1]) */
+    std::vector<Index> row_begin;
+    std::vector<Index> entry_cols;
+    std::vector<Cost> entry_costs;
+
+    std::vector<Cost> u;
+    std::vector<Cost> v;
+    std::vector<Index> row_cols;
+    std::vector<Index> col_rows;
+
+    /* Augmenting path search */
+    std::vector<Cost> shortest;
+    std::vector<Index> path;
+    std::vector<Index> remaining;
+    std::vector<char> is_col_visited;
+    std::vector<Index> visited_rows;
+    std::vector<Index> visited_cols;
+
+    void packEntries(const Cost* costs);
+
+    bool reduceRows();
+
+    bool augment(Index row);
+};
+
+template <typename Cost>
+bool AssignmentSolver<Cost>::solve(const Cost* costs, Index rows, Index cols) {
+    assert(rows <= cols);
+
+    n_rows = rows;
+    n_cols = cols;
+    total_cost = 0;
+
+    packEntries(costs);
+
+    u.assign(n_rows, 0);
+    v.assign(n_cols, 0);
+    row_cols.assign(n_rows, NONE);
+    col_rows.assign(n_cols, NONE);
+
+    if (!reduceRows()) {
+        return false;
+    }
+
+    for (Index row = 0; row < n_rows; row++) {
+        if ((row_cols[row] == NONE) && !augment(row)) {
+            return false;
+        }
+    }
+
+    for (Index row = 0; row < n_rows; row++) {
+        total_cost += costs[row * n_cols + row_cols[row]];
+    }
+
+    return true;
+}
+
+template <typename Cost>
+void AssignmentSolver<Cost>::packEntries(const Cost* costs) {
+    row_begin.assign(n_rows + 1, 0);
+    entry_cols.clear();
+    entry_costs.clear();
+
+    for (Index row = 0; row < n_rows; row++) {
+        const Cost* row_costs = costs + row * n_cols;
+
+        for (Index col = 0; col < n_cols; col++) {
+            if (row_costs[col] != FORBIDDEN) {
+                entry_cols.push_back(col);
+                entry_costs.push_back(row_costs[col]);
+            }
+        }
+
+        row_begin[row + 1] = entry_cols.size();
+    }
+}
+
+template <typename Cost>
+bool AssignmentSolver<Cost>::reduceRows() {
+    /* Row minimum is a feasible potential, free minimum columns are tight */
+    for (Index row = 0; row < n_rows; row++) {
+        if (row_begin[row] == row_begin[row + 1]) {
+            return false;
+        }
+
+        Index min_entry = row_begin[row];
+        for (Index entry = min_entry + 1; entry < row_begin[row + 1]; entry++) {
+            if (entry_costs[entry] < entry_costs[min_entry]) {
+                min_entry = entry;
+            }
+        }
+
+        u[row] = entry_costs[min_entry];
+
+        Index col = entry_cols[min_entry];
+        if (col_rows[col] == NONE) {
+            col_rows[col] = row;
+            row_cols[row] = col;
+        }
+    }
+
+    return true;
+}
+
+template <typename Cost>
+bool AssignmentSolver<Cost>::augment(Index row) {
+    shortest.assign(n_cols, INF);
+    path.resize(n_cols);
+    is_col_visited.assign(n_cols, 0);
+    visited_rows.clear();
+    visited_cols.clear();
+
+    remaining.resize(n_cols);
+    for (Index col = 0; col < n_cols; col++) {
+        remaining[col] = col;
+    }
+
+    Index n_remaining = n_cols;
+    Cost min_dist = 0;
+    Index cur_row = row;
+    Index sink = NONE;
+
+    /* Dijkstra over reduced costs until a free column is reached */
+    while (sink == NONE) {
+        visited_rows.push_back(cur_row);
+
+        for (Index entry = row_begin[cur_row]; entry < row_begin[cur_row + 1]; entry++) {
+            Index col = entry_cols[entry];
+
+            if (is_col_visited[col]) {
+                continue;
+            }
+
+            Cost dist = min_dist + entry_costs[entry] - u[cur_row] - v[col];
+            if (dist < shortest[col]) {
+                shortest[col] = dist;
+                path[col] = cur_row;
+            }
+        }
+
+        Cost lowest = INF;
+        Index lowest_idx = NONE;
+
+        for (Index idx = 0; idx < n_remaining; idx++) {
+            Index col = remaining[idx];
+
+            bool is_lower =
+                (shortest[col] < lowest)
+                    || ((shortest[col] == lowest) && (lowest != INF) && (col_rows[col] == NONE));
+
+            if (is_lower) {
+                lowest = shortest[col];
+                lowest_idx = idx;
+            }
+        }
+
+        if (lowest_idx == NONE) {
+            return false;
+        }
+
+        min_dist = lowest;
+
+        Index col = remaining[lowest_idx];
+        remaining[lowest_idx] = remaining[--n_remaining];
+
+        is_col_visited[col] = 1;
+        visited_cols.push_back(col);
+
+        if (col_rows[col] == NONE) {
+            sink = col;
+        } else {
+            cur_row = col_rows[col];
+        }
+    }
+
+    /* Potentials are updated once per path, not per Dijkstra step */
+    u[row] += min_dist;
+    for (auto visited_row : visited_rows) {
+        if (visited_row != row) {
+            u[visited_row] += min_dist - shortest[row_cols[visited_row]];
+        }
+    }
+
+    for (auto visited_col : visited_cols) {
+        v[visited_col] -= min_dist - shortest[visited_col];
+    }
+
+    /* Flip the augmenting path back to the root row */
+    Index col = sink;
+    while (true) {
+        Index path_row = path[col];
+        Index prev_col = row_cols[path_row];
+
+        col_rows[col] = path_row;
+        row_cols[path_row] = col;
+
+        if (path_row == row) {
+            break;
+        }
+
+        col = prev_col;
+    }
+
+    return true;
+}
+
+        } /* namespace math */
+    } /* namespace bphls */
+} /* namespace llvm */
+
+#endif /* __MATH_ASSIGNMENT_SOLVER_HPP__ */
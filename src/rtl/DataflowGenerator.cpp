@@ -0,0 +1,370 @@
+#include <cmath>
+#include <set>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include <llvm/IR/Function.h>
+#include <llvm/IR/Constants.h>
+#include <llvm/IR/Instructions.h>
+#include <llvm/Support/CommandLine.h>
+
+#include "../utility/verilog_utility.hpp"
+#include "../utility/instruction_utility.hpp"
+#include "DataflowGenerator.hpp"
+
+using namespace llvm;
+using namespace bphls;
+
+static cl::opt<unsigned int> dataflow_fifo_depth(
+    "dataflow-fifo-depth",
+    cl::desc("Depth of FIFOs between dataflow tasks (rounded up to a power of two)"),
+    cl::init(2)
+);
+
+static Function* getTaskCallee(Instruction& instr) {
+    auto* call = dyn_cast<CallInst>(&instr);
+
+    if ((call == nullptr) || utility::isDummyCall(instr)) {
+        return nullptr;
+    }
+
+    auto* callee = call->getCalledFunction();
+
+    if ((callee == nullptr) || callee->isDeclaration() || callee->isIntrinsic()) {
+        return nullptr;
+    }
+
+    return callee;
+}
+
+static bool isStreamValue(Value* val) {
+    return isa<Argument>(val)
+        || (isa<Instruction>(val) && (getTaskCallee(*cast<Instruction>(val)) != nullptr));
+}
+
+rtl::DataflowGenerator::DataflowGenerator(Function& function)
+    : function(function),
+      module(function.getName().str()) {}
+
+bool rtl::DataflowGenerator::isDataflowFunction(Function& function) {
+    if (function.isDeclaration() || (function.size() != 1)) {
+        return false;
+    }
+
+    auto* ret_type = function.getReturnType();
+    if (!ret_type->isVoidTy() && !ret_type->isIntegerTy()) {
+        return false;
+    }
+
+    unsigned int n_tasks = 0;
+
+    for (auto& instr : function.front()) {
+        if (auto* ret_instr = dyn_cast<ReturnInst>(&instr)) {
+            auto* ret_val = ret_instr->getReturnValue();
+
+            if ((ret_val != nullptr) && !isStreamValue(ret_val)) {
+                return false;
+            }
+            continue;
+        }
+
+        if (utility::isDummyCall(instr)) {
+            continue;
+        }
+
+        auto* callee = getTaskCallee(instr);
+
+        if ((callee == nullptr) || (callee == &function)) {
+            return false;
+        }
+
+        if (!instr.getType()->isVoidTy() && !instr.getType()->isIntegerTy()) {
+            return false;
+        }
+
+        for (auto& arg : cast<CallInst>(instr).args()) {
+            if (!arg->getType()->isIntegerTy()
+                    || (!isStreamValue(arg) && !isa<ConstantInt>(arg)))
+            {
+                return false;
+            }
+        }
+
+        n_tasks += 1;
+    }
+
+    return n_tasks != 0;
+}
+
+std::vector<Function*> rtl::DataflowGenerator::getCallees(Function& function) {
+    std::vector<Function*> callees;
+
+    for (auto& instr : function.front()) {
+        auto* callee = getTaskCallee(instr);
+
+        if ((callee != nullptr)
+                && (std::find(callees.begin(), callees.end(), callee) == callees.end()))
+        {
+            callees.push_back(callee);
+        }
+    }
+
+    return callees;
+}
+
+rtl::RtlModule& rtl::DataflowGenerator::generate() {
+    assert(isDataflowFunction(function));
+
+    ZERO = module.addConstant("0");
+    ONE = module.addConstant("1");
+
+    module.addInputWire("clk");
+    module.addInputWire("reset");
+
+    addArgumentStreams();
+
+    addTasks();
+
+    connectTasks();
+
+    addReturnStream();
+
+    generateHandshakes();
+
+    return module;
+}
+
+void rtl::DataflowGenerator::addArgumentStreams() {
+    for (auto& arg : function.args()) {
+        auto arg_name = utility::getVerilogName(&arg);
+
+        auto& producer = producers[&arg];
+        producer.name = arg_name;
+        producer.data = module.addInputWire(arg_name, RtlWidth(arg.getType()));
+
+        module.addInputWire(arg_name + "_valid");
+        module.addOutput(arg_name + "_ready");
+
+        producer.push = module.addWire(arg_name + "_push");
+    }
+}
+
+void rtl::DataflowGenerator::addTasks() {
+    std::map<Function*, unsigned int> callee_count;
+
+    for (auto& instr : function.front()) {
+        auto* callee = getTaskCallee(instr);
+
+        if (callee == nullptr) {
+            continue;
+        }
+
+        auto callee_name = callee->getName().str();
+        auto instance_name =
+            callee_name + "_inst_" + std::to_string(callee_count[callee]++);
+
+        Task task;
+        task.call = cast<CallInst>(&instr);
+        task.instance = module.addInstance(callee_name, instance_name);
+        task.start = module.addWire(instance_name + "_start");
+        task.busy = module.addReg(instance_name + "_busy");
+        task.done = module.addWire(instance_name + "_done");
+
+        auto* finish = module.addWire(instance_name + "_finish");
+
+        task.instance->connectInput("clk", module.find("clk"));
+        task.instance->connectInput("reset", module.find("reset"));
+        task.instance->connectInput("start", task.start);
+        task.instance->connectOutput("finish", finish);
+
+        /* Finish is a registered pulse, it is meaningful only while busy */
+        auto* done_check = module.addOperation(RtlOperation::And);
+        done_check->setOperand(0, finish);
+        done_check->setOperand(1, task.busy);
+        task.done->setExclDriver(done_check);
+
+        if (!instr.getType()->isVoidTy()) {
+            auto* ret_val =
+                module.addWire(instance_name + "_return_val", RtlWidth(instr.getType()));
+
+            task.instance->connectOutput("return_val", ret_val);
+
+            auto& producer = producers[&instr];
+            producer.name = instance_name;
+            producer.data = ret_val;
+            producer.push = task.done;
+        }
+
+        tasks.push_back(task);
+    }
+}
+
+void rtl::DataflowGenerator::connectTasks() {
+    for (auto& task : tasks) {
+        auto* callee = task.call->getCalledFunction();
+
+        for (unsigned int i = 0; i < task.call->arg_size(); i++) {
+            auto* operand = task.call->getArgOperand(i);
+            auto port_name = utility::getVerilogName(callee->getArg(i));
+
+            if (auto* const_operand = dyn_cast<ConstantInt>(operand)) {
+                auto* constant =
+                    module.addConstant(
+                        std::to_string(const_operand->getZExtValue()),
+                        RtlWidth(operand->getType())
+                    );
+
+                task.instance->connectInput(port_name, constant);
+                continue;
+            }
+
+            assert(producers.count(operand) != 0);
+
+            auto* rd_data =
+                module.addWire(task.instance->getName() + "_" + port_name,
+                               RtlWidth(operand->getType()));
+
+            RtlSignal* empty = nullptr;
+
+            auto* fifo = addFifo(producers[operand], empty);
+
+            /* Operands are held until the task is done */
+            fifo->connectInput("rd_en", task.done);
+            fifo->connectOutput("rd_data", rd_data);
+
+            task.instance->connectInput(port_name, rd_data);
+            task.fifo_empty.push_back(empty);
+        }
+    }
+}
+
+void rtl::DataflowGenerator::addReturnStream() {
+    auto* ret_instr = dyn_cast<ReturnInst>(function.front().getTerminator());
+    assert(ret_instr != nullptr);
+
+    auto* ret_val = ret_instr->getReturnValue();
+
+    if (ret_val == nullptr) {
+        return;
+    }
+
+    assert(producers.count(ret_val) != 0);
+
+    RtlSignal* empty = nullptr;
+
+    auto* fifo = addFifo(producers[ret_val], empty);
+
+    auto* out_data = module.addOutputWire("return_val", RtlWidth(ret_val->getType()));
+    auto* out_valid = module.addOutput("return_val_valid");
+    auto* out_ready = module.addInputWire("return_val_ready");
+
+    out_valid->setExclDriver(addNotOperation(empty));
+
+    auto* pop = module.addOperation(RtlOperation::And);
+    pop->setOperand(0, out_valid);
+    pop->setOperand(1, out_ready);
+
+    fifo->connectInput("rd_en", pop);
+    fifo->connectOutput("rd_data", out_data);
+}
+
+void rtl::DataflowGenerator::generateHandshakes() {
+    /* Argument is accepted when every consumer FIFO has room */
+    for (auto& arg : function.args()) {
+        auto& producer = producers[&arg];
+
+        std::vector<RtlSignal*> terms;
+        for (auto* full : producer.fifo_full) {
+            terms.push_back(addNotOperation(full));
+        }
+
+        auto* ready = module.find(producer.name + "_ready");
+        ready->setExclDriver(addAndOperation(terms));
+
+        auto* valid = module.find(producer.name + "_valid");
+
+        auto* push = module.addOperation(RtlOperation::And);
+        push->setOperand(0, valid);
+        push->setOperand(1, ready);
+        producer.push->setExclDriver(push);
+    }
+
+    /* Task starts when its operands are available and its results have
+     * room, the room is reserved since only the task writes its FIFOs */
+    for (auto& task : tasks) {
+        std::vector<RtlSignal*> terms;
+        terms.push_back(addNotOperation(task.busy));
+
+        for (auto* empty : task.fifo_empty) {
+            terms.push_back(addNotOperation(empty));
+        }
+
+        if (producers.count(task.call) != 0) {
+            for (auto* full : producers[task.call].fifo_full) {
+                terms.push_back(addNotOperation(full));
+            }
+        }
+
+        task.start->setExclDriver(addAndOperation(terms));
+
+        task.busy->addCondition(addSignalCheckOperation(task.start, ONE), ONE);
+        task.busy->addCondition(addSignalCheckOperation(task.done, ONE), ZERO);
+        task.busy->addCondition(addSignalCheckOperation(module.find("reset"), ONE), ZERO);
+    }
+}
+
+rtl::RtlInstance* rtl::DataflowGenerator::addFifo(Producer& producer, RtlSignal*& empty) {
+    auto fifo_name = producer.name + "_fifo_" + std::to_string(producer.fifo_full.size());
+
+    unsigned int addr_width =
+        std::max(1U, static_cast<unsigned int>(std::ceil(std::log2(static_cast<double>(dataflow_fifo_depth)))));
+
+    auto* fifo = module.addInstance(RtlInstance::FIFO_PRIMITIVE, fifo_name, true);
+    fifo->setParam("WIDTH", std::to_string(producer.data->getWidth().getBitwidth()));
+    fifo->setParam("ADDR_WIDTH", std::to_string(addr_width));
+
+    auto* full = module.addWire(fifo_name + "_full");
+    empty = module.addWire(fifo_name + "_empty");
+
+    fifo->connectInput("clk", module.find("clk"));
+    fifo->connectInput("reset", module.find("reset"));
+    fifo->connectInput("wr_en", producer.push);
+    fifo->connectInput("wr_data", producer.data);
+    fifo->connectOutput("full", full);
+    fifo->connectOutput("empty", empty);
+
+    producer.fifo_full.push_back(full);
+
+    return fifo;
+}
+
+rtl::RtlSignal* rtl::DataflowGenerator::addAndOperation(std::vector<RtlSignal*>& terms) {
+    if (terms.empty()) {
+        return ONE;
+    }
+
+    RtlSignal* result = terms[0];
+
+    for (unsigned int i = 1; i < terms.size(); i++) {
+        auto* and_op = module.addOperation(RtlOperation::And);
+        and_op->setOperand(0, result);
+        and_op->setOperand(1, terms[i]);
+        result = and_op;
+    }
+
+    return result;
+}
+
+rtl::RtlOperation* rtl::DataflowGenerator::addNotOperation(RtlSignal* signal) {
+    auto* not_op = module.addOperation(RtlOperation::Not);
+    not_op->setOperand(0, signal);
+    return not_op;
+}
+
+rtl::RtlOperation* rtl::DataflowGenerator::addSignalCheckOperation(RtlSignal* signal, RtlSignal* value) {
+    auto* check = module.addOperation(RtlOperation::Eq);
+    check->setOperand(0, signal);
+    check->setOperand(1, value);
+    return check;
+}
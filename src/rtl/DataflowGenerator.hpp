@@ -0,0 +1,90 @@
+#ifndef __RTL_DATAFLOW_GENERATOR_HPP__
+#define __RTL_DATAFLOW_GENERATOR_HPP__
+
+#include <map>
+#include <vector>
+#include <string>
+
+#include <llvm/IR/Function.h>
+#include <llvm/IR/Instructions.h>
+
+#include "RtlModule.hpp"
+#include "RtlInstance.hpp"
+
+namespace llvm {
+    namespace bphls {
+        namespace rtl {
+
+/**
+ * Task-level (dataflow) architecture of a function made of calls only.
+ *
+ * Every call site becomes an instance of the callee module, every use of
+ * an argument or a call result becomes a FIFO. A task starts as soon as
+ * all its input FIFOs hold data and all its output FIFOs have room, so
+ * tasks of successive invocations overlap. Arguments and return value of
+ * the function are valid/ready streams.
+ */
+class DataflowGenerator {
+public:
+    DataflowGenerator(Function& function);
+
+    /** Single basic block of calls to synthesizable functions */
+    static bool isDataflowFunction(Function& function);
+
+    /** Distinct callees in call order */
+    static std::vector<Function*> getCallees(Function& function);
+
+    RtlModule& generate();
+
+private:
+    /** Stream source: function argument or task result */
+    struct Producer {
+        std::string name;
+        RtlSignal* data;
+        RtlSignal* push;
+        std::vector<RtlSignal*> fifo_full;
+    };
+
+    struct Task {
+        CallInst* call;
+        RtlInstance* instance;
+        RtlSignal* start;
+        RtlSignal* busy;
+        RtlSignal* done;
+        std::vector<RtlSignal*> fifo_empty;
+    };
+
+    Function& function;
+
+    RtlModule module;
+
+    std::map<Value*, Producer> producers;
+    std::vector<Task> tasks;
+
+    RtlConstant* ZERO;
+    RtlConstant* ONE;
+
+    void addArgumentStreams();
+
+    void addTasks();
+
+    void connectTasks();
+
+    void addReturnStream();
+
+    void generateHandshakes();
+
+    RtlInstance* addFifo(Producer& producer, RtlSignal*& empty);
+
+    RtlSignal* addAndOperation(std::vector<RtlSignal*>& terms);
+
+    RtlOperation* addNotOperation(RtlSignal* signal);
+
+    RtlOperation* addSignalCheckOperation(RtlSignal* signal, RtlSignal* value);
+};
+
+        } /* namespace rtl */
+    } /* namespace bphls */
+} /* namespace llvm */
+
+#endif /* __RTL_DATAFLOW_GENERATOR_HPP__ */
@@ -4,24 +4,30 @@
 
 #include "RtlSignal.hpp"
 #include "RtlOperation.hpp"
+#include "../utility/arena_utility.hpp"
 #include "NetList.hpp"
 
 using namespace llvm;
 using namespace bphls;
 
 rtl::NetList::Cell* rtl::NetList::newCell(std::string name) {
-    auto* cell = new Cell(name);
-    cells.insert(cell);
-    return cell;
+    return utility::createInArena(cell_allocator, name);
 }
 
 rtl::NetList::Cell* rtl::NetList::newCell(std::string name, RtlSignal* signal) {
-    auto* cell = new Cell(name, signal);
-    cells.insert(cell);
+    auto* cell = utility::createInArena(cell_allocator, name, signal);
     signal_cell_lookup[signal] = cell;
     return cell;  
 }
 
+rtl::NetList::Pin* rtl::NetList::newPin(Cell* cell, std::string name) {
+    return utility::createInArena(pin_allocator, cell, name);
+}
+
+rtl::NetList::Net* rtl::NetList::newNet() {
+    return utility::createInArena(net_allocator);
+}
+
 rtl::NetList::Cell* rtl::NetList::getSignalCell(RtlSignal* signal) {
     assert(signal_cell_lookup.count(signal) != 0);
     return signal_cell_lookup[signal];
@@ -31,7 +37,7 @@ rtl::NetList::Cell* rtl::NetList::addCell(RtlSignal* signal) {
     Cell* cell = nullptr;
     if (signal_cell_lookup.count(signal) != 0) {
         cell = newCell(signal->getName().value_or(std::string()));
-        cell->out_pins.push_back(new Pin(cell));
+        cell->out_pins.push_back(newPin(cell));
         signal_cell_lookup[signal] = cell;
         cell->signal = signal;
     } else {
@@ -45,7 +51,7 @@ void rtl::NetList::connectAtPin(RtlSignal* signal, RtlSignal* driver, Pin* pin)
     Cell *cell_signal = addCell(signal);
     Cell *cell_driver = addCell(driver);
 
-    Pin* in_pin = new Pin(cell_signal);
+    Pin* in_pin = newPin(cell_signal);
     cell_signal->in_pins.push_back(in_pin);
 
 
@@ -58,8 +64,7 @@ void rtl::NetList::connectAtPin(RtlSignal* signal, RtlSignal* driver, Pin* pin)
 
     /* output pin is already driving a net */
     if (out_pin->net != nullptr) {
-        out_pin->net = new Net();
-        nets.insert(out_pin->net);
+        out_pin->net = newNet();
         out_pin->net->driver = out_pin;
     }
 
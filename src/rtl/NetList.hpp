@@ -6,6 +6,8 @@
 #include <set>
 #include <map>
 
+#include <llvm/Support/Allocator.h>
+
 #include "RtlSignal.hpp"
 
 namespace llvm {
@@ -53,6 +55,10 @@ public:
 
     Cell* newCell(std::string name, RtlSignal* signal);
 
+    Pin* newPin(Cell* cell, std::string name = std::string());
+
+    Net* newNet();
+
     Cell* getSignalCell(RtlSignal* signal);
 
     Cell* addCell(RtlSignal* signal);
@@ -62,8 +68,10 @@ public:
     void propagateBackwards(RtlSignal* signal);
 
 private:
-    std::set<Net*> nets;
-    std::set<Cell*> cells;
+    /* Graph objects are owned by arenas and released with the net list */
+    SpecificBumpPtrAllocator<Net> net_allocator;
+    SpecificBumpPtrAllocator<Pin> pin_allocator;
+    SpecificBumpPtrAllocator<Cell> cell_allocator;
 
     std::map<RtlSignal*, NetList::Cell*> signal_cell_lookup;
 };
@@ -3,6 +3,7 @@
 
 #include <string>
 #include <map>
+#include <algorithm>
 
 #include <llvm/IR/Function.h>
 #include <llvm/IR/Instruction.h>
@@ -11,7 +12,6 @@
 
 #include "../utility/verilog_utility.hpp"
 #include "../utility/instruction_utility.hpp"
-#include "../scheduling/Scheduler.hpp"
 #include "../scheduling/fsm/Fsm.hpp"
 #include "../binding/Binding.hpp"
 #include "../binding/LifetimeAnalysis.hpp"
@@ -29,17 +29,17 @@ rtl::RtlGenerator::RtlGenerator(llvm::Function& function,
       fsm(fsm),
       lva(lva),
       binding(binding),
-      module(function.getName().str()) {}
+      module(function.getName().str()),
+      visit_state(nullptr),
+      visit_instr(nullptr) {}
 
 rtl::RtlModule& rtl::RtlGenerator::generate() {
     generateDeclaration();
 
-#ifdef BITPACK
-    performBitpackRegBinding();
-#endif
-
     addInstructionsSignals();
 
+    generatePipelineControl();
+
     connectRegistersToWires();
 
     performBinding();
@@ -48,6 +48,8 @@ rtl::RtlModule& rtl::RtlGenerator::generate() {
 
     generateDatapath();
 
+    generatePhiCopies();
+
 #ifdef REG_OPT
     shareOperationRegisters();
 #endif
@@ -116,7 +118,7 @@ void rtl::RtlGenerator::addDefaultPorts() {
 }
 
 void rtl::RtlGenerator::performBitpackRegBinding() {
-    binding::BitpackRegBinding bp_binding(function, fsm);
+    binding::BitpackRegBinding bp_binding(function, fsm, lva);
 
     bp_binding.bindRegisters();
 
@@ -169,6 +171,88 @@ void rtl::RtlGenerator::addInstructionsSignals() {
     }
 }
 
+void rtl::RtlGenerator::generatePipelineControl() {
+    for (auto& bb_pipeline : fsm.pipelines()) {
+        generatePipelineControl(bb_pipeline.second);
+    }
+}
+
+void rtl::RtlGenerator::generatePipelineControl(FsmPipeline& pipeline) {
+    auto name = utility::getPipelineVerilogName(pipeline.basic_block);
+    auto& valid_signals = stage_valid_signals[pipeline.basic_block];
+
+    auto* prologue_state = pipeline.prologue_state;
+    auto* last_state = pipeline.kernel_states.back();
+
+    for (unsigned int i = 0; i < pipeline.n_stages; i++) {
+        valid_signals.push_back(module.addReg(name + "_valid_" + std::to_string(i)));
+    }
+
+    /* Loop exit has been taken by one of the issued iterations */
+    auto* exit_reg = module.addReg(name + "_exit");
+    auto* issue_wire = module.addWire(name + "_issue");
+    auto* done_wire = module.addWire(name + "_done");
+
+    driveSignalInState(exit_reg, ZERO, prologue_state);
+    exit_reg->addCondition(addPipelineExitCheckOperation(pipeline), ONE, pipeline.branch);
+
+    /* Next iteration is issued until exit is known */
+    issue_wire->setDefaultDriver(ONE);
+    issue_wire->addCondition(addSignalCheckOperation(exit_reg, ONE), ZERO);
+    issue_wire->addCondition(addPipelineExitCheckOperation(pipeline), ZERO);
+
+    /* Exit is resolved now, iterations in the stages before the exit stage
+     * were issued after the exiting one */
+    const unsigned int exit_stage = pipeline.start_stage[pipeline.branch];
+    auto* exiting_wire = module.addWire(name + "_exiting");
+
+    exiting_wire->setDefaultDriver(ZERO);
+    exiting_wire->addCondition(addPipelineExitCheckOperation(pipeline), ONE);
+
+    /* Pipeline is drained when no stage is valid in the next kernel pass */
+    done_wire->setDefaultDriver(ONE);
+    done_wire->addCondition(addSignalCheckOperation(issue_wire, ONE), ZERO);
+
+    for (unsigned int i = 0; i + 1 < pipeline.n_stages; i++) {
+        RtlOperation* valid_condition = addSignalCheckOperation(valid_signals[i], ONE);
+
+        if (i < exit_stage) {
+            auto* kept_condition = module.addOperation(RtlOperation::And);
+            kept_condition->setOperand(0, valid_condition);
+            kept_condition->setOperand(1, addSignalCheckOperation(exiting_wire, ZERO));
+
+            valid_condition = kept_condition;
+        }
+
+        done_wire->addCondition(valid_condition, ZERO);
+    }
+
+    /* First iteration enters stage 0, stages shift on every kernel pass */
+    for (unsigned int i = 0; i < pipeline.n_stages; i++) {
+        driveSignalInState(valid_signals[i], (i == 0) ? ONE : ZERO, prologue_state);
+
+        driveSignalInState(
+            valid_signals[i],
+            (i == 0) ? issue_wire : valid_signals[i - 1],
+            last_state
+        );
+    }
+
+    /* Squashed iterations write no registers for the rest of the pass. On the
+     * last kernel state they are cleared while shifted */
+    auto* branch_state = fsm.getStartState(pipeline.branch);
+    const unsigned int squash_offset = (branch_state == last_state) ? 1 : 0;
+
+    for (unsigned int i = 0; i < exit_stage; i++) {
+        valid_signals[i + squash_offset]->addCondition(
+            addSignalCheckOperation(exiting_wire, ONE),
+            ZERO
+        );
+    }
+
+    last_state->setTransitionSignal(done_wire);
+}
+
 void rtl::RtlGenerator::connectRegistersToWires() {
     for (auto& basic_block : function) {
         for (auto& instr : basic_block) {
@@ -191,7 +275,11 @@ void rtl::RtlGenerator::connectRegistersToWires() {
 
                 assert(bp_reg_signal != nullptr);
 
-                RtlWidth bitfield_width(sub_reg.bitfield.first, sub_reg.bitfield.second, false);
+                /* Single bit registers are not indexed */
+                RtlWidth bitfield_width =
+                    (reg.width > 1)
+                        ? RtlWidth(sub_reg.bitfield.first, sub_reg.bitfield.second, false)
+                        : RtlWidth(reg.width);
 
                 driveSignalInState(
                     bp_reg_signal,
@@ -216,8 +304,6 @@ void rtl::RtlGenerator::connectRegistersToWires() {
 }
 
 void rtl::RtlGenerator::performBinding() {
-    binding.assignInstructions();
-    
     for (auto& bind_map : binding.iter_binding()) {
         fu_binding_map[bind_map.second].insert(bind_map.first); 
     }
@@ -236,15 +322,29 @@ void rtl::RtlGenerator::createBindingSignals() {
 
         RtlSignal* fu_operation = nullptr;
 
+        /* Shared unit is as wide as the widest of its narrowed operations */
+        unsigned int op0_width = 0;
+        unsigned int op1_width = 0;
+        unsigned int out_width = 0;
+
+        for (auto* fu_instr : fu_binding_map[fu_inst]) {
+            op0_width = std::max(op0_width, utility::getBitwidth(fu_instr->getOperand(0)));
+            out_width = std::max(out_width, utility::getBitwidth(fu_instr));
+
+            if (fu_instr->getNumOperands() > 1) {
+                op1_width = std::max(op1_width, utility::getBitwidth(fu_instr->getOperand(1)));
+            }
+        }
+
         auto* op0 =
-            module.addWire(fu_signal + "_op0", RtlWidth(instr->getOperand(0)));
+            module.addWire(fu_signal + "_op0", RtlWidth(op0_width));
         
-        if (instr->isBinaryOp()) {
+        if (instr->isBinaryOp() || isa<CmpInst>(instr)) {
             auto* op1 =
-                module.addWire(fu_signal + "_op1", RtlWidth(instr->getOperand(1)));
-            fu_operation = createFu(instr, op0, op1);
+                module.addWire(fu_signal + "_op1", RtlWidth(op1_width));
+            fu_operation = createFu(instr, op0, op1, RtlWidth(out_width));
         } else {
-            fu_operation = createFu(instr, op0, nullptr);
+            fu_operation = createFu(instr, op0, nullptr, RtlWidth(out_width));
         }
 
         auto* fu = module.addWire(fu_signal, fu_operation->getWidth());
@@ -270,11 +370,14 @@ void rtl::RtlGenerator::generateDatapath() {
 
         for (auto* instr : state->instructions()) {
             visit_state = state;
+            visit_instr = instr;
 
             visit(instr);
             // TODO Update usage estimation
         }
 
+        visit_instr = nullptr;
+
         generateStateTransition(transition_state, state);
     }
 
@@ -290,7 +393,7 @@ void rtl::RtlGenerator::shareOperationRegisters() {
         auto& fu_inst = fu_bind_set.first;
         auto& instructions = fu_bind_set.second;
 
-        std::map<Instruction*, std::set<Instruction*>> independant_instructions;
+        binding::IndependenceMatrix independant_instructions;
 
         binding.findIndependantInstructions(
             instructions,
@@ -301,6 +404,107 @@ void rtl::RtlGenerator::shareOperationRegisters() {
     }
 }
 
+void rtl::RtlGenerator::generatePhiCopies() {
+    /* Wait state enters the first basic block */
+    auto* wait_state = *fsm.states().begin();
+
+    generatePhiCopies(
+        wait_state,
+        nullptr,
+        &function.front(),
+        addSignalCheckOperation(module.find("start"), ONE)
+    );
+
+    for (auto* state : fsm.states()) {
+        auto* basic_block = state->getBasicBlock();
+
+        if ((state == wait_state) || !state->getTerminatingFlag() || (basic_block == nullptr)) {
+            continue;
+        }
+
+        /* Pipelined loop leaves from the last kernel state */
+        if (auto* pipeline = fsm.getPipeline(basic_block)) {
+            auto* exit_bb = pipeline->branch->getSuccessor(pipeline->exit_on_true ? 0 : 1);
+
+            generatePhiCopies(
+                state,
+                basic_block,
+                exit_bb,
+                addSignalCheckOperation(getTransitionOperand(state), ONE)
+            );
+
+            continue;
+        }
+
+        auto* branch = dyn_cast<BranchInst>(basic_block->getTerminator());
+
+        // TODO Switch PHI copies
+        if (branch == nullptr) {
+            continue;
+        }
+
+        if (branch->isConditional()) {
+            generatePhiCopies(
+                state,
+                basic_block,
+                branch->getSuccessor(0),
+                addSignalCheckOperation(getTransitionOperand(state), ONE)
+            );
+
+            generatePhiCopies(
+                state,
+                basic_block,
+                branch->getSuccessor(1),
+                addSignalCheckOperation(getTransitionOperand(state), ZERO)
+            );
+        } else {
+            generatePhiCopies(state, basic_block, branch->getSuccessor(0), nullptr);
+        }
+    }
+}
+
+void rtl::RtlGenerator::generatePhiCopies(FsmState* state,
+                                          BasicBlock* basic_block,
+                                          BasicBlock* successor,
+                                          RtlOperation* condition)
+{
+    /* Edge leads through bypassed basic blocks */
+    while (fsm.isBypassed(successor)) {
+        basic_block = successor;
+        successor = successor->getSingleSuccessor();
+    }
+
+    /* Pipelined loop prologue loads its PHI nodes */
+    if (fsm.getPipeline(successor) != nullptr) {
+        return;
+    }
+
+    for (auto& phi : successor->phis()) {
+        if (shouldIgnoreInstruction(phi)) {
+            continue;
+        }
+
+        auto* phi_reg = module.find(utility::getVerilogName(&phi) + "_reg");
+        assert(phi_reg != nullptr);
+
+        auto* copy_condition = addStateCheckOperation(state);
+
+        if (condition != nullptr) {
+            auto* edge_condition = module.addOperation(RtlOperation::And);
+            edge_condition->setOperand(0, copy_condition);
+            edge_condition->setOperand(1, condition);
+
+            copy_condition = edge_condition;
+        }
+
+        phi_reg->addCondition(
+            copy_condition,
+            getOperandSignal(state, phi.getIncomingValueForBlock(basic_block)),
+            &phi
+        );
+    }
+}
+
 void rtl::RtlGenerator::generateStateTransition(RtlSignal* condition, FsmState* state) {
     assert(state->getDefaultTransition() != nullptr);
 
@@ -308,7 +512,6 @@ void rtl::RtlGenerator::generateStateTransition(RtlSignal* condition, FsmState*
 
     /* Unconditional branch */
     if (state->getTransitionsNum() == 1) {
-        // TODO PHI Copie line 5608 GenerateRTL.cpp
         cur_state->addCondition(condition, state_signals[state->getDefaultTransition()]);
         return;
     }
@@ -323,7 +526,6 @@ void rtl::RtlGenerator::generateStateTransition(RtlSignal* condition, FsmState*
         true_condition->setOperand(0, condition);
         true_condition->setOperand(1, true_branch);
 
-        // TODO PHI Copie
         cur_state->addCondition(true_condition, state_signals[state->getTransitionState(0)]);
 
         auto* false_branch = module.addOperation(RtlOperation::Eq);
@@ -334,7 +536,6 @@ void rtl::RtlGenerator::generateStateTransition(RtlSignal* condition, FsmState*
         false_condition->setOperand(0, condition);
         false_condition->setOperand(1, false_branch);
 
-        // TODO PHI Copie
         cur_state->addCondition(false_condition, state_signals[state->getDefaultTransition()]);
     
         return;
@@ -364,9 +565,78 @@ void rtl::RtlGenerator::driveSignalInState(RtlSignal* signal,
     assert(state != nullptr);
 
     RtlOperation* condition = addStateCheckOperation(state);
+
+    /* Pipelined loop registers are written only by valid stages */
+    auto* pipeline = (instr != nullptr) ? fsm.getPipeline(instr->getParent()) : nullptr;
+
+    if ((pipeline != nullptr)
+            && signal->isRegister()
+            && !isa<PHINode>(instr)
+            && (state != pipeline->prologue_state))
+    {
+        condition = addStageValidCheckOperation(
+            condition,
+            instr->getParent(),
+            pipeline->end_stage[instr]
+        );
+    }
+
     signal->addCondition(condition, driver, instr, src_bits, dets_bits);
 }
 
+rtl::RtlOperation* rtl::RtlGenerator::addSignalCheckOperation(RtlSignal* signal, RtlSignal* value) {
+    auto* condition_signal = module.addOperation(RtlOperation::Eq);
+    condition_signal->setOperand(0, signal);
+    condition_signal->setOperand(1, value);
+
+    return condition_signal;
+}
+
+rtl::RtlOperation* rtl::RtlGenerator::addStageValidCheckOperation(RtlOperation* condition,
+                                                                  BasicBlock* basic_block,
+                                                                  unsigned int stage)
+{
+    assert(stage_valid_signals[basic_block].size() > stage);
+
+    auto* valid_condition = module.addOperation(RtlOperation::And);
+    valid_condition->setOperand(0, condition);
+    valid_condition->setOperand(
+        1,
+        addSignalCheckOperation(stage_valid_signals[basic_block][stage], ONE)
+    );
+
+    return valid_condition;
+}
+
+rtl::RtlOperation* rtl::RtlGenerator::addPipelineExitCheckOperation(FsmPipeline& pipeline) {
+    auto* branch = pipeline.branch;
+    auto* branch_state = fsm.getStartState(branch);
+
+    auto* prev_visit_instr = visit_instr;
+    visit_instr = branch;
+
+    auto* exit_condition = module.addOperation(RtlOperation::And);
+    exit_condition->setOperand(
+        0,
+        addStageValidCheckOperation(
+            addStateCheckOperation(branch_state),
+            branch->getParent(),
+            pipeline.start_stage[branch]
+        )
+    );
+    exit_condition->setOperand(
+        1,
+        addSignalCheckOperation(
+            getOperandSignal(branch_state, branch->getCondition()),
+            pipeline.exit_on_true ? ONE : ZERO
+        )
+    );
+
+    visit_instr = prev_visit_instr;
+
+    return exit_condition;
+}
+
 bool rtl::RtlGenerator::shouldIgnoreInstruction(Instruction& instr) {
     return
         instr.getType()->isVoidTy()
@@ -387,6 +657,83 @@ bool rtl::RtlGenerator::isUsedAcrossStates(Value* val, FsmState* state) {
     return false;
 }
 
+bool rtl::RtlGenerator::isProducedInVisitStage(Instruction* instr) {
+    auto* pipeline = fsm.getPipeline(instr->getParent());
+
+    if (pipeline == nullptr) {
+        return true;
+    }
+
+    /* Loop is left after the pass where the last iteration is in its last stage */
+    if ((visit_instr == nullptr) || (visit_instr->getParent() != instr->getParent())) {
+        return pipeline->end_stage[instr] + 1 == pipeline->n_stages;
+    }
+
+    /* Same kernel state of a later stage reads registered value */
+    return pipeline->end_stage[instr] == pipeline->start_stage[visit_instr];
+}
+
+unsigned int rtl::RtlGenerator::getPipelineCopyIndex(Instruction* instr) {
+    auto* pipeline = fsm.getPipeline(instr->getParent());
+
+    if ((pipeline == nullptr)
+            || (visit_instr == nullptr)
+            || (visit_instr->getParent() != instr->getParent()))
+    {
+        return 0;
+    }
+
+    const int ii = pipeline->ii;
+    const int read_time = pipeline->start_time[visit_instr];
+
+    /* Phi register is written by the previous iteration */
+    int write_time = 0;
+
+    if (auto* phi = dyn_cast<PHINode>(instr)) {
+        auto* back_instr = cast<Instruction>(phi->getIncomingValueForBlock(instr->getParent()));
+        write_time = pipeline->end_time[back_instr] - ii;
+    } else {
+        write_time = pipeline->end_time[instr];
+    }
+
+    /* Register keeps the value for II cycles, then every copy for II more */
+    if (read_time <= write_time + ii) {
+        return 0;
+    }
+
+    return (read_time - write_time - 1) / ii;
+}
+
+rtl::RtlSignal* rtl::RtlGenerator::getPipelineCopy(Instruction* instr, unsigned int copy_idx) {
+    auto name = utility::getVerilogName(instr) + "_reg";
+    auto* prev_copy = module.find(name);
+    assert(prev_copy != nullptr);
+
+    /* Copies shift when the register is written, on every kernel pass, so the
+     * copy of an iteration only depends on the cycles since its issue */
+    auto* shift_instr = instr;
+
+    if (auto* phi = dyn_cast<PHINode>(instr)) {
+        shift_instr = cast<Instruction>(phi->getIncomingValueForBlock(instr->getParent()));
+    }
+
+    auto* shift_state = fsm.getEndState(shift_instr);
+
+    for (unsigned int i = 1; i <= copy_idx; i++) {
+        auto copy_name = name + "_copy_" + std::to_string(i);
+        auto* copy = module.find(copy_name);
+
+        if (copy == nullptr) {
+            copy = module.addReg(copy_name, prev_copy->getWidth());
+            driveSignalInState(copy, prev_copy, shift_state);
+        }
+
+        prev_copy = copy;
+    }
+
+    return prev_copy;
+}
+
 bool rtl::RtlGenerator::isLiveAcrossStates(Value* val, FsmState* state) {
     if (isa<PHINode>(val)) {
         return true;
@@ -401,20 +748,43 @@ bool rtl::RtlGenerator::isLiveAcrossStates(Value* val, FsmState* state) {
     }
 }
 
-void rtl::RtlGenerator::shareRegistersForFu(std::set<Instruction*> instructions,
-                                            std::map<Instruction*, std::set<Instruction*>> independant_instructions)
+void rtl::RtlGenerator::shareRegistersForFu(std::set<Instruction*>& instructions,
+                                            binding::IndependenceMatrix& independant_instructions)
 {
-	std::map<Instruction*, std::set<Instruction*>> shared_reg_instr_map;
+	std::vector<std::pair<Instruction*, std::vector<Instruction*>>> shared_reg_instr_map;
+
+    /* Layout order, shared registers do not depend on allocation addresses */
+    auto& numbering = fsm.getNumbering();
+    std::vector<Instruction*> ordered_instructions(instructions.begin(), instructions.end());
 
+    std::sort(ordered_instructions.begin(), ordered_instructions.end(),
+              [&numbering](Instruction* instr_a, Instruction* instr_b) {
+                  return numbering.getId(instr_a) < numbering.getId(instr_b);
+              });
 	// loop over every instruction assigned to this functional unit
-	for (auto* instr : instructions) {
+	for (auto* instr : ordered_instructions) {
 		// if it is a store, the verilogName(*inst) couldn't get its reg name
 		if (isa<StoreInst>(instr) || isa<LoadInst>(instr)) {
 			continue;
 		}
 
+        /* Unused values have no registers */
+        if (shouldIgnoreInstruction(*instr)) {
+            continue;
+        }
+
+        /* Pipelined loop registers are overlapped by iterations */
+        if (fsm.getPipeline(instr->getParent()) != nullptr) {
+            continue;
+        }
+
+        /* Bit-packed values are fields of their packed registers already */
+        if (bp_reg_binding_map.count(instr) != 0) {
+            continue;
+        }
+
 		bool is_sharable = false;
-		for (auto shared_reg_instr_set : shared_reg_instr_map) {
+		for (auto& shared_reg_instr_set : shared_reg_instr_map) {
             auto* shared_reg_instr = shared_reg_instr_set.first;
 			auto& assigned_instr_set = shared_reg_instr_set.second;
 
@@ -422,7 +792,7 @@ void rtl::RtlGenerator::shareRegistersForFu(std::set<Instruction*> instructions,
 
 			bool independent = true;
 			for (auto* assigned_instr : assigned_instr_set) {
-				if (independant_instructions[assigned_instr].count(instr) == 0) {
+				if (!independant_instructions.areIndependant(assigned_instr, instr)) {
 					independent = false;
 				}
 			}
@@ -455,10 +825,17 @@ void rtl::RtlGenerator::shareRegistersForFu(std::set<Instruction*> instructions,
                     new_width = old_width;
                 }
 				
-                unsigned int reg_instr_size = shared_reg_instr->getType()->getPrimitiveSizeInBits();
+                /* Register holds the widest narrowed value bound to it */
+                unsigned int reg_instr_size = utility::getBitwidth(instr);
+
+                for (auto* assigned_instr : assigned_instr_set) {
+                    reg_instr_size = std::max(reg_instr_size, utility::getBitwidth(assigned_instr));
+                }
+
 				new_width = std::min(new_width, reg_instr_size);
 
 				shared_reg->setWidth(RtlWidth(new_width, is_signed));
+                shared_reg->extendDrivers();
 
                 // now make sure the shared register is active at the
                 // correct times
@@ -474,13 +851,13 @@ void rtl::RtlGenerator::shareRegistersForFu(std::set<Instruction*> instructions,
                 // shared register
                 old_reg->setType("wire");
 				old_reg->setExclDriver(shared_reg, instr);
-				shared_reg_instr_map[shared_reg_instr].insert(instr);
+				assigned_instr_set.push_back(instr);
 				break;
 			}
 		}
 
 		if (!is_sharable) {
-			shared_reg_instr_map[instr].insert(instr);
+			shared_reg_instr_map.push_back({ instr, { instr } });
 		}
 	}
 }
@@ -519,7 +896,20 @@ rtl::RtlSignal* rtl::RtlGenerator::getOperandSignal(FsmState* state, Value* op)
         auto* instr = dyn_cast<Instruction>(op);
 
         if (instr != nullptr) {
-            return module.find(reg); // FIXME Пока что всегда привязывается регистр
+            /* Chained operand is produced combinationally in the same state */
+            if (!isa<PHINode>(instr)
+                    && (fsm.getEndState(instr) == state)
+                    && isProducedInVisitStage(instr))
+            {
+                return module.find(wire);
+            }
+
+            /* Pipelined value read after next iterations overwrote its register */
+            if (auto copy_idx = getPipelineCopyIndex(instr)) {
+                return getPipelineCopy(instr, copy_idx);
+            }
+
+            return module.find(reg);
         }
 
         RtlSignal* signal = nullptr;
@@ -566,37 +956,34 @@ rtl::RtlSignal* rtl::RtlGenerator::getInstructionLhsSignal(Instruction* instr) {
     return instr_wire;
 }
 
-rtl::RtlSignal* rtl::RtlGenerator::createFu(Instruction* instr, RtlSignal* op_0, RtlSignal* op_1) {
+rtl::RtlSignal* rtl::RtlGenerator::createFu(Instruction* instr,
+                                            RtlSignal* op_0,
+                                            RtlSignal* op_1,
+                                            std::optional<RtlWidth> fu_width)
+{
     // FIXME Only add operation (or smthng)
 
     auto* fu_operation = module.addOperation(*instr);
     fu_operation->setOperand(0, op_0);
     fu_operation->setOperand(1, op_1);
 
-    RtlWidth out_width(instr);
+    RtlWidth out_width = fu_width.value_or(RtlWidth(instr));
     fu_operation->setWidth(out_width);
 
     RtlSignal* fu_output = fu_operation;
 
-    unsigned int latency = Scheduler::getInstructionCycles(*instr);
+    unsigned int latency = fsm.getInstructionCycles(instr);
     if (latency > 0) {
-        auto enable_wire_name = utility::getVerilogName(instr) + "_en";
-        auto* enable_wire = module.addWire(enable_wire_name);
-
-        auto* enable_condition = module.addOperation(RtlOperation::Eq);
-        enable_condition->setOperand(0, enable_wire);
-        enable_condition->setOperand(1, ONE);
-
-        /* Delay shift register */
+        /* Multicycle unit is pipelined, its result of the start state leaves
+         * the delay shift register in the end state */
         auto* prev_stage_reg = fu_output;
         for (unsigned int i = 0; i < latency; i++) {
             auto stage_reg_name =
                 utility::getVerilogName(instr) + "_stage" + std::to_string(i) + "_reg";
 
             auto* stage_reg = module.addReg(stage_reg_name, out_width);
-            auto* driver = prev_stage_reg;
 
-            stage_reg->addCondition(enable_condition, driver, instr);
+            stage_reg->setExclDriver(prev_stage_reg, instr);
             prev_stage_reg = stage_reg;
         }
 
@@ -618,7 +1005,7 @@ rtl::RtlSignal* rtl::RtlGenerator::createBindedFuUse(Instruction* instr, RtlSign
         instr
     );
 
-    if (instr->isBinaryOp()) {
+    if (instr->isBinaryOp() || isa<CmpInst>(instr)) {
         driveSignalInState(
             module.find(fu_signal + "_op1"),
             op_1,
@@ -658,7 +1045,44 @@ void rtl::RtlGenerator::visitBranchInst(BranchInst &I) {}
 
 void rtl::RtlGenerator::visitSwitchInst(SwitchInst &I) {}
 
-void rtl::RtlGenerator::visitPHINode(PHINode &I) {}
+void rtl::RtlGenerator::visitPHINode(PHINode &I) {
+    auto* basic_block = I.getParent();
+    auto* pipeline = fsm.getPipeline(basic_block);
+
+    /* PHI copies of non-pipelined basic blocks are done on transitions */
+    if ((pipeline == nullptr) || shouldIgnoreInstruction(I)) {
+        return;
+    }
+
+    auto* phi_reg = module.find(utility::getVerilogName(&I) + "_reg");
+    assert(phi_reg != nullptr);
+
+    /* Initial value is loaded by prologue state */
+    for (unsigned int i = 0; i < I.getNumIncomingValues(); i++) {
+        if (I.getIncomingBlock(i) != basic_block) {
+            driveSignalInState(
+                phi_reg,
+                getOperandSignal(pipeline->prologue_state, I.getIncomingValue(i)),
+                pipeline->prologue_state,
+                &I
+            );
+        }
+    }
+
+    /* Loop-carried value is latched by the valid stage producing it */
+    auto* back_instr = cast<Instruction>(I.getIncomingValueForBlock(basic_block));
+    auto* back_state = fsm.getEndState(back_instr);
+
+    phi_reg->addCondition(
+        addStageValidCheckOperation(
+            addStateCheckOperation(back_state),
+            basic_block,
+            pipeline->end_stage[back_instr]
+        ),
+        module.find(utility::getVerilogName(back_instr)),
+        &I
+    );
+}
 
 void rtl::RtlGenerator::visitBinaryOperator(Instruction &I) {
     auto* instr = &I;
@@ -683,19 +1107,11 @@ void rtl::RtlGenerator::visitBinaryOperator(Instruction &I) {
         fu = createFu(instr, op_0, op_1);
     }
 
-    // FIXME Что то хмурое с переподключением сигнала готовнисти FU: create_fu_enable_signals
-    unsigned int latency = Scheduler::getInstructionCycles(*instr);
+    /* Multicycle result is registered in the end state with the others */
+    unsigned int latency = fsm.getInstructionCycles(instr);
     if (latency > 0) {
         instr_wire->setExclDriver(fu);
         instr_wire->setWidth(fu->getWidth());
-
-        auto* instr_reg = module.find(utility::getVerilogName(instr) + "_reg");
-        driveSignalInState(
-            instr_reg,
-            instr_wire,
-            fsm.getEndState(instr),
-            instr
-        );
     } else {
         driveSignalInState(
             instr_wire,
@@ -723,20 +1139,12 @@ void rtl::RtlGenerator::visitUnaryOperator(UnaryInstruction &I) {
         fu = createFu(instr, op_0, nullptr);
     }
 
-    // FIXME Что то хмурое с переподключением сигнала готовнисти FU: create_fu_enable_signals
-    unsigned int latency = Scheduler::getInstructionCycles(*instr);
+    /* Result is registered in the end state with the others */
+    unsigned int latency = fsm.getInstructionCycles(instr);
     assert(latency > 0);
 
     instr_wire->setExclDriver(fu);
     instr_wire->setWidth(fu->getWidth());
-
-    auto* instr_reg = module.find(utility::getVerilogName(instr) + "_reg");
-    driveSignalInState(
-        instr_reg,
-        instr_wire,
-        fsm.getEndState(instr),
-        instr
-    );
 }
 
 void rtl::RtlGenerator::visitICmpInst(ICmpInst &I) {
@@ -765,8 +1173,10 @@ void rtl::RtlGenerator::visitCastInst(CastInst &I) {
         );
     } else if (isa<BitCastInst>(instr)
                     || isa<PtrToIntInst>(instr)
-                    || isa<IntToPtrInst>(instr))
+                    || isa<IntToPtrInst>(instr)
+                    || isa<TruncInst>(instr))
     {
+        /* Narrower wire of a truncation keeps the low bits */
         driveSignalInState(
             instr_wire,
             op_0,
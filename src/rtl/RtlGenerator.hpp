@@ -26,8 +26,11 @@ public:
                  binding::LifetimeAnalysis& lva,
                  binding::Binding& binding);
 
+    /** Binding must be assigned and bitpack registers bound beforehand */
     RtlModule& generate();
 
+    void performBitpackRegBinding();
+
 /* VISITING FUNCTIONS BEGIN --------------------------------------------------*/
 
     void visitReturnInst        (ReturnInst &I);
@@ -61,9 +64,15 @@ private:
     RtlModule module;
 
     FsmState* visit_state;
+    Instruction* visit_instr;
     std::set<Instruction*> visited_instr;
 
-    std::map<binding::Binding::FuInstId, std::set<Instruction*>> fu_binding_map;
+    /* Stage-valid registers of pipelined loops */
+    std::map<BasicBlock*, std::vector<RtlSignal*>> stage_valid_signals;
+
+    std::map<binding::Binding::FuInstId,
+             std::set<Instruction*>,
+             binding::Binding::FuInstLess> fu_binding_map;
 
     std::vector<binding::BitpackRegBinding::Reg> bp_regs;
     std::map<Value*, binding::BitpackRegBinding::RegBitfield> bp_reg_binding_map;
@@ -79,10 +88,12 @@ private:
 
     void addDefaultPorts();
 
-    void performBitpackRegBinding();
-
     void addInstructionsSignals();
 
+    void generatePipelineControl();
+
+    void generatePipelineControl(FsmPipeline& pipeline);
+
     void connectRegistersToWires();
 
     void performBinding();
@@ -93,6 +104,13 @@ private:
 
     void shareOperationRegisters();
 
+    void generatePhiCopies();
+
+    void generatePhiCopies(FsmState* state,
+                           BasicBlock* basic_block,
+                           BasicBlock* successor,
+                           RtlOperation* condition);
+
     void generateStateTransition(RtlSignal* cond, FsmState* state);
 
     void driveSignalInState(RtlSignal* signal,
@@ -106,10 +124,13 @@ private:
 
     bool isLiveAcrossStates(Value* val, FsmState* state);
 
-    void shareRegistersForFu(std::set<Instruction*> instructions,
-                             std::map<Instruction*, std::set<Instruction*>> independant_instructions);
+    void shareRegistersForFu(std::set<Instruction*>& instructions,
+                             binding::IndependenceMatrix& independant_instructions);
 
-    RtlSignal* createFu(Instruction* instr, RtlSignal* op_0, RtlSignal* op_1);
+    RtlSignal* createFu(Instruction* instr,
+                        RtlSignal* op_0,
+                        RtlSignal* op_1,
+                        std::optional<RtlWidth> out_width = std::nullopt);
 
     RtlSignal* createBindedFuUse(Instruction* instr, RtlSignal* op_0, RtlSignal* op_1);
 
@@ -121,6 +142,22 @@ private:
 
     RtlOperation* addStateCheckOperation(FsmState* state);
 
+    RtlOperation* addSignalCheckOperation(RtlSignal* signal, RtlSignal* value);
+
+    RtlOperation* addStageValidCheckOperation(RtlOperation* condition,
+                                              BasicBlock* basic_block,
+                                              unsigned int stage);
+
+    RtlOperation* addPipelineExitCheckOperation(FsmPipeline& pipeline);
+
+    bool isProducedInVisitStage(Instruction* instr);
+
+    /** Stage copy of a pipelined value read by the visited instruction,
+     *  0 is the value register itself */
+    unsigned int getPipelineCopyIndex(Instruction* instr);
+
+    RtlSignal* getPipelineCopy(Instruction* instr, unsigned int copy_idx);
+
     bool shouldIgnoreInstruction(Instruction& instr);
 };
 
@@ -0,0 +1,26 @@
+#include <string>
+
+#include "RtlSignal.hpp"
+#include "RtlInstance.hpp"
+
+using namespace llvm;
+using namespace bphls;
+
+rtl::RtlInstance::RtlInstance(std::string module_name, std::string name, bool is_primitive)
+    : module_name(module_name),
+      name(name),
+      is_primitive(is_primitive) {}
+
+void rtl::RtlInstance::setParam(std::string param, std::string value) {
+    params.emplace_back(param, value);
+}
+
+void rtl::RtlInstance::connectInput(std::string port, RtlSignal* signal) {
+    assert(signal != nullptr);
+    connections.emplace_back(port, signal, false);
+}
+
+void rtl::RtlInstance::connectOutput(std::string port, RtlSignal* signal) {
+    assert(signal != nullptr);
+    connections.emplace_back(port, signal, true);
+}
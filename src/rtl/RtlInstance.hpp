@@ -0,0 +1,76 @@
+#ifndef __RTL_RTL_INSTANCE_HPP__
+#define __RTL_RTL_INSTANCE_HPP__
+
+#include <string>
+#include <vector>
+#include <utility>
+
+#include <llvm/ADT/iterator_range.h>
+
+#include "RtlSignal.hpp"
+
+namespace llvm {
+    namespace bphls {
+        namespace rtl {
+
+/**
+ * Instance of a nested module. Ports are connected by name, the instanced
+ * module is either another synthesized module or a library primitive
+ * (e.g. FIFO) whose definition is emitted by the Verilog writer.
+ */
+class RtlInstance {
+public:
+    struct Connection {
+        std::string port;
+        RtlSignal* signal;
+        bool is_output;
+
+        Connection(std::string port, RtlSignal* signal, bool is_output)
+            : port(port),
+              signal(signal),
+              is_output(is_output) {}
+    };
+
+    /** Library FIFO: clk, reset, wr_en, wr_data, full, rd_en, rd_data, empty */
+    static inline const std::string FIFO_PRIMITIVE = "bphls_fifo";
+
+    RtlInstance(std::string module_name, std::string name, bool is_primitive = false);
+
+    void setParam(std::string param, std::string value);
+
+    void connectInput(std::string port, RtlSignal* signal);
+
+    void connectOutput(std::string port, RtlSignal* signal);
+
+    std::string getModuleName() { return module_name; }
+
+    std::string getName() { return name; }
+
+    bool isPrimitive() { return is_primitive; }
+
+    typedef std::vector<std::pair<std::string, std::string>>::iterator ParamIterator;
+
+    iterator_range<ParamIterator> iter_params() {
+        return make_range(params.begin(), params.end());
+    }
+
+    typedef std::vector<Connection>::iterator ConnectionIterator;
+
+    iterator_range<ConnectionIterator> iter_connections() {
+        return make_range(connections.begin(), connections.end());
+    }
+
+private:
+    std::string module_name;
+    std::string name;
+    bool is_primitive;
+
+    std::vector<std::pair<std::string, std::string>> params;
+    std::vector<Connection> connections;
+};
+
+        } /* namespace rtl */
+    } /* namespace bphls */
+} /* namespace llvm */
+
+#endif /* __RTL_RTL_INSTANCE_HPP__ */
@@ -3,6 +3,8 @@
 #include <set>
 #include <queue>
 
+#include "../utility/arena_utility.hpp"
+#include "../utility/PhaseProfile.hpp"
 #include "NetList.hpp"
 #include "RtlModule.hpp"
 
@@ -20,15 +22,28 @@ rtl::NetList& rtl::RtlModule::buildNetList() {
 
         if (isSignalInput(port)) {
             input_cells.push_back(cell);
-            cell->out_pins.push_back(new NetList::Pin(cell, "input"));
+            cell->out_pins.push_back(net_list.newPin(cell, "input"));
         } else {
             assert(isSignalOutput(port));
             output_cells.push_back(cell);
-            cell->out_pins.push_back(new NetList::Pin(cell, "output"));
+            cell->out_pins.push_back(net_list.newPin(cell, "output"));
         }
     }
 
-    /* TODO Create cells for nested moduule instances */
+    /* Create cell for each nested module instance */
+    for (auto* instance : iter_instances()) {
+        auto* cell = net_list.newCell(instance->getName());
+
+        for (auto& connection : instance->iter_connections()) {
+            auto* pin = net_list.newPin(cell, connection.port);
+
+            if (connection.is_output) {
+                cell->out_pins.push_back(pin);
+            } else {
+                cell->in_pins.push_back(pin);
+            }
+        }
+    }
 
     /* Propagate port signals */
     for (auto* port : iter_ports()) {
@@ -81,8 +96,8 @@ void rtl::RtlModule::removeUnconnectedSignals() {
         auto* cell = net_list.getSignalCell(*signal_iter);
         assert(cell != nullptr);
 
+        /* Unconnected signal is released with the module arena */
         if (marked.count(cell) == 0) {
-            delete *signal_iter;
             signal_iter = signals.erase(signal_iter);
         } else {
             signal_iter++;
@@ -123,20 +138,33 @@ bool rtl::RtlModule::exists(std::string signal) {
 }
 
 rtl::RtlSignal* rtl::RtlModule::addInputWire(std::string name, RtlWidth width) {
-    auto* in_wire = new RtlSignal(name, std::nullopt, "input wire", width);
+    auto* in_wire =
+        utility::createInArena(signal_allocator, name, std::nullopt, "input wire", width);
     ports.push_back(in_wire);
+    utility::PhaseProfile::count("rtl.signals");
     return in_wire;
 }
 
 rtl::RtlSignal* rtl::RtlModule::addOutputWire(std::string name, RtlWidth width) {
-    auto* out_wire = new RtlSignal(name, std::nullopt, "output wire", width);
+    auto* out_wire =
+        utility::createInArena(signal_allocator, name, std::nullopt, "output wire", width);
     ports.push_back(out_wire);
+    utility::PhaseProfile::count("rtl.signals");
     return out_wire;
 }
 
+rtl::RtlSignal* rtl::RtlModule::addOutput(std::string name, RtlWidth width) {
+    auto* out = utility::createInArena(signal_allocator, name, std::nullopt, "output", width);
+    ports.push_back(out);
+    utility::PhaseProfile::count("rtl.signals");
+    return out;
+}
+
 rtl::RtlSignal* rtl::RtlModule::addOutputReg(std::string name, RtlWidth width) {
-    auto* out_reg = new RtlSignal(name, std::nullopt, "output reg", width);
+    auto* out_reg =
+        utility::createInArena(signal_allocator, name, std::nullopt, "output reg", width);
     ports.push_back(out_reg);
+    utility::PhaseProfile::count("rtl.signals");
     return out_reg;
 }
 
@@ -146,8 +174,9 @@ rtl::RtlSignal* rtl::RtlModule::addWire(std::string name, RtlWidth width) {
     if (wire != nullptr) {
         wire->setWidth(width);
     } else {
-        wire = new RtlSignal(name, std::nullopt, "wire", width);
+        wire = utility::createInArena(signal_allocator, name, std::nullopt, "wire", width);
         signals.push_back(wire);
+        utility::PhaseProfile::count("rtl.signals");
     }
 
     return wire;
@@ -159,37 +188,51 @@ rtl::RtlSignal* rtl::RtlModule::addReg(std::string name, RtlWidth width) {
     if (reg != nullptr) {
         reg->setWidth(width);
     } else {
-        reg = new RtlSignal(name, std::nullopt, "reg", width);
+        reg = utility::createInArena(signal_allocator, name, std::nullopt, "reg", width);
         signals.push_back(reg);
+        utility::PhaseProfile::count("rtl.signals");
     }
 
     return reg;
 }
 
 rtl::RtlSignal* rtl::RtlModule::addParam(std::string name, std::string value){
-    auto* param = new RtlSignal(name, value, "parameter");
+    auto* param = utility::createInArena(signal_allocator, name, value, "parameter");
     params.push_back(param);
+    utility::PhaseProfile::count("rtl.signals");
     return param;
 }
 
 rtl::RtlConstant* rtl::RtlModule::addConstant(std::string value, RtlWidth width){
-    auto* constant = new RtlConstant(value, width);
-    constants.insert(constant);
+    auto* constant = utility::createInArena(constant_allocator, value, width);
+    constants.push_back(constant);
+    utility::PhaseProfile::count("rtl.constants");
     return constant;
 }
 
 rtl::RtlOperation* rtl::RtlModule::addOperation(RtlOperation::Opcode opcode) {
-    auto* operation = new RtlOperation(opcode);
-    operations.insert(operation);
+    auto* operation = utility::createInArena(operation_allocator, opcode);
+    operations.push_back(operation);
+    utility::PhaseProfile::count("rtl.operations");
     return operation;
 }
 
 rtl::RtlOperation* rtl::RtlModule::addOperation(Instruction& instr) {
-    auto* operation = new RtlOperation(&instr);
-    operations.insert(operation);
+    auto* operation = utility::createInArena(operation_allocator, &instr);
+    operations.push_back(operation);
+    utility::PhaseProfile::count("rtl.operations");
     return operation;
 }
 
+rtl::RtlInstance* rtl::RtlModule::addInstance(std::string module_name,
+                                              std::string name,
+                                              bool is_primitive)
+{
+    auto* instance = utility::createInArena(instance_allocator, module_name, name, is_primitive);
+    instances.push_back(instance);
+    return instance;
+}
+
 bool rtl::RtlModule::isSignalInput(RtlSignal* signal) {
     if (signal == nullptr) {
         return false;
@@ -285,4 +328,10 @@ void rtl::RtlModule::printSignals() {
         std::cout << "\t" << opcode_name
             << " Operands Num: " << operation->getOperandsNum() << std::endl;
     }
+
+    std::cout << "\nInstances: " << std::endl;
+    for (auto* instance : instances) {
+        std::cout << "\t" << instance->getModuleName()
+            << " " << instance->getName() << std::endl;
+    }
 }
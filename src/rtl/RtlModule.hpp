@@ -6,11 +6,13 @@
 #include <set>
 
 #include <llvm/ADT/iterator_range.h>
+#include <llvm/Support/Allocator.h>
 
 #include "RtlWidth.hpp"
 #include "RtlSignal.hpp"
 #include "RtlConstant.hpp"
 #include "RtlOperation.hpp"
+#include "RtlInstance.hpp"
 #include "NetList.hpp"
 
 namespace llvm {
@@ -33,6 +35,9 @@ public:
 
     RtlSignal* addOutputWire(std::string name, RtlWidth width = RtlWidth());
 
+    /** Combinational output, driven in an always block */
+    RtlSignal* addOutput(std::string name, RtlWidth width = RtlWidth());
+
     RtlSignal* addOutputReg(std::string name, RtlWidth width = RtlWidth());
 
     RtlSignal* addWire(std::string name, RtlWidth width = RtlWidth());
@@ -47,6 +52,10 @@ public:
 
     RtlOperation* addOperation(Instruction& instr);
 
+    RtlInstance* addInstance(std::string module_name,
+                             std::string name,
+                             bool is_primitive = false);
+
     bool isSignalInput(RtlSignal* signal);
 
     bool isSignalOutput(RtlSignal* signal);
@@ -69,14 +78,27 @@ public:
         return make_range(signals.begin(), signals.end());
     }
 
+    typedef std::vector<RtlInstance*>::iterator RtlInstanceIterator;
+
+    iterator_range<RtlInstanceIterator> iter_instances() {
+        return make_range(instances.begin(), instances.end());
+    }
+
 private:
     std::string name;
 
+    /* Module objects are owned by arenas and released with the module */
+    SpecificBumpPtrAllocator<RtlSignal> signal_allocator;
+    SpecificBumpPtrAllocator<RtlConstant> constant_allocator;
+    SpecificBumpPtrAllocator<RtlOperation> operation_allocator;
+    SpecificBumpPtrAllocator<RtlInstance> instance_allocator;
+
     std::vector<RtlSignal*> params;
     std::vector<RtlSignal*> ports;
     std::vector<RtlSignal*> signals;
-    std::set<RtlConstant*> constants;
-    std::set<RtlOperation*> operations;
+    std::vector<RtlConstant*> constants;
+    std::vector<RtlOperation*> operations;
+    std::vector<RtlInstance*> instances;
 
     NetList net_list;
     std::vector<NetList::Cell*> input_cells;
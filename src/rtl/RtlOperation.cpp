@@ -104,7 +104,7 @@ unsigned int rtl::RtlOperation::getOperandsNum() {
 }
 
 void rtl::RtlOperation::setCastWidth(RtlWidth cast_width) {
-    cast_width = true;
+    this->cast_width = true;
     setWidth(cast_width);
 }
 
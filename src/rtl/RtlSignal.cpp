@@ -20,7 +20,7 @@ rtl::RtlSignal::RtlSignal::RtlSignalDriver::RtlSignalDriver(RtlSignal* driver, R
       dest_bits(dest_bits) {}
 
 rtl::RtlSignal::RtlSignal()
-    : default_driver(nullptr) {}
+    : default_driver(std::nullopt) {}
 
 rtl::RtlSignal::RtlSignal(std::optional<std::string> name,
                           std::optional<std::string> value,
@@ -30,7 +30,7 @@ rtl::RtlSignal::RtlSignal(std::optional<std::string> name,
       type(type),
       value(value),
       bitwidth(bitwidth),
-      default_driver(nullptr) {}
+      default_driver(std::nullopt) {}
 
 bool rtl::RtlSignal::isRegister() {
     bool is_register =
@@ -48,6 +48,17 @@ rtl::RtlWidth rtl::RtlSignal::getWidth() {
     return bitwidth;
 }
 
+void rtl::RtlSignal::extendDrivers() {
+    /* Narrower sources are zero-extended to the signal width */
+    for (auto& driver : drivers) {
+        driver.dest_bits = bitwidth;
+    }
+
+    if (default_driver.has_value()) {
+        default_driver->dest_bits = bitwidth;
+    }
+}
+
 void rtl::RtlSignal::setName(std::string name) {
     this->name = name;
 }
@@ -82,7 +93,7 @@ void rtl::RtlSignal::setDriver(unsigned int i,
 }
 
 rtl::RtlSignal::RtlSignalDriver* rtl::RtlSignal::getDriver(unsigned int i) {
-    return drivers.at(i);
+    return &drivers.at(i);
 }
 
 void rtl::RtlSignal::setExclDriver(RtlSignal* driver,
@@ -90,13 +101,6 @@ void rtl::RtlSignal::setExclDriver(RtlSignal* driver,
                                    std::optional<RtlWidth> src_bits,
                                    std::optional<RtlWidth> dets_bits)
 {
-    for (auto* driver : drivers) {
-        if (driver != nullptr) {
-            delete driver;
-            driver = nullptr;
-        }
-    }
-
     drivers.clear();
     conditions.clear();
     instructions.clear();
@@ -105,12 +109,11 @@ void rtl::RtlSignal::setExclDriver(RtlSignal* driver,
 
     auto dest_bits_actual = dets_bits.value_or(this->getWidth());
 
-    auto* rtl_driver =
-        src_bits.has_value()
-            ? new RtlSignalDriver(driver, dest_bits_actual, src_bits.value())
-            : new RtlSignalDriver(driver, dest_bits_actual);
-
-    drivers.push_back(rtl_driver);
+    if (src_bits.has_value()) {
+        drivers.emplace_back(driver, dest_bits_actual, src_bits.value());
+    } else {
+        drivers.emplace_back(driver, dest_bits_actual);
+    }
 }
 
 void rtl::RtlSignal::setDefaultDriver(RtlSignal* driver,
@@ -118,18 +121,18 @@ void rtl::RtlSignal::setDefaultDriver(RtlSignal* driver,
                                       std::optional<RtlWidth> dets_bits)
 {
     assert(driver != nullptr);
-    delete default_driver;
 
     auto dest_bits_actual = dets_bits.value_or(this->getWidth());
 
-    default_driver =
-        src_bits.has_value()
-            ? new RtlSignalDriver(driver, dest_bits_actual, src_bits.value())
-            : new RtlSignalDriver(driver, dest_bits_actual);
+    if (src_bits.has_value()) {
+        default_driver.emplace(driver, dest_bits_actual, src_bits.value());
+    } else {
+        default_driver.emplace(driver, dest_bits_actual);
+    }
 }
 
 rtl::RtlSignal::RtlSignalDriver* rtl::RtlSignal::getDefaultDriver() {
-    return default_driver;
+    return default_driver.has_value() ? &default_driver.value() : nullptr;
 }
 
 void rtl::RtlSignal::addCondition(RtlSignal* cond,
@@ -142,12 +145,12 @@ void rtl::RtlSignal::addCondition(RtlSignal* cond,
 
     auto dest_bits_actual = dets_bits.value_or(this->getWidth());
 
-    auto* rtl_driver =
-        src_bits.has_value()
-            ? new RtlSignalDriver(driver, dest_bits_actual, src_bits.value())
-            : new RtlSignalDriver(driver, dest_bits_actual);
+    if (src_bits.has_value()) {
+        drivers.emplace_back(driver, dest_bits_actual, src_bits.value());
+    } else {
+        drivers.emplace_back(driver, dest_bits_actual);
+    }
 
-    drivers.push_back(rtl_driver);
     instructions.push_back(instr);
 }
 
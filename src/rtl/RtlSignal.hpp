@@ -57,6 +57,9 @@ public:
 
     RtlWidth getWidth();
 
+    /** Drivers write the whole signal again, e.g. after it is widened */
+    void extendDrivers();
+
     void setDriver(unsigned int i,
                    RtlSignal* driver,
                    Instruction* instr = nullptr,
@@ -95,10 +98,11 @@ private:
 
     RtlWidth bitwidth;
 
-    RtlSignalDriver* default_driver;
+    /* Drivers are small and stored in place, no allocation per driver */
+    std::optional<RtlSignalDriver> default_driver;
 
     std::vector<RtlSignal*> conditions;
-    std::vector<RtlSignalDriver*> drivers;
+    std::vector<RtlSignalDriver> drivers;
     std::vector<Instruction*> instructions;
 };
 
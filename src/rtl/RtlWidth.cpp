@@ -3,6 +3,7 @@
 #include <llvm/IR/Type.h>
 #include <llvm/IR/Value.h>
 
+#include "../utility/instruction_utility.hpp"
 #include "RtlWidth.hpp"
 
 using namespace llvm;
@@ -18,7 +19,7 @@ rtl::RtlWidth::RtlWidth(Type* type, bool is_signed)
       is_signed(is_signed)
 {
     assert(!isa<PointerType>(type));
-    unsigned char primitive_width = type->getPrimitiveSizeInBits();
+    unsigned int primitive_width = type->getPrimitiveSizeInBits();
 
     if (primitive_width > 1) {
         msb_idx = primitive_width - 1;
@@ -31,10 +32,8 @@ rtl::RtlWidth::RtlWidth(Value* val, bool is_signed)
     : lsb_idx(0),
       is_signed(is_signed)
 {
-    auto* type = val->getType();
-
-    assert(!isa<PointerType>(type));
-    unsigned char primitive_width = type->getPrimitiveSizeInBits();
+    assert(!isa<PointerType>(val->getType()));
+    unsigned int primitive_width = utility::getBitwidth(val);
 
     if (primitive_width > 1) {
         msb_idx = primitive_width - 1;
@@ -43,10 +42,12 @@ rtl::RtlWidth::RtlWidth(Value* val, bool is_signed)
     }
 }
 
-rtl::RtlWidth::RtlWidth(unsigned char width, bool is_signed)
+rtl::RtlWidth::RtlWidth(unsigned int width, bool is_signed)
     : lsb_idx(0),
       is_signed(is_signed)
 {
+    assert(width != 0);
+
     if (width == 1) {
         msb_idx = std::nullopt;
     } else {
@@ -54,20 +55,23 @@ rtl::RtlWidth::RtlWidth(unsigned char width, bool is_signed)
     }
 }
 
-rtl::RtlWidth::RtlWidth(unsigned char msb_idx, unsigned char lsb_idx, bool is_signed)
+rtl::RtlWidth::RtlWidth(unsigned int msb_idx, unsigned int lsb_idx, bool is_signed)
     : msb_idx(msb_idx),
       lsb_idx(lsb_idx),
-      is_signed(is_signed) {}
+      is_signed(is_signed)
+{
+    assert(msb_idx >= lsb_idx);
+}
 
-unsigned char rtl::RtlWidth::getBitwidth() {
+unsigned int rtl::RtlWidth::getBitwidth() {
     return msb_idx.value_or(0) + 1;
 }
 
-std::optional<unsigned char> rtl::RtlWidth::getMsbIndex() {
+std::optional<unsigned int> rtl::RtlWidth::getMsbIndex() {
     return msb_idx;
 }
 
-std::optional<unsigned char> rtl::RtlWidth::getLsbIndex() {
+std::optional<unsigned int> rtl::RtlWidth::getLsbIndex() {
     return lsb_idx;
 }
 
@@ -18,21 +18,21 @@ public:
 
     RtlWidth(Value* val, bool is_signed = false);
 
-    RtlWidth(unsigned char msb_idx, unsigned char lsb_idx, bool is_signed = false);
+    RtlWidth(unsigned int msb_idx, unsigned int lsb_idx, bool is_signed = false);
 
-    RtlWidth(unsigned char width, bool is_signed = false);
+    RtlWidth(unsigned int width, bool is_signed = false);
 
-    unsigned char getBitwidth();
+    unsigned int getBitwidth();
 
-    std::optional<unsigned char> getMsbIndex();
+    std::optional<unsigned int> getMsbIndex();
 
-    std::optional<unsigned char> getLsbIndex();
+    std::optional<unsigned int> getLsbIndex();
 
     bool isSigned();
 
 private:
-    std::optional<unsigned char> msb_idx;
-    std::optional<unsigned char> lsb_idx;
+    std::optional<unsigned int> msb_idx;
+    std::optional<unsigned int> lsb_idx;
     bool is_signed;
 };
 
@@ -0,0 +1,174 @@
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <llvm/ADT/DenseMap.h>
+
+#include "RtlOperation.hpp"
+#include "SignalLevelization.hpp"
+
+using namespace llvm;
+using namespace bphls;
+
+void rtl::SignalLevelization::collectReadSignals(RtlSignal* signal,
+                                                 std::vector<RtlSignal*>& read_signals)
+{
+    if (signal == nullptr) {
+        return;
+    }
+
+    if (!signal->isOperation()) {
+        read_signals.push_back(signal);
+        return;
+    }
+
+    auto* operation = static_cast<RtlOperation*>(signal);
+
+    for (unsigned int i = 0; i < operation->getOperandsNum(); i++) {
+        collectReadSignals(operation->getOperand(i), read_signals);
+    }
+}
+
+void rtl::SignalLevelization::run() {
+    comb_groups.clear();
+    registers.clear();
+
+    std::vector<RtlSignal*> comb_signals;
+    DenseMap<RtlSignal*, unsigned int> comb_ids;
+
+    auto add_signal = [&](RtlSignal* signal) {
+        /* Signals without drivers keep their initial value */
+        if (signal->getDriversNum() == 0) {
+            return;
+        }
+
+        if (signal->isRegister()) {
+            registers.push_back(signal);
+        } else {
+            comb_ids[signal] = comb_signals.size();
+            comb_signals.push_back(signal);
+        }
+    };
+
+    for (auto* signal : rtl_module.iter_signals()) {
+        add_signal(signal);
+    }
+
+    for (auto* port : rtl_module.iter_ports()) {
+        if (!rtl_module.isSignalInput(port)) {
+            add_signal(port);
+        }
+    }
+
+    /* Edges lead from a signal to the combinational signals it reads */
+    std::vector<std::vector<unsigned int>> comb_reads(comb_signals.size());
+    std::vector<RtlSignal*> read_signals;
+
+    for (unsigned int id = 0; id < comb_signals.size(); id++) {
+        auto* signal = comb_signals[id];
+
+        read_signals.clear();
+
+        if (auto* default_driver = signal->getDefaultDriver()) {
+            collectReadSignals(default_driver->signal, read_signals);
+        }
+
+        for (unsigned int i = 0; i < signal->getDriversNum(); i++) {
+            collectReadSignals(signal->getDriver(i)->signal, read_signals);
+        }
+
+        for (unsigned int i = 0; i < signal->getConditionsNum(); i++) {
+            collectReadSignals(signal->getCondition(i), read_signals);
+        }
+
+        for (auto* read_signal : read_signals) {
+            auto id_iter = comb_ids.find(read_signal);
+
+            if (id_iter != comb_ids.end()) {
+                comb_reads[id].push_back(id_iter->second);
+            }
+        }
+    }
+
+    /*
+     * Tarjan's strongly connected components, iterative for deep datapaths.
+     * Components are completed after everything they read, which is the
+     * evaluation order.
+     */
+    static const unsigned int UNVISITED = ~0U;
+
+    std::vector<unsigned int> index(comb_signals.size(), UNVISITED);
+    std::vector<unsigned int> lowlink(comb_signals.size(), 0);
+    std::vector<bool> on_stack(comb_signals.size(), false);
+    std::vector<unsigned int> component_stack;
+
+    /* Visited signal and its next edge */
+    std::vector<std::pair<unsigned int, unsigned int>> dfs_stack;
+    unsigned int n_visited = 0;
+
+    auto visit = [&](unsigned int id) {
+        index[id] = n_visited;
+        lowlink[id] = n_visited;
+        n_visited++;
+
+        component_stack.push_back(id);
+        on_stack[id] = true;
+
+        dfs_stack.push_back({ id, 0 });
+    };
+
+    for (unsigned int root = 0; root < comb_signals.size(); root++) {
+        if (index[root] != UNVISITED) {
+            continue;
+        }
+
+        visit(root);
+
+        while (!dfs_stack.empty()) {
+            auto& [id, edge] = dfs_stack.back();
+
+            if (edge < comb_reads[id].size()) {
+                auto read_id = comb_reads[id][edge];
+                edge++;
+
+                if (index[read_id] == UNVISITED) {
+                    visit(read_id);
+                } else if (on_stack[read_id]) {
+                    lowlink[id] = std::min(lowlink[id], index[read_id]);
+                }
+
+                continue;
+            }
+
+            auto done_id = id;
+            dfs_stack.pop_back();
+
+            if (!dfs_stack.empty()) {
+                auto parent_id = dfs_stack.back().first;
+                lowlink[parent_id] = std::min(lowlink[parent_id], lowlink[done_id]);
+            }
+
+            if (lowlink[done_id] != index[done_id]) {
+                continue;
+            }
+
+            std::vector<RtlSignal*> group;
+            unsigned int member_id = 0;
+
+            do {
+                member_id = component_stack.back();
+                component_stack.pop_back();
+                on_stack[member_id] = false;
+
+                group.push_back(comb_signals[member_id]);
+            } while (member_id != done_id);
+
+            /* Members are evaluated in the order of the module */
+            std::sort(group.begin(), group.end(), [&](RtlSignal* lhs, RtlSignal* rhs) {
+                return comb_ids[lhs] < comb_ids[rhs];
+            });
+
+            comb_groups.push_back(std::move(group));
+        }
+    }
+}
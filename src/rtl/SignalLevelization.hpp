@@ -0,0 +1,48 @@
+#ifndef __RTL_SIGNAL_LEVELIZATION_HPP__
+#define __RTL_SIGNAL_LEVELIZATION_HPP__
+
+#include <vector>
+
+#include "RtlSignal.hpp"
+#include "RtlModule.hpp"
+
+namespace llvm {
+    namespace bphls {
+        namespace rtl {
+
+/**
+ * Evaluation order of the driven signals of a module. Registers are updated
+ * on clock edges, combinational signals are grouped into strongly connected
+ * components in topological order, each group reads only signals of the
+ * groups before it and of its own.
+ *
+ * Multiplexers of different states may connect signals into loops that are
+ * never active at once, such signals share one group, ordered as in the
+ * module.
+ */
+class SignalLevelization {
+public:
+    SignalLevelization(RtlModule& rtl_module)
+        : rtl_module(rtl_module) {}
+
+    void run();
+
+    std::vector<std::vector<RtlSignal*>>& getCombGroups() { return comb_groups; }
+
+    std::vector<RtlSignal*>& getRegisters() { return registers; }
+
+    /** Signals read by the value, through its operations */
+    static void collectReadSignals(RtlSignal* signal, std::vector<RtlSignal*>& read_signals);
+
+private:
+    RtlModule& rtl_module;
+
+    std::vector<std::vector<RtlSignal*>> comb_groups;
+    std::vector<RtlSignal*> registers;
+};
+
+        } /* namespace rtl */
+    } /* namespace bphls */
+} /* namespace llvm */
+
+#endif /* __RTL_SIGNAL_LEVELIZATION_HPP__ */
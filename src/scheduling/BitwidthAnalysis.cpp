@@ -0,0 +1,177 @@
+#include <iostream>
+#include <map>
+#include <algorithm>
+
+#include <llvm/ADT/PostOrderIterator.h>
+#include <llvm/ADT/Triple.h>
+#include <llvm/Analysis/AssumptionCache.h>
+#include <llvm/Analysis/LoopInfo.h>
+#include <llvm/Analysis/ScalarEvolution.h>
+#include <llvm/Analysis/TargetLibraryInfo.h>
+#include <llvm/Analysis/ValueTracking.h>
+#include <llvm/IR/CFG.h>
+#include <llvm/IR/Constants.h>
+#include <llvm/IR/Dominators.h>
+#include <llvm/IR/Function.h>
+#include <llvm/IR/Instructions.h>
+#include <llvm/IR/Module.h>
+#include <llvm/Support/CommandLine.h>
+#include <llvm/Support/KnownBits.h>
+
+#include "../utility/instruction_utility.hpp"
+#include "../utility/log_utility.hpp"
+
+#include "BitwidthAnalysis.hpp"
+
+using namespace llvm;
+using namespace bphls;
+
+static cl::opt<bool> sched_bitwidth(
+    "sched-bitwidth",
+    cl::desc("Narrow datapath widths to the value ranges before scheduling"),
+    cl::init(true)
+);
+
+BitwidthAnalysis::BitwidthAnalysis(Function& function)
+    : function(function),
+      n_narrowed(0),
+      n_saved_bits(0) {}
+
+void BitwidthAnalysis::run() {
+    if (!sched_bitwidth) {
+        return;
+    }
+
+    DominatorTree dom_tree(function);
+    LoopInfo loop_info(dom_tree);
+    AssumptionCache assumptions(function);
+    TargetLibraryInfoImpl tli_impl(Triple(function.getParent()->getTargetTriple()));
+    TargetLibraryInfo tli(tli_impl);
+
+    ScalarEvolution se(function, tli, assumptions, dom_tree, loop_info);
+
+    propagateRanges(se);
+
+    annotateWidths();
+
+    if (n_narrowed != 0) {
+        utility::logs() << "Bitwidth analysis: " << function.getName()
+            << " narrowed: " << n_narrowed
+            << " saved bits: " << n_saved_bits
+            << "\n";
+    }
+}
+
+ConstantRange BitwidthAnalysis::getRange(Value* val) {
+    auto width = val->getType()->getIntegerBitWidth();
+
+    if (auto* const_int = dyn_cast<ConstantInt>(val)) {
+        return ConstantRange(const_int->getValue());
+    }
+
+    auto range_iter = ranges.find(val);
+    if (range_iter != ranges.end()) {
+        return range_iter->second;
+    }
+
+    /* Not yet visited loop carried value is optimistically empty */
+    if (isa<Instruction>(val)) {
+        return ConstantRange::getEmpty(width);
+    }
+
+    return ConstantRange::getFull(width);
+}
+
+ConstantRange BitwidthAnalysis::computeRange(Instruction& instr, ScalarEvolution& se) {
+    auto width = instr.getType()->getIntegerBitWidth();
+    auto range = ConstantRange::getFull(width);
+
+    if ((n_updates.count(&instr) != 0) && (n_updates[&instr] > WIDENING_LIMIT)) {
+        /* Widened, only loop bounds and known bits are left */
+    } else if (auto* bin_op = dyn_cast<BinaryOperator>(&instr)) {
+        range =
+            getRange(bin_op->getOperand(0))
+                .binaryOp(bin_op->getOpcode(), getRange(bin_op->getOperand(1)));
+    } else if (auto* cast_instr = dyn_cast<CastInst>(&instr)) {
+        if (cast_instr->getSrcTy()->isIntegerTy()) {
+            range = getRange(cast_instr->getOperand(0)).castOp(cast_instr->getOpcode(), width);
+        }
+    } else if (auto* phi = dyn_cast<PHINode>(&instr)) {
+        range = ConstantRange::getEmpty(width);
+
+        for (auto& incoming : phi->incoming_values()) {
+            range = range.unionWith(getRange(incoming));
+        }
+    } else if (auto* select = dyn_cast<SelectInst>(&instr)) {
+        range = getRange(select->getTrueValue()).unionWith(getRange(select->getFalseValue()));
+    }
+
+    /* Scalar evolution bounds induction variables by the loop trip counts */
+    if (se.isSCEVable(instr.getType())) {
+        range = range.intersectWith(se.getUnsignedRange(se.getSCEV(&instr)));
+    }
+
+    auto known = computeKnownBits(&instr, function.getParent()->getDataLayout());
+    range = range.intersectWith(ConstantRange::fromKnownBits(known, false));
+
+    return range;
+}
+
+void BitwidthAnalysis::propagateRanges(ScalarEvolution& se) {
+    ReversePostOrderTraversal<Function*> rpo_traversal(&function);
+
+    bool is_changed = true;
+
+    while (is_changed) {
+        is_changed = false;
+
+        for (auto* basic_block : rpo_traversal) {
+            for (auto& instr : *basic_block) {
+                if (!instr.getType()->isIntegerTy()) {
+                    continue;
+                }
+
+                auto range = computeRange(instr, se);
+
+                auto range_iter = ranges.find(&instr);
+                if (range_iter != ranges.end()) {
+                    /* Loop carried ranges only grow until widened */
+                    range = range.unionWith(range_iter->second);
+
+                    if (range == range_iter->second) {
+                        continue;
+                    }
+
+                    range_iter->second = range;
+                } else {
+                    ranges.emplace(&instr, range);
+                }
+
+                n_updates[&instr] += 1;
+                is_changed = true;
+            }
+        }
+    }
+}
+
+void BitwidthAnalysis::annotateWidths() {
+    for (auto& range_entry : ranges) {
+        auto* instr = cast<Instruction>(range_entry.first);
+        auto& range = range_entry.second;
+
+        unsigned int type_width = instr->getType()->getIntegerBitWidth();
+
+        if ((type_width == 1) || range.isEmptySet()) {
+            continue;
+        }
+
+        unsigned int width = std::max(1U, range.getUnsignedMax().getActiveBits());
+
+        if (width < type_width) {
+            utility::setBitwidth(*instr, width);
+
+            n_narrowed += 1;
+            n_saved_bits += type_width - width;
+        }
+    }
+}
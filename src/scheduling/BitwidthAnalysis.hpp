@@ -0,0 +1,56 @@
+#ifndef __SCHEDULING_BITWIDTH_ANALYSIS_HPP__
+#define __SCHEDULING_BITWIDTH_ANALYSIS_HPP__
+
+#include <map>
+
+#include <llvm/IR/Function.h>
+#include <llvm/IR/Instruction.h>
+#include <llvm/IR/ConstantRange.h>
+#include <llvm/Analysis/ScalarEvolution.h>
+
+namespace llvm {
+    namespace bphls {
+
+/**
+ * Bit-level range analysis run before scheduling.
+ *
+ * Value ranges are propagated forward over the CFG, loop phis are widened
+ * after a few rounds and then bounded by scalar evolution, which knows the
+ * trip counts. Ranges are refined with known bits. Every integer value
+ * whose unsigned range needs fewer bits than its type is annotated with
+ * its minimal width, see utility::getBitwidth().
+ */
+class BitwidthAnalysis {
+public:
+    BitwidthAnalysis(Function& function);
+
+    void run();
+
+    unsigned int getNarrowedNum() { return n_narrowed; }
+
+    unsigned int getSavedBitsNum() { return n_saved_bits; }
+
+private:
+    static constexpr unsigned int WIDENING_LIMIT = 4;
+
+    Function& function;
+
+    std::map<Value*, ConstantRange> ranges;
+    std::map<Instruction*, unsigned int> n_updates;
+
+    unsigned int n_narrowed;
+    unsigned int n_saved_bits;
+
+    ConstantRange getRange(Value* val);
+
+    ConstantRange computeRange(Instruction& instr, ScalarEvolution& se);
+
+    void propagateRanges(ScalarEvolution& se);
+
+    void annotateWidths();
+};
+
+    } /* namespace bphls */
+} /* namespace llvm */
+
+#endif /* __SCHEDULING_BITWIDTH_ANALYSIS_HPP__ */
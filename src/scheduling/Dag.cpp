@@ -1,4 +1,7 @@
 #include <iostream>
+#include <vector>
+#include <algorithm>
+#include <cmath>
 
 #include <llvm/IR/Function.h>
 #include <llvm/IR/BasicBlock.h>
@@ -8,28 +11,27 @@
 
 #include "../utility/instruction_utility.hpp"
 #include "../utility/DotGraph.hpp"
+#include "../utility/arena_utility.hpp"
+#include "../utility/log_utility.hpp"
 
 #include "../hardware/HardwareConstraints.hpp"
 #include "../hardware/FunctionalUnit.hpp"
 
 #include "Dag.hpp"
 
-extern llvm::bphls::hardware::HardwareConstraints* constraints;
-
 using namespace llvm;
 using namespace bphls;
 
-Dag::Dag(Function& function) {
+Dag::Dag(Function& function, hardware::HardwareConstraints& constraints)
+    : constraints(constraints)
+{
     create(function);
 };
 
-Dag::~Dag() {
-    for (auto instr_node : instr_node_lookup) {
-        delete instr_node.second;
-    }
-}
-
 bool Dag::create(Function& function) {
+    numbering.reset(function);
+    nodes.assign(numbering.getInstructionsNum(), nullptr);
+
     for (auto& basic_block : function) {
         for (auto& instr : basic_block) {
             insertInstruction(instr);
@@ -48,11 +50,14 @@ bool Dag::create(Function& function) {
 }
 
 bool Dag::hasNode(Instruction& instr) {
-    return instr_node_lookup.count(&instr) != 0;
+    return numbering.getId(&instr) != utility::FunctionNumbering::NONE;
 }
 
 InstructionNode& Dag::getNode(Instruction& instr) {
-    return *instr_node_lookup[&instr];
+    auto id = numbering.getId(&instr);
+    assert(id != utility::FunctionNumbering::NONE);
+
+    return *nodes[id];
 }
 
 void Dag::filterInstructions(Function& function) {
@@ -61,44 +66,76 @@ void Dag::filterInstructions(Function& function) {
 
     for (auto& basic_block : function) {
         for (auto& instr : basic_block) {
-            if (isa<ZExtInst>(instr) || isa<SExtInst>(instr)) {
-                std::cout << "Filtering: " << instr.getOpcodeName() << std::endl;
+            /* Extensions used by other basic blocks are kept and scheduled */
+            if ((isa<ZExtInst>(instr) || isa<SExtInst>(instr)) && instr.use_empty()) {
+                utility::logs() << "Filtering: " << instr.getOpcodeName() << "\n";
                 to_erase.push_back(&instr);
             }
         }
     }
 
     for (auto* instr : to_erase) {
+        nodes[numbering.getId(instr)] = nullptr;
+
         instr->eraseFromParent();
     }
+
+    /* Renumber remaining instructions densely, nodes keep layout order */
+    auto erased_end = std::remove(nodes.begin(), nodes.end(), nullptr);
+    nodes.erase(erased_end, nodes.end());
+
+    numbering.reset(function);
+    assert(nodes.size() == numbering.getInstructionsNum());
+
+    for (unsigned int id = 0; id < nodes.size(); id++) {
+        nodes[id]->setId(id);
+    }
+}
+
+bool Dag::isBlockLocal(Instruction& instr) {
+    for (auto* user : instr.users()) {
+        auto* user_instr = dyn_cast<Instruction>(user);
+
+        /* PHI operands are not rewired */
+        if ((user_instr == nullptr)
+                || isa<PHINode>(user_instr)
+                || (user_instr->getParent() != instr.getParent()))
+        {
+            return false;
+        }
+    }
+
+    return true;
 }
 
 void Dag::insertInstruction(Instruction& instr) {
-    InstructionNode* instr_node = new InstructionNode(instr);
-    instr_node_lookup[&instr] = instr_node;
+    InstructionNode* instr_node = utility::createInArena(node_allocator, instr);
+    nodes[numbering.getId(&instr)] = instr_node;
 
-    auto* op = constraints->getInstructionOperation(instr);
+    auto* op = constraints.getInstructionOperation(instr);
     assert(op != nullptr);
 
     float crit_delay = op->crit_delay;
 
-    if (crit_delay > constraints->max_delay) {
-        instr_node->setMaxDelay();
+    if (crit_delay > constraints.max_delay) {
+        /* Multicycle operation, result is ready after ceil(delay / clock period) cycles */
+        instr_node->setMaxDelay(constraints.max_delay);
+        instr_node->setCycles(std::ceil(crit_delay / constraints.max_delay) - 1);
     } else {
         instr_node->setDelay(crit_delay);
     }
 }
 
 void Dag::constructDependencies(Instruction& instr) {
-    auto& instr_node = *instr_node_lookup[&instr];
+    auto& instr_node = getNode(instr);
 
     /* Filter instructions without dependencies */
     if (isa<AllocaInst>(instr) || isa<PHINode>(instr)) {
         return;
     }
 
-    /* Filter insteger extension istructions */
-    if (isa<ZExtInst>(instr) || isa<SExtInst>(instr)) {
+    /* Filter insteger extension istructions, unless used by other basic blocks */
+    if ((isa<ZExtInst>(instr) || isa<SExtInst>(instr)) && isBlockLocal(instr)) {
         return;
     }
 
@@ -118,8 +155,10 @@ void Dag::constructDependencies(Instruction& instr) {
             auto* before_cast_operand = dep_instr->getOperand(0);
 
             auto* before_cast_instr = dyn_cast<Instruction>(before_cast_operand);
-            if (before_cast_instr != nullptr) {
-                auto& before_cast_instr_node = *instr_node_lookup[before_cast_instr];
+            if ((before_cast_instr != nullptr)
+                    && (before_cast_instr->getParent() == instr.getParent()))
+            {
+                auto& before_cast_instr_node = getNode(*before_cast_instr);
 
                 instr_node.addDependence(before_cast_instr_node);
                 before_cast_instr_node.addUse(instr_node);
@@ -128,7 +167,7 @@ void Dag::constructDependencies(Instruction& instr) {
             // FIXME Обработать рекeрсивное приведение типов
             operand.set(before_cast_operand);
         } else {
-            auto& dep_instr_node = *instr_node_lookup[dep_instr];
+            auto& dep_instr_node = getNode(*dep_instr);
 
             instr_node.addDependence(dep_instr_node);
             dep_instr_node.addUse(instr_node);
@@ -162,7 +201,7 @@ void Dag::constructDependencies(Instruction& instr) {
             auto* dep_instr_addr = utility::getPointerOperand(dep_instr);
 
             if (instr_addr == dep_instr_addr) {
-                auto& dep_instr_node = *instr_node_lookup[&instr_a];
+                auto& dep_instr_node = getNode(instr_a);
 
                 instr_node.addMemoryDependence(dep_instr_node);
                 dep_instr_node.addMemoryUse(instr_node);
@@ -180,7 +219,7 @@ void Dag::exportDot(formatted_raw_ostream& out, BasicBlock& basic_block) {
     graph.setLabelLimit(40);
 
     for (auto& instr : basic_block) {
-        auto& instr_node = *instr_node_lookup[&instr];
+        auto& instr_node = getNode(instr);
 
         if (utility::isDummyCall(instr)) {
             continue;
@@ -198,7 +237,7 @@ void Dag::exportDot(formatted_raw_ostream& out, BasicBlock& basic_block) {
                     continue;
                 }
 
-                auto* dep_instr_node = instr_node_lookup[dep_instr];
+                auto* dep_instr_node = &getNode(*dep_instr);
                 graph.connectDot(out, &instr_node, dep_instr_node, label + "color=blue");
             }   
         }
@@ -1,13 +1,15 @@
 #ifndef __SCHEDULING_SCHEDULER_DAG_HPP__
 #define __SCHEDULING_SCHEDULER_DAG_HPP__
 
-#include <map>
 #include <vector>
 
 #include <llvm/IR/Function.h>
 #include <llvm/Support/FormattedStream.h>
 #include <llvm/ADT/iterator_range.h>
+#include <llvm/Support/Allocator.h>
 
+#include "../hardware/HardwareConstraints.hpp"
+#include "../utility/FunctionNumbering.hpp"
 #include "InstructionNode.hpp"
 
 namespace llvm {
@@ -15,9 +17,7 @@ namespace llvm {
 
 class Dag {
 public:
-    Dag(Function& function);
-
-    ~Dag();
+    Dag(Function& function, hardware::HardwareConstraints& constraints);
 
     void exportDot(formatted_raw_ostream& out, BasicBlock& basic_block);
 
@@ -25,8 +25,22 @@ public:
 
     InstructionNode& getNode(Instruction& instr);
 
+    /** Node of the instruction numbered id, node ids match the numbering */
+    InstructionNode& getNode(unsigned int id) { return *nodes[id]; }
+
+    unsigned int getNodesNum() { return nodes.size(); }
+
+    /** Numbering of the function after filtering, shared by later phases */
+    utility::FunctionNumbering& getNumbering() { return numbering; }
+
 private:
-    std::map<Instruction*, InstructionNode*> instr_node_lookup;
+    hardware::HardwareConstraints& constraints;
+
+    utility::FunctionNumbering numbering;
+
+    /* Nodes are owned by the arena and released together with the Dag */
+    SpecificBumpPtrAllocator<InstructionNode> node_allocator;
+    std::vector<InstructionNode*> nodes;
 
     bool create(Function& function);
 
@@ -35,6 +49,8 @@ private:
     void constructDependencies(Instruction& instr);
 
     void filterInstructions(Function& function);
+
+    static bool isBlockLocal(Instruction& instr);
 };
 
     } /* namespace bphls */ 
@@ -0,0 +1,228 @@
+#include <iostream>
+#include <set>
+#include <vector>
+
+#include <llvm/IR/CFG.h>
+#include <llvm/IR/Function.h>
+#include <llvm/IR/BasicBlock.h>
+#include <llvm/IR/Instruction.h>
+#include <llvm/IR/Instructions.h>
+#include <llvm/Support/CommandLine.h>
+
+#include "../binding/LifetimeAnalysis.hpp"
+#include "../utility/log_utility.hpp"
+
+#include "GlobalCodeMotion.hpp"
+
+using namespace llvm;
+using namespace bphls;
+
+static cl::opt<bool> sched_global(
+    "sched-global",
+    cl::desc("Move operations across basic blocks before scheduling"),
+    cl::init(true)
+);
+
+static cl::opt<unsigned int> sched_speculation_limit(
+    "sched-speculation-limit",
+    cl::desc("Maximum number of operations speculated from a basic block"),
+    cl::init(4)
+);
+
+GlobalCodeMotion::GlobalCodeMotion(Function& function)
+    : function(function),
+      n_sunk(0),
+      n_hoisted(0) {}
+
+void GlobalCodeMotion::run() {
+    if (!sched_global) {
+        return;
+    }
+
+    std::set<BasicBlock*> hoist_blocks;
+
+    {
+        binding::LifetimeAnalysis lva(function);
+        lva.analize();
+
+        for (auto& basic_block : function) {
+            if (canHoist(basic_block, lva)) {
+                hoist_blocks.insert(&basic_block);
+            }
+        }
+    }
+
+    /* Sinking never targets emptied blocks, so both motions agree */
+    sinkInstructions(hoist_blocks);
+
+    hoistInstructions(hoist_blocks);
+
+    if ((n_sunk != 0) || (n_hoisted != 0)) {
+        utility::logs() << "Global code motion: " << function.getName()
+            << " sunk: " << n_sunk
+            << " hoisted: " << n_hoisted
+            << " emptied blocks: " << hoist_blocks.size()
+            << "\n";
+    }
+}
+
+bool GlobalCodeMotion::isMovable(Instruction& instr) {
+    /* Side effect free, can not trap and takes no extra cycles */
+    switch (instr.getOpcode()) {
+        case Instruction::UDiv:
+        case Instruction::SDiv:
+        case Instruction::URem:
+        case Instruction::SRem:
+            return false;
+        default:
+            break;
+    }
+
+    return isa<BinaryOperator>(instr)
+        || isa<ICmpInst>(instr)
+        || isa<ZExtInst>(instr)
+        || isa<SExtInst>(instr);
+}
+
+BasicBlock* GlobalCodeMotion::getRegionHead(BasicBlock& basic_block) {
+    auto* head = basic_block.getSinglePredecessor();
+
+    if ((head == nullptr) || (head == &basic_block)) {
+        return nullptr;
+    }
+
+    /* Loop bodies keep their operations, see loop pipelining */
+    for (auto* succ_basic_block : successors(head)) {
+        if (succ_basic_block == head) {
+            return nullptr;
+        }
+    }
+
+    return head;
+}
+
+bool GlobalCodeMotion::canHoist(BasicBlock& basic_block, binding::LifetimeAnalysis& lva) {
+    auto* head = getRegionHead(basic_block);
+
+    if (head == nullptr) {
+        return false;
+    }
+
+    auto* branch = dyn_cast<BranchInst>(basic_block.getTerminator());
+
+    if ((branch == nullptr)
+            || branch->isConditional()
+            || (branch->getSuccessor(0) == &basic_block))
+    {
+        return false;
+    }
+
+    std::set<Instruction*> hoisted;
+
+    for (auto& instr : basic_block) {
+        if (instr.isTerminator()) {
+            break;
+        }
+
+        if (!isMovable(instr) || (hoisted.size() >= sched_speculation_limit)) {
+            return false;
+        }
+
+        /* Operands are defined by the head or flow into the basic block */
+        for (auto& operand : instr.operands()) {
+            auto* op_instr = dyn_cast<Instruction>(operand);
+
+            if ((op_instr == nullptr)
+                    || (op_instr->getParent() == head)
+                    || (hoisted.count(op_instr) != 0))
+            {
+                continue;
+            }
+
+            if (!lva.isLiveIn(op_instr, &basic_block)) {
+                return false;
+            }
+        }
+
+        hoisted.insert(&instr);
+    }
+
+    return true;
+}
+
+void GlobalCodeMotion::hoistInstructions(std::set<BasicBlock*>& hoist_blocks) {
+    std::set<Instruction*> hoisted;
+
+    /* Heads of chained regions may be emptied as well */
+    for (unsigned int i = 0; i < hoist_blocks.size(); i++) {
+        bool is_changed = false;
+
+        /* Layout order, hoisted instructions do not depend on block addresses */
+        for (auto& basic_block : function) {
+            if (hoist_blocks.count(&basic_block) == 0) {
+                continue;
+            }
+
+            auto* head = getRegionHead(basic_block);
+
+            while (&basic_block.front() != basic_block.getTerminator()) {
+                auto& instr = basic_block.front();
+
+                instr.moveBefore(head->getTerminator());
+                hoisted.insert(&instr);
+                is_changed = true;
+            }
+        }
+
+        if (!is_changed) {
+            break;
+        }
+    }
+
+    n_hoisted = hoisted.size();
+}
+
+void GlobalCodeMotion::sinkInstructions(std::set<BasicBlock*>& hoist_blocks) {
+    for (auto& basic_block : function) {
+        std::vector<Instruction*> candidates;
+
+        for (auto& instr : basic_block) {
+            if (isMovable(instr)) {
+                candidates.push_back(&instr);
+            }
+        }
+
+        /* Users are sunk before their operands */
+        for (auto instr_iter = candidates.rbegin(); instr_iter != candidates.rend(); instr_iter++) {
+            auto* instr = *instr_iter;
+
+            BasicBlock* target = nullptr;
+            bool is_sinkable = !instr->users().empty();
+
+            for (auto* user : instr->users()) {
+                auto* user_instr = dyn_cast<Instruction>(user);
+
+                if ((user_instr == nullptr)
+                        || isa<PHINode>(user_instr)
+                        || (user_instr->getParent() == &basic_block)
+                        || ((target != nullptr) && (user_instr->getParent() != target)))
+                {
+                    is_sinkable = false;
+                    break;
+                }
+
+                target = user_instr->getParent();
+            }
+
+            if (!is_sinkable
+                    || (getRegionHead(*target) != &basic_block)
+                    || (hoist_blocks.count(target) != 0))
+            {
+                continue;
+            }
+
+            instr->moveBefore(&*target->getFirstInsertionPt());
+            n_sunk += 1;
+        }
+    }
+}
@@ -0,0 +1,53 @@
+#ifndef __SCHEDULING_GLOBAL_CODE_MOTION_HPP__
+#define __SCHEDULING_GLOBAL_CODE_MOTION_HPP__
+
+#include <set>
+
+#include <llvm/IR/Function.h>
+#include <llvm/IR/BasicBlock.h>
+#include <llvm/IR/Instruction.h>
+
+#include "../binding/LifetimeAnalysis.hpp"
+
+namespace llvm {
+    namespace bphls {
+
+/**
+ * Moves operations across basic block boundaries before scheduling.
+ *
+ * Operations used by a single successor are sunk into it, so the other
+ * paths do not wait for them. Cheap operations of a successor are hoisted
+ * (speculated) above the branch of its only predecessor when this empties
+ * the successor, such forwarding blocks get no FSM states.
+ */
+class GlobalCodeMotion {
+public:
+    GlobalCodeMotion(Function& function);
+
+    void run();
+
+    unsigned int getSunkNum() { return n_sunk; }
+
+    unsigned int getHoistedNum() { return n_hoisted; }
+
+private:
+    Function& function;
+
+    unsigned int n_sunk;
+    unsigned int n_hoisted;
+
+    static bool isMovable(Instruction& instr);
+
+    static BasicBlock* getRegionHead(BasicBlock& basic_block);
+
+    bool canHoist(BasicBlock& basic_block, binding::LifetimeAnalysis& lva);
+
+    void hoistInstructions(std::set<BasicBlock*>& hoist_blocks);
+
+    void sinkInstructions(std::set<BasicBlock*>& hoist_blocks);
+};
+
+    } /* namespace bphls */
+} /* namespace llvm */
+
+#endif /* __SCHEDULING_GLOBAL_CODE_MOTION_HPP__ */
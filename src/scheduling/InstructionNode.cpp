@@ -7,14 +7,21 @@ using namespace bphls;
 
 InstructionNode::InstructionNode(Instruction& instruction)
     : instruction(instruction),
-      delay(0.0F) {}
+      id(0),
+      delay(0.0F),
+      cycles(0) {}
 
 void InstructionNode::setDelay(float delay) {
     this->delay = delay;
 }
 
-void InstructionNode::setMaxDelay() {
-    this->delay = 1.0F;
+void InstructionNode::setMaxDelay(float max_delay) {
+    /* Operation occupies the whole clock period */
+    this->delay = max_delay;
+}
+
+void InstructionNode::setCycles(unsigned int cycles) {
+    this->cycles = cycles;
 }
 
 void  InstructionNode::addDependence(InstructionNode& dep_instr_node) {
@@ -15,7 +15,14 @@ public:
 
     void setDelay(float delay);
 
-    void setMaxDelay();
+    void setMaxDelay(float max_delay);
+
+    float getDelay() { return delay; };
+
+    /** Extra states of operations slower than the clock period */
+    void setCycles(unsigned int cycles);
+
+    unsigned int getCycles() { return cycles; };
 
     void addDependence(InstructionNode& dep_instr_node);
 
@@ -27,6 +34,11 @@ public:
 
     Instruction& getInstruction() { return instruction; };
 
+    /** Dense index of the instruction in the function numbering */
+    unsigned int getId() { return id; }
+
+    void setId(unsigned int id) { this->id = id; }
+
     typedef std::vector<InstructionNode*>::iterator InstructionNodeIterator;
 
     iterator_range<InstructionNodeIterator> dependencies() {
@@ -48,8 +60,12 @@ public:
 private:
     Instruction& instruction;
 
+    unsigned int id;
+
     float delay;
 
+    unsigned int cycles;
+
     std::vector<InstructionNode*> dependencies_list;
     std::vector<InstructionNode*> users_list;
 
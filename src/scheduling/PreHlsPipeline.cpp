@@ -0,0 +1,382 @@
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include <llvm/IR/Function.h>
+#include <llvm/IR/IRBuilder.h>
+#include <llvm/IR/InstIterator.h>
+#include <llvm/IR/Instructions.h>
+#include <llvm/IR/IntrinsicInst.h>
+#include <llvm/IR/PassManager.h>
+#include <llvm/Passes/PassBuilder.h>
+#include <llvm/Support/CommandLine.h>
+#include <llvm/Support/Error.h>
+#include <llvm/Support/raw_ostream.h>
+#include <llvm/Transforms/Utils/BasicBlockUtils.h>
+#include <llvm/Transforms/Utils/Cloning.h>
+#include <llvm/Transforms/Utils/LowerSwitch.h>
+
+#include "../utility/PhaseProfile.hpp"
+#include "../utility/instruction_utility.hpp"
+#include "../utility/log_utility.hpp"
+
+#include "PreHlsPipeline.hpp"
+
+using namespace llvm;
+using namespace bphls;
+
+enum PreHlsPreset {
+    PreHlsNone,
+    PreHlsFast,
+    PreHlsDefault,
+    PreHlsAggressive
+};
+
+static cl::opt<PreHlsPreset> pre_hls(
+    "pre-hls",
+    cl::desc("LLVM optimizations of the function before the HLS flow"),
+    cl::init(PreHlsNone),
+    cl::values(
+        clEnumValN(PreHlsNone, "none", "No optimizations, the input is synthesized as is"),
+        clEnumValN(PreHlsFast, "fast", "Register promotion and instruction combining"),
+        clEnumValN(PreHlsDefault, "default", "Reassociation, GVN and bit-width narrowing too"),
+        clEnumValN(PreHlsAggressive, "aggressive", "Closed-form loop exit values and full unrolling of small loops first")
+    )
+);
+
+static cl::opt<std::string> pre_hls_passes(
+    "pre-hls-passes",
+    cl::desc("Textual function pass pipeline run instead of the -pre-hls preset"),
+    cl::value_desc("pipeline"),
+    cl::init("")
+);
+
+static cl::opt<unsigned int> pre_hls_unroll_max(
+    "pre-hls-unroll-max",
+    cl::desc("Trip count limit of the loops fully unrolled by -pre-hls=aggressive"),
+    cl::init(16)
+);
+
+/* Scalar cleanup, instcombine and bdce narrow operations to demanded bits */
+static const char* SCALAR_PASSES =
+    "instcombine,reassociate,gvn,instcombine,aggressive-instcombine,bdce,adce";
+
+bool PreHlsPipeline::run() {
+    /* Constructs not supported by the RTL generator are lowered even if the
+     * function is synthesized as is, presets only choose optimizations */
+    lowerSwitches(function);
+    legalize(function);
+
+    auto pipeline = getPipeline();
+
+    if (pipeline.empty()) {
+        return true;
+    }
+
+    /* Simplifycfg may form switches again */
+    pipeline += ",lowerswitch";
+
+    LoopAnalysisManager loop_analyses;
+    FunctionAnalysisManager function_analyses;
+    CGSCCAnalysisManager cgscc_analyses;
+    ModuleAnalysisManager module_analyses;
+
+    PassBuilder pass_builder;
+    pass_builder.registerModuleAnalyses(module_analyses);
+    pass_builder.registerCGSCCAnalyses(cgscc_analyses);
+    pass_builder.registerFunctionAnalyses(function_analyses);
+    pass_builder.registerLoopAnalyses(loop_analyses);
+    pass_builder.crossRegisterProxies(loop_analyses, function_analyses, cgscc_analyses, module_analyses);
+
+    FunctionPassManager function_passes;
+
+    if (auto error = pass_builder.parsePassPipeline(function_passes, pipeline)) {
+        errs() << "Invalid pre-HLS pipeline '" << getPipeline() << "': "
+            << toString(std::move(error)) << "\n";
+        return false;
+    }
+
+    utility::PhaseProfile::record("pre_hls_instructions_in", function.getInstructionCount());
+
+    /* Optimized copy replaces the function only if the RTL generator supports it */
+    ValueToValueMapTy value_map;
+    auto* optimized = CloneFunction(&function, value_map);
+
+    function_passes.run(*optimized, function_analyses);
+    function_analyses.clear();
+
+    legalize(*optimized);
+
+    if (auto* instr = findUnsupported(*optimized)) {
+        errs() << "Pre-HLS pipeline of function '" << function.getName()
+            << "' produced unsupported instruction '" << instr->getOpcodeName()
+            << "', the function is synthesized unoptimized\n";
+
+        optimized->eraseFromParent();
+        return true;
+    }
+
+    replaceBody(*optimized);
+
+    utility::PhaseProfile::record("pre_hls_instructions_out", function.getInstructionCount());
+
+    utility::logs() << "Pre-HLS pipeline: " << pipeline << "\n";
+
+    return true;
+}
+
+std::string PreHlsPipeline::getPipeline() {
+    if (!pre_hls_passes.empty()) {
+        return pre_hls_passes;
+    }
+
+    switch (pre_hls) {
+    case PreHlsNone:
+        return "";
+    case PreHlsFast:
+        return "mem2reg,instcombine";
+    case PreHlsDefault:
+        return std::string("mem2reg,") + SCALAR_PASSES;
+    case PreHlsAggressive:
+        /* Exit values of loops are rewritten by indvars as closed forms. Loops are
+         * only unrolled fully, remainder loops and peeled copies cost FSM states */
+        return "mem2reg,instcombine,loop(loop-rotate,indvars),"
+            "loop-unroll<O3;no-partial;no-runtime;no-upperbound;no-peeling;full-unroll-max="
+            + std::to_string(pre_hls_unroll_max) + ">,simplifycfg," + SCALAR_PASSES;
+    }
+
+    return "";
+}
+
+void PreHlsPipeline::lowerSwitches(Function& function) {
+    bool has_switches = std::any_of(inst_begin(function), inst_end(function), [](Instruction& instr) {
+        return isa<SwitchInst>(instr);
+    });
+
+    if (!has_switches) {
+        return;
+    }
+
+    FunctionAnalysisManager function_analyses;
+
+    PassBuilder pass_builder;
+    pass_builder.registerFunctionAnalyses(function_analyses);
+
+    FunctionPassManager function_passes;
+    function_passes.addPass(LowerSwitchPass());
+    function_passes.run(function, function_analyses);
+}
+
+void PreHlsPipeline::expandIntrinsics(Function& function) {
+    std::vector<IntrinsicInst*> intrinsics;
+
+    for (auto& instr : instructions(function)) {
+        if (auto* intrinsic = dyn_cast<IntrinsicInst>(&instr)) {
+            intrinsics.push_back(intrinsic);
+        }
+    }
+
+    for (auto* intrinsic : intrinsics) {
+        IRBuilder<> builder(intrinsic);
+
+        auto* lhs = intrinsic->getArgOperand(0);
+        auto* rhs = (intrinsic->arg_size() > 1) ? intrinsic->getArgOperand(1) : nullptr;
+
+        Value* expanded = nullptr;
+
+        switch (intrinsic->getIntrinsicID()) {
+        case Intrinsic::smax:
+            expanded = builder.CreateSelect(builder.CreateICmpSGT(lhs, rhs), lhs, rhs);
+            break;
+        case Intrinsic::smin:
+            expanded = builder.CreateSelect(builder.CreateICmpSLT(lhs, rhs), lhs, rhs);
+            break;
+        case Intrinsic::umax:
+            expanded = builder.CreateSelect(builder.CreateICmpUGT(lhs, rhs), lhs, rhs);
+            break;
+        case Intrinsic::umin:
+            expanded = builder.CreateSelect(builder.CreateICmpULT(lhs, rhs), lhs, rhs);
+            break;
+        case Intrinsic::abs:
+            expanded = builder.CreateSelect(
+                builder.CreateICmpSLT(lhs, Constant::getNullValue(lhs->getType())),
+                builder.CreateNeg(lhs),
+                lhs
+            );
+            break;
+        default:
+            continue;
+        }
+
+        expanded->takeName(intrinsic);
+        intrinsic->replaceAllUsesWith(expanded);
+        intrinsic->eraseFromParent();
+    }
+}
+
+void PreHlsPipeline::expandSelects(Function& function) {
+    std::vector<SelectInst*> selects;
+
+    for (auto& instr : instructions(function)) {
+        if (auto* select = dyn_cast<SelectInst>(&instr)) {
+            selects.push_back(select);
+        }
+    }
+
+    /* Select becomes a PHI of a diamond, the true value comes from the new block */
+    for (auto* select : selects) {
+        auto* head_block = select->getParent();
+        auto* then_term = SplitBlockAndInsertIfThen(select->getCondition(), select, false);
+
+        auto* phi = PHINode::Create(select->getType(), 2, "", select);
+        phi->addIncoming(select->getTrueValue(), then_term->getParent());
+        phi->addIncoming(select->getFalseValue(), head_block);
+
+        phi->takeName(select);
+        select->replaceAllUsesWith(phi);
+        select->eraseFromParent();
+    }
+}
+
+void PreHlsPipeline::expandSignedCompares(Function& function) {
+    for (auto& instr : instructions(function)) {
+        auto* compare = dyn_cast<ICmpInst>(&instr);
+
+        if ((compare == nullptr) || !compare->isSigned()) {
+            continue;
+        }
+
+        /* Flipped sign bits order signed values as unsigned ones */
+        IRBuilder<> builder(compare);
+        auto* sign_bit = ConstantInt::get(
+            compare->getOperand(0)->getType(),
+            APInt::getSignMask(compare->getOperand(0)->getType()->getScalarSizeInBits())
+        );
+
+        compare->setOperand(0, builder.CreateXor(compare->getOperand(0), sign_bit));
+        compare->setOperand(1, builder.CreateXor(compare->getOperand(1), sign_bit));
+        compare->setPredicate(compare->getUnsignedPredicate());
+    }
+}
+
+void PreHlsPipeline::expandShifts(Function& function) {
+    std::vector<BinaryOperator*> shifts;
+
+    for (auto& instr : instructions(function)) {
+        if ((instr.getOpcode() == Instruction::Shl) && isa<ConstantInt>(instr.getOperand(1))) {
+            shifts.push_back(cast<BinaryOperator>(&instr));
+        }
+    }
+
+    /* Left shift by a constant is a multiplication by a power of two */
+    for (auto* shift : shifts) {
+        auto* amount = cast<ConstantInt>(shift->getOperand(1));
+        auto width = shift->getType()->getScalarSizeInBits();
+
+        if (amount->getValue().uge(width)) {
+            continue;
+        }
+
+        auto* factor = ConstantInt::get(
+            shift->getType(),
+            APInt::getOneBitSet(width, amount->getZExtValue())
+        );
+
+        auto* multiply = BinaryOperator::CreateMul(shift->getOperand(0), factor, "", shift);
+
+        multiply->takeName(shift);
+        shift->replaceAllUsesWith(multiply);
+        shift->eraseFromParent();
+    }
+}
+
+void PreHlsPipeline::restoreSubtractions(Function& function) {
+    std::vector<BinaryOperator*> adds;
+
+    for (auto& instr : instructions(function)) {
+        if (instr.getOpcode() != Instruction::Add) {
+            continue;
+        }
+
+        auto* constant = dyn_cast<ConstantInt>(instr.getOperand(1));
+
+        if ((constant != nullptr) && constant->isNegative() && !constant->getValue().isMinSignedValue()) {
+            adds.push_back(cast<BinaryOperator>(&instr));
+        }
+    }
+
+    /* Instcombine adds negated constants, subtraction of a narrow one takes no adder */
+    for (auto* add : adds) {
+        auto* constant = cast<ConstantInt>(add->getOperand(1));
+
+        auto* subtract = BinaryOperator::CreateSub(
+            add->getOperand(0),
+            ConstantInt::get(constant->getType(), -constant->getValue()),
+            "",
+            add
+        );
+
+        subtract->takeName(add);
+        add->replaceAllUsesWith(subtract);
+        add->eraseFromParent();
+    }
+}
+
+void PreHlsPipeline::legalize(Function& function) {
+    restoreSubtractions(function);
+    expandShifts(function);
+    expandIntrinsics(function);
+    expandSelects(function);
+    expandSignedCompares(function);
+}
+
+Instruction* PreHlsPipeline::findUnsupported(Function& function) {
+    for (auto& instr : instructions(function)) {
+        switch (instr.getOpcode()) {
+        case Instruction::Add:
+        case Instruction::Sub:
+        case Instruction::Mul:
+        case Instruction::And:
+        case Instruction::Or:
+        case Instruction::Xor:
+        case Instruction::ICmp:
+        case Instruction::ZExt:
+        case Instruction::SExt:
+        case Instruction::Trunc:
+        case Instruction::BitCast:
+        case Instruction::PtrToInt:
+        case Instruction::IntToPtr:
+        case Instruction::PHI:
+        case Instruction::Br:
+        case Instruction::Ret:
+        case Instruction::Unreachable:
+        case Instruction::Alloca:
+        case Instruction::Load:
+        case Instruction::Store:
+            break;
+        case Instruction::Call:
+            /* Calls of the input, dataflow tasks and markers, are kept as is */
+            if (!isa<IntrinsicInst>(instr) || utility::isDummyCall(instr)) {
+                break;
+            }
+
+            return &instr;
+        default:
+            return &instr;
+        }
+    }
+
+    return nullptr;
+}
+
+void PreHlsPipeline::replaceBody(Function& optimized) {
+    function.dropAllReferences();
+
+    function.getBasicBlockList().splice(function.end(), optimized.getBasicBlockList());
+
+    for (unsigned int i = 0; i < function.arg_size(); i++) {
+        optimized.getArg(i)->replaceAllUsesWith(function.getArg(i));
+    }
+
+    optimized.eraseFromParent();
+}
@@ -0,0 +1,64 @@
+#ifndef __SCHEDULING_PRE_HLS_PIPELINE_HPP__
+#define __SCHEDULING_PRE_HLS_PIPELINE_HPP__
+
+#include <string>
+
+#include <llvm/IR/Function.h>
+
+namespace llvm {
+    namespace bphls {
+
+/**
+ * Target independent LLVM optimizations of the function before the HLS
+ * flow, run in-process by the new pass manager. Presets of -pre-hls trade
+ * compile time for schedules: "fast" promotes memory to registers and
+ * combines instructions, "default" adds reassociation, GVN and bit-width
+ * narrowing, "aggressive" computes loop exit values in closed form and
+ * fully unrolls loops with small trip counts first. -pre-hls-passes
+ * replaces the preset with a textual pipeline.
+ *
+ * The function is legalized for the RTL generator whatever the preset
+ * is: switches, selects and min/max/abs intrinsics are lowered to
+ * branches, signed comparisons to unsigned ones and constant left shifts
+ * to multiplications. Additions of negative constants become subtractions
+ * again, they do not compete for the adders. A copy of the function is
+ * then optimized and legalized again. The copy replaces the function if
+ * nothing the generator does not support is left, otherwise it is
+ * reported and the function is synthesized unoptimized.
+ */
+class PreHlsPipeline {
+public:
+    PreHlsPipeline(Function& function)
+        : function(function) {}
+
+    /** False if the pipeline description is invalid */
+    bool run();
+
+private:
+    Function& function;
+
+    static std::string getPipeline();
+
+    static void lowerSwitches(Function& function);
+
+    static void legalize(Function& function);
+
+    static void restoreSubtractions(Function& function);
+
+    static void expandShifts(Function& function);
+
+    static void expandIntrinsics(Function& function);
+
+    static void expandSelects(Function& function);
+
+    static void expandSignedCompares(Function& function);
+
+    static Instruction* findUnsupported(Function& function);
+
+    void replaceBody(Function& optimized);
+};
+
+    } /* namespace bphls */
+} /* namespace llvm */
+
+#endif /* __SCHEDULING_PRE_HLS_PIPELINE_HPP__ */
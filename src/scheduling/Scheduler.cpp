@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include <llvm/IR/Function.h>
 #include <llvm/IR/Instruction.h>
 
@@ -20,4 +22,8 @@ unsigned int Scheduler::getInstructionCycles(Instruction& instr) {
     default:
         return 0;
     }
-}
\ No newline at end of file
+}
+
+unsigned int Scheduler::getInstructionCycles(InstructionNode& instr_node) {
+    return std::max(getInstructionCycles(instr_node.getInstruction()), instr_node.getCycles());
+}
@@ -17,6 +17,9 @@ public:
     virtual SchedulerMapping& schedule() = 0;
 
     static unsigned int getInstructionCycles(Instruction& instr);
+
+    /** Opcode cycles or the cycles of a multicycle operation */
+    static unsigned int getInstructionCycles(InstructionNode& instr_node);
 };
 
     } /* namespace bphls */ 
@@ -2,6 +2,7 @@
 
 #include <map>
 #include <vector>
+#include <algorithm>
 
 #include <llvm/IR/Function.h>
 #include <llvm/IR/BasicBlock.h>
@@ -23,49 +24,97 @@ using namespace bphls;
 
 SchedulerMapping::SchedulerMapping(Function& function, Dag& dag)
     : function(function),
-      dag(dag) {} 
+      dag(dag),
+      numbering(dag.getNumbering()),
+      fsm(dag.getNumbering()),
+      instr_states(dag.getNodesNum(), 0),
+      bb_states_num(dag.getNumbering().getBasicBlocksNum(), 0),
+      bb_ii(dag.getNumbering().getBasicBlocksNum(), 0) {}
 
 unsigned int SchedulerMapping::getState(InstructionNode* instr) {
-    return instr_state_lookup[instr];
+    return instr_states[instr->getId()];
 }
 
 void SchedulerMapping::setState(InstructionNode* instr, unsigned int state) {
-    instr_state_lookup[instr] = state;
+    instr_states[instr->getId()] = state;
 }
 
 unsigned int SchedulerMapping::getBasicBlockStatesNum(BasicBlock* basic_block) {
-    return bb_states_num_lookup[basic_block];
+    return bb_states_num[numbering.getId(basic_block)];
 }
 
 void SchedulerMapping::setBasicBlockStatesNum(BasicBlock* basic_block, unsigned int state) {
-    bb_states_num_lookup[basic_block] = state;
+    bb_states_num[numbering.getId(basic_block)] = state;
+}
+
+unsigned int SchedulerMapping::getInitiationInterval(BasicBlock* basic_block) {
+    return bb_ii[numbering.getId(basic_block)];
+}
+
+void SchedulerMapping::setInitiationInterval(BasicBlock* basic_block, unsigned int ii) {
+    bb_ii[numbering.getId(basic_block)] = ii;
 }
 
 Fsm& SchedulerMapping::createFsm() {
     FsmState* wait_state = fsm.createState();
     wait_state->setDefaultTransition(wait_state);
 
-    std::map<BasicBlock*, unsigned int> bb_ids;
-    std::map<BasicBlock*, unsigned int> bb_state_ids; // Значение инкрементируется при добавлении нового состояния в бб
-    std::map<BasicBlock*, FsmState*> bb_first_states;
+    const unsigned int n_bb = numbering.getBasicBlocksNum();
+
+    std::vector<unsigned int> bb_ids(n_bb, 0);
+    std::vector<unsigned int> bb_state_ids(n_bb, 0); // Значение инкрементируется при добавлении нового состояния в бб
+    std::vector<FsmState*> bb_first_states(n_bb, nullptr);
+
+    /* Forwarding basic blocks are bypassed unless they form a cycle */
+    std::map<BasicBlock*, BasicBlock*> bb_forward_lookup;
+
+    for (auto& basic_block : function) {
+        BasicBlock* successor = nullptr;
+
+        if (utility::isForwardingBasicBlock(basic_block, successor)) {
+            bb_forward_lookup[&basic_block] = successor;
+        }
+    }
+
+    for (auto& bb_forward : bb_forward_lookup) {
+        auto* target = bb_forward.second;
+        unsigned int n_steps = 0;
+
+        while ((bb_forward_lookup.count(target) != 0) && (n_steps < bb_forward_lookup.size())) {
+            target = bb_forward_lookup[target];
+            n_steps++;
+        }
+
+        if (bb_forward_lookup.count(target) == 0) {
+            fsm.addBypassedBasicBlock(bb_forward.first);
+            bb_forward.second = target;
+        }
+    }
 
     unsigned int bb_count = 0;
     for (auto& basic_block : function) {
-        bb_ids[&basic_block] = bb_count;
+        bb_ids[numbering.getId(&basic_block)] = bb_count;
 
-        if (utility::isBasicBlockEmpty(basic_block)) {
+        if (utility::isBasicBlockEmpty(basic_block) || fsm.isBypassed(&basic_block)) {
             continue;
         }
 
         FsmState* state = fsm.createState();
 
         state->setBasicBlock(&basic_block);
-        bb_first_states[&basic_block] = state;
-        bb_state_ids[&basic_block] = 0;
+        bb_first_states[numbering.getId(&basic_block)] = state;
+        bb_state_ids[numbering.getId(&basic_block)] = 0;
 
         bb_count++;
     }
 
+    for (auto& bb_forward : bb_forward_lookup) {
+        if (fsm.isBypassed(bb_forward.first)) {
+            bb_first_states[numbering.getId(bb_forward.first)] =
+                bb_first_states[numbering.getId(bb_forward.second)];
+        }
+    }
+
     {
         auto& first_bb = function.front();
         BasicBlock* first_bb_succ = nullptr;
@@ -74,23 +123,28 @@ Fsm& SchedulerMapping::createFsm() {
             wait_state->setTerminatingFlag(true);
             wait_state->setBasicBlock(&first_bb);
         
-            assert(bb_first_states.find(first_bb_succ) != bb_first_states.end());
+            assert(bb_first_states[numbering.getId(first_bb_succ)] != nullptr);
         
-            wait_state->addTransition(bb_first_states[first_bb_succ]);
+            wait_state->addTransition(bb_first_states[numbering.getId(first_bb_succ)]);
         } else {
-            assert(bb_first_states.find(&first_bb) != bb_first_states.end());
-            wait_state->addTransition(bb_first_states[&first_bb]);
+            assert(bb_first_states[numbering.getId(&first_bb)] != nullptr);
+            wait_state->addTransition(bb_first_states[numbering.getId(&first_bb)]);
         }
     }
 
     for (auto& basic_block : function) {
         std::map<unsigned int, FsmState*> bb_states_order;
 
-        if (utility::isBasicBlockEmpty(basic_block)) {
+        if (utility::isBasicBlockEmpty(basic_block) || fsm.isBypassed(&basic_block)) {
+            continue;
+        }
+
+        if (getInitiationInterval(&basic_block) != 0) {
+            createPipelineStates(basic_block, bb_first_states);
             continue;
         }
 
-        bb_states_order[0] = bb_first_states[&basic_block];
+        bb_states_order[0] = bb_first_states[numbering.getId(&basic_block)];
         unsigned int last_state = getBasicBlockStatesNum(&basic_block);
 
         assert(!bb_states_order.empty());
@@ -103,7 +157,8 @@ Fsm& SchedulerMapping::createFsm() {
             unsigned int state_order = getState(&dag.getNode(instr));
             bb_states_order[state_order]->pushInstruction(&instr);
 
-            unsigned int delay_state = Scheduler::getInstructionCycles(instr);
+            unsigned int delay_state = Scheduler::getInstructionCycles(dag.getNode(instr));
+            fsm.setInstructionCycles(&instr, delay_state);
 
             if (delay_state == 0) {
                 fsm.setEndState(&instr, bb_states_order[state_order]);
@@ -149,12 +204,26 @@ Fsm& SchedulerMapping::createFsm() {
 
         std::string new_state_name =
             "BPHLS_F_" + function.getName().str()
-                + "_BB_" + std::to_string(bb_ids[state_bb])
-                + "_S_" + std::to_string(bb_state_ids[state_bb]);
+                + "_BB_" + std::to_string(bb_ids[numbering.getId(state_bb)])
+                + "_S_" + std::to_string(bb_state_ids[numbering.getId(state_bb)]);
 
         state->setName(new_state_name);
 
-        bb_state_ids[state->getBasicBlock()] += 1;
+        bb_state_ids[numbering.getId(state->getBasicBlock())] += 1;
+    }
+
+    for (auto& bb_pipeline : fsm.pipelines()) {
+        auto& pipeline = bb_pipeline.second;
+
+        std::string pipeline_name =
+            "BPHLS_F_" + function.getName().str()
+                + "_BB_" + std::to_string(bb_ids[numbering.getId(pipeline.basic_block)]);
+
+        pipeline.prologue_state->setName(pipeline_name + "_P");
+
+        for (unsigned int i = 0; i < pipeline.ii; i++) {
+            pipeline.kernel_states[i]->setName(pipeline_name + "_K_" + std::to_string(i));
+        }
     }
 
     if (!fsm.states().empty()) {
@@ -162,13 +231,80 @@ Fsm& SchedulerMapping::createFsm() {
         state->setName("BPHLS");
     }
 
+    fsm.numberStates();
+
     return fsm;
 }
 
+void SchedulerMapping::createPipelineStates(BasicBlock& basic_block,
+                                            std::vector<FsmState*>& bb_first_states)
+{
+    auto& pipeline = fsm.addPipeline(&basic_block);
+
+    pipeline.ii = getInitiationInterval(&basic_block);
+    pipeline.prologue_state = bb_first_states[numbering.getId(&basic_block)];
+    pipeline.prologue_state->setBasicBlock(&basic_block);
+
+    /* Kernel states follow the prologue state */
+    FsmState* prev_state = pipeline.prologue_state;
+
+    for (unsigned int i = 0; i < pipeline.ii; i++) {
+        auto* state = fsm.createState(prev_state);
+        state->setBasicBlock(&basic_block);
+
+        pipeline.kernel_states.push_back(state);
+        prev_state = state;
+    }
+
+    pipeline.prologue_state->setDefaultTransition(pipeline.kernel_states.front());
+
+    for (unsigned int i = 0; i + 1 < pipeline.ii; i++) {
+        pipeline.kernel_states[i]->setDefaultTransition(pipeline.kernel_states[i + 1]);
+    }
+
+    /* Iteration time t is executed in kernel state t mod II of stage t / II */
+    pipeline.n_stages = 1;
+
+    for (auto& instr : basic_block) {
+        unsigned int start_time = getState(&dag.getNode(instr));
+        unsigned int cycles = Scheduler::getInstructionCycles(dag.getNode(instr));
+        unsigned int end_time = start_time + cycles;
+
+        fsm.setInstructionCycles(&instr, cycles);
+
+        pipeline.kernel_states[start_time % pipeline.ii]->pushInstruction(&instr);
+        fsm.setEndState(&instr, pipeline.kernel_states[end_time % pipeline.ii]);
+
+        pipeline.start_stage[&instr] = start_time / pipeline.ii;
+        pipeline.end_stage[&instr] = end_time / pipeline.ii;
+
+        pipeline.start_time[&instr] = start_time;
+        pipeline.end_time[&instr] = end_time;
+
+        pipeline.n_stages = std::max(pipeline.n_stages, end_time / pipeline.ii + 1);
+    }
+
+    /* Last kernel state either starts next kernel pass or leaves drained pipeline */
+    auto* branch = cast<BranchInst>(basic_block.getTerminator());
+    assert(branch->isConditional());
+
+    pipeline.branch = branch;
+    pipeline.exit_on_true = (branch->getSuccessor(0) != &basic_block);
+
+    auto* exit_bb = branch->getSuccessor(pipeline.exit_on_true ? 0 : 1);
+    pipeline.exit_state = bb_first_states[numbering.getId(exit_bb)];
+
+    auto* last_state = pipeline.kernel_states.back();
+
+    last_state->setTerminatingFlag(true);
+    last_state->addTransition(pipeline.exit_state);
+    last_state->setDefaultTransition(pipeline.kernel_states.front());
+}
+
 void SchedulerMapping::setFsmStateTransitions(FsmState* last_state,
                                               FsmState* wait_state,
                                               Instruction* term_instr,
-                                              std::map<BasicBlock*, FsmState*> bb_firs_state)
+                                              std::vector<FsmState*>& bb_first_states)
 {
     last_state->setTerminatingFlag(true);
 
@@ -190,7 +326,7 @@ void SchedulerMapping::setFsmStateTransitions(FsmState* last_state,
             assert(value != nullptr);
 
             auto* successor_bb = dyn_cast<BasicBlock>(switch_instr->getOperand(i + 1));
-            FsmState* successor_state = bb_firs_state[successor_bb];
+            FsmState* successor_state = bb_first_states[numbering.getId(successor_bb)];
 
             last_state->addTransition(successor_state, value);
         }
@@ -202,7 +338,7 @@ void SchedulerMapping::setFsmStateTransitions(FsmState* last_state,
             default_branch_bb = dyn_cast<BasicBlock>(term_instr->getSuccessor(1));
 
             auto* successor_bb = dyn_cast<BasicBlock>(branch_instr->getSuccessor(0));
-            FsmState* successor_state = bb_firs_state[successor_bb];
+            FsmState* successor_state = bb_first_states[numbering.getId(successor_bb)];
 
             last_state->addTransition(successor_state);
         } else {
@@ -213,5 +349,5 @@ void SchedulerMapping::setFsmStateTransitions(FsmState* last_state,
         llvm_unreachable(0);
     }
 
-    last_state->setDefaultTransition(bb_firs_state[default_branch_bb]);
+    last_state->setDefaultTransition(bb_first_states[numbering.getId(default_branch_bb)]);
 }
\ No newline at end of file
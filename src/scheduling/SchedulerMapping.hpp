@@ -1,13 +1,14 @@
 #ifndef __SCHEDULING_SCHEDULER_MAPPING_HPP__
 #define __SCHEDULING_SCHEDULER_MAPPING_HPP__
 
-#include <map>
+#include <vector>
 
 #include <llvm/IR/Function.h>
 #include <llvm/IR/BasicBlock.h>
 #include <llvm/IR/Instruction.h>
 #include <llvm/IR/Instructions.h>
 
+#include "../utility/FunctionNumbering.hpp"
 #include "InstructionNode.hpp"
 #include "Dag.hpp"
 #include "fsm/FsmState.hpp"
@@ -28,23 +29,31 @@ public:
 
     void setBasicBlockStatesNum(BasicBlock* basic_block, unsigned int state);
 
-    Fsm& createFsm();
+    unsigned int getInitiationInterval(BasicBlock* basic_block);
+
+    void setInitiationInterval(BasicBlock* basic_block, unsigned int ii);
 
-    std::map<InstructionNode*, unsigned int>& getMap() { return instr_state_lookup; }
+    Fsm& createFsm();
 
 private:
     Function& function;
     Dag& dag;
+    utility::FunctionNumbering& numbering;
 
     Fsm fsm;
 
-    std::map<InstructionNode*, unsigned int> instr_state_lookup;
-    std::map<BasicBlock*, unsigned int> bb_states_num_lookup;
+    /* Indexed by node id and basic block id of the function numbering */
+    std::vector<unsigned int> instr_states;
+    std::vector<unsigned int> bb_states_num;
+    std::vector<unsigned int> bb_ii;
+
+    void createPipelineStates(BasicBlock& basic_block,
+                              std::vector<FsmState*>& bb_first_states);
 
     void setFsmStateTransitions(FsmState* last_state,
                                 FsmState* wait_state,
                                 Instruction* term_instr,
-                                std::map<BasicBlock*, FsmState*> bb_firs_state);
+                                std::vector<FsmState*>& bb_first_states);
 };
 
     } /* namespace bphls */ 
@@ -1,13 +1,27 @@
 #include <iostream>
+#include <map>
 #include <set>
+#include <memory>
+#include <vector>
 
 #include <llvm/IR/Function.h>
 #include <llvm/IR/BasicBlock.h>
 #include <llvm/IR/Instruction.h>
-
-#include <lpsolve/lp_lib.h>
+#include <llvm/IR/Instructions.h>
+#include <llvm/IR/InstrTypes.h>
+#include <llvm/Support/CommandLine.h>
+#include <llvm/Support/raw_ostream.h>
 
 #include "../hardware/HardwareConstraints.hpp"
+#include "../utility/instruction_utility.hpp"
+#include "../utility/log_utility.hpp"
+#include "../utility/PhaseProfile.hpp"
+#include "sdc/SdcSolver.hpp"
+#include "sdc/IncrementalSdcSolver.hpp"
+#include "sdc/GraphSdcSolver.hpp"
+#ifdef LPSOLVE
+#include "sdc/LpSdcSolver.hpp"
+#endif
 #include "Dag.hpp"
 #include "SchedulerMapping.hpp"
 
@@ -16,18 +30,156 @@
 using namespace llvm;
 using namespace bphls;
 
-extern llvm::bphls::hardware::HardwareConstraints* constraints;
-
-SdcScheduler::SdcScheduler(Function& function, Dag& dag)
+enum SdcSolverKind {
+    LpSolver,
+    IncrementalSolver,
+    GraphSolver,
+};
+
+static cl::opt<SdcSolverKind> sched_solver(
+    "sched-solver",
+    cl::desc("Scheduling constraint solver"),
+    cl::init(IncrementalSolver),
+    cl::values(
+        clEnumValN(LpSolver, "lp", "General LP solver (lp_solve)"),
+        clEnumValN(IncrementalSolver, "incremental", "Incremental difference constraint solver"),
+        clEnumValN(GraphSolver, "graph", "Longest path solver over CSR constraint graph")
+    )
+);
+
+static cl::opt<bool> sched_chaining(
+    "sched-chaining",
+    cl::desc("Chain dependent operations within a clock period"),
+    cl::init(true)
+);
+
+static cl::opt<unsigned int> pipeline_ii(
+    "pipeline-ii",
+    cl::desc("Target initiation interval of pipelined loops (0 - no pipelining)"),
+    cl::init(0)
+);
+
+static cl::opt<bool> sched_latency_report(
+    "sched-latency-report",
+    cl::desc("Report latency reduction from operation chaining"),
+    cl::init(false)
+);
+
+SdcScheduler::SdcScheduler(Function& function, Dag& dag, hardware::HardwareConstraints& constraints)
     : function(function),
       dag(dag),
+      constraints(constraints),
       n_instr(0),
+      n_lp_var(0),
+      is_pure_sdc(true),
+      is_chaining_enabled(sched_chaining),
       mapping(function, dag) {}
 
+void SdcScheduler::setChainingEnabled(bool enabled) {
+    is_chaining_enabled = enabled;
+}
+
+static std::string getBasicBlockLabel(BasicBlock& basic_block) {
+    std::string label;
+    raw_string_ostream out(label);
+
+    basic_block.printAsOperand(out, false);
+
+    return out.str();
+}
+
+bool SdcScheduler::isChainable(InstructionNode& instr_node) {
+    auto& instr = instr_node.getInstruction();
+
+    /* Combinational datapath operations and extensions (wiring) only */
+    return (isa<BinaryOperator>(instr)
+            || isa<ICmpInst>(instr)
+            || isa<ZExtInst>(instr)
+            || isa<SExtInst>(instr))
+        && (SdcScheduler::getInstructionCycles(instr_node) == 0);
+}
+
+bool SdcScheduler::isChained(InstructionNode& dep_instr_node, InstructionNode& instr_node) {
+    return is_chaining_enabled
+        && isChainable(dep_instr_node)
+        && isChainable(instr_node);
+}
+
 SchedulerMapping& SdcScheduler::schedule() {
-    unsigned int n_lp_var = createLpVariables();
+    n_lp_var = createLpVariables();
+
+    findPipelinedLoops();
+
+    /* Pipelined loops must beat their sequential schedules */
+    std::map<BasicBlock*, unsigned int> loop_cycles;
+
+    if (!loop_ii_lookup.empty()) {
+        auto pipelined_loops = loop_ii_lookup;
+        loop_ii_lookup.clear();
+
+        scheduleRelaxed();
+        getLoopCycles(pipelined_loops, loop_cycles);
+
+        loop_ii_lookup = pipelined_loops;
+    }
+
+    scheduleRelaxed();
+
+    if (dropSlowPipelines(loop_cycles)) {
+        scheduleRelaxed();
+    }
+
+    mapSchedule();
+
+    reportPipelinedLoops();
 
-    lp_solver = make_lp(0, n_lp_var);
+    if (sched_latency_report && is_chaining_enabled) {
+        reportLatency();
+    }
+
+    // TODO ? Add register type for roots and sinks of multicycle paths
+
+    solver.reset();
+    constraint_log.clear();
+
+    return mapping;
+}
+
+void SdcScheduler::scheduleRelaxed() {
+    while (true) {
+        std::set<BasicBlock*> failed_loops;
+
+        if (scheduleConstrained(failed_loops)) {
+            break;
+        }
+
+        if (loop_ii_lookup.empty()) {
+            reportInfeasibleCycle();
+            report_fatal_error("SDC solver could not find an optimal solution");
+        }
+
+        relaxPipelinedLoops(failed_loops);
+    }
+}
+
+bool SdcScheduler::scheduleConstrained(std::set<BasicBlock*>& failed_loops) {
+    constraint_log.clear();
+    is_pure_sdc = true;
+
+    /* Constraint system is kept live for all the scheduling passes */
+    switch (sched_solver) {
+    case LpSolver:
+        fallbackToLp();
+        break;
+    case IncrementalSolver:
+        solver = std::make_unique<sdc::IncrementalSdcSolver>(n_lp_var);
+        break;
+    case GraphSolver:
+        solver = std::make_unique<sdc::GraphSdcSolver>(n_lp_var);
+        break;
+    }
+
+    utility::PhaseProfile::count("sdc.columns", n_lp_var);
 
     /* Add multicycle variable constraints */
     addMulticycleConstraints();
@@ -38,357 +190,799 @@ SchedulerMapping& SdcScheduler::schedule() {
     /* Add timing constraints */
     addTimingConstraints();
 
+    /* Add loop-carried and register lifetime constraints of pipelined loops */
+    addPipelineConstraints();
+
     /* Schdule with ASAP strategy */
-    scheduleAsap();
+    if (!scheduleAsap()) {
+        /* Initiation interval is below recurrence bound */
+        getInfeasibleLoops(failed_loops);
+        return false;
+    }
 
 #ifndef NDEBUG
-    std::cout << "ASAP scheduling:" << std::endl;
+    utility::logs() << "ASAP scheduling:\n";
     printLp();
 #endif
 
     /* Take into account resourse constraints */
-    scheduleResourseConstrained();
+    if (!scheduleResourseConstrained()) {
+        getInfeasibleLoops(failed_loops);
+        return false;
+    }
+
+    /* Place pipelined loops operations into modulo reservation tables */
+    if (!scheduleModulo(failed_loops)) {
+        return false;
+    }
 
 #ifndef NDEBUG
-    std::cout << "Resource constrained scheduling:" << std::endl;
+    utility::logs() << "Resource constrained scheduling:\n";
     printLp();
 #endif
 
-    mapSchedule();
+    return true;
+}
 
-    // TODO ? Add register type for roots and sinks of multicycle paths
+bool SdcScheduler::isPipelinable(BasicBlock& basic_block) {
+    auto* branch = dyn_cast<BranchInst>(basic_block.getTerminator());
 
-    delete_lp(lp_solver);
+    /* Single basic block loop with conditional exit */
+    if ((branch == nullptr)
+            || !branch->isConditional()
+            || ((branch->getSuccessor(0) == &basic_block) == (branch->getSuccessor(1) == &basic_block)))
+    {
+        return false;
+    }
 
-    return mapping;
+    for (auto& instr : basic_block) {
+        /* Memory and calls are not ordered across iterations */
+        if (instr.mayReadOrWriteMemory() || isa<CallInst>(instr)) {
+            return false;
+        }
+
+        auto* phi = dyn_cast<PHINode>(&instr);
+
+        if (phi == nullptr) {
+            continue;
+        }
+
+        if (phi->getNumIncomingValues() != 2) {
+            return false;
+        }
+
+        /* Loop-carried value is produced by the loop body */
+        auto* back_instr = dyn_cast<Instruction>(phi->getIncomingValueForBlock(&basic_block));
+
+        if ((back_instr == nullptr)
+                || isa<PHINode>(back_instr)
+                || (back_instr->getParent() != &basic_block))
+        {
+            return false;
+        }
+
+        /* Phi register holds next iteration value after loop exit */
+        for (auto* user : phi->users()) {
+            auto* user_instr = dyn_cast<Instruction>(user);
+
+            if ((user_instr == nullptr) || (user_instr->getParent() != &basic_block)) {
+                return false;
+            }
+        }
+    }
+
+    return true;
 }
 
-unsigned int SdcScheduler::createLpVariables() {
-    unsigned int n_lpvar = 0;
+void SdcScheduler::findPipelinedLoops() {
+    if (pipeline_ii == 0) {
+        return;
+    }
 
     for (auto& basic_block : function) {
+        if (isPipelinable(basic_block)) {
+            loop_ii_lookup[&basic_block] = pipeline_ii;
+        }
+    }
+}
+
+unsigned int SdcScheduler::getMaxInitiationInterval(BasicBlock& basic_block) {
+    /* Sequential schedule of the loop body always fits */
+    unsigned int max_ii = 1;
+
+    for (auto& instr : basic_block) {
+        max_ii += SdcScheduler::getInstructionCycles(dag.getNode(instr)) + 1;
+    }
+
+    return std::max<unsigned int>(max_ii, pipeline_ii);
+}
+
+void SdcScheduler::relaxPipelinedLoops(std::set<BasicBlock*>& failed_loops) {
+    std::vector<BasicBlock*> relaxed_loops;
+
+    for (auto& loop_ii : loop_ii_lookup) {
+        if (failed_loops.empty() || (failed_loops.count(loop_ii.first) != 0)) {
+            relaxed_loops.push_back(loop_ii.first);
+        }
+    }
+
+    for (auto* basic_block : relaxed_loops) {
+        auto& ii = loop_ii_lookup[basic_block];
+        ii += 1;
+
+        if (ii > getMaxInitiationInterval(*basic_block)) {
+            errs() << "Loop " << getBasicBlockLabel(*basic_block)
+                << " of function " << function.getName()
+                << " could not be pipelined\n";
+
+            loop_ii_lookup.erase(basic_block);
+        }
+    }
+}
+
+void SdcScheduler::getLoopCycles(std::map<BasicBlock*, unsigned int>& loops,
+                                 std::map<BasicBlock*, unsigned int>& loop_cycles)
+{
+    for (auto& loop : loops) {
+        unsigned int n_cycles = 1;
+
+        for (auto& instr : *loop.first) {
+            auto end_lpvar = node_lp_vars[dag.getNode(instr).getId()].second;
+            n_cycles = std::max<unsigned int>(n_cycles, solver->getValue(end_lpvar) + 1);
+        }
+
+        loop_cycles[loop.first] = n_cycles;
+    }
+}
+
+bool SdcScheduler::dropSlowPipelines(std::map<BasicBlock*, unsigned int>& loop_cycles) {
+    std::vector<BasicBlock*> slow_loops;
+
+    /* Fill and drain passes are not paid back unless an iteration is issued
+     * before the previous one would have finished */
+    for (auto& loop_ii : loop_ii_lookup) {
+        if (loop_ii.second >= loop_cycles[loop_ii.first]) {
+            slow_loops.push_back(loop_ii.first);
+        }
+    }
+
+    for (auto* basic_block : slow_loops) {
+        utility::logs() << "Loop " << getBasicBlockLabel(*basic_block)
+            << " of function " << function.getName()
+            << " is not pipelined, II: " << loop_ii_lookup[basic_block]
+            << " sequential cycles: " << loop_cycles[basic_block]
+            << "\n";
+
+        loop_ii_lookup.erase(basic_block);
+    }
+
+    return !slow_loops.empty();
+}
+
+void SdcScheduler::getInfeasibleLoops(std::set<BasicBlock*>& failed_loops) {
+    std::map<unsigned int, BasicBlock*> lp_var_loops;
+
+    for (unsigned int id = 0; id < node_lp_vars.size(); id++) {
+        auto* basic_block = dag.getNode(id).getInstruction().getParent();
+
+        if (loop_ii_lookup.count(basic_block) == 0) {
+            continue;
+        }
+
+        for (unsigned int i = node_lp_vars[id].first; i <= node_lp_vars[id].second; i++) {
+            lp_var_loops[i] = basic_block;
+        }
+    }
+
+    /* Unknown cycle relaxes all loops */
+    for (auto lp_var : solver->getInfeasibleCycle()) {
+        if (lp_var_loops.count(lp_var) != 0) {
+            failed_loops.insert(lp_var_loops[lp_var]);
+        }
+    }
+}
+
+void SdcScheduler::addPipelineConstraints() {
+    for (auto& loop_ii : loop_ii_lookup) {
+        auto& basic_block = *loop_ii.first;
+        const double ii = loop_ii.second;
+
+        auto* branch = basic_block.getTerminator();
+        auto branch_start_lpvar = node_lp_vars[dag.getNode(*branch).getId()].first;
+
         for (auto& instr : basic_block) {
             auto& instr_node = dag.getNode(instr);
 
-            const unsigned int clk_latency = getInstructionCycles(instr);
+            if (auto* phi = dyn_cast<PHINode>(&instr)) {
+                auto* back_instr = cast<Instruction>(phi->getIncomingValueForBlock(&basic_block));
+                auto back_end_lpvar = node_lp_vars[dag.getNode(*back_instr).getId()].second;
+
+                /* Next iteration reads phi register after it is written, later
+                 * reads of the current iteration use its stage copies */
+                for (auto* user : phi->users()) {
+                    auto& user_node = dag.getNode(*cast<Instruction>(user));
+                    auto user_start_lpvar = node_lp_vars[user_node.getId()].first;
+
+                    addConstraint(
+                        { { user_start_lpvar, 1.0 }, { back_end_lpvar, -1.0 } },
+                        sdc::SdcSolver::Ge,
+                        1.0 - ii
+                    );
+                }
+
+                continue;
+            }
+
+            /* Iterations issued before the exit is resolved are squashed, they
+             * must not overwrite values read after the loop before that */
+            bool is_live_out = false;
+
+            for (auto* user : instr.users()) {
+                auto* user_instr = dyn_cast<Instruction>(user);
+
+                if ((user_instr == nullptr) || (user_instr->getParent() != &basic_block)) {
+                    is_live_out = true;
+                }
+            }
+
+            if (is_live_out) {
+                auto end_lpvar = node_lp_vars[instr_node.getId()].second;
+
+                addConstraint(
+                    { { end_lpvar, 1.0 }, { branch_start_lpvar, -1.0 } },
+                    sdc::SdcSolver::Ge,
+                    1.0 - ii
+                );
+            }
+        }
+    }
+}
+
+bool SdcScheduler::scheduleModulo(std::set<BasicBlock*>& failed_loops) {
+    for (auto& loop_ii : loop_ii_lookup) {
+        auto& basic_block = *loop_ii.first;
+        const unsigned int ii = loop_ii.second;
+
+        std::map<hardware::FunctionalUnit*, std::vector<InstructionNode*>> fu_instr_nodes;
+
+        for (auto& instr : basic_block) {
+            auto* fu = constraints.getInstructionFu(instr);
+
+            if ((fu != nullptr) && constraints.getFuNumConstraint(*fu).has_value()) {
+                fu_instr_nodes[fu].push_back(&dag.getNode(instr));
+            }
+        }
+
+        /* Only oversubscribed units may conflict in a kernel state */
+        std::vector<InstructionNode*> constrained_instr_nodes;
+
+        for (auto& fu_instr : fu_instr_nodes) {
+            if (fu_instr.second.size() > constraints.getFuNumConstraint(*fu_instr.first).value()) {
+                constrained_instr_nodes.insert(
+                    constrained_instr_nodes.end(),
+                    fu_instr.second.begin(),
+                    fu_instr.second.end()
+                );
+            }
+        }
+
+        auto predicate_asap = [&](InstructionNode* instr_a, InstructionNode* instr_b) {
+            auto lp_var_a = node_lp_vars[instr_a->getId()].first;
+            auto lp_var_b = node_lp_vars[instr_b->getId()].first;
+
+            int diff = solver->getValue(lp_var_a) - solver->getValue(lp_var_b);
+
+            return (diff < 0) || ((diff == 0) && (lp_var_a < lp_var_b));
+        };
+
+        std::sort(
+            constrained_instr_nodes.begin(),
+            constrained_instr_nodes.end(),
+            predicate_asap
+        );
+
+        /* Modulo reservation table: FU usage in every kernel state */
+        std::map<std::pair<unsigned int, hardware::FunctionalUnit*>, unsigned int> mrt;
+
+        for (auto* instr_node : constrained_instr_nodes) {
+            auto* fu = constraints.getInstructionFu(instr_node->getInstruction());
+            unsigned int fu_num = constraints.getFuNumConstraint(*fu).value();
+
+            auto start_lpvar = node_lp_vars[instr_node->getId()].first;
+            unsigned int asap_state = solver->getValue(start_lpvar);
+
+            bool is_placed = false;
+
+            for (unsigned int state = asap_state; state < asap_state + ii; state++) {
+                auto& fu_usage = mrt[std::make_pair(state % ii, fu)];
+
+                if (fu_usage >= fu_num) {
+                    continue;
+                }
+
+                auto id = addConstraint({ { start_lpvar, 1.0 } }, sdc::SdcSolver::Eq, state);
+
+                if (scheduleAsap()) {
+                    fu_usage += 1;
+                    is_placed = true;
+                    break;
+                }
+
+                removeConstraint(id);
+            }
+
+            if (!is_placed) {
+                failed_loops.insert(&basic_block);
+                return false;
+            }
+        }
+    }
 
-            instr_node_lp_var_lookup[&instr_node] =
-                std::make_pair(n_lpvar, n_lpvar + clk_latency);
+    return true;
+}
+
+void SdcScheduler::reportPipelinedLoops() {
+    for (auto& loop_ii : loop_ii_lookup) {
+        auto& basic_block = *loop_ii.first;
+        const unsigned int ii = loop_ii.second;
 
-            n_lpvar += clk_latency + 1;
-            n_instr += 1;
+        unsigned int n_stages = 1;
+
+        for (auto& instr : basic_block) {
+            unsigned int end_state =
+                mapping.getState(&dag.getNode(instr))
+                    + SdcScheduler::getInstructionCycles(dag.getNode(instr));
+
+            n_stages = std::max(n_stages, end_state / ii + 1);
         }
+
+        utility::logs() << "Pipelined loop: " << function.getName()
+            << " BB: " << getBasicBlockLabel(basic_block)
+            << " target II: " << pipeline_ii
+            << " achieved II: " << ii
+            << " stages: " << n_stages
+            << "\n";
+    }
+}
+
+SdcScheduler::ConstraintId SdcScheduler::addConstraint(Row row, ConstraintType type, double rhs) {
+    if (is_pure_sdc && !sdc::SdcSolver::isDifferenceRow(row)) {
+        fallbackToLp();
+    }
+
+    ConstraintId id = constraint_log.size();
+    auto solver_id = solver->addConstraint(row, type, rhs);
+
+    utility::PhaseProfile::count("sdc.rows");
+
+    constraint_log.push_back(ConstraintRecord { row, type, rhs, solver_id, true });
+
+    return id;
+}
+
+void SdcScheduler::removeConstraint(ConstraintId id) {
+    auto& record = constraint_log[id];
+    assert(record.alive);
+
+    solver->removeConstraint(record.solver_id);
+    record.alive = false;
+}
+
+void SdcScheduler::fallbackToLp() {
+    is_pure_sdc = false;
+
+    utility::PhaseProfile::count("sdc.lp_fallbacks");
+
+#ifdef LPSOLVE
+    /* Replay live constraints into warm-started LP model */
+    solver = std::make_unique<sdc::LpSdcSolver>(n_lp_var);
+
+    for (auto& record : constraint_log) {
+        if (record.alive) {
+            record.solver_id = solver->addConstraint(record.row, record.type, record.rhs);
+        }
+    }
+#else
+    report_fatal_error("LP solver is required but bitpack-hls was built without lp_solve");
+#endif
+}
+
+void SdcScheduler::reportInfeasibleCycle() {
+    auto cycle = solver->getInfeasibleCycle();
+
+    if (cycle.empty()) {
+        return;
+    }
+
+    std::map<unsigned int, InstructionNode*> lp_var_instr_nodes;
+
+    for (unsigned int id = 0; id < node_lp_vars.size(); id++) {
+        for (unsigned int i = node_lp_vars[id].first; i <= node_lp_vars[id].second; i++) {
+            lp_var_instr_nodes[i] = &dag.getNode(id);
+        }
+    }
+
+    errs() << "Infeasible scheduling constraints cycle:\n";
+
+    InstructionNode* prev_instr_node = nullptr;
+
+    for (auto lp_var : cycle) {
+        auto* instr_node = lp_var_instr_nodes[lp_var];
+
+        /* Multicycle instructions occupy several consecutive variables */
+        if (instr_node == prev_instr_node) {
+            continue;
+        }
+
+        errs() << "\t" << instr_node->getInstruction().getParent()->getName() << ":";
+        errs() << instr_node->getInstruction() << "\n";
+
+        prev_instr_node = instr_node;
+    }
+}
+
+unsigned int SdcScheduler::createLpVariables() {
+    unsigned int n_lpvar = 0;
+
+    /* Node ids follow layout order, so do the variables */
+    node_lp_vars.resize(dag.getNodesNum());
+
+    for (unsigned int id = 0; id < dag.getNodesNum(); id++) {
+        const unsigned int clk_latency = getInstructionCycles(dag.getNode(id));
+
+        node_lp_vars[id] = std::make_pair(n_lpvar, n_lpvar + clk_latency);
+
+        n_lpvar += clk_latency + 1;
+        n_instr += 1;
     }
 
     return n_lpvar;
 }
 
 void SdcScheduler::addMulticycleConstraints() {
-    int lpvar_col[2] = { 0, 0 };
-    double lpvar_coeff[2] = { 0.0, 0.0 };
-
-    for (auto& instr_node_lpvar : instr_node_lp_var_lookup) {
-        auto start_lpvar = instr_node_lpvar.second.first;
-        auto end_lpvar = instr_node_lpvar.second.second;
+    for (auto& lp_vars : node_lp_vars) {
+        auto start_lpvar = lp_vars.first;
+        auto end_lpvar = lp_vars.second;
 
         if (start_lpvar == end_lpvar) {
             continue;
         }
 
         for (unsigned int i = start_lpvar + 1; i <= end_lpvar; i++) {
-            lpvar_col[0] = 1 + i;
-            lpvar_col[1] = 1 + (i - 1);
-
-            lpvar_coeff[0] = 1.0;
-            lpvar_coeff[1] = -1.0;
-
-            add_constraintex(lp_solver, 2, lpvar_coeff, lpvar_col, EQ, 1.0);
+            addConstraint({ { i, 1.0 }, { i - 1, -1.0 } }, sdc::SdcSolver::Eq, 1.0);
         }
     }
 }
 
 void SdcScheduler::addDependencyConstraints() {
-    int lpvar_col[2] = { 0, 0 };
-    double lpvar_coeff[2] = { 0.0, 0.0 };
-
     for (auto& basic_block : function) {
         for (auto& instr : basic_block) {
             auto& instr_node = dag.getNode(instr);
+            auto start_lpvar = node_lp_vars[instr_node.getId()].first;
 
-            lpvar_col[0] = 1 + instr_node_lp_var_lookup[&instr_node].first;
-            lpvar_coeff[0] = 1.0;
-            add_constraintex(lp_solver, 1, lpvar_coeff, lpvar_col, GE, 0.0);
+            addConstraint({ { start_lpvar, 1.0 } }, sdc::SdcSolver::Ge, 0.0);
 
             for (auto dep_instr : instr_node.dependencies()) {
-                lpvar_col[0] = 1 + instr_node_lp_var_lookup[&instr_node].first;
-                lpvar_col[1] = 1 + instr_node_lp_var_lookup[dep_instr].second;
-
-                lpvar_coeff[0] = 1.0;
-                lpvar_coeff[1] = -1.0;
-
-                add_constraintex(lp_solver, 2, lpvar_coeff, lpvar_col, GE, 1.0); // TODO Only no chaining option
+                auto dep_end_lpvar = node_lp_vars[dep_instr->getId()].second;
+
+                /* Chained operations may share a state, see timing constraints.
+                 * Phi is a register loaded on transition into basic block, its
+                 * users share the first state only when chaining is enabled.
+                 * Pipelined loop exit is checked combinationally in its state */
+                bool is_phi = is_chaining_enabled && isa<PHINode>(dep_instr->getInstruction());
+
+                bool is_pipelined_exit =
+                    (loop_ii_lookup.count(&basic_block) != 0)
+                        && instr.isTerminator()
+                        && isChainable(*dep_instr);
+
+                bool is_chained =
+                    isChained(*dep_instr, instr_node) || is_phi || is_pipelined_exit;
+
+                addConstraint(
+                    { { start_lpvar, 1.0 }, { dep_end_lpvar, -1.0 } },
+                    sdc::SdcSolver::Ge,
+                    is_chained ? 0.0 : 1.0
+                );
             }
 
             for (auto* mem_dep_instr : instr_node.memory_dependencies()) {
-                lpvar_col[0] = 1 + instr_node_lp_var_lookup[&instr_node].first;
-                lpvar_col[1] = 1 + instr_node_lp_var_lookup[mem_dep_instr].second;
-
-                lpvar_coeff[0] = 1.0;
-                lpvar_coeff[1] = -1.0;
+                auto dep_end_lpvar = node_lp_vars[mem_dep_instr->getId()].second;
 
-                add_constraintex(lp_solver, 2, lpvar_coeff, lpvar_col, GE, 0.0);
+                addConstraint(
+                    { { start_lpvar, 1.0 }, { dep_end_lpvar, -1.0 } },
+                    sdc::SdcSolver::Ge,
+                    0.0
+                );
             }
         }
     }
 }
 
 void SdcScheduler::addTimingConstraints() {
-    // TODO Implement method
-}
+    if (!is_chaining_enabled) {
+        return;
+    }
 
-void SdcScheduler::addAlapConstraints() {
-    double* lp_vars = new double[get_Nrows(lp_solver)];
-    get_variables(lp_solver, lp_vars);
+    const float clock_period = constraints.max_delay;
 
-    std::map<BasicBlock*, unsigned int> bb_max_cycles;
+    /* Longest combinational path delay from every chained source node id,
+     * dependencies are block local so tables are released per block */
+    std::vector<std::map<unsigned int, float>> path_delays(dag.getNodesNum());
 
     for (auto& basic_block : function) {
         for (auto& instr : basic_block) {
-            unsigned int end_lpvar = instr_node_lp_var_lookup[&dag.getNode(instr)].second;
-            unsigned int assigned_state = lp_vars[end_lpvar];
+            auto& instr_node = dag.getNode(instr);
+            auto& instr_path_delays = path_delays[instr_node.getId()];
 
-            bb_max_cycles[&basic_block] = std::max(bb_max_cycles[&basic_block], assigned_state);
+            instr_path_delays[instr_node.getId()] = instr_node.getDelay();
+
+            for (auto* dep_instr : instr_node.dependencies()) {
+                if (!isChained(*dep_instr, instr_node)) {
+                    continue;
+                }
+
+                for (auto& src_delay : path_delays[dep_instr->getId()]) {
+                    float delay = src_delay.second + instr_node.getDelay();
+                    auto& max_delay = instr_path_delays[src_delay.first];
+
+                    max_delay = std::max(max_delay, delay);
+                }
+            }
+
+            auto start_lpvar = node_lp_vars[instr_node.getId()].first;
+
+            for (auto iter = instr_path_delays.begin(); iter != instr_path_delays.end();) {
+                if (iter->second <= clock_period) {
+                    iter++;
+                    continue;
+                }
+
+                /* Path does not fit the clock period, register it. Longer paths
+                 * through this node are cut by the dependency constraints */
+                auto src_end_lpvar = node_lp_vars[iter->first].second;
+
+                addConstraint(
+                    { { start_lpvar, 1.0 }, { src_end_lpvar, -1.0 } },
+                    sdc::SdcSolver::Ge,
+                    1.0
+                );
+
+                iter = instr_path_delays.erase(iter);
+            }
+        }
+
+        for (auto& instr : basic_block) {
+            path_delays[dag.getNode(instr).getId()].clear();
         }
     }
+}
+
+void SdcScheduler::addAlapConstraints(std::vector<ConstraintId>& alap_constraints) {
+    auto& numbering = dag.getNumbering();
+    std::vector<unsigned int> bb_max_cycles(numbering.getBasicBlocksNum(), 0);
 
-    int lp_var_col[1] = { 0 };
-    double lp_var_coeff[1] = { 0.0 };
+    for (unsigned int id = 0; id < node_lp_vars.size(); id++) {
+        auto* basic_block = dag.getNode(id).getInstruction().getParent();
+        unsigned int assigned_state = solver->getValue(node_lp_vars[id].second);
+
+        auto& max_cycles = bb_max_cycles[numbering.getId(basic_block)];
+        max_cycles = std::max(max_cycles, assigned_state);
+    }
 
     for (auto& basic_block : function) {
         for (auto& instr : basic_block) {
             auto& instr_node = dag.getNode(instr);
 
-            int start_lp_var_idx = instr_node_lp_var_lookup[&instr_node].first;
-            int end_lp_var_idx = instr_node_lp_var_lookup[&instr_node].second;
-
-            lp_var_col[0] = 1 + end_lp_var_idx;
-            lp_var_coeff[0] = 1.0;
+            unsigned int start_lp_var_idx = node_lp_vars[instr_node.getId()].first;
+            unsigned int end_lp_var_idx = node_lp_vars[instr_node.getId()].second;
 
             if (!instr.isTerminator()
                 && (instr_node.dependencies().empty())
-                && (static_cast<unsigned int>(lp_vars[start_lp_var_idx]) == 0))
+                && (solver->getValue(start_lp_var_idx) == 0))
             {
                 double end_state = end_lp_var_idx - start_lp_var_idx;
-                unsigned int latency = SdcScheduler::getInstructionCycles(instr);
+                unsigned int latency = SdcScheduler::getInstructionCycles(instr_node);
 
                 assert(end_state == latency);
 
-                add_constraintex(lp_solver, 1, lp_var_coeff, lp_var_col, EQ, end_state);
+                alap_constraints.push_back(
+                    addConstraint({ { end_lp_var_idx, 1.0 } }, sdc::SdcSolver::Eq, end_state)
+                );
             } else {
-                add_constraintex(lp_solver, 1, lp_var_coeff, lp_var_col, LE, (double) bb_max_cycles[&basic_block]);
+                alap_constraints.push_back(
+                    addConstraint(
+                        { { end_lp_var_idx, 1.0 } },
+                        sdc::SdcSolver::Le,
+                        (double) bb_max_cycles[numbering.getId(&basic_block)]
+                    )
+                );
             }
         }
     }
-
-    delete[] lp_vars;
-    lp_vars = nullptr;
 }
 
-static double* static_lp_var_coeffs;
-static std::map<InstructionNode*, std::pair<unsigned int, unsigned int>>* static_lp_var_lookup;
-
-bool predicateAlap(InstructionNode* instr_a, InstructionNode* instr_b) {
-  int diff =
-    (int) static_lp_var_coeffs[(*static_lp_var_lookup)[instr_a].first]
-        - (int) static_lp_var_coeffs[(*static_lp_var_lookup)[instr_b].first];
+void SdcScheduler::addResourseConstraint(
+    hardware::FunctionalUnit* fu,
+    unsigned int constraint,
+    const std::vector<int>& alap_schedule
+) {
+    std::vector<InstructionNode*> constrained_instr_nodes;
 
-  if (diff < 0) {
-    return true;
-  } else if (diff == 0) {
-    return ((*static_lp_var_lookup)[instr_a].first
-                - (*static_lp_var_lookup)[instr_b].first) < 0;
-  } else {
-      return false;
-  }
-}
+    auto predicate_alap = [&](InstructionNode* instr_a, InstructionNode* instr_b) {
+        auto lp_var_a = node_lp_vars[instr_a->getId()].first;
+        auto lp_var_b = node_lp_vars[instr_b->getId()].first;
 
-void SdcScheduler::addResourseConstraint(unsigned int opcode, unsigned int constraint) {
-    static_lp_var_coeffs = new double[get_Nrows(lp_solver)];
-    static_lp_var_lookup = &instr_node_lp_var_lookup;
+        int diff = alap_schedule[lp_var_a] - alap_schedule[lp_var_b];
 
-    get_variables(lp_solver, static_lp_var_coeffs);
-    std::vector<InstructionNode*> constrained_instr_nodes;
+        return (diff < 0) || ((diff == 0) && (lp_var_a < lp_var_b));
+    };
 
     for (auto& basic_block : function) {
+        /* Pipelined loops are constrained by modulo reservation table */
+        if (loop_ii_lookup.count(&basic_block) != 0) {
+            continue;
+        }
+
         constrained_instr_nodes.clear();
 
         for (auto& instr : basic_block) {
             auto& instr_node = dag.getNode(instr);
 
-            unsigned int instr_opcode = instr.getOpcode();
-
-            if (instr_opcode == opcode) {
+            /* Narrowed operations of one opcode may use different units */
+            if (constraints.getInstructionFu(instr) == fu) {
                 constrained_instr_nodes.push_back(&instr_node);
             }
         }
-    }
 
-    std::sort(
-        constrained_instr_nodes.begin(),
-        constrained_instr_nodes.end(),
-        predicateAlap
-    );
+        std::sort(
+            constrained_instr_nodes.begin(),
+            constrained_instr_nodes.end(),
+            predicate_alap
+        );
 
-    int lpvar_col[2] = { 0, 0 };
-    double lpvar_coeff[2] = { 0.0, 0.0 };
+        for (unsigned int i = constraint; i < constrained_instr_nodes.size(); i++) {
+            auto* instr_a = constrained_instr_nodes[i];
+            auto* instr_b = constrained_instr_nodes[i - constraint];
 
-    for (unsigned int i = constraint; i < constrained_instr_nodes.size(); i++) {
-        auto* instr_a = constrained_instr_nodes[i];
-        auto* instr_b = constrained_instr_nodes[i - constraint];
+            auto lpvar_a = node_lp_vars[instr_a->getId()].first;
+            auto lpvar_b = node_lp_vars[instr_b->getId()].first;
 
-        lpvar_col[0] = 1 + instr_node_lp_var_lookup[instr_a].first;
-        lpvar_col[1] = 1 + instr_node_lp_var_lookup[instr_b].first;
-
-        lpvar_coeff[0] = 1.0;
-        lpvar_coeff[1] = -1.0;
-
-        // TODO Add variable initiation cycles instead of 1 
-        add_constraintex(lp_solver, 2, lpvar_coeff, lpvar_col, GE, 1);
+            // TODO Add variable initiation cycles instead of 1 
+            addConstraint({ { lpvar_a, 1.0 }, { lpvar_b, -1.0 } }, sdc::SdcSolver::Ge, 1.0);
+        }
     }
-
-    delete[] static_lp_var_coeffs;
-    static_lp_var_coeffs = nullptr;
 }
 
-void SdcScheduler::scheduleResourseConstrained() {
-    const unsigned int n_lpvar_asap = get_Nrows(lp_solver);
+bool SdcScheduler::scheduleResourseConstrained() {
+    std::vector<ConstraintId> alap_constraints;
 
-    addAlapConstraints();
+    addAlapConstraints(alap_constraints);
 
-    scheduleAlap();
+    if (!scheduleAlap()) {
+        return false;
+    }
+
+    /* Keep ALAP solution for resource constraints ordering */
+    std::vector<int> alap_schedule(n_lp_var);
+    for (unsigned int i = 0; i < n_lp_var; i++) {
+        alap_schedule[i] = solver->getValue(i);
+    }
 
     /* Delete ALAP constraints */
-    for (unsigned int i = get_Nrows(lp_solver); i > n_lpvar_asap; i--) {
-        del_constraint(lp_solver, i);
+    for (auto id : alap_constraints) {
+        removeConstraint(id);
     }
 
-    std::set<unsigned int> seen_opcodes;
+    std::set<hardware::FunctionalUnit*> seen_fus;
 
     for (auto& basic_block : function) {
         for (auto& instr : basic_block) {
-            unsigned int instr_opcode = instr.getOpcode();
+            auto* fu = constraints.getInstructionFu(instr);
 
-            if (seen_opcodes.find(instr_opcode) != seen_opcodes.end()) {
+            if (seen_fus.find(fu) != seen_fus.end()) {
                 continue;
             } else {
-                seen_opcodes.insert(instr_opcode);
+                seen_fus.insert(fu);
             }
 
-            auto* fu = constraints->getInstructionFu(instr);
-            auto fu_num_constraint = constraints->getFuNumConstraint(*fu);
+            /* Operations without functional units are not constrained */
+            std::optional<unsigned int> fu_num_constraint;
+
+            if (fu != nullptr) {
+                fu_num_constraint = constraints.getFuNumConstraint(*fu);
+            }
 
             auto n_operands = instr.getNumOperands();
             unsigned int bw_0 = 0;
             unsigned int bw_1 = 0;;
 
             if (n_operands >= 1) {
-                bw_0 = instr.getOperand(0)->getType()->getPrimitiveSizeInBits();
+                bw_0 = utility::getFuBitwidth(instr);
             }
             
             if (n_operands >= 2) {
-                bw_1 = instr.getOperand(1)->getType()->getPrimitiveSizeInBits();
+                bw_1 = bw_0;
             }
 
+            auto& log_out = utility::logs();
+
             if (fu_num_constraint.has_value()) {
-                std::cout << "Adding constraint\n\tOPCODE: " << instr.getOpcodeName();
+                log_out << "Adding constraint\n\tOPCODE: " << instr.getOpcodeName();
 
                 if (n_operands >= 1) {
-                    std::cout << " W0: " << bw_0;
+                    log_out << " W0: " << bw_0;
                 }
 
                 if (n_operands >= 2) {
-                    std::cout << " W1: " << bw_1;
+                    log_out << " W1: " << bw_1;
                 }
 
-                std::cout << " FU number: " << fu_num_constraint.value() << std::endl;
+                log_out << " FU number: " << fu_num_constraint.value() << "\n";
 
-                addResourseConstraint(instr_opcode, fu_num_constraint.value());
+                addResourseConstraint(fu, fu_num_constraint.value(), alap_schedule);
             } else {
-                std::cout << "No constraints\n\tOPCODE: " << instr.getOpcodeName();
+                log_out << "No constraints\n\tOPCODE: " << instr.getOpcodeName();
 
                 if (n_operands >= 1) {
-                    std::cout << " W0: " << bw_0;
+                    log_out << " W0: " << bw_0;
                 }
 
                 if (n_operands >= 2) {
-                    std::cout << " W1: " << bw_1;
+                    log_out << " W1: " << bw_1;
                 }
 
-                std::cout << std::endl;
+                log_out << "\n";
             }
         }
     }
 
-    scheduleAsap();
+    return scheduleAsap();
 }
 
-void SdcScheduler::scheduleAxap(Axap axap) {
-    int* lpvar_cols = new int[n_instr];
-    double* lpvar_coeffs = new double[n_instr];
+bool SdcScheduler::scheduleAxap(Axap axap) {
+    Row objective;
+    objective.reserve(n_instr);
 
-    unsigned int count = 0;
-    for (auto& instr_node_lpvar : instr_node_lp_var_lookup) {
-        unsigned int lpvar_col = instr_node_lpvar.second.first;
-        lpvar_cols[count] = 1 + lpvar_col;
-        lpvar_coeffs[count] = 1.0;
-        count += 1;
+    for (auto& lp_vars : node_lp_vars) {
+        objective.push_back({ lp_vars.first, 1.0 });
     }
 
-    assert(count == n_instr);  
+    assert(objective.size() == n_instr);
 
-    set_obj_fnex(lp_solver, count, lpvar_coeffs, lpvar_cols);
+    if (is_pure_sdc && !sdc::SdcSolver::isMonotoneRow(objective)) {
+        fallbackToLp();
+    }
+
+    solver->setObjective(objective);
 
     assert((axap == Asap) || (axap == Alap));
 
+    utility::PhaseProfile::count("sdc.solves");
+
+    bool is_solved = false;
+
     switch (axap) {
     case Asap:
-        set_minim(lp_solver);
+        is_solved = solver->solve(sdc::SdcSolver::Asap);
         break;
     case Alap:
-        set_maxim(lp_solver);
+        is_solved = solver->solve(sdc::SdcSolver::Alap);
         break;
     }
 
-// #ifndef NDEBUG
-//     write_LP(lp_solver, stdout);
-// #endif
-
-    int lp_solver_status = solve(lp_solver);
-
-    if (lp_solver_status != 0) {
-        errs() << "LP solver returned: " << lp_solver_status << "\n";
-        report_fatal_error("LP solver could not find an optimal solution");
-    }
-
-    delete[] lpvar_cols;
-    lpvar_cols = nullptr;
-
-    delete[] lpvar_coeffs;
-    lpvar_coeffs = nullptr;
+    return is_solved;
 }
 
-void SdcScheduler::scheduleAsap() {
-    scheduleAxap(Asap);
+bool SdcScheduler::scheduleAsap() {
+    return scheduleAxap(Asap);
 }
 
-void SdcScheduler::scheduleAlap() {
-    scheduleAxap(Alap);
+bool SdcScheduler::scheduleAlap() {
+    return scheduleAxap(Alap);
 }
 
 void SdcScheduler::mapSchedule() {
-    double* lp_vars = new REAL[get_Nrows(lp_solver)];
-    get_variables(lp_solver, lp_vars);
-
 #ifndef NDEBUG
     std::string out_buffer;
     raw_string_ostream out_stream(out_buffer);
@@ -401,20 +995,20 @@ void SdcScheduler::mapSchedule() {
 
         for (auto& instr : basic_block) {
             auto& instr_node = dag.getNode(instr);
-            auto start_lp_var_idx = instr_node_lp_var_lookup[&instr_node].first;
-            auto assigned_state = static_cast<unsigned int>(lp_vars[start_lp_var_idx]);
+            auto start_lp_var_idx = node_lp_vars[instr_node.getId()].first;
+            auto assigned_state = static_cast<unsigned int>(solver->getValue(start_lp_var_idx));
 
 #ifndef NDEBUG
             out_stream << "BB#" << bb_count << ": ";
             basic_block.printAsOperand(out_stream, false);
             out_stream << " OPCODE: " << instr.getOpcodeName();
-            out_stream << " IDX: " << instr_node_lp_var_lookup[&instr_node].first + 1;
+            out_stream << " IDX: " << node_lp_vars[instr_node.getId()].first + 1;
             out_stream << " CLOCK ASSIGNED: " << assigned_state << "\n";
 #endif
 
             mapping.setState(&dag.getNode(instr), assigned_state);
 
-            assigned_state += SdcScheduler::getInstructionCycles(instr);
+            assigned_state += SdcScheduler::getInstructionCycles(instr_node);
 
             if (assigned_state > bb_states_count) {
                 bb_states_count = assigned_state;
@@ -422,43 +1016,67 @@ void SdcScheduler::mapSchedule() {
         }
 
 #ifndef NDEBUG
-        std::cout << "\n" << out_stream.str() << std::endl;
+        utility::logs() << "\n" << out_stream.str() << "\n";
 #endif
 
         bb_count++;
         mapping.setBasicBlockStatesNum(&basic_block, bb_states_count);
 
+        if (loop_ii_lookup.count(&basic_block) != 0) {
+            /* Prologue state and kernel states */
+            mapping.setInitiationInterval(&basic_block, loop_ii_lookup[&basic_block]);
+            mapping.setBasicBlockStatesNum(&basic_block, loop_ii_lookup[&basic_block] + 1);
+        }
+
         auto* ret_instr = dyn_cast<ReturnInst>(basic_block.getTerminator());
         if (ret_instr != nullptr) {
             mapping.setState(&dag.getNode(*ret_instr), bb_states_count);
         }
     }
+}
+
+unsigned int SdcScheduler::getLatency(SchedulerMapping& sched_mapping) {
+    unsigned int latency = 0;
+
+    for (auto& basic_block : function) {
+        latency += sched_mapping.getBasicBlockStatesNum(&basic_block);
+    }
 
-    delete[] lp_vars;
-    lp_vars = nullptr;
+    return latency;
+}
+
+void SdcScheduler::reportLatency() {
+    SdcScheduler unchained_sched(function, dag, constraints);
+    unchained_sched.setChainingEnabled(false);
+
+    unsigned int unchained_latency = getLatency(unchained_sched.schedule());
+    unsigned int chained_latency = getLatency(mapping);
+
+    std::cout << "Latency: " << function.getName().str()
+        << " unchained: " << unchained_latency
+        << " chained: " << chained_latency
+        << " reduction: " << (int) unchained_latency - (int) chained_latency
+        << std::endl;
 }
 
 #ifndef NDEBUG
 void SdcScheduler::printLp() {
-    double* lp_vars = new double[get_Nrows(lp_solver)];
-    get_variables(lp_solver, lp_vars);
-
     std::string out_buffer;
     raw_string_ostream out_stream(out_buffer);
 
     for (auto& basic_block : function) {
         for (auto& instr : basic_block) {
             auto& instr_node = dag.getNode(instr);
-            auto end_lp_var_idx = instr_node_lp_var_lookup[&instr_node].second;
+            auto end_lp_var_idx = node_lp_vars[instr_node.getId()].second;
 
             out_stream << "BB: ";
             basic_block.printAsOperand(out_stream, false);
             out_stream << " OPCODE: " << instr.getOpcodeName();
-            out_stream << " IDX: " << instr_node_lp_var_lookup[&instr_node].first + 1;
-            out_stream << " CLOCK: " << lp_vars[end_lp_var_idx] << "\n";
+            out_stream << " IDX: " << node_lp_vars[instr_node.getId()].first + 1;
+            out_stream << " CLOCK: " << solver->getValue(end_lp_var_idx) << "\n";
         }
     }
 
-    std::cout << "\n" << out_stream.str() << std::endl;
+    utility::logs() << "\n" << out_stream.str() << "\n";
 }
 #endif
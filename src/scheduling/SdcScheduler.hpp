@@ -2,13 +2,16 @@
 #define __SCHEDULING_SDC_SCHEDULER_HPP__
 
 #include <map>
+#include <set>
+#include <memory>
+#include <vector>
 #include <utility>
 
 #include <llvm/IR/Function.h>
 #include <llvm/IR/Instruction.h>
 
-#include <lpsolve/lp_lib.h>
-
+#include "../hardware/HardwareConstraints.hpp"
+#include "sdc/SdcSolver.hpp"
 #include "SchedulerMapping.hpp"
 #include "Dag.hpp"
 #include "Scheduler.hpp"
@@ -18,29 +21,65 @@ namespace llvm {
 
 class SdcScheduler : public Scheduler {
 public:
-    SdcScheduler(Function& function, Dag& dag);
+    SdcScheduler(Function& function, Dag& dag, hardware::HardwareConstraints& constraints);
 
     SchedulerMapping& schedule() override;
 
+    void setChainingEnabled(bool enabled);
+
     ~SdcScheduler() {};
 
 private:
     Function& function;
     Dag& dag;
+    hardware::HardwareConstraints& constraints;
 
     unsigned int n_instr;
 
-    lprec* lp_solver;
+    unsigned int n_lp_var;
+
+    /* Live constraint system, replaced by LP model on non-SDC constraint or objective */
+    std::unique_ptr<sdc::SdcSolver> solver;
+
+    bool is_pure_sdc;
+
+    bool is_chaining_enabled;
+
+    typedef sdc::SdcSolver::Row Row;
+    typedef sdc::SdcSolver::ConstraintType ConstraintType;
+    typedef unsigned int ConstraintId;
+
+    struct ConstraintRecord {
+        Row row;
+        ConstraintType type;
+        double rhs;
+        sdc::SdcSolver::ConstraintId solver_id;
+        bool alive;
+    };
+
+    std::vector<ConstraintRecord> constraint_log;
+
+    /* Pipelined loop basic blocks and their current initiation intervals */
+    std::map<BasicBlock*, unsigned int> loop_ii_lookup;
 
     SchedulerMapping mapping;
 
-    std::map<InstructionNode*, std::pair<unsigned int, unsigned int>> instr_node_lp_var_lookup;
+    /* First and last LP variable of every node, indexed by node id */
+    std::vector<std::pair<unsigned int, unsigned int>> node_lp_vars;
 
     enum Axap {
         Asap,
         Alap,
     };
 
+    ConstraintId addConstraint(Row row, ConstraintType type, double rhs);
+
+    void removeConstraint(ConstraintId id);
+
+    void fallbackToLp();
+
+    void reportInfeasibleCycle();
+
     unsigned int createLpVariables();
 
     void addMulticycleConstraints();
@@ -49,20 +88,59 @@ private:
 
     void addTimingConstraints();
 
-    void addAlapConstraints();
+    static bool isChainable(InstructionNode& instr_node);
+
+    bool isChained(InstructionNode& dep_instr_node, InstructionNode& instr_node);
 
-    void addResourseConstraint(unsigned int opcode, unsigned int constraint);
+    void addAlapConstraints(std::vector<ConstraintId>& alap_constraints);
 
-    void scheduleResourseConstrained();
+    /** Schedules, relaxing initiation intervals of infeasible pipelined loops */
+    void scheduleRelaxed();
 
-    void scheduleAxap(Axap axap);
+    bool scheduleConstrained(std::set<BasicBlock*>& failed_loops);
 
-    void scheduleAsap();
+    static bool isPipelinable(BasicBlock& basic_block);
 
-    void scheduleAlap();
+    void findPipelinedLoops();
+
+    unsigned int getMaxInitiationInterval(BasicBlock& basic_block);
+
+    void relaxPipelinedLoops(std::set<BasicBlock*>& failed_loops);
+
+    void getInfeasibleLoops(std::set<BasicBlock*>& failed_loops);
+
+    void getLoopCycles(std::map<BasicBlock*, unsigned int>& loops,
+                       std::map<BasicBlock*, unsigned int>& loop_cycles);
+
+    /** Drops pipelined loops not faster than their sequential schedules */
+    bool dropSlowPipelines(std::map<BasicBlock*, unsigned int>& loop_cycles);
+
+    void addPipelineConstraints();
+
+    bool scheduleModulo(std::set<BasicBlock*>& failed_loops);
+
+    void reportPipelinedLoops();
+
+    void addResourseConstraint(
+        hardware::FunctionalUnit* fu,
+        unsigned int constraint,
+        const std::vector<int>& alap_schedule
+    );
+
+    bool scheduleResourseConstrained();
+
+    bool scheduleAxap(Axap axap);
+
+    bool scheduleAsap();
+
+    bool scheduleAlap();
 
     void mapSchedule();
 
+    unsigned int getLatency(SchedulerMapping& sched_mapping);
+
+    void reportLatency();
+
 #ifndef NDEBUG
     void printLp();
 #endif
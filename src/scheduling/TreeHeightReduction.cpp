@@ -0,0 +1,240 @@
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include <llvm/IR/Function.h>
+#include <llvm/IR/BasicBlock.h>
+#include <llvm/IR/Instruction.h>
+#include <llvm/IR/Instructions.h>
+#include <llvm/Support/CommandLine.h>
+
+#include "../hardware/HardwareConstraints.hpp"
+#include "../utility/log_utility.hpp"
+
+#include "TreeHeightReduction.hpp"
+
+using namespace llvm;
+using namespace bphls;
+
+static cl::opt<bool> sched_rebalance(
+    "sched-rebalance",
+    cl::desc("Rebalance chains of associative operations into trees before scheduling"),
+    cl::init(true)
+);
+
+TreeHeightReduction::TreeHeightReduction(Function& function, hardware::HardwareConstraints& constraints)
+    : function(function),
+      constraints(constraints),
+      n_rebalanced(0),
+      n_saved_levels(0) {}
+
+void TreeHeightReduction::run() {
+    if (!sched_rebalance) {
+        return;
+    }
+
+    for (auto& basic_block : function) {
+        rebalance(basic_block);
+    }
+
+    levels.clear();
+
+    if (n_rebalanced != 0) {
+        utility::logs() << "Tree height reduction: " << function.getName()
+            << " rebalanced: " << n_rebalanced
+            << " saved levels: " << n_saved_levels
+            << "\n";
+    }
+}
+
+bool TreeHeightReduction::isReassociable(Instruction& instr) {
+    if (!instr.getType()->isIntegerTy()) {
+        return false;
+    }
+
+    /* Modular arithmetic, wrapping flags are dropped by the rebuilt tree */
+    switch (instr.getOpcode()) {
+        case Instruction::Add:
+        case Instruction::Mul:
+        case Instruction::And:
+        case Instruction::Or:
+        case Instruction::Xor:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool TreeHeightReduction::isChainNode(Instruction& instr, Instruction& root) {
+    /* Inner results are not observed anywhere else */
+    return (instr.getOpcode() == root.getOpcode())
+        && (instr.getParent() == root.getParent())
+        && instr.hasOneUse();
+}
+
+unsigned int TreeHeightReduction::getLevel(Value* val) {
+    auto level_iter = levels.find(val);
+
+    return (level_iter != levels.end()) ? level_iter->second : 0;
+}
+
+void TreeHeightReduction::collectChain(Instruction& root,
+                                       std::vector<Instruction*>& nodes,
+                                       std::vector<Value*>& leaves)
+{
+    std::function<void(Instruction&)> visit = [&](Instruction& node) {
+        nodes.push_back(&node);
+
+        for (auto& operand : node.operands()) {
+            auto* op_instr = dyn_cast<Instruction>(operand);
+
+            if ((op_instr != nullptr) && isChainNode(*op_instr, root)) {
+                visit(*op_instr);
+            } else {
+                leaves.push_back(operand);
+            }
+        }
+    };
+
+    visit(root);
+}
+
+void TreeHeightReduction::rebalance(BasicBlock& basic_block) {
+    std::vector<Instruction*> instructions;
+
+    for (auto& instr : basic_block) {
+        instructions.push_back(&instr);
+    }
+
+    levels.clear();
+
+    for (auto* instr : instructions) {
+        unsigned int level = 0;
+
+        if (!isa<PHINode>(instr)) {
+            for (auto& operand : instr->operands()) {
+                level = std::max(level, getLevel(operand));
+            }
+
+            /* Casts are wires */
+            level += isa<CastInst>(instr) ? 0 : 1;
+        }
+
+        levels[instr] = level;
+
+        if (!isReassociable(*instr)) {
+            continue;
+        }
+
+        /* Chains are rebuilt at their roots, inner nodes feed the same operation */
+        if (instr->hasOneUse()) {
+            auto* user = dyn_cast<Instruction>(instr->user_back());
+
+            if ((user != nullptr) && isChainNode(*instr, *user)) {
+                continue;
+            }
+        }
+
+        std::vector<Instruction*> nodes;
+        std::vector<Value*> leaves;
+
+        collectChain(*instr, nodes, leaves);
+
+        if (nodes.size() < 2) {
+            continue;
+        }
+
+        unsigned int fu_num = ~0U;
+
+        if (auto* fu = constraints.getInstructionFu(*instr)) {
+            if (auto fu_num_constraint = constraints.getFuNumConstraint(*fu)) {
+                fu_num = std::max(1U, fu_num_constraint.value());
+            }
+        }
+
+        /* Operands by level, then by their order in the chain */
+        typedef std::pair<unsigned int, unsigned int> LevelOperand;
+
+        std::priority_queue<LevelOperand, std::vector<LevelOperand>, std::greater<LevelOperand>> ready;
+        std::vector<std::pair<unsigned int, unsigned int>> tree;
+
+        for (unsigned int i = 0; i < leaves.size(); i++) {
+            ready.push({ getLevel(leaves[i]), i });
+        }
+
+        unsigned int n_operands = leaves.size();
+
+        /* List scheduling of the reduction, up to fu_num operations per step */
+        while (ready.size() > 1) {
+            std::vector<LevelOperand> step_operands = { ready.top() };
+            ready.pop();
+
+            unsigned int step = ready.top().first;
+
+            while (!ready.empty()
+                    && (ready.top().first <= step)
+                    && (step_operands.size() / 2 < fu_num))
+            {
+                step_operands.push_back(ready.top());
+                ready.pop();
+            }
+
+            if (step_operands.size() % 2 != 0) {
+                ready.push(step_operands.back());
+                step_operands.pop_back();
+            }
+
+            for (unsigned int i = 0; i < step_operands.size(); i += 2) {
+                tree.push_back({ step_operands[i].second, step_operands[i + 1].second });
+                ready.push({ step + 1, n_operands++ });
+            }
+        }
+
+        unsigned int tree_level = ready.top().first;
+
+        if (tree_level >= level) {
+            continue;
+        }
+
+        std::vector<Value*> values = leaves;
+        std::vector<unsigned int> value_levels;
+
+        for (auto* leaf : leaves) {
+            value_levels.push_back(getLevel(leaf));
+        }
+
+        for (auto& operation : tree) {
+            auto* tree_instr = BinaryOperator::Create(
+                static_cast<Instruction::BinaryOps>(instr->getOpcode()),
+                values[operation.first],
+                values[operation.second],
+                "",
+                instr
+            );
+
+            tree_instr->setDebugLoc(instr->getDebugLoc());
+
+            value_levels.push_back(
+                std::max(value_levels[operation.first], value_levels[operation.second]) + 1
+            );
+
+            values.push_back(tree_instr);
+            levels[tree_instr] = value_levels.back();
+        }
+
+        values.back()->takeName(instr);
+        instr->replaceAllUsesWith(values.back());
+
+        /* Every node is used by the previous one only */
+        for (auto* node : nodes) {
+            levels.erase(node);
+            node->eraseFromParent();
+        }
+
+        n_rebalanced++;
+        n_saved_levels += level - tree_level;
+    }
+}
@@ -0,0 +1,61 @@
+#ifndef __SCHEDULING_TREE_HEIGHT_REDUCTION_HPP__
+#define __SCHEDULING_TREE_HEIGHT_REDUCTION_HPP__
+
+#include <map>
+#include <vector>
+
+#include <llvm/IR/Function.h>
+#include <llvm/IR/BasicBlock.h>
+#include <llvm/IR/Instruction.h>
+
+#include "../hardware/HardwareConstraints.hpp"
+
+namespace llvm {
+    namespace bphls {
+
+/**
+ * Rebalances chains of associative and commutative operations (add, mul,
+ * and, or, xor) of a basic block into trees before scheduling.
+ *
+ * The operands of a chain are combined earliest available first, at most
+ * as many operations per step as there are functional units of the chain,
+ * so constrained chains become parallel partial chains reduced by a tree.
+ * A chain is rewritten only if its critical path gets shorter.
+ */
+class TreeHeightReduction {
+public:
+    TreeHeightReduction(Function& function, hardware::HardwareConstraints& constraints);
+
+    void run();
+
+    unsigned int getRebalancedNum() { return n_rebalanced; }
+
+    unsigned int getSavedLevelsNum() { return n_saved_levels; }
+
+private:
+    Function& function;
+    hardware::HardwareConstraints& constraints;
+
+    /* Operation levels of the basic block, its inputs are at level 0 */
+    std::map<Value*, unsigned int> levels;
+
+    unsigned int n_rebalanced;
+    unsigned int n_saved_levels;
+
+    static bool isReassociable(Instruction& instr);
+
+    static bool isChainNode(Instruction& instr, Instruction& root);
+
+    unsigned int getLevel(Value* val);
+
+    void collectChain(Instruction& root,
+                      std::vector<Instruction*>& nodes,
+                      std::vector<Value*>& leaves);
+
+    void rebalance(BasicBlock& basic_block);
+};
+
+    } /* namespace bphls */
+} /* namespace llvm */
+
+#endif /* __SCHEDULING_TREE_HEIGHT_REDUCTION_HPP__ */
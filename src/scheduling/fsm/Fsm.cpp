@@ -4,14 +4,22 @@
 
 #include "../../utility/DotGraph.hpp"
 #include "../../utility/transition_utility.hpp"
+#include "../../utility/arena_utility.hpp"
+#include "../../utility/PhaseProfile.hpp"
 
 #include "Fsm.hpp"
 
 using namespace llvm;
 using namespace bphls;
 
+Fsm::Fsm(utility::FunctionNumbering& numbering)
+    : numbering(numbering),
+      start_states(numbering.getInstructionsNum(), nullptr),
+      end_states(numbering.getInstructionsNum(), nullptr),
+      instr_cycles(numbering.getInstructionsNum(), 0) {}
+
 FsmState* Fsm::createState(FsmState* after, std::string name) {
-    FsmState* state = new FsmState(this);
+    FsmState* state = utility::createInArena(state_allocator, this);
 
     if (after != nullptr) {
         auto after_iter = std::find(states().begin(), states().end(), after);
@@ -25,29 +33,70 @@ FsmState* Fsm::createState(FsmState* after, std::string name) {
     }
 
     state->setName(name);
+    utility::PhaseProfile::count("fsm.states");
+
     return state;
 }
 
+void Fsm::numberStates() {
+    unsigned int id = 0;
+
+    for (auto* state : states()) {
+        state->setId(id++);
+    }
+}
+
 void Fsm::setStartState(Instruction* instr, FsmState* state) {
-    start_state_lookup[instr] = state;
+    start_states[numbering.getId(instr)] = state;
 }
 
 FsmState* Fsm::getStartState(Instruction* instr) {
-    return start_state_lookup[instr];
+    auto id = numbering.getId(instr);
+
+    return (id != utility::FunctionNumbering::NONE) ? start_states[id] : nullptr;
 }
 
 void Fsm::setEndState(Instruction* instr, FsmState* state) {
-    end_state_lookup[instr] = state;
+    end_states[numbering.getId(instr)] = state;
 }
 
 FsmState* Fsm::getEndState(Instruction* instr) {
-    return end_state_lookup[instr];
+    auto id = numbering.getId(instr);
+
+    return (id != utility::FunctionNumbering::NONE) ? end_states[id] : nullptr;
+}
+
+void Fsm::setInstructionCycles(Instruction* instr, unsigned int cycles) {
+    instr_cycles[numbering.getId(instr)] = cycles;
+}
+
+unsigned int Fsm::getInstructionCycles(Instruction* instr) {
+    auto id = numbering.getId(instr);
+
+    return (id != utility::FunctionNumbering::NONE) ? instr_cycles[id] : 0;
 }
 
 unsigned int Fsm::getStatesNum() {
     return state_list.size();
 }
 
+FsmPipeline& Fsm::addPipeline(BasicBlock* basic_block) {
+    auto& pipeline = pipeline_lookup[basic_block];
+    pipeline.basic_block = basic_block;
+
+    return pipeline;
+}
+
+FsmPipeline* Fsm::getPipeline(BasicBlock* basic_block) {
+    auto pipeline_iter = pipeline_lookup.find(basic_block);
+
+    if (pipeline_iter == pipeline_lookup.end()) {
+        return nullptr;
+    }
+
+    return &pipeline_iter->second;
+}
+
 void printNodeLabel(raw_ostream& out, FsmState* state) {
     out << state->getName() << "\\n";
 
@@ -2,22 +2,67 @@
 #define __SCHEDULING_FSM_FSM_HPP__
 
 #include <list>
+#include <map>
+#include <set>
+#include <vector>
 
 #include <llvm/Support/raw_ostream.h>
 #include <llvm/Support/FormattedStream.h>
 #include <llvm/ADT/DenseMap.h>
 #include <llvm/ADT/iterator_range.h>
+#include <llvm/Support/Allocator.h>
 #include <llvm/IR/Instructions.h>
 
+#include "../../utility/FunctionNumbering.hpp"
 #include "FsmState.hpp"
 
 namespace llvm {
     namespace bphls {
 
+/**
+ * Modulo scheduled (pipelined) loop basic block. The loop body is a single
+ * kernel of II states executed by overlapped iterations, the prologue
+ * state starts the pipeline and stage-valid flags fill and drain it.
+ * Iterations issued before the exit branch is resolved are squashed.
+ */
+struct FsmPipeline {
+    BasicBlock* basic_block;
+    unsigned int ii;
+    unsigned int n_stages;
+
+    FsmState* prologue_state;
+    std::vector<FsmState*> kernel_states;
+    FsmState* exit_state;
+
+    BranchInst* branch;
+    bool exit_on_true;
+
+    std::map<Instruction*, unsigned int> start_stage;
+    std::map<Instruction*, unsigned int> end_stage;
+
+    /* Cycles since the iteration was issued */
+    std::map<Instruction*, unsigned int> start_time;
+    std::map<Instruction*, unsigned int> end_time;
+
+    FsmPipeline()
+        : basic_block(nullptr),
+          ii(0),
+          n_stages(0),
+          prologue_state(nullptr),
+          exit_state(nullptr),
+          branch(nullptr),
+          exit_on_true(false) {};
+};
+
 class Fsm {
 public:
+    Fsm(utility::FunctionNumbering& numbering);
+
     FsmState* createState(FsmState* after = nullptr, std::string name = "bphls");
 
+    /** Assigns dense state ids in state list order, once states are final */
+    void numberStates();
+
     void setStartState(Instruction* instr, FsmState* state);
 
     FsmState* getStartState(Instruction* instr);
@@ -26,8 +71,25 @@ public:
 
     FsmState* getEndState(Instruction* instr);
 
+    void setInstructionCycles(Instruction* instr, unsigned int cycles);
+
+    /** Cycles from the start state to the end state of the instruction */
+    unsigned int getInstructionCycles(Instruction* instr);
+
     unsigned int getStatesNum();
 
+    utility::FunctionNumbering& getNumbering() { return numbering; }
+
+    FsmPipeline& addPipeline(BasicBlock* basic_block);
+
+    FsmPipeline* getPipeline(BasicBlock* basic_block);
+
+    std::map<BasicBlock*, FsmPipeline>& pipelines() { return pipeline_lookup; }
+
+    void addBypassedBasicBlock(BasicBlock* basic_block) { bypassed_basic_blocks.insert(basic_block); }
+
+    bool isBypassed(BasicBlock* basic_block) { return bypassed_basic_blocks.count(basic_block) != 0; }
+
     void exportDot(formatted_raw_ostream& out);
 
     typedef std::list<FsmState*>::iterator StateIterator;
@@ -37,9 +99,20 @@ public:
     }
 
 private:
+    utility::FunctionNumbering& numbering;
+
+    /* States are owned by the arena and released together with the Fsm */
+    SpecificBumpPtrAllocator<FsmState> state_allocator;
     std::list<FsmState*> state_list;
-    DenseMap<const Instruction*, FsmState*> start_state_lookup;
-    DenseMap<const Instruction*, FsmState*> end_state_lookup;
+
+    /* Indexed by instruction id */
+    std::vector<FsmState*> start_states;
+    std::vector<FsmState*> end_states;
+    std::vector<unsigned int> instr_cycles;
+    std::map<BasicBlock*, FsmPipeline> pipeline_lookup;
+
+    /* Forwarding basic blocks without states, transitions skip them */
+    std::set<BasicBlock*> bypassed_basic_blocks;
 };
 
     } /* namespace bphls */
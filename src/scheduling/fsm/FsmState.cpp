@@ -3,6 +3,8 @@
 
 #include <llvm/Support/raw_ostream.h>
 
+#include "../../utility/log_utility.hpp"
+
 #include "Fsm.hpp"
 
 #include "FsmState.hpp"
@@ -85,22 +87,21 @@ BasicBlock* FsmState::getBasicBlock() {
 }
 
 void FsmState::printStateInfo() {
-    std::string out_buffer;
-    llvm::raw_string_ostream out(out_buffer);
+    auto& out = utility::logs();
 
-    std::cout << "Transition:\n";
+    out << "Transition:\n";
 
-    std::cout << "\tTransition states:\n";
+    out << "\tTransition states:\n";
     for (auto* state : transition.states) {
-        std::cout << "\t\t-" << state->getName() << std::endl;
+        out << "\t\t-" << state->getName() << "\n";
     }
 
     if (getDefaultTransition() != nullptr) {
-        std::cout << "\tDefault transition state: " << getDefaultTransition()->getName() << std::endl;
+        out << "\tDefault transition state: " << getDefaultTransition()->getName() << "\n";
     }
 
-    std::cout << "\tInstructions:\n";
+    out << "\tInstructions:\n";
     for (auto* instr : instructions()) {
-            std::cout << "\t\t-" << instr->getOpcodeName() << std::endl;
+            out << "\t\t-" << instr->getOpcodeName() << "\n";
     }
 }
\ No newline at end of file
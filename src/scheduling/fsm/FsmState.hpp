@@ -45,9 +45,15 @@ public:
 
     FsmState(Fsm* parent)
         : parent(parent),
+          id(0),
           basic_block(nullptr),
           terminating(false) {};
 
+    /** Dense index in the state list, valid after Fsm::numberStates */
+    unsigned int getId() { return id; }
+
+    void setId(unsigned int id) { this->id = id; }
+
     void addTransition(FsmState* state, Value* value = nullptr);
 
     void setDefaultTransition(FsmState* state);
@@ -89,6 +95,7 @@ private:
 
     std::string name;
     Fsm* parent;
+    unsigned int id;
     BasicBlock* basic_block;
 
     Transition transition;
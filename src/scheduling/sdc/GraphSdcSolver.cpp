@@ -0,0 +1,251 @@
+#include <vector>
+#include <deque>
+#include <algorithm>
+#include <cmath>
+#include <cassert>
+
+#include "../../utility/PhaseProfile.hpp"
+#include "GraphSdcSolver.hpp"
+
+using namespace llvm;
+using namespace bphls;
+
+sdc::GraphSdcSolver::GraphSdcSolver(unsigned int n_vars)
+    : n_vars(n_vars),
+      zero_node(n_vars),
+      is_dirty(true),
+      last_objective(Asap),
+      value(n_vars + 1, 0),
+      pred_edge(n_vars + 1, NO_EDGE),
+      n_relaxed(n_vars + 1, 0),
+      in_worklist(n_vars + 1, false),
+      n_visits(0) {}
+
+sdc::GraphSdcSolver::~GraphSdcSolver() {
+    utility::PhaseProfile::count("sdc.iterations", n_visits);
+}
+
+sdc::SdcSolver::ConstraintId sdc::GraphSdcSolver::addConstraint(Row& row,
+                                                              ConstraintType type,
+                                                              double rhs)
+{
+    assert(isDifferenceRow(row) && "Not a difference constraint");
+    assert((std::floor(rhs) == rhs) && "Non-integer constraint bound");
+
+    /* Normalize to x_a - x_b (type) c, x_b is the zero node for bounds */
+    unsigned int var_a = zero_node;
+    unsigned int var_b = zero_node;
+
+    for (auto& var_coeff : row) {
+        assert(var_coeff.first < n_vars);
+
+        if (var_coeff.second > 0.0) {
+            var_a = var_coeff.first;
+        } else {
+            var_b = var_coeff.first;
+        }
+    }
+
+    int c = static_cast<int>(rhs);
+
+    ConstraintId id = constraint_edges.size();
+    constraint_edges.emplace_back();
+
+    if ((type == Ge) || (type == Eq)) {
+        /* x_a - x_b >= c */
+        constraint_edges[id].push_back(addEdge(var_b, var_a, c));
+    }
+
+    if ((type == Le) || (type == Eq)) {
+        /* x_b - x_a >= -c */
+        constraint_edges[id].push_back(addEdge(var_a, var_b, -c));
+    }
+
+    return id;
+}
+
+void sdc::GraphSdcSolver::removeConstraint(ConstraintId id) {
+    assert(id < constraint_edges.size());
+
+    for (auto edge_id : constraint_edges[id]) {
+        assert(edges[edge_id].alive);
+        edges[edge_id].alive = false;
+    }
+
+    constraint_edges[id].clear();
+    is_dirty = true;
+}
+
+bool sdc::GraphSdcSolver::solve(Objective objective) {
+    last_objective = objective;
+    infeasible_cycle.clear();
+
+    if (is_dirty) {
+        buildCsr(forward, false);
+        buildCsr(reverse, true);
+        is_dirty = false;
+    }
+
+    if (objective == Asap) {
+        /* Least solution, variables are non-negative */
+        return computePotentials(forward, false, 0);
+    }
+
+    /* Greatest solution as negated longest paths over the reverse graph */
+    if (!computePotentials(reverse, true, UNBOUNDED)) {
+        return false;
+    }
+
+    for (unsigned int var = 0; var < n_vars; var++) {
+        /* Unbounded or below implicit zero lower bound */
+        if ((value[var] == UNBOUNDED) || (value[var] > 0)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int sdc::GraphSdcSolver::getValue(unsigned int var) {
+    assert(var < n_vars);
+
+    if (last_objective == Asap) {
+        return value[var];
+    } else {
+        return -value[var];
+    }
+}
+
+unsigned int sdc::GraphSdcSolver::addEdge(unsigned int from, unsigned int to, int weight) {
+    unsigned int edge_id = edges.size();
+    edges.emplace_back(from, to, weight);
+
+    is_dirty = true;
+
+    return edge_id;
+}
+
+void sdc::GraphSdcSolver::buildCsr(Csr& csr, bool reversed) {
+    const unsigned int n_nodes = n_vars + 1;
+
+    csr.offsets.assign(n_nodes + 1, 0);
+
+    /* Counting sort of alive edges by tail node */
+    for (auto& edge : edges) {
+        if (edge.alive) {
+            csr.offsets[(reversed ? edge.to : edge.from) + 1] += 1;
+        }
+    }
+
+    for (unsigned int node = 0; node < n_nodes; node++) {
+        csr.offsets[node + 1] += csr.offsets[node];
+    }
+
+    csr.edge_ids.resize(csr.offsets[n_nodes]);
+
+    std::vector<unsigned int> fill(csr.offsets.begin(), csr.offsets.end() - 1);
+
+    for (unsigned int edge_id = 0; edge_id < edges.size(); edge_id++) {
+        auto& edge = edges[edge_id];
+
+        if (edge.alive) {
+            csr.edge_ids[fill[reversed ? edge.to : edge.from]++] = edge_id;
+        }
+    }
+}
+
+bool sdc::GraphSdcSolver::computePotentials(Csr& csr, bool reversed, int base) {
+    const unsigned int n_nodes = n_vars + 1;
+
+    value.assign(n_nodes, base);
+    pred_edge.assign(n_nodes, NO_EDGE);
+    n_relaxed.assign(n_nodes, 0);
+    in_worklist.assign(n_nodes, false);
+    worklist.clear();
+
+    value[zero_node] = 0;
+
+    for (unsigned int node = 0; node < n_nodes; node++) {
+        if (value[node] != UNBOUNDED) {
+            worklist.push_back(node);
+            in_worklist[node] = true;
+        }
+    }
+
+    while (!worklist.empty()) {
+        unsigned int node = worklist.front();
+        worklist.pop_front();
+        in_worklist[node] = false;
+        n_visits += 1;
+
+        const int node_value = value[node];
+
+        for (unsigned int i = csr.offsets[node]; i < csr.offsets[node + 1]; i++) {
+            unsigned int edge_id = csr.edge_ids[i];
+            auto& edge = edges[edge_id];
+
+            unsigned int head = reversed ? edge.from : edge.to;
+            int head_value = node_value + edge.weight;
+
+            if ((value[head] != UNBOUNDED) && (head_value <= value[head])) {
+                continue;
+            }
+
+            pred_edge[head] = edge_id;
+
+            /* Zero node is pinned, raising it closes a positive cycle */
+            if (head == zero_node) {
+                collectCycle(head, reversed);
+                return false;
+            }
+
+            value[head] = head_value;
+
+            if (!in_worklist[head]) {
+                n_relaxed[head] += 1;
+
+                if (n_relaxed[head] > n_nodes) {
+                    collectCycle(head, reversed);
+                    return false;
+                }
+
+                worklist.push_back(head);
+                in_worklist[head] = true;
+            }
+        }
+    }
+
+    return true;
+}
+
+unsigned int sdc::GraphSdcSolver::getPredNode(unsigned int node, bool reversed) {
+    if (pred_edge[node] == NO_EDGE) {
+        /* Implicit zero lower bound */
+        return zero_node;
+    }
+
+    auto& edge = edges[pred_edge[node]];
+
+    return reversed ? edge.to : edge.from;
+}
+
+void sdc::GraphSdcSolver::collectCycle(unsigned int node, bool reversed) {
+    /* Walk back far enough to be inside the cycle */
+    for (unsigned int i = 0; i <= n_vars; i++) {
+        node = getPredNode(node, reversed);
+    }
+
+    unsigned int cycle_node = node;
+
+    do {
+        if (node != zero_node) {
+            infeasible_cycle.push_back(node);
+        }
+
+        node = getPredNode(node, reversed);
+    } while (node != cycle_node);
+
+    if (!reversed) {
+        std::reverse(infeasible_cycle.begin(), infeasible_cycle.end());
+    }
+}
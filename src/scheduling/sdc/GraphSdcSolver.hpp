@@ -0,0 +1,109 @@
+#ifndef __SCHEDULING_SDC_GRAPH_SDC_SOLVER_HPP__
+#define __SCHEDULING_SDC_GRAPH_SDC_SOLVER_HPP__
+
+#include <vector>
+#include <deque>
+#include <climits>
+
+#include "SdcSolver.hpp"
+
+namespace llvm {
+    namespace bphls {
+        namespace sdc {
+
+/**
+ * System of difference constraints solved as longest paths over a
+ * compact (CSR) constraint graph.
+ *
+ * Every constraint x_a - x_b >= c is an edge b -> a with weight c, single
+ * variable bounds are edges to/from an extra zero node pinned at 0.
+ * The graph is rebuilt lazily on the first solve after a modification,
+ * ASAP (least) and ALAP (greatest) solutions are computed from scratch
+ * with a worklist Bellman-Ford (SPFA) pass over the graph or its reverse.
+ *
+ * A positive cycle makes the system infeasible, its variables are kept
+ * for diagnostics.
+ */
+class GraphSdcSolver : public SdcSolver {
+public:
+    GraphSdcSolver(unsigned int n_vars);
+
+    ~GraphSdcSolver();
+
+    ConstraintId addConstraint(Row& row, ConstraintType type, double rhs) override;
+
+    void removeConstraint(ConstraintId id) override;
+
+    void setObjective(Row& row) override {};
+
+    bool solve(Objective objective) override;
+
+    int getValue(unsigned int var) override;
+
+    unsigned int getVariablesNum() override { return n_vars; }
+
+    std::vector<unsigned int> getInfeasibleCycle() override { return infeasible_cycle; }
+
+private:
+    static constexpr int UNBOUNDED = INT_MIN;
+    static constexpr unsigned int NO_EDGE = UINT_MAX;
+
+    /** Constraint x_to - x_from >= weight */
+    struct Edge {
+        unsigned int from;
+        unsigned int to;
+        int weight;
+        bool alive;
+
+        Edge(unsigned int from, unsigned int to, int weight)
+            : from(from),
+              to(to),
+              weight(weight),
+              alive(true) {}
+    };
+
+    /** Compressed adjacency of the alive edges */
+    struct Csr {
+        std::vector<unsigned int> offsets;
+        std::vector<unsigned int> edge_ids;
+    };
+
+    unsigned int n_vars;
+    unsigned int zero_node;
+
+    bool is_dirty;
+    Objective last_objective;
+
+    std::vector<Edge> edges;
+    std::vector<std::vector<unsigned int>> constraint_edges;
+
+    Csr forward;
+    Csr reverse;
+
+    std::vector<int> value;
+    std::vector<unsigned int> pred_edge;
+    std::vector<unsigned int> n_relaxed;
+    std::deque<unsigned int> worklist;
+    std::vector<bool> in_worklist;
+
+    /* Worklist visits of all solves, reported when the solver is released */
+    long long n_visits;
+
+    std::vector<unsigned int> infeasible_cycle;
+
+    unsigned int addEdge(unsigned int from, unsigned int to, int weight);
+
+    void buildCsr(Csr& csr, bool reversed);
+
+    bool computePotentials(Csr& csr, bool reversed, int base);
+
+    unsigned int getPredNode(unsigned int node, bool reversed);
+
+    void collectCycle(unsigned int node, bool reversed);
+};
+
+        } /* namespace sdc */
+    } /* namespace bphls */
+} /* namespace llvm */
+
+#endif /* __SCHEDULING_SDC_GRAPH_SDC_SOLVER_HPP__ */
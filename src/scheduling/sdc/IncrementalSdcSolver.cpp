@@ -0,0 +1,289 @@
+#include <vector>
+#include <deque>
+#include <algorithm>
+#include <cmath>
+#include <cassert>
+
+#include <llvm/Support/ErrorHandling.h>
+
+#include "../../utility/PhaseProfile.hpp"
+#include "IncrementalSdcSolver.hpp"
+
+using namespace llvm;
+using namespace bphls;
+
+sdc::IncrementalSdcSolver::IncrementalSdcSolver(unsigned int n_vars)
+    : n_vars(n_vars),
+      zero_node(n_vars),
+      infeasible(false),
+      last_objective(Asap),
+      out_edges(n_vars + 1),
+      in_edges(n_vars + 1),
+      asap(false, 0, n_vars + 1),   /* Variables are non-negative */
+      alap(true, UNBOUNDED, n_vars + 1),
+      in_worklist(n_vars + 1, false),
+      n_relaxed(n_vars + 1, 0),
+      n_visits(0)
+{
+    asap.value[zero_node] = 0;
+    alap.value[zero_node] = 0;
+}
+
+sdc::SdcSolver::ConstraintId sdc::IncrementalSdcSolver::addConstraint(Row& row,
+                                                                    ConstraintType type,
+                                                                    double rhs)
+{
+    assert(isDifferenceRow(row) && "Not a difference constraint");
+    assert((std::floor(rhs) == rhs) && "Non-integer constraint bound");
+
+    /* Normalize to x_a - x_b (type) c, x_b is the zero node for bounds */
+    unsigned int var_a = zero_node;
+    unsigned int var_b = zero_node;
+
+    for (auto& var_coeff : row) {
+        assert(var_coeff.first < n_vars);
+
+        if (var_coeff.second > 0.0) {
+            var_a = var_coeff.first;
+        } else {
+            var_b = var_coeff.first;
+        }
+    }
+
+    int c = static_cast<int>(rhs);
+
+    ConstraintId id = constraint_edges.size();
+    constraint_edges.emplace_back();
+
+    if ((type == Ge) || (type == Eq)) {
+        /* x_a - x_b >= c */
+        constraint_edges[id].push_back(addEdge(var_b, var_a, c));
+    }
+
+    if ((type == Le) || (type == Eq)) {
+        /* x_b - x_a >= -c */
+        constraint_edges[id].push_back(addEdge(var_a, var_b, -c));
+    }
+
+    return id;
+}
+
+void sdc::IncrementalSdcSolver::removeConstraint(ConstraintId id) {
+    assert(id < constraint_edges.size());
+
+    for (auto edge_id : constraint_edges[id]) {
+        removeEdge(edge_id);
+    }
+
+    constraint_edges[id].clear();
+}
+
+bool sdc::IncrementalSdcSolver::solve(Objective objective) {
+    last_objective = objective;
+
+    if (infeasible) {
+        return false;
+    }
+
+    if (objective == Alap) {
+        for (unsigned int var = 0; var < n_vars; var++) {
+            /* Unbounded or below implicit zero lower bound */
+            if ((alap.value[var] == UNBOUNDED) || (alap.value[var] > 0)) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+sdc::IncrementalSdcSolver::~IncrementalSdcSolver() {
+    utility::PhaseProfile::count("sdc.iterations", n_visits);
+}
+
+int sdc::IncrementalSdcSolver::getValue(unsigned int var) {
+    assert(var < n_vars);
+
+    if (last_objective == Asap) {
+        return asap.value[var];
+    } else {
+        return -alap.value[var];
+    }
+}
+
+unsigned int sdc::IncrementalSdcSolver::addEdge(unsigned int from, unsigned int to, int weight) {
+    unsigned int edge_id = edges.size();
+    edges.emplace_back(from, to, weight);
+
+    out_edges[from].push_back(edge_id);
+    in_edges[to].push_back(edge_id);
+
+    if (!infeasible) {
+        propagateAddedEdge(asap, edges[edge_id]);
+    }
+
+    if (!infeasible) {
+        propagateAddedEdge(alap, edges[edge_id]);
+    }
+
+    return edge_id;
+}
+
+void sdc::IncrementalSdcSolver::removeEdge(unsigned int edge_id) {
+    auto& edge = edges[edge_id];
+    assert(edge.alive);
+
+    edge.alive = false;
+
+    auto& from_out = out_edges[edge.from];
+    from_out.erase(std::find(from_out.begin(), from_out.end(), edge_id));
+
+    auto& to_in = in_edges[edge.to];
+    to_in.erase(std::find(to_in.begin(), to_in.end(), edge_id));
+
+    if (infeasible) {
+        /* Aborted propagation left potentials inconsistent */
+        infeasible = false;
+        recompute(asap);
+        recompute(alap);
+        return;
+    }
+
+    propagateRemovedEdge(asap, edge);
+    propagateRemovedEdge(alap, edge);
+}
+
+bool sdc::IncrementalSdcSolver::isTight(Potentials& pot, Edge& edge) {
+    int tail_value = pot.value[getTail(pot, edge)];
+
+    if (tail_value == UNBOUNDED) {
+        return false;
+    }
+
+    return pot.value[getHead(pot, edge)] == tail_value + edge.weight;
+}
+
+void sdc::IncrementalSdcSolver::relax(Potentials& pot, Edge& edge) {
+    unsigned int tail = getTail(pot, edge);
+    unsigned int head = getHead(pot, edge);
+
+    if (pot.value[tail] == UNBOUNDED) {
+        return;
+    }
+
+    int new_value = pot.value[tail] + edge.weight;
+
+    if ((pot.value[head] != UNBOUNDED) && (pot.value[head] >= new_value)) {
+        return;
+    }
+
+    if (head == zero_node) {
+        /* Zero node is pinned: bound violated */
+        infeasible = true;
+        return;
+    }
+
+    pot.value[head] = new_value;
+
+    if (!in_worklist[head]) {
+        in_worklist[head] = true;
+        worklist.push_back(head);
+    }
+}
+
+void sdc::IncrementalSdcSolver::propagate(Potentials& pot) {
+    const unsigned int n_nodes = n_vars + 1;
+
+    std::vector<unsigned int> touched;
+
+    while (!worklist.empty() && !infeasible) {
+        unsigned int node = worklist.front();
+        worklist.pop_front();
+        in_worklist[node] = false;
+        n_visits += 1;
+
+        if (n_relaxed[node] == 0) {
+            touched.push_back(node);
+        }
+
+        /* Node re-queued more than |V| times lies on a positive cycle */
+        if (++n_relaxed[node] > n_nodes) {
+            infeasible = true;
+            break;
+        }
+
+        for (auto edge_id : getSuccEdges(pot, node)) {
+            relax(pot, edges[edge_id]);
+        }
+    }
+
+    while (!worklist.empty()) {
+        in_worklist[worklist.front()] = false;
+        worklist.pop_front();
+    }
+
+    for (auto node : touched) {
+        n_relaxed[node] = 0;
+    }
+}
+
+void sdc::IncrementalSdcSolver::propagateAddedEdge(Potentials& pot, Edge& edge) {
+    relax(pot, edge);
+    propagate(pot);
+}
+
+void sdc::IncrementalSdcSolver::propagateRemovedEdge(Potentials& pot, Edge& edge) {
+    if (!isTight(pot, edge) || (getHead(pot, edge) == zero_node)) {
+        /* Removed edge did not define its head potential */
+        return;
+    }
+
+    /* Collect nodes whose potential may have been supported by the edge */
+    std::vector<unsigned int> affected;
+    std::vector<bool> is_affected(n_vars + 1, false);
+
+    affected.push_back(getHead(pot, edge));
+    is_affected[getHead(pot, edge)] = true;
+
+    for (unsigned int i = 0; i < affected.size(); i++) {
+        for (auto edge_id : getSuccEdges(pot, affected[i])) {
+            auto& succ_edge = edges[edge_id];
+            unsigned int head = getHead(pot, succ_edge);
+
+            if (!is_affected[head] && (head != zero_node) && isTight(pot, succ_edge)) {
+                is_affected[head] = true;
+                affected.push_back(head);
+            }
+        }
+    }
+
+    /* Reset affected potentials and recompute them from their predecessors */
+    for (auto node : affected) {
+        pot.value[node] = pot.base;
+    }
+
+    for (auto node : affected) {
+        for (auto edge_id : getPredEdges(pot, node)) {
+            relax(pot, edges[edge_id]);
+        }
+    }
+
+    propagate(pot);
+}
+
+void sdc::IncrementalSdcSolver::recompute(Potentials& pot) {
+    std::fill(pot.value.begin(), pot.value.end(), pot.base);
+    pot.value[zero_node] = 0;
+
+    in_worklist[zero_node] = true;
+    worklist.push_back(zero_node);
+
+    for (unsigned int node = 0; node < n_vars; node++) {
+        if (pot.value[node] != UNBOUNDED) {
+            in_worklist[node] = true;
+            worklist.push_back(node);
+        }
+    }
+
+    propagate(pot);
+}
@@ -0,0 +1,128 @@
+#ifndef __SCHEDULING_SDC_INCREMENTAL_SDC_SOLVER_HPP__
+#define __SCHEDULING_SDC_INCREMENTAL_SDC_SOLVER_HPP__
+
+#include <vector>
+#include <deque>
+#include <climits>
+
+#include "SdcSolver.hpp"
+
+namespace llvm {
+    namespace bphls {
+        namespace sdc {
+
+/**
+ * System of difference constraints kept live as a constraint graph.
+ *
+ * Every constraint x_a - x_b >= c is an edge b -> a with weight c, single
+ * variable bounds are edges to/from an extra zero node pinned at 0.
+ * ASAP (least) and ALAP (greatest) solutions are longest path potentials
+ * over the graph and its reverse. Both are maintained by incremental
+ * Bellman-Ford: adding an edge propagates from its head only, removing an
+ * edge resets and re-propagates the nodes that were supported by it.
+ *
+ * Any non-negative objective over the variables is optimized by the least
+ * (ASAP) or the greatest (ALAP) solution, so the objective row is ignored.
+ */
+class IncrementalSdcSolver : public SdcSolver {
+public:
+    IncrementalSdcSolver(unsigned int n_vars);
+
+    ~IncrementalSdcSolver();
+
+    ConstraintId addConstraint(Row& row, ConstraintType type, double rhs) override;
+
+    void removeConstraint(ConstraintId id) override;
+
+    void setObjective(Row& row) override {};
+
+    bool solve(Objective objective) override;
+
+    int getValue(unsigned int var) override;
+
+    unsigned int getVariablesNum() override { return n_vars; }
+
+private:
+    static const int UNBOUNDED = INT_MIN;
+
+    /** Constraint x_to - x_from >= weight */
+    struct Edge {
+        unsigned int from;
+        unsigned int to;
+        int weight;
+        bool alive;
+
+        Edge(unsigned int from, unsigned int to, int weight)
+            : from(from),
+              to(to),
+              weight(weight),
+              alive(true) {}
+    };
+
+    /** Longest path potentials over the graph (ASAP) or its reverse (ALAP) */
+    struct Potentials {
+        bool reversed;
+        int base;
+        std::vector<int> value;
+
+        Potentials(bool reversed, int base, unsigned int n_nodes)
+            : reversed(reversed),
+              base(base),
+              value(n_nodes, base) {}
+    };
+
+    unsigned int n_vars;
+    unsigned int zero_node;
+
+    bool infeasible;
+    Objective last_objective;
+
+    std::vector<Edge> edges;
+    std::vector<std::vector<unsigned int>> out_edges;
+    std::vector<std::vector<unsigned int>> in_edges;
+    std::vector<std::vector<unsigned int>> constraint_edges;
+
+    Potentials asap;
+    Potentials alap;
+
+    std::deque<unsigned int> worklist;
+    std::vector<bool> in_worklist;
+    std::vector<unsigned int> n_relaxed;
+
+    /* Worklist visits of all updates, reported when the solver is released */
+    long long n_visits;
+
+    unsigned int addEdge(unsigned int from, unsigned int to, int weight);
+
+    void removeEdge(unsigned int edge_id);
+
+    unsigned int getTail(Potentials& pot, Edge& edge) { return pot.reversed ? edge.to : edge.from; }
+
+    unsigned int getHead(Potentials& pot, Edge& edge) { return pot.reversed ? edge.from : edge.to; }
+
+    std::vector<unsigned int>& getSuccEdges(Potentials& pot, unsigned int node) {
+        return pot.reversed ? in_edges[node] : out_edges[node];
+    }
+
+    std::vector<unsigned int>& getPredEdges(Potentials& pot, unsigned int node) {
+        return pot.reversed ? out_edges[node] : in_edges[node];
+    }
+
+    bool isTight(Potentials& pot, Edge& edge);
+
+    void relax(Potentials& pot, Edge& edge);
+
+    void propagate(Potentials& pot);
+
+    void propagateAddedEdge(Potentials& pot, Edge& edge);
+
+    void propagateRemovedEdge(Potentials& pot, Edge& edge);
+
+    void recompute(Potentials& pot);
+};
+
+        } /* namespace sdc */
+    } /* namespace bphls */
+} /* namespace llvm */
+
+#endif /* __SCHEDULING_SDC_INCREMENTAL_SDC_SOLVER_HPP__ */
@@ -0,0 +1,127 @@
+#ifdef LPSOLVE
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <cassert>
+
+#include <llvm/Support/ErrorHandling.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include <lpsolve/lp_lib.h>
+
+#include "../../utility/PhaseProfile.hpp"
+#include "LpSdcSolver.hpp"
+
+using namespace llvm;
+using namespace bphls;
+
+sdc::LpSdcSolver::LpSdcSolver(unsigned int n_vars)
+    : n_vars(n_vars),
+      next_id(0),
+      solution(n_vars, 0.0),
+      n_iterations(0)
+{
+    lp_solver = make_lp(0, n_vars);
+
+    if (lp_solver == nullptr) {
+        report_fatal_error("LP solver could not be created");
+    }
+}
+
+sdc::LpSdcSolver::~LpSdcSolver() {
+    utility::PhaseProfile::count("sdc.iterations", n_iterations);
+
+    delete_lp(lp_solver);
+}
+
+sdc::SdcSolver::ConstraintId sdc::LpSdcSolver::addConstraint(Row& row,
+                                                           ConstraintType type,
+                                                           double rhs)
+{
+    std::vector<int> lpvar_cols;
+    std::vector<REAL> lpvar_coeffs;
+
+    for (auto& var_coeff : row) {
+        lpvar_cols.push_back(1 + var_coeff.first);
+        lpvar_coeffs.push_back(var_coeff.second);
+    }
+
+    int lp_type = EQ;
+
+    switch (type) {
+    case Le:
+        lp_type = LE;
+        break;
+    case Ge:
+        lp_type = GE;
+        break;
+    case Eq:
+        lp_type = EQ;
+        break;
+    }
+
+    add_constraintex(
+        lp_solver,
+        row.size(),
+        lpvar_coeffs.data(),
+        lpvar_cols.data(),
+        lp_type,
+        rhs
+    );
+
+    row_ids.push_back(next_id);
+
+    return next_id++;
+}
+
+void sdc::LpSdcSolver::removeConstraint(ConstraintId id) {
+    auto row_iter = std::find(row_ids.begin(), row_ids.end(), id);
+    assert(row_iter != row_ids.end());
+
+    del_constraint(lp_solver, 1 + (row_iter - row_ids.begin()));
+    row_ids.erase(row_iter);
+}
+
+void sdc::LpSdcSolver::setObjective(Row& row) {
+    std::vector<int> lpvar_cols;
+    std::vector<REAL> lpvar_coeffs;
+
+    for (auto& var_coeff : row) {
+        lpvar_cols.push_back(1 + var_coeff.first);
+        lpvar_coeffs.push_back(var_coeff.second);
+    }
+
+    set_obj_fnex(lp_solver, row.size(), lpvar_coeffs.data(), lpvar_cols.data());
+}
+
+bool sdc::LpSdcSolver::solve(Objective objective) {
+    switch (objective) {
+    case Asap:
+        set_minim(lp_solver);
+        break;
+    case Alap:
+        set_maxim(lp_solver);
+        break;
+    }
+
+    int lp_solver_status = ::solve(lp_solver);
+
+    n_iterations += get_total_iter(lp_solver);
+
+    if (lp_solver_status != 0) {
+        errs() << "LP solver returned: " << lp_solver_status << "\n";
+        return false;
+    }
+
+    get_variables(lp_solver, solution.data());
+
+    return true;
+}
+
+int sdc::LpSdcSolver::getValue(unsigned int var) {
+    assert(var < n_vars);
+    return static_cast<int>(std::lround(solution[var]));
+}
+
+#endif /* LPSOLVE */
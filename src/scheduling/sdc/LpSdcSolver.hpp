@@ -0,0 +1,59 @@
+#ifndef __SCHEDULING_SDC_LP_SDC_SOLVER_HPP__
+#define __SCHEDULING_SDC_LP_SDC_SOLVER_HPP__
+
+#include <vector>
+
+#include <lpsolve/lp_lib.h>
+
+#include "SdcSolver.hpp"
+
+namespace llvm {
+    namespace bphls {
+        namespace sdc {
+
+/**
+ * General LP solver backend. Used as a fallback when the constraint
+ * system is not a pure system of difference constraints.
+ *
+ * The model is built once and modified in place, so every solve is warm
+ * started from the basis of the previous one.
+ */
+class LpSdcSolver : public SdcSolver {
+public:
+    LpSdcSolver(unsigned int n_vars);
+
+    ~LpSdcSolver();
+
+    ConstraintId addConstraint(Row& row, ConstraintType type, double rhs) override;
+
+    void removeConstraint(ConstraintId id) override;
+
+    void setObjective(Row& row) override;
+
+    bool solve(Objective objective) override;
+
+    int getValue(unsigned int var) override;
+
+    unsigned int getVariablesNum() override { return n_vars; }
+
+private:
+    unsigned int n_vars;
+
+    lprec* lp_solver;
+
+    ConstraintId next_id;
+
+    /* Constraint ids in LP row order */
+    std::vector<ConstraintId> row_ids;
+
+    std::vector<REAL> solution;
+
+    /* Simplex iterations of all solves, reported when the solver is released */
+    long long n_iterations;
+};
+
+        } /* namespace sdc */
+    } /* namespace bphls */
+} /* namespace llvm */
+
+#endif /* __SCHEDULING_SDC_LP_SDC_SOLVER_HPP__ */
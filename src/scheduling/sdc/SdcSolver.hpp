@@ -0,0 +1,83 @@
+#ifndef __SCHEDULING_SDC_SDC_SOLVER_HPP__
+#define __SCHEDULING_SDC_SDC_SOLVER_HPP__
+
+#include <vector>
+#include <utility>
+
+namespace llvm {
+    namespace bphls {
+        namespace sdc {
+
+/**
+ * Solver of the scheduling constraint system. Variables are non-negative
+ * integers (clock cycles) indexed from 0, constraints are linear rows
+ * sum(coeff_i * x_i) (<=|>=|==) rhs.
+ *
+ * The system is kept live between solves: constraints may be added and
+ * removed and the previous solution is reused as a starting point.
+ */
+class SdcSolver {
+public:
+    enum ConstraintType {
+        Le,
+        Ge,
+        Eq,
+    };
+
+    enum Objective {
+        Asap,   /* Minimize sum of variables */
+        Alap,   /* Maximize sum of variables */
+    };
+
+    typedef unsigned int ConstraintId;
+
+    typedef std::vector<std::pair<unsigned int /* var */, double /* coeff */>> Row;
+
+    virtual ~SdcSolver() {};
+
+    virtual ConstraintId addConstraint(Row& row, ConstraintType type, double rhs) = 0;
+
+    virtual void removeConstraint(ConstraintId id) = 0;
+
+    virtual void setObjective(Row& row) = 0;
+
+    virtual bool solve(Objective objective) = 0;
+
+    virtual int getValue(unsigned int var) = 0;
+
+    virtual unsigned int getVariablesNum() = 0;
+
+    /** Variables on a cycle of contradicting constraints after failed solve */
+    virtual std::vector<unsigned int> getInfeasibleCycle() { return {}; }
+
+    /** True if row has the form x_a - x_b or x_a (difference constraint) */
+    static bool isDifferenceRow(Row& row) {
+        if (row.size() == 1) {
+            return row[0].second == 1.0;
+        }
+
+        if (row.size() == 2) {
+            return ((row[0].second == 1.0) && (row[1].second == -1.0))
+                        || ((row[0].second == -1.0) && (row[1].second == 1.0));
+        }
+
+        return false;
+    }
+
+    /** True if objective is optimized by the least/greatest solution */
+    static bool isMonotoneRow(Row& row) {
+        for (auto& var_coeff : row) {
+            if (var_coeff.second < 0.0) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+};
+
+        } /* namespace sdc */
+    } /* namespace bphls */
+} /* namespace llvm */
+
+#endif /* __SCHEDULING_SDC_SDC_SOLVER_HPP__ */
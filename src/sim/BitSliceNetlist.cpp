@@ -0,0 +1,724 @@
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <llvm/ADT/Hashing.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include "../rtl/SignalLevelization.hpp"
+#include "../utility/verilog_utility.hpp"
+#include "BitSliceNetlist.hpp"
+
+using namespace llvm;
+using namespace bphls;
+
+/* Ports and operation results are at most 64 bits wide, as in the C++
+ * model. Registers are wider only as bit-packed fields, never computed */
+static const unsigned int MAX_WIDTH = 64;
+
+static const std::string UNKNOWN_NAME = "unknown";
+
+/* Part select is printed for explicit indices only, as by VerilogWriter */
+static bool hasSlice(rtl::RtlWidth width) {
+    return width.getMsbIndex().has_value();
+}
+
+static uint64_t getMask(unsigned int width) {
+    return (width >= MAX_WIDTH) ? ~0ULL : ((1ULL << width) - 1);
+}
+
+bool sim::BitSliceNetlist::GateKey::operator==(const GateKey& other) const {
+    return (opcode == other.opcode)
+        && (lhs == other.lhs)
+        && (rhs == other.rhs)
+        && (select == other.select)
+        && (lhs_version == other.lhs_version)
+        && (rhs_version == other.rhs_version)
+        && (select_version == other.select_version);
+}
+
+std::size_t sim::BitSliceNetlist::GateKeyHash::operator()(const GateKey& key) const {
+    return hash_combine(static_cast<unsigned int>(key.opcode),
+                        key.lhs, key.rhs, key.select,
+                        key.lhs_version, key.rhs_version, key.select_version);
+}
+
+bool sim::BitSliceNetlist::build() {
+    if (!rtl_module.iter_instances().empty()) {
+        reportUnsupported("module instances");
+        return false;
+    }
+
+    addSlot(false);
+    addSlot(false);
+
+    auto add_signal = [this](rtl::RtlSignal* signal, bool is_port) {
+        unsigned int width = signal->getWidth().getBitwidth();
+
+        if (is_port && (width > MAX_WIDTH)) {
+            reportUnsupported("signal '" + signal->getName().value_or(UNKNOWN_NAME)
+                + "' is wider than " + std::to_string(MAX_WIDTH) + " bits");
+            return;
+        }
+
+        auto& slots = signal_slots[signal];
+
+        for (unsigned int i = 0; i < width; i++) {
+            slots.push_back(addSlot(true));
+        }
+    };
+
+    for (auto* port : rtl_module.iter_ports()) {
+        add_signal(port, true);
+    }
+
+    for (auto* signal : rtl_module.iter_signals()) {
+        add_signal(signal, false);
+    }
+
+    if (!is_valid) {
+        return false;
+    }
+
+    rtl::SignalLevelization levelization(rtl_module);
+    levelization.run();
+
+    buildEval(levelization.getCombGroups());
+
+    /* Gates are shared within a program only */
+    gate_cache.clear();
+
+    buildTick(levelization.getRegisters());
+
+    return is_valid;
+}
+
+std::vector<unsigned int>& sim::BitSliceNetlist::getSignalSlots(rtl::RtlSignal* signal) {
+    return signal_slots[signal];
+}
+
+unsigned int sim::BitSliceNetlist::addSlot(bool is_signal) {
+    slot_versions.push_back(0);
+    is_signal_slot.push_back(is_signal);
+
+    return slot_versions.size() - 1;
+}
+
+void sim::BitSliceNetlist::startBlock(std::vector<GateBlock>& program, unsigned int passes) {
+    /* Straight-line groups extend the previous block */
+    if (!program.empty() && (passes == 1) && (program.back().passes == 1)) {
+        return;
+    }
+
+    program.push_back({ static_cast<unsigned int>(gates.size()),
+                        static_cast<unsigned int>(gates.size()),
+                        passes });
+}
+
+void sim::BitSliceNetlist::endBlock(std::vector<GateBlock>& program) {
+    program.back().end = gates.size();
+}
+
+void sim::BitSliceNetlist::buildEval(std::vector<std::vector<rtl::RtlSignal*>>& comb_groups) {
+    for (auto& group : comb_groups) {
+        /* Loop of multiplexers, settles in at most one pass per member */
+        startBlock(eval_program, group.size());
+
+        /* Stores of later passes reach the reads before them */
+        if (group.size() > 1) {
+            for (auto* signal : group) {
+                for (auto slot : signal_slots[signal]) {
+                    slot_versions[slot]++;
+                }
+            }
+        }
+
+        for (auto* signal : group) {
+            storeSignal(signal, defineSignal(signal, true));
+        }
+
+        endBlock(eval_program);
+    }
+}
+
+void sim::BitSliceNetlist::buildTick(std::vector<rtl::RtlSignal*>& registers) {
+    startBlock(tick_program, 1);
+
+    std::vector<Bits> next_values;
+
+    for (auto* signal : registers) {
+        next_values.push_back(defineSignal(signal, false));
+    }
+
+    /* Registers latch at once, current values are read before any store */
+    std::vector<bool> is_register_slot(slot_versions.size(), false);
+
+    for (auto* signal : registers) {
+        for (auto slot : signal_slots[signal]) {
+            is_register_slot[slot] = true;
+        }
+    }
+
+    for (unsigned int i = 0; i < registers.size(); i++) {
+        auto& slots = signal_slots[registers[i]];
+
+        for (unsigned int j = 0; j < slots.size(); j++) {
+            auto& src = next_values[i][j];
+
+            if ((src != slots[j]) && is_register_slot[src]) {
+                src = addGate(Copy, src);
+            }
+        }
+    }
+
+    for (unsigned int i = 0; i < registers.size(); i++) {
+        auto& slots = signal_slots[registers[i]];
+
+        for (unsigned int j = 0; j < slots.size(); j++) {
+            if (next_values[i][j] != slots[j]) {
+                addStore(slots[j], next_values[i][j]);
+            }
+        }
+    }
+
+    endBlock(tick_program);
+}
+
+sim::BitSliceNetlist::Bits sim::BitSliceNetlist::defineSignal(rtl::RtlSignal* signal,
+                                                              bool is_self_read)
+{
+    Bits value = signal_slots[signal];
+
+    /* Combinational signals read the value assigned so far, registers the latched one */
+    if (is_self_read) {
+        defining_signal = signal;
+        defining_value = &value;
+    }
+
+    if (signal->getDefaultDriver() != nullptr) {
+        value = assignDriver(signal, signal->getDefaultDriver(), value);
+    }
+
+    if (signal->getConditionsNum() == 0) {
+        value = assignDriver(signal, signal->getDriver(0), value);
+    } else {
+        assignConditions(signal, value);
+    }
+
+    defining_signal = nullptr;
+    defining_value = nullptr;
+
+    return value;
+}
+
+void sim::BitSliceNetlist::assignConditions(rtl::RtlSignal* signal, Bits& value) {
+    unsigned int n_conditions = signal->getConditionsNum();
+
+    /* Registers keep their value and defaults are overridden in order */
+    bool no_else = signal->isRegister() || (signal->getDefaultDriver() != nullptr);
+
+    if (!no_else && (n_conditions == 1)) {
+        value = assignDriver(signal, signal->getDriver(0), value);
+        return;
+    }
+
+    if (no_else) {
+        for (unsigned int i = 0; i < n_conditions; i++) {
+            auto condition = lowerReduceOr(lowerValue(signal->getCondition(i)));
+            auto assigned = assignDriver(signal, signal->getDriver(i), value);
+
+            value = mux(condition, value, assigned);
+        }
+
+        return;
+    }
+
+    /* Chain of else-ifs, all branches assign to the value before it */
+    auto result = assignDriver(signal, signal->getDriver(n_conditions - 1), value);
+
+    for (unsigned int i = n_conditions - 1; i-- > 0;) {
+        auto condition = lowerReduceOr(lowerValue(signal->getCondition(i)));
+        auto assigned = assignDriver(signal, signal->getDriver(i), value);
+
+        result = mux(condition, result, assigned);
+    }
+
+    value = result;
+}
+
+sim::BitSliceNetlist::Bits sim::BitSliceNetlist::assignDriver(rtl::RtlSignal* signal,
+                                                              rtl::RtlSignal::RtlSignalDriver* driver,
+                                                              const Bits& value)
+{
+    assert(driver != nullptr);
+
+    unsigned int signal_width = value.size();
+    auto dest_bits = driver->dest_bits;
+
+    auto src = lowerValue(driver->signal, driver->src_bits);
+    auto get_src_bit = [&src](unsigned int i) {
+        return (i < src.size()) ? src[i] : ZERO_SLOT;
+    };
+
+    Bits result = value;
+
+    /* Part select of the whole signal is a plain assignment */
+    bool is_partial =
+        hasSlice(dest_bits)
+            && ((dest_bits.getLsbIndex().value() != 0)
+                    || (dest_bits.getMsbIndex().value() + 1U < signal_width));
+
+    if (is_partial) {
+        unsigned int msb = dest_bits.getMsbIndex().value();
+        unsigned int lsb = dest_bits.getLsbIndex().value();
+
+        /* Bits above the signal are dropped, as out of range part selects */
+        for (unsigned int i = lsb; (i <= msb) && (i < signal_width); i++) {
+            result[i] = get_src_bit(i - lsb);
+        }
+    } else {
+        for (unsigned int i = 0; i < signal_width; i++) {
+            result[i] = get_src_bit(i);
+        }
+    }
+
+    return result;
+}
+
+sim::BitSliceNetlist::Bits sim::BitSliceNetlist::mux(unsigned int select,
+                                                     const Bits& lhs,
+                                                     const Bits& rhs)
+{
+    assert(lhs.size() == rhs.size());
+
+    Bits result(lhs.size());
+
+    for (unsigned int i = 0; i < lhs.size(); i++) {
+        result[i] = addGate(Mux, lhs[i], rhs[i], select);
+    }
+
+    return result;
+}
+
+void sim::BitSliceNetlist::storeSignal(rtl::RtlSignal* signal, const Bits& value) {
+    auto& slots = signal_slots[signal];
+
+    if (slots.empty()) {
+        return;
+    }
+
+    /* Bits moved within the signal are read before they are overwritten */
+    Bits stored = value;
+
+    for (unsigned int i = 0; i < slots.size(); i++) {
+        auto& src = stored[i];
+
+        if ((src != slots[i]) && (src >= slots.front()) && (src <= slots.back())) {
+            src = addGate(Copy, src);
+        }
+    }
+
+    for (unsigned int i = 0; i < slots.size(); i++) {
+        if (value[i] != slots[i]) {
+            addStore(slots[i], stored[i]);
+        }
+    }
+}
+
+sim::BitSliceNetlist::Bits sim::BitSliceNetlist::lowerValue(rtl::RtlSignal* signal, rtl::RtlWidth width) {
+    /* Missing operands of unary functional units read as zero */
+    if (signal == nullptr) {
+        return {};
+    }
+
+    if (signal->isOperation()) {
+        return lowerOperation(static_cast<rtl::RtlOperation*>(signal), width);
+    }
+
+    if (signal->getType() == "parameter") {
+        return lowerConstant(signal->getValue().value_or("0"), signal->getWidth().getBitwidth());
+    }
+
+    if (signal->getValue().has_value()) {
+        return lowerConstant(signal->getValue().value(), signal->getWidth().getBitwidth());
+    }
+
+    auto slots_iter = signal_slots.find(signal);
+
+    if (slots_iter == signal_slots.end()) {
+        reportUnsupported("signal '" + signal->getName().value_or(UNKNOWN_NAME)
+            + "' is not declared");
+        return {};
+    }
+
+    auto& bits = (signal == defining_signal) ? *defining_value : slots_iter->second;
+
+    if (!hasSlice(width)) {
+        return bits;
+    }
+
+    unsigned int msb = width.getMsbIndex().value();
+    unsigned int lsb = width.getLsbIndex().value();
+
+    if (lsb > msb) {
+        return {};
+    }
+
+    Bits result;
+
+    for (unsigned int i = lsb; (i <= msb) && (i < bits.size()); i++) {
+        result.push_back(bits[i]);
+    }
+
+    return result;
+}
+
+sim::BitSliceNetlist::Bits sim::BitSliceNetlist::lowerOperation(rtl::RtlOperation* operation,
+                                                                rtl::RtlWidth width)
+{
+    assert(operation != nullptr);
+
+    auto opcode = operation->getOpcode();
+    unsigned int op_width = std::min<unsigned int>(operation->getWidth().getBitwidth(), MAX_WIDTH);
+
+    auto get_bit = [](const Bits& value, unsigned int i) {
+        return (i < value.size()) ? value[i] : ZERO_SLOT;
+    };
+
+    auto bitwise = [&](GateOpcode gate_opcode, const Bits& lhs, const Bits& rhs) {
+        Bits result(op_width);
+
+        for (unsigned int i = 0; i < op_width; i++) {
+            result[i] = addGate(gate_opcode, get_bit(lhs, i), get_bit(rhs, i));
+        }
+
+        return result;
+    };
+
+    auto differences = [&](const Bits& lhs, const Bits& rhs) {
+        Bits result(std::max(lhs.size(), rhs.size()));
+
+        for (unsigned int i = 0; i < result.size(); i++) {
+            result[i] = addGate(Xor, get_bit(lhs, i), get_bit(rhs, i));
+        }
+
+        return result;
+    };
+
+    switch (operation->getOperandsNum()) {
+    case 2: {
+        auto lhs = lowerValue(operation->getOperand(0));
+        auto rhs = lowerValue(operation->getOperand(1));
+
+        switch (opcode) {
+        case rtl::RtlOperation::Eq:
+            return { addGate(Not, lowerReduceOr(differences(lhs, rhs))) };
+        case rtl::RtlOperation::Ne:
+            return { lowerReduceOr(differences(lhs, rhs)) };
+        case rtl::RtlOperation::Lt:
+            return { lowerLess(lhs, rhs) };
+        case rtl::RtlOperation::Le:
+            return { addGate(Not, lowerLess(rhs, lhs)) };
+        case rtl::RtlOperation::Gt:
+            return { lowerLess(rhs, lhs) };
+        case rtl::RtlOperation::Ge:
+            return { addGate(Not, lowerLess(lhs, rhs)) };
+        case rtl::RtlOperation::Concat: {
+            unsigned int shift = operation->getOperand(1)->getWidth().getBitwidth();
+            unsigned int concat_width = std::min<unsigned int>(
+                std::max<unsigned int>(lhs.size() + shift, rhs.size()), MAX_WIDTH);
+
+            Bits result(concat_width);
+
+            for (unsigned int i = 0; i < concat_width; i++) {
+                auto lhs_bit = (i >= shift) ? get_bit(lhs, i - shift) : ZERO_SLOT;
+                result[i] = addGate(Or, lhs_bit, get_bit(rhs, i));
+            }
+
+            return result;
+        }
+        case rtl::RtlOperation::And:
+            return bitwise(And, lhs, rhs);
+        case rtl::RtlOperation::Or:
+            return bitwise(Or, lhs, rhs);
+        case rtl::RtlOperation::Xor:
+            return bitwise(Xor, lhs, rhs);
+        case rtl::RtlOperation::Add:
+            return lowerAdd(lhs, rhs, ZERO_SLOT, op_width);
+        case rtl::RtlOperation::Sub: {
+            /* a - b = a + ~b + 1 */
+            Bits inverted(op_width);
+
+            for (unsigned int i = 0; i < op_width; i++) {
+                inverted[i] = addGate(Not, get_bit(rhs, i));
+            }
+
+            return lowerAdd(lhs, inverted, ONES_SLOT, op_width);
+        }
+        case rtl::RtlOperation::Mul:
+            return lowerMul(lhs, rhs, op_width);
+        default:
+            reportUnsupported("binary operation " + std::to_string(opcode));
+            return {};
+        }
+    }
+    case 1:
+        if (opcode == rtl::RtlOperation::Not) {
+            auto value = lowerValue(operation->getOperand(0));
+            Bits result(op_width);
+
+            for (unsigned int i = 0; i < op_width; i++) {
+                result[i] = addGate(Not, get_bit(value, i));
+            }
+
+            return result;
+        } else if (opcode == rtl::RtlOperation::SExt) {
+            unsigned int src_width = operation->getOperand(0)->getWidth().getBitwidth();
+            auto value = lowerValue(operation->getOperand(0));
+
+            if (src_width >= op_width) {
+                return value;
+            }
+
+            Bits result(op_width);
+
+            if (value.size() <= src_width) {
+                for (unsigned int i = 0; i < op_width; i++) {
+                    result[i] = get_bit(value, std::min(i, src_width - 1));
+                }
+
+                return result;
+            }
+
+            /* Wider values, sign bit is flipped and subtracted back */
+            Bits inverted_sign(op_width);
+
+            for (unsigned int i = 0; i < op_width; i++) {
+                inverted_sign[i] = (i == src_width - 1) ? ZERO_SLOT : ONES_SLOT;
+            }
+
+            value[src_width - 1] = addGate(Not, value[src_width - 1]);
+
+            return lowerAdd(value, inverted_sign, ONES_SLOT, op_width);
+        } else if (opcode == rtl::RtlOperation::ZExt) {
+            return lowerValue(operation->getOperand(0), width);
+        }
+
+        reportUnsupported("unary operation " + std::to_string(opcode));
+        return {};
+    default:
+        reportUnsupported("operation with " + std::to_string(operation->getOperandsNum())
+            + " operands");
+        return {};
+    }
+}
+
+sim::BitSliceNetlist::Bits sim::BitSliceNetlist::lowerConstant(const std::string& value, unsigned int width) {
+    uint64_t const_value = 0;
+    unsigned int const_width = 0;
+
+    if (utility::isNumeric(value)) {
+        /* Sized literal, truncated to its width */
+        const_value = std::stoull(value) & getMask(width);
+        const_width = std::min(width, MAX_WIDTH);
+    } else if ((value.size() > 1) && (value[0] == '-') && utility::isNumeric(value.substr(1))) {
+        /* Negative values are printed as unsized integers, sign extended */
+        const_value = 0ULL - std::stoull(value.substr(1));
+        const_width = MAX_WIDTH;
+    } else {
+        /* Named constants are parameters of the module */
+        for (auto* param : rtl_module.iter_params()) {
+            if (param->getName() == value) {
+                return lowerConstant(param->getValue().value_or("0"), param->getWidth().getBitwidth());
+            }
+        }
+
+        reportUnsupported("constant '" + value + "'");
+        return {};
+    }
+
+    Bits result;
+
+    for (unsigned int i = 0; i < const_width; i++) {
+        result.push_back(((const_value >> i) & 1) ? ONES_SLOT : ZERO_SLOT);
+    }
+
+    while (!result.empty() && (result.back() == ZERO_SLOT)) {
+        result.pop_back();
+    }
+
+    return result;
+}
+
+sim::BitSliceNetlist::Bits sim::BitSliceNetlist::lowerAdd(const Bits& lhs,
+                                                          const Bits& rhs,
+                                                          unsigned int carry,
+                                                          unsigned int width)
+{
+    Bits result(width);
+
+    /* Ripple carry adder, the carry out of the top bit is dropped */
+    for (unsigned int i = 0; i < width; i++) {
+        auto lhs_bit = (i < lhs.size()) ? lhs[i] : ZERO_SLOT;
+        auto rhs_bit = (i < rhs.size()) ? rhs[i] : ZERO_SLOT;
+
+        auto half_sum = addGate(Xor, lhs_bit, rhs_bit);
+        result[i] = addGate(Xor, half_sum, carry);
+
+        if (i + 1 < width) {
+            carry = addGate(Or, addGate(And, lhs_bit, rhs_bit), addGate(And, half_sum, carry));
+        }
+    }
+
+    return result;
+}
+
+sim::BitSliceNetlist::Bits sim::BitSliceNetlist::lowerMul(const Bits& lhs,
+                                                          const Bits& rhs,
+                                                          unsigned int width)
+{
+    Bits product;
+
+    /* Shifted partial products are accumulated, truncated to the width */
+    for (unsigned int j = 0; (j < width) && (j < rhs.size()); j++) {
+        if (rhs[j] == ZERO_SLOT) {
+            continue;
+        }
+
+        Bits partial(width, ZERO_SLOT);
+
+        for (unsigned int i = j; (i < width) && (i - j < lhs.size()); i++) {
+            partial[i] = addGate(And, lhs[i - j], rhs[j]);
+        }
+
+        product = lowerAdd(product, partial, ZERO_SLOT, width);
+    }
+
+    return product;
+}
+
+unsigned int sim::BitSliceNetlist::lowerLess(const Bits& lhs, const Bits& rhs) {
+    unsigned int width = std::max(lhs.size(), rhs.size());
+    unsigned int borrow = ZERO_SLOT;
+
+    /* Unsigned, the highest differing bit decides */
+    for (unsigned int i = 0; i < width; i++) {
+        auto lhs_bit = (i < lhs.size()) ? lhs[i] : ZERO_SLOT;
+        auto rhs_bit = (i < rhs.size()) ? rhs[i] : ZERO_SLOT;
+
+        borrow = addGate(Mux, borrow, rhs_bit, addGate(Xor, lhs_bit, rhs_bit));
+    }
+
+    return borrow;
+}
+
+unsigned int sim::BitSliceNetlist::lowerReduceOr(const Bits& value) {
+    unsigned int result = ZERO_SLOT;
+
+    for (auto bit : value) {
+        result = addGate(Or, result, bit);
+    }
+
+    return result;
+}
+
+unsigned int sim::BitSliceNetlist::addGate(GateOpcode opcode,
+                                           unsigned int lhs,
+                                           unsigned int rhs,
+                                           unsigned int select)
+{
+    /* Constant folding */
+    switch (opcode) {
+    case Not:
+        if ((lhs == ZERO_SLOT) || (lhs == ONES_SLOT)) {
+            return (lhs == ZERO_SLOT) ? ONES_SLOT : ZERO_SLOT;
+        }
+        break;
+    case And:
+        if ((lhs == ZERO_SLOT) || (rhs == ZERO_SLOT)) {
+            return ZERO_SLOT;
+        } else if ((lhs == ONES_SLOT) || (lhs == rhs)) {
+            return rhs;
+        } else if (rhs == ONES_SLOT) {
+            return lhs;
+        }
+        break;
+    case Or:
+        if ((lhs == ONES_SLOT) || (rhs == ONES_SLOT)) {
+            return ONES_SLOT;
+        } else if ((lhs == ZERO_SLOT) || (lhs == rhs)) {
+            return rhs;
+        } else if (rhs == ZERO_SLOT) {
+            return lhs;
+        }
+        break;
+    case Xor:
+        if (lhs == rhs) {
+            return ZERO_SLOT;
+        } else if (lhs == ZERO_SLOT) {
+            return rhs;
+        } else if (rhs == ZERO_SLOT) {
+            return lhs;
+        } else if (lhs == ONES_SLOT) {
+            return addGate(Not, rhs);
+        } else if (rhs == ONES_SLOT) {
+            return addGate(Not, lhs);
+        }
+        break;
+    case Mux:
+        if ((select == ZERO_SLOT) || (lhs == rhs)) {
+            return lhs;
+        } else if (select == ONES_SLOT) {
+            return rhs;
+        } else if ((lhs == ZERO_SLOT) && (rhs == ONES_SLOT)) {
+            return select;
+        } else if (lhs == ZERO_SLOT) {
+            return addGate(And, select, rhs);
+        } else if (rhs == ONES_SLOT) {
+            return addGate(Or, select, lhs);
+        }
+        break;
+    case Copy:
+    case Store:
+        break;
+    }
+
+    if (((opcode == And) || (opcode == Or) || (opcode == Xor)) && (lhs > rhs)) {
+        std::swap(lhs, rhs);
+    }
+
+    GateKey key = {
+        opcode, lhs, rhs, select,
+        slot_versions[lhs], slot_versions[rhs], slot_versions[select]
+    };
+
+    auto cache_iter = gate_cache.find(key);
+
+    if (cache_iter != gate_cache.end()) {
+        return cache_iter->second;
+    }
+
+    auto dest = addSlot(false);
+
+    gates.push_back({ opcode, dest, lhs, rhs, select });
+    gate_cache[key] = dest;
+
+    return dest;
+}
+
+void sim::BitSliceNetlist::addStore(unsigned int dest, unsigned int src) {
+    assert(is_signal_slot[dest]);
+
+    gates.push_back({ Store, dest, src, ZERO_SLOT, ZERO_SLOT });
+    slot_versions[dest]++;
+}
+
+void sim::BitSliceNetlist::reportUnsupported(const std::string& reason) {
+    if (is_valid) {
+        errs() << "Bit-sliced simulation of module '" << rtl_module.getName()
+            << "' is not supported: " << reason << "\n";
+    }
+
+    is_valid = false;
+}
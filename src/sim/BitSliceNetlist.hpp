@@ -0,0 +1,176 @@
+#ifndef __SIM_BIT_SLICE_NETLIST_HPP__
+#define __SIM_BIT_SLICE_NETLIST_HPP__
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <llvm/ADT/DenseMap.h>
+
+#include "../rtl/RtlSignal.hpp"
+#include "../rtl/RtlOperation.hpp"
+#include "../rtl/RtlModule.hpp"
+
+namespace llvm {
+    namespace bphls {
+        namespace sim {
+
+/**
+ * Gate level form of an RTL module for bit-sliced simulation. Every bit of
+ * every signal is a slot holding one machine word, bit j of the word is the
+ * value of the bit in test vector j, so a gate evaluates all the vectors of
+ * a word with one bitwise operation.
+ *
+ * Operations are lowered to AND, OR, XOR, NOT and multiplexer gates: ripple
+ * carry adders, shift-add multipliers and borrow chains for comparisons.
+ * Signals follow the semantics of the Verilog printed by VerilogWriter, as
+ * the C++ model does. Constants are folded and equal gates are shared.
+ *
+ * The eval program settles the combinational signals, the tick program
+ * latches the registers. Programs are lists of gate blocks, blocks of loops
+ * of multiplexers are run at most once per member signal, until a pass
+ * stores no new value.
+ */
+class BitSliceNetlist {
+public:
+    enum GateOpcode {
+        Copy,   /* dest = lhs */
+        Store,  /* dest = lhs, into a signal */
+        Not,    /* dest = ~lhs */
+        And,    /* dest = lhs & rhs */
+        Or,     /* dest = lhs | rhs */
+        Xor,    /* dest = lhs ^ rhs */
+        Mux,    /* dest = select ? rhs : lhs */
+    };
+
+    struct Gate {
+        GateOpcode opcode;
+        unsigned int dest;
+        unsigned int lhs;
+        unsigned int rhs;
+        unsigned int select;
+    };
+
+    struct GateBlock {
+        unsigned int begin;
+        unsigned int end;
+        unsigned int passes;
+    };
+
+    /* Slots of the constant words */
+    static constexpr unsigned int ZERO_SLOT = 0;
+    static constexpr unsigned int ONES_SLOT = 1;
+
+    BitSliceNetlist(rtl::RtlModule& rtl_module)
+        : rtl_module(rtl_module),
+          defining_signal(nullptr),
+          defining_value(nullptr),
+          is_valid(true) {}
+
+    /** Lowers the module, false if it is not supported */
+    bool build();
+
+    unsigned int getSlotsNum() { return slot_versions.size(); }
+
+    std::vector<Gate>& getGates() { return gates; }
+
+    std::vector<GateBlock>& getEvalProgram() { return eval_program; }
+
+    std::vector<GateBlock>& getTickProgram() { return tick_program; }
+
+    /** Slots of the bits of a port or signal, least significant first */
+    std::vector<unsigned int>& getSignalSlots(rtl::RtlSignal* signal);
+
+private:
+    typedef std::vector<unsigned int> Bits;
+
+    struct GateKey {
+        GateOpcode opcode;
+        unsigned int lhs;
+        unsigned int rhs;
+        unsigned int select;
+
+        /* Versions of signal slots, gates are shared between equal reads only */
+        unsigned int lhs_version;
+        unsigned int rhs_version;
+        unsigned int select_version;
+
+        bool operator==(const GateKey& other) const;
+    };
+
+    struct GateKeyHash {
+        std::size_t operator()(const GateKey& key) const;
+    };
+
+    rtl::RtlModule& rtl_module;
+
+    std::vector<Gate> gates;
+    std::vector<GateBlock> eval_program;
+    std::vector<GateBlock> tick_program;
+
+    DenseMap<rtl::RtlSignal*, Bits> signal_slots;
+
+    /* Stores into a slot of a signal start a new version of it */
+    std::vector<unsigned int> slot_versions;
+    std::vector<bool> is_signal_slot;
+
+    std::unordered_map<GateKey, unsigned int, GateKeyHash> gate_cache;
+
+    /* Signal read as its value assigned so far, while it is being defined */
+    rtl::RtlSignal* defining_signal;
+    Bits* defining_value;
+
+    bool is_valid;
+
+    unsigned int addSlot(bool is_signal);
+
+    void startBlock(std::vector<GateBlock>& program, unsigned int passes);
+
+    void endBlock(std::vector<GateBlock>& program);
+
+    void buildEval(std::vector<std::vector<rtl::RtlSignal*>>& comb_groups);
+
+    void buildTick(std::vector<rtl::RtlSignal*>& registers);
+
+    Bits defineSignal(rtl::RtlSignal* signal, bool is_self_read);
+
+    void assignConditions(rtl::RtlSignal* signal, Bits& value);
+
+    Bits assignDriver(rtl::RtlSignal* signal,
+                      rtl::RtlSignal::RtlSignalDriver* driver,
+                      const Bits& value);
+
+    Bits mux(unsigned int select, const Bits& lhs, const Bits& rhs);
+
+    void storeSignal(rtl::RtlSignal* signal, const Bits& value);
+
+    Bits lowerValue(rtl::RtlSignal* signal, rtl::RtlWidth width = rtl::RtlWidth());
+
+    Bits lowerOperation(rtl::RtlOperation* operation, rtl::RtlWidth width);
+
+    Bits lowerConstant(const std::string& value, unsigned int width);
+
+    Bits lowerAdd(const Bits& lhs, const Bits& rhs, unsigned int carry, unsigned int width);
+
+    Bits lowerMul(const Bits& lhs, const Bits& rhs, unsigned int width);
+
+    unsigned int lowerLess(const Bits& lhs, const Bits& rhs);
+
+    unsigned int lowerReduceOr(const Bits& value);
+
+    unsigned int addGate(GateOpcode opcode,
+                         unsigned int lhs,
+                         unsigned int rhs = ZERO_SLOT,
+                         unsigned int select = ZERO_SLOT);
+
+    void addStore(unsigned int dest, unsigned int src);
+
+    void reportUnsupported(const std::string& reason);
+};
+
+        } /* namespace sim */
+    } /* namespace bphls */
+} /* namespace llvm */
+
+#endif /* __SIM_BIT_SLICE_NETLIST_HPP__ */
@@ -0,0 +1,388 @@
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <llvm/Support/CommandLine.h>
+#include <llvm/Support/Format.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include "../utility/PhaseProfile.hpp"
+#include "../utility/log_utility.hpp"
+#include "BitSliceSimulator.hpp"
+
+using namespace llvm;
+using namespace bphls;
+
+enum SimLanes {
+    Lanes64 = 64,
+    Lanes256 = 256,
+};
+
+static cl::opt<SimLanes> sim_lanes(
+    "sim-lanes",
+    cl::desc("Test vectors simulated at once"),
+    cl::init(Lanes64),
+    cl::values(
+        clEnumValN(Lanes64, "64", "One 64-bit word per signal bit"),
+        clEnumValN(Lanes256, "256", "Four words per signal bit, AVX2 when supported")
+    )
+);
+
+static cl::opt<unsigned int> sim_max_cycles(
+    "sim-max-cycles",
+    cl::desc("Cycles after start a test vector may take to finish"),
+    cl::init(100000)
+);
+
+static const unsigned int MAX_REPORTED_MISMATCHES = 10;
+
+static const unsigned int WORD_BITS = 64;
+
+/* Four words per slot, vector operations of the compiler. Vector types are
+ * aligned to 16 bytes only without AVX, the struct keeps slots aligned for
+ * the AVX2 loads. Operators are always inlined, vectors are not passed
+ * between functions compiled for different targets. */
+#define LANE_WORD_INLINE inline __attribute__((always_inline))
+
+struct alignas(32) LaneWord256 {
+    typedef uint64_t Vector __attribute__((vector_size(32)));
+
+    Vector value;
+
+    LANE_WORD_INLINE LaneWord256 operator~() const { return { ~value }; }
+
+    LANE_WORD_INLINE LaneWord256 operator&(const LaneWord256& other) const { return { value & other.value }; }
+
+    LANE_WORD_INLINE LaneWord256 operator|(const LaneWord256& other) const { return { value | other.value }; }
+
+    LANE_WORD_INLINE LaneWord256 operator^(const LaneWord256& other) const { return { value ^ other.value }; }
+};
+
+typedef sim::BitSliceNetlist::Gate Gate;
+typedef sim::BitSliceNetlist::GateBlock GateBlock;
+
+static uint64_t getMask(unsigned int width) {
+    return (width >= WORD_BITS) ? ~0ULL : ((1ULL << width) - 1);
+}
+
+template <typename Word>
+static uint64_t* getWords(Word& word) {
+    return reinterpret_cast<uint64_t*>(&word);
+}
+
+static LANE_WORD_INLINE bool isZero(uint64_t word) {
+    return word == 0;
+}
+
+static LANE_WORD_INLINE bool isZero(const LaneWord256& word) {
+    return (word.value[0] | word.value[1] | word.value[2] | word.value[3]) == 0;
+}
+
+template <typename Word>
+static LANE_WORD_INLINE
+void evaluateProgram(const std::vector<Gate>& gates, const std::vector<GateBlock>& program, Word* slots)
+{
+    for (auto& block : program) {
+        for (unsigned int pass = 0; pass < block.passes; pass++) {
+            /* Bits changed by the stores of the pass */
+            Word changes = Word();
+
+            for (unsigned int i = block.begin; i < block.end; i++) {
+                auto& gate = gates[i];
+
+                switch (gate.opcode) {
+                case sim::BitSliceNetlist::Copy:
+                    slots[gate.dest] = slots[gate.lhs];
+                    break;
+                case sim::BitSliceNetlist::Store:
+                    changes = changes | (slots[gate.dest] ^ slots[gate.lhs]);
+                    slots[gate.dest] = slots[gate.lhs];
+                    break;
+                case sim::BitSliceNetlist::Not:
+                    slots[gate.dest] = ~slots[gate.lhs];
+                    break;
+                case sim::BitSliceNetlist::And:
+                    slots[gate.dest] = slots[gate.lhs] & slots[gate.rhs];
+                    break;
+                case sim::BitSliceNetlist::Or:
+                    slots[gate.dest] = slots[gate.lhs] | slots[gate.rhs];
+                    break;
+                case sim::BitSliceNetlist::Xor:
+                    slots[gate.dest] = slots[gate.lhs] ^ slots[gate.rhs];
+                    break;
+                case sim::BitSliceNetlist::Mux:
+                    slots[gate.dest] = slots[gate.lhs]
+                        ^ ((slots[gate.lhs] ^ slots[gate.rhs]) & slots[gate.select]);
+                    break;
+                }
+            }
+
+            /* Loop settled, another pass reads the same values */
+            if (isZero(changes)) {
+                break;
+            }
+        }
+    }
+}
+
+static void runProgram(const std::vector<Gate>& gates, const std::vector<GateBlock>& program, uint64_t* slots) {
+    evaluateProgram(gates, program, slots);
+}
+
+#if defined(__x86_64__)
+__attribute__((target("avx2")))
+static void runProgramAvx2(const std::vector<Gate>& gates, const std::vector<GateBlock>& program, LaneWord256* slots) {
+    evaluateProgram(gates, program, slots);
+}
+#endif
+
+static void runProgram(const std::vector<Gate>& gates, const std::vector<GateBlock>& program, LaneWord256* slots) {
+#if defined(__x86_64__)
+    static const bool has_avx2 = __builtin_cpu_supports("avx2");
+
+    if (has_avx2) {
+        runProgramAvx2(gates, program, slots);
+        return;
+    }
+#endif
+
+    evaluateProgram(gates, program, slots);
+}
+
+bool sim::BitSliceSimulator::run(TestVectors& vectors) {
+    if (!golden.isValid() || !findPorts()) {
+        return false;
+    }
+
+    if (netlist.getGates().empty() && !netlist.build()) {
+        return false;
+    }
+
+    utility::PhaseProfile::record("sim_gates", netlist.getGates().size());
+
+    if (sim_lanes == Lanes256) {
+        simulate<LaneWord256>(vectors);
+    } else {
+        simulate<uint64_t>(vectors);
+    }
+
+    return check(vectors);
+}
+
+bool sim::BitSliceSimulator::findPorts() {
+    static const char* CONTROL_PORTS[] = { "clk", "reset", "start" };
+
+    arg_ports.clear();
+
+    for (auto* port : rtl_module.iter_ports()) {
+        if (!rtl_module.isSignalInput(port)) {
+            continue;
+        }
+
+        auto& name = port->getName();
+
+        if (std::none_of(std::begin(CONTROL_PORTS), std::end(CONTROL_PORTS),
+                         [&name](const char* control_port) { return name == control_port; }))
+        {
+            arg_ports.push_back(port);
+        }
+    }
+
+    bool has_ports = (rtl_module.find("reset") != nullptr)
+        && (rtl_module.find("start") != nullptr)
+        && (rtl_module.find("finish") != nullptr)
+        && (function.getReturnType()->isVoidTy() || (rtl_module.find("return_val") != nullptr))
+        && (arg_ports.size() == function.arg_size());
+
+    if (!has_ports) {
+        errs() << "Bit-sliced simulation of module '" << rtl_module.getName()
+            << "' is not supported: no start/finish interface of the function\n";
+    }
+
+    return has_ports;
+}
+
+template <typename Word>
+void sim::BitSliceSimulator::simulate(TestVectors& vectors) {
+    const unsigned int n_lanes = sizeof(Word) * 8;
+
+    auto& gates = netlist.getGates();
+    std::vector<Word> slots(netlist.getSlotsNum());
+
+    auto eval = [&]() {
+        runProgram(gates, netlist.getEvalProgram(), slots.data());
+    };
+
+    auto tick = [&]() {
+        runProgram(gates, netlist.getTickProgram(), slots.data());
+        eval();
+    };
+
+    auto set_port = [&](rtl::RtlSignal* port, bool value) {
+        for (auto slot : netlist.getSignalSlots(port)) {
+            slots[slot] = value ? ~Word() : Word();
+        }
+    };
+
+    auto* reset_port = rtl_module.find("reset");
+    auto* start_port = rtl_module.find("start");
+    auto* finish_port = rtl_module.find("finish");
+    auto* return_port = function.getReturnType()->isVoidTy() ? nullptr : rtl_module.find("return_val");
+
+    unsigned int n_vectors = vectors.size();
+
+    for (unsigned int first = 0; first < n_vectors; first += n_lanes) {
+        unsigned int n_batch = std::min(n_lanes, n_vectors - first);
+
+        std::fill(slots.begin(), slots.end(), Word());
+        slots[BitSliceNetlist::ONES_SLOT] = ~Word();
+
+        set_port(reset_port, true);
+        eval();
+        tick();
+        set_port(reset_port, false);
+        eval();
+
+        for (unsigned int k = 0; k < arg_ports.size(); k++) {
+            auto& port_slots = netlist.getSignalSlots(arg_ports[k]);
+
+            for (unsigned int i = 0; i < port_slots.size(); i++) {
+                Word word = Word();
+                auto* words = getWords(word);
+
+                for (unsigned int lane = 0; lane < n_batch; lane++) {
+                    uint64_t bit = (vectors.getArg(first + lane, k) >> i) & 1;
+                    words[lane / WORD_BITS] |= bit << (lane % WORD_BITS);
+                }
+
+                slots[port_slots[i]] = word;
+            }
+        }
+
+        set_port(start_port, true);
+        eval();
+        tick();
+        set_port(start_port, false);
+        eval();
+
+        /* Return value is taken when finish rises, the start edge is the first cycle */
+        unsigned int n_finished = 0;
+
+        for (unsigned int cycle = 0; ; cycle++) {
+            auto* finish_words = getWords(slots[netlist.getSignalSlots(finish_port).front()]);
+
+            for (unsigned int lane = 0; lane < n_batch; lane++) {
+                auto& outcome = vectors.getOutcome(first + lane);
+
+                if (outcome.is_finished || !((finish_words[lane / WORD_BITS] >> (lane % WORD_BITS)) & 1)) {
+                    continue;
+                }
+
+                uint64_t result = 0;
+
+                if (return_port != nullptr) {
+                    auto& return_slots = netlist.getSignalSlots(return_port);
+
+                    for (unsigned int i = 0; i < return_slots.size(); i++) {
+                        auto* words = getWords(slots[return_slots[i]]);
+                        result |= ((words[lane / WORD_BITS] >> (lane % WORD_BITS)) & 1) << i;
+                    }
+                }
+
+                outcome.is_finished = true;
+                outcome.result = result;
+                outcome.latency = cycle + 1;
+                n_finished++;
+            }
+
+            if ((n_finished == n_batch) || (cycle == sim_max_cycles)) {
+                break;
+            }
+
+            tick();
+        }
+    }
+}
+
+bool sim::BitSliceSimulator::check(TestVectors& vectors) {
+    auto* return_port = function.getReturnType()->isVoidTy() ? nullptr : rtl_module.find("return_val");
+
+    unsigned int n_vectors = vectors.size();
+    unsigned int n_mismatches = 0;
+    unsigned int n_unfinished = 0;
+    unsigned int n_undefined = 0;
+
+    for (unsigned int i = 0; i < n_vectors; i++) {
+        auto& outcome = vectors.getOutcome(i);
+
+        if (!outcome.is_finished) {
+            n_unfinished++;
+            continue;
+        }
+
+        auto vector_args = vectors.getArgs(i);
+
+        outcome.is_defined = golden.run(vector_args, outcome.expected);
+
+        /* Divisions by zero and overflows of signed ones have no reference result */
+        if (!outcome.is_defined) {
+            n_undefined++;
+            continue;
+        }
+
+        if (return_port != nullptr) {
+            outcome.expected &= getMask(return_port->getWidth().getBitwidth());
+        }
+
+        if (outcome.result == outcome.expected) {
+            continue;
+        }
+
+        n_mismatches++;
+
+        if (n_mismatches > MAX_REPORTED_MISMATCHES) {
+            continue;
+        }
+
+        errs() << "Simulation mismatch in module '" << rtl_module.getName()
+            << "', vector " << i << ":";
+
+        for (unsigned int k = 0; k < arg_ports.size(); k++) {
+            errs() << " " << arg_ports[k]->getName().value_or("arg") << " = " << vector_args[k];
+        }
+
+        errs() << ", expected " << outcome.expected << ", got " << outcome.result << "\n";
+    }
+
+    utility::PhaseProfile::record("sim_vectors", n_vectors);
+    utility::PhaseProfile::record("sim_mismatches", n_mismatches);
+
+    auto& report = ((n_mismatches > 0) || (n_unfinished > 0) || (n_undefined > 0)) ? errs() : utility::logs();
+
+    report << "Simulated module '" << rtl_module.getName() << "' on " << n_vectors
+        << " vectors, " << n_mismatches << " mismatches";
+
+    if (n_unfinished > 0) {
+        report << ", " << n_unfinished << " not finished in " << sim_max_cycles << " cycles";
+    }
+
+    if (n_undefined > 0) {
+        report << ", " << n_undefined << " not checked, the function divides by zero or overflows";
+    }
+
+    unsigned int min_latency = 0;
+    unsigned int max_latency = 0;
+    double avg_latency = 0;
+
+    if (vectors.getLatency(min_latency, avg_latency, max_latency)) {
+        utility::PhaseProfile::record("latency_min", min_latency);
+        utility::PhaseProfile::record("latency_max", max_latency);
+
+        report << ", latency " << min_latency << "/" << format("%.2f", avg_latency)
+            << "/" << max_latency << " (min/avg/max) cycles";
+    }
+
+    report << "\n";
+
+    return n_mismatches == 0;
+}
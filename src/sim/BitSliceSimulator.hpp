@@ -0,0 +1,69 @@
+#ifndef __SIM_BIT_SLICE_SIMULATOR_HPP__
+#define __SIM_BIT_SLICE_SIMULATOR_HPP__
+
+#include <cstdint>
+#include <vector>
+
+#include <llvm/IR/Function.h>
+
+#include "../rtl/RtlSignal.hpp"
+#include "../rtl/RtlModule.hpp"
+
+#include "BitSliceNetlist.hpp"
+#include "GoldenModel.hpp"
+#include "TestVectors.hpp"
+
+namespace llvm {
+    namespace bphls {
+        namespace sim {
+
+/**
+ * Simulation of the RTL module of a function on test vectors, checked
+ * against its golden model. The module is lowered to a BitSliceNetlist and 64 test vectors
+ * are simulated at once, one per bit of the slot words, or 256 with
+ * -sim-lanes=256, evaluated with AVX2 when the processor supports it.
+ *
+ * Every vector resets the module, sets its arguments and starts it, the
+ * return value and the latency are taken when finish rises and the value
+ * is compared with the golden one. Vectors which do not finish within
+ * -sim-max-cycles are reported and not compared, the golden model might
+ * not terminate on them. Neither are vectors the golden result of which
+ * is undefined.
+ */
+class BitSliceSimulator {
+public:
+    BitSliceSimulator(Function& function, rtl::RtlModule& rtl_module, GoldenModel& golden)
+        : function(function),
+          rtl_module(rtl_module),
+          golden(golden),
+          netlist(rtl_module) {}
+
+    /**
+     * Simulates the vectors and fills in their outcomes, false on mismatches
+     * or unsupported modules
+     */
+    bool run(TestVectors& vectors);
+
+private:
+    Function& function;
+    rtl::RtlModule& rtl_module;
+    GoldenModel& golden;
+
+    BitSliceNetlist netlist;
+
+    /* Input ports of the function arguments, in order */
+    std::vector<rtl::RtlSignal*> arg_ports;
+
+    bool findPorts();
+
+    template <typename Word>
+    void simulate(TestVectors& vectors);
+
+    bool check(TestVectors& vectors);
+};
+
+        } /* namespace sim */
+    } /* namespace bphls */
+} /* namespace llvm */
+
+#endif /* __SIM_BIT_SLICE_SIMULATOR_HPP__ */
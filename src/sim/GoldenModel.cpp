@@ -0,0 +1,240 @@
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <llvm/ADT/APInt.h>
+#include <llvm/ExecutionEngine/GenericValue.h>
+#include <llvm/ExecutionEngine/Interpreter.h>
+#include <llvm/ExecutionEngine/MCJIT.h>
+#include <llvm/IR/IRBuilder.h>
+#include <llvm/IR/InstIterator.h>
+#include <llvm/IR/Module.h>
+#include <llvm/Support/TargetSelect.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include "../utility/module_utility.hpp"
+#include "GoldenModel.hpp"
+
+using namespace llvm;
+using namespace bphls;
+
+static const unsigned int MAX_WIDTH = 64;
+
+static const char* WRAPPER_NAME = "bphls_golden_wrapper";
+
+static const char* UNDEFINED_FLAG_NAME = "bphls_golden_undefined";
+
+static bool isSupportedType(Type* type) {
+    return type->isIntegerTy() && (type->getIntegerBitWidth() <= MAX_WIDTH);
+}
+
+/* Native target is registered once, functions are compiled concurrently */
+static bool initializeNativeTarget() {
+    static std::once_flag init_flag;
+    static bool has_native_target = false;
+
+    std::call_once(init_flag, []() {
+        has_native_target = !InitializeNativeTarget() && !InitializeNativeTargetAsmPrinter();
+    });
+
+    return has_native_target;
+}
+
+/**
+ * Divisions by zero and signed divisions of the minimal value by -1 trap on
+ * the host. The divisor is replaced by one and the flag is set instead
+ */
+static void guardDivisions(Module& module) {
+    auto& context = module.getContext();
+    auto* flag_type = Type::getInt8Ty(context);
+
+    auto* undefined_flag = new GlobalVariable(module, flag_type, false, GlobalValue::ExternalLinkage,
+                                              ConstantInt::get(flag_type, 0), UNDEFINED_FLAG_NAME);
+
+    std::vector<BinaryOperator*> divisions;
+
+    for (auto& function : module) {
+        for (auto& instr : instructions(function)) {
+            switch (instr.getOpcode()) {
+            case Instruction::UDiv:
+            case Instruction::SDiv:
+            case Instruction::URem:
+            case Instruction::SRem:
+                if (instr.getType()->isIntegerTy()) {
+                    divisions.push_back(cast<BinaryOperator>(&instr));
+                }
+                break;
+            default:
+                break;
+            }
+        }
+    }
+
+    for (auto* division : divisions) {
+        IRBuilder<> builder(division);
+
+        auto* dividend = division->getOperand(0);
+        auto* divisor = division->getOperand(1);
+        auto* type = cast<IntegerType>(division->getType());
+
+        auto* is_undefined = builder.CreateICmpEQ(divisor, ConstantInt::get(type, 0));
+
+        if ((division->getOpcode() == Instruction::SDiv) || (division->getOpcode() == Instruction::SRem)) {
+            auto* is_overflow = builder.CreateAnd(
+                builder.CreateICmpEQ(dividend, ConstantInt::get(type, APInt::getSignedMinValue(type->getBitWidth()))),
+                builder.CreateICmpEQ(divisor, ConstantInt::getAllOnesValue(type))
+            );
+
+            is_undefined = builder.CreateOr(is_undefined, is_overflow);
+        }
+
+        auto* flag = builder.CreateLoad(flag_type, undefined_flag);
+        builder.CreateStore(builder.CreateOr(flag, builder.CreateZExt(is_undefined, flag_type)), undefined_flag);
+
+        division->setOperand(1, builder.CreateSelect(is_undefined, ConstantInt::get(type, 1), divisor));
+    }
+}
+
+/* uint64_t wrapper(const uint64_t* args), arguments and result zero extended */
+static void createWrapper(Function& function) {
+    auto& context = function.getContext();
+    auto* i64_type = Type::getInt64Ty(context);
+
+    auto* wrapper_type = FunctionType::get(i64_type, { PointerType::getUnqual(i64_type) }, false);
+    auto* wrapper = Function::Create(wrapper_type, GlobalValue::ExternalLinkage,
+                                     WRAPPER_NAME, function.getParent());
+
+    IRBuilder<> builder(BasicBlock::Create(context, "entry", wrapper));
+    std::vector<Value*> call_args;
+
+    for (auto& arg : function.args()) {
+        auto* arg_ptr = builder.CreateConstGEP1_64(i64_type, wrapper->getArg(0), arg.getArgNo());
+        auto* arg_value = builder.CreateLoad(i64_type, arg_ptr);
+
+        call_args.push_back(builder.CreateTrunc(arg_value, arg.getType()));
+    }
+
+    auto* result = builder.CreateCall(&function, call_args);
+
+    if (function.getReturnType()->isVoidTy()) {
+        builder.CreateRet(ConstantInt::get(i64_type, 0));
+    } else {
+        builder.CreateRet(builder.CreateZExt(result, i64_type));
+    }
+}
+
+sim::GoldenModel::GoldenModel(Function& function)
+    : golden_function(nullptr),
+      native_wrapper(nullptr),
+      undefined_flag(nullptr)
+{
+    bool is_supported = function.getReturnType()->isVoidTy()
+        || isSupportedType(function.getReturnType());
+
+    for (auto& arg : function.args()) {
+        is_supported = is_supported && isSupportedType(arg.getType());
+    }
+
+    if (!is_supported) {
+        errs() << "Golden model of function '" << function.getName()
+            << "' is not supported: arguments and result must be integers of at most "
+            << MAX_WIDTH << " bits\n";
+        return;
+    }
+
+    if (!createJit(function)) {
+        createInterpreter(function);
+    }
+}
+
+sim::GoldenModel::~GoldenModel() = default;
+
+bool sim::GoldenModel::createJit(Function& function) {
+    if (!initializeNativeTarget()) {
+        return false;
+    }
+
+    auto golden_module = utility::cloneFunctionModule(function);
+    guardDivisions(*golden_module);
+    createWrapper(*golden_module->getFunction(function.getName()));
+
+    std::string error;
+    EngineBuilder builder(std::move(golden_module));
+    builder.setEngineKind(EngineKind::JIT);
+    builder.setErrorStr(&error);
+
+    engine.reset(builder.create());
+
+    if (!engine) {
+        return false;
+    }
+
+    native_wrapper = reinterpret_cast<NativeWrapper>(engine->getFunctionAddress(WRAPPER_NAME));
+    undefined_flag = reinterpret_cast<uint8_t*>(engine->getGlobalValueAddress(UNDEFINED_FLAG_NAME));
+
+    if ((native_wrapper == nullptr) || (undefined_flag == nullptr)) {
+        native_wrapper = nullptr;
+        undefined_flag = nullptr;
+        engine.reset();
+        return false;
+    }
+
+    return true;
+}
+
+bool sim::GoldenModel::createInterpreter(Function& function) {
+    auto golden_module = utility::cloneFunctionModule(function);
+    guardDivisions(*golden_module);
+
+    auto* cloned_function = golden_module->getFunction(function.getName());
+    auto* cloned_flag = golden_module->getGlobalVariable(UNDEFINED_FLAG_NAME);
+
+    std::string error;
+    EngineBuilder builder(std::move(golden_module));
+    builder.setEngineKind(EngineKind::Interpreter);
+    builder.setErrorStr(&error);
+
+    engine.reset(builder.create());
+
+    if (!engine) {
+        errs() << "Cannot create golden model of function '" << function.getName()
+            << "': " << error << "\n";
+        return false;
+    }
+
+    golden_function = cloned_function;
+    undefined_flag = static_cast<uint8_t*>(engine->getPointerToGlobal(cloned_flag));
+
+    return true;
+}
+
+bool sim::GoldenModel::isValid() {
+    return (native_wrapper != nullptr) || (golden_function != nullptr);
+}
+
+bool sim::GoldenModel::run(const std::vector<uint64_t>& args, uint64_t& result) {
+    assert(isValid());
+
+    *undefined_flag = 0;
+
+    if (native_wrapper != nullptr) {
+        result = native_wrapper(args.data());
+        return *undefined_flag == 0;
+    }
+
+    assert(args.size() == golden_function->arg_size());
+
+    std::vector<GenericValue> arg_values(args.size());
+
+    for (auto& arg : golden_function->args()) {
+        unsigned int width = arg.getType()->getIntegerBitWidth();
+        arg_values[arg.getArgNo()].IntVal = APInt(width, args[arg.getArgNo()]);
+    }
+
+    auto return_value = engine->runFunction(golden_function, arg_values);
+
+    result = golden_function->getReturnType()->isVoidTy() ? 0 : return_value.IntVal.getZExtValue();
+
+    return *undefined_flag == 0;
+}
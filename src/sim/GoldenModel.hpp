@@ -0,0 +1,64 @@
+#ifndef __SIM_GOLDEN_MODEL_HPP__
+#define __SIM_GOLDEN_MODEL_HPP__
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <llvm/IR/Function.h>
+#include <llvm/ExecutionEngine/ExecutionEngine.h>
+
+namespace llvm {
+    namespace bphls {
+        namespace sim {
+
+/**
+ * Reference results of a function, computed by an LLVM execution engine on
+ * a copy of the function and the globals it references. The copy is taken
+ * on construction, so the function may be transformed by the compilation
+ * afterwards. Other functions of the module are not copied, they may be
+ * compiled, and left rewritten, by the same thread before.
+ *
+ * The copy is compiled to native code by MCJIT through a wrapper reading
+ * the arguments from an array, the interpreter runs it on hosts without a
+ * native target. Arguments and the return value are integers of at most
+ * 64 bits, passed zero extended, the model is not valid for other
+ * signatures. Divisions by zero and signed division overflows of the copy
+ * do not trap, the result of such a call is reported as undefined.
+ */
+class GoldenModel {
+public:
+    GoldenModel(Function& function);
+
+    ~GoldenModel();
+
+    bool isValid();
+
+    /**
+     * Return value of the call, zero for void functions. False if the
+     * result is undefined, the call divides by zero or overflows
+     */
+    bool run(const std::vector<uint64_t>& args, uint64_t& result);
+
+private:
+    typedef uint64_t (*NativeWrapper)(const uint64_t* args);
+
+    /* Owns the copy of the module */
+    std::unique_ptr<ExecutionEngine> engine;
+    Function* golden_function;
+
+    NativeWrapper native_wrapper;
+
+    /* Set by the guarded divisions of the copy */
+    uint8_t* undefined_flag;
+
+    bool createJit(Function& function);
+
+    bool createInterpreter(Function& function);
+};
+
+        } /* namespace sim */
+    } /* namespace bphls */
+} /* namespace llvm */
+
+#endif /* __SIM_GOLDEN_MODEL_HPP__ */
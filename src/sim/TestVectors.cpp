@@ -0,0 +1,158 @@
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <llvm/ADT/StringRef.h>
+#include <llvm/ADT/SmallVector.h>
+#include <llvm/Support/CommandLine.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include "TestVectors.hpp"
+
+using namespace llvm;
+using namespace bphls;
+
+static cl::opt<unsigned int> sim_seed(
+    "sim-seed",
+    cl::desc("Seed of the random test vectors"),
+    cl::init(1)
+);
+
+static const unsigned int MAX_WIDTH = 64;
+
+static uint64_t getMask(unsigned int width) {
+    return (width >= MAX_WIDTH) ? ~0ULL : ((1ULL << width) - 1);
+}
+
+sim::TestVectors::TestVectors(Function& function) {
+    for (auto& arg : function.args()) {
+        auto* type = arg.getType();
+        arg_widths.push_back(type->isIntegerTy() ? type->getIntegerBitWidth() : MAX_WIDTH);
+    }
+}
+
+void sim::TestVectors::addRandom(unsigned int n_vectors) {
+    std::mt19937_64 rng(sim_seed);
+    std::vector<uint64_t> vector_args(arg_widths.size());
+
+    for (unsigned int i = 0; i < n_vectors; i++) {
+        for (unsigned int k = 0; k < arg_widths.size(); k++) {
+            auto mask = getMask(arg_widths[k]);
+            uint64_t value = rng();
+
+            if ((value & 7) == 0) {
+                uint64_t corner_values[] = { 0, 1, mask };
+                value = corner_values[(value >> 3) % 3];
+            } else {
+                value = rng();
+            }
+
+            vector_args[k] = value;
+        }
+
+        addVector(vector_args);
+    }
+}
+
+bool sim::TestVectors::readFile(const std::string& file_name) {
+    auto file_buffer = MemoryBuffer::getFile(file_name);
+
+    if (!file_buffer) {
+        errs() << "Cannot read test vectors '" << file_name << "': "
+            << file_buffer.getError().message() << "\n";
+        return false;
+    }
+
+    SmallVector<StringRef, 0> lines;
+    file_buffer.get()->getBuffer().split(lines, '\n');
+
+    SmallVector<StringRef, 8> fields;
+    std::vector<uint64_t> vector_args(arg_widths.size());
+
+    for (unsigned int line_number = 1; line_number <= lines.size(); line_number++) {
+        auto line = lines[line_number - 1].trim();
+
+        if (line.empty() || line.startswith("#")) {
+            continue;
+        }
+
+        fields.clear();
+        line.split(fields, ' ', -1, false);
+
+        /* Tabs are separators too */
+        SmallVector<StringRef, 8> values;
+
+        for (auto field : fields) {
+            field.split(values, '\t', -1, false);
+        }
+
+        if (values.size() != arg_widths.size()) {
+            errs() << file_name << ":" << line_number << ": expected " << arg_widths.size()
+                << " arguments, found " << values.size() << "\n";
+            return false;
+        }
+
+        for (unsigned int k = 0; k < values.size(); k++) {
+            auto value = values[k];
+            bool is_negative = value.consume_front("-");
+            bool is_hex = value.consume_front_insensitive("0x");
+
+            uint64_t arg_value = 0;
+
+            if (value.getAsInteger(is_hex ? 16 : 10, arg_value)) {
+                errs() << file_name << ":" << line_number << ": invalid argument '"
+                    << values[k] << "'\n";
+                return false;
+            }
+
+            vector_args[k] = is_negative ? (0ULL - arg_value) : arg_value;
+        }
+
+        addVector(vector_args);
+    }
+
+    return true;
+}
+
+std::vector<uint64_t> sim::TestVectors::getArgs(unsigned int i) {
+    auto first = args.begin() + i * arg_widths.size();
+    return std::vector<uint64_t>(first, first + arg_widths.size());
+}
+
+bool sim::TestVectors::getLatency(unsigned int& min_latency,
+                                  double& avg_latency,
+                                  unsigned int& max_latency)
+{
+    unsigned int n_finished = 0;
+    double total_latency = 0;
+
+    for (auto& outcome : outcomes) {
+        if (!outcome.is_finished) {
+            continue;
+        }
+
+        min_latency = (n_finished == 0) ? outcome.latency : std::min(min_latency, outcome.latency);
+        max_latency = (n_finished == 0) ? outcome.latency : std::max(max_latency, outcome.latency);
+        total_latency += outcome.latency;
+
+        n_finished++;
+    }
+
+    if (n_finished == 0) {
+        return false;
+    }
+
+    avg_latency = total_latency / n_finished;
+
+    return true;
+}
+
+void sim::TestVectors::addVector(const std::vector<uint64_t>& vector_args) {
+    for (unsigned int k = 0; k < arg_widths.size(); k++) {
+        args.push_back(vector_args[k] & getMask(arg_widths[k]));
+    }
+
+    outcomes.push_back({ false, false, 0, 0, 0 });
+}
@@ -0,0 +1,76 @@
+#ifndef __SIM_TEST_VECTORS_HPP__
+#define __SIM_TEST_VECTORS_HPP__
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <llvm/IR/Function.h>
+
+namespace llvm {
+    namespace bphls {
+        namespace sim {
+
+/**
+ * Calls of a function used as test vectors and their outcomes. Arguments
+ * are kept in the order of the function arguments, truncated to their
+ * widths. Outcomes are filled in by the simulation, the expected result
+ * by the golden model.
+ */
+class TestVectors {
+public:
+    struct Outcome {
+        bool is_finished;
+
+        /* False if the golden model divides by zero or overflows */
+        bool is_defined;
+
+        uint64_t result;
+        uint64_t expected;
+
+        /* Clock cycles from the one sampling start to finish */
+        unsigned int latency;
+    };
+
+    TestVectors(Function& function);
+
+    /** Random arguments, every eighth one is zero, one or all ones */
+    void addRandom(unsigned int n_vectors);
+
+    /**
+     * Reads the arguments of one call per line, separated by whitespace.
+     * Values are decimal or 0x prefixed hexadecimal, negative ones are
+     * two's complement. Empty lines and lines starting with '#' are skipped.
+     */
+    bool readFile(const std::string& file_name);
+
+    unsigned int size() { return outcomes.size(); }
+
+    unsigned int getArgsNum() { return arg_widths.size(); }
+
+    unsigned int getArgWidth(unsigned int k) { return arg_widths[k]; }
+
+    uint64_t getArg(unsigned int i, unsigned int k) { return args[i * arg_widths.size() + k]; }
+
+    std::vector<uint64_t> getArgs(unsigned int i);
+
+    Outcome& getOutcome(unsigned int i) { return outcomes[i]; }
+
+    /** Latency of the finished calls, false if there are none */
+    bool getLatency(unsigned int& min_latency, double& avg_latency, unsigned int& max_latency);
+
+private:
+    std::vector<unsigned int> arg_widths;
+
+    /* Arguments of every call, call after call */
+    std::vector<uint64_t> args;
+    std::vector<Outcome> outcomes;
+
+    void addVector(const std::vector<uint64_t>& vector_args);
+};
+
+        } /* namespace sim */
+    } /* namespace bphls */
+} /* namespace llvm */
+
+#endif /* __SIM_TEST_VECTORS_HPP__ */
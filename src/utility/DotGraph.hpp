@@ -1,7 +1,7 @@
 #ifndef __DOT_GRAPH_HPP__
 #define __DOT_GRAPH_HPP__
 
-#include <set>
+#include <map>
 
 #include <llvm/Support/FormattedStream.h>
 
@@ -52,25 +52,26 @@ public:
         out << "]";
     }
 
+    /* Nodes are numbered as they are seen, not named by their addresses */
     void printNode(formatted_raw_ostream &out, T *I) {
-        out << "Node" << static_cast<const void*>(I);
+        out << "Node" << seen[I];
     }
 
     void connectDot(formatted_raw_ostream &out, T *driver,
             T *signal, std::string label) {
 
         if (seen.find(signal) == seen.end()) {
+            seen.emplace(signal, seen.size());
             printNode(out, signal);
             printLabel(out, signal);
             out << ";\n";
-            seen.insert(signal);
         }
 
         if (seen.find(driver) == seen.end()) {
+            seen.emplace(driver, seen.size());
             printNode(out, driver);
             printLabel(out, driver);
             out << ";\n";
-            seen.insert(driver);
         }
 
         printNode(out, driver);
@@ -83,7 +84,7 @@ public:
     void setLabelLimit(int l) { limit = l; }
 
 private:
-    std::set<T*> seen;
+    std::map<T*, unsigned> seen;
     unsigned limit;
     llvm::formatted_raw_ostream &out;
     void (*printNodeLabel)(raw_ostream &out, T *I);
@@ -0,0 +1,42 @@
+#include <vector>
+
+#include <llvm/IR/Function.h>
+#include <llvm/IR/BasicBlock.h>
+#include <llvm/IR/Instruction.h>
+
+#include "FunctionNumbering.hpp"
+
+using namespace llvm;
+using namespace bphls;
+
+void utility::FunctionNumbering::reset(Function& function) {
+    instructions.clear();
+    basic_blocks.clear();
+    instr_id_lookup.clear();
+    bb_id_lookup.clear();
+
+    instr_id_lookup.reserve(function.getInstructionCount());
+    bb_id_lookup.reserve(function.size());
+
+    for (auto& basic_block : function) {
+        bb_id_lookup[&basic_block] = basic_blocks.size();
+        basic_blocks.push_back(&basic_block);
+
+        for (auto& instr : basic_block) {
+            instr_id_lookup[&instr] = instructions.size();
+            instructions.push_back(&instr);
+        }
+    }
+}
+
+unsigned int utility::FunctionNumbering::getId(const Instruction* instr) {
+    auto id_iter = instr_id_lookup.find(instr);
+
+    return (id_iter != instr_id_lookup.end()) ? id_iter->second : NONE;
+}
+
+unsigned int utility::FunctionNumbering::getId(const BasicBlock* basic_block) {
+    auto id_iter = bb_id_lookup.find(basic_block);
+
+    return (id_iter != bb_id_lookup.end()) ? id_iter->second : NONE;
+}
@@ -0,0 +1,52 @@
+#ifndef __UTILITY_FUNCTION_NUMBERING_HPP__
+#define __UTILITY_FUNCTION_NUMBERING_HPP__
+
+#include <vector>
+
+#include <llvm/ADT/DenseMap.h>
+#include <llvm/IR/Function.h>
+#include <llvm/IR/BasicBlock.h>
+#include <llvm/IR/Instruction.h>
+
+namespace llvm {
+    namespace bphls {
+        namespace utility {
+
+/**
+ * Dense indices of the instructions and basic blocks of a function, assigned
+ * in layout order. Later phases keep their per-instruction and per-block data
+ * in flat vectors indexed by them, a pointer is translated once per query.
+ * Numbering must be reset after instructions are inserted or erased.
+ */
+class FunctionNumbering {
+public:
+    static constexpr unsigned int NONE = ~0U;
+
+    void reset(Function& function);
+
+    unsigned int getInstructionsNum() { return instructions.size(); }
+
+    unsigned int getBasicBlocksNum() { return basic_blocks.size(); }
+
+    /** Returns NONE for values not numbered */
+    unsigned int getId(const Instruction* instr);
+
+    unsigned int getId(const BasicBlock* basic_block);
+
+    Instruction* getInstruction(unsigned int id) { return instructions[id]; }
+
+    BasicBlock* getBasicBlock(unsigned int id) { return basic_blocks[id]; }
+
+private:
+    std::vector<Instruction*> instructions;
+    std::vector<BasicBlock*> basic_blocks;
+
+    DenseMap<const Instruction*, unsigned int> instr_id_lookup;
+    DenseMap<const BasicBlock*, unsigned int> bb_id_lookup;
+};
+
+        } /* namespace utility */
+    } /* namespace bphls */
+} /* namespace llvm */
+
+#endif /* __UTILITY_FUNCTION_NUMBERING_HPP__ */
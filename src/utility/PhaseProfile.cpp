@@ -0,0 +1,380 @@
+#include <new>
+#include <atomic>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#include <malloc.h>
+#include <time.h>
+
+#include <llvm/Support/CommandLine.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/Format.h>
+#include <llvm/Support/JSON.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include "PhaseProfile.hpp"
+
+using namespace llvm;
+using namespace bphls;
+
+static cl::opt<bool> heap_report(
+    "heap-report",
+    cl::desc("Report peak heap use of every compilation phase"),
+    cl::init(false)
+);
+
+static cl::opt<bool> time_phases(
+    "time-phases",
+    cl::desc("Report time and resident memory of every compilation phase, memory is process-wide"),
+    cl::init(false)
+);
+
+enum StatsFormat {
+    NoStats,
+    JsonStats,
+};
+
+/* Plain -stats is taken by LLVM statistics */
+static cl::opt<StatsFormat> stats_format(
+    "hls-stats",
+    cl::desc("Write compilation statistics of every function"),
+    cl::values(
+        clEnumValN(JsonStats, "json", "<function>.stats.json in the output directory")
+    ),
+    cl::init(NoStats)
+);
+
+/* Profile collecting counters of the function compiled on this thread */
+static thread_local utility::PhaseProfile* active_profile = nullptr;
+
+/* Counting starts with the first enabled profile, earlier frees only shift
+ * the absolute numbers, phases are measured relatively. Set by batch worker
+ * threads while others allocate, an allocation seeing it late is harmless */
+static std::atomic<bool> is_heap_counted(false);
+
+static thread_local long long heap_in_use = 0;
+static thread_local long long heap_peak = 0;
+
+/* Largest resident size of the process read by any thread */
+static std::atomic<long long> seen_max_rss(0);
+
+static void countAllocation(void* ptr) {
+    heap_in_use += malloc_usable_size(ptr);
+
+    if (heap_in_use > heap_peak) {
+        heap_peak = heap_in_use;
+    }
+}
+
+static void countDeallocation(void* ptr) {
+    heap_in_use -= malloc_usable_size(ptr);
+}
+
+/* Replaced global allocation functions, aligned ones are left uncounted */
+void* operator new(std::size_t size) {
+    void* ptr = std::malloc((size != 0) ? size : 1);
+
+    if (ptr == nullptr) {
+        throw std::bad_alloc();
+    }
+
+    if (is_heap_counted.load(std::memory_order_relaxed)) {
+        countAllocation(ptr);
+    }
+
+    return ptr;
+}
+
+void* operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    try {
+        return operator new(size);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return operator new(size, std::nothrow);
+}
+
+void operator delete(void* ptr) noexcept {
+    if (ptr == nullptr) {
+        return;
+    }
+
+    if (is_heap_counted.load(std::memory_order_relaxed)) {
+        countDeallocation(ptr);
+    }
+
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    operator delete(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    operator delete(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept {
+    operator delete(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+    operator delete(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+    operator delete(ptr);
+}
+
+utility::PhaseProfile::PhaseProfile(std::string name, std::string stats_file)
+    : name(name),
+      stats_file(stats_file),
+      is_enabled(heap_report || time_phases || (stats_format != NoStats)),
+      prev_profile(active_profile),
+      phase_wall_start(0),
+      phase_cpu_start(0),
+      phase_heap_start(0)
+{
+    if (!is_enabled) {
+        return;
+    }
+
+    if (heap_report || (stats_format != NoStats)) {
+        is_heap_counted.store(true, std::memory_order_relaxed);
+    }
+
+    active_profile = this;
+}
+
+utility::PhaseProfile::~PhaseProfile() {
+    if (!is_enabled) {
+        return;
+    }
+
+    endPhase();
+
+    active_profile = prev_profile;
+
+    if (heap_report || time_phases) {
+        printText();
+    }
+
+    if (stats_format == JsonStats) {
+        writeJson();
+    }
+}
+
+static double getWallMs() {
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+
+    return std::chrono::duration<double, std::milli>(now).count();
+}
+
+static double getThreadCpuMs() {
+    timespec cpu_time;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu_time);
+
+    return cpu_time.tv_sec * 1e3 + cpu_time.tv_nsec / 1e6;
+}
+
+/* Bytes resident now and at most so far, both for the whole process. The
+ * peak is never below a size read before */
+static void getRss(long long& rss, long long& max_rss) {
+    rss = 0;
+    max_rss = 0;
+
+    std::ifstream status("/proc/self/status");
+    std::string line;
+
+    while (std::getline(status, line)) {
+        if (line.compare(0, 6, "VmRSS:") == 0) {
+            rss = std::atoll(line.c_str() + 6) * 1024LL;
+        } else if (line.compare(0, 6, "VmHWM:") == 0) {
+            max_rss = std::atoll(line.c_str() + 6) * 1024LL;
+        }
+    }
+
+    /* High water mark is updated lazily, it may lag sizes read before */
+    long long prev_max_rss = seen_max_rss.load();
+    max_rss = std::max(max_rss, rss);
+
+    while ((prev_max_rss < max_rss) && !seen_max_rss.compare_exchange_weak(prev_max_rss, max_rss)) {}
+
+    max_rss = std::max(max_rss, prev_max_rss);
+}
+
+void utility::PhaseProfile::startPhase(std::string phase) {
+    if (!is_enabled) {
+        return;
+    }
+
+    endPhase();
+
+    phases.push_back(Phase { phase, 0, 0, 0, 0, 0, 0, {} });
+
+    phase_heap_start = heap_in_use;
+    heap_peak = heap_in_use;
+
+    phase_wall_start = getWallMs();
+    phase_cpu_start = getThreadCpuMs();
+}
+
+void utility::PhaseProfile::endPhase() {
+    if (phases.empty()) {
+        return;
+    }
+
+    auto& phase = phases.back();
+
+    phase.wall_ms = getWallMs() - phase_wall_start;
+    phase.cpu_ms = getThreadCpuMs() - phase_cpu_start;
+    getRss(phase.rss, phase.max_rss);
+
+    phase.heap_peak = heap_peak - phase_heap_start;
+    phase.heap_retained = heap_in_use - phase_heap_start;
+}
+
+void utility::PhaseProfile::count(const char* counter, long long value) {
+    auto* profile = active_profile;
+
+    if ((profile == nullptr) || profile->phases.empty()) {
+        return;
+    }
+
+    auto& counters = profile->phases.back().counters;
+
+    for (auto& phase_counter : counters) {
+        if (std::strcmp(phase_counter.name, counter) == 0) {
+            phase_counter.value += value;
+            return;
+        }
+    }
+
+    counters.push_back(Counter { counter, value });
+}
+
+void utility::PhaseProfile::record(const char* metric, long long value) {
+    if (active_profile == nullptr) {
+        return;
+    }
+
+    active_profile->metrics.push_back(Counter { metric, value });
+}
+
+void utility::PhaseProfile::printText() {
+    std::string report_buffer;
+    raw_string_ostream report(report_buffer);
+
+    for (auto& phase : phases) {
+        if (time_phases) {
+            report << "Time: " << name
+                << " phase: " << phase.name
+                << " wall: " << format("%.3f", phase.wall_ms) << " ms"
+                << " cpu: " << format("%.3f", phase.cpu_ms) << " ms"
+                << " rss: " << phase.rss / 1024 << " KiB"
+                << " max rss: " << phase.max_rss / 1024 << " KiB\n";
+        }
+
+        if (heap_report) {
+            report << "Heap: " << name
+                << " phase: " << phase.name
+                << " peak: " << format("%.1f", phase.heap_peak / 1024.0) << " KiB"
+                << " retained: " << format("%.1f", phase.heap_retained / 1024.0) << " KiB\n";
+        }
+    }
+
+    std::cout << report.str() << std::flush;
+}
+
+void utility::PhaseProfile::writeJson() {
+    std::error_code ec;
+    raw_fd_ostream stats_out(stats_file, ec, sys::fs::OF_None);
+
+    if (ec) {
+        std::cerr << "Cannot open statistics file '" << stats_file << "': "
+            << ec.message() << std::endl;
+        return;
+    }
+
+    std::vector<Counter> total_counters;
+    double total_wall_ms = 0;
+    double total_cpu_ms = 0;
+    long long max_rss = 0;
+
+    json::OStream json_out(stats_out, 2);
+
+    json_out.object([&]() {
+        json_out.attribute("function", name);
+
+        json_out.attributeArray("phases", [&]() {
+            for (auto& phase : phases) {
+                json_out.object([&]() {
+                    json_out.attribute("name", phase.name);
+                    json_out.attribute("wall_ms", phase.wall_ms);
+                    json_out.attribute("cpu_ms", phase.cpu_ms);
+                    json_out.attribute("rss_kib", phase.rss / 1024);
+                    json_out.attribute("max_rss_kib", phase.max_rss / 1024);
+                    json_out.attribute("heap_peak_kib", phase.heap_peak / 1024.0);
+                    json_out.attribute("heap_retained_kib", phase.heap_retained / 1024.0);
+
+                    json_out.attributeObject("counters", [&]() {
+                        for (auto& counter : phase.counters) {
+                            json_out.attribute(counter.name, counter.value);
+                        }
+                    });
+                });
+
+                total_wall_ms += phase.wall_ms;
+                total_cpu_ms += phase.cpu_ms;
+                max_rss = std::max(max_rss, phase.max_rss);
+
+                for (auto& counter : phase.counters) {
+                    auto total_iter = std::find_if(
+                        total_counters.begin(),
+                        total_counters.end(),
+                        [&](Counter& total) { return std::strcmp(total.name, counter.name) == 0; }
+                    );
+
+                    if (total_iter != total_counters.end()) {
+                        total_iter->value += counter.value;
+                    } else {
+                        total_counters.push_back(counter);
+                    }
+                }
+            }
+        });
+
+        json_out.attributeObject("total", [&]() {
+            json_out.attribute("wall_ms", total_wall_ms);
+            json_out.attribute("cpu_ms", total_cpu_ms);
+            json_out.attribute("max_rss_kib", max_rss / 1024);
+
+            json_out.attributeObject("counters", [&]() {
+                for (auto& counter : total_counters) {
+                    json_out.attribute(counter.name, counter.value);
+                }
+            });
+        });
+
+        json_out.attributeObject("metrics", [&]() {
+            for (auto& metric : metrics) {
+                json_out.attribute(metric.name, metric.value);
+            }
+        });
+    });
+
+    stats_out << "\n";
+}
@@ -0,0 +1,83 @@
+#ifndef __UTILITY_PHASE_PROFILE_HPP__
+#define __UTILITY_PHASE_PROFILE_HPP__
+
+#include <string>
+#include <vector>
+
+namespace llvm {
+    namespace bphls {
+        namespace utility {
+
+/**
+ * Telemetry of the compilation phases of one function: wall and thread CPU
+ * time, resident set size, heap use and event counters. A phase lasts until
+ * the next one starts. The report is printed when the profile is destroyed,
+ * after the objects of the function declared later are released.
+ *
+ * -time-phases and -heap-report print text lines, -hls-stats=json writes the
+ * whole profile to the given file. Allocations through operator new are
+ * counted per thread, so functions compiled concurrently do not mix. RSS
+ * and peak RSS are those of the whole process, they include the functions
+ * compiled by the other -j threads.
+ *
+ * The profile is active on its thread until destroyed, count() adds to the
+ * current phase of the active profile and record() sets a metric of the
+ * whole function, both do nothing without one.
+ */
+class PhaseProfile {
+public:
+    PhaseProfile(std::string name, std::string stats_file);
+
+    ~PhaseProfile();
+
+    void startPhase(std::string phase);
+
+    static void count(const char* counter, long long value = 1);
+
+    static void record(const char* metric, long long value);
+
+private:
+    struct Counter {
+        const char* name;
+        long long value;
+    };
+
+    struct Phase {
+        std::string name;
+
+        double wall_ms;
+        double cpu_ms;
+        long long rss;
+        long long max_rss;
+
+        long long heap_peak;
+        long long heap_retained;
+
+        std::vector<Counter> counters;
+    };
+
+    std::string name;
+    std::string stats_file;
+    bool is_enabled;
+
+    PhaseProfile* prev_profile;
+
+    std::vector<Phase> phases;
+    std::vector<Counter> metrics;
+
+    double phase_wall_start;
+    double phase_cpu_start;
+    long long phase_heap_start;
+
+    void endPhase();
+
+    void printText();
+
+    void writeJson();
+};
+
+        } /* namespace utility */
+    } /* namespace bphls */
+} /* namespace llvm */
+
+#endif /* __UTILITY_PHASE_PROFILE_HPP__ */
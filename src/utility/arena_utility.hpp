@@ -0,0 +1,25 @@
+#ifndef __UTILITY_ARENA_UTILITY_HPP__
+#define __UTILITY_ARENA_UTILITY_HPP__
+
+#include <utility>
+
+#include <llvm/Support/Allocator.h>
+
+namespace llvm {
+    namespace bphls {
+        namespace utility {
+
+/**
+ * Constructs an object in a typed bump arena. Objects are never freed one
+ * by one, destructors of all of them run when the arena is destroyed.
+ */
+template <typename T, typename... Args>
+T* createInArena(SpecificBumpPtrAllocator<T>& arena, Args&&... args) {
+    return new (arena.Allocate()) T(std::forward<Args>(args)...);
+}
+
+        } /* namespace utility */
+    } /* namespace bphls */
+} /* namespace llvm */
+
+#endif /* __UTILITY_ARENA_UTILITY_HPP__ */
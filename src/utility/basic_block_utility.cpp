@@ -39,4 +39,23 @@ bool utility::isBasicBlockEmpty(BasicBlock& basic_block, BasicBlock*& successor)
 bool utility::isBasicBlockEmpty(BasicBlock& basic_block) {
     BasicBlock* dummy = nullptr;
     return isBasicBlockEmpty(basic_block, dummy);
-}
\ No newline at end of file
+}
+
+bool utility::isForwardingBasicBlock(BasicBlock& basic_block, BasicBlock*& successor) {
+    /* Single unconditional branch, no PHI nodes */
+    if (basic_block.size() != 1) {
+        return false;
+    }
+
+    auto* branch = dyn_cast<BranchInst>(basic_block.getTerminator());
+
+    if ((branch == nullptr)
+            || branch->isConditional()
+            || (branch->getSuccessor(0) == &basic_block))
+    {
+        return false;
+    }
+
+    successor = branch->getSuccessor(0);
+    return true;
+}
@@ -12,6 +12,8 @@ bool isBasicBlockEmpty(BasicBlock& basic_block, BasicBlock*& successor);
 
 bool isBasicBlockEmpty(BasicBlock& basic_block);
 
+bool isForwardingBasicBlock(BasicBlock& basic_block, BasicBlock*& successor);
+
         } /* namespace utility */
     } /* namespace bphls */
 } /* namespace llvm */
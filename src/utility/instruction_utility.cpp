@@ -1,6 +1,10 @@
+#include <algorithm>
+
 #include <llvm/IR/Value.h>
 #include <llvm/IR/Instruction.h>
 #include <llvm/IR/Instructions.h>
+#include <llvm/IR/Constants.h>
+#include <llvm/IR/Metadata.h>
 
 #include "instruction_utility.hpp"
 
@@ -42,4 +46,64 @@ Value* utility::getPointerOperand(Instruction& instr) {
     }
 
     return nullptr;
-}
\ No newline at end of file
+}
+
+static const char* BITWIDTH_METADATA = "bphls.width";
+
+unsigned int utility::getBitwidth(Value* val) {
+    if (auto* const_int = dyn_cast<ConstantInt>(val)) {
+        return std::max(1U, const_int->getValue().getActiveBits());
+    }
+
+    if (auto* instr = dyn_cast<Instruction>(val)) {
+        if (auto* node = instr->getMetadata(BITWIDTH_METADATA)) {
+            auto* width = mdconst::extract<ConstantInt>(node->getOperand(0));
+            return static_cast<unsigned int>(width->getZExtValue());
+        }
+    }
+
+    return val->getType()->getPrimitiveSizeInBits();
+}
+
+void utility::setBitwidth(Instruction& instr, unsigned int width) {
+    auto& context = instr.getContext();
+
+    auto* width_md =
+        ConstantAsMetadata::get(ConstantInt::get(Type::getInt32Ty(context), width));
+
+    instr.setMetadata(BITWIDTH_METADATA, MDNode::get(context, width_md));
+}
+
+unsigned int utility::getFuBitwidth(Instruction& instr) {
+    unsigned int width = 0;
+
+    for (auto& operand : instr.operands()) {
+        width = std::max(width, getBitwidth(operand));
+    }
+
+    if (!isa<CmpInst>(instr)) {
+        width = std::max(width, getBitwidth(&instr));
+    }
+
+    /* Functional units are never wider than the operation type. The DAG
+     * replaces extended operands by their sources, so operands tell the
+     * type only of comparisons and stores, which have no result of it */
+    unsigned int type_width = 0;
+
+    if (isa<CmpInst>(instr) || instr.getType()->isVoidTy()) {
+        for (auto& operand : instr.operands()) {
+            type_width = std::max<unsigned int>(
+                type_width, operand->getType()->getPrimitiveSizeInBits()
+            );
+        }
+    } else {
+        type_width = instr.getType()->getPrimitiveSizeInBits();
+    }
+
+    unsigned int fu_width = 8;
+    while (fu_width < width) {
+        fu_width *= 2;
+    }
+
+    return std::min(fu_width, type_width);
+}
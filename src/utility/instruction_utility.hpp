@@ -2,6 +2,7 @@
 #define __UTILITY_INSTRUCTION_UTILITY_HPP__
 
 #include <llvm/IR/Value.h>
+#include <llvm/IR/Instruction.h>
 
 namespace llvm {
     namespace bphls {
@@ -11,6 +12,14 @@ bool isDummyCall(Instruction& instr);
 
 Value* getPointerOperand(Instruction& instr);
 
+/** Minimal bitwidth of value, narrowed by bitwidth analysis */
+unsigned int getBitwidth(Value* val);
+
+void setBitwidth(Instruction& instr, unsigned int width);
+
+/** Bitwidth of functional unit class (8/16/32/64) executing instruction */
+unsigned int getFuBitwidth(Instruction& instr);
+
         } /* namespace utility */
     } /* namespace bphls */
 } /* namespace llvm */
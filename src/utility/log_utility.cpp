@@ -0,0 +1,21 @@
+#include <llvm/Support/CommandLine.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include "log_utility.hpp"
+
+using namespace llvm;
+using namespace bphls;
+
+static cl::opt<bool> verbose(
+    "verbose",
+    cl::desc("Print progress and diagnostic messages of every phase"),
+    cl::init(false)
+);
+
+bool utility::isVerbose() {
+    return verbose;
+}
+
+raw_ostream& utility::logs() {
+    return verbose ? outs() : nulls();
+}
@@ -0,0 +1,20 @@
+#ifndef __UTILITY_LOG_UTILITY_HPP__
+#define __UTILITY_LOG_UTILITY_HPP__
+
+#include <llvm/Support/raw_ostream.h>
+
+namespace llvm {
+    namespace bphls {
+        namespace utility {
+
+/** Progress and diagnostic chatter is printed only with -verbose */
+bool isVerbose();
+
+/** Standard output with -verbose, a null stream otherwise */
+raw_ostream& logs();
+
+        } /* namespace utility */
+    } /* namespace bphls */
+} /* namespace llvm */
+
+#endif /* __UTILITY_LOG_UTILITY_HPP__ */
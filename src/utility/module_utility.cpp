@@ -0,0 +1,163 @@
+#include <string>
+#include <vector>
+
+#include <llvm/ADT/SmallPtrSet.h>
+#include <llvm/ADT/SmallVector.h>
+#include <llvm/IR/Constants.h>
+#include <llvm/IR/Function.h>
+#include <llvm/IR/InstIterator.h>
+#include <llvm/IRReader/IRReader.h>
+#include <llvm/Support/CommandLine.h>
+#include <llvm/Support/Error.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/raw_ostream.h>
+#include <llvm/Transforms/Utils/Cloning.h>
+
+#include "log_utility.hpp"
+#include "module_utility.hpp"
+
+using namespace llvm;
+using namespace bphls;
+
+static cl::opt<bool> input_mmap(
+    "input-mmap",
+    cl::desc("Read input modules through memory-mapped buffers"),
+    cl::init(true)
+);
+
+std::unique_ptr<Module> utility::loadModule(const std::string& ir_file,
+                                            SMDiagnostic& err,
+                                            LLVMContext& context)
+{
+    /* Volatile files are read into memory instead of being mapped */
+    auto file_buffer = MemoryBuffer::getFile(ir_file, false, false, !input_mmap);
+
+    if (!file_buffer) {
+        err = SMDiagnostic(ir_file, SourceMgr::DK_Error,
+                           "Could not open input file: " + file_buffer.getError().message());
+        return nullptr;
+    }
+
+    /* Bitcode keeps the buffer, function bodies are read from it on demand */
+    return getLazyIRModule(std::move(file_buffer.get()), err, context);
+}
+
+/* Globals referenced by the instructions, through constant expressions and
+ * initializers of the referenced variables too */
+static void collectReferencedGlobals(Function& function, SmallVectorImpl<GlobalValue*>& globals) {
+    SmallVector<Constant*, 8> constants;
+    SmallPtrSet<Constant*, 8> visited_constants;
+
+    for (auto& instr : instructions(function)) {
+        for (auto& operand : instr.operands()) {
+            if (auto* constant = dyn_cast<Constant>(operand)) {
+                constants.push_back(constant);
+            }
+        }
+    }
+
+    while (!constants.empty()) {
+        auto* constant = constants.pop_back_val();
+
+        if (!visited_constants.insert(constant).second) {
+            continue;
+        }
+
+        if (auto* referenced = dyn_cast<GlobalValue>(constant)) {
+            globals.push_back(referenced);
+
+            auto* variable = dyn_cast<GlobalVariable>(referenced);
+
+            if ((variable != nullptr) && variable->hasInitializer()) {
+                constants.push_back(variable->getInitializer());
+            }
+
+            continue;
+        }
+
+        for (auto& operand : constant->operands()) {
+            if (auto* operand_constant = dyn_cast<Constant>(operand)) {
+                constants.push_back(operand_constant);
+            }
+        }
+    }
+}
+
+bool utility::materializeFunctions(Module& module, const std::vector<std::string>& function_names) {
+    SmallVector<Function*, 8> worklist;
+    SmallPtrSet<Function*, 8> visited;
+
+    for (auto& function_name : function_names) {
+        if (auto* function = module.getFunction(function_name)) {
+            worklist.push_back(function);
+        }
+    }
+
+    unsigned int n_materialized = 0;
+
+    while (!worklist.empty()) {
+        auto* function = worklist.pop_back_val();
+
+        if (!visited.insert(function).second) {
+            continue;
+        }
+
+        if (function->isMaterializable()) {
+            if (auto error = function->materialize()) {
+                errs() << "Cannot materialize function '" << function->getName() << "': "
+                    << toString(std::move(error)) << "\n";
+                return false;
+            }
+
+            n_materialized++;
+        }
+
+        SmallVector<GlobalValue*, 8> referenced;
+        collectReferencedGlobals(*function, referenced);
+
+        for (auto* global : referenced) {
+            if (auto* referenced_function = dyn_cast<Function>(global)) {
+                worklist.push_back(referenced_function);
+            }
+        }
+    }
+
+    unsigned int n_dropped = 0;
+
+    for (auto& function : module) {
+        if (function.isMaterializable()) {
+            function.deleteBody();
+            n_dropped++;
+        }
+    }
+
+    if ((n_materialized > 0) || (n_dropped > 0)) {
+        logs() << "Materialized " << n_materialized << " functions of module '"
+            << module.getModuleIdentifier() << "', " << n_dropped << " left unread\n";
+    }
+
+    return true;
+}
+
+std::unique_ptr<Module> utility::cloneFunctionModule(Function& function) {
+    SmallVector<GlobalValue*, 8> worklist = { &function };
+    SmallPtrSet<const GlobalValue*, 8> cloned;
+
+    while (!worklist.empty()) {
+        auto* global = worklist.pop_back_val();
+
+        if (!cloned.insert(global).second) {
+            continue;
+        }
+
+        if (auto* referenced_function = dyn_cast<Function>(global)) {
+            collectReferencedGlobals(*referenced_function, worklist);
+        }
+    }
+
+    ValueToValueMapTy value_map;
+
+    return CloneModule(*function.getParent(), value_map, [&](const GlobalValue* global) {
+        return cloned.count(global) != 0;
+    });
+}
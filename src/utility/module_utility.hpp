@@ -0,0 +1,43 @@
+#ifndef __UTILITY_MODULE_UTILITY_HPP__
+#define __UTILITY_MODULE_UTILITY_HPP__
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include <llvm/Support/SourceMgr.h>
+
+namespace llvm {
+    namespace bphls {
+        namespace utility {
+
+/**
+ * Reads an IR module. Bitcode is loaded lazily, function bodies stay in
+ * the file until materializeFunctions(). Textual IR is parsed in full.
+ * Null on errors, described by err.
+ */
+std::unique_ptr<Module> loadModule(const std::string& ir_file,
+                                   SMDiagnostic& err,
+                                   LLVMContext& context);
+
+/**
+ * Materializes the named functions and the functions they reference,
+ * transitively. Bodies of the other lazily loaded functions are dropped,
+ * they become declarations.
+ */
+bool materializeFunctions(Module& module, const std::vector<std::string>& function_names);
+
+/**
+ * Copies the function and the globals it references, transitively, into a
+ * new module of the same context. Other globals are declared only, so the
+ * copy does not depend on the bodies of unrelated functions.
+ */
+std::unique_ptr<Module> cloneFunctionModule(Function& function);
+
+        } /* namespace utility */
+    } /* namespace bphls */
+} /* namespace llvm */
+
+#endif /* __UTILITY_MODULE_UTILITY_HPP__ */
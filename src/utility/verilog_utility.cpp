@@ -7,22 +7,46 @@
 #include <llvm/IR/Function.h>
 #include <llvm/IR/BasicBlock.h>
 #include <llvm/IR/Instruction.h>
+#include <llvm/IR/InstIterator.h>
 
 #include "../rtl/RtlSignal.hpp"
 #include "../rtl/RtlOperation.hpp"
+#include "instruction_utility.hpp"
 #include "verilog_utility.hpp"
 
 using namespace llvm;
 using namespace bphls;
 
-std::string utility::getVerilogName(Value* val) {
-    static unsigned int var_count = 0;
+/* Position of an unnamed value in its function, the same whatever was synthesized before */
+static unsigned int getValueIndex(Value* val) {
+    if (auto* arg = dyn_cast<Argument>(val)) {
+        return arg->getArgNo();
+    }
+
+    auto* instr = dyn_cast<Instruction>(val);
+
+    if ((instr == nullptr) || (instr->getParent() == nullptr)) {
+        return 0;
+    }
+
+    unsigned int index = 0;
+
+    for (auto& function_instr : instructions(*instr->getFunction())) {
+        if (&function_instr == instr) {
+            break;
+        }
+
+        index++;
+    }
 
+    return index;
+}
+
+std::string utility::getVerilogName(Value* val) {
     auto name = getLabel(val);
 
     if (name.empty()) {
-        name = "var_" + std::to_string(var_count);
-        var_count++; 
+        name = "var_" + std::to_string(getValueIndex(val));
     }
     
     if (isa<Instruction>(val)) {
@@ -58,14 +82,14 @@ std::string utility::getFuInstVerilogName(Instruction* instr, unsigned int idx)
     auto basic_block_label = getLabel(basic_block);
     auto function_label = basic_block->getParent()->getName().str();
     auto opcode_name = instr->getOpcodeName();
-    auto op_0_w = std::to_string(instr->getOperand(0)->getType()->getPrimitiveSizeInBits());
+    auto op_0_w = std::to_string(getFuBitwidth(*instr));
 
     auto name =
         function_label + "_" + basic_block_label
             + "_" + opcode_name + "_" + op_0_w;
 
     if (instr->isBinaryOp()) {
-        auto op_1_w = std::to_string(instr->getOperand(1)->getType()->getPrimitiveSizeInBits());
+        auto op_1_w = op_0_w;
         name += "_" + op_1_w;
     }
 
@@ -79,6 +103,22 @@ std::string utility::getFuInstVerilogName(Instruction* instr, unsigned int idx)
     return name;
 }
 
+std::string utility::getPipelineVerilogName(BasicBlock* basic_block) {
+    assert(basic_block != nullptr);
+
+    auto basic_block_label = getLabel(basic_block);
+    auto function_label = basic_block->getParent()->getName().str();
+
+    auto name = function_label + "_" + basic_block_label + "_pipeline";
+
+    static std::string forbidden_chars = "%/.@#'`";
+    for (char c : forbidden_chars) {
+        name.erase (std::remove(name.begin(), name.end(), c), name.end());
+    }
+
+    return name;
+}
+
 std::string utility::getBpRegVarilogName(binding::BitpackRegBinding::Reg& reg) {
     std::string name = "bp_reg_" + std::to_string(reg.id);
     return name;
@@ -104,7 +144,7 @@ std::string utility::getLabel(Value* val) {
     return label_buffer;
 }
 
-bool utility::isNumeric(std::string val_string) {
+bool utility::isNumeric(const std::string& val_string) {
     if (val_string.empty()) {
         return false;
     }
@@ -18,11 +18,13 @@ std::string getVerilogName(Value* val);
 
 std::string getFuInstVerilogName(Instruction* instr, unsigned int idx);
 
+std::string getPipelineVerilogName(BasicBlock* basic_block);
+
 std::string getBpRegVarilogName(binding::BitpackRegBinding::Reg& reg);
 
 std::string getLabel(Value* val);
 
-bool isNumeric(std::string val_string);
+bool isNumeric(const std::string& val_string);
 
 void getConditionStateName(rtl::RtlSignal* condition, std::string& name);
 
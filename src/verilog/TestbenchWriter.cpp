@@ -0,0 +1,314 @@
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <llvm/Support/raw_ostream.h>
+
+#include "TestbenchWriter.hpp"
+
+using namespace llvm;
+using namespace bphls;
+
+/* Cycles a call may take, relative to the longest simulated one */
+static const unsigned int TIMEOUT_FACTOR = 2;
+static const unsigned int TIMEOUT_MARGIN = 16;
+
+static const unsigned int MAX_REPORTED_ERRORS = 10;
+
+static const char* HEX_DIGITS = "0123456789abcdef";
+
+bool verilog::TestbenchWriter::print() {
+    findPorts();
+
+    n_finished = 0;
+    max_latency = 0;
+
+    for (unsigned int i = 0; i < vectors.size(); i++) {
+        auto& outcome = vectors.getOutcome(i);
+
+        /* Undefined results of the golden model are not checked */
+        if (outcome.is_finished && outcome.is_defined) {
+            n_finished++;
+            max_latency = std::max(max_latency, outcome.latency);
+        }
+    }
+
+    if (n_finished == 0) {
+        errs() << "No test vector of module '" << rtl_module.getName()
+            << "' finished with a defined result, the testbench is not written\n";
+        return false;
+    }
+
+    printVectors();
+
+    out << "`timescale 1us/100ns\n\n";
+
+    out << "/*\n";
+    out << " * Self-checking testbench of module " << rtl_module.getName() << ".\n";
+    out << " * Every line of " << vector_file << " holds the arguments and the expected\n";
+    out << " * return value of a call.\n";
+    out << " */\n";
+    out << "module " << rtl_module.getName() << "_testbench;\n\n";
+
+    printDeclarations();
+
+    printInstance();
+
+    printStimulus();
+
+    out << "endmodule\n";
+
+    return true;
+}
+
+void verilog::TestbenchWriter::findPorts() {
+    static const char* CONTROL_PORTS[] = { "clk", "reset", "start" };
+
+    arg_ports.clear();
+    return_port = rtl_module.find("return_val");
+
+    for (auto* port : rtl_module.iter_ports()) {
+        if (!rtl_module.isSignalInput(port)) {
+            continue;
+        }
+
+        auto& name = port->getName();
+
+        if (std::none_of(std::begin(CONTROL_PORTS), std::end(CONTROL_PORTS),
+                         [&name](const char* control_port) { return name == control_port; }))
+        {
+            arg_ports.push_back(port);
+        }
+    }
+
+    fields = arg_ports;
+
+    if (return_port != nullptr) {
+        fields.push_back(return_port);
+    }
+}
+
+void verilog::TestbenchWriter::printVectors() {
+    unsigned int vector_width = 0;
+
+    vectors_out << "// " << rtl_module.getName() << ": " << n_finished << " vectors of {";
+
+    for (unsigned int k = 0; k < fields.size(); k++) {
+        unsigned int width = fields[k]->getWidth().getBitwidth();
+        vector_width += width;
+
+        vectors_out << ((k == 0) ? "" : ", ") << fields[k]->getName().value_or("arg")
+            << "[" << (width - 1) << ":0]";
+    }
+
+    vectors_out << "}\n";
+
+    /* Bits of a line, least significant first */
+    std::vector<bool> bits(std::max(vector_width, 1U));
+
+    for (unsigned int i = 0; i < vectors.size(); i++) {
+        auto& outcome = vectors.getOutcome(i);
+
+        if (!outcome.is_finished || !outcome.is_defined) {
+            continue;
+        }
+
+        unsigned int offset = vector_width;
+
+        for (unsigned int k = 0; k < fields.size(); k++) {
+            unsigned int width = fields[k]->getWidth().getBitwidth();
+            uint64_t value = (fields[k] == return_port) ? outcome.expected : vectors.getArg(i, k);
+
+            offset -= width;
+
+            for (unsigned int bit = 0; bit < width; bit++) {
+                bits[offset + bit] = (bit < 64) && ((value >> bit) & 1);
+            }
+        }
+
+        for (unsigned int digit = (bits.size() + 3) / 4; digit-- > 0; ) {
+            unsigned int nibble = 0;
+
+            for (unsigned int bit = 0; bit < 4; bit++) {
+                unsigned int position = digit * 4 + bit;
+
+                if ((position < bits.size()) && bits[position]) {
+                    nibble |= 1 << bit;
+                }
+            }
+
+            vectors_out << HEX_DIGITS[nibble];
+        }
+
+        vectors_out << "\n";
+    }
+}
+
+void verilog::TestbenchWriter::printDeclarations() {
+    unsigned int vector_width = 0;
+
+    for (auto* field : fields) {
+        vector_width += field->getWidth().getBitwidth();
+    }
+
+    out << "    parameter VECTOR_FILE = \"" << vector_file << "\";\n\n";
+
+    out << "    localparam N_VECTORS = " << n_finished << ";\n";
+    out << "    localparam VECTOR_WIDTH = " << std::max(vector_width, 1U) << ";\n";
+    out << "    localparam MAX_CYCLES = " << (max_latency * TIMEOUT_FACTOR + TIMEOUT_MARGIN) << ";\n";
+    out << "    localparam MAX_REPORTED_ERRORS = " << MAX_REPORTED_ERRORS << ";\n\n";
+
+    out << "    reg clk;\n";
+    out << "    reg reset;\n\n";
+
+    out << "    reg start;\n";
+    out << "    wire finish;\n\n";
+
+    for (auto* port : arg_ports) {
+        printDeclaration("reg", port->getName().value(), port->getWidth().getBitwidth());
+    }
+
+    if (return_port != nullptr) {
+        printDeclaration("wire", "return_val", return_port->getWidth().getBitwidth());
+        printDeclaration("reg", "expected", return_port->getWidth().getBitwidth());
+    }
+
+    out << "\n";
+    out << "    reg [VECTOR_WIDTH-1:0] vectors [0:N_VECTORS-1];\n\n";
+
+    out << "    integer i;\n";
+    out << "    integer cycles;\n";
+    out << "    integer min_cycles;\n";
+    out << "    integer max_cycles;\n";
+    out << "    integer total_cycles;\n";
+    out << "    integer n_finished;\n";
+    out << "    integer n_errors;\n\n";
+}
+
+void verilog::TestbenchWriter::printInstance() {
+    out << "    " << rtl_module.getName() << " " << rtl_module.getName() << "_dut (\n";
+    out << "        .clk(clk),\n";
+    out << "        .reset(reset),\n\n";
+
+    out << "        .start(start),\n";
+    out << "        .finish(finish)";
+
+    for (unsigned int k = 0; k < arg_ports.size(); k++) {
+        auto& name = arg_ports[k]->getName().value();
+        out << ((k == 0) ? ",\n\n" : ",\n") << "        ." << name << "(" << name << ")";
+    }
+
+    if (return_port != nullptr) {
+        out << ",\n\n        .return_val(return_val)";
+    }
+
+    out << "\n    );\n\n";
+
+    out << "    always #10 clk = !clk;\n\n";
+
+    /* Inputs change after the edge, the module samples them on the next one */
+    out << "    task clock_cycle;\n";
+    out << "        begin\n";
+    out << "            @(posedge clk);\n";
+    out << "            #1;\n";
+    out << "        end\n";
+    out << "    endtask\n\n";
+}
+
+void verilog::TestbenchWriter::printStimulus() {
+    out << "    initial begin\n";
+    out << "        $readmemh(VECTOR_FILE, vectors);\n\n";
+
+    out << "        clk = 1'b0;\n";
+    out << "        reset = 1'b0;\n";
+    out << "        start = 1'b0;\n\n";
+
+    out << "        min_cycles = MAX_CYCLES;\n";
+    out << "        max_cycles = 0;\n";
+    out << "        total_cycles = 0;\n";
+    out << "        n_finished = 0;\n";
+    out << "        n_errors = 0;\n\n";
+
+    out << "        for (i = 0; i < N_VECTORS; i = i + 1) begin\n";
+    out << "            reset = 1'b1;\n";
+    out << "            clock_cycle;\n";
+    out << "            reset = 1'b0;\n\n";
+
+    if (!fields.empty()) {
+        out << "            {";
+
+        for (unsigned int k = 0; k < fields.size(); k++) {
+            out << ((k == 0) ? "" : ", ")
+                << ((fields[k] == return_port) ? std::string("expected") : fields[k]->getName().value());
+        }
+
+        out << "} = vectors[i];\n";
+    }
+
+    out << "            start = 1'b1;\n";
+    out << "            clock_cycle;\n";
+    out << "            start = 1'b0;\n\n";
+
+    /* Same latency as the simulation, the start edge is the first cycle */
+    out << "            cycles = 1;\n\n";
+
+    out << "            while (!finish && (cycles <= MAX_CYCLES)) begin\n";
+    out << "                clock_cycle;\n";
+    out << "                cycles = cycles + 1;\n";
+    out << "            end\n\n";
+
+    out << "            if (!finish) begin\n";
+    out << "                n_errors = n_errors + 1;\n\n";
+    out << "                if (n_errors <= MAX_REPORTED_ERRORS) begin\n";
+    out << "                    $display(\"vector %0d: no finish in %0d cycles\", i, MAX_CYCLES);\n";
+    out << "                end\n";
+    out << "            end else begin\n";
+    out << "                n_finished = n_finished + 1;\n";
+    out << "                total_cycles = total_cycles + cycles;\n\n";
+    out << "                if (cycles < min_cycles) begin\n";
+    out << "                    min_cycles = cycles;\n";
+    out << "                end\n\n";
+    out << "                if (cycles > max_cycles) begin\n";
+    out << "                    max_cycles = cycles;\n";
+    out << "                end\n";
+
+    if (return_port != nullptr) {
+        out << "\n";
+        out << "                if (return_val !== expected) begin\n";
+        out << "                    n_errors = n_errors + 1;\n\n";
+        out << "                    if (n_errors <= MAX_REPORTED_ERRORS) begin\n";
+        out << "                        $display(\"vector %0d: expected %0d, got %0d\", i, expected, return_val);\n";
+        out << "                    end\n";
+        out << "                end\n";
+    }
+
+    out << "            end\n";
+    out << "        end\n\n";
+
+    out << "        if (n_finished > 0) begin\n";
+    out << "            $display(\"Latency: min %0d avg %0.2f max %0d cycles\",\n";
+    out << "                     min_cycles, $itor(total_cycles) / n_finished, max_cycles);\n";
+    out << "        end\n\n";
+
+    out << "        if (n_errors == 0) begin\n";
+    out << "            $display(\"PASSED: %0d vectors\", N_VECTORS);\n";
+    out << "        end else begin\n";
+    out << "            $display(\"FAILED: %0d errors in %0d vectors\", n_errors, N_VECTORS);\n";
+    out << "        end\n\n";
+
+    out << "        $finish;\n";
+    out << "    end\n\n";
+}
+
+void verilog::TestbenchWriter::printDeclaration(const char* type,
+                                                const std::string& name,
+                                                unsigned int width)
+{
+    out << "    " << type << " ";
+
+    if (width > 1) {
+        out << "[" << (width - 1) << ":0] ";
+    }
+
+    out << name << ";\n";
+}
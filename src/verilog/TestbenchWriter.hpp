@@ -0,0 +1,78 @@
+#ifndef __VERILOG_TESTBENCH_WRITER_HPP__
+#define __VERILOG_TESTBENCH_WRITER_HPP__
+
+#include <string>
+#include <vector>
+
+#include <llvm/Support/raw_ostream.h>
+
+#include "../rtl/RtlSignal.hpp"
+#include "../rtl/RtlModule.hpp"
+#include "../sim/TestVectors.hpp"
+
+namespace llvm {
+    namespace bphls {
+        namespace verilog {
+
+/**
+ * Prints a self-checking Verilog testbench of an RTL module and the test
+ * vectors it streams in with $readmemh. Every line of the vector file is
+ * the hexadecimal concatenation of the arguments and the expected return
+ * value of one call. The testbench resets and starts the module for every
+ * vector, checks the return value when finish rises and reports the
+ * min/avg/max latency from the start edge to finish.
+ *
+ * Only the finished vectors are printed, their outcomes must be filled in
+ * by the simulation.
+ */
+class TestbenchWriter {
+public:
+    TestbenchWriter(raw_ostream& out,
+                    raw_ostream& vectors_out,
+                    const std::string& vector_file,
+                    rtl::RtlModule& rtl_module,
+                    sim::TestVectors& vectors)
+        : out(out),
+          vectors_out(vectors_out),
+          vector_file(vector_file),
+          rtl_module(rtl_module),
+          vectors(vectors) {}
+
+    /** False if no vector finished */
+    bool print();
+
+private:
+    raw_ostream& out;
+    raw_ostream& vectors_out;
+    std::string vector_file;
+    rtl::RtlModule& rtl_module;
+    sim::TestVectors& vectors;
+
+    /* Input ports of the function arguments, in order */
+    std::vector<rtl::RtlSignal*> arg_ports;
+    rtl::RtlSignal* return_port;
+
+    unsigned int n_finished;
+    unsigned int max_latency;
+
+    /* Fields of a vector line, most significant first */
+    std::vector<rtl::RtlSignal*> fields;
+
+    void findPorts();
+
+    void printVectors();
+
+    void printDeclarations();
+
+    void printInstance();
+
+    void printStimulus();
+
+    void printDeclaration(const char* type, const std::string& name, unsigned int width);
+};
+
+        } /* namespace verilog */
+    } /* namespace bphls */
+} /* namespace llvm */
+
+#endif /* __VERILOG_TESTBENCH_WRITER_HPP__ */
@@ -1,6 +1,12 @@
 #include <iostream>
+#include <algorithm>
+#include <functional>
 #include <map>
+#include <set>
 
+#include <llvm/Support/CommandLine.h>
+#include <llvm/Support/ThreadPool.h>
+#include <llvm/Support/Threading.h>
 #include <llvm/Support/raw_ostream.h>
 
 #include "../utility/verilog_utility.hpp"
@@ -9,14 +15,160 @@
 using namespace llvm;
 using namespace bphls;
 
+static cl::opt<bool> verilog_parallel(
+    "verilog-parallel",
+    cl::desc("Render Verilog sections of a module concurrently"),
+    cl::init(false)
+);
+
+/* Fallback names are printed in place instead of copying optionals */
+static const std::string UNKNOWN_NAME = "unknown";
+
+static const std::string& getNameOr(std::optional<std::string>& name,
+                                    const std::string& fallback)
+{
+    return name.has_value() ? name.value() : fallback;
+}
+
+static bool isFsmStateSignal(rtl::RtlSignal* signal) {
+    return signal->getName() == "cur_state";
+}
+
 void verilog::VerilogWriter::print() {
-    printHeader();
+    if (verilog_parallel) {
+        printSections();
+    } else {
+        printPrimitives();
 
-    printBody();
+        printHeader();
+
+        printBody();
+    }
 
     printFooter();
 }
 
+void verilog::VerilogWriter::printSections() {
+    auto signals_begin = rtl_module.iter_signals().begin();
+    auto signals_end = rtl_module.iter_signals().end();
+    auto fsm_iter = std::find_if(signals_begin, signals_end, isFsmStateSignal);
+
+    /* Split around the FSM, so concatenation keeps the sequential order */
+    std::vector<std::function<void(VerilogWriter&)>> sections = {
+        [](VerilogWriter& writer) {
+            writer.printPrimitives();
+            writer.printHeader();
+        },
+        [=](VerilogWriter& writer) {
+            writer.printSignalDefinitions(signals_begin, fsm_iter);
+        },
+        [=](VerilogWriter& writer) {
+            if (fsm_iter != signals_end) {
+                writer.printSignalDefinitions(fsm_iter, fsm_iter + 1);
+            }
+        },
+        [=](VerilogWriter& writer) {
+            if (fsm_iter != signals_end) {
+                writer.printSignalDefinitions(fsm_iter + 1, signals_end);
+            }
+
+            for (auto* signal : writer.rtl_module.iter_ports()) {
+                writer.printSignalDefinition(signal);
+            }
+
+            for (auto* instance : writer.rtl_module.iter_instances()) {
+                writer.printInstance(instance);
+            }
+        }
+    };
+
+    /* Section buffers are allocated on the workers, -heap-report misses them */
+    std::vector<std::string> section_buffers(sections.size());
+
+    {
+        ThreadPool pool(hardware_concurrency(sections.size()));
+
+        for (unsigned int i = 0; i < sections.size(); i++) {
+            pool.async([this, &sections, &section_buffers, i]() {
+                raw_string_ostream section_out(section_buffers[i]);
+                VerilogWriter section_writer(section_out, rtl_module);
+
+                sections[i](section_writer);
+                section_out.flush();
+            });
+        }
+
+        pool.wait();
+    }
+
+    for (auto& section_buffer : section_buffers) {
+        out << section_buffer;
+    }
+}
+
+void verilog::VerilogWriter::printPrimitives() {
+    std::set<std::string> printed;
+
+    for (auto* instance : rtl_module.iter_instances()) {
+        auto module_name = instance->getModuleName();
+
+        if (!instance->isPrimitive() || (printed.count(module_name) != 0)) {
+            continue;
+        }
+        printed.insert(module_name);
+
+        if (module_name == rtl::RtlInstance::FIFO_PRIMITIVE) {
+            printFifoPrimitive();
+        } else {
+            llvm_unreachable("Unknown RTL primitive");
+        }
+    }
+}
+
+void verilog::VerilogWriter::printFifoPrimitive() {
+    out << "module " << rtl::RtlInstance::FIFO_PRIMITIVE << " #(\n";
+    out << "\tparameter WIDTH = 32,\n";
+    out << "\tparameter ADDR_WIDTH = 1\n";
+    out << ")\n";
+    out << "(\n";
+    out << "\tinput wire clk,\n";
+    out << "\tinput wire reset,\n";
+    out << "\tinput wire wr_en,\n";
+    out << "\tinput wire [WIDTH-1:0] wr_data,\n";
+    out << "\toutput wire full,\n";
+    out << "\tinput wire rd_en,\n";
+    out << "\toutput wire [WIDTH-1:0] rd_data,\n";
+    out << "\toutput wire empty\n";
+    out << ");\n\n";
+
+    out << "reg [WIDTH-1:0] mem [0:(1<<ADDR_WIDTH)-1];\n";
+    out << "reg [ADDR_WIDTH:0] wr_ptr;\n";
+    out << "reg [ADDR_WIDTH:0] rd_ptr;\n\n";
+
+    /* Pointers carry an extra wrap bit to tell full from empty */
+    out << "assign empty = (wr_ptr == rd_ptr);\n";
+    out << "assign full = (wr_ptr[ADDR_WIDTH-1:0] == rd_ptr[ADDR_WIDTH-1:0])"
+           " & (wr_ptr[ADDR_WIDTH] != rd_ptr[ADDR_WIDTH]);\n";
+    out << "assign rd_data = mem[rd_ptr[ADDR_WIDTH-1:0]];\n\n";
+
+    out << "always @ (posedge clk) begin\n";
+    out << "\tif (reset == 1'b1) begin\n";
+    out << "\t\twr_ptr <= 0;\n";
+    out << "\t\trd_ptr <= 0;\n";
+    out << "\tend else begin\n";
+    out << "\t\tif ((wr_en == 1'b1) & (full == 1'b0)) begin\n";
+    out << "\t\t\tmem[wr_ptr[ADDR_WIDTH-1:0]] <= wr_data;\n";
+    out << "\t\t\twr_ptr <= wr_ptr + 1;\n";
+    out << "\t\tend\n";
+    out << "\t\tif ((rd_en == 1'b1) & (empty == 1'b0)) begin\n";
+    out << "\t\t\trd_ptr <= rd_ptr + 1;\n";
+    out << "\t\tend\n";
+    out << "\tend\n";
+    out << "end\n\n";
+
+    out << "endmodule\n\n";
+}
+
 void verilog::VerilogWriter::printHeader() {
     auto module_name = rtl_module.getName();
 
@@ -59,13 +211,67 @@ void verilog::VerilogWriter::printHeader() {
 
 void verilog::VerilogWriter::printBody() {
     /* NOTE: FSM is build during "cur_state" signal definition */
-    for (auto* signal : rtl_module.iter_signals()) {
-        printSignalDefinition(signal);
-    }
+    printSignalDefinitions(rtl_module.iter_signals().begin(),
+                           rtl_module.iter_signals().end());
 
     for (auto* signal : rtl_module.iter_ports()) {
         printSignalDefinition(signal);
     }
+
+    for (auto* instance : rtl_module.iter_instances()) {
+        printInstance(instance);
+    }
+}
+
+void verilog::VerilogWriter::printSignalDefinitions(rtl::RtlModule::RtlSignalIterator begin,
+                                                    rtl::RtlModule::RtlSignalIterator end)
+{
+    for (auto signal_iter = begin; signal_iter != end; signal_iter++) {
+        printSignalDefinition(*signal_iter);
+    }
+}
+
+void verilog::VerilogWriter::printInstance(rtl::RtlInstance* instance) {
+    out << instance->getModuleName();
+
+    auto param_iter = instance->iter_params().begin();
+    auto param_iter_end = instance->iter_params().end();
+
+    if (param_iter != param_iter_end) {
+        out << " #(\n";
+
+        for (; param_iter != param_iter_end; param_iter++) {
+            out << "\t." << param_iter->first << "(" << param_iter->second << ")";
+
+            if (param_iter != (param_iter_end - 1)) {
+                out << ",";
+            }
+
+            out << "\n";
+        }
+
+        out << ")";
+    }
+
+    out << " " << instance->getName() << "\n";
+    out << "(\n";
+
+    auto conn_iter = instance->iter_connections().begin();
+    auto conn_iter_end = instance->iter_connections().end();
+
+    for (; conn_iter != conn_iter_end; conn_iter++) {
+        out << "\t." << conn_iter->port << "(";
+        printValue(conn_iter->signal);
+        out << ")";
+
+        if (conn_iter != (conn_iter_end - 1)) {
+            out << ",";
+        }
+
+        out << "\n";
+    }
+
+    out << ");\n\n";
 }
 
 void verilog::VerilogWriter::printFooter() {
@@ -73,7 +279,7 @@ void verilog::VerilogWriter::printFooter() {
 }
 
 void verilog::VerilogWriter::printSignalDeclaration(rtl::RtlSignal* signal) {
-    auto type = signal->getType().value_or("unknown");
+    auto& type = getNameOr(signal->getType(), UNKNOWN_NAME);
 
     /* Type */
     if (type == "wire"
@@ -95,10 +301,10 @@ void verilog::VerilogWriter::printSignalDeclaration(rtl::RtlSignal* signal) {
     out << " ";
 
     /* Name */
-    out << signal->getName().value_or("unknown");
+    out << getNameOr(signal->getName(), UNKNOWN_NAME);
 
     /* Special case for FSM state signal */
-    if (signal->getName() == "cur_state") {
+    if (isFsmStateSignal(signal)) {
         out << ";\n";
         out << "reg ";
         printWidth(signal->getWidth());
@@ -109,7 +315,7 @@ void verilog::VerilogWriter::printSignalDeclaration(rtl::RtlSignal* signal) {
     if (signal->getValue().has_value()) {
         out << " = ";
 
-        auto value = signal->getValue().value(); 
+        auto& value = signal->getValue().value();
         if (utility::isNumeric(value)) {
             printBiwidthPrefix(signal->getWidth());
             out << "d" << value;
@@ -130,7 +336,7 @@ void verilog::VerilogWriter::printSignalDefinition(rtl::RtlSignal* signal) {
     bool is_block_assign = !is_register;
     auto width = signal->getWidth();
 
-    if (signal->getName().value_or("") == "cur_state") {
+    if (isFsmStateSignal(signal)) {
         out << "/* FSM BEGIN ---------------------------------------------------------------*/\n\n";
     }
 
@@ -160,7 +366,7 @@ void verilog::VerilogWriter::printSignalDefinition(rtl::RtlSignal* signal) {
         // }
     } else {
         /* Special case for FSM state signal */
-        if (signal->getName().value_or("") == "cur_state") {
+        if (isFsmStateSignal(signal)) {
             printFsmController(signal, is_block_assign);
         } else {
             printConditions(signal, is_block_assign);
@@ -170,16 +376,13 @@ void verilog::VerilogWriter::printSignalDefinition(rtl::RtlSignal* signal) {
 
     out << "end\n\n";
 
-    if (signal->getName().value_or("") == "cur_state") {
+    if (isFsmStateSignal(signal)) {
         out << "/* FSM END -----------------------------------------------------------------*/\n\n";
     }
 }
 
 void verilog::VerilogWriter::printFsmController(rtl::RtlSignal* signal, bool assign_block) {
-    assert(
-        signal->getName().has_value()
-            && signal->getName().value() == "cur_state"
-    );
+    assert(isFsmStateSignal(signal));
 
     std::map<std::string, std::vector<unsigned int>> fsm_cases;
 
@@ -188,6 +391,8 @@ void verilog::VerilogWriter::printFsmController(rtl::RtlSignal* signal, bool ass
 
     assert(n_conditions != 0);
 
+    std::string state_name;
+
     for (unsigned int i = 0; i < n_conditions; i++) {
         auto* driver = signal->getDriver(i);
         auto* condition = signal->getCondition(i);
@@ -195,7 +400,7 @@ void verilog::VerilogWriter::printFsmController(rtl::RtlSignal* signal, bool ass
         assert(driver != nullptr);
         assert(condition != nullptr);
 
-        std::string state_name;
+        state_name.clear();
         utility::getConditionStateName(condition, state_name);
 
         fsm_cases[state_name].push_back(i);
@@ -244,8 +449,8 @@ void verilog::VerilogWriter::printFsmController(rtl::RtlSignal* signal, bool ass
         std::vector<rtl::RtlSignal*> clauses;
 
         for (auto i : fsm_case.second) {
-            auto driver_name = signal->getDriver(i)->signal->getName().value_or("");
-            if ((driver_name == fsm_case.first)) {
+            /* Case labels are never empty, unnamed drivers do not match */
+            if (signal->getDriver(i)->signal->getName() == fsm_case.first) {
                 continue;
             }
 
@@ -265,7 +470,7 @@ void verilog::VerilogWriter::printFsmController(rtl::RtlSignal* signal, bool ass
                 auto clauses_iter_end = clauses.end();
 
                 for (; clauses_iter != clauses_iter_end; clauses_iter++) {
-                    if ((*clauses_iter)->getName().value_or("") == fsm_case.first) {
+                    if ((*clauses_iter)->getName() == fsm_case.first) {
                         continue;
                     } else {
                         printValue(*clauses_iter);
@@ -323,14 +528,14 @@ void verilog::VerilogWriter::printValue(rtl::RtlSignal* signal,
         return;
     }
 
-    if (signal->getType().value_or("") == "parameter") {
-        out << signal->getName().value_or("unknown");
+    if (signal->getType() == "parameter") {
+        out << getNameOr(signal->getName(), UNKNOWN_NAME);
         return;
     }
 
     if (!signal->getValue().has_value()) {
         // TODO Printing concatenation & minimizing biwidth
-        out << signal->getName().value_or("unknown");
+        out << getNameOr(signal->getName(), UNKNOWN_NAME);
         printWidth(width);
     } else {
         if (utility::isNumeric(signal->getValue().value())) {
@@ -532,7 +737,7 @@ void verilog::VerilogWriter::printCondition(rtl::RtlSignal* signal,
             ? assign_block_symb
             : assign_non_block_symb;
 
-    out << signal->getName().value_or("unknown");
+    out << getNameOr(signal->getName(), UNKNOWN_NAME);
     printWidth(driver->dest_bits);
     out << " " << assign << " ";
     printValue(driver->signal, driver->src_bits, false);
@@ -544,15 +749,15 @@ void verilog::VerilogWriter::printCondition(rtl::RtlSignal* signal,
 }
 
 void verilog::VerilogWriter::printWidth(rtl::RtlWidth width) {
-    if (width.getBitwidth() > 1) {
-        assert(width.getMsbIndex().has_value());
+    /* Single bits have no indices, unless they are fields of wider signals */
+    if (width.getMsbIndex().has_value()) {
         assert(width.getLsbIndex().has_value());
 
-        out << "[" << std::to_string(width.getMsbIndex().value()) << ":"
-                   << std::to_string(width.getLsbIndex().value()) << "]";
+        out << "[" << width.getMsbIndex().value() << ":"
+                   << width.getLsbIndex().value() << "]";
     }
 }
 
 void verilog::VerilogWriter::printBiwidthPrefix(rtl::RtlWidth width) {
-    out << std::to_string(width.getBitwidth()) << "'";
+    out << width.getBitwidth() << "'";
 }
@@ -5,11 +5,18 @@
 
 #include "../rtl/RtlSignal.hpp"
 #include "../rtl/RtlModule.hpp"
+#include "../rtl/RtlInstance.hpp"
 
 namespace llvm {
     namespace bphls {
         namespace verilog {
 
+/**
+ * Prints an RTL module as Verilog straight into the given stream. With
+ * -verilog-parallel the declarations, the datapath and the FSM controller
+ * are rendered concurrently into section buffers and concatenated in order,
+ * the output is identical to the sequential one.
+ */
 class VerilogWriter {
 public:
     VerilogWriter(raw_ostream& out, rtl::RtlModule& rtl_module)
@@ -22,10 +29,21 @@ private:
     raw_ostream& out;
     rtl::RtlModule& rtl_module;
 
+    void printPrimitives();
+
+    void printFifoPrimitive();
+
     void printHeader();
 
     void printBody();
 
+    void printSections();
+
+    void printSignalDefinitions(rtl::RtlModule::RtlSignalIterator begin,
+                                rtl::RtlModule::RtlSignalIterator end);
+
+    void printInstance(rtl::RtlInstance* instance);
+
     void printFooter();
 
     void printSignalDeclaration(rtl::RtlSignal* signal);